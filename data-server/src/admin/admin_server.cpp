@@ -114,6 +114,10 @@ Status AdminServer::compaction(const CompactionRequest& req, CompactionResponse*
     rocksdb::Status s;
     if (req.range_id() == 0) {
         s = db->CompactRange(rocksdb::CompactRangeOptions(), nullptr, nullptr);
+        for (const auto& cf : context_->range_server->GetAllTableColumnFamilies()) {
+            if (!s.ok()) break;
+            s = db->CompactRange(rocksdb::CompactRangeOptions(), cf.get(), nullptr, nullptr);
+        }
     } else {
         auto rng = context_->range_server->Find(req.range_id());
         if (rng == nullptr) {
@@ -124,7 +128,9 @@ Status AdminServer::compaction(const CompactionRequest& req, CompactionResponse*
         resp->set_end_key(meta.end_key());
         rocksdb::Slice begin = meta.start_key();
         rocksdb::Slice end = meta.end_key();
-        s = db->CompactRange(rocksdb::CompactRangeOptions(), &begin, &end);
+        auto cf = context_->range_server->GetTableColumnFamily(meta.table_id());
+        s = db->CompactRange(rocksdb::CompactRangeOptions(),
+                             cf ? cf.get() : db->DefaultColumnFamily(), &begin, &end);
     }
 
     if (!s.ok()) {
@@ -163,6 +169,10 @@ Status AdminServer::flushDB(const FlushDBRequest& req, FlushDBResponse* resp) {
     rocksdb::FlushOptions fops;
     fops.wait = req.wait();
     auto s = context_->rocks_db->Flush(fops);
+    for (const auto& cf : context_->range_server->GetAllTableColumnFamilies()) {
+        if (!s.ok()) break;
+        s = context_->rocks_db->Flush(fops, cf.get());
+    }
     if (!s.ok()) {
         return Status(Status::kIOError, "flush", s.ToString());
     }
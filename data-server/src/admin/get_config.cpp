@@ -52,6 +52,10 @@ static const ConfigGeterMap cfg_getters = {
         ADD_CFG_GETTER(rocksdb, level0_stop_writes_trigger),
         ADD_CFG_GETTER(rocksdb, disable_wal),
         ADD_CFG_GETTER(rocksdb, cache_index_and_filter_blocks),
+        ADD_CFG_GETTER(rocksdb, bloom_bits_per_key),
+        ADD_CFG_GETTER(rocksdb, prefix_extractor_len),
+        ADD_CFG_GETTER(rocksdb, memtable_prefix_bloom_size_ratio),
+        ADD_CFG_GETTER(rocksdb, cf_per_table),
         ADD_CFG_GETTER(rocksdb, compression),
         ADD_CFG_GETTER(rocksdb, storage_type),
         ADD_CFG_GETTER(rocksdb, min_blob_size),
@@ -60,8 +64,17 @@ static const ConfigGeterMap cfg_getters = {
         ADD_CFG_GETTER(rocksdb, blob_gc_percent),
         ADD_CFG_GETTER(rocksdb, blob_compression),
         ADD_CFG_GETTER(rocksdb, ttl),
+        ADD_CFG_GETTER_STR(rocksdb, table_ttl),
+        ADD_CFG_GETTER(rocksdb, block_cache_high_pri_ratio),
+        ADD_CFG_GETTER(rocksdb, block_cache_compressed_size),
+        ADD_CFG_GETTER(rocksdb, large_scan_rows),
+        ADD_CFG_GETTER_STR(rocksdb, low_pri_tables),
+        ADD_CFG_GETTER_STR(rocksdb, high_pri_tables),
+        ADD_CFG_GETTER(rocksdb, high_pri_block_cache_size),
         ADD_CFG_GETTER(rocksdb, enable_stats),
         ADD_CFG_GETTER(rocksdb, enable_debug_log),
+        ADD_CFG_GETTER(rocksdb, perf_sample_rate),
+        ADD_CFG_GETTER(rocksdb, ingest_snapshot),
 
         // range
         ADD_CFG_GETTER(range, recover_skip_fail),
@@ -71,6 +84,13 @@ static const ConfigGeterMap cfg_getters = {
         ADD_CFG_GETTER(range, max_size),
         ADD_CFG_GETTER(range, worker_threads),
         ADD_CFG_GETTER(range, access_mode),
+        ADD_CFG_GETTER(range, max_cursors),
+        ADD_CFG_GETTER(range, cursor_ttl_ms),
+        ADD_CFG_GETTER(range, max_snapshots),
+        ADD_CFG_GETTER(range, snapshot_ttl_ms),
+        ADD_CFG_GETTER(range, approximate_statis),
+        ADD_CFG_GETTER(range, load_split_qps),
+        ADD_CFG_GETTER(range, load_split_duration),
 
         // raft
         ADD_CFG_GETTER(raft, port),
@@ -82,10 +102,17 @@ static const ConfigGeterMap cfg_getters = {
         ADD_CFG_GETTER(raft, consensus_queue),
         ADD_CFG_GETTER(raft, apply_threads),
         ADD_CFG_GETTER(raft, apply_queue),
+        ADD_CFG_GETTER(raft, thread_balance),
+        ADD_CFG_GETTER(raft, balance_interval),
+        ADD_CFG_GETTER(raft, balance_threshold),
+        ADD_CFG_GETTER(raft, max_batch_bytes),
+        ADD_CFG_GETTER(raft, leader_async_persist),
+        ADD_CFG_GETTER(raft, persist_threads),
         ADD_CFG_GETTER(raft, transport_send_threads),
         ADD_CFG_GETTER(raft, transport_recv_threads),
         ADD_CFG_GETTER(raft, tick_interval_ms),
         ADD_CFG_GETTER(raft, max_msg_size),
+        ADD_CFG_GETTER(raft, max_inflight_bytes),
 
         // metric
         ADD_CFG_GETTER(metric, interval),
@@ -5,6 +5,8 @@
 #include <rapidjson/stringbuffer.h>
 #include <rapidjson/writer.h>
 
+#include "common/ds_config.h"
+#include "proto/gen/funcpb.pb.h"
 #include "server/version.h"
 #include "server/range_server.h"
 #include "server/run_status.h"
@@ -32,6 +34,35 @@ static vector<string> parsePath(const std::string& str) {
     return result;
 }
 
+static void writePerfStat(const storage::PerfStat& stat, JsonWriter& writer) {
+    writer.StartObject();
+    writer.Key("samples");
+    writer.Uint64(stat.samples);
+    writer.Key("block_cache_hits");
+    writer.Uint64(stat.block_cache_hits);
+    writer.Key("block_reads");
+    writer.Uint64(stat.block_reads);
+    writer.Key("block_read_bytes");
+    writer.Uint64(stat.block_read_bytes);
+    writer.Key("block_read_nanos");
+    writer.Uint64(stat.block_read_nanos);
+    writer.Key("memtable_nanos");
+    writer.Uint64(stat.memtable_nanos);
+    writer.Key("sst_nanos");
+    writer.Uint64(stat.sst_nanos);
+    writer.Key("iter_seek_nanos");
+    writer.Uint64(stat.iter_seek_nanos);
+    writer.Key("keys_skipped");
+    writer.Uint64(stat.keys_skipped);
+    writer.Key("deletes_skipped");
+    writer.Uint64(stat.deletes_skipped);
+    writer.Key("io_read_bytes");
+    writer.Uint64(stat.io_read_bytes);
+    writer.Key("io_read_nanos");
+    writer.Uint64(stat.io_read_nanos);
+    writer.EndObject();
+}
+
 static Status getServerInfo(ContextServer* ctx, const vector<string>& path, JsonWriter& writer) {
     writer.Key("version");
     writer.String(server::GetGitDescribe().c_str());
@@ -53,6 +84,66 @@ static Status getServerInfo(ContextServer* ctx, const vector<string>& path, Json
     writer.Uint64(ctx->worker->FastQueueSize());
     writer.Key("slow_queue_size");
     writer.Uint64(ctx->worker->SlowQueueSize());
+
+    monitor::ProcStats stats;
+    if (ctx->run_status->GetProcStats(&stats)) {
+        writer.Key("cpu_usage");
+        writer.Double(stats.cpu_usage);
+        writer.Key("process_cpu_usage");
+        writer.Double(stats.proc_cpu_usage);
+        writer.Key("cpu_cores");
+        writer.StartArray();
+        for (int i = 0; i < stats.cpu_count; ++i) {
+            writer.Double(stats.cpu_usages[i]);
+        }
+        writer.EndArray();
+
+        writer.Key("disks");
+        writer.StartArray();
+        for (int i = 0; i < stats.disk_count; ++i) {
+            const auto& d = stats.disks[i];
+            writer.StartObject();
+            writer.Key("name");
+            writer.String(d.name);
+            writer.Key("read_iops");
+            writer.Double(d.read_iops);
+            writer.Key("write_iops");
+            writer.Double(d.write_iops);
+            writer.Key("read_bytes_sec");
+            writer.Double(d.read_bytes_sec);
+            writer.Key("write_bytes_sec");
+            writer.Double(d.write_bytes_sec);
+            writer.Key("read_latency_ms");
+            writer.Double(d.read_latency_ms);
+            writer.Key("write_latency_ms");
+            writer.Double(d.write_latency_ms);
+            writer.Key("util");
+            writer.Double(d.util);
+            writer.EndObject();
+        }
+        writer.EndArray();
+
+        writer.Key("nics");
+        writer.StartArray();
+        for (int i = 0; i < stats.nic_count; ++i) {
+            const auto& n = stats.nics[i];
+            writer.StartObject();
+            writer.Key("name");
+            writer.String(n.name);
+            writer.Key("rx_bytes_sec");
+            writer.Double(n.rx_bytes_sec);
+            writer.Key("tx_bytes_sec");
+            writer.Double(n.tx_bytes_sec);
+            writer.Key("rx_packets_sec");
+            writer.Double(n.rx_packets_sec);
+            writer.Key("tx_packets_sec");
+            writer.Double(n.tx_packets_sec);
+            writer.Key("errors");
+            writer.Uint64(n.errors);
+            writer.EndObject();
+        }
+        writer.EndArray();
+    }
     return Status::OK();
 }
 
@@ -110,6 +201,13 @@ static Status getRangeInfo(ContextServer* ctx, const vector<string>& path, JsonW
     }
     writer.Key("submit_queue");
     writer.Uint64(rng->GetSubmitQueueSize());
+    writer.Key("snapshots");
+    writer.Uint64(rng->GetSnapshotCount());
+
+    storage::PerfStat perf;
+    rng->GetPerfStat(&perf);
+    writer.Key("perf");
+    writePerfStat(perf, writer);
 
     // table info
     writer.Key("table_id");
@@ -205,12 +303,36 @@ static Status getRocksdbInfo(ContextServer* ctx, const vector<string>& path, Jso
     return Status::OK();
 }
 
+// 按请求类型的rocksdb perf context采样统计（累计值）
+static Status getPerfInfo(ContextServer* ctx, const vector<string>& path, JsonWriter& writer) {
+    writer.Key("sample_rate");
+    writer.Int(ds_config.rocksdb_config.perf_sample_rate);
+
+    std::map<int, storage::PerfStat> stats;
+    storage::GetFuncPerfStats(&stats);
+    writer.Key("funcs");
+    writer.StartObject();
+    for (const auto& p : stats) {
+        writer.Key(funcpb::FunctionID_Name(static_cast<funcpb::FunctionID>(p.first)).c_str());
+        writePerfStat(p.second, writer);
+    }
+    writer.EndObject();
+
+    // 与节点心跳中上报的值相同
+    storage::PerfStat total;
+    storage::GetTotalPerfStats(&total);
+    writer.Key("total");
+    writePerfStat(total, writer);
+    return Status::OK();
+}
+
 static const GetInfoFunMap get_info_funcs = {
         {"", getServerInfo},
         {"server", getServerInfo},
         {"raft", getRaftInfo},
         {"range", getRangeInfo},
         {"rocksdb", getRocksdbInfo},
+        {"perf", getPerfInfo},
 };
 
 Status AdminServer::getInfo(const ds_adminpb::GetInfoRequest& req, ds_adminpb::GetInfoResponse* resp) {
@@ -3,6 +3,7 @@
 #include <fastcommon/shared_func.h>
 #include "frame/sf_logger.h"
 #include "common/ds_config.h"
+#include "server/range_server.h"
 
 namespace sharkstore {
 namespace dataserver {
@@ -21,6 +22,21 @@ static Status setLogLevel(server::ContextServer* ctx, const std::string& value)
     return Status::OK();
 }
 
+static Status setPerfSampleRate(server::ContextServer* ctx, const std::string& value) {
+    (void)ctx;
+    int rate = 0;
+    try {
+        rate = std::stoi(value);
+    } catch (std::exception &e) {
+        return Status(Status::kInvalidArgument, "rocksdb perf_sample_rate", value);
+    }
+    if (rate < 0) {
+        return Status(Status::kInvalidArgument, "rocksdb perf_sample_rate", value);
+    }
+    ds_config.rocksdb_config.perf_sample_rate = rate;
+    return Status::OK();
+}
+
 #define SET_RANGE_SIZE(opt) \
     {"range."#opt, [](server::ContextServer *ctx, const std::string& value) { \
         (void)ctx; \
@@ -34,6 +50,23 @@ static Status setLogLevel(server::ContextServer* ctx, const std::string& value)
         return Status::OK(); \
     }}
 
+// int类型的range配置，小于min_value时拒绝
+#define SET_RANGE_INT(opt, min_value) \
+    {"range."#opt, [](server::ContextServer *ctx, const std::string& value) { \
+        (void)ctx; \
+        int new_value = 0; \
+        try { \
+            new_value = std::stoi(value); \
+        } catch (std::exception &e) { \
+            return Status(Status::kInvalidArgument, "range "#opt, value); \
+        } \
+        if (new_value < (min_value)) { \
+            return Status(Status::kInvalidArgument, "range "#opt, value); \
+        } \
+        ds_config.range_config.opt = new_value; \
+        return Status::OK(); \
+    }}
+
 #define SET_ROCKSDB_OPTIONS(opt) \
     {"rocksdb."#opt, [](server::ContextServer *ctx, const std::string& value) { \
         auto db = ctx->rocks_db; \
@@ -65,8 +98,16 @@ static const ConfigSetFuncMap cfg_set_funcs = {
         SET_RANGE_SIZE(check_size),
         SET_RANGE_SIZE(split_size),
         SET_RANGE_SIZE(max_size),
+        SET_RANGE_INT(max_cursors, 0),
+        SET_RANGE_INT(cursor_ttl_ms, 1),
+        SET_RANGE_INT(max_snapshots, 0),
+        SET_RANGE_INT(snapshot_ttl_ms, 1),
+        SET_RANGE_SIZE(approximate_statis),
+        SET_RANGE_SIZE(load_split_qps),
+        SET_RANGE_SIZE(load_split_duration),
 
         // rocksdb configs
+        {"rocksdb.perf_sample_rate", setPerfSampleRate},
         SET_ROCKSDB_OPTIONS(disable_auto_compactions),
         SET_ROCKSDB_OPTIONS(write_buffer_size),
         SET_ROCKSDB_OPTIONS(max_write_buffer_number),
@@ -82,6 +123,7 @@ static const ConfigSetFuncMap cfg_set_funcs = {
         SET_ROCKSDB_OPTIONS(report_bg_io_stats),
         SET_ROCKSDB_OPTIONS(paranoid_file_checks),
         SET_ROCKSDB_OPTIONS(compression),
+        SET_ROCKSDB_OPTIONS(memtable_prefix_bloom_size_ratio),
         SET_ROCKSDB_DBOPTIONS(max_background_jobs),
         SET_ROCKSDB_DBOPTIONS(base_background_compactions),
         SET_ROCKSDB_DBOPTIONS(max_background_compactions),
@@ -96,14 +138,33 @@ static const ConfigSetFuncMap cfg_set_funcs = {
         SET_ROCKSDB_DBOPTIONS(compaction_readahead_size),
 };
 
+static const std::string kTableOptionsSection = "rocksdb.table.";
+
+// section为rocksdb.table.{table_id}时设置该表column family的rocksdb参数
+static Status setTableOptions(server::ContextServer* ctx, const ConfigKey& key,
+                              const std::string& value) {
+    uint64_t table_id = 0;
+    try {
+        table_id = std::stoull(key.section().substr(kTableOptionsSection.size()));
+    } catch (std::exception &e) {
+        return Status(Status::kInvalidArgument, "table id", key.section());
+    }
+    return ctx->range_server->SetTableOptions(table_id, {{key.name(), value}});
+}
+
 Status AdminServer::setConfig(const SetConfigRequest& req, SetConfigResponse* resp) {
     for (auto &cfg: req.configs()) {
-        auto it = cfg_set_funcs.find(cfg.key().section() + "." + cfg.key().name());
-        if (it == cfg_set_funcs.end()) {
-            return Status(Status::kNotSupported, "set config",
-                    cfg.key().section() + "." + cfg.key().name());
+        Status s;
+        if (cfg.key().section().compare(0, kTableOptionsSection.size(), kTableOptionsSection) == 0) {
+            s = setTableOptions(context_, cfg.key(), cfg.value());
+        } else {
+            auto it = cfg_set_funcs.find(cfg.key().section() + "." + cfg.key().name());
+            if (it == cfg_set_funcs.end()) {
+                return Status(Status::kNotSupported, "set config",
+                        cfg.key().section() + "." + cfg.key().name());
+            }
+            s = (it->second)(context_, cfg.value());
         }
-        auto s = (it->second)(context_, cfg.value());
         if (!s.ok()) {
             FLOG_WARN("[Admin] config %s.%s set to %s failed: %s", cfg.key().section().c_str(),
                       cfg.key().name().c_str(), cfg.value().c_str(), s.ToString().c_str());
@@ -0,0 +1,106 @@
+#include "rcu.h"
+
+#include <chrono>
+#include <thread>
+
+namespace sharkstore {
+
+RcuDomain::~RcuDomain() {
+    {
+        std::lock_guard<std::mutex> lock(retire_mu_);
+        stopped_ = true;
+    }
+    retire_cond_.notify_all();
+    if (reclaimer_.joinable()) {
+        reclaimer_.join();
+    }
+    Barrier();
+}
+
+RcuDomain::ReadGuard::ReadGuard(RcuDomain& domain) {
+    auto& slot = domain.slots_[threadSlot()];
+    counter_ = &slot.readers[domain.phase_.load() & 1];
+    counter_->fetch_add(1);
+}
+
+RcuDomain::ReadGuard::~ReadGuard() { counter_->fetch_sub(1); }
+
+int RcuDomain::threadSlot() {
+    static std::atomic<uint32_t> next = {0};
+    static thread_local int slot = static_cast<int>(next.fetch_add(1) % kSlots);
+    return slot;
+}
+
+uint64_t RcuDomain::readers(uint32_t phase) const {
+    uint64_t count = 0;
+    for (int i = 0; i < kSlots; ++i) {
+        count += slots_[i].readers[phase & 1].load();
+    }
+    return count;
+}
+
+void RcuDomain::Synchronize() {
+    std::lock_guard<std::mutex> lock(sync_mu_);
+
+    // 翻转两次：读取了旧phase但翻转后才计数的读者在第二轮被等待
+    for (int i = 0; i < 2; ++i) {
+        auto old = phase_.fetch_add(1);
+        int spins = 0;
+        while (readers(old) != 0) {
+            if (++spins < 100) {
+                std::this_thread::yield();
+            } else {
+                std::this_thread::sleep_for(std::chrono::microseconds(100));
+            }
+        }
+    }
+}
+
+void RcuDomain::Retire(std::function<void()> reclaim) {
+    {
+        std::lock_guard<std::mutex> lock(retire_mu_);
+        retired_.push_back(std::move(reclaim));
+        if (!reclaimer_.joinable() && !stopped_) {
+            reclaimer_ = std::thread(&RcuDomain::reclaimLoop, this);
+        }
+    }
+    retire_cond_.notify_one();
+}
+
+void RcuDomain::Barrier() {
+    while (reclaim()) {
+    }
+}
+
+bool RcuDomain::reclaim() {
+    std::lock_guard<std::mutex> reclaim_lock(reclaim_mu_);
+    std::vector<std::function<void()>> retired;
+    {
+        std::lock_guard<std::mutex> lock(retire_mu_);
+        retired.swap(retired_);
+    }
+    if (retired.empty()) {
+        return false;
+    }
+    // 取出的都是已替换下来的数据，等待此前进入的读者退出
+    Synchronize();
+    for (auto& f : retired) {
+        f();
+    }
+    return true;
+}
+
+void RcuDomain::reclaimLoop() {
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(retire_mu_);
+            retire_cond_.wait(lock, [this] { return stopped_ || !retired_.empty(); });
+            if (stopped_) {
+                return;
+            }
+        }
+        reclaim();
+    }
+}
+
+} /* namespace sharkstore */
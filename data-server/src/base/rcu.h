@@ -0,0 +1,75 @@
+_Pragma("once");
+
+#include <stdint.h>
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace sharkstore {
+
+// 读多写少场景下的简单RCU
+// 读者用ReadGuard进入读临界区（只有本线程所在槽的计数增减，无锁），可嵌套
+// 写者原子地发布新数据后调用Synchronize，返回时发布前进入的读者都已退出，旧数据可以回收
+// 写者不能等待时用Retire交给后台线程回收，Barrier等待已提交的回收全部完成
+// 读者在临界区内不能等待写者（包括调用Synchronize、Barrier），否则会死锁
+class RcuDomain {
+public:
+    RcuDomain() = default;
+    ~RcuDomain();
+
+    RcuDomain(const RcuDomain&) = delete;
+    RcuDomain& operator=(const RcuDomain&) = delete;
+
+    class ReadGuard {
+    public:
+        explicit ReadGuard(RcuDomain& domain);
+        ~ReadGuard();
+
+        ReadGuard(const ReadGuard&) = delete;
+        ReadGuard& operator=(const ReadGuard&) = delete;
+
+    private:
+        std::atomic<uint64_t>* counter_ = nullptr;
+    };
+
+    void Synchronize();
+
+    // 不等待读者，reclaim在当前读者都退出后由后台线程执行
+    void Retire(std::function<void()> reclaim);
+    // 返回时此前Retire的reclaim都已执行
+    void Barrier();
+
+private:
+    static const int kSlots = 64;
+
+    // 按计数奇偶两组，写者翻转后等待旧的一组归零
+    struct alignas(64) Slot {
+        std::atomic<uint64_t> readers[2];
+
+        Slot() { readers[0] = 0; readers[1] = 0; }
+    };
+
+    static int threadSlot();
+    uint64_t readers(uint32_t phase) const;
+
+    void reclaimLoop();
+    // 执行已提交的回收，没有待回收的返回false
+    bool reclaim();
+
+private:
+    Slot slots_[kSlots];
+    std::atomic<uint32_t> phase_ = {0};
+    std::mutex sync_mu_;
+
+    std::mutex retire_mu_;
+    std::condition_variable retire_cond_;
+    std::vector<std::function<void()>> retired_;
+    bool stopped_ = false;
+    std::thread reclaimer_;  // 首次Retire时启动
+    std::mutex reclaim_mu_;  // 保证Barrier返回时没有正在执行的回收
+};
+
+} /* namespace sharkstore */
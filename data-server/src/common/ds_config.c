@@ -112,6 +112,22 @@ static int load_rocksdb_config(IniContext *ini_context) {
     ds_config.rocksdb_config.cache_index_and_filter_blocks =
             (bool)iniGetIntValue(section, "cache_index_and_filter_blocks", ini_context, 0);
 
+    ds_config.rocksdb_config.bloom_bits_per_key =
+            load_integer_value_atleast(ini_context, section, "bloom_bits_per_key", 0, 0);
+    ds_config.rocksdb_config.prefix_extractor_len =
+            load_integer_value_atleast(ini_context, section, "prefix_extractor_len", 0, 0);
+    ds_config.rocksdb_config.memtable_prefix_bloom_size_ratio =
+            iniGetDoubleValue(section, "memtable_prefix_bloom_size_ratio", ini_context, 0);
+    if (ds_config.rocksdb_config.memtable_prefix_bloom_size_ratio < 0 ||
+        ds_config.rocksdb_config.memtable_prefix_bloom_size_ratio > 0.25) {
+        fprintf(stderr, "invalid rocksdb memtable_prefix_bloom_size_ratio config(%f)",
+                ds_config.rocksdb_config.memtable_prefix_bloom_size_ratio);
+        return -1;
+    }
+
+    ds_config.rocksdb_config.cf_per_table =
+            (bool)iniGetIntValue(section, "cf_per_table", ini_context, 0);
+
     ds_config.rocksdb_config.compression = load_integer_value_atleast(ini_context, section, "compression", 0, 0);
 
     ds_config.rocksdb_config.storage_type = load_integer_value_atleast(ini_context, section, "storage_type", 0, 0);
@@ -130,12 +146,56 @@ static int load_rocksdb_config(IniContext *ini_context) {
 
     ds_config.rocksdb_config.ttl = load_integer_value_atleast(ini_context, section, "ttl", 0, 0);
 
+    temp_str = iniGetStrValue(section, "table_ttl", ini_context);
+    if (temp_str != NULL) {
+        snprintf(ds_config.rocksdb_config.table_ttl, sizeof(ds_config.rocksdb_config.table_ttl), "%s", temp_str);
+    } else {
+        ds_config.rocksdb_config.table_ttl[0] = '\0';
+    }
+
+    ds_config.rocksdb_config.block_cache_high_pri_ratio =
+            iniGetDoubleValue(section, "block_cache_high_pri_ratio", ini_context, 0);
+    if (ds_config.rocksdb_config.block_cache_high_pri_ratio < 0 ||
+        ds_config.rocksdb_config.block_cache_high_pri_ratio > 1) {
+        fprintf(stderr, "invalid rocksdb block_cache_high_pri_ratio config(%f)",
+                ds_config.rocksdb_config.block_cache_high_pri_ratio);
+        return -1;
+    }
+
+    ds_config.rocksdb_config.block_cache_compressed_size =
+            load_bytes_value_ne(ini_context, section, "block_cache_compressed_size", 0);
+
+    ds_config.rocksdb_config.large_scan_rows =
+            load_integer_value_atleast(ini_context, section, "large_scan_rows", 0, 0);
+
+    temp_str = iniGetStrValue(section, "low_pri_tables", ini_context);
+    if (temp_str != NULL) {
+        snprintf(ds_config.rocksdb_config.low_pri_tables, sizeof(ds_config.rocksdb_config.low_pri_tables), "%s", temp_str);
+    } else {
+        ds_config.rocksdb_config.low_pri_tables[0] = '\0';
+    }
+
+    temp_str = iniGetStrValue(section, "high_pri_tables", ini_context);
+    if (temp_str != NULL) {
+        snprintf(ds_config.rocksdb_config.high_pri_tables, sizeof(ds_config.rocksdb_config.high_pri_tables), "%s", temp_str);
+    } else {
+        ds_config.rocksdb_config.high_pri_tables[0] = '\0';
+    }
+    ds_config.rocksdb_config.high_pri_block_cache_size =
+            load_bytes_value_ne(ini_context, section, "high_pri_block_cache_size", 256 * 1024 * 1024);
+
     ds_config.rocksdb_config.enable_stats =
             (bool)iniGetIntValue(section, "enable_stats",ini_context, 1);
 
     ds_config.rocksdb_config.enable_debug_log =
             (bool)iniGetIntValue(section, "enable_debug_log",ini_context, 0);
 
+    ds_config.rocksdb_config.perf_sample_rate =
+            load_integer_value_atleast(ini_context, section, "perf_sample_rate", 0, 0);
+
+    ds_config.rocksdb_config.ingest_snapshot =
+            (bool)iniGetIntValue(section, "ingest_snapshot", ini_context, 0);
+
     return 0;
 }
 
@@ -164,6 +224,10 @@ void print_rocksdb_config() {
               "\n\tlevel0_stop_writes_trigger: %d"
               "\n\tdisable_wal: %d"
               "\n\tcache_index_and_filter_blocks: %d"
+              "\n\tbloom_bits_per_key: %d"
+              "\n\tprefix_extractor_len: %d"
+              "\n\tmemtable_prefix_bloom_size_ratio: %f"
+              "\n\tcf_per_table: %d"
               "\n\tcompression: %d"
               "\n\tstorage_type: %d"
               "\n\tmin_blob_size: %d"
@@ -172,8 +236,17 @@ void print_rocksdb_config() {
               "\n\tblob_gc_percent: %d"
               "\n\tblob_compression: %d"
               "\n\tttl: %d"
+              "\n\ttable_ttl: %s"
+              "\n\tblock_cache_high_pri_ratio: %f"
+              "\n\tblock_cache_compressed_size: %lu"
+              "\n\tlarge_scan_rows: %d"
+              "\n\tlow_pri_tables: %s"
+              "\n\thigh_pri_tables: %s"
+              "\n\thigh_pri_block_cache_size: %lu"
               "\n\tenable_stats: %d"
               "\n\tenable_debug_log: %d"
+              "\n\tperf_sample_rate: %d"
+              "\n\tingest_snapshot: %d"
               ,
               ds_config.rocksdb_config.path,
               ds_config.rocksdb_config.block_cache_size,
@@ -198,6 +271,10 @@ void print_rocksdb_config() {
               ds_config.rocksdb_config.level0_stop_writes_trigger,
               ds_config.rocksdb_config.disable_wal,
               ds_config.rocksdb_config.cache_index_and_filter_blocks,
+              ds_config.rocksdb_config.bloom_bits_per_key,
+              ds_config.rocksdb_config.prefix_extractor_len,
+              ds_config.rocksdb_config.memtable_prefix_bloom_size_ratio,
+              ds_config.rocksdb_config.cf_per_table,
               ds_config.rocksdb_config.compression,
               ds_config.rocksdb_config.storage_type,
               ds_config.rocksdb_config.min_blob_size,
@@ -206,8 +283,17 @@ void print_rocksdb_config() {
               ds_config.rocksdb_config.blob_gc_percent,
               ds_config.rocksdb_config.blob_compression,
               ds_config.rocksdb_config.ttl,
+              ds_config.rocksdb_config.table_ttl,
+              ds_config.rocksdb_config.block_cache_high_pri_ratio,
+              ds_config.rocksdb_config.block_cache_compressed_size,
+              ds_config.rocksdb_config.large_scan_rows,
+              ds_config.rocksdb_config.low_pri_tables,
+              ds_config.rocksdb_config.high_pri_tables,
+              ds_config.rocksdb_config.high_pri_block_cache_size,
               ds_config.rocksdb_config.enable_stats,
-              ds_config.rocksdb_config.enable_debug_log
+              ds_config.rocksdb_config.enable_debug_log,
+              ds_config.rocksdb_config.perf_sample_rate,
+              ds_config.rocksdb_config.ingest_snapshot
               );
 }
 
@@ -238,6 +324,29 @@ static int load_range_config(IniContext *ini_context) {
         ds_config.range_config.access_mode = 0;
     }
 
+    ds_config.range_config.max_cursors =
+        iniGetIntValue(section, "max_cursors", ini_context, 4);
+    if (ds_config.range_config.max_cursors < 0) {
+        ds_config.range_config.max_cursors = 0;
+    }
+
+    ds_config.range_config.cursor_ttl_ms =
+        load_integer_value_atleast(ini_context, section, "cursor_ttl_ms", 10000, 1);
+
+    ds_config.range_config.max_snapshots =
+        load_integer_value_atleast(ini_context, section, "max_snapshots", 0, 0);
+
+    ds_config.range_config.snapshot_ttl_ms =
+        load_integer_value_atleast(ini_context, section, "snapshot_ttl_ms", 60000, 1);
+
+    ds_config.range_config.approximate_statis =
+        (bool)iniGetIntValue(section, "approximate_statis", ini_context, 1);
+
+    ds_config.range_config.load_split_qps =
+        load_integer_value_atleast(ini_context, section, "load_split_qps", 0, 0);
+    ds_config.range_config.load_split_duration =
+        load_integer_value_atleast(ini_context, section, "load_split_duration", 30, 1);
+
     temp_char = iniGetStrValue(section, "check_size", ini_context);
     if (temp_char == NULL) {
         temp_int = 32 * mega;
@@ -321,6 +430,24 @@ static int load_raft_config(IniContext *ini_context) {
     ds_config.raft_config.apply_queue = (size_t)load_integer_value_atleast(
             ini_context, section, "apply_queue", 100000, 100);
 
+    ds_config.raft_config.thread_balance =
+        (bool)iniGetIntValue(section, "thread_balance", ini_context, 0);
+    ds_config.raft_config.balance_interval = (size_t)load_integer_value_atleast(
+            ini_context, section, "balance_interval", 10, 1);
+    ds_config.raft_config.balance_threshold = (size_t)load_integer_value_atleast(
+            ini_context, section, "balance_threshold", 30, 1);
+    if (ds_config.raft_config.balance_threshold >= 100) {
+        ds_config.raft_config.balance_threshold = 99;
+    }
+
+    ds_config.raft_config.max_batch_bytes =
+        load_bytes_value_ne(ini_context, section, "max_batch_bytes", 0);
+
+    ds_config.raft_config.leader_async_persist =
+        (bool)iniGetIntValue(section, "leader_async_persist", ini_context, 0);
+    ds_config.raft_config.persist_threads = (size_t)load_integer_value_atleast(
+            ini_context, section, "persist_threads", 4, 1);
+
     ds_config.raft_config.transport_send_threads = (size_t)load_integer_value_atleast(
             ini_context, section, "transport_send_threads", 4, 1);
     ds_config.raft_config.transport_recv_threads = (size_t)load_integer_value_atleast(
@@ -331,6 +458,8 @@ static int load_raft_config(IniContext *ini_context) {
 
     ds_config.raft_config.max_msg_size =
         load_bytes_value_ne(ini_context, section, "max_msg_size", 1024 * 1024);
+    ds_config.raft_config.max_inflight_bytes =
+        load_bytes_value_ne(ini_context, section, "max_inflight_bytes", 0);
 
     return 0;
 }
@@ -346,10 +475,17 @@ void print_raft_config() {
               "\n\tconsensus_queue: %lu"
               "\n\tapply_threads: %lu"
               "\n\tapply_queue: %lu"
+              "\n\tthread_balance: %d"
+              "\n\tbalance_interval: %lu"
+              "\n\tbalance_threshold: %lu"
+              "\n\tmax_batch_bytes: %lu"
+              "\n\tleader_async_persist: %d"
+              "\n\tpersist_threads: %lu"
               "\n\tsend_threads: %lu"
               "\n\trecv_threads: %lu"
               "\n\ttick_interval_ms: %lu"
               "\n\tmax_msg_size: %lu"
+              "\n\tmax_inflight_bytes: %lu"
               ,
               ds_config.raft_config.port,
               ds_config.raft_config.log_path,
@@ -360,10 +496,17 @@ void print_raft_config() {
               ds_config.raft_config.consensus_queue,
               ds_config.raft_config.apply_threads,
               ds_config.raft_config.apply_queue,
+              ds_config.raft_config.thread_balance,
+              ds_config.raft_config.balance_interval,
+              ds_config.raft_config.balance_threshold,
+              ds_config.raft_config.max_batch_bytes,
+              ds_config.raft_config.leader_async_persist,
+              ds_config.raft_config.persist_threads,
               ds_config.raft_config.transport_send_threads,
               ds_config.raft_config.transport_recv_threads,
               ds_config.raft_config.tick_interval_ms,
-              ds_config.raft_config.max_msg_size
+              ds_config.raft_config.max_msg_size,
+              ds_config.raft_config.max_inflight_bytes
     );
 }
 
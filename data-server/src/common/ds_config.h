@@ -34,6 +34,10 @@ typedef struct ds_config_s {
         int level0_stop_writes_trigger;
         bool disable_wal;
         bool cache_index_and_filter_blocks;
+        int bloom_bits_per_key;
+        int prefix_extractor_len;
+        double memtable_prefix_bloom_size_ratio;
+        bool cf_per_table;
         int compression;
         int storage_type;
         int min_blob_size;
@@ -42,8 +46,17 @@ typedef struct ds_config_s {
         int blob_gc_percent;
         int blob_compression;
         int ttl;
+        char table_ttl[1024];  // 按表的TTL，table_id:seconds[,table_id:seconds...]
+        double block_cache_high_pri_ratio;  // block cache中留给index、filter的高优先级比例
+        size_t block_cache_compressed_size;  // 压缩的二级block cache，0表示不使用
+        int large_scan_rows;  // 预计超过该行数的扫描不填充block cache，0表示不限制
+        char low_pri_tables[1024];  // 扫描不填充block cache的表，逗号分隔
+        char high_pri_tables[1024];  // 使用独立block cache的延迟敏感表，逗号分隔
+        size_t high_pri_block_cache_size;  // high_pri_tables共用的独立block cache大小
         bool enable_stats;
         bool enable_debug_log;
+        int perf_sample_rate;  // 每N个读请求采样一次PerfContext，0表示关闭
+        bool ingest_snapshot;  // 应用快照时先写成sst文件再导入，不经过WAL和memtable
     } rocksdb_config;
 
     struct {
@@ -61,6 +74,13 @@ typedef struct ds_config_s {
         uint64_t max_size;
         int worker_threads;
         int access_mode; // 0 sql, 1 redis, default=0
+        int max_cursors; // 每个range缓存的分页游标数, 0表示不缓存
+        int cursor_ttl_ms; // 游标最长存活时间
+        int max_snapshots; // 每个range缓存的rocksdb快照数(select/kv scan的open_snapshot), 0表示不支持快照读
+        int snapshot_ttl_ms; // 快照最长空闲时间
+        bool approximate_statis; // 使用rocksdb估算range大小，不全量扫描
+        uint64_t load_split_qps; // 按负载分裂的每秒读写key数阈值，0表示关闭
+        uint64_t load_split_duration; // 持续超过阈值多少秒后分裂
     } range_config;
 
     struct {
@@ -73,10 +93,17 @@ typedef struct ds_config_s {
         size_t consensus_queue;
         size_t apply_threads;
         size_t apply_queue;
+        bool thread_balance;
+        size_t balance_interval;
+        size_t balance_threshold;
+        size_t max_batch_bytes;
+        bool leader_async_persist;
+        size_t persist_threads;
         size_t transport_send_threads;
         size_t transport_recv_threads;
         size_t tick_interval_ms;
         size_t max_msg_size;
+        size_t max_inflight_bytes;
     } raft_config;
 
     struct {
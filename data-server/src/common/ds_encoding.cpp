@@ -2,6 +2,10 @@
 
 #include <assert.h>
 #include <string.h>
+#include <sys/types.h>
+#if defined(__x86_64__)
+#include <immintrin.h>
+#endif
 #include <cmath>
 #include <iostream>
 
@@ -462,13 +466,75 @@ static const uint8_t kEscapedTerm = 0x01;
 static const uint8_t kEscaped00 = 0xff;
 static const uint8_t kEscapedFF = 0x00;
 
+// 查找第一个kEscape(0x00)字节的位置, 找不到返回n
+// 行主键里的varchar/binary都要经过转义编解码, 这里按16/32字节分块查找,
+// 运行时根据CPU支持的指令集选择实现
+static size_t findEscapeScalar(const char *data, size_t n) {
+    const void *p = memchr(data, kEscape, n);
+    return p == nullptr ? n : static_cast<const char *>(p) - data;
+}
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+__attribute__((target("sse4.2")))
+static size_t findEscapeSSE42(const char *data, size_t n) {
+    const __m128i zero = _mm_setzero_si128();
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + i));
+        int mask = _mm_movemask_epi8(_mm_cmpeq_epi8(chunk, zero));
+        if (mask != 0) {
+            return i + __builtin_ctz(static_cast<unsigned>(mask));
+        }
+    }
+    for (; i < n; ++i) {
+        if (static_cast<uint8_t>(data[i]) == kEscape) return i;
+    }
+    return n;
+}
+
+__attribute__((target("avx2")))
+static size_t findEscapeAVX2(const char *data, size_t n) {
+    const __m256i zero = _mm256_setzero_si256();
+    size_t i = 0;
+    for (; i + 32 <= n; i += 32) {
+        __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + i));
+        int mask = _mm256_movemask_epi8(_mm256_cmpeq_epi8(chunk, zero));
+        if (mask != 0) {
+            return i + __builtin_ctz(static_cast<unsigned>(mask));
+        }
+    }
+    return i + findEscapeSSE42(data + i, n - i);
+}
+#endif
+
+typedef size_t (*FindEscapeFunc)(const char *data, size_t n);
+
+static FindEscapeFunc selectFindEscape() {
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        return findEscapeAVX2;
+    }
+    if (__builtin_cpu_supports("sse4.2")) {
+        return findEscapeSSE42;
+    }
+#endif
+    return findEscapeScalar;
+}
+
+static const FindEscapeFunc findEscape = selectFindEscape();
+
 void EncodeBytesAscending(std::string *buf, const char *value, size_t value_size) {
+    buf->reserve(buf->size() + value_size + 3);
     buf->push_back(static_cast<char>(kBytesMarker));
-    for (size_t i = 0; i < value_size; i++) {
-        buf->push_back(value[i]);
-        if (static_cast<uint8_t>(value[i]) == kEscape) {
-            buf->push_back(kEscaped00);
-        }
+    while (value_size > 0) {
+        size_t n = findEscape(value, value_size);
+        buf->append(value, n);
+        if (n == value_size) break;
+        buf->push_back(static_cast<char>(kEscape));
+        buf->push_back(static_cast<char>(kEscaped00));
+        value += n + 1;
+        value_size -= n + 1;
     }
     buf->push_back(kEscape);
     buf->push_back(kEscapedTerm);
@@ -513,23 +579,48 @@ bool DecodeFloatAscending(const std::string& buf, size_t& pos, double* out) {
     return false;
 }
 
-bool DecodeBytesAscending(const std::string& buf, size_t& pos, std::string* out) {
-    if (pos >= buf.size() || buf[pos] != kBytesMarker)
-        return false;
-    for (++pos; pos < buf.size();) {
-        auto escapePos = buf.find((char) kEscape, pos);
-        if (escapePos == std::string::npos || escapePos + 1 >= buf.size()) return false;
-        auto escapeChar = (unsigned char) buf[escapePos + 1];
+// 返回解码后的长度, 失败返回-1; out为nullptr时只跳过不拷贝
+static ssize_t decodeBytesAscending(const char *data, size_t size, size_t &pos, char *out) {
+    if (pos >= size || static_cast<uint8_t>(data[pos]) != kBytesMarker) return -1;
+    size_t p = pos + 1;
+    size_t len = 0;
+    while (p < size) {
+        size_t n = findEscape(data + p, size - p);
+        if (p + n + 1 >= size) return -1;
+        auto escapeChar = static_cast<uint8_t>(data[p + n + 1]);
         if (escapeChar == kEscapedTerm) {
-            if (out) out->append(buf.substr(pos, escapePos - pos));
-            pos = escapePos + 2;
-            return true;
+            if (out) memcpy(out + len, data + p, n);
+            len += n;
+            pos = p + n + 2;
+            return static_cast<ssize_t>(len);
         }
-        if (escapeChar != kEscaped00) return false;
-        if (out) out->append(buf.substr(pos, escapePos - pos + 1));
-        pos = escapePos + 2;
+        if (escapeChar != kEscaped00) return -1;
+        // 拷贝转义前的数据并还原0x00
+        if (out) memcpy(out + len, data + p, n + 1);
+        len += n + 1;
+        p += n + 2;
     }
-    return false;
+    return -1;
+}
+
+bool DecodeBytesAscending(const std::string& buf, size_t& pos, std::string* out) {
+    if (out == nullptr) {
+        return decodeBytesAscending(buf.data(), buf.size(), pos, nullptr) >= 0;
+    }
+    // 解码后的长度不会超过剩余的编码长度
+    size_t old_size = out->size();
+    out->resize(old_size + (pos < buf.size() ? buf.size() - pos : 0));
+    auto len = decodeBytesAscending(buf.data(), buf.size(), pos, &(*out)[old_size]);
+    out->resize(old_size + (len > 0 ? len : 0));
+    return len >= 0;
+}
+
+bool DecodeBytesAscending(const char* data, size_t size, size_t& pos, char* out,
+                          size_t* out_len) {
+    auto len = decodeBytesAscending(data, size, pos, out);
+    if (len < 0) return false;
+    if (out_len) *out_len = static_cast<size_t>(len);
+    return true;
 }
 
 std::string EncodeToHexString(const std::string &str) {
@@ -54,6 +54,10 @@ bool DecodeUvarintAscending(const std::string& buf, size_t& pos, uint64_t* out);
 bool DecodeVarintAscending(const std::string& buf, size_t& pos, int64_t* out);
 bool DecodeFloatAscending(const std::string& buf, size_t& pos, double* out);
 bool DecodeBytesAscending(const std::string& buf, size_t& pos, std::string* out);
+// 解码到调用方提供的buffer, out的容量至少为size - pos（解码后长度不超过编码长度）
+// out_len返回解码后的长度
+bool DecodeBytesAscending(const char* data, size_t size, size_t& pos, char* out,
+                          size_t* out_len);
 
 // for tests or debug
 std::string EncodeToHexString(const std::string& str);
@@ -9,6 +9,9 @@ namespace sharkstore {
 namespace dataserver {
 namespace master {
 
+// master不支持批量range心跳时，间隔多久再尝试批量发送
+static const int kBatchRangeHeartbeatRetrySecs = 60;
+
 Client::Client(const std::vector<std::string>& ms_addrs)
     : ms_addrs_(ms_addrs.cbegin(), ms_addrs.cend()),
       last_async_ask_(std::chrono::steady_clock::now()) {
@@ -135,6 +138,24 @@ Status Client::AsyncRangeHeartbeat(const mspb::RangeHeartbeatRequest& req) {
     return Status::OK();
 }
 
+Status Client::AsyncBatchRangeHeartbeat(const mspb::BatchRangeHeartbeatRequest& req) {
+    auto conn = getLeaderConn();
+    if (conn == nullptr) {
+        return Status(Status::kNoLeader);
+    }
+
+    auto call = new BatchRangeHeartbeatCall;
+    call->type = AsyncCallType::kBatchRangeHeartbeat;
+    call->full_ranges.reserve(req.heartbeats_size());
+    for (const auto& hb : req.heartbeats()) {
+        call->full_ranges.push_back(hb.range().id());
+    }
+    call->response_reader =
+        conn->GetStub()->AsyncBatchRangeHeartbeat(&call->context, req, &cq_);
+    call->Finish();
+    return Status::OK();
+}
+
 Status Client::AsyncAskSplit(const mspb::AskSplitRequest& req) {
     auto conn = getLeaderConn();
     if (conn == nullptr) {
@@ -161,10 +182,28 @@ Status Client::AsyncReportSplit(const mspb::ReportSplitRequest& req) {
     return Status::OK();
 }
 
+bool Client::BatchRangeHeartbeatSupported() const {
+    std::lock_guard<std::mutex> lock(addr_mu_);
+    if (!batch_hb_unsupported_) return true;
+    auto elapse_secs = std::chrono::duration_cast<std::chrono::seconds>(
+            std::chrono::steady_clock::now() - batch_hb_unsupported_at_).count();
+    return elapse_secs >= kBatchRangeHeartbeatRetrySecs;
+}
+
+void Client::setBatchRangeHeartbeatUnsupported() {
+    std::lock_guard<std::mutex> lock(addr_mu_);
+    batch_hb_unsupported_ = true;
+    batch_hb_unsupported_at_ = std::chrono::steady_clock::now();
+}
+
 void Client::set_leader(const std::string& leader) {
     FLOG_INFO("[Master] Leader set to %s.", leader.c_str());
 
     std::lock_guard<std::mutex> lock(addr_mu_);
+    if (leader != leader_) {
+        // 新的leader可能已经升级
+        batch_hb_unsupported_ = false;
+    }
     leader_ = leader;
     if (!leader.empty()) {
         addAddr(leader);
@@ -300,6 +339,14 @@ void Client::recvResponse(TaskHandler* handler) {
             FLOG_ERROR("[Master] rpc failed to %s. type=%s, code=%d, msg=%s.",
                        from.c_str(), AsyncCallTypeName(call->type).c_str(),
                        call->status.error_code(), call->status.error_message().c_str());
+            if (call->type == AsyncCallType::kBatchRangeHeartbeat) {
+                if (call->status.error_code() == grpc::UNIMPLEMENTED) {
+                    FLOG_WARN("[Master] %s not support BatchRangeHeartbeat, "
+                              "fallback to RangeHeartbeat.", from.c_str());
+                    setBatchRangeHeartbeatUnsupported();
+                }
+                dropRangeHeartbeats(handler, call);
+            }
         } else {
             FLOG_DEBUG("[Master] recv %s respone from %s.",
                        AsyncCallTypeName(call->type).c_str(), from.c_str());
@@ -332,13 +379,26 @@ void Client::dispatchResponse(TaskHandler* handler, const std::string& from,
             break;
         }
         case AsyncCallType::kRangeHeartbeat: {
-            auto res =
-                dynamic_cast<AsyncCallResultT<mspb::RangeHeartbeatResponse>*>(call);
+            auto res = dynamic_cast<AsyncCallResultT<mspb::RangeHeartbeatResponse>*>(call);
             if (!checkResponseError(from, res->response.header())) {
                 handler->OnRangeHeartbeatResp(res->response);
             }
             break;
         }
+        case AsyncCallType::kBatchRangeHeartbeat: {
+            auto res = dynamic_cast<BatchRangeHeartbeatCall*>(call);
+            if (checkResponseError(from, res->response.header())) {
+                dropRangeHeartbeats(handler, call);
+                break;
+            }
+            for (const auto& resp : res->response.responses()) {
+                handler->OnRangeHeartbeatResp(resp);
+            }
+            for (auto range_id : res->response.full_required()) {
+                handler->OnRangeHeartbeatFullRequired(range_id);
+            }
+            break;
+        }
         case AsyncCallType::kGetMSLeader: {
             auto res = dynamic_cast<AsyncCallResultT<mspb::GetMSLeaderResponse>*>(call);
             if (!checkResponseError(from, res->response.header())) {
@@ -352,6 +412,13 @@ void Client::dispatchResponse(TaskHandler* handler, const std::string& from,
     }
 }
 
+void Client::dropRangeHeartbeats(TaskHandler* handler, AsyncCallResult* call) {
+    auto res = dynamic_cast<BatchRangeHeartbeatCall*>(call);
+    for (auto range_id : res->full_ranges) {
+        handler->OnRangeHeartbeatFullRequired(range_id);
+    }
+}
+
 void Client::checkStatus(const grpc::Status& s) {
     static const uint64_t kAskThreshold = 5;
 
@@ -43,9 +43,14 @@ public:
     // 异步调用方法
     Status AsyncNodeHeartbeat(const mspb::NodeHeartbeatRequest& req);
     Status AsyncRangeHeartbeat(const mspb::RangeHeartbeatRequest& req);
+    Status AsyncBatchRangeHeartbeat(const mspb::BatchRangeHeartbeatRequest& req);
     Status AsyncAskSplit(const mspb::AskSplitRequest& req);
     Status AsyncReportSplit(const mspb::ReportSplitRequest& req);
 
+    // 滚动升级期间旧版本的master不支持BatchRangeHeartbeat（返回UNIMPLEMENTED），
+    // 此时改用逐个range的RangeHeartbeat；leader变化或一段时间后再尝试批量发送
+    bool BatchRangeHeartbeatSupported() const;
+
 private:
     using ConnPtr = std::shared_ptr<Connection>;
 
@@ -71,6 +76,9 @@ private:
     void recvResponse(TaskHandler* handler);
     void dispatchResponse(TaskHandler* handler, const std::string& from,
                           AsyncCallResult* resp);
+    // 批量range心跳未送达，其中带完整内容的range下次需重发完整心跳
+    void dropRangeHeartbeats(TaskHandler* handler, AsyncCallResult* call);
+    void setBatchRangeHeartbeatUnsupported();
 
     // 检查rpc状态马，如果连续多次都是网络错误，我们可能连到了一个假的leader
     // 就发起一次AsyncAskLeader请求
@@ -93,6 +101,10 @@ private:
     std::atomic<uint64_t> network_fail_count_{0};
     TimePoint last_async_ask_;
 
+    // 收到BatchRangeHeartbeat UNIMPLEMENTED的时间，受addr_mu_保护
+    bool batch_hb_unsupported_ = false;
+    TimePoint batch_hb_unsupported_at_;
+
     ConnMap connections_;
     std::mutex conn_mu_;
     grpc::CompletionQueue cq_;
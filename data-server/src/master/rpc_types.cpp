@@ -25,6 +25,8 @@ std::string AsyncCallTypeName(AsyncCallType type) {
             return "NodeHeartbeat";
         case AsyncCallType::kRangeHeartbeat:
             return "RangeHeartbeat";
+        case AsyncCallType::kBatchRangeHeartbeat:
+            return "BatchRangeHeartbeat";
         case AsyncCallType::kGetMSLeader:
             return "GetMSLeader";
         default:
@@ -1,5 +1,6 @@
 _Pragma("once");
 
+#include <vector>
 #include <grpc++/grpc++.h>
 
 #include "proto/gen/mspb.grpc.pb.h"
@@ -16,6 +17,7 @@ enum class AsyncCallType : char {
     kReportSplit,
     kNodeHeartbeat,
     kRangeHeartbeat,
+    kBatchRangeHeartbeat,
     kGetMSLeader,
 };
 
@@ -40,6 +42,12 @@ public:
     void Finish() { response_reader->Finish(&response, &status, (void*)this); }
 };
 
+// 批量range心跳，记录其中带完整内容的range，未送达时需重发完整心跳
+struct BatchRangeHeartbeatCall
+    : public AsyncCallResultT<mspb::BatchRangeHeartbeatResponse> {
+    std::vector<uint64_t> full_ranges;
+};
+
 }  // namespace master
 }  // namespace dataserver
 }  // namespace sharkstore
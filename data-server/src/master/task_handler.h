@@ -13,6 +13,8 @@ public:
 
     virtual void OnNodeHeartbeatResp(const mspb::NodeHeartbeatResponse&) = 0;
     virtual void OnRangeHeartbeatResp(const mspb::RangeHeartbeatResponse&) = 0;
+    // master需要该range的完整心跳（master没有该range的信息或者上次的心跳未送达）
+    virtual void OnRangeHeartbeatFullRequired(uint64_t range_id) = 0;
     virtual void OnAskSplitResp(const mspb::AskSplitResponse&) = 0;
 
     virtual void CollectNodeHeartbeat(mspb::NodeHeartbeatRequest* req) = 0;
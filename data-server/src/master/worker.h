@@ -24,6 +24,8 @@ public:
 
     virtual void AsyncNodeHeartbeat(const mspb::NodeHeartbeatRequest &req) = 0;
     virtual void AsyncRangeHeartbeat(const mspb::RangeHeartbeatRequest &req) = 0;
+    // 与上次发送的心跳内容相同，只发送range id
+    virtual void AsyncRangeHeartbeatUnchanged(uint64_t range_id) = 0;
     virtual void AsyncAskSplit(const mspb::AskSplitRequest &req) = 0;
     virtual void AsyncReportSplit(const mspb::ReportSplitRequest &req) = 0;
 };
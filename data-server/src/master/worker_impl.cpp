@@ -2,6 +2,7 @@
 
 #include <chrono>
 #include <condition_variable>
+#include <iterator>
 #include <mutex>
 #include <thread>
 
@@ -15,6 +16,8 @@ namespace dataserver {
 namespace master {
 
 static const int kRcpRetryTimeoutSecs = 3;
+// 单个BatchRangeHeartbeat请求中完整心跳的最大字节数，超过时拆分为多个请求
+static const size_t kMaxBatchRangeHeartbeatBytes = 1024 * 1024;
 
 WorkerImpl::WorkerImpl(const std::vector<std::string> &ms_addrs, int node_hb_secs)
     : node_heartbeat_secs_(node_hb_secs), client_(new Client(ms_addrs)) {}
@@ -38,6 +41,7 @@ Status WorkerImpl::GetNodeId(mspb::GetNodeIdRequest& req, uint64_t *node_id, boo
             FLOG_INFO(
                     "[Master] GetNodeId successfully. node_id=%" PRIu64 ", clearup=%d",
                     *node_id, *clearup);
+            node_id_ = *node_id;
             return s;
         } else {
             FLOG_ERROR("[Master] GetNodeId failed(%s).", s.ToString().c_str());
@@ -76,6 +80,7 @@ Status WorkerImpl::Start(TaskHandler *handler) {
 
     assert(handler != nullptr);
 
+    handler_ = handler;
     client_->Start(handler);
 
     send_rpc_thr_ = std::thread(&WorkerImpl::doCallRPC, this);
@@ -120,12 +125,112 @@ void WorkerImpl::AsyncNodeHeartbeat(const mspb::NodeHeartbeatRequest &req) {
 }
 
 void WorkerImpl::AsyncRangeHeartbeat(const mspb::RangeHeartbeatRequest &req) {
+    std::lock_guard<std::mutex> lock(mu_);
+    if (stopped_) return;
+    auto range_id = req.range().id();
+    pending_range_hbs_[range_id] = req;
+    unchanged_range_hbs_.erase(range_id);
+    pushRangeHeartbeatTask();
+}
+
+void WorkerImpl::AsyncRangeHeartbeatUnchanged(uint64_t range_id) {
+    std::lock_guard<std::mutex> lock(mu_);
+    if (stopped_) return;
+    // 已有待发送的完整心跳
+    if (pending_range_hbs_.find(range_id) != pending_range_hbs_.end()) {
+        return;
+    }
+    unchanged_range_hbs_.insert(range_id);
+    pushRangeHeartbeatTask();
+}
+
+void WorkerImpl::pushRangeHeartbeatTask() {
+    // 已有未执行的发送任务时只需加入待发送集合
+    if (range_hb_task_pending_) return;
+
     auto task = new AsyncRPCTask;
-    task->type = AsyncCallType::kRangeHeartbeat;
-    task->call_func = std::bind(&Client::AsyncRangeHeartbeat, client_, req);
-    if (!pushCall(task)) {
-        delete task;
+    task->type = AsyncCallType::kBatchRangeHeartbeat;
+    task->call_func = std::bind(&WorkerImpl::flushRangeHeartbeats, this);
+    rpc_queue_.push(task);
+    range_hb_task_pending_ = true;
+    cond_.notify_all();
+}
+
+std::vector<mspb::BatchRangeHeartbeatRequest> SplitRangeHeartbeats(
+        uint64_t node_id, std::map<uint64_t, mspb::RangeHeartbeatRequest>&& hbs,
+        const std::set<uint64_t>& unchanged, size_t max_bytes) {
+    std::vector<mspb::BatchRangeHeartbeatRequest> reqs(1);
+    reqs.back().set_node_id(node_id);
+    for (auto range_id : unchanged) {
+        reqs.back().add_unchanged_ranges(range_id);
+    }
+
+    size_t bytes = 0;
+    for (auto &it : hbs) {
+        auto size = it.second.ByteSizeLong();
+        if (reqs.back().heartbeats_size() > 0 && bytes + size > max_bytes) {
+            reqs.emplace_back();
+            reqs.back().set_node_id(node_id);
+            bytes = 0;
+        }
+        bytes += size;
+        reqs.back().add_heartbeats()->Swap(&it.second);
+    }
+    return reqs;
+}
+
+Status WorkerImpl::flushRangeHeartbeats() {
+    std::map<uint64_t, mspb::RangeHeartbeatRequest> hbs;
+    std::set<uint64_t> unchanged;
+    {
+        std::lock_guard<std::mutex> lock(mu_);
+        hbs.swap(pending_range_hbs_);
+        unchanged.swap(unchanged_range_hbs_);
+        range_hb_task_pending_ = false;
+    }
+
+    if (!client_->BatchRangeHeartbeatSupported()) {
+        return sendRangeHeartbeats(hbs, unchanged);
+    }
+
+    auto reqs = SplitRangeHeartbeats(node_id_, std::move(hbs), unchanged,
+                                     kMaxBatchRangeHeartbeatBytes);
+    for (size_t i = 0; i < reqs.size(); ++i) {
+        auto s = client_->AsyncBatchRangeHeartbeat(reqs[i]);
+        if (!s.ok()) {
+            // 没有leader等错误，剩余的心跳也会失败，未送达的range下个周期发送完整心跳
+            size_t dropped = 0;
+            for (; i < reqs.size(); ++i) {
+                for (const auto &hb : reqs[i].heartbeats()) {
+                    handler_->OnRangeHeartbeatFullRequired(hb.range().id());
+                }
+                dropped += reqs[i].heartbeats_size() + reqs[i].unchanged_ranges_size();
+            }
+            return Status(s.code(), "range heartbeat", std::to_string(dropped) + " dropped");
+        }
     }
+
+    return Status::OK();
+}
+
+Status WorkerImpl::sendRangeHeartbeats(std::map<uint64_t, mspb::RangeHeartbeatRequest> &hbs,
+                                       const std::set<uint64_t> &unchanged) {
+    // 旧版本的master只接受完整心跳，发送后仍要求range下次发送完整心跳
+    // 内容没有变化的range本周期不发送
+    for (auto range_id : unchanged) {
+        handler_->OnRangeHeartbeatFullRequired(range_id);
+    }
+    for (auto &it : hbs) {
+        handler_->OnRangeHeartbeatFullRequired(it.first);
+    }
+    for (auto it = hbs.begin(); it != hbs.end(); ++it) {
+        auto s = client_->AsyncRangeHeartbeat(it->second);
+        if (!s.ok()) {
+            return Status(s.code(), "range heartbeat",
+                          std::to_string(std::distance(it, hbs.end())) + " dropped");
+        }
+    }
+    return Status::OK();
 }
 
 void WorkerImpl::AsyncAskSplit(const mspb::AskSplitRequest &req) {
@@ -1,11 +1,15 @@
 _Pragma("once");
 
+#include <atomic>
 #include <condition_variable>
+#include <map>
 #include <mutex>
 #include <queue>
+#include <set>
 #include <string>
 #include <thread>
 #include <unordered_map>
+#include <vector>
 
 #include "base/status.h"
 #include "rpc_types.h"
@@ -18,6 +22,12 @@ namespace master {
 class Client;
 class TaskHandler;
 
+// 把待发送的range心跳拆分为多个BatchRangeHeartbeatRequest：每个请求中完整心跳的大小
+// 合计不超过max_bytes（单个心跳超过时独占一个请求），内容没有变化的range放在第一个请求中
+std::vector<mspb::BatchRangeHeartbeatRequest> SplitRangeHeartbeats(
+        uint64_t node_id, std::map<uint64_t, mspb::RangeHeartbeatRequest>&& hbs,
+        const std::set<uint64_t>& unchanged, size_t max_bytes);
+
 class WorkerImpl : public Worker {
 public:
     WorkerImpl(const std::vector<std::string> &ms_addrs, int node_hb_secs);
@@ -38,6 +48,7 @@ public:
 
     void AsyncNodeHeartbeat(const mspb::NodeHeartbeatRequest &req) override;
     void AsyncRangeHeartbeat(const mspb::RangeHeartbeatRequest &req) override;
+    void AsyncRangeHeartbeatUnchanged(uint64_t range_id) override;
     void AsyncAskSplit(const mspb::AskSplitRequest &req) override;
     void AsyncReportSplit(const mspb::ReportSplitRequest &req) override;
 
@@ -54,15 +65,29 @@ private:
     bool pushCall(AsyncRPCTask *task);
     void doCallRPC();
     void doNodeHeartbeat(TaskHandler *handler);
+    // 待发送的range心跳合并为BatchRangeHeartbeat发送
+    Status flushRangeHeartbeats();
+    // master不支持BatchRangeHeartbeat时逐个发送完整心跳
+    Status sendRangeHeartbeats(std::map<uint64_t, mspb::RangeHeartbeatRequest>& hbs,
+                               const std::set<uint64_t>& unchanged);
+    // 合并发送range心跳的任务，调用方须持有mu_
+    void pushRangeHeartbeatTask();
 
 private:
     const size_t node_heartbeat_secs_ = 10;
 
     Client *client_ = nullptr;
+    TaskHandler *handler_ = nullptr;
+    std::atomic<uint64_t> node_id_ = {0};
 
     bool stopped_ = false;
 
     std::queue<AsyncRPCTask *> rpc_queue_;
+    // 待发送的range心跳，同一range只保留最新的，合并为一个rpc任务发送
+    std::map<uint64_t, mspb::RangeHeartbeatRequest> pending_range_hbs_;
+    // 待发送的内容没有变化的range
+    std::set<uint64_t> unchanged_range_hbs_;
+    bool range_hb_task_pending_ = false;
     mutable std::mutex mu_;
     std::condition_variable cond_;
 
@@ -101,6 +101,9 @@ namespace sharkstore
         bool ISystemStatus::GetFileSystemUsage(const char *path, uint64_t *total, uint64_t *available) {
             return this->statusPtr_->GetFileSystemUsage(path, total, available);
         }
+        bool ISystemStatus::SampleProcStats(ProcStats *stats) {
+            return this->statusPtr_->SampleProcStats(stats);
+        }
 
         //拆分GetProcessStats函数
         void ISystemStatus::GetMemStats(pid_t pid)
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "syscommon.h"
+#include "proc_sampler.h"
 #include <memory>
 #include <mutex>
 
@@ -33,6 +34,10 @@ public:
 
     bool GetFileSystemUsage(const char *path, uint64_t *total, uint64_t *available);
 
+    // 采样/proc，计算与上一次采样之间的cpu、磁盘、网卡速率
+    // 会推进采样基线，只由RunStatus周期调用，其他地方读取RunStatus保存的结果
+    bool SampleProcStats(ProcStats *stats);
+
 
 public:
     void PutTopData(PrintTag tag, uint32_t time);
@@ -43,38 +43,39 @@ namespace sharkstore
             this->GetHardDiskInfo(info.HardDisk);
             return bRet;
         }
+        bool LinuxStatus::SampleProcStats(ProcStats *stats)
+        {
+            if (!sampler_.Sample(stats))
+            {
+                return false;
+            }
+            std::lock_guard<std::mutex> lock(last_mu_);
+            last_stats_ = *stats;
+            return true;
+        }
+        bool LinuxStatus::GetLastProcStats(ProcStats *stats)
+        {
+            std::lock_guard<std::mutex> lock(last_mu_);
+            if (last_stats_.elapsed_ms <= 0)
+            {
+                return false;
+            }
+            *stats = last_stats_;
+            return true;
+        }
         bool LinuxStatus::GetCPUInfo(CpuInfo&info)
         {
-            bool bRet = true;
-            std::vector<uint64_t> vltTotalFirst, vltIdleFirst,vUtilization;
-            int num = CPUCurCalc(vltTotalFirst,vltIdleFirst);
-            sleep(1); 
-
-            std::vector<uint64_t> vltTotalSecond, vltIdleSecond;
-            int nCores = CPUCurCalc(vltTotalSecond, vltIdleSecond);
-            for(int i = 0; i < nCores; i++)
+            //最近一个统计周期的使用率，不推进采样基线
+            ProcStats stats;
+            info.Rate = 0.0;
+            if (!GetLastProcStats(&stats))
             {
-                double divisor = (vltIdleSecond[i] - vltIdleFirst[i]) * 1.0;
-                double dividend = (vltTotalSecond[i] - vltTotalFirst[i]) * 1.0;
-
-                info.Rate  = 0.0;
-                if (dividend <= 0 || divisor <= 0)
-                {
-                    info.Rate = 0.0;
-                    return false;
-                }
-
-                double dvalue = dividend - divisor;
-                if (dvalue <= 0)
-                {
-                    info.Rate = 0;
-                    return false;
-                }
-
-                info.Rate = dvalue/dividend;
-            } 
+                return false;
+            }
 
-            return bRet;
+            info.Rate = stats.cpu_usage / 100.0;
+            info.CpuCount = stats.cpu_count;
+            return true;
         }
         bool LinuxStatus::GetMemInfo(MemInfo&info)
         {
@@ -264,54 +265,6 @@ namespace sharkstore
             }
         }
 
-        void LinuxStatus::LinesFrom(FILE *pFile, std::vector<std::string> &vResult)
-        {
-            vResult.clear();
-            char szLine[READ_CHARS_LENGTH] = { 0 };
-            while(fgets(szLine, READ_CHARS_LENGTH, pFile) != NULL)
-            {
-                int nLength = strlen(szLine);
-                if(szLine[nLength - 1] == '\n')
-                {
-                    szLine[nLength - 1] = '\0';
-                }
-                
-                vResult.push_back(szLine);
-            }
-        }
-
-        int LinuxStatus::ExecCmd(const char *szCmd, std::vector<std::string> &vResult)
-        {    
-            FILE *pCmd = popen(szCmd, "r");
-            if(pCmd == NULL) 
-            {
-                    return -1;
-            } 
-            LinesFrom(pCmd, vResult);
-
-            return pclose(pCmd);
-        }
-
-        int LinuxStatus::CPUCurCalc(std::vector<uint64_t> &vltTotal, std::vector<uint64_t> &vltIdle)
-        {
-            return 32;
-            vltTotal.clear();
-            vltIdle.clear();    
-            // /proc/stat | grep cpu | awk -F ' ' '{ print $2 + $3 + $4 + $5 + $6 + $7 + $8 + $9, $5 }'
-            std::vector<std::string> vResult;
-            ExecCmd("cat /proc/stat | grep cpu | awk -F ' ' '{ print $2 + $3 + $4 + $5 + $6 + $7 + $8 + $9, $5 }'", vResult);
-                
-            int nCores = vResult.size();
-            for(int i = 0; i < nCores; i++)
-            {
-                uint64_t ltTotal, ltIdle;
-                sscanf(vResult[i].c_str(), "%ld %ld ", &ltTotal, &ltIdle);
-                vltTotal.push_back(ltTotal);
-                vltIdle.push_back(ltIdle);
-            }
-
-            return nCores;
-        }
         bool LinuxStatus::GetMemProcInfo(MemInfo &info,const pid_t pid)
         {
             bool bRet = true;
@@ -331,6 +284,17 @@ namespace sharkstore
         bool LinuxStatus::GetCPUInfo(CpuInfo &info,const pid_t  id)
         {
             bool bRet = true;
+            info.CpuCount = this->GetCpuNum();
+
+            //本进程使用最近一个统计周期的结果，不需要等待
+            if (id == getpid())
+            {
+                ProcStats stats;
+                bRet = GetLastProcStats(&stats);
+                info.Rate = stats.proc_cpu_usage;
+                return bRet;
+            }
+
             unsigned int total1,total2;
             unsigned int proc1,proc2;
             total1 = this->GetTotalCPU();
@@ -342,7 +306,6 @@ namespace sharkstore
 
             info.Rate = pcpu;
             info.Used = proc2 - proc1;
-            info.CpuCount = this->GetCpuNum();
             
             return bRet;
         }
@@ -558,105 +521,37 @@ namespace sharkstore
 
             return total;
         }
-        char * LinuxStatus::GetName(char * name, char * p)
-        {
-            char * t = NULL;
-
-            /*处理小写*/
-            while((*p<'a') || (*p>'z'))
-            {
-                p++;
-            }
-
-            if ((t =  strchr(p, ':')))
-            {
-                memcpy(name, p, t-p);
-                return t+1;
-            }
-            else
-            {
-                return NULL;
-            } 
-        }
         int LinuxStatus::GetNetWorkStats(char * ifname,  NetdevStats * pstats)
         {
-            FILE * fp = NULL;
-            char name[256] = {0};
-            char buf[256] = {0};
-            char * s = NULL;
-            int found = 0;
-
-
-            if (/*!ifname || */!pstats) 
+            if (!pstats)
             {
                 return -1;
             }
 
-            fp = fopen(PROC_NET_DEV_FNAME, "r");
+            ProcCounters counters;
+            sampler_.Read(&counters);
 
-            if (!fp) 
+            //未指定网卡时取第一个非lo的网卡
+            for (int i = 0; i < counters.nic_count; i++)
             {
-                return -1;
-            }
-            else
-            {
-                //清除内容的两行头
-                char * end = fgets(buf, sizeof(buf), fp );
-                if (NULL == end)
+                const auto &nic = counters.nics[i];
+                if (ifname != NULL && strcmp(nic.name, ifname) != 0)
                 {
-                    return -1;
-                }
-                end = fgets(buf, sizeof(buf), fp );
-                if (NULL == end)
-                {
-                    return -1;
+                    continue;
                 }
 
-                memset(buf, 0 ,sizeof(buf));
-
-                while (fgets(buf, sizeof(buf), fp ))
-                {
-                    memset(name, 0, sizeof(name));
-                    s = GetName(name, buf);
-
-                    if (s)
-                    {
-                        sscanf(s, "%llu%llu%lu%lu%lu%lu%lu%lu%llu%llu%lu%lu%lu%lu%lu%lu",
-                            &pstats->RxBytesM,  &pstats->RxPacketsM,
-                            &pstats->RxErrorsM, &pstats->RxDroppedM,
-                            &pstats->RxFifoErrorsM, &pstats->RxFrameErrorsM,
-                            &pstats->RxCompressedM,  &pstats->RxMulticastM, 
-                            &pstats->TxBytesM, &pstats->TxPacketsM,
-                            &pstats->TxErrorsM,&pstats->TxDroppedM,
-                            &pstats->TxFifoErrorsM, &pstats->CollisionsM,
-                            &pstats->TxCarrierErrorsM,&pstats->TxCompressedM
-                            );
-
-                        //判断是否得到相关网卡的信息
-                        //if(!strncmp(name, ifname, strlen(ifname))) 
-                        if(strncmp(name, "lo", 2))
-                        {
-                            found = 1;
-                            break;              
-                        }
-                    }
-                    else 
-                    {
-                        continue;
-                    }
-                }
-            
-                fclose(fp);
-            }
-
-            if (!found)
-            {
-                return -1;
-            }
-            else 
-            {
+                pstats->RxBytesM = nic.rx_bytes;
+                pstats->RxPacketsM = nic.rx_packets;
+                pstats->RxErrorsM = nic.rx_errors;
+                pstats->RxDroppedM = nic.rx_dropped;
+                pstats->TxBytesM = nic.tx_bytes;
+                pstats->TxPacketsM = nic.tx_packets;
+                pstats->TxErrorsM = nic.tx_errors;
+                pstats->TxDroppedM = nic.tx_dropped;
                 return 0;
             }
+
+            return -1;
         }
         int  LinuxStatus::GetLoadAvg(LoadAvg&lv)
         {
@@ -682,30 +577,15 @@ namespace sharkstore
 
             return 0;
         }
-        uint32_t LinuxStatus::GetCpuNum() 
-        {  
-            return 32;
-            char buf[16] = {0};  
-            int num;  
-            FILE* fp = popen("cat /proc/cpuinfo |grep processor|wc -l", "r");  
-            if(fp) 
-            {                                                                                                                                                                               
-                int ret = fread(buf, 1, sizeof(buf) - 1, fp);  
-                // TODO: check return value
-                (void)ret;
-                pclose(fp);  
-            }
-            else
+        uint32_t LinuxStatus::GetCpuNum()
+        {
+            long num = sysconf(_SC_NPROCESSORS_ONLN);
+            if (num <= 0)
             {
-                return 0;
-            }     
-            sscanf(buf,"%d",&num);  
-            if(num <= 0)
-            {   
-                num = 1;  
-            }     
-            return (uint32_t)num;  
-        } 
+                num = 1;
+            }
+            return (uint32_t)num;
+        }
         uint32_t LinuxStatus::GetFileCount(pid_t pid)
         {
             DIR *dir = NULL;
@@ -776,75 +656,17 @@ namespace sharkstore
             drs.Count++;
             drs.TimeStamp = this->GetTimeStamp();
 
-            FILE *fp = NULL;       
-            char buf[MAX_FILE_NAME * 4] = {0};                                                                                                
-            fp = fopen ("/proc/diskstats", "r"); 
-
-            if (NULL == fp)
+            //只统计整盘，分区及loop、ram设备在采样器中已排除
+            ProcCounters counters;
+            sampler_.Read(&counters);
+            for (int i = 0; i < counters.disk_count; i++)
             {
-                perror("/proc/diskstats:");
-                return false;
+                const auto &disk = counters.disks[i];
+                drs.CurReadBytesSec += disk.read_sectors * 512;
+                drs.CurReadCountSec += disk.reads;
+                drs.CurWriteBytesSec += disk.write_sectors * 512;
+                drs.CurWriteCountSec += disk.writes;
             }
-            else
-            {
-                char name[MAX_FILE_NAME] = {0};
-                uint32_t major = 0;
-                uint32_t minor = 0;
-                char devname[MAX_FILE_NAME] = {0};
-                uint64_t rdios = 0;
-
-                uint64_t rdmerges_or_rdsec = 0;
-                uint64_t rdsec_or_wrios = 0;
-                uint64_t rdticks_or_wrsec = 0;
-                uint64_t wrios = 0;
-                uint64_t wrmerges = 0;
-
-                uint64_t wrsec = 0;
-
-                while (fgets(buf, sizeof(buf), fp))
-                {
-                    sscanf(buf, "%u %u %s %lu %lu %lu %lu %lu %lu %lu",
-                    &major, &minor, devname,
-                    &rdios, &rdmerges_or_rdsec, &rdsec_or_wrios, &rdticks_or_wrsec,
-                    &wrios, &wrmerges, &wrsec);
-
-                    size_t len0 = strlen(name);
-                    size_t len1 = strlen(devname);
-                    size_t minsize = 0;
-
-                    if (len0 < len1)
-                    {
-                        minsize = len0;
-                    }
-                    else
-                    {
-                        minsize = len1;
-                    }
-
-                    if (minsize < 1)
-                    {
-                        minsize = 1;
-                    }
-
-                    //取不同值
-                    int result = strncmp(name,devname,minsize);
-                    if (result != 0)
-                    {
-                        drs.CurReadBytesSec += rdsec_or_wrios * 512;
-                        drs.CurReadCountSec += rdsec_or_wrios;
-                        drs.CurWriteBytesSec += wrsec * 512;
-                        drs.CurWriteCountSec += wrsec;
-                    }
-                    else
-                    {
-                        continue;
-                    }
-
-                    strcpy(name,devname);
-                }
-                fclose(fp);
-            }
-            
 
             //第二次以上开始计算
             if (drs_.Count > 0)
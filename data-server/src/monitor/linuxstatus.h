@@ -1,7 +1,9 @@
 #pragma once
 #include "syscommon.h"
+#include "proc_sampler.h"
 #include <string>
 #include <vector>
+#include <mutex>
 #include <sys/types.h>
 namespace sharkstore {
 namespace monitor {
@@ -20,6 +22,11 @@ public:
 
     bool GetMemProcInfo(MemInfo &info,const pid_t  id);
     bool GetCPUInfo(CpuInfo &info,const pid_t  id);
+
+    // 采样并计算与上一次采样之间的cpu、磁盘、网卡速率，会推进采样基线，
+    // 只由RunStatus周期调用；其他地方通过GetLastProcStats读取最近一次的结果
+    bool SampleProcStats(ProcStats *stats);
+    bool GetLastProcStats(ProcStats *stats);
 public:
     bool GetPathFromDisk(const char *path,std::string &name);
 private:
@@ -28,10 +35,6 @@ private:
     bool GetDiskBlockSize(std::vector<HardDiskInfo> & vecSize);
     void DiskInfoUinque(std::vector<HardDiskInfo> & vecSize);
 
-    void LinesFrom(FILE *pFile, std::vector<std::string> &vResult);
-    int ExecCmd(const char *szCmd, std::vector<std::string> &vResult);
-    int CPUCurCalc(std::vector<uint64_t> &vltTotal, std::vector<uint64_t> &vltIdle);
-
     const char *GetFiled(const char *pData,int pos);
     uint64_t GetMemUse(const pid_t pid,uint32_t &count);
     uint64_t GetTotalMem(MemInfo &info);
@@ -39,7 +42,6 @@ private:
     uint32_t  GetProcCPU(const pid_t pid);
     uint32_t  GetTotalCPU();
 
-    char * GetName(char * name, char * p);
     uint32_t GetCpuNum();
 private:
     bool GetRWStatus(HardDiskInfo &hdi);
@@ -52,6 +54,9 @@ public:
 private:
     std::vector<HardDiskInfo> vecSize_;
     DiskRwStatus drs_;
+    ProcSampler sampler_;
+    std::mutex last_mu_;
+    ProcStats last_stats_;
 };
 
 }
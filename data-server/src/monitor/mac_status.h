@@ -1,6 +1,7 @@
 #pragma once
 
 #include "syscommon.h"
+#include "proc_sampler.h"
 #include <string>
 #include <vector>
 #include <sys/types.h>
@@ -27,6 +28,8 @@ public:
     int GetLoadAvg(LoadAvg&lv) { return 0; }
     int GetNetWorkStats(char * ifname,  NetdevStats * pstats) { return 0; }
     uint32_t GetFileCount(pid_t pid) { return 0; }
+    bool SampleProcStats(ProcStats *stats) { return false; }
+    bool GetLastProcStats(ProcStats *stats) { return false; }
 };
 
 }
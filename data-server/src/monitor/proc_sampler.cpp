@@ -0,0 +1,379 @@
+#include "proc_sampler.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+namespace sharkstore {
+namespace monitor {
+
+namespace {
+
+const char *kProcFiles[] = {"/proc/stat", "/proc/self/stat", "/proc/diskstats", "/proc/net/dev"};
+
+// 按行、按空白分隔扫描缓冲区
+class Scanner {
+public:
+    Scanner(const char *data, size_t len) : p_(data), end_(data + len) {}
+
+    bool Eof() const { return p_ >= end_; }
+    bool Eol() const { return p_ >= end_ || *p_ == '\n'; }
+
+    // 跳过行内空白，返回是否还有字段
+    bool SkipSpaces() {
+        while (p_ < end_ && (*p_ == ' ' || *p_ == '\t')) ++p_;
+        return !Eol();
+    }
+
+    // 跳到下一行开头
+    void NextLine() {
+        while (p_ < end_ && *p_ != '\n') ++p_;
+        if (p_ < end_) ++p_;
+    }
+
+    bool ReadU64(uint64_t *value) {
+        if (!SkipSpaces() || *p_ < '0' || *p_ > '9') {
+            return false;
+        }
+        uint64_t v = 0;
+        while (p_ < end_ && *p_ >= '0' && *p_ <= '9') {
+            v = v * 10 + static_cast<uint64_t>(*p_ - '0');
+            ++p_;
+        }
+        *value = v;
+        return true;
+    }
+
+    void SkipField(int n = 1) {
+        for (int i = 0; i < n; ++i) {
+            if (!SkipSpaces()) return;
+            while (p_ < end_ && *p_ != ' ' && *p_ != '\t' && *p_ != '\n') ++p_;
+        }
+    }
+
+    // 读取字段到out（截断并以'\0'结尾），遇到空白或stop字符结束
+    bool ReadName(char *out, size_t cap, char stop = ' ') {
+        if (!SkipSpaces()) {
+            return false;
+        }
+        size_t n = 0;
+        while (p_ < end_ && *p_ != ' ' && *p_ != '\t' && *p_ != '\n' && *p_ != stop) {
+            if (n + 1 < cap) out[n++] = *p_;
+            ++p_;
+        }
+        out[n] = '\0';
+        if (p_ < end_ && *p_ == stop) ++p_;
+        return n > 0;
+    }
+
+    bool StartsWith(const char *prefix) const {
+        size_t n = strlen(prefix);
+        return static_cast<size_t>(end_ - p_) >= n && memcmp(p_, prefix, n) == 0;
+    }
+
+    void Skip(size_t n) { p_ = (static_cast<size_t>(end_ - p_) > n) ? p_ + n : end_; }
+
+    // 定位到区间内最后一个c之后
+    bool SeekAfterLast(char c) {
+        for (const char *q = end_; q > p_; --q) {
+            if (*(q - 1) == c) {
+                p_ = q;
+                return true;
+            }
+        }
+        return false;
+    }
+
+private:
+    const char *p_;
+    const char *end_;
+};
+
+int64_t monotonicMs() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return static_cast<int64_t>(ts.tv_sec) * 1000 + ts.tv_nsec / 1000000;
+}
+
+bool readCpu(Scanner &sc, ProcCounters::Cpu *cpu) {
+    // user nice system idle iowait irq softirq steal (guest已计入user)
+    uint64_t v[8] = {0};
+    int n = 0;
+    for (; n < 8 && sc.ReadU64(&v[n]); ++n) {
+    }
+    if (n < 4) {
+        return false;
+    }
+    cpu->total = 0;
+    for (int i = 0; i < n; ++i) {
+        cpu->total += v[i];
+    }
+    cpu->idle = v[3] + v[4];
+    return true;
+}
+
+uint64_t delta(uint64_t prev, uint64_t cur) { return cur > prev ? cur - prev : 0; }
+
+bool isVirtualDisk(const char *name) {
+    return strncmp(name, "loop", 4) == 0 || strncmp(name, "ram", 3) == 0;
+}
+
+}  // namespace
+
+ProcSampler::ProcSampler() {
+    for (int i = 0; i < kFileCount; ++i) {
+        fds_[i] = ::open(kProcFiles[i], O_RDONLY | O_CLOEXEC);
+    }
+}
+
+ProcSampler::~ProcSampler() {
+    for (int i = 0; i < kFileCount; ++i) {
+        if (fds_[i] >= 0) {
+            ::close(fds_[i]);
+        }
+    }
+}
+
+ssize_t ProcSampler::readFile(ProcFile file) {
+    int fd = fds_[file];
+    if (fd < 0) {
+        return -1;
+    }
+    // proc文件每次从偏移0读取都会重新生成内容
+    size_t len = 0;
+    while (len < kBufferSize) {
+        ssize_t n = ::pread(fd, buf_ + len, kBufferSize - len, static_cast<off_t>(len));
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            return -1;
+        }
+        if (n == 0) break;
+        len += static_cast<size_t>(n);
+    }
+    return static_cast<ssize_t>(len);
+}
+
+bool ProcSampler::Read(ProcCounters *counters) {
+    std::lock_guard<std::mutex> lock(mu_);
+    return read(counters);
+}
+
+bool ProcSampler::read(ProcCounters *counters) {
+    counters->time_ms = monotonicMs();
+    counters->cpu_count = 0;
+    counters->disk_count = 0;
+    counters->nic_count = 0;
+
+    bool ret = true;
+    ssize_t len = readFile(kStat);
+    ret = len > 0 && ParseStat(buf_, static_cast<size_t>(len), counters) && ret;
+    len = readFile(kSelfStat);
+    ret = len > 0 && ParseSelfStat(buf_, static_cast<size_t>(len), counters) && ret;
+    len = readFile(kDiskStats);
+    ret = len > 0 && ParseDiskStats(buf_, static_cast<size_t>(len), counters) && ret;
+    len = readFile(kNetDev);
+    ret = len > 0 && ParseNetDev(buf_, static_cast<size_t>(len), counters) && ret;
+    return ret;
+}
+
+bool ProcSampler::Sample(ProcStats *stats) {
+    std::lock_guard<std::mutex> lock(mu_);
+
+    int next = current_ ^ 1;
+    bool ret = read(&counters_[next]);
+    if (has_prev_) {
+        Diff(counters_[current_], counters_[next], stats);
+    } else {
+        Diff(counters_[next], counters_[next], stats);
+        stats->elapsed_ms = 0;
+    }
+    current_ = next;
+    has_prev_ = true;
+    return ret;
+}
+
+bool ProcSampler::ParseStat(const char *data, size_t len, ProcCounters *counters) {
+    Scanner sc(data, len);
+    bool found = false;
+    counters->cpu_count = 0;
+    for (; !sc.Eof(); sc.NextLine()) {
+        if (!sc.StartsWith("cpu")) {
+            continue;
+        }
+        sc.Skip(3);
+        if (sc.StartsWith(" ")) {  // 汇总行
+            found = readCpu(sc, &counters->cpu);
+            continue;
+        }
+        // cpuN，下线的核不会出现，按出现顺序记录
+        uint64_t idx = 0;
+        if (!sc.ReadU64(&idx) || counters->cpu_count >= kProcMaxCpus) {
+            continue;
+        }
+        if (readCpu(sc, &counters->cpus[counters->cpu_count])) {
+            ++counters->cpu_count;
+        }
+    }
+    return found;
+}
+
+bool ProcSampler::ParseSelfStat(const char *data, size_t len, ProcCounters *counters) {
+    // pid (comm) state ppid ...，comm中可能含有空格和括号
+    Scanner sc(data, len);
+    if (!sc.SeekAfterLast(')')) {
+        return false;
+    }
+    // ')'之后第一个字段为state（第3项），utime、stime为第14、15项
+    sc.SkipField(11);
+    uint64_t utime = 0, stime = 0;
+    if (!sc.ReadU64(&utime) || !sc.ReadU64(&stime)) {
+        return false;
+    }
+    counters->proc_cpu = utime + stime;
+    return true;
+}
+
+bool ProcSampler::ParseDiskStats(const char *data, size_t len, ProcCounters *counters) {
+    // major minor name reads rd_merges rd_sectors rd_ms writes wr_merges wr_sectors wr_ms
+    // in_flight io_ms ...
+    Scanner sc(data, len);
+    counters->disk_count = 0;
+    const char *last_disk = nullptr;
+    for (; !sc.Eof(); sc.NextLine()) {
+        if (counters->disk_count >= kProcMaxDisks) {
+            break;
+        }
+        auto &d = counters->disks[counters->disk_count];
+        sc.SkipField(2);
+        if (!sc.ReadName(d.name, sizeof(d.name))) {
+            continue;
+        }
+        if (isVirtualDisk(d.name)) {
+            continue;
+        }
+        // 分区紧跟在所属磁盘之后，名字以磁盘名为前缀，只统计整盘
+        if (last_disk != nullptr && strncmp(d.name, last_disk, strlen(last_disk)) == 0) {
+            continue;
+        }
+        uint64_t v[10] = {0};
+        int n = 0;
+        for (; n < 10 && sc.ReadU64(&v[n]); ++n) {
+        }
+        if (n < 10) {
+            continue;
+        }
+        d.reads = v[0];
+        d.read_sectors = v[2];
+        d.read_ms = v[3];
+        d.writes = v[4];
+        d.write_sectors = v[6];
+        d.write_ms = v[7];
+        d.io_ms = v[9];
+        last_disk = d.name;
+        ++counters->disk_count;
+    }
+    return true;
+}
+
+bool ProcSampler::ParseNetDev(const char *data, size_t len, ProcCounters *counters) {
+    // 前两行为表头，之后每行：name: rx_bytes packets errs drop fifo frame compressed multicast
+    //                                tx_bytes packets errs drop fifo colls carrier compressed
+    Scanner sc(data, len);
+    sc.NextLine();
+    sc.NextLine();
+    counters->nic_count = 0;
+    for (; !sc.Eof() && counters->nic_count < kProcMaxNics; sc.NextLine()) {
+        auto &nic = counters->nics[counters->nic_count];
+        if (!sc.ReadName(nic.name, sizeof(nic.name), ':') || strcmp(nic.name, "lo") == 0) {
+            continue;
+        }
+        uint64_t v[12] = {0};
+        int n = 0;
+        for (; n < 12 && sc.ReadU64(&v[n]); ++n) {
+        }
+        if (n < 12) {
+            continue;
+        }
+        nic.rx_bytes = v[0];
+        nic.rx_packets = v[1];
+        nic.rx_errors = v[2];
+        nic.rx_dropped = v[3];
+        nic.tx_bytes = v[8];
+        nic.tx_packets = v[9];
+        nic.tx_errors = v[10];
+        nic.tx_dropped = v[11];
+        ++counters->nic_count;
+    }
+    return true;
+}
+
+void ProcSampler::Diff(const ProcCounters &prev, const ProcCounters &cur, ProcStats *stats) {
+    stats->elapsed_ms = cur.time_ms - prev.time_ms;
+    double secs = stats->elapsed_ms > 0 ? stats->elapsed_ms / 1000.0 : 0;
+
+    auto usage = [](const ProcCounters::Cpu &p, const ProcCounters::Cpu &c) {
+        uint64_t total = delta(p.total, c.total);
+        uint64_t idle = delta(p.idle, c.idle);
+        return total > 0 && total >= idle ? 100.0 * (total - idle) / total : 0.0;
+    };
+
+    stats->cpu_usage = usage(prev.cpu, cur.cpu);
+    stats->cpu_count = cur.cpu_count;
+    for (int i = 0; i < cur.cpu_count; ++i) {
+        stats->cpu_usages[i] = i < prev.cpu_count ? usage(prev.cpus[i], cur.cpus[i]) : 0;
+    }
+
+    uint64_t total = delta(prev.cpu.total, cur.cpu.total);
+    stats->proc_cpu_usage = total > 0 ? 100.0 * delta(prev.proc_cpu, cur.proc_cpu) / total : 0;
+
+    // 设备可能增减，按名字匹配上一次的计数
+    stats->disk_count = cur.disk_count;
+    for (int i = 0; i < cur.disk_count; ++i) {
+        const auto &c = cur.disks[i];
+        auto &d = stats->disks[i];
+        memcpy(d.name, c.name, sizeof(d.name));
+        const ProcCounters::Disk *p = &c;
+        for (int j = 0; j < prev.disk_count; ++j) {
+            if (strcmp(prev.disks[j].name, c.name) == 0) {
+                p = &prev.disks[j];
+                break;
+            }
+        }
+        uint64_t reads = delta(p->reads, c.reads);
+        uint64_t writes = delta(p->writes, c.writes);
+        d.read_iops = secs > 0 ? reads / secs : 0;
+        d.write_iops = secs > 0 ? writes / secs : 0;
+        d.read_bytes_sec = secs > 0 ? delta(p->read_sectors, c.read_sectors) * 512 / secs : 0;
+        d.write_bytes_sec = secs > 0 ? delta(p->write_sectors, c.write_sectors) * 512 / secs : 0;
+        d.read_latency_ms = reads > 0 ? static_cast<double>(delta(p->read_ms, c.read_ms)) / reads : 0;
+        d.write_latency_ms =
+            writes > 0 ? static_cast<double>(delta(p->write_ms, c.write_ms)) / writes : 0;
+        d.util = stats->elapsed_ms > 0 ? 100.0 * delta(p->io_ms, c.io_ms) / stats->elapsed_ms : 0;
+        if (d.util > 100) d.util = 100;
+    }
+
+    stats->nic_count = cur.nic_count;
+    for (int i = 0; i < cur.nic_count; ++i) {
+        const auto &c = cur.nics[i];
+        auto &n = stats->nics[i];
+        memcpy(n.name, c.name, sizeof(n.name));
+        const ProcCounters::Nic *p = &c;
+        for (int j = 0; j < prev.nic_count; ++j) {
+            if (strcmp(prev.nics[j].name, c.name) == 0) {
+                p = &prev.nics[j];
+                break;
+            }
+        }
+        n.rx_bytes_sec = secs > 0 ? delta(p->rx_bytes, c.rx_bytes) / secs : 0;
+        n.tx_bytes_sec = secs > 0 ? delta(p->tx_bytes, c.tx_bytes) / secs : 0;
+        n.rx_packets_sec = secs > 0 ? delta(p->rx_packets, c.rx_packets) / secs : 0;
+        n.tx_packets_sec = secs > 0 ? delta(p->tx_packets, c.tx_packets) / secs : 0;
+        n.errors = delta(p->rx_errors, c.rx_errors) + delta(p->rx_dropped, c.rx_dropped) +
+                   delta(p->tx_errors, c.tx_errors) + delta(p->tx_dropped, c.tx_dropped);
+    }
+}
+
+}  // namespace monitor
+}  // namespace sharkstore
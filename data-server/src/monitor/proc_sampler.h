@@ -0,0 +1,143 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <sys/types.h>
+#include <mutex>
+
+namespace sharkstore {
+namespace monitor {
+
+static const int kProcMaxCpus = 256;
+static const int kProcMaxDisks = 64;
+static const int kProcMaxNics = 32;
+static const int kProcNameLen = 32;
+
+// /proc下的累计计数器，一次采样的原始值
+struct ProcCounters {
+    struct Cpu {
+        uint64_t total = 0;  // user ~ steal之和，单位jiffies
+        uint64_t idle = 0;   // idle + iowait
+    };
+
+    struct Disk {
+        char name[kProcNameLen] = {0};
+        uint64_t reads = 0;
+        uint64_t read_sectors = 0;
+        uint64_t read_ms = 0;
+        uint64_t writes = 0;
+        uint64_t write_sectors = 0;
+        uint64_t write_ms = 0;
+        uint64_t io_ms = 0;
+    };
+
+    struct Nic {
+        char name[kProcNameLen] = {0};
+        uint64_t rx_bytes = 0;
+        uint64_t rx_packets = 0;
+        uint64_t rx_errors = 0;
+        uint64_t rx_dropped = 0;
+        uint64_t tx_bytes = 0;
+        uint64_t tx_packets = 0;
+        uint64_t tx_errors = 0;
+        uint64_t tx_dropped = 0;
+    };
+
+    int64_t time_ms = 0;  // 采样时间（单调时钟）
+
+    Cpu cpu;  // 所有核汇总
+    int cpu_count = 0;
+    Cpu cpus[kProcMaxCpus];
+
+    uint64_t proc_cpu = 0;  // 本进程utime + stime
+
+    int disk_count = 0;
+    Disk disks[kProcMaxDisks];
+
+    int nic_count = 0;
+    Nic nics[kProcMaxNics];
+};
+
+// 两次采样之间的速率
+struct ProcStats {
+    struct Disk {
+        char name[kProcNameLen] = {0};
+        double read_iops = 0;
+        double write_iops = 0;
+        double read_bytes_sec = 0;
+        double write_bytes_sec = 0;
+        double read_latency_ms = 0;   // 平均每次读耗时
+        double write_latency_ms = 0;  // 平均每次写耗时
+        double util = 0;              // 繁忙时间占比（百分比）
+    };
+
+    struct Nic {
+        char name[kProcNameLen] = {0};
+        double rx_bytes_sec = 0;
+        double tx_bytes_sec = 0;
+        double rx_packets_sec = 0;
+        double tx_packets_sec = 0;
+        uint64_t errors = 0;  // 收发错误及丢包数（区间内）
+    };
+
+    int64_t elapsed_ms = 0;  // 为0表示还没有上一次采样，速率均无效
+
+    double cpu_usage = 0;  // 整机cpu使用率（百分比）
+    int cpu_count = 0;
+    double cpu_usages[kProcMaxCpus] = {0};
+
+    double proc_cpu_usage = 0;  // 本进程占整机cpu的百分比
+
+    int disk_count = 0;
+    Disk disks[kProcMaxDisks];
+
+    int nic_count = 0;
+    Nic nics[kProcMaxNics];
+};
+
+// 直接读取/proc的系统指标采样器，取代popen执行shell命令的方式
+// 文件描述符在构造时打开并一直持有，每次采样用pread从头读入固定缓冲区，
+// 解析过程不分配内存
+class ProcSampler {
+public:
+    ProcSampler();
+    ~ProcSampler();
+
+    ProcSampler(const ProcSampler &) = delete;
+    ProcSampler &operator=(const ProcSampler &) = delete;
+
+    // 读取当前的累计计数器，部分文件读取失败时对应部分为空
+    bool Read(ProcCounters *counters);
+
+    // 采样并计算与上一次采样之间的速率
+    bool Sample(ProcStats *stats);
+
+    // 解析各文件的内容，data不要求以'\0'结尾
+    static bool ParseStat(const char *data, size_t len, ProcCounters *counters);
+    static bool ParseSelfStat(const char *data, size_t len, ProcCounters *counters);
+    static bool ParseDiskStats(const char *data, size_t len, ProcCounters *counters);
+    static bool ParseNetDev(const char *data, size_t len, ProcCounters *counters);
+
+    static void Diff(const ProcCounters &prev, const ProcCounters &cur, ProcStats *stats);
+
+private:
+    enum ProcFile { kStat = 0, kSelfStat, kDiskStats, kNetDev, kFileCount };
+
+    bool read(ProcCounters *counters);
+    // 读入buf_，返回读取的长度，失败返回-1
+    ssize_t readFile(ProcFile file);
+
+private:
+    static const size_t kBufferSize = 64 * 1024;
+
+    std::mutex mu_;
+    int fds_[kFileCount];
+    char buf_[kBufferSize];
+
+    ProcCounters counters_[2];
+    int current_ = 0;
+    bool has_prev_ = false;
+};
+
+}  // namespace monitor
+}  // namespace sharkstore
@@ -68,6 +68,8 @@ enum FunctionID {
   kFuncKvBatchDel = 105,
   kFuncKvRangeDel = 106,
   kFuncKvScan = 107,
+  kFuncKvIncr = 109,
+  kFuncKvAppend = 110,
   kFuncLock = 200,
   kFuncLockUpdate = 201,
   kFuncUnlock = 202,
@@ -393,6 +393,46 @@ public:
  ::google::protobuf::internal::ExplicitlyConstructed<DsKvRangeDeleteResponse>
      _instance;
 } _DsKvRangeDeleteResponse_default_instance_;
+class KvIncrRequestDefaultTypeInternal {
+public:
+ ::google::protobuf::internal::ExplicitlyConstructed<KvIncrRequest>
+     _instance;
+} _KvIncrRequest_default_instance_;
+class KvIncrResponseDefaultTypeInternal {
+public:
+ ::google::protobuf::internal::ExplicitlyConstructed<KvIncrResponse>
+     _instance;
+} _KvIncrResponse_default_instance_;
+class DsKvIncrRequestDefaultTypeInternal {
+public:
+ ::google::protobuf::internal::ExplicitlyConstructed<DsKvIncrRequest>
+     _instance;
+} _DsKvIncrRequest_default_instance_;
+class DsKvIncrResponseDefaultTypeInternal {
+public:
+ ::google::protobuf::internal::ExplicitlyConstructed<DsKvIncrResponse>
+     _instance;
+} _DsKvIncrResponse_default_instance_;
+class KvAppendRequestDefaultTypeInternal {
+public:
+ ::google::protobuf::internal::ExplicitlyConstructed<KvAppendRequest>
+     _instance;
+} _KvAppendRequest_default_instance_;
+class KvAppendResponseDefaultTypeInternal {
+public:
+ ::google::protobuf::internal::ExplicitlyConstructed<KvAppendResponse>
+     _instance;
+} _KvAppendResponse_default_instance_;
+class DsKvAppendRequestDefaultTypeInternal {
+public:
+ ::google::protobuf::internal::ExplicitlyConstructed<DsKvAppendRequest>
+     _instance;
+} _DsKvAppendRequest_default_instance_;
+class DsKvAppendResponseDefaultTypeInternal {
+public:
+ ::google::protobuf::internal::ExplicitlyConstructed<DsKvAppendResponse>
+     _instance;
+} _DsKvAppendResponse_default_instance_;
 class LockValueDefaultTypeInternal {
 public:
  ::google::protobuf::internal::ExplicitlyConstructed<LockValue>
@@ -494,7 +534,7 @@ namespace protobuf_kvrpcpb_2eproto {
 
 namespace {
 
-::google::protobuf::Metadata file_level_metadata[94];
+::google::protobuf::Metadata file_level_metadata[102];
 const ::google::protobuf::EnumDescriptor* file_level_enum_descriptors[5];
 
 }  // namespace
@@ -604,6 +644,14 @@ PROTOBUF_CONSTEXPR_VAR ::google::protobuf::internal::ParseTable const
   { NULL, NULL, 0, -1, -1, -1, -1, NULL, false },
   { NULL, NULL, 0, -1, -1, -1, -1, NULL, false },
   { NULL, NULL, 0, -1, -1, -1, -1, NULL, false },
+  { NULL, NULL, 0, -1, -1, -1, -1, NULL, false },
+  { NULL, NULL, 0, -1, -1, -1, -1, NULL, false },
+  { NULL, NULL, 0, -1, -1, -1, -1, NULL, false },
+  { NULL, NULL, 0, -1, -1, -1, -1, NULL, false },
+  { NULL, NULL, 0, -1, -1, -1, -1, NULL, false },
+  { NULL, NULL, 0, -1, -1, -1, -1, NULL, false },
+  { NULL, NULL, 0, -1, -1, -1, -1, NULL, false },
+  { NULL, NULL, 0, -1, -1, -1, -1, NULL, false },
 };
 
 const ::google::protobuf::uint32 TableStruct::offsets[] GOOGLE_ATTRIBUTE_SECTION_VARIABLE(protodesc_cold) = {
@@ -796,6 +844,8 @@ const ::google::protobuf::uint32 TableStruct::offsets[] GOOGLE_ATTRIBUTE_SECTION
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SelectRequest, group_bys_),
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SelectRequest, limit_),
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SelectRequest, timestamp_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SelectRequest, open_snapshot_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SelectRequest, snapshot_id_),
   ~0u,  // no _has_bits_
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Row, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -819,6 +869,7 @@ const ::google::protobuf::uint32 TableStruct::offsets[] GOOGLE_ATTRIBUTE_SECTION
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SelectResponse, code_),
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SelectResponse, rows_),
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SelectResponse, offset_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SelectResponse, snapshot_id_),
   ~0u,  // no _has_bits_
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(KeyValue, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -1044,6 +1095,8 @@ const ::google::protobuf::uint32 TableStruct::offsets[] GOOGLE_ATTRIBUTE_SECTION
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(KvScanRequest, count_only_),
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(KvScanRequest, key_only_),
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(KvScanRequest, max_count_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(KvScanRequest, open_snapshot_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(KvScanRequest, snapshot_id_),
   ~0u,  // no _has_bits_
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(KvScanResponse, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -1053,6 +1106,7 @@ const ::google::protobuf::uint32 TableStruct::offsets[] GOOGLE_ATTRIBUTE_SECTION
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(KvScanResponse, count_),
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(KvScanResponse, kvs_),
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(KvScanResponse, last_key_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(KvScanResponse, snapshot_id_),
   ~0u,  // no _has_bits_
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(DsKvScanRequest, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -1155,6 +1209,60 @@ const ::google::protobuf::uint32 TableStruct::offsets[] GOOGLE_ATTRIBUTE_SECTION
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(DsKvRangeDeleteResponse, header_),
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(DsKvRangeDeleteResponse, resp_),
   ~0u,  // no _has_bits_
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(KvIncrRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(KvIncrRequest, key_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(KvIncrRequest, delta_),
+  ~0u,  // no _has_bits_
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(KvIncrResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(KvIncrResponse, code_),
+  ~0u,  // no _has_bits_
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(DsKvIncrRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(DsKvIncrRequest, header_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(DsKvIncrRequest, req_),
+  ~0u,  // no _has_bits_
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(DsKvIncrResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(DsKvIncrResponse, header_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(DsKvIncrResponse, resp_),
+  ~0u,  // no _has_bits_
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(KvAppendRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(KvAppendRequest, key_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(KvAppendRequest, value_),
+  ~0u,  // no _has_bits_
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(KvAppendResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(KvAppendResponse, code_),
+  ~0u,  // no _has_bits_
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(DsKvAppendRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(DsKvAppendRequest, header_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(DsKvAppendRequest, req_),
+  ~0u,  // no _has_bits_
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(DsKvAppendResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(DsKvAppendResponse, header_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(DsKvAppendResponse, resp_),
+  ~0u,  // no _has_bits_
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(LockValue, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
@@ -1329,74 +1437,82 @@ static const ::google::protobuf::internal::MigrationSchema schemas[] GOOGLE_ATTR
   { 163, -1, sizeof(Limit)},
   { 170, -1, sizeof(DsSelectRequest)},
   { 177, -1, sizeof(SelectRequest)},
-  { 189, -1, sizeof(Row)},
-  { 197, -1, sizeof(DsSelectResponse)},
-  { 204, -1, sizeof(SelectResponse)},
-  { 212, -1, sizeof(KeyValue)},
-  { 220, -1, sizeof(DsInsertRequest)},
-  { 227, -1, sizeof(DsInsertResponse)},
-  { 234, -1, sizeof(InsertRequest)},
-  { 242, -1, sizeof(InsertResponse)},
-  { 250, -1, sizeof(BatchInsertRequest)},
-  { 256, -1, sizeof(BatchInsertResponse)},
-  { 262, -1, sizeof(DsDeleteRequest)},
-  { 269, -1, sizeof(DsDeleteResponse)},
-  { 276, -1, sizeof(DeleteRequest)},
-  { 286, -1, sizeof(DeleteResponse)},
-  { 293, -1, sizeof(Field)},
-  { 300, -1, sizeof(RedisKeyValue)},
-  { 307, -1, sizeof(RedisDo)},
-  { 316, -1, sizeof(KvSetRequest)},
-  { 323, -1, sizeof(KvSetResponse)},
-  { 330, -1, sizeof(DsKvSetRequest)},
-  { 337, -1, sizeof(DsKvSetResponse)},
-  { 344, -1, sizeof(KvGetRequest)},
-  { 350, -1, sizeof(KvGetResponse)},
-  { 357, -1, sizeof(DsKvGetRequest)},
-  { 364, -1, sizeof(DsKvGetResponse)},
-  { 371, -1, sizeof(KvBatchSetRequest)},
-  { 378, -1, sizeof(KvBatchSetResponse)},
-  { 385, -1, sizeof(DsKvBatchSetRequest)},
-  { 392, -1, sizeof(DsKvBatchSetResponse)},
-  { 399, -1, sizeof(KvBatchGetRequest)},
-  { 406, -1, sizeof(KvBatchGetResponse)},
-  { 413, -1, sizeof(DsKvBatchGetRequest)},
-  { 420, -1, sizeof(DsKvBatchGetResponse)},
-  { 427, -1, sizeof(KvScanRequest)},
-  { 437, -1, sizeof(KvScanResponse)},
-  { 446, -1, sizeof(DsKvScanRequest)},
-  { 453, -1, sizeof(DsKvScanResponse)},
-  { 460, -1, sizeof(KvDeleteRequest)},
-  { 467, -1, sizeof(KvDeleteResponse)},
-  { 474, -1, sizeof(DsKvDeleteRequest)},
-  { 481, -1, sizeof(DsKvDeleteResponse)},
-  { 488, -1, sizeof(KvBatchDeleteRequest)},
-  { 495, -1, sizeof(KvBatchDeleteResponse)},
-  { 502, -1, sizeof(DsKvBatchDeleteRequest)},
-  { 509, -1, sizeof(DsKvBatchDeleteResponse)},
-  { 516, -1, sizeof(KvRangeDeleteRequest)},
-  { 525, -1, sizeof(KvRangeDeleteResponse)},
-  { 533, -1, sizeof(DsKvRangeDeleteRequest)},
-  { 540, -1, sizeof(DsKvRangeDeleteResponse)},
-  { 547, -1, sizeof(LockValue)},
-  { 557, -1, sizeof(LockRequest)},
-  { 566, -1, sizeof(DsLockRequest)},
-  { 573, -1, sizeof(LockResponse)},
-  { 582, -1, sizeof(LockInfo)},
-  { 589, -1, sizeof(LockScanResponse)},
-  { 596, -1, sizeof(DsLockResponse)},
-  { 603, -1, sizeof(LockUpdateRequest)},
-  { 613, -1, sizeof(DsLockUpdateRequest)},
-  { 620, -1, sizeof(DsLockUpdateResponse)},
-  { 627, -1, sizeof(UnlockRequest)},
-  { 636, -1, sizeof(DsUnlockRequest)},
-  { 643, -1, sizeof(DsUnlockResponse)},
-  { 650, -1, sizeof(UnlockForceRequest)},
-  { 658, -1, sizeof(DsUnlockForceRequest)},
-  { 665, -1, sizeof(DsUnlockForceResponse)},
-  { 672, -1, sizeof(LockScanRequest)},
-  { 680, -1, sizeof(DsLockScanRequest)},
-  { 687, -1, sizeof(DsLockScanResponse)},
+  { 191, -1, sizeof(Row)},
+  { 199, -1, sizeof(DsSelectResponse)},
+  { 206, -1, sizeof(SelectResponse)},
+  { 215, -1, sizeof(KeyValue)},
+  { 223, -1, sizeof(DsInsertRequest)},
+  { 230, -1, sizeof(DsInsertResponse)},
+  { 237, -1, sizeof(InsertRequest)},
+  { 245, -1, sizeof(InsertResponse)},
+  { 253, -1, sizeof(BatchInsertRequest)},
+  { 259, -1, sizeof(BatchInsertResponse)},
+  { 265, -1, sizeof(DsDeleteRequest)},
+  { 272, -1, sizeof(DsDeleteResponse)},
+  { 279, -1, sizeof(DeleteRequest)},
+  { 289, -1, sizeof(DeleteResponse)},
+  { 296, -1, sizeof(Field)},
+  { 303, -1, sizeof(RedisKeyValue)},
+  { 310, -1, sizeof(RedisDo)},
+  { 319, -1, sizeof(KvSetRequest)},
+  { 326, -1, sizeof(KvSetResponse)},
+  { 333, -1, sizeof(DsKvSetRequest)},
+  { 340, -1, sizeof(DsKvSetResponse)},
+  { 347, -1, sizeof(KvGetRequest)},
+  { 353, -1, sizeof(KvGetResponse)},
+  { 360, -1, sizeof(DsKvGetRequest)},
+  { 367, -1, sizeof(DsKvGetResponse)},
+  { 374, -1, sizeof(KvBatchSetRequest)},
+  { 381, -1, sizeof(KvBatchSetResponse)},
+  { 388, -1, sizeof(DsKvBatchSetRequest)},
+  { 395, -1, sizeof(DsKvBatchSetResponse)},
+  { 402, -1, sizeof(KvBatchGetRequest)},
+  { 409, -1, sizeof(KvBatchGetResponse)},
+  { 416, -1, sizeof(DsKvBatchGetRequest)},
+  { 423, -1, sizeof(DsKvBatchGetResponse)},
+  { 430, -1, sizeof(KvScanRequest)},
+  { 442, -1, sizeof(KvScanResponse)},
+  { 452, -1, sizeof(DsKvScanRequest)},
+  { 459, -1, sizeof(DsKvScanResponse)},
+  { 466, -1, sizeof(KvDeleteRequest)},
+  { 473, -1, sizeof(KvDeleteResponse)},
+  { 480, -1, sizeof(DsKvDeleteRequest)},
+  { 487, -1, sizeof(DsKvDeleteResponse)},
+  { 494, -1, sizeof(KvBatchDeleteRequest)},
+  { 501, -1, sizeof(KvBatchDeleteResponse)},
+  { 508, -1, sizeof(DsKvBatchDeleteRequest)},
+  { 515, -1, sizeof(DsKvBatchDeleteResponse)},
+  { 522, -1, sizeof(KvRangeDeleteRequest)},
+  { 531, -1, sizeof(KvRangeDeleteResponse)},
+  { 539, -1, sizeof(DsKvRangeDeleteRequest)},
+  { 546, -1, sizeof(DsKvRangeDeleteResponse)},
+  { 553, -1, sizeof(KvIncrRequest)},
+  { 560, -1, sizeof(KvIncrResponse)},
+  { 566, -1, sizeof(DsKvIncrRequest)},
+  { 573, -1, sizeof(DsKvIncrResponse)},
+  { 580, -1, sizeof(KvAppendRequest)},
+  { 587, -1, sizeof(KvAppendResponse)},
+  { 593, -1, sizeof(DsKvAppendRequest)},
+  { 600, -1, sizeof(DsKvAppendResponse)},
+  { 607, -1, sizeof(LockValue)},
+  { 617, -1, sizeof(LockRequest)},
+  { 626, -1, sizeof(DsLockRequest)},
+  { 633, -1, sizeof(LockResponse)},
+  { 642, -1, sizeof(LockInfo)},
+  { 649, -1, sizeof(LockScanResponse)},
+  { 656, -1, sizeof(DsLockResponse)},
+  { 663, -1, sizeof(LockUpdateRequest)},
+  { 673, -1, sizeof(DsLockUpdateRequest)},
+  { 680, -1, sizeof(DsLockUpdateResponse)},
+  { 687, -1, sizeof(UnlockRequest)},
+  { 696, -1, sizeof(DsUnlockRequest)},
+  { 703, -1, sizeof(DsUnlockResponse)},
+  { 710, -1, sizeof(UnlockForceRequest)},
+  { 718, -1, sizeof(DsUnlockForceRequest)},
+  { 725, -1, sizeof(DsUnlockForceResponse)},
+  { 732, -1, sizeof(LockScanRequest)},
+  { 740, -1, sizeof(DsLockScanRequest)},
+  { 747, -1, sizeof(DsLockScanResponse)},
 };
 
 static ::google::protobuf::Message const * const file_default_instances[] = {
@@ -1475,6 +1591,14 @@ static ::google::protobuf::Message const * const file_default_instances[] = {
   reinterpret_cast<const ::google::protobuf::Message*>(&_KvRangeDeleteResponse_default_instance_),
   reinterpret_cast<const ::google::protobuf::Message*>(&_DsKvRangeDeleteRequest_default_instance_),
   reinterpret_cast<const ::google::protobuf::Message*>(&_DsKvRangeDeleteResponse_default_instance_),
+  reinterpret_cast<const ::google::protobuf::Message*>(&_KvIncrRequest_default_instance_),
+  reinterpret_cast<const ::google::protobuf::Message*>(&_KvIncrResponse_default_instance_),
+  reinterpret_cast<const ::google::protobuf::Message*>(&_DsKvIncrRequest_default_instance_),
+  reinterpret_cast<const ::google::protobuf::Message*>(&_DsKvIncrResponse_default_instance_),
+  reinterpret_cast<const ::google::protobuf::Message*>(&_KvAppendRequest_default_instance_),
+  reinterpret_cast<const ::google::protobuf::Message*>(&_KvAppendResponse_default_instance_),
+  reinterpret_cast<const ::google::protobuf::Message*>(&_DsKvAppendRequest_default_instance_),
+  reinterpret_cast<const ::google::protobuf::Message*>(&_DsKvAppendResponse_default_instance_),
   reinterpret_cast<const ::google::protobuf::Message*>(&_LockValue_default_instance_),
   reinterpret_cast<const ::google::protobuf::Message*>(&_LockRequest_default_instance_),
   reinterpret_cast<const ::google::protobuf::Message*>(&_DsLockRequest_default_instance_),
@@ -1514,7 +1638,7 @@ void protobuf_AssignDescriptorsOnce() {
 void protobuf_RegisterTypes(const ::std::string&) GOOGLE_ATTRIBUTE_COLD;
 void protobuf_RegisterTypes(const ::std::string&) {
   protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::internal::RegisterAllTypes(file_level_metadata, 94);
+  ::google::protobuf::internal::RegisterAllTypes(file_level_metadata, 102);
 }
 
 }  // namespace
@@ -1675,7 +1799,23 @@ void TableStruct::InitDefaultsImpl() {
   ::google::protobuf::internal::OnShutdownDestroyMessage(
       &_DsKvRangeDeleteRequest_default_instance_);_DsKvRangeDeleteResponse_default_instance_._instance.DefaultConstruct();
   ::google::protobuf::internal::OnShutdownDestroyMessage(
-      &_DsKvRangeDeleteResponse_default_instance_);_LockValue_default_instance_._instance.DefaultConstruct();
+      &_DsKvRangeDeleteResponse_default_instance_);_KvIncrRequest_default_instance_._instance.DefaultConstruct();
+  ::google::protobuf::internal::OnShutdownDestroyMessage(
+      &_KvIncrRequest_default_instance_);_KvIncrResponse_default_instance_._instance.DefaultConstruct();
+  ::google::protobuf::internal::OnShutdownDestroyMessage(
+      &_KvIncrResponse_default_instance_);_DsKvIncrRequest_default_instance_._instance.DefaultConstruct();
+  ::google::protobuf::internal::OnShutdownDestroyMessage(
+      &_DsKvIncrRequest_default_instance_);_DsKvIncrResponse_default_instance_._instance.DefaultConstruct();
+  ::google::protobuf::internal::OnShutdownDestroyMessage(
+      &_DsKvIncrResponse_default_instance_);_KvAppendRequest_default_instance_._instance.DefaultConstruct();
+  ::google::protobuf::internal::OnShutdownDestroyMessage(
+      &_KvAppendRequest_default_instance_);_KvAppendResponse_default_instance_._instance.DefaultConstruct();
+  ::google::protobuf::internal::OnShutdownDestroyMessage(
+      &_KvAppendResponse_default_instance_);_DsKvAppendRequest_default_instance_._instance.DefaultConstruct();
+  ::google::protobuf::internal::OnShutdownDestroyMessage(
+      &_DsKvAppendRequest_default_instance_);_DsKvAppendResponse_default_instance_._instance.DefaultConstruct();
+  ::google::protobuf::internal::OnShutdownDestroyMessage(
+      &_DsKvAppendResponse_default_instance_);_LockValue_default_instance_._instance.DefaultConstruct();
   ::google::protobuf::internal::OnShutdownDestroyMessage(
       &_LockValue_default_instance_);_LockRequest_default_instance_._instance.DefaultConstruct();
   ::google::protobuf::internal::OnShutdownDestroyMessage(
@@ -1863,6 +2003,22 @@ void TableStruct::InitDefaultsImpl() {
       ::kvrpcpb::ResponseHeader::internal_default_instance());
   _DsKvRangeDeleteResponse_default_instance_._instance.get_mutable()->resp_ = const_cast< ::kvrpcpb::KvRangeDeleteResponse*>(
       ::kvrpcpb::KvRangeDeleteResponse::internal_default_instance());
+  _DsKvIncrRequest_default_instance_._instance.get_mutable()->header_ = const_cast< ::kvrpcpb::RequestHeader*>(
+      ::kvrpcpb::RequestHeader::internal_default_instance());
+  _DsKvIncrRequest_default_instance_._instance.get_mutable()->req_ = const_cast< ::kvrpcpb::KvIncrRequest*>(
+      ::kvrpcpb::KvIncrRequest::internal_default_instance());
+  _DsKvIncrResponse_default_instance_._instance.get_mutable()->header_ = const_cast< ::kvrpcpb::ResponseHeader*>(
+      ::kvrpcpb::ResponseHeader::internal_default_instance());
+  _DsKvIncrResponse_default_instance_._instance.get_mutable()->resp_ = const_cast< ::kvrpcpb::KvIncrResponse*>(
+      ::kvrpcpb::KvIncrResponse::internal_default_instance());
+  _DsKvAppendRequest_default_instance_._instance.get_mutable()->header_ = const_cast< ::kvrpcpb::RequestHeader*>(
+      ::kvrpcpb::RequestHeader::internal_default_instance());
+  _DsKvAppendRequest_default_instance_._instance.get_mutable()->req_ = const_cast< ::kvrpcpb::KvAppendRequest*>(
+      ::kvrpcpb::KvAppendRequest::internal_default_instance());
+  _DsKvAppendResponse_default_instance_._instance.get_mutable()->header_ = const_cast< ::kvrpcpb::ResponseHeader*>(
+      ::kvrpcpb::ResponseHeader::internal_default_instance());
+  _DsKvAppendResponse_default_instance_._instance.get_mutable()->resp_ = const_cast< ::kvrpcpb::KvAppendResponse*>(
+      ::kvrpcpb::KvAppendResponse::internal_default_instance());
   _LockRequest_default_instance_._instance.get_mutable()->value_ = const_cast< ::kvrpcpb::LockValue*>(
       ::kvrpcpb::LockValue::internal_default_instance());
   _LockRequest_default_instance_._instance.get_mutable()->timestamp_ = const_cast< ::timestamp::Timestamp*>(
@@ -1978,174 +2134,192 @@ void AddDescriptorsImpl() {
       "et\030\001 \001(\004\022\r\n\005count\030\002 \001(\004\"^\n\017DsSelectReque"
       "st\022&\n\006header\030\001 \001(\0132\026.kvrpcpb.RequestHead"
       "er\022#\n\003req\030\002 \001(\0132\026.kvrpcpb.SelectRequest\""
-      "\367\001\n\rSelectRequest\022\013\n\003key\030\001 \001(\014\022\035\n\005scope\030"
+      "\243\002\n\rSelectRequest\022\013\n\003key\030\001 \001(\014\022\035\n\005scope\030"
       "\002 \001(\0132\016.kvrpcpb.Scope\022(\n\nfield_list\030\003 \003("
       "\0132\024.kvrpcpb.SelectField\022%\n\rwhere_filters"
       "\030\004 \003(\0132\016.kvrpcpb.Match\022!\n\tgroup_bys\030\005 \003("
       "\0132\016.metapb.Column\022\035\n\005limit\030\006 \001(\0132\016.kvrpc"
       "pb.Limit\022\'\n\ttimestamp\030\007 \001(\0132\024.timestamp."
-      "Timestamp\"9\n\003Row\022\013\n\003key\030\001 \001(\014\022\016\n\006fields\030"
-      "\002 \001(\014\022\025\n\raggred_counts\030\003 \003(\003\"b\n\020DsSelect"
-      "Response\022\'\n\006header\030\001 \001(\0132\027.kvrpcpb.Respo"
-      "nseHeader\022%\n\004resp\030\002 \001(\0132\027.kvrpcpb.Select"
-      "Response\"J\n\016SelectResponse\022\014\n\004code\030\001 \001(\005"
-      "\022\032\n\004rows\030\002 \003(\0132\014.kvrpcpb.Row\022\016\n\006offset\030\003"
-      " \001(\004\"8\n\010KeyValue\022\013\n\003Key\030\001 \001(\014\022\r\n\005Value\030\002"
-      " \001(\014\022\020\n\010ExpireAt\030\003 \001(\003\"^\n\017DsInsertReques"
-      "t\022&\n\006header\030\001 \001(\0132\026.kvrpcpb.RequestHeade"
-      "r\022#\n\003req\030\002 \001(\0132\026.kvrpcpb.InsertRequest\"b"
-      "\n\020DsInsertResponse\022\'\n\006header\030\001 \001(\0132\027.kvr"
-      "pcpb.ResponseHeader\022%\n\004resp\030\002 \001(\0132\027.kvrp"
-      "cpb.InsertResponse\"r\n\rInsertRequest\022\037\n\004r"
-      "ows\030\001 \003(\0132\021.kvrpcpb.KeyValue\022\027\n\017check_du"
-      "plicate\030\002 \001(\010\022\'\n\ttimestamp\030\003 \001(\0132\024.times"
-      "tamp.Timestamp\"L\n\016InsertResponse\022\014\n\004code"
-      "\030\001 \001(\005\022\025\n\raffected_keys\030\002 \001(\004\022\025\n\rduplica"
-      "te_key\030\003 \001(\014\":\n\022BatchInsertRequest\022$\n\004re"
-      "qs\030\001 \003(\0132\026.kvrpcpb.InsertRequest\"=\n\023Batc"
-      "hInsertResponse\022&\n\005resps\030\002 \003(\0132\027.kvrpcpb"
-      ".InsertResponse\"^\n\017DsDeleteRequest\022&\n\006he"
-      "ader\030\001 \001(\0132\026.kvrpcpb.RequestHeader\022#\n\003re"
-      "q\030\002 \001(\0132\026.kvrpcpb.DeleteRequest\"b\n\020DsDel"
-      "eteResponse\022\'\n\006header\030\001 \001(\0132\027.kvrpcpb.Re"
-      "sponseHeader\022%\n\004resp\030\002 \001(\0132\027.kvrpcpb.Del"
-      "eteResponse\"\233\001\n\rDeleteRequest\022\013\n\003key\030\001 \001"
-      "(\014\022\035\n\005scope\030\002 \001(\0132\016.kvrpcpb.Scope\022%\n\rwhe"
-      "re_filters\030\003 \003(\0132\016.kvrpcpb.Match\022\016\n\006inde"
-      "xs\030\004 \003(\004\022\'\n\ttimestamp\030\n \001(\0132\024.timestamp."
-      "Timestamp\"5\n\016DeleteResponse\022\014\n\004code\030\001 \001("
-      "\005\022\025\n\raffected_keys\030\002 \001(\004\")\n\005Field\022\021\n\tcol"
-      "umn_id\030\001 \001(\004\022\r\n\005value\030\002 \001(\014\"+\n\rRedisKeyV"
-      "alue\022\013\n\003key\030\001 \001(\014\022\r\n\005value\030\002 \001(\014\"g\n\007Redi"
-      "sDo\022\013\n\003key\030\001 \001(\014\022\r\n\005value\030\002 \001(\014\022\036\n\002op\030\003 "
-      "\001(\0162\022.kvrpcpb.Operation\022 \n\004case\030\004 \001(\0162\022."
-      "kvrpcpb.ExistCase\"T\n\014KvSetRequest\022\"\n\002kv\030"
-      "\001 \001(\0132\026.kvrpcpb.RedisKeyValue\022 \n\004case\030\002 "
-      "\001(\0162\022.kvrpcpb.ExistCase\"4\n\rKvSetResponse"
-      "\022\014\n\004code\030\001 \001(\005\022\025\n\raffected_keys\030\002 \001(\004\"\\\n"
-      "\016DsKvSetRequest\022&\n\006header\030\001 \001(\0132\026.kvrpcp"
-      "b.RequestHeader\022\"\n\003req\030\002 \001(\0132\025.kvrpcpb.K"
-      "vSetRequest\"`\n\017DsKvSetResponse\022\'\n\006header"
-      "\030\001 \001(\0132\027.kvrpcpb.ResponseHeader\022$\n\004resp\030"
-      "\002 \001(\0132\026.kvrpcpb.KvSetResponse\"\033\n\014KvGetRe"
-      "quest\022\013\n\003key\030\001 \001(\014\",\n\rKvGetResponse\022\014\n\004c"
-      "ode\030\001 \001(\005\022\r\n\005value\030\002 \001(\014\"\\\n\016DsKvGetReque"
-      "st\022&\n\006header\030\001 \001(\0132\026.kvrpcpb.RequestHead"
-      "er\022\"\n\003req\030\002 \001(\0132\025.kvrpcpb.KvGetRequest\"`"
-      "\n\017DsKvGetResponse\022\'\n\006header\030\001 \001(\0132\027.kvrp"
-      "cpb.ResponseHeader\022$\n\004resp\030\002 \001(\0132\026.kvrpc"
-      "pb.KvGetResponse\"Z\n\021KvBatchSetRequest\022#\n"
-      "\003kvs\030\001 \003(\0132\026.kvrpcpb.RedisKeyValue\022 \n\004ca"
-      "se\030\002 \001(\0162\022.kvrpcpb.ExistCase\"9\n\022KvBatchS"
-      "etResponse\022\014\n\004code\030\001 \001(\005\022\025\n\raffected_key"
-      "s\030\002 \001(\004\"f\n\023DsKvBatchSetRequest\022&\n\006header"
-      "\030\001 \001(\0132\026.kvrpcpb.RequestHeader\022\'\n\003req\030\002 "
-      "\001(\0132\032.kvrpcpb.KvBatchSetRequest\"j\n\024DsKvB"
-      "atchSetResponse\022\'\n\006header\030\001 \001(\0132\027.kvrpcp"
-      "b.ResponseHeader\022)\n\004resp\030\002 \001(\0132\033.kvrpcpb"
-      ".KvBatchSetResponse\"/\n\021KvBatchGetRequest"
-      "\022\014\n\004code\030\001 \001(\005\022\014\n\004keys\030\002 \003(\014\"G\n\022KvBatchG"
-      "etResponse\022\014\n\004code\030\001 \001(\005\022#\n\003kvs\030\002 \003(\0132\026."
-      "kvrpcpb.RedisKeyValue\"f\n\023DsKvBatchGetReq"
-      "uest\022&\n\006header\030\001 \001(\0132\026.kvrpcpb.RequestHe"
-      "ader\022\'\n\003req\030\002 \001(\0132\032.kvrpcpb.KvBatchGetRe"
-      "quest\"j\n\024DsKvBatchGetResponse\022\'\n\006header\030"
-      "\001 \001(\0132\027.kvrpcpb.ResponseHeader\022)\n\004resp\030\002"
-      " \001(\0132\033.kvrpcpb.KvBatchGetResponse\"f\n\rKvS"
-      "canRequest\022\r\n\005start\030\001 \001(\014\022\r\n\005limit\030\002 \001(\014"
-      "\022\022\n\ncount_only\030\003 \001(\010\022\020\n\010key_only\030\004 \001(\010\022\021"
-      "\n\tmax_count\030\005 \001(\003\"d\n\016KvScanResponse\022\014\n\004c"
-      "ode\030\001 \001(\005\022\r\n\005count\030\002 \001(\003\022#\n\003kvs\030\003 \003(\0132\026."
-      "kvrpcpb.RedisKeyValue\022\020\n\010last_key\030\004 \001(\014\""
-      "^\n\017DsKvScanRequest\022&\n\006header\030\001 \001(\0132\026.kvr"
-      "pcpb.RequestHeader\022#\n\003req\030\002 \001(\0132\026.kvrpcp"
-      "b.KvScanRequest\"b\n\020DsKvScanResponse\022\'\n\006h"
-      "eader\030\001 \001(\0132\027.kvrpcpb.ResponseHeader\022%\n\004"
-      "resp\030\002 \001(\0132\027.kvrpcpb.KvScanResponse\"@\n\017K"
-      "vDeleteRequest\022\013\n\003key\030\001 \001(\014\022 \n\004case\030\002 \001("
-      "\0162\022.kvrpcpb.ExistCase\"7\n\020KvDeleteRespons"
-      "e\022\014\n\004code\030\001 \001(\005\022\025\n\raffected_keys\030\002 \001(\004\"b"
-      "\n\021DsKvDeleteRequest\022&\n\006header\030\001 \001(\0132\026.kv"
-      "rpcpb.RequestHeader\022%\n\003req\030\002 \001(\0132\030.kvrpc"
-      "pb.KvDeleteRequest\"f\n\022DsKvDeleteResponse"
+      "Timestamp\022\025\n\ropen_snapshot\030\010 \001(\010\022\023\n\013snap"
+      "shot_id\030\t \001(\004\"9\n\003Row\022\013\n\003key\030\001 \001(\014\022\016\n\006fie"
+      "lds\030\002 \001(\014\022\025\n\raggred_counts\030\003 \003(\003\"b\n\020DsSe"
+      "lectResponse\022\'\n\006header\030\001 \001(\0132\027.kvrpcpb.R"
+      "esponseHeader\022%\n\004resp\030\002 \001(\0132\027.kvrpcpb.Se"
+      "lectResponse\"_\n\016SelectResponse\022\014\n\004code\030\001"
+      " \001(\005\022\032\n\004rows\030\002 \003(\0132\014.kvrpcpb.Row\022\016\n\006offs"
+      "et\030\003 \001(\004\022\023\n\013snapshot_id\030\004 \001(\004\"8\n\010KeyValu"
+      "e\022\013\n\003Key\030\001 \001(\014\022\r\n\005Value\030\002 \001(\014\022\020\n\010ExpireA"
+      "t\030\003 \001(\003\"^\n\017DsInsertRequest\022&\n\006header\030\001 \001"
+      "(\0132\026.kvrpcpb.RequestHeader\022#\n\003req\030\002 \001(\0132"
+      "\026.kvrpcpb.InsertRequest\"b\n\020DsInsertRespo"
+      "nse\022\'\n\006header\030\001 \001(\0132\027.kvrpcpb.ResponseHe"
+      "ader\022%\n\004resp\030\002 \001(\0132\027.kvrpcpb.InsertRespo"
+      "nse\"r\n\rInsertRequest\022\037\n\004rows\030\001 \003(\0132\021.kvr"
+      "pcpb.KeyValue\022\027\n\017check_duplicate\030\002 \001(\010\022\'"
+      "\n\ttimestamp\030\003 \001(\0132\024.timestamp.Timestamp\""
+      "L\n\016InsertResponse\022\014\n\004code\030\001 \001(\005\022\025\n\raffec"
+      "ted_keys\030\002 \001(\004\022\025\n\rduplicate_key\030\003 \001(\014\":\n"
+      "\022BatchInsertRequest\022$\n\004reqs\030\001 \003(\0132\026.kvrp"
+      "cpb.InsertRequest\"=\n\023BatchInsertResponse"
+      "\022&\n\005resps\030\002 \003(\0132\027.kvrpcpb.InsertResponse"
+      "\"^\n\017DsDeleteRequest\022&\n\006header\030\001 \001(\0132\026.kv"
+      "rpcpb.RequestHeader\022#\n\003req\030\002 \001(\0132\026.kvrpc"
+      "pb.DeleteRequest\"b\n\020DsDeleteResponse\022\'\n\006"
+      "header\030\001 \001(\0132\027.kvrpcpb.ResponseHeader\022%\n"
+      "\004resp\030\002 \001(\0132\027.kvrpcpb.DeleteResponse\"\233\001\n"
+      "\rDeleteRequest\022\013\n\003key\030\001 \001(\014\022\035\n\005scope\030\002 \001"
+      "(\0132\016.kvrpcpb.Scope\022%\n\rwhere_filters\030\003 \003("
+      "\0132\016.kvrpcpb.Match\022\016\n\006indexs\030\004 \003(\004\022\'\n\ttim"
+      "estamp\030\n \001(\0132\024.timestamp.Timestamp\"5\n\016De"
+      "leteResponse\022\014\n\004code\030\001 \001(\005\022\025\n\raffected_k"
+      "eys\030\002 \001(\004\")\n\005Field\022\021\n\tcolumn_id\030\001 \001(\004\022\r\n"
+      "\005value\030\002 \001(\014\"+\n\rRedisKeyValue\022\013\n\003key\030\001 \001"
+      "(\014\022\r\n\005value\030\002 \001(\014\"g\n\007RedisDo\022\013\n\003key\030\001 \001("
+      "\014\022\r\n\005value\030\002 \001(\014\022\036\n\002op\030\003 \001(\0162\022.kvrpcpb.O"
+      "peration\022 \n\004case\030\004 \001(\0162\022.kvrpcpb.ExistCa"
+      "se\"T\n\014KvSetRequest\022\"\n\002kv\030\001 \001(\0132\026.kvrpcpb"
+      ".RedisKeyValue\022 \n\004case\030\002 \001(\0162\022.kvrpcpb.E"
+      "xistCase\"4\n\rKvSetResponse\022\014\n\004code\030\001 \001(\005\022"
+      "\025\n\raffected_keys\030\002 \001(\004\"\\\n\016DsKvSetRequest"
+      "\022&\n\006header\030\001 \001(\0132\026.kvrpcpb.RequestHeader"
+      "\022\"\n\003req\030\002 \001(\0132\025.kvrpcpb.KvSetRequest\"`\n\017"
+      "DsKvSetResponse\022\'\n\006header\030\001 \001(\0132\027.kvrpcp"
+      "b.ResponseHeader\022$\n\004resp\030\002 \001(\0132\026.kvrpcpb"
+      ".KvSetResponse\"\033\n\014KvGetRequest\022\013\n\003key\030\001 "
+      "\001(\014\",\n\rKvGetResponse\022\014\n\004code\030\001 \001(\005\022\r\n\005va"
+      "lue\030\002 \001(\014\"\\\n\016DsKvGetRequest\022&\n\006header\030\001 "
+      "\001(\0132\026.kvrpcpb.RequestHeader\022\"\n\003req\030\002 \001(\013"
+      "2\025.kvrpcpb.KvGetRequest\"`\n\017DsKvGetRespon"
+      "se\022\'\n\006header\030\001 \001(\0132\027.kvrpcpb.ResponseHea"
+      "der\022$\n\004resp\030\002 \001(\0132\026.kvrpcpb.KvGetRespons"
+      "e\"Z\n\021KvBatchSetRequest\022#\n\003kvs\030\001 \003(\0132\026.kv"
+      "rpcpb.RedisKeyValue\022 \n\004case\030\002 \001(\0162\022.kvrp"
+      "cpb.ExistCase\"9\n\022KvBatchSetResponse\022\014\n\004c"
+      "ode\030\001 \001(\005\022\025\n\raffected_keys\030\002 \001(\004\"f\n\023DsKv"
+      "BatchSetRequest\022&\n\006header\030\001 \001(\0132\026.kvrpcp"
+      "b.RequestHeader\022\'\n\003req\030\002 \001(\0132\032.kvrpcpb.K"
+      "vBatchSetRequest\"j\n\024DsKvBatchSetResponse"
       "\022\'\n\006header\030\001 \001(\0132\027.kvrpcpb.ResponseHeade"
-      "r\022\'\n\004resp\030\002 \001(\0132\031.kvrpcpb.KvDeleteRespon"
-      "se\"F\n\024KvBatchDeleteRequest\022\014\n\004keys\030\001 \003(\014"
-      "\022 \n\004case\030\002 \001(\0162\022.kvrpcpb.ExistCase\"<\n\025Kv"
-      "BatchDeleteResponse\022\014\n\004code\030\001 \001(\005\022\025\n\raff"
-      "ected_keys\030\002 \001(\004\"l\n\026DsKvBatchDeleteReque"
-      "st\022&\n\006header\030\001 \001(\0132\026.kvrpcpb.RequestHead"
-      "er\022*\n\003req\030\002 \001(\0132\035.kvrpcpb.KvBatchDeleteR"
-      "equest\"p\n\027DsKvBatchDeleteResponse\022\'\n\006hea"
-      "der\030\001 \001(\0132\027.kvrpcpb.ResponseHeader\022,\n\004re"
-      "sp\030\002 \001(\0132\036.kvrpcpb.KvBatchDeleteResponse"
-      "\"i\n\024KvRangeDeleteRequest\022\r\n\005start\030\001 \001(\014\022"
-      "\r\n\005limit\030\002 \001(\014\022\021\n\tmax_count\030\003 \001(\003\022 \n\004cas"
-      "e\030\004 \001(\0162\022.kvrpcpb.ExistCase\"N\n\025KvRangeDe"
+      "r\022)\n\004resp\030\002 \001(\0132\033.kvrpcpb.KvBatchSetResp"
+      "onse\"/\n\021KvBatchGetRequest\022\014\n\004code\030\001 \001(\005\022"
+      "\014\n\004keys\030\002 \003(\014\"G\n\022KvBatchGetResponse\022\014\n\004c"
+      "ode\030\001 \001(\005\022#\n\003kvs\030\002 \003(\0132\026.kvrpcpb.RedisKe"
+      "yValue\"f\n\023DsKvBatchGetRequest\022&\n\006header\030"
+      "\001 \001(\0132\026.kvrpcpb.RequestHeader\022\'\n\003req\030\002 \001"
+      "(\0132\032.kvrpcpb.KvBatchGetRequest\"j\n\024DsKvBa"
+      "tchGetResponse\022\'\n\006header\030\001 \001(\0132\027.kvrpcpb"
+      ".ResponseHeader\022)\n\004resp\030\002 \001(\0132\033.kvrpcpb."
+      "KvBatchGetResponse\"\222\001\n\rKvScanRequest\022\r\n\005"
+      "start\030\001 \001(\014\022\r\n\005limit\030\002 \001(\014\022\022\n\ncount_only"
+      "\030\003 \001(\010\022\020\n\010key_only\030\004 \001(\010\022\021\n\tmax_count\030\005 "
+      "\001(\003\022\025\n\ropen_snapshot\030\006 \001(\010\022\023\n\013snapshot_i"
+      "d\030\007 \001(\004\"y\n\016KvScanResponse\022\014\n\004code\030\001 \001(\005\022"
+      "\r\n\005count\030\002 \001(\003\022#\n\003kvs\030\003 \003(\0132\026.kvrpcpb.Re"
+      "disKeyValue\022\020\n\010last_key\030\004 \001(\014\022\023\n\013snapsho"
+      "t_id\030\005 \001(\004\"^\n\017DsKvScanRequest\022&\n\006header\030"
+      "\001 \001(\0132\026.kvrpcpb.RequestHeader\022#\n\003req\030\002 \001"
+      "(\0132\026.kvrpcpb.KvScanRequest\"b\n\020DsKvScanRe"
+      "sponse\022\'\n\006header\030\001 \001(\0132\027.kvrpcpb.Respons"
+      "eHeader\022%\n\004resp\030\002 \001(\0132\027.kvrpcpb.KvScanRe"
+      "sponse\"@\n\017KvDeleteRequest\022\013\n\003key\030\001 \001(\014\022 "
+      "\n\004case\030\002 \001(\0162\022.kvrpcpb.ExistCase\"7\n\020KvDe"
       "leteResponse\022\014\n\004code\030\001 \001(\005\022\025\n\raffected_k"
-      "eys\030\002 \001(\004\022\020\n\010last_key\030\003 \001(\014\"l\n\026DsKvRange"
+      "eys\030\002 \001(\004\"b\n\021DsKvDeleteRequest\022&\n\006header"
+      "\030\001 \001(\0132\026.kvrpcpb.RequestHeader\022%\n\003req\030\002 "
+      "\001(\0132\030.kvrpcpb.KvDeleteRequest\"f\n\022DsKvDel"
+      "eteResponse\022\'\n\006header\030\001 \001(\0132\027.kvrpcpb.Re"
+      "sponseHeader\022\'\n\004resp\030\002 \001(\0132\031.kvrpcpb.KvD"
+      "eleteResponse\"F\n\024KvBatchDeleteRequest\022\014\n"
+      "\004keys\030\001 \003(\014\022 \n\004case\030\002 \001(\0162\022.kvrpcpb.Exis"
+      "tCase\"<\n\025KvBatchDeleteResponse\022\014\n\004code\030\001"
+      " \001(\005\022\025\n\raffected_keys\030\002 \001(\004\"l\n\026DsKvBatch"
       "DeleteRequest\022&\n\006header\030\001 \001(\0132\026.kvrpcpb."
-      "RequestHeader\022*\n\003req\030\002 \001(\0132\035.kvrpcpb.KvR"
-      "angeDeleteRequest\"p\n\027DsKvRangeDeleteResp"
+      "RequestHeader\022*\n\003req\030\002 \001(\0132\035.kvrpcpb.KvB"
+      "atchDeleteRequest\"p\n\027DsKvBatchDeleteResp"
       "onse\022\'\n\006header\030\001 \001(\0132\027.kvrpcpb.ResponseH"
-      "eader\022,\n\004resp\030\002 \001(\0132\036.kvrpcpb.KvRangeDel"
-      "eteResponse\"e\n\tLockValue\022\r\n\005value\030\002 \001(\014\022"
-      "\n\n\002id\030\003 \001(\t\022\023\n\013delete_time\030\004 \001(\003\022\023\n\013upda"
-      "te_time\030\005 \001(\003\022\023\n\013delete_flag\030\006 \001(\010\"r\n\013Lo"
-      "ckRequest\022\013\n\003key\030\001 \001(\014\022!\n\005value\030\002 \001(\0132\022."
-      "kvrpcpb.LockValue\022\'\n\ttimestamp\030\n \001(\0132\024.t"
-      "imestamp.Timestamp\022\n\n\002by\030\013 \001(\t\"Z\n\rDsLock"
-      "Request\022&\n\006header\030\001 \001(\0132\026.kvrpcpb.Reques"
-      "tHeader\022!\n\003req\030\002 \001(\0132\024.kvrpcpb.LockReque"
-      "st\"O\n\014LockResponse\022\014\n\004code\030\001 \001(\003\022\r\n\005erro"
-      "r\030\002 \001(\t\022\r\n\005value\030\003 \001(\014\022\023\n\013update_time\030\004 "
-      "\001(\003\":\n\010LockInfo\022\013\n\003key\030\001 \001(\014\022!\n\005value\030\002 "
-      "\001(\0132\022.kvrpcpb.LockValue\"E\n\020LockScanRespo"
-      "nse\022\037\n\004info\030\001 \003(\0132\021.kvrpcpb.LockInfo\022\020\n\010"
-      "last_key\030\002 \001(\014\"^\n\016DsLockResponse\022\'\n\006head"
-      "er\030\001 \001(\0132\027.kvrpcpb.ResponseHeader\022#\n\004res"
-      "p\030\002 \001(\0132\025.kvrpcpb.LockResponse\"\200\001\n\021LockU"
-      "pdateRequest\022\013\n\003key\030\001 \001(\014\022\n\n\002id\030\003 \001(\t\022\023\n"
-      "\013update_time\030\005 \001(\003\022\024\n\014update_value\030\006 \001(\014"
-      "\022\'\n\ttimestamp\030\n \001(\0132\024.timestamp.Timestam"
-      "p\"f\n\023DsLockUpdateRequest\022&\n\006header\030\001 \001(\013"
-      "2\026.kvrpcpb.RequestHeader\022\'\n\003req\030\002 \001(\0132\032."
-      "kvrpcpb.LockUpdateRequest\"d\n\024DsLockUpdat"
-      "eResponse\022\'\n\006header\030\001 \001(\0132\027.kvrpcpb.Resp"
-      "onseHeader\022#\n\004resp\030\002 \001(\0132\025.kvrpcpb.LockR"
-      "esponse\"]\n\rUnlockRequest\022\013\n\003key\030\001 \001(\014\022\n\n"
-      "\002id\030\003 \001(\t\022\'\n\ttimestamp\030\n \001(\0132\024.timestamp"
-      ".Timestamp\022\n\n\002by\030\013 \001(\t\"^\n\017DsUnlockReques"
-      "t\022&\n\006header\030\001 \001(\0132\026.kvrpcpb.RequestHeade"
-      "r\022#\n\003req\030\002 \001(\0132\026.kvrpcpb.UnlockRequest\"`"
-      "\n\020DsUnlockResponse\022\'\n\006header\030\001 \001(\0132\027.kvr"
+      "eader\022,\n\004resp\030\002 \001(\0132\036.kvrpcpb.KvBatchDel"
+      "eteResponse\"i\n\024KvRangeDeleteRequest\022\r\n\005s"
+      "tart\030\001 \001(\014\022\r\n\005limit\030\002 \001(\014\022\021\n\tmax_count\030\003"
+      " \001(\003\022 \n\004case\030\004 \001(\0162\022.kvrpcpb.ExistCase\"N"
+      "\n\025KvRangeDeleteResponse\022\014\n\004code\030\001 \001(\005\022\025\n"
+      "\raffected_keys\030\002 \001(\004\022\020\n\010last_key\030\003 \001(\014\"l"
+      "\n\026DsKvRangeDeleteRequest\022&\n\006header\030\001 \001(\013"
+      "2\026.kvrpcpb.RequestHeader\022*\n\003req\030\002 \001(\0132\035."
+      "kvrpcpb.KvRangeDeleteRequest\"p\n\027DsKvRang"
+      "eDeleteResponse\022\'\n\006header\030\001 \001(\0132\027.kvrpcp"
+      "b.ResponseHeader\022,\n\004resp\030\002 \001(\0132\036.kvrpcpb"
+      ".KvRangeDeleteResponse\"+\n\rKvIncrRequest\022"
+      "\013\n\003key\030\001 \001(\014\022\r\n\005delta\030\002 \001(\003\"\036\n\016KvIncrRes"
+      "ponse\022\014\n\004code\030\001 \001(\005\"^\n\017DsKvIncrRequest\022&"
+      "\n\006header\030\001 \001(\0132\026.kvrpcpb.RequestHeader\022#"
+      "\n\003req\030\002 \001(\0132\026.kvrpcpb.KvIncrRequest\"b\n\020D"
+      "sKvIncrResponse\022\'\n\006header\030\001 \001(\0132\027.kvrpcp"
+      "b.ResponseHeader\022%\n\004resp\030\002 \001(\0132\027.kvrpcpb"
+      ".KvIncrResponse\"-\n\017KvAppendRequest\022\013\n\003ke"
+      "y\030\001 \001(\014\022\r\n\005value\030\002 \001(\014\" \n\020KvAppendRespon"
+      "se\022\014\n\004code\030\001 \001(\005\"b\n\021DsKvAppendRequest\022&\n"
+      "\006header\030\001 \001(\0132\026.kvrpcpb.RequestHeader\022%\n"
+      "\003req\030\002 \001(\0132\030.kvrpcpb.KvAppendRequest\"f\n\022"
+      "DsKvAppendResponse\022\'\n\006header\030\001 \001(\0132\027.kvr"
+      "pcpb.ResponseHeader\022\'\n\004resp\030\002 \001(\0132\031.kvrp"
+      "cpb.KvAppendResponse\"e\n\tLockValue\022\r\n\005val"
+      "ue\030\002 \001(\014\022\n\n\002id\030\003 \001(\t\022\023\n\013delete_time\030\004 \001("
+      "\003\022\023\n\013update_time\030\005 \001(\003\022\023\n\013delete_flag\030\006 "
+      "\001(\010\"r\n\013LockRequest\022\013\n\003key\030\001 \001(\014\022!\n\005value"
+      "\030\002 \001(\0132\022.kvrpcpb.LockValue\022\'\n\ttimestamp\030"
+      "\n \001(\0132\024.timestamp.Timestamp\022\n\n\002by\030\013 \001(\t\""
+      "Z\n\rDsLockRequest\022&\n\006header\030\001 \001(\0132\026.kvrpc"
+      "pb.RequestHeader\022!\n\003req\030\002 \001(\0132\024.kvrpcpb."
+      "LockRequest\"O\n\014LockResponse\022\014\n\004code\030\001 \001("
+      "\003\022\r\n\005error\030\002 \001(\t\022\r\n\005value\030\003 \001(\014\022\023\n\013updat"
+      "e_time\030\004 \001(\003\":\n\010LockInfo\022\013\n\003key\030\001 \001(\014\022!\n"
+      "\005value\030\002 \001(\0132\022.kvrpcpb.LockValue\"E\n\020Lock"
+      "ScanResponse\022\037\n\004info\030\001 \003(\0132\021.kvrpcpb.Loc"
+      "kInfo\022\020\n\010last_key\030\002 \001(\014\"^\n\016DsLockRespons"
+      "e\022\'\n\006header\030\001 \001(\0132\027.kvrpcpb.ResponseHead"
+      "er\022#\n\004resp\030\002 \001(\0132\025.kvrpcpb.LockResponse\""
+      "\200\001\n\021LockUpdateRequest\022\013\n\003key\030\001 \001(\014\022\n\n\002id"
+      "\030\003 \001(\t\022\023\n\013update_time\030\005 \001(\003\022\024\n\014update_va"
+      "lue\030\006 \001(\014\022\'\n\ttimestamp\030\n \001(\0132\024.timestamp"
+      ".Timestamp\"f\n\023DsLockUpdateRequest\022&\n\006hea"
+      "der\030\001 \001(\0132\026.kvrpcpb.RequestHeader\022\'\n\003req"
+      "\030\002 \001(\0132\032.kvrpcpb.LockUpdateRequest\"d\n\024Ds"
+      "LockUpdateResponse\022\'\n\006header\030\001 \001(\0132\027.kvr"
       "pcpb.ResponseHeader\022#\n\004resp\030\002 \001(\0132\025.kvrp"
-      "cpb.LockResponse\"V\n\022UnlockForceRequest\022\013"
-      "\n\003key\030\001 \001(\014\022\'\n\ttimestamp\030\n \001(\0132\024.timesta"
-      "mp.Timestamp\022\n\n\002by\030\013 \001(\t\"h\n\024DsUnlockForc"
-      "eRequest\022&\n\006header\030\001 \001(\0132\026.kvrpcpb.Reque"
-      "stHeader\022(\n\003req\030\002 \001(\0132\033.kvrpcpb.UnlockFo"
-      "rceRequest\"e\n\025DsUnlockForceResponse\022\'\n\006h"
-      "eader\030\001 \001(\0132\027.kvrpcpb.ResponseHeader\022#\n\004"
-      "resp\030\002 \001(\0132\025.kvrpcpb.LockResponse\">\n\017Loc"
-      "kScanRequest\022\r\n\005start\030\001 \001(\014\022\r\n\005limit\030\002 \001"
-      "(\014\022\r\n\005count\030\003 \001(\r\"b\n\021DsLockScanRequest\022&"
-      "\n\006header\030\001 \001(\0132\026.kvrpcpb.RequestHeader\022%"
-      "\n\003req\030\002 \001(\0132\030.kvrpcpb.LockScanRequest\"f\n"
-      "\022DsLockScanResponse\022\'\n\006header\030\001 \001(\0132\027.kv"
-      "rpcpb.ResponseHeader\022\'\n\004resp\030\002 \001(\0132\031.kvr"
-      "pcpb.LockScanResponse*;\n\013ExecuteType\022\017\n\013"
-      "ExecInvalid\020\000\022\013\n\007ExecPut\020\001\022\016\n\nExecDelete"
-      "\020\002*k\n\tMatchType\022\013\n\007Invalid\020\000\022\t\n\005Equal\020\001\022"
-      "\014\n\010NotEqual\020\002\022\010\n\004Less\020\003\022\017\n\013LessOrEqual\020\004"
-      "\022\n\n\006Larger\020\005\022\021\n\rLargerOrEqual\020\006*Z\n\tExist"
-      "Case\022\016\n\nEC_Invalid\020\000\022\020\n\014EC_NotExists\020\001\022\r"
-      "\n\tEC_Exists\020\002\022\016\n\nEC_AnyCase\020\003\022\014\n\010EC_Forc"
-      "e\020\004*B\n\tOperation\022\016\n\nOP_Invalid\020\000\022\n\n\006OP_S"
-      "et\020\001\022\r\n\tOP_Delete\020\002\022\n\n\006OP_Get\020\003b\006proto3"
+      "cpb.LockResponse\"]\n\rUnlockRequest\022\013\n\003key"
+      "\030\001 \001(\014\022\n\n\002id\030\003 \001(\t\022\'\n\ttimestamp\030\n \001(\0132\024."
+      "timestamp.Timestamp\022\n\n\002by\030\013 \001(\t\"^\n\017DsUnl"
+      "ockRequest\022&\n\006header\030\001 \001(\0132\026.kvrpcpb.Req"
+      "uestHeader\022#\n\003req\030\002 \001(\0132\026.kvrpcpb.Unlock"
+      "Request\"`\n\020DsUnlockResponse\022\'\n\006header\030\001 "
+      "\001(\0132\027.kvrpcpb.ResponseHeader\022#\n\004resp\030\002 \001"
+      "(\0132\025.kvrpcpb.LockResponse\"V\n\022UnlockForce"
+      "Request\022\013\n\003key\030\001 \001(\014\022\'\n\ttimestamp\030\n \001(\0132"
+      "\024.timestamp.Timestamp\022\n\n\002by\030\013 \001(\t\"h\n\024DsU"
+      "nlockForceRequest\022&\n\006header\030\001 \001(\0132\026.kvrp"
+      "cpb.RequestHeader\022(\n\003req\030\002 \001(\0132\033.kvrpcpb"
+      ".UnlockForceRequest\"e\n\025DsUnlockForceResp"
+      "onse\022\'\n\006header\030\001 \001(\0132\027.kvrpcpb.ResponseH"
+      "eader\022#\n\004resp\030\002 \001(\0132\025.kvrpcpb.LockRespon"
+      "se\">\n\017LockScanRequest\022\r\n\005start\030\001 \001(\014\022\r\n\005"
+      "limit\030\002 \001(\014\022\r\n\005count\030\003 \001(\r\"b\n\021DsLockScan"
+      "Request\022&\n\006header\030\001 \001(\0132\026.kvrpcpb.Reques"
+      "tHeader\022%\n\003req\030\002 \001(\0132\030.kvrpcpb.LockScanR"
+      "equest\"f\n\022DsLockScanResponse\022\'\n\006header\030\001"
+      " \001(\0132\027.kvrpcpb.ResponseHeader\022\'\n\004resp\030\002 "
+      "\001(\0132\031.kvrpcpb.LockScanResponse*;\n\013Execut"
+      "eType\022\017\n\013ExecInvalid\020\000\022\013\n\007ExecPut\020\001\022\016\n\nE"
+      "xecDelete\020\002*k\n\tMatchType\022\013\n\007Invalid\020\000\022\t\n"
+      "\005Equal\020\001\022\014\n\010NotEqual\020\002\022\010\n\004Less\020\003\022\017\n\013Less"
+      "OrEqual\020\004\022\n\n\006Larger\020\005\022\021\n\rLargerOrEqual\020\006"
+      "*Z\n\tExistCase\022\016\n\nEC_Invalid\020\000\022\020\n\014EC_NotE"
+      "xists\020\001\022\r\n\tEC_Exists\020\002\022\016\n\nEC_AnyCase\020\003\022\014"
+      "\n\010EC_Force\020\004*B\n\tOperation\022\016\n\nOP_Invalid\020"
+      "\000\022\n\n\006OP_Set\020\001\022\r\n\tOP_Delete\020\002\022\n\n\006OP_Get\020\003"
+      "b\006proto3"
   };
   ::google::protobuf::DescriptorPool::InternalAddGeneratedFile(
-      descriptor, 8719);
+      descriptor, 9408);
   ::google::protobuf::MessageFactory::InternalRegisterGeneratedFile(
     "kvrpcpb.proto", &protobuf_RegisterTypes);
   ::metapb::protobuf_metapb_2eproto::AddDescriptors();
@@ -11503,6 +11677,8 @@ const int SelectRequest::kWhereFiltersFieldNumber;
 const int SelectRequest::kGroupBysFieldNumber;
 const int SelectRequest::kLimitFieldNumber;
 const int SelectRequest::kTimestampFieldNumber;
+const int SelectRequest::kOpenSnapshotFieldNumber;
+const int SelectRequest::kSnapshotIdFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
 SelectRequest::SelectRequest()
@@ -11540,14 +11716,17 @@ SelectRequest::SelectRequest(const SelectRequest& from)
   } else {
     timestamp_ = NULL;
   }
+  ::memcpy(&snapshot_id_, &from.snapshot_id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&open_snapshot_) -
+    reinterpret_cast<char*>(&snapshot_id_)) + sizeof(open_snapshot_));
   // @@protoc_insertion_point(copy_constructor:kvrpcpb.SelectRequest)
 }
 
 void SelectRequest::SharedCtor() {
   key_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   ::memset(&scope_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&timestamp_) -
-      reinterpret_cast<char*>(&scope_)) + sizeof(timestamp_));
+      reinterpret_cast<char*>(&open_snapshot_) -
+      reinterpret_cast<char*>(&scope_)) + sizeof(open_snapshot_));
   _cached_size_ = 0;
 }
 
@@ -11608,6 +11787,9 @@ void SelectRequest::Clear() {
     delete timestamp_;
   }
   timestamp_ = NULL;
+  ::memset(&snapshot_id_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&open_snapshot_) -
+      reinterpret_cast<char*>(&snapshot_id_)) + sizeof(open_snapshot_));
   _internal_metadata_.Clear();
 }
 
@@ -11705,6 +11887,34 @@ bool SelectRequest::MergePartialFromCodedStream(
         break;
       }
 
+      // bool open_snapshot = 8;
+      case 8: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(64u /* 64 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
+                 input, &open_snapshot_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint64 snapshot_id = 9;
+      case 9: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(72u /* 72 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &snapshot_id_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
       default: {
       handle_unusual:
         if (tag == 0) {
@@ -11776,6 +11986,16 @@ void SelectRequest::SerializeWithCachedSizes(
       7, *this->timestamp_, output);
   }
 
+  // bool open_snapshot = 8;
+  if (this->open_snapshot() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteBool(8, this->open_snapshot(), output);
+  }
+
+  // uint64 snapshot_id = 9;
+  if (this->snapshot_id() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(9, this->snapshot_id(), output);
+  }
+
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
     ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
@@ -11842,6 +12062,16 @@ void SelectRequest::SerializeWithCachedSizes(
         7, *this->timestamp_, deterministic, target);
   }
 
+  // bool open_snapshot = 8;
+  if (this->open_snapshot() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(8, this->open_snapshot(), target);
+  }
+
+  // uint64 snapshot_id = 9;
+  if (this->snapshot_id() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(9, this->snapshot_id(), target);
+  }
+
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
     target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
@@ -11920,6 +12150,18 @@ size_t SelectRequest::ByteSizeLong() const {
         *this->timestamp_);
   }
 
+  // uint64 snapshot_id = 9;
+  if (this->snapshot_id() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt64Size(
+        this->snapshot_id());
+  }
+
+  // bool open_snapshot = 8;
+  if (this->open_snapshot() != 0) {
+    total_size += 1 + 1;
+  }
+
   int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = cached_size;
@@ -11965,6 +12207,12 @@ void SelectRequest::MergeFrom(const SelectRequest& from) {
   if (from.has_timestamp()) {
     mutable_timestamp()->::timestamp::Timestamp::MergeFrom(from.timestamp());
   }
+  if (from.snapshot_id() != 0) {
+    set_snapshot_id(from.snapshot_id());
+  }
+  if (from.open_snapshot() != 0) {
+    set_open_snapshot(from.open_snapshot());
+  }
 }
 
 void SelectRequest::CopyFrom(const ::google::protobuf::Message& from) {
@@ -11998,6 +12246,8 @@ void SelectRequest::InternalSwap(SelectRequest* other) {
   swap(scope_, other->scope_);
   swap(limit_, other->limit_);
   swap(timestamp_, other->timestamp_);
+  swap(snapshot_id_, other->snapshot_id_);
+  swap(open_snapshot_, other->open_snapshot_);
   _internal_metadata_.Swap(&other->_internal_metadata_);
   swap(_cached_size_, other->_cached_size_);
 }
@@ -12273,6 +12523,34 @@ void SelectRequest::set_allocated_timestamp(::timestamp::Timestamp* timestamp) {
   // @@protoc_insertion_point(field_set_allocated:kvrpcpb.SelectRequest.timestamp)
 }
 
+// bool open_snapshot = 8;
+void SelectRequest::clear_open_snapshot() {
+  open_snapshot_ = false;
+}
+bool SelectRequest::open_snapshot() const {
+  // @@protoc_insertion_point(field_get:kvrpcpb.SelectRequest.open_snapshot)
+  return open_snapshot_;
+}
+void SelectRequest::set_open_snapshot(bool value) {
+  
+  open_snapshot_ = value;
+  // @@protoc_insertion_point(field_set:kvrpcpb.SelectRequest.open_snapshot)
+}
+
+// uint64 snapshot_id = 9;
+void SelectRequest::clear_snapshot_id() {
+  snapshot_id_ = GOOGLE_ULONGLONG(0);
+}
+::google::protobuf::uint64 SelectRequest::snapshot_id() const {
+  // @@protoc_insertion_point(field_get:kvrpcpb.SelectRequest.snapshot_id)
+  return snapshot_id_;
+}
+void SelectRequest::set_snapshot_id(::google::protobuf::uint64 value) {
+  
+  snapshot_id_ = value;
+  // @@protoc_insertion_point(field_set:kvrpcpb.SelectRequest.snapshot_id)
+}
+
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
 
 // ===================================================================
@@ -13150,6 +13428,7 @@ void DsSelectResponse::set_allocated_resp(::kvrpcpb::SelectResponse* resp) {
 const int SelectResponse::kCodeFieldNumber;
 const int SelectResponse::kRowsFieldNumber;
 const int SelectResponse::kOffsetFieldNumber;
+const int SelectResponse::kSnapshotIdFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
 SelectResponse::SelectResponse()
@@ -13273,6 +13552,20 @@ bool SelectResponse::MergePartialFromCodedStream(
         break;
       }
 
+      // uint64 snapshot_id = 4;
+      case 4: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(32u /* 32 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &snapshot_id_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
       default: {
       handle_unusual:
         if (tag == 0) {
@@ -13316,6 +13609,11 @@ void SelectResponse::SerializeWithCachedSizes(
     ::google::protobuf::internal::WireFormatLite::WriteUInt64(3, this->offset(), output);
   }
 
+  // uint64 snapshot_id = 4;
+  if (this->snapshot_id() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(4, this->snapshot_id(), output);
+  }
+
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
     ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
@@ -13348,6 +13646,11 @@ void SelectResponse::SerializeWithCachedSizes(
     target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(3, this->offset(), target);
   }
 
+  // uint64 snapshot_id = 4;
+  if (this->snapshot_id() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(4, this->snapshot_id(), target);
+  }
+
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
     target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
@@ -13383,6 +13686,13 @@ size_t SelectResponse::ByteSizeLong() const {
         this->offset());
   }
 
+  // uint64 snapshot_id = 4;
+  if (this->snapshot_id() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt64Size(
+        this->snapshot_id());
+  }
+
   // int32 code = 1;
   if (this->code() != 0) {
     total_size += 1 +
@@ -13423,6 +13733,9 @@ void SelectResponse::MergeFrom(const SelectResponse& from) {
   if (from.offset() != 0) {
     set_offset(from.offset());
   }
+  if (from.snapshot_id() != 0) {
+    set_snapshot_id(from.snapshot_id());
+  }
   if (from.code() != 0) {
     set_code(from.code());
   }
@@ -13454,6 +13767,7 @@ void SelectResponse::InternalSwap(SelectResponse* other) {
   using std::swap;
   rows_.InternalSwap(&other->rows_);
   swap(offset_, other->offset_);
+  swap(snapshot_id_, other->snapshot_id_);
   swap(code_, other->code_);
   _internal_metadata_.Swap(&other->_internal_metadata_);
   swap(_cached_size_, other->_cached_size_);
@@ -13525,6 +13839,20 @@ void SelectResponse::set_offset(::google::protobuf::uint64 value) {
   // @@protoc_insertion_point(field_set:kvrpcpb.SelectResponse.offset)
 }
 
+// uint64 snapshot_id = 4;
+void SelectResponse::clear_snapshot_id() {
+  snapshot_id_ = GOOGLE_ULONGLONG(0);
+}
+::google::protobuf::uint64 SelectResponse::snapshot_id() const {
+  // @@protoc_insertion_point(field_get:kvrpcpb.SelectResponse.snapshot_id)
+  return snapshot_id_;
+}
+void SelectResponse::set_snapshot_id(::google::protobuf::uint64 value) {
+  
+  snapshot_id_ = value;
+  // @@protoc_insertion_point(field_set:kvrpcpb.SelectResponse.snapshot_id)
+}
+
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
 
 // ===================================================================
@@ -24735,6 +25063,8 @@ const int KvScanRequest::kLimitFieldNumber;
 const int KvScanRequest::kCountOnlyFieldNumber;
 const int KvScanRequest::kKeyOnlyFieldNumber;
 const int KvScanRequest::kMaxCountFieldNumber;
+const int KvScanRequest::kOpenSnapshotFieldNumber;
+const int KvScanRequest::kSnapshotIdFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
 KvScanRequest::KvScanRequest()
@@ -24759,8 +25089,8 @@ KvScanRequest::KvScanRequest(const KvScanRequest& from)
     limit_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.limit_);
   }
   ::memcpy(&max_count_, &from.max_count_,
-    static_cast<size_t>(reinterpret_cast<char*>(&key_only_) -
-    reinterpret_cast<char*>(&max_count_)) + sizeof(key_only_));
+    static_cast<size_t>(reinterpret_cast<char*>(&open_snapshot_) -
+    reinterpret_cast<char*>(&max_count_)) + sizeof(open_snapshot_));
   // @@protoc_insertion_point(copy_constructor:kvrpcpb.KvScanRequest)
 }
 
@@ -24768,8 +25098,8 @@ void KvScanRequest::SharedCtor() {
   start_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   limit_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   ::memset(&max_count_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&key_only_) -
-      reinterpret_cast<char*>(&max_count_)) + sizeof(key_only_));
+      reinterpret_cast<char*>(&open_snapshot_) -
+      reinterpret_cast<char*>(&max_count_)) + sizeof(open_snapshot_));
   _cached_size_ = 0;
 }
 
@@ -24815,8 +25145,8 @@ void KvScanRequest::Clear() {
   start_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   limit_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   ::memset(&max_count_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&key_only_) -
-      reinterpret_cast<char*>(&max_count_)) + sizeof(key_only_));
+      reinterpret_cast<char*>(&open_snapshot_) -
+      reinterpret_cast<char*>(&max_count_)) + sizeof(open_snapshot_));
   _internal_metadata_.Clear();
 }
 
@@ -24896,6 +25226,34 @@ bool KvScanRequest::MergePartialFromCodedStream(
         break;
       }
 
+      // bool open_snapshot = 6;
+      case 6: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(48u /* 48 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
+                 input, &open_snapshot_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint64 snapshot_id = 7;
+      case 7: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(56u /* 56 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &snapshot_id_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
       default: {
       handle_unusual:
         if (tag == 0) {
@@ -24949,6 +25307,16 @@ void KvScanRequest::SerializeWithCachedSizes(
     ::google::protobuf::internal::WireFormatLite::WriteInt64(5, this->max_count(), output);
   }
 
+  // bool open_snapshot = 6;
+  if (this->open_snapshot() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteBool(6, this->open_snapshot(), output);
+  }
+
+  // uint64 snapshot_id = 7;
+  if (this->snapshot_id() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(7, this->snapshot_id(), output);
+  }
+
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
     ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
@@ -24992,6 +25360,16 @@ void KvScanRequest::SerializeWithCachedSizes(
     target = ::google::protobuf::internal::WireFormatLite::WriteInt64ToArray(5, this->max_count(), target);
   }
 
+  // bool open_snapshot = 6;
+  if (this->open_snapshot() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(6, this->open_snapshot(), target);
+  }
+
+  // uint64 snapshot_id = 7;
+  if (this->snapshot_id() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(7, this->snapshot_id(), target);
+  }
+
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
     target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
@@ -25030,6 +25408,13 @@ size_t KvScanRequest::ByteSizeLong() const {
         this->max_count());
   }
 
+  // uint64 snapshot_id = 7;
+  if (this->snapshot_id() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt64Size(
+        this->snapshot_id());
+  }
+
   // bool count_only = 3;
   if (this->count_only() != 0) {
     total_size += 1 + 1;
@@ -25040,6 +25425,11 @@ size_t KvScanRequest::ByteSizeLong() const {
     total_size += 1 + 1;
   }
 
+  // bool open_snapshot = 6;
+  if (this->open_snapshot() != 0) {
+    total_size += 1 + 1;
+  }
+
   int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = cached_size;
@@ -25080,12 +25470,18 @@ void KvScanRequest::MergeFrom(const KvScanRequest& from) {
   if (from.max_count() != 0) {
     set_max_count(from.max_count());
   }
+  if (from.snapshot_id() != 0) {
+    set_snapshot_id(from.snapshot_id());
+  }
   if (from.count_only() != 0) {
     set_count_only(from.count_only());
   }
   if (from.key_only() != 0) {
     set_key_only(from.key_only());
   }
+  if (from.open_snapshot() != 0) {
+    set_open_snapshot(from.open_snapshot());
+  }
 }
 
 void KvScanRequest::CopyFrom(const ::google::protobuf::Message& from) {
@@ -25115,8 +25511,10 @@ void KvScanRequest::InternalSwap(KvScanRequest* other) {
   start_.Swap(&other->start_);
   limit_.Swap(&other->limit_);
   swap(max_count_, other->max_count_);
+  swap(snapshot_id_, other->snapshot_id_);
   swap(count_only_, other->count_only_);
   swap(key_only_, other->key_only_);
+  swap(open_snapshot_, other->open_snapshot_);
   _internal_metadata_.Swap(&other->_internal_metadata_);
   swap(_cached_size_, other->_cached_size_);
 }
@@ -25277,6 +25675,34 @@ void KvScanRequest::set_max_count(::google::protobuf::int64 value) {
   // @@protoc_insertion_point(field_set:kvrpcpb.KvScanRequest.max_count)
 }
 
+// bool open_snapshot = 6;
+void KvScanRequest::clear_open_snapshot() {
+  open_snapshot_ = false;
+}
+bool KvScanRequest::open_snapshot() const {
+  // @@protoc_insertion_point(field_get:kvrpcpb.KvScanRequest.open_snapshot)
+  return open_snapshot_;
+}
+void KvScanRequest::set_open_snapshot(bool value) {
+  
+  open_snapshot_ = value;
+  // @@protoc_insertion_point(field_set:kvrpcpb.KvScanRequest.open_snapshot)
+}
+
+// uint64 snapshot_id = 7;
+void KvScanRequest::clear_snapshot_id() {
+  snapshot_id_ = GOOGLE_ULONGLONG(0);
+}
+::google::protobuf::uint64 KvScanRequest::snapshot_id() const {
+  // @@protoc_insertion_point(field_get:kvrpcpb.KvScanRequest.snapshot_id)
+  return snapshot_id_;
+}
+void KvScanRequest::set_snapshot_id(::google::protobuf::uint64 value) {
+  
+  snapshot_id_ = value;
+  // @@protoc_insertion_point(field_set:kvrpcpb.KvScanRequest.snapshot_id)
+}
+
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
 
 // ===================================================================
@@ -25286,6 +25712,7 @@ const int KvScanResponse::kCodeFieldNumber;
 const int KvScanResponse::kCountFieldNumber;
 const int KvScanResponse::kKvsFieldNumber;
 const int KvScanResponse::kLastKeyFieldNumber;
+const int KvScanResponse::kSnapshotIdFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
 KvScanResponse::KvScanResponse()
@@ -25428,6 +25855,20 @@ bool KvScanResponse::MergePartialFromCodedStream(
         break;
       }
 
+      // uint64 snapshot_id = 5;
+      case 5: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(40u /* 40 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &snapshot_id_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
       default: {
       handle_unusual:
         if (tag == 0) {
@@ -25477,6 +25918,11 @@ void KvScanResponse::SerializeWithCachedSizes(
       4, this->last_key(), output);
   }
 
+  // uint64 snapshot_id = 5;
+  if (this->snapshot_id() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(5, this->snapshot_id(), output);
+  }
+
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
     ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
@@ -25516,6 +25962,11 @@ void KvScanResponse::SerializeWithCachedSizes(
         4, this->last_key(), target);
   }
 
+  // uint64 snapshot_id = 5;
+  if (this->snapshot_id() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(5, this->snapshot_id(), target);
+  }
+
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
     target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
@@ -25558,6 +26009,13 @@ size_t KvScanResponse::ByteSizeLong() const {
         this->count());
   }
 
+  // uint64 snapshot_id = 5;
+  if (this->snapshot_id() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt64Size(
+        this->snapshot_id());
+  }
+
   // int32 code = 1;
   if (this->code() != 0) {
     total_size += 1 +
@@ -25602,6 +26060,9 @@ void KvScanResponse::MergeFrom(const KvScanResponse& from) {
   if (from.count() != 0) {
     set_count(from.count());
   }
+  if (from.snapshot_id() != 0) {
+    set_snapshot_id(from.snapshot_id());
+  }
   if (from.code() != 0) {
     set_code(from.code());
   }
@@ -25634,6 +26095,7 @@ void KvScanResponse::InternalSwap(KvScanResponse* other) {
   kvs_.InternalSwap(&other->kvs_);
   last_key_.Swap(&other->last_key_);
   swap(count_, other->count_);
+  swap(snapshot_id_, other->snapshot_id_);
   swap(code_, other->code_);
   _internal_metadata_.Swap(&other->_internal_metadata_);
   swap(_cached_size_, other->_cached_size_);
@@ -25758,6 +26220,20 @@ void KvScanResponse::set_allocated_last_key(::std::string* last_key) {
   // @@protoc_insertion_point(field_set_allocated:kvrpcpb.KvScanResponse.last_key)
 }
 
+// uint64 snapshot_id = 5;
+void KvScanResponse::clear_snapshot_id() {
+  snapshot_id_ = GOOGLE_ULONGLONG(0);
+}
+::google::protobuf::uint64 KvScanResponse::snapshot_id() const {
+  // @@protoc_insertion_point(field_get:kvrpcpb.KvScanResponse.snapshot_id)
+  return snapshot_id_;
+}
+void KvScanResponse::set_snapshot_id(::google::protobuf::uint64 value) {
+  
+  snapshot_id_ = value;
+  // @@protoc_insertion_point(field_set:kvrpcpb.KvScanResponse.snapshot_id)
+}
+
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
 
 // ===================================================================
@@ -31038,6 +31514,2775 @@ void DsKvRangeDeleteResponse::set_allocated_resp(::kvrpcpb::KvRangeDeleteRespons
 
 // ===================================================================
 
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int KvIncrRequest::kKeyFieldNumber;
+const int KvIncrRequest::kDeltaFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+KvIncrRequest::KvIncrRequest()
+  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
+  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
+    protobuf_kvrpcpb_2eproto::InitDefaults();
+  }
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:kvrpcpb.KvIncrRequest)
+}
+KvIncrRequest::KvIncrRequest(const KvIncrRequest& from)
+  : ::google::protobuf::Message(),
+      _internal_metadata_(NULL),
+      _cached_size_(0) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  key_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (from.key().size() > 0) {
+    key_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.key_);
+  }
+  delta_ = from.delta_;
+  // @@protoc_insertion_point(copy_constructor:kvrpcpb.KvIncrRequest)
+}
+
+void KvIncrRequest::SharedCtor() {
+  key_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  delta_ = GOOGLE_LONGLONG(0);
+  _cached_size_ = 0;
+}
+
+KvIncrRequest::~KvIncrRequest() {
+  // @@protoc_insertion_point(destructor:kvrpcpb.KvIncrRequest)
+  SharedDtor();
+}
+
+void KvIncrRequest::SharedDtor() {
+  key_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+
+void KvIncrRequest::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* KvIncrRequest::descriptor() {
+  protobuf_kvrpcpb_2eproto::protobuf_AssignDescriptorsOnce();
+  return protobuf_kvrpcpb_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
+}
+
+const KvIncrRequest& KvIncrRequest::default_instance() {
+  protobuf_kvrpcpb_2eproto::InitDefaults();
+  return *internal_default_instance();
+}
+
+KvIncrRequest* KvIncrRequest::New(::google::protobuf::Arena* arena) const {
+  KvIncrRequest* n = new KvIncrRequest;
+  if (arena != NULL) {
+    arena->Own(n);
+  }
+  return n;
+}
+
+void KvIncrRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:kvrpcpb.KvIncrRequest)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  key_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  delta_ = GOOGLE_LONGLONG(0);
+  _internal_metadata_.Clear();
+}
+
+bool KvIncrRequest::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  // @@protoc_insertion_point(parse_start:kvrpcpb.KvIncrRequest)
+  for (;;) {
+    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // bytes key = 1;
+      case 1: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
+                input, this->mutable_key()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // int64 delta = 2;
+      case 2: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(16u /* 16 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int64, ::google::protobuf::internal::WireFormatLite::TYPE_INT64>(
+                 input, &delta_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, _internal_metadata_.mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:kvrpcpb.KvIncrRequest)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:kvrpcpb.KvIncrRequest)
+  return false;
+#undef DO_
+}
+
+void KvIncrRequest::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:kvrpcpb.KvIncrRequest)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bytes key = 1;
+  if (this->key().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteBytesMaybeAliased(
+      1, this->key(), output);
+  }
+
+  // int64 delta = 2;
+  if (this->delta() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt64(2, this->delta(), output);
+  }
+
+  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
+  }
+  // @@protoc_insertion_point(serialize_end:kvrpcpb.KvIncrRequest)
+}
+
+::google::protobuf::uint8* KvIncrRequest::InternalSerializeWithCachedSizesToArray(
+    bool deterministic, ::google::protobuf::uint8* target) const {
+  (void)deterministic; // Unused
+  // @@protoc_insertion_point(serialize_to_array_start:kvrpcpb.KvIncrRequest)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bytes key = 1;
+  if (this->key().size() > 0) {
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteBytesToArray(
+        1, this->key(), target);
+  }
+
+  // int64 delta = 2;
+  if (this->delta() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt64ToArray(2, this->delta(), target);
+  }
+
+  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:kvrpcpb.KvIncrRequest)
+  return target;
+}
+
+size_t KvIncrRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:kvrpcpb.KvIncrRequest)
+  size_t total_size = 0;
+
+  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
+  }
+  // bytes key = 1;
+  if (this->key().size() > 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::BytesSize(
+        this->key());
+  }
+
+  // int64 delta = 2;
+  if (this->delta() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::Int64Size(
+        this->delta());
+  }
+
+  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = cached_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void KvIncrRequest::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:kvrpcpb.KvIncrRequest)
+  GOOGLE_DCHECK_NE(&from, this);
+  const KvIncrRequest* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const KvIncrRequest>(
+          &from);
+  if (source == NULL) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:kvrpcpb.KvIncrRequest)
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:kvrpcpb.KvIncrRequest)
+    MergeFrom(*source);
+  }
+}
+
+void KvIncrRequest::MergeFrom(const KvIncrRequest& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:kvrpcpb.KvIncrRequest)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.key().size() > 0) {
+
+    key_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.key_);
+  }
+  if (from.delta() != 0) {
+    set_delta(from.delta());
+  }
+}
+
+void KvIncrRequest::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:kvrpcpb.KvIncrRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void KvIncrRequest::CopyFrom(const KvIncrRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:kvrpcpb.KvIncrRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool KvIncrRequest::IsInitialized() const {
+  return true;
+}
+
+void KvIncrRequest::Swap(KvIncrRequest* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void KvIncrRequest::InternalSwap(KvIncrRequest* other) {
+  using std::swap;
+  key_.Swap(&other->key_);
+  swap(delta_, other->delta_);
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  swap(_cached_size_, other->_cached_size_);
+}
+
+::google::protobuf::Metadata KvIncrRequest::GetMetadata() const {
+  protobuf_kvrpcpb_2eproto::protobuf_AssignDescriptorsOnce();
+  return protobuf_kvrpcpb_2eproto::file_level_metadata[kIndexInFileMessages];
+}
+
+#if PROTOBUF_INLINE_NOT_IN_HEADERS
+// KvIncrRequest
+
+// bytes key = 1;
+void KvIncrRequest::clear_key() {
+  key_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+const ::std::string& KvIncrRequest::key() const {
+  // @@protoc_insertion_point(field_get:kvrpcpb.KvIncrRequest.key)
+  return key_.GetNoArena();
+}
+void KvIncrRequest::set_key(const ::std::string& value) {
+  
+  key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:kvrpcpb.KvIncrRequest.key)
+}
+#if LANG_CXX11
+void KvIncrRequest::set_key(::std::string&& value) {
+  
+  key_.SetNoArena(
+    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:kvrpcpb.KvIncrRequest.key)
+}
+#endif
+void KvIncrRequest::set_key(const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  
+  key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:kvrpcpb.KvIncrRequest.key)
+}
+void KvIncrRequest::set_key(const void* value, size_t size) {
+  
+  key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:kvrpcpb.KvIncrRequest.key)
+}
+::std::string* KvIncrRequest::mutable_key() {
+  
+  // @@protoc_insertion_point(field_mutable:kvrpcpb.KvIncrRequest.key)
+  return key_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+::std::string* KvIncrRequest::release_key() {
+  // @@protoc_insertion_point(field_release:kvrpcpb.KvIncrRequest.key)
+  
+  return key_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+void KvIncrRequest::set_allocated_key(::std::string* key) {
+  if (key != NULL) {
+    
+  } else {
+    
+  }
+  key_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), key);
+  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.KvIncrRequest.key)
+}
+
+// int64 delta = 2;
+void KvIncrRequest::clear_delta() {
+  delta_ = GOOGLE_LONGLONG(0);
+}
+::google::protobuf::int64 KvIncrRequest::delta() const {
+  // @@protoc_insertion_point(field_get:kvrpcpb.KvIncrRequest.delta)
+  return delta_;
+}
+void KvIncrRequest::set_delta(::google::protobuf::int64 value) {
+  
+  delta_ = value;
+  // @@protoc_insertion_point(field_set:kvrpcpb.KvIncrRequest.delta)
+}
+
+#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
+
+// ===================================================================
+
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int KvIncrResponse::kCodeFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+KvIncrResponse::KvIncrResponse()
+  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
+  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
+    protobuf_kvrpcpb_2eproto::InitDefaults();
+  }
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:kvrpcpb.KvIncrResponse)
+}
+KvIncrResponse::KvIncrResponse(const KvIncrResponse& from)
+  : ::google::protobuf::Message(),
+      _internal_metadata_(NULL),
+      _cached_size_(0) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  code_ = from.code_;
+  // @@protoc_insertion_point(copy_constructor:kvrpcpb.KvIncrResponse)
+}
+
+void KvIncrResponse::SharedCtor() {
+  code_ = 0;
+  _cached_size_ = 0;
+}
+
+KvIncrResponse::~KvIncrResponse() {
+  // @@protoc_insertion_point(destructor:kvrpcpb.KvIncrResponse)
+  SharedDtor();
+}
+
+void KvIncrResponse::SharedDtor() {
+}
+
+void KvIncrResponse::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* KvIncrResponse::descriptor() {
+  protobuf_kvrpcpb_2eproto::protobuf_AssignDescriptorsOnce();
+  return protobuf_kvrpcpb_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
+}
+
+const KvIncrResponse& KvIncrResponse::default_instance() {
+  protobuf_kvrpcpb_2eproto::InitDefaults();
+  return *internal_default_instance();
+}
+
+KvIncrResponse* KvIncrResponse::New(::google::protobuf::Arena* arena) const {
+  KvIncrResponse* n = new KvIncrResponse;
+  if (arena != NULL) {
+    arena->Own(n);
+  }
+  return n;
+}
+
+void KvIncrResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:kvrpcpb.KvIncrResponse)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  code_ = 0;
+  _internal_metadata_.Clear();
+}
+
+bool KvIncrResponse::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  // @@protoc_insertion_point(parse_start:kvrpcpb.KvIncrResponse)
+  for (;;) {
+    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // int32 code = 1;
+      case 1: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(8u /* 8 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
+                 input, &code_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, _internal_metadata_.mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:kvrpcpb.KvIncrResponse)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:kvrpcpb.KvIncrResponse)
+  return false;
+#undef DO_
+}
+
+void KvIncrResponse::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:kvrpcpb.KvIncrResponse)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 code = 1;
+  if (this->code() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt32(1, this->code(), output);
+  }
+
+  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
+  }
+  // @@protoc_insertion_point(serialize_end:kvrpcpb.KvIncrResponse)
+}
+
+::google::protobuf::uint8* KvIncrResponse::InternalSerializeWithCachedSizesToArray(
+    bool deterministic, ::google::protobuf::uint8* target) const {
+  (void)deterministic; // Unused
+  // @@protoc_insertion_point(serialize_to_array_start:kvrpcpb.KvIncrResponse)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 code = 1;
+  if (this->code() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(1, this->code(), target);
+  }
+
+  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:kvrpcpb.KvIncrResponse)
+  return target;
+}
+
+size_t KvIncrResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:kvrpcpb.KvIncrResponse)
+  size_t total_size = 0;
+
+  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
+  }
+  // int32 code = 1;
+  if (this->code() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::Int32Size(
+        this->code());
+  }
+
+  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = cached_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void KvIncrResponse::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:kvrpcpb.KvIncrResponse)
+  GOOGLE_DCHECK_NE(&from, this);
+  const KvIncrResponse* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const KvIncrResponse>(
+          &from);
+  if (source == NULL) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:kvrpcpb.KvIncrResponse)
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:kvrpcpb.KvIncrResponse)
+    MergeFrom(*source);
+  }
+}
+
+void KvIncrResponse::MergeFrom(const KvIncrResponse& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:kvrpcpb.KvIncrResponse)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.code() != 0) {
+    set_code(from.code());
+  }
+}
+
+void KvIncrResponse::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:kvrpcpb.KvIncrResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void KvIncrResponse::CopyFrom(const KvIncrResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:kvrpcpb.KvIncrResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool KvIncrResponse::IsInitialized() const {
+  return true;
+}
+
+void KvIncrResponse::Swap(KvIncrResponse* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void KvIncrResponse::InternalSwap(KvIncrResponse* other) {
+  using std::swap;
+  swap(code_, other->code_);
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  swap(_cached_size_, other->_cached_size_);
+}
+
+::google::protobuf::Metadata KvIncrResponse::GetMetadata() const {
+  protobuf_kvrpcpb_2eproto::protobuf_AssignDescriptorsOnce();
+  return protobuf_kvrpcpb_2eproto::file_level_metadata[kIndexInFileMessages];
+}
+
+#if PROTOBUF_INLINE_NOT_IN_HEADERS
+// KvIncrResponse
+
+// int32 code = 1;
+void KvIncrResponse::clear_code() {
+  code_ = 0;
+}
+::google::protobuf::int32 KvIncrResponse::code() const {
+  // @@protoc_insertion_point(field_get:kvrpcpb.KvIncrResponse.code)
+  return code_;
+}
+void KvIncrResponse::set_code(::google::protobuf::int32 value) {
+  
+  code_ = value;
+  // @@protoc_insertion_point(field_set:kvrpcpb.KvIncrResponse.code)
+}
+
+#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
+
+// ===================================================================
+
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int DsKvIncrRequest::kHeaderFieldNumber;
+const int DsKvIncrRequest::kReqFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+DsKvIncrRequest::DsKvIncrRequest()
+  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
+  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
+    protobuf_kvrpcpb_2eproto::InitDefaults();
+  }
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:kvrpcpb.DsKvIncrRequest)
+}
+DsKvIncrRequest::DsKvIncrRequest(const DsKvIncrRequest& from)
+  : ::google::protobuf::Message(),
+      _internal_metadata_(NULL),
+      _cached_size_(0) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  if (from.has_header()) {
+    header_ = new ::kvrpcpb::RequestHeader(*from.header_);
+  } else {
+    header_ = NULL;
+  }
+  if (from.has_req()) {
+    req_ = new ::kvrpcpb::KvIncrRequest(*from.req_);
+  } else {
+    req_ = NULL;
+  }
+  // @@protoc_insertion_point(copy_constructor:kvrpcpb.DsKvIncrRequest)
+}
+
+void DsKvIncrRequest::SharedCtor() {
+  ::memset(&header_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&req_) -
+      reinterpret_cast<char*>(&header_)) + sizeof(req_));
+  _cached_size_ = 0;
+}
+
+DsKvIncrRequest::~DsKvIncrRequest() {
+  // @@protoc_insertion_point(destructor:kvrpcpb.DsKvIncrRequest)
+  SharedDtor();
+}
+
+void DsKvIncrRequest::SharedDtor() {
+  if (this != internal_default_instance()) delete header_;
+  if (this != internal_default_instance()) delete req_;
+}
+
+void DsKvIncrRequest::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* DsKvIncrRequest::descriptor() {
+  protobuf_kvrpcpb_2eproto::protobuf_AssignDescriptorsOnce();
+  return protobuf_kvrpcpb_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
+}
+
+const DsKvIncrRequest& DsKvIncrRequest::default_instance() {
+  protobuf_kvrpcpb_2eproto::InitDefaults();
+  return *internal_default_instance();
+}
+
+DsKvIncrRequest* DsKvIncrRequest::New(::google::protobuf::Arena* arena) const {
+  DsKvIncrRequest* n = new DsKvIncrRequest;
+  if (arena != NULL) {
+    arena->Own(n);
+  }
+  return n;
+}
+
+void DsKvIncrRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:kvrpcpb.DsKvIncrRequest)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (GetArenaNoVirtual() == NULL && header_ != NULL) {
+    delete header_;
+  }
+  header_ = NULL;
+  if (GetArenaNoVirtual() == NULL && req_ != NULL) {
+    delete req_;
+  }
+  req_ = NULL;
+  _internal_metadata_.Clear();
+}
+
+bool DsKvIncrRequest::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  // @@protoc_insertion_point(parse_start:kvrpcpb.DsKvIncrRequest)
+  for (;;) {
+    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // .kvrpcpb.RequestHeader header = 1;
+      case 1: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_header()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // .kvrpcpb.KvIncrRequest req = 2;
+      case 2: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(18u /* 18 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_req()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, _internal_metadata_.mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:kvrpcpb.DsKvIncrRequest)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:kvrpcpb.DsKvIncrRequest)
+  return false;
+#undef DO_
+}
+
+void DsKvIncrRequest::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:kvrpcpb.DsKvIncrRequest)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .kvrpcpb.RequestHeader header = 1;
+  if (this->has_header()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      1, *this->header_, output);
+  }
+
+  // .kvrpcpb.KvIncrRequest req = 2;
+  if (this->has_req()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      2, *this->req_, output);
+  }
+
+  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
+  }
+  // @@protoc_insertion_point(serialize_end:kvrpcpb.DsKvIncrRequest)
+}
+
+::google::protobuf::uint8* DsKvIncrRequest::InternalSerializeWithCachedSizesToArray(
+    bool deterministic, ::google::protobuf::uint8* target) const {
+  (void)deterministic; // Unused
+  // @@protoc_insertion_point(serialize_to_array_start:kvrpcpb.DsKvIncrRequest)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .kvrpcpb.RequestHeader header = 1;
+  if (this->has_header()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      InternalWriteMessageNoVirtualToArray(
+        1, *this->header_, deterministic, target);
+  }
+
+  // .kvrpcpb.KvIncrRequest req = 2;
+  if (this->has_req()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      InternalWriteMessageNoVirtualToArray(
+        2, *this->req_, deterministic, target);
+  }
+
+  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:kvrpcpb.DsKvIncrRequest)
+  return target;
+}
+
+size_t DsKvIncrRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:kvrpcpb.DsKvIncrRequest)
+  size_t total_size = 0;
+
+  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
+  }
+  // .kvrpcpb.RequestHeader header = 1;
+  if (this->has_header()) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+        *this->header_);
+  }
+
+  // .kvrpcpb.KvIncrRequest req = 2;
+  if (this->has_req()) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+        *this->req_);
+  }
+
+  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = cached_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void DsKvIncrRequest::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:kvrpcpb.DsKvIncrRequest)
+  GOOGLE_DCHECK_NE(&from, this);
+  const DsKvIncrRequest* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const DsKvIncrRequest>(
+          &from);
+  if (source == NULL) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:kvrpcpb.DsKvIncrRequest)
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:kvrpcpb.DsKvIncrRequest)
+    MergeFrom(*source);
+  }
+}
+
+void DsKvIncrRequest::MergeFrom(const DsKvIncrRequest& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:kvrpcpb.DsKvIncrRequest)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.has_header()) {
+    mutable_header()->::kvrpcpb::RequestHeader::MergeFrom(from.header());
+  }
+  if (from.has_req()) {
+    mutable_req()->::kvrpcpb::KvIncrRequest::MergeFrom(from.req());
+  }
+}
+
+void DsKvIncrRequest::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:kvrpcpb.DsKvIncrRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void DsKvIncrRequest::CopyFrom(const DsKvIncrRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:kvrpcpb.DsKvIncrRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool DsKvIncrRequest::IsInitialized() const {
+  return true;
+}
+
+void DsKvIncrRequest::Swap(DsKvIncrRequest* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void DsKvIncrRequest::InternalSwap(DsKvIncrRequest* other) {
+  using std::swap;
+  swap(header_, other->header_);
+  swap(req_, other->req_);
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  swap(_cached_size_, other->_cached_size_);
+}
+
+::google::protobuf::Metadata DsKvIncrRequest::GetMetadata() const {
+  protobuf_kvrpcpb_2eproto::protobuf_AssignDescriptorsOnce();
+  return protobuf_kvrpcpb_2eproto::file_level_metadata[kIndexInFileMessages];
+}
+
+#if PROTOBUF_INLINE_NOT_IN_HEADERS
+// DsKvIncrRequest
+
+// .kvrpcpb.RequestHeader header = 1;
+bool DsKvIncrRequest::has_header() const {
+  return this != internal_default_instance() && header_ != NULL;
+}
+void DsKvIncrRequest::clear_header() {
+  if (GetArenaNoVirtual() == NULL && header_ != NULL) delete header_;
+  header_ = NULL;
+}
+const ::kvrpcpb::RequestHeader& DsKvIncrRequest::header() const {
+  const ::kvrpcpb::RequestHeader* p = header_;
+  // @@protoc_insertion_point(field_get:kvrpcpb.DsKvIncrRequest.header)
+  return p != NULL ? *p : *reinterpret_cast<const ::kvrpcpb::RequestHeader*>(
+      &::kvrpcpb::_RequestHeader_default_instance_);
+}
+::kvrpcpb::RequestHeader* DsKvIncrRequest::mutable_header() {
+  
+  if (header_ == NULL) {
+    header_ = new ::kvrpcpb::RequestHeader;
+  }
+  // @@protoc_insertion_point(field_mutable:kvrpcpb.DsKvIncrRequest.header)
+  return header_;
+}
+::kvrpcpb::RequestHeader* DsKvIncrRequest::release_header() {
+  // @@protoc_insertion_point(field_release:kvrpcpb.DsKvIncrRequest.header)
+  
+  ::kvrpcpb::RequestHeader* temp = header_;
+  header_ = NULL;
+  return temp;
+}
+void DsKvIncrRequest::set_allocated_header(::kvrpcpb::RequestHeader* header) {
+  delete header_;
+  header_ = header;
+  if (header) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.DsKvIncrRequest.header)
+}
+
+// .kvrpcpb.KvIncrRequest req = 2;
+bool DsKvIncrRequest::has_req() const {
+  return this != internal_default_instance() && req_ != NULL;
+}
+void DsKvIncrRequest::clear_req() {
+  if (GetArenaNoVirtual() == NULL && req_ != NULL) delete req_;
+  req_ = NULL;
+}
+const ::kvrpcpb::KvIncrRequest& DsKvIncrRequest::req() const {
+  const ::kvrpcpb::KvIncrRequest* p = req_;
+  // @@protoc_insertion_point(field_get:kvrpcpb.DsKvIncrRequest.req)
+  return p != NULL ? *p : *reinterpret_cast<const ::kvrpcpb::KvIncrRequest*>(
+      &::kvrpcpb::_KvIncrRequest_default_instance_);
+}
+::kvrpcpb::KvIncrRequest* DsKvIncrRequest::mutable_req() {
+  
+  if (req_ == NULL) {
+    req_ = new ::kvrpcpb::KvIncrRequest;
+  }
+  // @@protoc_insertion_point(field_mutable:kvrpcpb.DsKvIncrRequest.req)
+  return req_;
+}
+::kvrpcpb::KvIncrRequest* DsKvIncrRequest::release_req() {
+  // @@protoc_insertion_point(field_release:kvrpcpb.DsKvIncrRequest.req)
+  
+  ::kvrpcpb::KvIncrRequest* temp = req_;
+  req_ = NULL;
+  return temp;
+}
+void DsKvIncrRequest::set_allocated_req(::kvrpcpb::KvIncrRequest* req) {
+  delete req_;
+  req_ = req;
+  if (req) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.DsKvIncrRequest.req)
+}
+
+#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
+
+// ===================================================================
+
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int DsKvIncrResponse::kHeaderFieldNumber;
+const int DsKvIncrResponse::kRespFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+DsKvIncrResponse::DsKvIncrResponse()
+  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
+  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
+    protobuf_kvrpcpb_2eproto::InitDefaults();
+  }
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:kvrpcpb.DsKvIncrResponse)
+}
+DsKvIncrResponse::DsKvIncrResponse(const DsKvIncrResponse& from)
+  : ::google::protobuf::Message(),
+      _internal_metadata_(NULL),
+      _cached_size_(0) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  if (from.has_header()) {
+    header_ = new ::kvrpcpb::ResponseHeader(*from.header_);
+  } else {
+    header_ = NULL;
+  }
+  if (from.has_resp()) {
+    resp_ = new ::kvrpcpb::KvIncrResponse(*from.resp_);
+  } else {
+    resp_ = NULL;
+  }
+  // @@protoc_insertion_point(copy_constructor:kvrpcpb.DsKvIncrResponse)
+}
+
+void DsKvIncrResponse::SharedCtor() {
+  ::memset(&header_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&resp_) -
+      reinterpret_cast<char*>(&header_)) + sizeof(resp_));
+  _cached_size_ = 0;
+}
+
+DsKvIncrResponse::~DsKvIncrResponse() {
+  // @@protoc_insertion_point(destructor:kvrpcpb.DsKvIncrResponse)
+  SharedDtor();
+}
+
+void DsKvIncrResponse::SharedDtor() {
+  if (this != internal_default_instance()) delete header_;
+  if (this != internal_default_instance()) delete resp_;
+}
+
+void DsKvIncrResponse::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* DsKvIncrResponse::descriptor() {
+  protobuf_kvrpcpb_2eproto::protobuf_AssignDescriptorsOnce();
+  return protobuf_kvrpcpb_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
+}
+
+const DsKvIncrResponse& DsKvIncrResponse::default_instance() {
+  protobuf_kvrpcpb_2eproto::InitDefaults();
+  return *internal_default_instance();
+}
+
+DsKvIncrResponse* DsKvIncrResponse::New(::google::protobuf::Arena* arena) const {
+  DsKvIncrResponse* n = new DsKvIncrResponse;
+  if (arena != NULL) {
+    arena->Own(n);
+  }
+  return n;
+}
+
+void DsKvIncrResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:kvrpcpb.DsKvIncrResponse)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (GetArenaNoVirtual() == NULL && header_ != NULL) {
+    delete header_;
+  }
+  header_ = NULL;
+  if (GetArenaNoVirtual() == NULL && resp_ != NULL) {
+    delete resp_;
+  }
+  resp_ = NULL;
+  _internal_metadata_.Clear();
+}
+
+bool DsKvIncrResponse::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  // @@protoc_insertion_point(parse_start:kvrpcpb.DsKvIncrResponse)
+  for (;;) {
+    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // .kvrpcpb.ResponseHeader header = 1;
+      case 1: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_header()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // .kvrpcpb.KvIncrResponse resp = 2;
+      case 2: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(18u /* 18 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_resp()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, _internal_metadata_.mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:kvrpcpb.DsKvIncrResponse)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:kvrpcpb.DsKvIncrResponse)
+  return false;
+#undef DO_
+}
+
+void DsKvIncrResponse::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:kvrpcpb.DsKvIncrResponse)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .kvrpcpb.ResponseHeader header = 1;
+  if (this->has_header()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      1, *this->header_, output);
+  }
+
+  // .kvrpcpb.KvIncrResponse resp = 2;
+  if (this->has_resp()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      2, *this->resp_, output);
+  }
+
+  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
+  }
+  // @@protoc_insertion_point(serialize_end:kvrpcpb.DsKvIncrResponse)
+}
+
+::google::protobuf::uint8* DsKvIncrResponse::InternalSerializeWithCachedSizesToArray(
+    bool deterministic, ::google::protobuf::uint8* target) const {
+  (void)deterministic; // Unused
+  // @@protoc_insertion_point(serialize_to_array_start:kvrpcpb.DsKvIncrResponse)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .kvrpcpb.ResponseHeader header = 1;
+  if (this->has_header()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      InternalWriteMessageNoVirtualToArray(
+        1, *this->header_, deterministic, target);
+  }
+
+  // .kvrpcpb.KvIncrResponse resp = 2;
+  if (this->has_resp()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      InternalWriteMessageNoVirtualToArray(
+        2, *this->resp_, deterministic, target);
+  }
+
+  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:kvrpcpb.DsKvIncrResponse)
+  return target;
+}
+
+size_t DsKvIncrResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:kvrpcpb.DsKvIncrResponse)
+  size_t total_size = 0;
+
+  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
+  }
+  // .kvrpcpb.ResponseHeader header = 1;
+  if (this->has_header()) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+        *this->header_);
+  }
+
+  // .kvrpcpb.KvIncrResponse resp = 2;
+  if (this->has_resp()) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+        *this->resp_);
+  }
+
+  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = cached_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void DsKvIncrResponse::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:kvrpcpb.DsKvIncrResponse)
+  GOOGLE_DCHECK_NE(&from, this);
+  const DsKvIncrResponse* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const DsKvIncrResponse>(
+          &from);
+  if (source == NULL) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:kvrpcpb.DsKvIncrResponse)
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:kvrpcpb.DsKvIncrResponse)
+    MergeFrom(*source);
+  }
+}
+
+void DsKvIncrResponse::MergeFrom(const DsKvIncrResponse& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:kvrpcpb.DsKvIncrResponse)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.has_header()) {
+    mutable_header()->::kvrpcpb::ResponseHeader::MergeFrom(from.header());
+  }
+  if (from.has_resp()) {
+    mutable_resp()->::kvrpcpb::KvIncrResponse::MergeFrom(from.resp());
+  }
+}
+
+void DsKvIncrResponse::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:kvrpcpb.DsKvIncrResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void DsKvIncrResponse::CopyFrom(const DsKvIncrResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:kvrpcpb.DsKvIncrResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool DsKvIncrResponse::IsInitialized() const {
+  return true;
+}
+
+void DsKvIncrResponse::Swap(DsKvIncrResponse* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void DsKvIncrResponse::InternalSwap(DsKvIncrResponse* other) {
+  using std::swap;
+  swap(header_, other->header_);
+  swap(resp_, other->resp_);
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  swap(_cached_size_, other->_cached_size_);
+}
+
+::google::protobuf::Metadata DsKvIncrResponse::GetMetadata() const {
+  protobuf_kvrpcpb_2eproto::protobuf_AssignDescriptorsOnce();
+  return protobuf_kvrpcpb_2eproto::file_level_metadata[kIndexInFileMessages];
+}
+
+#if PROTOBUF_INLINE_NOT_IN_HEADERS
+// DsKvIncrResponse
+
+// .kvrpcpb.ResponseHeader header = 1;
+bool DsKvIncrResponse::has_header() const {
+  return this != internal_default_instance() && header_ != NULL;
+}
+void DsKvIncrResponse::clear_header() {
+  if (GetArenaNoVirtual() == NULL && header_ != NULL) delete header_;
+  header_ = NULL;
+}
+const ::kvrpcpb::ResponseHeader& DsKvIncrResponse::header() const {
+  const ::kvrpcpb::ResponseHeader* p = header_;
+  // @@protoc_insertion_point(field_get:kvrpcpb.DsKvIncrResponse.header)
+  return p != NULL ? *p : *reinterpret_cast<const ::kvrpcpb::ResponseHeader*>(
+      &::kvrpcpb::_ResponseHeader_default_instance_);
+}
+::kvrpcpb::ResponseHeader* DsKvIncrResponse::mutable_header() {
+  
+  if (header_ == NULL) {
+    header_ = new ::kvrpcpb::ResponseHeader;
+  }
+  // @@protoc_insertion_point(field_mutable:kvrpcpb.DsKvIncrResponse.header)
+  return header_;
+}
+::kvrpcpb::ResponseHeader* DsKvIncrResponse::release_header() {
+  // @@protoc_insertion_point(field_release:kvrpcpb.DsKvIncrResponse.header)
+  
+  ::kvrpcpb::ResponseHeader* temp = header_;
+  header_ = NULL;
+  return temp;
+}
+void DsKvIncrResponse::set_allocated_header(::kvrpcpb::ResponseHeader* header) {
+  delete header_;
+  header_ = header;
+  if (header) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.DsKvIncrResponse.header)
+}
+
+// .kvrpcpb.KvIncrResponse resp = 2;
+bool DsKvIncrResponse::has_resp() const {
+  return this != internal_default_instance() && resp_ != NULL;
+}
+void DsKvIncrResponse::clear_resp() {
+  if (GetArenaNoVirtual() == NULL && resp_ != NULL) delete resp_;
+  resp_ = NULL;
+}
+const ::kvrpcpb::KvIncrResponse& DsKvIncrResponse::resp() const {
+  const ::kvrpcpb::KvIncrResponse* p = resp_;
+  // @@protoc_insertion_point(field_get:kvrpcpb.DsKvIncrResponse.resp)
+  return p != NULL ? *p : *reinterpret_cast<const ::kvrpcpb::KvIncrResponse*>(
+      &::kvrpcpb::_KvIncrResponse_default_instance_);
+}
+::kvrpcpb::KvIncrResponse* DsKvIncrResponse::mutable_resp() {
+  
+  if (resp_ == NULL) {
+    resp_ = new ::kvrpcpb::KvIncrResponse;
+  }
+  // @@protoc_insertion_point(field_mutable:kvrpcpb.DsKvIncrResponse.resp)
+  return resp_;
+}
+::kvrpcpb::KvIncrResponse* DsKvIncrResponse::release_resp() {
+  // @@protoc_insertion_point(field_release:kvrpcpb.DsKvIncrResponse.resp)
+  
+  ::kvrpcpb::KvIncrResponse* temp = resp_;
+  resp_ = NULL;
+  return temp;
+}
+void DsKvIncrResponse::set_allocated_resp(::kvrpcpb::KvIncrResponse* resp) {
+  delete resp_;
+  resp_ = resp;
+  if (resp) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.DsKvIncrResponse.resp)
+}
+
+#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
+
+// ===================================================================
+
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int KvAppendRequest::kKeyFieldNumber;
+const int KvAppendRequest::kValueFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+KvAppendRequest::KvAppendRequest()
+  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
+  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
+    protobuf_kvrpcpb_2eproto::InitDefaults();
+  }
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:kvrpcpb.KvAppendRequest)
+}
+KvAppendRequest::KvAppendRequest(const KvAppendRequest& from)
+  : ::google::protobuf::Message(),
+      _internal_metadata_(NULL),
+      _cached_size_(0) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  key_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (from.key().size() > 0) {
+    key_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.key_);
+  }
+  value_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (from.value().size() > 0) {
+    value_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.value_);
+  }
+  // @@protoc_insertion_point(copy_constructor:kvrpcpb.KvAppendRequest)
+}
+
+void KvAppendRequest::SharedCtor() {
+  key_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  value_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _cached_size_ = 0;
+}
+
+KvAppendRequest::~KvAppendRequest() {
+  // @@protoc_insertion_point(destructor:kvrpcpb.KvAppendRequest)
+  SharedDtor();
+}
+
+void KvAppendRequest::SharedDtor() {
+  key_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  value_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+
+void KvAppendRequest::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* KvAppendRequest::descriptor() {
+  protobuf_kvrpcpb_2eproto::protobuf_AssignDescriptorsOnce();
+  return protobuf_kvrpcpb_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
+}
+
+const KvAppendRequest& KvAppendRequest::default_instance() {
+  protobuf_kvrpcpb_2eproto::InitDefaults();
+  return *internal_default_instance();
+}
+
+KvAppendRequest* KvAppendRequest::New(::google::protobuf::Arena* arena) const {
+  KvAppendRequest* n = new KvAppendRequest;
+  if (arena != NULL) {
+    arena->Own(n);
+  }
+  return n;
+}
+
+void KvAppendRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:kvrpcpb.KvAppendRequest)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  key_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  value_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _internal_metadata_.Clear();
+}
+
+bool KvAppendRequest::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  // @@protoc_insertion_point(parse_start:kvrpcpb.KvAppendRequest)
+  for (;;) {
+    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // bytes key = 1;
+      case 1: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
+                input, this->mutable_key()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // bytes value = 2;
+      case 2: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(18u /* 18 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
+                input, this->mutable_value()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, _internal_metadata_.mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:kvrpcpb.KvAppendRequest)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:kvrpcpb.KvAppendRequest)
+  return false;
+#undef DO_
+}
+
+void KvAppendRequest::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:kvrpcpb.KvAppendRequest)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bytes key = 1;
+  if (this->key().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteBytesMaybeAliased(
+      1, this->key(), output);
+  }
+
+  // bytes value = 2;
+  if (this->value().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteBytesMaybeAliased(
+      2, this->value(), output);
+  }
+
+  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
+  }
+  // @@protoc_insertion_point(serialize_end:kvrpcpb.KvAppendRequest)
+}
+
+::google::protobuf::uint8* KvAppendRequest::InternalSerializeWithCachedSizesToArray(
+    bool deterministic, ::google::protobuf::uint8* target) const {
+  (void)deterministic; // Unused
+  // @@protoc_insertion_point(serialize_to_array_start:kvrpcpb.KvAppendRequest)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bytes key = 1;
+  if (this->key().size() > 0) {
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteBytesToArray(
+        1, this->key(), target);
+  }
+
+  // bytes value = 2;
+  if (this->value().size() > 0) {
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteBytesToArray(
+        2, this->value(), target);
+  }
+
+  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:kvrpcpb.KvAppendRequest)
+  return target;
+}
+
+size_t KvAppendRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:kvrpcpb.KvAppendRequest)
+  size_t total_size = 0;
+
+  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
+  }
+  // bytes key = 1;
+  if (this->key().size() > 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::BytesSize(
+        this->key());
+  }
+
+  // bytes value = 2;
+  if (this->value().size() > 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::BytesSize(
+        this->value());
+  }
+
+  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = cached_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void KvAppendRequest::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:kvrpcpb.KvAppendRequest)
+  GOOGLE_DCHECK_NE(&from, this);
+  const KvAppendRequest* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const KvAppendRequest>(
+          &from);
+  if (source == NULL) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:kvrpcpb.KvAppendRequest)
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:kvrpcpb.KvAppendRequest)
+    MergeFrom(*source);
+  }
+}
+
+void KvAppendRequest::MergeFrom(const KvAppendRequest& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:kvrpcpb.KvAppendRequest)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.key().size() > 0) {
+
+    key_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.key_);
+  }
+  if (from.value().size() > 0) {
+
+    value_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.value_);
+  }
+}
+
+void KvAppendRequest::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:kvrpcpb.KvAppendRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void KvAppendRequest::CopyFrom(const KvAppendRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:kvrpcpb.KvAppendRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool KvAppendRequest::IsInitialized() const {
+  return true;
+}
+
+void KvAppendRequest::Swap(KvAppendRequest* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void KvAppendRequest::InternalSwap(KvAppendRequest* other) {
+  using std::swap;
+  key_.Swap(&other->key_);
+  value_.Swap(&other->value_);
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  swap(_cached_size_, other->_cached_size_);
+}
+
+::google::protobuf::Metadata KvAppendRequest::GetMetadata() const {
+  protobuf_kvrpcpb_2eproto::protobuf_AssignDescriptorsOnce();
+  return protobuf_kvrpcpb_2eproto::file_level_metadata[kIndexInFileMessages];
+}
+
+#if PROTOBUF_INLINE_NOT_IN_HEADERS
+// KvAppendRequest
+
+// bytes key = 1;
+void KvAppendRequest::clear_key() {
+  key_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+const ::std::string& KvAppendRequest::key() const {
+  // @@protoc_insertion_point(field_get:kvrpcpb.KvAppendRequest.key)
+  return key_.GetNoArena();
+}
+void KvAppendRequest::set_key(const ::std::string& value) {
+  
+  key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:kvrpcpb.KvAppendRequest.key)
+}
+#if LANG_CXX11
+void KvAppendRequest::set_key(::std::string&& value) {
+  
+  key_.SetNoArena(
+    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:kvrpcpb.KvAppendRequest.key)
+}
+#endif
+void KvAppendRequest::set_key(const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  
+  key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:kvrpcpb.KvAppendRequest.key)
+}
+void KvAppendRequest::set_key(const void* value, size_t size) {
+  
+  key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:kvrpcpb.KvAppendRequest.key)
+}
+::std::string* KvAppendRequest::mutable_key() {
+  
+  // @@protoc_insertion_point(field_mutable:kvrpcpb.KvAppendRequest.key)
+  return key_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+::std::string* KvAppendRequest::release_key() {
+  // @@protoc_insertion_point(field_release:kvrpcpb.KvAppendRequest.key)
+  
+  return key_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+void KvAppendRequest::set_allocated_key(::std::string* key) {
+  if (key != NULL) {
+    
+  } else {
+    
+  }
+  key_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), key);
+  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.KvAppendRequest.key)
+}
+
+// bytes value = 2;
+void KvAppendRequest::clear_value() {
+  value_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+const ::std::string& KvAppendRequest::value() const {
+  // @@protoc_insertion_point(field_get:kvrpcpb.KvAppendRequest.value)
+  return value_.GetNoArena();
+}
+void KvAppendRequest::set_value(const ::std::string& value) {
+  
+  value_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:kvrpcpb.KvAppendRequest.value)
+}
+#if LANG_CXX11
+void KvAppendRequest::set_value(::std::string&& value) {
+  
+  value_.SetNoArena(
+    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:kvrpcpb.KvAppendRequest.value)
+}
+#endif
+void KvAppendRequest::set_value(const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  
+  value_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:kvrpcpb.KvAppendRequest.value)
+}
+void KvAppendRequest::set_value(const void* value, size_t size) {
+  
+  value_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:kvrpcpb.KvAppendRequest.value)
+}
+::std::string* KvAppendRequest::mutable_value() {
+  
+  // @@protoc_insertion_point(field_mutable:kvrpcpb.KvAppendRequest.value)
+  return value_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+::std::string* KvAppendRequest::release_value() {
+  // @@protoc_insertion_point(field_release:kvrpcpb.KvAppendRequest.value)
+  
+  return value_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+void KvAppendRequest::set_allocated_value(::std::string* value) {
+  if (value != NULL) {
+    
+  } else {
+    
+  }
+  value_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.KvAppendRequest.value)
+}
+
+#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
+
+// ===================================================================
+
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int KvAppendResponse::kCodeFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+KvAppendResponse::KvAppendResponse()
+  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
+  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
+    protobuf_kvrpcpb_2eproto::InitDefaults();
+  }
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:kvrpcpb.KvAppendResponse)
+}
+KvAppendResponse::KvAppendResponse(const KvAppendResponse& from)
+  : ::google::protobuf::Message(),
+      _internal_metadata_(NULL),
+      _cached_size_(0) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  code_ = from.code_;
+  // @@protoc_insertion_point(copy_constructor:kvrpcpb.KvAppendResponse)
+}
+
+void KvAppendResponse::SharedCtor() {
+  code_ = 0;
+  _cached_size_ = 0;
+}
+
+KvAppendResponse::~KvAppendResponse() {
+  // @@protoc_insertion_point(destructor:kvrpcpb.KvAppendResponse)
+  SharedDtor();
+}
+
+void KvAppendResponse::SharedDtor() {
+}
+
+void KvAppendResponse::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* KvAppendResponse::descriptor() {
+  protobuf_kvrpcpb_2eproto::protobuf_AssignDescriptorsOnce();
+  return protobuf_kvrpcpb_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
+}
+
+const KvAppendResponse& KvAppendResponse::default_instance() {
+  protobuf_kvrpcpb_2eproto::InitDefaults();
+  return *internal_default_instance();
+}
+
+KvAppendResponse* KvAppendResponse::New(::google::protobuf::Arena* arena) const {
+  KvAppendResponse* n = new KvAppendResponse;
+  if (arena != NULL) {
+    arena->Own(n);
+  }
+  return n;
+}
+
+void KvAppendResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:kvrpcpb.KvAppendResponse)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  code_ = 0;
+  _internal_metadata_.Clear();
+}
+
+bool KvAppendResponse::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  // @@protoc_insertion_point(parse_start:kvrpcpb.KvAppendResponse)
+  for (;;) {
+    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // int32 code = 1;
+      case 1: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(8u /* 8 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
+                 input, &code_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, _internal_metadata_.mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:kvrpcpb.KvAppendResponse)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:kvrpcpb.KvAppendResponse)
+  return false;
+#undef DO_
+}
+
+void KvAppendResponse::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:kvrpcpb.KvAppendResponse)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 code = 1;
+  if (this->code() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt32(1, this->code(), output);
+  }
+
+  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
+  }
+  // @@protoc_insertion_point(serialize_end:kvrpcpb.KvAppendResponse)
+}
+
+::google::protobuf::uint8* KvAppendResponse::InternalSerializeWithCachedSizesToArray(
+    bool deterministic, ::google::protobuf::uint8* target) const {
+  (void)deterministic; // Unused
+  // @@protoc_insertion_point(serialize_to_array_start:kvrpcpb.KvAppendResponse)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 code = 1;
+  if (this->code() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(1, this->code(), target);
+  }
+
+  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:kvrpcpb.KvAppendResponse)
+  return target;
+}
+
+size_t KvAppendResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:kvrpcpb.KvAppendResponse)
+  size_t total_size = 0;
+
+  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
+  }
+  // int32 code = 1;
+  if (this->code() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::Int32Size(
+        this->code());
+  }
+
+  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = cached_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void KvAppendResponse::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:kvrpcpb.KvAppendResponse)
+  GOOGLE_DCHECK_NE(&from, this);
+  const KvAppendResponse* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const KvAppendResponse>(
+          &from);
+  if (source == NULL) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:kvrpcpb.KvAppendResponse)
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:kvrpcpb.KvAppendResponse)
+    MergeFrom(*source);
+  }
+}
+
+void KvAppendResponse::MergeFrom(const KvAppendResponse& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:kvrpcpb.KvAppendResponse)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.code() != 0) {
+    set_code(from.code());
+  }
+}
+
+void KvAppendResponse::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:kvrpcpb.KvAppendResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void KvAppendResponse::CopyFrom(const KvAppendResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:kvrpcpb.KvAppendResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool KvAppendResponse::IsInitialized() const {
+  return true;
+}
+
+void KvAppendResponse::Swap(KvAppendResponse* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void KvAppendResponse::InternalSwap(KvAppendResponse* other) {
+  using std::swap;
+  swap(code_, other->code_);
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  swap(_cached_size_, other->_cached_size_);
+}
+
+::google::protobuf::Metadata KvAppendResponse::GetMetadata() const {
+  protobuf_kvrpcpb_2eproto::protobuf_AssignDescriptorsOnce();
+  return protobuf_kvrpcpb_2eproto::file_level_metadata[kIndexInFileMessages];
+}
+
+#if PROTOBUF_INLINE_NOT_IN_HEADERS
+// KvAppendResponse
+
+// int32 code = 1;
+void KvAppendResponse::clear_code() {
+  code_ = 0;
+}
+::google::protobuf::int32 KvAppendResponse::code() const {
+  // @@protoc_insertion_point(field_get:kvrpcpb.KvAppendResponse.code)
+  return code_;
+}
+void KvAppendResponse::set_code(::google::protobuf::int32 value) {
+  
+  code_ = value;
+  // @@protoc_insertion_point(field_set:kvrpcpb.KvAppendResponse.code)
+}
+
+#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
+
+// ===================================================================
+
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int DsKvAppendRequest::kHeaderFieldNumber;
+const int DsKvAppendRequest::kReqFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+DsKvAppendRequest::DsKvAppendRequest()
+  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
+  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
+    protobuf_kvrpcpb_2eproto::InitDefaults();
+  }
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:kvrpcpb.DsKvAppendRequest)
+}
+DsKvAppendRequest::DsKvAppendRequest(const DsKvAppendRequest& from)
+  : ::google::protobuf::Message(),
+      _internal_metadata_(NULL),
+      _cached_size_(0) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  if (from.has_header()) {
+    header_ = new ::kvrpcpb::RequestHeader(*from.header_);
+  } else {
+    header_ = NULL;
+  }
+  if (from.has_req()) {
+    req_ = new ::kvrpcpb::KvAppendRequest(*from.req_);
+  } else {
+    req_ = NULL;
+  }
+  // @@protoc_insertion_point(copy_constructor:kvrpcpb.DsKvAppendRequest)
+}
+
+void DsKvAppendRequest::SharedCtor() {
+  ::memset(&header_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&req_) -
+      reinterpret_cast<char*>(&header_)) + sizeof(req_));
+  _cached_size_ = 0;
+}
+
+DsKvAppendRequest::~DsKvAppendRequest() {
+  // @@protoc_insertion_point(destructor:kvrpcpb.DsKvAppendRequest)
+  SharedDtor();
+}
+
+void DsKvAppendRequest::SharedDtor() {
+  if (this != internal_default_instance()) delete header_;
+  if (this != internal_default_instance()) delete req_;
+}
+
+void DsKvAppendRequest::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* DsKvAppendRequest::descriptor() {
+  protobuf_kvrpcpb_2eproto::protobuf_AssignDescriptorsOnce();
+  return protobuf_kvrpcpb_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
+}
+
+const DsKvAppendRequest& DsKvAppendRequest::default_instance() {
+  protobuf_kvrpcpb_2eproto::InitDefaults();
+  return *internal_default_instance();
+}
+
+DsKvAppendRequest* DsKvAppendRequest::New(::google::protobuf::Arena* arena) const {
+  DsKvAppendRequest* n = new DsKvAppendRequest;
+  if (arena != NULL) {
+    arena->Own(n);
+  }
+  return n;
+}
+
+void DsKvAppendRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:kvrpcpb.DsKvAppendRequest)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (GetArenaNoVirtual() == NULL && header_ != NULL) {
+    delete header_;
+  }
+  header_ = NULL;
+  if (GetArenaNoVirtual() == NULL && req_ != NULL) {
+    delete req_;
+  }
+  req_ = NULL;
+  _internal_metadata_.Clear();
+}
+
+bool DsKvAppendRequest::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  // @@protoc_insertion_point(parse_start:kvrpcpb.DsKvAppendRequest)
+  for (;;) {
+    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // .kvrpcpb.RequestHeader header = 1;
+      case 1: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_header()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // .kvrpcpb.KvAppendRequest req = 2;
+      case 2: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(18u /* 18 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_req()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, _internal_metadata_.mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:kvrpcpb.DsKvAppendRequest)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:kvrpcpb.DsKvAppendRequest)
+  return false;
+#undef DO_
+}
+
+void DsKvAppendRequest::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:kvrpcpb.DsKvAppendRequest)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .kvrpcpb.RequestHeader header = 1;
+  if (this->has_header()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      1, *this->header_, output);
+  }
+
+  // .kvrpcpb.KvAppendRequest req = 2;
+  if (this->has_req()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      2, *this->req_, output);
+  }
+
+  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
+  }
+  // @@protoc_insertion_point(serialize_end:kvrpcpb.DsKvAppendRequest)
+}
+
+::google::protobuf::uint8* DsKvAppendRequest::InternalSerializeWithCachedSizesToArray(
+    bool deterministic, ::google::protobuf::uint8* target) const {
+  (void)deterministic; // Unused
+  // @@protoc_insertion_point(serialize_to_array_start:kvrpcpb.DsKvAppendRequest)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .kvrpcpb.RequestHeader header = 1;
+  if (this->has_header()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      InternalWriteMessageNoVirtualToArray(
+        1, *this->header_, deterministic, target);
+  }
+
+  // .kvrpcpb.KvAppendRequest req = 2;
+  if (this->has_req()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      InternalWriteMessageNoVirtualToArray(
+        2, *this->req_, deterministic, target);
+  }
+
+  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:kvrpcpb.DsKvAppendRequest)
+  return target;
+}
+
+size_t DsKvAppendRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:kvrpcpb.DsKvAppendRequest)
+  size_t total_size = 0;
+
+  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
+  }
+  // .kvrpcpb.RequestHeader header = 1;
+  if (this->has_header()) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+        *this->header_);
+  }
+
+  // .kvrpcpb.KvAppendRequest req = 2;
+  if (this->has_req()) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+        *this->req_);
+  }
+
+  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = cached_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void DsKvAppendRequest::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:kvrpcpb.DsKvAppendRequest)
+  GOOGLE_DCHECK_NE(&from, this);
+  const DsKvAppendRequest* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const DsKvAppendRequest>(
+          &from);
+  if (source == NULL) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:kvrpcpb.DsKvAppendRequest)
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:kvrpcpb.DsKvAppendRequest)
+    MergeFrom(*source);
+  }
+}
+
+void DsKvAppendRequest::MergeFrom(const DsKvAppendRequest& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:kvrpcpb.DsKvAppendRequest)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.has_header()) {
+    mutable_header()->::kvrpcpb::RequestHeader::MergeFrom(from.header());
+  }
+  if (from.has_req()) {
+    mutable_req()->::kvrpcpb::KvAppendRequest::MergeFrom(from.req());
+  }
+}
+
+void DsKvAppendRequest::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:kvrpcpb.DsKvAppendRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void DsKvAppendRequest::CopyFrom(const DsKvAppendRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:kvrpcpb.DsKvAppendRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool DsKvAppendRequest::IsInitialized() const {
+  return true;
+}
+
+void DsKvAppendRequest::Swap(DsKvAppendRequest* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void DsKvAppendRequest::InternalSwap(DsKvAppendRequest* other) {
+  using std::swap;
+  swap(header_, other->header_);
+  swap(req_, other->req_);
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  swap(_cached_size_, other->_cached_size_);
+}
+
+::google::protobuf::Metadata DsKvAppendRequest::GetMetadata() const {
+  protobuf_kvrpcpb_2eproto::protobuf_AssignDescriptorsOnce();
+  return protobuf_kvrpcpb_2eproto::file_level_metadata[kIndexInFileMessages];
+}
+
+#if PROTOBUF_INLINE_NOT_IN_HEADERS
+// DsKvAppendRequest
+
+// .kvrpcpb.RequestHeader header = 1;
+bool DsKvAppendRequest::has_header() const {
+  return this != internal_default_instance() && header_ != NULL;
+}
+void DsKvAppendRequest::clear_header() {
+  if (GetArenaNoVirtual() == NULL && header_ != NULL) delete header_;
+  header_ = NULL;
+}
+const ::kvrpcpb::RequestHeader& DsKvAppendRequest::header() const {
+  const ::kvrpcpb::RequestHeader* p = header_;
+  // @@protoc_insertion_point(field_get:kvrpcpb.DsKvAppendRequest.header)
+  return p != NULL ? *p : *reinterpret_cast<const ::kvrpcpb::RequestHeader*>(
+      &::kvrpcpb::_RequestHeader_default_instance_);
+}
+::kvrpcpb::RequestHeader* DsKvAppendRequest::mutable_header() {
+  
+  if (header_ == NULL) {
+    header_ = new ::kvrpcpb::RequestHeader;
+  }
+  // @@protoc_insertion_point(field_mutable:kvrpcpb.DsKvAppendRequest.header)
+  return header_;
+}
+::kvrpcpb::RequestHeader* DsKvAppendRequest::release_header() {
+  // @@protoc_insertion_point(field_release:kvrpcpb.DsKvAppendRequest.header)
+  
+  ::kvrpcpb::RequestHeader* temp = header_;
+  header_ = NULL;
+  return temp;
+}
+void DsKvAppendRequest::set_allocated_header(::kvrpcpb::RequestHeader* header) {
+  delete header_;
+  header_ = header;
+  if (header) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.DsKvAppendRequest.header)
+}
+
+// .kvrpcpb.KvAppendRequest req = 2;
+bool DsKvAppendRequest::has_req() const {
+  return this != internal_default_instance() && req_ != NULL;
+}
+void DsKvAppendRequest::clear_req() {
+  if (GetArenaNoVirtual() == NULL && req_ != NULL) delete req_;
+  req_ = NULL;
+}
+const ::kvrpcpb::KvAppendRequest& DsKvAppendRequest::req() const {
+  const ::kvrpcpb::KvAppendRequest* p = req_;
+  // @@protoc_insertion_point(field_get:kvrpcpb.DsKvAppendRequest.req)
+  return p != NULL ? *p : *reinterpret_cast<const ::kvrpcpb::KvAppendRequest*>(
+      &::kvrpcpb::_KvAppendRequest_default_instance_);
+}
+::kvrpcpb::KvAppendRequest* DsKvAppendRequest::mutable_req() {
+  
+  if (req_ == NULL) {
+    req_ = new ::kvrpcpb::KvAppendRequest;
+  }
+  // @@protoc_insertion_point(field_mutable:kvrpcpb.DsKvAppendRequest.req)
+  return req_;
+}
+::kvrpcpb::KvAppendRequest* DsKvAppendRequest::release_req() {
+  // @@protoc_insertion_point(field_release:kvrpcpb.DsKvAppendRequest.req)
+  
+  ::kvrpcpb::KvAppendRequest* temp = req_;
+  req_ = NULL;
+  return temp;
+}
+void DsKvAppendRequest::set_allocated_req(::kvrpcpb::KvAppendRequest* req) {
+  delete req_;
+  req_ = req;
+  if (req) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.DsKvAppendRequest.req)
+}
+
+#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
+
+// ===================================================================
+
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int DsKvAppendResponse::kHeaderFieldNumber;
+const int DsKvAppendResponse::kRespFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+DsKvAppendResponse::DsKvAppendResponse()
+  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
+  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
+    protobuf_kvrpcpb_2eproto::InitDefaults();
+  }
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:kvrpcpb.DsKvAppendResponse)
+}
+DsKvAppendResponse::DsKvAppendResponse(const DsKvAppendResponse& from)
+  : ::google::protobuf::Message(),
+      _internal_metadata_(NULL),
+      _cached_size_(0) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  if (from.has_header()) {
+    header_ = new ::kvrpcpb::ResponseHeader(*from.header_);
+  } else {
+    header_ = NULL;
+  }
+  if (from.has_resp()) {
+    resp_ = new ::kvrpcpb::KvAppendResponse(*from.resp_);
+  } else {
+    resp_ = NULL;
+  }
+  // @@protoc_insertion_point(copy_constructor:kvrpcpb.DsKvAppendResponse)
+}
+
+void DsKvAppendResponse::SharedCtor() {
+  ::memset(&header_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&resp_) -
+      reinterpret_cast<char*>(&header_)) + sizeof(resp_));
+  _cached_size_ = 0;
+}
+
+DsKvAppendResponse::~DsKvAppendResponse() {
+  // @@protoc_insertion_point(destructor:kvrpcpb.DsKvAppendResponse)
+  SharedDtor();
+}
+
+void DsKvAppendResponse::SharedDtor() {
+  if (this != internal_default_instance()) delete header_;
+  if (this != internal_default_instance()) delete resp_;
+}
+
+void DsKvAppendResponse::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* DsKvAppendResponse::descriptor() {
+  protobuf_kvrpcpb_2eproto::protobuf_AssignDescriptorsOnce();
+  return protobuf_kvrpcpb_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
+}
+
+const DsKvAppendResponse& DsKvAppendResponse::default_instance() {
+  protobuf_kvrpcpb_2eproto::InitDefaults();
+  return *internal_default_instance();
+}
+
+DsKvAppendResponse* DsKvAppendResponse::New(::google::protobuf::Arena* arena) const {
+  DsKvAppendResponse* n = new DsKvAppendResponse;
+  if (arena != NULL) {
+    arena->Own(n);
+  }
+  return n;
+}
+
+void DsKvAppendResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:kvrpcpb.DsKvAppendResponse)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (GetArenaNoVirtual() == NULL && header_ != NULL) {
+    delete header_;
+  }
+  header_ = NULL;
+  if (GetArenaNoVirtual() == NULL && resp_ != NULL) {
+    delete resp_;
+  }
+  resp_ = NULL;
+  _internal_metadata_.Clear();
+}
+
+bool DsKvAppendResponse::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  // @@protoc_insertion_point(parse_start:kvrpcpb.DsKvAppendResponse)
+  for (;;) {
+    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // .kvrpcpb.ResponseHeader header = 1;
+      case 1: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_header()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // .kvrpcpb.KvAppendResponse resp = 2;
+      case 2: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(18u /* 18 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_resp()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, _internal_metadata_.mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:kvrpcpb.DsKvAppendResponse)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:kvrpcpb.DsKvAppendResponse)
+  return false;
+#undef DO_
+}
+
+void DsKvAppendResponse::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:kvrpcpb.DsKvAppendResponse)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .kvrpcpb.ResponseHeader header = 1;
+  if (this->has_header()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      1, *this->header_, output);
+  }
+
+  // .kvrpcpb.KvAppendResponse resp = 2;
+  if (this->has_resp()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      2, *this->resp_, output);
+  }
+
+  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
+  }
+  // @@protoc_insertion_point(serialize_end:kvrpcpb.DsKvAppendResponse)
+}
+
+::google::protobuf::uint8* DsKvAppendResponse::InternalSerializeWithCachedSizesToArray(
+    bool deterministic, ::google::protobuf::uint8* target) const {
+  (void)deterministic; // Unused
+  // @@protoc_insertion_point(serialize_to_array_start:kvrpcpb.DsKvAppendResponse)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .kvrpcpb.ResponseHeader header = 1;
+  if (this->has_header()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      InternalWriteMessageNoVirtualToArray(
+        1, *this->header_, deterministic, target);
+  }
+
+  // .kvrpcpb.KvAppendResponse resp = 2;
+  if (this->has_resp()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      InternalWriteMessageNoVirtualToArray(
+        2, *this->resp_, deterministic, target);
+  }
+
+  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:kvrpcpb.DsKvAppendResponse)
+  return target;
+}
+
+size_t DsKvAppendResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:kvrpcpb.DsKvAppendResponse)
+  size_t total_size = 0;
+
+  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
+  }
+  // .kvrpcpb.ResponseHeader header = 1;
+  if (this->has_header()) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+        *this->header_);
+  }
+
+  // .kvrpcpb.KvAppendResponse resp = 2;
+  if (this->has_resp()) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+        *this->resp_);
+  }
+
+  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = cached_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void DsKvAppendResponse::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:kvrpcpb.DsKvAppendResponse)
+  GOOGLE_DCHECK_NE(&from, this);
+  const DsKvAppendResponse* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const DsKvAppendResponse>(
+          &from);
+  if (source == NULL) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:kvrpcpb.DsKvAppendResponse)
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:kvrpcpb.DsKvAppendResponse)
+    MergeFrom(*source);
+  }
+}
+
+void DsKvAppendResponse::MergeFrom(const DsKvAppendResponse& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:kvrpcpb.DsKvAppendResponse)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.has_header()) {
+    mutable_header()->::kvrpcpb::ResponseHeader::MergeFrom(from.header());
+  }
+  if (from.has_resp()) {
+    mutable_resp()->::kvrpcpb::KvAppendResponse::MergeFrom(from.resp());
+  }
+}
+
+void DsKvAppendResponse::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:kvrpcpb.DsKvAppendResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void DsKvAppendResponse::CopyFrom(const DsKvAppendResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:kvrpcpb.DsKvAppendResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool DsKvAppendResponse::IsInitialized() const {
+  return true;
+}
+
+void DsKvAppendResponse::Swap(DsKvAppendResponse* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void DsKvAppendResponse::InternalSwap(DsKvAppendResponse* other) {
+  using std::swap;
+  swap(header_, other->header_);
+  swap(resp_, other->resp_);
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  swap(_cached_size_, other->_cached_size_);
+}
+
+::google::protobuf::Metadata DsKvAppendResponse::GetMetadata() const {
+  protobuf_kvrpcpb_2eproto::protobuf_AssignDescriptorsOnce();
+  return protobuf_kvrpcpb_2eproto::file_level_metadata[kIndexInFileMessages];
+}
+
+#if PROTOBUF_INLINE_NOT_IN_HEADERS
+// DsKvAppendResponse
+
+// .kvrpcpb.ResponseHeader header = 1;
+bool DsKvAppendResponse::has_header() const {
+  return this != internal_default_instance() && header_ != NULL;
+}
+void DsKvAppendResponse::clear_header() {
+  if (GetArenaNoVirtual() == NULL && header_ != NULL) delete header_;
+  header_ = NULL;
+}
+const ::kvrpcpb::ResponseHeader& DsKvAppendResponse::header() const {
+  const ::kvrpcpb::ResponseHeader* p = header_;
+  // @@protoc_insertion_point(field_get:kvrpcpb.DsKvAppendResponse.header)
+  return p != NULL ? *p : *reinterpret_cast<const ::kvrpcpb::ResponseHeader*>(
+      &::kvrpcpb::_ResponseHeader_default_instance_);
+}
+::kvrpcpb::ResponseHeader* DsKvAppendResponse::mutable_header() {
+  
+  if (header_ == NULL) {
+    header_ = new ::kvrpcpb::ResponseHeader;
+  }
+  // @@protoc_insertion_point(field_mutable:kvrpcpb.DsKvAppendResponse.header)
+  return header_;
+}
+::kvrpcpb::ResponseHeader* DsKvAppendResponse::release_header() {
+  // @@protoc_insertion_point(field_release:kvrpcpb.DsKvAppendResponse.header)
+  
+  ::kvrpcpb::ResponseHeader* temp = header_;
+  header_ = NULL;
+  return temp;
+}
+void DsKvAppendResponse::set_allocated_header(::kvrpcpb::ResponseHeader* header) {
+  delete header_;
+  header_ = header;
+  if (header) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.DsKvAppendResponse.header)
+}
+
+// .kvrpcpb.KvAppendResponse resp = 2;
+bool DsKvAppendResponse::has_resp() const {
+  return this != internal_default_instance() && resp_ != NULL;
+}
+void DsKvAppendResponse::clear_resp() {
+  if (GetArenaNoVirtual() == NULL && resp_ != NULL) delete resp_;
+  resp_ = NULL;
+}
+const ::kvrpcpb::KvAppendResponse& DsKvAppendResponse::resp() const {
+  const ::kvrpcpb::KvAppendResponse* p = resp_;
+  // @@protoc_insertion_point(field_get:kvrpcpb.DsKvAppendResponse.resp)
+  return p != NULL ? *p : *reinterpret_cast<const ::kvrpcpb::KvAppendResponse*>(
+      &::kvrpcpb::_KvAppendResponse_default_instance_);
+}
+::kvrpcpb::KvAppendResponse* DsKvAppendResponse::mutable_resp() {
+  
+  if (resp_ == NULL) {
+    resp_ = new ::kvrpcpb::KvAppendResponse;
+  }
+  // @@protoc_insertion_point(field_mutable:kvrpcpb.DsKvAppendResponse.resp)
+  return resp_;
+}
+::kvrpcpb::KvAppendResponse* DsKvAppendResponse::release_resp() {
+  // @@protoc_insertion_point(field_release:kvrpcpb.DsKvAppendResponse.resp)
+  
+  ::kvrpcpb::KvAppendResponse* temp = resp_;
+  resp_ = NULL;
+  return temp;
+}
+void DsKvAppendResponse::set_allocated_resp(::kvrpcpb::KvAppendResponse* resp) {
+  delete resp_;
+  resp_ = resp;
+  if (resp) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.DsKvAppendResponse.resp)
+}
+
+#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
+
+// ===================================================================
+
 #if !defined(_MSC_VER) || _MSC_VER >= 1900
 const int LockValue::kValueFieldNumber;
 const int LockValue::kIdFieldNumber;
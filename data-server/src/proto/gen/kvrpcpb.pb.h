@@ -59,6 +59,12 @@ extern DsInsertRequestDefaultTypeInternal _DsInsertRequest_default_instance_;
 class DsInsertResponse;
 class DsInsertResponseDefaultTypeInternal;
 extern DsInsertResponseDefaultTypeInternal _DsInsertResponse_default_instance_;
+class DsKvAppendRequest;
+class DsKvAppendRequestDefaultTypeInternal;
+extern DsKvAppendRequestDefaultTypeInternal _DsKvAppendRequest_default_instance_;
+class DsKvAppendResponse;
+class DsKvAppendResponseDefaultTypeInternal;
+extern DsKvAppendResponseDefaultTypeInternal _DsKvAppendResponse_default_instance_;
 class DsKvBatchDeleteRequest;
 class DsKvBatchDeleteRequestDefaultTypeInternal;
 extern DsKvBatchDeleteRequestDefaultTypeInternal _DsKvBatchDeleteRequest_default_instance_;
@@ -89,6 +95,12 @@ extern DsKvGetRequestDefaultTypeInternal _DsKvGetRequest_default_instance_;
 class DsKvGetResponse;
 class DsKvGetResponseDefaultTypeInternal;
 extern DsKvGetResponseDefaultTypeInternal _DsKvGetResponse_default_instance_;
+class DsKvIncrRequest;
+class DsKvIncrRequestDefaultTypeInternal;
+extern DsKvIncrRequestDefaultTypeInternal _DsKvIncrRequest_default_instance_;
+class DsKvIncrResponse;
+class DsKvIncrResponseDefaultTypeInternal;
+extern DsKvIncrResponseDefaultTypeInternal _DsKvIncrResponse_default_instance_;
 class DsKvRangeDeleteRequest;
 class DsKvRangeDeleteRequestDefaultTypeInternal;
 extern DsKvRangeDeleteRequestDefaultTypeInternal _DsKvRangeDeleteRequest_default_instance_;
@@ -179,6 +191,12 @@ extern InsertResponseDefaultTypeInternal _InsertResponse_default_instance_;
 class KeyValue;
 class KeyValueDefaultTypeInternal;
 extern KeyValueDefaultTypeInternal _KeyValue_default_instance_;
+class KvAppendRequest;
+class KvAppendRequestDefaultTypeInternal;
+extern KvAppendRequestDefaultTypeInternal _KvAppendRequest_default_instance_;
+class KvAppendResponse;
+class KvAppendResponseDefaultTypeInternal;
+extern KvAppendResponseDefaultTypeInternal _KvAppendResponse_default_instance_;
 class KvBatchDeleteRequest;
 class KvBatchDeleteRequestDefaultTypeInternal;
 extern KvBatchDeleteRequestDefaultTypeInternal _KvBatchDeleteRequest_default_instance_;
@@ -209,6 +227,12 @@ extern KvGetRequestDefaultTypeInternal _KvGetRequest_default_instance_;
 class KvGetResponse;
 class KvGetResponseDefaultTypeInternal;
 extern KvGetResponseDefaultTypeInternal _KvGetResponse_default_instance_;
+class KvIncrRequest;
+class KvIncrRequestDefaultTypeInternal;
+extern KvIncrRequestDefaultTypeInternal _KvIncrRequest_default_instance_;
+class KvIncrResponse;
+class KvIncrResponseDefaultTypeInternal;
+extern KvIncrResponseDefaultTypeInternal _KvIncrResponse_default_instance_;
 class KvPair;
 class KvPairDefaultTypeInternal;
 extern KvPairDefaultTypeInternal _KvPair_default_instance_;
@@ -3424,6 +3448,18 @@ class SelectRequest : public ::google::protobuf::Message /* @@protoc_insertion_p
   ::timestamp::Timestamp* release_timestamp();
   void set_allocated_timestamp(::timestamp::Timestamp* timestamp);
 
+  // uint64 snapshot_id = 9;
+  void clear_snapshot_id();
+  static const int kSnapshotIdFieldNumber = 9;
+  ::google::protobuf::uint64 snapshot_id() const;
+  void set_snapshot_id(::google::protobuf::uint64 value);
+
+  // bool open_snapshot = 8;
+  void clear_open_snapshot();
+  static const int kOpenSnapshotFieldNumber = 8;
+  bool open_snapshot() const;
+  void set_open_snapshot(bool value);
+
   // @@protoc_insertion_point(class_scope:kvrpcpb.SelectRequest)
  private:
 
@@ -3435,6 +3471,8 @@ class SelectRequest : public ::google::protobuf::Message /* @@protoc_insertion_p
   ::kvrpcpb::Scope* scope_;
   ::kvrpcpb::Limit* limit_;
   ::timestamp::Timestamp* timestamp_;
+  ::google::protobuf::uint64 snapshot_id_;
+  bool open_snapshot_;
   mutable int _cached_size_;
   friend struct protobuf_kvrpcpb_2eproto::TableStruct;
 };
@@ -3783,6 +3821,12 @@ class SelectResponse : public ::google::protobuf::Message /* @@protoc_insertion_
   ::google::protobuf::uint64 offset() const;
   void set_offset(::google::protobuf::uint64 value);
 
+  // uint64 snapshot_id = 4;
+  void clear_snapshot_id();
+  static const int kSnapshotIdFieldNumber = 4;
+  ::google::protobuf::uint64 snapshot_id() const;
+  void set_snapshot_id(::google::protobuf::uint64 value);
+
   // int32 code = 1;
   void clear_code();
   static const int kCodeFieldNumber = 1;
@@ -3795,6 +3839,7 @@ class SelectResponse : public ::google::protobuf::Message /* @@protoc_insertion_
   ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
   ::google::protobuf::RepeatedPtrField< ::kvrpcpb::Row > rows_;
   ::google::protobuf::uint64 offset_;
+  ::google::protobuf::uint64 snapshot_id_;
   ::google::protobuf::int32 code_;
   mutable int _cached_size_;
   friend struct protobuf_kvrpcpb_2eproto::TableStruct;
@@ -7302,6 +7347,12 @@ class KvScanRequest : public ::google::protobuf::Message /* @@protoc_insertion_p
   ::google::protobuf::int64 max_count() const;
   void set_max_count(::google::protobuf::int64 value);
 
+  // uint64 snapshot_id = 7;
+  void clear_snapshot_id();
+  static const int kSnapshotIdFieldNumber = 7;
+  ::google::protobuf::uint64 snapshot_id() const;
+  void set_snapshot_id(::google::protobuf::uint64 value);
+
   // bool count_only = 3;
   void clear_count_only();
   static const int kCountOnlyFieldNumber = 3;
@@ -7314,6 +7365,12 @@ class KvScanRequest : public ::google::protobuf::Message /* @@protoc_insertion_p
   bool key_only() const;
   void set_key_only(bool value);
 
+  // bool open_snapshot = 6;
+  void clear_open_snapshot();
+  static const int kOpenSnapshotFieldNumber = 6;
+  bool open_snapshot() const;
+  void set_open_snapshot(bool value);
+
   // @@protoc_insertion_point(class_scope:kvrpcpb.KvScanRequest)
  private:
 
@@ -7321,8 +7378,10 @@ class KvScanRequest : public ::google::protobuf::Message /* @@protoc_insertion_p
   ::google::protobuf::internal::ArenaStringPtr start_;
   ::google::protobuf::internal::ArenaStringPtr limit_;
   ::google::protobuf::int64 max_count_;
+  ::google::protobuf::uint64 snapshot_id_;
   bool count_only_;
   bool key_only_;
+  bool open_snapshot_;
   mutable int _cached_size_;
   friend struct protobuf_kvrpcpb_2eproto::TableStruct;
 };
@@ -7441,6 +7500,12 @@ class KvScanResponse : public ::google::protobuf::Message /* @@protoc_insertion_
   ::google::protobuf::int64 count() const;
   void set_count(::google::protobuf::int64 value);
 
+  // uint64 snapshot_id = 5;
+  void clear_snapshot_id();
+  static const int kSnapshotIdFieldNumber = 5;
+  ::google::protobuf::uint64 snapshot_id() const;
+  void set_snapshot_id(::google::protobuf::uint64 value);
+
   // int32 code = 1;
   void clear_code();
   static const int kCodeFieldNumber = 1;
@@ -7454,6 +7519,7 @@ class KvScanResponse : public ::google::protobuf::Message /* @@protoc_insertion_
   ::google::protobuf::RepeatedPtrField< ::kvrpcpb::RedisKeyValue > kvs_;
   ::google::protobuf::internal::ArenaStringPtr last_key_;
   ::google::protobuf::int64 count_;
+  ::google::protobuf::uint64 snapshot_id_;
   ::google::protobuf::int32 code_;
   mutable int _cached_size_;
   friend struct protobuf_kvrpcpb_2eproto::TableStruct;
@@ -9033,24 +9099,24 @@ class DsKvRangeDeleteResponse : public ::google::protobuf::Message /* @@protoc_i
 };
 // -------------------------------------------------------------------
 
-class LockValue : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:kvrpcpb.LockValue) */ {
+class KvIncrRequest : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:kvrpcpb.KvIncrRequest) */ {
  public:
-  LockValue();
-  virtual ~LockValue();
+  KvIncrRequest();
+  virtual ~KvIncrRequest();
 
-  LockValue(const LockValue& from);
+  KvIncrRequest(const KvIncrRequest& from);
 
-  inline LockValue& operator=(const LockValue& from) {
+  inline KvIncrRequest& operator=(const KvIncrRequest& from) {
     CopyFrom(from);
     return *this;
   }
   #if LANG_CXX11
-  LockValue(LockValue&& from) noexcept
-    : LockValue() {
+  KvIncrRequest(KvIncrRequest&& from) noexcept
+    : KvIncrRequest() {
     *this = ::std::move(from);
   }
 
-  inline LockValue& operator=(LockValue&& from) noexcept {
+  inline KvIncrRequest& operator=(KvIncrRequest&& from) noexcept {
     if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
       if (this != &from) InternalSwap(&from);
     } else {
@@ -9060,29 +9126,29 @@ class LockValue : public ::google::protobuf::Message /* @@protoc_insertion_point
   }
   #endif
   static const ::google::protobuf::Descriptor* descriptor();
-  static const LockValue& default_instance();
+  static const KvIncrRequest& default_instance();
 
-  static inline const LockValue* internal_default_instance() {
-    return reinterpret_cast<const LockValue*>(
-               &_LockValue_default_instance_);
+  static inline const KvIncrRequest* internal_default_instance() {
+    return reinterpret_cast<const KvIncrRequest*>(
+               &_KvIncrRequest_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
     75;
 
-  void Swap(LockValue* other);
-  friend void swap(LockValue& a, LockValue& b) {
+  void Swap(KvIncrRequest* other);
+  friend void swap(KvIncrRequest& a, KvIncrRequest& b) {
     a.Swap(&b);
   }
 
   // implements Message ----------------------------------------------
 
-  inline LockValue* New() const PROTOBUF_FINAL { return New(NULL); }
+  inline KvIncrRequest* New() const PROTOBUF_FINAL { return New(NULL); }
 
-  LockValue* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
+  KvIncrRequest* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
   void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
   void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
-  void CopyFrom(const LockValue& from);
-  void MergeFrom(const LockValue& from);
+  void CopyFrom(const KvIncrRequest& from);
+  void MergeFrom(const KvIncrRequest& from);
   void Clear() PROTOBUF_FINAL;
   bool IsInitialized() const PROTOBUF_FINAL;
 
@@ -9098,7 +9164,7 @@ class LockValue : public ::google::protobuf::Message /* @@protoc_insertion_point
   void SharedCtor();
   void SharedDtor();
   void SetCachedSize(int size) const PROTOBUF_FINAL;
-  void InternalSwap(LockValue* other);
+  void InternalSwap(KvIncrRequest* other);
   private:
   inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
     return NULL;
@@ -9114,84 +9180,55 @@ class LockValue : public ::google::protobuf::Message /* @@protoc_insertion_point
 
   // accessors -------------------------------------------------------
 
-  // bytes value = 2;
-  void clear_value();
-  static const int kValueFieldNumber = 2;
-  const ::std::string& value() const;
-  void set_value(const ::std::string& value);
-  #if LANG_CXX11
-  void set_value(::std::string&& value);
-  #endif
-  void set_value(const char* value);
-  void set_value(const void* value, size_t size);
-  ::std::string* mutable_value();
-  ::std::string* release_value();
-  void set_allocated_value(::std::string* value);
-
-  // string id = 3;
-  void clear_id();
-  static const int kIdFieldNumber = 3;
-  const ::std::string& id() const;
-  void set_id(const ::std::string& value);
+  // bytes key = 1;
+  void clear_key();
+  static const int kKeyFieldNumber = 1;
+  const ::std::string& key() const;
+  void set_key(const ::std::string& value);
   #if LANG_CXX11
-  void set_id(::std::string&& value);
+  void set_key(::std::string&& value);
   #endif
-  void set_id(const char* value);
-  void set_id(const char* value, size_t size);
-  ::std::string* mutable_id();
-  ::std::string* release_id();
-  void set_allocated_id(::std::string* id);
-
-  // int64 delete_time = 4;
-  void clear_delete_time();
-  static const int kDeleteTimeFieldNumber = 4;
-  ::google::protobuf::int64 delete_time() const;
-  void set_delete_time(::google::protobuf::int64 value);
-
-  // int64 update_time = 5;
-  void clear_update_time();
-  static const int kUpdateTimeFieldNumber = 5;
-  ::google::protobuf::int64 update_time() const;
-  void set_update_time(::google::protobuf::int64 value);
+  void set_key(const char* value);
+  void set_key(const void* value, size_t size);
+  ::std::string* mutable_key();
+  ::std::string* release_key();
+  void set_allocated_key(::std::string* key);
 
-  // bool delete_flag = 6;
-  void clear_delete_flag();
-  static const int kDeleteFlagFieldNumber = 6;
-  bool delete_flag() const;
-  void set_delete_flag(bool value);
+  // int64 delta = 2;
+  void clear_delta();
+  static const int kDeltaFieldNumber = 2;
+  ::google::protobuf::int64 delta() const;
+  void set_delta(::google::protobuf::int64 value);
 
-  // @@protoc_insertion_point(class_scope:kvrpcpb.LockValue)
+  // @@protoc_insertion_point(class_scope:kvrpcpb.KvIncrRequest)
  private:
 
   ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::internal::ArenaStringPtr value_;
-  ::google::protobuf::internal::ArenaStringPtr id_;
-  ::google::protobuf::int64 delete_time_;
-  ::google::protobuf::int64 update_time_;
-  bool delete_flag_;
+  ::google::protobuf::internal::ArenaStringPtr key_;
+  ::google::protobuf::int64 delta_;
   mutable int _cached_size_;
   friend struct protobuf_kvrpcpb_2eproto::TableStruct;
 };
 // -------------------------------------------------------------------
 
-class LockRequest : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:kvrpcpb.LockRequest) */ {
+class KvIncrResponse : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:kvrpcpb.KvIncrResponse) */ {
  public:
-  LockRequest();
-  virtual ~LockRequest();
+  KvIncrResponse();
+  virtual ~KvIncrResponse();
 
-  LockRequest(const LockRequest& from);
+  KvIncrResponse(const KvIncrResponse& from);
 
-  inline LockRequest& operator=(const LockRequest& from) {
+  inline KvIncrResponse& operator=(const KvIncrResponse& from) {
     CopyFrom(from);
     return *this;
   }
   #if LANG_CXX11
-  LockRequest(LockRequest&& from) noexcept
-    : LockRequest() {
+  KvIncrResponse(KvIncrResponse&& from) noexcept
+    : KvIncrResponse() {
     *this = ::std::move(from);
   }
 
-  inline LockRequest& operator=(LockRequest&& from) noexcept {
+  inline KvIncrResponse& operator=(KvIncrResponse&& from) noexcept {
     if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
       if (this != &from) InternalSwap(&from);
     } else {
@@ -9201,29 +9238,29 @@ class LockRequest : public ::google::protobuf::Message /* @@protoc_insertion_poi
   }
   #endif
   static const ::google::protobuf::Descriptor* descriptor();
-  static const LockRequest& default_instance();
+  static const KvIncrResponse& default_instance();
 
-  static inline const LockRequest* internal_default_instance() {
-    return reinterpret_cast<const LockRequest*>(
-               &_LockRequest_default_instance_);
+  static inline const KvIncrResponse* internal_default_instance() {
+    return reinterpret_cast<const KvIncrResponse*>(
+               &_KvIncrResponse_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
     76;
 
-  void Swap(LockRequest* other);
-  friend void swap(LockRequest& a, LockRequest& b) {
+  void Swap(KvIncrResponse* other);
+  friend void swap(KvIncrResponse& a, KvIncrResponse& b) {
     a.Swap(&b);
   }
 
   // implements Message ----------------------------------------------
 
-  inline LockRequest* New() const PROTOBUF_FINAL { return New(NULL); }
+  inline KvIncrResponse* New() const PROTOBUF_FINAL { return New(NULL); }
 
-  LockRequest* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
+  KvIncrResponse* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
   void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
   void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
-  void CopyFrom(const LockRequest& from);
-  void MergeFrom(const LockRequest& from);
+  void CopyFrom(const KvIncrResponse& from);
+  void MergeFrom(const KvIncrResponse& from);
   void Clear() PROTOBUF_FINAL;
   bool IsInitialized() const PROTOBUF_FINAL;
 
@@ -9239,7 +9276,7 @@ class LockRequest : public ::google::protobuf::Message /* @@protoc_insertion_poi
   void SharedCtor();
   void SharedDtor();
   void SetCachedSize(int size) const PROTOBUF_FINAL;
-  void InternalSwap(LockRequest* other);
+  void InternalSwap(KvIncrResponse* other);
   private:
   inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
     return NULL;
@@ -9255,83 +9292,40 @@ class LockRequest : public ::google::protobuf::Message /* @@protoc_insertion_poi
 
   // accessors -------------------------------------------------------
 
-  // bytes key = 1;
-  void clear_key();
-  static const int kKeyFieldNumber = 1;
-  const ::std::string& key() const;
-  void set_key(const ::std::string& value);
-  #if LANG_CXX11
-  void set_key(::std::string&& value);
-  #endif
-  void set_key(const char* value);
-  void set_key(const void* value, size_t size);
-  ::std::string* mutable_key();
-  ::std::string* release_key();
-  void set_allocated_key(::std::string* key);
-
-  // string by = 11;
-  void clear_by();
-  static const int kByFieldNumber = 11;
-  const ::std::string& by() const;
-  void set_by(const ::std::string& value);
-  #if LANG_CXX11
-  void set_by(::std::string&& value);
-  #endif
-  void set_by(const char* value);
-  void set_by(const char* value, size_t size);
-  ::std::string* mutable_by();
-  ::std::string* release_by();
-  void set_allocated_by(::std::string* by);
-
-  // .kvrpcpb.LockValue value = 2;
-  bool has_value() const;
-  void clear_value();
-  static const int kValueFieldNumber = 2;
-  const ::kvrpcpb::LockValue& value() const;
-  ::kvrpcpb::LockValue* mutable_value();
-  ::kvrpcpb::LockValue* release_value();
-  void set_allocated_value(::kvrpcpb::LockValue* value);
-
-  // .timestamp.Timestamp timestamp = 10;
-  bool has_timestamp() const;
-  void clear_timestamp();
-  static const int kTimestampFieldNumber = 10;
-  const ::timestamp::Timestamp& timestamp() const;
-  ::timestamp::Timestamp* mutable_timestamp();
-  ::timestamp::Timestamp* release_timestamp();
-  void set_allocated_timestamp(::timestamp::Timestamp* timestamp);
+  // int32 code = 1;
+  void clear_code();
+  static const int kCodeFieldNumber = 1;
+  ::google::protobuf::int32 code() const;
+  void set_code(::google::protobuf::int32 value);
 
-  // @@protoc_insertion_point(class_scope:kvrpcpb.LockRequest)
+  // @@protoc_insertion_point(class_scope:kvrpcpb.KvIncrResponse)
  private:
 
   ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::internal::ArenaStringPtr key_;
-  ::google::protobuf::internal::ArenaStringPtr by_;
-  ::kvrpcpb::LockValue* value_;
-  ::timestamp::Timestamp* timestamp_;
+  ::google::protobuf::int32 code_;
   mutable int _cached_size_;
   friend struct protobuf_kvrpcpb_2eproto::TableStruct;
 };
 // -------------------------------------------------------------------
 
-class DsLockRequest : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:kvrpcpb.DsLockRequest) */ {
+class DsKvIncrRequest : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:kvrpcpb.DsKvIncrRequest) */ {
  public:
-  DsLockRequest();
-  virtual ~DsLockRequest();
+  DsKvIncrRequest();
+  virtual ~DsKvIncrRequest();
 
-  DsLockRequest(const DsLockRequest& from);
+  DsKvIncrRequest(const DsKvIncrRequest& from);
 
-  inline DsLockRequest& operator=(const DsLockRequest& from) {
+  inline DsKvIncrRequest& operator=(const DsKvIncrRequest& from) {
     CopyFrom(from);
     return *this;
   }
   #if LANG_CXX11
-  DsLockRequest(DsLockRequest&& from) noexcept
-    : DsLockRequest() {
+  DsKvIncrRequest(DsKvIncrRequest&& from) noexcept
+    : DsKvIncrRequest() {
     *this = ::std::move(from);
   }
 
-  inline DsLockRequest& operator=(DsLockRequest&& from) noexcept {
+  inline DsKvIncrRequest& operator=(DsKvIncrRequest&& from) noexcept {
     if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
       if (this != &from) InternalSwap(&from);
     } else {
@@ -9341,29 +9335,29 @@ class DsLockRequest : public ::google::protobuf::Message /* @@protoc_insertion_p
   }
   #endif
   static const ::google::protobuf::Descriptor* descriptor();
-  static const DsLockRequest& default_instance();
+  static const DsKvIncrRequest& default_instance();
 
-  static inline const DsLockRequest* internal_default_instance() {
-    return reinterpret_cast<const DsLockRequest*>(
-               &_DsLockRequest_default_instance_);
+  static inline const DsKvIncrRequest* internal_default_instance() {
+    return reinterpret_cast<const DsKvIncrRequest*>(
+               &_DsKvIncrRequest_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
     77;
 
-  void Swap(DsLockRequest* other);
-  friend void swap(DsLockRequest& a, DsLockRequest& b) {
+  void Swap(DsKvIncrRequest* other);
+  friend void swap(DsKvIncrRequest& a, DsKvIncrRequest& b) {
     a.Swap(&b);
   }
 
   // implements Message ----------------------------------------------
 
-  inline DsLockRequest* New() const PROTOBUF_FINAL { return New(NULL); }
+  inline DsKvIncrRequest* New() const PROTOBUF_FINAL { return New(NULL); }
 
-  DsLockRequest* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
+  DsKvIncrRequest* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
   void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
   void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
-  void CopyFrom(const DsLockRequest& from);
-  void MergeFrom(const DsLockRequest& from);
+  void CopyFrom(const DsKvIncrRequest& from);
+  void MergeFrom(const DsKvIncrRequest& from);
   void Clear() PROTOBUF_FINAL;
   bool IsInitialized() const PROTOBUF_FINAL;
 
@@ -9379,7 +9373,7 @@ class DsLockRequest : public ::google::protobuf::Message /* @@protoc_insertion_p
   void SharedCtor();
   void SharedDtor();
   void SetCachedSize(int size) const PROTOBUF_FINAL;
-  void InternalSwap(DsLockRequest* other);
+  void InternalSwap(DsKvIncrRequest* other);
   private:
   inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
     return NULL;
@@ -9404,44 +9398,44 @@ class DsLockRequest : public ::google::protobuf::Message /* @@protoc_insertion_p
   ::kvrpcpb::RequestHeader* release_header();
   void set_allocated_header(::kvrpcpb::RequestHeader* header);
 
-  // .kvrpcpb.LockRequest req = 2;
+  // .kvrpcpb.KvIncrRequest req = 2;
   bool has_req() const;
   void clear_req();
   static const int kReqFieldNumber = 2;
-  const ::kvrpcpb::LockRequest& req() const;
-  ::kvrpcpb::LockRequest* mutable_req();
-  ::kvrpcpb::LockRequest* release_req();
-  void set_allocated_req(::kvrpcpb::LockRequest* req);
+  const ::kvrpcpb::KvIncrRequest& req() const;
+  ::kvrpcpb::KvIncrRequest* mutable_req();
+  ::kvrpcpb::KvIncrRequest* release_req();
+  void set_allocated_req(::kvrpcpb::KvIncrRequest* req);
 
-  // @@protoc_insertion_point(class_scope:kvrpcpb.DsLockRequest)
+  // @@protoc_insertion_point(class_scope:kvrpcpb.DsKvIncrRequest)
  private:
 
   ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
   ::kvrpcpb::RequestHeader* header_;
-  ::kvrpcpb::LockRequest* req_;
+  ::kvrpcpb::KvIncrRequest* req_;
   mutable int _cached_size_;
   friend struct protobuf_kvrpcpb_2eproto::TableStruct;
 };
 // -------------------------------------------------------------------
 
-class LockResponse : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:kvrpcpb.LockResponse) */ {
+class DsKvIncrResponse : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:kvrpcpb.DsKvIncrResponse) */ {
  public:
-  LockResponse();
-  virtual ~LockResponse();
+  DsKvIncrResponse();
+  virtual ~DsKvIncrResponse();
 
-  LockResponse(const LockResponse& from);
+  DsKvIncrResponse(const DsKvIncrResponse& from);
 
-  inline LockResponse& operator=(const LockResponse& from) {
+  inline DsKvIncrResponse& operator=(const DsKvIncrResponse& from) {
     CopyFrom(from);
     return *this;
   }
   #if LANG_CXX11
-  LockResponse(LockResponse&& from) noexcept
-    : LockResponse() {
+  DsKvIncrResponse(DsKvIncrResponse&& from) noexcept
+    : DsKvIncrResponse() {
     *this = ::std::move(from);
   }
 
-  inline LockResponse& operator=(LockResponse&& from) noexcept {
+  inline DsKvIncrResponse& operator=(DsKvIncrResponse&& from) noexcept {
     if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
       if (this != &from) InternalSwap(&from);
     } else {
@@ -9451,29 +9445,29 @@ class LockResponse : public ::google::protobuf::Message /* @@protoc_insertion_po
   }
   #endif
   static const ::google::protobuf::Descriptor* descriptor();
-  static const LockResponse& default_instance();
+  static const DsKvIncrResponse& default_instance();
 
-  static inline const LockResponse* internal_default_instance() {
-    return reinterpret_cast<const LockResponse*>(
-               &_LockResponse_default_instance_);
+  static inline const DsKvIncrResponse* internal_default_instance() {
+    return reinterpret_cast<const DsKvIncrResponse*>(
+               &_DsKvIncrResponse_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
     78;
 
-  void Swap(LockResponse* other);
-  friend void swap(LockResponse& a, LockResponse& b) {
+  void Swap(DsKvIncrResponse* other);
+  friend void swap(DsKvIncrResponse& a, DsKvIncrResponse& b) {
     a.Swap(&b);
   }
 
   // implements Message ----------------------------------------------
 
-  inline LockResponse* New() const PROTOBUF_FINAL { return New(NULL); }
+  inline DsKvIncrResponse* New() const PROTOBUF_FINAL { return New(NULL); }
 
-  LockResponse* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
+  DsKvIncrResponse* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
   void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
   void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
-  void CopyFrom(const LockResponse& from);
-  void MergeFrom(const LockResponse& from);
+  void CopyFrom(const DsKvIncrResponse& from);
+  void MergeFrom(const DsKvIncrResponse& from);
   void Clear() PROTOBUF_FINAL;
   bool IsInitialized() const PROTOBUF_FINAL;
 
@@ -9489,7 +9483,7 @@ class LockResponse : public ::google::protobuf::Message /* @@protoc_insertion_po
   void SharedCtor();
   void SharedDtor();
   void SetCachedSize(int size) const PROTOBUF_FINAL;
-  void InternalSwap(LockResponse* other);
+  void InternalSwap(DsKvIncrResponse* other);
   private:
   inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
     return NULL;
@@ -9505,77 +9499,53 @@ class LockResponse : public ::google::protobuf::Message /* @@protoc_insertion_po
 
   // accessors -------------------------------------------------------
 
-  // string error = 2;
-  void clear_error();
-  static const int kErrorFieldNumber = 2;
-  const ::std::string& error() const;
-  void set_error(const ::std::string& value);
-  #if LANG_CXX11
-  void set_error(::std::string&& value);
-  #endif
-  void set_error(const char* value);
-  void set_error(const char* value, size_t size);
-  ::std::string* mutable_error();
-  ::std::string* release_error();
-  void set_allocated_error(::std::string* error);
-
-  // bytes value = 3;
-  void clear_value();
-  static const int kValueFieldNumber = 3;
-  const ::std::string& value() const;
-  void set_value(const ::std::string& value);
-  #if LANG_CXX11
-  void set_value(::std::string&& value);
-  #endif
-  void set_value(const char* value);
-  void set_value(const void* value, size_t size);
-  ::std::string* mutable_value();
-  ::std::string* release_value();
-  void set_allocated_value(::std::string* value);
-
-  // int64 code = 1;
-  void clear_code();
-  static const int kCodeFieldNumber = 1;
-  ::google::protobuf::int64 code() const;
-  void set_code(::google::protobuf::int64 value);
+  // .kvrpcpb.ResponseHeader header = 1;
+  bool has_header() const;
+  void clear_header();
+  static const int kHeaderFieldNumber = 1;
+  const ::kvrpcpb::ResponseHeader& header() const;
+  ::kvrpcpb::ResponseHeader* mutable_header();
+  ::kvrpcpb::ResponseHeader* release_header();
+  void set_allocated_header(::kvrpcpb::ResponseHeader* header);
 
-  // int64 update_time = 4;
-  void clear_update_time();
-  static const int kUpdateTimeFieldNumber = 4;
-  ::google::protobuf::int64 update_time() const;
-  void set_update_time(::google::protobuf::int64 value);
+  // .kvrpcpb.KvIncrResponse resp = 2;
+  bool has_resp() const;
+  void clear_resp();
+  static const int kRespFieldNumber = 2;
+  const ::kvrpcpb::KvIncrResponse& resp() const;
+  ::kvrpcpb::KvIncrResponse* mutable_resp();
+  ::kvrpcpb::KvIncrResponse* release_resp();
+  void set_allocated_resp(::kvrpcpb::KvIncrResponse* resp);
 
-  // @@protoc_insertion_point(class_scope:kvrpcpb.LockResponse)
+  // @@protoc_insertion_point(class_scope:kvrpcpb.DsKvIncrResponse)
  private:
 
   ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::internal::ArenaStringPtr error_;
-  ::google::protobuf::internal::ArenaStringPtr value_;
-  ::google::protobuf::int64 code_;
-  ::google::protobuf::int64 update_time_;
+  ::kvrpcpb::ResponseHeader* header_;
+  ::kvrpcpb::KvIncrResponse* resp_;
   mutable int _cached_size_;
   friend struct protobuf_kvrpcpb_2eproto::TableStruct;
 };
 // -------------------------------------------------------------------
 
-class LockInfo : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:kvrpcpb.LockInfo) */ {
+class KvAppendRequest : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:kvrpcpb.KvAppendRequest) */ {
  public:
-  LockInfo();
-  virtual ~LockInfo();
+  KvAppendRequest();
+  virtual ~KvAppendRequest();
 
-  LockInfo(const LockInfo& from);
+  KvAppendRequest(const KvAppendRequest& from);
 
-  inline LockInfo& operator=(const LockInfo& from) {
+  inline KvAppendRequest& operator=(const KvAppendRequest& from) {
     CopyFrom(from);
     return *this;
   }
   #if LANG_CXX11
-  LockInfo(LockInfo&& from) noexcept
-    : LockInfo() {
+  KvAppendRequest(KvAppendRequest&& from) noexcept
+    : KvAppendRequest() {
     *this = ::std::move(from);
   }
 
-  inline LockInfo& operator=(LockInfo&& from) noexcept {
+  inline KvAppendRequest& operator=(KvAppendRequest&& from) noexcept {
     if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
       if (this != &from) InternalSwap(&from);
     } else {
@@ -9585,29 +9555,29 @@ class LockInfo : public ::google::protobuf::Message /* @@protoc_insertion_point(
   }
   #endif
   static const ::google::protobuf::Descriptor* descriptor();
-  static const LockInfo& default_instance();
+  static const KvAppendRequest& default_instance();
 
-  static inline const LockInfo* internal_default_instance() {
-    return reinterpret_cast<const LockInfo*>(
-               &_LockInfo_default_instance_);
+  static inline const KvAppendRequest* internal_default_instance() {
+    return reinterpret_cast<const KvAppendRequest*>(
+               &_KvAppendRequest_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
     79;
 
-  void Swap(LockInfo* other);
-  friend void swap(LockInfo& a, LockInfo& b) {
+  void Swap(KvAppendRequest* other);
+  friend void swap(KvAppendRequest& a, KvAppendRequest& b) {
     a.Swap(&b);
   }
 
   // implements Message ----------------------------------------------
 
-  inline LockInfo* New() const PROTOBUF_FINAL { return New(NULL); }
+  inline KvAppendRequest* New() const PROTOBUF_FINAL { return New(NULL); }
 
-  LockInfo* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
+  KvAppendRequest* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
   void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
   void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
-  void CopyFrom(const LockInfo& from);
-  void MergeFrom(const LockInfo& from);
+  void CopyFrom(const KvAppendRequest& from);
+  void MergeFrom(const KvAppendRequest& from);
   void Clear() PROTOBUF_FINAL;
   bool IsInitialized() const PROTOBUF_FINAL;
 
@@ -9623,7 +9593,7 @@ class LockInfo : public ::google::protobuf::Message /* @@protoc_insertion_point(
   void SharedCtor();
   void SharedDtor();
   void SetCachedSize(int size) const PROTOBUF_FINAL;
-  void InternalSwap(LockInfo* other);
+  void InternalSwap(KvAppendRequest* other);
   private:
   inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
     return NULL;
@@ -9653,44 +9623,49 @@ class LockInfo : public ::google::protobuf::Message /* @@protoc_insertion_point(
   ::std::string* release_key();
   void set_allocated_key(::std::string* key);
 
-  // .kvrpcpb.LockValue value = 2;
-  bool has_value() const;
+  // bytes value = 2;
   void clear_value();
   static const int kValueFieldNumber = 2;
-  const ::kvrpcpb::LockValue& value() const;
-  ::kvrpcpb::LockValue* mutable_value();
-  ::kvrpcpb::LockValue* release_value();
-  void set_allocated_value(::kvrpcpb::LockValue* value);
+  const ::std::string& value() const;
+  void set_value(const ::std::string& value);
+  #if LANG_CXX11
+  void set_value(::std::string&& value);
+  #endif
+  void set_value(const char* value);
+  void set_value(const void* value, size_t size);
+  ::std::string* mutable_value();
+  ::std::string* release_value();
+  void set_allocated_value(::std::string* value);
 
-  // @@protoc_insertion_point(class_scope:kvrpcpb.LockInfo)
+  // @@protoc_insertion_point(class_scope:kvrpcpb.KvAppendRequest)
  private:
 
   ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
   ::google::protobuf::internal::ArenaStringPtr key_;
-  ::kvrpcpb::LockValue* value_;
+  ::google::protobuf::internal::ArenaStringPtr value_;
   mutable int _cached_size_;
   friend struct protobuf_kvrpcpb_2eproto::TableStruct;
 };
 // -------------------------------------------------------------------
 
-class LockScanResponse : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:kvrpcpb.LockScanResponse) */ {
+class KvAppendResponse : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:kvrpcpb.KvAppendResponse) */ {
  public:
-  LockScanResponse();
-  virtual ~LockScanResponse();
+  KvAppendResponse();
+  virtual ~KvAppendResponse();
 
-  LockScanResponse(const LockScanResponse& from);
+  KvAppendResponse(const KvAppendResponse& from);
 
-  inline LockScanResponse& operator=(const LockScanResponse& from) {
+  inline KvAppendResponse& operator=(const KvAppendResponse& from) {
     CopyFrom(from);
     return *this;
   }
   #if LANG_CXX11
-  LockScanResponse(LockScanResponse&& from) noexcept
-    : LockScanResponse() {
+  KvAppendResponse(KvAppendResponse&& from) noexcept
+    : KvAppendResponse() {
     *this = ::std::move(from);
   }
 
-  inline LockScanResponse& operator=(LockScanResponse&& from) noexcept {
+  inline KvAppendResponse& operator=(KvAppendResponse&& from) noexcept {
     if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
       if (this != &from) InternalSwap(&from);
     } else {
@@ -9700,29 +9675,29 @@ class LockScanResponse : public ::google::protobuf::Message /* @@protoc_insertio
   }
   #endif
   static const ::google::protobuf::Descriptor* descriptor();
-  static const LockScanResponse& default_instance();
+  static const KvAppendResponse& default_instance();
 
-  static inline const LockScanResponse* internal_default_instance() {
-    return reinterpret_cast<const LockScanResponse*>(
-               &_LockScanResponse_default_instance_);
+  static inline const KvAppendResponse* internal_default_instance() {
+    return reinterpret_cast<const KvAppendResponse*>(
+               &_KvAppendResponse_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
     80;
 
-  void Swap(LockScanResponse* other);
-  friend void swap(LockScanResponse& a, LockScanResponse& b) {
+  void Swap(KvAppendResponse* other);
+  friend void swap(KvAppendResponse& a, KvAppendResponse& b) {
     a.Swap(&b);
   }
 
   // implements Message ----------------------------------------------
 
-  inline LockScanResponse* New() const PROTOBUF_FINAL { return New(NULL); }
+  inline KvAppendResponse* New() const PROTOBUF_FINAL { return New(NULL); }
 
-  LockScanResponse* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
+  KvAppendResponse* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
   void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
   void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
-  void CopyFrom(const LockScanResponse& from);
-  void MergeFrom(const LockScanResponse& from);
+  void CopyFrom(const KvAppendResponse& from);
+  void MergeFrom(const KvAppendResponse& from);
   void Clear() PROTOBUF_FINAL;
   bool IsInitialized() const PROTOBUF_FINAL;
 
@@ -9738,7 +9713,7 @@ class LockScanResponse : public ::google::protobuf::Message /* @@protoc_insertio
   void SharedCtor();
   void SharedDtor();
   void SetCachedSize(int size) const PROTOBUF_FINAL;
-  void InternalSwap(LockScanResponse* other);
+  void InternalSwap(KvAppendResponse* other);
   private:
   inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
     return NULL;
@@ -9754,61 +9729,40 @@ class LockScanResponse : public ::google::protobuf::Message /* @@protoc_insertio
 
   // accessors -------------------------------------------------------
 
-  // repeated .kvrpcpb.LockInfo info = 1;
-  int info_size() const;
-  void clear_info();
-  static const int kInfoFieldNumber = 1;
-  const ::kvrpcpb::LockInfo& info(int index) const;
-  ::kvrpcpb::LockInfo* mutable_info(int index);
-  ::kvrpcpb::LockInfo* add_info();
-  ::google::protobuf::RepeatedPtrField< ::kvrpcpb::LockInfo >*
-      mutable_info();
-  const ::google::protobuf::RepeatedPtrField< ::kvrpcpb::LockInfo >&
-      info() const;
-
-  // bytes last_key = 2;
-  void clear_last_key();
-  static const int kLastKeyFieldNumber = 2;
-  const ::std::string& last_key() const;
-  void set_last_key(const ::std::string& value);
-  #if LANG_CXX11
-  void set_last_key(::std::string&& value);
-  #endif
-  void set_last_key(const char* value);
-  void set_last_key(const void* value, size_t size);
-  ::std::string* mutable_last_key();
-  ::std::string* release_last_key();
-  void set_allocated_last_key(::std::string* last_key);
+  // int32 code = 1;
+  void clear_code();
+  static const int kCodeFieldNumber = 1;
+  ::google::protobuf::int32 code() const;
+  void set_code(::google::protobuf::int32 value);
 
-  // @@protoc_insertion_point(class_scope:kvrpcpb.LockScanResponse)
+  // @@protoc_insertion_point(class_scope:kvrpcpb.KvAppendResponse)
  private:
 
   ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::RepeatedPtrField< ::kvrpcpb::LockInfo > info_;
-  ::google::protobuf::internal::ArenaStringPtr last_key_;
+  ::google::protobuf::int32 code_;
   mutable int _cached_size_;
   friend struct protobuf_kvrpcpb_2eproto::TableStruct;
 };
 // -------------------------------------------------------------------
 
-class DsLockResponse : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:kvrpcpb.DsLockResponse) */ {
+class DsKvAppendRequest : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:kvrpcpb.DsKvAppendRequest) */ {
  public:
-  DsLockResponse();
-  virtual ~DsLockResponse();
+  DsKvAppendRequest();
+  virtual ~DsKvAppendRequest();
 
-  DsLockResponse(const DsLockResponse& from);
+  DsKvAppendRequest(const DsKvAppendRequest& from);
 
-  inline DsLockResponse& operator=(const DsLockResponse& from) {
+  inline DsKvAppendRequest& operator=(const DsKvAppendRequest& from) {
     CopyFrom(from);
     return *this;
   }
   #if LANG_CXX11
-  DsLockResponse(DsLockResponse&& from) noexcept
-    : DsLockResponse() {
+  DsKvAppendRequest(DsKvAppendRequest&& from) noexcept
+    : DsKvAppendRequest() {
     *this = ::std::move(from);
   }
 
-  inline DsLockResponse& operator=(DsLockResponse&& from) noexcept {
+  inline DsKvAppendRequest& operator=(DsKvAppendRequest&& from) noexcept {
     if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
       if (this != &from) InternalSwap(&from);
     } else {
@@ -9818,29 +9772,29 @@ class DsLockResponse : public ::google::protobuf::Message /* @@protoc_insertion_
   }
   #endif
   static const ::google::protobuf::Descriptor* descriptor();
-  static const DsLockResponse& default_instance();
+  static const DsKvAppendRequest& default_instance();
 
-  static inline const DsLockResponse* internal_default_instance() {
-    return reinterpret_cast<const DsLockResponse*>(
-               &_DsLockResponse_default_instance_);
+  static inline const DsKvAppendRequest* internal_default_instance() {
+    return reinterpret_cast<const DsKvAppendRequest*>(
+               &_DsKvAppendRequest_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
     81;
 
-  void Swap(DsLockResponse* other);
-  friend void swap(DsLockResponse& a, DsLockResponse& b) {
+  void Swap(DsKvAppendRequest* other);
+  friend void swap(DsKvAppendRequest& a, DsKvAppendRequest& b) {
     a.Swap(&b);
   }
 
   // implements Message ----------------------------------------------
 
-  inline DsLockResponse* New() const PROTOBUF_FINAL { return New(NULL); }
+  inline DsKvAppendRequest* New() const PROTOBUF_FINAL { return New(NULL); }
 
-  DsLockResponse* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
+  DsKvAppendRequest* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
   void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
   void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
-  void CopyFrom(const DsLockResponse& from);
-  void MergeFrom(const DsLockResponse& from);
+  void CopyFrom(const DsKvAppendRequest& from);
+  void MergeFrom(const DsKvAppendRequest& from);
   void Clear() PROTOBUF_FINAL;
   bool IsInitialized() const PROTOBUF_FINAL;
 
@@ -9856,7 +9810,7 @@ class DsLockResponse : public ::google::protobuf::Message /* @@protoc_insertion_
   void SharedCtor();
   void SharedDtor();
   void SetCachedSize(int size) const PROTOBUF_FINAL;
-  void InternalSwap(DsLockResponse* other);
+  void InternalSwap(DsKvAppendRequest* other);
   private:
   inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
     return NULL;
@@ -9872,53 +9826,53 @@ class DsLockResponse : public ::google::protobuf::Message /* @@protoc_insertion_
 
   // accessors -------------------------------------------------------
 
-  // .kvrpcpb.ResponseHeader header = 1;
+  // .kvrpcpb.RequestHeader header = 1;
   bool has_header() const;
   void clear_header();
   static const int kHeaderFieldNumber = 1;
-  const ::kvrpcpb::ResponseHeader& header() const;
-  ::kvrpcpb::ResponseHeader* mutable_header();
-  ::kvrpcpb::ResponseHeader* release_header();
-  void set_allocated_header(::kvrpcpb::ResponseHeader* header);
+  const ::kvrpcpb::RequestHeader& header() const;
+  ::kvrpcpb::RequestHeader* mutable_header();
+  ::kvrpcpb::RequestHeader* release_header();
+  void set_allocated_header(::kvrpcpb::RequestHeader* header);
 
-  // .kvrpcpb.LockResponse resp = 2;
-  bool has_resp() const;
-  void clear_resp();
-  static const int kRespFieldNumber = 2;
-  const ::kvrpcpb::LockResponse& resp() const;
-  ::kvrpcpb::LockResponse* mutable_resp();
-  ::kvrpcpb::LockResponse* release_resp();
-  void set_allocated_resp(::kvrpcpb::LockResponse* resp);
+  // .kvrpcpb.KvAppendRequest req = 2;
+  bool has_req() const;
+  void clear_req();
+  static const int kReqFieldNumber = 2;
+  const ::kvrpcpb::KvAppendRequest& req() const;
+  ::kvrpcpb::KvAppendRequest* mutable_req();
+  ::kvrpcpb::KvAppendRequest* release_req();
+  void set_allocated_req(::kvrpcpb::KvAppendRequest* req);
 
-  // @@protoc_insertion_point(class_scope:kvrpcpb.DsLockResponse)
+  // @@protoc_insertion_point(class_scope:kvrpcpb.DsKvAppendRequest)
  private:
 
   ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::kvrpcpb::ResponseHeader* header_;
-  ::kvrpcpb::LockResponse* resp_;
+  ::kvrpcpb::RequestHeader* header_;
+  ::kvrpcpb::KvAppendRequest* req_;
   mutable int _cached_size_;
   friend struct protobuf_kvrpcpb_2eproto::TableStruct;
 };
 // -------------------------------------------------------------------
 
-class LockUpdateRequest : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:kvrpcpb.LockUpdateRequest) */ {
+class DsKvAppendResponse : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:kvrpcpb.DsKvAppendResponse) */ {
  public:
-  LockUpdateRequest();
-  virtual ~LockUpdateRequest();
+  DsKvAppendResponse();
+  virtual ~DsKvAppendResponse();
 
-  LockUpdateRequest(const LockUpdateRequest& from);
+  DsKvAppendResponse(const DsKvAppendResponse& from);
 
-  inline LockUpdateRequest& operator=(const LockUpdateRequest& from) {
+  inline DsKvAppendResponse& operator=(const DsKvAppendResponse& from) {
     CopyFrom(from);
     return *this;
   }
   #if LANG_CXX11
-  LockUpdateRequest(LockUpdateRequest&& from) noexcept
-    : LockUpdateRequest() {
+  DsKvAppendResponse(DsKvAppendResponse&& from) noexcept
+    : DsKvAppendResponse() {
     *this = ::std::move(from);
   }
 
-  inline LockUpdateRequest& operator=(LockUpdateRequest&& from) noexcept {
+  inline DsKvAppendResponse& operator=(DsKvAppendResponse&& from) noexcept {
     if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
       if (this != &from) InternalSwap(&from);
     } else {
@@ -9928,29 +9882,29 @@ class LockUpdateRequest : public ::google::protobuf::Message /* @@protoc_inserti
   }
   #endif
   static const ::google::protobuf::Descriptor* descriptor();
-  static const LockUpdateRequest& default_instance();
+  static const DsKvAppendResponse& default_instance();
 
-  static inline const LockUpdateRequest* internal_default_instance() {
-    return reinterpret_cast<const LockUpdateRequest*>(
-               &_LockUpdateRequest_default_instance_);
+  static inline const DsKvAppendResponse* internal_default_instance() {
+    return reinterpret_cast<const DsKvAppendResponse*>(
+               &_DsKvAppendResponse_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
     82;
 
-  void Swap(LockUpdateRequest* other);
-  friend void swap(LockUpdateRequest& a, LockUpdateRequest& b) {
+  void Swap(DsKvAppendResponse* other);
+  friend void swap(DsKvAppendResponse& a, DsKvAppendResponse& b) {
     a.Swap(&b);
   }
 
   // implements Message ----------------------------------------------
 
-  inline LockUpdateRequest* New() const PROTOBUF_FINAL { return New(NULL); }
+  inline DsKvAppendResponse* New() const PROTOBUF_FINAL { return New(NULL); }
 
-  LockUpdateRequest* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
+  DsKvAppendResponse* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
   void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
   void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
-  void CopyFrom(const LockUpdateRequest& from);
-  void MergeFrom(const LockUpdateRequest& from);
+  void CopyFrom(const DsKvAppendResponse& from);
+  void MergeFrom(const DsKvAppendResponse& from);
   void Clear() PROTOBUF_FINAL;
   bool IsInitialized() const PROTOBUF_FINAL;
 
@@ -9966,7 +9920,7 @@ class LockUpdateRequest : public ::google::protobuf::Message /* @@protoc_inserti
   void SharedCtor();
   void SharedDtor();
   void SetCachedSize(int size) const PROTOBUF_FINAL;
-  void InternalSwap(LockUpdateRequest* other);
+  void InternalSwap(DsKvAppendResponse* other);
   private:
   inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
     return NULL;
@@ -9982,95 +9936,53 @@ class LockUpdateRequest : public ::google::protobuf::Message /* @@protoc_inserti
 
   // accessors -------------------------------------------------------
 
-  // bytes key = 1;
-  void clear_key();
-  static const int kKeyFieldNumber = 1;
-  const ::std::string& key() const;
-  void set_key(const ::std::string& value);
-  #if LANG_CXX11
-  void set_key(::std::string&& value);
-  #endif
-  void set_key(const char* value);
-  void set_key(const void* value, size_t size);
-  ::std::string* mutable_key();
-  ::std::string* release_key();
-  void set_allocated_key(::std::string* key);
-
-  // string id = 3;
-  void clear_id();
-  static const int kIdFieldNumber = 3;
-  const ::std::string& id() const;
-  void set_id(const ::std::string& value);
-  #if LANG_CXX11
-  void set_id(::std::string&& value);
-  #endif
-  void set_id(const char* value);
-  void set_id(const char* value, size_t size);
-  ::std::string* mutable_id();
-  ::std::string* release_id();
-  void set_allocated_id(::std::string* id);
-
-  // bytes update_value = 6;
-  void clear_update_value();
-  static const int kUpdateValueFieldNumber = 6;
-  const ::std::string& update_value() const;
-  void set_update_value(const ::std::string& value);
-  #if LANG_CXX11
-  void set_update_value(::std::string&& value);
-  #endif
-  void set_update_value(const char* value);
-  void set_update_value(const void* value, size_t size);
-  ::std::string* mutable_update_value();
-  ::std::string* release_update_value();
-  void set_allocated_update_value(::std::string* update_value);
-
-  // .timestamp.Timestamp timestamp = 10;
-  bool has_timestamp() const;
-  void clear_timestamp();
-  static const int kTimestampFieldNumber = 10;
-  const ::timestamp::Timestamp& timestamp() const;
-  ::timestamp::Timestamp* mutable_timestamp();
-  ::timestamp::Timestamp* release_timestamp();
-  void set_allocated_timestamp(::timestamp::Timestamp* timestamp);
+  // .kvrpcpb.ResponseHeader header = 1;
+  bool has_header() const;
+  void clear_header();
+  static const int kHeaderFieldNumber = 1;
+  const ::kvrpcpb::ResponseHeader& header() const;
+  ::kvrpcpb::ResponseHeader* mutable_header();
+  ::kvrpcpb::ResponseHeader* release_header();
+  void set_allocated_header(::kvrpcpb::ResponseHeader* header);
 
-  // int64 update_time = 5;
-  void clear_update_time();
-  static const int kUpdateTimeFieldNumber = 5;
-  ::google::protobuf::int64 update_time() const;
-  void set_update_time(::google::protobuf::int64 value);
+  // .kvrpcpb.KvAppendResponse resp = 2;
+  bool has_resp() const;
+  void clear_resp();
+  static const int kRespFieldNumber = 2;
+  const ::kvrpcpb::KvAppendResponse& resp() const;
+  ::kvrpcpb::KvAppendResponse* mutable_resp();
+  ::kvrpcpb::KvAppendResponse* release_resp();
+  void set_allocated_resp(::kvrpcpb::KvAppendResponse* resp);
 
-  // @@protoc_insertion_point(class_scope:kvrpcpb.LockUpdateRequest)
+  // @@protoc_insertion_point(class_scope:kvrpcpb.DsKvAppendResponse)
  private:
 
   ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::internal::ArenaStringPtr key_;
-  ::google::protobuf::internal::ArenaStringPtr id_;
-  ::google::protobuf::internal::ArenaStringPtr update_value_;
-  ::timestamp::Timestamp* timestamp_;
-  ::google::protobuf::int64 update_time_;
+  ::kvrpcpb::ResponseHeader* header_;
+  ::kvrpcpb::KvAppendResponse* resp_;
   mutable int _cached_size_;
   friend struct protobuf_kvrpcpb_2eproto::TableStruct;
 };
 // -------------------------------------------------------------------
 
-class DsLockUpdateRequest : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:kvrpcpb.DsLockUpdateRequest) */ {
+class LockValue : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:kvrpcpb.LockValue) */ {
  public:
-  DsLockUpdateRequest();
-  virtual ~DsLockUpdateRequest();
+  LockValue();
+  virtual ~LockValue();
 
-  DsLockUpdateRequest(const DsLockUpdateRequest& from);
+  LockValue(const LockValue& from);
 
-  inline DsLockUpdateRequest& operator=(const DsLockUpdateRequest& from) {
+  inline LockValue& operator=(const LockValue& from) {
     CopyFrom(from);
     return *this;
   }
   #if LANG_CXX11
-  DsLockUpdateRequest(DsLockUpdateRequest&& from) noexcept
-    : DsLockUpdateRequest() {
+  LockValue(LockValue&& from) noexcept
+    : LockValue() {
     *this = ::std::move(from);
   }
 
-  inline DsLockUpdateRequest& operator=(DsLockUpdateRequest&& from) noexcept {
+  inline LockValue& operator=(LockValue&& from) noexcept {
     if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
       if (this != &from) InternalSwap(&from);
     } else {
@@ -10080,29 +9992,29 @@ class DsLockUpdateRequest : public ::google::protobuf::Message /* @@protoc_inser
   }
   #endif
   static const ::google::protobuf::Descriptor* descriptor();
-  static const DsLockUpdateRequest& default_instance();
+  static const LockValue& default_instance();
 
-  static inline const DsLockUpdateRequest* internal_default_instance() {
-    return reinterpret_cast<const DsLockUpdateRequest*>(
-               &_DsLockUpdateRequest_default_instance_);
+  static inline const LockValue* internal_default_instance() {
+    return reinterpret_cast<const LockValue*>(
+               &_LockValue_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
     83;
 
-  void Swap(DsLockUpdateRequest* other);
-  friend void swap(DsLockUpdateRequest& a, DsLockUpdateRequest& b) {
+  void Swap(LockValue* other);
+  friend void swap(LockValue& a, LockValue& b) {
     a.Swap(&b);
   }
 
   // implements Message ----------------------------------------------
 
-  inline DsLockUpdateRequest* New() const PROTOBUF_FINAL { return New(NULL); }
+  inline LockValue* New() const PROTOBUF_FINAL { return New(NULL); }
 
-  DsLockUpdateRequest* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
+  LockValue* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
   void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
   void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
-  void CopyFrom(const DsLockUpdateRequest& from);
-  void MergeFrom(const DsLockUpdateRequest& from);
+  void CopyFrom(const LockValue& from);
+  void MergeFrom(const LockValue& from);
   void Clear() PROTOBUF_FINAL;
   bool IsInitialized() const PROTOBUF_FINAL;
 
@@ -10118,7 +10030,7 @@ class DsLockUpdateRequest : public ::google::protobuf::Message /* @@protoc_inser
   void SharedCtor();
   void SharedDtor();
   void SetCachedSize(int size) const PROTOBUF_FINAL;
-  void InternalSwap(DsLockUpdateRequest* other);
+  void InternalSwap(LockValue* other);
   private:
   inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
     return NULL;
@@ -10134,53 +10046,84 @@ class DsLockUpdateRequest : public ::google::protobuf::Message /* @@protoc_inser
 
   // accessors -------------------------------------------------------
 
-  // .kvrpcpb.RequestHeader header = 1;
-  bool has_header() const;
-  void clear_header();
-  static const int kHeaderFieldNumber = 1;
-  const ::kvrpcpb::RequestHeader& header() const;
-  ::kvrpcpb::RequestHeader* mutable_header();
-  ::kvrpcpb::RequestHeader* release_header();
-  void set_allocated_header(::kvrpcpb::RequestHeader* header);
+  // bytes value = 2;
+  void clear_value();
+  static const int kValueFieldNumber = 2;
+  const ::std::string& value() const;
+  void set_value(const ::std::string& value);
+  #if LANG_CXX11
+  void set_value(::std::string&& value);
+  #endif
+  void set_value(const char* value);
+  void set_value(const void* value, size_t size);
+  ::std::string* mutable_value();
+  ::std::string* release_value();
+  void set_allocated_value(::std::string* value);
 
-  // .kvrpcpb.LockUpdateRequest req = 2;
-  bool has_req() const;
-  void clear_req();
-  static const int kReqFieldNumber = 2;
-  const ::kvrpcpb::LockUpdateRequest& req() const;
-  ::kvrpcpb::LockUpdateRequest* mutable_req();
-  ::kvrpcpb::LockUpdateRequest* release_req();
-  void set_allocated_req(::kvrpcpb::LockUpdateRequest* req);
+  // string id = 3;
+  void clear_id();
+  static const int kIdFieldNumber = 3;
+  const ::std::string& id() const;
+  void set_id(const ::std::string& value);
+  #if LANG_CXX11
+  void set_id(::std::string&& value);
+  #endif
+  void set_id(const char* value);
+  void set_id(const char* value, size_t size);
+  ::std::string* mutable_id();
+  ::std::string* release_id();
+  void set_allocated_id(::std::string* id);
 
-  // @@protoc_insertion_point(class_scope:kvrpcpb.DsLockUpdateRequest)
+  // int64 delete_time = 4;
+  void clear_delete_time();
+  static const int kDeleteTimeFieldNumber = 4;
+  ::google::protobuf::int64 delete_time() const;
+  void set_delete_time(::google::protobuf::int64 value);
+
+  // int64 update_time = 5;
+  void clear_update_time();
+  static const int kUpdateTimeFieldNumber = 5;
+  ::google::protobuf::int64 update_time() const;
+  void set_update_time(::google::protobuf::int64 value);
+
+  // bool delete_flag = 6;
+  void clear_delete_flag();
+  static const int kDeleteFlagFieldNumber = 6;
+  bool delete_flag() const;
+  void set_delete_flag(bool value);
+
+  // @@protoc_insertion_point(class_scope:kvrpcpb.LockValue)
  private:
 
   ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::kvrpcpb::RequestHeader* header_;
-  ::kvrpcpb::LockUpdateRequest* req_;
+  ::google::protobuf::internal::ArenaStringPtr value_;
+  ::google::protobuf::internal::ArenaStringPtr id_;
+  ::google::protobuf::int64 delete_time_;
+  ::google::protobuf::int64 update_time_;
+  bool delete_flag_;
   mutable int _cached_size_;
   friend struct protobuf_kvrpcpb_2eproto::TableStruct;
 };
 // -------------------------------------------------------------------
 
-class DsLockUpdateResponse : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:kvrpcpb.DsLockUpdateResponse) */ {
+class LockRequest : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:kvrpcpb.LockRequest) */ {
  public:
-  DsLockUpdateResponse();
-  virtual ~DsLockUpdateResponse();
+  LockRequest();
+  virtual ~LockRequest();
 
-  DsLockUpdateResponse(const DsLockUpdateResponse& from);
+  LockRequest(const LockRequest& from);
 
-  inline DsLockUpdateResponse& operator=(const DsLockUpdateResponse& from) {
+  inline LockRequest& operator=(const LockRequest& from) {
     CopyFrom(from);
     return *this;
   }
   #if LANG_CXX11
-  DsLockUpdateResponse(DsLockUpdateResponse&& from) noexcept
-    : DsLockUpdateResponse() {
+  LockRequest(LockRequest&& from) noexcept
+    : LockRequest() {
     *this = ::std::move(from);
   }
 
-  inline DsLockUpdateResponse& operator=(DsLockUpdateResponse&& from) noexcept {
+  inline LockRequest& operator=(LockRequest&& from) noexcept {
     if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
       if (this != &from) InternalSwap(&from);
     } else {
@@ -10190,29 +10133,29 @@ class DsLockUpdateResponse : public ::google::protobuf::Message /* @@protoc_inse
   }
   #endif
   static const ::google::protobuf::Descriptor* descriptor();
-  static const DsLockUpdateResponse& default_instance();
+  static const LockRequest& default_instance();
 
-  static inline const DsLockUpdateResponse* internal_default_instance() {
-    return reinterpret_cast<const DsLockUpdateResponse*>(
-               &_DsLockUpdateResponse_default_instance_);
+  static inline const LockRequest* internal_default_instance() {
+    return reinterpret_cast<const LockRequest*>(
+               &_LockRequest_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
     84;
 
-  void Swap(DsLockUpdateResponse* other);
-  friend void swap(DsLockUpdateResponse& a, DsLockUpdateResponse& b) {
+  void Swap(LockRequest* other);
+  friend void swap(LockRequest& a, LockRequest& b) {
     a.Swap(&b);
   }
 
   // implements Message ----------------------------------------------
 
-  inline DsLockUpdateResponse* New() const PROTOBUF_FINAL { return New(NULL); }
+  inline LockRequest* New() const PROTOBUF_FINAL { return New(NULL); }
 
-  DsLockUpdateResponse* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
+  LockRequest* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
   void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
   void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
-  void CopyFrom(const DsLockUpdateResponse& from);
-  void MergeFrom(const DsLockUpdateResponse& from);
+  void CopyFrom(const LockRequest& from);
+  void MergeFrom(const LockRequest& from);
   void Clear() PROTOBUF_FINAL;
   bool IsInitialized() const PROTOBUF_FINAL;
 
@@ -10228,7 +10171,7 @@ class DsLockUpdateResponse : public ::google::protobuf::Message /* @@protoc_inse
   void SharedCtor();
   void SharedDtor();
   void SetCachedSize(int size) const PROTOBUF_FINAL;
-  void InternalSwap(DsLockUpdateResponse* other);
+  void InternalSwap(LockRequest* other);
   private:
   inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
     return NULL;
@@ -10244,53 +10187,83 @@ class DsLockUpdateResponse : public ::google::protobuf::Message /* @@protoc_inse
 
   // accessors -------------------------------------------------------
 
-  // .kvrpcpb.ResponseHeader header = 1;
-  bool has_header() const;
-  void clear_header();
-  static const int kHeaderFieldNumber = 1;
-  const ::kvrpcpb::ResponseHeader& header() const;
-  ::kvrpcpb::ResponseHeader* mutable_header();
-  ::kvrpcpb::ResponseHeader* release_header();
-  void set_allocated_header(::kvrpcpb::ResponseHeader* header);
+  // bytes key = 1;
+  void clear_key();
+  static const int kKeyFieldNumber = 1;
+  const ::std::string& key() const;
+  void set_key(const ::std::string& value);
+  #if LANG_CXX11
+  void set_key(::std::string&& value);
+  #endif
+  void set_key(const char* value);
+  void set_key(const void* value, size_t size);
+  ::std::string* mutable_key();
+  ::std::string* release_key();
+  void set_allocated_key(::std::string* key);
 
-  // .kvrpcpb.LockResponse resp = 2;
-  bool has_resp() const;
-  void clear_resp();
-  static const int kRespFieldNumber = 2;
-  const ::kvrpcpb::LockResponse& resp() const;
-  ::kvrpcpb::LockResponse* mutable_resp();
-  ::kvrpcpb::LockResponse* release_resp();
-  void set_allocated_resp(::kvrpcpb::LockResponse* resp);
+  // string by = 11;
+  void clear_by();
+  static const int kByFieldNumber = 11;
+  const ::std::string& by() const;
+  void set_by(const ::std::string& value);
+  #if LANG_CXX11
+  void set_by(::std::string&& value);
+  #endif
+  void set_by(const char* value);
+  void set_by(const char* value, size_t size);
+  ::std::string* mutable_by();
+  ::std::string* release_by();
+  void set_allocated_by(::std::string* by);
 
-  // @@protoc_insertion_point(class_scope:kvrpcpb.DsLockUpdateResponse)
+  // .kvrpcpb.LockValue value = 2;
+  bool has_value() const;
+  void clear_value();
+  static const int kValueFieldNumber = 2;
+  const ::kvrpcpb::LockValue& value() const;
+  ::kvrpcpb::LockValue* mutable_value();
+  ::kvrpcpb::LockValue* release_value();
+  void set_allocated_value(::kvrpcpb::LockValue* value);
+
+  // .timestamp.Timestamp timestamp = 10;
+  bool has_timestamp() const;
+  void clear_timestamp();
+  static const int kTimestampFieldNumber = 10;
+  const ::timestamp::Timestamp& timestamp() const;
+  ::timestamp::Timestamp* mutable_timestamp();
+  ::timestamp::Timestamp* release_timestamp();
+  void set_allocated_timestamp(::timestamp::Timestamp* timestamp);
+
+  // @@protoc_insertion_point(class_scope:kvrpcpb.LockRequest)
  private:
 
   ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::kvrpcpb::ResponseHeader* header_;
-  ::kvrpcpb::LockResponse* resp_;
+  ::google::protobuf::internal::ArenaStringPtr key_;
+  ::google::protobuf::internal::ArenaStringPtr by_;
+  ::kvrpcpb::LockValue* value_;
+  ::timestamp::Timestamp* timestamp_;
   mutable int _cached_size_;
   friend struct protobuf_kvrpcpb_2eproto::TableStruct;
 };
 // -------------------------------------------------------------------
 
-class UnlockRequest : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:kvrpcpb.UnlockRequest) */ {
+class DsLockRequest : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:kvrpcpb.DsLockRequest) */ {
  public:
-  UnlockRequest();
-  virtual ~UnlockRequest();
+  DsLockRequest();
+  virtual ~DsLockRequest();
 
-  UnlockRequest(const UnlockRequest& from);
+  DsLockRequest(const DsLockRequest& from);
 
-  inline UnlockRequest& operator=(const UnlockRequest& from) {
+  inline DsLockRequest& operator=(const DsLockRequest& from) {
     CopyFrom(from);
     return *this;
   }
   #if LANG_CXX11
-  UnlockRequest(UnlockRequest&& from) noexcept
-    : UnlockRequest() {
+  DsLockRequest(DsLockRequest&& from) noexcept
+    : DsLockRequest() {
     *this = ::std::move(from);
   }
 
-  inline UnlockRequest& operator=(UnlockRequest&& from) noexcept {
+  inline DsLockRequest& operator=(DsLockRequest&& from) noexcept {
     if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
       if (this != &from) InternalSwap(&from);
     } else {
@@ -10300,29 +10273,29 @@ class UnlockRequest : public ::google::protobuf::Message /* @@protoc_insertion_p
   }
   #endif
   static const ::google::protobuf::Descriptor* descriptor();
-  static const UnlockRequest& default_instance();
+  static const DsLockRequest& default_instance();
 
-  static inline const UnlockRequest* internal_default_instance() {
-    return reinterpret_cast<const UnlockRequest*>(
-               &_UnlockRequest_default_instance_);
+  static inline const DsLockRequest* internal_default_instance() {
+    return reinterpret_cast<const DsLockRequest*>(
+               &_DsLockRequest_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
     85;
 
-  void Swap(UnlockRequest* other);
-  friend void swap(UnlockRequest& a, UnlockRequest& b) {
+  void Swap(DsLockRequest* other);
+  friend void swap(DsLockRequest& a, DsLockRequest& b) {
     a.Swap(&b);
   }
 
   // implements Message ----------------------------------------------
 
-  inline UnlockRequest* New() const PROTOBUF_FINAL { return New(NULL); }
+  inline DsLockRequest* New() const PROTOBUF_FINAL { return New(NULL); }
 
-  UnlockRequest* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
+  DsLockRequest* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
   void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
   void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
-  void CopyFrom(const UnlockRequest& from);
-  void MergeFrom(const UnlockRequest& from);
+  void CopyFrom(const DsLockRequest& from);
+  void MergeFrom(const DsLockRequest& from);
   void Clear() PROTOBUF_FINAL;
   bool IsInitialized() const PROTOBUF_FINAL;
 
@@ -10338,7 +10311,7 @@ class UnlockRequest : public ::google::protobuf::Message /* @@protoc_insertion_p
   void SharedCtor();
   void SharedDtor();
   void SetCachedSize(int size) const PROTOBUF_FINAL;
-  void InternalSwap(UnlockRequest* other);
+  void InternalSwap(DsLockRequest* other);
   private:
   inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
     return NULL;
@@ -10354,88 +10327,53 @@ class UnlockRequest : public ::google::protobuf::Message /* @@protoc_insertion_p
 
   // accessors -------------------------------------------------------
 
-  // bytes key = 1;
-  void clear_key();
-  static const int kKeyFieldNumber = 1;
-  const ::std::string& key() const;
-  void set_key(const ::std::string& value);
-  #if LANG_CXX11
-  void set_key(::std::string&& value);
-  #endif
-  void set_key(const char* value);
-  void set_key(const void* value, size_t size);
-  ::std::string* mutable_key();
-  ::std::string* release_key();
-  void set_allocated_key(::std::string* key);
+  // .kvrpcpb.RequestHeader header = 1;
+  bool has_header() const;
+  void clear_header();
+  static const int kHeaderFieldNumber = 1;
+  const ::kvrpcpb::RequestHeader& header() const;
+  ::kvrpcpb::RequestHeader* mutable_header();
+  ::kvrpcpb::RequestHeader* release_header();
+  void set_allocated_header(::kvrpcpb::RequestHeader* header);
 
-  // string id = 3;
-  void clear_id();
-  static const int kIdFieldNumber = 3;
-  const ::std::string& id() const;
-  void set_id(const ::std::string& value);
-  #if LANG_CXX11
-  void set_id(::std::string&& value);
-  #endif
-  void set_id(const char* value);
-  void set_id(const char* value, size_t size);
-  ::std::string* mutable_id();
-  ::std::string* release_id();
-  void set_allocated_id(::std::string* id);
-
-  // string by = 11;
-  void clear_by();
-  static const int kByFieldNumber = 11;
-  const ::std::string& by() const;
-  void set_by(const ::std::string& value);
-  #if LANG_CXX11
-  void set_by(::std::string&& value);
-  #endif
-  void set_by(const char* value);
-  void set_by(const char* value, size_t size);
-  ::std::string* mutable_by();
-  ::std::string* release_by();
-  void set_allocated_by(::std::string* by);
-
-  // .timestamp.Timestamp timestamp = 10;
-  bool has_timestamp() const;
-  void clear_timestamp();
-  static const int kTimestampFieldNumber = 10;
-  const ::timestamp::Timestamp& timestamp() const;
-  ::timestamp::Timestamp* mutable_timestamp();
-  ::timestamp::Timestamp* release_timestamp();
-  void set_allocated_timestamp(::timestamp::Timestamp* timestamp);
+  // .kvrpcpb.LockRequest req = 2;
+  bool has_req() const;
+  void clear_req();
+  static const int kReqFieldNumber = 2;
+  const ::kvrpcpb::LockRequest& req() const;
+  ::kvrpcpb::LockRequest* mutable_req();
+  ::kvrpcpb::LockRequest* release_req();
+  void set_allocated_req(::kvrpcpb::LockRequest* req);
 
-  // @@protoc_insertion_point(class_scope:kvrpcpb.UnlockRequest)
+  // @@protoc_insertion_point(class_scope:kvrpcpb.DsLockRequest)
  private:
 
   ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::internal::ArenaStringPtr key_;
-  ::google::protobuf::internal::ArenaStringPtr id_;
-  ::google::protobuf::internal::ArenaStringPtr by_;
-  ::timestamp::Timestamp* timestamp_;
+  ::kvrpcpb::RequestHeader* header_;
+  ::kvrpcpb::LockRequest* req_;
   mutable int _cached_size_;
   friend struct protobuf_kvrpcpb_2eproto::TableStruct;
 };
 // -------------------------------------------------------------------
 
-class DsUnlockRequest : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:kvrpcpb.DsUnlockRequest) */ {
+class LockResponse : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:kvrpcpb.LockResponse) */ {
  public:
-  DsUnlockRequest();
-  virtual ~DsUnlockRequest();
+  LockResponse();
+  virtual ~LockResponse();
 
-  DsUnlockRequest(const DsUnlockRequest& from);
+  LockResponse(const LockResponse& from);
 
-  inline DsUnlockRequest& operator=(const DsUnlockRequest& from) {
+  inline LockResponse& operator=(const LockResponse& from) {
     CopyFrom(from);
     return *this;
   }
   #if LANG_CXX11
-  DsUnlockRequest(DsUnlockRequest&& from) noexcept
-    : DsUnlockRequest() {
+  LockResponse(LockResponse&& from) noexcept
+    : LockResponse() {
     *this = ::std::move(from);
   }
 
-  inline DsUnlockRequest& operator=(DsUnlockRequest&& from) noexcept {
+  inline LockResponse& operator=(LockResponse&& from) noexcept {
     if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
       if (this != &from) InternalSwap(&from);
     } else {
@@ -10445,29 +10383,29 @@ class DsUnlockRequest : public ::google::protobuf::Message /* @@protoc_insertion
   }
   #endif
   static const ::google::protobuf::Descriptor* descriptor();
-  static const DsUnlockRequest& default_instance();
+  static const LockResponse& default_instance();
 
-  static inline const DsUnlockRequest* internal_default_instance() {
-    return reinterpret_cast<const DsUnlockRequest*>(
-               &_DsUnlockRequest_default_instance_);
+  static inline const LockResponse* internal_default_instance() {
+    return reinterpret_cast<const LockResponse*>(
+               &_LockResponse_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
     86;
 
-  void Swap(DsUnlockRequest* other);
-  friend void swap(DsUnlockRequest& a, DsUnlockRequest& b) {
+  void Swap(LockResponse* other);
+  friend void swap(LockResponse& a, LockResponse& b) {
     a.Swap(&b);
   }
 
   // implements Message ----------------------------------------------
 
-  inline DsUnlockRequest* New() const PROTOBUF_FINAL { return New(NULL); }
+  inline LockResponse* New() const PROTOBUF_FINAL { return New(NULL); }
 
-  DsUnlockRequest* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
+  LockResponse* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
   void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
   void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
-  void CopyFrom(const DsUnlockRequest& from);
-  void MergeFrom(const DsUnlockRequest& from);
+  void CopyFrom(const LockResponse& from);
+  void MergeFrom(const LockResponse& from);
   void Clear() PROTOBUF_FINAL;
   bool IsInitialized() const PROTOBUF_FINAL;
 
@@ -10483,7 +10421,7 @@ class DsUnlockRequest : public ::google::protobuf::Message /* @@protoc_insertion
   void SharedCtor();
   void SharedDtor();
   void SetCachedSize(int size) const PROTOBUF_FINAL;
-  void InternalSwap(DsUnlockRequest* other);
+  void InternalSwap(LockResponse* other);
   private:
   inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
     return NULL;
@@ -10499,53 +10437,77 @@ class DsUnlockRequest : public ::google::protobuf::Message /* @@protoc_insertion
 
   // accessors -------------------------------------------------------
 
-  // .kvrpcpb.RequestHeader header = 1;
-  bool has_header() const;
-  void clear_header();
-  static const int kHeaderFieldNumber = 1;
-  const ::kvrpcpb::RequestHeader& header() const;
-  ::kvrpcpb::RequestHeader* mutable_header();
-  ::kvrpcpb::RequestHeader* release_header();
-  void set_allocated_header(::kvrpcpb::RequestHeader* header);
+  // string error = 2;
+  void clear_error();
+  static const int kErrorFieldNumber = 2;
+  const ::std::string& error() const;
+  void set_error(const ::std::string& value);
+  #if LANG_CXX11
+  void set_error(::std::string&& value);
+  #endif
+  void set_error(const char* value);
+  void set_error(const char* value, size_t size);
+  ::std::string* mutable_error();
+  ::std::string* release_error();
+  void set_allocated_error(::std::string* error);
 
-  // .kvrpcpb.UnlockRequest req = 2;
-  bool has_req() const;
-  void clear_req();
-  static const int kReqFieldNumber = 2;
-  const ::kvrpcpb::UnlockRequest& req() const;
-  ::kvrpcpb::UnlockRequest* mutable_req();
-  ::kvrpcpb::UnlockRequest* release_req();
-  void set_allocated_req(::kvrpcpb::UnlockRequest* req);
+  // bytes value = 3;
+  void clear_value();
+  static const int kValueFieldNumber = 3;
+  const ::std::string& value() const;
+  void set_value(const ::std::string& value);
+  #if LANG_CXX11
+  void set_value(::std::string&& value);
+  #endif
+  void set_value(const char* value);
+  void set_value(const void* value, size_t size);
+  ::std::string* mutable_value();
+  ::std::string* release_value();
+  void set_allocated_value(::std::string* value);
 
-  // @@protoc_insertion_point(class_scope:kvrpcpb.DsUnlockRequest)
+  // int64 code = 1;
+  void clear_code();
+  static const int kCodeFieldNumber = 1;
+  ::google::protobuf::int64 code() const;
+  void set_code(::google::protobuf::int64 value);
+
+  // int64 update_time = 4;
+  void clear_update_time();
+  static const int kUpdateTimeFieldNumber = 4;
+  ::google::protobuf::int64 update_time() const;
+  void set_update_time(::google::protobuf::int64 value);
+
+  // @@protoc_insertion_point(class_scope:kvrpcpb.LockResponse)
  private:
 
   ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::kvrpcpb::RequestHeader* header_;
-  ::kvrpcpb::UnlockRequest* req_;
+  ::google::protobuf::internal::ArenaStringPtr error_;
+  ::google::protobuf::internal::ArenaStringPtr value_;
+  ::google::protobuf::int64 code_;
+  ::google::protobuf::int64 update_time_;
   mutable int _cached_size_;
   friend struct protobuf_kvrpcpb_2eproto::TableStruct;
 };
 // -------------------------------------------------------------------
 
-class DsUnlockResponse : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:kvrpcpb.DsUnlockResponse) */ {
+class LockInfo : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:kvrpcpb.LockInfo) */ {
  public:
-  DsUnlockResponse();
-  virtual ~DsUnlockResponse();
+  LockInfo();
+  virtual ~LockInfo();
 
-  DsUnlockResponse(const DsUnlockResponse& from);
+  LockInfo(const LockInfo& from);
 
-  inline DsUnlockResponse& operator=(const DsUnlockResponse& from) {
+  inline LockInfo& operator=(const LockInfo& from) {
     CopyFrom(from);
     return *this;
   }
   #if LANG_CXX11
-  DsUnlockResponse(DsUnlockResponse&& from) noexcept
-    : DsUnlockResponse() {
+  LockInfo(LockInfo&& from) noexcept
+    : LockInfo() {
     *this = ::std::move(from);
   }
 
-  inline DsUnlockResponse& operator=(DsUnlockResponse&& from) noexcept {
+  inline LockInfo& operator=(LockInfo&& from) noexcept {
     if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
       if (this != &from) InternalSwap(&from);
     } else {
@@ -10555,29 +10517,29 @@ class DsUnlockResponse : public ::google::protobuf::Message /* @@protoc_insertio
   }
   #endif
   static const ::google::protobuf::Descriptor* descriptor();
-  static const DsUnlockResponse& default_instance();
+  static const LockInfo& default_instance();
 
-  static inline const DsUnlockResponse* internal_default_instance() {
-    return reinterpret_cast<const DsUnlockResponse*>(
-               &_DsUnlockResponse_default_instance_);
+  static inline const LockInfo* internal_default_instance() {
+    return reinterpret_cast<const LockInfo*>(
+               &_LockInfo_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
     87;
 
-  void Swap(DsUnlockResponse* other);
-  friend void swap(DsUnlockResponse& a, DsUnlockResponse& b) {
+  void Swap(LockInfo* other);
+  friend void swap(LockInfo& a, LockInfo& b) {
     a.Swap(&b);
   }
 
   // implements Message ----------------------------------------------
 
-  inline DsUnlockResponse* New() const PROTOBUF_FINAL { return New(NULL); }
+  inline LockInfo* New() const PROTOBUF_FINAL { return New(NULL); }
 
-  DsUnlockResponse* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
+  LockInfo* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
   void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
   void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
-  void CopyFrom(const DsUnlockResponse& from);
-  void MergeFrom(const DsUnlockResponse& from);
+  void CopyFrom(const LockInfo& from);
+  void MergeFrom(const LockInfo& from);
   void Clear() PROTOBUF_FINAL;
   bool IsInitialized() const PROTOBUF_FINAL;
 
@@ -10593,7 +10555,7 @@ class DsUnlockResponse : public ::google::protobuf::Message /* @@protoc_insertio
   void SharedCtor();
   void SharedDtor();
   void SetCachedSize(int size) const PROTOBUF_FINAL;
-  void InternalSwap(DsUnlockResponse* other);
+  void InternalSwap(LockInfo* other);
   private:
   inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
     return NULL;
@@ -10609,53 +10571,58 @@ class DsUnlockResponse : public ::google::protobuf::Message /* @@protoc_insertio
 
   // accessors -------------------------------------------------------
 
-  // .kvrpcpb.ResponseHeader header = 1;
-  bool has_header() const;
-  void clear_header();
-  static const int kHeaderFieldNumber = 1;
-  const ::kvrpcpb::ResponseHeader& header() const;
-  ::kvrpcpb::ResponseHeader* mutable_header();
-  ::kvrpcpb::ResponseHeader* release_header();
-  void set_allocated_header(::kvrpcpb::ResponseHeader* header);
+  // bytes key = 1;
+  void clear_key();
+  static const int kKeyFieldNumber = 1;
+  const ::std::string& key() const;
+  void set_key(const ::std::string& value);
+  #if LANG_CXX11
+  void set_key(::std::string&& value);
+  #endif
+  void set_key(const char* value);
+  void set_key(const void* value, size_t size);
+  ::std::string* mutable_key();
+  ::std::string* release_key();
+  void set_allocated_key(::std::string* key);
 
-  // .kvrpcpb.LockResponse resp = 2;
-  bool has_resp() const;
-  void clear_resp();
-  static const int kRespFieldNumber = 2;
-  const ::kvrpcpb::LockResponse& resp() const;
-  ::kvrpcpb::LockResponse* mutable_resp();
-  ::kvrpcpb::LockResponse* release_resp();
-  void set_allocated_resp(::kvrpcpb::LockResponse* resp);
+  // .kvrpcpb.LockValue value = 2;
+  bool has_value() const;
+  void clear_value();
+  static const int kValueFieldNumber = 2;
+  const ::kvrpcpb::LockValue& value() const;
+  ::kvrpcpb::LockValue* mutable_value();
+  ::kvrpcpb::LockValue* release_value();
+  void set_allocated_value(::kvrpcpb::LockValue* value);
 
-  // @@protoc_insertion_point(class_scope:kvrpcpb.DsUnlockResponse)
+  // @@protoc_insertion_point(class_scope:kvrpcpb.LockInfo)
  private:
 
   ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::kvrpcpb::ResponseHeader* header_;
-  ::kvrpcpb::LockResponse* resp_;
+  ::google::protobuf::internal::ArenaStringPtr key_;
+  ::kvrpcpb::LockValue* value_;
   mutable int _cached_size_;
   friend struct protobuf_kvrpcpb_2eproto::TableStruct;
 };
 // -------------------------------------------------------------------
 
-class UnlockForceRequest : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:kvrpcpb.UnlockForceRequest) */ {
+class LockScanResponse : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:kvrpcpb.LockScanResponse) */ {
  public:
-  UnlockForceRequest();
-  virtual ~UnlockForceRequest();
+  LockScanResponse();
+  virtual ~LockScanResponse();
 
-  UnlockForceRequest(const UnlockForceRequest& from);
+  LockScanResponse(const LockScanResponse& from);
 
-  inline UnlockForceRequest& operator=(const UnlockForceRequest& from) {
+  inline LockScanResponse& operator=(const LockScanResponse& from) {
     CopyFrom(from);
     return *this;
   }
   #if LANG_CXX11
-  UnlockForceRequest(UnlockForceRequest&& from) noexcept
-    : UnlockForceRequest() {
+  LockScanResponse(LockScanResponse&& from) noexcept
+    : LockScanResponse() {
     *this = ::std::move(from);
   }
 
-  inline UnlockForceRequest& operator=(UnlockForceRequest&& from) noexcept {
+  inline LockScanResponse& operator=(LockScanResponse&& from) noexcept {
     if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
       if (this != &from) InternalSwap(&from);
     } else {
@@ -10665,29 +10632,29 @@ class UnlockForceRequest : public ::google::protobuf::Message /* @@protoc_insert
   }
   #endif
   static const ::google::protobuf::Descriptor* descriptor();
-  static const UnlockForceRequest& default_instance();
+  static const LockScanResponse& default_instance();
 
-  static inline const UnlockForceRequest* internal_default_instance() {
-    return reinterpret_cast<const UnlockForceRequest*>(
-               &_UnlockForceRequest_default_instance_);
+  static inline const LockScanResponse* internal_default_instance() {
+    return reinterpret_cast<const LockScanResponse*>(
+               &_LockScanResponse_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
     88;
 
-  void Swap(UnlockForceRequest* other);
-  friend void swap(UnlockForceRequest& a, UnlockForceRequest& b) {
+  void Swap(LockScanResponse* other);
+  friend void swap(LockScanResponse& a, LockScanResponse& b) {
     a.Swap(&b);
   }
 
   // implements Message ----------------------------------------------
 
-  inline UnlockForceRequest* New() const PROTOBUF_FINAL { return New(NULL); }
+  inline LockScanResponse* New() const PROTOBUF_FINAL { return New(NULL); }
 
-  UnlockForceRequest* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
+  LockScanResponse* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
   void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
   void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
-  void CopyFrom(const UnlockForceRequest& from);
-  void MergeFrom(const UnlockForceRequest& from);
+  void CopyFrom(const LockScanResponse& from);
+  void MergeFrom(const LockScanResponse& from);
   void Clear() PROTOBUF_FINAL;
   bool IsInitialized() const PROTOBUF_FINAL;
 
@@ -10703,7 +10670,7 @@ class UnlockForceRequest : public ::google::protobuf::Message /* @@protoc_insert
   void SharedCtor();
   void SharedDtor();
   void SetCachedSize(int size) const PROTOBUF_FINAL;
-  void InternalSwap(UnlockForceRequest* other);
+  void InternalSwap(LockScanResponse* other);
   private:
   inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
     return NULL;
@@ -10719,73 +10686,61 @@ class UnlockForceRequest : public ::google::protobuf::Message /* @@protoc_insert
 
   // accessors -------------------------------------------------------
 
-  // bytes key = 1;
-  void clear_key();
-  static const int kKeyFieldNumber = 1;
-  const ::std::string& key() const;
-  void set_key(const ::std::string& value);
-  #if LANG_CXX11
-  void set_key(::std::string&& value);
-  #endif
-  void set_key(const char* value);
-  void set_key(const void* value, size_t size);
-  ::std::string* mutable_key();
-  ::std::string* release_key();
-  void set_allocated_key(::std::string* key);
+  // repeated .kvrpcpb.LockInfo info = 1;
+  int info_size() const;
+  void clear_info();
+  static const int kInfoFieldNumber = 1;
+  const ::kvrpcpb::LockInfo& info(int index) const;
+  ::kvrpcpb::LockInfo* mutable_info(int index);
+  ::kvrpcpb::LockInfo* add_info();
+  ::google::protobuf::RepeatedPtrField< ::kvrpcpb::LockInfo >*
+      mutable_info();
+  const ::google::protobuf::RepeatedPtrField< ::kvrpcpb::LockInfo >&
+      info() const;
 
-  // string by = 11;
-  void clear_by();
-  static const int kByFieldNumber = 11;
-  const ::std::string& by() const;
-  void set_by(const ::std::string& value);
+  // bytes last_key = 2;
+  void clear_last_key();
+  static const int kLastKeyFieldNumber = 2;
+  const ::std::string& last_key() const;
+  void set_last_key(const ::std::string& value);
   #if LANG_CXX11
-  void set_by(::std::string&& value);
+  void set_last_key(::std::string&& value);
   #endif
-  void set_by(const char* value);
-  void set_by(const char* value, size_t size);
-  ::std::string* mutable_by();
-  ::std::string* release_by();
-  void set_allocated_by(::std::string* by);
-
-  // .timestamp.Timestamp timestamp = 10;
-  bool has_timestamp() const;
-  void clear_timestamp();
-  static const int kTimestampFieldNumber = 10;
-  const ::timestamp::Timestamp& timestamp() const;
-  ::timestamp::Timestamp* mutable_timestamp();
-  ::timestamp::Timestamp* release_timestamp();
-  void set_allocated_timestamp(::timestamp::Timestamp* timestamp);
+  void set_last_key(const char* value);
+  void set_last_key(const void* value, size_t size);
+  ::std::string* mutable_last_key();
+  ::std::string* release_last_key();
+  void set_allocated_last_key(::std::string* last_key);
 
-  // @@protoc_insertion_point(class_scope:kvrpcpb.UnlockForceRequest)
+  // @@protoc_insertion_point(class_scope:kvrpcpb.LockScanResponse)
  private:
 
   ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::internal::ArenaStringPtr key_;
-  ::google::protobuf::internal::ArenaStringPtr by_;
-  ::timestamp::Timestamp* timestamp_;
+  ::google::protobuf::RepeatedPtrField< ::kvrpcpb::LockInfo > info_;
+  ::google::protobuf::internal::ArenaStringPtr last_key_;
   mutable int _cached_size_;
   friend struct protobuf_kvrpcpb_2eproto::TableStruct;
 };
 // -------------------------------------------------------------------
 
-class DsUnlockForceRequest : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:kvrpcpb.DsUnlockForceRequest) */ {
+class DsLockResponse : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:kvrpcpb.DsLockResponse) */ {
  public:
-  DsUnlockForceRequest();
-  virtual ~DsUnlockForceRequest();
+  DsLockResponse();
+  virtual ~DsLockResponse();
 
-  DsUnlockForceRequest(const DsUnlockForceRequest& from);
+  DsLockResponse(const DsLockResponse& from);
 
-  inline DsUnlockForceRequest& operator=(const DsUnlockForceRequest& from) {
+  inline DsLockResponse& operator=(const DsLockResponse& from) {
     CopyFrom(from);
     return *this;
   }
   #if LANG_CXX11
-  DsUnlockForceRequest(DsUnlockForceRequest&& from) noexcept
-    : DsUnlockForceRequest() {
+  DsLockResponse(DsLockResponse&& from) noexcept
+    : DsLockResponse() {
     *this = ::std::move(from);
   }
 
-  inline DsUnlockForceRequest& operator=(DsUnlockForceRequest&& from) noexcept {
+  inline DsLockResponse& operator=(DsLockResponse&& from) noexcept {
     if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
       if (this != &from) InternalSwap(&from);
     } else {
@@ -10795,29 +10750,29 @@ class DsUnlockForceRequest : public ::google::protobuf::Message /* @@protoc_inse
   }
   #endif
   static const ::google::protobuf::Descriptor* descriptor();
-  static const DsUnlockForceRequest& default_instance();
+  static const DsLockResponse& default_instance();
 
-  static inline const DsUnlockForceRequest* internal_default_instance() {
-    return reinterpret_cast<const DsUnlockForceRequest*>(
-               &_DsUnlockForceRequest_default_instance_);
+  static inline const DsLockResponse* internal_default_instance() {
+    return reinterpret_cast<const DsLockResponse*>(
+               &_DsLockResponse_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
     89;
 
-  void Swap(DsUnlockForceRequest* other);
-  friend void swap(DsUnlockForceRequest& a, DsUnlockForceRequest& b) {
+  void Swap(DsLockResponse* other);
+  friend void swap(DsLockResponse& a, DsLockResponse& b) {
     a.Swap(&b);
   }
 
   // implements Message ----------------------------------------------
 
-  inline DsUnlockForceRequest* New() const PROTOBUF_FINAL { return New(NULL); }
+  inline DsLockResponse* New() const PROTOBUF_FINAL { return New(NULL); }
 
-  DsUnlockForceRequest* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
+  DsLockResponse* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
   void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
   void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
-  void CopyFrom(const DsUnlockForceRequest& from);
-  void MergeFrom(const DsUnlockForceRequest& from);
+  void CopyFrom(const DsLockResponse& from);
+  void MergeFrom(const DsLockResponse& from);
   void Clear() PROTOBUF_FINAL;
   bool IsInitialized() const PROTOBUF_FINAL;
 
@@ -10833,7 +10788,7 @@ class DsUnlockForceRequest : public ::google::protobuf::Message /* @@protoc_inse
   void SharedCtor();
   void SharedDtor();
   void SetCachedSize(int size) const PROTOBUF_FINAL;
-  void InternalSwap(DsUnlockForceRequest* other);
+  void InternalSwap(DsLockResponse* other);
   private:
   inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
     return NULL;
@@ -10849,53 +10804,53 @@ class DsUnlockForceRequest : public ::google::protobuf::Message /* @@protoc_inse
 
   // accessors -------------------------------------------------------
 
-  // .kvrpcpb.RequestHeader header = 1;
+  // .kvrpcpb.ResponseHeader header = 1;
   bool has_header() const;
   void clear_header();
   static const int kHeaderFieldNumber = 1;
-  const ::kvrpcpb::RequestHeader& header() const;
-  ::kvrpcpb::RequestHeader* mutable_header();
-  ::kvrpcpb::RequestHeader* release_header();
-  void set_allocated_header(::kvrpcpb::RequestHeader* header);
+  const ::kvrpcpb::ResponseHeader& header() const;
+  ::kvrpcpb::ResponseHeader* mutable_header();
+  ::kvrpcpb::ResponseHeader* release_header();
+  void set_allocated_header(::kvrpcpb::ResponseHeader* header);
 
-  // .kvrpcpb.UnlockForceRequest req = 2;
-  bool has_req() const;
-  void clear_req();
-  static const int kReqFieldNumber = 2;
-  const ::kvrpcpb::UnlockForceRequest& req() const;
-  ::kvrpcpb::UnlockForceRequest* mutable_req();
-  ::kvrpcpb::UnlockForceRequest* release_req();
-  void set_allocated_req(::kvrpcpb::UnlockForceRequest* req);
+  // .kvrpcpb.LockResponse resp = 2;
+  bool has_resp() const;
+  void clear_resp();
+  static const int kRespFieldNumber = 2;
+  const ::kvrpcpb::LockResponse& resp() const;
+  ::kvrpcpb::LockResponse* mutable_resp();
+  ::kvrpcpb::LockResponse* release_resp();
+  void set_allocated_resp(::kvrpcpb::LockResponse* resp);
 
-  // @@protoc_insertion_point(class_scope:kvrpcpb.DsUnlockForceRequest)
+  // @@protoc_insertion_point(class_scope:kvrpcpb.DsLockResponse)
  private:
 
   ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::kvrpcpb::RequestHeader* header_;
-  ::kvrpcpb::UnlockForceRequest* req_;
+  ::kvrpcpb::ResponseHeader* header_;
+  ::kvrpcpb::LockResponse* resp_;
   mutable int _cached_size_;
   friend struct protobuf_kvrpcpb_2eproto::TableStruct;
 };
 // -------------------------------------------------------------------
 
-class DsUnlockForceResponse : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:kvrpcpb.DsUnlockForceResponse) */ {
+class LockUpdateRequest : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:kvrpcpb.LockUpdateRequest) */ {
  public:
-  DsUnlockForceResponse();
-  virtual ~DsUnlockForceResponse();
+  LockUpdateRequest();
+  virtual ~LockUpdateRequest();
 
-  DsUnlockForceResponse(const DsUnlockForceResponse& from);
+  LockUpdateRequest(const LockUpdateRequest& from);
 
-  inline DsUnlockForceResponse& operator=(const DsUnlockForceResponse& from) {
+  inline LockUpdateRequest& operator=(const LockUpdateRequest& from) {
     CopyFrom(from);
     return *this;
   }
   #if LANG_CXX11
-  DsUnlockForceResponse(DsUnlockForceResponse&& from) noexcept
-    : DsUnlockForceResponse() {
+  LockUpdateRequest(LockUpdateRequest&& from) noexcept
+    : LockUpdateRequest() {
     *this = ::std::move(from);
   }
 
-  inline DsUnlockForceResponse& operator=(DsUnlockForceResponse&& from) noexcept {
+  inline LockUpdateRequest& operator=(LockUpdateRequest&& from) noexcept {
     if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
       if (this != &from) InternalSwap(&from);
     } else {
@@ -10905,29 +10860,29 @@ class DsUnlockForceResponse : public ::google::protobuf::Message /* @@protoc_ins
   }
   #endif
   static const ::google::protobuf::Descriptor* descriptor();
-  static const DsUnlockForceResponse& default_instance();
+  static const LockUpdateRequest& default_instance();
 
-  static inline const DsUnlockForceResponse* internal_default_instance() {
-    return reinterpret_cast<const DsUnlockForceResponse*>(
-               &_DsUnlockForceResponse_default_instance_);
+  static inline const LockUpdateRequest* internal_default_instance() {
+    return reinterpret_cast<const LockUpdateRequest*>(
+               &_LockUpdateRequest_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
     90;
 
-  void Swap(DsUnlockForceResponse* other);
-  friend void swap(DsUnlockForceResponse& a, DsUnlockForceResponse& b) {
+  void Swap(LockUpdateRequest* other);
+  friend void swap(LockUpdateRequest& a, LockUpdateRequest& b) {
     a.Swap(&b);
   }
 
   // implements Message ----------------------------------------------
 
-  inline DsUnlockForceResponse* New() const PROTOBUF_FINAL { return New(NULL); }
+  inline LockUpdateRequest* New() const PROTOBUF_FINAL { return New(NULL); }
 
-  DsUnlockForceResponse* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
+  LockUpdateRequest* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
   void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
   void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
-  void CopyFrom(const DsUnlockForceResponse& from);
-  void MergeFrom(const DsUnlockForceResponse& from);
+  void CopyFrom(const LockUpdateRequest& from);
+  void MergeFrom(const LockUpdateRequest& from);
   void Clear() PROTOBUF_FINAL;
   bool IsInitialized() const PROTOBUF_FINAL;
 
@@ -10943,7 +10898,7 @@ class DsUnlockForceResponse : public ::google::protobuf::Message /* @@protoc_ins
   void SharedCtor();
   void SharedDtor();
   void SetCachedSize(int size) const PROTOBUF_FINAL;
-  void InternalSwap(DsUnlockForceResponse* other);
+  void InternalSwap(LockUpdateRequest* other);
   private:
   inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
     return NULL;
@@ -10959,53 +10914,95 @@ class DsUnlockForceResponse : public ::google::protobuf::Message /* @@protoc_ins
 
   // accessors -------------------------------------------------------
 
-  // .kvrpcpb.ResponseHeader header = 1;
-  bool has_header() const;
-  void clear_header();
-  static const int kHeaderFieldNumber = 1;
-  const ::kvrpcpb::ResponseHeader& header() const;
-  ::kvrpcpb::ResponseHeader* mutable_header();
-  ::kvrpcpb::ResponseHeader* release_header();
-  void set_allocated_header(::kvrpcpb::ResponseHeader* header);
+  // bytes key = 1;
+  void clear_key();
+  static const int kKeyFieldNumber = 1;
+  const ::std::string& key() const;
+  void set_key(const ::std::string& value);
+  #if LANG_CXX11
+  void set_key(::std::string&& value);
+  #endif
+  void set_key(const char* value);
+  void set_key(const void* value, size_t size);
+  ::std::string* mutable_key();
+  ::std::string* release_key();
+  void set_allocated_key(::std::string* key);
 
-  // .kvrpcpb.LockResponse resp = 2;
-  bool has_resp() const;
-  void clear_resp();
-  static const int kRespFieldNumber = 2;
-  const ::kvrpcpb::LockResponse& resp() const;
-  ::kvrpcpb::LockResponse* mutable_resp();
-  ::kvrpcpb::LockResponse* release_resp();
-  void set_allocated_resp(::kvrpcpb::LockResponse* resp);
+  // string id = 3;
+  void clear_id();
+  static const int kIdFieldNumber = 3;
+  const ::std::string& id() const;
+  void set_id(const ::std::string& value);
+  #if LANG_CXX11
+  void set_id(::std::string&& value);
+  #endif
+  void set_id(const char* value);
+  void set_id(const char* value, size_t size);
+  ::std::string* mutable_id();
+  ::std::string* release_id();
+  void set_allocated_id(::std::string* id);
 
-  // @@protoc_insertion_point(class_scope:kvrpcpb.DsUnlockForceResponse)
+  // bytes update_value = 6;
+  void clear_update_value();
+  static const int kUpdateValueFieldNumber = 6;
+  const ::std::string& update_value() const;
+  void set_update_value(const ::std::string& value);
+  #if LANG_CXX11
+  void set_update_value(::std::string&& value);
+  #endif
+  void set_update_value(const char* value);
+  void set_update_value(const void* value, size_t size);
+  ::std::string* mutable_update_value();
+  ::std::string* release_update_value();
+  void set_allocated_update_value(::std::string* update_value);
+
+  // .timestamp.Timestamp timestamp = 10;
+  bool has_timestamp() const;
+  void clear_timestamp();
+  static const int kTimestampFieldNumber = 10;
+  const ::timestamp::Timestamp& timestamp() const;
+  ::timestamp::Timestamp* mutable_timestamp();
+  ::timestamp::Timestamp* release_timestamp();
+  void set_allocated_timestamp(::timestamp::Timestamp* timestamp);
+
+  // int64 update_time = 5;
+  void clear_update_time();
+  static const int kUpdateTimeFieldNumber = 5;
+  ::google::protobuf::int64 update_time() const;
+  void set_update_time(::google::protobuf::int64 value);
+
+  // @@protoc_insertion_point(class_scope:kvrpcpb.LockUpdateRequest)
  private:
 
   ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::kvrpcpb::ResponseHeader* header_;
-  ::kvrpcpb::LockResponse* resp_;
-  mutable int _cached_size_;
-  friend struct protobuf_kvrpcpb_2eproto::TableStruct;
-};
-// -------------------------------------------------------------------
+  ::google::protobuf::internal::ArenaStringPtr key_;
+  ::google::protobuf::internal::ArenaStringPtr id_;
+  ::google::protobuf::internal::ArenaStringPtr update_value_;
+  ::timestamp::Timestamp* timestamp_;
+  ::google::protobuf::int64 update_time_;
+  mutable int _cached_size_;
+  friend struct protobuf_kvrpcpb_2eproto::TableStruct;
+};
+// -------------------------------------------------------------------
 
-class LockScanRequest : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:kvrpcpb.LockScanRequest) */ {
+class DsLockUpdateRequest : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:kvrpcpb.DsLockUpdateRequest) */ {
  public:
-  LockScanRequest();
-  virtual ~LockScanRequest();
+  DsLockUpdateRequest();
+  virtual ~DsLockUpdateRequest();
 
-  LockScanRequest(const LockScanRequest& from);
+  DsLockUpdateRequest(const DsLockUpdateRequest& from);
 
-  inline LockScanRequest& operator=(const LockScanRequest& from) {
+  inline DsLockUpdateRequest& operator=(const DsLockUpdateRequest& from) {
     CopyFrom(from);
     return *this;
   }
   #if LANG_CXX11
-  LockScanRequest(LockScanRequest&& from) noexcept
-    : LockScanRequest() {
+  DsLockUpdateRequest(DsLockUpdateRequest&& from) noexcept
+    : DsLockUpdateRequest() {
     *this = ::std::move(from);
   }
 
-  inline LockScanRequest& operator=(LockScanRequest&& from) noexcept {
+  inline DsLockUpdateRequest& operator=(DsLockUpdateRequest&& from) noexcept {
     if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
       if (this != &from) InternalSwap(&from);
     } else {
@@ -11015,29 +11012,29 @@ class LockScanRequest : public ::google::protobuf::Message /* @@protoc_insertion
   }
   #endif
   static const ::google::protobuf::Descriptor* descriptor();
-  static const LockScanRequest& default_instance();
+  static const DsLockUpdateRequest& default_instance();
 
-  static inline const LockScanRequest* internal_default_instance() {
-    return reinterpret_cast<const LockScanRequest*>(
-               &_LockScanRequest_default_instance_);
+  static inline const DsLockUpdateRequest* internal_default_instance() {
+    return reinterpret_cast<const DsLockUpdateRequest*>(
+               &_DsLockUpdateRequest_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
     91;
 
-  void Swap(LockScanRequest* other);
-  friend void swap(LockScanRequest& a, LockScanRequest& b) {
+  void Swap(DsLockUpdateRequest* other);
+  friend void swap(DsLockUpdateRequest& a, DsLockUpdateRequest& b) {
     a.Swap(&b);
   }
 
   // implements Message ----------------------------------------------
 
-  inline LockScanRequest* New() const PROTOBUF_FINAL { return New(NULL); }
+  inline DsLockUpdateRequest* New() const PROTOBUF_FINAL { return New(NULL); }
 
-  LockScanRequest* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
+  DsLockUpdateRequest* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
   void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
   void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
-  void CopyFrom(const LockScanRequest& from);
-  void MergeFrom(const LockScanRequest& from);
+  void CopyFrom(const DsLockUpdateRequest& from);
+  void MergeFrom(const DsLockUpdateRequest& from);
   void Clear() PROTOBUF_FINAL;
   bool IsInitialized() const PROTOBUF_FINAL;
 
@@ -11053,7 +11050,7 @@ class LockScanRequest : public ::google::protobuf::Message /* @@protoc_insertion
   void SharedCtor();
   void SharedDtor();
   void SetCachedSize(int size) const PROTOBUF_FINAL;
-  void InternalSwap(LockScanRequest* other);
+  void InternalSwap(DsLockUpdateRequest* other);
   private:
   inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
     return NULL;
@@ -11069,70 +11066,53 @@ class LockScanRequest : public ::google::protobuf::Message /* @@protoc_insertion
 
   // accessors -------------------------------------------------------
 
-  // bytes start = 1;
-  void clear_start();
-  static const int kStartFieldNumber = 1;
-  const ::std::string& start() const;
-  void set_start(const ::std::string& value);
-  #if LANG_CXX11
-  void set_start(::std::string&& value);
-  #endif
-  void set_start(const char* value);
-  void set_start(const void* value, size_t size);
-  ::std::string* mutable_start();
-  ::std::string* release_start();
-  void set_allocated_start(::std::string* start);
-
-  // bytes limit = 2;
-  void clear_limit();
-  static const int kLimitFieldNumber = 2;
-  const ::std::string& limit() const;
-  void set_limit(const ::std::string& value);
-  #if LANG_CXX11
-  void set_limit(::std::string&& value);
-  #endif
-  void set_limit(const char* value);
-  void set_limit(const void* value, size_t size);
-  ::std::string* mutable_limit();
-  ::std::string* release_limit();
-  void set_allocated_limit(::std::string* limit);
+  // .kvrpcpb.RequestHeader header = 1;
+  bool has_header() const;
+  void clear_header();
+  static const int kHeaderFieldNumber = 1;
+  const ::kvrpcpb::RequestHeader& header() const;
+  ::kvrpcpb::RequestHeader* mutable_header();
+  ::kvrpcpb::RequestHeader* release_header();
+  void set_allocated_header(::kvrpcpb::RequestHeader* header);
 
-  // uint32 count = 3;
-  void clear_count();
-  static const int kCountFieldNumber = 3;
-  ::google::protobuf::uint32 count() const;
-  void set_count(::google::protobuf::uint32 value);
+  // .kvrpcpb.LockUpdateRequest req = 2;
+  bool has_req() const;
+  void clear_req();
+  static const int kReqFieldNumber = 2;
+  const ::kvrpcpb::LockUpdateRequest& req() const;
+  ::kvrpcpb::LockUpdateRequest* mutable_req();
+  ::kvrpcpb::LockUpdateRequest* release_req();
+  void set_allocated_req(::kvrpcpb::LockUpdateRequest* req);
 
-  // @@protoc_insertion_point(class_scope:kvrpcpb.LockScanRequest)
+  // @@protoc_insertion_point(class_scope:kvrpcpb.DsLockUpdateRequest)
  private:
 
   ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::internal::ArenaStringPtr start_;
-  ::google::protobuf::internal::ArenaStringPtr limit_;
-  ::google::protobuf::uint32 count_;
+  ::kvrpcpb::RequestHeader* header_;
+  ::kvrpcpb::LockUpdateRequest* req_;
   mutable int _cached_size_;
   friend struct protobuf_kvrpcpb_2eproto::TableStruct;
 };
 // -------------------------------------------------------------------
 
-class DsLockScanRequest : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:kvrpcpb.DsLockScanRequest) */ {
+class DsLockUpdateResponse : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:kvrpcpb.DsLockUpdateResponse) */ {
  public:
-  DsLockScanRequest();
-  virtual ~DsLockScanRequest();
+  DsLockUpdateResponse();
+  virtual ~DsLockUpdateResponse();
 
-  DsLockScanRequest(const DsLockScanRequest& from);
+  DsLockUpdateResponse(const DsLockUpdateResponse& from);
 
-  inline DsLockScanRequest& operator=(const DsLockScanRequest& from) {
+  inline DsLockUpdateResponse& operator=(const DsLockUpdateResponse& from) {
     CopyFrom(from);
     return *this;
   }
   #if LANG_CXX11
-  DsLockScanRequest(DsLockScanRequest&& from) noexcept
-    : DsLockScanRequest() {
+  DsLockUpdateResponse(DsLockUpdateResponse&& from) noexcept
+    : DsLockUpdateResponse() {
     *this = ::std::move(from);
   }
 
-  inline DsLockScanRequest& operator=(DsLockScanRequest&& from) noexcept {
+  inline DsLockUpdateResponse& operator=(DsLockUpdateResponse&& from) noexcept {
     if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
       if (this != &from) InternalSwap(&from);
     } else {
@@ -11142,29 +11122,29 @@ class DsLockScanRequest : public ::google::protobuf::Message /* @@protoc_inserti
   }
   #endif
   static const ::google::protobuf::Descriptor* descriptor();
-  static const DsLockScanRequest& default_instance();
+  static const DsLockUpdateResponse& default_instance();
 
-  static inline const DsLockScanRequest* internal_default_instance() {
-    return reinterpret_cast<const DsLockScanRequest*>(
-               &_DsLockScanRequest_default_instance_);
+  static inline const DsLockUpdateResponse* internal_default_instance() {
+    return reinterpret_cast<const DsLockUpdateResponse*>(
+               &_DsLockUpdateResponse_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
     92;
 
-  void Swap(DsLockScanRequest* other);
-  friend void swap(DsLockScanRequest& a, DsLockScanRequest& b) {
+  void Swap(DsLockUpdateResponse* other);
+  friend void swap(DsLockUpdateResponse& a, DsLockUpdateResponse& b) {
     a.Swap(&b);
   }
 
   // implements Message ----------------------------------------------
 
-  inline DsLockScanRequest* New() const PROTOBUF_FINAL { return New(NULL); }
+  inline DsLockUpdateResponse* New() const PROTOBUF_FINAL { return New(NULL); }
 
-  DsLockScanRequest* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
+  DsLockUpdateResponse* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
   void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
   void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
-  void CopyFrom(const DsLockScanRequest& from);
-  void MergeFrom(const DsLockScanRequest& from);
+  void CopyFrom(const DsLockUpdateResponse& from);
+  void MergeFrom(const DsLockUpdateResponse& from);
   void Clear() PROTOBUF_FINAL;
   bool IsInitialized() const PROTOBUF_FINAL;
 
@@ -11180,7 +11160,7 @@ class DsLockScanRequest : public ::google::protobuf::Message /* @@protoc_inserti
   void SharedCtor();
   void SharedDtor();
   void SetCachedSize(int size) const PROTOBUF_FINAL;
-  void InternalSwap(DsLockScanRequest* other);
+  void InternalSwap(DsLockUpdateResponse* other);
   private:
   inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
     return NULL;
@@ -11196,53 +11176,53 @@ class DsLockScanRequest : public ::google::protobuf::Message /* @@protoc_inserti
 
   // accessors -------------------------------------------------------
 
-  // .kvrpcpb.RequestHeader header = 1;
+  // .kvrpcpb.ResponseHeader header = 1;
   bool has_header() const;
   void clear_header();
   static const int kHeaderFieldNumber = 1;
-  const ::kvrpcpb::RequestHeader& header() const;
-  ::kvrpcpb::RequestHeader* mutable_header();
-  ::kvrpcpb::RequestHeader* release_header();
-  void set_allocated_header(::kvrpcpb::RequestHeader* header);
+  const ::kvrpcpb::ResponseHeader& header() const;
+  ::kvrpcpb::ResponseHeader* mutable_header();
+  ::kvrpcpb::ResponseHeader* release_header();
+  void set_allocated_header(::kvrpcpb::ResponseHeader* header);
 
-  // .kvrpcpb.LockScanRequest req = 2;
-  bool has_req() const;
-  void clear_req();
-  static const int kReqFieldNumber = 2;
-  const ::kvrpcpb::LockScanRequest& req() const;
-  ::kvrpcpb::LockScanRequest* mutable_req();
-  ::kvrpcpb::LockScanRequest* release_req();
-  void set_allocated_req(::kvrpcpb::LockScanRequest* req);
+  // .kvrpcpb.LockResponse resp = 2;
+  bool has_resp() const;
+  void clear_resp();
+  static const int kRespFieldNumber = 2;
+  const ::kvrpcpb::LockResponse& resp() const;
+  ::kvrpcpb::LockResponse* mutable_resp();
+  ::kvrpcpb::LockResponse* release_resp();
+  void set_allocated_resp(::kvrpcpb::LockResponse* resp);
 
-  // @@protoc_insertion_point(class_scope:kvrpcpb.DsLockScanRequest)
+  // @@protoc_insertion_point(class_scope:kvrpcpb.DsLockUpdateResponse)
  private:
 
   ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::kvrpcpb::RequestHeader* header_;
-  ::kvrpcpb::LockScanRequest* req_;
+  ::kvrpcpb::ResponseHeader* header_;
+  ::kvrpcpb::LockResponse* resp_;
   mutable int _cached_size_;
   friend struct protobuf_kvrpcpb_2eproto::TableStruct;
 };
 // -------------------------------------------------------------------
 
-class DsLockScanResponse : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:kvrpcpb.DsLockScanResponse) */ {
+class UnlockRequest : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:kvrpcpb.UnlockRequest) */ {
  public:
-  DsLockScanResponse();
-  virtual ~DsLockScanResponse();
+  UnlockRequest();
+  virtual ~UnlockRequest();
 
-  DsLockScanResponse(const DsLockScanResponse& from);
+  UnlockRequest(const UnlockRequest& from);
 
-  inline DsLockScanResponse& operator=(const DsLockScanResponse& from) {
+  inline UnlockRequest& operator=(const UnlockRequest& from) {
     CopyFrom(from);
     return *this;
   }
   #if LANG_CXX11
-  DsLockScanResponse(DsLockScanResponse&& from) noexcept
-    : DsLockScanResponse() {
+  UnlockRequest(UnlockRequest&& from) noexcept
+    : UnlockRequest() {
     *this = ::std::move(from);
   }
 
-  inline DsLockScanResponse& operator=(DsLockScanResponse&& from) noexcept {
+  inline UnlockRequest& operator=(UnlockRequest&& from) noexcept {
     if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
       if (this != &from) InternalSwap(&from);
     } else {
@@ -11252,29 +11232,29 @@ class DsLockScanResponse : public ::google::protobuf::Message /* @@protoc_insert
   }
   #endif
   static const ::google::protobuf::Descriptor* descriptor();
-  static const DsLockScanResponse& default_instance();
+  static const UnlockRequest& default_instance();
 
-  static inline const DsLockScanResponse* internal_default_instance() {
-    return reinterpret_cast<const DsLockScanResponse*>(
-               &_DsLockScanResponse_default_instance_);
+  static inline const UnlockRequest* internal_default_instance() {
+    return reinterpret_cast<const UnlockRequest*>(
+               &_UnlockRequest_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
     93;
 
-  void Swap(DsLockScanResponse* other);
-  friend void swap(DsLockScanResponse& a, DsLockScanResponse& b) {
+  void Swap(UnlockRequest* other);
+  friend void swap(UnlockRequest& a, UnlockRequest& b) {
     a.Swap(&b);
   }
 
   // implements Message ----------------------------------------------
 
-  inline DsLockScanResponse* New() const PROTOBUF_FINAL { return New(NULL); }
+  inline UnlockRequest* New() const PROTOBUF_FINAL { return New(NULL); }
 
-  DsLockScanResponse* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
+  UnlockRequest* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
   void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
   void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
-  void CopyFrom(const DsLockScanResponse& from);
-  void MergeFrom(const DsLockScanResponse& from);
+  void CopyFrom(const UnlockRequest& from);
+  void MergeFrom(const UnlockRequest& from);
   void Clear() PROTOBUF_FINAL;
   bool IsInitialized() const PROTOBUF_FINAL;
 
@@ -11290,7 +11270,7 @@ class DsLockScanResponse : public ::google::protobuf::Message /* @@protoc_insert
   void SharedCtor();
   void SharedDtor();
   void SetCachedSize(int size) const PROTOBUF_FINAL;
-  void InternalSwap(DsLockScanResponse* other);
+  void InternalSwap(UnlockRequest* other);
   private:
   inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
     return NULL;
@@ -11306,28 +11286,980 @@ class DsLockScanResponse : public ::google::protobuf::Message /* @@protoc_insert
 
   // accessors -------------------------------------------------------
 
-  // .kvrpcpb.ResponseHeader header = 1;
-  bool has_header() const;
-  void clear_header();
-  static const int kHeaderFieldNumber = 1;
-  const ::kvrpcpb::ResponseHeader& header() const;
-  ::kvrpcpb::ResponseHeader* mutable_header();
-  ::kvrpcpb::ResponseHeader* release_header();
-  void set_allocated_header(::kvrpcpb::ResponseHeader* header);
-
-  // .kvrpcpb.LockScanResponse resp = 2;
-  bool has_resp() const;
-  void clear_resp();
-  static const int kRespFieldNumber = 2;
-  const ::kvrpcpb::LockScanResponse& resp() const;
-  ::kvrpcpb::LockScanResponse* mutable_resp();
-  ::kvrpcpb::LockScanResponse* release_resp();
-  void set_allocated_resp(::kvrpcpb::LockScanResponse* resp);
+  // bytes key = 1;
+  void clear_key();
+  static const int kKeyFieldNumber = 1;
+  const ::std::string& key() const;
+  void set_key(const ::std::string& value);
+  #if LANG_CXX11
+  void set_key(::std::string&& value);
+  #endif
+  void set_key(const char* value);
+  void set_key(const void* value, size_t size);
+  ::std::string* mutable_key();
+  ::std::string* release_key();
+  void set_allocated_key(::std::string* key);
 
-  // @@protoc_insertion_point(class_scope:kvrpcpb.DsLockScanResponse)
- private:
+  // string id = 3;
+  void clear_id();
+  static const int kIdFieldNumber = 3;
+  const ::std::string& id() const;
+  void set_id(const ::std::string& value);
+  #if LANG_CXX11
+  void set_id(::std::string&& value);
+  #endif
+  void set_id(const char* value);
+  void set_id(const char* value, size_t size);
+  ::std::string* mutable_id();
+  ::std::string* release_id();
+  void set_allocated_id(::std::string* id);
 
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  // string by = 11;
+  void clear_by();
+  static const int kByFieldNumber = 11;
+  const ::std::string& by() const;
+  void set_by(const ::std::string& value);
+  #if LANG_CXX11
+  void set_by(::std::string&& value);
+  #endif
+  void set_by(const char* value);
+  void set_by(const char* value, size_t size);
+  ::std::string* mutable_by();
+  ::std::string* release_by();
+  void set_allocated_by(::std::string* by);
+
+  // .timestamp.Timestamp timestamp = 10;
+  bool has_timestamp() const;
+  void clear_timestamp();
+  static const int kTimestampFieldNumber = 10;
+  const ::timestamp::Timestamp& timestamp() const;
+  ::timestamp::Timestamp* mutable_timestamp();
+  ::timestamp::Timestamp* release_timestamp();
+  void set_allocated_timestamp(::timestamp::Timestamp* timestamp);
+
+  // @@protoc_insertion_point(class_scope:kvrpcpb.UnlockRequest)
+ private:
+
+  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  ::google::protobuf::internal::ArenaStringPtr key_;
+  ::google::protobuf::internal::ArenaStringPtr id_;
+  ::google::protobuf::internal::ArenaStringPtr by_;
+  ::timestamp::Timestamp* timestamp_;
+  mutable int _cached_size_;
+  friend struct protobuf_kvrpcpb_2eproto::TableStruct;
+};
+// -------------------------------------------------------------------
+
+class DsUnlockRequest : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:kvrpcpb.DsUnlockRequest) */ {
+ public:
+  DsUnlockRequest();
+  virtual ~DsUnlockRequest();
+
+  DsUnlockRequest(const DsUnlockRequest& from);
+
+  inline DsUnlockRequest& operator=(const DsUnlockRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  #if LANG_CXX11
+  DsUnlockRequest(DsUnlockRequest&& from) noexcept
+    : DsUnlockRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline DsUnlockRequest& operator=(DsUnlockRequest&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+  #endif
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const DsUnlockRequest& default_instance();
+
+  static inline const DsUnlockRequest* internal_default_instance() {
+    return reinterpret_cast<const DsUnlockRequest*>(
+               &_DsUnlockRequest_default_instance_);
+  }
+  static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
+    94;
+
+  void Swap(DsUnlockRequest* other);
+  friend void swap(DsUnlockRequest& a, DsUnlockRequest& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline DsUnlockRequest* New() const PROTOBUF_FINAL { return New(NULL); }
+
+  DsUnlockRequest* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
+  void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  void CopyFrom(const DsUnlockRequest& from);
+  void MergeFrom(const DsUnlockRequest& from);
+  void Clear() PROTOBUF_FINAL;
+  bool IsInitialized() const PROTOBUF_FINAL;
+
+  size_t ByteSizeLong() const PROTOBUF_FINAL;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* target) const PROTOBUF_FINAL;
+  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const PROTOBUF_FINAL;
+  void InternalSwap(DsUnlockRequest* other);
+  private:
+  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
+    return NULL;
+  }
+  inline void* MaybeArenaPtr() const {
+    return NULL;
+  }
+  public:
+
+  ::google::protobuf::Metadata GetMetadata() const PROTOBUF_FINAL;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // .kvrpcpb.RequestHeader header = 1;
+  bool has_header() const;
+  void clear_header();
+  static const int kHeaderFieldNumber = 1;
+  const ::kvrpcpb::RequestHeader& header() const;
+  ::kvrpcpb::RequestHeader* mutable_header();
+  ::kvrpcpb::RequestHeader* release_header();
+  void set_allocated_header(::kvrpcpb::RequestHeader* header);
+
+  // .kvrpcpb.UnlockRequest req = 2;
+  bool has_req() const;
+  void clear_req();
+  static const int kReqFieldNumber = 2;
+  const ::kvrpcpb::UnlockRequest& req() const;
+  ::kvrpcpb::UnlockRequest* mutable_req();
+  ::kvrpcpb::UnlockRequest* release_req();
+  void set_allocated_req(::kvrpcpb::UnlockRequest* req);
+
+  // @@protoc_insertion_point(class_scope:kvrpcpb.DsUnlockRequest)
+ private:
+
+  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  ::kvrpcpb::RequestHeader* header_;
+  ::kvrpcpb::UnlockRequest* req_;
+  mutable int _cached_size_;
+  friend struct protobuf_kvrpcpb_2eproto::TableStruct;
+};
+// -------------------------------------------------------------------
+
+class DsUnlockResponse : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:kvrpcpb.DsUnlockResponse) */ {
+ public:
+  DsUnlockResponse();
+  virtual ~DsUnlockResponse();
+
+  DsUnlockResponse(const DsUnlockResponse& from);
+
+  inline DsUnlockResponse& operator=(const DsUnlockResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  #if LANG_CXX11
+  DsUnlockResponse(DsUnlockResponse&& from) noexcept
+    : DsUnlockResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline DsUnlockResponse& operator=(DsUnlockResponse&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+  #endif
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const DsUnlockResponse& default_instance();
+
+  static inline const DsUnlockResponse* internal_default_instance() {
+    return reinterpret_cast<const DsUnlockResponse*>(
+               &_DsUnlockResponse_default_instance_);
+  }
+  static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
+    95;
+
+  void Swap(DsUnlockResponse* other);
+  friend void swap(DsUnlockResponse& a, DsUnlockResponse& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline DsUnlockResponse* New() const PROTOBUF_FINAL { return New(NULL); }
+
+  DsUnlockResponse* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
+  void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  void CopyFrom(const DsUnlockResponse& from);
+  void MergeFrom(const DsUnlockResponse& from);
+  void Clear() PROTOBUF_FINAL;
+  bool IsInitialized() const PROTOBUF_FINAL;
+
+  size_t ByteSizeLong() const PROTOBUF_FINAL;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* target) const PROTOBUF_FINAL;
+  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const PROTOBUF_FINAL;
+  void InternalSwap(DsUnlockResponse* other);
+  private:
+  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
+    return NULL;
+  }
+  inline void* MaybeArenaPtr() const {
+    return NULL;
+  }
+  public:
+
+  ::google::protobuf::Metadata GetMetadata() const PROTOBUF_FINAL;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // .kvrpcpb.ResponseHeader header = 1;
+  bool has_header() const;
+  void clear_header();
+  static const int kHeaderFieldNumber = 1;
+  const ::kvrpcpb::ResponseHeader& header() const;
+  ::kvrpcpb::ResponseHeader* mutable_header();
+  ::kvrpcpb::ResponseHeader* release_header();
+  void set_allocated_header(::kvrpcpb::ResponseHeader* header);
+
+  // .kvrpcpb.LockResponse resp = 2;
+  bool has_resp() const;
+  void clear_resp();
+  static const int kRespFieldNumber = 2;
+  const ::kvrpcpb::LockResponse& resp() const;
+  ::kvrpcpb::LockResponse* mutable_resp();
+  ::kvrpcpb::LockResponse* release_resp();
+  void set_allocated_resp(::kvrpcpb::LockResponse* resp);
+
+  // @@protoc_insertion_point(class_scope:kvrpcpb.DsUnlockResponse)
+ private:
+
+  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  ::kvrpcpb::ResponseHeader* header_;
+  ::kvrpcpb::LockResponse* resp_;
+  mutable int _cached_size_;
+  friend struct protobuf_kvrpcpb_2eproto::TableStruct;
+};
+// -------------------------------------------------------------------
+
+class UnlockForceRequest : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:kvrpcpb.UnlockForceRequest) */ {
+ public:
+  UnlockForceRequest();
+  virtual ~UnlockForceRequest();
+
+  UnlockForceRequest(const UnlockForceRequest& from);
+
+  inline UnlockForceRequest& operator=(const UnlockForceRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  #if LANG_CXX11
+  UnlockForceRequest(UnlockForceRequest&& from) noexcept
+    : UnlockForceRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline UnlockForceRequest& operator=(UnlockForceRequest&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+  #endif
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const UnlockForceRequest& default_instance();
+
+  static inline const UnlockForceRequest* internal_default_instance() {
+    return reinterpret_cast<const UnlockForceRequest*>(
+               &_UnlockForceRequest_default_instance_);
+  }
+  static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
+    96;
+
+  void Swap(UnlockForceRequest* other);
+  friend void swap(UnlockForceRequest& a, UnlockForceRequest& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline UnlockForceRequest* New() const PROTOBUF_FINAL { return New(NULL); }
+
+  UnlockForceRequest* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
+  void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  void CopyFrom(const UnlockForceRequest& from);
+  void MergeFrom(const UnlockForceRequest& from);
+  void Clear() PROTOBUF_FINAL;
+  bool IsInitialized() const PROTOBUF_FINAL;
+
+  size_t ByteSizeLong() const PROTOBUF_FINAL;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* target) const PROTOBUF_FINAL;
+  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const PROTOBUF_FINAL;
+  void InternalSwap(UnlockForceRequest* other);
+  private:
+  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
+    return NULL;
+  }
+  inline void* MaybeArenaPtr() const {
+    return NULL;
+  }
+  public:
+
+  ::google::protobuf::Metadata GetMetadata() const PROTOBUF_FINAL;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // bytes key = 1;
+  void clear_key();
+  static const int kKeyFieldNumber = 1;
+  const ::std::string& key() const;
+  void set_key(const ::std::string& value);
+  #if LANG_CXX11
+  void set_key(::std::string&& value);
+  #endif
+  void set_key(const char* value);
+  void set_key(const void* value, size_t size);
+  ::std::string* mutable_key();
+  ::std::string* release_key();
+  void set_allocated_key(::std::string* key);
+
+  // string by = 11;
+  void clear_by();
+  static const int kByFieldNumber = 11;
+  const ::std::string& by() const;
+  void set_by(const ::std::string& value);
+  #if LANG_CXX11
+  void set_by(::std::string&& value);
+  #endif
+  void set_by(const char* value);
+  void set_by(const char* value, size_t size);
+  ::std::string* mutable_by();
+  ::std::string* release_by();
+  void set_allocated_by(::std::string* by);
+
+  // .timestamp.Timestamp timestamp = 10;
+  bool has_timestamp() const;
+  void clear_timestamp();
+  static const int kTimestampFieldNumber = 10;
+  const ::timestamp::Timestamp& timestamp() const;
+  ::timestamp::Timestamp* mutable_timestamp();
+  ::timestamp::Timestamp* release_timestamp();
+  void set_allocated_timestamp(::timestamp::Timestamp* timestamp);
+
+  // @@protoc_insertion_point(class_scope:kvrpcpb.UnlockForceRequest)
+ private:
+
+  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  ::google::protobuf::internal::ArenaStringPtr key_;
+  ::google::protobuf::internal::ArenaStringPtr by_;
+  ::timestamp::Timestamp* timestamp_;
+  mutable int _cached_size_;
+  friend struct protobuf_kvrpcpb_2eproto::TableStruct;
+};
+// -------------------------------------------------------------------
+
+class DsUnlockForceRequest : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:kvrpcpb.DsUnlockForceRequest) */ {
+ public:
+  DsUnlockForceRequest();
+  virtual ~DsUnlockForceRequest();
+
+  DsUnlockForceRequest(const DsUnlockForceRequest& from);
+
+  inline DsUnlockForceRequest& operator=(const DsUnlockForceRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  #if LANG_CXX11
+  DsUnlockForceRequest(DsUnlockForceRequest&& from) noexcept
+    : DsUnlockForceRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline DsUnlockForceRequest& operator=(DsUnlockForceRequest&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+  #endif
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const DsUnlockForceRequest& default_instance();
+
+  static inline const DsUnlockForceRequest* internal_default_instance() {
+    return reinterpret_cast<const DsUnlockForceRequest*>(
+               &_DsUnlockForceRequest_default_instance_);
+  }
+  static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
+    97;
+
+  void Swap(DsUnlockForceRequest* other);
+  friend void swap(DsUnlockForceRequest& a, DsUnlockForceRequest& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline DsUnlockForceRequest* New() const PROTOBUF_FINAL { return New(NULL); }
+
+  DsUnlockForceRequest* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
+  void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  void CopyFrom(const DsUnlockForceRequest& from);
+  void MergeFrom(const DsUnlockForceRequest& from);
+  void Clear() PROTOBUF_FINAL;
+  bool IsInitialized() const PROTOBUF_FINAL;
+
+  size_t ByteSizeLong() const PROTOBUF_FINAL;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* target) const PROTOBUF_FINAL;
+  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const PROTOBUF_FINAL;
+  void InternalSwap(DsUnlockForceRequest* other);
+  private:
+  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
+    return NULL;
+  }
+  inline void* MaybeArenaPtr() const {
+    return NULL;
+  }
+  public:
+
+  ::google::protobuf::Metadata GetMetadata() const PROTOBUF_FINAL;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // .kvrpcpb.RequestHeader header = 1;
+  bool has_header() const;
+  void clear_header();
+  static const int kHeaderFieldNumber = 1;
+  const ::kvrpcpb::RequestHeader& header() const;
+  ::kvrpcpb::RequestHeader* mutable_header();
+  ::kvrpcpb::RequestHeader* release_header();
+  void set_allocated_header(::kvrpcpb::RequestHeader* header);
+
+  // .kvrpcpb.UnlockForceRequest req = 2;
+  bool has_req() const;
+  void clear_req();
+  static const int kReqFieldNumber = 2;
+  const ::kvrpcpb::UnlockForceRequest& req() const;
+  ::kvrpcpb::UnlockForceRequest* mutable_req();
+  ::kvrpcpb::UnlockForceRequest* release_req();
+  void set_allocated_req(::kvrpcpb::UnlockForceRequest* req);
+
+  // @@protoc_insertion_point(class_scope:kvrpcpb.DsUnlockForceRequest)
+ private:
+
+  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  ::kvrpcpb::RequestHeader* header_;
+  ::kvrpcpb::UnlockForceRequest* req_;
+  mutable int _cached_size_;
+  friend struct protobuf_kvrpcpb_2eproto::TableStruct;
+};
+// -------------------------------------------------------------------
+
+class DsUnlockForceResponse : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:kvrpcpb.DsUnlockForceResponse) */ {
+ public:
+  DsUnlockForceResponse();
+  virtual ~DsUnlockForceResponse();
+
+  DsUnlockForceResponse(const DsUnlockForceResponse& from);
+
+  inline DsUnlockForceResponse& operator=(const DsUnlockForceResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  #if LANG_CXX11
+  DsUnlockForceResponse(DsUnlockForceResponse&& from) noexcept
+    : DsUnlockForceResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline DsUnlockForceResponse& operator=(DsUnlockForceResponse&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+  #endif
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const DsUnlockForceResponse& default_instance();
+
+  static inline const DsUnlockForceResponse* internal_default_instance() {
+    return reinterpret_cast<const DsUnlockForceResponse*>(
+               &_DsUnlockForceResponse_default_instance_);
+  }
+  static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
+    98;
+
+  void Swap(DsUnlockForceResponse* other);
+  friend void swap(DsUnlockForceResponse& a, DsUnlockForceResponse& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline DsUnlockForceResponse* New() const PROTOBUF_FINAL { return New(NULL); }
+
+  DsUnlockForceResponse* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
+  void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  void CopyFrom(const DsUnlockForceResponse& from);
+  void MergeFrom(const DsUnlockForceResponse& from);
+  void Clear() PROTOBUF_FINAL;
+  bool IsInitialized() const PROTOBUF_FINAL;
+
+  size_t ByteSizeLong() const PROTOBUF_FINAL;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* target) const PROTOBUF_FINAL;
+  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const PROTOBUF_FINAL;
+  void InternalSwap(DsUnlockForceResponse* other);
+  private:
+  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
+    return NULL;
+  }
+  inline void* MaybeArenaPtr() const {
+    return NULL;
+  }
+  public:
+
+  ::google::protobuf::Metadata GetMetadata() const PROTOBUF_FINAL;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // .kvrpcpb.ResponseHeader header = 1;
+  bool has_header() const;
+  void clear_header();
+  static const int kHeaderFieldNumber = 1;
+  const ::kvrpcpb::ResponseHeader& header() const;
+  ::kvrpcpb::ResponseHeader* mutable_header();
+  ::kvrpcpb::ResponseHeader* release_header();
+  void set_allocated_header(::kvrpcpb::ResponseHeader* header);
+
+  // .kvrpcpb.LockResponse resp = 2;
+  bool has_resp() const;
+  void clear_resp();
+  static const int kRespFieldNumber = 2;
+  const ::kvrpcpb::LockResponse& resp() const;
+  ::kvrpcpb::LockResponse* mutable_resp();
+  ::kvrpcpb::LockResponse* release_resp();
+  void set_allocated_resp(::kvrpcpb::LockResponse* resp);
+
+  // @@protoc_insertion_point(class_scope:kvrpcpb.DsUnlockForceResponse)
+ private:
+
+  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  ::kvrpcpb::ResponseHeader* header_;
+  ::kvrpcpb::LockResponse* resp_;
+  mutable int _cached_size_;
+  friend struct protobuf_kvrpcpb_2eproto::TableStruct;
+};
+// -------------------------------------------------------------------
+
+class LockScanRequest : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:kvrpcpb.LockScanRequest) */ {
+ public:
+  LockScanRequest();
+  virtual ~LockScanRequest();
+
+  LockScanRequest(const LockScanRequest& from);
+
+  inline LockScanRequest& operator=(const LockScanRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  #if LANG_CXX11
+  LockScanRequest(LockScanRequest&& from) noexcept
+    : LockScanRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline LockScanRequest& operator=(LockScanRequest&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+  #endif
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const LockScanRequest& default_instance();
+
+  static inline const LockScanRequest* internal_default_instance() {
+    return reinterpret_cast<const LockScanRequest*>(
+               &_LockScanRequest_default_instance_);
+  }
+  static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
+    99;
+
+  void Swap(LockScanRequest* other);
+  friend void swap(LockScanRequest& a, LockScanRequest& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline LockScanRequest* New() const PROTOBUF_FINAL { return New(NULL); }
+
+  LockScanRequest* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
+  void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  void CopyFrom(const LockScanRequest& from);
+  void MergeFrom(const LockScanRequest& from);
+  void Clear() PROTOBUF_FINAL;
+  bool IsInitialized() const PROTOBUF_FINAL;
+
+  size_t ByteSizeLong() const PROTOBUF_FINAL;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* target) const PROTOBUF_FINAL;
+  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const PROTOBUF_FINAL;
+  void InternalSwap(LockScanRequest* other);
+  private:
+  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
+    return NULL;
+  }
+  inline void* MaybeArenaPtr() const {
+    return NULL;
+  }
+  public:
+
+  ::google::protobuf::Metadata GetMetadata() const PROTOBUF_FINAL;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // bytes start = 1;
+  void clear_start();
+  static const int kStartFieldNumber = 1;
+  const ::std::string& start() const;
+  void set_start(const ::std::string& value);
+  #if LANG_CXX11
+  void set_start(::std::string&& value);
+  #endif
+  void set_start(const char* value);
+  void set_start(const void* value, size_t size);
+  ::std::string* mutable_start();
+  ::std::string* release_start();
+  void set_allocated_start(::std::string* start);
+
+  // bytes limit = 2;
+  void clear_limit();
+  static const int kLimitFieldNumber = 2;
+  const ::std::string& limit() const;
+  void set_limit(const ::std::string& value);
+  #if LANG_CXX11
+  void set_limit(::std::string&& value);
+  #endif
+  void set_limit(const char* value);
+  void set_limit(const void* value, size_t size);
+  ::std::string* mutable_limit();
+  ::std::string* release_limit();
+  void set_allocated_limit(::std::string* limit);
+
+  // uint32 count = 3;
+  void clear_count();
+  static const int kCountFieldNumber = 3;
+  ::google::protobuf::uint32 count() const;
+  void set_count(::google::protobuf::uint32 value);
+
+  // @@protoc_insertion_point(class_scope:kvrpcpb.LockScanRequest)
+ private:
+
+  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  ::google::protobuf::internal::ArenaStringPtr start_;
+  ::google::protobuf::internal::ArenaStringPtr limit_;
+  ::google::protobuf::uint32 count_;
+  mutable int _cached_size_;
+  friend struct protobuf_kvrpcpb_2eproto::TableStruct;
+};
+// -------------------------------------------------------------------
+
+class DsLockScanRequest : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:kvrpcpb.DsLockScanRequest) */ {
+ public:
+  DsLockScanRequest();
+  virtual ~DsLockScanRequest();
+
+  DsLockScanRequest(const DsLockScanRequest& from);
+
+  inline DsLockScanRequest& operator=(const DsLockScanRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  #if LANG_CXX11
+  DsLockScanRequest(DsLockScanRequest&& from) noexcept
+    : DsLockScanRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline DsLockScanRequest& operator=(DsLockScanRequest&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+  #endif
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const DsLockScanRequest& default_instance();
+
+  static inline const DsLockScanRequest* internal_default_instance() {
+    return reinterpret_cast<const DsLockScanRequest*>(
+               &_DsLockScanRequest_default_instance_);
+  }
+  static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
+    100;
+
+  void Swap(DsLockScanRequest* other);
+  friend void swap(DsLockScanRequest& a, DsLockScanRequest& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline DsLockScanRequest* New() const PROTOBUF_FINAL { return New(NULL); }
+
+  DsLockScanRequest* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
+  void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  void CopyFrom(const DsLockScanRequest& from);
+  void MergeFrom(const DsLockScanRequest& from);
+  void Clear() PROTOBUF_FINAL;
+  bool IsInitialized() const PROTOBUF_FINAL;
+
+  size_t ByteSizeLong() const PROTOBUF_FINAL;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* target) const PROTOBUF_FINAL;
+  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const PROTOBUF_FINAL;
+  void InternalSwap(DsLockScanRequest* other);
+  private:
+  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
+    return NULL;
+  }
+  inline void* MaybeArenaPtr() const {
+    return NULL;
+  }
+  public:
+
+  ::google::protobuf::Metadata GetMetadata() const PROTOBUF_FINAL;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // .kvrpcpb.RequestHeader header = 1;
+  bool has_header() const;
+  void clear_header();
+  static const int kHeaderFieldNumber = 1;
+  const ::kvrpcpb::RequestHeader& header() const;
+  ::kvrpcpb::RequestHeader* mutable_header();
+  ::kvrpcpb::RequestHeader* release_header();
+  void set_allocated_header(::kvrpcpb::RequestHeader* header);
+
+  // .kvrpcpb.LockScanRequest req = 2;
+  bool has_req() const;
+  void clear_req();
+  static const int kReqFieldNumber = 2;
+  const ::kvrpcpb::LockScanRequest& req() const;
+  ::kvrpcpb::LockScanRequest* mutable_req();
+  ::kvrpcpb::LockScanRequest* release_req();
+  void set_allocated_req(::kvrpcpb::LockScanRequest* req);
+
+  // @@protoc_insertion_point(class_scope:kvrpcpb.DsLockScanRequest)
+ private:
+
+  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  ::kvrpcpb::RequestHeader* header_;
+  ::kvrpcpb::LockScanRequest* req_;
+  mutable int _cached_size_;
+  friend struct protobuf_kvrpcpb_2eproto::TableStruct;
+};
+// -------------------------------------------------------------------
+
+class DsLockScanResponse : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:kvrpcpb.DsLockScanResponse) */ {
+ public:
+  DsLockScanResponse();
+  virtual ~DsLockScanResponse();
+
+  DsLockScanResponse(const DsLockScanResponse& from);
+
+  inline DsLockScanResponse& operator=(const DsLockScanResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  #if LANG_CXX11
+  DsLockScanResponse(DsLockScanResponse&& from) noexcept
+    : DsLockScanResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline DsLockScanResponse& operator=(DsLockScanResponse&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+  #endif
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const DsLockScanResponse& default_instance();
+
+  static inline const DsLockScanResponse* internal_default_instance() {
+    return reinterpret_cast<const DsLockScanResponse*>(
+               &_DsLockScanResponse_default_instance_);
+  }
+  static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
+    101;
+
+  void Swap(DsLockScanResponse* other);
+  friend void swap(DsLockScanResponse& a, DsLockScanResponse& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline DsLockScanResponse* New() const PROTOBUF_FINAL { return New(NULL); }
+
+  DsLockScanResponse* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
+  void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  void CopyFrom(const DsLockScanResponse& from);
+  void MergeFrom(const DsLockScanResponse& from);
+  void Clear() PROTOBUF_FINAL;
+  bool IsInitialized() const PROTOBUF_FINAL;
+
+  size_t ByteSizeLong() const PROTOBUF_FINAL;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* target) const PROTOBUF_FINAL;
+  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const PROTOBUF_FINAL;
+  void InternalSwap(DsLockScanResponse* other);
+  private:
+  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
+    return NULL;
+  }
+  inline void* MaybeArenaPtr() const {
+    return NULL;
+  }
+  public:
+
+  ::google::protobuf::Metadata GetMetadata() const PROTOBUF_FINAL;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // .kvrpcpb.ResponseHeader header = 1;
+  bool has_header() const;
+  void clear_header();
+  static const int kHeaderFieldNumber = 1;
+  const ::kvrpcpb::ResponseHeader& header() const;
+  ::kvrpcpb::ResponseHeader* mutable_header();
+  ::kvrpcpb::ResponseHeader* release_header();
+  void set_allocated_header(::kvrpcpb::ResponseHeader* header);
+
+  // .kvrpcpb.LockScanResponse resp = 2;
+  bool has_resp() const;
+  void clear_resp();
+  static const int kRespFieldNumber = 2;
+  const ::kvrpcpb::LockScanResponse& resp() const;
+  ::kvrpcpb::LockScanResponse* mutable_resp();
+  ::kvrpcpb::LockScanResponse* release_resp();
+  void set_allocated_resp(::kvrpcpb::LockScanResponse* resp);
+
+  // @@protoc_insertion_point(class_scope:kvrpcpb.DsLockScanResponse)
+ private:
+
+  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
   ::kvrpcpb::ResponseHeader* header_;
   ::kvrpcpb::LockScanResponse* resp_;
   mutable int _cached_size_;
@@ -13491,246 +14423,642 @@ inline const ::kvrpcpb::Limit& SelectRequest::limit() const {
   return p != NULL ? *p : *reinterpret_cast<const ::kvrpcpb::Limit*>(
       &::kvrpcpb::_Limit_default_instance_);
 }
-inline ::kvrpcpb::Limit* SelectRequest::mutable_limit() {
+inline ::kvrpcpb::Limit* SelectRequest::mutable_limit() {
+  
+  if (limit_ == NULL) {
+    limit_ = new ::kvrpcpb::Limit;
+  }
+  // @@protoc_insertion_point(field_mutable:kvrpcpb.SelectRequest.limit)
+  return limit_;
+}
+inline ::kvrpcpb::Limit* SelectRequest::release_limit() {
+  // @@protoc_insertion_point(field_release:kvrpcpb.SelectRequest.limit)
+  
+  ::kvrpcpb::Limit* temp = limit_;
+  limit_ = NULL;
+  return temp;
+}
+inline void SelectRequest::set_allocated_limit(::kvrpcpb::Limit* limit) {
+  delete limit_;
+  limit_ = limit;
+  if (limit) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.SelectRequest.limit)
+}
+
+// .timestamp.Timestamp timestamp = 7;
+inline bool SelectRequest::has_timestamp() const {
+  return this != internal_default_instance() && timestamp_ != NULL;
+}
+inline void SelectRequest::clear_timestamp() {
+  if (GetArenaNoVirtual() == NULL && timestamp_ != NULL) delete timestamp_;
+  timestamp_ = NULL;
+}
+inline const ::timestamp::Timestamp& SelectRequest::timestamp() const {
+  const ::timestamp::Timestamp* p = timestamp_;
+  // @@protoc_insertion_point(field_get:kvrpcpb.SelectRequest.timestamp)
+  return p != NULL ? *p : *reinterpret_cast<const ::timestamp::Timestamp*>(
+      &::timestamp::_Timestamp_default_instance_);
+}
+inline ::timestamp::Timestamp* SelectRequest::mutable_timestamp() {
+  
+  if (timestamp_ == NULL) {
+    timestamp_ = new ::timestamp::Timestamp;
+  }
+  // @@protoc_insertion_point(field_mutable:kvrpcpb.SelectRequest.timestamp)
+  return timestamp_;
+}
+inline ::timestamp::Timestamp* SelectRequest::release_timestamp() {
+  // @@protoc_insertion_point(field_release:kvrpcpb.SelectRequest.timestamp)
+  
+  ::timestamp::Timestamp* temp = timestamp_;
+  timestamp_ = NULL;
+  return temp;
+}
+inline void SelectRequest::set_allocated_timestamp(::timestamp::Timestamp* timestamp) {
+  delete timestamp_;
+  timestamp_ = timestamp;
+  if (timestamp) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.SelectRequest.timestamp)
+}
+
+// bool open_snapshot = 8;
+inline void SelectRequest::clear_open_snapshot() {
+  open_snapshot_ = false;
+}
+inline bool SelectRequest::open_snapshot() const {
+  // @@protoc_insertion_point(field_get:kvrpcpb.SelectRequest.open_snapshot)
+  return open_snapshot_;
+}
+inline void SelectRequest::set_open_snapshot(bool value) {
+  
+  open_snapshot_ = value;
+  // @@protoc_insertion_point(field_set:kvrpcpb.SelectRequest.open_snapshot)
+}
+
+// uint64 snapshot_id = 9;
+inline void SelectRequest::clear_snapshot_id() {
+  snapshot_id_ = GOOGLE_ULONGLONG(0);
+}
+inline ::google::protobuf::uint64 SelectRequest::snapshot_id() const {
+  // @@protoc_insertion_point(field_get:kvrpcpb.SelectRequest.snapshot_id)
+  return snapshot_id_;
+}
+inline void SelectRequest::set_snapshot_id(::google::protobuf::uint64 value) {
+  
+  snapshot_id_ = value;
+  // @@protoc_insertion_point(field_set:kvrpcpb.SelectRequest.snapshot_id)
+}
+
+// -------------------------------------------------------------------
+
+// Row
+
+// bytes key = 1;
+inline void Row::clear_key() {
+  key_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline const ::std::string& Row::key() const {
+  // @@protoc_insertion_point(field_get:kvrpcpb.Row.key)
+  return key_.GetNoArena();
+}
+inline void Row::set_key(const ::std::string& value) {
+  
+  key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:kvrpcpb.Row.key)
+}
+#if LANG_CXX11
+inline void Row::set_key(::std::string&& value) {
+  
+  key_.SetNoArena(
+    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:kvrpcpb.Row.key)
+}
+#endif
+inline void Row::set_key(const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  
+  key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:kvrpcpb.Row.key)
+}
+inline void Row::set_key(const void* value, size_t size) {
+  
+  key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:kvrpcpb.Row.key)
+}
+inline ::std::string* Row::mutable_key() {
+  
+  // @@protoc_insertion_point(field_mutable:kvrpcpb.Row.key)
+  return key_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline ::std::string* Row::release_key() {
+  // @@protoc_insertion_point(field_release:kvrpcpb.Row.key)
+  
+  return key_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline void Row::set_allocated_key(::std::string* key) {
+  if (key != NULL) {
+    
+  } else {
+    
+  }
+  key_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), key);
+  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.Row.key)
+}
+
+// bytes fields = 2;
+inline void Row::clear_fields() {
+  fields_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline const ::std::string& Row::fields() const {
+  // @@protoc_insertion_point(field_get:kvrpcpb.Row.fields)
+  return fields_.GetNoArena();
+}
+inline void Row::set_fields(const ::std::string& value) {
+  
+  fields_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:kvrpcpb.Row.fields)
+}
+#if LANG_CXX11
+inline void Row::set_fields(::std::string&& value) {
+  
+  fields_.SetNoArena(
+    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:kvrpcpb.Row.fields)
+}
+#endif
+inline void Row::set_fields(const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  
+  fields_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:kvrpcpb.Row.fields)
+}
+inline void Row::set_fields(const void* value, size_t size) {
+  
+  fields_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:kvrpcpb.Row.fields)
+}
+inline ::std::string* Row::mutable_fields() {
+  
+  // @@protoc_insertion_point(field_mutable:kvrpcpb.Row.fields)
+  return fields_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline ::std::string* Row::release_fields() {
+  // @@protoc_insertion_point(field_release:kvrpcpb.Row.fields)
+  
+  return fields_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline void Row::set_allocated_fields(::std::string* fields) {
+  if (fields != NULL) {
+    
+  } else {
+    
+  }
+  fields_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), fields);
+  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.Row.fields)
+}
+
+// repeated int64 aggred_counts = 3;
+inline int Row::aggred_counts_size() const {
+  return aggred_counts_.size();
+}
+inline void Row::clear_aggred_counts() {
+  aggred_counts_.Clear();
+}
+inline ::google::protobuf::int64 Row::aggred_counts(int index) const {
+  // @@protoc_insertion_point(field_get:kvrpcpb.Row.aggred_counts)
+  return aggred_counts_.Get(index);
+}
+inline void Row::set_aggred_counts(int index, ::google::protobuf::int64 value) {
+  aggred_counts_.Set(index, value);
+  // @@protoc_insertion_point(field_set:kvrpcpb.Row.aggred_counts)
+}
+inline void Row::add_aggred_counts(::google::protobuf::int64 value) {
+  aggred_counts_.Add(value);
+  // @@protoc_insertion_point(field_add:kvrpcpb.Row.aggred_counts)
+}
+inline const ::google::protobuf::RepeatedField< ::google::protobuf::int64 >&
+Row::aggred_counts() const {
+  // @@protoc_insertion_point(field_list:kvrpcpb.Row.aggred_counts)
+  return aggred_counts_;
+}
+inline ::google::protobuf::RepeatedField< ::google::protobuf::int64 >*
+Row::mutable_aggred_counts() {
+  // @@protoc_insertion_point(field_mutable_list:kvrpcpb.Row.aggred_counts)
+  return &aggred_counts_;
+}
+
+// -------------------------------------------------------------------
+
+// DsSelectResponse
+
+// .kvrpcpb.ResponseHeader header = 1;
+inline bool DsSelectResponse::has_header() const {
+  return this != internal_default_instance() && header_ != NULL;
+}
+inline void DsSelectResponse::clear_header() {
+  if (GetArenaNoVirtual() == NULL && header_ != NULL) delete header_;
+  header_ = NULL;
+}
+inline const ::kvrpcpb::ResponseHeader& DsSelectResponse::header() const {
+  const ::kvrpcpb::ResponseHeader* p = header_;
+  // @@protoc_insertion_point(field_get:kvrpcpb.DsSelectResponse.header)
+  return p != NULL ? *p : *reinterpret_cast<const ::kvrpcpb::ResponseHeader*>(
+      &::kvrpcpb::_ResponseHeader_default_instance_);
+}
+inline ::kvrpcpb::ResponseHeader* DsSelectResponse::mutable_header() {
   
-  if (limit_ == NULL) {
-    limit_ = new ::kvrpcpb::Limit;
+  if (header_ == NULL) {
+    header_ = new ::kvrpcpb::ResponseHeader;
   }
-  // @@protoc_insertion_point(field_mutable:kvrpcpb.SelectRequest.limit)
-  return limit_;
+  // @@protoc_insertion_point(field_mutable:kvrpcpb.DsSelectResponse.header)
+  return header_;
 }
-inline ::kvrpcpb::Limit* SelectRequest::release_limit() {
-  // @@protoc_insertion_point(field_release:kvrpcpb.SelectRequest.limit)
+inline ::kvrpcpb::ResponseHeader* DsSelectResponse::release_header() {
+  // @@protoc_insertion_point(field_release:kvrpcpb.DsSelectResponse.header)
   
-  ::kvrpcpb::Limit* temp = limit_;
-  limit_ = NULL;
+  ::kvrpcpb::ResponseHeader* temp = header_;
+  header_ = NULL;
   return temp;
 }
-inline void SelectRequest::set_allocated_limit(::kvrpcpb::Limit* limit) {
-  delete limit_;
-  limit_ = limit;
-  if (limit) {
+inline void DsSelectResponse::set_allocated_header(::kvrpcpb::ResponseHeader* header) {
+  delete header_;
+  header_ = header;
+  if (header) {
     
   } else {
     
   }
-  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.SelectRequest.limit)
+  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.DsSelectResponse.header)
 }
 
-// .timestamp.Timestamp timestamp = 7;
-inline bool SelectRequest::has_timestamp() const {
-  return this != internal_default_instance() && timestamp_ != NULL;
+// .kvrpcpb.SelectResponse resp = 2;
+inline bool DsSelectResponse::has_resp() const {
+  return this != internal_default_instance() && resp_ != NULL;
 }
-inline void SelectRequest::clear_timestamp() {
-  if (GetArenaNoVirtual() == NULL && timestamp_ != NULL) delete timestamp_;
-  timestamp_ = NULL;
+inline void DsSelectResponse::clear_resp() {
+  if (GetArenaNoVirtual() == NULL && resp_ != NULL) delete resp_;
+  resp_ = NULL;
 }
-inline const ::timestamp::Timestamp& SelectRequest::timestamp() const {
-  const ::timestamp::Timestamp* p = timestamp_;
-  // @@protoc_insertion_point(field_get:kvrpcpb.SelectRequest.timestamp)
-  return p != NULL ? *p : *reinterpret_cast<const ::timestamp::Timestamp*>(
-      &::timestamp::_Timestamp_default_instance_);
+inline const ::kvrpcpb::SelectResponse& DsSelectResponse::resp() const {
+  const ::kvrpcpb::SelectResponse* p = resp_;
+  // @@protoc_insertion_point(field_get:kvrpcpb.DsSelectResponse.resp)
+  return p != NULL ? *p : *reinterpret_cast<const ::kvrpcpb::SelectResponse*>(
+      &::kvrpcpb::_SelectResponse_default_instance_);
 }
-inline ::timestamp::Timestamp* SelectRequest::mutable_timestamp() {
+inline ::kvrpcpb::SelectResponse* DsSelectResponse::mutable_resp() {
   
-  if (timestamp_ == NULL) {
-    timestamp_ = new ::timestamp::Timestamp;
+  if (resp_ == NULL) {
+    resp_ = new ::kvrpcpb::SelectResponse;
   }
-  // @@protoc_insertion_point(field_mutable:kvrpcpb.SelectRequest.timestamp)
-  return timestamp_;
+  // @@protoc_insertion_point(field_mutable:kvrpcpb.DsSelectResponse.resp)
+  return resp_;
 }
-inline ::timestamp::Timestamp* SelectRequest::release_timestamp() {
-  // @@protoc_insertion_point(field_release:kvrpcpb.SelectRequest.timestamp)
+inline ::kvrpcpb::SelectResponse* DsSelectResponse::release_resp() {
+  // @@protoc_insertion_point(field_release:kvrpcpb.DsSelectResponse.resp)
   
-  ::timestamp::Timestamp* temp = timestamp_;
-  timestamp_ = NULL;
+  ::kvrpcpb::SelectResponse* temp = resp_;
+  resp_ = NULL;
   return temp;
 }
-inline void SelectRequest::set_allocated_timestamp(::timestamp::Timestamp* timestamp) {
-  delete timestamp_;
-  timestamp_ = timestamp;
-  if (timestamp) {
+inline void DsSelectResponse::set_allocated_resp(::kvrpcpb::SelectResponse* resp) {
+  delete resp_;
+  resp_ = resp;
+  if (resp) {
     
   } else {
     
   }
-  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.SelectRequest.timestamp)
+  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.DsSelectResponse.resp)
 }
 
 // -------------------------------------------------------------------
 
-// Row
+// SelectResponse
 
-// bytes key = 1;
-inline void Row::clear_key() {
+// int32 code = 1;
+inline void SelectResponse::clear_code() {
+  code_ = 0;
+}
+inline ::google::protobuf::int32 SelectResponse::code() const {
+  // @@protoc_insertion_point(field_get:kvrpcpb.SelectResponse.code)
+  return code_;
+}
+inline void SelectResponse::set_code(::google::protobuf::int32 value) {
+  
+  code_ = value;
+  // @@protoc_insertion_point(field_set:kvrpcpb.SelectResponse.code)
+}
+
+// repeated .kvrpcpb.Row rows = 2;
+inline int SelectResponse::rows_size() const {
+  return rows_.size();
+}
+inline void SelectResponse::clear_rows() {
+  rows_.Clear();
+}
+inline const ::kvrpcpb::Row& SelectResponse::rows(int index) const {
+  // @@protoc_insertion_point(field_get:kvrpcpb.SelectResponse.rows)
+  return rows_.Get(index);
+}
+inline ::kvrpcpb::Row* SelectResponse::mutable_rows(int index) {
+  // @@protoc_insertion_point(field_mutable:kvrpcpb.SelectResponse.rows)
+  return rows_.Mutable(index);
+}
+inline ::kvrpcpb::Row* SelectResponse::add_rows() {
+  // @@protoc_insertion_point(field_add:kvrpcpb.SelectResponse.rows)
+  return rows_.Add();
+}
+inline ::google::protobuf::RepeatedPtrField< ::kvrpcpb::Row >*
+SelectResponse::mutable_rows() {
+  // @@protoc_insertion_point(field_mutable_list:kvrpcpb.SelectResponse.rows)
+  return &rows_;
+}
+inline const ::google::protobuf::RepeatedPtrField< ::kvrpcpb::Row >&
+SelectResponse::rows() const {
+  // @@protoc_insertion_point(field_list:kvrpcpb.SelectResponse.rows)
+  return rows_;
+}
+
+// uint64 offset = 3;
+inline void SelectResponse::clear_offset() {
+  offset_ = GOOGLE_ULONGLONG(0);
+}
+inline ::google::protobuf::uint64 SelectResponse::offset() const {
+  // @@protoc_insertion_point(field_get:kvrpcpb.SelectResponse.offset)
+  return offset_;
+}
+inline void SelectResponse::set_offset(::google::protobuf::uint64 value) {
+  
+  offset_ = value;
+  // @@protoc_insertion_point(field_set:kvrpcpb.SelectResponse.offset)
+}
+
+// uint64 snapshot_id = 4;
+inline void SelectResponse::clear_snapshot_id() {
+  snapshot_id_ = GOOGLE_ULONGLONG(0);
+}
+inline ::google::protobuf::uint64 SelectResponse::snapshot_id() const {
+  // @@protoc_insertion_point(field_get:kvrpcpb.SelectResponse.snapshot_id)
+  return snapshot_id_;
+}
+inline void SelectResponse::set_snapshot_id(::google::protobuf::uint64 value) {
+  
+  snapshot_id_ = value;
+  // @@protoc_insertion_point(field_set:kvrpcpb.SelectResponse.snapshot_id)
+}
+
+// -------------------------------------------------------------------
+
+// KeyValue
+
+// bytes Key = 1;
+inline void KeyValue::clear_key() {
   key_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline const ::std::string& Row::key() const {
-  // @@protoc_insertion_point(field_get:kvrpcpb.Row.key)
+inline const ::std::string& KeyValue::key() const {
+  // @@protoc_insertion_point(field_get:kvrpcpb.KeyValue.Key)
   return key_.GetNoArena();
 }
-inline void Row::set_key(const ::std::string& value) {
+inline void KeyValue::set_key(const ::std::string& value) {
   
   key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:kvrpcpb.Row.key)
+  // @@protoc_insertion_point(field_set:kvrpcpb.KeyValue.Key)
 }
 #if LANG_CXX11
-inline void Row::set_key(::std::string&& value) {
+inline void KeyValue::set_key(::std::string&& value) {
   
   key_.SetNoArena(
     &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:kvrpcpb.Row.key)
+  // @@protoc_insertion_point(field_set_rvalue:kvrpcpb.KeyValue.Key)
 }
 #endif
-inline void Row::set_key(const char* value) {
+inline void KeyValue::set_key(const char* value) {
   GOOGLE_DCHECK(value != NULL);
   
   key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:kvrpcpb.Row.key)
+  // @@protoc_insertion_point(field_set_char:kvrpcpb.KeyValue.Key)
 }
-inline void Row::set_key(const void* value, size_t size) {
+inline void KeyValue::set_key(const void* value, size_t size) {
   
   key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
       ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:kvrpcpb.Row.key)
+  // @@protoc_insertion_point(field_set_pointer:kvrpcpb.KeyValue.Key)
 }
-inline ::std::string* Row::mutable_key() {
+inline ::std::string* KeyValue::mutable_key() {
   
-  // @@protoc_insertion_point(field_mutable:kvrpcpb.Row.key)
+  // @@protoc_insertion_point(field_mutable:kvrpcpb.KeyValue.Key)
   return key_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline ::std::string* Row::release_key() {
-  // @@protoc_insertion_point(field_release:kvrpcpb.Row.key)
+inline ::std::string* KeyValue::release_key() {
+  // @@protoc_insertion_point(field_release:kvrpcpb.KeyValue.Key)
   
   return key_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline void Row::set_allocated_key(::std::string* key) {
+inline void KeyValue::set_allocated_key(::std::string* key) {
   if (key != NULL) {
     
   } else {
     
   }
   key_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), key);
-  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.Row.key)
+  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.KeyValue.Key)
 }
 
-// bytes fields = 2;
-inline void Row::clear_fields() {
-  fields_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+// bytes Value = 2;
+inline void KeyValue::clear_value() {
+  value_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline const ::std::string& Row::fields() const {
-  // @@protoc_insertion_point(field_get:kvrpcpb.Row.fields)
-  return fields_.GetNoArena();
+inline const ::std::string& KeyValue::value() const {
+  // @@protoc_insertion_point(field_get:kvrpcpb.KeyValue.Value)
+  return value_.GetNoArena();
+}
+inline void KeyValue::set_value(const ::std::string& value) {
+  
+  value_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:kvrpcpb.KeyValue.Value)
+}
+#if LANG_CXX11
+inline void KeyValue::set_value(::std::string&& value) {
+  
+  value_.SetNoArena(
+    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:kvrpcpb.KeyValue.Value)
+}
+#endif
+inline void KeyValue::set_value(const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  
+  value_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:kvrpcpb.KeyValue.Value)
+}
+inline void KeyValue::set_value(const void* value, size_t size) {
+  
+  value_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:kvrpcpb.KeyValue.Value)
+}
+inline ::std::string* KeyValue::mutable_value() {
+  
+  // @@protoc_insertion_point(field_mutable:kvrpcpb.KeyValue.Value)
+  return value_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline ::std::string* KeyValue::release_value() {
+  // @@protoc_insertion_point(field_release:kvrpcpb.KeyValue.Value)
+  
+  return value_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline void KeyValue::set_allocated_value(::std::string* value) {
+  if (value != NULL) {
+    
+  } else {
+    
+  }
+  value_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.KeyValue.Value)
+}
+
+// int64 ExpireAt = 3;
+inline void KeyValue::clear_expireat() {
+  expireat_ = GOOGLE_LONGLONG(0);
+}
+inline ::google::protobuf::int64 KeyValue::expireat() const {
+  // @@protoc_insertion_point(field_get:kvrpcpb.KeyValue.ExpireAt)
+  return expireat_;
 }
-inline void Row::set_fields(const ::std::string& value) {
+inline void KeyValue::set_expireat(::google::protobuf::int64 value) {
   
-  fields_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:kvrpcpb.Row.fields)
+  expireat_ = value;
+  // @@protoc_insertion_point(field_set:kvrpcpb.KeyValue.ExpireAt)
 }
-#if LANG_CXX11
-inline void Row::set_fields(::std::string&& value) {
-  
-  fields_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:kvrpcpb.Row.fields)
+
+// -------------------------------------------------------------------
+
+// DsInsertRequest
+
+// .kvrpcpb.RequestHeader header = 1;
+inline bool DsInsertRequest::has_header() const {
+  return this != internal_default_instance() && header_ != NULL;
 }
-#endif
-inline void Row::set_fields(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  fields_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:kvrpcpb.Row.fields)
+inline void DsInsertRequest::clear_header() {
+  if (GetArenaNoVirtual() == NULL && header_ != NULL) delete header_;
+  header_ = NULL;
 }
-inline void Row::set_fields(const void* value, size_t size) {
-  
-  fields_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:kvrpcpb.Row.fields)
+inline const ::kvrpcpb::RequestHeader& DsInsertRequest::header() const {
+  const ::kvrpcpb::RequestHeader* p = header_;
+  // @@protoc_insertion_point(field_get:kvrpcpb.DsInsertRequest.header)
+  return p != NULL ? *p : *reinterpret_cast<const ::kvrpcpb::RequestHeader*>(
+      &::kvrpcpb::_RequestHeader_default_instance_);
 }
-inline ::std::string* Row::mutable_fields() {
+inline ::kvrpcpb::RequestHeader* DsInsertRequest::mutable_header() {
   
-  // @@protoc_insertion_point(field_mutable:kvrpcpb.Row.fields)
-  return fields_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (header_ == NULL) {
+    header_ = new ::kvrpcpb::RequestHeader;
+  }
+  // @@protoc_insertion_point(field_mutable:kvrpcpb.DsInsertRequest.header)
+  return header_;
 }
-inline ::std::string* Row::release_fields() {
-  // @@protoc_insertion_point(field_release:kvrpcpb.Row.fields)
+inline ::kvrpcpb::RequestHeader* DsInsertRequest::release_header() {
+  // @@protoc_insertion_point(field_release:kvrpcpb.DsInsertRequest.header)
   
-  return fields_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::kvrpcpb::RequestHeader* temp = header_;
+  header_ = NULL;
+  return temp;
 }
-inline void Row::set_allocated_fields(::std::string* fields) {
-  if (fields != NULL) {
+inline void DsInsertRequest::set_allocated_header(::kvrpcpb::RequestHeader* header) {
+  delete header_;
+  header_ = header;
+  if (header) {
     
   } else {
     
   }
-  fields_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), fields);
-  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.Row.fields)
+  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.DsInsertRequest.header)
 }
 
-// repeated int64 aggred_counts = 3;
-inline int Row::aggred_counts_size() const {
-  return aggred_counts_.size();
-}
-inline void Row::clear_aggred_counts() {
-  aggred_counts_.Clear();
+// .kvrpcpb.InsertRequest req = 2;
+inline bool DsInsertRequest::has_req() const {
+  return this != internal_default_instance() && req_ != NULL;
 }
-inline ::google::protobuf::int64 Row::aggred_counts(int index) const {
-  // @@protoc_insertion_point(field_get:kvrpcpb.Row.aggred_counts)
-  return aggred_counts_.Get(index);
+inline void DsInsertRequest::clear_req() {
+  if (GetArenaNoVirtual() == NULL && req_ != NULL) delete req_;
+  req_ = NULL;
 }
-inline void Row::set_aggred_counts(int index, ::google::protobuf::int64 value) {
-  aggred_counts_.Set(index, value);
-  // @@protoc_insertion_point(field_set:kvrpcpb.Row.aggred_counts)
+inline const ::kvrpcpb::InsertRequest& DsInsertRequest::req() const {
+  const ::kvrpcpb::InsertRequest* p = req_;
+  // @@protoc_insertion_point(field_get:kvrpcpb.DsInsertRequest.req)
+  return p != NULL ? *p : *reinterpret_cast<const ::kvrpcpb::InsertRequest*>(
+      &::kvrpcpb::_InsertRequest_default_instance_);
 }
-inline void Row::add_aggred_counts(::google::protobuf::int64 value) {
-  aggred_counts_.Add(value);
-  // @@protoc_insertion_point(field_add:kvrpcpb.Row.aggred_counts)
+inline ::kvrpcpb::InsertRequest* DsInsertRequest::mutable_req() {
+  
+  if (req_ == NULL) {
+    req_ = new ::kvrpcpb::InsertRequest;
+  }
+  // @@protoc_insertion_point(field_mutable:kvrpcpb.DsInsertRequest.req)
+  return req_;
 }
-inline const ::google::protobuf::RepeatedField< ::google::protobuf::int64 >&
-Row::aggred_counts() const {
-  // @@protoc_insertion_point(field_list:kvrpcpb.Row.aggred_counts)
-  return aggred_counts_;
+inline ::kvrpcpb::InsertRequest* DsInsertRequest::release_req() {
+  // @@protoc_insertion_point(field_release:kvrpcpb.DsInsertRequest.req)
+  
+  ::kvrpcpb::InsertRequest* temp = req_;
+  req_ = NULL;
+  return temp;
 }
-inline ::google::protobuf::RepeatedField< ::google::protobuf::int64 >*
-Row::mutable_aggred_counts() {
-  // @@protoc_insertion_point(field_mutable_list:kvrpcpb.Row.aggred_counts)
-  return &aggred_counts_;
+inline void DsInsertRequest::set_allocated_req(::kvrpcpb::InsertRequest* req) {
+  delete req_;
+  req_ = req;
+  if (req) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.DsInsertRequest.req)
 }
 
 // -------------------------------------------------------------------
 
-// DsSelectResponse
+// DsInsertResponse
 
 // .kvrpcpb.ResponseHeader header = 1;
-inline bool DsSelectResponse::has_header() const {
+inline bool DsInsertResponse::has_header() const {
   return this != internal_default_instance() && header_ != NULL;
 }
-inline void DsSelectResponse::clear_header() {
+inline void DsInsertResponse::clear_header() {
   if (GetArenaNoVirtual() == NULL && header_ != NULL) delete header_;
   header_ = NULL;
 }
-inline const ::kvrpcpb::ResponseHeader& DsSelectResponse::header() const {
+inline const ::kvrpcpb::ResponseHeader& DsInsertResponse::header() const {
   const ::kvrpcpb::ResponseHeader* p = header_;
-  // @@protoc_insertion_point(field_get:kvrpcpb.DsSelectResponse.header)
+  // @@protoc_insertion_point(field_get:kvrpcpb.DsInsertResponse.header)
   return p != NULL ? *p : *reinterpret_cast<const ::kvrpcpb::ResponseHeader*>(
       &::kvrpcpb::_ResponseHeader_default_instance_);
 }
-inline ::kvrpcpb::ResponseHeader* DsSelectResponse::mutable_header() {
+inline ::kvrpcpb::ResponseHeader* DsInsertResponse::mutable_header() {
   
   if (header_ == NULL) {
     header_ = new ::kvrpcpb::ResponseHeader;
   }
-  // @@protoc_insertion_point(field_mutable:kvrpcpb.DsSelectResponse.header)
+  // @@protoc_insertion_point(field_mutable:kvrpcpb.DsInsertResponse.header)
   return header_;
 }
-inline ::kvrpcpb::ResponseHeader* DsSelectResponse::release_header() {
-  // @@protoc_insertion_point(field_release:kvrpcpb.DsSelectResponse.header)
+inline ::kvrpcpb::ResponseHeader* DsInsertResponse::release_header() {
+  // @@protoc_insertion_point(field_release:kvrpcpb.DsInsertResponse.header)
   
   ::kvrpcpb::ResponseHeader* temp = header_;
   header_ = NULL;
   return temp;
 }
-inline void DsSelectResponse::set_allocated_header(::kvrpcpb::ResponseHeader* header) {
+inline void DsInsertResponse::set_allocated_header(::kvrpcpb::ResponseHeader* header) {
   delete header_;
   header_ = header;
   if (header) {
@@ -13738,269 +15066,324 @@ inline void DsSelectResponse::set_allocated_header(::kvrpcpb::ResponseHeader* he
   } else {
     
   }
-  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.DsSelectResponse.header)
+  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.DsInsertResponse.header)
 }
 
-// .kvrpcpb.SelectResponse resp = 2;
-inline bool DsSelectResponse::has_resp() const {
+// .kvrpcpb.InsertResponse resp = 2;
+inline bool DsInsertResponse::has_resp() const {
   return this != internal_default_instance() && resp_ != NULL;
 }
-inline void DsSelectResponse::clear_resp() {
+inline void DsInsertResponse::clear_resp() {
   if (GetArenaNoVirtual() == NULL && resp_ != NULL) delete resp_;
   resp_ = NULL;
 }
-inline const ::kvrpcpb::SelectResponse& DsSelectResponse::resp() const {
-  const ::kvrpcpb::SelectResponse* p = resp_;
-  // @@protoc_insertion_point(field_get:kvrpcpb.DsSelectResponse.resp)
-  return p != NULL ? *p : *reinterpret_cast<const ::kvrpcpb::SelectResponse*>(
-      &::kvrpcpb::_SelectResponse_default_instance_);
+inline const ::kvrpcpb::InsertResponse& DsInsertResponse::resp() const {
+  const ::kvrpcpb::InsertResponse* p = resp_;
+  // @@protoc_insertion_point(field_get:kvrpcpb.DsInsertResponse.resp)
+  return p != NULL ? *p : *reinterpret_cast<const ::kvrpcpb::InsertResponse*>(
+      &::kvrpcpb::_InsertResponse_default_instance_);
 }
-inline ::kvrpcpb::SelectResponse* DsSelectResponse::mutable_resp() {
+inline ::kvrpcpb::InsertResponse* DsInsertResponse::mutable_resp() {
   
   if (resp_ == NULL) {
-    resp_ = new ::kvrpcpb::SelectResponse;
+    resp_ = new ::kvrpcpb::InsertResponse;
   }
-  // @@protoc_insertion_point(field_mutable:kvrpcpb.DsSelectResponse.resp)
+  // @@protoc_insertion_point(field_mutable:kvrpcpb.DsInsertResponse.resp)
   return resp_;
 }
-inline ::kvrpcpb::SelectResponse* DsSelectResponse::release_resp() {
-  // @@protoc_insertion_point(field_release:kvrpcpb.DsSelectResponse.resp)
+inline ::kvrpcpb::InsertResponse* DsInsertResponse::release_resp() {
+  // @@protoc_insertion_point(field_release:kvrpcpb.DsInsertResponse.resp)
+  
+  ::kvrpcpb::InsertResponse* temp = resp_;
+  resp_ = NULL;
+  return temp;
+}
+inline void DsInsertResponse::set_allocated_resp(::kvrpcpb::InsertResponse* resp) {
+  delete resp_;
+  resp_ = resp;
+  if (resp) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.DsInsertResponse.resp)
+}
+
+// -------------------------------------------------------------------
+
+// InsertRequest
+
+// repeated .kvrpcpb.KeyValue rows = 1;
+inline int InsertRequest::rows_size() const {
+  return rows_.size();
+}
+inline void InsertRequest::clear_rows() {
+  rows_.Clear();
+}
+inline const ::kvrpcpb::KeyValue& InsertRequest::rows(int index) const {
+  // @@protoc_insertion_point(field_get:kvrpcpb.InsertRequest.rows)
+  return rows_.Get(index);
+}
+inline ::kvrpcpb::KeyValue* InsertRequest::mutable_rows(int index) {
+  // @@protoc_insertion_point(field_mutable:kvrpcpb.InsertRequest.rows)
+  return rows_.Mutable(index);
+}
+inline ::kvrpcpb::KeyValue* InsertRequest::add_rows() {
+  // @@protoc_insertion_point(field_add:kvrpcpb.InsertRequest.rows)
+  return rows_.Add();
+}
+inline ::google::protobuf::RepeatedPtrField< ::kvrpcpb::KeyValue >*
+InsertRequest::mutable_rows() {
+  // @@protoc_insertion_point(field_mutable_list:kvrpcpb.InsertRequest.rows)
+  return &rows_;
+}
+inline const ::google::protobuf::RepeatedPtrField< ::kvrpcpb::KeyValue >&
+InsertRequest::rows() const {
+  // @@protoc_insertion_point(field_list:kvrpcpb.InsertRequest.rows)
+  return rows_;
+}
+
+// bool check_duplicate = 2;
+inline void InsertRequest::clear_check_duplicate() {
+  check_duplicate_ = false;
+}
+inline bool InsertRequest::check_duplicate() const {
+  // @@protoc_insertion_point(field_get:kvrpcpb.InsertRequest.check_duplicate)
+  return check_duplicate_;
+}
+inline void InsertRequest::set_check_duplicate(bool value) {
+  
+  check_duplicate_ = value;
+  // @@protoc_insertion_point(field_set:kvrpcpb.InsertRequest.check_duplicate)
+}
+
+// .timestamp.Timestamp timestamp = 3;
+inline bool InsertRequest::has_timestamp() const {
+  return this != internal_default_instance() && timestamp_ != NULL;
+}
+inline void InsertRequest::clear_timestamp() {
+  if (GetArenaNoVirtual() == NULL && timestamp_ != NULL) delete timestamp_;
+  timestamp_ = NULL;
+}
+inline const ::timestamp::Timestamp& InsertRequest::timestamp() const {
+  const ::timestamp::Timestamp* p = timestamp_;
+  // @@protoc_insertion_point(field_get:kvrpcpb.InsertRequest.timestamp)
+  return p != NULL ? *p : *reinterpret_cast<const ::timestamp::Timestamp*>(
+      &::timestamp::_Timestamp_default_instance_);
+}
+inline ::timestamp::Timestamp* InsertRequest::mutable_timestamp() {
+  
+  if (timestamp_ == NULL) {
+    timestamp_ = new ::timestamp::Timestamp;
+  }
+  // @@protoc_insertion_point(field_mutable:kvrpcpb.InsertRequest.timestamp)
+  return timestamp_;
+}
+inline ::timestamp::Timestamp* InsertRequest::release_timestamp() {
+  // @@protoc_insertion_point(field_release:kvrpcpb.InsertRequest.timestamp)
   
-  ::kvrpcpb::SelectResponse* temp = resp_;
-  resp_ = NULL;
+  ::timestamp::Timestamp* temp = timestamp_;
+  timestamp_ = NULL;
   return temp;
 }
-inline void DsSelectResponse::set_allocated_resp(::kvrpcpb::SelectResponse* resp) {
-  delete resp_;
-  resp_ = resp;
-  if (resp) {
+inline void InsertRequest::set_allocated_timestamp(::timestamp::Timestamp* timestamp) {
+  delete timestamp_;
+  timestamp_ = timestamp;
+  if (timestamp) {
     
   } else {
     
   }
-  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.DsSelectResponse.resp)
+  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.InsertRequest.timestamp)
 }
 
 // -------------------------------------------------------------------
 
-// SelectResponse
+// InsertResponse
 
 // int32 code = 1;
-inline void SelectResponse::clear_code() {
+inline void InsertResponse::clear_code() {
   code_ = 0;
 }
-inline ::google::protobuf::int32 SelectResponse::code() const {
-  // @@protoc_insertion_point(field_get:kvrpcpb.SelectResponse.code)
+inline ::google::protobuf::int32 InsertResponse::code() const {
+  // @@protoc_insertion_point(field_get:kvrpcpb.InsertResponse.code)
   return code_;
 }
-inline void SelectResponse::set_code(::google::protobuf::int32 value) {
+inline void InsertResponse::set_code(::google::protobuf::int32 value) {
   
   code_ = value;
-  // @@protoc_insertion_point(field_set:kvrpcpb.SelectResponse.code)
-}
-
-// repeated .kvrpcpb.Row rows = 2;
-inline int SelectResponse::rows_size() const {
-  return rows_.size();
-}
-inline void SelectResponse::clear_rows() {
-  rows_.Clear();
-}
-inline const ::kvrpcpb::Row& SelectResponse::rows(int index) const {
-  // @@protoc_insertion_point(field_get:kvrpcpb.SelectResponse.rows)
-  return rows_.Get(index);
-}
-inline ::kvrpcpb::Row* SelectResponse::mutable_rows(int index) {
-  // @@protoc_insertion_point(field_mutable:kvrpcpb.SelectResponse.rows)
-  return rows_.Mutable(index);
-}
-inline ::kvrpcpb::Row* SelectResponse::add_rows() {
-  // @@protoc_insertion_point(field_add:kvrpcpb.SelectResponse.rows)
-  return rows_.Add();
-}
-inline ::google::protobuf::RepeatedPtrField< ::kvrpcpb::Row >*
-SelectResponse::mutable_rows() {
-  // @@protoc_insertion_point(field_mutable_list:kvrpcpb.SelectResponse.rows)
-  return &rows_;
-}
-inline const ::google::protobuf::RepeatedPtrField< ::kvrpcpb::Row >&
-SelectResponse::rows() const {
-  // @@protoc_insertion_point(field_list:kvrpcpb.SelectResponse.rows)
-  return rows_;
+  // @@protoc_insertion_point(field_set:kvrpcpb.InsertResponse.code)
 }
 
-// uint64 offset = 3;
-inline void SelectResponse::clear_offset() {
-  offset_ = GOOGLE_ULONGLONG(0);
+// uint64 affected_keys = 2;
+inline void InsertResponse::clear_affected_keys() {
+  affected_keys_ = GOOGLE_ULONGLONG(0);
 }
-inline ::google::protobuf::uint64 SelectResponse::offset() const {
-  // @@protoc_insertion_point(field_get:kvrpcpb.SelectResponse.offset)
-  return offset_;
+inline ::google::protobuf::uint64 InsertResponse::affected_keys() const {
+  // @@protoc_insertion_point(field_get:kvrpcpb.InsertResponse.affected_keys)
+  return affected_keys_;
 }
-inline void SelectResponse::set_offset(::google::protobuf::uint64 value) {
+inline void InsertResponse::set_affected_keys(::google::protobuf::uint64 value) {
   
-  offset_ = value;
-  // @@protoc_insertion_point(field_set:kvrpcpb.SelectResponse.offset)
+  affected_keys_ = value;
+  // @@protoc_insertion_point(field_set:kvrpcpb.InsertResponse.affected_keys)
 }
 
-// -------------------------------------------------------------------
-
-// KeyValue
-
-// bytes Key = 1;
-inline void KeyValue::clear_key() {
-  key_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+// bytes duplicate_key = 3;
+inline void InsertResponse::clear_duplicate_key() {
+  duplicate_key_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline const ::std::string& KeyValue::key() const {
-  // @@protoc_insertion_point(field_get:kvrpcpb.KeyValue.Key)
-  return key_.GetNoArena();
+inline const ::std::string& InsertResponse::duplicate_key() const {
+  // @@protoc_insertion_point(field_get:kvrpcpb.InsertResponse.duplicate_key)
+  return duplicate_key_.GetNoArena();
 }
-inline void KeyValue::set_key(const ::std::string& value) {
+inline void InsertResponse::set_duplicate_key(const ::std::string& value) {
   
-  key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:kvrpcpb.KeyValue.Key)
+  duplicate_key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:kvrpcpb.InsertResponse.duplicate_key)
 }
 #if LANG_CXX11
-inline void KeyValue::set_key(::std::string&& value) {
+inline void InsertResponse::set_duplicate_key(::std::string&& value) {
   
-  key_.SetNoArena(
+  duplicate_key_.SetNoArena(
     &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:kvrpcpb.KeyValue.Key)
+  // @@protoc_insertion_point(field_set_rvalue:kvrpcpb.InsertResponse.duplicate_key)
 }
 #endif
-inline void KeyValue::set_key(const char* value) {
+inline void InsertResponse::set_duplicate_key(const char* value) {
   GOOGLE_DCHECK(value != NULL);
   
-  key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:kvrpcpb.KeyValue.Key)
+  duplicate_key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:kvrpcpb.InsertResponse.duplicate_key)
 }
-inline void KeyValue::set_key(const void* value, size_t size) {
+inline void InsertResponse::set_duplicate_key(const void* value, size_t size) {
   
-  key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+  duplicate_key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
       ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:kvrpcpb.KeyValue.Key)
+  // @@protoc_insertion_point(field_set_pointer:kvrpcpb.InsertResponse.duplicate_key)
 }
-inline ::std::string* KeyValue::mutable_key() {
+inline ::std::string* InsertResponse::mutable_duplicate_key() {
   
-  // @@protoc_insertion_point(field_mutable:kvrpcpb.KeyValue.Key)
-  return key_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  // @@protoc_insertion_point(field_mutable:kvrpcpb.InsertResponse.duplicate_key)
+  return duplicate_key_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline ::std::string* KeyValue::release_key() {
-  // @@protoc_insertion_point(field_release:kvrpcpb.KeyValue.Key)
+inline ::std::string* InsertResponse::release_duplicate_key() {
+  // @@protoc_insertion_point(field_release:kvrpcpb.InsertResponse.duplicate_key)
   
-  return key_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return duplicate_key_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline void KeyValue::set_allocated_key(::std::string* key) {
-  if (key != NULL) {
+inline void InsertResponse::set_allocated_duplicate_key(::std::string* duplicate_key) {
+  if (duplicate_key != NULL) {
     
   } else {
     
   }
-  key_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), key);
-  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.KeyValue.Key)
+  duplicate_key_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), duplicate_key);
+  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.InsertResponse.duplicate_key)
 }
 
-// bytes Value = 2;
-inline void KeyValue::clear_value() {
-  value_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+// -------------------------------------------------------------------
+
+// BatchInsertRequest
+
+// repeated .kvrpcpb.InsertRequest reqs = 1;
+inline int BatchInsertRequest::reqs_size() const {
+  return reqs_.size();
 }
-inline const ::std::string& KeyValue::value() const {
-  // @@protoc_insertion_point(field_get:kvrpcpb.KeyValue.Value)
-  return value_.GetNoArena();
+inline void BatchInsertRequest::clear_reqs() {
+  reqs_.Clear();
 }
-inline void KeyValue::set_value(const ::std::string& value) {
-  
-  value_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:kvrpcpb.KeyValue.Value)
+inline const ::kvrpcpb::InsertRequest& BatchInsertRequest::reqs(int index) const {
+  // @@protoc_insertion_point(field_get:kvrpcpb.BatchInsertRequest.reqs)
+  return reqs_.Get(index);
 }
-#if LANG_CXX11
-inline void KeyValue::set_value(::std::string&& value) {
-  
-  value_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:kvrpcpb.KeyValue.Value)
+inline ::kvrpcpb::InsertRequest* BatchInsertRequest::mutable_reqs(int index) {
+  // @@protoc_insertion_point(field_mutable:kvrpcpb.BatchInsertRequest.reqs)
+  return reqs_.Mutable(index);
 }
-#endif
-inline void KeyValue::set_value(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  value_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:kvrpcpb.KeyValue.Value)
+inline ::kvrpcpb::InsertRequest* BatchInsertRequest::add_reqs() {
+  // @@protoc_insertion_point(field_add:kvrpcpb.BatchInsertRequest.reqs)
+  return reqs_.Add();
 }
-inline void KeyValue::set_value(const void* value, size_t size) {
-  
-  value_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:kvrpcpb.KeyValue.Value)
+inline ::google::protobuf::RepeatedPtrField< ::kvrpcpb::InsertRequest >*
+BatchInsertRequest::mutable_reqs() {
+  // @@protoc_insertion_point(field_mutable_list:kvrpcpb.BatchInsertRequest.reqs)
+  return &reqs_;
 }
-inline ::std::string* KeyValue::mutable_value() {
-  
-  // @@protoc_insertion_point(field_mutable:kvrpcpb.KeyValue.Value)
-  return value_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline const ::google::protobuf::RepeatedPtrField< ::kvrpcpb::InsertRequest >&
+BatchInsertRequest::reqs() const {
+  // @@protoc_insertion_point(field_list:kvrpcpb.BatchInsertRequest.reqs)
+  return reqs_;
 }
-inline ::std::string* KeyValue::release_value() {
-  // @@protoc_insertion_point(field_release:kvrpcpb.KeyValue.Value)
-  
-  return value_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+
+// -------------------------------------------------------------------
+
+// BatchInsertResponse
+
+// repeated .kvrpcpb.InsertResponse resps = 2;
+inline int BatchInsertResponse::resps_size() const {
+  return resps_.size();
 }
-inline void KeyValue::set_allocated_value(::std::string* value) {
-  if (value != NULL) {
-    
-  } else {
-    
-  }
-  value_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.KeyValue.Value)
+inline void BatchInsertResponse::clear_resps() {
+  resps_.Clear();
 }
-
-// int64 ExpireAt = 3;
-inline void KeyValue::clear_expireat() {
-  expireat_ = GOOGLE_LONGLONG(0);
+inline const ::kvrpcpb::InsertResponse& BatchInsertResponse::resps(int index) const {
+  // @@protoc_insertion_point(field_get:kvrpcpb.BatchInsertResponse.resps)
+  return resps_.Get(index);
 }
-inline ::google::protobuf::int64 KeyValue::expireat() const {
-  // @@protoc_insertion_point(field_get:kvrpcpb.KeyValue.ExpireAt)
-  return expireat_;
+inline ::kvrpcpb::InsertResponse* BatchInsertResponse::mutable_resps(int index) {
+  // @@protoc_insertion_point(field_mutable:kvrpcpb.BatchInsertResponse.resps)
+  return resps_.Mutable(index);
 }
-inline void KeyValue::set_expireat(::google::protobuf::int64 value) {
-  
-  expireat_ = value;
-  // @@protoc_insertion_point(field_set:kvrpcpb.KeyValue.ExpireAt)
+inline ::kvrpcpb::InsertResponse* BatchInsertResponse::add_resps() {
+  // @@protoc_insertion_point(field_add:kvrpcpb.BatchInsertResponse.resps)
+  return resps_.Add();
+}
+inline ::google::protobuf::RepeatedPtrField< ::kvrpcpb::InsertResponse >*
+BatchInsertResponse::mutable_resps() {
+  // @@protoc_insertion_point(field_mutable_list:kvrpcpb.BatchInsertResponse.resps)
+  return &resps_;
+}
+inline const ::google::protobuf::RepeatedPtrField< ::kvrpcpb::InsertResponse >&
+BatchInsertResponse::resps() const {
+  // @@protoc_insertion_point(field_list:kvrpcpb.BatchInsertResponse.resps)
+  return resps_;
 }
 
 // -------------------------------------------------------------------
 
-// DsInsertRequest
+// DsDeleteRequest
 
 // .kvrpcpb.RequestHeader header = 1;
-inline bool DsInsertRequest::has_header() const {
+inline bool DsDeleteRequest::has_header() const {
   return this != internal_default_instance() && header_ != NULL;
 }
-inline void DsInsertRequest::clear_header() {
+inline void DsDeleteRequest::clear_header() {
   if (GetArenaNoVirtual() == NULL && header_ != NULL) delete header_;
   header_ = NULL;
 }
-inline const ::kvrpcpb::RequestHeader& DsInsertRequest::header() const {
+inline const ::kvrpcpb::RequestHeader& DsDeleteRequest::header() const {
   const ::kvrpcpb::RequestHeader* p = header_;
-  // @@protoc_insertion_point(field_get:kvrpcpb.DsInsertRequest.header)
+  // @@protoc_insertion_point(field_get:kvrpcpb.DsDeleteRequest.header)
   return p != NULL ? *p : *reinterpret_cast<const ::kvrpcpb::RequestHeader*>(
       &::kvrpcpb::_RequestHeader_default_instance_);
 }
-inline ::kvrpcpb::RequestHeader* DsInsertRequest::mutable_header() {
+inline ::kvrpcpb::RequestHeader* DsDeleteRequest::mutable_header() {
   
   if (header_ == NULL) {
     header_ = new ::kvrpcpb::RequestHeader;
   }
-  // @@protoc_insertion_point(field_mutable:kvrpcpb.DsInsertRequest.header)
+  // @@protoc_insertion_point(field_mutable:kvrpcpb.DsDeleteRequest.header)
   return header_;
 }
-inline ::kvrpcpb::RequestHeader* DsInsertRequest::release_header() {
-  // @@protoc_insertion_point(field_release:kvrpcpb.DsInsertRequest.header)
+inline ::kvrpcpb::RequestHeader* DsDeleteRequest::release_header() {
+  // @@protoc_insertion_point(field_release:kvrpcpb.DsDeleteRequest.header)
   
   ::kvrpcpb::RequestHeader* temp = header_;
   header_ = NULL;
   return temp;
 }
-inline void DsInsertRequest::set_allocated_header(::kvrpcpb::RequestHeader* header) {
+inline void DsDeleteRequest::set_allocated_header(::kvrpcpb::RequestHeader* header) {
   delete header_;
   header_ = header;
   if (header) {
@@ -14008,39 +15391,39 @@ inline void DsInsertRequest::set_allocated_header(::kvrpcpb::RequestHeader* head
   } else {
     
   }
-  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.DsInsertRequest.header)
+  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.DsDeleteRequest.header)
 }
 
-// .kvrpcpb.InsertRequest req = 2;
-inline bool DsInsertRequest::has_req() const {
+// .kvrpcpb.DeleteRequest req = 2;
+inline bool DsDeleteRequest::has_req() const {
   return this != internal_default_instance() && req_ != NULL;
 }
-inline void DsInsertRequest::clear_req() {
+inline void DsDeleteRequest::clear_req() {
   if (GetArenaNoVirtual() == NULL && req_ != NULL) delete req_;
   req_ = NULL;
 }
-inline const ::kvrpcpb::InsertRequest& DsInsertRequest::req() const {
-  const ::kvrpcpb::InsertRequest* p = req_;
-  // @@protoc_insertion_point(field_get:kvrpcpb.DsInsertRequest.req)
-  return p != NULL ? *p : *reinterpret_cast<const ::kvrpcpb::InsertRequest*>(
-      &::kvrpcpb::_InsertRequest_default_instance_);
+inline const ::kvrpcpb::DeleteRequest& DsDeleteRequest::req() const {
+  const ::kvrpcpb::DeleteRequest* p = req_;
+  // @@protoc_insertion_point(field_get:kvrpcpb.DsDeleteRequest.req)
+  return p != NULL ? *p : *reinterpret_cast<const ::kvrpcpb::DeleteRequest*>(
+      &::kvrpcpb::_DeleteRequest_default_instance_);
 }
-inline ::kvrpcpb::InsertRequest* DsInsertRequest::mutable_req() {
+inline ::kvrpcpb::DeleteRequest* DsDeleteRequest::mutable_req() {
   
   if (req_ == NULL) {
-    req_ = new ::kvrpcpb::InsertRequest;
+    req_ = new ::kvrpcpb::DeleteRequest;
   }
-  // @@protoc_insertion_point(field_mutable:kvrpcpb.DsInsertRequest.req)
+  // @@protoc_insertion_point(field_mutable:kvrpcpb.DsDeleteRequest.req)
   return req_;
 }
-inline ::kvrpcpb::InsertRequest* DsInsertRequest::release_req() {
-  // @@protoc_insertion_point(field_release:kvrpcpb.DsInsertRequest.req)
+inline ::kvrpcpb::DeleteRequest* DsDeleteRequest::release_req() {
+  // @@protoc_insertion_point(field_release:kvrpcpb.DsDeleteRequest.req)
   
-  ::kvrpcpb::InsertRequest* temp = req_;
+  ::kvrpcpb::DeleteRequest* temp = req_;
   req_ = NULL;
   return temp;
 }
-inline void DsInsertRequest::set_allocated_req(::kvrpcpb::InsertRequest* req) {
+inline void DsDeleteRequest::set_allocated_req(::kvrpcpb::DeleteRequest* req) {
   delete req_;
   req_ = req;
   if (req) {
@@ -14048,43 +15431,43 @@ inline void DsInsertRequest::set_allocated_req(::kvrpcpb::InsertRequest* req) {
   } else {
     
   }
-  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.DsInsertRequest.req)
+  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.DsDeleteRequest.req)
 }
 
 // -------------------------------------------------------------------
 
-// DsInsertResponse
+// DsDeleteResponse
 
 // .kvrpcpb.ResponseHeader header = 1;
-inline bool DsInsertResponse::has_header() const {
+inline bool DsDeleteResponse::has_header() const {
   return this != internal_default_instance() && header_ != NULL;
 }
-inline void DsInsertResponse::clear_header() {
+inline void DsDeleteResponse::clear_header() {
   if (GetArenaNoVirtual() == NULL && header_ != NULL) delete header_;
   header_ = NULL;
 }
-inline const ::kvrpcpb::ResponseHeader& DsInsertResponse::header() const {
+inline const ::kvrpcpb::ResponseHeader& DsDeleteResponse::header() const {
   const ::kvrpcpb::ResponseHeader* p = header_;
-  // @@protoc_insertion_point(field_get:kvrpcpb.DsInsertResponse.header)
+  // @@protoc_insertion_point(field_get:kvrpcpb.DsDeleteResponse.header)
   return p != NULL ? *p : *reinterpret_cast<const ::kvrpcpb::ResponseHeader*>(
       &::kvrpcpb::_ResponseHeader_default_instance_);
 }
-inline ::kvrpcpb::ResponseHeader* DsInsertResponse::mutable_header() {
+inline ::kvrpcpb::ResponseHeader* DsDeleteResponse::mutable_header() {
   
   if (header_ == NULL) {
     header_ = new ::kvrpcpb::ResponseHeader;
   }
-  // @@protoc_insertion_point(field_mutable:kvrpcpb.DsInsertResponse.header)
+  // @@protoc_insertion_point(field_mutable:kvrpcpb.DsDeleteResponse.header)
   return header_;
 }
-inline ::kvrpcpb::ResponseHeader* DsInsertResponse::release_header() {
-  // @@protoc_insertion_point(field_release:kvrpcpb.DsInsertResponse.header)
+inline ::kvrpcpb::ResponseHeader* DsDeleteResponse::release_header() {
+  // @@protoc_insertion_point(field_release:kvrpcpb.DsDeleteResponse.header)
   
   ::kvrpcpb::ResponseHeader* temp = header_;
   header_ = NULL;
   return temp;
 }
-inline void DsInsertResponse::set_allocated_header(::kvrpcpb::ResponseHeader* header) {
+inline void DsDeleteResponse::set_allocated_header(::kvrpcpb::ResponseHeader* header) {
   delete header_;
   header_ = header;
   if (header) {
@@ -14092,39 +15475,39 @@ inline void DsInsertResponse::set_allocated_header(::kvrpcpb::ResponseHeader* he
   } else {
     
   }
-  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.DsInsertResponse.header)
+  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.DsDeleteResponse.header)
 }
 
-// .kvrpcpb.InsertResponse resp = 2;
-inline bool DsInsertResponse::has_resp() const {
+// .kvrpcpb.DeleteResponse resp = 2;
+inline bool DsDeleteResponse::has_resp() const {
   return this != internal_default_instance() && resp_ != NULL;
 }
-inline void DsInsertResponse::clear_resp() {
+inline void DsDeleteResponse::clear_resp() {
   if (GetArenaNoVirtual() == NULL && resp_ != NULL) delete resp_;
   resp_ = NULL;
 }
-inline const ::kvrpcpb::InsertResponse& DsInsertResponse::resp() const {
-  const ::kvrpcpb::InsertResponse* p = resp_;
-  // @@protoc_insertion_point(field_get:kvrpcpb.DsInsertResponse.resp)
-  return p != NULL ? *p : *reinterpret_cast<const ::kvrpcpb::InsertResponse*>(
-      &::kvrpcpb::_InsertResponse_default_instance_);
+inline const ::kvrpcpb::DeleteResponse& DsDeleteResponse::resp() const {
+  const ::kvrpcpb::DeleteResponse* p = resp_;
+  // @@protoc_insertion_point(field_get:kvrpcpb.DsDeleteResponse.resp)
+  return p != NULL ? *p : *reinterpret_cast<const ::kvrpcpb::DeleteResponse*>(
+      &::kvrpcpb::_DeleteResponse_default_instance_);
 }
-inline ::kvrpcpb::InsertResponse* DsInsertResponse::mutable_resp() {
+inline ::kvrpcpb::DeleteResponse* DsDeleteResponse::mutable_resp() {
   
   if (resp_ == NULL) {
-    resp_ = new ::kvrpcpb::InsertResponse;
+    resp_ = new ::kvrpcpb::DeleteResponse;
   }
-  // @@protoc_insertion_point(field_mutable:kvrpcpb.DsInsertResponse.resp)
+  // @@protoc_insertion_point(field_mutable:kvrpcpb.DsDeleteResponse.resp)
   return resp_;
 }
-inline ::kvrpcpb::InsertResponse* DsInsertResponse::release_resp() {
-  // @@protoc_insertion_point(field_release:kvrpcpb.DsInsertResponse.resp)
+inline ::kvrpcpb::DeleteResponse* DsDeleteResponse::release_resp() {
+  // @@protoc_insertion_point(field_release:kvrpcpb.DsDeleteResponse.resp)
   
-  ::kvrpcpb::InsertResponse* temp = resp_;
+  ::kvrpcpb::DeleteResponse* temp = resp_;
   resp_ = NULL;
   return temp;
 }
-inline void DsInsertResponse::set_allocated_resp(::kvrpcpb::InsertResponse* resp) {
+inline void DsDeleteResponse::set_allocated_resp(::kvrpcpb::DeleteResponse* resp) {
   delete resp_;
   resp_ = resp;
   if (resp) {
@@ -14132,87 +15515,196 @@ inline void DsInsertResponse::set_allocated_resp(::kvrpcpb::InsertResponse* resp
   } else {
     
   }
-  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.DsInsertResponse.resp)
+  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.DsDeleteResponse.resp)
 }
 
 // -------------------------------------------------------------------
 
-// InsertRequest
+// DeleteRequest
 
-// repeated .kvrpcpb.KeyValue rows = 1;
-inline int InsertRequest::rows_size() const {
-  return rows_.size();
+// bytes key = 1;
+inline void DeleteRequest::clear_key() {
+  key_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline void InsertRequest::clear_rows() {
-  rows_.Clear();
+inline const ::std::string& DeleteRequest::key() const {
+  // @@protoc_insertion_point(field_get:kvrpcpb.DeleteRequest.key)
+  return key_.GetNoArena();
 }
-inline const ::kvrpcpb::KeyValue& InsertRequest::rows(int index) const {
-  // @@protoc_insertion_point(field_get:kvrpcpb.InsertRequest.rows)
-  return rows_.Get(index);
+inline void DeleteRequest::set_key(const ::std::string& value) {
+  
+  key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:kvrpcpb.DeleteRequest.key)
 }
-inline ::kvrpcpb::KeyValue* InsertRequest::mutable_rows(int index) {
-  // @@protoc_insertion_point(field_mutable:kvrpcpb.InsertRequest.rows)
-  return rows_.Mutable(index);
+#if LANG_CXX11
+inline void DeleteRequest::set_key(::std::string&& value) {
+  
+  key_.SetNoArena(
+    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:kvrpcpb.DeleteRequest.key)
 }
-inline ::kvrpcpb::KeyValue* InsertRequest::add_rows() {
-  // @@protoc_insertion_point(field_add:kvrpcpb.InsertRequest.rows)
-  return rows_.Add();
+#endif
+inline void DeleteRequest::set_key(const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  
+  key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:kvrpcpb.DeleteRequest.key)
 }
-inline ::google::protobuf::RepeatedPtrField< ::kvrpcpb::KeyValue >*
-InsertRequest::mutable_rows() {
-  // @@protoc_insertion_point(field_mutable_list:kvrpcpb.InsertRequest.rows)
-  return &rows_;
+inline void DeleteRequest::set_key(const void* value, size_t size) {
+  
+  key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:kvrpcpb.DeleteRequest.key)
 }
-inline const ::google::protobuf::RepeatedPtrField< ::kvrpcpb::KeyValue >&
-InsertRequest::rows() const {
-  // @@protoc_insertion_point(field_list:kvrpcpb.InsertRequest.rows)
-  return rows_;
+inline ::std::string* DeleteRequest::mutable_key() {
+  
+  // @@protoc_insertion_point(field_mutable:kvrpcpb.DeleteRequest.key)
+  return key_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline ::std::string* DeleteRequest::release_key() {
+  // @@protoc_insertion_point(field_release:kvrpcpb.DeleteRequest.key)
+  
+  return key_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline void DeleteRequest::set_allocated_key(::std::string* key) {
+  if (key != NULL) {
+    
+  } else {
+    
+  }
+  key_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), key);
+  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.DeleteRequest.key)
 }
 
-// bool check_duplicate = 2;
-inline void InsertRequest::clear_check_duplicate() {
-  check_duplicate_ = false;
+// .kvrpcpb.Scope scope = 2;
+inline bool DeleteRequest::has_scope() const {
+  return this != internal_default_instance() && scope_ != NULL;
+}
+inline void DeleteRequest::clear_scope() {
+  if (GetArenaNoVirtual() == NULL && scope_ != NULL) delete scope_;
+  scope_ = NULL;
+}
+inline const ::kvrpcpb::Scope& DeleteRequest::scope() const {
+  const ::kvrpcpb::Scope* p = scope_;
+  // @@protoc_insertion_point(field_get:kvrpcpb.DeleteRequest.scope)
+  return p != NULL ? *p : *reinterpret_cast<const ::kvrpcpb::Scope*>(
+      &::kvrpcpb::_Scope_default_instance_);
+}
+inline ::kvrpcpb::Scope* DeleteRequest::mutable_scope() {
+  
+  if (scope_ == NULL) {
+    scope_ = new ::kvrpcpb::Scope;
+  }
+  // @@protoc_insertion_point(field_mutable:kvrpcpb.DeleteRequest.scope)
+  return scope_;
+}
+inline ::kvrpcpb::Scope* DeleteRequest::release_scope() {
+  // @@protoc_insertion_point(field_release:kvrpcpb.DeleteRequest.scope)
+  
+  ::kvrpcpb::Scope* temp = scope_;
+  scope_ = NULL;
+  return temp;
+}
+inline void DeleteRequest::set_allocated_scope(::kvrpcpb::Scope* scope) {
+  delete scope_;
+  scope_ = scope;
+  if (scope) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.DeleteRequest.scope)
+}
+
+// repeated .kvrpcpb.Match where_filters = 3;
+inline int DeleteRequest::where_filters_size() const {
+  return where_filters_.size();
+}
+inline void DeleteRequest::clear_where_filters() {
+  where_filters_.Clear();
+}
+inline const ::kvrpcpb::Match& DeleteRequest::where_filters(int index) const {
+  // @@protoc_insertion_point(field_get:kvrpcpb.DeleteRequest.where_filters)
+  return where_filters_.Get(index);
+}
+inline ::kvrpcpb::Match* DeleteRequest::mutable_where_filters(int index) {
+  // @@protoc_insertion_point(field_mutable:kvrpcpb.DeleteRequest.where_filters)
+  return where_filters_.Mutable(index);
+}
+inline ::kvrpcpb::Match* DeleteRequest::add_where_filters() {
+  // @@protoc_insertion_point(field_add:kvrpcpb.DeleteRequest.where_filters)
+  return where_filters_.Add();
+}
+inline ::google::protobuf::RepeatedPtrField< ::kvrpcpb::Match >*
+DeleteRequest::mutable_where_filters() {
+  // @@protoc_insertion_point(field_mutable_list:kvrpcpb.DeleteRequest.where_filters)
+  return &where_filters_;
+}
+inline const ::google::protobuf::RepeatedPtrField< ::kvrpcpb::Match >&
+DeleteRequest::where_filters() const {
+  // @@protoc_insertion_point(field_list:kvrpcpb.DeleteRequest.where_filters)
+  return where_filters_;
+}
+
+// repeated uint64 indexs = 4;
+inline int DeleteRequest::indexs_size() const {
+  return indexs_.size();
+}
+inline void DeleteRequest::clear_indexs() {
+  indexs_.Clear();
+}
+inline ::google::protobuf::uint64 DeleteRequest::indexs(int index) const {
+  // @@protoc_insertion_point(field_get:kvrpcpb.DeleteRequest.indexs)
+  return indexs_.Get(index);
+}
+inline void DeleteRequest::set_indexs(int index, ::google::protobuf::uint64 value) {
+  indexs_.Set(index, value);
+  // @@protoc_insertion_point(field_set:kvrpcpb.DeleteRequest.indexs)
+}
+inline void DeleteRequest::add_indexs(::google::protobuf::uint64 value) {
+  indexs_.Add(value);
+  // @@protoc_insertion_point(field_add:kvrpcpb.DeleteRequest.indexs)
 }
-inline bool InsertRequest::check_duplicate() const {
-  // @@protoc_insertion_point(field_get:kvrpcpb.InsertRequest.check_duplicate)
-  return check_duplicate_;
+inline const ::google::protobuf::RepeatedField< ::google::protobuf::uint64 >&
+DeleteRequest::indexs() const {
+  // @@protoc_insertion_point(field_list:kvrpcpb.DeleteRequest.indexs)
+  return indexs_;
 }
-inline void InsertRequest::set_check_duplicate(bool value) {
-  
-  check_duplicate_ = value;
-  // @@protoc_insertion_point(field_set:kvrpcpb.InsertRequest.check_duplicate)
+inline ::google::protobuf::RepeatedField< ::google::protobuf::uint64 >*
+DeleteRequest::mutable_indexs() {
+  // @@protoc_insertion_point(field_mutable_list:kvrpcpb.DeleteRequest.indexs)
+  return &indexs_;
 }
 
-// .timestamp.Timestamp timestamp = 3;
-inline bool InsertRequest::has_timestamp() const {
+// .timestamp.Timestamp timestamp = 10;
+inline bool DeleteRequest::has_timestamp() const {
   return this != internal_default_instance() && timestamp_ != NULL;
 }
-inline void InsertRequest::clear_timestamp() {
+inline void DeleteRequest::clear_timestamp() {
   if (GetArenaNoVirtual() == NULL && timestamp_ != NULL) delete timestamp_;
   timestamp_ = NULL;
 }
-inline const ::timestamp::Timestamp& InsertRequest::timestamp() const {
+inline const ::timestamp::Timestamp& DeleteRequest::timestamp() const {
   const ::timestamp::Timestamp* p = timestamp_;
-  // @@protoc_insertion_point(field_get:kvrpcpb.InsertRequest.timestamp)
+  // @@protoc_insertion_point(field_get:kvrpcpb.DeleteRequest.timestamp)
   return p != NULL ? *p : *reinterpret_cast<const ::timestamp::Timestamp*>(
       &::timestamp::_Timestamp_default_instance_);
 }
-inline ::timestamp::Timestamp* InsertRequest::mutable_timestamp() {
+inline ::timestamp::Timestamp* DeleteRequest::mutable_timestamp() {
   
   if (timestamp_ == NULL) {
     timestamp_ = new ::timestamp::Timestamp;
   }
-  // @@protoc_insertion_point(field_mutable:kvrpcpb.InsertRequest.timestamp)
+  // @@protoc_insertion_point(field_mutable:kvrpcpb.DeleteRequest.timestamp)
   return timestamp_;
 }
-inline ::timestamp::Timestamp* InsertRequest::release_timestamp() {
-  // @@protoc_insertion_point(field_release:kvrpcpb.InsertRequest.timestamp)
+inline ::timestamp::Timestamp* DeleteRequest::release_timestamp() {
+  // @@protoc_insertion_point(field_release:kvrpcpb.DeleteRequest.timestamp)
   
   ::timestamp::Timestamp* temp = timestamp_;
   timestamp_ = NULL;
   return temp;
 }
-inline void InsertRequest::set_allocated_timestamp(::timestamp::Timestamp* timestamp) {
+inline void DeleteRequest::set_allocated_timestamp(::timestamp::Timestamp* timestamp) {
   delete timestamp_;
   timestamp_ = timestamp;
   if (timestamp) {
@@ -14220,1002 +15712,1028 @@ inline void InsertRequest::set_allocated_timestamp(::timestamp::Timestamp* times
   } else {
     
   }
-  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.InsertRequest.timestamp)
+  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.DeleteRequest.timestamp)
 }
 
 // -------------------------------------------------------------------
 
-// InsertResponse
+// DeleteResponse
 
 // int32 code = 1;
-inline void InsertResponse::clear_code() {
+inline void DeleteResponse::clear_code() {
   code_ = 0;
 }
-inline ::google::protobuf::int32 InsertResponse::code() const {
-  // @@protoc_insertion_point(field_get:kvrpcpb.InsertResponse.code)
+inline ::google::protobuf::int32 DeleteResponse::code() const {
+  // @@protoc_insertion_point(field_get:kvrpcpb.DeleteResponse.code)
   return code_;
 }
-inline void InsertResponse::set_code(::google::protobuf::int32 value) {
+inline void DeleteResponse::set_code(::google::protobuf::int32 value) {
   
   code_ = value;
-  // @@protoc_insertion_point(field_set:kvrpcpb.InsertResponse.code)
+  // @@protoc_insertion_point(field_set:kvrpcpb.DeleteResponse.code)
 }
 
 // uint64 affected_keys = 2;
-inline void InsertResponse::clear_affected_keys() {
+inline void DeleteResponse::clear_affected_keys() {
   affected_keys_ = GOOGLE_ULONGLONG(0);
 }
-inline ::google::protobuf::uint64 InsertResponse::affected_keys() const {
-  // @@protoc_insertion_point(field_get:kvrpcpb.InsertResponse.affected_keys)
+inline ::google::protobuf::uint64 DeleteResponse::affected_keys() const {
+  // @@protoc_insertion_point(field_get:kvrpcpb.DeleteResponse.affected_keys)
   return affected_keys_;
 }
-inline void InsertResponse::set_affected_keys(::google::protobuf::uint64 value) {
+inline void DeleteResponse::set_affected_keys(::google::protobuf::uint64 value) {
   
   affected_keys_ = value;
-  // @@protoc_insertion_point(field_set:kvrpcpb.InsertResponse.affected_keys)
-}
-
-// bytes duplicate_key = 3;
-inline void InsertResponse::clear_duplicate_key() {
-  duplicate_key_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-inline const ::std::string& InsertResponse::duplicate_key() const {
-  // @@protoc_insertion_point(field_get:kvrpcpb.InsertResponse.duplicate_key)
-  return duplicate_key_.GetNoArena();
-}
-inline void InsertResponse::set_duplicate_key(const ::std::string& value) {
-  
-  duplicate_key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:kvrpcpb.InsertResponse.duplicate_key)
-}
-#if LANG_CXX11
-inline void InsertResponse::set_duplicate_key(::std::string&& value) {
-  
-  duplicate_key_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:kvrpcpb.InsertResponse.duplicate_key)
-}
-#endif
-inline void InsertResponse::set_duplicate_key(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  duplicate_key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:kvrpcpb.InsertResponse.duplicate_key)
-}
-inline void InsertResponse::set_duplicate_key(const void* value, size_t size) {
-  
-  duplicate_key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:kvrpcpb.InsertResponse.duplicate_key)
-}
-inline ::std::string* InsertResponse::mutable_duplicate_key() {
-  
-  // @@protoc_insertion_point(field_mutable:kvrpcpb.InsertResponse.duplicate_key)
-  return duplicate_key_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-inline ::std::string* InsertResponse::release_duplicate_key() {
-  // @@protoc_insertion_point(field_release:kvrpcpb.InsertResponse.duplicate_key)
-  
-  return duplicate_key_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-inline void InsertResponse::set_allocated_duplicate_key(::std::string* duplicate_key) {
-  if (duplicate_key != NULL) {
-    
-  } else {
-    
-  }
-  duplicate_key_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), duplicate_key);
-  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.InsertResponse.duplicate_key)
-}
-
-// -------------------------------------------------------------------
-
-// BatchInsertRequest
-
-// repeated .kvrpcpb.InsertRequest reqs = 1;
-inline int BatchInsertRequest::reqs_size() const {
-  return reqs_.size();
-}
-inline void BatchInsertRequest::clear_reqs() {
-  reqs_.Clear();
-}
-inline const ::kvrpcpb::InsertRequest& BatchInsertRequest::reqs(int index) const {
-  // @@protoc_insertion_point(field_get:kvrpcpb.BatchInsertRequest.reqs)
-  return reqs_.Get(index);
-}
-inline ::kvrpcpb::InsertRequest* BatchInsertRequest::mutable_reqs(int index) {
-  // @@protoc_insertion_point(field_mutable:kvrpcpb.BatchInsertRequest.reqs)
-  return reqs_.Mutable(index);
-}
-inline ::kvrpcpb::InsertRequest* BatchInsertRequest::add_reqs() {
-  // @@protoc_insertion_point(field_add:kvrpcpb.BatchInsertRequest.reqs)
-  return reqs_.Add();
-}
-inline ::google::protobuf::RepeatedPtrField< ::kvrpcpb::InsertRequest >*
-BatchInsertRequest::mutable_reqs() {
-  // @@protoc_insertion_point(field_mutable_list:kvrpcpb.BatchInsertRequest.reqs)
-  return &reqs_;
-}
-inline const ::google::protobuf::RepeatedPtrField< ::kvrpcpb::InsertRequest >&
-BatchInsertRequest::reqs() const {
-  // @@protoc_insertion_point(field_list:kvrpcpb.BatchInsertRequest.reqs)
-  return reqs_;
+  // @@protoc_insertion_point(field_set:kvrpcpb.DeleteResponse.affected_keys)
 }
 
 // -------------------------------------------------------------------
 
-// BatchInsertResponse
+// Field
 
-// repeated .kvrpcpb.InsertResponse resps = 2;
-inline int BatchInsertResponse::resps_size() const {
-  return resps_.size();
-}
-inline void BatchInsertResponse::clear_resps() {
-  resps_.Clear();
-}
-inline const ::kvrpcpb::InsertResponse& BatchInsertResponse::resps(int index) const {
-  // @@protoc_insertion_point(field_get:kvrpcpb.BatchInsertResponse.resps)
-  return resps_.Get(index);
-}
-inline ::kvrpcpb::InsertResponse* BatchInsertResponse::mutable_resps(int index) {
-  // @@protoc_insertion_point(field_mutable:kvrpcpb.BatchInsertResponse.resps)
-  return resps_.Mutable(index);
-}
-inline ::kvrpcpb::InsertResponse* BatchInsertResponse::add_resps() {
-  // @@protoc_insertion_point(field_add:kvrpcpb.BatchInsertResponse.resps)
-  return resps_.Add();
+// uint64 column_id = 1;
+inline void Field::clear_column_id() {
+  column_id_ = GOOGLE_ULONGLONG(0);
 }
-inline ::google::protobuf::RepeatedPtrField< ::kvrpcpb::InsertResponse >*
-BatchInsertResponse::mutable_resps() {
-  // @@protoc_insertion_point(field_mutable_list:kvrpcpb.BatchInsertResponse.resps)
-  return &resps_;
+inline ::google::protobuf::uint64 Field::column_id() const {
+  // @@protoc_insertion_point(field_get:kvrpcpb.Field.column_id)
+  return column_id_;
 }
-inline const ::google::protobuf::RepeatedPtrField< ::kvrpcpb::InsertResponse >&
-BatchInsertResponse::resps() const {
-  // @@protoc_insertion_point(field_list:kvrpcpb.BatchInsertResponse.resps)
-  return resps_;
+inline void Field::set_column_id(::google::protobuf::uint64 value) {
+  
+  column_id_ = value;
+  // @@protoc_insertion_point(field_set:kvrpcpb.Field.column_id)
 }
 
-// -------------------------------------------------------------------
-
-// DsDeleteRequest
-
-// .kvrpcpb.RequestHeader header = 1;
-inline bool DsDeleteRequest::has_header() const {
-  return this != internal_default_instance() && header_ != NULL;
-}
-inline void DsDeleteRequest::clear_header() {
-  if (GetArenaNoVirtual() == NULL && header_ != NULL) delete header_;
-  header_ = NULL;
+// bytes value = 2;
+inline void Field::clear_value() {
+  value_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline const ::kvrpcpb::RequestHeader& DsDeleteRequest::header() const {
-  const ::kvrpcpb::RequestHeader* p = header_;
-  // @@protoc_insertion_point(field_get:kvrpcpb.DsDeleteRequest.header)
-  return p != NULL ? *p : *reinterpret_cast<const ::kvrpcpb::RequestHeader*>(
-      &::kvrpcpb::_RequestHeader_default_instance_);
+inline const ::std::string& Field::value() const {
+  // @@protoc_insertion_point(field_get:kvrpcpb.Field.value)
+  return value_.GetNoArena();
 }
-inline ::kvrpcpb::RequestHeader* DsDeleteRequest::mutable_header() {
+inline void Field::set_value(const ::std::string& value) {
   
-  if (header_ == NULL) {
-    header_ = new ::kvrpcpb::RequestHeader;
-  }
-  // @@protoc_insertion_point(field_mutable:kvrpcpb.DsDeleteRequest.header)
-  return header_;
+  value_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:kvrpcpb.Field.value)
 }
-inline ::kvrpcpb::RequestHeader* DsDeleteRequest::release_header() {
-  // @@protoc_insertion_point(field_release:kvrpcpb.DsDeleteRequest.header)
+#if LANG_CXX11
+inline void Field::set_value(::std::string&& value) {
   
-  ::kvrpcpb::RequestHeader* temp = header_;
-  header_ = NULL;
-  return temp;
-}
-inline void DsDeleteRequest::set_allocated_header(::kvrpcpb::RequestHeader* header) {
-  delete header_;
-  header_ = header;
-  if (header) {
-    
-  } else {
-    
-  }
-  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.DsDeleteRequest.header)
-}
-
-// .kvrpcpb.DeleteRequest req = 2;
-inline bool DsDeleteRequest::has_req() const {
-  return this != internal_default_instance() && req_ != NULL;
-}
-inline void DsDeleteRequest::clear_req() {
-  if (GetArenaNoVirtual() == NULL && req_ != NULL) delete req_;
-  req_ = NULL;
+  value_.SetNoArena(
+    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:kvrpcpb.Field.value)
 }
-inline const ::kvrpcpb::DeleteRequest& DsDeleteRequest::req() const {
-  const ::kvrpcpb::DeleteRequest* p = req_;
-  // @@protoc_insertion_point(field_get:kvrpcpb.DsDeleteRequest.req)
-  return p != NULL ? *p : *reinterpret_cast<const ::kvrpcpb::DeleteRequest*>(
-      &::kvrpcpb::_DeleteRequest_default_instance_);
+#endif
+inline void Field::set_value(const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  
+  value_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:kvrpcpb.Field.value)
 }
-inline ::kvrpcpb::DeleteRequest* DsDeleteRequest::mutable_req() {
+inline void Field::set_value(const void* value, size_t size) {
   
-  if (req_ == NULL) {
-    req_ = new ::kvrpcpb::DeleteRequest;
-  }
-  // @@protoc_insertion_point(field_mutable:kvrpcpb.DsDeleteRequest.req)
-  return req_;
+  value_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:kvrpcpb.Field.value)
 }
-inline ::kvrpcpb::DeleteRequest* DsDeleteRequest::release_req() {
-  // @@protoc_insertion_point(field_release:kvrpcpb.DsDeleteRequest.req)
+inline ::std::string* Field::mutable_value() {
   
-  ::kvrpcpb::DeleteRequest* temp = req_;
-  req_ = NULL;
-  return temp;
+  // @@protoc_insertion_point(field_mutable:kvrpcpb.Field.value)
+  return value_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline void DsDeleteRequest::set_allocated_req(::kvrpcpb::DeleteRequest* req) {
-  delete req_;
-  req_ = req;
-  if (req) {
+inline ::std::string* Field::release_value() {
+  // @@protoc_insertion_point(field_release:kvrpcpb.Field.value)
+  
+  return value_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline void Field::set_allocated_value(::std::string* value) {
+  if (value != NULL) {
     
   } else {
     
   }
-  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.DsDeleteRequest.req)
+  value_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.Field.value)
 }
 
 // -------------------------------------------------------------------
 
-// DsDeleteResponse
+// RedisKeyValue
 
-// .kvrpcpb.ResponseHeader header = 1;
-inline bool DsDeleteResponse::has_header() const {
-  return this != internal_default_instance() && header_ != NULL;
+// bytes key = 1;
+inline void RedisKeyValue::clear_key() {
+  key_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline void DsDeleteResponse::clear_header() {
-  if (GetArenaNoVirtual() == NULL && header_ != NULL) delete header_;
-  header_ = NULL;
+inline const ::std::string& RedisKeyValue::key() const {
+  // @@protoc_insertion_point(field_get:kvrpcpb.RedisKeyValue.key)
+  return key_.GetNoArena();
 }
-inline const ::kvrpcpb::ResponseHeader& DsDeleteResponse::header() const {
-  const ::kvrpcpb::ResponseHeader* p = header_;
-  // @@protoc_insertion_point(field_get:kvrpcpb.DsDeleteResponse.header)
-  return p != NULL ? *p : *reinterpret_cast<const ::kvrpcpb::ResponseHeader*>(
-      &::kvrpcpb::_ResponseHeader_default_instance_);
+inline void RedisKeyValue::set_key(const ::std::string& value) {
+  
+  key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:kvrpcpb.RedisKeyValue.key)
 }
-inline ::kvrpcpb::ResponseHeader* DsDeleteResponse::mutable_header() {
+#if LANG_CXX11
+inline void RedisKeyValue::set_key(::std::string&& value) {
   
-  if (header_ == NULL) {
-    header_ = new ::kvrpcpb::ResponseHeader;
-  }
-  // @@protoc_insertion_point(field_mutable:kvrpcpb.DsDeleteResponse.header)
-  return header_;
+  key_.SetNoArena(
+    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:kvrpcpb.RedisKeyValue.key)
 }
-inline ::kvrpcpb::ResponseHeader* DsDeleteResponse::release_header() {
-  // @@protoc_insertion_point(field_release:kvrpcpb.DsDeleteResponse.header)
+#endif
+inline void RedisKeyValue::set_key(const char* value) {
+  GOOGLE_DCHECK(value != NULL);
   
-  ::kvrpcpb::ResponseHeader* temp = header_;
-  header_ = NULL;
-  return temp;
+  key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:kvrpcpb.RedisKeyValue.key)
 }
-inline void DsDeleteResponse::set_allocated_header(::kvrpcpb::ResponseHeader* header) {
-  delete header_;
-  header_ = header;
-  if (header) {
+inline void RedisKeyValue::set_key(const void* value, size_t size) {
+  
+  key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:kvrpcpb.RedisKeyValue.key)
+}
+inline ::std::string* RedisKeyValue::mutable_key() {
+  
+  // @@protoc_insertion_point(field_mutable:kvrpcpb.RedisKeyValue.key)
+  return key_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline ::std::string* RedisKeyValue::release_key() {
+  // @@protoc_insertion_point(field_release:kvrpcpb.RedisKeyValue.key)
+  
+  return key_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline void RedisKeyValue::set_allocated_key(::std::string* key) {
+  if (key != NULL) {
     
   } else {
     
   }
-  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.DsDeleteResponse.header)
+  key_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), key);
+  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.RedisKeyValue.key)
 }
 
-// .kvrpcpb.DeleteResponse resp = 2;
-inline bool DsDeleteResponse::has_resp() const {
-  return this != internal_default_instance() && resp_ != NULL;
+// bytes value = 2;
+inline void RedisKeyValue::clear_value() {
+  value_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline void DsDeleteResponse::clear_resp() {
-  if (GetArenaNoVirtual() == NULL && resp_ != NULL) delete resp_;
-  resp_ = NULL;
+inline const ::std::string& RedisKeyValue::value() const {
+  // @@protoc_insertion_point(field_get:kvrpcpb.RedisKeyValue.value)
+  return value_.GetNoArena();
 }
-inline const ::kvrpcpb::DeleteResponse& DsDeleteResponse::resp() const {
-  const ::kvrpcpb::DeleteResponse* p = resp_;
-  // @@protoc_insertion_point(field_get:kvrpcpb.DsDeleteResponse.resp)
-  return p != NULL ? *p : *reinterpret_cast<const ::kvrpcpb::DeleteResponse*>(
-      &::kvrpcpb::_DeleteResponse_default_instance_);
+inline void RedisKeyValue::set_value(const ::std::string& value) {
+  
+  value_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:kvrpcpb.RedisKeyValue.value)
 }
-inline ::kvrpcpb::DeleteResponse* DsDeleteResponse::mutable_resp() {
+#if LANG_CXX11
+inline void RedisKeyValue::set_value(::std::string&& value) {
   
-  if (resp_ == NULL) {
-    resp_ = new ::kvrpcpb::DeleteResponse;
-  }
-  // @@protoc_insertion_point(field_mutable:kvrpcpb.DsDeleteResponse.resp)
-  return resp_;
+  value_.SetNoArena(
+    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:kvrpcpb.RedisKeyValue.value)
 }
-inline ::kvrpcpb::DeleteResponse* DsDeleteResponse::release_resp() {
-  // @@protoc_insertion_point(field_release:kvrpcpb.DsDeleteResponse.resp)
+#endif
+inline void RedisKeyValue::set_value(const char* value) {
+  GOOGLE_DCHECK(value != NULL);
   
-  ::kvrpcpb::DeleteResponse* temp = resp_;
-  resp_ = NULL;
-  return temp;
+  value_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:kvrpcpb.RedisKeyValue.value)
 }
-inline void DsDeleteResponse::set_allocated_resp(::kvrpcpb::DeleteResponse* resp) {
-  delete resp_;
-  resp_ = resp;
-  if (resp) {
+inline void RedisKeyValue::set_value(const void* value, size_t size) {
+  
+  value_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:kvrpcpb.RedisKeyValue.value)
+}
+inline ::std::string* RedisKeyValue::mutable_value() {
+  
+  // @@protoc_insertion_point(field_mutable:kvrpcpb.RedisKeyValue.value)
+  return value_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline ::std::string* RedisKeyValue::release_value() {
+  // @@protoc_insertion_point(field_release:kvrpcpb.RedisKeyValue.value)
+  
+  return value_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline void RedisKeyValue::set_allocated_value(::std::string* value) {
+  if (value != NULL) {
     
   } else {
     
   }
-  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.DsDeleteResponse.resp)
+  value_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.RedisKeyValue.value)
 }
 
 // -------------------------------------------------------------------
 
-// DeleteRequest
+// RedisDo
 
 // bytes key = 1;
-inline void DeleteRequest::clear_key() {
+inline void RedisDo::clear_key() {
   key_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline const ::std::string& DeleteRequest::key() const {
-  // @@protoc_insertion_point(field_get:kvrpcpb.DeleteRequest.key)
+inline const ::std::string& RedisDo::key() const {
+  // @@protoc_insertion_point(field_get:kvrpcpb.RedisDo.key)
   return key_.GetNoArena();
 }
-inline void DeleteRequest::set_key(const ::std::string& value) {
+inline void RedisDo::set_key(const ::std::string& value) {
   
   key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:kvrpcpb.DeleteRequest.key)
+  // @@protoc_insertion_point(field_set:kvrpcpb.RedisDo.key)
 }
 #if LANG_CXX11
-inline void DeleteRequest::set_key(::std::string&& value) {
+inline void RedisDo::set_key(::std::string&& value) {
   
   key_.SetNoArena(
     &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:kvrpcpb.DeleteRequest.key)
+  // @@protoc_insertion_point(field_set_rvalue:kvrpcpb.RedisDo.key)
 }
 #endif
-inline void DeleteRequest::set_key(const char* value) {
+inline void RedisDo::set_key(const char* value) {
   GOOGLE_DCHECK(value != NULL);
   
   key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:kvrpcpb.DeleteRequest.key)
+  // @@protoc_insertion_point(field_set_char:kvrpcpb.RedisDo.key)
 }
-inline void DeleteRequest::set_key(const void* value, size_t size) {
+inline void RedisDo::set_key(const void* value, size_t size) {
   
   key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
       ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:kvrpcpb.DeleteRequest.key)
+  // @@protoc_insertion_point(field_set_pointer:kvrpcpb.RedisDo.key)
 }
-inline ::std::string* DeleteRequest::mutable_key() {
+inline ::std::string* RedisDo::mutable_key() {
   
-  // @@protoc_insertion_point(field_mutable:kvrpcpb.DeleteRequest.key)
+  // @@protoc_insertion_point(field_mutable:kvrpcpb.RedisDo.key)
   return key_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline ::std::string* DeleteRequest::release_key() {
-  // @@protoc_insertion_point(field_release:kvrpcpb.DeleteRequest.key)
+inline ::std::string* RedisDo::release_key() {
+  // @@protoc_insertion_point(field_release:kvrpcpb.RedisDo.key)
   
   return key_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline void DeleteRequest::set_allocated_key(::std::string* key) {
+inline void RedisDo::set_allocated_key(::std::string* key) {
   if (key != NULL) {
     
   } else {
     
   }
   key_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), key);
-  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.DeleteRequest.key)
+  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.RedisDo.key)
 }
 
-// .kvrpcpb.Scope scope = 2;
-inline bool DeleteRequest::has_scope() const {
-  return this != internal_default_instance() && scope_ != NULL;
+// bytes value = 2;
+inline void RedisDo::clear_value() {
+  value_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline void DeleteRequest::clear_scope() {
-  if (GetArenaNoVirtual() == NULL && scope_ != NULL) delete scope_;
-  scope_ = NULL;
+inline const ::std::string& RedisDo::value() const {
+  // @@protoc_insertion_point(field_get:kvrpcpb.RedisDo.value)
+  return value_.GetNoArena();
 }
-inline const ::kvrpcpb::Scope& DeleteRequest::scope() const {
-  const ::kvrpcpb::Scope* p = scope_;
-  // @@protoc_insertion_point(field_get:kvrpcpb.DeleteRequest.scope)
-  return p != NULL ? *p : *reinterpret_cast<const ::kvrpcpb::Scope*>(
-      &::kvrpcpb::_Scope_default_instance_);
+inline void RedisDo::set_value(const ::std::string& value) {
+  
+  value_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:kvrpcpb.RedisDo.value)
 }
-inline ::kvrpcpb::Scope* DeleteRequest::mutable_scope() {
+#if LANG_CXX11
+inline void RedisDo::set_value(::std::string&& value) {
   
-  if (scope_ == NULL) {
-    scope_ = new ::kvrpcpb::Scope;
-  }
-  // @@protoc_insertion_point(field_mutable:kvrpcpb.DeleteRequest.scope)
-  return scope_;
+  value_.SetNoArena(
+    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:kvrpcpb.RedisDo.value)
 }
-inline ::kvrpcpb::Scope* DeleteRequest::release_scope() {
-  // @@protoc_insertion_point(field_release:kvrpcpb.DeleteRequest.scope)
+#endif
+inline void RedisDo::set_value(const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  
+  value_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:kvrpcpb.RedisDo.value)
+}
+inline void RedisDo::set_value(const void* value, size_t size) {
+  
+  value_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:kvrpcpb.RedisDo.value)
+}
+inline ::std::string* RedisDo::mutable_value() {
+  
+  // @@protoc_insertion_point(field_mutable:kvrpcpb.RedisDo.value)
+  return value_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline ::std::string* RedisDo::release_value() {
+  // @@protoc_insertion_point(field_release:kvrpcpb.RedisDo.value)
   
-  ::kvrpcpb::Scope* temp = scope_;
-  scope_ = NULL;
-  return temp;
+  return value_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline void DeleteRequest::set_allocated_scope(::kvrpcpb::Scope* scope) {
-  delete scope_;
-  scope_ = scope;
-  if (scope) {
+inline void RedisDo::set_allocated_value(::std::string* value) {
+  if (value != NULL) {
     
   } else {
     
   }
-  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.DeleteRequest.scope)
+  value_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.RedisDo.value)
 }
 
-// repeated .kvrpcpb.Match where_filters = 3;
-inline int DeleteRequest::where_filters_size() const {
-  return where_filters_.size();
-}
-inline void DeleteRequest::clear_where_filters() {
-  where_filters_.Clear();
-}
-inline const ::kvrpcpb::Match& DeleteRequest::where_filters(int index) const {
-  // @@protoc_insertion_point(field_get:kvrpcpb.DeleteRequest.where_filters)
-  return where_filters_.Get(index);
-}
-inline ::kvrpcpb::Match* DeleteRequest::mutable_where_filters(int index) {
-  // @@protoc_insertion_point(field_mutable:kvrpcpb.DeleteRequest.where_filters)
-  return where_filters_.Mutable(index);
-}
-inline ::kvrpcpb::Match* DeleteRequest::add_where_filters() {
-  // @@protoc_insertion_point(field_add:kvrpcpb.DeleteRequest.where_filters)
-  return where_filters_.Add();
+// .kvrpcpb.Operation op = 3;
+inline void RedisDo::clear_op() {
+  op_ = 0;
 }
-inline ::google::protobuf::RepeatedPtrField< ::kvrpcpb::Match >*
-DeleteRequest::mutable_where_filters() {
-  // @@protoc_insertion_point(field_mutable_list:kvrpcpb.DeleteRequest.where_filters)
-  return &where_filters_;
+inline ::kvrpcpb::Operation RedisDo::op() const {
+  // @@protoc_insertion_point(field_get:kvrpcpb.RedisDo.op)
+  return static_cast< ::kvrpcpb::Operation >(op_);
 }
-inline const ::google::protobuf::RepeatedPtrField< ::kvrpcpb::Match >&
-DeleteRequest::where_filters() const {
-  // @@protoc_insertion_point(field_list:kvrpcpb.DeleteRequest.where_filters)
-  return where_filters_;
+inline void RedisDo::set_op(::kvrpcpb::Operation value) {
+  
+  op_ = value;
+  // @@protoc_insertion_point(field_set:kvrpcpb.RedisDo.op)
 }
 
-// repeated uint64 indexs = 4;
-inline int DeleteRequest::indexs_size() const {
-  return indexs_.size();
-}
-inline void DeleteRequest::clear_indexs() {
-  indexs_.Clear();
-}
-inline ::google::protobuf::uint64 DeleteRequest::indexs(int index) const {
-  // @@protoc_insertion_point(field_get:kvrpcpb.DeleteRequest.indexs)
-  return indexs_.Get(index);
-}
-inline void DeleteRequest::set_indexs(int index, ::google::protobuf::uint64 value) {
-  indexs_.Set(index, value);
-  // @@protoc_insertion_point(field_set:kvrpcpb.DeleteRequest.indexs)
-}
-inline void DeleteRequest::add_indexs(::google::protobuf::uint64 value) {
-  indexs_.Add(value);
-  // @@protoc_insertion_point(field_add:kvrpcpb.DeleteRequest.indexs)
+// .kvrpcpb.ExistCase case = 4;
+inline void RedisDo::clear_case_() {
+  case__ = 0;
 }
-inline const ::google::protobuf::RepeatedField< ::google::protobuf::uint64 >&
-DeleteRequest::indexs() const {
-  // @@protoc_insertion_point(field_list:kvrpcpb.DeleteRequest.indexs)
-  return indexs_;
+inline ::kvrpcpb::ExistCase RedisDo::case_() const {
+  // @@protoc_insertion_point(field_get:kvrpcpb.RedisDo.case)
+  return static_cast< ::kvrpcpb::ExistCase >(case__);
 }
-inline ::google::protobuf::RepeatedField< ::google::protobuf::uint64 >*
-DeleteRequest::mutable_indexs() {
-  // @@protoc_insertion_point(field_mutable_list:kvrpcpb.DeleteRequest.indexs)
-  return &indexs_;
+inline void RedisDo::set_case_(::kvrpcpb::ExistCase value) {
+  
+  case__ = value;
+  // @@protoc_insertion_point(field_set:kvrpcpb.RedisDo.case)
 }
 
-// .timestamp.Timestamp timestamp = 10;
-inline bool DeleteRequest::has_timestamp() const {
-  return this != internal_default_instance() && timestamp_ != NULL;
+// -------------------------------------------------------------------
+
+// KvSetRequest
+
+// .kvrpcpb.RedisKeyValue kv = 1;
+inline bool KvSetRequest::has_kv() const {
+  return this != internal_default_instance() && kv_ != NULL;
 }
-inline void DeleteRequest::clear_timestamp() {
-  if (GetArenaNoVirtual() == NULL && timestamp_ != NULL) delete timestamp_;
-  timestamp_ = NULL;
+inline void KvSetRequest::clear_kv() {
+  if (GetArenaNoVirtual() == NULL && kv_ != NULL) delete kv_;
+  kv_ = NULL;
 }
-inline const ::timestamp::Timestamp& DeleteRequest::timestamp() const {
-  const ::timestamp::Timestamp* p = timestamp_;
-  // @@protoc_insertion_point(field_get:kvrpcpb.DeleteRequest.timestamp)
-  return p != NULL ? *p : *reinterpret_cast<const ::timestamp::Timestamp*>(
-      &::timestamp::_Timestamp_default_instance_);
+inline const ::kvrpcpb::RedisKeyValue& KvSetRequest::kv() const {
+  const ::kvrpcpb::RedisKeyValue* p = kv_;
+  // @@protoc_insertion_point(field_get:kvrpcpb.KvSetRequest.kv)
+  return p != NULL ? *p : *reinterpret_cast<const ::kvrpcpb::RedisKeyValue*>(
+      &::kvrpcpb::_RedisKeyValue_default_instance_);
 }
-inline ::timestamp::Timestamp* DeleteRequest::mutable_timestamp() {
+inline ::kvrpcpb::RedisKeyValue* KvSetRequest::mutable_kv() {
   
-  if (timestamp_ == NULL) {
-    timestamp_ = new ::timestamp::Timestamp;
+  if (kv_ == NULL) {
+    kv_ = new ::kvrpcpb::RedisKeyValue;
   }
-  // @@protoc_insertion_point(field_mutable:kvrpcpb.DeleteRequest.timestamp)
-  return timestamp_;
+  // @@protoc_insertion_point(field_mutable:kvrpcpb.KvSetRequest.kv)
+  return kv_;
 }
-inline ::timestamp::Timestamp* DeleteRequest::release_timestamp() {
-  // @@protoc_insertion_point(field_release:kvrpcpb.DeleteRequest.timestamp)
+inline ::kvrpcpb::RedisKeyValue* KvSetRequest::release_kv() {
+  // @@protoc_insertion_point(field_release:kvrpcpb.KvSetRequest.kv)
   
-  ::timestamp::Timestamp* temp = timestamp_;
-  timestamp_ = NULL;
+  ::kvrpcpb::RedisKeyValue* temp = kv_;
+  kv_ = NULL;
   return temp;
 }
-inline void DeleteRequest::set_allocated_timestamp(::timestamp::Timestamp* timestamp) {
-  delete timestamp_;
-  timestamp_ = timestamp;
-  if (timestamp) {
+inline void KvSetRequest::set_allocated_kv(::kvrpcpb::RedisKeyValue* kv) {
+  delete kv_;
+  kv_ = kv;
+  if (kv) {
     
   } else {
     
   }
-  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.DeleteRequest.timestamp)
+  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.KvSetRequest.kv)
+}
+
+// .kvrpcpb.ExistCase case = 2;
+inline void KvSetRequest::clear_case_() {
+  case__ = 0;
+}
+inline ::kvrpcpb::ExistCase KvSetRequest::case_() const {
+  // @@protoc_insertion_point(field_get:kvrpcpb.KvSetRequest.case)
+  return static_cast< ::kvrpcpb::ExistCase >(case__);
+}
+inline void KvSetRequest::set_case_(::kvrpcpb::ExistCase value) {
+  
+  case__ = value;
+  // @@protoc_insertion_point(field_set:kvrpcpb.KvSetRequest.case)
 }
 
 // -------------------------------------------------------------------
 
-// DeleteResponse
+// KvSetResponse
 
 // int32 code = 1;
-inline void DeleteResponse::clear_code() {
+inline void KvSetResponse::clear_code() {
   code_ = 0;
 }
-inline ::google::protobuf::int32 DeleteResponse::code() const {
-  // @@protoc_insertion_point(field_get:kvrpcpb.DeleteResponse.code)
+inline ::google::protobuf::int32 KvSetResponse::code() const {
+  // @@protoc_insertion_point(field_get:kvrpcpb.KvSetResponse.code)
   return code_;
 }
-inline void DeleteResponse::set_code(::google::protobuf::int32 value) {
+inline void KvSetResponse::set_code(::google::protobuf::int32 value) {
   
   code_ = value;
-  // @@protoc_insertion_point(field_set:kvrpcpb.DeleteResponse.code)
+  // @@protoc_insertion_point(field_set:kvrpcpb.KvSetResponse.code)
 }
 
 // uint64 affected_keys = 2;
-inline void DeleteResponse::clear_affected_keys() {
+inline void KvSetResponse::clear_affected_keys() {
   affected_keys_ = GOOGLE_ULONGLONG(0);
 }
-inline ::google::protobuf::uint64 DeleteResponse::affected_keys() const {
-  // @@protoc_insertion_point(field_get:kvrpcpb.DeleteResponse.affected_keys)
+inline ::google::protobuf::uint64 KvSetResponse::affected_keys() const {
+  // @@protoc_insertion_point(field_get:kvrpcpb.KvSetResponse.affected_keys)
   return affected_keys_;
 }
-inline void DeleteResponse::set_affected_keys(::google::protobuf::uint64 value) {
+inline void KvSetResponse::set_affected_keys(::google::protobuf::uint64 value) {
   
   affected_keys_ = value;
-  // @@protoc_insertion_point(field_set:kvrpcpb.DeleteResponse.affected_keys)
+  // @@protoc_insertion_point(field_set:kvrpcpb.KvSetResponse.affected_keys)
 }
 
 // -------------------------------------------------------------------
 
-// Field
+// DsKvSetRequest
 
-// uint64 column_id = 1;
-inline void Field::clear_column_id() {
-  column_id_ = GOOGLE_ULONGLONG(0);
+// .kvrpcpb.RequestHeader header = 1;
+inline bool DsKvSetRequest::has_header() const {
+  return this != internal_default_instance() && header_ != NULL;
 }
-inline ::google::protobuf::uint64 Field::column_id() const {
-  // @@protoc_insertion_point(field_get:kvrpcpb.Field.column_id)
-  return column_id_;
+inline void DsKvSetRequest::clear_header() {
+  if (GetArenaNoVirtual() == NULL && header_ != NULL) delete header_;
+  header_ = NULL;
 }
-inline void Field::set_column_id(::google::protobuf::uint64 value) {
+inline const ::kvrpcpb::RequestHeader& DsKvSetRequest::header() const {
+  const ::kvrpcpb::RequestHeader* p = header_;
+  // @@protoc_insertion_point(field_get:kvrpcpb.DsKvSetRequest.header)
+  return p != NULL ? *p : *reinterpret_cast<const ::kvrpcpb::RequestHeader*>(
+      &::kvrpcpb::_RequestHeader_default_instance_);
+}
+inline ::kvrpcpb::RequestHeader* DsKvSetRequest::mutable_header() {
   
-  column_id_ = value;
-  // @@protoc_insertion_point(field_set:kvrpcpb.Field.column_id)
+  if (header_ == NULL) {
+    header_ = new ::kvrpcpb::RequestHeader;
+  }
+  // @@protoc_insertion_point(field_mutable:kvrpcpb.DsKvSetRequest.header)
+  return header_;
+}
+inline ::kvrpcpb::RequestHeader* DsKvSetRequest::release_header() {
+  // @@protoc_insertion_point(field_release:kvrpcpb.DsKvSetRequest.header)
+  
+  ::kvrpcpb::RequestHeader* temp = header_;
+  header_ = NULL;
+  return temp;
+}
+inline void DsKvSetRequest::set_allocated_header(::kvrpcpb::RequestHeader* header) {
+  delete header_;
+  header_ = header;
+  if (header) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.DsKvSetRequest.header)
+}
+
+// .kvrpcpb.KvSetRequest req = 2;
+inline bool DsKvSetRequest::has_req() const {
+  return this != internal_default_instance() && req_ != NULL;
+}
+inline void DsKvSetRequest::clear_req() {
+  if (GetArenaNoVirtual() == NULL && req_ != NULL) delete req_;
+  req_ = NULL;
+}
+inline const ::kvrpcpb::KvSetRequest& DsKvSetRequest::req() const {
+  const ::kvrpcpb::KvSetRequest* p = req_;
+  // @@protoc_insertion_point(field_get:kvrpcpb.DsKvSetRequest.req)
+  return p != NULL ? *p : *reinterpret_cast<const ::kvrpcpb::KvSetRequest*>(
+      &::kvrpcpb::_KvSetRequest_default_instance_);
+}
+inline ::kvrpcpb::KvSetRequest* DsKvSetRequest::mutable_req() {
+  
+  if (req_ == NULL) {
+    req_ = new ::kvrpcpb::KvSetRequest;
+  }
+  // @@protoc_insertion_point(field_mutable:kvrpcpb.DsKvSetRequest.req)
+  return req_;
+}
+inline ::kvrpcpb::KvSetRequest* DsKvSetRequest::release_req() {
+  // @@protoc_insertion_point(field_release:kvrpcpb.DsKvSetRequest.req)
+  
+  ::kvrpcpb::KvSetRequest* temp = req_;
+  req_ = NULL;
+  return temp;
+}
+inline void DsKvSetRequest::set_allocated_req(::kvrpcpb::KvSetRequest* req) {
+  delete req_;
+  req_ = req;
+  if (req) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.DsKvSetRequest.req)
 }
 
-// bytes value = 2;
-inline void Field::clear_value() {
-  value_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+// -------------------------------------------------------------------
+
+// DsKvSetResponse
+
+// .kvrpcpb.ResponseHeader header = 1;
+inline bool DsKvSetResponse::has_header() const {
+  return this != internal_default_instance() && header_ != NULL;
 }
-inline const ::std::string& Field::value() const {
-  // @@protoc_insertion_point(field_get:kvrpcpb.Field.value)
-  return value_.GetNoArena();
+inline void DsKvSetResponse::clear_header() {
+  if (GetArenaNoVirtual() == NULL && header_ != NULL) delete header_;
+  header_ = NULL;
 }
-inline void Field::set_value(const ::std::string& value) {
-  
-  value_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:kvrpcpb.Field.value)
+inline const ::kvrpcpb::ResponseHeader& DsKvSetResponse::header() const {
+  const ::kvrpcpb::ResponseHeader* p = header_;
+  // @@protoc_insertion_point(field_get:kvrpcpb.DsKvSetResponse.header)
+  return p != NULL ? *p : *reinterpret_cast<const ::kvrpcpb::ResponseHeader*>(
+      &::kvrpcpb::_ResponseHeader_default_instance_);
 }
-#if LANG_CXX11
-inline void Field::set_value(::std::string&& value) {
+inline ::kvrpcpb::ResponseHeader* DsKvSetResponse::mutable_header() {
   
-  value_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:kvrpcpb.Field.value)
+  if (header_ == NULL) {
+    header_ = new ::kvrpcpb::ResponseHeader;
+  }
+  // @@protoc_insertion_point(field_mutable:kvrpcpb.DsKvSetResponse.header)
+  return header_;
 }
-#endif
-inline void Field::set_value(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
+inline ::kvrpcpb::ResponseHeader* DsKvSetResponse::release_header() {
+  // @@protoc_insertion_point(field_release:kvrpcpb.DsKvSetResponse.header)
   
-  value_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:kvrpcpb.Field.value)
+  ::kvrpcpb::ResponseHeader* temp = header_;
+  header_ = NULL;
+  return temp;
 }
-inline void Field::set_value(const void* value, size_t size) {
-  
-  value_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:kvrpcpb.Field.value)
+inline void DsKvSetResponse::set_allocated_header(::kvrpcpb::ResponseHeader* header) {
+  delete header_;
+  header_ = header;
+  if (header) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.DsKvSetResponse.header)
 }
-inline ::std::string* Field::mutable_value() {
+
+// .kvrpcpb.KvSetResponse resp = 2;
+inline bool DsKvSetResponse::has_resp() const {
+  return this != internal_default_instance() && resp_ != NULL;
+}
+inline void DsKvSetResponse::clear_resp() {
+  if (GetArenaNoVirtual() == NULL && resp_ != NULL) delete resp_;
+  resp_ = NULL;
+}
+inline const ::kvrpcpb::KvSetResponse& DsKvSetResponse::resp() const {
+  const ::kvrpcpb::KvSetResponse* p = resp_;
+  // @@protoc_insertion_point(field_get:kvrpcpb.DsKvSetResponse.resp)
+  return p != NULL ? *p : *reinterpret_cast<const ::kvrpcpb::KvSetResponse*>(
+      &::kvrpcpb::_KvSetResponse_default_instance_);
+}
+inline ::kvrpcpb::KvSetResponse* DsKvSetResponse::mutable_resp() {
   
-  // @@protoc_insertion_point(field_mutable:kvrpcpb.Field.value)
-  return value_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (resp_ == NULL) {
+    resp_ = new ::kvrpcpb::KvSetResponse;
+  }
+  // @@protoc_insertion_point(field_mutable:kvrpcpb.DsKvSetResponse.resp)
+  return resp_;
 }
-inline ::std::string* Field::release_value() {
-  // @@protoc_insertion_point(field_release:kvrpcpb.Field.value)
+inline ::kvrpcpb::KvSetResponse* DsKvSetResponse::release_resp() {
+  // @@protoc_insertion_point(field_release:kvrpcpb.DsKvSetResponse.resp)
   
-  return value_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::kvrpcpb::KvSetResponse* temp = resp_;
+  resp_ = NULL;
+  return temp;
 }
-inline void Field::set_allocated_value(::std::string* value) {
-  if (value != NULL) {
+inline void DsKvSetResponse::set_allocated_resp(::kvrpcpb::KvSetResponse* resp) {
+  delete resp_;
+  resp_ = resp;
+  if (resp) {
     
   } else {
     
   }
-  value_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.Field.value)
+  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.DsKvSetResponse.resp)
 }
 
 // -------------------------------------------------------------------
 
-// RedisKeyValue
+// KvGetRequest
 
 // bytes key = 1;
-inline void RedisKeyValue::clear_key() {
+inline void KvGetRequest::clear_key() {
   key_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline const ::std::string& RedisKeyValue::key() const {
-  // @@protoc_insertion_point(field_get:kvrpcpb.RedisKeyValue.key)
+inline const ::std::string& KvGetRequest::key() const {
+  // @@protoc_insertion_point(field_get:kvrpcpb.KvGetRequest.key)
   return key_.GetNoArena();
 }
-inline void RedisKeyValue::set_key(const ::std::string& value) {
+inline void KvGetRequest::set_key(const ::std::string& value) {
   
   key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:kvrpcpb.RedisKeyValue.key)
+  // @@protoc_insertion_point(field_set:kvrpcpb.KvGetRequest.key)
 }
 #if LANG_CXX11
-inline void RedisKeyValue::set_key(::std::string&& value) {
+inline void KvGetRequest::set_key(::std::string&& value) {
   
   key_.SetNoArena(
     &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:kvrpcpb.RedisKeyValue.key)
+  // @@protoc_insertion_point(field_set_rvalue:kvrpcpb.KvGetRequest.key)
 }
 #endif
-inline void RedisKeyValue::set_key(const char* value) {
+inline void KvGetRequest::set_key(const char* value) {
   GOOGLE_DCHECK(value != NULL);
   
   key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:kvrpcpb.RedisKeyValue.key)
+  // @@protoc_insertion_point(field_set_char:kvrpcpb.KvGetRequest.key)
 }
-inline void RedisKeyValue::set_key(const void* value, size_t size) {
+inline void KvGetRequest::set_key(const void* value, size_t size) {
   
   key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
       ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:kvrpcpb.RedisKeyValue.key)
+  // @@protoc_insertion_point(field_set_pointer:kvrpcpb.KvGetRequest.key)
 }
-inline ::std::string* RedisKeyValue::mutable_key() {
+inline ::std::string* KvGetRequest::mutable_key() {
   
-  // @@protoc_insertion_point(field_mutable:kvrpcpb.RedisKeyValue.key)
+  // @@protoc_insertion_point(field_mutable:kvrpcpb.KvGetRequest.key)
   return key_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline ::std::string* RedisKeyValue::release_key() {
-  // @@protoc_insertion_point(field_release:kvrpcpb.RedisKeyValue.key)
+inline ::std::string* KvGetRequest::release_key() {
+  // @@protoc_insertion_point(field_release:kvrpcpb.KvGetRequest.key)
   
   return key_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline void RedisKeyValue::set_allocated_key(::std::string* key) {
+inline void KvGetRequest::set_allocated_key(::std::string* key) {
   if (key != NULL) {
     
   } else {
     
   }
   key_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), key);
-  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.RedisKeyValue.key)
+  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.KvGetRequest.key)
+}
+
+// -------------------------------------------------------------------
+
+// KvGetResponse
+
+// int32 code = 1;
+inline void KvGetResponse::clear_code() {
+  code_ = 0;
+}
+inline ::google::protobuf::int32 KvGetResponse::code() const {
+  // @@protoc_insertion_point(field_get:kvrpcpb.KvGetResponse.code)
+  return code_;
+}
+inline void KvGetResponse::set_code(::google::protobuf::int32 value) {
+  
+  code_ = value;
+  // @@protoc_insertion_point(field_set:kvrpcpb.KvGetResponse.code)
 }
 
 // bytes value = 2;
-inline void RedisKeyValue::clear_value() {
+inline void KvGetResponse::clear_value() {
   value_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline const ::std::string& RedisKeyValue::value() const {
-  // @@protoc_insertion_point(field_get:kvrpcpb.RedisKeyValue.value)
+inline const ::std::string& KvGetResponse::value() const {
+  // @@protoc_insertion_point(field_get:kvrpcpb.KvGetResponse.value)
   return value_.GetNoArena();
 }
-inline void RedisKeyValue::set_value(const ::std::string& value) {
+inline void KvGetResponse::set_value(const ::std::string& value) {
   
   value_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:kvrpcpb.RedisKeyValue.value)
+  // @@protoc_insertion_point(field_set:kvrpcpb.KvGetResponse.value)
 }
 #if LANG_CXX11
-inline void RedisKeyValue::set_value(::std::string&& value) {
+inline void KvGetResponse::set_value(::std::string&& value) {
   
   value_.SetNoArena(
     &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:kvrpcpb.RedisKeyValue.value)
+  // @@protoc_insertion_point(field_set_rvalue:kvrpcpb.KvGetResponse.value)
 }
 #endif
-inline void RedisKeyValue::set_value(const char* value) {
+inline void KvGetResponse::set_value(const char* value) {
   GOOGLE_DCHECK(value != NULL);
   
   value_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:kvrpcpb.RedisKeyValue.value)
+  // @@protoc_insertion_point(field_set_char:kvrpcpb.KvGetResponse.value)
 }
-inline void RedisKeyValue::set_value(const void* value, size_t size) {
+inline void KvGetResponse::set_value(const void* value, size_t size) {
   
   value_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
       ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:kvrpcpb.RedisKeyValue.value)
+  // @@protoc_insertion_point(field_set_pointer:kvrpcpb.KvGetResponse.value)
 }
-inline ::std::string* RedisKeyValue::mutable_value() {
+inline ::std::string* KvGetResponse::mutable_value() {
   
-  // @@protoc_insertion_point(field_mutable:kvrpcpb.RedisKeyValue.value)
+  // @@protoc_insertion_point(field_mutable:kvrpcpb.KvGetResponse.value)
   return value_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline ::std::string* RedisKeyValue::release_value() {
-  // @@protoc_insertion_point(field_release:kvrpcpb.RedisKeyValue.value)
+inline ::std::string* KvGetResponse::release_value() {
+  // @@protoc_insertion_point(field_release:kvrpcpb.KvGetResponse.value)
   
   return value_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline void RedisKeyValue::set_allocated_value(::std::string* value) {
+inline void KvGetResponse::set_allocated_value(::std::string* value) {
   if (value != NULL) {
     
   } else {
     
   }
   value_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.RedisKeyValue.value)
+  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.KvGetResponse.value)
 }
 
 // -------------------------------------------------------------------
 
-// RedisDo
+// DsKvGetRequest
 
-// bytes key = 1;
-inline void RedisDo::clear_key() {
-  key_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-inline const ::std::string& RedisDo::key() const {
-  // @@protoc_insertion_point(field_get:kvrpcpb.RedisDo.key)
-  return key_.GetNoArena();
-}
-inline void RedisDo::set_key(const ::std::string& value) {
-  
-  key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:kvrpcpb.RedisDo.key)
-}
-#if LANG_CXX11
-inline void RedisDo::set_key(::std::string&& value) {
-  
-  key_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:kvrpcpb.RedisDo.key)
+// .kvrpcpb.RequestHeader header = 1;
+inline bool DsKvGetRequest::has_header() const {
+  return this != internal_default_instance() && header_ != NULL;
 }
-#endif
-inline void RedisDo::set_key(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:kvrpcpb.RedisDo.key)
+inline void DsKvGetRequest::clear_header() {
+  if (GetArenaNoVirtual() == NULL && header_ != NULL) delete header_;
+  header_ = NULL;
 }
-inline void RedisDo::set_key(const void* value, size_t size) {
-  
-  key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:kvrpcpb.RedisDo.key)
+inline const ::kvrpcpb::RequestHeader& DsKvGetRequest::header() const {
+  const ::kvrpcpb::RequestHeader* p = header_;
+  // @@protoc_insertion_point(field_get:kvrpcpb.DsKvGetRequest.header)
+  return p != NULL ? *p : *reinterpret_cast<const ::kvrpcpb::RequestHeader*>(
+      &::kvrpcpb::_RequestHeader_default_instance_);
 }
-inline ::std::string* RedisDo::mutable_key() {
+inline ::kvrpcpb::RequestHeader* DsKvGetRequest::mutable_header() {
   
-  // @@protoc_insertion_point(field_mutable:kvrpcpb.RedisDo.key)
-  return key_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (header_ == NULL) {
+    header_ = new ::kvrpcpb::RequestHeader;
+  }
+  // @@protoc_insertion_point(field_mutable:kvrpcpb.DsKvGetRequest.header)
+  return header_;
 }
-inline ::std::string* RedisDo::release_key() {
-  // @@protoc_insertion_point(field_release:kvrpcpb.RedisDo.key)
+inline ::kvrpcpb::RequestHeader* DsKvGetRequest::release_header() {
+  // @@protoc_insertion_point(field_release:kvrpcpb.DsKvGetRequest.header)
   
-  return key_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::kvrpcpb::RequestHeader* temp = header_;
+  header_ = NULL;
+  return temp;
 }
-inline void RedisDo::set_allocated_key(::std::string* key) {
-  if (key != NULL) {
+inline void DsKvGetRequest::set_allocated_header(::kvrpcpb::RequestHeader* header) {
+  delete header_;
+  header_ = header;
+  if (header) {
     
   } else {
     
   }
-  key_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), key);
-  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.RedisDo.key)
+  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.DsKvGetRequest.header)
 }
 
-// bytes value = 2;
-inline void RedisDo::clear_value() {
-  value_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-inline const ::std::string& RedisDo::value() const {
-  // @@protoc_insertion_point(field_get:kvrpcpb.RedisDo.value)
-  return value_.GetNoArena();
-}
-inline void RedisDo::set_value(const ::std::string& value) {
-  
-  value_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:kvrpcpb.RedisDo.value)
-}
-#if LANG_CXX11
-inline void RedisDo::set_value(::std::string&& value) {
-  
-  value_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:kvrpcpb.RedisDo.value)
+// .kvrpcpb.KvGetRequest req = 2;
+inline bool DsKvGetRequest::has_req() const {
+  return this != internal_default_instance() && req_ != NULL;
 }
-#endif
-inline void RedisDo::set_value(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  value_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:kvrpcpb.RedisDo.value)
+inline void DsKvGetRequest::clear_req() {
+  if (GetArenaNoVirtual() == NULL && req_ != NULL) delete req_;
+  req_ = NULL;
 }
-inline void RedisDo::set_value(const void* value, size_t size) {
-  
-  value_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:kvrpcpb.RedisDo.value)
+inline const ::kvrpcpb::KvGetRequest& DsKvGetRequest::req() const {
+  const ::kvrpcpb::KvGetRequest* p = req_;
+  // @@protoc_insertion_point(field_get:kvrpcpb.DsKvGetRequest.req)
+  return p != NULL ? *p : *reinterpret_cast<const ::kvrpcpb::KvGetRequest*>(
+      &::kvrpcpb::_KvGetRequest_default_instance_);
 }
-inline ::std::string* RedisDo::mutable_value() {
+inline ::kvrpcpb::KvGetRequest* DsKvGetRequest::mutable_req() {
   
-  // @@protoc_insertion_point(field_mutable:kvrpcpb.RedisDo.value)
-  return value_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (req_ == NULL) {
+    req_ = new ::kvrpcpb::KvGetRequest;
+  }
+  // @@protoc_insertion_point(field_mutable:kvrpcpb.DsKvGetRequest.req)
+  return req_;
 }
-inline ::std::string* RedisDo::release_value() {
-  // @@protoc_insertion_point(field_release:kvrpcpb.RedisDo.value)
+inline ::kvrpcpb::KvGetRequest* DsKvGetRequest::release_req() {
+  // @@protoc_insertion_point(field_release:kvrpcpb.DsKvGetRequest.req)
   
-  return value_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::kvrpcpb::KvGetRequest* temp = req_;
+  req_ = NULL;
+  return temp;
 }
-inline void RedisDo::set_allocated_value(::std::string* value) {
-  if (value != NULL) {
+inline void DsKvGetRequest::set_allocated_req(::kvrpcpb::KvGetRequest* req) {
+  delete req_;
+  req_ = req;
+  if (req) {
     
   } else {
     
   }
-  value_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.RedisDo.value)
+  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.DsKvGetRequest.req)
 }
 
-// .kvrpcpb.Operation op = 3;
-inline void RedisDo::clear_op() {
-  op_ = 0;
-}
-inline ::kvrpcpb::Operation RedisDo::op() const {
-  // @@protoc_insertion_point(field_get:kvrpcpb.RedisDo.op)
-  return static_cast< ::kvrpcpb::Operation >(op_);
+// -------------------------------------------------------------------
+
+// DsKvGetResponse
+
+// .kvrpcpb.ResponseHeader header = 1;
+inline bool DsKvGetResponse::has_header() const {
+  return this != internal_default_instance() && header_ != NULL;
 }
-inline void RedisDo::set_op(::kvrpcpb::Operation value) {
-  
-  op_ = value;
-  // @@protoc_insertion_point(field_set:kvrpcpb.RedisDo.op)
+inline void DsKvGetResponse::clear_header() {
+  if (GetArenaNoVirtual() == NULL && header_ != NULL) delete header_;
+  header_ = NULL;
 }
-
-// .kvrpcpb.ExistCase case = 4;
-inline void RedisDo::clear_case_() {
-  case__ = 0;
+inline const ::kvrpcpb::ResponseHeader& DsKvGetResponse::header() const {
+  const ::kvrpcpb::ResponseHeader* p = header_;
+  // @@protoc_insertion_point(field_get:kvrpcpb.DsKvGetResponse.header)
+  return p != NULL ? *p : *reinterpret_cast<const ::kvrpcpb::ResponseHeader*>(
+      &::kvrpcpb::_ResponseHeader_default_instance_);
 }
-inline ::kvrpcpb::ExistCase RedisDo::case_() const {
-  // @@protoc_insertion_point(field_get:kvrpcpb.RedisDo.case)
-  return static_cast< ::kvrpcpb::ExistCase >(case__);
+inline ::kvrpcpb::ResponseHeader* DsKvGetResponse::mutable_header() {
+  
+  if (header_ == NULL) {
+    header_ = new ::kvrpcpb::ResponseHeader;
+  }
+  // @@protoc_insertion_point(field_mutable:kvrpcpb.DsKvGetResponse.header)
+  return header_;
 }
-inline void RedisDo::set_case_(::kvrpcpb::ExistCase value) {
+inline ::kvrpcpb::ResponseHeader* DsKvGetResponse::release_header() {
+  // @@protoc_insertion_point(field_release:kvrpcpb.DsKvGetResponse.header)
   
-  case__ = value;
-  // @@protoc_insertion_point(field_set:kvrpcpb.RedisDo.case)
+  ::kvrpcpb::ResponseHeader* temp = header_;
+  header_ = NULL;
+  return temp;
+}
+inline void DsKvGetResponse::set_allocated_header(::kvrpcpb::ResponseHeader* header) {
+  delete header_;
+  header_ = header;
+  if (header) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.DsKvGetResponse.header)
 }
 
-// -------------------------------------------------------------------
-
-// KvSetRequest
-
-// .kvrpcpb.RedisKeyValue kv = 1;
-inline bool KvSetRequest::has_kv() const {
-  return this != internal_default_instance() && kv_ != NULL;
+// .kvrpcpb.KvGetResponse resp = 2;
+inline bool DsKvGetResponse::has_resp() const {
+  return this != internal_default_instance() && resp_ != NULL;
 }
-inline void KvSetRequest::clear_kv() {
-  if (GetArenaNoVirtual() == NULL && kv_ != NULL) delete kv_;
-  kv_ = NULL;
+inline void DsKvGetResponse::clear_resp() {
+  if (GetArenaNoVirtual() == NULL && resp_ != NULL) delete resp_;
+  resp_ = NULL;
 }
-inline const ::kvrpcpb::RedisKeyValue& KvSetRequest::kv() const {
-  const ::kvrpcpb::RedisKeyValue* p = kv_;
-  // @@protoc_insertion_point(field_get:kvrpcpb.KvSetRequest.kv)
-  return p != NULL ? *p : *reinterpret_cast<const ::kvrpcpb::RedisKeyValue*>(
-      &::kvrpcpb::_RedisKeyValue_default_instance_);
+inline const ::kvrpcpb::KvGetResponse& DsKvGetResponse::resp() const {
+  const ::kvrpcpb::KvGetResponse* p = resp_;
+  // @@protoc_insertion_point(field_get:kvrpcpb.DsKvGetResponse.resp)
+  return p != NULL ? *p : *reinterpret_cast<const ::kvrpcpb::KvGetResponse*>(
+      &::kvrpcpb::_KvGetResponse_default_instance_);
 }
-inline ::kvrpcpb::RedisKeyValue* KvSetRequest::mutable_kv() {
+inline ::kvrpcpb::KvGetResponse* DsKvGetResponse::mutable_resp() {
   
-  if (kv_ == NULL) {
-    kv_ = new ::kvrpcpb::RedisKeyValue;
+  if (resp_ == NULL) {
+    resp_ = new ::kvrpcpb::KvGetResponse;
   }
-  // @@protoc_insertion_point(field_mutable:kvrpcpb.KvSetRequest.kv)
-  return kv_;
+  // @@protoc_insertion_point(field_mutable:kvrpcpb.DsKvGetResponse.resp)
+  return resp_;
 }
-inline ::kvrpcpb::RedisKeyValue* KvSetRequest::release_kv() {
-  // @@protoc_insertion_point(field_release:kvrpcpb.KvSetRequest.kv)
+inline ::kvrpcpb::KvGetResponse* DsKvGetResponse::release_resp() {
+  // @@protoc_insertion_point(field_release:kvrpcpb.DsKvGetResponse.resp)
   
-  ::kvrpcpb::RedisKeyValue* temp = kv_;
-  kv_ = NULL;
+  ::kvrpcpb::KvGetResponse* temp = resp_;
+  resp_ = NULL;
   return temp;
 }
-inline void KvSetRequest::set_allocated_kv(::kvrpcpb::RedisKeyValue* kv) {
-  delete kv_;
-  kv_ = kv;
-  if (kv) {
+inline void DsKvGetResponse::set_allocated_resp(::kvrpcpb::KvGetResponse* resp) {
+  delete resp_;
+  resp_ = resp;
+  if (resp) {
     
   } else {
     
   }
-  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.KvSetRequest.kv)
+  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.DsKvGetResponse.resp)
+}
+
+// -------------------------------------------------------------------
+
+// KvBatchSetRequest
+
+// repeated .kvrpcpb.RedisKeyValue kvs = 1;
+inline int KvBatchSetRequest::kvs_size() const {
+  return kvs_.size();
+}
+inline void KvBatchSetRequest::clear_kvs() {
+  kvs_.Clear();
+}
+inline const ::kvrpcpb::RedisKeyValue& KvBatchSetRequest::kvs(int index) const {
+  // @@protoc_insertion_point(field_get:kvrpcpb.KvBatchSetRequest.kvs)
+  return kvs_.Get(index);
+}
+inline ::kvrpcpb::RedisKeyValue* KvBatchSetRequest::mutable_kvs(int index) {
+  // @@protoc_insertion_point(field_mutable:kvrpcpb.KvBatchSetRequest.kvs)
+  return kvs_.Mutable(index);
+}
+inline ::kvrpcpb::RedisKeyValue* KvBatchSetRequest::add_kvs() {
+  // @@protoc_insertion_point(field_add:kvrpcpb.KvBatchSetRequest.kvs)
+  return kvs_.Add();
+}
+inline ::google::protobuf::RepeatedPtrField< ::kvrpcpb::RedisKeyValue >*
+KvBatchSetRequest::mutable_kvs() {
+  // @@protoc_insertion_point(field_mutable_list:kvrpcpb.KvBatchSetRequest.kvs)
+  return &kvs_;
+}
+inline const ::google::protobuf::RepeatedPtrField< ::kvrpcpb::RedisKeyValue >&
+KvBatchSetRequest::kvs() const {
+  // @@protoc_insertion_point(field_list:kvrpcpb.KvBatchSetRequest.kvs)
+  return kvs_;
 }
 
 // .kvrpcpb.ExistCase case = 2;
-inline void KvSetRequest::clear_case_() {
+inline void KvBatchSetRequest::clear_case_() {
   case__ = 0;
 }
-inline ::kvrpcpb::ExistCase KvSetRequest::case_() const {
-  // @@protoc_insertion_point(field_get:kvrpcpb.KvSetRequest.case)
+inline ::kvrpcpb::ExistCase KvBatchSetRequest::case_() const {
+  // @@protoc_insertion_point(field_get:kvrpcpb.KvBatchSetRequest.case)
   return static_cast< ::kvrpcpb::ExistCase >(case__);
 }
-inline void KvSetRequest::set_case_(::kvrpcpb::ExistCase value) {
+inline void KvBatchSetRequest::set_case_(::kvrpcpb::ExistCase value) {
   
   case__ = value;
-  // @@protoc_insertion_point(field_set:kvrpcpb.KvSetRequest.case)
+  // @@protoc_insertion_point(field_set:kvrpcpb.KvBatchSetRequest.case)
 }
 
 // -------------------------------------------------------------------
 
-// KvSetResponse
+// KvBatchSetResponse
 
 // int32 code = 1;
-inline void KvSetResponse::clear_code() {
+inline void KvBatchSetResponse::clear_code() {
   code_ = 0;
 }
-inline ::google::protobuf::int32 KvSetResponse::code() const {
-  // @@protoc_insertion_point(field_get:kvrpcpb.KvSetResponse.code)
+inline ::google::protobuf::int32 KvBatchSetResponse::code() const {
+  // @@protoc_insertion_point(field_get:kvrpcpb.KvBatchSetResponse.code)
   return code_;
 }
-inline void KvSetResponse::set_code(::google::protobuf::int32 value) {
+inline void KvBatchSetResponse::set_code(::google::protobuf::int32 value) {
   
   code_ = value;
-  // @@protoc_insertion_point(field_set:kvrpcpb.KvSetResponse.code)
+  // @@protoc_insertion_point(field_set:kvrpcpb.KvBatchSetResponse.code)
 }
 
 // uint64 affected_keys = 2;
-inline void KvSetResponse::clear_affected_keys() {
+inline void KvBatchSetResponse::clear_affected_keys() {
   affected_keys_ = GOOGLE_ULONGLONG(0);
 }
-inline ::google::protobuf::uint64 KvSetResponse::affected_keys() const {
-  // @@protoc_insertion_point(field_get:kvrpcpb.KvSetResponse.affected_keys)
+inline ::google::protobuf::uint64 KvBatchSetResponse::affected_keys() const {
+  // @@protoc_insertion_point(field_get:kvrpcpb.KvBatchSetResponse.affected_keys)
   return affected_keys_;
 }
-inline void KvSetResponse::set_affected_keys(::google::protobuf::uint64 value) {
+inline void KvBatchSetResponse::set_affected_keys(::google::protobuf::uint64 value) {
   
   affected_keys_ = value;
-  // @@protoc_insertion_point(field_set:kvrpcpb.KvSetResponse.affected_keys)
+  // @@protoc_insertion_point(field_set:kvrpcpb.KvBatchSetResponse.affected_keys)
 }
 
 // -------------------------------------------------------------------
 
-// DsKvSetRequest
+// DsKvBatchSetRequest
 
 // .kvrpcpb.RequestHeader header = 1;
-inline bool DsKvSetRequest::has_header() const {
+inline bool DsKvBatchSetRequest::has_header() const {
   return this != internal_default_instance() && header_ != NULL;
 }
-inline void DsKvSetRequest::clear_header() {
+inline void DsKvBatchSetRequest::clear_header() {
   if (GetArenaNoVirtual() == NULL && header_ != NULL) delete header_;
   header_ = NULL;
 }
-inline const ::kvrpcpb::RequestHeader& DsKvSetRequest::header() const {
+inline const ::kvrpcpb::RequestHeader& DsKvBatchSetRequest::header() const {
   const ::kvrpcpb::RequestHeader* p = header_;
-  // @@protoc_insertion_point(field_get:kvrpcpb.DsKvSetRequest.header)
+  // @@protoc_insertion_point(field_get:kvrpcpb.DsKvBatchSetRequest.header)
   return p != NULL ? *p : *reinterpret_cast<const ::kvrpcpb::RequestHeader*>(
       &::kvrpcpb::_RequestHeader_default_instance_);
 }
-inline ::kvrpcpb::RequestHeader* DsKvSetRequest::mutable_header() {
+inline ::kvrpcpb::RequestHeader* DsKvBatchSetRequest::mutable_header() {
   
   if (header_ == NULL) {
     header_ = new ::kvrpcpb::RequestHeader;
   }
-  // @@protoc_insertion_point(field_mutable:kvrpcpb.DsKvSetRequest.header)
+  // @@protoc_insertion_point(field_mutable:kvrpcpb.DsKvBatchSetRequest.header)
   return header_;
 }
-inline ::kvrpcpb::RequestHeader* DsKvSetRequest::release_header() {
-  // @@protoc_insertion_point(field_release:kvrpcpb.DsKvSetRequest.header)
+inline ::kvrpcpb::RequestHeader* DsKvBatchSetRequest::release_header() {
+  // @@protoc_insertion_point(field_release:kvrpcpb.DsKvBatchSetRequest.header)
   
   ::kvrpcpb::RequestHeader* temp = header_;
   header_ = NULL;
   return temp;
 }
-inline void DsKvSetRequest::set_allocated_header(::kvrpcpb::RequestHeader* header) {
+inline void DsKvBatchSetRequest::set_allocated_header(::kvrpcpb::RequestHeader* header) {
   delete header_;
   header_ = header;
   if (header) {
@@ -15223,39 +16741,39 @@ inline void DsKvSetRequest::set_allocated_header(::kvrpcpb::RequestHeader* heade
   } else {
     
   }
-  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.DsKvSetRequest.header)
+  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.DsKvBatchSetRequest.header)
 }
 
-// .kvrpcpb.KvSetRequest req = 2;
-inline bool DsKvSetRequest::has_req() const {
+// .kvrpcpb.KvBatchSetRequest req = 2;
+inline bool DsKvBatchSetRequest::has_req() const {
   return this != internal_default_instance() && req_ != NULL;
 }
-inline void DsKvSetRequest::clear_req() {
+inline void DsKvBatchSetRequest::clear_req() {
   if (GetArenaNoVirtual() == NULL && req_ != NULL) delete req_;
   req_ = NULL;
 }
-inline const ::kvrpcpb::KvSetRequest& DsKvSetRequest::req() const {
-  const ::kvrpcpb::KvSetRequest* p = req_;
-  // @@protoc_insertion_point(field_get:kvrpcpb.DsKvSetRequest.req)
-  return p != NULL ? *p : *reinterpret_cast<const ::kvrpcpb::KvSetRequest*>(
-      &::kvrpcpb::_KvSetRequest_default_instance_);
+inline const ::kvrpcpb::KvBatchSetRequest& DsKvBatchSetRequest::req() const {
+  const ::kvrpcpb::KvBatchSetRequest* p = req_;
+  // @@protoc_insertion_point(field_get:kvrpcpb.DsKvBatchSetRequest.req)
+  return p != NULL ? *p : *reinterpret_cast<const ::kvrpcpb::KvBatchSetRequest*>(
+      &::kvrpcpb::_KvBatchSetRequest_default_instance_);
 }
-inline ::kvrpcpb::KvSetRequest* DsKvSetRequest::mutable_req() {
+inline ::kvrpcpb::KvBatchSetRequest* DsKvBatchSetRequest::mutable_req() {
   
   if (req_ == NULL) {
-    req_ = new ::kvrpcpb::KvSetRequest;
+    req_ = new ::kvrpcpb::KvBatchSetRequest;
   }
-  // @@protoc_insertion_point(field_mutable:kvrpcpb.DsKvSetRequest.req)
+  // @@protoc_insertion_point(field_mutable:kvrpcpb.DsKvBatchSetRequest.req)
   return req_;
 }
-inline ::kvrpcpb::KvSetRequest* DsKvSetRequest::release_req() {
-  // @@protoc_insertion_point(field_release:kvrpcpb.DsKvSetRequest.req)
+inline ::kvrpcpb::KvBatchSetRequest* DsKvBatchSetRequest::release_req() {
+  // @@protoc_insertion_point(field_release:kvrpcpb.DsKvBatchSetRequest.req)
   
-  ::kvrpcpb::KvSetRequest* temp = req_;
+  ::kvrpcpb::KvBatchSetRequest* temp = req_;
   req_ = NULL;
   return temp;
 }
-inline void DsKvSetRequest::set_allocated_req(::kvrpcpb::KvSetRequest* req) {
+inline void DsKvBatchSetRequest::set_allocated_req(::kvrpcpb::KvBatchSetRequest* req) {
   delete req_;
   req_ = req;
   if (req) {
@@ -15263,43 +16781,43 @@ inline void DsKvSetRequest::set_allocated_req(::kvrpcpb::KvSetRequest* req) {
   } else {
     
   }
-  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.DsKvSetRequest.req)
+  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.DsKvBatchSetRequest.req)
 }
 
 // -------------------------------------------------------------------
 
-// DsKvSetResponse
+// DsKvBatchSetResponse
 
 // .kvrpcpb.ResponseHeader header = 1;
-inline bool DsKvSetResponse::has_header() const {
+inline bool DsKvBatchSetResponse::has_header() const {
   return this != internal_default_instance() && header_ != NULL;
 }
-inline void DsKvSetResponse::clear_header() {
+inline void DsKvBatchSetResponse::clear_header() {
   if (GetArenaNoVirtual() == NULL && header_ != NULL) delete header_;
   header_ = NULL;
 }
-inline const ::kvrpcpb::ResponseHeader& DsKvSetResponse::header() const {
+inline const ::kvrpcpb::ResponseHeader& DsKvBatchSetResponse::header() const {
   const ::kvrpcpb::ResponseHeader* p = header_;
-  // @@protoc_insertion_point(field_get:kvrpcpb.DsKvSetResponse.header)
+  // @@protoc_insertion_point(field_get:kvrpcpb.DsKvBatchSetResponse.header)
   return p != NULL ? *p : *reinterpret_cast<const ::kvrpcpb::ResponseHeader*>(
       &::kvrpcpb::_ResponseHeader_default_instance_);
 }
-inline ::kvrpcpb::ResponseHeader* DsKvSetResponse::mutable_header() {
+inline ::kvrpcpb::ResponseHeader* DsKvBatchSetResponse::mutable_header() {
   
   if (header_ == NULL) {
     header_ = new ::kvrpcpb::ResponseHeader;
   }
-  // @@protoc_insertion_point(field_mutable:kvrpcpb.DsKvSetResponse.header)
+  // @@protoc_insertion_point(field_mutable:kvrpcpb.DsKvBatchSetResponse.header)
   return header_;
 }
-inline ::kvrpcpb::ResponseHeader* DsKvSetResponse::release_header() {
-  // @@protoc_insertion_point(field_release:kvrpcpb.DsKvSetResponse.header)
+inline ::kvrpcpb::ResponseHeader* DsKvBatchSetResponse::release_header() {
+  // @@protoc_insertion_point(field_release:kvrpcpb.DsKvBatchSetResponse.header)
   
   ::kvrpcpb::ResponseHeader* temp = header_;
   header_ = NULL;
   return temp;
 }
-inline void DsKvSetResponse::set_allocated_header(::kvrpcpb::ResponseHeader* header) {
+inline void DsKvBatchSetResponse::set_allocated_header(::kvrpcpb::ResponseHeader* header) {
   delete header_;
   header_ = header;
   if (header) {
@@ -15307,39 +16825,39 @@ inline void DsKvSetResponse::set_allocated_header(::kvrpcpb::ResponseHeader* hea
   } else {
     
   }
-  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.DsKvSetResponse.header)
+  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.DsKvBatchSetResponse.header)
 }
 
-// .kvrpcpb.KvSetResponse resp = 2;
-inline bool DsKvSetResponse::has_resp() const {
+// .kvrpcpb.KvBatchSetResponse resp = 2;
+inline bool DsKvBatchSetResponse::has_resp() const {
   return this != internal_default_instance() && resp_ != NULL;
 }
-inline void DsKvSetResponse::clear_resp() {
+inline void DsKvBatchSetResponse::clear_resp() {
   if (GetArenaNoVirtual() == NULL && resp_ != NULL) delete resp_;
   resp_ = NULL;
 }
-inline const ::kvrpcpb::KvSetResponse& DsKvSetResponse::resp() const {
-  const ::kvrpcpb::KvSetResponse* p = resp_;
-  // @@protoc_insertion_point(field_get:kvrpcpb.DsKvSetResponse.resp)
-  return p != NULL ? *p : *reinterpret_cast<const ::kvrpcpb::KvSetResponse*>(
-      &::kvrpcpb::_KvSetResponse_default_instance_);
+inline const ::kvrpcpb::KvBatchSetResponse& DsKvBatchSetResponse::resp() const {
+  const ::kvrpcpb::KvBatchSetResponse* p = resp_;
+  // @@protoc_insertion_point(field_get:kvrpcpb.DsKvBatchSetResponse.resp)
+  return p != NULL ? *p : *reinterpret_cast<const ::kvrpcpb::KvBatchSetResponse*>(
+      &::kvrpcpb::_KvBatchSetResponse_default_instance_);
 }
-inline ::kvrpcpb::KvSetResponse* DsKvSetResponse::mutable_resp() {
+inline ::kvrpcpb::KvBatchSetResponse* DsKvBatchSetResponse::mutable_resp() {
   
   if (resp_ == NULL) {
-    resp_ = new ::kvrpcpb::KvSetResponse;
+    resp_ = new ::kvrpcpb::KvBatchSetResponse;
   }
-  // @@protoc_insertion_point(field_mutable:kvrpcpb.DsKvSetResponse.resp)
+  // @@protoc_insertion_point(field_mutable:kvrpcpb.DsKvBatchSetResponse.resp)
   return resp_;
 }
-inline ::kvrpcpb::KvSetResponse* DsKvSetResponse::release_resp() {
-  // @@protoc_insertion_point(field_release:kvrpcpb.DsKvSetResponse.resp)
+inline ::kvrpcpb::KvBatchSetResponse* DsKvBatchSetResponse::release_resp() {
+  // @@protoc_insertion_point(field_release:kvrpcpb.DsKvBatchSetResponse.resp)
   
-  ::kvrpcpb::KvSetResponse* temp = resp_;
+  ::kvrpcpb::KvBatchSetResponse* temp = resp_;
   resp_ = NULL;
   return temp;
 }
-inline void DsKvSetResponse::set_allocated_resp(::kvrpcpb::KvSetResponse* resp) {
+inline void DsKvBatchSetResponse::set_allocated_resp(::kvrpcpb::KvBatchSetResponse* resp) {
   delete resp_;
   resp_ = resp;
   if (resp) {
@@ -15347,171 +16865,178 @@ inline void DsKvSetResponse::set_allocated_resp(::kvrpcpb::KvSetResponse* resp)
   } else {
     
   }
-  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.DsKvSetResponse.resp)
+  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.DsKvBatchSetResponse.resp)
 }
 
 // -------------------------------------------------------------------
 
-// KvGetRequest
+// KvBatchGetRequest
 
-// bytes key = 1;
-inline void KvGetRequest::clear_key() {
-  key_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+// int32 code = 1;
+inline void KvBatchGetRequest::clear_code() {
+  code_ = 0;
 }
-inline const ::std::string& KvGetRequest::key() const {
-  // @@protoc_insertion_point(field_get:kvrpcpb.KvGetRequest.key)
-  return key_.GetNoArena();
+inline ::google::protobuf::int32 KvBatchGetRequest::code() const {
+  // @@protoc_insertion_point(field_get:kvrpcpb.KvBatchGetRequest.code)
+  return code_;
 }
-inline void KvGetRequest::set_key(const ::std::string& value) {
+inline void KvBatchGetRequest::set_code(::google::protobuf::int32 value) {
   
-  key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:kvrpcpb.KvGetRequest.key)
+  code_ = value;
+  // @@protoc_insertion_point(field_set:kvrpcpb.KvBatchGetRequest.code)
+}
+
+// repeated bytes keys = 2;
+inline int KvBatchGetRequest::keys_size() const {
+  return keys_.size();
+}
+inline void KvBatchGetRequest::clear_keys() {
+  keys_.Clear();
+}
+inline const ::std::string& KvBatchGetRequest::keys(int index) const {
+  // @@protoc_insertion_point(field_get:kvrpcpb.KvBatchGetRequest.keys)
+  return keys_.Get(index);
+}
+inline ::std::string* KvBatchGetRequest::mutable_keys(int index) {
+  // @@protoc_insertion_point(field_mutable:kvrpcpb.KvBatchGetRequest.keys)
+  return keys_.Mutable(index);
+}
+inline void KvBatchGetRequest::set_keys(int index, const ::std::string& value) {
+  // @@protoc_insertion_point(field_set:kvrpcpb.KvBatchGetRequest.keys)
+  keys_.Mutable(index)->assign(value);
 }
 #if LANG_CXX11
-inline void KvGetRequest::set_key(::std::string&& value) {
-  
-  key_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:kvrpcpb.KvGetRequest.key)
+inline void KvBatchGetRequest::set_keys(int index, ::std::string&& value) {
+  // @@protoc_insertion_point(field_set:kvrpcpb.KvBatchGetRequest.keys)
+  keys_.Mutable(index)->assign(std::move(value));
 }
 #endif
-inline void KvGetRequest::set_key(const char* value) {
+inline void KvBatchGetRequest::set_keys(int index, const char* value) {
   GOOGLE_DCHECK(value != NULL);
-  
-  key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:kvrpcpb.KvGetRequest.key)
+  keys_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:kvrpcpb.KvBatchGetRequest.keys)
 }
-inline void KvGetRequest::set_key(const void* value, size_t size) {
-  
-  key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:kvrpcpb.KvGetRequest.key)
+inline void KvBatchGetRequest::set_keys(int index, const void* value, size_t size) {
+  keys_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:kvrpcpb.KvBatchGetRequest.keys)
 }
-inline ::std::string* KvGetRequest::mutable_key() {
-  
-  // @@protoc_insertion_point(field_mutable:kvrpcpb.KvGetRequest.key)
-  return key_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline ::std::string* KvBatchGetRequest::add_keys() {
+  // @@protoc_insertion_point(field_add_mutable:kvrpcpb.KvBatchGetRequest.keys)
+  return keys_.Add();
 }
-inline ::std::string* KvGetRequest::release_key() {
-  // @@protoc_insertion_point(field_release:kvrpcpb.KvGetRequest.key)
-  
-  return key_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void KvBatchGetRequest::add_keys(const ::std::string& value) {
+  keys_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:kvrpcpb.KvBatchGetRequest.keys)
 }
-inline void KvGetRequest::set_allocated_key(::std::string* key) {
-  if (key != NULL) {
-    
-  } else {
-    
-  }
-  key_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), key);
-  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.KvGetRequest.key)
+#if LANG_CXX11
+inline void KvBatchGetRequest::add_keys(::std::string&& value) {
+  keys_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:kvrpcpb.KvBatchGetRequest.keys)
+}
+#endif
+inline void KvBatchGetRequest::add_keys(const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  keys_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:kvrpcpb.KvBatchGetRequest.keys)
+}
+inline void KvBatchGetRequest::add_keys(const void* value, size_t size) {
+  keys_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:kvrpcpb.KvBatchGetRequest.keys)
+}
+inline const ::google::protobuf::RepeatedPtrField< ::std::string>&
+KvBatchGetRequest::keys() const {
+  // @@protoc_insertion_point(field_list:kvrpcpb.KvBatchGetRequest.keys)
+  return keys_;
+}
+inline ::google::protobuf::RepeatedPtrField< ::std::string>*
+KvBatchGetRequest::mutable_keys() {
+  // @@protoc_insertion_point(field_mutable_list:kvrpcpb.KvBatchGetRequest.keys)
+  return &keys_;
 }
 
 // -------------------------------------------------------------------
 
-// KvGetResponse
+// KvBatchGetResponse
 
 // int32 code = 1;
-inline void KvGetResponse::clear_code() {
+inline void KvBatchGetResponse::clear_code() {
   code_ = 0;
 }
-inline ::google::protobuf::int32 KvGetResponse::code() const {
-  // @@protoc_insertion_point(field_get:kvrpcpb.KvGetResponse.code)
+inline ::google::protobuf::int32 KvBatchGetResponse::code() const {
+  // @@protoc_insertion_point(field_get:kvrpcpb.KvBatchGetResponse.code)
   return code_;
 }
-inline void KvGetResponse::set_code(::google::protobuf::int32 value) {
+inline void KvBatchGetResponse::set_code(::google::protobuf::int32 value) {
   
   code_ = value;
-  // @@protoc_insertion_point(field_set:kvrpcpb.KvGetResponse.code)
+  // @@protoc_insertion_point(field_set:kvrpcpb.KvBatchGetResponse.code)
 }
 
-// bytes value = 2;
-inline void KvGetResponse::clear_value() {
-  value_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-inline const ::std::string& KvGetResponse::value() const {
-  // @@protoc_insertion_point(field_get:kvrpcpb.KvGetResponse.value)
-  return value_.GetNoArena();
-}
-inline void KvGetResponse::set_value(const ::std::string& value) {
-  
-  value_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:kvrpcpb.KvGetResponse.value)
-}
-#if LANG_CXX11
-inline void KvGetResponse::set_value(::std::string&& value) {
-  
-  value_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:kvrpcpb.KvGetResponse.value)
+// repeated .kvrpcpb.RedisKeyValue kvs = 2;
+inline int KvBatchGetResponse::kvs_size() const {
+  return kvs_.size();
 }
-#endif
-inline void KvGetResponse::set_value(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  value_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:kvrpcpb.KvGetResponse.value)
+inline void KvBatchGetResponse::clear_kvs() {
+  kvs_.Clear();
 }
-inline void KvGetResponse::set_value(const void* value, size_t size) {
-  
-  value_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:kvrpcpb.KvGetResponse.value)
+inline const ::kvrpcpb::RedisKeyValue& KvBatchGetResponse::kvs(int index) const {
+  // @@protoc_insertion_point(field_get:kvrpcpb.KvBatchGetResponse.kvs)
+  return kvs_.Get(index);
 }
-inline ::std::string* KvGetResponse::mutable_value() {
-  
-  // @@protoc_insertion_point(field_mutable:kvrpcpb.KvGetResponse.value)
-  return value_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline ::kvrpcpb::RedisKeyValue* KvBatchGetResponse::mutable_kvs(int index) {
+  // @@protoc_insertion_point(field_mutable:kvrpcpb.KvBatchGetResponse.kvs)
+  return kvs_.Mutable(index);
 }
-inline ::std::string* KvGetResponse::release_value() {
-  // @@protoc_insertion_point(field_release:kvrpcpb.KvGetResponse.value)
-  
-  return value_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline ::kvrpcpb::RedisKeyValue* KvBatchGetResponse::add_kvs() {
+  // @@protoc_insertion_point(field_add:kvrpcpb.KvBatchGetResponse.kvs)
+  return kvs_.Add();
 }
-inline void KvGetResponse::set_allocated_value(::std::string* value) {
-  if (value != NULL) {
-    
-  } else {
-    
-  }
-  value_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.KvGetResponse.value)
+inline ::google::protobuf::RepeatedPtrField< ::kvrpcpb::RedisKeyValue >*
+KvBatchGetResponse::mutable_kvs() {
+  // @@protoc_insertion_point(field_mutable_list:kvrpcpb.KvBatchGetResponse.kvs)
+  return &kvs_;
+}
+inline const ::google::protobuf::RepeatedPtrField< ::kvrpcpb::RedisKeyValue >&
+KvBatchGetResponse::kvs() const {
+  // @@protoc_insertion_point(field_list:kvrpcpb.KvBatchGetResponse.kvs)
+  return kvs_;
 }
 
 // -------------------------------------------------------------------
 
-// DsKvGetRequest
+// DsKvBatchGetRequest
 
 // .kvrpcpb.RequestHeader header = 1;
-inline bool DsKvGetRequest::has_header() const {
+inline bool DsKvBatchGetRequest::has_header() const {
   return this != internal_default_instance() && header_ != NULL;
 }
-inline void DsKvGetRequest::clear_header() {
+inline void DsKvBatchGetRequest::clear_header() {
   if (GetArenaNoVirtual() == NULL && header_ != NULL) delete header_;
   header_ = NULL;
 }
-inline const ::kvrpcpb::RequestHeader& DsKvGetRequest::header() const {
+inline const ::kvrpcpb::RequestHeader& DsKvBatchGetRequest::header() const {
   const ::kvrpcpb::RequestHeader* p = header_;
-  // @@protoc_insertion_point(field_get:kvrpcpb.DsKvGetRequest.header)
+  // @@protoc_insertion_point(field_get:kvrpcpb.DsKvBatchGetRequest.header)
   return p != NULL ? *p : *reinterpret_cast<const ::kvrpcpb::RequestHeader*>(
       &::kvrpcpb::_RequestHeader_default_instance_);
 }
-inline ::kvrpcpb::RequestHeader* DsKvGetRequest::mutable_header() {
+inline ::kvrpcpb::RequestHeader* DsKvBatchGetRequest::mutable_header() {
   
   if (header_ == NULL) {
     header_ = new ::kvrpcpb::RequestHeader;
   }
-  // @@protoc_insertion_point(field_mutable:kvrpcpb.DsKvGetRequest.header)
+  // @@protoc_insertion_point(field_mutable:kvrpcpb.DsKvBatchGetRequest.header)
   return header_;
 }
-inline ::kvrpcpb::RequestHeader* DsKvGetRequest::release_header() {
-  // @@protoc_insertion_point(field_release:kvrpcpb.DsKvGetRequest.header)
+inline ::kvrpcpb::RequestHeader* DsKvBatchGetRequest::release_header() {
+  // @@protoc_insertion_point(field_release:kvrpcpb.DsKvBatchGetRequest.header)
   
   ::kvrpcpb::RequestHeader* temp = header_;
   header_ = NULL;
   return temp;
 }
-inline void DsKvGetRequest::set_allocated_header(::kvrpcpb::RequestHeader* header) {
+inline void DsKvBatchGetRequest::set_allocated_header(::kvrpcpb::RequestHeader* header) {
   delete header_;
   header_ = header;
   if (header) {
@@ -15519,39 +17044,39 @@ inline void DsKvGetRequest::set_allocated_header(::kvrpcpb::RequestHeader* heade
   } else {
     
   }
-  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.DsKvGetRequest.header)
+  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.DsKvBatchGetRequest.header)
 }
 
-// .kvrpcpb.KvGetRequest req = 2;
-inline bool DsKvGetRequest::has_req() const {
+// .kvrpcpb.KvBatchGetRequest req = 2;
+inline bool DsKvBatchGetRequest::has_req() const {
   return this != internal_default_instance() && req_ != NULL;
 }
-inline void DsKvGetRequest::clear_req() {
+inline void DsKvBatchGetRequest::clear_req() {
   if (GetArenaNoVirtual() == NULL && req_ != NULL) delete req_;
   req_ = NULL;
 }
-inline const ::kvrpcpb::KvGetRequest& DsKvGetRequest::req() const {
-  const ::kvrpcpb::KvGetRequest* p = req_;
-  // @@protoc_insertion_point(field_get:kvrpcpb.DsKvGetRequest.req)
-  return p != NULL ? *p : *reinterpret_cast<const ::kvrpcpb::KvGetRequest*>(
-      &::kvrpcpb::_KvGetRequest_default_instance_);
+inline const ::kvrpcpb::KvBatchGetRequest& DsKvBatchGetRequest::req() const {
+  const ::kvrpcpb::KvBatchGetRequest* p = req_;
+  // @@protoc_insertion_point(field_get:kvrpcpb.DsKvBatchGetRequest.req)
+  return p != NULL ? *p : *reinterpret_cast<const ::kvrpcpb::KvBatchGetRequest*>(
+      &::kvrpcpb::_KvBatchGetRequest_default_instance_);
 }
-inline ::kvrpcpb::KvGetRequest* DsKvGetRequest::mutable_req() {
+inline ::kvrpcpb::KvBatchGetRequest* DsKvBatchGetRequest::mutable_req() {
   
   if (req_ == NULL) {
-    req_ = new ::kvrpcpb::KvGetRequest;
+    req_ = new ::kvrpcpb::KvBatchGetRequest;
   }
-  // @@protoc_insertion_point(field_mutable:kvrpcpb.DsKvGetRequest.req)
+  // @@protoc_insertion_point(field_mutable:kvrpcpb.DsKvBatchGetRequest.req)
   return req_;
 }
-inline ::kvrpcpb::KvGetRequest* DsKvGetRequest::release_req() {
-  // @@protoc_insertion_point(field_release:kvrpcpb.DsKvGetRequest.req)
+inline ::kvrpcpb::KvBatchGetRequest* DsKvBatchGetRequest::release_req() {
+  // @@protoc_insertion_point(field_release:kvrpcpb.DsKvBatchGetRequest.req)
   
-  ::kvrpcpb::KvGetRequest* temp = req_;
+  ::kvrpcpb::KvBatchGetRequest* temp = req_;
   req_ = NULL;
   return temp;
 }
-inline void DsKvGetRequest::set_allocated_req(::kvrpcpb::KvGetRequest* req) {
+inline void DsKvBatchGetRequest::set_allocated_req(::kvrpcpb::KvBatchGetRequest* req) {
   delete req_;
   req_ = req;
   if (req) {
@@ -15559,207 +17084,436 @@ inline void DsKvGetRequest::set_allocated_req(::kvrpcpb::KvGetRequest* req) {
   } else {
     
   }
-  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.DsKvGetRequest.req)
+  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.DsKvBatchGetRequest.req)
 }
 
 // -------------------------------------------------------------------
 
-// DsKvGetResponse
+// DsKvBatchGetResponse
 
 // .kvrpcpb.ResponseHeader header = 1;
-inline bool DsKvGetResponse::has_header() const {
+inline bool DsKvBatchGetResponse::has_header() const {
   return this != internal_default_instance() && header_ != NULL;
 }
-inline void DsKvGetResponse::clear_header() {
+inline void DsKvBatchGetResponse::clear_header() {
   if (GetArenaNoVirtual() == NULL && header_ != NULL) delete header_;
   header_ = NULL;
 }
-inline const ::kvrpcpb::ResponseHeader& DsKvGetResponse::header() const {
+inline const ::kvrpcpb::ResponseHeader& DsKvBatchGetResponse::header() const {
   const ::kvrpcpb::ResponseHeader* p = header_;
-  // @@protoc_insertion_point(field_get:kvrpcpb.DsKvGetResponse.header)
+  // @@protoc_insertion_point(field_get:kvrpcpb.DsKvBatchGetResponse.header)
   return p != NULL ? *p : *reinterpret_cast<const ::kvrpcpb::ResponseHeader*>(
       &::kvrpcpb::_ResponseHeader_default_instance_);
 }
-inline ::kvrpcpb::ResponseHeader* DsKvGetResponse::mutable_header() {
+inline ::kvrpcpb::ResponseHeader* DsKvBatchGetResponse::mutable_header() {
   
   if (header_ == NULL) {
     header_ = new ::kvrpcpb::ResponseHeader;
   }
-  // @@protoc_insertion_point(field_mutable:kvrpcpb.DsKvGetResponse.header)
+  // @@protoc_insertion_point(field_mutable:kvrpcpb.DsKvBatchGetResponse.header)
   return header_;
 }
-inline ::kvrpcpb::ResponseHeader* DsKvGetResponse::release_header() {
-  // @@protoc_insertion_point(field_release:kvrpcpb.DsKvGetResponse.header)
+inline ::kvrpcpb::ResponseHeader* DsKvBatchGetResponse::release_header() {
+  // @@protoc_insertion_point(field_release:kvrpcpb.DsKvBatchGetResponse.header)
+  
+  ::kvrpcpb::ResponseHeader* temp = header_;
+  header_ = NULL;
+  return temp;
+}
+inline void DsKvBatchGetResponse::set_allocated_header(::kvrpcpb::ResponseHeader* header) {
+  delete header_;
+  header_ = header;
+  if (header) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.DsKvBatchGetResponse.header)
+}
+
+// .kvrpcpb.KvBatchGetResponse resp = 2;
+inline bool DsKvBatchGetResponse::has_resp() const {
+  return this != internal_default_instance() && resp_ != NULL;
+}
+inline void DsKvBatchGetResponse::clear_resp() {
+  if (GetArenaNoVirtual() == NULL && resp_ != NULL) delete resp_;
+  resp_ = NULL;
+}
+inline const ::kvrpcpb::KvBatchGetResponse& DsKvBatchGetResponse::resp() const {
+  const ::kvrpcpb::KvBatchGetResponse* p = resp_;
+  // @@protoc_insertion_point(field_get:kvrpcpb.DsKvBatchGetResponse.resp)
+  return p != NULL ? *p : *reinterpret_cast<const ::kvrpcpb::KvBatchGetResponse*>(
+      &::kvrpcpb::_KvBatchGetResponse_default_instance_);
+}
+inline ::kvrpcpb::KvBatchGetResponse* DsKvBatchGetResponse::mutable_resp() {
+  
+  if (resp_ == NULL) {
+    resp_ = new ::kvrpcpb::KvBatchGetResponse;
+  }
+  // @@protoc_insertion_point(field_mutable:kvrpcpb.DsKvBatchGetResponse.resp)
+  return resp_;
+}
+inline ::kvrpcpb::KvBatchGetResponse* DsKvBatchGetResponse::release_resp() {
+  // @@protoc_insertion_point(field_release:kvrpcpb.DsKvBatchGetResponse.resp)
+  
+  ::kvrpcpb::KvBatchGetResponse* temp = resp_;
+  resp_ = NULL;
+  return temp;
+}
+inline void DsKvBatchGetResponse::set_allocated_resp(::kvrpcpb::KvBatchGetResponse* resp) {
+  delete resp_;
+  resp_ = resp;
+  if (resp) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.DsKvBatchGetResponse.resp)
+}
+
+// -------------------------------------------------------------------
+
+// KvScanRequest
+
+// bytes start = 1;
+inline void KvScanRequest::clear_start() {
+  start_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline const ::std::string& KvScanRequest::start() const {
+  // @@protoc_insertion_point(field_get:kvrpcpb.KvScanRequest.start)
+  return start_.GetNoArena();
+}
+inline void KvScanRequest::set_start(const ::std::string& value) {
+  
+  start_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:kvrpcpb.KvScanRequest.start)
+}
+#if LANG_CXX11
+inline void KvScanRequest::set_start(::std::string&& value) {
+  
+  start_.SetNoArena(
+    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:kvrpcpb.KvScanRequest.start)
+}
+#endif
+inline void KvScanRequest::set_start(const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  
+  start_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:kvrpcpb.KvScanRequest.start)
+}
+inline void KvScanRequest::set_start(const void* value, size_t size) {
+  
+  start_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:kvrpcpb.KvScanRequest.start)
+}
+inline ::std::string* KvScanRequest::mutable_start() {
+  
+  // @@protoc_insertion_point(field_mutable:kvrpcpb.KvScanRequest.start)
+  return start_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline ::std::string* KvScanRequest::release_start() {
+  // @@protoc_insertion_point(field_release:kvrpcpb.KvScanRequest.start)
+  
+  return start_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline void KvScanRequest::set_allocated_start(::std::string* start) {
+  if (start != NULL) {
+    
+  } else {
+    
+  }
+  start_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), start);
+  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.KvScanRequest.start)
+}
+
+// bytes limit = 2;
+inline void KvScanRequest::clear_limit() {
+  limit_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline const ::std::string& KvScanRequest::limit() const {
+  // @@protoc_insertion_point(field_get:kvrpcpb.KvScanRequest.limit)
+  return limit_.GetNoArena();
+}
+inline void KvScanRequest::set_limit(const ::std::string& value) {
+  
+  limit_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:kvrpcpb.KvScanRequest.limit)
+}
+#if LANG_CXX11
+inline void KvScanRequest::set_limit(::std::string&& value) {
+  
+  limit_.SetNoArena(
+    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:kvrpcpb.KvScanRequest.limit)
+}
+#endif
+inline void KvScanRequest::set_limit(const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  
+  limit_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:kvrpcpb.KvScanRequest.limit)
+}
+inline void KvScanRequest::set_limit(const void* value, size_t size) {
+  
+  limit_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:kvrpcpb.KvScanRequest.limit)
+}
+inline ::std::string* KvScanRequest::mutable_limit() {
   
-  ::kvrpcpb::ResponseHeader* temp = header_;
-  header_ = NULL;
-  return temp;
+  // @@protoc_insertion_point(field_mutable:kvrpcpb.KvScanRequest.limit)
+  return limit_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline void DsKvGetResponse::set_allocated_header(::kvrpcpb::ResponseHeader* header) {
-  delete header_;
-  header_ = header;
-  if (header) {
+inline ::std::string* KvScanRequest::release_limit() {
+  // @@protoc_insertion_point(field_release:kvrpcpb.KvScanRequest.limit)
+  
+  return limit_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline void KvScanRequest::set_allocated_limit(::std::string* limit) {
+  if (limit != NULL) {
     
   } else {
     
   }
-  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.DsKvGetResponse.header)
+  limit_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), limit);
+  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.KvScanRequest.limit)
 }
 
-// .kvrpcpb.KvGetResponse resp = 2;
-inline bool DsKvGetResponse::has_resp() const {
-  return this != internal_default_instance() && resp_ != NULL;
+// bool count_only = 3;
+inline void KvScanRequest::clear_count_only() {
+  count_only_ = false;
 }
-inline void DsKvGetResponse::clear_resp() {
-  if (GetArenaNoVirtual() == NULL && resp_ != NULL) delete resp_;
-  resp_ = NULL;
+inline bool KvScanRequest::count_only() const {
+  // @@protoc_insertion_point(field_get:kvrpcpb.KvScanRequest.count_only)
+  return count_only_;
 }
-inline const ::kvrpcpb::KvGetResponse& DsKvGetResponse::resp() const {
-  const ::kvrpcpb::KvGetResponse* p = resp_;
-  // @@protoc_insertion_point(field_get:kvrpcpb.DsKvGetResponse.resp)
-  return p != NULL ? *p : *reinterpret_cast<const ::kvrpcpb::KvGetResponse*>(
-      &::kvrpcpb::_KvGetResponse_default_instance_);
+inline void KvScanRequest::set_count_only(bool value) {
+  
+  count_only_ = value;
+  // @@protoc_insertion_point(field_set:kvrpcpb.KvScanRequest.count_only)
 }
-inline ::kvrpcpb::KvGetResponse* DsKvGetResponse::mutable_resp() {
+
+// bool key_only = 4;
+inline void KvScanRequest::clear_key_only() {
+  key_only_ = false;
+}
+inline bool KvScanRequest::key_only() const {
+  // @@protoc_insertion_point(field_get:kvrpcpb.KvScanRequest.key_only)
+  return key_only_;
+}
+inline void KvScanRequest::set_key_only(bool value) {
   
-  if (resp_ == NULL) {
-    resp_ = new ::kvrpcpb::KvGetResponse;
-  }
-  // @@protoc_insertion_point(field_mutable:kvrpcpb.DsKvGetResponse.resp)
-  return resp_;
+  key_only_ = value;
+  // @@protoc_insertion_point(field_set:kvrpcpb.KvScanRequest.key_only)
 }
-inline ::kvrpcpb::KvGetResponse* DsKvGetResponse::release_resp() {
-  // @@protoc_insertion_point(field_release:kvrpcpb.DsKvGetResponse.resp)
+
+// int64 max_count = 5;
+inline void KvScanRequest::clear_max_count() {
+  max_count_ = GOOGLE_LONGLONG(0);
+}
+inline ::google::protobuf::int64 KvScanRequest::max_count() const {
+  // @@protoc_insertion_point(field_get:kvrpcpb.KvScanRequest.max_count)
+  return max_count_;
+}
+inline void KvScanRequest::set_max_count(::google::protobuf::int64 value) {
   
-  ::kvrpcpb::KvGetResponse* temp = resp_;
-  resp_ = NULL;
-  return temp;
+  max_count_ = value;
+  // @@protoc_insertion_point(field_set:kvrpcpb.KvScanRequest.max_count)
 }
-inline void DsKvGetResponse::set_allocated_resp(::kvrpcpb::KvGetResponse* resp) {
-  delete resp_;
-  resp_ = resp;
-  if (resp) {
-    
-  } else {
-    
-  }
-  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.DsKvGetResponse.resp)
+
+// bool open_snapshot = 6;
+inline void KvScanRequest::clear_open_snapshot() {
+  open_snapshot_ = false;
+}
+inline bool KvScanRequest::open_snapshot() const {
+  // @@protoc_insertion_point(field_get:kvrpcpb.KvScanRequest.open_snapshot)
+  return open_snapshot_;
+}
+inline void KvScanRequest::set_open_snapshot(bool value) {
+  
+  open_snapshot_ = value;
+  // @@protoc_insertion_point(field_set:kvrpcpb.KvScanRequest.open_snapshot)
+}
+
+// uint64 snapshot_id = 7;
+inline void KvScanRequest::clear_snapshot_id() {
+  snapshot_id_ = GOOGLE_ULONGLONG(0);
+}
+inline ::google::protobuf::uint64 KvScanRequest::snapshot_id() const {
+  // @@protoc_insertion_point(field_get:kvrpcpb.KvScanRequest.snapshot_id)
+  return snapshot_id_;
+}
+inline void KvScanRequest::set_snapshot_id(::google::protobuf::uint64 value) {
+  
+  snapshot_id_ = value;
+  // @@protoc_insertion_point(field_set:kvrpcpb.KvScanRequest.snapshot_id)
 }
 
 // -------------------------------------------------------------------
 
-// KvBatchSetRequest
+// KvScanResponse
 
-// repeated .kvrpcpb.RedisKeyValue kvs = 1;
-inline int KvBatchSetRequest::kvs_size() const {
+// int32 code = 1;
+inline void KvScanResponse::clear_code() {
+  code_ = 0;
+}
+inline ::google::protobuf::int32 KvScanResponse::code() const {
+  // @@protoc_insertion_point(field_get:kvrpcpb.KvScanResponse.code)
+  return code_;
+}
+inline void KvScanResponse::set_code(::google::protobuf::int32 value) {
+  
+  code_ = value;
+  // @@protoc_insertion_point(field_set:kvrpcpb.KvScanResponse.code)
+}
+
+// int64 count = 2;
+inline void KvScanResponse::clear_count() {
+  count_ = GOOGLE_LONGLONG(0);
+}
+inline ::google::protobuf::int64 KvScanResponse::count() const {
+  // @@protoc_insertion_point(field_get:kvrpcpb.KvScanResponse.count)
+  return count_;
+}
+inline void KvScanResponse::set_count(::google::protobuf::int64 value) {
+  
+  count_ = value;
+  // @@protoc_insertion_point(field_set:kvrpcpb.KvScanResponse.count)
+}
+
+// repeated .kvrpcpb.RedisKeyValue kvs = 3;
+inline int KvScanResponse::kvs_size() const {
   return kvs_.size();
 }
-inline void KvBatchSetRequest::clear_kvs() {
+inline void KvScanResponse::clear_kvs() {
   kvs_.Clear();
 }
-inline const ::kvrpcpb::RedisKeyValue& KvBatchSetRequest::kvs(int index) const {
-  // @@protoc_insertion_point(field_get:kvrpcpb.KvBatchSetRequest.kvs)
+inline const ::kvrpcpb::RedisKeyValue& KvScanResponse::kvs(int index) const {
+  // @@protoc_insertion_point(field_get:kvrpcpb.KvScanResponse.kvs)
   return kvs_.Get(index);
 }
-inline ::kvrpcpb::RedisKeyValue* KvBatchSetRequest::mutable_kvs(int index) {
-  // @@protoc_insertion_point(field_mutable:kvrpcpb.KvBatchSetRequest.kvs)
+inline ::kvrpcpb::RedisKeyValue* KvScanResponse::mutable_kvs(int index) {
+  // @@protoc_insertion_point(field_mutable:kvrpcpb.KvScanResponse.kvs)
   return kvs_.Mutable(index);
 }
-inline ::kvrpcpb::RedisKeyValue* KvBatchSetRequest::add_kvs() {
-  // @@protoc_insertion_point(field_add:kvrpcpb.KvBatchSetRequest.kvs)
+inline ::kvrpcpb::RedisKeyValue* KvScanResponse::add_kvs() {
+  // @@protoc_insertion_point(field_add:kvrpcpb.KvScanResponse.kvs)
   return kvs_.Add();
 }
 inline ::google::protobuf::RepeatedPtrField< ::kvrpcpb::RedisKeyValue >*
-KvBatchSetRequest::mutable_kvs() {
-  // @@protoc_insertion_point(field_mutable_list:kvrpcpb.KvBatchSetRequest.kvs)
+KvScanResponse::mutable_kvs() {
+  // @@protoc_insertion_point(field_mutable_list:kvrpcpb.KvScanResponse.kvs)
   return &kvs_;
 }
 inline const ::google::protobuf::RepeatedPtrField< ::kvrpcpb::RedisKeyValue >&
-KvBatchSetRequest::kvs() const {
-  // @@protoc_insertion_point(field_list:kvrpcpb.KvBatchSetRequest.kvs)
+KvScanResponse::kvs() const {
+  // @@protoc_insertion_point(field_list:kvrpcpb.KvScanResponse.kvs)
   return kvs_;
 }
 
-// .kvrpcpb.ExistCase case = 2;
-inline void KvBatchSetRequest::clear_case_() {
-  case__ = 0;
+// bytes last_key = 4;
+inline void KvScanResponse::clear_last_key() {
+  last_key_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline ::kvrpcpb::ExistCase KvBatchSetRequest::case_() const {
-  // @@protoc_insertion_point(field_get:kvrpcpb.KvBatchSetRequest.case)
-  return static_cast< ::kvrpcpb::ExistCase >(case__);
+inline const ::std::string& KvScanResponse::last_key() const {
+  // @@protoc_insertion_point(field_get:kvrpcpb.KvScanResponse.last_key)
+  return last_key_.GetNoArena();
 }
-inline void KvBatchSetRequest::set_case_(::kvrpcpb::ExistCase value) {
+inline void KvScanResponse::set_last_key(const ::std::string& value) {
   
-  case__ = value;
-  // @@protoc_insertion_point(field_set:kvrpcpb.KvBatchSetRequest.case)
+  last_key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:kvrpcpb.KvScanResponse.last_key)
 }
-
-// -------------------------------------------------------------------
-
-// KvBatchSetResponse
-
-// int32 code = 1;
-inline void KvBatchSetResponse::clear_code() {
-  code_ = 0;
+#if LANG_CXX11
+inline void KvScanResponse::set_last_key(::std::string&& value) {
+  
+  last_key_.SetNoArena(
+    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:kvrpcpb.KvScanResponse.last_key)
 }
-inline ::google::protobuf::int32 KvBatchSetResponse::code() const {
-  // @@protoc_insertion_point(field_get:kvrpcpb.KvBatchSetResponse.code)
-  return code_;
+#endif
+inline void KvScanResponse::set_last_key(const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  
+  last_key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:kvrpcpb.KvScanResponse.last_key)
 }
-inline void KvBatchSetResponse::set_code(::google::protobuf::int32 value) {
+inline void KvScanResponse::set_last_key(const void* value, size_t size) {
   
-  code_ = value;
-  // @@protoc_insertion_point(field_set:kvrpcpb.KvBatchSetResponse.code)
+  last_key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:kvrpcpb.KvScanResponse.last_key)
+}
+inline ::std::string* KvScanResponse::mutable_last_key() {
+  
+  // @@protoc_insertion_point(field_mutable:kvrpcpb.KvScanResponse.last_key)
+  return last_key_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline ::std::string* KvScanResponse::release_last_key() {
+  // @@protoc_insertion_point(field_release:kvrpcpb.KvScanResponse.last_key)
+  
+  return last_key_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline void KvScanResponse::set_allocated_last_key(::std::string* last_key) {
+  if (last_key != NULL) {
+    
+  } else {
+    
+  }
+  last_key_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), last_key);
+  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.KvScanResponse.last_key)
 }
 
-// uint64 affected_keys = 2;
-inline void KvBatchSetResponse::clear_affected_keys() {
-  affected_keys_ = GOOGLE_ULONGLONG(0);
+// uint64 snapshot_id = 5;
+inline void KvScanResponse::clear_snapshot_id() {
+  snapshot_id_ = GOOGLE_ULONGLONG(0);
 }
-inline ::google::protobuf::uint64 KvBatchSetResponse::affected_keys() const {
-  // @@protoc_insertion_point(field_get:kvrpcpb.KvBatchSetResponse.affected_keys)
-  return affected_keys_;
+inline ::google::protobuf::uint64 KvScanResponse::snapshot_id() const {
+  // @@protoc_insertion_point(field_get:kvrpcpb.KvScanResponse.snapshot_id)
+  return snapshot_id_;
 }
-inline void KvBatchSetResponse::set_affected_keys(::google::protobuf::uint64 value) {
+inline void KvScanResponse::set_snapshot_id(::google::protobuf::uint64 value) {
   
-  affected_keys_ = value;
-  // @@protoc_insertion_point(field_set:kvrpcpb.KvBatchSetResponse.affected_keys)
+  snapshot_id_ = value;
+  // @@protoc_insertion_point(field_set:kvrpcpb.KvScanResponse.snapshot_id)
 }
 
 // -------------------------------------------------------------------
 
-// DsKvBatchSetRequest
+// DsKvScanRequest
 
 // .kvrpcpb.RequestHeader header = 1;
-inline bool DsKvBatchSetRequest::has_header() const {
+inline bool DsKvScanRequest::has_header() const {
   return this != internal_default_instance() && header_ != NULL;
 }
-inline void DsKvBatchSetRequest::clear_header() {
+inline void DsKvScanRequest::clear_header() {
   if (GetArenaNoVirtual() == NULL && header_ != NULL) delete header_;
   header_ = NULL;
 }
-inline const ::kvrpcpb::RequestHeader& DsKvBatchSetRequest::header() const {
+inline const ::kvrpcpb::RequestHeader& DsKvScanRequest::header() const {
   const ::kvrpcpb::RequestHeader* p = header_;
-  // @@protoc_insertion_point(field_get:kvrpcpb.DsKvBatchSetRequest.header)
+  // @@protoc_insertion_point(field_get:kvrpcpb.DsKvScanRequest.header)
   return p != NULL ? *p : *reinterpret_cast<const ::kvrpcpb::RequestHeader*>(
       &::kvrpcpb::_RequestHeader_default_instance_);
 }
-inline ::kvrpcpb::RequestHeader* DsKvBatchSetRequest::mutable_header() {
+inline ::kvrpcpb::RequestHeader* DsKvScanRequest::mutable_header() {
   
   if (header_ == NULL) {
     header_ = new ::kvrpcpb::RequestHeader;
   }
-  // @@protoc_insertion_point(field_mutable:kvrpcpb.DsKvBatchSetRequest.header)
+  // @@protoc_insertion_point(field_mutable:kvrpcpb.DsKvScanRequest.header)
   return header_;
 }
-inline ::kvrpcpb::RequestHeader* DsKvBatchSetRequest::release_header() {
-  // @@protoc_insertion_point(field_release:kvrpcpb.DsKvBatchSetRequest.header)
+inline ::kvrpcpb::RequestHeader* DsKvScanRequest::release_header() {
+  // @@protoc_insertion_point(field_release:kvrpcpb.DsKvScanRequest.header)
   
   ::kvrpcpb::RequestHeader* temp = header_;
   header_ = NULL;
   return temp;
 }
-inline void DsKvBatchSetRequest::set_allocated_header(::kvrpcpb::RequestHeader* header) {
+inline void DsKvScanRequest::set_allocated_header(::kvrpcpb::RequestHeader* header) {
   delete header_;
   header_ = header;
   if (header) {
@@ -15767,39 +17521,39 @@ inline void DsKvBatchSetRequest::set_allocated_header(::kvrpcpb::RequestHeader*
   } else {
     
   }
-  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.DsKvBatchSetRequest.header)
+  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.DsKvScanRequest.header)
 }
 
-// .kvrpcpb.KvBatchSetRequest req = 2;
-inline bool DsKvBatchSetRequest::has_req() const {
+// .kvrpcpb.KvScanRequest req = 2;
+inline bool DsKvScanRequest::has_req() const {
   return this != internal_default_instance() && req_ != NULL;
 }
-inline void DsKvBatchSetRequest::clear_req() {
+inline void DsKvScanRequest::clear_req() {
   if (GetArenaNoVirtual() == NULL && req_ != NULL) delete req_;
   req_ = NULL;
 }
-inline const ::kvrpcpb::KvBatchSetRequest& DsKvBatchSetRequest::req() const {
-  const ::kvrpcpb::KvBatchSetRequest* p = req_;
-  // @@protoc_insertion_point(field_get:kvrpcpb.DsKvBatchSetRequest.req)
-  return p != NULL ? *p : *reinterpret_cast<const ::kvrpcpb::KvBatchSetRequest*>(
-      &::kvrpcpb::_KvBatchSetRequest_default_instance_);
+inline const ::kvrpcpb::KvScanRequest& DsKvScanRequest::req() const {
+  const ::kvrpcpb::KvScanRequest* p = req_;
+  // @@protoc_insertion_point(field_get:kvrpcpb.DsKvScanRequest.req)
+  return p != NULL ? *p : *reinterpret_cast<const ::kvrpcpb::KvScanRequest*>(
+      &::kvrpcpb::_KvScanRequest_default_instance_);
 }
-inline ::kvrpcpb::KvBatchSetRequest* DsKvBatchSetRequest::mutable_req() {
+inline ::kvrpcpb::KvScanRequest* DsKvScanRequest::mutable_req() {
   
   if (req_ == NULL) {
-    req_ = new ::kvrpcpb::KvBatchSetRequest;
+    req_ = new ::kvrpcpb::KvScanRequest;
   }
-  // @@protoc_insertion_point(field_mutable:kvrpcpb.DsKvBatchSetRequest.req)
+  // @@protoc_insertion_point(field_mutable:kvrpcpb.DsKvScanRequest.req)
   return req_;
 }
-inline ::kvrpcpb::KvBatchSetRequest* DsKvBatchSetRequest::release_req() {
-  // @@protoc_insertion_point(field_release:kvrpcpb.DsKvBatchSetRequest.req)
+inline ::kvrpcpb::KvScanRequest* DsKvScanRequest::release_req() {
+  // @@protoc_insertion_point(field_release:kvrpcpb.DsKvScanRequest.req)
   
-  ::kvrpcpb::KvBatchSetRequest* temp = req_;
+  ::kvrpcpb::KvScanRequest* temp = req_;
   req_ = NULL;
   return temp;
 }
-inline void DsKvBatchSetRequest::set_allocated_req(::kvrpcpb::KvBatchSetRequest* req) {
+inline void DsKvScanRequest::set_allocated_req(::kvrpcpb::KvScanRequest* req) {
   delete req_;
   req_ = req;
   if (req) {
@@ -15807,43 +17561,43 @@ inline void DsKvBatchSetRequest::set_allocated_req(::kvrpcpb::KvBatchSetRequest*
   } else {
     
   }
-  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.DsKvBatchSetRequest.req)
+  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.DsKvScanRequest.req)
 }
 
 // -------------------------------------------------------------------
 
-// DsKvBatchSetResponse
+// DsKvScanResponse
 
 // .kvrpcpb.ResponseHeader header = 1;
-inline bool DsKvBatchSetResponse::has_header() const {
+inline bool DsKvScanResponse::has_header() const {
   return this != internal_default_instance() && header_ != NULL;
 }
-inline void DsKvBatchSetResponse::clear_header() {
+inline void DsKvScanResponse::clear_header() {
   if (GetArenaNoVirtual() == NULL && header_ != NULL) delete header_;
   header_ = NULL;
 }
-inline const ::kvrpcpb::ResponseHeader& DsKvBatchSetResponse::header() const {
+inline const ::kvrpcpb::ResponseHeader& DsKvScanResponse::header() const {
   const ::kvrpcpb::ResponseHeader* p = header_;
-  // @@protoc_insertion_point(field_get:kvrpcpb.DsKvBatchSetResponse.header)
+  // @@protoc_insertion_point(field_get:kvrpcpb.DsKvScanResponse.header)
   return p != NULL ? *p : *reinterpret_cast<const ::kvrpcpb::ResponseHeader*>(
       &::kvrpcpb::_ResponseHeader_default_instance_);
 }
-inline ::kvrpcpb::ResponseHeader* DsKvBatchSetResponse::mutable_header() {
+inline ::kvrpcpb::ResponseHeader* DsKvScanResponse::mutable_header() {
   
   if (header_ == NULL) {
     header_ = new ::kvrpcpb::ResponseHeader;
   }
-  // @@protoc_insertion_point(field_mutable:kvrpcpb.DsKvBatchSetResponse.header)
+  // @@protoc_insertion_point(field_mutable:kvrpcpb.DsKvScanResponse.header)
   return header_;
 }
-inline ::kvrpcpb::ResponseHeader* DsKvBatchSetResponse::release_header() {
-  // @@protoc_insertion_point(field_release:kvrpcpb.DsKvBatchSetResponse.header)
+inline ::kvrpcpb::ResponseHeader* DsKvScanResponse::release_header() {
+  // @@protoc_insertion_point(field_release:kvrpcpb.DsKvScanResponse.header)
   
   ::kvrpcpb::ResponseHeader* temp = header_;
   header_ = NULL;
   return temp;
 }
-inline void DsKvBatchSetResponse::set_allocated_header(::kvrpcpb::ResponseHeader* header) {
+inline void DsKvScanResponse::set_allocated_header(::kvrpcpb::ResponseHeader* header) {
   delete header_;
   header_ = header;
   if (header) {
@@ -15851,39 +17605,39 @@ inline void DsKvBatchSetResponse::set_allocated_header(::kvrpcpb::ResponseHeader
   } else {
     
   }
-  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.DsKvBatchSetResponse.header)
+  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.DsKvScanResponse.header)
 }
 
-// .kvrpcpb.KvBatchSetResponse resp = 2;
-inline bool DsKvBatchSetResponse::has_resp() const {
+// .kvrpcpb.KvScanResponse resp = 2;
+inline bool DsKvScanResponse::has_resp() const {
   return this != internal_default_instance() && resp_ != NULL;
 }
-inline void DsKvBatchSetResponse::clear_resp() {
+inline void DsKvScanResponse::clear_resp() {
   if (GetArenaNoVirtual() == NULL && resp_ != NULL) delete resp_;
   resp_ = NULL;
 }
-inline const ::kvrpcpb::KvBatchSetResponse& DsKvBatchSetResponse::resp() const {
-  const ::kvrpcpb::KvBatchSetResponse* p = resp_;
-  // @@protoc_insertion_point(field_get:kvrpcpb.DsKvBatchSetResponse.resp)
-  return p != NULL ? *p : *reinterpret_cast<const ::kvrpcpb::KvBatchSetResponse*>(
-      &::kvrpcpb::_KvBatchSetResponse_default_instance_);
+inline const ::kvrpcpb::KvScanResponse& DsKvScanResponse::resp() const {
+  const ::kvrpcpb::KvScanResponse* p = resp_;
+  // @@protoc_insertion_point(field_get:kvrpcpb.DsKvScanResponse.resp)
+  return p != NULL ? *p : *reinterpret_cast<const ::kvrpcpb::KvScanResponse*>(
+      &::kvrpcpb::_KvScanResponse_default_instance_);
 }
-inline ::kvrpcpb::KvBatchSetResponse* DsKvBatchSetResponse::mutable_resp() {
+inline ::kvrpcpb::KvScanResponse* DsKvScanResponse::mutable_resp() {
   
   if (resp_ == NULL) {
-    resp_ = new ::kvrpcpb::KvBatchSetResponse;
+    resp_ = new ::kvrpcpb::KvScanResponse;
   }
-  // @@protoc_insertion_point(field_mutable:kvrpcpb.DsKvBatchSetResponse.resp)
+  // @@protoc_insertion_point(field_mutable:kvrpcpb.DsKvScanResponse.resp)
   return resp_;
 }
-inline ::kvrpcpb::KvBatchSetResponse* DsKvBatchSetResponse::release_resp() {
-  // @@protoc_insertion_point(field_release:kvrpcpb.DsKvBatchSetResponse.resp)
+inline ::kvrpcpb::KvScanResponse* DsKvScanResponse::release_resp() {
+  // @@protoc_insertion_point(field_release:kvrpcpb.DsKvScanResponse.resp)
   
-  ::kvrpcpb::KvBatchSetResponse* temp = resp_;
+  ::kvrpcpb::KvScanResponse* temp = resp_;
   resp_ = NULL;
   return temp;
 }
-inline void DsKvBatchSetResponse::set_allocated_resp(::kvrpcpb::KvBatchSetResponse* resp) {
+inline void DsKvScanResponse::set_allocated_resp(::kvrpcpb::KvScanResponse* resp) {
   delete resp_;
   resp_ = resp;
   if (resp) {
@@ -15891,178 +17645,146 @@ inline void DsKvBatchSetResponse::set_allocated_resp(::kvrpcpb::KvBatchSetRespon
   } else {
     
   }
-  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.DsKvBatchSetResponse.resp)
+  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.DsKvScanResponse.resp)
 }
 
 // -------------------------------------------------------------------
 
-// KvBatchGetRequest
+// KvDeleteRequest
 
-// int32 code = 1;
-inline void KvBatchGetRequest::clear_code() {
-  code_ = 0;
+// bytes key = 1;
+inline void KvDeleteRequest::clear_key() {
+  key_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline ::google::protobuf::int32 KvBatchGetRequest::code() const {
-  // @@protoc_insertion_point(field_get:kvrpcpb.KvBatchGetRequest.code)
-  return code_;
+inline const ::std::string& KvDeleteRequest::key() const {
+  // @@protoc_insertion_point(field_get:kvrpcpb.KvDeleteRequest.key)
+  return key_.GetNoArena();
 }
-inline void KvBatchGetRequest::set_code(::google::protobuf::int32 value) {
+inline void KvDeleteRequest::set_key(const ::std::string& value) {
   
-  code_ = value;
-  // @@protoc_insertion_point(field_set:kvrpcpb.KvBatchGetRequest.code)
-}
-
-// repeated bytes keys = 2;
-inline int KvBatchGetRequest::keys_size() const {
-  return keys_.size();
-}
-inline void KvBatchGetRequest::clear_keys() {
-  keys_.Clear();
-}
-inline const ::std::string& KvBatchGetRequest::keys(int index) const {
-  // @@protoc_insertion_point(field_get:kvrpcpb.KvBatchGetRequest.keys)
-  return keys_.Get(index);
-}
-inline ::std::string* KvBatchGetRequest::mutable_keys(int index) {
-  // @@protoc_insertion_point(field_mutable:kvrpcpb.KvBatchGetRequest.keys)
-  return keys_.Mutable(index);
-}
-inline void KvBatchGetRequest::set_keys(int index, const ::std::string& value) {
-  // @@protoc_insertion_point(field_set:kvrpcpb.KvBatchGetRequest.keys)
-  keys_.Mutable(index)->assign(value);
+  key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:kvrpcpb.KvDeleteRequest.key)
 }
 #if LANG_CXX11
-inline void KvBatchGetRequest::set_keys(int index, ::std::string&& value) {
-  // @@protoc_insertion_point(field_set:kvrpcpb.KvBatchGetRequest.keys)
-  keys_.Mutable(index)->assign(std::move(value));
+inline void KvDeleteRequest::set_key(::std::string&& value) {
+  
+  key_.SetNoArena(
+    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:kvrpcpb.KvDeleteRequest.key)
 }
 #endif
-inline void KvBatchGetRequest::set_keys(int index, const char* value) {
+inline void KvDeleteRequest::set_key(const char* value) {
   GOOGLE_DCHECK(value != NULL);
-  keys_.Mutable(index)->assign(value);
-  // @@protoc_insertion_point(field_set_char:kvrpcpb.KvBatchGetRequest.keys)
-}
-inline void KvBatchGetRequest::set_keys(int index, const void* value, size_t size) {
-  keys_.Mutable(index)->assign(
-    reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_set_pointer:kvrpcpb.KvBatchGetRequest.keys)
+  
+  key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:kvrpcpb.KvDeleteRequest.key)
 }
-inline ::std::string* KvBatchGetRequest::add_keys() {
-  // @@protoc_insertion_point(field_add_mutable:kvrpcpb.KvBatchGetRequest.keys)
-  return keys_.Add();
+inline void KvDeleteRequest::set_key(const void* value, size_t size) {
+  
+  key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:kvrpcpb.KvDeleteRequest.key)
 }
-inline void KvBatchGetRequest::add_keys(const ::std::string& value) {
-  keys_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add:kvrpcpb.KvBatchGetRequest.keys)
+inline ::std::string* KvDeleteRequest::mutable_key() {
+  
+  // @@protoc_insertion_point(field_mutable:kvrpcpb.KvDeleteRequest.key)
+  return key_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-#if LANG_CXX11
-inline void KvBatchGetRequest::add_keys(::std::string&& value) {
-  keys_.Add(std::move(value));
-  // @@protoc_insertion_point(field_add:kvrpcpb.KvBatchGetRequest.keys)
+inline ::std::string* KvDeleteRequest::release_key() {
+  // @@protoc_insertion_point(field_release:kvrpcpb.KvDeleteRequest.key)
+  
+  return key_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-#endif
-inline void KvBatchGetRequest::add_keys(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  keys_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add_char:kvrpcpb.KvBatchGetRequest.keys)
+inline void KvDeleteRequest::set_allocated_key(::std::string* key) {
+  if (key != NULL) {
+    
+  } else {
+    
+  }
+  key_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), key);
+  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.KvDeleteRequest.key)
 }
-inline void KvBatchGetRequest::add_keys(const void* value, size_t size) {
-  keys_.Add()->assign(reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_add_pointer:kvrpcpb.KvBatchGetRequest.keys)
+
+// .kvrpcpb.ExistCase case = 2;
+inline void KvDeleteRequest::clear_case_() {
+  case__ = 0;
 }
-inline const ::google::protobuf::RepeatedPtrField< ::std::string>&
-KvBatchGetRequest::keys() const {
-  // @@protoc_insertion_point(field_list:kvrpcpb.KvBatchGetRequest.keys)
-  return keys_;
+inline ::kvrpcpb::ExistCase KvDeleteRequest::case_() const {
+  // @@protoc_insertion_point(field_get:kvrpcpb.KvDeleteRequest.case)
+  return static_cast< ::kvrpcpb::ExistCase >(case__);
 }
-inline ::google::protobuf::RepeatedPtrField< ::std::string>*
-KvBatchGetRequest::mutable_keys() {
-  // @@protoc_insertion_point(field_mutable_list:kvrpcpb.KvBatchGetRequest.keys)
-  return &keys_;
+inline void KvDeleteRequest::set_case_(::kvrpcpb::ExistCase value) {
+  
+  case__ = value;
+  // @@protoc_insertion_point(field_set:kvrpcpb.KvDeleteRequest.case)
 }
 
 // -------------------------------------------------------------------
 
-// KvBatchGetResponse
+// KvDeleteResponse
 
 // int32 code = 1;
-inline void KvBatchGetResponse::clear_code() {
+inline void KvDeleteResponse::clear_code() {
   code_ = 0;
 }
-inline ::google::protobuf::int32 KvBatchGetResponse::code() const {
-  // @@protoc_insertion_point(field_get:kvrpcpb.KvBatchGetResponse.code)
+inline ::google::protobuf::int32 KvDeleteResponse::code() const {
+  // @@protoc_insertion_point(field_get:kvrpcpb.KvDeleteResponse.code)
   return code_;
 }
-inline void KvBatchGetResponse::set_code(::google::protobuf::int32 value) {
+inline void KvDeleteResponse::set_code(::google::protobuf::int32 value) {
   
   code_ = value;
-  // @@protoc_insertion_point(field_set:kvrpcpb.KvBatchGetResponse.code)
+  // @@protoc_insertion_point(field_set:kvrpcpb.KvDeleteResponse.code)
 }
 
-// repeated .kvrpcpb.RedisKeyValue kvs = 2;
-inline int KvBatchGetResponse::kvs_size() const {
-  return kvs_.size();
-}
-inline void KvBatchGetResponse::clear_kvs() {
-  kvs_.Clear();
-}
-inline const ::kvrpcpb::RedisKeyValue& KvBatchGetResponse::kvs(int index) const {
-  // @@protoc_insertion_point(field_get:kvrpcpb.KvBatchGetResponse.kvs)
-  return kvs_.Get(index);
-}
-inline ::kvrpcpb::RedisKeyValue* KvBatchGetResponse::mutable_kvs(int index) {
-  // @@protoc_insertion_point(field_mutable:kvrpcpb.KvBatchGetResponse.kvs)
-  return kvs_.Mutable(index);
-}
-inline ::kvrpcpb::RedisKeyValue* KvBatchGetResponse::add_kvs() {
-  // @@protoc_insertion_point(field_add:kvrpcpb.KvBatchGetResponse.kvs)
-  return kvs_.Add();
+// uint64 affected_keys = 2;
+inline void KvDeleteResponse::clear_affected_keys() {
+  affected_keys_ = GOOGLE_ULONGLONG(0);
 }
-inline ::google::protobuf::RepeatedPtrField< ::kvrpcpb::RedisKeyValue >*
-KvBatchGetResponse::mutable_kvs() {
-  // @@protoc_insertion_point(field_mutable_list:kvrpcpb.KvBatchGetResponse.kvs)
-  return &kvs_;
+inline ::google::protobuf::uint64 KvDeleteResponse::affected_keys() const {
+  // @@protoc_insertion_point(field_get:kvrpcpb.KvDeleteResponse.affected_keys)
+  return affected_keys_;
 }
-inline const ::google::protobuf::RepeatedPtrField< ::kvrpcpb::RedisKeyValue >&
-KvBatchGetResponse::kvs() const {
-  // @@protoc_insertion_point(field_list:kvrpcpb.KvBatchGetResponse.kvs)
-  return kvs_;
+inline void KvDeleteResponse::set_affected_keys(::google::protobuf::uint64 value) {
+  
+  affected_keys_ = value;
+  // @@protoc_insertion_point(field_set:kvrpcpb.KvDeleteResponse.affected_keys)
 }
 
 // -------------------------------------------------------------------
 
-// DsKvBatchGetRequest
+// DsKvDeleteRequest
 
 // .kvrpcpb.RequestHeader header = 1;
-inline bool DsKvBatchGetRequest::has_header() const {
+inline bool DsKvDeleteRequest::has_header() const {
   return this != internal_default_instance() && header_ != NULL;
 }
-inline void DsKvBatchGetRequest::clear_header() {
+inline void DsKvDeleteRequest::clear_header() {
   if (GetArenaNoVirtual() == NULL && header_ != NULL) delete header_;
   header_ = NULL;
 }
-inline const ::kvrpcpb::RequestHeader& DsKvBatchGetRequest::header() const {
+inline const ::kvrpcpb::RequestHeader& DsKvDeleteRequest::header() const {
   const ::kvrpcpb::RequestHeader* p = header_;
-  // @@protoc_insertion_point(field_get:kvrpcpb.DsKvBatchGetRequest.header)
+  // @@protoc_insertion_point(field_get:kvrpcpb.DsKvDeleteRequest.header)
   return p != NULL ? *p : *reinterpret_cast<const ::kvrpcpb::RequestHeader*>(
       &::kvrpcpb::_RequestHeader_default_instance_);
 }
-inline ::kvrpcpb::RequestHeader* DsKvBatchGetRequest::mutable_header() {
+inline ::kvrpcpb::RequestHeader* DsKvDeleteRequest::mutable_header() {
   
   if (header_ == NULL) {
     header_ = new ::kvrpcpb::RequestHeader;
   }
-  // @@protoc_insertion_point(field_mutable:kvrpcpb.DsKvBatchGetRequest.header)
+  // @@protoc_insertion_point(field_mutable:kvrpcpb.DsKvDeleteRequest.header)
   return header_;
 }
-inline ::kvrpcpb::RequestHeader* DsKvBatchGetRequest::release_header() {
-  // @@protoc_insertion_point(field_release:kvrpcpb.DsKvBatchGetRequest.header)
+inline ::kvrpcpb::RequestHeader* DsKvDeleteRequest::release_header() {
+  // @@protoc_insertion_point(field_release:kvrpcpb.DsKvDeleteRequest.header)
   
   ::kvrpcpb::RequestHeader* temp = header_;
   header_ = NULL;
   return temp;
 }
-inline void DsKvBatchGetRequest::set_allocated_header(::kvrpcpb::RequestHeader* header) {
+inline void DsKvDeleteRequest::set_allocated_header(::kvrpcpb::RequestHeader* header) {
   delete header_;
   header_ = header;
   if (header) {
@@ -16070,39 +17792,39 @@ inline void DsKvBatchGetRequest::set_allocated_header(::kvrpcpb::RequestHeader*
   } else {
     
   }
-  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.DsKvBatchGetRequest.header)
+  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.DsKvDeleteRequest.header)
 }
 
-// .kvrpcpb.KvBatchGetRequest req = 2;
-inline bool DsKvBatchGetRequest::has_req() const {
+// .kvrpcpb.KvDeleteRequest req = 2;
+inline bool DsKvDeleteRequest::has_req() const {
   return this != internal_default_instance() && req_ != NULL;
 }
-inline void DsKvBatchGetRequest::clear_req() {
+inline void DsKvDeleteRequest::clear_req() {
   if (GetArenaNoVirtual() == NULL && req_ != NULL) delete req_;
   req_ = NULL;
 }
-inline const ::kvrpcpb::KvBatchGetRequest& DsKvBatchGetRequest::req() const {
-  const ::kvrpcpb::KvBatchGetRequest* p = req_;
-  // @@protoc_insertion_point(field_get:kvrpcpb.DsKvBatchGetRequest.req)
-  return p != NULL ? *p : *reinterpret_cast<const ::kvrpcpb::KvBatchGetRequest*>(
-      &::kvrpcpb::_KvBatchGetRequest_default_instance_);
+inline const ::kvrpcpb::KvDeleteRequest& DsKvDeleteRequest::req() const {
+  const ::kvrpcpb::KvDeleteRequest* p = req_;
+  // @@protoc_insertion_point(field_get:kvrpcpb.DsKvDeleteRequest.req)
+  return p != NULL ? *p : *reinterpret_cast<const ::kvrpcpb::KvDeleteRequest*>(
+      &::kvrpcpb::_KvDeleteRequest_default_instance_);
 }
-inline ::kvrpcpb::KvBatchGetRequest* DsKvBatchGetRequest::mutable_req() {
+inline ::kvrpcpb::KvDeleteRequest* DsKvDeleteRequest::mutable_req() {
   
   if (req_ == NULL) {
-    req_ = new ::kvrpcpb::KvBatchGetRequest;
+    req_ = new ::kvrpcpb::KvDeleteRequest;
   }
-  // @@protoc_insertion_point(field_mutable:kvrpcpb.DsKvBatchGetRequest.req)
+  // @@protoc_insertion_point(field_mutable:kvrpcpb.DsKvDeleteRequest.req)
   return req_;
 }
-inline ::kvrpcpb::KvBatchGetRequest* DsKvBatchGetRequest::release_req() {
-  // @@protoc_insertion_point(field_release:kvrpcpb.DsKvBatchGetRequest.req)
+inline ::kvrpcpb::KvDeleteRequest* DsKvDeleteRequest::release_req() {
+  // @@protoc_insertion_point(field_release:kvrpcpb.DsKvDeleteRequest.req)
   
-  ::kvrpcpb::KvBatchGetRequest* temp = req_;
+  ::kvrpcpb::KvDeleteRequest* temp = req_;
   req_ = NULL;
   return temp;
 }
-inline void DsKvBatchGetRequest::set_allocated_req(::kvrpcpb::KvBatchGetRequest* req) {
+inline void DsKvDeleteRequest::set_allocated_req(::kvrpcpb::KvDeleteRequest* req) {
   delete req_;
   req_ = req;
   if (req) {
@@ -16110,43 +17832,43 @@ inline void DsKvBatchGetRequest::set_allocated_req(::kvrpcpb::KvBatchGetRequest*
   } else {
     
   }
-  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.DsKvBatchGetRequest.req)
+  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.DsKvDeleteRequest.req)
 }
 
 // -------------------------------------------------------------------
 
-// DsKvBatchGetResponse
+// DsKvDeleteResponse
 
 // .kvrpcpb.ResponseHeader header = 1;
-inline bool DsKvBatchGetResponse::has_header() const {
+inline bool DsKvDeleteResponse::has_header() const {
   return this != internal_default_instance() && header_ != NULL;
 }
-inline void DsKvBatchGetResponse::clear_header() {
+inline void DsKvDeleteResponse::clear_header() {
   if (GetArenaNoVirtual() == NULL && header_ != NULL) delete header_;
   header_ = NULL;
 }
-inline const ::kvrpcpb::ResponseHeader& DsKvBatchGetResponse::header() const {
+inline const ::kvrpcpb::ResponseHeader& DsKvDeleteResponse::header() const {
   const ::kvrpcpb::ResponseHeader* p = header_;
-  // @@protoc_insertion_point(field_get:kvrpcpb.DsKvBatchGetResponse.header)
+  // @@protoc_insertion_point(field_get:kvrpcpb.DsKvDeleteResponse.header)
   return p != NULL ? *p : *reinterpret_cast<const ::kvrpcpb::ResponseHeader*>(
       &::kvrpcpb::_ResponseHeader_default_instance_);
 }
-inline ::kvrpcpb::ResponseHeader* DsKvBatchGetResponse::mutable_header() {
+inline ::kvrpcpb::ResponseHeader* DsKvDeleteResponse::mutable_header() {
   
   if (header_ == NULL) {
     header_ = new ::kvrpcpb::ResponseHeader;
   }
-  // @@protoc_insertion_point(field_mutable:kvrpcpb.DsKvBatchGetResponse.header)
+  // @@protoc_insertion_point(field_mutable:kvrpcpb.DsKvDeleteResponse.header)
   return header_;
 }
-inline ::kvrpcpb::ResponseHeader* DsKvBatchGetResponse::release_header() {
-  // @@protoc_insertion_point(field_release:kvrpcpb.DsKvBatchGetResponse.header)
+inline ::kvrpcpb::ResponseHeader* DsKvDeleteResponse::release_header() {
+  // @@protoc_insertion_point(field_release:kvrpcpb.DsKvDeleteResponse.header)
   
   ::kvrpcpb::ResponseHeader* temp = header_;
   header_ = NULL;
   return temp;
 }
-inline void DsKvBatchGetResponse::set_allocated_header(::kvrpcpb::ResponseHeader* header) {
+inline void DsKvDeleteResponse::set_allocated_header(::kvrpcpb::ResponseHeader* header) {
   delete header_;
   header_ = header;
   if (header) {
@@ -16154,350 +17876,202 @@ inline void DsKvBatchGetResponse::set_allocated_header(::kvrpcpb::ResponseHeader
   } else {
     
   }
-  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.DsKvBatchGetResponse.header)
+  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.DsKvDeleteResponse.header)
 }
 
-// .kvrpcpb.KvBatchGetResponse resp = 2;
-inline bool DsKvBatchGetResponse::has_resp() const {
+// .kvrpcpb.KvDeleteResponse resp = 2;
+inline bool DsKvDeleteResponse::has_resp() const {
   return this != internal_default_instance() && resp_ != NULL;
 }
-inline void DsKvBatchGetResponse::clear_resp() {
+inline void DsKvDeleteResponse::clear_resp() {
   if (GetArenaNoVirtual() == NULL && resp_ != NULL) delete resp_;
   resp_ = NULL;
 }
-inline const ::kvrpcpb::KvBatchGetResponse& DsKvBatchGetResponse::resp() const {
-  const ::kvrpcpb::KvBatchGetResponse* p = resp_;
-  // @@protoc_insertion_point(field_get:kvrpcpb.DsKvBatchGetResponse.resp)
-  return p != NULL ? *p : *reinterpret_cast<const ::kvrpcpb::KvBatchGetResponse*>(
-      &::kvrpcpb::_KvBatchGetResponse_default_instance_);
+inline const ::kvrpcpb::KvDeleteResponse& DsKvDeleteResponse::resp() const {
+  const ::kvrpcpb::KvDeleteResponse* p = resp_;
+  // @@protoc_insertion_point(field_get:kvrpcpb.DsKvDeleteResponse.resp)
+  return p != NULL ? *p : *reinterpret_cast<const ::kvrpcpb::KvDeleteResponse*>(
+      &::kvrpcpb::_KvDeleteResponse_default_instance_);
 }
-inline ::kvrpcpb::KvBatchGetResponse* DsKvBatchGetResponse::mutable_resp() {
+inline ::kvrpcpb::KvDeleteResponse* DsKvDeleteResponse::mutable_resp() {
   
   if (resp_ == NULL) {
-    resp_ = new ::kvrpcpb::KvBatchGetResponse;
+    resp_ = new ::kvrpcpb::KvDeleteResponse;
   }
-  // @@protoc_insertion_point(field_mutable:kvrpcpb.DsKvBatchGetResponse.resp)
+  // @@protoc_insertion_point(field_mutable:kvrpcpb.DsKvDeleteResponse.resp)
   return resp_;
 }
-inline ::kvrpcpb::KvBatchGetResponse* DsKvBatchGetResponse::release_resp() {
-  // @@protoc_insertion_point(field_release:kvrpcpb.DsKvBatchGetResponse.resp)
+inline ::kvrpcpb::KvDeleteResponse* DsKvDeleteResponse::release_resp() {
+  // @@protoc_insertion_point(field_release:kvrpcpb.DsKvDeleteResponse.resp)
   
-  ::kvrpcpb::KvBatchGetResponse* temp = resp_;
+  ::kvrpcpb::KvDeleteResponse* temp = resp_;
   resp_ = NULL;
   return temp;
 }
-inline void DsKvBatchGetResponse::set_allocated_resp(::kvrpcpb::KvBatchGetResponse* resp) {
+inline void DsKvDeleteResponse::set_allocated_resp(::kvrpcpb::KvDeleteResponse* resp) {
   delete resp_;
-  resp_ = resp;
-  if (resp) {
-    
-  } else {
-    
-  }
-  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.DsKvBatchGetResponse.resp)
-}
-
-// -------------------------------------------------------------------
-
-// KvScanRequest
-
-// bytes start = 1;
-inline void KvScanRequest::clear_start() {
-  start_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-inline const ::std::string& KvScanRequest::start() const {
-  // @@protoc_insertion_point(field_get:kvrpcpb.KvScanRequest.start)
-  return start_.GetNoArena();
-}
-inline void KvScanRequest::set_start(const ::std::string& value) {
-  
-  start_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:kvrpcpb.KvScanRequest.start)
-}
-#if LANG_CXX11
-inline void KvScanRequest::set_start(::std::string&& value) {
-  
-  start_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:kvrpcpb.KvScanRequest.start)
-}
-#endif
-inline void KvScanRequest::set_start(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  start_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:kvrpcpb.KvScanRequest.start)
-}
-inline void KvScanRequest::set_start(const void* value, size_t size) {
-  
-  start_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:kvrpcpb.KvScanRequest.start)
-}
-inline ::std::string* KvScanRequest::mutable_start() {
-  
-  // @@protoc_insertion_point(field_mutable:kvrpcpb.KvScanRequest.start)
-  return start_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-inline ::std::string* KvScanRequest::release_start() {
-  // @@protoc_insertion_point(field_release:kvrpcpb.KvScanRequest.start)
-  
-  return start_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-inline void KvScanRequest::set_allocated_start(::std::string* start) {
-  if (start != NULL) {
-    
-  } else {
-    
-  }
-  start_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), start);
-  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.KvScanRequest.start)
-}
-
-// bytes limit = 2;
-inline void KvScanRequest::clear_limit() {
-  limit_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-inline const ::std::string& KvScanRequest::limit() const {
-  // @@protoc_insertion_point(field_get:kvrpcpb.KvScanRequest.limit)
-  return limit_.GetNoArena();
-}
-inline void KvScanRequest::set_limit(const ::std::string& value) {
-  
-  limit_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:kvrpcpb.KvScanRequest.limit)
-}
-#if LANG_CXX11
-inline void KvScanRequest::set_limit(::std::string&& value) {
-  
-  limit_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:kvrpcpb.KvScanRequest.limit)
-}
-#endif
-inline void KvScanRequest::set_limit(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  limit_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:kvrpcpb.KvScanRequest.limit)
-}
-inline void KvScanRequest::set_limit(const void* value, size_t size) {
-  
-  limit_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:kvrpcpb.KvScanRequest.limit)
-}
-inline ::std::string* KvScanRequest::mutable_limit() {
-  
-  // @@protoc_insertion_point(field_mutable:kvrpcpb.KvScanRequest.limit)
-  return limit_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-inline ::std::string* KvScanRequest::release_limit() {
-  // @@protoc_insertion_point(field_release:kvrpcpb.KvScanRequest.limit)
-  
-  return limit_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-inline void KvScanRequest::set_allocated_limit(::std::string* limit) {
-  if (limit != NULL) {
-    
-  } else {
-    
-  }
-  limit_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), limit);
-  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.KvScanRequest.limit)
-}
-
-// bool count_only = 3;
-inline void KvScanRequest::clear_count_only() {
-  count_only_ = false;
-}
-inline bool KvScanRequest::count_only() const {
-  // @@protoc_insertion_point(field_get:kvrpcpb.KvScanRequest.count_only)
-  return count_only_;
-}
-inline void KvScanRequest::set_count_only(bool value) {
-  
-  count_only_ = value;
-  // @@protoc_insertion_point(field_set:kvrpcpb.KvScanRequest.count_only)
-}
-
-// bool key_only = 4;
-inline void KvScanRequest::clear_key_only() {
-  key_only_ = false;
-}
-inline bool KvScanRequest::key_only() const {
-  // @@protoc_insertion_point(field_get:kvrpcpb.KvScanRequest.key_only)
-  return key_only_;
-}
-inline void KvScanRequest::set_key_only(bool value) {
-  
-  key_only_ = value;
-  // @@protoc_insertion_point(field_set:kvrpcpb.KvScanRequest.key_only)
-}
-
-// int64 max_count = 5;
-inline void KvScanRequest::clear_max_count() {
-  max_count_ = GOOGLE_LONGLONG(0);
-}
-inline ::google::protobuf::int64 KvScanRequest::max_count() const {
-  // @@protoc_insertion_point(field_get:kvrpcpb.KvScanRequest.max_count)
-  return max_count_;
-}
-inline void KvScanRequest::set_max_count(::google::protobuf::int64 value) {
-  
-  max_count_ = value;
-  // @@protoc_insertion_point(field_set:kvrpcpb.KvScanRequest.max_count)
+  resp_ = resp;
+  if (resp) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.DsKvDeleteResponse.resp)
 }
 
 // -------------------------------------------------------------------
 
-// KvScanResponse
+// KvBatchDeleteRequest
 
-// int32 code = 1;
-inline void KvScanResponse::clear_code() {
-  code_ = 0;
+// repeated bytes keys = 1;
+inline int KvBatchDeleteRequest::keys_size() const {
+  return keys_.size();
 }
-inline ::google::protobuf::int32 KvScanResponse::code() const {
-  // @@protoc_insertion_point(field_get:kvrpcpb.KvScanResponse.code)
-  return code_;
+inline void KvBatchDeleteRequest::clear_keys() {
+  keys_.Clear();
 }
-inline void KvScanResponse::set_code(::google::protobuf::int32 value) {
-  
-  code_ = value;
-  // @@protoc_insertion_point(field_set:kvrpcpb.KvScanResponse.code)
+inline const ::std::string& KvBatchDeleteRequest::keys(int index) const {
+  // @@protoc_insertion_point(field_get:kvrpcpb.KvBatchDeleteRequest.keys)
+  return keys_.Get(index);
 }
-
-// int64 count = 2;
-inline void KvScanResponse::clear_count() {
-  count_ = GOOGLE_LONGLONG(0);
+inline ::std::string* KvBatchDeleteRequest::mutable_keys(int index) {
+  // @@protoc_insertion_point(field_mutable:kvrpcpb.KvBatchDeleteRequest.keys)
+  return keys_.Mutable(index);
 }
-inline ::google::protobuf::int64 KvScanResponse::count() const {
-  // @@protoc_insertion_point(field_get:kvrpcpb.KvScanResponse.count)
-  return count_;
+inline void KvBatchDeleteRequest::set_keys(int index, const ::std::string& value) {
+  // @@protoc_insertion_point(field_set:kvrpcpb.KvBatchDeleteRequest.keys)
+  keys_.Mutable(index)->assign(value);
 }
-inline void KvScanResponse::set_count(::google::protobuf::int64 value) {
-  
-  count_ = value;
-  // @@protoc_insertion_point(field_set:kvrpcpb.KvScanResponse.count)
+#if LANG_CXX11
+inline void KvBatchDeleteRequest::set_keys(int index, ::std::string&& value) {
+  // @@protoc_insertion_point(field_set:kvrpcpb.KvBatchDeleteRequest.keys)
+  keys_.Mutable(index)->assign(std::move(value));
 }
-
-// repeated .kvrpcpb.RedisKeyValue kvs = 3;
-inline int KvScanResponse::kvs_size() const {
-  return kvs_.size();
+#endif
+inline void KvBatchDeleteRequest::set_keys(int index, const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  keys_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:kvrpcpb.KvBatchDeleteRequest.keys)
 }
-inline void KvScanResponse::clear_kvs() {
-  kvs_.Clear();
+inline void KvBatchDeleteRequest::set_keys(int index, const void* value, size_t size) {
+  keys_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:kvrpcpb.KvBatchDeleteRequest.keys)
 }
-inline const ::kvrpcpb::RedisKeyValue& KvScanResponse::kvs(int index) const {
-  // @@protoc_insertion_point(field_get:kvrpcpb.KvScanResponse.kvs)
-  return kvs_.Get(index);
+inline ::std::string* KvBatchDeleteRequest::add_keys() {
+  // @@protoc_insertion_point(field_add_mutable:kvrpcpb.KvBatchDeleteRequest.keys)
+  return keys_.Add();
 }
-inline ::kvrpcpb::RedisKeyValue* KvScanResponse::mutable_kvs(int index) {
-  // @@protoc_insertion_point(field_mutable:kvrpcpb.KvScanResponse.kvs)
-  return kvs_.Mutable(index);
+inline void KvBatchDeleteRequest::add_keys(const ::std::string& value) {
+  keys_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:kvrpcpb.KvBatchDeleteRequest.keys)
 }
-inline ::kvrpcpb::RedisKeyValue* KvScanResponse::add_kvs() {
-  // @@protoc_insertion_point(field_add:kvrpcpb.KvScanResponse.kvs)
-  return kvs_.Add();
+#if LANG_CXX11
+inline void KvBatchDeleteRequest::add_keys(::std::string&& value) {
+  keys_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:kvrpcpb.KvBatchDeleteRequest.keys)
 }
-inline ::google::protobuf::RepeatedPtrField< ::kvrpcpb::RedisKeyValue >*
-KvScanResponse::mutable_kvs() {
-  // @@protoc_insertion_point(field_mutable_list:kvrpcpb.KvScanResponse.kvs)
-  return &kvs_;
+#endif
+inline void KvBatchDeleteRequest::add_keys(const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  keys_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:kvrpcpb.KvBatchDeleteRequest.keys)
 }
-inline const ::google::protobuf::RepeatedPtrField< ::kvrpcpb::RedisKeyValue >&
-KvScanResponse::kvs() const {
-  // @@protoc_insertion_point(field_list:kvrpcpb.KvScanResponse.kvs)
-  return kvs_;
+inline void KvBatchDeleteRequest::add_keys(const void* value, size_t size) {
+  keys_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:kvrpcpb.KvBatchDeleteRequest.keys)
+}
+inline const ::google::protobuf::RepeatedPtrField< ::std::string>&
+KvBatchDeleteRequest::keys() const {
+  // @@protoc_insertion_point(field_list:kvrpcpb.KvBatchDeleteRequest.keys)
+  return keys_;
+}
+inline ::google::protobuf::RepeatedPtrField< ::std::string>*
+KvBatchDeleteRequest::mutable_keys() {
+  // @@protoc_insertion_point(field_mutable_list:kvrpcpb.KvBatchDeleteRequest.keys)
+  return &keys_;
 }
 
-// bytes last_key = 4;
-inline void KvScanResponse::clear_last_key() {
-  last_key_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+// .kvrpcpb.ExistCase case = 2;
+inline void KvBatchDeleteRequest::clear_case_() {
+  case__ = 0;
 }
-inline const ::std::string& KvScanResponse::last_key() const {
-  // @@protoc_insertion_point(field_get:kvrpcpb.KvScanResponse.last_key)
-  return last_key_.GetNoArena();
+inline ::kvrpcpb::ExistCase KvBatchDeleteRequest::case_() const {
+  // @@protoc_insertion_point(field_get:kvrpcpb.KvBatchDeleteRequest.case)
+  return static_cast< ::kvrpcpb::ExistCase >(case__);
 }
-inline void KvScanResponse::set_last_key(const ::std::string& value) {
+inline void KvBatchDeleteRequest::set_case_(::kvrpcpb::ExistCase value) {
   
-  last_key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:kvrpcpb.KvScanResponse.last_key)
+  case__ = value;
+  // @@protoc_insertion_point(field_set:kvrpcpb.KvBatchDeleteRequest.case)
 }
-#if LANG_CXX11
-inline void KvScanResponse::set_last_key(::std::string&& value) {
-  
-  last_key_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:kvrpcpb.KvScanResponse.last_key)
+
+// -------------------------------------------------------------------
+
+// KvBatchDeleteResponse
+
+// int32 code = 1;
+inline void KvBatchDeleteResponse::clear_code() {
+  code_ = 0;
 }
-#endif
-inline void KvScanResponse::set_last_key(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  last_key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:kvrpcpb.KvScanResponse.last_key)
+inline ::google::protobuf::int32 KvBatchDeleteResponse::code() const {
+  // @@protoc_insertion_point(field_get:kvrpcpb.KvBatchDeleteResponse.code)
+  return code_;
 }
-inline void KvScanResponse::set_last_key(const void* value, size_t size) {
+inline void KvBatchDeleteResponse::set_code(::google::protobuf::int32 value) {
   
-  last_key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:kvrpcpb.KvScanResponse.last_key)
+  code_ = value;
+  // @@protoc_insertion_point(field_set:kvrpcpb.KvBatchDeleteResponse.code)
 }
-inline ::std::string* KvScanResponse::mutable_last_key() {
-  
-  // @@protoc_insertion_point(field_mutable:kvrpcpb.KvScanResponse.last_key)
-  return last_key_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+
+// uint64 affected_keys = 2;
+inline void KvBatchDeleteResponse::clear_affected_keys() {
+  affected_keys_ = GOOGLE_ULONGLONG(0);
 }
-inline ::std::string* KvScanResponse::release_last_key() {
-  // @@protoc_insertion_point(field_release:kvrpcpb.KvScanResponse.last_key)
-  
-  return last_key_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline ::google::protobuf::uint64 KvBatchDeleteResponse::affected_keys() const {
+  // @@protoc_insertion_point(field_get:kvrpcpb.KvBatchDeleteResponse.affected_keys)
+  return affected_keys_;
 }
-inline void KvScanResponse::set_allocated_last_key(::std::string* last_key) {
-  if (last_key != NULL) {
-    
-  } else {
-    
-  }
-  last_key_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), last_key);
-  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.KvScanResponse.last_key)
+inline void KvBatchDeleteResponse::set_affected_keys(::google::protobuf::uint64 value) {
+  
+  affected_keys_ = value;
+  // @@protoc_insertion_point(field_set:kvrpcpb.KvBatchDeleteResponse.affected_keys)
 }
 
 // -------------------------------------------------------------------
 
-// DsKvScanRequest
+// DsKvBatchDeleteRequest
 
 // .kvrpcpb.RequestHeader header = 1;
-inline bool DsKvScanRequest::has_header() const {
+inline bool DsKvBatchDeleteRequest::has_header() const {
   return this != internal_default_instance() && header_ != NULL;
 }
-inline void DsKvScanRequest::clear_header() {
+inline void DsKvBatchDeleteRequest::clear_header() {
   if (GetArenaNoVirtual() == NULL && header_ != NULL) delete header_;
   header_ = NULL;
 }
-inline const ::kvrpcpb::RequestHeader& DsKvScanRequest::header() const {
+inline const ::kvrpcpb::RequestHeader& DsKvBatchDeleteRequest::header() const {
   const ::kvrpcpb::RequestHeader* p = header_;
-  // @@protoc_insertion_point(field_get:kvrpcpb.DsKvScanRequest.header)
+  // @@protoc_insertion_point(field_get:kvrpcpb.DsKvBatchDeleteRequest.header)
   return p != NULL ? *p : *reinterpret_cast<const ::kvrpcpb::RequestHeader*>(
       &::kvrpcpb::_RequestHeader_default_instance_);
 }
-inline ::kvrpcpb::RequestHeader* DsKvScanRequest::mutable_header() {
+inline ::kvrpcpb::RequestHeader* DsKvBatchDeleteRequest::mutable_header() {
   
   if (header_ == NULL) {
     header_ = new ::kvrpcpb::RequestHeader;
   }
-  // @@protoc_insertion_point(field_mutable:kvrpcpb.DsKvScanRequest.header)
+  // @@protoc_insertion_point(field_mutable:kvrpcpb.DsKvBatchDeleteRequest.header)
   return header_;
 }
-inline ::kvrpcpb::RequestHeader* DsKvScanRequest::release_header() {
-  // @@protoc_insertion_point(field_release:kvrpcpb.DsKvScanRequest.header)
+inline ::kvrpcpb::RequestHeader* DsKvBatchDeleteRequest::release_header() {
+  // @@protoc_insertion_point(field_release:kvrpcpb.DsKvBatchDeleteRequest.header)
   
   ::kvrpcpb::RequestHeader* temp = header_;
   header_ = NULL;
   return temp;
 }
-inline void DsKvScanRequest::set_allocated_header(::kvrpcpb::RequestHeader* header) {
+inline void DsKvBatchDeleteRequest::set_allocated_header(::kvrpcpb::RequestHeader* header) {
   delete header_;
   header_ = header;
   if (header) {
@@ -16505,39 +18079,39 @@ inline void DsKvScanRequest::set_allocated_header(::kvrpcpb::RequestHeader* head
   } else {
     
   }
-  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.DsKvScanRequest.header)
+  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.DsKvBatchDeleteRequest.header)
 }
 
-// .kvrpcpb.KvScanRequest req = 2;
-inline bool DsKvScanRequest::has_req() const {
+// .kvrpcpb.KvBatchDeleteRequest req = 2;
+inline bool DsKvBatchDeleteRequest::has_req() const {
   return this != internal_default_instance() && req_ != NULL;
 }
-inline void DsKvScanRequest::clear_req() {
+inline void DsKvBatchDeleteRequest::clear_req() {
   if (GetArenaNoVirtual() == NULL && req_ != NULL) delete req_;
   req_ = NULL;
 }
-inline const ::kvrpcpb::KvScanRequest& DsKvScanRequest::req() const {
-  const ::kvrpcpb::KvScanRequest* p = req_;
-  // @@protoc_insertion_point(field_get:kvrpcpb.DsKvScanRequest.req)
-  return p != NULL ? *p : *reinterpret_cast<const ::kvrpcpb::KvScanRequest*>(
-      &::kvrpcpb::_KvScanRequest_default_instance_);
+inline const ::kvrpcpb::KvBatchDeleteRequest& DsKvBatchDeleteRequest::req() const {
+  const ::kvrpcpb::KvBatchDeleteRequest* p = req_;
+  // @@protoc_insertion_point(field_get:kvrpcpb.DsKvBatchDeleteRequest.req)
+  return p != NULL ? *p : *reinterpret_cast<const ::kvrpcpb::KvBatchDeleteRequest*>(
+      &::kvrpcpb::_KvBatchDeleteRequest_default_instance_);
 }
-inline ::kvrpcpb::KvScanRequest* DsKvScanRequest::mutable_req() {
+inline ::kvrpcpb::KvBatchDeleteRequest* DsKvBatchDeleteRequest::mutable_req() {
   
   if (req_ == NULL) {
-    req_ = new ::kvrpcpb::KvScanRequest;
+    req_ = new ::kvrpcpb::KvBatchDeleteRequest;
   }
-  // @@protoc_insertion_point(field_mutable:kvrpcpb.DsKvScanRequest.req)
+  // @@protoc_insertion_point(field_mutable:kvrpcpb.DsKvBatchDeleteRequest.req)
   return req_;
 }
-inline ::kvrpcpb::KvScanRequest* DsKvScanRequest::release_req() {
-  // @@protoc_insertion_point(field_release:kvrpcpb.DsKvScanRequest.req)
+inline ::kvrpcpb::KvBatchDeleteRequest* DsKvBatchDeleteRequest::release_req() {
+  // @@protoc_insertion_point(field_release:kvrpcpb.DsKvBatchDeleteRequest.req)
   
-  ::kvrpcpb::KvScanRequest* temp = req_;
+  ::kvrpcpb::KvBatchDeleteRequest* temp = req_;
   req_ = NULL;
   return temp;
 }
-inline void DsKvScanRequest::set_allocated_req(::kvrpcpb::KvScanRequest* req) {
+inline void DsKvBatchDeleteRequest::set_allocated_req(::kvrpcpb::KvBatchDeleteRequest* req) {
   delete req_;
   req_ = req;
   if (req) {
@@ -16545,43 +18119,43 @@ inline void DsKvScanRequest::set_allocated_req(::kvrpcpb::KvScanRequest* req) {
   } else {
     
   }
-  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.DsKvScanRequest.req)
+  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.DsKvBatchDeleteRequest.req)
 }
 
 // -------------------------------------------------------------------
 
-// DsKvScanResponse
+// DsKvBatchDeleteResponse
 
 // .kvrpcpb.ResponseHeader header = 1;
-inline bool DsKvScanResponse::has_header() const {
+inline bool DsKvBatchDeleteResponse::has_header() const {
   return this != internal_default_instance() && header_ != NULL;
 }
-inline void DsKvScanResponse::clear_header() {
+inline void DsKvBatchDeleteResponse::clear_header() {
   if (GetArenaNoVirtual() == NULL && header_ != NULL) delete header_;
   header_ = NULL;
 }
-inline const ::kvrpcpb::ResponseHeader& DsKvScanResponse::header() const {
+inline const ::kvrpcpb::ResponseHeader& DsKvBatchDeleteResponse::header() const {
   const ::kvrpcpb::ResponseHeader* p = header_;
-  // @@protoc_insertion_point(field_get:kvrpcpb.DsKvScanResponse.header)
+  // @@protoc_insertion_point(field_get:kvrpcpb.DsKvBatchDeleteResponse.header)
   return p != NULL ? *p : *reinterpret_cast<const ::kvrpcpb::ResponseHeader*>(
       &::kvrpcpb::_ResponseHeader_default_instance_);
 }
-inline ::kvrpcpb::ResponseHeader* DsKvScanResponse::mutable_header() {
+inline ::kvrpcpb::ResponseHeader* DsKvBatchDeleteResponse::mutable_header() {
   
   if (header_ == NULL) {
     header_ = new ::kvrpcpb::ResponseHeader;
   }
-  // @@protoc_insertion_point(field_mutable:kvrpcpb.DsKvScanResponse.header)
+  // @@protoc_insertion_point(field_mutable:kvrpcpb.DsKvBatchDeleteResponse.header)
   return header_;
 }
-inline ::kvrpcpb::ResponseHeader* DsKvScanResponse::release_header() {
-  // @@protoc_insertion_point(field_release:kvrpcpb.DsKvScanResponse.header)
+inline ::kvrpcpb::ResponseHeader* DsKvBatchDeleteResponse::release_header() {
+  // @@protoc_insertion_point(field_release:kvrpcpb.DsKvBatchDeleteResponse.header)
   
   ::kvrpcpb::ResponseHeader* temp = header_;
   header_ = NULL;
   return temp;
 }
-inline void DsKvScanResponse::set_allocated_header(::kvrpcpb::ResponseHeader* header) {
+inline void DsKvBatchDeleteResponse::set_allocated_header(::kvrpcpb::ResponseHeader* header) {
   delete header_;
   header_ = header;
   if (header) {
@@ -16589,39 +18163,39 @@ inline void DsKvScanResponse::set_allocated_header(::kvrpcpb::ResponseHeader* he
   } else {
     
   }
-  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.DsKvScanResponse.header)
+  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.DsKvBatchDeleteResponse.header)
 }
 
-// .kvrpcpb.KvScanResponse resp = 2;
-inline bool DsKvScanResponse::has_resp() const {
+// .kvrpcpb.KvBatchDeleteResponse resp = 2;
+inline bool DsKvBatchDeleteResponse::has_resp() const {
   return this != internal_default_instance() && resp_ != NULL;
 }
-inline void DsKvScanResponse::clear_resp() {
+inline void DsKvBatchDeleteResponse::clear_resp() {
   if (GetArenaNoVirtual() == NULL && resp_ != NULL) delete resp_;
   resp_ = NULL;
 }
-inline const ::kvrpcpb::KvScanResponse& DsKvScanResponse::resp() const {
-  const ::kvrpcpb::KvScanResponse* p = resp_;
-  // @@protoc_insertion_point(field_get:kvrpcpb.DsKvScanResponse.resp)
-  return p != NULL ? *p : *reinterpret_cast<const ::kvrpcpb::KvScanResponse*>(
-      &::kvrpcpb::_KvScanResponse_default_instance_);
+inline const ::kvrpcpb::KvBatchDeleteResponse& DsKvBatchDeleteResponse::resp() const {
+  const ::kvrpcpb::KvBatchDeleteResponse* p = resp_;
+  // @@protoc_insertion_point(field_get:kvrpcpb.DsKvBatchDeleteResponse.resp)
+  return p != NULL ? *p : *reinterpret_cast<const ::kvrpcpb::KvBatchDeleteResponse*>(
+      &::kvrpcpb::_KvBatchDeleteResponse_default_instance_);
 }
-inline ::kvrpcpb::KvScanResponse* DsKvScanResponse::mutable_resp() {
+inline ::kvrpcpb::KvBatchDeleteResponse* DsKvBatchDeleteResponse::mutable_resp() {
   
   if (resp_ == NULL) {
-    resp_ = new ::kvrpcpb::KvScanResponse;
+    resp_ = new ::kvrpcpb::KvBatchDeleteResponse;
   }
-  // @@protoc_insertion_point(field_mutable:kvrpcpb.DsKvScanResponse.resp)
+  // @@protoc_insertion_point(field_mutable:kvrpcpb.DsKvBatchDeleteResponse.resp)
   return resp_;
 }
-inline ::kvrpcpb::KvScanResponse* DsKvScanResponse::release_resp() {
-  // @@protoc_insertion_point(field_release:kvrpcpb.DsKvScanResponse.resp)
+inline ::kvrpcpb::KvBatchDeleteResponse* DsKvBatchDeleteResponse::release_resp() {
+  // @@protoc_insertion_point(field_release:kvrpcpb.DsKvBatchDeleteResponse.resp)
   
-  ::kvrpcpb::KvScanResponse* temp = resp_;
+  ::kvrpcpb::KvBatchDeleteResponse* temp = resp_;
   resp_ = NULL;
   return temp;
 }
-inline void DsKvScanResponse::set_allocated_resp(::kvrpcpb::KvScanResponse* resp) {
+inline void DsKvBatchDeleteResponse::set_allocated_resp(::kvrpcpb::KvBatchDeleteResponse* resp) {
   delete resp_;
   resp_ = resp;
   if (resp) {
@@ -16629,146 +18203,266 @@ inline void DsKvScanResponse::set_allocated_resp(::kvrpcpb::KvScanResponse* resp
   } else {
     
   }
-  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.DsKvScanResponse.resp)
+  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.DsKvBatchDeleteResponse.resp)
 }
 
 // -------------------------------------------------------------------
 
-// KvDeleteRequest
+// KvRangeDeleteRequest
 
-// bytes key = 1;
-inline void KvDeleteRequest::clear_key() {
-  key_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+// bytes start = 1;
+inline void KvRangeDeleteRequest::clear_start() {
+  start_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline const ::std::string& KvDeleteRequest::key() const {
-  // @@protoc_insertion_point(field_get:kvrpcpb.KvDeleteRequest.key)
-  return key_.GetNoArena();
+inline const ::std::string& KvRangeDeleteRequest::start() const {
+  // @@protoc_insertion_point(field_get:kvrpcpb.KvRangeDeleteRequest.start)
+  return start_.GetNoArena();
 }
-inline void KvDeleteRequest::set_key(const ::std::string& value) {
+inline void KvRangeDeleteRequest::set_start(const ::std::string& value) {
   
-  key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:kvrpcpb.KvDeleteRequest.key)
+  start_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:kvrpcpb.KvRangeDeleteRequest.start)
 }
 #if LANG_CXX11
-inline void KvDeleteRequest::set_key(::std::string&& value) {
+inline void KvRangeDeleteRequest::set_start(::std::string&& value) {
   
-  key_.SetNoArena(
+  start_.SetNoArena(
     &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:kvrpcpb.KvDeleteRequest.key)
+  // @@protoc_insertion_point(field_set_rvalue:kvrpcpb.KvRangeDeleteRequest.start)
 }
 #endif
-inline void KvDeleteRequest::set_key(const char* value) {
+inline void KvRangeDeleteRequest::set_start(const char* value) {
   GOOGLE_DCHECK(value != NULL);
   
-  key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:kvrpcpb.KvDeleteRequest.key)
+  start_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:kvrpcpb.KvRangeDeleteRequest.start)
 }
-inline void KvDeleteRequest::set_key(const void* value, size_t size) {
+inline void KvRangeDeleteRequest::set_start(const void* value, size_t size) {
   
-  key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+  start_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
       ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:kvrpcpb.KvDeleteRequest.key)
+  // @@protoc_insertion_point(field_set_pointer:kvrpcpb.KvRangeDeleteRequest.start)
 }
-inline ::std::string* KvDeleteRequest::mutable_key() {
+inline ::std::string* KvRangeDeleteRequest::mutable_start() {
   
-  // @@protoc_insertion_point(field_mutable:kvrpcpb.KvDeleteRequest.key)
-  return key_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  // @@protoc_insertion_point(field_mutable:kvrpcpb.KvRangeDeleteRequest.start)
+  return start_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline ::std::string* KvDeleteRequest::release_key() {
-  // @@protoc_insertion_point(field_release:kvrpcpb.KvDeleteRequest.key)
+inline ::std::string* KvRangeDeleteRequest::release_start() {
+  // @@protoc_insertion_point(field_release:kvrpcpb.KvRangeDeleteRequest.start)
   
-  return key_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return start_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline void KvDeleteRequest::set_allocated_key(::std::string* key) {
-  if (key != NULL) {
+inline void KvRangeDeleteRequest::set_allocated_start(::std::string* start) {
+  if (start != NULL) {
     
   } else {
     
   }
-  key_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), key);
-  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.KvDeleteRequest.key)
+  start_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), start);
+  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.KvRangeDeleteRequest.start)
 }
 
-// .kvrpcpb.ExistCase case = 2;
-inline void KvDeleteRequest::clear_case_() {
+// bytes limit = 2;
+inline void KvRangeDeleteRequest::clear_limit() {
+  limit_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline const ::std::string& KvRangeDeleteRequest::limit() const {
+  // @@protoc_insertion_point(field_get:kvrpcpb.KvRangeDeleteRequest.limit)
+  return limit_.GetNoArena();
+}
+inline void KvRangeDeleteRequest::set_limit(const ::std::string& value) {
+  
+  limit_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:kvrpcpb.KvRangeDeleteRequest.limit)
+}
+#if LANG_CXX11
+inline void KvRangeDeleteRequest::set_limit(::std::string&& value) {
+  
+  limit_.SetNoArena(
+    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:kvrpcpb.KvRangeDeleteRequest.limit)
+}
+#endif
+inline void KvRangeDeleteRequest::set_limit(const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  
+  limit_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:kvrpcpb.KvRangeDeleteRequest.limit)
+}
+inline void KvRangeDeleteRequest::set_limit(const void* value, size_t size) {
+  
+  limit_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:kvrpcpb.KvRangeDeleteRequest.limit)
+}
+inline ::std::string* KvRangeDeleteRequest::mutable_limit() {
+  
+  // @@protoc_insertion_point(field_mutable:kvrpcpb.KvRangeDeleteRequest.limit)
+  return limit_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline ::std::string* KvRangeDeleteRequest::release_limit() {
+  // @@protoc_insertion_point(field_release:kvrpcpb.KvRangeDeleteRequest.limit)
+  
+  return limit_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline void KvRangeDeleteRequest::set_allocated_limit(::std::string* limit) {
+  if (limit != NULL) {
+    
+  } else {
+    
+  }
+  limit_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), limit);
+  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.KvRangeDeleteRequest.limit)
+}
+
+// int64 max_count = 3;
+inline void KvRangeDeleteRequest::clear_max_count() {
+  max_count_ = GOOGLE_LONGLONG(0);
+}
+inline ::google::protobuf::int64 KvRangeDeleteRequest::max_count() const {
+  // @@protoc_insertion_point(field_get:kvrpcpb.KvRangeDeleteRequest.max_count)
+  return max_count_;
+}
+inline void KvRangeDeleteRequest::set_max_count(::google::protobuf::int64 value) {
+  
+  max_count_ = value;
+  // @@protoc_insertion_point(field_set:kvrpcpb.KvRangeDeleteRequest.max_count)
+}
+
+// .kvrpcpb.ExistCase case = 4;
+inline void KvRangeDeleteRequest::clear_case_() {
   case__ = 0;
 }
-inline ::kvrpcpb::ExistCase KvDeleteRequest::case_() const {
-  // @@protoc_insertion_point(field_get:kvrpcpb.KvDeleteRequest.case)
+inline ::kvrpcpb::ExistCase KvRangeDeleteRequest::case_() const {
+  // @@protoc_insertion_point(field_get:kvrpcpb.KvRangeDeleteRequest.case)
   return static_cast< ::kvrpcpb::ExistCase >(case__);
 }
-inline void KvDeleteRequest::set_case_(::kvrpcpb::ExistCase value) {
+inline void KvRangeDeleteRequest::set_case_(::kvrpcpb::ExistCase value) {
   
   case__ = value;
-  // @@protoc_insertion_point(field_set:kvrpcpb.KvDeleteRequest.case)
+  // @@protoc_insertion_point(field_set:kvrpcpb.KvRangeDeleteRequest.case)
 }
 
 // -------------------------------------------------------------------
 
-// KvDeleteResponse
+// KvRangeDeleteResponse
 
 // int32 code = 1;
-inline void KvDeleteResponse::clear_code() {
+inline void KvRangeDeleteResponse::clear_code() {
   code_ = 0;
 }
-inline ::google::protobuf::int32 KvDeleteResponse::code() const {
-  // @@protoc_insertion_point(field_get:kvrpcpb.KvDeleteResponse.code)
+inline ::google::protobuf::int32 KvRangeDeleteResponse::code() const {
+  // @@protoc_insertion_point(field_get:kvrpcpb.KvRangeDeleteResponse.code)
   return code_;
 }
-inline void KvDeleteResponse::set_code(::google::protobuf::int32 value) {
+inline void KvRangeDeleteResponse::set_code(::google::protobuf::int32 value) {
   
   code_ = value;
-  // @@protoc_insertion_point(field_set:kvrpcpb.KvDeleteResponse.code)
+  // @@protoc_insertion_point(field_set:kvrpcpb.KvRangeDeleteResponse.code)
 }
 
 // uint64 affected_keys = 2;
-inline void KvDeleteResponse::clear_affected_keys() {
+inline void KvRangeDeleteResponse::clear_affected_keys() {
   affected_keys_ = GOOGLE_ULONGLONG(0);
 }
-inline ::google::protobuf::uint64 KvDeleteResponse::affected_keys() const {
-  // @@protoc_insertion_point(field_get:kvrpcpb.KvDeleteResponse.affected_keys)
+inline ::google::protobuf::uint64 KvRangeDeleteResponse::affected_keys() const {
+  // @@protoc_insertion_point(field_get:kvrpcpb.KvRangeDeleteResponse.affected_keys)
   return affected_keys_;
 }
-inline void KvDeleteResponse::set_affected_keys(::google::protobuf::uint64 value) {
+inline void KvRangeDeleteResponse::set_affected_keys(::google::protobuf::uint64 value) {
   
   affected_keys_ = value;
-  // @@protoc_insertion_point(field_set:kvrpcpb.KvDeleteResponse.affected_keys)
+  // @@protoc_insertion_point(field_set:kvrpcpb.KvRangeDeleteResponse.affected_keys)
+}
+
+// bytes last_key = 3;
+inline void KvRangeDeleteResponse::clear_last_key() {
+  last_key_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline const ::std::string& KvRangeDeleteResponse::last_key() const {
+  // @@protoc_insertion_point(field_get:kvrpcpb.KvRangeDeleteResponse.last_key)
+  return last_key_.GetNoArena();
+}
+inline void KvRangeDeleteResponse::set_last_key(const ::std::string& value) {
+  
+  last_key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:kvrpcpb.KvRangeDeleteResponse.last_key)
+}
+#if LANG_CXX11
+inline void KvRangeDeleteResponse::set_last_key(::std::string&& value) {
+  
+  last_key_.SetNoArena(
+    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:kvrpcpb.KvRangeDeleteResponse.last_key)
+}
+#endif
+inline void KvRangeDeleteResponse::set_last_key(const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  
+  last_key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:kvrpcpb.KvRangeDeleteResponse.last_key)
+}
+inline void KvRangeDeleteResponse::set_last_key(const void* value, size_t size) {
+  
+  last_key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:kvrpcpb.KvRangeDeleteResponse.last_key)
+}
+inline ::std::string* KvRangeDeleteResponse::mutable_last_key() {
+  
+  // @@protoc_insertion_point(field_mutable:kvrpcpb.KvRangeDeleteResponse.last_key)
+  return last_key_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline ::std::string* KvRangeDeleteResponse::release_last_key() {
+  // @@protoc_insertion_point(field_release:kvrpcpb.KvRangeDeleteResponse.last_key)
+  
+  return last_key_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline void KvRangeDeleteResponse::set_allocated_last_key(::std::string* last_key) {
+  if (last_key != NULL) {
+    
+  } else {
+    
+  }
+  last_key_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), last_key);
+  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.KvRangeDeleteResponse.last_key)
 }
 
 // -------------------------------------------------------------------
 
-// DsKvDeleteRequest
+// DsKvRangeDeleteRequest
 
 // .kvrpcpb.RequestHeader header = 1;
-inline bool DsKvDeleteRequest::has_header() const {
+inline bool DsKvRangeDeleteRequest::has_header() const {
   return this != internal_default_instance() && header_ != NULL;
 }
-inline void DsKvDeleteRequest::clear_header() {
+inline void DsKvRangeDeleteRequest::clear_header() {
   if (GetArenaNoVirtual() == NULL && header_ != NULL) delete header_;
   header_ = NULL;
 }
-inline const ::kvrpcpb::RequestHeader& DsKvDeleteRequest::header() const {
+inline const ::kvrpcpb::RequestHeader& DsKvRangeDeleteRequest::header() const {
   const ::kvrpcpb::RequestHeader* p = header_;
-  // @@protoc_insertion_point(field_get:kvrpcpb.DsKvDeleteRequest.header)
+  // @@protoc_insertion_point(field_get:kvrpcpb.DsKvRangeDeleteRequest.header)
   return p != NULL ? *p : *reinterpret_cast<const ::kvrpcpb::RequestHeader*>(
       &::kvrpcpb::_RequestHeader_default_instance_);
 }
-inline ::kvrpcpb::RequestHeader* DsKvDeleteRequest::mutable_header() {
+inline ::kvrpcpb::RequestHeader* DsKvRangeDeleteRequest::mutable_header() {
   
   if (header_ == NULL) {
     header_ = new ::kvrpcpb::RequestHeader;
   }
-  // @@protoc_insertion_point(field_mutable:kvrpcpb.DsKvDeleteRequest.header)
+  // @@protoc_insertion_point(field_mutable:kvrpcpb.DsKvRangeDeleteRequest.header)
   return header_;
 }
-inline ::kvrpcpb::RequestHeader* DsKvDeleteRequest::release_header() {
-  // @@protoc_insertion_point(field_release:kvrpcpb.DsKvDeleteRequest.header)
+inline ::kvrpcpb::RequestHeader* DsKvRangeDeleteRequest::release_header() {
+  // @@protoc_insertion_point(field_release:kvrpcpb.DsKvRangeDeleteRequest.header)
   
   ::kvrpcpb::RequestHeader* temp = header_;
   header_ = NULL;
   return temp;
 }
-inline void DsKvDeleteRequest::set_allocated_header(::kvrpcpb::RequestHeader* header) {
+inline void DsKvRangeDeleteRequest::set_allocated_header(::kvrpcpb::RequestHeader* header) {
   delete header_;
   header_ = header;
   if (header) {
@@ -16776,39 +18470,39 @@ inline void DsKvDeleteRequest::set_allocated_header(::kvrpcpb::RequestHeader* he
   } else {
     
   }
-  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.DsKvDeleteRequest.header)
+  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.DsKvRangeDeleteRequest.header)
 }
 
-// .kvrpcpb.KvDeleteRequest req = 2;
-inline bool DsKvDeleteRequest::has_req() const {
+// .kvrpcpb.KvRangeDeleteRequest req = 2;
+inline bool DsKvRangeDeleteRequest::has_req() const {
   return this != internal_default_instance() && req_ != NULL;
 }
-inline void DsKvDeleteRequest::clear_req() {
+inline void DsKvRangeDeleteRequest::clear_req() {
   if (GetArenaNoVirtual() == NULL && req_ != NULL) delete req_;
   req_ = NULL;
 }
-inline const ::kvrpcpb::KvDeleteRequest& DsKvDeleteRequest::req() const {
-  const ::kvrpcpb::KvDeleteRequest* p = req_;
-  // @@protoc_insertion_point(field_get:kvrpcpb.DsKvDeleteRequest.req)
-  return p != NULL ? *p : *reinterpret_cast<const ::kvrpcpb::KvDeleteRequest*>(
-      &::kvrpcpb::_KvDeleteRequest_default_instance_);
+inline const ::kvrpcpb::KvRangeDeleteRequest& DsKvRangeDeleteRequest::req() const {
+  const ::kvrpcpb::KvRangeDeleteRequest* p = req_;
+  // @@protoc_insertion_point(field_get:kvrpcpb.DsKvRangeDeleteRequest.req)
+  return p != NULL ? *p : *reinterpret_cast<const ::kvrpcpb::KvRangeDeleteRequest*>(
+      &::kvrpcpb::_KvRangeDeleteRequest_default_instance_);
 }
-inline ::kvrpcpb::KvDeleteRequest* DsKvDeleteRequest::mutable_req() {
+inline ::kvrpcpb::KvRangeDeleteRequest* DsKvRangeDeleteRequest::mutable_req() {
   
   if (req_ == NULL) {
-    req_ = new ::kvrpcpb::KvDeleteRequest;
+    req_ = new ::kvrpcpb::KvRangeDeleteRequest;
   }
-  // @@protoc_insertion_point(field_mutable:kvrpcpb.DsKvDeleteRequest.req)
+  // @@protoc_insertion_point(field_mutable:kvrpcpb.DsKvRangeDeleteRequest.req)
   return req_;
 }
-inline ::kvrpcpb::KvDeleteRequest* DsKvDeleteRequest::release_req() {
-  // @@protoc_insertion_point(field_release:kvrpcpb.DsKvDeleteRequest.req)
+inline ::kvrpcpb::KvRangeDeleteRequest* DsKvRangeDeleteRequest::release_req() {
+  // @@protoc_insertion_point(field_release:kvrpcpb.DsKvRangeDeleteRequest.req)
   
-  ::kvrpcpb::KvDeleteRequest* temp = req_;
+  ::kvrpcpb::KvRangeDeleteRequest* temp = req_;
   req_ = NULL;
   return temp;
 }
-inline void DsKvDeleteRequest::set_allocated_req(::kvrpcpb::KvDeleteRequest* req) {
+inline void DsKvRangeDeleteRequest::set_allocated_req(::kvrpcpb::KvRangeDeleteRequest* req) {
   delete req_;
   req_ = req;
   if (req) {
@@ -16816,43 +18510,43 @@ inline void DsKvDeleteRequest::set_allocated_req(::kvrpcpb::KvDeleteRequest* req
   } else {
     
   }
-  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.DsKvDeleteRequest.req)
+  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.DsKvRangeDeleteRequest.req)
 }
 
 // -------------------------------------------------------------------
 
-// DsKvDeleteResponse
+// DsKvRangeDeleteResponse
 
 // .kvrpcpb.ResponseHeader header = 1;
-inline bool DsKvDeleteResponse::has_header() const {
+inline bool DsKvRangeDeleteResponse::has_header() const {
   return this != internal_default_instance() && header_ != NULL;
 }
-inline void DsKvDeleteResponse::clear_header() {
+inline void DsKvRangeDeleteResponse::clear_header() {
   if (GetArenaNoVirtual() == NULL && header_ != NULL) delete header_;
   header_ = NULL;
 }
-inline const ::kvrpcpb::ResponseHeader& DsKvDeleteResponse::header() const {
+inline const ::kvrpcpb::ResponseHeader& DsKvRangeDeleteResponse::header() const {
   const ::kvrpcpb::ResponseHeader* p = header_;
-  // @@protoc_insertion_point(field_get:kvrpcpb.DsKvDeleteResponse.header)
+  // @@protoc_insertion_point(field_get:kvrpcpb.DsKvRangeDeleteResponse.header)
   return p != NULL ? *p : *reinterpret_cast<const ::kvrpcpb::ResponseHeader*>(
       &::kvrpcpb::_ResponseHeader_default_instance_);
 }
-inline ::kvrpcpb::ResponseHeader* DsKvDeleteResponse::mutable_header() {
+inline ::kvrpcpb::ResponseHeader* DsKvRangeDeleteResponse::mutable_header() {
   
   if (header_ == NULL) {
     header_ = new ::kvrpcpb::ResponseHeader;
   }
-  // @@protoc_insertion_point(field_mutable:kvrpcpb.DsKvDeleteResponse.header)
+  // @@protoc_insertion_point(field_mutable:kvrpcpb.DsKvRangeDeleteResponse.header)
   return header_;
 }
-inline ::kvrpcpb::ResponseHeader* DsKvDeleteResponse::release_header() {
-  // @@protoc_insertion_point(field_release:kvrpcpb.DsKvDeleteResponse.header)
+inline ::kvrpcpb::ResponseHeader* DsKvRangeDeleteResponse::release_header() {
+  // @@protoc_insertion_point(field_release:kvrpcpb.DsKvRangeDeleteResponse.header)
   
   ::kvrpcpb::ResponseHeader* temp = header_;
   header_ = NULL;
   return temp;
 }
-inline void DsKvDeleteResponse::set_allocated_header(::kvrpcpb::ResponseHeader* header) {
+inline void DsKvRangeDeleteResponse::set_allocated_header(::kvrpcpb::ResponseHeader* header) {
   delete header_;
   header_ = header;
   if (header) {
@@ -16860,39 +18554,39 @@ inline void DsKvDeleteResponse::set_allocated_header(::kvrpcpb::ResponseHeader*
   } else {
     
   }
-  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.DsKvDeleteResponse.header)
+  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.DsKvRangeDeleteResponse.header)
 }
 
-// .kvrpcpb.KvDeleteResponse resp = 2;
-inline bool DsKvDeleteResponse::has_resp() const {
+// .kvrpcpb.KvRangeDeleteResponse resp = 2;
+inline bool DsKvRangeDeleteResponse::has_resp() const {
   return this != internal_default_instance() && resp_ != NULL;
 }
-inline void DsKvDeleteResponse::clear_resp() {
+inline void DsKvRangeDeleteResponse::clear_resp() {
   if (GetArenaNoVirtual() == NULL && resp_ != NULL) delete resp_;
   resp_ = NULL;
 }
-inline const ::kvrpcpb::KvDeleteResponse& DsKvDeleteResponse::resp() const {
-  const ::kvrpcpb::KvDeleteResponse* p = resp_;
-  // @@protoc_insertion_point(field_get:kvrpcpb.DsKvDeleteResponse.resp)
-  return p != NULL ? *p : *reinterpret_cast<const ::kvrpcpb::KvDeleteResponse*>(
-      &::kvrpcpb::_KvDeleteResponse_default_instance_);
+inline const ::kvrpcpb::KvRangeDeleteResponse& DsKvRangeDeleteResponse::resp() const {
+  const ::kvrpcpb::KvRangeDeleteResponse* p = resp_;
+  // @@protoc_insertion_point(field_get:kvrpcpb.DsKvRangeDeleteResponse.resp)
+  return p != NULL ? *p : *reinterpret_cast<const ::kvrpcpb::KvRangeDeleteResponse*>(
+      &::kvrpcpb::_KvRangeDeleteResponse_default_instance_);
 }
-inline ::kvrpcpb::KvDeleteResponse* DsKvDeleteResponse::mutable_resp() {
+inline ::kvrpcpb::KvRangeDeleteResponse* DsKvRangeDeleteResponse::mutable_resp() {
   
   if (resp_ == NULL) {
-    resp_ = new ::kvrpcpb::KvDeleteResponse;
+    resp_ = new ::kvrpcpb::KvRangeDeleteResponse;
   }
-  // @@protoc_insertion_point(field_mutable:kvrpcpb.DsKvDeleteResponse.resp)
+  // @@protoc_insertion_point(field_mutable:kvrpcpb.DsKvRangeDeleteResponse.resp)
   return resp_;
 }
-inline ::kvrpcpb::KvDeleteResponse* DsKvDeleteResponse::release_resp() {
-  // @@protoc_insertion_point(field_release:kvrpcpb.DsKvDeleteResponse.resp)
+inline ::kvrpcpb::KvRangeDeleteResponse* DsKvRangeDeleteResponse::release_resp() {
+  // @@protoc_insertion_point(field_release:kvrpcpb.DsKvRangeDeleteResponse.resp)
   
-  ::kvrpcpb::KvDeleteResponse* temp = resp_;
+  ::kvrpcpb::KvRangeDeleteResponse* temp = resp_;
   resp_ = NULL;
   return temp;
 }
-inline void DsKvDeleteResponse::set_allocated_resp(::kvrpcpb::KvDeleteResponse* resp) {
+inline void DsKvRangeDeleteResponse::set_allocated_resp(::kvrpcpb::KvRangeDeleteResponse* resp) {
   delete resp_;
   resp_ = resp;
   if (resp) {
@@ -16900,162 +18594,132 @@ inline void DsKvDeleteResponse::set_allocated_resp(::kvrpcpb::KvDeleteResponse*
   } else {
     
   }
-  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.DsKvDeleteResponse.resp)
+  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.DsKvRangeDeleteResponse.resp)
 }
 
 // -------------------------------------------------------------------
 
-// KvBatchDeleteRequest
+// KvIncrRequest
 
-// repeated bytes keys = 1;
-inline int KvBatchDeleteRequest::keys_size() const {
-  return keys_.size();
-}
-inline void KvBatchDeleteRequest::clear_keys() {
-  keys_.Clear();
-}
-inline const ::std::string& KvBatchDeleteRequest::keys(int index) const {
-  // @@protoc_insertion_point(field_get:kvrpcpb.KvBatchDeleteRequest.keys)
-  return keys_.Get(index);
+// bytes key = 1;
+inline void KvIncrRequest::clear_key() {
+  key_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline ::std::string* KvBatchDeleteRequest::mutable_keys(int index) {
-  // @@protoc_insertion_point(field_mutable:kvrpcpb.KvBatchDeleteRequest.keys)
-  return keys_.Mutable(index);
+inline const ::std::string& KvIncrRequest::key() const {
+  // @@protoc_insertion_point(field_get:kvrpcpb.KvIncrRequest.key)
+  return key_.GetNoArena();
 }
-inline void KvBatchDeleteRequest::set_keys(int index, const ::std::string& value) {
-  // @@protoc_insertion_point(field_set:kvrpcpb.KvBatchDeleteRequest.keys)
-  keys_.Mutable(index)->assign(value);
+inline void KvIncrRequest::set_key(const ::std::string& value) {
+  
+  key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:kvrpcpb.KvIncrRequest.key)
 }
 #if LANG_CXX11
-inline void KvBatchDeleteRequest::set_keys(int index, ::std::string&& value) {
-  // @@protoc_insertion_point(field_set:kvrpcpb.KvBatchDeleteRequest.keys)
-  keys_.Mutable(index)->assign(std::move(value));
+inline void KvIncrRequest::set_key(::std::string&& value) {
+  
+  key_.SetNoArena(
+    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:kvrpcpb.KvIncrRequest.key)
 }
 #endif
-inline void KvBatchDeleteRequest::set_keys(int index, const char* value) {
+inline void KvIncrRequest::set_key(const char* value) {
   GOOGLE_DCHECK(value != NULL);
-  keys_.Mutable(index)->assign(value);
-  // @@protoc_insertion_point(field_set_char:kvrpcpb.KvBatchDeleteRequest.keys)
-}
-inline void KvBatchDeleteRequest::set_keys(int index, const void* value, size_t size) {
-  keys_.Mutable(index)->assign(
-    reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_set_pointer:kvrpcpb.KvBatchDeleteRequest.keys)
-}
-inline ::std::string* KvBatchDeleteRequest::add_keys() {
-  // @@protoc_insertion_point(field_add_mutable:kvrpcpb.KvBatchDeleteRequest.keys)
-  return keys_.Add();
-}
-inline void KvBatchDeleteRequest::add_keys(const ::std::string& value) {
-  keys_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add:kvrpcpb.KvBatchDeleteRequest.keys)
-}
-#if LANG_CXX11
-inline void KvBatchDeleteRequest::add_keys(::std::string&& value) {
-  keys_.Add(std::move(value));
-  // @@protoc_insertion_point(field_add:kvrpcpb.KvBatchDeleteRequest.keys)
+  
+  key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:kvrpcpb.KvIncrRequest.key)
 }
-#endif
-inline void KvBatchDeleteRequest::add_keys(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  keys_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add_char:kvrpcpb.KvBatchDeleteRequest.keys)
+inline void KvIncrRequest::set_key(const void* value, size_t size) {
+  
+  key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:kvrpcpb.KvIncrRequest.key)
 }
-inline void KvBatchDeleteRequest::add_keys(const void* value, size_t size) {
-  keys_.Add()->assign(reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_add_pointer:kvrpcpb.KvBatchDeleteRequest.keys)
+inline ::std::string* KvIncrRequest::mutable_key() {
+  
+  // @@protoc_insertion_point(field_mutable:kvrpcpb.KvIncrRequest.key)
+  return key_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline const ::google::protobuf::RepeatedPtrField< ::std::string>&
-KvBatchDeleteRequest::keys() const {
-  // @@protoc_insertion_point(field_list:kvrpcpb.KvBatchDeleteRequest.keys)
-  return keys_;
+inline ::std::string* KvIncrRequest::release_key() {
+  // @@protoc_insertion_point(field_release:kvrpcpb.KvIncrRequest.key)
+  
+  return key_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline ::google::protobuf::RepeatedPtrField< ::std::string>*
-KvBatchDeleteRequest::mutable_keys() {
-  // @@protoc_insertion_point(field_mutable_list:kvrpcpb.KvBatchDeleteRequest.keys)
-  return &keys_;
+inline void KvIncrRequest::set_allocated_key(::std::string* key) {
+  if (key != NULL) {
+    
+  } else {
+    
+  }
+  key_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), key);
+  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.KvIncrRequest.key)
 }
 
-// .kvrpcpb.ExistCase case = 2;
-inline void KvBatchDeleteRequest::clear_case_() {
-  case__ = 0;
+// int64 delta = 2;
+inline void KvIncrRequest::clear_delta() {
+  delta_ = GOOGLE_LONGLONG(0);
 }
-inline ::kvrpcpb::ExistCase KvBatchDeleteRequest::case_() const {
-  // @@protoc_insertion_point(field_get:kvrpcpb.KvBatchDeleteRequest.case)
-  return static_cast< ::kvrpcpb::ExistCase >(case__);
+inline ::google::protobuf::int64 KvIncrRequest::delta() const {
+  // @@protoc_insertion_point(field_get:kvrpcpb.KvIncrRequest.delta)
+  return delta_;
 }
-inline void KvBatchDeleteRequest::set_case_(::kvrpcpb::ExistCase value) {
+inline void KvIncrRequest::set_delta(::google::protobuf::int64 value) {
   
-  case__ = value;
-  // @@protoc_insertion_point(field_set:kvrpcpb.KvBatchDeleteRequest.case)
+  delta_ = value;
+  // @@protoc_insertion_point(field_set:kvrpcpb.KvIncrRequest.delta)
 }
 
 // -------------------------------------------------------------------
 
-// KvBatchDeleteResponse
+// KvIncrResponse
 
 // int32 code = 1;
-inline void KvBatchDeleteResponse::clear_code() {
+inline void KvIncrResponse::clear_code() {
   code_ = 0;
 }
-inline ::google::protobuf::int32 KvBatchDeleteResponse::code() const {
-  // @@protoc_insertion_point(field_get:kvrpcpb.KvBatchDeleteResponse.code)
+inline ::google::protobuf::int32 KvIncrResponse::code() const {
+  // @@protoc_insertion_point(field_get:kvrpcpb.KvIncrResponse.code)
   return code_;
 }
-inline void KvBatchDeleteResponse::set_code(::google::protobuf::int32 value) {
+inline void KvIncrResponse::set_code(::google::protobuf::int32 value) {
   
   code_ = value;
-  // @@protoc_insertion_point(field_set:kvrpcpb.KvBatchDeleteResponse.code)
-}
-
-// uint64 affected_keys = 2;
-inline void KvBatchDeleteResponse::clear_affected_keys() {
-  affected_keys_ = GOOGLE_ULONGLONG(0);
-}
-inline ::google::protobuf::uint64 KvBatchDeleteResponse::affected_keys() const {
-  // @@protoc_insertion_point(field_get:kvrpcpb.KvBatchDeleteResponse.affected_keys)
-  return affected_keys_;
-}
-inline void KvBatchDeleteResponse::set_affected_keys(::google::protobuf::uint64 value) {
-  
-  affected_keys_ = value;
-  // @@protoc_insertion_point(field_set:kvrpcpb.KvBatchDeleteResponse.affected_keys)
+  // @@protoc_insertion_point(field_set:kvrpcpb.KvIncrResponse.code)
 }
 
 // -------------------------------------------------------------------
 
-// DsKvBatchDeleteRequest
+// DsKvIncrRequest
 
 // .kvrpcpb.RequestHeader header = 1;
-inline bool DsKvBatchDeleteRequest::has_header() const {
+inline bool DsKvIncrRequest::has_header() const {
   return this != internal_default_instance() && header_ != NULL;
 }
-inline void DsKvBatchDeleteRequest::clear_header() {
+inline void DsKvIncrRequest::clear_header() {
   if (GetArenaNoVirtual() == NULL && header_ != NULL) delete header_;
   header_ = NULL;
 }
-inline const ::kvrpcpb::RequestHeader& DsKvBatchDeleteRequest::header() const {
+inline const ::kvrpcpb::RequestHeader& DsKvIncrRequest::header() const {
   const ::kvrpcpb::RequestHeader* p = header_;
-  // @@protoc_insertion_point(field_get:kvrpcpb.DsKvBatchDeleteRequest.header)
+  // @@protoc_insertion_point(field_get:kvrpcpb.DsKvIncrRequest.header)
   return p != NULL ? *p : *reinterpret_cast<const ::kvrpcpb::RequestHeader*>(
       &::kvrpcpb::_RequestHeader_default_instance_);
 }
-inline ::kvrpcpb::RequestHeader* DsKvBatchDeleteRequest::mutable_header() {
+inline ::kvrpcpb::RequestHeader* DsKvIncrRequest::mutable_header() {
   
   if (header_ == NULL) {
     header_ = new ::kvrpcpb::RequestHeader;
   }
-  // @@protoc_insertion_point(field_mutable:kvrpcpb.DsKvBatchDeleteRequest.header)
+  // @@protoc_insertion_point(field_mutable:kvrpcpb.DsKvIncrRequest.header)
   return header_;
 }
-inline ::kvrpcpb::RequestHeader* DsKvBatchDeleteRequest::release_header() {
-  // @@protoc_insertion_point(field_release:kvrpcpb.DsKvBatchDeleteRequest.header)
+inline ::kvrpcpb::RequestHeader* DsKvIncrRequest::release_header() {
+  // @@protoc_insertion_point(field_release:kvrpcpb.DsKvIncrRequest.header)
   
   ::kvrpcpb::RequestHeader* temp = header_;
   header_ = NULL;
   return temp;
 }
-inline void DsKvBatchDeleteRequest::set_allocated_header(::kvrpcpb::RequestHeader* header) {
+inline void DsKvIncrRequest::set_allocated_header(::kvrpcpb::RequestHeader* header) {
   delete header_;
   header_ = header;
   if (header) {
@@ -17063,39 +18727,39 @@ inline void DsKvBatchDeleteRequest::set_allocated_header(::kvrpcpb::RequestHeade
   } else {
     
   }
-  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.DsKvBatchDeleteRequest.header)
+  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.DsKvIncrRequest.header)
 }
 
-// .kvrpcpb.KvBatchDeleteRequest req = 2;
-inline bool DsKvBatchDeleteRequest::has_req() const {
+// .kvrpcpb.KvIncrRequest req = 2;
+inline bool DsKvIncrRequest::has_req() const {
   return this != internal_default_instance() && req_ != NULL;
 }
-inline void DsKvBatchDeleteRequest::clear_req() {
+inline void DsKvIncrRequest::clear_req() {
   if (GetArenaNoVirtual() == NULL && req_ != NULL) delete req_;
   req_ = NULL;
 }
-inline const ::kvrpcpb::KvBatchDeleteRequest& DsKvBatchDeleteRequest::req() const {
-  const ::kvrpcpb::KvBatchDeleteRequest* p = req_;
-  // @@protoc_insertion_point(field_get:kvrpcpb.DsKvBatchDeleteRequest.req)
-  return p != NULL ? *p : *reinterpret_cast<const ::kvrpcpb::KvBatchDeleteRequest*>(
-      &::kvrpcpb::_KvBatchDeleteRequest_default_instance_);
+inline const ::kvrpcpb::KvIncrRequest& DsKvIncrRequest::req() const {
+  const ::kvrpcpb::KvIncrRequest* p = req_;
+  // @@protoc_insertion_point(field_get:kvrpcpb.DsKvIncrRequest.req)
+  return p != NULL ? *p : *reinterpret_cast<const ::kvrpcpb::KvIncrRequest*>(
+      &::kvrpcpb::_KvIncrRequest_default_instance_);
 }
-inline ::kvrpcpb::KvBatchDeleteRequest* DsKvBatchDeleteRequest::mutable_req() {
+inline ::kvrpcpb::KvIncrRequest* DsKvIncrRequest::mutable_req() {
   
   if (req_ == NULL) {
-    req_ = new ::kvrpcpb::KvBatchDeleteRequest;
+    req_ = new ::kvrpcpb::KvIncrRequest;
   }
-  // @@protoc_insertion_point(field_mutable:kvrpcpb.DsKvBatchDeleteRequest.req)
+  // @@protoc_insertion_point(field_mutable:kvrpcpb.DsKvIncrRequest.req)
   return req_;
 }
-inline ::kvrpcpb::KvBatchDeleteRequest* DsKvBatchDeleteRequest::release_req() {
-  // @@protoc_insertion_point(field_release:kvrpcpb.DsKvBatchDeleteRequest.req)
+inline ::kvrpcpb::KvIncrRequest* DsKvIncrRequest::release_req() {
+  // @@protoc_insertion_point(field_release:kvrpcpb.DsKvIncrRequest.req)
   
-  ::kvrpcpb::KvBatchDeleteRequest* temp = req_;
+  ::kvrpcpb::KvIncrRequest* temp = req_;
   req_ = NULL;
   return temp;
 }
-inline void DsKvBatchDeleteRequest::set_allocated_req(::kvrpcpb::KvBatchDeleteRequest* req) {
+inline void DsKvIncrRequest::set_allocated_req(::kvrpcpb::KvIncrRequest* req) {
   delete req_;
   req_ = req;
   if (req) {
@@ -17103,43 +18767,43 @@ inline void DsKvBatchDeleteRequest::set_allocated_req(::kvrpcpb::KvBatchDeleteRe
   } else {
     
   }
-  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.DsKvBatchDeleteRequest.req)
+  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.DsKvIncrRequest.req)
 }
 
 // -------------------------------------------------------------------
 
-// DsKvBatchDeleteResponse
+// DsKvIncrResponse
 
 // .kvrpcpb.ResponseHeader header = 1;
-inline bool DsKvBatchDeleteResponse::has_header() const {
+inline bool DsKvIncrResponse::has_header() const {
   return this != internal_default_instance() && header_ != NULL;
 }
-inline void DsKvBatchDeleteResponse::clear_header() {
+inline void DsKvIncrResponse::clear_header() {
   if (GetArenaNoVirtual() == NULL && header_ != NULL) delete header_;
   header_ = NULL;
 }
-inline const ::kvrpcpb::ResponseHeader& DsKvBatchDeleteResponse::header() const {
+inline const ::kvrpcpb::ResponseHeader& DsKvIncrResponse::header() const {
   const ::kvrpcpb::ResponseHeader* p = header_;
-  // @@protoc_insertion_point(field_get:kvrpcpb.DsKvBatchDeleteResponse.header)
+  // @@protoc_insertion_point(field_get:kvrpcpb.DsKvIncrResponse.header)
   return p != NULL ? *p : *reinterpret_cast<const ::kvrpcpb::ResponseHeader*>(
       &::kvrpcpb::_ResponseHeader_default_instance_);
 }
-inline ::kvrpcpb::ResponseHeader* DsKvBatchDeleteResponse::mutable_header() {
+inline ::kvrpcpb::ResponseHeader* DsKvIncrResponse::mutable_header() {
   
   if (header_ == NULL) {
     header_ = new ::kvrpcpb::ResponseHeader;
   }
-  // @@protoc_insertion_point(field_mutable:kvrpcpb.DsKvBatchDeleteResponse.header)
+  // @@protoc_insertion_point(field_mutable:kvrpcpb.DsKvIncrResponse.header)
   return header_;
 }
-inline ::kvrpcpb::ResponseHeader* DsKvBatchDeleteResponse::release_header() {
-  // @@protoc_insertion_point(field_release:kvrpcpb.DsKvBatchDeleteResponse.header)
+inline ::kvrpcpb::ResponseHeader* DsKvIncrResponse::release_header() {
+  // @@protoc_insertion_point(field_release:kvrpcpb.DsKvIncrResponse.header)
   
   ::kvrpcpb::ResponseHeader* temp = header_;
   header_ = NULL;
   return temp;
 }
-inline void DsKvBatchDeleteResponse::set_allocated_header(::kvrpcpb::ResponseHeader* header) {
+inline void DsKvIncrResponse::set_allocated_header(::kvrpcpb::ResponseHeader* header) {
   delete header_;
   header_ = header;
   if (header) {
@@ -17147,39 +18811,39 @@ inline void DsKvBatchDeleteResponse::set_allocated_header(::kvrpcpb::ResponseHea
   } else {
     
   }
-  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.DsKvBatchDeleteResponse.header)
+  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.DsKvIncrResponse.header)
 }
 
-// .kvrpcpb.KvBatchDeleteResponse resp = 2;
-inline bool DsKvBatchDeleteResponse::has_resp() const {
+// .kvrpcpb.KvIncrResponse resp = 2;
+inline bool DsKvIncrResponse::has_resp() const {
   return this != internal_default_instance() && resp_ != NULL;
 }
-inline void DsKvBatchDeleteResponse::clear_resp() {
+inline void DsKvIncrResponse::clear_resp() {
   if (GetArenaNoVirtual() == NULL && resp_ != NULL) delete resp_;
   resp_ = NULL;
 }
-inline const ::kvrpcpb::KvBatchDeleteResponse& DsKvBatchDeleteResponse::resp() const {
-  const ::kvrpcpb::KvBatchDeleteResponse* p = resp_;
-  // @@protoc_insertion_point(field_get:kvrpcpb.DsKvBatchDeleteResponse.resp)
-  return p != NULL ? *p : *reinterpret_cast<const ::kvrpcpb::KvBatchDeleteResponse*>(
-      &::kvrpcpb::_KvBatchDeleteResponse_default_instance_);
+inline const ::kvrpcpb::KvIncrResponse& DsKvIncrResponse::resp() const {
+  const ::kvrpcpb::KvIncrResponse* p = resp_;
+  // @@protoc_insertion_point(field_get:kvrpcpb.DsKvIncrResponse.resp)
+  return p != NULL ? *p : *reinterpret_cast<const ::kvrpcpb::KvIncrResponse*>(
+      &::kvrpcpb::_KvIncrResponse_default_instance_);
 }
-inline ::kvrpcpb::KvBatchDeleteResponse* DsKvBatchDeleteResponse::mutable_resp() {
+inline ::kvrpcpb::KvIncrResponse* DsKvIncrResponse::mutable_resp() {
   
   if (resp_ == NULL) {
-    resp_ = new ::kvrpcpb::KvBatchDeleteResponse;
+    resp_ = new ::kvrpcpb::KvIncrResponse;
   }
-  // @@protoc_insertion_point(field_mutable:kvrpcpb.DsKvBatchDeleteResponse.resp)
+  // @@protoc_insertion_point(field_mutable:kvrpcpb.DsKvIncrResponse.resp)
   return resp_;
 }
-inline ::kvrpcpb::KvBatchDeleteResponse* DsKvBatchDeleteResponse::release_resp() {
-  // @@protoc_insertion_point(field_release:kvrpcpb.DsKvBatchDeleteResponse.resp)
+inline ::kvrpcpb::KvIncrResponse* DsKvIncrResponse::release_resp() {
+  // @@protoc_insertion_point(field_release:kvrpcpb.DsKvIncrResponse.resp)
   
-  ::kvrpcpb::KvBatchDeleteResponse* temp = resp_;
+  ::kvrpcpb::KvIncrResponse* temp = resp_;
   resp_ = NULL;
   return temp;
 }
-inline void DsKvBatchDeleteResponse::set_allocated_resp(::kvrpcpb::KvBatchDeleteResponse* resp) {
+inline void DsKvIncrResponse::set_allocated_resp(::kvrpcpb::KvIncrResponse* resp) {
   delete resp_;
   resp_ = resp;
   if (resp) {
@@ -17187,266 +18851,171 @@ inline void DsKvBatchDeleteResponse::set_allocated_resp(::kvrpcpb::KvBatchDelete
   } else {
     
   }
-  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.DsKvBatchDeleteResponse.resp)
+  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.DsKvIncrResponse.resp)
 }
 
 // -------------------------------------------------------------------
 
-// KvRangeDeleteRequest
+// KvAppendRequest
 
-// bytes start = 1;
-inline void KvRangeDeleteRequest::clear_start() {
-  start_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+// bytes key = 1;
+inline void KvAppendRequest::clear_key() {
+  key_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline const ::std::string& KvRangeDeleteRequest::start() const {
-  // @@protoc_insertion_point(field_get:kvrpcpb.KvRangeDeleteRequest.start)
-  return start_.GetNoArena();
+inline const ::std::string& KvAppendRequest::key() const {
+  // @@protoc_insertion_point(field_get:kvrpcpb.KvAppendRequest.key)
+  return key_.GetNoArena();
 }
-inline void KvRangeDeleteRequest::set_start(const ::std::string& value) {
+inline void KvAppendRequest::set_key(const ::std::string& value) {
   
-  start_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:kvrpcpb.KvRangeDeleteRequest.start)
+  key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:kvrpcpb.KvAppendRequest.key)
 }
 #if LANG_CXX11
-inline void KvRangeDeleteRequest::set_start(::std::string&& value) {
+inline void KvAppendRequest::set_key(::std::string&& value) {
   
-  start_.SetNoArena(
+  key_.SetNoArena(
     &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:kvrpcpb.KvRangeDeleteRequest.start)
+  // @@protoc_insertion_point(field_set_rvalue:kvrpcpb.KvAppendRequest.key)
 }
 #endif
-inline void KvRangeDeleteRequest::set_start(const char* value) {
+inline void KvAppendRequest::set_key(const char* value) {
   GOOGLE_DCHECK(value != NULL);
   
-  start_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:kvrpcpb.KvRangeDeleteRequest.start)
+  key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:kvrpcpb.KvAppendRequest.key)
 }
-inline void KvRangeDeleteRequest::set_start(const void* value, size_t size) {
+inline void KvAppendRequest::set_key(const void* value, size_t size) {
   
-  start_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+  key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
       ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:kvrpcpb.KvRangeDeleteRequest.start)
+  // @@protoc_insertion_point(field_set_pointer:kvrpcpb.KvAppendRequest.key)
 }
-inline ::std::string* KvRangeDeleteRequest::mutable_start() {
+inline ::std::string* KvAppendRequest::mutable_key() {
   
-  // @@protoc_insertion_point(field_mutable:kvrpcpb.KvRangeDeleteRequest.start)
-  return start_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  // @@protoc_insertion_point(field_mutable:kvrpcpb.KvAppendRequest.key)
+  return key_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline ::std::string* KvRangeDeleteRequest::release_start() {
-  // @@protoc_insertion_point(field_release:kvrpcpb.KvRangeDeleteRequest.start)
+inline ::std::string* KvAppendRequest::release_key() {
+  // @@protoc_insertion_point(field_release:kvrpcpb.KvAppendRequest.key)
   
-  return start_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return key_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline void KvRangeDeleteRequest::set_allocated_start(::std::string* start) {
-  if (start != NULL) {
+inline void KvAppendRequest::set_allocated_key(::std::string* key) {
+  if (key != NULL) {
     
   } else {
     
   }
-  start_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), start);
-  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.KvRangeDeleteRequest.start)
+  key_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), key);
+  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.KvAppendRequest.key)
 }
 
-// bytes limit = 2;
-inline void KvRangeDeleteRequest::clear_limit() {
-  limit_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+// bytes value = 2;
+inline void KvAppendRequest::clear_value() {
+  value_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline const ::std::string& KvRangeDeleteRequest::limit() const {
-  // @@protoc_insertion_point(field_get:kvrpcpb.KvRangeDeleteRequest.limit)
-  return limit_.GetNoArena();
+inline const ::std::string& KvAppendRequest::value() const {
+  // @@protoc_insertion_point(field_get:kvrpcpb.KvAppendRequest.value)
+  return value_.GetNoArena();
 }
-inline void KvRangeDeleteRequest::set_limit(const ::std::string& value) {
+inline void KvAppendRequest::set_value(const ::std::string& value) {
   
-  limit_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:kvrpcpb.KvRangeDeleteRequest.limit)
+  value_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:kvrpcpb.KvAppendRequest.value)
 }
 #if LANG_CXX11
-inline void KvRangeDeleteRequest::set_limit(::std::string&& value) {
+inline void KvAppendRequest::set_value(::std::string&& value) {
   
-  limit_.SetNoArena(
+  value_.SetNoArena(
     &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:kvrpcpb.KvRangeDeleteRequest.limit)
+  // @@protoc_insertion_point(field_set_rvalue:kvrpcpb.KvAppendRequest.value)
 }
 #endif
-inline void KvRangeDeleteRequest::set_limit(const char* value) {
+inline void KvAppendRequest::set_value(const char* value) {
   GOOGLE_DCHECK(value != NULL);
   
-  limit_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:kvrpcpb.KvRangeDeleteRequest.limit)
+  value_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:kvrpcpb.KvAppendRequest.value)
 }
-inline void KvRangeDeleteRequest::set_limit(const void* value, size_t size) {
+inline void KvAppendRequest::set_value(const void* value, size_t size) {
   
-  limit_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+  value_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
       ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:kvrpcpb.KvRangeDeleteRequest.limit)
+  // @@protoc_insertion_point(field_set_pointer:kvrpcpb.KvAppendRequest.value)
 }
-inline ::std::string* KvRangeDeleteRequest::mutable_limit() {
+inline ::std::string* KvAppendRequest::mutable_value() {
   
-  // @@protoc_insertion_point(field_mutable:kvrpcpb.KvRangeDeleteRequest.limit)
-  return limit_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  // @@protoc_insertion_point(field_mutable:kvrpcpb.KvAppendRequest.value)
+  return value_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline ::std::string* KvRangeDeleteRequest::release_limit() {
-  // @@protoc_insertion_point(field_release:kvrpcpb.KvRangeDeleteRequest.limit)
+inline ::std::string* KvAppendRequest::release_value() {
+  // @@protoc_insertion_point(field_release:kvrpcpb.KvAppendRequest.value)
   
-  return limit_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return value_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline void KvRangeDeleteRequest::set_allocated_limit(::std::string* limit) {
-  if (limit != NULL) {
+inline void KvAppendRequest::set_allocated_value(::std::string* value) {
+  if (value != NULL) {
     
   } else {
     
   }
-  limit_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), limit);
-  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.KvRangeDeleteRequest.limit)
-}
-
-// int64 max_count = 3;
-inline void KvRangeDeleteRequest::clear_max_count() {
-  max_count_ = GOOGLE_LONGLONG(0);
-}
-inline ::google::protobuf::int64 KvRangeDeleteRequest::max_count() const {
-  // @@protoc_insertion_point(field_get:kvrpcpb.KvRangeDeleteRequest.max_count)
-  return max_count_;
-}
-inline void KvRangeDeleteRequest::set_max_count(::google::protobuf::int64 value) {
-  
-  max_count_ = value;
-  // @@protoc_insertion_point(field_set:kvrpcpb.KvRangeDeleteRequest.max_count)
-}
-
-// .kvrpcpb.ExistCase case = 4;
-inline void KvRangeDeleteRequest::clear_case_() {
-  case__ = 0;
-}
-inline ::kvrpcpb::ExistCase KvRangeDeleteRequest::case_() const {
-  // @@protoc_insertion_point(field_get:kvrpcpb.KvRangeDeleteRequest.case)
-  return static_cast< ::kvrpcpb::ExistCase >(case__);
-}
-inline void KvRangeDeleteRequest::set_case_(::kvrpcpb::ExistCase value) {
-  
-  case__ = value;
-  // @@protoc_insertion_point(field_set:kvrpcpb.KvRangeDeleteRequest.case)
+  value_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.KvAppendRequest.value)
 }
 
 // -------------------------------------------------------------------
 
-// KvRangeDeleteResponse
+// KvAppendResponse
 
 // int32 code = 1;
-inline void KvRangeDeleteResponse::clear_code() {
+inline void KvAppendResponse::clear_code() {
   code_ = 0;
 }
-inline ::google::protobuf::int32 KvRangeDeleteResponse::code() const {
-  // @@protoc_insertion_point(field_get:kvrpcpb.KvRangeDeleteResponse.code)
+inline ::google::protobuf::int32 KvAppendResponse::code() const {
+  // @@protoc_insertion_point(field_get:kvrpcpb.KvAppendResponse.code)
   return code_;
 }
-inline void KvRangeDeleteResponse::set_code(::google::protobuf::int32 value) {
+inline void KvAppendResponse::set_code(::google::protobuf::int32 value) {
   
   code_ = value;
-  // @@protoc_insertion_point(field_set:kvrpcpb.KvRangeDeleteResponse.code)
-}
-
-// uint64 affected_keys = 2;
-inline void KvRangeDeleteResponse::clear_affected_keys() {
-  affected_keys_ = GOOGLE_ULONGLONG(0);
-}
-inline ::google::protobuf::uint64 KvRangeDeleteResponse::affected_keys() const {
-  // @@protoc_insertion_point(field_get:kvrpcpb.KvRangeDeleteResponse.affected_keys)
-  return affected_keys_;
-}
-inline void KvRangeDeleteResponse::set_affected_keys(::google::protobuf::uint64 value) {
-  
-  affected_keys_ = value;
-  // @@protoc_insertion_point(field_set:kvrpcpb.KvRangeDeleteResponse.affected_keys)
-}
-
-// bytes last_key = 3;
-inline void KvRangeDeleteResponse::clear_last_key() {
-  last_key_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-inline const ::std::string& KvRangeDeleteResponse::last_key() const {
-  // @@protoc_insertion_point(field_get:kvrpcpb.KvRangeDeleteResponse.last_key)
-  return last_key_.GetNoArena();
-}
-inline void KvRangeDeleteResponse::set_last_key(const ::std::string& value) {
-  
-  last_key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:kvrpcpb.KvRangeDeleteResponse.last_key)
-}
-#if LANG_CXX11
-inline void KvRangeDeleteResponse::set_last_key(::std::string&& value) {
-  
-  last_key_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:kvrpcpb.KvRangeDeleteResponse.last_key)
-}
-#endif
-inline void KvRangeDeleteResponse::set_last_key(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  last_key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:kvrpcpb.KvRangeDeleteResponse.last_key)
-}
-inline void KvRangeDeleteResponse::set_last_key(const void* value, size_t size) {
-  
-  last_key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:kvrpcpb.KvRangeDeleteResponse.last_key)
-}
-inline ::std::string* KvRangeDeleteResponse::mutable_last_key() {
-  
-  // @@protoc_insertion_point(field_mutable:kvrpcpb.KvRangeDeleteResponse.last_key)
-  return last_key_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-inline ::std::string* KvRangeDeleteResponse::release_last_key() {
-  // @@protoc_insertion_point(field_release:kvrpcpb.KvRangeDeleteResponse.last_key)
-  
-  return last_key_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-inline void KvRangeDeleteResponse::set_allocated_last_key(::std::string* last_key) {
-  if (last_key != NULL) {
-    
-  } else {
-    
-  }
-  last_key_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), last_key);
-  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.KvRangeDeleteResponse.last_key)
+  // @@protoc_insertion_point(field_set:kvrpcpb.KvAppendResponse.code)
 }
 
 // -------------------------------------------------------------------
 
-// DsKvRangeDeleteRequest
+// DsKvAppendRequest
 
 // .kvrpcpb.RequestHeader header = 1;
-inline bool DsKvRangeDeleteRequest::has_header() const {
+inline bool DsKvAppendRequest::has_header() const {
   return this != internal_default_instance() && header_ != NULL;
 }
-inline void DsKvRangeDeleteRequest::clear_header() {
+inline void DsKvAppendRequest::clear_header() {
   if (GetArenaNoVirtual() == NULL && header_ != NULL) delete header_;
   header_ = NULL;
 }
-inline const ::kvrpcpb::RequestHeader& DsKvRangeDeleteRequest::header() const {
+inline const ::kvrpcpb::RequestHeader& DsKvAppendRequest::header() const {
   const ::kvrpcpb::RequestHeader* p = header_;
-  // @@protoc_insertion_point(field_get:kvrpcpb.DsKvRangeDeleteRequest.header)
+  // @@protoc_insertion_point(field_get:kvrpcpb.DsKvAppendRequest.header)
   return p != NULL ? *p : *reinterpret_cast<const ::kvrpcpb::RequestHeader*>(
       &::kvrpcpb::_RequestHeader_default_instance_);
 }
-inline ::kvrpcpb::RequestHeader* DsKvRangeDeleteRequest::mutable_header() {
+inline ::kvrpcpb::RequestHeader* DsKvAppendRequest::mutable_header() {
   
   if (header_ == NULL) {
     header_ = new ::kvrpcpb::RequestHeader;
   }
-  // @@protoc_insertion_point(field_mutable:kvrpcpb.DsKvRangeDeleteRequest.header)
+  // @@protoc_insertion_point(field_mutable:kvrpcpb.DsKvAppendRequest.header)
   return header_;
 }
-inline ::kvrpcpb::RequestHeader* DsKvRangeDeleteRequest::release_header() {
-  // @@protoc_insertion_point(field_release:kvrpcpb.DsKvRangeDeleteRequest.header)
+inline ::kvrpcpb::RequestHeader* DsKvAppendRequest::release_header() {
+  // @@protoc_insertion_point(field_release:kvrpcpb.DsKvAppendRequest.header)
   
   ::kvrpcpb::RequestHeader* temp = header_;
   header_ = NULL;
   return temp;
 }
-inline void DsKvRangeDeleteRequest::set_allocated_header(::kvrpcpb::RequestHeader* header) {
+inline void DsKvAppendRequest::set_allocated_header(::kvrpcpb::RequestHeader* header) {
   delete header_;
   header_ = header;
   if (header) {
@@ -17454,39 +19023,39 @@ inline void DsKvRangeDeleteRequest::set_allocated_header(::kvrpcpb::RequestHeade
   } else {
     
   }
-  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.DsKvRangeDeleteRequest.header)
+  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.DsKvAppendRequest.header)
 }
 
-// .kvrpcpb.KvRangeDeleteRequest req = 2;
-inline bool DsKvRangeDeleteRequest::has_req() const {
+// .kvrpcpb.KvAppendRequest req = 2;
+inline bool DsKvAppendRequest::has_req() const {
   return this != internal_default_instance() && req_ != NULL;
 }
-inline void DsKvRangeDeleteRequest::clear_req() {
+inline void DsKvAppendRequest::clear_req() {
   if (GetArenaNoVirtual() == NULL && req_ != NULL) delete req_;
   req_ = NULL;
 }
-inline const ::kvrpcpb::KvRangeDeleteRequest& DsKvRangeDeleteRequest::req() const {
-  const ::kvrpcpb::KvRangeDeleteRequest* p = req_;
-  // @@protoc_insertion_point(field_get:kvrpcpb.DsKvRangeDeleteRequest.req)
-  return p != NULL ? *p : *reinterpret_cast<const ::kvrpcpb::KvRangeDeleteRequest*>(
-      &::kvrpcpb::_KvRangeDeleteRequest_default_instance_);
+inline const ::kvrpcpb::KvAppendRequest& DsKvAppendRequest::req() const {
+  const ::kvrpcpb::KvAppendRequest* p = req_;
+  // @@protoc_insertion_point(field_get:kvrpcpb.DsKvAppendRequest.req)
+  return p != NULL ? *p : *reinterpret_cast<const ::kvrpcpb::KvAppendRequest*>(
+      &::kvrpcpb::_KvAppendRequest_default_instance_);
 }
-inline ::kvrpcpb::KvRangeDeleteRequest* DsKvRangeDeleteRequest::mutable_req() {
+inline ::kvrpcpb::KvAppendRequest* DsKvAppendRequest::mutable_req() {
   
   if (req_ == NULL) {
-    req_ = new ::kvrpcpb::KvRangeDeleteRequest;
+    req_ = new ::kvrpcpb::KvAppendRequest;
   }
-  // @@protoc_insertion_point(field_mutable:kvrpcpb.DsKvRangeDeleteRequest.req)
+  // @@protoc_insertion_point(field_mutable:kvrpcpb.DsKvAppendRequest.req)
   return req_;
 }
-inline ::kvrpcpb::KvRangeDeleteRequest* DsKvRangeDeleteRequest::release_req() {
-  // @@protoc_insertion_point(field_release:kvrpcpb.DsKvRangeDeleteRequest.req)
+inline ::kvrpcpb::KvAppendRequest* DsKvAppendRequest::release_req() {
+  // @@protoc_insertion_point(field_release:kvrpcpb.DsKvAppendRequest.req)
   
-  ::kvrpcpb::KvRangeDeleteRequest* temp = req_;
+  ::kvrpcpb::KvAppendRequest* temp = req_;
   req_ = NULL;
   return temp;
 }
-inline void DsKvRangeDeleteRequest::set_allocated_req(::kvrpcpb::KvRangeDeleteRequest* req) {
+inline void DsKvAppendRequest::set_allocated_req(::kvrpcpb::KvAppendRequest* req) {
   delete req_;
   req_ = req;
   if (req) {
@@ -17494,43 +19063,43 @@ inline void DsKvRangeDeleteRequest::set_allocated_req(::kvrpcpb::KvRangeDeleteRe
   } else {
     
   }
-  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.DsKvRangeDeleteRequest.req)
+  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.DsKvAppendRequest.req)
 }
 
 // -------------------------------------------------------------------
 
-// DsKvRangeDeleteResponse
+// DsKvAppendResponse
 
 // .kvrpcpb.ResponseHeader header = 1;
-inline bool DsKvRangeDeleteResponse::has_header() const {
+inline bool DsKvAppendResponse::has_header() const {
   return this != internal_default_instance() && header_ != NULL;
 }
-inline void DsKvRangeDeleteResponse::clear_header() {
+inline void DsKvAppendResponse::clear_header() {
   if (GetArenaNoVirtual() == NULL && header_ != NULL) delete header_;
   header_ = NULL;
 }
-inline const ::kvrpcpb::ResponseHeader& DsKvRangeDeleteResponse::header() const {
+inline const ::kvrpcpb::ResponseHeader& DsKvAppendResponse::header() const {
   const ::kvrpcpb::ResponseHeader* p = header_;
-  // @@protoc_insertion_point(field_get:kvrpcpb.DsKvRangeDeleteResponse.header)
+  // @@protoc_insertion_point(field_get:kvrpcpb.DsKvAppendResponse.header)
   return p != NULL ? *p : *reinterpret_cast<const ::kvrpcpb::ResponseHeader*>(
       &::kvrpcpb::_ResponseHeader_default_instance_);
 }
-inline ::kvrpcpb::ResponseHeader* DsKvRangeDeleteResponse::mutable_header() {
+inline ::kvrpcpb::ResponseHeader* DsKvAppendResponse::mutable_header() {
   
   if (header_ == NULL) {
     header_ = new ::kvrpcpb::ResponseHeader;
   }
-  // @@protoc_insertion_point(field_mutable:kvrpcpb.DsKvRangeDeleteResponse.header)
+  // @@protoc_insertion_point(field_mutable:kvrpcpb.DsKvAppendResponse.header)
   return header_;
 }
-inline ::kvrpcpb::ResponseHeader* DsKvRangeDeleteResponse::release_header() {
-  // @@protoc_insertion_point(field_release:kvrpcpb.DsKvRangeDeleteResponse.header)
+inline ::kvrpcpb::ResponseHeader* DsKvAppendResponse::release_header() {
+  // @@protoc_insertion_point(field_release:kvrpcpb.DsKvAppendResponse.header)
   
   ::kvrpcpb::ResponseHeader* temp = header_;
   header_ = NULL;
   return temp;
 }
-inline void DsKvRangeDeleteResponse::set_allocated_header(::kvrpcpb::ResponseHeader* header) {
+inline void DsKvAppendResponse::set_allocated_header(::kvrpcpb::ResponseHeader* header) {
   delete header_;
   header_ = header;
   if (header) {
@@ -17538,39 +19107,39 @@ inline void DsKvRangeDeleteResponse::set_allocated_header(::kvrpcpb::ResponseHea
   } else {
     
   }
-  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.DsKvRangeDeleteResponse.header)
+  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.DsKvAppendResponse.header)
 }
 
-// .kvrpcpb.KvRangeDeleteResponse resp = 2;
-inline bool DsKvRangeDeleteResponse::has_resp() const {
+// .kvrpcpb.KvAppendResponse resp = 2;
+inline bool DsKvAppendResponse::has_resp() const {
   return this != internal_default_instance() && resp_ != NULL;
 }
-inline void DsKvRangeDeleteResponse::clear_resp() {
+inline void DsKvAppendResponse::clear_resp() {
   if (GetArenaNoVirtual() == NULL && resp_ != NULL) delete resp_;
   resp_ = NULL;
 }
-inline const ::kvrpcpb::KvRangeDeleteResponse& DsKvRangeDeleteResponse::resp() const {
-  const ::kvrpcpb::KvRangeDeleteResponse* p = resp_;
-  // @@protoc_insertion_point(field_get:kvrpcpb.DsKvRangeDeleteResponse.resp)
-  return p != NULL ? *p : *reinterpret_cast<const ::kvrpcpb::KvRangeDeleteResponse*>(
-      &::kvrpcpb::_KvRangeDeleteResponse_default_instance_);
+inline const ::kvrpcpb::KvAppendResponse& DsKvAppendResponse::resp() const {
+  const ::kvrpcpb::KvAppendResponse* p = resp_;
+  // @@protoc_insertion_point(field_get:kvrpcpb.DsKvAppendResponse.resp)
+  return p != NULL ? *p : *reinterpret_cast<const ::kvrpcpb::KvAppendResponse*>(
+      &::kvrpcpb::_KvAppendResponse_default_instance_);
 }
-inline ::kvrpcpb::KvRangeDeleteResponse* DsKvRangeDeleteResponse::mutable_resp() {
+inline ::kvrpcpb::KvAppendResponse* DsKvAppendResponse::mutable_resp() {
   
   if (resp_ == NULL) {
-    resp_ = new ::kvrpcpb::KvRangeDeleteResponse;
+    resp_ = new ::kvrpcpb::KvAppendResponse;
   }
-  // @@protoc_insertion_point(field_mutable:kvrpcpb.DsKvRangeDeleteResponse.resp)
+  // @@protoc_insertion_point(field_mutable:kvrpcpb.DsKvAppendResponse.resp)
   return resp_;
 }
-inline ::kvrpcpb::KvRangeDeleteResponse* DsKvRangeDeleteResponse::release_resp() {
-  // @@protoc_insertion_point(field_release:kvrpcpb.DsKvRangeDeleteResponse.resp)
+inline ::kvrpcpb::KvAppendResponse* DsKvAppendResponse::release_resp() {
+  // @@protoc_insertion_point(field_release:kvrpcpb.DsKvAppendResponse.resp)
   
-  ::kvrpcpb::KvRangeDeleteResponse* temp = resp_;
+  ::kvrpcpb::KvAppendResponse* temp = resp_;
   resp_ = NULL;
   return temp;
 }
-inline void DsKvRangeDeleteResponse::set_allocated_resp(::kvrpcpb::KvRangeDeleteResponse* resp) {
+inline void DsKvAppendResponse::set_allocated_resp(::kvrpcpb::KvAppendResponse* resp) {
   delete resp_;
   resp_ = resp;
   if (resp) {
@@ -17578,7 +19147,7 @@ inline void DsKvRangeDeleteResponse::set_allocated_resp(::kvrpcpb::KvRangeDelete
   } else {
     
   }
-  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.DsKvRangeDeleteResponse.resp)
+  // @@protoc_insertion_point(field_set_allocated:kvrpcpb.DsKvAppendResponse.resp)
 }
 
 // -------------------------------------------------------------------
@@ -19969,6 +21538,22 @@ inline void DsLockScanResponse::set_allocated_resp(::kvrpcpb::LockScanResponse*
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
@@ -53,6 +53,16 @@ public:
  ::google::protobuf::internal::ExplicitlyConstructed<RangeHeartbeatResponse>
      _instance;
 } _RangeHeartbeatResponse_default_instance_;
+class BatchRangeHeartbeatRequestDefaultTypeInternal {
+public:
+ ::google::protobuf::internal::ExplicitlyConstructed<BatchRangeHeartbeatRequest>
+     _instance;
+} _BatchRangeHeartbeatRequest_default_instance_;
+class BatchRangeHeartbeatResponseDefaultTypeInternal {
+public:
+ ::google::protobuf::internal::ExplicitlyConstructed<BatchRangeHeartbeatResponse>
+     _instance;
+} _BatchRangeHeartbeatResponse_default_instance_;
 class NodeStatsDefaultTypeInternal {
 public:
  ::google::protobuf::internal::ExplicitlyConstructed<NodeStats>
@@ -228,6 +238,16 @@ public:
  ::google::protobuf::internal::ExplicitlyConstructed<CreateTableResponse>
      _instance;
 } _CreateTableResponse_default_instance_;
+class GetAutoIncIdRequestDefaultTypeInternal {
+public:
+ ::google::protobuf::internal::ExplicitlyConstructed<GetAutoIncIdRequest>
+     _instance;
+} _GetAutoIncIdRequest_default_instance_;
+class GetAutoIncIdResponseDefaultTypeInternal {
+public:
+ ::google::protobuf::internal::ExplicitlyConstructed<GetAutoIncIdResponse>
+     _instance;
+} _GetAutoIncIdResponse_default_instance_;
 class RequestHeaderDefaultTypeInternal {
 public:
  ::google::protobuf::internal::ExplicitlyConstructed<RequestHeader>
@@ -259,7 +279,7 @@ namespace protobuf_mspb_2eproto {
 
 namespace {
 
-::google::protobuf::Metadata file_level_metadata[47];
+::google::protobuf::Metadata file_level_metadata[51];
 
 }  // namespace
 
@@ -321,6 +341,10 @@ PROTOBUF_CONSTEXPR_VAR ::google::protobuf::internal::ParseTable const
   { NULL, NULL, 0, -1, -1, -1, -1, NULL, false },
   { NULL, NULL, 0, -1, -1, -1, -1, NULL, false },
   { NULL, NULL, 0, -1, -1, -1, -1, NULL, false },
+  { NULL, NULL, 0, -1, -1, -1, -1, NULL, false },
+  { NULL, NULL, 0, -1, -1, -1, -1, NULL, false },
+  { NULL, NULL, 0, -1, -1, -1, -1, NULL, false },
+  { NULL, NULL, 0, -1, -1, -1, -1, NULL, false },
 };
 
 const ::google::protobuf::uint32 TableStruct::offsets[] GOOGLE_ATTRIBUTE_SECTION_VARIABLE(protodesc_cold) = {
@@ -387,6 +411,23 @@ const ::google::protobuf::uint32 TableStruct::offsets[] GOOGLE_ATTRIBUTE_SECTION
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(RangeHeartbeatResponse, target_peer_),
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(RangeHeartbeatResponse, task_),
   ~0u,  // no _has_bits_
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(BatchRangeHeartbeatRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(BatchRangeHeartbeatRequest, header_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(BatchRangeHeartbeatRequest, node_id_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(BatchRangeHeartbeatRequest, heartbeats_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(BatchRangeHeartbeatRequest, unchanged_ranges_),
+  ~0u,  // no _has_bits_
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(BatchRangeHeartbeatResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(BatchRangeHeartbeatResponse, header_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(BatchRangeHeartbeatResponse, responses_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(BatchRangeHeartbeatResponse, full_required_),
+  ~0u,  // no _has_bits_
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(NodeStats, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
@@ -406,6 +447,28 @@ const ::google::protobuf::uint32 TableStruct::offsets[] GOOGLE_ATTRIBUTE_SECTION
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(NodeStats, keys_read_),
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(NodeStats, is_busy_),
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(NodeStats, start_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(NodeStats, cpu_usage_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(NodeStats, process_cpu_usage_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(NodeStats, cpu_count_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(NodeStats, disk_util_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(NodeStats, disk_read_latency_ms_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(NodeStats, disk_write_latency_ms_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(NodeStats, disk_read_bytes_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(NodeStats, disk_write_bytes_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(NodeStats, net_in_bytes_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(NodeStats, net_out_bytes_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(NodeStats, perf_samples_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(NodeStats, perf_block_cache_hits_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(NodeStats, perf_block_reads_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(NodeStats, perf_block_read_bytes_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(NodeStats, perf_block_read_nanos_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(NodeStats, perf_memtable_nanos_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(NodeStats, perf_sst_nanos_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(NodeStats, perf_iter_seek_nanos_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(NodeStats, perf_keys_skipped_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(NodeStats, perf_deletes_skipped_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(NodeStats, perf_io_read_bytes_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(NodeStats, perf_io_read_nanos_),
   ~0u,  // no _has_bits_
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(NodeHeartbeatRequest, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -666,6 +729,22 @@ const ::google::protobuf::uint32 TableStruct::offsets[] GOOGLE_ATTRIBUTE_SECTION
   ~0u,  // no _weak_field_map_
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CreateTableResponse, header_),
   ~0u,  // no _has_bits_
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(GetAutoIncIdRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(GetAutoIncIdRequest, header_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(GetAutoIncIdRequest, db_id_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(GetAutoIncIdRequest, table_id_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(GetAutoIncIdRequest, size_),
+  ~0u,  // no _has_bits_
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(GetAutoIncIdResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(GetAutoIncIdResponse, header_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(GetAutoIncIdResponse, ids_),
+  ~0u,  // no _has_bits_
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(RequestHeader, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
@@ -706,46 +785,50 @@ static const ::google::protobuf::internal::MigrationSchema schemas[] GOOGLE_ATTR
   { 31, -1, sizeof(RangeStats)},
   { 41, -1, sizeof(RangeHeartbeatRequest)},
   { 52, -1, sizeof(RangeHeartbeatResponse)},
-  { 62, -1, sizeof(NodeStats)},
-  { 82, -1, sizeof(NodeHeartbeatRequest)},
-  { 91, -1, sizeof(NodeHeartbeatResponse)},
-  { 99, -1, sizeof(AskSplitRequest)},
-  { 107, -1, sizeof(AskSplitResponse)},
-  { 117, -1, sizeof(ReportSplitRequest)},
-  { 125, -1, sizeof(ReportSplitResponse)},
-  { 131, -1, sizeof(NodeLoginRequest)},
-  { 138, -1, sizeof(NodeLoginResponse)},
-  { 144, -1, sizeof(GetNodeIdRequest)},
-  { 154, -1, sizeof(GetNodeIdResponse)},
-  { 162, -1, sizeof(GetRouteRequest)},
-  { 171, -1, sizeof(GetRouteResponse)},
-  { 178, -1, sizeof(GetNodeRequest)},
-  { 185, -1, sizeof(GetNodeResponse)},
-  { 192, -1, sizeof(GetDBRequest)},
-  { 199, -1, sizeof(GetDBResponse)},
-  { 206, -1, sizeof(GetTableRequest)},
-  { 214, -1, sizeof(GetTableByIdRequest)},
-  { 222, -1, sizeof(GetTableResponse)},
-  { 229, -1, sizeof(GetTableByIdResponse)},
-  { 236, -1, sizeof(GetColumnsRequest)},
-  { 244, -1, sizeof(GetColumnsResponse)},
-  { 251, -1, sizeof(GetColumnByNameRequest)},
-  { 260, -1, sizeof(GetColumnByNameResponse)},
-  { 267, -1, sizeof(GetColumnByIdRequest)},
-  { 276, -1, sizeof(GetColumnByIdResponse)},
-  { 283, -1, sizeof(AddColumnRequest)},
-  { 292, -1, sizeof(AddColumnResponse)},
-  { 299, -1, sizeof(TruncateTableRequest)},
-  { 307, -1, sizeof(TruncateTableResponse)},
-  { 313, -1, sizeof(CreateDatabaseRequest)},
-  { 320, -1, sizeof(CreateDatabaseResponse)},
-  { 326, -1, sizeof(CreateTableRequest)},
-  { 335, -1, sizeof(CreateTableResponse)},
-  { 341, -1, sizeof(RequestHeader)},
-  { 347, -1, sizeof(ResponseHeader)},
-  { 354, -1, sizeof(LeaderHint)},
-  { 361, -1, sizeof(NoLeader)},
-  { 366, -1, sizeof(Error)},
+  { 62, -1, sizeof(BatchRangeHeartbeatRequest)},
+  { 71, -1, sizeof(BatchRangeHeartbeatResponse)},
+  { 79, -1, sizeof(NodeStats)},
+  { 121, -1, sizeof(NodeHeartbeatRequest)},
+  { 130, -1, sizeof(NodeHeartbeatResponse)},
+  { 138, -1, sizeof(AskSplitRequest)},
+  { 146, -1, sizeof(AskSplitResponse)},
+  { 156, -1, sizeof(ReportSplitRequest)},
+  { 164, -1, sizeof(ReportSplitResponse)},
+  { 170, -1, sizeof(NodeLoginRequest)},
+  { 177, -1, sizeof(NodeLoginResponse)},
+  { 183, -1, sizeof(GetNodeIdRequest)},
+  { 193, -1, sizeof(GetNodeIdResponse)},
+  { 201, -1, sizeof(GetRouteRequest)},
+  { 210, -1, sizeof(GetRouteResponse)},
+  { 217, -1, sizeof(GetNodeRequest)},
+  { 224, -1, sizeof(GetNodeResponse)},
+  { 231, -1, sizeof(GetDBRequest)},
+  { 238, -1, sizeof(GetDBResponse)},
+  { 245, -1, sizeof(GetTableRequest)},
+  { 253, -1, sizeof(GetTableByIdRequest)},
+  { 261, -1, sizeof(GetTableResponse)},
+  { 268, -1, sizeof(GetTableByIdResponse)},
+  { 275, -1, sizeof(GetColumnsRequest)},
+  { 283, -1, sizeof(GetColumnsResponse)},
+  { 290, -1, sizeof(GetColumnByNameRequest)},
+  { 299, -1, sizeof(GetColumnByNameResponse)},
+  { 306, -1, sizeof(GetColumnByIdRequest)},
+  { 315, -1, sizeof(GetColumnByIdResponse)},
+  { 322, -1, sizeof(AddColumnRequest)},
+  { 331, -1, sizeof(AddColumnResponse)},
+  { 338, -1, sizeof(TruncateTableRequest)},
+  { 346, -1, sizeof(TruncateTableResponse)},
+  { 352, -1, sizeof(CreateDatabaseRequest)},
+  { 359, -1, sizeof(CreateDatabaseResponse)},
+  { 365, -1, sizeof(CreateTableRequest)},
+  { 374, -1, sizeof(CreateTableResponse)},
+  { 380, -1, sizeof(GetAutoIncIdRequest)},
+  { 389, -1, sizeof(GetAutoIncIdResponse)},
+  { 396, -1, sizeof(RequestHeader)},
+  { 402, -1, sizeof(ResponseHeader)},
+  { 409, -1, sizeof(LeaderHint)},
+  { 416, -1, sizeof(NoLeader)},
+  { 421, -1, sizeof(Error)},
 };
 
 static ::google::protobuf::Message const * const file_default_instances[] = {
@@ -756,6 +839,8 @@ static ::google::protobuf::Message const * const file_default_instances[] = {
   reinterpret_cast<const ::google::protobuf::Message*>(&_RangeStats_default_instance_),
   reinterpret_cast<const ::google::protobuf::Message*>(&_RangeHeartbeatRequest_default_instance_),
   reinterpret_cast<const ::google::protobuf::Message*>(&_RangeHeartbeatResponse_default_instance_),
+  reinterpret_cast<const ::google::protobuf::Message*>(&_BatchRangeHeartbeatRequest_default_instance_),
+  reinterpret_cast<const ::google::protobuf::Message*>(&_BatchRangeHeartbeatResponse_default_instance_),
   reinterpret_cast<const ::google::protobuf::Message*>(&_NodeStats_default_instance_),
   reinterpret_cast<const ::google::protobuf::Message*>(&_NodeHeartbeatRequest_default_instance_),
   reinterpret_cast<const ::google::protobuf::Message*>(&_NodeHeartbeatResponse_default_instance_),
@@ -791,6 +876,8 @@ static ::google::protobuf::Message const * const file_default_instances[] = {
   reinterpret_cast<const ::google::protobuf::Message*>(&_CreateDatabaseResponse_default_instance_),
   reinterpret_cast<const ::google::protobuf::Message*>(&_CreateTableRequest_default_instance_),
   reinterpret_cast<const ::google::protobuf::Message*>(&_CreateTableResponse_default_instance_),
+  reinterpret_cast<const ::google::protobuf::Message*>(&_GetAutoIncIdRequest_default_instance_),
+  reinterpret_cast<const ::google::protobuf::Message*>(&_GetAutoIncIdResponse_default_instance_),
   reinterpret_cast<const ::google::protobuf::Message*>(&_RequestHeader_default_instance_),
   reinterpret_cast<const ::google::protobuf::Message*>(&_ResponseHeader_default_instance_),
   reinterpret_cast<const ::google::protobuf::Message*>(&_LeaderHint_default_instance_),
@@ -816,7 +903,7 @@ void protobuf_AssignDescriptorsOnce() {
 void protobuf_RegisterTypes(const ::std::string&) GOOGLE_ATTRIBUTE_COLD;
 void protobuf_RegisterTypes(const ::std::string&) {
   protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::internal::RegisterAllTypes(file_level_metadata, 47);
+  ::google::protobuf::internal::RegisterAllTypes(file_level_metadata, 51);
 }
 
 }  // namespace
@@ -840,7 +927,11 @@ void TableStruct::InitDefaultsImpl() {
   ::google::protobuf::internal::OnShutdownDestroyMessage(
       &_RangeHeartbeatRequest_default_instance_);_RangeHeartbeatResponse_default_instance_._instance.DefaultConstruct();
   ::google::protobuf::internal::OnShutdownDestroyMessage(
-      &_RangeHeartbeatResponse_default_instance_);_NodeStats_default_instance_._instance.DefaultConstruct();
+      &_RangeHeartbeatResponse_default_instance_);_BatchRangeHeartbeatRequest_default_instance_._instance.DefaultConstruct();
+  ::google::protobuf::internal::OnShutdownDestroyMessage(
+      &_BatchRangeHeartbeatRequest_default_instance_);_BatchRangeHeartbeatResponse_default_instance_._instance.DefaultConstruct();
+  ::google::protobuf::internal::OnShutdownDestroyMessage(
+      &_BatchRangeHeartbeatResponse_default_instance_);_NodeStats_default_instance_._instance.DefaultConstruct();
   ::google::protobuf::internal::OnShutdownDestroyMessage(
       &_NodeStats_default_instance_);_NodeHeartbeatRequest_default_instance_._instance.DefaultConstruct();
   ::google::protobuf::internal::OnShutdownDestroyMessage(
@@ -910,7 +1001,11 @@ void TableStruct::InitDefaultsImpl() {
   ::google::protobuf::internal::OnShutdownDestroyMessage(
       &_CreateTableRequest_default_instance_);_CreateTableResponse_default_instance_._instance.DefaultConstruct();
   ::google::protobuf::internal::OnShutdownDestroyMessage(
-      &_CreateTableResponse_default_instance_);_RequestHeader_default_instance_._instance.DefaultConstruct();
+      &_CreateTableResponse_default_instance_);_GetAutoIncIdRequest_default_instance_._instance.DefaultConstruct();
+  ::google::protobuf::internal::OnShutdownDestroyMessage(
+      &_GetAutoIncIdRequest_default_instance_);_GetAutoIncIdResponse_default_instance_._instance.DefaultConstruct();
+  ::google::protobuf::internal::OnShutdownDestroyMessage(
+      &_GetAutoIncIdResponse_default_instance_);_RequestHeader_default_instance_._instance.DefaultConstruct();
   ::google::protobuf::internal::OnShutdownDestroyMessage(
       &_RequestHeader_default_instance_);_ResponseHeader_default_instance_._instance.DefaultConstruct();
   ::google::protobuf::internal::OnShutdownDestroyMessage(
@@ -944,6 +1039,10 @@ void TableStruct::InitDefaultsImpl() {
       ::metapb::Peer::internal_default_instance());
   _RangeHeartbeatResponse_default_instance_._instance.get_mutable()->task_ = const_cast< ::taskpb::Task*>(
       ::taskpb::Task::internal_default_instance());
+  _BatchRangeHeartbeatRequest_default_instance_._instance.get_mutable()->header_ = const_cast< ::mspb::RequestHeader*>(
+      ::mspb::RequestHeader::internal_default_instance());
+  _BatchRangeHeartbeatResponse_default_instance_._instance.get_mutable()->header_ = const_cast< ::mspb::ResponseHeader*>(
+      ::mspb::ResponseHeader::internal_default_instance());
   _NodeHeartbeatRequest_default_instance_._instance.get_mutable()->header_ = const_cast< ::mspb::RequestHeader*>(
       ::mspb::RequestHeader::internal_default_instance());
   _NodeHeartbeatRequest_default_instance_._instance.get_mutable()->stats_ = const_cast< ::mspb::NodeStats*>(
@@ -1034,6 +1133,10 @@ void TableStruct::InitDefaultsImpl() {
       ::mspb::RequestHeader::internal_default_instance());
   _CreateTableResponse_default_instance_._instance.get_mutable()->header_ = const_cast< ::mspb::ResponseHeader*>(
       ::mspb::ResponseHeader::internal_default_instance());
+  _GetAutoIncIdRequest_default_instance_._instance.get_mutable()->header_ = const_cast< ::mspb::RequestHeader*>(
+      ::mspb::RequestHeader::internal_default_instance());
+  _GetAutoIncIdResponse_default_instance_._instance.get_mutable()->header_ = const_cast< ::mspb::ResponseHeader*>(
+      ::mspb::ResponseHeader::internal_default_instance());
   _ResponseHeader_default_instance_._instance.get_mutable()->error_ = const_cast< ::mspb::Error*>(
       ::mspb::Error::internal_default_instance());
   _Error_default_instance_._instance.get_mutable()->new_leader_ = const_cast< ::mspb::LeaderHint*>(
@@ -1072,15 +1175,37 @@ void AddDescriptorsImpl() {
       "nseHeader\022\020\n\010range_id\030\002 \001(\004\022!\n\005epoch\030\003 \001"
       "(\0132\022.metapb.RangeEpoch\022!\n\013target_peer\030\004 "
       "\001(\0132\014.metapb.Peer\022\032\n\004task\030\005 \001(\0132\014.taskpb"
-      ".Task\"\332\002\n\tNodeStats\022\023\n\013range_count\030\001 \001(\r"
-      "\022\031\n\021range_split_count\030\002 \001(\r\022\032\n\022sending_s"
-      "nap_count\030\003 \001(\r\022\034\n\024receiving_snap_count\030"
-      "\004 \001(\r\022\033\n\023applying_snap_count\030\005 \001(\r\022\032\n\022ra"
-      "nge_leader_count\030\006 \001(\r\022\020\n\010capacity\030\007 \001(\004"
-      "\022\021\n\tused_size\030\010 \001(\004\022\021\n\tavailable\030\t \001(\004\022\025"
-      "\n\rbytes_written\030\n \001(\004\022\024\n\014keys_written\030\013 "
-      "\001(\004\022\022\n\nbytes_read\030\014 \001(\004\022\021\n\tkeys_read\030\r \001"
-      "(\004\022\017\n\007is_busy\030\016 \001(\010\022\r\n\005start\030\017 \001(\r\"\207\001\n\024N"
+      ".Task\"\235\001\n\032BatchRangeHeartbeatRequest\022#\n\006"
+      "header\030\001 \001(\0132\023.mspb.RequestHeader\022\017\n\007nod"
+      "e_id\030\002 \001(\004\022/\n\nheartbeats\030\003 \003(\0132\033.mspb.Ra"
+      "ngeHeartbeatRequest\022\030\n\020unchanged_ranges\030"
+      "\004 \003(\004\"\213\001\n\033BatchRangeHeartbeatResponse\022$\n"
+      "\006header\030\001 \001(\0132\024.mspb.ResponseHeader\022/\n\tr"
+      "esponses\030\002 \003(\0132\034.mspb.RangeHeartbeatResp"
+      "onse\022\025\n\rfull_required\030\003 \003(\004\"\234\007\n\tNodeStat"
+      "s\022\023\n\013range_count\030\001 \001(\r\022\031\n\021range_split_co"
+      "unt\030\002 \001(\r\022\032\n\022sending_snap_count\030\003 \001(\r\022\034\n"
+      "\024receiving_snap_count\030\004 \001(\r\022\033\n\023applying_"
+      "snap_count\030\005 \001(\r\022\032\n\022range_leader_count\030\006"
+      " \001(\r\022\020\n\010capacity\030\007 \001(\004\022\021\n\tused_size\030\010 \001("
+      "\004\022\021\n\tavailable\030\t \001(\004\022\025\n\rbytes_written\030\n "
+      "\001(\004\022\024\n\014keys_written\030\013 \001(\004\022\022\n\nbytes_read\030"
+      "\014 \001(\004\022\021\n\tkeys_read\030\r \001(\004\022\017\n\007is_busy\030\016 \001("
+      "\010\022\r\n\005start\030\017 \001(\r\022\021\n\tcpu_usage\030\020 \001(\001\022\031\n\021p"
+      "rocess_cpu_usage\030\021 \001(\001\022\021\n\tcpu_count\030\022 \001("
+      "\r\022\021\n\tdisk_util\030\023 \001(\001\022\034\n\024disk_read_latenc"
+      "y_ms\030\024 \001(\001\022\035\n\025disk_write_latency_ms\030\025 \001("
+      "\001\022\027\n\017disk_read_bytes\030\026 \001(\004\022\030\n\020disk_write"
+      "_bytes\030\027 \001(\004\022\024\n\014net_in_bytes\030\030 \001(\004\022\025\n\rne"
+      "t_out_bytes\030\031 \001(\004\022\024\n\014perf_samples\030\032 \001(\004\022"
+      "\035\n\025perf_block_cache_hits\030\033 \001(\004\022\030\n\020perf_b"
+      "lock_reads\030\034 \001(\004\022\035\n\025perf_block_read_byte"
+      "s\030\035 \001(\004\022\035\n\025perf_block_read_nanos\030\036 \001(\004\022\033"
+      "\n\023perf_memtable_nanos\030\037 \001(\004\022\026\n\016perf_sst_"
+      "nanos\030  \001(\004\022\034\n\024perf_iter_seek_nanos\030! \001("
+      "\004\022\031\n\021perf_keys_skipped\030\" \001(\004\022\034\n\024perf_del"
+      "etes_skipped\030# \001(\004\022\032\n\022perf_io_read_bytes"
+      "\030$ \001(\004\022\032\n\022perf_io_read_nanos\030% \001(\004\"\207\001\n\024N"
       "odeHeartbeatRequest\022#\n\006header\030\001 \001(\0132\023.ms"
       "pb.RequestHeader\022\017\n\007node_id\030\002 \001(\004\022\036\n\005sta"
       "ts\030\003 \001(\0132\017.mspb.NodeStats\022\031\n\021isolated_re"
@@ -1160,49 +1285,58 @@ void AddDescriptorsImpl() {
       "er\030\001 \001(\0132\023.mspb.RequestHeader\022\017\n\007db_name"
       "\030\002 \001(\t\022\022\n\ntable_name\030\003 \001(\t\022\022\n\nproperties"
       "\030\004 \001(\t\";\n\023CreateTableResponse\022$\n\006header\030"
-      "\001 \001(\0132\024.mspb.ResponseHeader\"#\n\rRequestHe"
-      "ader\022\022\n\ncluster_id\030\001 \001(\004\"@\n\016ResponseHead"
-      "er\022\022\n\ncluster_id\030\001 \001(\004\022\032\n\005error\030\002 \001(\0132\013."
-      "mspb.Error\"+\n\nLeaderHint\022\017\n\007address\030\001 \001("
-      "\t\022\014\n\004term\030\002 \001(\004\"\n\n\010NoLeader\"P\n\005Error\022$\n\n"
-      "new_leader\030\002 \001(\0132\020.mspb.LeaderHint\022!\n\tno"
-      "_leader\030\003 \001(\0132\016.mspb.NoLeader2\241\n\n\010MsServ"
-      "er\022J\n\rNodeHeartbeat\022\032.mspb.NodeHeartbeat"
-      "Request\032\033.mspb.NodeHeartbeatResponse\"\000\022M"
-      "\n\016RangeHeartbeat\022\033.mspb.RangeHeartbeatRe"
-      "quest\032\034.mspb.RangeHeartbeatResponse\"\000\022;\n"
-      "\010AskSplit\022\025.mspb.AskSplitRequest\032\026.mspb."
-      "AskSplitResponse\"\000\022D\n\013ReportSplit\022\030.mspb"
-      ".ReportSplitRequest\032\031.mspb.ReportSplitRe"
-      "sponse\"\000\022>\n\tNodeLogin\022\026.mspb.NodeLoginRe"
-      "quest\032\027.mspb.NodeLoginResponse\"\000\022>\n\tGetN"
-      "odeId\022\026.mspb.GetNodeIdRequest\032\027.mspb.Get"
-      "NodeIdResponse\"\000\022D\n\013GetMSLeader\022\030.mspb.G"
-      "etMSLeaderRequest\032\031.mspb.GetMSLeaderResp"
-      "onse\"\000\022;\n\010GetRoute\022\025.mspb.GetRouteReques"
-      "t\032\026.mspb.GetRouteResponse\"\000\0228\n\007GetNode\022\024"
-      ".mspb.GetNodeRequest\032\025.mspb.GetNodeRespo"
-      "nse\"\000\0222\n\005GetDB\022\022.mspb.GetDBRequest\032\023.msp"
-      "b.GetDBResponse\"\000\022;\n\010GetTable\022\025.mspb.Get"
-      "TableRequest\032\026.mspb.GetTableResponse\"\000\022G"
-      "\n\014GetTableById\022\031.mspb.GetTableByIdReques"
-      "t\032\032.mspb.GetTableByIdResponse\"\000\022A\n\nGetCo"
-      "lumns\022\027.mspb.GetColumnsRequest\032\030.mspb.Ge"
-      "tColumnsResponse\"\000\022P\n\017GetColumnByName\022\034."
-      "mspb.GetColumnByNameRequest\032\035.mspb.GetCo"
-      "lumnByNameResponse\"\000\022J\n\rGetColumnById\022\032."
-      "mspb.GetColumnByIdRequest\032\033.mspb.GetColu"
-      "mnByIdResponse\"\000\022J\n\rTruncateTable\022\032.mspb"
-      ".TruncateTableRequest\032\033.mspb.TruncateTab"
-      "leResponse\"\000\022>\n\tAddColumn\022\026.mspb.AddColu"
-      "mnRequest\032\027.mspb.AddColumnResponse\"\000\022M\n\016"
-      "CreateDatabase\022\033.mspb.CreateDatabaseRequ"
-      "est\032\034.mspb.CreateDatabaseResponse\"\000\022D\n\013C"
-      "reateTable\022\030.mspb.CreateTableRequest\032\031.m"
-      "spb.CreateTableResponse\"\000b\006proto3"
+      "\001 \001(\0132\024.mspb.ResponseHeader\"i\n\023GetAutoIn"
+      "cIdRequest\022#\n\006header\030\001 \001(\0132\023.mspb.Reques"
+      "tHeader\022\r\n\005db_id\030\002 \001(\004\022\020\n\010table_id\030\003 \001(\004"
+      "\022\014\n\004size\030\004 \001(\r\"I\n\024GetAutoIncIdResponse\022$"
+      "\n\006header\030\001 \001(\0132\024.mspb.ResponseHeader\022\013\n\003"
+      "ids\030\002 \003(\004\"#\n\rRequestHeader\022\022\n\ncluster_id"
+      "\030\001 \001(\004\"@\n\016ResponseHeader\022\022\n\ncluster_id\030\001"
+      " \001(\004\022\032\n\005error\030\002 \001(\0132\013.mspb.Error\"+\n\nLead"
+      "erHint\022\017\n\007address\030\001 \001(\t\022\014\n\004term\030\002 \001(\004\"\n\n"
+      "\010NoLeader\"P\n\005Error\022$\n\nnew_leader\030\002 \001(\0132\020"
+      ".mspb.LeaderHint\022!\n\tno_leader\030\003 \001(\0132\016.ms"
+      "pb.NoLeader2\310\013\n\010MsServer\022J\n\rNodeHeartbea"
+      "t\022\032.mspb.NodeHeartbeatRequest\032\033.mspb.Nod"
+      "eHeartbeatResponse\"\000\022M\n\016RangeHeartbeat\022\033"
+      ".mspb.RangeHeartbeatRequest\032\034.mspb.Range"
+      "HeartbeatResponse\"\000\022;\n\010AskSplit\022\025.mspb.A"
+      "skSplitRequest\032\026.mspb.AskSplitResponse\"\000"
+      "\022D\n\013ReportSplit\022\030.mspb.ReportSplitReques"
+      "t\032\031.mspb.ReportSplitResponse\"\000\022>\n\tNodeLo"
+      "gin\022\026.mspb.NodeLoginRequest\032\027.mspb.NodeL"
+      "oginResponse\"\000\022>\n\tGetNodeId\022\026.mspb.GetNo"
+      "deIdRequest\032\027.mspb.GetNodeIdResponse\"\000\022D"
+      "\n\013GetMSLeader\022\030.mspb.GetMSLeaderRequest\032"
+      "\031.mspb.GetMSLeaderResponse\"\000\022;\n\010GetRoute"
+      "\022\025.mspb.GetRouteRequest\032\026.mspb.GetRouteR"
+      "esponse\"\000\0228\n\007GetNode\022\024.mspb.GetNodeReque"
+      "st\032\025.mspb.GetNodeResponse\"\000\0222\n\005GetDB\022\022.m"
+      "spb.GetDBRequest\032\023.mspb.GetDBResponse\"\000\022"
+      ";\n\010GetTable\022\025.mspb.GetTableRequest\032\026.msp"
+      "b.GetTableResponse\"\000\022G\n\014GetTableById\022\031.m"
+      "spb.GetTableByIdRequest\032\032.mspb.GetTableB"
+      "yIdResponse\"\000\022A\n\nGetColumns\022\027.mspb.GetCo"
+      "lumnsRequest\032\030.mspb.GetColumnsResponse\"\000"
+      "\022P\n\017GetColumnByName\022\034.mspb.GetColumnByNa"
+      "meRequest\032\035.mspb.GetColumnByNameResponse"
+      "\"\000\022J\n\rGetColumnById\022\032.mspb.GetColumnById"
+      "Request\032\033.mspb.GetColumnByIdResponse\"\000\022J"
+      "\n\rTruncateTable\022\032.mspb.TruncateTableRequ"
+      "est\032\033.mspb.TruncateTableResponse\"\000\022>\n\tAd"
+      "dColumn\022\026.mspb.AddColumnRequest\032\027.mspb.A"
+      "ddColumnResponse\"\000\022M\n\016CreateDatabase\022\033.m"
+      "spb.CreateDatabaseRequest\032\034.mspb.CreateD"
+      "atabaseResponse\"\000\022D\n\013CreateTable\022\030.mspb."
+      "CreateTableRequest\032\031.mspb.CreateTableRes"
+      "ponse\"\000\022G\n\014GetAutoIncId\022\031.mspb.GetAutoIn"
+      "cIdRequest\032\032.mspb.GetAutoIncIdResponse\"\000"
+      "\022\\\n\023BatchRangeHeartbeat\022 .mspb.BatchRang"
+      "eHeartbeatRequest\032!.mspb.BatchRangeHeart"
+      "beatResponse\"\000b\006proto3"
   };
   ::google::protobuf::DescriptorPool::InternalAddGeneratedFile(
-      descriptor, 5993);
+      descriptor, 7222);
   ::google::protobuf::MessageFactory::InternalRegisterGeneratedFile(
     "mspb.proto", &protobuf_RegisterTypes);
   ::metapb::protobuf_metapb_2eproto::AddDescriptors();
@@ -4550,306 +4684,3675 @@ void RangeHeartbeatResponse::set_allocated_task(::taskpb::Task* task) {
 // ===================================================================
 
 #if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int NodeStats::kRangeCountFieldNumber;
-const int NodeStats::kRangeSplitCountFieldNumber;
-const int NodeStats::kSendingSnapCountFieldNumber;
-const int NodeStats::kReceivingSnapCountFieldNumber;
-const int NodeStats::kApplyingSnapCountFieldNumber;
-const int NodeStats::kRangeLeaderCountFieldNumber;
-const int NodeStats::kCapacityFieldNumber;
-const int NodeStats::kUsedSizeFieldNumber;
-const int NodeStats::kAvailableFieldNumber;
-const int NodeStats::kBytesWrittenFieldNumber;
-const int NodeStats::kKeysWrittenFieldNumber;
-const int NodeStats::kBytesReadFieldNumber;
-const int NodeStats::kKeysReadFieldNumber;
-const int NodeStats::kIsBusyFieldNumber;
-const int NodeStats::kStartFieldNumber;
+const int BatchRangeHeartbeatRequest::kHeaderFieldNumber;
+const int BatchRangeHeartbeatRequest::kNodeIdFieldNumber;
+const int BatchRangeHeartbeatRequest::kHeartbeatsFieldNumber;
+const int BatchRangeHeartbeatRequest::kUnchangedRangesFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
-NodeStats::NodeStats()
+BatchRangeHeartbeatRequest::BatchRangeHeartbeatRequest()
   : ::google::protobuf::Message(), _internal_metadata_(NULL) {
   if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
     protobuf_mspb_2eproto::InitDefaults();
   }
   SharedCtor();
-  // @@protoc_insertion_point(constructor:mspb.NodeStats)
+  // @@protoc_insertion_point(constructor:mspb.BatchRangeHeartbeatRequest)
 }
-NodeStats::NodeStats(const NodeStats& from)
+BatchRangeHeartbeatRequest::BatchRangeHeartbeatRequest(const BatchRangeHeartbeatRequest& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
+      heartbeats_(from.heartbeats_),
+      unchanged_ranges_(from.unchanged_ranges_),
       _cached_size_(0) {
   _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::memcpy(&range_count_, &from.range_count_,
-    static_cast<size_t>(reinterpret_cast<char*>(&start_) -
-    reinterpret_cast<char*>(&range_count_)) + sizeof(start_));
-  // @@protoc_insertion_point(copy_constructor:mspb.NodeStats)
+  if (from.has_header()) {
+    header_ = new ::mspb::RequestHeader(*from.header_);
+  } else {
+    header_ = NULL;
+  }
+  node_id_ = from.node_id_;
+  // @@protoc_insertion_point(copy_constructor:mspb.BatchRangeHeartbeatRequest)
 }
 
-void NodeStats::SharedCtor() {
-  ::memset(&range_count_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&start_) -
-      reinterpret_cast<char*>(&range_count_)) + sizeof(start_));
+void BatchRangeHeartbeatRequest::SharedCtor() {
+  ::memset(&header_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&node_id_) -
+      reinterpret_cast<char*>(&header_)) + sizeof(node_id_));
   _cached_size_ = 0;
 }
 
-NodeStats::~NodeStats() {
-  // @@protoc_insertion_point(destructor:mspb.NodeStats)
+BatchRangeHeartbeatRequest::~BatchRangeHeartbeatRequest() {
+  // @@protoc_insertion_point(destructor:mspb.BatchRangeHeartbeatRequest)
   SharedDtor();
 }
 
-void NodeStats::SharedDtor() {
+void BatchRangeHeartbeatRequest::SharedDtor() {
+  if (this != internal_default_instance()) delete header_;
 }
 
-void NodeStats::SetCachedSize(int size) const {
+void BatchRangeHeartbeatRequest::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* NodeStats::descriptor() {
+const ::google::protobuf::Descriptor* BatchRangeHeartbeatRequest::descriptor() {
   protobuf_mspb_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_mspb_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
 }
 
-const NodeStats& NodeStats::default_instance() {
+const BatchRangeHeartbeatRequest& BatchRangeHeartbeatRequest::default_instance() {
   protobuf_mspb_2eproto::InitDefaults();
   return *internal_default_instance();
 }
 
-NodeStats* NodeStats::New(::google::protobuf::Arena* arena) const {
-  NodeStats* n = new NodeStats;
+BatchRangeHeartbeatRequest* BatchRangeHeartbeatRequest::New(::google::protobuf::Arena* arena) const {
+  BatchRangeHeartbeatRequest* n = new BatchRangeHeartbeatRequest;
   if (arena != NULL) {
     arena->Own(n);
   }
   return n;
 }
 
-void NodeStats::Clear() {
-// @@protoc_insertion_point(message_clear_start:mspb.NodeStats)
+void BatchRangeHeartbeatRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:mspb.BatchRangeHeartbeatRequest)
   ::google::protobuf::uint32 cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  ::memset(&range_count_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&start_) -
-      reinterpret_cast<char*>(&range_count_)) + sizeof(start_));
+  heartbeats_.Clear();
+  unchanged_ranges_.Clear();
+  if (GetArenaNoVirtual() == NULL && header_ != NULL) {
+    delete header_;
+  }
+  header_ = NULL;
+  node_id_ = GOOGLE_ULONGLONG(0);
   _internal_metadata_.Clear();
 }
 
-bool NodeStats::MergePartialFromCodedStream(
+bool BatchRangeHeartbeatRequest::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:mspb.NodeStats)
+  // @@protoc_insertion_point(parse_start:mspb.BatchRangeHeartbeatRequest)
   for (;;) {
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
     tag = p.first;
     if (!p.second) goto handle_unusual;
     switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // uint32 range_count = 1;
+      // .mspb.RequestHeader header = 1;
       case 1: {
         if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(8u /* 8 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &range_count_)));
+            static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_header()));
         } else {
           goto handle_unusual;
         }
         break;
       }
 
-      // uint32 range_split_count = 2;
+      // uint64 node_id = 2;
       case 2: {
         if (static_cast< ::google::protobuf::uint8>(tag) ==
             static_cast< ::google::protobuf::uint8>(16u /* 16 & 0xFF */)) {
 
           DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &range_split_count_)));
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &node_id_)));
         } else {
           goto handle_unusual;
         }
         break;
       }
 
-      // uint32 sending_snap_count = 3;
+      // repeated .mspb.RangeHeartbeatRequest heartbeats = 3;
       case 3: {
         if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(24u /* 24 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &sending_snap_count_)));
+            static_cast< ::google::protobuf::uint8>(26u /* 26 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+                input, add_heartbeats()));
         } else {
           goto handle_unusual;
         }
         break;
       }
 
-      // uint32 receiving_snap_count = 4;
+      // repeated uint64 unchanged_ranges = 4;
       case 4: {
         if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(34u /* 34 & 0xFF */)) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPackedPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, this->mutable_unchanged_ranges())));
+        } else if (
+            static_cast< ::google::protobuf::uint8>(tag) ==
             static_cast< ::google::protobuf::uint8>(32u /* 32 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &receiving_snap_count_)));
+          DO_((::google::protobuf::internal::WireFormatLite::ReadRepeatedPrimitiveNoInline<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 1, 34u, input, this->mutable_unchanged_ranges())));
         } else {
           goto handle_unusual;
         }
         break;
       }
 
-      // uint32 applying_snap_count = 5;
-      case 5: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(40u /* 40 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &applying_snap_count_)));
-        } else {
-          goto handle_unusual;
+      default: {
+      handle_unusual:
+        if (tag == 0) {
+          goto success;
         }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, _internal_metadata_.mutable_unknown_fields()));
         break;
       }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:mspb.BatchRangeHeartbeatRequest)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:mspb.BatchRangeHeartbeatRequest)
+  return false;
+#undef DO_
+}
 
-      // uint32 range_leader_count = 6;
-      case 6: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(48u /* 48 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &range_leader_count_)));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
+void BatchRangeHeartbeatRequest::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:mspb.BatchRangeHeartbeatRequest)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
 
-      // uint64 capacity = 7;
-      case 7: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(56u /* 56 & 0xFF */)) {
+  // .mspb.RequestHeader header = 1;
+  if (this->has_header()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      1, *this->header_, output);
+  }
 
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
-                 input, &capacity_)));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
+  // uint64 node_id = 2;
+  if (this->node_id() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(2, this->node_id(), output);
+  }
 
-      // uint64 used_size = 8;
-      case 8: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(64u /* 64 & 0xFF */)) {
+  // repeated .mspb.RangeHeartbeatRequest heartbeats = 3;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->heartbeats_size()); i < n; i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      3, this->heartbeats(static_cast<int>(i)), output);
+  }
 
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
-                 input, &used_size_)));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
+  // repeated uint64 unchanged_ranges = 4;
+  if (this->unchanged_ranges_size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteTag(4, ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
+    output->WriteVarint32(static_cast< ::google::protobuf::uint32>(
+        _unchanged_ranges_cached_byte_size_));
+  }
+  for (int i = 0, n = this->unchanged_ranges_size(); i < n; i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64NoTag(
+      this->unchanged_ranges(i), output);
+  }
 
-      // uint64 available = 9;
-      case 9: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(72u /* 72 & 0xFF */)) {
+  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
+  }
+  // @@protoc_insertion_point(serialize_end:mspb.BatchRangeHeartbeatRequest)
+}
 
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
-                 input, &available_)));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
+::google::protobuf::uint8* BatchRangeHeartbeatRequest::InternalSerializeWithCachedSizesToArray(
+    bool deterministic, ::google::protobuf::uint8* target) const {
+  (void)deterministic; // Unused
+  // @@protoc_insertion_point(serialize_to_array_start:mspb.BatchRangeHeartbeatRequest)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
 
-      // uint64 bytes_written = 10;
-      case 10: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(80u /* 80 & 0xFF */)) {
+  // .mspb.RequestHeader header = 1;
+  if (this->has_header()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      InternalWriteMessageNoVirtualToArray(
+        1, *this->header_, deterministic, target);
+  }
 
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
-                 input, &bytes_written_)));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
+  // uint64 node_id = 2;
+  if (this->node_id() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(2, this->node_id(), target);
+  }
 
-      // uint64 keys_written = 11;
-      case 11: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(88u /* 88 & 0xFF */)) {
+  // repeated .mspb.RangeHeartbeatRequest heartbeats = 3;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->heartbeats_size()); i < n; i++) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      InternalWriteMessageNoVirtualToArray(
+        3, this->heartbeats(static_cast<int>(i)), deterministic, target);
+  }
 
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
-                 input, &keys_written_)));
+  // repeated uint64 unchanged_ranges = 4;
+  if (this->unchanged_ranges_size() > 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteTagToArray(
+      4,
+      ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
+      target);
+    target = ::google::protobuf::io::CodedOutputStream::WriteVarint32ToArray(
+        static_cast< ::google::protobuf::uint32>(
+            _unchanged_ranges_cached_byte_size_), target);
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteUInt64NoTagToArray(this->unchanged_ranges_, target);
+  }
+
+  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:mspb.BatchRangeHeartbeatRequest)
+  return target;
+}
+
+size_t BatchRangeHeartbeatRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mspb.BatchRangeHeartbeatRequest)
+  size_t total_size = 0;
+
+  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
+  }
+  // repeated .mspb.RangeHeartbeatRequest heartbeats = 3;
+  {
+    unsigned int count = static_cast<unsigned int>(this->heartbeats_size());
+    total_size += 1UL * count;
+    for (unsigned int i = 0; i < count; i++) {
+      total_size +=
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->heartbeats(static_cast<int>(i)));
+    }
+  }
+
+  // repeated uint64 unchanged_ranges = 4;
+  {
+    size_t data_size = ::google::protobuf::internal::WireFormatLite::
+      UInt64Size(this->unchanged_ranges_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(
+            static_cast< ::google::protobuf::int32>(data_size));
+    }
+    int cached_size = ::google::protobuf::internal::ToCachedSize(data_size);
+    GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+    _unchanged_ranges_cached_byte_size_ = cached_size;
+    GOOGLE_SAFE_CONCURRENT_WRITES_END();
+    total_size += data_size;
+  }
+
+  // .mspb.RequestHeader header = 1;
+  if (this->has_header()) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+        *this->header_);
+  }
+
+  // uint64 node_id = 2;
+  if (this->node_id() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt64Size(
+        this->node_id());
+  }
+
+  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = cached_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void BatchRangeHeartbeatRequest::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:mspb.BatchRangeHeartbeatRequest)
+  GOOGLE_DCHECK_NE(&from, this);
+  const BatchRangeHeartbeatRequest* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const BatchRangeHeartbeatRequest>(
+          &from);
+  if (source == NULL) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:mspb.BatchRangeHeartbeatRequest)
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:mspb.BatchRangeHeartbeatRequest)
+    MergeFrom(*source);
+  }
+}
+
+void BatchRangeHeartbeatRequest::MergeFrom(const BatchRangeHeartbeatRequest& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:mspb.BatchRangeHeartbeatRequest)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  heartbeats_.MergeFrom(from.heartbeats_);
+  unchanged_ranges_.MergeFrom(from.unchanged_ranges_);
+  if (from.has_header()) {
+    mutable_header()->::mspb::RequestHeader::MergeFrom(from.header());
+  }
+  if (from.node_id() != 0) {
+    set_node_id(from.node_id());
+  }
+}
+
+void BatchRangeHeartbeatRequest::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:mspb.BatchRangeHeartbeatRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void BatchRangeHeartbeatRequest::CopyFrom(const BatchRangeHeartbeatRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mspb.BatchRangeHeartbeatRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool BatchRangeHeartbeatRequest::IsInitialized() const {
+  return true;
+}
+
+void BatchRangeHeartbeatRequest::Swap(BatchRangeHeartbeatRequest* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void BatchRangeHeartbeatRequest::InternalSwap(BatchRangeHeartbeatRequest* other) {
+  using std::swap;
+  heartbeats_.InternalSwap(&other->heartbeats_);
+  unchanged_ranges_.InternalSwap(&other->unchanged_ranges_);
+  swap(header_, other->header_);
+  swap(node_id_, other->node_id_);
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  swap(_cached_size_, other->_cached_size_);
+}
+
+::google::protobuf::Metadata BatchRangeHeartbeatRequest::GetMetadata() const {
+  protobuf_mspb_2eproto::protobuf_AssignDescriptorsOnce();
+  return protobuf_mspb_2eproto::file_level_metadata[kIndexInFileMessages];
+}
+
+#if PROTOBUF_INLINE_NOT_IN_HEADERS
+// BatchRangeHeartbeatRequest
+
+// .mspb.RequestHeader header = 1;
+bool BatchRangeHeartbeatRequest::has_header() const {
+  return this != internal_default_instance() && header_ != NULL;
+}
+void BatchRangeHeartbeatRequest::clear_header() {
+  if (GetArenaNoVirtual() == NULL && header_ != NULL) delete header_;
+  header_ = NULL;
+}
+const ::mspb::RequestHeader& BatchRangeHeartbeatRequest::header() const {
+  const ::mspb::RequestHeader* p = header_;
+  // @@protoc_insertion_point(field_get:mspb.BatchRangeHeartbeatRequest.header)
+  return p != NULL ? *p : *reinterpret_cast<const ::mspb::RequestHeader*>(
+      &::mspb::_RequestHeader_default_instance_);
+}
+::mspb::RequestHeader* BatchRangeHeartbeatRequest::mutable_header() {
+  
+  if (header_ == NULL) {
+    header_ = new ::mspb::RequestHeader;
+  }
+  // @@protoc_insertion_point(field_mutable:mspb.BatchRangeHeartbeatRequest.header)
+  return header_;
+}
+::mspb::RequestHeader* BatchRangeHeartbeatRequest::release_header() {
+  // @@protoc_insertion_point(field_release:mspb.BatchRangeHeartbeatRequest.header)
+  
+  ::mspb::RequestHeader* temp = header_;
+  header_ = NULL;
+  return temp;
+}
+void BatchRangeHeartbeatRequest::set_allocated_header(::mspb::RequestHeader* header) {
+  delete header_;
+  header_ = header;
+  if (header) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_set_allocated:mspb.BatchRangeHeartbeatRequest.header)
+}
+
+// uint64 node_id = 2;
+void BatchRangeHeartbeatRequest::clear_node_id() {
+  node_id_ = GOOGLE_ULONGLONG(0);
+}
+::google::protobuf::uint64 BatchRangeHeartbeatRequest::node_id() const {
+  // @@protoc_insertion_point(field_get:mspb.BatchRangeHeartbeatRequest.node_id)
+  return node_id_;
+}
+void BatchRangeHeartbeatRequest::set_node_id(::google::protobuf::uint64 value) {
+  
+  node_id_ = value;
+  // @@protoc_insertion_point(field_set:mspb.BatchRangeHeartbeatRequest.node_id)
+}
+
+// repeated .mspb.RangeHeartbeatRequest heartbeats = 3;
+int BatchRangeHeartbeatRequest::heartbeats_size() const {
+  return heartbeats_.size();
+}
+void BatchRangeHeartbeatRequest::clear_heartbeats() {
+  heartbeats_.Clear();
+}
+const ::mspb::RangeHeartbeatRequest& BatchRangeHeartbeatRequest::heartbeats(int index) const {
+  // @@protoc_insertion_point(field_get:mspb.BatchRangeHeartbeatRequest.heartbeats)
+  return heartbeats_.Get(index);
+}
+::mspb::RangeHeartbeatRequest* BatchRangeHeartbeatRequest::mutable_heartbeats(int index) {
+  // @@protoc_insertion_point(field_mutable:mspb.BatchRangeHeartbeatRequest.heartbeats)
+  return heartbeats_.Mutable(index);
+}
+::mspb::RangeHeartbeatRequest* BatchRangeHeartbeatRequest::add_heartbeats() {
+  // @@protoc_insertion_point(field_add:mspb.BatchRangeHeartbeatRequest.heartbeats)
+  return heartbeats_.Add();
+}
+::google::protobuf::RepeatedPtrField< ::mspb::RangeHeartbeatRequest >*
+BatchRangeHeartbeatRequest::mutable_heartbeats() {
+  // @@protoc_insertion_point(field_mutable_list:mspb.BatchRangeHeartbeatRequest.heartbeats)
+  return &heartbeats_;
+}
+const ::google::protobuf::RepeatedPtrField< ::mspb::RangeHeartbeatRequest >&
+BatchRangeHeartbeatRequest::heartbeats() const {
+  // @@protoc_insertion_point(field_list:mspb.BatchRangeHeartbeatRequest.heartbeats)
+  return heartbeats_;
+}
+
+// repeated uint64 unchanged_ranges = 4;
+int BatchRangeHeartbeatRequest::unchanged_ranges_size() const {
+  return unchanged_ranges_.size();
+}
+void BatchRangeHeartbeatRequest::clear_unchanged_ranges() {
+  unchanged_ranges_.Clear();
+}
+::google::protobuf::uint64 BatchRangeHeartbeatRequest::unchanged_ranges(int index) const {
+  // @@protoc_insertion_point(field_get:mspb.BatchRangeHeartbeatRequest.unchanged_ranges)
+  return unchanged_ranges_.Get(index);
+}
+void BatchRangeHeartbeatRequest::set_unchanged_ranges(int index, ::google::protobuf::uint64 value) {
+  unchanged_ranges_.Set(index, value);
+  // @@protoc_insertion_point(field_set:mspb.BatchRangeHeartbeatRequest.unchanged_ranges)
+}
+void BatchRangeHeartbeatRequest::add_unchanged_ranges(::google::protobuf::uint64 value) {
+  unchanged_ranges_.Add(value);
+  // @@protoc_insertion_point(field_add:mspb.BatchRangeHeartbeatRequest.unchanged_ranges)
+}
+const ::google::protobuf::RepeatedField< ::google::protobuf::uint64 >&
+BatchRangeHeartbeatRequest::unchanged_ranges() const {
+  // @@protoc_insertion_point(field_list:mspb.BatchRangeHeartbeatRequest.unchanged_ranges)
+  return unchanged_ranges_;
+}
+::google::protobuf::RepeatedField< ::google::protobuf::uint64 >*
+BatchRangeHeartbeatRequest::mutable_unchanged_ranges() {
+  // @@protoc_insertion_point(field_mutable_list:mspb.BatchRangeHeartbeatRequest.unchanged_ranges)
+  return &unchanged_ranges_;
+}
+
+#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
+
+// ===================================================================
+
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int BatchRangeHeartbeatResponse::kHeaderFieldNumber;
+const int BatchRangeHeartbeatResponse::kResponsesFieldNumber;
+const int BatchRangeHeartbeatResponse::kFullRequiredFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+BatchRangeHeartbeatResponse::BatchRangeHeartbeatResponse()
+  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
+  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
+    protobuf_mspb_2eproto::InitDefaults();
+  }
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:mspb.BatchRangeHeartbeatResponse)
+}
+BatchRangeHeartbeatResponse::BatchRangeHeartbeatResponse(const BatchRangeHeartbeatResponse& from)
+  : ::google::protobuf::Message(),
+      _internal_metadata_(NULL),
+      responses_(from.responses_),
+      full_required_(from.full_required_),
+      _cached_size_(0) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  if (from.has_header()) {
+    header_ = new ::mspb::ResponseHeader(*from.header_);
+  } else {
+    header_ = NULL;
+  }
+  // @@protoc_insertion_point(copy_constructor:mspb.BatchRangeHeartbeatResponse)
+}
+
+void BatchRangeHeartbeatResponse::SharedCtor() {
+  header_ = NULL;
+  _cached_size_ = 0;
+}
+
+BatchRangeHeartbeatResponse::~BatchRangeHeartbeatResponse() {
+  // @@protoc_insertion_point(destructor:mspb.BatchRangeHeartbeatResponse)
+  SharedDtor();
+}
+
+void BatchRangeHeartbeatResponse::SharedDtor() {
+  if (this != internal_default_instance()) delete header_;
+}
+
+void BatchRangeHeartbeatResponse::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* BatchRangeHeartbeatResponse::descriptor() {
+  protobuf_mspb_2eproto::protobuf_AssignDescriptorsOnce();
+  return protobuf_mspb_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
+}
+
+const BatchRangeHeartbeatResponse& BatchRangeHeartbeatResponse::default_instance() {
+  protobuf_mspb_2eproto::InitDefaults();
+  return *internal_default_instance();
+}
+
+BatchRangeHeartbeatResponse* BatchRangeHeartbeatResponse::New(::google::protobuf::Arena* arena) const {
+  BatchRangeHeartbeatResponse* n = new BatchRangeHeartbeatResponse;
+  if (arena != NULL) {
+    arena->Own(n);
+  }
+  return n;
+}
+
+void BatchRangeHeartbeatResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:mspb.BatchRangeHeartbeatResponse)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  responses_.Clear();
+  full_required_.Clear();
+  if (GetArenaNoVirtual() == NULL && header_ != NULL) {
+    delete header_;
+  }
+  header_ = NULL;
+  _internal_metadata_.Clear();
+}
+
+bool BatchRangeHeartbeatResponse::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  // @@protoc_insertion_point(parse_start:mspb.BatchRangeHeartbeatResponse)
+  for (;;) {
+    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // .mspb.ResponseHeader header = 1;
+      case 1: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_header()));
         } else {
           goto handle_unusual;
         }
         break;
       }
 
-      // uint64 bytes_read = 12;
-      case 12: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(96u /* 96 & 0xFF */)) {
+      // repeated .mspb.RangeHeartbeatResponse responses = 2;
+      case 2: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(18u /* 18 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+                input, add_responses()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // repeated uint64 full_required = 3;
+      case 3: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(26u /* 26 & 0xFF */)) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPackedPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, this->mutable_full_required())));
+        } else if (
+            static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(24u /* 24 & 0xFF */)) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadRepeatedPrimitiveNoInline<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 1, 26u, input, this->mutable_full_required())));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, _internal_metadata_.mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:mspb.BatchRangeHeartbeatResponse)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:mspb.BatchRangeHeartbeatResponse)
+  return false;
+#undef DO_
+}
+
+void BatchRangeHeartbeatResponse::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:mspb.BatchRangeHeartbeatResponse)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .mspb.ResponseHeader header = 1;
+  if (this->has_header()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      1, *this->header_, output);
+  }
+
+  // repeated .mspb.RangeHeartbeatResponse responses = 2;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->responses_size()); i < n; i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      2, this->responses(static_cast<int>(i)), output);
+  }
+
+  // repeated uint64 full_required = 3;
+  if (this->full_required_size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteTag(3, ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
+    output->WriteVarint32(static_cast< ::google::protobuf::uint32>(
+        _full_required_cached_byte_size_));
+  }
+  for (int i = 0, n = this->full_required_size(); i < n; i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64NoTag(
+      this->full_required(i), output);
+  }
+
+  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
+  }
+  // @@protoc_insertion_point(serialize_end:mspb.BatchRangeHeartbeatResponse)
+}
+
+::google::protobuf::uint8* BatchRangeHeartbeatResponse::InternalSerializeWithCachedSizesToArray(
+    bool deterministic, ::google::protobuf::uint8* target) const {
+  (void)deterministic; // Unused
+  // @@protoc_insertion_point(serialize_to_array_start:mspb.BatchRangeHeartbeatResponse)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .mspb.ResponseHeader header = 1;
+  if (this->has_header()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      InternalWriteMessageNoVirtualToArray(
+        1, *this->header_, deterministic, target);
+  }
+
+  // repeated .mspb.RangeHeartbeatResponse responses = 2;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->responses_size()); i < n; i++) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      InternalWriteMessageNoVirtualToArray(
+        2, this->responses(static_cast<int>(i)), deterministic, target);
+  }
+
+  // repeated uint64 full_required = 3;
+  if (this->full_required_size() > 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteTagToArray(
+      3,
+      ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
+      target);
+    target = ::google::protobuf::io::CodedOutputStream::WriteVarint32ToArray(
+        static_cast< ::google::protobuf::uint32>(
+            _full_required_cached_byte_size_), target);
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteUInt64NoTagToArray(this->full_required_, target);
+  }
+
+  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:mspb.BatchRangeHeartbeatResponse)
+  return target;
+}
+
+size_t BatchRangeHeartbeatResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mspb.BatchRangeHeartbeatResponse)
+  size_t total_size = 0;
+
+  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
+  }
+  // repeated .mspb.RangeHeartbeatResponse responses = 2;
+  {
+    unsigned int count = static_cast<unsigned int>(this->responses_size());
+    total_size += 1UL * count;
+    for (unsigned int i = 0; i < count; i++) {
+      total_size +=
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->responses(static_cast<int>(i)));
+    }
+  }
+
+  // repeated uint64 full_required = 3;
+  {
+    size_t data_size = ::google::protobuf::internal::WireFormatLite::
+      UInt64Size(this->full_required_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(
+            static_cast< ::google::protobuf::int32>(data_size));
+    }
+    int cached_size = ::google::protobuf::internal::ToCachedSize(data_size);
+    GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+    _full_required_cached_byte_size_ = cached_size;
+    GOOGLE_SAFE_CONCURRENT_WRITES_END();
+    total_size += data_size;
+  }
+
+  // .mspb.ResponseHeader header = 1;
+  if (this->has_header()) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+        *this->header_);
+  }
+
+  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = cached_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void BatchRangeHeartbeatResponse::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:mspb.BatchRangeHeartbeatResponse)
+  GOOGLE_DCHECK_NE(&from, this);
+  const BatchRangeHeartbeatResponse* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const BatchRangeHeartbeatResponse>(
+          &from);
+  if (source == NULL) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:mspb.BatchRangeHeartbeatResponse)
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:mspb.BatchRangeHeartbeatResponse)
+    MergeFrom(*source);
+  }
+}
+
+void BatchRangeHeartbeatResponse::MergeFrom(const BatchRangeHeartbeatResponse& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:mspb.BatchRangeHeartbeatResponse)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  responses_.MergeFrom(from.responses_);
+  full_required_.MergeFrom(from.full_required_);
+  if (from.has_header()) {
+    mutable_header()->::mspb::ResponseHeader::MergeFrom(from.header());
+  }
+}
+
+void BatchRangeHeartbeatResponse::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:mspb.BatchRangeHeartbeatResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void BatchRangeHeartbeatResponse::CopyFrom(const BatchRangeHeartbeatResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mspb.BatchRangeHeartbeatResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool BatchRangeHeartbeatResponse::IsInitialized() const {
+  return true;
+}
+
+void BatchRangeHeartbeatResponse::Swap(BatchRangeHeartbeatResponse* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void BatchRangeHeartbeatResponse::InternalSwap(BatchRangeHeartbeatResponse* other) {
+  using std::swap;
+  responses_.InternalSwap(&other->responses_);
+  full_required_.InternalSwap(&other->full_required_);
+  swap(header_, other->header_);
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  swap(_cached_size_, other->_cached_size_);
+}
+
+::google::protobuf::Metadata BatchRangeHeartbeatResponse::GetMetadata() const {
+  protobuf_mspb_2eproto::protobuf_AssignDescriptorsOnce();
+  return protobuf_mspb_2eproto::file_level_metadata[kIndexInFileMessages];
+}
+
+#if PROTOBUF_INLINE_NOT_IN_HEADERS
+// BatchRangeHeartbeatResponse
+
+// .mspb.ResponseHeader header = 1;
+bool BatchRangeHeartbeatResponse::has_header() const {
+  return this != internal_default_instance() && header_ != NULL;
+}
+void BatchRangeHeartbeatResponse::clear_header() {
+  if (GetArenaNoVirtual() == NULL && header_ != NULL) delete header_;
+  header_ = NULL;
+}
+const ::mspb::ResponseHeader& BatchRangeHeartbeatResponse::header() const {
+  const ::mspb::ResponseHeader* p = header_;
+  // @@protoc_insertion_point(field_get:mspb.BatchRangeHeartbeatResponse.header)
+  return p != NULL ? *p : *reinterpret_cast<const ::mspb::ResponseHeader*>(
+      &::mspb::_ResponseHeader_default_instance_);
+}
+::mspb::ResponseHeader* BatchRangeHeartbeatResponse::mutable_header() {
+  
+  if (header_ == NULL) {
+    header_ = new ::mspb::ResponseHeader;
+  }
+  // @@protoc_insertion_point(field_mutable:mspb.BatchRangeHeartbeatResponse.header)
+  return header_;
+}
+::mspb::ResponseHeader* BatchRangeHeartbeatResponse::release_header() {
+  // @@protoc_insertion_point(field_release:mspb.BatchRangeHeartbeatResponse.header)
+  
+  ::mspb::ResponseHeader* temp = header_;
+  header_ = NULL;
+  return temp;
+}
+void BatchRangeHeartbeatResponse::set_allocated_header(::mspb::ResponseHeader* header) {
+  delete header_;
+  header_ = header;
+  if (header) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_set_allocated:mspb.BatchRangeHeartbeatResponse.header)
+}
+
+// repeated .mspb.RangeHeartbeatResponse responses = 2;
+int BatchRangeHeartbeatResponse::responses_size() const {
+  return responses_.size();
+}
+void BatchRangeHeartbeatResponse::clear_responses() {
+  responses_.Clear();
+}
+const ::mspb::RangeHeartbeatResponse& BatchRangeHeartbeatResponse::responses(int index) const {
+  // @@protoc_insertion_point(field_get:mspb.BatchRangeHeartbeatResponse.responses)
+  return responses_.Get(index);
+}
+::mspb::RangeHeartbeatResponse* BatchRangeHeartbeatResponse::mutable_responses(int index) {
+  // @@protoc_insertion_point(field_mutable:mspb.BatchRangeHeartbeatResponse.responses)
+  return responses_.Mutable(index);
+}
+::mspb::RangeHeartbeatResponse* BatchRangeHeartbeatResponse::add_responses() {
+  // @@protoc_insertion_point(field_add:mspb.BatchRangeHeartbeatResponse.responses)
+  return responses_.Add();
+}
+::google::protobuf::RepeatedPtrField< ::mspb::RangeHeartbeatResponse >*
+BatchRangeHeartbeatResponse::mutable_responses() {
+  // @@protoc_insertion_point(field_mutable_list:mspb.BatchRangeHeartbeatResponse.responses)
+  return &responses_;
+}
+const ::google::protobuf::RepeatedPtrField< ::mspb::RangeHeartbeatResponse >&
+BatchRangeHeartbeatResponse::responses() const {
+  // @@protoc_insertion_point(field_list:mspb.BatchRangeHeartbeatResponse.responses)
+  return responses_;
+}
+
+// repeated uint64 full_required = 3;
+int BatchRangeHeartbeatResponse::full_required_size() const {
+  return full_required_.size();
+}
+void BatchRangeHeartbeatResponse::clear_full_required() {
+  full_required_.Clear();
+}
+::google::protobuf::uint64 BatchRangeHeartbeatResponse::full_required(int index) const {
+  // @@protoc_insertion_point(field_get:mspb.BatchRangeHeartbeatResponse.full_required)
+  return full_required_.Get(index);
+}
+void BatchRangeHeartbeatResponse::set_full_required(int index, ::google::protobuf::uint64 value) {
+  full_required_.Set(index, value);
+  // @@protoc_insertion_point(field_set:mspb.BatchRangeHeartbeatResponse.full_required)
+}
+void BatchRangeHeartbeatResponse::add_full_required(::google::protobuf::uint64 value) {
+  full_required_.Add(value);
+  // @@protoc_insertion_point(field_add:mspb.BatchRangeHeartbeatResponse.full_required)
+}
+const ::google::protobuf::RepeatedField< ::google::protobuf::uint64 >&
+BatchRangeHeartbeatResponse::full_required() const {
+  // @@protoc_insertion_point(field_list:mspb.BatchRangeHeartbeatResponse.full_required)
+  return full_required_;
+}
+::google::protobuf::RepeatedField< ::google::protobuf::uint64 >*
+BatchRangeHeartbeatResponse::mutable_full_required() {
+  // @@protoc_insertion_point(field_mutable_list:mspb.BatchRangeHeartbeatResponse.full_required)
+  return &full_required_;
+}
+
+#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
+
+// ===================================================================
+
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int NodeStats::kRangeCountFieldNumber;
+const int NodeStats::kRangeSplitCountFieldNumber;
+const int NodeStats::kSendingSnapCountFieldNumber;
+const int NodeStats::kReceivingSnapCountFieldNumber;
+const int NodeStats::kApplyingSnapCountFieldNumber;
+const int NodeStats::kRangeLeaderCountFieldNumber;
+const int NodeStats::kCapacityFieldNumber;
+const int NodeStats::kUsedSizeFieldNumber;
+const int NodeStats::kAvailableFieldNumber;
+const int NodeStats::kBytesWrittenFieldNumber;
+const int NodeStats::kKeysWrittenFieldNumber;
+const int NodeStats::kBytesReadFieldNumber;
+const int NodeStats::kKeysReadFieldNumber;
+const int NodeStats::kIsBusyFieldNumber;
+const int NodeStats::kStartFieldNumber;
+const int NodeStats::kCpuUsageFieldNumber;
+const int NodeStats::kProcessCpuUsageFieldNumber;
+const int NodeStats::kCpuCountFieldNumber;
+const int NodeStats::kDiskUtilFieldNumber;
+const int NodeStats::kDiskReadLatencyMsFieldNumber;
+const int NodeStats::kDiskWriteLatencyMsFieldNumber;
+const int NodeStats::kDiskReadBytesFieldNumber;
+const int NodeStats::kDiskWriteBytesFieldNumber;
+const int NodeStats::kNetInBytesFieldNumber;
+const int NodeStats::kNetOutBytesFieldNumber;
+const int NodeStats::kPerfSamplesFieldNumber;
+const int NodeStats::kPerfBlockCacheHitsFieldNumber;
+const int NodeStats::kPerfBlockReadsFieldNumber;
+const int NodeStats::kPerfBlockReadBytesFieldNumber;
+const int NodeStats::kPerfBlockReadNanosFieldNumber;
+const int NodeStats::kPerfMemtableNanosFieldNumber;
+const int NodeStats::kPerfSstNanosFieldNumber;
+const int NodeStats::kPerfIterSeekNanosFieldNumber;
+const int NodeStats::kPerfKeysSkippedFieldNumber;
+const int NodeStats::kPerfDeletesSkippedFieldNumber;
+const int NodeStats::kPerfIoReadBytesFieldNumber;
+const int NodeStats::kPerfIoReadNanosFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+NodeStats::NodeStats()
+  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
+  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
+    protobuf_mspb_2eproto::InitDefaults();
+  }
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:mspb.NodeStats)
+}
+NodeStats::NodeStats(const NodeStats& from)
+  : ::google::protobuf::Message(),
+      _internal_metadata_(NULL),
+      _cached_size_(0) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::memcpy(&range_count_, &from.range_count_,
+    static_cast<size_t>(reinterpret_cast<char*>(&cpu_count_) -
+    reinterpret_cast<char*>(&range_count_)) + sizeof(cpu_count_));
+  // @@protoc_insertion_point(copy_constructor:mspb.NodeStats)
+}
+
+void NodeStats::SharedCtor() {
+  ::memset(&range_count_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&cpu_count_) -
+      reinterpret_cast<char*>(&range_count_)) + sizeof(cpu_count_));
+  _cached_size_ = 0;
+}
+
+NodeStats::~NodeStats() {
+  // @@protoc_insertion_point(destructor:mspb.NodeStats)
+  SharedDtor();
+}
+
+void NodeStats::SharedDtor() {
+}
+
+void NodeStats::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* NodeStats::descriptor() {
+  protobuf_mspb_2eproto::protobuf_AssignDescriptorsOnce();
+  return protobuf_mspb_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
+}
+
+const NodeStats& NodeStats::default_instance() {
+  protobuf_mspb_2eproto::InitDefaults();
+  return *internal_default_instance();
+}
+
+NodeStats* NodeStats::New(::google::protobuf::Arena* arena) const {
+  NodeStats* n = new NodeStats;
+  if (arena != NULL) {
+    arena->Own(n);
+  }
+  return n;
+}
+
+void NodeStats::Clear() {
+// @@protoc_insertion_point(message_clear_start:mspb.NodeStats)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&range_count_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&cpu_count_) -
+      reinterpret_cast<char*>(&range_count_)) + sizeof(cpu_count_));
+  _internal_metadata_.Clear();
+}
+
+bool NodeStats::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  // @@protoc_insertion_point(parse_start:mspb.NodeStats)
+  for (;;) {
+    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(16383u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // uint32 range_count = 1;
+      case 1: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(8u /* 8 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &range_count_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint32 range_split_count = 2;
+      case 2: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(16u /* 16 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &range_split_count_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint32 sending_snap_count = 3;
+      case 3: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(24u /* 24 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &sending_snap_count_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint32 receiving_snap_count = 4;
+      case 4: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(32u /* 32 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &receiving_snap_count_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint32 applying_snap_count = 5;
+      case 5: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(40u /* 40 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &applying_snap_count_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint32 range_leader_count = 6;
+      case 6: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(48u /* 48 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &range_leader_count_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint64 capacity = 7;
+      case 7: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(56u /* 56 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &capacity_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint64 used_size = 8;
+      case 8: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(64u /* 64 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &used_size_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint64 available = 9;
+      case 9: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(72u /* 72 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &available_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint64 bytes_written = 10;
+      case 10: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(80u /* 80 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &bytes_written_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint64 keys_written = 11;
+      case 11: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(88u /* 88 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &keys_written_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint64 bytes_read = 12;
+      case 12: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(96u /* 96 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &bytes_read_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint64 keys_read = 13;
+      case 13: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(104u /* 104 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &keys_read_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // bool is_busy = 14;
+      case 14: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(112u /* 112 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
+                 input, &is_busy_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint32 start = 15;
+      case 15: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(120u /* 120 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &start_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // double cpu_usage = 16;
+      case 16: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(129u /* 129 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   double, ::google::protobuf::internal::WireFormatLite::TYPE_DOUBLE>(
+                 input, &cpu_usage_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // double process_cpu_usage = 17;
+      case 17: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(137u /* 137 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   double, ::google::protobuf::internal::WireFormatLite::TYPE_DOUBLE>(
+                 input, &process_cpu_usage_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint32 cpu_count = 18;
+      case 18: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(144u /* 144 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &cpu_count_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // double disk_util = 19;
+      case 19: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(153u /* 153 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   double, ::google::protobuf::internal::WireFormatLite::TYPE_DOUBLE>(
+                 input, &disk_util_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // double disk_read_latency_ms = 20;
+      case 20: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(161u /* 161 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   double, ::google::protobuf::internal::WireFormatLite::TYPE_DOUBLE>(
+                 input, &disk_read_latency_ms_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // double disk_write_latency_ms = 21;
+      case 21: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(169u /* 169 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   double, ::google::protobuf::internal::WireFormatLite::TYPE_DOUBLE>(
+                 input, &disk_write_latency_ms_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint64 disk_read_bytes = 22;
+      case 22: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(176u /* 176 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &disk_read_bytes_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint64 disk_write_bytes = 23;
+      case 23: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(184u /* 184 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &disk_write_bytes_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint64 net_in_bytes = 24;
+      case 24: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(192u /* 192 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &net_in_bytes_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint64 net_out_bytes = 25;
+      case 25: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(200u /* 200 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &net_out_bytes_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint64 perf_samples = 26;
+      case 26: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(208u /* 208 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &perf_samples_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint64 perf_block_cache_hits = 27;
+      case 27: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(216u /* 216 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &perf_block_cache_hits_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint64 perf_block_reads = 28;
+      case 28: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(224u /* 224 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &perf_block_reads_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint64 perf_block_read_bytes = 29;
+      case 29: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(232u /* 232 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &perf_block_read_bytes_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint64 perf_block_read_nanos = 30;
+      case 30: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(240u /* 240 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &perf_block_read_nanos_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint64 perf_memtable_nanos = 31;
+      case 31: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(248u /* 248 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &perf_memtable_nanos_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint64 perf_sst_nanos = 32;
+      case 32: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(0u /* 256 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &perf_sst_nanos_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint64 perf_iter_seek_nanos = 33;
+      case 33: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(8u /* 264 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &perf_iter_seek_nanos_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint64 perf_keys_skipped = 34;
+      case 34: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(16u /* 272 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &perf_keys_skipped_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint64 perf_deletes_skipped = 35;
+      case 35: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(24u /* 280 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &perf_deletes_skipped_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint64 perf_io_read_bytes = 36;
+      case 36: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(32u /* 288 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &perf_io_read_bytes_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint64 perf_io_read_nanos = 37;
+      case 37: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(40u /* 296 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &perf_io_read_nanos_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, _internal_metadata_.mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:mspb.NodeStats)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:mspb.NodeStats)
+  return false;
+#undef DO_
+}
+
+void NodeStats::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:mspb.NodeStats)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint32 range_count = 1;
+  if (this->range_count() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(1, this->range_count(), output);
+  }
+
+  // uint32 range_split_count = 2;
+  if (this->range_split_count() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(2, this->range_split_count(), output);
+  }
+
+  // uint32 sending_snap_count = 3;
+  if (this->sending_snap_count() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(3, this->sending_snap_count(), output);
+  }
+
+  // uint32 receiving_snap_count = 4;
+  if (this->receiving_snap_count() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(4, this->receiving_snap_count(), output);
+  }
+
+  // uint32 applying_snap_count = 5;
+  if (this->applying_snap_count() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(5, this->applying_snap_count(), output);
+  }
+
+  // uint32 range_leader_count = 6;
+  if (this->range_leader_count() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(6, this->range_leader_count(), output);
+  }
+
+  // uint64 capacity = 7;
+  if (this->capacity() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(7, this->capacity(), output);
+  }
+
+  // uint64 used_size = 8;
+  if (this->used_size() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(8, this->used_size(), output);
+  }
+
+  // uint64 available = 9;
+  if (this->available() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(9, this->available(), output);
+  }
+
+  // uint64 bytes_written = 10;
+  if (this->bytes_written() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(10, this->bytes_written(), output);
+  }
+
+  // uint64 keys_written = 11;
+  if (this->keys_written() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(11, this->keys_written(), output);
+  }
+
+  // uint64 bytes_read = 12;
+  if (this->bytes_read() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(12, this->bytes_read(), output);
+  }
+
+  // uint64 keys_read = 13;
+  if (this->keys_read() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(13, this->keys_read(), output);
+  }
+
+  // bool is_busy = 14;
+  if (this->is_busy() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteBool(14, this->is_busy(), output);
+  }
+
+  // uint32 start = 15;
+  if (this->start() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(15, this->start(), output);
+  }
+
+  // double cpu_usage = 16;
+  if (this->cpu_usage() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteDouble(16, this->cpu_usage(), output);
+  }
+
+  // double process_cpu_usage = 17;
+  if (this->process_cpu_usage() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteDouble(17, this->process_cpu_usage(), output);
+  }
+
+  // uint32 cpu_count = 18;
+  if (this->cpu_count() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(18, this->cpu_count(), output);
+  }
+
+  // double disk_util = 19;
+  if (this->disk_util() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteDouble(19, this->disk_util(), output);
+  }
+
+  // double disk_read_latency_ms = 20;
+  if (this->disk_read_latency_ms() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteDouble(20, this->disk_read_latency_ms(), output);
+  }
+
+  // double disk_write_latency_ms = 21;
+  if (this->disk_write_latency_ms() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteDouble(21, this->disk_write_latency_ms(), output);
+  }
+
+  // uint64 disk_read_bytes = 22;
+  if (this->disk_read_bytes() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(22, this->disk_read_bytes(), output);
+  }
+
+  // uint64 disk_write_bytes = 23;
+  if (this->disk_write_bytes() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(23, this->disk_write_bytes(), output);
+  }
+
+  // uint64 net_in_bytes = 24;
+  if (this->net_in_bytes() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(24, this->net_in_bytes(), output);
+  }
+
+  // uint64 net_out_bytes = 25;
+  if (this->net_out_bytes() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(25, this->net_out_bytes(), output);
+  }
+
+  // uint64 perf_samples = 26;
+  if (this->perf_samples() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(26, this->perf_samples(), output);
+  }
+
+  // uint64 perf_block_cache_hits = 27;
+  if (this->perf_block_cache_hits() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(27, this->perf_block_cache_hits(), output);
+  }
+
+  // uint64 perf_block_reads = 28;
+  if (this->perf_block_reads() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(28, this->perf_block_reads(), output);
+  }
+
+  // uint64 perf_block_read_bytes = 29;
+  if (this->perf_block_read_bytes() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(29, this->perf_block_read_bytes(), output);
+  }
+
+  // uint64 perf_block_read_nanos = 30;
+  if (this->perf_block_read_nanos() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(30, this->perf_block_read_nanos(), output);
+  }
+
+  // uint64 perf_memtable_nanos = 31;
+  if (this->perf_memtable_nanos() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(31, this->perf_memtable_nanos(), output);
+  }
+
+  // uint64 perf_sst_nanos = 32;
+  if (this->perf_sst_nanos() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(32, this->perf_sst_nanos(), output);
+  }
+
+  // uint64 perf_iter_seek_nanos = 33;
+  if (this->perf_iter_seek_nanos() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(33, this->perf_iter_seek_nanos(), output);
+  }
+
+  // uint64 perf_keys_skipped = 34;
+  if (this->perf_keys_skipped() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(34, this->perf_keys_skipped(), output);
+  }
+
+  // uint64 perf_deletes_skipped = 35;
+  if (this->perf_deletes_skipped() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(35, this->perf_deletes_skipped(), output);
+  }
+
+  // uint64 perf_io_read_bytes = 36;
+  if (this->perf_io_read_bytes() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(36, this->perf_io_read_bytes(), output);
+  }
+
+  // uint64 perf_io_read_nanos = 37;
+  if (this->perf_io_read_nanos() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(37, this->perf_io_read_nanos(), output);
+  }
+
+  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
+  }
+  // @@protoc_insertion_point(serialize_end:mspb.NodeStats)
+}
+
+::google::protobuf::uint8* NodeStats::InternalSerializeWithCachedSizesToArray(
+    bool deterministic, ::google::protobuf::uint8* target) const {
+  (void)deterministic; // Unused
+  // @@protoc_insertion_point(serialize_to_array_start:mspb.NodeStats)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint32 range_count = 1;
+  if (this->range_count() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(1, this->range_count(), target);
+  }
+
+  // uint32 range_split_count = 2;
+  if (this->range_split_count() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(2, this->range_split_count(), target);
+  }
+
+  // uint32 sending_snap_count = 3;
+  if (this->sending_snap_count() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(3, this->sending_snap_count(), target);
+  }
+
+  // uint32 receiving_snap_count = 4;
+  if (this->receiving_snap_count() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(4, this->receiving_snap_count(), target);
+  }
+
+  // uint32 applying_snap_count = 5;
+  if (this->applying_snap_count() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(5, this->applying_snap_count(), target);
+  }
+
+  // uint32 range_leader_count = 6;
+  if (this->range_leader_count() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(6, this->range_leader_count(), target);
+  }
+
+  // uint64 capacity = 7;
+  if (this->capacity() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(7, this->capacity(), target);
+  }
+
+  // uint64 used_size = 8;
+  if (this->used_size() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(8, this->used_size(), target);
+  }
+
+  // uint64 available = 9;
+  if (this->available() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(9, this->available(), target);
+  }
+
+  // uint64 bytes_written = 10;
+  if (this->bytes_written() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(10, this->bytes_written(), target);
+  }
+
+  // uint64 keys_written = 11;
+  if (this->keys_written() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(11, this->keys_written(), target);
+  }
+
+  // uint64 bytes_read = 12;
+  if (this->bytes_read() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(12, this->bytes_read(), target);
+  }
+
+  // uint64 keys_read = 13;
+  if (this->keys_read() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(13, this->keys_read(), target);
+  }
+
+  // bool is_busy = 14;
+  if (this->is_busy() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(14, this->is_busy(), target);
+  }
+
+  // uint32 start = 15;
+  if (this->start() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(15, this->start(), target);
+  }
+
+  // double cpu_usage = 16;
+  if (this->cpu_usage() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteDoubleToArray(16, this->cpu_usage(), target);
+  }
+
+  // double process_cpu_usage = 17;
+  if (this->process_cpu_usage() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteDoubleToArray(17, this->process_cpu_usage(), target);
+  }
+
+  // uint32 cpu_count = 18;
+  if (this->cpu_count() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(18, this->cpu_count(), target);
+  }
+
+  // double disk_util = 19;
+  if (this->disk_util() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteDoubleToArray(19, this->disk_util(), target);
+  }
+
+  // double disk_read_latency_ms = 20;
+  if (this->disk_read_latency_ms() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteDoubleToArray(20, this->disk_read_latency_ms(), target);
+  }
+
+  // double disk_write_latency_ms = 21;
+  if (this->disk_write_latency_ms() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteDoubleToArray(21, this->disk_write_latency_ms(), target);
+  }
+
+  // uint64 disk_read_bytes = 22;
+  if (this->disk_read_bytes() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(22, this->disk_read_bytes(), target);
+  }
+
+  // uint64 disk_write_bytes = 23;
+  if (this->disk_write_bytes() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(23, this->disk_write_bytes(), target);
+  }
+
+  // uint64 net_in_bytes = 24;
+  if (this->net_in_bytes() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(24, this->net_in_bytes(), target);
+  }
+
+  // uint64 net_out_bytes = 25;
+  if (this->net_out_bytes() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(25, this->net_out_bytes(), target);
+  }
+
+  // uint64 perf_samples = 26;
+  if (this->perf_samples() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(26, this->perf_samples(), target);
+  }
+
+  // uint64 perf_block_cache_hits = 27;
+  if (this->perf_block_cache_hits() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(27, this->perf_block_cache_hits(), target);
+  }
+
+  // uint64 perf_block_reads = 28;
+  if (this->perf_block_reads() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(28, this->perf_block_reads(), target);
+  }
+
+  // uint64 perf_block_read_bytes = 29;
+  if (this->perf_block_read_bytes() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(29, this->perf_block_read_bytes(), target);
+  }
+
+  // uint64 perf_block_read_nanos = 30;
+  if (this->perf_block_read_nanos() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(30, this->perf_block_read_nanos(), target);
+  }
+
+  // uint64 perf_memtable_nanos = 31;
+  if (this->perf_memtable_nanos() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(31, this->perf_memtable_nanos(), target);
+  }
+
+  // uint64 perf_sst_nanos = 32;
+  if (this->perf_sst_nanos() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(32, this->perf_sst_nanos(), target);
+  }
+
+  // uint64 perf_iter_seek_nanos = 33;
+  if (this->perf_iter_seek_nanos() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(33, this->perf_iter_seek_nanos(), target);
+  }
+
+  // uint64 perf_keys_skipped = 34;
+  if (this->perf_keys_skipped() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(34, this->perf_keys_skipped(), target);
+  }
+
+  // uint64 perf_deletes_skipped = 35;
+  if (this->perf_deletes_skipped() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(35, this->perf_deletes_skipped(), target);
+  }
+
+  // uint64 perf_io_read_bytes = 36;
+  if (this->perf_io_read_bytes() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(36, this->perf_io_read_bytes(), target);
+  }
+
+  // uint64 perf_io_read_nanos = 37;
+  if (this->perf_io_read_nanos() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(37, this->perf_io_read_nanos(), target);
+  }
+
+  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:mspb.NodeStats)
+  return target;
+}
+
+size_t NodeStats::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mspb.NodeStats)
+  size_t total_size = 0;
+
+  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
+  }
+  // uint32 range_count = 1;
+  if (this->range_count() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt32Size(
+        this->range_count());
+  }
+
+  // uint32 range_split_count = 2;
+  if (this->range_split_count() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt32Size(
+        this->range_split_count());
+  }
+
+  // uint32 sending_snap_count = 3;
+  if (this->sending_snap_count() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt32Size(
+        this->sending_snap_count());
+  }
+
+  // uint32 receiving_snap_count = 4;
+  if (this->receiving_snap_count() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt32Size(
+        this->receiving_snap_count());
+  }
+
+  // uint32 applying_snap_count = 5;
+  if (this->applying_snap_count() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt32Size(
+        this->applying_snap_count());
+  }
+
+  // uint32 range_leader_count = 6;
+  if (this->range_leader_count() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt32Size(
+        this->range_leader_count());
+  }
+
+  // uint64 capacity = 7;
+  if (this->capacity() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt64Size(
+        this->capacity());
+  }
+
+  // uint64 used_size = 8;
+  if (this->used_size() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt64Size(
+        this->used_size());
+  }
+
+  // uint64 available = 9;
+  if (this->available() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt64Size(
+        this->available());
+  }
+
+  // uint64 bytes_written = 10;
+  if (this->bytes_written() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt64Size(
+        this->bytes_written());
+  }
+
+  // uint64 keys_written = 11;
+  if (this->keys_written() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt64Size(
+        this->keys_written());
+  }
+
+  // uint64 bytes_read = 12;
+  if (this->bytes_read() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt64Size(
+        this->bytes_read());
+  }
+
+  // uint64 keys_read = 13;
+  if (this->keys_read() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt64Size(
+        this->keys_read());
+  }
+
+  // bool is_busy = 14;
+  if (this->is_busy() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // uint32 start = 15;
+  if (this->start() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt32Size(
+        this->start());
+  }
+
+  // double cpu_usage = 16;
+  if (this->cpu_usage() != 0) {
+    total_size += 2 + 8;
+  }
+
+  // double process_cpu_usage = 17;
+  if (this->process_cpu_usage() != 0) {
+    total_size += 2 + 8;
+  }
+
+  // double disk_util = 19;
+  if (this->disk_util() != 0) {
+    total_size += 2 + 8;
+  }
+
+  // double disk_read_latency_ms = 20;
+  if (this->disk_read_latency_ms() != 0) {
+    total_size += 2 + 8;
+  }
+
+  // double disk_write_latency_ms = 21;
+  if (this->disk_write_latency_ms() != 0) {
+    total_size += 2 + 8;
+  }
+
+  // uint64 disk_read_bytes = 22;
+  if (this->disk_read_bytes() != 0) {
+    total_size += 2 +
+      ::google::protobuf::internal::WireFormatLite::UInt64Size(
+        this->disk_read_bytes());
+  }
+
+  // uint64 disk_write_bytes = 23;
+  if (this->disk_write_bytes() != 0) {
+    total_size += 2 +
+      ::google::protobuf::internal::WireFormatLite::UInt64Size(
+        this->disk_write_bytes());
+  }
+
+  // uint64 net_in_bytes = 24;
+  if (this->net_in_bytes() != 0) {
+    total_size += 2 +
+      ::google::protobuf::internal::WireFormatLite::UInt64Size(
+        this->net_in_bytes());
+  }
+
+  // uint64 net_out_bytes = 25;
+  if (this->net_out_bytes() != 0) {
+    total_size += 2 +
+      ::google::protobuf::internal::WireFormatLite::UInt64Size(
+        this->net_out_bytes());
+  }
+
+  // uint64 perf_samples = 26;
+  if (this->perf_samples() != 0) {
+    total_size += 2 +
+      ::google::protobuf::internal::WireFormatLite::UInt64Size(
+        this->perf_samples());
+  }
+
+  // uint64 perf_block_cache_hits = 27;
+  if (this->perf_block_cache_hits() != 0) {
+    total_size += 2 +
+      ::google::protobuf::internal::WireFormatLite::UInt64Size(
+        this->perf_block_cache_hits());
+  }
+
+  // uint64 perf_block_reads = 28;
+  if (this->perf_block_reads() != 0) {
+    total_size += 2 +
+      ::google::protobuf::internal::WireFormatLite::UInt64Size(
+        this->perf_block_reads());
+  }
+
+  // uint64 perf_block_read_bytes = 29;
+  if (this->perf_block_read_bytes() != 0) {
+    total_size += 2 +
+      ::google::protobuf::internal::WireFormatLite::UInt64Size(
+        this->perf_block_read_bytes());
+  }
+
+  // uint64 perf_block_read_nanos = 30;
+  if (this->perf_block_read_nanos() != 0) {
+    total_size += 2 +
+      ::google::protobuf::internal::WireFormatLite::UInt64Size(
+        this->perf_block_read_nanos());
+  }
+
+  // uint64 perf_memtable_nanos = 31;
+  if (this->perf_memtable_nanos() != 0) {
+    total_size += 2 +
+      ::google::protobuf::internal::WireFormatLite::UInt64Size(
+        this->perf_memtable_nanos());
+  }
+
+  // uint64 perf_sst_nanos = 32;
+  if (this->perf_sst_nanos() != 0) {
+    total_size += 2 +
+      ::google::protobuf::internal::WireFormatLite::UInt64Size(
+        this->perf_sst_nanos());
+  }
+
+  // uint64 perf_iter_seek_nanos = 33;
+  if (this->perf_iter_seek_nanos() != 0) {
+    total_size += 2 +
+      ::google::protobuf::internal::WireFormatLite::UInt64Size(
+        this->perf_iter_seek_nanos());
+  }
+
+  // uint64 perf_keys_skipped = 34;
+  if (this->perf_keys_skipped() != 0) {
+    total_size += 2 +
+      ::google::protobuf::internal::WireFormatLite::UInt64Size(
+        this->perf_keys_skipped());
+  }
+
+  // uint64 perf_deletes_skipped = 35;
+  if (this->perf_deletes_skipped() != 0) {
+    total_size += 2 +
+      ::google::protobuf::internal::WireFormatLite::UInt64Size(
+        this->perf_deletes_skipped());
+  }
+
+  // uint64 perf_io_read_bytes = 36;
+  if (this->perf_io_read_bytes() != 0) {
+    total_size += 2 +
+      ::google::protobuf::internal::WireFormatLite::UInt64Size(
+        this->perf_io_read_bytes());
+  }
+
+  // uint64 perf_io_read_nanos = 37;
+  if (this->perf_io_read_nanos() != 0) {
+    total_size += 2 +
+      ::google::protobuf::internal::WireFormatLite::UInt64Size(
+        this->perf_io_read_nanos());
+  }
+
+  // uint32 cpu_count = 18;
+  if (this->cpu_count() != 0) {
+    total_size += 2 +
+      ::google::protobuf::internal::WireFormatLite::UInt32Size(
+        this->cpu_count());
+  }
+
+  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = cached_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void NodeStats::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:mspb.NodeStats)
+  GOOGLE_DCHECK_NE(&from, this);
+  const NodeStats* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const NodeStats>(
+          &from);
+  if (source == NULL) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:mspb.NodeStats)
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:mspb.NodeStats)
+    MergeFrom(*source);
+  }
+}
+
+void NodeStats::MergeFrom(const NodeStats& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:mspb.NodeStats)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.range_count() != 0) {
+    set_range_count(from.range_count());
+  }
+  if (from.range_split_count() != 0) {
+    set_range_split_count(from.range_split_count());
+  }
+  if (from.sending_snap_count() != 0) {
+    set_sending_snap_count(from.sending_snap_count());
+  }
+  if (from.receiving_snap_count() != 0) {
+    set_receiving_snap_count(from.receiving_snap_count());
+  }
+  if (from.applying_snap_count() != 0) {
+    set_applying_snap_count(from.applying_snap_count());
+  }
+  if (from.range_leader_count() != 0) {
+    set_range_leader_count(from.range_leader_count());
+  }
+  if (from.capacity() != 0) {
+    set_capacity(from.capacity());
+  }
+  if (from.used_size() != 0) {
+    set_used_size(from.used_size());
+  }
+  if (from.available() != 0) {
+    set_available(from.available());
+  }
+  if (from.bytes_written() != 0) {
+    set_bytes_written(from.bytes_written());
+  }
+  if (from.keys_written() != 0) {
+    set_keys_written(from.keys_written());
+  }
+  if (from.bytes_read() != 0) {
+    set_bytes_read(from.bytes_read());
+  }
+  if (from.keys_read() != 0) {
+    set_keys_read(from.keys_read());
+  }
+  if (from.is_busy() != 0) {
+    set_is_busy(from.is_busy());
+  }
+  if (from.start() != 0) {
+    set_start(from.start());
+  }
+  if (from.cpu_usage() != 0) {
+    set_cpu_usage(from.cpu_usage());
+  }
+  if (from.process_cpu_usage() != 0) {
+    set_process_cpu_usage(from.process_cpu_usage());
+  }
+  if (from.disk_util() != 0) {
+    set_disk_util(from.disk_util());
+  }
+  if (from.disk_read_latency_ms() != 0) {
+    set_disk_read_latency_ms(from.disk_read_latency_ms());
+  }
+  if (from.disk_write_latency_ms() != 0) {
+    set_disk_write_latency_ms(from.disk_write_latency_ms());
+  }
+  if (from.disk_read_bytes() != 0) {
+    set_disk_read_bytes(from.disk_read_bytes());
+  }
+  if (from.disk_write_bytes() != 0) {
+    set_disk_write_bytes(from.disk_write_bytes());
+  }
+  if (from.net_in_bytes() != 0) {
+    set_net_in_bytes(from.net_in_bytes());
+  }
+  if (from.net_out_bytes() != 0) {
+    set_net_out_bytes(from.net_out_bytes());
+  }
+  if (from.perf_samples() != 0) {
+    set_perf_samples(from.perf_samples());
+  }
+  if (from.perf_block_cache_hits() != 0) {
+    set_perf_block_cache_hits(from.perf_block_cache_hits());
+  }
+  if (from.perf_block_reads() != 0) {
+    set_perf_block_reads(from.perf_block_reads());
+  }
+  if (from.perf_block_read_bytes() != 0) {
+    set_perf_block_read_bytes(from.perf_block_read_bytes());
+  }
+  if (from.perf_block_read_nanos() != 0) {
+    set_perf_block_read_nanos(from.perf_block_read_nanos());
+  }
+  if (from.perf_memtable_nanos() != 0) {
+    set_perf_memtable_nanos(from.perf_memtable_nanos());
+  }
+  if (from.perf_sst_nanos() != 0) {
+    set_perf_sst_nanos(from.perf_sst_nanos());
+  }
+  if (from.perf_iter_seek_nanos() != 0) {
+    set_perf_iter_seek_nanos(from.perf_iter_seek_nanos());
+  }
+  if (from.perf_keys_skipped() != 0) {
+    set_perf_keys_skipped(from.perf_keys_skipped());
+  }
+  if (from.perf_deletes_skipped() != 0) {
+    set_perf_deletes_skipped(from.perf_deletes_skipped());
+  }
+  if (from.perf_io_read_bytes() != 0) {
+    set_perf_io_read_bytes(from.perf_io_read_bytes());
+  }
+  if (from.perf_io_read_nanos() != 0) {
+    set_perf_io_read_nanos(from.perf_io_read_nanos());
+  }
+  if (from.cpu_count() != 0) {
+    set_cpu_count(from.cpu_count());
+  }
+}
+
+void NodeStats::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:mspb.NodeStats)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void NodeStats::CopyFrom(const NodeStats& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mspb.NodeStats)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool NodeStats::IsInitialized() const {
+  return true;
+}
+
+void NodeStats::Swap(NodeStats* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void NodeStats::InternalSwap(NodeStats* other) {
+  using std::swap;
+  swap(range_count_, other->range_count_);
+  swap(range_split_count_, other->range_split_count_);
+  swap(sending_snap_count_, other->sending_snap_count_);
+  swap(receiving_snap_count_, other->receiving_snap_count_);
+  swap(applying_snap_count_, other->applying_snap_count_);
+  swap(range_leader_count_, other->range_leader_count_);
+  swap(capacity_, other->capacity_);
+  swap(used_size_, other->used_size_);
+  swap(available_, other->available_);
+  swap(bytes_written_, other->bytes_written_);
+  swap(keys_written_, other->keys_written_);
+  swap(bytes_read_, other->bytes_read_);
+  swap(keys_read_, other->keys_read_);
+  swap(is_busy_, other->is_busy_);
+  swap(start_, other->start_);
+  swap(cpu_usage_, other->cpu_usage_);
+  swap(process_cpu_usage_, other->process_cpu_usage_);
+  swap(disk_util_, other->disk_util_);
+  swap(disk_read_latency_ms_, other->disk_read_latency_ms_);
+  swap(disk_write_latency_ms_, other->disk_write_latency_ms_);
+  swap(disk_read_bytes_, other->disk_read_bytes_);
+  swap(disk_write_bytes_, other->disk_write_bytes_);
+  swap(net_in_bytes_, other->net_in_bytes_);
+  swap(net_out_bytes_, other->net_out_bytes_);
+  swap(perf_samples_, other->perf_samples_);
+  swap(perf_block_cache_hits_, other->perf_block_cache_hits_);
+  swap(perf_block_reads_, other->perf_block_reads_);
+  swap(perf_block_read_bytes_, other->perf_block_read_bytes_);
+  swap(perf_block_read_nanos_, other->perf_block_read_nanos_);
+  swap(perf_memtable_nanos_, other->perf_memtable_nanos_);
+  swap(perf_sst_nanos_, other->perf_sst_nanos_);
+  swap(perf_iter_seek_nanos_, other->perf_iter_seek_nanos_);
+  swap(perf_keys_skipped_, other->perf_keys_skipped_);
+  swap(perf_deletes_skipped_, other->perf_deletes_skipped_);
+  swap(perf_io_read_bytes_, other->perf_io_read_bytes_);
+  swap(perf_io_read_nanos_, other->perf_io_read_nanos_);
+  swap(cpu_count_, other->cpu_count_);
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  swap(_cached_size_, other->_cached_size_);
+}
+
+::google::protobuf::Metadata NodeStats::GetMetadata() const {
+  protobuf_mspb_2eproto::protobuf_AssignDescriptorsOnce();
+  return protobuf_mspb_2eproto::file_level_metadata[kIndexInFileMessages];
+}
+
+#if PROTOBUF_INLINE_NOT_IN_HEADERS
+// NodeStats
+
+// uint32 range_count = 1;
+void NodeStats::clear_range_count() {
+  range_count_ = 0u;
+}
+::google::protobuf::uint32 NodeStats::range_count() const {
+  // @@protoc_insertion_point(field_get:mspb.NodeStats.range_count)
+  return range_count_;
+}
+void NodeStats::set_range_count(::google::protobuf::uint32 value) {
+  
+  range_count_ = value;
+  // @@protoc_insertion_point(field_set:mspb.NodeStats.range_count)
+}
+
+// uint32 range_split_count = 2;
+void NodeStats::clear_range_split_count() {
+  range_split_count_ = 0u;
+}
+::google::protobuf::uint32 NodeStats::range_split_count() const {
+  // @@protoc_insertion_point(field_get:mspb.NodeStats.range_split_count)
+  return range_split_count_;
+}
+void NodeStats::set_range_split_count(::google::protobuf::uint32 value) {
+  
+  range_split_count_ = value;
+  // @@protoc_insertion_point(field_set:mspb.NodeStats.range_split_count)
+}
+
+// uint32 sending_snap_count = 3;
+void NodeStats::clear_sending_snap_count() {
+  sending_snap_count_ = 0u;
+}
+::google::protobuf::uint32 NodeStats::sending_snap_count() const {
+  // @@protoc_insertion_point(field_get:mspb.NodeStats.sending_snap_count)
+  return sending_snap_count_;
+}
+void NodeStats::set_sending_snap_count(::google::protobuf::uint32 value) {
+  
+  sending_snap_count_ = value;
+  // @@protoc_insertion_point(field_set:mspb.NodeStats.sending_snap_count)
+}
+
+// uint32 receiving_snap_count = 4;
+void NodeStats::clear_receiving_snap_count() {
+  receiving_snap_count_ = 0u;
+}
+::google::protobuf::uint32 NodeStats::receiving_snap_count() const {
+  // @@protoc_insertion_point(field_get:mspb.NodeStats.receiving_snap_count)
+  return receiving_snap_count_;
+}
+void NodeStats::set_receiving_snap_count(::google::protobuf::uint32 value) {
+  
+  receiving_snap_count_ = value;
+  // @@protoc_insertion_point(field_set:mspb.NodeStats.receiving_snap_count)
+}
+
+// uint32 applying_snap_count = 5;
+void NodeStats::clear_applying_snap_count() {
+  applying_snap_count_ = 0u;
+}
+::google::protobuf::uint32 NodeStats::applying_snap_count() const {
+  // @@protoc_insertion_point(field_get:mspb.NodeStats.applying_snap_count)
+  return applying_snap_count_;
+}
+void NodeStats::set_applying_snap_count(::google::protobuf::uint32 value) {
+  
+  applying_snap_count_ = value;
+  // @@protoc_insertion_point(field_set:mspb.NodeStats.applying_snap_count)
+}
+
+// uint32 range_leader_count = 6;
+void NodeStats::clear_range_leader_count() {
+  range_leader_count_ = 0u;
+}
+::google::protobuf::uint32 NodeStats::range_leader_count() const {
+  // @@protoc_insertion_point(field_get:mspb.NodeStats.range_leader_count)
+  return range_leader_count_;
+}
+void NodeStats::set_range_leader_count(::google::protobuf::uint32 value) {
+  
+  range_leader_count_ = value;
+  // @@protoc_insertion_point(field_set:mspb.NodeStats.range_leader_count)
+}
+
+// uint64 capacity = 7;
+void NodeStats::clear_capacity() {
+  capacity_ = GOOGLE_ULONGLONG(0);
+}
+::google::protobuf::uint64 NodeStats::capacity() const {
+  // @@protoc_insertion_point(field_get:mspb.NodeStats.capacity)
+  return capacity_;
+}
+void NodeStats::set_capacity(::google::protobuf::uint64 value) {
+  
+  capacity_ = value;
+  // @@protoc_insertion_point(field_set:mspb.NodeStats.capacity)
+}
+
+// uint64 used_size = 8;
+void NodeStats::clear_used_size() {
+  used_size_ = GOOGLE_ULONGLONG(0);
+}
+::google::protobuf::uint64 NodeStats::used_size() const {
+  // @@protoc_insertion_point(field_get:mspb.NodeStats.used_size)
+  return used_size_;
+}
+void NodeStats::set_used_size(::google::protobuf::uint64 value) {
+  
+  used_size_ = value;
+  // @@protoc_insertion_point(field_set:mspb.NodeStats.used_size)
+}
+
+// uint64 available = 9;
+void NodeStats::clear_available() {
+  available_ = GOOGLE_ULONGLONG(0);
+}
+::google::protobuf::uint64 NodeStats::available() const {
+  // @@protoc_insertion_point(field_get:mspb.NodeStats.available)
+  return available_;
+}
+void NodeStats::set_available(::google::protobuf::uint64 value) {
+  
+  available_ = value;
+  // @@protoc_insertion_point(field_set:mspb.NodeStats.available)
+}
+
+// uint64 bytes_written = 10;
+void NodeStats::clear_bytes_written() {
+  bytes_written_ = GOOGLE_ULONGLONG(0);
+}
+::google::protobuf::uint64 NodeStats::bytes_written() const {
+  // @@protoc_insertion_point(field_get:mspb.NodeStats.bytes_written)
+  return bytes_written_;
+}
+void NodeStats::set_bytes_written(::google::protobuf::uint64 value) {
+  
+  bytes_written_ = value;
+  // @@protoc_insertion_point(field_set:mspb.NodeStats.bytes_written)
+}
+
+// uint64 keys_written = 11;
+void NodeStats::clear_keys_written() {
+  keys_written_ = GOOGLE_ULONGLONG(0);
+}
+::google::protobuf::uint64 NodeStats::keys_written() const {
+  // @@protoc_insertion_point(field_get:mspb.NodeStats.keys_written)
+  return keys_written_;
+}
+void NodeStats::set_keys_written(::google::protobuf::uint64 value) {
+  
+  keys_written_ = value;
+  // @@protoc_insertion_point(field_set:mspb.NodeStats.keys_written)
+}
+
+// uint64 bytes_read = 12;
+void NodeStats::clear_bytes_read() {
+  bytes_read_ = GOOGLE_ULONGLONG(0);
+}
+::google::protobuf::uint64 NodeStats::bytes_read() const {
+  // @@protoc_insertion_point(field_get:mspb.NodeStats.bytes_read)
+  return bytes_read_;
+}
+void NodeStats::set_bytes_read(::google::protobuf::uint64 value) {
+  
+  bytes_read_ = value;
+  // @@protoc_insertion_point(field_set:mspb.NodeStats.bytes_read)
+}
+
+// uint64 keys_read = 13;
+void NodeStats::clear_keys_read() {
+  keys_read_ = GOOGLE_ULONGLONG(0);
+}
+::google::protobuf::uint64 NodeStats::keys_read() const {
+  // @@protoc_insertion_point(field_get:mspb.NodeStats.keys_read)
+  return keys_read_;
+}
+void NodeStats::set_keys_read(::google::protobuf::uint64 value) {
+  
+  keys_read_ = value;
+  // @@protoc_insertion_point(field_set:mspb.NodeStats.keys_read)
+}
+
+// bool is_busy = 14;
+void NodeStats::clear_is_busy() {
+  is_busy_ = false;
+}
+bool NodeStats::is_busy() const {
+  // @@protoc_insertion_point(field_get:mspb.NodeStats.is_busy)
+  return is_busy_;
+}
+void NodeStats::set_is_busy(bool value) {
+  
+  is_busy_ = value;
+  // @@protoc_insertion_point(field_set:mspb.NodeStats.is_busy)
+}
+
+// uint32 start = 15;
+void NodeStats::clear_start() {
+  start_ = 0u;
+}
+::google::protobuf::uint32 NodeStats::start() const {
+  // @@protoc_insertion_point(field_get:mspb.NodeStats.start)
+  return start_;
+}
+void NodeStats::set_start(::google::protobuf::uint32 value) {
+  
+  start_ = value;
+  // @@protoc_insertion_point(field_set:mspb.NodeStats.start)
+}
+
+// double cpu_usage = 16;
+void NodeStats::clear_cpu_usage() {
+  cpu_usage_ = 0;
+}
+double NodeStats::cpu_usage() const {
+  // @@protoc_insertion_point(field_get:mspb.NodeStats.cpu_usage)
+  return cpu_usage_;
+}
+void NodeStats::set_cpu_usage(double value) {
+  
+  cpu_usage_ = value;
+  // @@protoc_insertion_point(field_set:mspb.NodeStats.cpu_usage)
+}
+
+// double process_cpu_usage = 17;
+void NodeStats::clear_process_cpu_usage() {
+  process_cpu_usage_ = 0;
+}
+double NodeStats::process_cpu_usage() const {
+  // @@protoc_insertion_point(field_get:mspb.NodeStats.process_cpu_usage)
+  return process_cpu_usage_;
+}
+void NodeStats::set_process_cpu_usage(double value) {
+  
+  process_cpu_usage_ = value;
+  // @@protoc_insertion_point(field_set:mspb.NodeStats.process_cpu_usage)
+}
+
+// uint32 cpu_count = 18;
+void NodeStats::clear_cpu_count() {
+  cpu_count_ = 0u;
+}
+::google::protobuf::uint32 NodeStats::cpu_count() const {
+  // @@protoc_insertion_point(field_get:mspb.NodeStats.cpu_count)
+  return cpu_count_;
+}
+void NodeStats::set_cpu_count(::google::protobuf::uint32 value) {
+  
+  cpu_count_ = value;
+  // @@protoc_insertion_point(field_set:mspb.NodeStats.cpu_count)
+}
+
+// double disk_util = 19;
+void NodeStats::clear_disk_util() {
+  disk_util_ = 0;
+}
+double NodeStats::disk_util() const {
+  // @@protoc_insertion_point(field_get:mspb.NodeStats.disk_util)
+  return disk_util_;
+}
+void NodeStats::set_disk_util(double value) {
+  
+  disk_util_ = value;
+  // @@protoc_insertion_point(field_set:mspb.NodeStats.disk_util)
+}
+
+// double disk_read_latency_ms = 20;
+void NodeStats::clear_disk_read_latency_ms() {
+  disk_read_latency_ms_ = 0;
+}
+double NodeStats::disk_read_latency_ms() const {
+  // @@protoc_insertion_point(field_get:mspb.NodeStats.disk_read_latency_ms)
+  return disk_read_latency_ms_;
+}
+void NodeStats::set_disk_read_latency_ms(double value) {
+  
+  disk_read_latency_ms_ = value;
+  // @@protoc_insertion_point(field_set:mspb.NodeStats.disk_read_latency_ms)
+}
+
+// double disk_write_latency_ms = 21;
+void NodeStats::clear_disk_write_latency_ms() {
+  disk_write_latency_ms_ = 0;
+}
+double NodeStats::disk_write_latency_ms() const {
+  // @@protoc_insertion_point(field_get:mspb.NodeStats.disk_write_latency_ms)
+  return disk_write_latency_ms_;
+}
+void NodeStats::set_disk_write_latency_ms(double value) {
+  
+  disk_write_latency_ms_ = value;
+  // @@protoc_insertion_point(field_set:mspb.NodeStats.disk_write_latency_ms)
+}
+
+// uint64 disk_read_bytes = 22;
+void NodeStats::clear_disk_read_bytes() {
+  disk_read_bytes_ = GOOGLE_ULONGLONG(0);
+}
+::google::protobuf::uint64 NodeStats::disk_read_bytes() const {
+  // @@protoc_insertion_point(field_get:mspb.NodeStats.disk_read_bytes)
+  return disk_read_bytes_;
+}
+void NodeStats::set_disk_read_bytes(::google::protobuf::uint64 value) {
+  
+  disk_read_bytes_ = value;
+  // @@protoc_insertion_point(field_set:mspb.NodeStats.disk_read_bytes)
+}
+
+// uint64 disk_write_bytes = 23;
+void NodeStats::clear_disk_write_bytes() {
+  disk_write_bytes_ = GOOGLE_ULONGLONG(0);
+}
+::google::protobuf::uint64 NodeStats::disk_write_bytes() const {
+  // @@protoc_insertion_point(field_get:mspb.NodeStats.disk_write_bytes)
+  return disk_write_bytes_;
+}
+void NodeStats::set_disk_write_bytes(::google::protobuf::uint64 value) {
+  
+  disk_write_bytes_ = value;
+  // @@protoc_insertion_point(field_set:mspb.NodeStats.disk_write_bytes)
+}
+
+// uint64 net_in_bytes = 24;
+void NodeStats::clear_net_in_bytes() {
+  net_in_bytes_ = GOOGLE_ULONGLONG(0);
+}
+::google::protobuf::uint64 NodeStats::net_in_bytes() const {
+  // @@protoc_insertion_point(field_get:mspb.NodeStats.net_in_bytes)
+  return net_in_bytes_;
+}
+void NodeStats::set_net_in_bytes(::google::protobuf::uint64 value) {
+  
+  net_in_bytes_ = value;
+  // @@protoc_insertion_point(field_set:mspb.NodeStats.net_in_bytes)
+}
+
+// uint64 net_out_bytes = 25;
+void NodeStats::clear_net_out_bytes() {
+  net_out_bytes_ = GOOGLE_ULONGLONG(0);
+}
+::google::protobuf::uint64 NodeStats::net_out_bytes() const {
+  // @@protoc_insertion_point(field_get:mspb.NodeStats.net_out_bytes)
+  return net_out_bytes_;
+}
+void NodeStats::set_net_out_bytes(::google::protobuf::uint64 value) {
+  
+  net_out_bytes_ = value;
+  // @@protoc_insertion_point(field_set:mspb.NodeStats.net_out_bytes)
+}
+
+// uint64 perf_samples = 26;
+void NodeStats::clear_perf_samples() {
+  perf_samples_ = GOOGLE_ULONGLONG(0);
+}
+::google::protobuf::uint64 NodeStats::perf_samples() const {
+  // @@protoc_insertion_point(field_get:mspb.NodeStats.perf_samples)
+  return perf_samples_;
+}
+void NodeStats::set_perf_samples(::google::protobuf::uint64 value) {
+  
+  perf_samples_ = value;
+  // @@protoc_insertion_point(field_set:mspb.NodeStats.perf_samples)
+}
+
+// uint64 perf_block_cache_hits = 27;
+void NodeStats::clear_perf_block_cache_hits() {
+  perf_block_cache_hits_ = GOOGLE_ULONGLONG(0);
+}
+::google::protobuf::uint64 NodeStats::perf_block_cache_hits() const {
+  // @@protoc_insertion_point(field_get:mspb.NodeStats.perf_block_cache_hits)
+  return perf_block_cache_hits_;
+}
+void NodeStats::set_perf_block_cache_hits(::google::protobuf::uint64 value) {
+  
+  perf_block_cache_hits_ = value;
+  // @@protoc_insertion_point(field_set:mspb.NodeStats.perf_block_cache_hits)
+}
+
+// uint64 perf_block_reads = 28;
+void NodeStats::clear_perf_block_reads() {
+  perf_block_reads_ = GOOGLE_ULONGLONG(0);
+}
+::google::protobuf::uint64 NodeStats::perf_block_reads() const {
+  // @@protoc_insertion_point(field_get:mspb.NodeStats.perf_block_reads)
+  return perf_block_reads_;
+}
+void NodeStats::set_perf_block_reads(::google::protobuf::uint64 value) {
+  
+  perf_block_reads_ = value;
+  // @@protoc_insertion_point(field_set:mspb.NodeStats.perf_block_reads)
+}
+
+// uint64 perf_block_read_bytes = 29;
+void NodeStats::clear_perf_block_read_bytes() {
+  perf_block_read_bytes_ = GOOGLE_ULONGLONG(0);
+}
+::google::protobuf::uint64 NodeStats::perf_block_read_bytes() const {
+  // @@protoc_insertion_point(field_get:mspb.NodeStats.perf_block_read_bytes)
+  return perf_block_read_bytes_;
+}
+void NodeStats::set_perf_block_read_bytes(::google::protobuf::uint64 value) {
+  
+  perf_block_read_bytes_ = value;
+  // @@protoc_insertion_point(field_set:mspb.NodeStats.perf_block_read_bytes)
+}
+
+// uint64 perf_block_read_nanos = 30;
+void NodeStats::clear_perf_block_read_nanos() {
+  perf_block_read_nanos_ = GOOGLE_ULONGLONG(0);
+}
+::google::protobuf::uint64 NodeStats::perf_block_read_nanos() const {
+  // @@protoc_insertion_point(field_get:mspb.NodeStats.perf_block_read_nanos)
+  return perf_block_read_nanos_;
+}
+void NodeStats::set_perf_block_read_nanos(::google::protobuf::uint64 value) {
+  
+  perf_block_read_nanos_ = value;
+  // @@protoc_insertion_point(field_set:mspb.NodeStats.perf_block_read_nanos)
+}
+
+// uint64 perf_memtable_nanos = 31;
+void NodeStats::clear_perf_memtable_nanos() {
+  perf_memtable_nanos_ = GOOGLE_ULONGLONG(0);
+}
+::google::protobuf::uint64 NodeStats::perf_memtable_nanos() const {
+  // @@protoc_insertion_point(field_get:mspb.NodeStats.perf_memtable_nanos)
+  return perf_memtable_nanos_;
+}
+void NodeStats::set_perf_memtable_nanos(::google::protobuf::uint64 value) {
+  
+  perf_memtable_nanos_ = value;
+  // @@protoc_insertion_point(field_set:mspb.NodeStats.perf_memtable_nanos)
+}
+
+// uint64 perf_sst_nanos = 32;
+void NodeStats::clear_perf_sst_nanos() {
+  perf_sst_nanos_ = GOOGLE_ULONGLONG(0);
+}
+::google::protobuf::uint64 NodeStats::perf_sst_nanos() const {
+  // @@protoc_insertion_point(field_get:mspb.NodeStats.perf_sst_nanos)
+  return perf_sst_nanos_;
+}
+void NodeStats::set_perf_sst_nanos(::google::protobuf::uint64 value) {
+  
+  perf_sst_nanos_ = value;
+  // @@protoc_insertion_point(field_set:mspb.NodeStats.perf_sst_nanos)
+}
+
+// uint64 perf_iter_seek_nanos = 33;
+void NodeStats::clear_perf_iter_seek_nanos() {
+  perf_iter_seek_nanos_ = GOOGLE_ULONGLONG(0);
+}
+::google::protobuf::uint64 NodeStats::perf_iter_seek_nanos() const {
+  // @@protoc_insertion_point(field_get:mspb.NodeStats.perf_iter_seek_nanos)
+  return perf_iter_seek_nanos_;
+}
+void NodeStats::set_perf_iter_seek_nanos(::google::protobuf::uint64 value) {
+  
+  perf_iter_seek_nanos_ = value;
+  // @@protoc_insertion_point(field_set:mspb.NodeStats.perf_iter_seek_nanos)
+}
+
+// uint64 perf_keys_skipped = 34;
+void NodeStats::clear_perf_keys_skipped() {
+  perf_keys_skipped_ = GOOGLE_ULONGLONG(0);
+}
+::google::protobuf::uint64 NodeStats::perf_keys_skipped() const {
+  // @@protoc_insertion_point(field_get:mspb.NodeStats.perf_keys_skipped)
+  return perf_keys_skipped_;
+}
+void NodeStats::set_perf_keys_skipped(::google::protobuf::uint64 value) {
+  
+  perf_keys_skipped_ = value;
+  // @@protoc_insertion_point(field_set:mspb.NodeStats.perf_keys_skipped)
+}
+
+// uint64 perf_deletes_skipped = 35;
+void NodeStats::clear_perf_deletes_skipped() {
+  perf_deletes_skipped_ = GOOGLE_ULONGLONG(0);
+}
+::google::protobuf::uint64 NodeStats::perf_deletes_skipped() const {
+  // @@protoc_insertion_point(field_get:mspb.NodeStats.perf_deletes_skipped)
+  return perf_deletes_skipped_;
+}
+void NodeStats::set_perf_deletes_skipped(::google::protobuf::uint64 value) {
+  
+  perf_deletes_skipped_ = value;
+  // @@protoc_insertion_point(field_set:mspb.NodeStats.perf_deletes_skipped)
+}
+
+// uint64 perf_io_read_bytes = 36;
+void NodeStats::clear_perf_io_read_bytes() {
+  perf_io_read_bytes_ = GOOGLE_ULONGLONG(0);
+}
+::google::protobuf::uint64 NodeStats::perf_io_read_bytes() const {
+  // @@protoc_insertion_point(field_get:mspb.NodeStats.perf_io_read_bytes)
+  return perf_io_read_bytes_;
+}
+void NodeStats::set_perf_io_read_bytes(::google::protobuf::uint64 value) {
+  
+  perf_io_read_bytes_ = value;
+  // @@protoc_insertion_point(field_set:mspb.NodeStats.perf_io_read_bytes)
+}
+
+// uint64 perf_io_read_nanos = 37;
+void NodeStats::clear_perf_io_read_nanos() {
+  perf_io_read_nanos_ = GOOGLE_ULONGLONG(0);
+}
+::google::protobuf::uint64 NodeStats::perf_io_read_nanos() const {
+  // @@protoc_insertion_point(field_get:mspb.NodeStats.perf_io_read_nanos)
+  return perf_io_read_nanos_;
+}
+void NodeStats::set_perf_io_read_nanos(::google::protobuf::uint64 value) {
+  
+  perf_io_read_nanos_ = value;
+  // @@protoc_insertion_point(field_set:mspb.NodeStats.perf_io_read_nanos)
+}
+
+#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
+
+// ===================================================================
+
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int NodeHeartbeatRequest::kHeaderFieldNumber;
+const int NodeHeartbeatRequest::kNodeIdFieldNumber;
+const int NodeHeartbeatRequest::kStatsFieldNumber;
+const int NodeHeartbeatRequest::kIsolatedReplicasFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+NodeHeartbeatRequest::NodeHeartbeatRequest()
+  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
+  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
+    protobuf_mspb_2eproto::InitDefaults();
+  }
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:mspb.NodeHeartbeatRequest)
+}
+NodeHeartbeatRequest::NodeHeartbeatRequest(const NodeHeartbeatRequest& from)
+  : ::google::protobuf::Message(),
+      _internal_metadata_(NULL),
+      isolated_replicas_(from.isolated_replicas_),
+      _cached_size_(0) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  if (from.has_header()) {
+    header_ = new ::mspb::RequestHeader(*from.header_);
+  } else {
+    header_ = NULL;
+  }
+  if (from.has_stats()) {
+    stats_ = new ::mspb::NodeStats(*from.stats_);
+  } else {
+    stats_ = NULL;
+  }
+  node_id_ = from.node_id_;
+  // @@protoc_insertion_point(copy_constructor:mspb.NodeHeartbeatRequest)
+}
+
+void NodeHeartbeatRequest::SharedCtor() {
+  ::memset(&header_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&node_id_) -
+      reinterpret_cast<char*>(&header_)) + sizeof(node_id_));
+  _cached_size_ = 0;
+}
+
+NodeHeartbeatRequest::~NodeHeartbeatRequest() {
+  // @@protoc_insertion_point(destructor:mspb.NodeHeartbeatRequest)
+  SharedDtor();
+}
+
+void NodeHeartbeatRequest::SharedDtor() {
+  if (this != internal_default_instance()) delete header_;
+  if (this != internal_default_instance()) delete stats_;
+}
+
+void NodeHeartbeatRequest::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* NodeHeartbeatRequest::descriptor() {
+  protobuf_mspb_2eproto::protobuf_AssignDescriptorsOnce();
+  return protobuf_mspb_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
+}
+
+const NodeHeartbeatRequest& NodeHeartbeatRequest::default_instance() {
+  protobuf_mspb_2eproto::InitDefaults();
+  return *internal_default_instance();
+}
+
+NodeHeartbeatRequest* NodeHeartbeatRequest::New(::google::protobuf::Arena* arena) const {
+  NodeHeartbeatRequest* n = new NodeHeartbeatRequest;
+  if (arena != NULL) {
+    arena->Own(n);
+  }
+  return n;
+}
+
+void NodeHeartbeatRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:mspb.NodeHeartbeatRequest)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  isolated_replicas_.Clear();
+  if (GetArenaNoVirtual() == NULL && header_ != NULL) {
+    delete header_;
+  }
+  header_ = NULL;
+  if (GetArenaNoVirtual() == NULL && stats_ != NULL) {
+    delete stats_;
+  }
+  stats_ = NULL;
+  node_id_ = GOOGLE_ULONGLONG(0);
+  _internal_metadata_.Clear();
+}
+
+bool NodeHeartbeatRequest::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  // @@protoc_insertion_point(parse_start:mspb.NodeHeartbeatRequest)
+  for (;;) {
+    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // .mspb.RequestHeader header = 1;
+      case 1: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_header()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint64 node_id = 2;
+      case 2: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(16u /* 16 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &node_id_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // .mspb.NodeStats stats = 3;
+      case 3: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(26u /* 26 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_stats()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // repeated uint64 isolated_replicas = 4;
+      case 4: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(34u /* 34 & 0xFF */)) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPackedPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, this->mutable_isolated_replicas())));
+        } else if (
+            static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(32u /* 32 & 0xFF */)) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadRepeatedPrimitiveNoInline<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 1, 34u, input, this->mutable_isolated_replicas())));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, _internal_metadata_.mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:mspb.NodeHeartbeatRequest)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:mspb.NodeHeartbeatRequest)
+  return false;
+#undef DO_
+}
+
+void NodeHeartbeatRequest::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:mspb.NodeHeartbeatRequest)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .mspb.RequestHeader header = 1;
+  if (this->has_header()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      1, *this->header_, output);
+  }
+
+  // uint64 node_id = 2;
+  if (this->node_id() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(2, this->node_id(), output);
+  }
+
+  // .mspb.NodeStats stats = 3;
+  if (this->has_stats()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      3, *this->stats_, output);
+  }
+
+  // repeated uint64 isolated_replicas = 4;
+  if (this->isolated_replicas_size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteTag(4, ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
+    output->WriteVarint32(static_cast< ::google::protobuf::uint32>(
+        _isolated_replicas_cached_byte_size_));
+  }
+  for (int i = 0, n = this->isolated_replicas_size(); i < n; i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64NoTag(
+      this->isolated_replicas(i), output);
+  }
+
+  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
+  }
+  // @@protoc_insertion_point(serialize_end:mspb.NodeHeartbeatRequest)
+}
+
+::google::protobuf::uint8* NodeHeartbeatRequest::InternalSerializeWithCachedSizesToArray(
+    bool deterministic, ::google::protobuf::uint8* target) const {
+  (void)deterministic; // Unused
+  // @@protoc_insertion_point(serialize_to_array_start:mspb.NodeHeartbeatRequest)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .mspb.RequestHeader header = 1;
+  if (this->has_header()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      InternalWriteMessageNoVirtualToArray(
+        1, *this->header_, deterministic, target);
+  }
+
+  // uint64 node_id = 2;
+  if (this->node_id() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(2, this->node_id(), target);
+  }
+
+  // .mspb.NodeStats stats = 3;
+  if (this->has_stats()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      InternalWriteMessageNoVirtualToArray(
+        3, *this->stats_, deterministic, target);
+  }
+
+  // repeated uint64 isolated_replicas = 4;
+  if (this->isolated_replicas_size() > 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteTagToArray(
+      4,
+      ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
+      target);
+    target = ::google::protobuf::io::CodedOutputStream::WriteVarint32ToArray(
+        static_cast< ::google::protobuf::uint32>(
+            _isolated_replicas_cached_byte_size_), target);
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteUInt64NoTagToArray(this->isolated_replicas_, target);
+  }
+
+  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:mspb.NodeHeartbeatRequest)
+  return target;
+}
+
+size_t NodeHeartbeatRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mspb.NodeHeartbeatRequest)
+  size_t total_size = 0;
+
+  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
+  }
+  // repeated uint64 isolated_replicas = 4;
+  {
+    size_t data_size = ::google::protobuf::internal::WireFormatLite::
+      UInt64Size(this->isolated_replicas_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(
+            static_cast< ::google::protobuf::int32>(data_size));
+    }
+    int cached_size = ::google::protobuf::internal::ToCachedSize(data_size);
+    GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+    _isolated_replicas_cached_byte_size_ = cached_size;
+    GOOGLE_SAFE_CONCURRENT_WRITES_END();
+    total_size += data_size;
+  }
+
+  // .mspb.RequestHeader header = 1;
+  if (this->has_header()) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+        *this->header_);
+  }
+
+  // .mspb.NodeStats stats = 3;
+  if (this->has_stats()) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+        *this->stats_);
+  }
+
+  // uint64 node_id = 2;
+  if (this->node_id() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt64Size(
+        this->node_id());
+  }
+
+  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = cached_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void NodeHeartbeatRequest::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:mspb.NodeHeartbeatRequest)
+  GOOGLE_DCHECK_NE(&from, this);
+  const NodeHeartbeatRequest* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const NodeHeartbeatRequest>(
+          &from);
+  if (source == NULL) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:mspb.NodeHeartbeatRequest)
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:mspb.NodeHeartbeatRequest)
+    MergeFrom(*source);
+  }
+}
+
+void NodeHeartbeatRequest::MergeFrom(const NodeHeartbeatRequest& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:mspb.NodeHeartbeatRequest)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  isolated_replicas_.MergeFrom(from.isolated_replicas_);
+  if (from.has_header()) {
+    mutable_header()->::mspb::RequestHeader::MergeFrom(from.header());
+  }
+  if (from.has_stats()) {
+    mutable_stats()->::mspb::NodeStats::MergeFrom(from.stats());
+  }
+  if (from.node_id() != 0) {
+    set_node_id(from.node_id());
+  }
+}
+
+void NodeHeartbeatRequest::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:mspb.NodeHeartbeatRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void NodeHeartbeatRequest::CopyFrom(const NodeHeartbeatRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mspb.NodeHeartbeatRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool NodeHeartbeatRequest::IsInitialized() const {
+  return true;
+}
+
+void NodeHeartbeatRequest::Swap(NodeHeartbeatRequest* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void NodeHeartbeatRequest::InternalSwap(NodeHeartbeatRequest* other) {
+  using std::swap;
+  isolated_replicas_.InternalSwap(&other->isolated_replicas_);
+  swap(header_, other->header_);
+  swap(stats_, other->stats_);
+  swap(node_id_, other->node_id_);
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  swap(_cached_size_, other->_cached_size_);
+}
+
+::google::protobuf::Metadata NodeHeartbeatRequest::GetMetadata() const {
+  protobuf_mspb_2eproto::protobuf_AssignDescriptorsOnce();
+  return protobuf_mspb_2eproto::file_level_metadata[kIndexInFileMessages];
+}
+
+#if PROTOBUF_INLINE_NOT_IN_HEADERS
+// NodeHeartbeatRequest
+
+// .mspb.RequestHeader header = 1;
+bool NodeHeartbeatRequest::has_header() const {
+  return this != internal_default_instance() && header_ != NULL;
+}
+void NodeHeartbeatRequest::clear_header() {
+  if (GetArenaNoVirtual() == NULL && header_ != NULL) delete header_;
+  header_ = NULL;
+}
+const ::mspb::RequestHeader& NodeHeartbeatRequest::header() const {
+  const ::mspb::RequestHeader* p = header_;
+  // @@protoc_insertion_point(field_get:mspb.NodeHeartbeatRequest.header)
+  return p != NULL ? *p : *reinterpret_cast<const ::mspb::RequestHeader*>(
+      &::mspb::_RequestHeader_default_instance_);
+}
+::mspb::RequestHeader* NodeHeartbeatRequest::mutable_header() {
+  
+  if (header_ == NULL) {
+    header_ = new ::mspb::RequestHeader;
+  }
+  // @@protoc_insertion_point(field_mutable:mspb.NodeHeartbeatRequest.header)
+  return header_;
+}
+::mspb::RequestHeader* NodeHeartbeatRequest::release_header() {
+  // @@protoc_insertion_point(field_release:mspb.NodeHeartbeatRequest.header)
+  
+  ::mspb::RequestHeader* temp = header_;
+  header_ = NULL;
+  return temp;
+}
+void NodeHeartbeatRequest::set_allocated_header(::mspb::RequestHeader* header) {
+  delete header_;
+  header_ = header;
+  if (header) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_set_allocated:mspb.NodeHeartbeatRequest.header)
+}
+
+// uint64 node_id = 2;
+void NodeHeartbeatRequest::clear_node_id() {
+  node_id_ = GOOGLE_ULONGLONG(0);
+}
+::google::protobuf::uint64 NodeHeartbeatRequest::node_id() const {
+  // @@protoc_insertion_point(field_get:mspb.NodeHeartbeatRequest.node_id)
+  return node_id_;
+}
+void NodeHeartbeatRequest::set_node_id(::google::protobuf::uint64 value) {
+  
+  node_id_ = value;
+  // @@protoc_insertion_point(field_set:mspb.NodeHeartbeatRequest.node_id)
+}
+
+// .mspb.NodeStats stats = 3;
+bool NodeHeartbeatRequest::has_stats() const {
+  return this != internal_default_instance() && stats_ != NULL;
+}
+void NodeHeartbeatRequest::clear_stats() {
+  if (GetArenaNoVirtual() == NULL && stats_ != NULL) delete stats_;
+  stats_ = NULL;
+}
+const ::mspb::NodeStats& NodeHeartbeatRequest::stats() const {
+  const ::mspb::NodeStats* p = stats_;
+  // @@protoc_insertion_point(field_get:mspb.NodeHeartbeatRequest.stats)
+  return p != NULL ? *p : *reinterpret_cast<const ::mspb::NodeStats*>(
+      &::mspb::_NodeStats_default_instance_);
+}
+::mspb::NodeStats* NodeHeartbeatRequest::mutable_stats() {
+  
+  if (stats_ == NULL) {
+    stats_ = new ::mspb::NodeStats;
+  }
+  // @@protoc_insertion_point(field_mutable:mspb.NodeHeartbeatRequest.stats)
+  return stats_;
+}
+::mspb::NodeStats* NodeHeartbeatRequest::release_stats() {
+  // @@protoc_insertion_point(field_release:mspb.NodeHeartbeatRequest.stats)
+  
+  ::mspb::NodeStats* temp = stats_;
+  stats_ = NULL;
+  return temp;
+}
+void NodeHeartbeatRequest::set_allocated_stats(::mspb::NodeStats* stats) {
+  delete stats_;
+  stats_ = stats;
+  if (stats) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_set_allocated:mspb.NodeHeartbeatRequest.stats)
+}
+
+// repeated uint64 isolated_replicas = 4;
+int NodeHeartbeatRequest::isolated_replicas_size() const {
+  return isolated_replicas_.size();
+}
+void NodeHeartbeatRequest::clear_isolated_replicas() {
+  isolated_replicas_.Clear();
+}
+::google::protobuf::uint64 NodeHeartbeatRequest::isolated_replicas(int index) const {
+  // @@protoc_insertion_point(field_get:mspb.NodeHeartbeatRequest.isolated_replicas)
+  return isolated_replicas_.Get(index);
+}
+void NodeHeartbeatRequest::set_isolated_replicas(int index, ::google::protobuf::uint64 value) {
+  isolated_replicas_.Set(index, value);
+  // @@protoc_insertion_point(field_set:mspb.NodeHeartbeatRequest.isolated_replicas)
+}
+void NodeHeartbeatRequest::add_isolated_replicas(::google::protobuf::uint64 value) {
+  isolated_replicas_.Add(value);
+  // @@protoc_insertion_point(field_add:mspb.NodeHeartbeatRequest.isolated_replicas)
+}
+const ::google::protobuf::RepeatedField< ::google::protobuf::uint64 >&
+NodeHeartbeatRequest::isolated_replicas() const {
+  // @@protoc_insertion_point(field_list:mspb.NodeHeartbeatRequest.isolated_replicas)
+  return isolated_replicas_;
+}
+::google::protobuf::RepeatedField< ::google::protobuf::uint64 >*
+NodeHeartbeatRequest::mutable_isolated_replicas() {
+  // @@protoc_insertion_point(field_mutable_list:mspb.NodeHeartbeatRequest.isolated_replicas)
+  return &isolated_replicas_;
+}
 
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
-                 input, &bytes_read_)));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
+#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
 
-      // uint64 keys_read = 13;
-      case 13: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(104u /* 104 & 0xFF */)) {
+// ===================================================================
 
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
-                 input, &keys_read_)));
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int NodeHeartbeatResponse::kHeaderFieldNumber;
+const int NodeHeartbeatResponse::kNodeIdFieldNumber;
+const int NodeHeartbeatResponse::kDeleteReplicasFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+NodeHeartbeatResponse::NodeHeartbeatResponse()
+  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
+  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
+    protobuf_mspb_2eproto::InitDefaults();
+  }
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:mspb.NodeHeartbeatResponse)
+}
+NodeHeartbeatResponse::NodeHeartbeatResponse(const NodeHeartbeatResponse& from)
+  : ::google::protobuf::Message(),
+      _internal_metadata_(NULL),
+      delete_replicas_(from.delete_replicas_),
+      _cached_size_(0) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  if (from.has_header()) {
+    header_ = new ::mspb::ResponseHeader(*from.header_);
+  } else {
+    header_ = NULL;
+  }
+  node_id_ = from.node_id_;
+  // @@protoc_insertion_point(copy_constructor:mspb.NodeHeartbeatResponse)
+}
+
+void NodeHeartbeatResponse::SharedCtor() {
+  ::memset(&header_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&node_id_) -
+      reinterpret_cast<char*>(&header_)) + sizeof(node_id_));
+  _cached_size_ = 0;
+}
+
+NodeHeartbeatResponse::~NodeHeartbeatResponse() {
+  // @@protoc_insertion_point(destructor:mspb.NodeHeartbeatResponse)
+  SharedDtor();
+}
+
+void NodeHeartbeatResponse::SharedDtor() {
+  if (this != internal_default_instance()) delete header_;
+}
+
+void NodeHeartbeatResponse::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* NodeHeartbeatResponse::descriptor() {
+  protobuf_mspb_2eproto::protobuf_AssignDescriptorsOnce();
+  return protobuf_mspb_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
+}
+
+const NodeHeartbeatResponse& NodeHeartbeatResponse::default_instance() {
+  protobuf_mspb_2eproto::InitDefaults();
+  return *internal_default_instance();
+}
+
+NodeHeartbeatResponse* NodeHeartbeatResponse::New(::google::protobuf::Arena* arena) const {
+  NodeHeartbeatResponse* n = new NodeHeartbeatResponse;
+  if (arena != NULL) {
+    arena->Own(n);
+  }
+  return n;
+}
+
+void NodeHeartbeatResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:mspb.NodeHeartbeatResponse)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  delete_replicas_.Clear();
+  if (GetArenaNoVirtual() == NULL && header_ != NULL) {
+    delete header_;
+  }
+  header_ = NULL;
+  node_id_ = GOOGLE_ULONGLONG(0);
+  _internal_metadata_.Clear();
+}
+
+bool NodeHeartbeatResponse::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  // @@protoc_insertion_point(parse_start:mspb.NodeHeartbeatResponse)
+  for (;;) {
+    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // .mspb.ResponseHeader header = 1;
+      case 1: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_header()));
         } else {
           goto handle_unusual;
         }
         break;
       }
 
-      // bool is_busy = 14;
-      case 14: {
+      // uint64 node_id = 2;
+      case 2: {
         if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(112u /* 112 & 0xFF */)) {
+            static_cast< ::google::protobuf::uint8>(16u /* 16 & 0xFF */)) {
 
           DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
-                 input, &is_busy_)));
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &node_id_)));
         } else {
           goto handle_unusual;
         }
         break;
       }
 
-      // uint32 start = 15;
-      case 15: {
+      // repeated uint64 delete_replicas = 3;
+      case 3: {
         if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(120u /* 120 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &start_)));
+            static_cast< ::google::protobuf::uint8>(26u /* 26 & 0xFF */)) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPackedPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, this->mutable_delete_replicas())));
+        } else if (
+            static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(24u /* 24 & 0xFF */)) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadRepeatedPrimitiveNoInline<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 1, 26u, input, this->mutable_delete_replicas())));
         } else {
           goto handle_unusual;
         }
@@ -4861,201 +8364,98 @@ bool NodeStats::MergePartialFromCodedStream(
         if (tag == 0) {
           goto success;
         }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:mspb.NodeStats)
-  return true;
-failure:
-  // @@protoc_insertion_point(parse_failure:mspb.NodeStats)
-  return false;
-#undef DO_
-}
-
-void NodeStats::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:mspb.NodeStats)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // uint32 range_count = 1;
-  if (this->range_count() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(1, this->range_count(), output);
-  }
-
-  // uint32 range_split_count = 2;
-  if (this->range_split_count() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(2, this->range_split_count(), output);
-  }
-
-  // uint32 sending_snap_count = 3;
-  if (this->sending_snap_count() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(3, this->sending_snap_count(), output);
-  }
-
-  // uint32 receiving_snap_count = 4;
-  if (this->receiving_snap_count() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(4, this->receiving_snap_count(), output);
-  }
-
-  // uint32 applying_snap_count = 5;
-  if (this->applying_snap_count() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(5, this->applying_snap_count(), output);
-  }
-
-  // uint32 range_leader_count = 6;
-  if (this->range_leader_count() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(6, this->range_leader_count(), output);
-  }
-
-  // uint64 capacity = 7;
-  if (this->capacity() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt64(7, this->capacity(), output);
-  }
-
-  // uint64 used_size = 8;
-  if (this->used_size() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt64(8, this->used_size(), output);
-  }
-
-  // uint64 available = 9;
-  if (this->available() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt64(9, this->available(), output);
-  }
-
-  // uint64 bytes_written = 10;
-  if (this->bytes_written() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt64(10, this->bytes_written(), output);
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, _internal_metadata_.mutable_unknown_fields()));
+        break;
+      }
+    }
   }
+success:
+  // @@protoc_insertion_point(parse_success:mspb.NodeHeartbeatResponse)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:mspb.NodeHeartbeatResponse)
+  return false;
+#undef DO_
+}
 
-  // uint64 keys_written = 11;
-  if (this->keys_written() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt64(11, this->keys_written(), output);
-  }
+void NodeHeartbeatResponse::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:mspb.NodeHeartbeatResponse)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
 
-  // uint64 bytes_read = 12;
-  if (this->bytes_read() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt64(12, this->bytes_read(), output);
+  // .mspb.ResponseHeader header = 1;
+  if (this->has_header()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      1, *this->header_, output);
   }
 
-  // uint64 keys_read = 13;
-  if (this->keys_read() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt64(13, this->keys_read(), output);
+  // uint64 node_id = 2;
+  if (this->node_id() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(2, this->node_id(), output);
   }
 
-  // bool is_busy = 14;
-  if (this->is_busy() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteBool(14, this->is_busy(), output);
+  // repeated uint64 delete_replicas = 3;
+  if (this->delete_replicas_size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteTag(3, ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
+    output->WriteVarint32(static_cast< ::google::protobuf::uint32>(
+        _delete_replicas_cached_byte_size_));
   }
-
-  // uint32 start = 15;
-  if (this->start() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(15, this->start(), output);
+  for (int i = 0, n = this->delete_replicas_size(); i < n; i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64NoTag(
+      this->delete_replicas(i), output);
   }
 
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
     ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
   }
-  // @@protoc_insertion_point(serialize_end:mspb.NodeStats)
+  // @@protoc_insertion_point(serialize_end:mspb.NodeHeartbeatResponse)
 }
 
-::google::protobuf::uint8* NodeStats::InternalSerializeWithCachedSizesToArray(
+::google::protobuf::uint8* NodeHeartbeatResponse::InternalSerializeWithCachedSizesToArray(
     bool deterministic, ::google::protobuf::uint8* target) const {
   (void)deterministic; // Unused
-  // @@protoc_insertion_point(serialize_to_array_start:mspb.NodeStats)
+  // @@protoc_insertion_point(serialize_to_array_start:mspb.NodeHeartbeatResponse)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // uint32 range_count = 1;
-  if (this->range_count() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(1, this->range_count(), target);
-  }
-
-  // uint32 range_split_count = 2;
-  if (this->range_split_count() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(2, this->range_split_count(), target);
-  }
-
-  // uint32 sending_snap_count = 3;
-  if (this->sending_snap_count() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(3, this->sending_snap_count(), target);
-  }
-
-  // uint32 receiving_snap_count = 4;
-  if (this->receiving_snap_count() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(4, this->receiving_snap_count(), target);
-  }
-
-  // uint32 applying_snap_count = 5;
-  if (this->applying_snap_count() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(5, this->applying_snap_count(), target);
-  }
-
-  // uint32 range_leader_count = 6;
-  if (this->range_leader_count() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(6, this->range_leader_count(), target);
-  }
-
-  // uint64 capacity = 7;
-  if (this->capacity() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(7, this->capacity(), target);
-  }
-
-  // uint64 used_size = 8;
-  if (this->used_size() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(8, this->used_size(), target);
-  }
-
-  // uint64 available = 9;
-  if (this->available() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(9, this->available(), target);
-  }
-
-  // uint64 bytes_written = 10;
-  if (this->bytes_written() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(10, this->bytes_written(), target);
-  }
-
-  // uint64 keys_written = 11;
-  if (this->keys_written() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(11, this->keys_written(), target);
-  }
-
-  // uint64 bytes_read = 12;
-  if (this->bytes_read() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(12, this->bytes_read(), target);
-  }
-
-  // uint64 keys_read = 13;
-  if (this->keys_read() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(13, this->keys_read(), target);
+  // .mspb.ResponseHeader header = 1;
+  if (this->has_header()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      InternalWriteMessageNoVirtualToArray(
+        1, *this->header_, deterministic, target);
   }
 
-  // bool is_busy = 14;
-  if (this->is_busy() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(14, this->is_busy(), target);
+  // uint64 node_id = 2;
+  if (this->node_id() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(2, this->node_id(), target);
   }
 
-  // uint32 start = 15;
-  if (this->start() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(15, this->start(), target);
+  // repeated uint64 delete_replicas = 3;
+  if (this->delete_replicas_size() > 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteTagToArray(
+      3,
+      ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
+      target);
+    target = ::google::protobuf::io::CodedOutputStream::WriteVarint32ToArray(
+        static_cast< ::google::protobuf::uint32>(
+            _delete_replicas_cached_byte_size_), target);
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteUInt64NoTagToArray(this->delete_replicas_, target);
   }
 
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
     target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:mspb.NodeStats)
+  // @@protoc_insertion_point(serialize_to_array_end:mspb.NodeHeartbeatResponse)
   return target;
 }
 
-size_t NodeStats::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:mspb.NodeStats)
+size_t NodeHeartbeatResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mspb.NodeHeartbeatResponse)
   size_t total_size = 0;
 
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
@@ -5063,107 +8463,34 @@ size_t NodeStats::ByteSizeLong() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
   }
-  // uint32 range_count = 1;
-  if (this->range_count() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt32Size(
-        this->range_count());
-  }
-
-  // uint32 range_split_count = 2;
-  if (this->range_split_count() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt32Size(
-        this->range_split_count());
-  }
-
-  // uint32 sending_snap_count = 3;
-  if (this->sending_snap_count() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt32Size(
-        this->sending_snap_count());
-  }
-
-  // uint32 receiving_snap_count = 4;
-  if (this->receiving_snap_count() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt32Size(
-        this->receiving_snap_count());
-  }
-
-  // uint32 applying_snap_count = 5;
-  if (this->applying_snap_count() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt32Size(
-        this->applying_snap_count());
-  }
-
-  // uint32 range_leader_count = 6;
-  if (this->range_leader_count() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt32Size(
-        this->range_leader_count());
-  }
-
-  // uint64 capacity = 7;
-  if (this->capacity() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt64Size(
-        this->capacity());
-  }
-
-  // uint64 used_size = 8;
-  if (this->used_size() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt64Size(
-        this->used_size());
-  }
-
-  // uint64 available = 9;
-  if (this->available() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt64Size(
-        this->available());
-  }
-
-  // uint64 bytes_written = 10;
-  if (this->bytes_written() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt64Size(
-        this->bytes_written());
-  }
-
-  // uint64 keys_written = 11;
-  if (this->keys_written() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt64Size(
-        this->keys_written());
-  }
-
-  // uint64 bytes_read = 12;
-  if (this->bytes_read() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt64Size(
-        this->bytes_read());
-  }
-
-  // uint64 keys_read = 13;
-  if (this->keys_read() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt64Size(
-        this->keys_read());
+  // repeated uint64 delete_replicas = 3;
+  {
+    size_t data_size = ::google::protobuf::internal::WireFormatLite::
+      UInt64Size(this->delete_replicas_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(
+            static_cast< ::google::protobuf::int32>(data_size));
+    }
+    int cached_size = ::google::protobuf::internal::ToCachedSize(data_size);
+    GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+    _delete_replicas_cached_byte_size_ = cached_size;
+    GOOGLE_SAFE_CONCURRENT_WRITES_END();
+    total_size += data_size;
   }
 
-  // bool is_busy = 14;
-  if (this->is_busy() != 0) {
-    total_size += 1 + 1;
+  // .mspb.ResponseHeader header = 1;
+  if (this->has_header()) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+        *this->header_);
   }
 
-  // uint32 start = 15;
-  if (this->start() != 0) {
+  // uint64 node_id = 2;
+  if (this->node_id() != 0) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt32Size(
-        this->start());
+      ::google::protobuf::internal::WireFormatLite::UInt64Size(
+        this->node_id());
   }
 
   int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
@@ -5173,334 +8500,158 @@ size_t NodeStats::ByteSizeLong() const {
   return total_size;
 }
 
-void NodeStats::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:mspb.NodeStats)
+void NodeHeartbeatResponse::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:mspb.NodeHeartbeatResponse)
   GOOGLE_DCHECK_NE(&from, this);
-  const NodeStats* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const NodeStats>(
+  const NodeHeartbeatResponse* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const NodeHeartbeatResponse>(
           &from);
   if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:mspb.NodeStats)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:mspb.NodeHeartbeatResponse)
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:mspb.NodeStats)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:mspb.NodeHeartbeatResponse)
     MergeFrom(*source);
   }
 }
 
-void NodeStats::MergeFrom(const NodeStats& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:mspb.NodeStats)
+void NodeHeartbeatResponse::MergeFrom(const NodeHeartbeatResponse& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:mspb.NodeHeartbeatResponse)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.range_count() != 0) {
-    set_range_count(from.range_count());
-  }
-  if (from.range_split_count() != 0) {
-    set_range_split_count(from.range_split_count());
-  }
-  if (from.sending_snap_count() != 0) {
-    set_sending_snap_count(from.sending_snap_count());
-  }
-  if (from.receiving_snap_count() != 0) {
-    set_receiving_snap_count(from.receiving_snap_count());
-  }
-  if (from.applying_snap_count() != 0) {
-    set_applying_snap_count(from.applying_snap_count());
-  }
-  if (from.range_leader_count() != 0) {
-    set_range_leader_count(from.range_leader_count());
-  }
-  if (from.capacity() != 0) {
-    set_capacity(from.capacity());
-  }
-  if (from.used_size() != 0) {
-    set_used_size(from.used_size());
-  }
-  if (from.available() != 0) {
-    set_available(from.available());
-  }
-  if (from.bytes_written() != 0) {
-    set_bytes_written(from.bytes_written());
-  }
-  if (from.keys_written() != 0) {
-    set_keys_written(from.keys_written());
-  }
-  if (from.bytes_read() != 0) {
-    set_bytes_read(from.bytes_read());
-  }
-  if (from.keys_read() != 0) {
-    set_keys_read(from.keys_read());
-  }
-  if (from.is_busy() != 0) {
-    set_is_busy(from.is_busy());
+  delete_replicas_.MergeFrom(from.delete_replicas_);
+  if (from.has_header()) {
+    mutable_header()->::mspb::ResponseHeader::MergeFrom(from.header());
   }
-  if (from.start() != 0) {
-    set_start(from.start());
+  if (from.node_id() != 0) {
+    set_node_id(from.node_id());
   }
 }
 
-void NodeStats::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:mspb.NodeStats)
+void NodeHeartbeatResponse::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:mspb.NodeHeartbeatResponse)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void NodeStats::CopyFrom(const NodeStats& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:mspb.NodeStats)
+void NodeHeartbeatResponse::CopyFrom(const NodeHeartbeatResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mspb.NodeHeartbeatResponse)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool NodeStats::IsInitialized() const {
+bool NodeHeartbeatResponse::IsInitialized() const {
   return true;
 }
 
-void NodeStats::Swap(NodeStats* other) {
+void NodeHeartbeatResponse::Swap(NodeHeartbeatResponse* other) {
   if (other == this) return;
   InternalSwap(other);
 }
-void NodeStats::InternalSwap(NodeStats* other) {
+void NodeHeartbeatResponse::InternalSwap(NodeHeartbeatResponse* other) {
   using std::swap;
-  swap(range_count_, other->range_count_);
-  swap(range_split_count_, other->range_split_count_);
-  swap(sending_snap_count_, other->sending_snap_count_);
-  swap(receiving_snap_count_, other->receiving_snap_count_);
-  swap(applying_snap_count_, other->applying_snap_count_);
-  swap(range_leader_count_, other->range_leader_count_);
-  swap(capacity_, other->capacity_);
-  swap(used_size_, other->used_size_);
-  swap(available_, other->available_);
-  swap(bytes_written_, other->bytes_written_);
-  swap(keys_written_, other->keys_written_);
-  swap(bytes_read_, other->bytes_read_);
-  swap(keys_read_, other->keys_read_);
-  swap(is_busy_, other->is_busy_);
-  swap(start_, other->start_);
+  delete_replicas_.InternalSwap(&other->delete_replicas_);
+  swap(header_, other->header_);
+  swap(node_id_, other->node_id_);
   _internal_metadata_.Swap(&other->_internal_metadata_);
   swap(_cached_size_, other->_cached_size_);
 }
 
-::google::protobuf::Metadata NodeStats::GetMetadata() const {
-  protobuf_mspb_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_mspb_2eproto::file_level_metadata[kIndexInFileMessages];
-}
-
-#if PROTOBUF_INLINE_NOT_IN_HEADERS
-// NodeStats
-
-// uint32 range_count = 1;
-void NodeStats::clear_range_count() {
-  range_count_ = 0u;
-}
-::google::protobuf::uint32 NodeStats::range_count() const {
-  // @@protoc_insertion_point(field_get:mspb.NodeStats.range_count)
-  return range_count_;
-}
-void NodeStats::set_range_count(::google::protobuf::uint32 value) {
-  
-  range_count_ = value;
-  // @@protoc_insertion_point(field_set:mspb.NodeStats.range_count)
-}
-
-// uint32 range_split_count = 2;
-void NodeStats::clear_range_split_count() {
-  range_split_count_ = 0u;
-}
-::google::protobuf::uint32 NodeStats::range_split_count() const {
-  // @@protoc_insertion_point(field_get:mspb.NodeStats.range_split_count)
-  return range_split_count_;
-}
-void NodeStats::set_range_split_count(::google::protobuf::uint32 value) {
-  
-  range_split_count_ = value;
-  // @@protoc_insertion_point(field_set:mspb.NodeStats.range_split_count)
-}
-
-// uint32 sending_snap_count = 3;
-void NodeStats::clear_sending_snap_count() {
-  sending_snap_count_ = 0u;
-}
-::google::protobuf::uint32 NodeStats::sending_snap_count() const {
-  // @@protoc_insertion_point(field_get:mspb.NodeStats.sending_snap_count)
-  return sending_snap_count_;
-}
-void NodeStats::set_sending_snap_count(::google::protobuf::uint32 value) {
-  
-  sending_snap_count_ = value;
-  // @@protoc_insertion_point(field_set:mspb.NodeStats.sending_snap_count)
-}
-
-// uint32 receiving_snap_count = 4;
-void NodeStats::clear_receiving_snap_count() {
-  receiving_snap_count_ = 0u;
-}
-::google::protobuf::uint32 NodeStats::receiving_snap_count() const {
-  // @@protoc_insertion_point(field_get:mspb.NodeStats.receiving_snap_count)
-  return receiving_snap_count_;
-}
-void NodeStats::set_receiving_snap_count(::google::protobuf::uint32 value) {
-  
-  receiving_snap_count_ = value;
-  // @@protoc_insertion_point(field_set:mspb.NodeStats.receiving_snap_count)
-}
-
-// uint32 applying_snap_count = 5;
-void NodeStats::clear_applying_snap_count() {
-  applying_snap_count_ = 0u;
-}
-::google::protobuf::uint32 NodeStats::applying_snap_count() const {
-  // @@protoc_insertion_point(field_get:mspb.NodeStats.applying_snap_count)
-  return applying_snap_count_;
-}
-void NodeStats::set_applying_snap_count(::google::protobuf::uint32 value) {
-  
-  applying_snap_count_ = value;
-  // @@protoc_insertion_point(field_set:mspb.NodeStats.applying_snap_count)
-}
-
-// uint32 range_leader_count = 6;
-void NodeStats::clear_range_leader_count() {
-  range_leader_count_ = 0u;
-}
-::google::protobuf::uint32 NodeStats::range_leader_count() const {
-  // @@protoc_insertion_point(field_get:mspb.NodeStats.range_leader_count)
-  return range_leader_count_;
-}
-void NodeStats::set_range_leader_count(::google::protobuf::uint32 value) {
-  
-  range_leader_count_ = value;
-  // @@protoc_insertion_point(field_set:mspb.NodeStats.range_leader_count)
-}
-
-// uint64 capacity = 7;
-void NodeStats::clear_capacity() {
-  capacity_ = GOOGLE_ULONGLONG(0);
-}
-::google::protobuf::uint64 NodeStats::capacity() const {
-  // @@protoc_insertion_point(field_get:mspb.NodeStats.capacity)
-  return capacity_;
-}
-void NodeStats::set_capacity(::google::protobuf::uint64 value) {
-  
-  capacity_ = value;
-  // @@protoc_insertion_point(field_set:mspb.NodeStats.capacity)
-}
-
-// uint64 used_size = 8;
-void NodeStats::clear_used_size() {
-  used_size_ = GOOGLE_ULONGLONG(0);
-}
-::google::protobuf::uint64 NodeStats::used_size() const {
-  // @@protoc_insertion_point(field_get:mspb.NodeStats.used_size)
-  return used_size_;
-}
-void NodeStats::set_used_size(::google::protobuf::uint64 value) {
-  
-  used_size_ = value;
-  // @@protoc_insertion_point(field_set:mspb.NodeStats.used_size)
-}
-
-// uint64 available = 9;
-void NodeStats::clear_available() {
-  available_ = GOOGLE_ULONGLONG(0);
-}
-::google::protobuf::uint64 NodeStats::available() const {
-  // @@protoc_insertion_point(field_get:mspb.NodeStats.available)
-  return available_;
-}
-void NodeStats::set_available(::google::protobuf::uint64 value) {
-  
-  available_ = value;
-  // @@protoc_insertion_point(field_set:mspb.NodeStats.available)
-}
-
-// uint64 bytes_written = 10;
-void NodeStats::clear_bytes_written() {
-  bytes_written_ = GOOGLE_ULONGLONG(0);
-}
-::google::protobuf::uint64 NodeStats::bytes_written() const {
-  // @@protoc_insertion_point(field_get:mspb.NodeStats.bytes_written)
-  return bytes_written_;
-}
-void NodeStats::set_bytes_written(::google::protobuf::uint64 value) {
-  
-  bytes_written_ = value;
-  // @@protoc_insertion_point(field_set:mspb.NodeStats.bytes_written)
+::google::protobuf::Metadata NodeHeartbeatResponse::GetMetadata() const {
+  protobuf_mspb_2eproto::protobuf_AssignDescriptorsOnce();
+  return protobuf_mspb_2eproto::file_level_metadata[kIndexInFileMessages];
 }
 
-// uint64 keys_written = 11;
-void NodeStats::clear_keys_written() {
-  keys_written_ = GOOGLE_ULONGLONG(0);
-}
-::google::protobuf::uint64 NodeStats::keys_written() const {
-  // @@protoc_insertion_point(field_get:mspb.NodeStats.keys_written)
-  return keys_written_;
+#if PROTOBUF_INLINE_NOT_IN_HEADERS
+// NodeHeartbeatResponse
+
+// .mspb.ResponseHeader header = 1;
+bool NodeHeartbeatResponse::has_header() const {
+  return this != internal_default_instance() && header_ != NULL;
 }
-void NodeStats::set_keys_written(::google::protobuf::uint64 value) {
-  
-  keys_written_ = value;
-  // @@protoc_insertion_point(field_set:mspb.NodeStats.keys_written)
+void NodeHeartbeatResponse::clear_header() {
+  if (GetArenaNoVirtual() == NULL && header_ != NULL) delete header_;
+  header_ = NULL;
 }
-
-// uint64 bytes_read = 12;
-void NodeStats::clear_bytes_read() {
-  bytes_read_ = GOOGLE_ULONGLONG(0);
+const ::mspb::ResponseHeader& NodeHeartbeatResponse::header() const {
+  const ::mspb::ResponseHeader* p = header_;
+  // @@protoc_insertion_point(field_get:mspb.NodeHeartbeatResponse.header)
+  return p != NULL ? *p : *reinterpret_cast<const ::mspb::ResponseHeader*>(
+      &::mspb::_ResponseHeader_default_instance_);
 }
-::google::protobuf::uint64 NodeStats::bytes_read() const {
-  // @@protoc_insertion_point(field_get:mspb.NodeStats.bytes_read)
-  return bytes_read_;
+::mspb::ResponseHeader* NodeHeartbeatResponse::mutable_header() {
+  
+  if (header_ == NULL) {
+    header_ = new ::mspb::ResponseHeader;
+  }
+  // @@protoc_insertion_point(field_mutable:mspb.NodeHeartbeatResponse.header)
+  return header_;
 }
-void NodeStats::set_bytes_read(::google::protobuf::uint64 value) {
+::mspb::ResponseHeader* NodeHeartbeatResponse::release_header() {
+  // @@protoc_insertion_point(field_release:mspb.NodeHeartbeatResponse.header)
   
-  bytes_read_ = value;
-  // @@protoc_insertion_point(field_set:mspb.NodeStats.bytes_read)
+  ::mspb::ResponseHeader* temp = header_;
+  header_ = NULL;
+  return temp;
+}
+void NodeHeartbeatResponse::set_allocated_header(::mspb::ResponseHeader* header) {
+  delete header_;
+  header_ = header;
+  if (header) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_set_allocated:mspb.NodeHeartbeatResponse.header)
 }
 
-// uint64 keys_read = 13;
-void NodeStats::clear_keys_read() {
-  keys_read_ = GOOGLE_ULONGLONG(0);
+// uint64 node_id = 2;
+void NodeHeartbeatResponse::clear_node_id() {
+  node_id_ = GOOGLE_ULONGLONG(0);
 }
-::google::protobuf::uint64 NodeStats::keys_read() const {
-  // @@protoc_insertion_point(field_get:mspb.NodeStats.keys_read)
-  return keys_read_;
+::google::protobuf::uint64 NodeHeartbeatResponse::node_id() const {
+  // @@protoc_insertion_point(field_get:mspb.NodeHeartbeatResponse.node_id)
+  return node_id_;
 }
-void NodeStats::set_keys_read(::google::protobuf::uint64 value) {
+void NodeHeartbeatResponse::set_node_id(::google::protobuf::uint64 value) {
   
-  keys_read_ = value;
-  // @@protoc_insertion_point(field_set:mspb.NodeStats.keys_read)
+  node_id_ = value;
+  // @@protoc_insertion_point(field_set:mspb.NodeHeartbeatResponse.node_id)
 }
 
-// bool is_busy = 14;
-void NodeStats::clear_is_busy() {
-  is_busy_ = false;
+// repeated uint64 delete_replicas = 3;
+int NodeHeartbeatResponse::delete_replicas_size() const {
+  return delete_replicas_.size();
 }
-bool NodeStats::is_busy() const {
-  // @@protoc_insertion_point(field_get:mspb.NodeStats.is_busy)
-  return is_busy_;
+void NodeHeartbeatResponse::clear_delete_replicas() {
+  delete_replicas_.Clear();
 }
-void NodeStats::set_is_busy(bool value) {
-  
-  is_busy_ = value;
-  // @@protoc_insertion_point(field_set:mspb.NodeStats.is_busy)
+::google::protobuf::uint64 NodeHeartbeatResponse::delete_replicas(int index) const {
+  // @@protoc_insertion_point(field_get:mspb.NodeHeartbeatResponse.delete_replicas)
+  return delete_replicas_.Get(index);
 }
-
-// uint32 start = 15;
-void NodeStats::clear_start() {
-  start_ = 0u;
+void NodeHeartbeatResponse::set_delete_replicas(int index, ::google::protobuf::uint64 value) {
+  delete_replicas_.Set(index, value);
+  // @@protoc_insertion_point(field_set:mspb.NodeHeartbeatResponse.delete_replicas)
 }
-::google::protobuf::uint32 NodeStats::start() const {
-  // @@protoc_insertion_point(field_get:mspb.NodeStats.start)
-  return start_;
+void NodeHeartbeatResponse::add_delete_replicas(::google::protobuf::uint64 value) {
+  delete_replicas_.Add(value);
+  // @@protoc_insertion_point(field_add:mspb.NodeHeartbeatResponse.delete_replicas)
 }
-void NodeStats::set_start(::google::protobuf::uint32 value) {
-  
-  start_ = value;
-  // @@protoc_insertion_point(field_set:mspb.NodeStats.start)
+const ::google::protobuf::RepeatedField< ::google::protobuf::uint64 >&
+NodeHeartbeatResponse::delete_replicas() const {
+  // @@protoc_insertion_point(field_list:mspb.NodeHeartbeatResponse.delete_replicas)
+  return delete_replicas_;
+}
+::google::protobuf::RepeatedField< ::google::protobuf::uint64 >*
+NodeHeartbeatResponse::mutable_delete_replicas() {
+  // @@protoc_insertion_point(field_mutable_list:mspb.NodeHeartbeatResponse.delete_replicas)
+  return &delete_replicas_;
 }
 
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -5508,104 +8659,106 @@ void NodeStats::set_start(::google::protobuf::uint32 value) {
 // ===================================================================
 
 #if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int NodeHeartbeatRequest::kHeaderFieldNumber;
-const int NodeHeartbeatRequest::kNodeIdFieldNumber;
-const int NodeHeartbeatRequest::kStatsFieldNumber;
-const int NodeHeartbeatRequest::kIsolatedReplicasFieldNumber;
+const int AskSplitRequest::kHeaderFieldNumber;
+const int AskSplitRequest::kRangeFieldNumber;
+const int AskSplitRequest::kSplitKeyFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
-NodeHeartbeatRequest::NodeHeartbeatRequest()
+AskSplitRequest::AskSplitRequest()
   : ::google::protobuf::Message(), _internal_metadata_(NULL) {
   if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
     protobuf_mspb_2eproto::InitDefaults();
   }
   SharedCtor();
-  // @@protoc_insertion_point(constructor:mspb.NodeHeartbeatRequest)
+  // @@protoc_insertion_point(constructor:mspb.AskSplitRequest)
 }
-NodeHeartbeatRequest::NodeHeartbeatRequest(const NodeHeartbeatRequest& from)
+AskSplitRequest::AskSplitRequest(const AskSplitRequest& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
-      isolated_replicas_(from.isolated_replicas_),
       _cached_size_(0) {
   _internal_metadata_.MergeFrom(from._internal_metadata_);
+  split_key_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (from.split_key().size() > 0) {
+    split_key_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.split_key_);
+  }
   if (from.has_header()) {
     header_ = new ::mspb::RequestHeader(*from.header_);
   } else {
     header_ = NULL;
   }
-  if (from.has_stats()) {
-    stats_ = new ::mspb::NodeStats(*from.stats_);
+  if (from.has_range()) {
+    range_ = new ::metapb::Range(*from.range_);
   } else {
-    stats_ = NULL;
+    range_ = NULL;
   }
-  node_id_ = from.node_id_;
-  // @@protoc_insertion_point(copy_constructor:mspb.NodeHeartbeatRequest)
+  // @@protoc_insertion_point(copy_constructor:mspb.AskSplitRequest)
 }
 
-void NodeHeartbeatRequest::SharedCtor() {
+void AskSplitRequest::SharedCtor() {
+  split_key_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   ::memset(&header_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&node_id_) -
-      reinterpret_cast<char*>(&header_)) + sizeof(node_id_));
+      reinterpret_cast<char*>(&range_) -
+      reinterpret_cast<char*>(&header_)) + sizeof(range_));
   _cached_size_ = 0;
 }
 
-NodeHeartbeatRequest::~NodeHeartbeatRequest() {
-  // @@protoc_insertion_point(destructor:mspb.NodeHeartbeatRequest)
+AskSplitRequest::~AskSplitRequest() {
+  // @@protoc_insertion_point(destructor:mspb.AskSplitRequest)
   SharedDtor();
 }
 
-void NodeHeartbeatRequest::SharedDtor() {
+void AskSplitRequest::SharedDtor() {
+  split_key_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   if (this != internal_default_instance()) delete header_;
-  if (this != internal_default_instance()) delete stats_;
+  if (this != internal_default_instance()) delete range_;
 }
 
-void NodeHeartbeatRequest::SetCachedSize(int size) const {
+void AskSplitRequest::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* NodeHeartbeatRequest::descriptor() {
+const ::google::protobuf::Descriptor* AskSplitRequest::descriptor() {
   protobuf_mspb_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_mspb_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
 }
 
-const NodeHeartbeatRequest& NodeHeartbeatRequest::default_instance() {
+const AskSplitRequest& AskSplitRequest::default_instance() {
   protobuf_mspb_2eproto::InitDefaults();
   return *internal_default_instance();
 }
 
-NodeHeartbeatRequest* NodeHeartbeatRequest::New(::google::protobuf::Arena* arena) const {
-  NodeHeartbeatRequest* n = new NodeHeartbeatRequest;
+AskSplitRequest* AskSplitRequest::New(::google::protobuf::Arena* arena) const {
+  AskSplitRequest* n = new AskSplitRequest;
   if (arena != NULL) {
     arena->Own(n);
   }
   return n;
 }
 
-void NodeHeartbeatRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:mspb.NodeHeartbeatRequest)
+void AskSplitRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:mspb.AskSplitRequest)
   ::google::protobuf::uint32 cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  isolated_replicas_.Clear();
+  split_key_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   if (GetArenaNoVirtual() == NULL && header_ != NULL) {
     delete header_;
   }
   header_ = NULL;
-  if (GetArenaNoVirtual() == NULL && stats_ != NULL) {
-    delete stats_;
+  if (GetArenaNoVirtual() == NULL && range_ != NULL) {
+    delete range_;
   }
-  stats_ = NULL;
-  node_id_ = GOOGLE_ULONGLONG(0);
+  range_ = NULL;
   _internal_metadata_.Clear();
 }
 
-bool NodeHeartbeatRequest::MergePartialFromCodedStream(
+bool AskSplitRequest::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:mspb.NodeHeartbeatRequest)
+  // @@protoc_insertion_point(parse_start:mspb.AskSplitRequest)
   for (;;) {
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
     tag = p.first;
@@ -5623,45 +8776,24 @@ bool NodeHeartbeatRequest::MergePartialFromCodedStream(
         break;
       }
 
-      // uint64 node_id = 2;
+      // .metapb.Range range = 2;
       case 2: {
         if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(16u /* 16 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
-                 input, &node_id_)));
+            static_cast< ::google::protobuf::uint8>(18u /* 18 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_range()));
         } else {
           goto handle_unusual;
         }
         break;
       }
 
-      // .mspb.NodeStats stats = 3;
+      // bytes split_key = 3;
       case 3: {
         if (static_cast< ::google::protobuf::uint8>(tag) ==
             static_cast< ::google::protobuf::uint8>(26u /* 26 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_stats()));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // repeated uint64 isolated_replicas = 4;
-      case 4: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(34u /* 34 & 0xFF */)) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPackedPrimitive<
-                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
-                 input, this->mutable_isolated_replicas())));
-        } else if (
-            static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(32u /* 32 & 0xFF */)) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadRepeatedPrimitiveNoInline<
-                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
-                 1, 34u, input, this->mutable_isolated_replicas())));
+          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
+                input, this->mutable_split_key()));
         } else {
           goto handle_unusual;
         }
@@ -5680,17 +8812,17 @@ bool NodeHeartbeatRequest::MergePartialFromCodedStream(
     }
   }
 success:
-  // @@protoc_insertion_point(parse_success:mspb.NodeHeartbeatRequest)
+  // @@protoc_insertion_point(parse_success:mspb.AskSplitRequest)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:mspb.NodeHeartbeatRequest)
+  // @@protoc_insertion_point(parse_failure:mspb.AskSplitRequest)
   return false;
 #undef DO_
 }
 
-void NodeHeartbeatRequest::SerializeWithCachedSizes(
+void AskSplitRequest::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:mspb.NodeHeartbeatRequest)
+  // @@protoc_insertion_point(serialize_start:mspb.AskSplitRequest)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
@@ -5700,39 +8832,29 @@ void NodeHeartbeatRequest::SerializeWithCachedSizes(
       1, *this->header_, output);
   }
 
-  // uint64 node_id = 2;
-  if (this->node_id() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt64(2, this->node_id(), output);
-  }
-
-  // .mspb.NodeStats stats = 3;
-  if (this->has_stats()) {
+  // .metapb.Range range = 2;
+  if (this->has_range()) {
     ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      3, *this->stats_, output);
+      2, *this->range_, output);
   }
 
-  // repeated uint64 isolated_replicas = 4;
-  if (this->isolated_replicas_size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteTag(4, ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
-    output->WriteVarint32(static_cast< ::google::protobuf::uint32>(
-        _isolated_replicas_cached_byte_size_));
-  }
-  for (int i = 0, n = this->isolated_replicas_size(); i < n; i++) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt64NoTag(
-      this->isolated_replicas(i), output);
+  // bytes split_key = 3;
+  if (this->split_key().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteBytesMaybeAliased(
+      3, this->split_key(), output);
   }
 
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
     ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
   }
-  // @@protoc_insertion_point(serialize_end:mspb.NodeHeartbeatRequest)
+  // @@protoc_insertion_point(serialize_end:mspb.AskSplitRequest)
 }
 
-::google::protobuf::uint8* NodeHeartbeatRequest::InternalSerializeWithCachedSizesToArray(
+::google::protobuf::uint8* AskSplitRequest::InternalSerializeWithCachedSizesToArray(
     bool deterministic, ::google::protobuf::uint8* target) const {
   (void)deterministic; // Unused
-  // @@protoc_insertion_point(serialize_to_array_start:mspb.NodeHeartbeatRequest)
+  // @@protoc_insertion_point(serialize_to_array_start:mspb.AskSplitRequest)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
@@ -5743,41 +8865,30 @@ void NodeHeartbeatRequest::SerializeWithCachedSizes(
         1, *this->header_, deterministic, target);
   }
 
-  // uint64 node_id = 2;
-  if (this->node_id() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(2, this->node_id(), target);
-  }
-
-  // .mspb.NodeStats stats = 3;
-  if (this->has_stats()) {
+  // .metapb.Range range = 2;
+  if (this->has_range()) {
     target = ::google::protobuf::internal::WireFormatLite::
       InternalWriteMessageNoVirtualToArray(
-        3, *this->stats_, deterministic, target);
+        2, *this->range_, deterministic, target);
   }
 
-  // repeated uint64 isolated_replicas = 4;
-  if (this->isolated_replicas_size() > 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteTagToArray(
-      4,
-      ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
-      target);
-    target = ::google::protobuf::io::CodedOutputStream::WriteVarint32ToArray(
-        static_cast< ::google::protobuf::uint32>(
-            _isolated_replicas_cached_byte_size_), target);
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteUInt64NoTagToArray(this->isolated_replicas_, target);
+  // bytes split_key = 3;
+  if (this->split_key().size() > 0) {
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteBytesToArray(
+        3, this->split_key(), target);
   }
 
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
     target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:mspb.NodeHeartbeatRequest)
+  // @@protoc_insertion_point(serialize_to_array_end:mspb.AskSplitRequest)
   return target;
 }
 
-size_t NodeHeartbeatRequest::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:mspb.NodeHeartbeatRequest)
+size_t AskSplitRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mspb.AskSplitRequest)
   size_t total_size = 0;
 
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
@@ -5785,20 +8896,11 @@ size_t NodeHeartbeatRequest::ByteSizeLong() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
   }
-  // repeated uint64 isolated_replicas = 4;
-  {
-    size_t data_size = ::google::protobuf::internal::WireFormatLite::
-      UInt64Size(this->isolated_replicas_);
-    if (data_size > 0) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int32Size(
-            static_cast< ::google::protobuf::int32>(data_size));
-    }
-    int cached_size = ::google::protobuf::internal::ToCachedSize(data_size);
-    GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-    _isolated_replicas_cached_byte_size_ = cached_size;
-    GOOGLE_SAFE_CONCURRENT_WRITES_END();
-    total_size += data_size;
+  // bytes split_key = 3;
+  if (this->split_key().size() > 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::BytesSize(
+        this->split_key());
   }
 
   // .mspb.RequestHeader header = 1;
@@ -5808,18 +8910,11 @@ size_t NodeHeartbeatRequest::ByteSizeLong() const {
         *this->header_);
   }
 
-  // .mspb.NodeStats stats = 3;
-  if (this->has_stats()) {
+  // .metapb.Range range = 2;
+  if (this->has_range()) {
     total_size += 1 +
       ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-        *this->stats_);
-  }
-
-  // uint64 node_id = 2;
-  if (this->node_id() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt64Size(
-        this->node_id());
+        *this->range_);
   }
 
   int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
@@ -5829,110 +8924,109 @@ size_t NodeHeartbeatRequest::ByteSizeLong() const {
   return total_size;
 }
 
-void NodeHeartbeatRequest::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:mspb.NodeHeartbeatRequest)
+void AskSplitRequest::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:mspb.AskSplitRequest)
   GOOGLE_DCHECK_NE(&from, this);
-  const NodeHeartbeatRequest* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const NodeHeartbeatRequest>(
+  const AskSplitRequest* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const AskSplitRequest>(
           &from);
   if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:mspb.NodeHeartbeatRequest)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:mspb.AskSplitRequest)
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:mspb.NodeHeartbeatRequest)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:mspb.AskSplitRequest)
     MergeFrom(*source);
   }
 }
 
-void NodeHeartbeatRequest::MergeFrom(const NodeHeartbeatRequest& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:mspb.NodeHeartbeatRequest)
+void AskSplitRequest::MergeFrom(const AskSplitRequest& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:mspb.AskSplitRequest)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  isolated_replicas_.MergeFrom(from.isolated_replicas_);
+  if (from.split_key().size() > 0) {
+
+    split_key_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.split_key_);
+  }
   if (from.has_header()) {
     mutable_header()->::mspb::RequestHeader::MergeFrom(from.header());
   }
-  if (from.has_stats()) {
-    mutable_stats()->::mspb::NodeStats::MergeFrom(from.stats());
-  }
-  if (from.node_id() != 0) {
-    set_node_id(from.node_id());
+  if (from.has_range()) {
+    mutable_range()->::metapb::Range::MergeFrom(from.range());
   }
 }
 
-void NodeHeartbeatRequest::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:mspb.NodeHeartbeatRequest)
+void AskSplitRequest::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:mspb.AskSplitRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void NodeHeartbeatRequest::CopyFrom(const NodeHeartbeatRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:mspb.NodeHeartbeatRequest)
+void AskSplitRequest::CopyFrom(const AskSplitRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mspb.AskSplitRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool NodeHeartbeatRequest::IsInitialized() const {
+bool AskSplitRequest::IsInitialized() const {
   return true;
 }
 
-void NodeHeartbeatRequest::Swap(NodeHeartbeatRequest* other) {
+void AskSplitRequest::Swap(AskSplitRequest* other) {
   if (other == this) return;
   InternalSwap(other);
 }
-void NodeHeartbeatRequest::InternalSwap(NodeHeartbeatRequest* other) {
+void AskSplitRequest::InternalSwap(AskSplitRequest* other) {
   using std::swap;
-  isolated_replicas_.InternalSwap(&other->isolated_replicas_);
+  split_key_.Swap(&other->split_key_);
   swap(header_, other->header_);
-  swap(stats_, other->stats_);
-  swap(node_id_, other->node_id_);
+  swap(range_, other->range_);
   _internal_metadata_.Swap(&other->_internal_metadata_);
   swap(_cached_size_, other->_cached_size_);
 }
 
-::google::protobuf::Metadata NodeHeartbeatRequest::GetMetadata() const {
+::google::protobuf::Metadata AskSplitRequest::GetMetadata() const {
   protobuf_mspb_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_mspb_2eproto::file_level_metadata[kIndexInFileMessages];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
-// NodeHeartbeatRequest
+// AskSplitRequest
 
 // .mspb.RequestHeader header = 1;
-bool NodeHeartbeatRequest::has_header() const {
+bool AskSplitRequest::has_header() const {
   return this != internal_default_instance() && header_ != NULL;
 }
-void NodeHeartbeatRequest::clear_header() {
+void AskSplitRequest::clear_header() {
   if (GetArenaNoVirtual() == NULL && header_ != NULL) delete header_;
   header_ = NULL;
 }
-const ::mspb::RequestHeader& NodeHeartbeatRequest::header() const {
+const ::mspb::RequestHeader& AskSplitRequest::header() const {
   const ::mspb::RequestHeader* p = header_;
-  // @@protoc_insertion_point(field_get:mspb.NodeHeartbeatRequest.header)
+  // @@protoc_insertion_point(field_get:mspb.AskSplitRequest.header)
   return p != NULL ? *p : *reinterpret_cast<const ::mspb::RequestHeader*>(
       &::mspb::_RequestHeader_default_instance_);
 }
-::mspb::RequestHeader* NodeHeartbeatRequest::mutable_header() {
+::mspb::RequestHeader* AskSplitRequest::mutable_header() {
   
   if (header_ == NULL) {
     header_ = new ::mspb::RequestHeader;
   }
-  // @@protoc_insertion_point(field_mutable:mspb.NodeHeartbeatRequest.header)
+  // @@protoc_insertion_point(field_mutable:mspb.AskSplitRequest.header)
   return header_;
 }
-::mspb::RequestHeader* NodeHeartbeatRequest::release_header() {
-  // @@protoc_insertion_point(field_release:mspb.NodeHeartbeatRequest.header)
+::mspb::RequestHeader* AskSplitRequest::release_header() {
+  // @@protoc_insertion_point(field_release:mspb.AskSplitRequest.header)
   
   ::mspb::RequestHeader* temp = header_;
   header_ = NULL;
   return temp;
 }
-void NodeHeartbeatRequest::set_allocated_header(::mspb::RequestHeader* header) {
+void AskSplitRequest::set_allocated_header(::mspb::RequestHeader* header) {
   delete header_;
   header_ = header;
   if (header) {
@@ -5940,91 +9034,100 @@ void NodeHeartbeatRequest::set_allocated_header(::mspb::RequestHeader* header) {
   } else {
     
   }
-  // @@protoc_insertion_point(field_set_allocated:mspb.NodeHeartbeatRequest.header)
-}
-
-// uint64 node_id = 2;
-void NodeHeartbeatRequest::clear_node_id() {
-  node_id_ = GOOGLE_ULONGLONG(0);
-}
-::google::protobuf::uint64 NodeHeartbeatRequest::node_id() const {
-  // @@protoc_insertion_point(field_get:mspb.NodeHeartbeatRequest.node_id)
-  return node_id_;
-}
-void NodeHeartbeatRequest::set_node_id(::google::protobuf::uint64 value) {
-  
-  node_id_ = value;
-  // @@protoc_insertion_point(field_set:mspb.NodeHeartbeatRequest.node_id)
+  // @@protoc_insertion_point(field_set_allocated:mspb.AskSplitRequest.header)
 }
 
-// .mspb.NodeStats stats = 3;
-bool NodeHeartbeatRequest::has_stats() const {
-  return this != internal_default_instance() && stats_ != NULL;
+// .metapb.Range range = 2;
+bool AskSplitRequest::has_range() const {
+  return this != internal_default_instance() && range_ != NULL;
 }
-void NodeHeartbeatRequest::clear_stats() {
-  if (GetArenaNoVirtual() == NULL && stats_ != NULL) delete stats_;
-  stats_ = NULL;
+void AskSplitRequest::clear_range() {
+  if (GetArenaNoVirtual() == NULL && range_ != NULL) delete range_;
+  range_ = NULL;
 }
-const ::mspb::NodeStats& NodeHeartbeatRequest::stats() const {
-  const ::mspb::NodeStats* p = stats_;
-  // @@protoc_insertion_point(field_get:mspb.NodeHeartbeatRequest.stats)
-  return p != NULL ? *p : *reinterpret_cast<const ::mspb::NodeStats*>(
-      &::mspb::_NodeStats_default_instance_);
+const ::metapb::Range& AskSplitRequest::range() const {
+  const ::metapb::Range* p = range_;
+  // @@protoc_insertion_point(field_get:mspb.AskSplitRequest.range)
+  return p != NULL ? *p : *reinterpret_cast<const ::metapb::Range*>(
+      &::metapb::_Range_default_instance_);
 }
-::mspb::NodeStats* NodeHeartbeatRequest::mutable_stats() {
+::metapb::Range* AskSplitRequest::mutable_range() {
   
-  if (stats_ == NULL) {
-    stats_ = new ::mspb::NodeStats;
+  if (range_ == NULL) {
+    range_ = new ::metapb::Range;
   }
-  // @@protoc_insertion_point(field_mutable:mspb.NodeHeartbeatRequest.stats)
-  return stats_;
+  // @@protoc_insertion_point(field_mutable:mspb.AskSplitRequest.range)
+  return range_;
 }
-::mspb::NodeStats* NodeHeartbeatRequest::release_stats() {
-  // @@protoc_insertion_point(field_release:mspb.NodeHeartbeatRequest.stats)
+::metapb::Range* AskSplitRequest::release_range() {
+  // @@protoc_insertion_point(field_release:mspb.AskSplitRequest.range)
   
-  ::mspb::NodeStats* temp = stats_;
-  stats_ = NULL;
+  ::metapb::Range* temp = range_;
+  range_ = NULL;
   return temp;
 }
-void NodeHeartbeatRequest::set_allocated_stats(::mspb::NodeStats* stats) {
-  delete stats_;
-  stats_ = stats;
-  if (stats) {
+void AskSplitRequest::set_allocated_range(::metapb::Range* range) {
+  delete range_;
+  range_ = range;
+  if (range) {
     
   } else {
     
   }
-  // @@protoc_insertion_point(field_set_allocated:mspb.NodeHeartbeatRequest.stats)
+  // @@protoc_insertion_point(field_set_allocated:mspb.AskSplitRequest.range)
 }
 
-// repeated uint64 isolated_replicas = 4;
-int NodeHeartbeatRequest::isolated_replicas_size() const {
-  return isolated_replicas_.size();
+// bytes split_key = 3;
+void AskSplitRequest::clear_split_key() {
+  split_key_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-void NodeHeartbeatRequest::clear_isolated_replicas() {
-  isolated_replicas_.Clear();
+const ::std::string& AskSplitRequest::split_key() const {
+  // @@protoc_insertion_point(field_get:mspb.AskSplitRequest.split_key)
+  return split_key_.GetNoArena();
 }
-::google::protobuf::uint64 NodeHeartbeatRequest::isolated_replicas(int index) const {
-  // @@protoc_insertion_point(field_get:mspb.NodeHeartbeatRequest.isolated_replicas)
-  return isolated_replicas_.Get(index);
+void AskSplitRequest::set_split_key(const ::std::string& value) {
+  
+  split_key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:mspb.AskSplitRequest.split_key)
 }
-void NodeHeartbeatRequest::set_isolated_replicas(int index, ::google::protobuf::uint64 value) {
-  isolated_replicas_.Set(index, value);
-  // @@protoc_insertion_point(field_set:mspb.NodeHeartbeatRequest.isolated_replicas)
+#if LANG_CXX11
+void AskSplitRequest::set_split_key(::std::string&& value) {
+  
+  split_key_.SetNoArena(
+    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:mspb.AskSplitRequest.split_key)
 }
-void NodeHeartbeatRequest::add_isolated_replicas(::google::protobuf::uint64 value) {
-  isolated_replicas_.Add(value);
-  // @@protoc_insertion_point(field_add:mspb.NodeHeartbeatRequest.isolated_replicas)
+#endif
+void AskSplitRequest::set_split_key(const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  
+  split_key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:mspb.AskSplitRequest.split_key)
 }
-const ::google::protobuf::RepeatedField< ::google::protobuf::uint64 >&
-NodeHeartbeatRequest::isolated_replicas() const {
-  // @@protoc_insertion_point(field_list:mspb.NodeHeartbeatRequest.isolated_replicas)
-  return isolated_replicas_;
+void AskSplitRequest::set_split_key(const void* value, size_t size) {
+  
+  split_key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:mspb.AskSplitRequest.split_key)
+}
+::std::string* AskSplitRequest::mutable_split_key() {
+  
+  // @@protoc_insertion_point(field_mutable:mspb.AskSplitRequest.split_key)
+  return split_key_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-::google::protobuf::RepeatedField< ::google::protobuf::uint64 >*
-NodeHeartbeatRequest::mutable_isolated_replicas() {
-  // @@protoc_insertion_point(field_mutable_list:mspb.NodeHeartbeatRequest.isolated_replicas)
-  return &isolated_replicas_;
+::std::string* AskSplitRequest::release_split_key() {
+  // @@protoc_insertion_point(field_release:mspb.AskSplitRequest.split_key)
+  
+  return split_key_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+void AskSplitRequest::set_allocated_split_key(::std::string* split_key) {
+  if (split_key != NULL) {
+    
+  } else {
+    
+  }
+  split_key_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), split_key);
+  // @@protoc_insertion_point(field_set_allocated:mspb.AskSplitRequest.split_key)
 }
 
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -6032,93 +9135,112 @@ NodeHeartbeatRequest::mutable_isolated_replicas() {
 // ===================================================================
 
 #if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int NodeHeartbeatResponse::kHeaderFieldNumber;
-const int NodeHeartbeatResponse::kNodeIdFieldNumber;
-const int NodeHeartbeatResponse::kDeleteReplicasFieldNumber;
+const int AskSplitResponse::kHeaderFieldNumber;
+const int AskSplitResponse::kRangeFieldNumber;
+const int AskSplitResponse::kNewRangeIdFieldNumber;
+const int AskSplitResponse::kNewPeerIdsFieldNumber;
+const int AskSplitResponse::kSplitKeyFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
-NodeHeartbeatResponse::NodeHeartbeatResponse()
+AskSplitResponse::AskSplitResponse()
   : ::google::protobuf::Message(), _internal_metadata_(NULL) {
   if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
     protobuf_mspb_2eproto::InitDefaults();
   }
   SharedCtor();
-  // @@protoc_insertion_point(constructor:mspb.NodeHeartbeatResponse)
+  // @@protoc_insertion_point(constructor:mspb.AskSplitResponse)
 }
-NodeHeartbeatResponse::NodeHeartbeatResponse(const NodeHeartbeatResponse& from)
+AskSplitResponse::AskSplitResponse(const AskSplitResponse& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
-      delete_replicas_(from.delete_replicas_),
+      new_peer_ids_(from.new_peer_ids_),
       _cached_size_(0) {
   _internal_metadata_.MergeFrom(from._internal_metadata_);
+  split_key_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (from.split_key().size() > 0) {
+    split_key_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.split_key_);
+  }
   if (from.has_header()) {
     header_ = new ::mspb::ResponseHeader(*from.header_);
   } else {
     header_ = NULL;
   }
-  node_id_ = from.node_id_;
-  // @@protoc_insertion_point(copy_constructor:mspb.NodeHeartbeatResponse)
+  if (from.has_range()) {
+    range_ = new ::metapb::Range(*from.range_);
+  } else {
+    range_ = NULL;
+  }
+  new_range_id_ = from.new_range_id_;
+  // @@protoc_insertion_point(copy_constructor:mspb.AskSplitResponse)
 }
 
-void NodeHeartbeatResponse::SharedCtor() {
+void AskSplitResponse::SharedCtor() {
+  split_key_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   ::memset(&header_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&node_id_) -
-      reinterpret_cast<char*>(&header_)) + sizeof(node_id_));
+      reinterpret_cast<char*>(&new_range_id_) -
+      reinterpret_cast<char*>(&header_)) + sizeof(new_range_id_));
   _cached_size_ = 0;
 }
 
-NodeHeartbeatResponse::~NodeHeartbeatResponse() {
-  // @@protoc_insertion_point(destructor:mspb.NodeHeartbeatResponse)
+AskSplitResponse::~AskSplitResponse() {
+  // @@protoc_insertion_point(destructor:mspb.AskSplitResponse)
   SharedDtor();
 }
 
-void NodeHeartbeatResponse::SharedDtor() {
+void AskSplitResponse::SharedDtor() {
+  split_key_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   if (this != internal_default_instance()) delete header_;
+  if (this != internal_default_instance()) delete range_;
 }
 
-void NodeHeartbeatResponse::SetCachedSize(int size) const {
+void AskSplitResponse::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* NodeHeartbeatResponse::descriptor() {
+const ::google::protobuf::Descriptor* AskSplitResponse::descriptor() {
   protobuf_mspb_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_mspb_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
 }
 
-const NodeHeartbeatResponse& NodeHeartbeatResponse::default_instance() {
+const AskSplitResponse& AskSplitResponse::default_instance() {
   protobuf_mspb_2eproto::InitDefaults();
   return *internal_default_instance();
 }
 
-NodeHeartbeatResponse* NodeHeartbeatResponse::New(::google::protobuf::Arena* arena) const {
-  NodeHeartbeatResponse* n = new NodeHeartbeatResponse;
+AskSplitResponse* AskSplitResponse::New(::google::protobuf::Arena* arena) const {
+  AskSplitResponse* n = new AskSplitResponse;
   if (arena != NULL) {
     arena->Own(n);
   }
   return n;
 }
 
-void NodeHeartbeatResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:mspb.NodeHeartbeatResponse)
+void AskSplitResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:mspb.AskSplitResponse)
   ::google::protobuf::uint32 cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  delete_replicas_.Clear();
+  new_peer_ids_.Clear();
+  split_key_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   if (GetArenaNoVirtual() == NULL && header_ != NULL) {
     delete header_;
   }
   header_ = NULL;
-  node_id_ = GOOGLE_ULONGLONG(0);
+  if (GetArenaNoVirtual() == NULL && range_ != NULL) {
+    delete range_;
+  }
+  range_ = NULL;
+  new_range_id_ = GOOGLE_ULONGLONG(0);
   _internal_metadata_.Clear();
 }
 
-bool NodeHeartbeatResponse::MergePartialFromCodedStream(
+bool AskSplitResponse::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:mspb.NodeHeartbeatResponse)
+  // @@protoc_insertion_point(parse_start:mspb.AskSplitResponse)
   for (;;) {
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
     tag = p.first;
@@ -6136,33 +9258,57 @@ bool NodeHeartbeatResponse::MergePartialFromCodedStream(
         break;
       }
 
-      // uint64 node_id = 2;
+      // .metapb.Range range = 2;
       case 2: {
         if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(16u /* 16 & 0xFF */)) {
+            static_cast< ::google::protobuf::uint8>(18u /* 18 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_range()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint64 new_range_id = 3;
+      case 3: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(24u /* 24 & 0xFF */)) {
 
           DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
                    ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
-                 input, &node_id_)));
+                 input, &new_range_id_)));
         } else {
           goto handle_unusual;
         }
         break;
       }
 
-      // repeated uint64 delete_replicas = 3;
-      case 3: {
+      // repeated uint64 new_peer_ids = 4;
+      case 4: {
         if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(26u /* 26 & 0xFF */)) {
+            static_cast< ::google::protobuf::uint8>(34u /* 34 & 0xFF */)) {
           DO_((::google::protobuf::internal::WireFormatLite::ReadPackedPrimitive<
                    ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
-                 input, this->mutable_delete_replicas())));
+                 input, this->mutable_new_peer_ids())));
         } else if (
             static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(24u /* 24 & 0xFF */)) {
+            static_cast< ::google::protobuf::uint8>(32u /* 32 & 0xFF */)) {
           DO_((::google::protobuf::internal::WireFormatLite::ReadRepeatedPrimitiveNoInline<
                    ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
-                 1, 26u, input, this->mutable_delete_replicas())));
+                 1, 34u, input, this->mutable_new_peer_ids())));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // bytes split_key = 5;
+      case 5: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(42u /* 42 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
+                input, this->mutable_split_key()));
         } else {
           goto handle_unusual;
         }
@@ -6181,17 +9327,17 @@ bool NodeHeartbeatResponse::MergePartialFromCodedStream(
     }
   }
 success:
-  // @@protoc_insertion_point(parse_success:mspb.NodeHeartbeatResponse)
+  // @@protoc_insertion_point(parse_success:mspb.AskSplitResponse)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:mspb.NodeHeartbeatResponse)
+  // @@protoc_insertion_point(parse_failure:mspb.AskSplitResponse)
   return false;
 #undef DO_
 }
 
-void NodeHeartbeatResponse::SerializeWithCachedSizes(
+void AskSplitResponse::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:mspb.NodeHeartbeatResponse)
+  // @@protoc_insertion_point(serialize_start:mspb.AskSplitResponse)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
@@ -6201,33 +9347,45 @@ void NodeHeartbeatResponse::SerializeWithCachedSizes(
       1, *this->header_, output);
   }
 
-  // uint64 node_id = 2;
-  if (this->node_id() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt64(2, this->node_id(), output);
+  // .metapb.Range range = 2;
+  if (this->has_range()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      2, *this->range_, output);
   }
 
-  // repeated uint64 delete_replicas = 3;
-  if (this->delete_replicas_size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteTag(3, ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
+  // uint64 new_range_id = 3;
+  if (this->new_range_id() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(3, this->new_range_id(), output);
+  }
+
+  // repeated uint64 new_peer_ids = 4;
+  if (this->new_peer_ids_size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteTag(4, ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
     output->WriteVarint32(static_cast< ::google::protobuf::uint32>(
-        _delete_replicas_cached_byte_size_));
+        _new_peer_ids_cached_byte_size_));
   }
-  for (int i = 0, n = this->delete_replicas_size(); i < n; i++) {
+  for (int i = 0, n = this->new_peer_ids_size(); i < n; i++) {
     ::google::protobuf::internal::WireFormatLite::WriteUInt64NoTag(
-      this->delete_replicas(i), output);
+      this->new_peer_ids(i), output);
+  }
+
+  // bytes split_key = 5;
+  if (this->split_key().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteBytesMaybeAliased(
+      5, this->split_key(), output);
   }
 
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
     ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
   }
-  // @@protoc_insertion_point(serialize_end:mspb.NodeHeartbeatResponse)
+  // @@protoc_insertion_point(serialize_end:mspb.AskSplitResponse)
 }
 
-::google::protobuf::uint8* NodeHeartbeatResponse::InternalSerializeWithCachedSizesToArray(
+::google::protobuf::uint8* AskSplitResponse::InternalSerializeWithCachedSizesToArray(
     bool deterministic, ::google::protobuf::uint8* target) const {
   (void)deterministic; // Unused
-  // @@protoc_insertion_point(serialize_to_array_start:mspb.NodeHeartbeatResponse)
+  // @@protoc_insertion_point(serialize_to_array_start:mspb.AskSplitResponse)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
@@ -6238,34 +9396,48 @@ void NodeHeartbeatResponse::SerializeWithCachedSizes(
         1, *this->header_, deterministic, target);
   }
 
-  // uint64 node_id = 2;
-  if (this->node_id() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(2, this->node_id(), target);
+  // .metapb.Range range = 2;
+  if (this->has_range()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      InternalWriteMessageNoVirtualToArray(
+        2, *this->range_, deterministic, target);
   }
 
-  // repeated uint64 delete_replicas = 3;
-  if (this->delete_replicas_size() > 0) {
+  // uint64 new_range_id = 3;
+  if (this->new_range_id() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(3, this->new_range_id(), target);
+  }
+
+  // repeated uint64 new_peer_ids = 4;
+  if (this->new_peer_ids_size() > 0) {
     target = ::google::protobuf::internal::WireFormatLite::WriteTagToArray(
-      3,
+      4,
       ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
       target);
     target = ::google::protobuf::io::CodedOutputStream::WriteVarint32ToArray(
         static_cast< ::google::protobuf::uint32>(
-            _delete_replicas_cached_byte_size_), target);
+            _new_peer_ids_cached_byte_size_), target);
     target = ::google::protobuf::internal::WireFormatLite::
-      WriteUInt64NoTagToArray(this->delete_replicas_, target);
+      WriteUInt64NoTagToArray(this->new_peer_ids_, target);
+  }
+
+  // bytes split_key = 5;
+  if (this->split_key().size() > 0) {
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteBytesToArray(
+        5, this->split_key(), target);
   }
 
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
     target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:mspb.NodeHeartbeatResponse)
+  // @@protoc_insertion_point(serialize_to_array_end:mspb.AskSplitResponse)
   return target;
 }
 
-size_t NodeHeartbeatResponse::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:mspb.NodeHeartbeatResponse)
+size_t AskSplitResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mspb.AskSplitResponse)
   size_t total_size = 0;
 
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
@@ -6273,10 +9445,10 @@ size_t NodeHeartbeatResponse::ByteSizeLong() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
   }
-  // repeated uint64 delete_replicas = 3;
+  // repeated uint64 new_peer_ids = 4;
   {
     size_t data_size = ::google::protobuf::internal::WireFormatLite::
-      UInt64Size(this->delete_replicas_);
+      UInt64Size(this->new_peer_ids_);
     if (data_size > 0) {
       total_size += 1 +
         ::google::protobuf::internal::WireFormatLite::Int32Size(
@@ -6284,11 +9456,18 @@ size_t NodeHeartbeatResponse::ByteSizeLong() const {
     }
     int cached_size = ::google::protobuf::internal::ToCachedSize(data_size);
     GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-    _delete_replicas_cached_byte_size_ = cached_size;
+    _new_peer_ids_cached_byte_size_ = cached_size;
     GOOGLE_SAFE_CONCURRENT_WRITES_END();
     total_size += data_size;
   }
 
+  // bytes split_key = 5;
+  if (this->split_key().size() > 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::BytesSize(
+        this->split_key());
+  }
+
   // .mspb.ResponseHeader header = 1;
   if (this->has_header()) {
     total_size += 1 +
@@ -6296,11 +9475,18 @@ size_t NodeHeartbeatResponse::ByteSizeLong() const {
         *this->header_);
   }
 
-  // uint64 node_id = 2;
-  if (this->node_id() != 0) {
+  // .metapb.Range range = 2;
+  if (this->has_range()) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+        *this->range_);
+  }
+
+  // uint64 new_range_id = 3;
+  if (this->new_range_id() != 0) {
     total_size += 1 +
       ::google::protobuf::internal::WireFormatLite::UInt64Size(
-        this->node_id());
+        this->new_range_id());
   }
 
   int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
@@ -6310,106 +9496,115 @@ size_t NodeHeartbeatResponse::ByteSizeLong() const {
   return total_size;
 }
 
-void NodeHeartbeatResponse::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:mspb.NodeHeartbeatResponse)
+void AskSplitResponse::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:mspb.AskSplitResponse)
   GOOGLE_DCHECK_NE(&from, this);
-  const NodeHeartbeatResponse* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const NodeHeartbeatResponse>(
+  const AskSplitResponse* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const AskSplitResponse>(
           &from);
   if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:mspb.NodeHeartbeatResponse)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:mspb.AskSplitResponse)
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:mspb.NodeHeartbeatResponse)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:mspb.AskSplitResponse)
     MergeFrom(*source);
   }
 }
 
-void NodeHeartbeatResponse::MergeFrom(const NodeHeartbeatResponse& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:mspb.NodeHeartbeatResponse)
+void AskSplitResponse::MergeFrom(const AskSplitResponse& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:mspb.AskSplitResponse)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  delete_replicas_.MergeFrom(from.delete_replicas_);
+  new_peer_ids_.MergeFrom(from.new_peer_ids_);
+  if (from.split_key().size() > 0) {
+
+    split_key_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.split_key_);
+  }
   if (from.has_header()) {
     mutable_header()->::mspb::ResponseHeader::MergeFrom(from.header());
   }
-  if (from.node_id() != 0) {
-    set_node_id(from.node_id());
+  if (from.has_range()) {
+    mutable_range()->::metapb::Range::MergeFrom(from.range());
+  }
+  if (from.new_range_id() != 0) {
+    set_new_range_id(from.new_range_id());
   }
 }
 
-void NodeHeartbeatResponse::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:mspb.NodeHeartbeatResponse)
+void AskSplitResponse::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:mspb.AskSplitResponse)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void NodeHeartbeatResponse::CopyFrom(const NodeHeartbeatResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:mspb.NodeHeartbeatResponse)
+void AskSplitResponse::CopyFrom(const AskSplitResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mspb.AskSplitResponse)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool NodeHeartbeatResponse::IsInitialized() const {
+bool AskSplitResponse::IsInitialized() const {
   return true;
 }
 
-void NodeHeartbeatResponse::Swap(NodeHeartbeatResponse* other) {
+void AskSplitResponse::Swap(AskSplitResponse* other) {
   if (other == this) return;
   InternalSwap(other);
 }
-void NodeHeartbeatResponse::InternalSwap(NodeHeartbeatResponse* other) {
+void AskSplitResponse::InternalSwap(AskSplitResponse* other) {
   using std::swap;
-  delete_replicas_.InternalSwap(&other->delete_replicas_);
+  new_peer_ids_.InternalSwap(&other->new_peer_ids_);
+  split_key_.Swap(&other->split_key_);
   swap(header_, other->header_);
-  swap(node_id_, other->node_id_);
+  swap(range_, other->range_);
+  swap(new_range_id_, other->new_range_id_);
   _internal_metadata_.Swap(&other->_internal_metadata_);
   swap(_cached_size_, other->_cached_size_);
 }
 
-::google::protobuf::Metadata NodeHeartbeatResponse::GetMetadata() const {
+::google::protobuf::Metadata AskSplitResponse::GetMetadata() const {
   protobuf_mspb_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_mspb_2eproto::file_level_metadata[kIndexInFileMessages];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
-// NodeHeartbeatResponse
+// AskSplitResponse
 
 // .mspb.ResponseHeader header = 1;
-bool NodeHeartbeatResponse::has_header() const {
+bool AskSplitResponse::has_header() const {
   return this != internal_default_instance() && header_ != NULL;
 }
-void NodeHeartbeatResponse::clear_header() {
+void AskSplitResponse::clear_header() {
   if (GetArenaNoVirtual() == NULL && header_ != NULL) delete header_;
   header_ = NULL;
 }
-const ::mspb::ResponseHeader& NodeHeartbeatResponse::header() const {
+const ::mspb::ResponseHeader& AskSplitResponse::header() const {
   const ::mspb::ResponseHeader* p = header_;
-  // @@protoc_insertion_point(field_get:mspb.NodeHeartbeatResponse.header)
+  // @@protoc_insertion_point(field_get:mspb.AskSplitResponse.header)
   return p != NULL ? *p : *reinterpret_cast<const ::mspb::ResponseHeader*>(
       &::mspb::_ResponseHeader_default_instance_);
 }
-::mspb::ResponseHeader* NodeHeartbeatResponse::mutable_header() {
+::mspb::ResponseHeader* AskSplitResponse::mutable_header() {
   
   if (header_ == NULL) {
     header_ = new ::mspb::ResponseHeader;
   }
-  // @@protoc_insertion_point(field_mutable:mspb.NodeHeartbeatResponse.header)
+  // @@protoc_insertion_point(field_mutable:mspb.AskSplitResponse.header)
   return header_;
 }
-::mspb::ResponseHeader* NodeHeartbeatResponse::release_header() {
-  // @@protoc_insertion_point(field_release:mspb.NodeHeartbeatResponse.header)
+::mspb::ResponseHeader* AskSplitResponse::release_header() {
+  // @@protoc_insertion_point(field_release:mspb.AskSplitResponse.header)
   
   ::mspb::ResponseHeader* temp = header_;
   header_ = NULL;
   return temp;
 }
-void NodeHeartbeatResponse::set_allocated_header(::mspb::ResponseHeader* header) {
+void AskSplitResponse::set_allocated_header(::mspb::ResponseHeader* header) {
   delete header_;
   header_ = header;
   if (header) {
@@ -6417,51 +9612,144 @@ void NodeHeartbeatResponse::set_allocated_header(::mspb::ResponseHeader* header)
   } else {
     
   }
-  // @@protoc_insertion_point(field_set_allocated:mspb.NodeHeartbeatResponse.header)
+  // @@protoc_insertion_point(field_set_allocated:mspb.AskSplitResponse.header)
 }
 
-// uint64 node_id = 2;
-void NodeHeartbeatResponse::clear_node_id() {
-  node_id_ = GOOGLE_ULONGLONG(0);
+// .metapb.Range range = 2;
+bool AskSplitResponse::has_range() const {
+  return this != internal_default_instance() && range_ != NULL;
 }
-::google::protobuf::uint64 NodeHeartbeatResponse::node_id() const {
-  // @@protoc_insertion_point(field_get:mspb.NodeHeartbeatResponse.node_id)
-  return node_id_;
+void AskSplitResponse::clear_range() {
+  if (GetArenaNoVirtual() == NULL && range_ != NULL) delete range_;
+  range_ = NULL;
 }
-void NodeHeartbeatResponse::set_node_id(::google::protobuf::uint64 value) {
+const ::metapb::Range& AskSplitResponse::range() const {
+  const ::metapb::Range* p = range_;
+  // @@protoc_insertion_point(field_get:mspb.AskSplitResponse.range)
+  return p != NULL ? *p : *reinterpret_cast<const ::metapb::Range*>(
+      &::metapb::_Range_default_instance_);
+}
+::metapb::Range* AskSplitResponse::mutable_range() {
   
-  node_id_ = value;
-  // @@protoc_insertion_point(field_set:mspb.NodeHeartbeatResponse.node_id)
+  if (range_ == NULL) {
+    range_ = new ::metapb::Range;
+  }
+  // @@protoc_insertion_point(field_mutable:mspb.AskSplitResponse.range)
+  return range_;
+}
+::metapb::Range* AskSplitResponse::release_range() {
+  // @@protoc_insertion_point(field_release:mspb.AskSplitResponse.range)
+  
+  ::metapb::Range* temp = range_;
+  range_ = NULL;
+  return temp;
+}
+void AskSplitResponse::set_allocated_range(::metapb::Range* range) {
+  delete range_;
+  range_ = range;
+  if (range) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_set_allocated:mspb.AskSplitResponse.range)
 }
 
-// repeated uint64 delete_replicas = 3;
-int NodeHeartbeatResponse::delete_replicas_size() const {
-  return delete_replicas_.size();
+// uint64 new_range_id = 3;
+void AskSplitResponse::clear_new_range_id() {
+  new_range_id_ = GOOGLE_ULONGLONG(0);
 }
-void NodeHeartbeatResponse::clear_delete_replicas() {
-  delete_replicas_.Clear();
+::google::protobuf::uint64 AskSplitResponse::new_range_id() const {
+  // @@protoc_insertion_point(field_get:mspb.AskSplitResponse.new_range_id)
+  return new_range_id_;
 }
-::google::protobuf::uint64 NodeHeartbeatResponse::delete_replicas(int index) const {
-  // @@protoc_insertion_point(field_get:mspb.NodeHeartbeatResponse.delete_replicas)
-  return delete_replicas_.Get(index);
+void AskSplitResponse::set_new_range_id(::google::protobuf::uint64 value) {
+  
+  new_range_id_ = value;
+  // @@protoc_insertion_point(field_set:mspb.AskSplitResponse.new_range_id)
 }
-void NodeHeartbeatResponse::set_delete_replicas(int index, ::google::protobuf::uint64 value) {
-  delete_replicas_.Set(index, value);
-  // @@protoc_insertion_point(field_set:mspb.NodeHeartbeatResponse.delete_replicas)
+
+// repeated uint64 new_peer_ids = 4;
+int AskSplitResponse::new_peer_ids_size() const {
+  return new_peer_ids_.size();
 }
-void NodeHeartbeatResponse::add_delete_replicas(::google::protobuf::uint64 value) {
-  delete_replicas_.Add(value);
-  // @@protoc_insertion_point(field_add:mspb.NodeHeartbeatResponse.delete_replicas)
+void AskSplitResponse::clear_new_peer_ids() {
+  new_peer_ids_.Clear();
+}
+::google::protobuf::uint64 AskSplitResponse::new_peer_ids(int index) const {
+  // @@protoc_insertion_point(field_get:mspb.AskSplitResponse.new_peer_ids)
+  return new_peer_ids_.Get(index);
+}
+void AskSplitResponse::set_new_peer_ids(int index, ::google::protobuf::uint64 value) {
+  new_peer_ids_.Set(index, value);
+  // @@protoc_insertion_point(field_set:mspb.AskSplitResponse.new_peer_ids)
+}
+void AskSplitResponse::add_new_peer_ids(::google::protobuf::uint64 value) {
+  new_peer_ids_.Add(value);
+  // @@protoc_insertion_point(field_add:mspb.AskSplitResponse.new_peer_ids)
 }
 const ::google::protobuf::RepeatedField< ::google::protobuf::uint64 >&
-NodeHeartbeatResponse::delete_replicas() const {
-  // @@protoc_insertion_point(field_list:mspb.NodeHeartbeatResponse.delete_replicas)
-  return delete_replicas_;
+AskSplitResponse::new_peer_ids() const {
+  // @@protoc_insertion_point(field_list:mspb.AskSplitResponse.new_peer_ids)
+  return new_peer_ids_;
 }
 ::google::protobuf::RepeatedField< ::google::protobuf::uint64 >*
-NodeHeartbeatResponse::mutable_delete_replicas() {
-  // @@protoc_insertion_point(field_mutable_list:mspb.NodeHeartbeatResponse.delete_replicas)
-  return &delete_replicas_;
+AskSplitResponse::mutable_new_peer_ids() {
+  // @@protoc_insertion_point(field_mutable_list:mspb.AskSplitResponse.new_peer_ids)
+  return &new_peer_ids_;
+}
+
+// bytes split_key = 5;
+void AskSplitResponse::clear_split_key() {
+  split_key_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+const ::std::string& AskSplitResponse::split_key() const {
+  // @@protoc_insertion_point(field_get:mspb.AskSplitResponse.split_key)
+  return split_key_.GetNoArena();
+}
+void AskSplitResponse::set_split_key(const ::std::string& value) {
+  
+  split_key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:mspb.AskSplitResponse.split_key)
+}
+#if LANG_CXX11
+void AskSplitResponse::set_split_key(::std::string&& value) {
+  
+  split_key_.SetNoArena(
+    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:mspb.AskSplitResponse.split_key)
+}
+#endif
+void AskSplitResponse::set_split_key(const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  
+  split_key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:mspb.AskSplitResponse.split_key)
+}
+void AskSplitResponse::set_split_key(const void* value, size_t size) {
+  
+  split_key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:mspb.AskSplitResponse.split_key)
+}
+::std::string* AskSplitResponse::mutable_split_key() {
+  
+  // @@protoc_insertion_point(field_mutable:mspb.AskSplitResponse.split_key)
+  return split_key_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+::std::string* AskSplitResponse::release_split_key() {
+  // @@protoc_insertion_point(field_release:mspb.AskSplitResponse.split_key)
+  
+  return split_key_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+void AskSplitResponse::set_allocated_split_key(::std::string* split_key) {
+  if (split_key != NULL) {
+    
+  } else {
+    
+  }
+  split_key_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), split_key);
+  // @@protoc_insertion_point(field_set_allocated:mspb.AskSplitResponse.split_key)
 }
 
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -6469,106 +9757,109 @@ NodeHeartbeatResponse::mutable_delete_replicas() {
 // ===================================================================
 
 #if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int AskSplitRequest::kHeaderFieldNumber;
-const int AskSplitRequest::kRangeFieldNumber;
-const int AskSplitRequest::kSplitKeyFieldNumber;
+const int ReportSplitRequest::kHeaderFieldNumber;
+const int ReportSplitRequest::kLeftFieldNumber;
+const int ReportSplitRequest::kRightFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
-AskSplitRequest::AskSplitRequest()
+ReportSplitRequest::ReportSplitRequest()
   : ::google::protobuf::Message(), _internal_metadata_(NULL) {
   if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
     protobuf_mspb_2eproto::InitDefaults();
   }
   SharedCtor();
-  // @@protoc_insertion_point(constructor:mspb.AskSplitRequest)
+  // @@protoc_insertion_point(constructor:mspb.ReportSplitRequest)
 }
-AskSplitRequest::AskSplitRequest(const AskSplitRequest& from)
+ReportSplitRequest::ReportSplitRequest(const ReportSplitRequest& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
       _cached_size_(0) {
   _internal_metadata_.MergeFrom(from._internal_metadata_);
-  split_key_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.split_key().size() > 0) {
-    split_key_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.split_key_);
-  }
   if (from.has_header()) {
     header_ = new ::mspb::RequestHeader(*from.header_);
   } else {
     header_ = NULL;
   }
-  if (from.has_range()) {
-    range_ = new ::metapb::Range(*from.range_);
+  if (from.has_left()) {
+    left_ = new ::metapb::Range(*from.left_);
   } else {
-    range_ = NULL;
+    left_ = NULL;
   }
-  // @@protoc_insertion_point(copy_constructor:mspb.AskSplitRequest)
+  if (from.has_right()) {
+    right_ = new ::metapb::Range(*from.right_);
+  } else {
+    right_ = NULL;
+  }
+  // @@protoc_insertion_point(copy_constructor:mspb.ReportSplitRequest)
 }
 
-void AskSplitRequest::SharedCtor() {
-  split_key_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+void ReportSplitRequest::SharedCtor() {
   ::memset(&header_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&range_) -
-      reinterpret_cast<char*>(&header_)) + sizeof(range_));
+      reinterpret_cast<char*>(&right_) -
+      reinterpret_cast<char*>(&header_)) + sizeof(right_));
   _cached_size_ = 0;
 }
 
-AskSplitRequest::~AskSplitRequest() {
-  // @@protoc_insertion_point(destructor:mspb.AskSplitRequest)
+ReportSplitRequest::~ReportSplitRequest() {
+  // @@protoc_insertion_point(destructor:mspb.ReportSplitRequest)
   SharedDtor();
 }
 
-void AskSplitRequest::SharedDtor() {
-  split_key_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+void ReportSplitRequest::SharedDtor() {
   if (this != internal_default_instance()) delete header_;
-  if (this != internal_default_instance()) delete range_;
+  if (this != internal_default_instance()) delete left_;
+  if (this != internal_default_instance()) delete right_;
 }
 
-void AskSplitRequest::SetCachedSize(int size) const {
+void ReportSplitRequest::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* AskSplitRequest::descriptor() {
+const ::google::protobuf::Descriptor* ReportSplitRequest::descriptor() {
   protobuf_mspb_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_mspb_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
 }
 
-const AskSplitRequest& AskSplitRequest::default_instance() {
+const ReportSplitRequest& ReportSplitRequest::default_instance() {
   protobuf_mspb_2eproto::InitDefaults();
   return *internal_default_instance();
 }
 
-AskSplitRequest* AskSplitRequest::New(::google::protobuf::Arena* arena) const {
-  AskSplitRequest* n = new AskSplitRequest;
+ReportSplitRequest* ReportSplitRequest::New(::google::protobuf::Arena* arena) const {
+  ReportSplitRequest* n = new ReportSplitRequest;
   if (arena != NULL) {
     arena->Own(n);
   }
   return n;
 }
 
-void AskSplitRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:mspb.AskSplitRequest)
+void ReportSplitRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:mspb.ReportSplitRequest)
   ::google::protobuf::uint32 cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  split_key_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   if (GetArenaNoVirtual() == NULL && header_ != NULL) {
     delete header_;
   }
   header_ = NULL;
-  if (GetArenaNoVirtual() == NULL && range_ != NULL) {
-    delete range_;
+  if (GetArenaNoVirtual() == NULL && left_ != NULL) {
+    delete left_;
   }
-  range_ = NULL;
+  left_ = NULL;
+  if (GetArenaNoVirtual() == NULL && right_ != NULL) {
+    delete right_;
+  }
+  right_ = NULL;
   _internal_metadata_.Clear();
 }
 
-bool AskSplitRequest::MergePartialFromCodedStream(
+bool ReportSplitRequest::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:mspb.AskSplitRequest)
+  // @@protoc_insertion_point(parse_start:mspb.ReportSplitRequest)
   for (;;) {
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
     tag = p.first;
@@ -6586,24 +9877,24 @@ bool AskSplitRequest::MergePartialFromCodedStream(
         break;
       }
 
-      // .metapb.Range range = 2;
+      // .metapb.Range left = 2;
       case 2: {
         if (static_cast< ::google::protobuf::uint8>(tag) ==
             static_cast< ::google::protobuf::uint8>(18u /* 18 & 0xFF */)) {
           DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_range()));
+               input, mutable_left()));
         } else {
           goto handle_unusual;
         }
         break;
       }
 
-      // bytes split_key = 3;
+      // .metapb.Range right = 3;
       case 3: {
         if (static_cast< ::google::protobuf::uint8>(tag) ==
             static_cast< ::google::protobuf::uint8>(26u /* 26 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
-                input, this->mutable_split_key()));
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_right()));
         } else {
           goto handle_unusual;
         }
@@ -6622,17 +9913,17 @@ bool AskSplitRequest::MergePartialFromCodedStream(
     }
   }
 success:
-  // @@protoc_insertion_point(parse_success:mspb.AskSplitRequest)
+  // @@protoc_insertion_point(parse_success:mspb.ReportSplitRequest)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:mspb.AskSplitRequest)
+  // @@protoc_insertion_point(parse_failure:mspb.ReportSplitRequest)
   return false;
 #undef DO_
 }
 
-void AskSplitRequest::SerializeWithCachedSizes(
+void ReportSplitRequest::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:mspb.AskSplitRequest)
+  // @@protoc_insertion_point(serialize_start:mspb.ReportSplitRequest)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
@@ -6642,29 +9933,29 @@ void AskSplitRequest::SerializeWithCachedSizes(
       1, *this->header_, output);
   }
 
-  // .metapb.Range range = 2;
-  if (this->has_range()) {
+  // .metapb.Range left = 2;
+  if (this->has_left()) {
     ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      2, *this->range_, output);
+      2, *this->left_, output);
   }
 
-  // bytes split_key = 3;
-  if (this->split_key().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteBytesMaybeAliased(
-      3, this->split_key(), output);
+  // .metapb.Range right = 3;
+  if (this->has_right()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      3, *this->right_, output);
   }
 
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
     ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
   }
-  // @@protoc_insertion_point(serialize_end:mspb.AskSplitRequest)
+  // @@protoc_insertion_point(serialize_end:mspb.ReportSplitRequest)
 }
 
-::google::protobuf::uint8* AskSplitRequest::InternalSerializeWithCachedSizesToArray(
+::google::protobuf::uint8* ReportSplitRequest::InternalSerializeWithCachedSizesToArray(
     bool deterministic, ::google::protobuf::uint8* target) const {
   (void)deterministic; // Unused
-  // @@protoc_insertion_point(serialize_to_array_start:mspb.AskSplitRequest)
+  // @@protoc_insertion_point(serialize_to_array_start:mspb.ReportSplitRequest)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
@@ -6675,30 +9966,30 @@ void AskSplitRequest::SerializeWithCachedSizes(
         1, *this->header_, deterministic, target);
   }
 
-  // .metapb.Range range = 2;
-  if (this->has_range()) {
+  // .metapb.Range left = 2;
+  if (this->has_left()) {
     target = ::google::protobuf::internal::WireFormatLite::
       InternalWriteMessageNoVirtualToArray(
-        2, *this->range_, deterministic, target);
+        2, *this->left_, deterministic, target);
   }
 
-  // bytes split_key = 3;
-  if (this->split_key().size() > 0) {
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteBytesToArray(
-        3, this->split_key(), target);
+  // .metapb.Range right = 3;
+  if (this->has_right()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      InternalWriteMessageNoVirtualToArray(
+        3, *this->right_, deterministic, target);
   }
 
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
     target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:mspb.AskSplitRequest)
+  // @@protoc_insertion_point(serialize_to_array_end:mspb.ReportSplitRequest)
   return target;
 }
 
-size_t AskSplitRequest::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:mspb.AskSplitRequest)
+size_t ReportSplitRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mspb.ReportSplitRequest)
   size_t total_size = 0;
 
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
@@ -6706,13 +9997,6 @@ size_t AskSplitRequest::ByteSizeLong() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
   }
-  // bytes split_key = 3;
-  if (this->split_key().size() > 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::BytesSize(
-        this->split_key());
-  }
-
   // .mspb.RequestHeader header = 1;
   if (this->has_header()) {
     total_size += 1 +
@@ -6720,11 +10004,18 @@ size_t AskSplitRequest::ByteSizeLong() const {
         *this->header_);
   }
 
-  // .metapb.Range range = 2;
-  if (this->has_range()) {
+  // .metapb.Range left = 2;
+  if (this->has_left()) {
     total_size += 1 +
       ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-        *this->range_);
+        *this->left_);
+  }
+
+  // .metapb.Range right = 3;
+  if (this->has_right()) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+        *this->right_);
   }
 
   int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
@@ -6734,109 +10025,108 @@ size_t AskSplitRequest::ByteSizeLong() const {
   return total_size;
 }
 
-void AskSplitRequest::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:mspb.AskSplitRequest)
+void ReportSplitRequest::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:mspb.ReportSplitRequest)
   GOOGLE_DCHECK_NE(&from, this);
-  const AskSplitRequest* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const AskSplitRequest>(
+  const ReportSplitRequest* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const ReportSplitRequest>(
           &from);
   if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:mspb.AskSplitRequest)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:mspb.ReportSplitRequest)
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:mspb.AskSplitRequest)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:mspb.ReportSplitRequest)
     MergeFrom(*source);
   }
 }
 
-void AskSplitRequest::MergeFrom(const AskSplitRequest& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:mspb.AskSplitRequest)
+void ReportSplitRequest::MergeFrom(const ReportSplitRequest& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:mspb.ReportSplitRequest)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.split_key().size() > 0) {
-
-    split_key_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.split_key_);
-  }
   if (from.has_header()) {
     mutable_header()->::mspb::RequestHeader::MergeFrom(from.header());
   }
-  if (from.has_range()) {
-    mutable_range()->::metapb::Range::MergeFrom(from.range());
+  if (from.has_left()) {
+    mutable_left()->::metapb::Range::MergeFrom(from.left());
+  }
+  if (from.has_right()) {
+    mutable_right()->::metapb::Range::MergeFrom(from.right());
   }
 }
 
-void AskSplitRequest::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:mspb.AskSplitRequest)
+void ReportSplitRequest::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:mspb.ReportSplitRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void AskSplitRequest::CopyFrom(const AskSplitRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:mspb.AskSplitRequest)
+void ReportSplitRequest::CopyFrom(const ReportSplitRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mspb.ReportSplitRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool AskSplitRequest::IsInitialized() const {
+bool ReportSplitRequest::IsInitialized() const {
   return true;
 }
 
-void AskSplitRequest::Swap(AskSplitRequest* other) {
+void ReportSplitRequest::Swap(ReportSplitRequest* other) {
   if (other == this) return;
   InternalSwap(other);
 }
-void AskSplitRequest::InternalSwap(AskSplitRequest* other) {
+void ReportSplitRequest::InternalSwap(ReportSplitRequest* other) {
   using std::swap;
-  split_key_.Swap(&other->split_key_);
   swap(header_, other->header_);
-  swap(range_, other->range_);
+  swap(left_, other->left_);
+  swap(right_, other->right_);
   _internal_metadata_.Swap(&other->_internal_metadata_);
   swap(_cached_size_, other->_cached_size_);
 }
 
-::google::protobuf::Metadata AskSplitRequest::GetMetadata() const {
+::google::protobuf::Metadata ReportSplitRequest::GetMetadata() const {
   protobuf_mspb_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_mspb_2eproto::file_level_metadata[kIndexInFileMessages];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
-// AskSplitRequest
+// ReportSplitRequest
 
 // .mspb.RequestHeader header = 1;
-bool AskSplitRequest::has_header() const {
+bool ReportSplitRequest::has_header() const {
   return this != internal_default_instance() && header_ != NULL;
 }
-void AskSplitRequest::clear_header() {
+void ReportSplitRequest::clear_header() {
   if (GetArenaNoVirtual() == NULL && header_ != NULL) delete header_;
   header_ = NULL;
 }
-const ::mspb::RequestHeader& AskSplitRequest::header() const {
+const ::mspb::RequestHeader& ReportSplitRequest::header() const {
   const ::mspb::RequestHeader* p = header_;
-  // @@protoc_insertion_point(field_get:mspb.AskSplitRequest.header)
+  // @@protoc_insertion_point(field_get:mspb.ReportSplitRequest.header)
   return p != NULL ? *p : *reinterpret_cast<const ::mspb::RequestHeader*>(
       &::mspb::_RequestHeader_default_instance_);
 }
-::mspb::RequestHeader* AskSplitRequest::mutable_header() {
+::mspb::RequestHeader* ReportSplitRequest::mutable_header() {
   
   if (header_ == NULL) {
     header_ = new ::mspb::RequestHeader;
   }
-  // @@protoc_insertion_point(field_mutable:mspb.AskSplitRequest.header)
+  // @@protoc_insertion_point(field_mutable:mspb.ReportSplitRequest.header)
   return header_;
 }
-::mspb::RequestHeader* AskSplitRequest::release_header() {
-  // @@protoc_insertion_point(field_release:mspb.AskSplitRequest.header)
+::mspb::RequestHeader* ReportSplitRequest::release_header() {
+  // @@protoc_insertion_point(field_release:mspb.ReportSplitRequest.header)
   
   ::mspb::RequestHeader* temp = header_;
   header_ = NULL;
   return temp;
 }
-void AskSplitRequest::set_allocated_header(::mspb::RequestHeader* header) {
+void ReportSplitRequest::set_allocated_header(::mspb::RequestHeader* header) {
   delete header_;
   header_ = header;
   if (header) {
@@ -6844,100 +10134,87 @@ void AskSplitRequest::set_allocated_header(::mspb::RequestHeader* header) {
   } else {
     
   }
-  // @@protoc_insertion_point(field_set_allocated:mspb.AskSplitRequest.header)
+  // @@protoc_insertion_point(field_set_allocated:mspb.ReportSplitRequest.header)
 }
 
-// .metapb.Range range = 2;
-bool AskSplitRequest::has_range() const {
-  return this != internal_default_instance() && range_ != NULL;
+// .metapb.Range left = 2;
+bool ReportSplitRequest::has_left() const {
+  return this != internal_default_instance() && left_ != NULL;
 }
-void AskSplitRequest::clear_range() {
-  if (GetArenaNoVirtual() == NULL && range_ != NULL) delete range_;
-  range_ = NULL;
+void ReportSplitRequest::clear_left() {
+  if (GetArenaNoVirtual() == NULL && left_ != NULL) delete left_;
+  left_ = NULL;
 }
-const ::metapb::Range& AskSplitRequest::range() const {
-  const ::metapb::Range* p = range_;
-  // @@protoc_insertion_point(field_get:mspb.AskSplitRequest.range)
+const ::metapb::Range& ReportSplitRequest::left() const {
+  const ::metapb::Range* p = left_;
+  // @@protoc_insertion_point(field_get:mspb.ReportSplitRequest.left)
   return p != NULL ? *p : *reinterpret_cast<const ::metapb::Range*>(
       &::metapb::_Range_default_instance_);
 }
-::metapb::Range* AskSplitRequest::mutable_range() {
+::metapb::Range* ReportSplitRequest::mutable_left() {
   
-  if (range_ == NULL) {
-    range_ = new ::metapb::Range;
+  if (left_ == NULL) {
+    left_ = new ::metapb::Range;
   }
-  // @@protoc_insertion_point(field_mutable:mspb.AskSplitRequest.range)
-  return range_;
+  // @@protoc_insertion_point(field_mutable:mspb.ReportSplitRequest.left)
+  return left_;
 }
-::metapb::Range* AskSplitRequest::release_range() {
-  // @@protoc_insertion_point(field_release:mspb.AskSplitRequest.range)
+::metapb::Range* ReportSplitRequest::release_left() {
+  // @@protoc_insertion_point(field_release:mspb.ReportSplitRequest.left)
   
-  ::metapb::Range* temp = range_;
-  range_ = NULL;
+  ::metapb::Range* temp = left_;
+  left_ = NULL;
   return temp;
 }
-void AskSplitRequest::set_allocated_range(::metapb::Range* range) {
-  delete range_;
-  range_ = range;
-  if (range) {
+void ReportSplitRequest::set_allocated_left(::metapb::Range* left) {
+  delete left_;
+  left_ = left;
+  if (left) {
     
   } else {
     
   }
-  // @@protoc_insertion_point(field_set_allocated:mspb.AskSplitRequest.range)
+  // @@protoc_insertion_point(field_set_allocated:mspb.ReportSplitRequest.left)
 }
 
-// bytes split_key = 3;
-void AskSplitRequest::clear_split_key() {
-  split_key_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-const ::std::string& AskSplitRequest::split_key() const {
-  // @@protoc_insertion_point(field_get:mspb.AskSplitRequest.split_key)
-  return split_key_.GetNoArena();
-}
-void AskSplitRequest::set_split_key(const ::std::string& value) {
-  
-  split_key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:mspb.AskSplitRequest.split_key)
-}
-#if LANG_CXX11
-void AskSplitRequest::set_split_key(::std::string&& value) {
-  
-  split_key_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:mspb.AskSplitRequest.split_key)
-}
-#endif
-void AskSplitRequest::set_split_key(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  split_key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:mspb.AskSplitRequest.split_key)
+// .metapb.Range right = 3;
+bool ReportSplitRequest::has_right() const {
+  return this != internal_default_instance() && right_ != NULL;
 }
-void AskSplitRequest::set_split_key(const void* value, size_t size) {
-  
-  split_key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:mspb.AskSplitRequest.split_key)
+void ReportSplitRequest::clear_right() {
+  if (GetArenaNoVirtual() == NULL && right_ != NULL) delete right_;
+  right_ = NULL;
 }
-::std::string* AskSplitRequest::mutable_split_key() {
+const ::metapb::Range& ReportSplitRequest::right() const {
+  const ::metapb::Range* p = right_;
+  // @@protoc_insertion_point(field_get:mspb.ReportSplitRequest.right)
+  return p != NULL ? *p : *reinterpret_cast<const ::metapb::Range*>(
+      &::metapb::_Range_default_instance_);
+}
+::metapb::Range* ReportSplitRequest::mutable_right() {
   
-  // @@protoc_insertion_point(field_mutable:mspb.AskSplitRequest.split_key)
-  return split_key_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (right_ == NULL) {
+    right_ = new ::metapb::Range;
+  }
+  // @@protoc_insertion_point(field_mutable:mspb.ReportSplitRequest.right)
+  return right_;
 }
-::std::string* AskSplitRequest::release_split_key() {
-  // @@protoc_insertion_point(field_release:mspb.AskSplitRequest.split_key)
+::metapb::Range* ReportSplitRequest::release_right() {
+  // @@protoc_insertion_point(field_release:mspb.ReportSplitRequest.right)
   
-  return split_key_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::metapb::Range* temp = right_;
+  right_ = NULL;
+  return temp;
 }
-void AskSplitRequest::set_allocated_split_key(::std::string* split_key) {
-  if (split_key != NULL) {
+void ReportSplitRequest::set_allocated_right(::metapb::Range* right) {
+  delete right_;
+  right_ = right;
+  if (right) {
     
   } else {
     
   }
-  split_key_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), split_key);
-  // @@protoc_insertion_point(field_set_allocated:mspb.AskSplitRequest.split_key)
+  // @@protoc_insertion_point(field_set_allocated:mspb.ReportSplitRequest.right)
 }
 
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -6945,112 +10222,85 @@ void AskSplitRequest::set_allocated_split_key(::std::string* split_key) {
 // ===================================================================
 
 #if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int AskSplitResponse::kHeaderFieldNumber;
-const int AskSplitResponse::kRangeFieldNumber;
-const int AskSplitResponse::kNewRangeIdFieldNumber;
-const int AskSplitResponse::kNewPeerIdsFieldNumber;
-const int AskSplitResponse::kSplitKeyFieldNumber;
+const int ReportSplitResponse::kHeaderFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
-AskSplitResponse::AskSplitResponse()
+ReportSplitResponse::ReportSplitResponse()
   : ::google::protobuf::Message(), _internal_metadata_(NULL) {
   if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
     protobuf_mspb_2eproto::InitDefaults();
   }
   SharedCtor();
-  // @@protoc_insertion_point(constructor:mspb.AskSplitResponse)
+  // @@protoc_insertion_point(constructor:mspb.ReportSplitResponse)
 }
-AskSplitResponse::AskSplitResponse(const AskSplitResponse& from)
+ReportSplitResponse::ReportSplitResponse(const ReportSplitResponse& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
-      new_peer_ids_(from.new_peer_ids_),
       _cached_size_(0) {
   _internal_metadata_.MergeFrom(from._internal_metadata_);
-  split_key_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.split_key().size() > 0) {
-    split_key_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.split_key_);
-  }
   if (from.has_header()) {
     header_ = new ::mspb::ResponseHeader(*from.header_);
   } else {
     header_ = NULL;
   }
-  if (from.has_range()) {
-    range_ = new ::metapb::Range(*from.range_);
-  } else {
-    range_ = NULL;
-  }
-  new_range_id_ = from.new_range_id_;
-  // @@protoc_insertion_point(copy_constructor:mspb.AskSplitResponse)
+  // @@protoc_insertion_point(copy_constructor:mspb.ReportSplitResponse)
 }
 
-void AskSplitResponse::SharedCtor() {
-  split_key_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  ::memset(&header_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&new_range_id_) -
-      reinterpret_cast<char*>(&header_)) + sizeof(new_range_id_));
+void ReportSplitResponse::SharedCtor() {
+  header_ = NULL;
   _cached_size_ = 0;
 }
 
-AskSplitResponse::~AskSplitResponse() {
-  // @@protoc_insertion_point(destructor:mspb.AskSplitResponse)
+ReportSplitResponse::~ReportSplitResponse() {
+  // @@protoc_insertion_point(destructor:mspb.ReportSplitResponse)
   SharedDtor();
 }
 
-void AskSplitResponse::SharedDtor() {
-  split_key_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+void ReportSplitResponse::SharedDtor() {
   if (this != internal_default_instance()) delete header_;
-  if (this != internal_default_instance()) delete range_;
 }
 
-void AskSplitResponse::SetCachedSize(int size) const {
+void ReportSplitResponse::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* AskSplitResponse::descriptor() {
+const ::google::protobuf::Descriptor* ReportSplitResponse::descriptor() {
   protobuf_mspb_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_mspb_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
 }
 
-const AskSplitResponse& AskSplitResponse::default_instance() {
+const ReportSplitResponse& ReportSplitResponse::default_instance() {
   protobuf_mspb_2eproto::InitDefaults();
   return *internal_default_instance();
 }
 
-AskSplitResponse* AskSplitResponse::New(::google::protobuf::Arena* arena) const {
-  AskSplitResponse* n = new AskSplitResponse;
+ReportSplitResponse* ReportSplitResponse::New(::google::protobuf::Arena* arena) const {
+  ReportSplitResponse* n = new ReportSplitResponse;
   if (arena != NULL) {
     arena->Own(n);
   }
   return n;
 }
 
-void AskSplitResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:mspb.AskSplitResponse)
+void ReportSplitResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:mspb.ReportSplitResponse)
   ::google::protobuf::uint32 cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  new_peer_ids_.Clear();
-  split_key_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   if (GetArenaNoVirtual() == NULL && header_ != NULL) {
     delete header_;
   }
   header_ = NULL;
-  if (GetArenaNoVirtual() == NULL && range_ != NULL) {
-    delete range_;
-  }
-  range_ = NULL;
-  new_range_id_ = GOOGLE_ULONGLONG(0);
   _internal_metadata_.Clear();
 }
 
-bool AskSplitResponse::MergePartialFromCodedStream(
+bool ReportSplitResponse::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:mspb.AskSplitResponse)
+  // @@protoc_insertion_point(parse_start:mspb.ReportSplitResponse)
   for (;;) {
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
     tag = p.first;
@@ -7068,63 +10318,6 @@ bool AskSplitResponse::MergePartialFromCodedStream(
         break;
       }
 
-      // .metapb.Range range = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(18u /* 18 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_range()));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // uint64 new_range_id = 3;
-      case 3: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(24u /* 24 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
-                 input, &new_range_id_)));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // repeated uint64 new_peer_ids = 4;
-      case 4: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(34u /* 34 & 0xFF */)) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPackedPrimitive<
-                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
-                 input, this->mutable_new_peer_ids())));
-        } else if (
-            static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(32u /* 32 & 0xFF */)) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadRepeatedPrimitiveNoInline<
-                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
-                 1, 34u, input, this->mutable_new_peer_ids())));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // bytes split_key = 5;
-      case 5: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(42u /* 42 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
-                input, this->mutable_split_key()));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
       default: {
       handle_unusual:
         if (tag == 0) {
@@ -7137,17 +10330,17 @@ bool AskSplitResponse::MergePartialFromCodedStream(
     }
   }
 success:
-  // @@protoc_insertion_point(parse_success:mspb.AskSplitResponse)
+  // @@protoc_insertion_point(parse_success:mspb.ReportSplitResponse)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:mspb.AskSplitResponse)
+  // @@protoc_insertion_point(parse_failure:mspb.ReportSplitResponse)
   return false;
 #undef DO_
 }
 
-void AskSplitResponse::SerializeWithCachedSizes(
+void ReportSplitResponse::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:mspb.AskSplitResponse)
+  // @@protoc_insertion_point(serialize_start:mspb.ReportSplitResponse)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
@@ -7157,45 +10350,17 @@ void AskSplitResponse::SerializeWithCachedSizes(
       1, *this->header_, output);
   }
 
-  // .metapb.Range range = 2;
-  if (this->has_range()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      2, *this->range_, output);
-  }
-
-  // uint64 new_range_id = 3;
-  if (this->new_range_id() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt64(3, this->new_range_id(), output);
-  }
-
-  // repeated uint64 new_peer_ids = 4;
-  if (this->new_peer_ids_size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteTag(4, ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
-    output->WriteVarint32(static_cast< ::google::protobuf::uint32>(
-        _new_peer_ids_cached_byte_size_));
-  }
-  for (int i = 0, n = this->new_peer_ids_size(); i < n; i++) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt64NoTag(
-      this->new_peer_ids(i), output);
-  }
-
-  // bytes split_key = 5;
-  if (this->split_key().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteBytesMaybeAliased(
-      5, this->split_key(), output);
-  }
-
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
     ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
   }
-  // @@protoc_insertion_point(serialize_end:mspb.AskSplitResponse)
+  // @@protoc_insertion_point(serialize_end:mspb.ReportSplitResponse)
 }
 
-::google::protobuf::uint8* AskSplitResponse::InternalSerializeWithCachedSizesToArray(
+::google::protobuf::uint8* ReportSplitResponse::InternalSerializeWithCachedSizesToArray(
     bool deterministic, ::google::protobuf::uint8* target) const {
   (void)deterministic; // Unused
-  // @@protoc_insertion_point(serialize_to_array_start:mspb.AskSplitResponse)
+  // @@protoc_insertion_point(serialize_to_array_start:mspb.ReportSplitResponse)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
@@ -7206,78 +10371,23 @@ void AskSplitResponse::SerializeWithCachedSizes(
         1, *this->header_, deterministic, target);
   }
 
-  // .metapb.Range range = 2;
-  if (this->has_range()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageNoVirtualToArray(
-        2, *this->range_, deterministic, target);
-  }
-
-  // uint64 new_range_id = 3;
-  if (this->new_range_id() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(3, this->new_range_id(), target);
-  }
-
-  // repeated uint64 new_peer_ids = 4;
-  if (this->new_peer_ids_size() > 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteTagToArray(
-      4,
-      ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
-      target);
-    target = ::google::protobuf::io::CodedOutputStream::WriteVarint32ToArray(
-        static_cast< ::google::protobuf::uint32>(
-            _new_peer_ids_cached_byte_size_), target);
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteUInt64NoTagToArray(this->new_peer_ids_, target);
-  }
-
-  // bytes split_key = 5;
-  if (this->split_key().size() > 0) {
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteBytesToArray(
-        5, this->split_key(), target);
-  }
-
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
     target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:mspb.AskSplitResponse)
+  // @@protoc_insertion_point(serialize_to_array_end:mspb.ReportSplitResponse)
   return target;
 }
 
-size_t AskSplitResponse::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:mspb.AskSplitResponse)
+size_t ReportSplitResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mspb.ReportSplitResponse)
   size_t total_size = 0;
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
-  }
-  // repeated uint64 new_peer_ids = 4;
-  {
-    size_t data_size = ::google::protobuf::internal::WireFormatLite::
-      UInt64Size(this->new_peer_ids_);
-    if (data_size > 0) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int32Size(
-            static_cast< ::google::protobuf::int32>(data_size));
-    }
-    int cached_size = ::google::protobuf::internal::ToCachedSize(data_size);
-    GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-    _new_peer_ids_cached_byte_size_ = cached_size;
-    GOOGLE_SAFE_CONCURRENT_WRITES_END();
-    total_size += data_size;
-  }
-
-  // bytes split_key = 5;
-  if (this->split_key().size() > 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::BytesSize(
-        this->split_key());
+  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
   }
-
   // .mspb.ResponseHeader header = 1;
   if (this->has_header()) {
     total_size += 1 +
@@ -7285,20 +10395,6 @@ size_t AskSplitResponse::ByteSizeLong() const {
         *this->header_);
   }
 
-  // .metapb.Range range = 2;
-  if (this->has_range()) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-        *this->range_);
-  }
-
-  // uint64 new_range_id = 3;
-  if (this->new_range_id() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt64Size(
-        this->new_range_id());
-  }
-
   int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = cached_size;
@@ -7306,115 +10402,100 @@ size_t AskSplitResponse::ByteSizeLong() const {
   return total_size;
 }
 
-void AskSplitResponse::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:mspb.AskSplitResponse)
+void ReportSplitResponse::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:mspb.ReportSplitResponse)
   GOOGLE_DCHECK_NE(&from, this);
-  const AskSplitResponse* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const AskSplitResponse>(
+  const ReportSplitResponse* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const ReportSplitResponse>(
           &from);
   if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:mspb.AskSplitResponse)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:mspb.ReportSplitResponse)
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:mspb.AskSplitResponse)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:mspb.ReportSplitResponse)
     MergeFrom(*source);
   }
 }
 
-void AskSplitResponse::MergeFrom(const AskSplitResponse& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:mspb.AskSplitResponse)
+void ReportSplitResponse::MergeFrom(const ReportSplitResponse& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:mspb.ReportSplitResponse)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  new_peer_ids_.MergeFrom(from.new_peer_ids_);
-  if (from.split_key().size() > 0) {
-
-    split_key_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.split_key_);
-  }
   if (from.has_header()) {
     mutable_header()->::mspb::ResponseHeader::MergeFrom(from.header());
   }
-  if (from.has_range()) {
-    mutable_range()->::metapb::Range::MergeFrom(from.range());
-  }
-  if (from.new_range_id() != 0) {
-    set_new_range_id(from.new_range_id());
-  }
 }
 
-void AskSplitResponse::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:mspb.AskSplitResponse)
+void ReportSplitResponse::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:mspb.ReportSplitResponse)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void AskSplitResponse::CopyFrom(const AskSplitResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:mspb.AskSplitResponse)
+void ReportSplitResponse::CopyFrom(const ReportSplitResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mspb.ReportSplitResponse)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool AskSplitResponse::IsInitialized() const {
+bool ReportSplitResponse::IsInitialized() const {
   return true;
 }
 
-void AskSplitResponse::Swap(AskSplitResponse* other) {
+void ReportSplitResponse::Swap(ReportSplitResponse* other) {
   if (other == this) return;
   InternalSwap(other);
 }
-void AskSplitResponse::InternalSwap(AskSplitResponse* other) {
+void ReportSplitResponse::InternalSwap(ReportSplitResponse* other) {
   using std::swap;
-  new_peer_ids_.InternalSwap(&other->new_peer_ids_);
-  split_key_.Swap(&other->split_key_);
   swap(header_, other->header_);
-  swap(range_, other->range_);
-  swap(new_range_id_, other->new_range_id_);
   _internal_metadata_.Swap(&other->_internal_metadata_);
   swap(_cached_size_, other->_cached_size_);
 }
 
-::google::protobuf::Metadata AskSplitResponse::GetMetadata() const {
+::google::protobuf::Metadata ReportSplitResponse::GetMetadata() const {
   protobuf_mspb_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_mspb_2eproto::file_level_metadata[kIndexInFileMessages];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
-// AskSplitResponse
+// ReportSplitResponse
 
 // .mspb.ResponseHeader header = 1;
-bool AskSplitResponse::has_header() const {
+bool ReportSplitResponse::has_header() const {
   return this != internal_default_instance() && header_ != NULL;
 }
-void AskSplitResponse::clear_header() {
+void ReportSplitResponse::clear_header() {
   if (GetArenaNoVirtual() == NULL && header_ != NULL) delete header_;
   header_ = NULL;
 }
-const ::mspb::ResponseHeader& AskSplitResponse::header() const {
+const ::mspb::ResponseHeader& ReportSplitResponse::header() const {
   const ::mspb::ResponseHeader* p = header_;
-  // @@protoc_insertion_point(field_get:mspb.AskSplitResponse.header)
+  // @@protoc_insertion_point(field_get:mspb.ReportSplitResponse.header)
   return p != NULL ? *p : *reinterpret_cast<const ::mspb::ResponseHeader*>(
       &::mspb::_ResponseHeader_default_instance_);
 }
-::mspb::ResponseHeader* AskSplitResponse::mutable_header() {
+::mspb::ResponseHeader* ReportSplitResponse::mutable_header() {
   
   if (header_ == NULL) {
     header_ = new ::mspb::ResponseHeader;
   }
-  // @@protoc_insertion_point(field_mutable:mspb.AskSplitResponse.header)
+  // @@protoc_insertion_point(field_mutable:mspb.ReportSplitResponse.header)
   return header_;
 }
-::mspb::ResponseHeader* AskSplitResponse::release_header() {
-  // @@protoc_insertion_point(field_release:mspb.AskSplitResponse.header)
+::mspb::ResponseHeader* ReportSplitResponse::release_header() {
+  // @@protoc_insertion_point(field_release:mspb.ReportSplitResponse.header)
   
   ::mspb::ResponseHeader* temp = header_;
   header_ = NULL;
   return temp;
 }
-void AskSplitResponse::set_allocated_header(::mspb::ResponseHeader* header) {
+void ReportSplitResponse::set_allocated_header(::mspb::ResponseHeader* header) {
   delete header_;
   header_ = header;
   if (header) {
@@ -7422,144 +10503,7 @@ void AskSplitResponse::set_allocated_header(::mspb::ResponseHeader* header) {
   } else {
     
   }
-  // @@protoc_insertion_point(field_set_allocated:mspb.AskSplitResponse.header)
-}
-
-// .metapb.Range range = 2;
-bool AskSplitResponse::has_range() const {
-  return this != internal_default_instance() && range_ != NULL;
-}
-void AskSplitResponse::clear_range() {
-  if (GetArenaNoVirtual() == NULL && range_ != NULL) delete range_;
-  range_ = NULL;
-}
-const ::metapb::Range& AskSplitResponse::range() const {
-  const ::metapb::Range* p = range_;
-  // @@protoc_insertion_point(field_get:mspb.AskSplitResponse.range)
-  return p != NULL ? *p : *reinterpret_cast<const ::metapb::Range*>(
-      &::metapb::_Range_default_instance_);
-}
-::metapb::Range* AskSplitResponse::mutable_range() {
-  
-  if (range_ == NULL) {
-    range_ = new ::metapb::Range;
-  }
-  // @@protoc_insertion_point(field_mutable:mspb.AskSplitResponse.range)
-  return range_;
-}
-::metapb::Range* AskSplitResponse::release_range() {
-  // @@protoc_insertion_point(field_release:mspb.AskSplitResponse.range)
-  
-  ::metapb::Range* temp = range_;
-  range_ = NULL;
-  return temp;
-}
-void AskSplitResponse::set_allocated_range(::metapb::Range* range) {
-  delete range_;
-  range_ = range;
-  if (range) {
-    
-  } else {
-    
-  }
-  // @@protoc_insertion_point(field_set_allocated:mspb.AskSplitResponse.range)
-}
-
-// uint64 new_range_id = 3;
-void AskSplitResponse::clear_new_range_id() {
-  new_range_id_ = GOOGLE_ULONGLONG(0);
-}
-::google::protobuf::uint64 AskSplitResponse::new_range_id() const {
-  // @@protoc_insertion_point(field_get:mspb.AskSplitResponse.new_range_id)
-  return new_range_id_;
-}
-void AskSplitResponse::set_new_range_id(::google::protobuf::uint64 value) {
-  
-  new_range_id_ = value;
-  // @@protoc_insertion_point(field_set:mspb.AskSplitResponse.new_range_id)
-}
-
-// repeated uint64 new_peer_ids = 4;
-int AskSplitResponse::new_peer_ids_size() const {
-  return new_peer_ids_.size();
-}
-void AskSplitResponse::clear_new_peer_ids() {
-  new_peer_ids_.Clear();
-}
-::google::protobuf::uint64 AskSplitResponse::new_peer_ids(int index) const {
-  // @@protoc_insertion_point(field_get:mspb.AskSplitResponse.new_peer_ids)
-  return new_peer_ids_.Get(index);
-}
-void AskSplitResponse::set_new_peer_ids(int index, ::google::protobuf::uint64 value) {
-  new_peer_ids_.Set(index, value);
-  // @@protoc_insertion_point(field_set:mspb.AskSplitResponse.new_peer_ids)
-}
-void AskSplitResponse::add_new_peer_ids(::google::protobuf::uint64 value) {
-  new_peer_ids_.Add(value);
-  // @@protoc_insertion_point(field_add:mspb.AskSplitResponse.new_peer_ids)
-}
-const ::google::protobuf::RepeatedField< ::google::protobuf::uint64 >&
-AskSplitResponse::new_peer_ids() const {
-  // @@protoc_insertion_point(field_list:mspb.AskSplitResponse.new_peer_ids)
-  return new_peer_ids_;
-}
-::google::protobuf::RepeatedField< ::google::protobuf::uint64 >*
-AskSplitResponse::mutable_new_peer_ids() {
-  // @@protoc_insertion_point(field_mutable_list:mspb.AskSplitResponse.new_peer_ids)
-  return &new_peer_ids_;
-}
-
-// bytes split_key = 5;
-void AskSplitResponse::clear_split_key() {
-  split_key_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-const ::std::string& AskSplitResponse::split_key() const {
-  // @@protoc_insertion_point(field_get:mspb.AskSplitResponse.split_key)
-  return split_key_.GetNoArena();
-}
-void AskSplitResponse::set_split_key(const ::std::string& value) {
-  
-  split_key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:mspb.AskSplitResponse.split_key)
-}
-#if LANG_CXX11
-void AskSplitResponse::set_split_key(::std::string&& value) {
-  
-  split_key_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:mspb.AskSplitResponse.split_key)
-}
-#endif
-void AskSplitResponse::set_split_key(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  split_key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:mspb.AskSplitResponse.split_key)
-}
-void AskSplitResponse::set_split_key(const void* value, size_t size) {
-  
-  split_key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:mspb.AskSplitResponse.split_key)
-}
-::std::string* AskSplitResponse::mutable_split_key() {
-  
-  // @@protoc_insertion_point(field_mutable:mspb.AskSplitResponse.split_key)
-  return split_key_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-::std::string* AskSplitResponse::release_split_key() {
-  // @@protoc_insertion_point(field_release:mspb.AskSplitResponse.split_key)
-  
-  return split_key_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-void AskSplitResponse::set_allocated_split_key(::std::string* split_key) {
-  if (split_key != NULL) {
-    
-  } else {
-    
-  }
-  split_key_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), split_key);
-  // @@protoc_insertion_point(field_set_allocated:mspb.AskSplitResponse.split_key)
+  // @@protoc_insertion_point(field_set_allocated:mspb.ReportSplitResponse.header)
 }
 
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -7567,20 +10511,19 @@ void AskSplitResponse::set_allocated_split_key(::std::string* split_key) {
 // ===================================================================
 
 #if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int ReportSplitRequest::kHeaderFieldNumber;
-const int ReportSplitRequest::kLeftFieldNumber;
-const int ReportSplitRequest::kRightFieldNumber;
+const int NodeLoginRequest::kHeaderFieldNumber;
+const int NodeLoginRequest::kNodeIdFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
-ReportSplitRequest::ReportSplitRequest()
+NodeLoginRequest::NodeLoginRequest()
   : ::google::protobuf::Message(), _internal_metadata_(NULL) {
   if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
     protobuf_mspb_2eproto::InitDefaults();
   }
   SharedCtor();
-  // @@protoc_insertion_point(constructor:mspb.ReportSplitRequest)
+  // @@protoc_insertion_point(constructor:mspb.NodeLoginRequest)
 }
-ReportSplitRequest::ReportSplitRequest(const ReportSplitRequest& from)
+NodeLoginRequest::NodeLoginRequest(const NodeLoginRequest& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
       _cached_size_(0) {
@@ -7590,62 +10533,51 @@ ReportSplitRequest::ReportSplitRequest(const ReportSplitRequest& from)
   } else {
     header_ = NULL;
   }
-  if (from.has_left()) {
-    left_ = new ::metapb::Range(*from.left_);
-  } else {
-    left_ = NULL;
-  }
-  if (from.has_right()) {
-    right_ = new ::metapb::Range(*from.right_);
-  } else {
-    right_ = NULL;
-  }
-  // @@protoc_insertion_point(copy_constructor:mspb.ReportSplitRequest)
+  node_id_ = from.node_id_;
+  // @@protoc_insertion_point(copy_constructor:mspb.NodeLoginRequest)
 }
 
-void ReportSplitRequest::SharedCtor() {
+void NodeLoginRequest::SharedCtor() {
   ::memset(&header_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&right_) -
-      reinterpret_cast<char*>(&header_)) + sizeof(right_));
+      reinterpret_cast<char*>(&node_id_) -
+      reinterpret_cast<char*>(&header_)) + sizeof(node_id_));
   _cached_size_ = 0;
 }
 
-ReportSplitRequest::~ReportSplitRequest() {
-  // @@protoc_insertion_point(destructor:mspb.ReportSplitRequest)
+NodeLoginRequest::~NodeLoginRequest() {
+  // @@protoc_insertion_point(destructor:mspb.NodeLoginRequest)
   SharedDtor();
 }
 
-void ReportSplitRequest::SharedDtor() {
+void NodeLoginRequest::SharedDtor() {
   if (this != internal_default_instance()) delete header_;
-  if (this != internal_default_instance()) delete left_;
-  if (this != internal_default_instance()) delete right_;
 }
 
-void ReportSplitRequest::SetCachedSize(int size) const {
+void NodeLoginRequest::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* ReportSplitRequest::descriptor() {
+const ::google::protobuf::Descriptor* NodeLoginRequest::descriptor() {
   protobuf_mspb_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_mspb_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
 }
 
-const ReportSplitRequest& ReportSplitRequest::default_instance() {
+const NodeLoginRequest& NodeLoginRequest::default_instance() {
   protobuf_mspb_2eproto::InitDefaults();
   return *internal_default_instance();
 }
 
-ReportSplitRequest* ReportSplitRequest::New(::google::protobuf::Arena* arena) const {
-  ReportSplitRequest* n = new ReportSplitRequest;
+NodeLoginRequest* NodeLoginRequest::New(::google::protobuf::Arena* arena) const {
+  NodeLoginRequest* n = new NodeLoginRequest;
   if (arena != NULL) {
     arena->Own(n);
   }
   return n;
 }
 
-void ReportSplitRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:mspb.ReportSplitRequest)
+void NodeLoginRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:mspb.NodeLoginRequest)
   ::google::protobuf::uint32 cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
@@ -7654,22 +10586,15 @@ void ReportSplitRequest::Clear() {
     delete header_;
   }
   header_ = NULL;
-  if (GetArenaNoVirtual() == NULL && left_ != NULL) {
-    delete left_;
-  }
-  left_ = NULL;
-  if (GetArenaNoVirtual() == NULL && right_ != NULL) {
-    delete right_;
-  }
-  right_ = NULL;
+  node_id_ = GOOGLE_ULONGLONG(0);
   _internal_metadata_.Clear();
 }
 
-bool ReportSplitRequest::MergePartialFromCodedStream(
+bool NodeLoginRequest::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:mspb.ReportSplitRequest)
+  // @@protoc_insertion_point(parse_start:mspb.NodeLoginRequest)
   for (;;) {
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
     tag = p.first;
@@ -7687,24 +10612,14 @@ bool ReportSplitRequest::MergePartialFromCodedStream(
         break;
       }
 
-      // .metapb.Range left = 2;
+      // uint64 node_id = 2;
       case 2: {
         if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(18u /* 18 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_left()));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
+            static_cast< ::google::protobuf::uint8>(16u /* 16 & 0xFF */)) {
 
-      // .metapb.Range right = 3;
-      case 3: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(26u /* 26 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_right()));
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &node_id_)));
         } else {
           goto handle_unusual;
         }
@@ -7723,17 +10638,17 @@ bool ReportSplitRequest::MergePartialFromCodedStream(
     }
   }
 success:
-  // @@protoc_insertion_point(parse_success:mspb.ReportSplitRequest)
+  // @@protoc_insertion_point(parse_success:mspb.NodeLoginRequest)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:mspb.ReportSplitRequest)
+  // @@protoc_insertion_point(parse_failure:mspb.NodeLoginRequest)
   return false;
 #undef DO_
 }
 
-void ReportSplitRequest::SerializeWithCachedSizes(
+void NodeLoginRequest::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:mspb.ReportSplitRequest)
+  // @@protoc_insertion_point(serialize_start:mspb.NodeLoginRequest)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
@@ -7743,29 +10658,22 @@ void ReportSplitRequest::SerializeWithCachedSizes(
       1, *this->header_, output);
   }
 
-  // .metapb.Range left = 2;
-  if (this->has_left()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      2, *this->left_, output);
-  }
-
-  // .metapb.Range right = 3;
-  if (this->has_right()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      3, *this->right_, output);
+  // uint64 node_id = 2;
+  if (this->node_id() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(2, this->node_id(), output);
   }
 
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
     ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
   }
-  // @@protoc_insertion_point(serialize_end:mspb.ReportSplitRequest)
+  // @@protoc_insertion_point(serialize_end:mspb.NodeLoginRequest)
 }
 
-::google::protobuf::uint8* ReportSplitRequest::InternalSerializeWithCachedSizesToArray(
+::google::protobuf::uint8* NodeLoginRequest::InternalSerializeWithCachedSizesToArray(
     bool deterministic, ::google::protobuf::uint8* target) const {
   (void)deterministic; // Unused
-  // @@protoc_insertion_point(serialize_to_array_start:mspb.ReportSplitRequest)
+  // @@protoc_insertion_point(serialize_to_array_start:mspb.NodeLoginRequest)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
@@ -7776,30 +10684,21 @@ void ReportSplitRequest::SerializeWithCachedSizes(
         1, *this->header_, deterministic, target);
   }
 
-  // .metapb.Range left = 2;
-  if (this->has_left()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageNoVirtualToArray(
-        2, *this->left_, deterministic, target);
-  }
-
-  // .metapb.Range right = 3;
-  if (this->has_right()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageNoVirtualToArray(
-        3, *this->right_, deterministic, target);
+  // uint64 node_id = 2;
+  if (this->node_id() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(2, this->node_id(), target);
   }
 
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
     target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:mspb.ReportSplitRequest)
+  // @@protoc_insertion_point(serialize_to_array_end:mspb.NodeLoginRequest)
   return target;
 }
 
-size_t ReportSplitRequest::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:mspb.ReportSplitRequest)
+size_t NodeLoginRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mspb.NodeLoginRequest)
   size_t total_size = 0;
 
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
@@ -7814,18 +10713,11 @@ size_t ReportSplitRequest::ByteSizeLong() const {
         *this->header_);
   }
 
-  // .metapb.Range left = 2;
-  if (this->has_left()) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-        *this->left_);
-  }
-
-  // .metapb.Range right = 3;
-  if (this->has_right()) {
+  // uint64 node_id = 2;
+  if (this->node_id() != 0) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-        *this->right_);
+      ::google::protobuf::internal::WireFormatLite::UInt64Size(
+        this->node_id());
   }
 
   int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
@@ -7835,23 +10727,23 @@ size_t ReportSplitRequest::ByteSizeLong() const {
   return total_size;
 }
 
-void ReportSplitRequest::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:mspb.ReportSplitRequest)
+void NodeLoginRequest::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:mspb.NodeLoginRequest)
   GOOGLE_DCHECK_NE(&from, this);
-  const ReportSplitRequest* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const ReportSplitRequest>(
+  const NodeLoginRequest* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const NodeLoginRequest>(
           &from);
   if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:mspb.ReportSplitRequest)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:mspb.NodeLoginRequest)
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:mspb.ReportSplitRequest)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:mspb.NodeLoginRequest)
     MergeFrom(*source);
   }
 }
 
-void ReportSplitRequest::MergeFrom(const ReportSplitRequest& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:mspb.ReportSplitRequest)
+void NodeLoginRequest::MergeFrom(const NodeLoginRequest& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:mspb.NodeLoginRequest)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   ::google::protobuf::uint32 cached_has_bits = 0;
@@ -7860,171 +10752,101 @@ void ReportSplitRequest::MergeFrom(const ReportSplitRequest& from) {
   if (from.has_header()) {
     mutable_header()->::mspb::RequestHeader::MergeFrom(from.header());
   }
-  if (from.has_left()) {
-    mutable_left()->::metapb::Range::MergeFrom(from.left());
-  }
-  if (from.has_right()) {
-    mutable_right()->::metapb::Range::MergeFrom(from.right());
+  if (from.node_id() != 0) {
+    set_node_id(from.node_id());
   }
 }
 
-void ReportSplitRequest::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:mspb.ReportSplitRequest)
+void NodeLoginRequest::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:mspb.NodeLoginRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void ReportSplitRequest::CopyFrom(const ReportSplitRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:mspb.ReportSplitRequest)
+void NodeLoginRequest::CopyFrom(const NodeLoginRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mspb.NodeLoginRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool ReportSplitRequest::IsInitialized() const {
+bool NodeLoginRequest::IsInitialized() const {
   return true;
 }
 
-void ReportSplitRequest::Swap(ReportSplitRequest* other) {
+void NodeLoginRequest::Swap(NodeLoginRequest* other) {
   if (other == this) return;
   InternalSwap(other);
 }
-void ReportSplitRequest::InternalSwap(ReportSplitRequest* other) {
+void NodeLoginRequest::InternalSwap(NodeLoginRequest* other) {
   using std::swap;
   swap(header_, other->header_);
-  swap(left_, other->left_);
-  swap(right_, other->right_);
+  swap(node_id_, other->node_id_);
   _internal_metadata_.Swap(&other->_internal_metadata_);
   swap(_cached_size_, other->_cached_size_);
 }
 
-::google::protobuf::Metadata ReportSplitRequest::GetMetadata() const {
+::google::protobuf::Metadata NodeLoginRequest::GetMetadata() const {
   protobuf_mspb_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_mspb_2eproto::file_level_metadata[kIndexInFileMessages];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
-// ReportSplitRequest
+// NodeLoginRequest
 
 // .mspb.RequestHeader header = 1;
-bool ReportSplitRequest::has_header() const {
+bool NodeLoginRequest::has_header() const {
   return this != internal_default_instance() && header_ != NULL;
 }
-void ReportSplitRequest::clear_header() {
+void NodeLoginRequest::clear_header() {
   if (GetArenaNoVirtual() == NULL && header_ != NULL) delete header_;
   header_ = NULL;
 }
-const ::mspb::RequestHeader& ReportSplitRequest::header() const {
-  const ::mspb::RequestHeader* p = header_;
-  // @@protoc_insertion_point(field_get:mspb.ReportSplitRequest.header)
-  return p != NULL ? *p : *reinterpret_cast<const ::mspb::RequestHeader*>(
-      &::mspb::_RequestHeader_default_instance_);
-}
-::mspb::RequestHeader* ReportSplitRequest::mutable_header() {
-  
-  if (header_ == NULL) {
-    header_ = new ::mspb::RequestHeader;
-  }
-  // @@protoc_insertion_point(field_mutable:mspb.ReportSplitRequest.header)
-  return header_;
-}
-::mspb::RequestHeader* ReportSplitRequest::release_header() {
-  // @@protoc_insertion_point(field_release:mspb.ReportSplitRequest.header)
-  
-  ::mspb::RequestHeader* temp = header_;
-  header_ = NULL;
-  return temp;
-}
-void ReportSplitRequest::set_allocated_header(::mspb::RequestHeader* header) {
-  delete header_;
-  header_ = header;
-  if (header) {
-    
-  } else {
-    
-  }
-  // @@protoc_insertion_point(field_set_allocated:mspb.ReportSplitRequest.header)
-}
-
-// .metapb.Range left = 2;
-bool ReportSplitRequest::has_left() const {
-  return this != internal_default_instance() && left_ != NULL;
-}
-void ReportSplitRequest::clear_left() {
-  if (GetArenaNoVirtual() == NULL && left_ != NULL) delete left_;
-  left_ = NULL;
-}
-const ::metapb::Range& ReportSplitRequest::left() const {
-  const ::metapb::Range* p = left_;
-  // @@protoc_insertion_point(field_get:mspb.ReportSplitRequest.left)
-  return p != NULL ? *p : *reinterpret_cast<const ::metapb::Range*>(
-      &::metapb::_Range_default_instance_);
-}
-::metapb::Range* ReportSplitRequest::mutable_left() {
-  
-  if (left_ == NULL) {
-    left_ = new ::metapb::Range;
-  }
-  // @@protoc_insertion_point(field_mutable:mspb.ReportSplitRequest.left)
-  return left_;
-}
-::metapb::Range* ReportSplitRequest::release_left() {
-  // @@protoc_insertion_point(field_release:mspb.ReportSplitRequest.left)
-  
-  ::metapb::Range* temp = left_;
-  left_ = NULL;
-  return temp;
-}
-void ReportSplitRequest::set_allocated_left(::metapb::Range* left) {
-  delete left_;
-  left_ = left;
-  if (left) {
-    
-  } else {
-    
-  }
-  // @@protoc_insertion_point(field_set_allocated:mspb.ReportSplitRequest.left)
-}
-
-// .metapb.Range right = 3;
-bool ReportSplitRequest::has_right() const {
-  return this != internal_default_instance() && right_ != NULL;
-}
-void ReportSplitRequest::clear_right() {
-  if (GetArenaNoVirtual() == NULL && right_ != NULL) delete right_;
-  right_ = NULL;
-}
-const ::metapb::Range& ReportSplitRequest::right() const {
-  const ::metapb::Range* p = right_;
-  // @@protoc_insertion_point(field_get:mspb.ReportSplitRequest.right)
-  return p != NULL ? *p : *reinterpret_cast<const ::metapb::Range*>(
-      &::metapb::_Range_default_instance_);
+const ::mspb::RequestHeader& NodeLoginRequest::header() const {
+  const ::mspb::RequestHeader* p = header_;
+  // @@protoc_insertion_point(field_get:mspb.NodeLoginRequest.header)
+  return p != NULL ? *p : *reinterpret_cast<const ::mspb::RequestHeader*>(
+      &::mspb::_RequestHeader_default_instance_);
 }
-::metapb::Range* ReportSplitRequest::mutable_right() {
+::mspb::RequestHeader* NodeLoginRequest::mutable_header() {
   
-  if (right_ == NULL) {
-    right_ = new ::metapb::Range;
+  if (header_ == NULL) {
+    header_ = new ::mspb::RequestHeader;
   }
-  // @@protoc_insertion_point(field_mutable:mspb.ReportSplitRequest.right)
-  return right_;
+  // @@protoc_insertion_point(field_mutable:mspb.NodeLoginRequest.header)
+  return header_;
 }
-::metapb::Range* ReportSplitRequest::release_right() {
-  // @@protoc_insertion_point(field_release:mspb.ReportSplitRequest.right)
+::mspb::RequestHeader* NodeLoginRequest::release_header() {
+  // @@protoc_insertion_point(field_release:mspb.NodeLoginRequest.header)
   
-  ::metapb::Range* temp = right_;
-  right_ = NULL;
+  ::mspb::RequestHeader* temp = header_;
+  header_ = NULL;
   return temp;
 }
-void ReportSplitRequest::set_allocated_right(::metapb::Range* right) {
-  delete right_;
-  right_ = right;
-  if (right) {
+void NodeLoginRequest::set_allocated_header(::mspb::RequestHeader* header) {
+  delete header_;
+  header_ = header;
+  if (header) {
     
   } else {
     
   }
-  // @@protoc_insertion_point(field_set_allocated:mspb.ReportSplitRequest.right)
+  // @@protoc_insertion_point(field_set_allocated:mspb.NodeLoginRequest.header)
+}
+
+// uint64 node_id = 2;
+void NodeLoginRequest::clear_node_id() {
+  node_id_ = GOOGLE_ULONGLONG(0);
+}
+::google::protobuf::uint64 NodeLoginRequest::node_id() const {
+  // @@protoc_insertion_point(field_get:mspb.NodeLoginRequest.node_id)
+  return node_id_;
+}
+void NodeLoginRequest::set_node_id(::google::protobuf::uint64 value) {
+  
+  node_id_ = value;
+  // @@protoc_insertion_point(field_set:mspb.NodeLoginRequest.node_id)
 }
 
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -8032,18 +10854,18 @@ void ReportSplitRequest::set_allocated_right(::metapb::Range* right) {
 // ===================================================================
 
 #if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int ReportSplitResponse::kHeaderFieldNumber;
+const int NodeLoginResponse::kHeaderFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
-ReportSplitResponse::ReportSplitResponse()
+NodeLoginResponse::NodeLoginResponse()
   : ::google::protobuf::Message(), _internal_metadata_(NULL) {
   if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
     protobuf_mspb_2eproto::InitDefaults();
   }
   SharedCtor();
-  // @@protoc_insertion_point(constructor:mspb.ReportSplitResponse)
+  // @@protoc_insertion_point(constructor:mspb.NodeLoginResponse)
 }
-ReportSplitResponse::ReportSplitResponse(const ReportSplitResponse& from)
+NodeLoginResponse::NodeLoginResponse(const NodeLoginResponse& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
       _cached_size_(0) {
@@ -8053,48 +10875,48 @@ ReportSplitResponse::ReportSplitResponse(const ReportSplitResponse& from)
   } else {
     header_ = NULL;
   }
-  // @@protoc_insertion_point(copy_constructor:mspb.ReportSplitResponse)
+  // @@protoc_insertion_point(copy_constructor:mspb.NodeLoginResponse)
 }
 
-void ReportSplitResponse::SharedCtor() {
+void NodeLoginResponse::SharedCtor() {
   header_ = NULL;
   _cached_size_ = 0;
 }
 
-ReportSplitResponse::~ReportSplitResponse() {
-  // @@protoc_insertion_point(destructor:mspb.ReportSplitResponse)
+NodeLoginResponse::~NodeLoginResponse() {
+  // @@protoc_insertion_point(destructor:mspb.NodeLoginResponse)
   SharedDtor();
 }
 
-void ReportSplitResponse::SharedDtor() {
+void NodeLoginResponse::SharedDtor() {
   if (this != internal_default_instance()) delete header_;
 }
 
-void ReportSplitResponse::SetCachedSize(int size) const {
+void NodeLoginResponse::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* ReportSplitResponse::descriptor() {
+const ::google::protobuf::Descriptor* NodeLoginResponse::descriptor() {
   protobuf_mspb_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_mspb_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
 }
 
-const ReportSplitResponse& ReportSplitResponse::default_instance() {
+const NodeLoginResponse& NodeLoginResponse::default_instance() {
   protobuf_mspb_2eproto::InitDefaults();
   return *internal_default_instance();
 }
 
-ReportSplitResponse* ReportSplitResponse::New(::google::protobuf::Arena* arena) const {
-  ReportSplitResponse* n = new ReportSplitResponse;
+NodeLoginResponse* NodeLoginResponse::New(::google::protobuf::Arena* arena) const {
+  NodeLoginResponse* n = new NodeLoginResponse;
   if (arena != NULL) {
     arena->Own(n);
   }
   return n;
 }
 
-void ReportSplitResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:mspb.ReportSplitResponse)
+void NodeLoginResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:mspb.NodeLoginResponse)
   ::google::protobuf::uint32 cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
@@ -8106,11 +10928,11 @@ void ReportSplitResponse::Clear() {
   _internal_metadata_.Clear();
 }
 
-bool ReportSplitResponse::MergePartialFromCodedStream(
+bool NodeLoginResponse::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:mspb.ReportSplitResponse)
+  // @@protoc_insertion_point(parse_start:mspb.NodeLoginResponse)
   for (;;) {
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
     tag = p.first;
@@ -8140,17 +10962,17 @@ bool ReportSplitResponse::MergePartialFromCodedStream(
     }
   }
 success:
-  // @@protoc_insertion_point(parse_success:mspb.ReportSplitResponse)
+  // @@protoc_insertion_point(parse_success:mspb.NodeLoginResponse)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:mspb.ReportSplitResponse)
+  // @@protoc_insertion_point(parse_failure:mspb.NodeLoginResponse)
   return false;
 #undef DO_
 }
 
-void ReportSplitResponse::SerializeWithCachedSizes(
+void NodeLoginResponse::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:mspb.ReportSplitResponse)
+  // @@protoc_insertion_point(serialize_start:mspb.NodeLoginResponse)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
@@ -8164,13 +10986,13 @@ void ReportSplitResponse::SerializeWithCachedSizes(
     ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
   }
-  // @@protoc_insertion_point(serialize_end:mspb.ReportSplitResponse)
+  // @@protoc_insertion_point(serialize_end:mspb.NodeLoginResponse)
 }
 
-::google::protobuf::uint8* ReportSplitResponse::InternalSerializeWithCachedSizesToArray(
+::google::protobuf::uint8* NodeLoginResponse::InternalSerializeWithCachedSizesToArray(
     bool deterministic, ::google::protobuf::uint8* target) const {
   (void)deterministic; // Unused
-  // @@protoc_insertion_point(serialize_to_array_start:mspb.ReportSplitResponse)
+  // @@protoc_insertion_point(serialize_to_array_start:mspb.NodeLoginResponse)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
@@ -8185,12 +11007,12 @@ void ReportSplitResponse::SerializeWithCachedSizes(
     target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:mspb.ReportSplitResponse)
+  // @@protoc_insertion_point(serialize_to_array_end:mspb.NodeLoginResponse)
   return target;
 }
 
-size_t ReportSplitResponse::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:mspb.ReportSplitResponse)
+size_t NodeLoginResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mspb.NodeLoginResponse)
   size_t total_size = 0;
 
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
@@ -8212,23 +11034,23 @@ size_t ReportSplitResponse::ByteSizeLong() const {
   return total_size;
 }
 
-void ReportSplitResponse::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:mspb.ReportSplitResponse)
+void NodeLoginResponse::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:mspb.NodeLoginResponse)
   GOOGLE_DCHECK_NE(&from, this);
-  const ReportSplitResponse* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const ReportSplitResponse>(
+  const NodeLoginResponse* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const NodeLoginResponse>(
           &from);
   if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:mspb.ReportSplitResponse)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:mspb.NodeLoginResponse)
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:mspb.ReportSplitResponse)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:mspb.NodeLoginResponse)
     MergeFrom(*source);
   }
 }
 
-void ReportSplitResponse::MergeFrom(const ReportSplitResponse& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:mspb.ReportSplitResponse)
+void NodeLoginResponse::MergeFrom(const NodeLoginResponse& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:mspb.NodeLoginResponse)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   ::google::protobuf::uint32 cached_has_bits = 0;
@@ -8239,73 +11061,73 @@ void ReportSplitResponse::MergeFrom(const ReportSplitResponse& from) {
   }
 }
 
-void ReportSplitResponse::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:mspb.ReportSplitResponse)
+void NodeLoginResponse::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:mspb.NodeLoginResponse)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void ReportSplitResponse::CopyFrom(const ReportSplitResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:mspb.ReportSplitResponse)
+void NodeLoginResponse::CopyFrom(const NodeLoginResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mspb.NodeLoginResponse)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool ReportSplitResponse::IsInitialized() const {
+bool NodeLoginResponse::IsInitialized() const {
   return true;
 }
 
-void ReportSplitResponse::Swap(ReportSplitResponse* other) {
+void NodeLoginResponse::Swap(NodeLoginResponse* other) {
   if (other == this) return;
   InternalSwap(other);
 }
-void ReportSplitResponse::InternalSwap(ReportSplitResponse* other) {
+void NodeLoginResponse::InternalSwap(NodeLoginResponse* other) {
   using std::swap;
   swap(header_, other->header_);
   _internal_metadata_.Swap(&other->_internal_metadata_);
   swap(_cached_size_, other->_cached_size_);
 }
 
-::google::protobuf::Metadata ReportSplitResponse::GetMetadata() const {
+::google::protobuf::Metadata NodeLoginResponse::GetMetadata() const {
   protobuf_mspb_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_mspb_2eproto::file_level_metadata[kIndexInFileMessages];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
-// ReportSplitResponse
+// NodeLoginResponse
 
 // .mspb.ResponseHeader header = 1;
-bool ReportSplitResponse::has_header() const {
+bool NodeLoginResponse::has_header() const {
   return this != internal_default_instance() && header_ != NULL;
 }
-void ReportSplitResponse::clear_header() {
+void NodeLoginResponse::clear_header() {
   if (GetArenaNoVirtual() == NULL && header_ != NULL) delete header_;
   header_ = NULL;
 }
-const ::mspb::ResponseHeader& ReportSplitResponse::header() const {
+const ::mspb::ResponseHeader& NodeLoginResponse::header() const {
   const ::mspb::ResponseHeader* p = header_;
-  // @@protoc_insertion_point(field_get:mspb.ReportSplitResponse.header)
+  // @@protoc_insertion_point(field_get:mspb.NodeLoginResponse.header)
   return p != NULL ? *p : *reinterpret_cast<const ::mspb::ResponseHeader*>(
       &::mspb::_ResponseHeader_default_instance_);
 }
-::mspb::ResponseHeader* ReportSplitResponse::mutable_header() {
+::mspb::ResponseHeader* NodeLoginResponse::mutable_header() {
   
   if (header_ == NULL) {
     header_ = new ::mspb::ResponseHeader;
   }
-  // @@protoc_insertion_point(field_mutable:mspb.ReportSplitResponse.header)
+  // @@protoc_insertion_point(field_mutable:mspb.NodeLoginResponse.header)
   return header_;
 }
-::mspb::ResponseHeader* ReportSplitResponse::release_header() {
-  // @@protoc_insertion_point(field_release:mspb.ReportSplitResponse.header)
+::mspb::ResponseHeader* NodeLoginResponse::release_header() {
+  // @@protoc_insertion_point(field_release:mspb.NodeLoginResponse.header)
   
   ::mspb::ResponseHeader* temp = header_;
   header_ = NULL;
   return temp;
 }
-void ReportSplitResponse::set_allocated_header(::mspb::ResponseHeader* header) {
+void NodeLoginResponse::set_allocated_header(::mspb::ResponseHeader* header) {
   delete header_;
   header_ = header;
   if (header) {
@@ -8313,7 +11135,7 @@ void ReportSplitResponse::set_allocated_header(::mspb::ResponseHeader* header) {
   } else {
     
   }
-  // @@protoc_insertion_point(field_set_allocated:mspb.ReportSplitResponse.header)
+  // @@protoc_insertion_point(field_set_allocated:mspb.NodeLoginResponse.header)
 }
 
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -8321,90 +11143,104 @@ void ReportSplitResponse::set_allocated_header(::mspb::ResponseHeader* header) {
 // ===================================================================
 
 #if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int NodeLoginRequest::kHeaderFieldNumber;
-const int NodeLoginRequest::kNodeIdFieldNumber;
+const int GetNodeIdRequest::kHeaderFieldNumber;
+const int GetNodeIdRequest::kServerPortFieldNumber;
+const int GetNodeIdRequest::kRaftPortFieldNumber;
+const int GetNodeIdRequest::kAdminPortFieldNumber;
+const int GetNodeIdRequest::kVersionFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
-NodeLoginRequest::NodeLoginRequest()
+GetNodeIdRequest::GetNodeIdRequest()
   : ::google::protobuf::Message(), _internal_metadata_(NULL) {
   if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
     protobuf_mspb_2eproto::InitDefaults();
   }
   SharedCtor();
-  // @@protoc_insertion_point(constructor:mspb.NodeLoginRequest)
+  // @@protoc_insertion_point(constructor:mspb.GetNodeIdRequest)
 }
-NodeLoginRequest::NodeLoginRequest(const NodeLoginRequest& from)
+GetNodeIdRequest::GetNodeIdRequest(const GetNodeIdRequest& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
       _cached_size_(0) {
   _internal_metadata_.MergeFrom(from._internal_metadata_);
+  version_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (from.version().size() > 0) {
+    version_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.version_);
+  }
   if (from.has_header()) {
     header_ = new ::mspb::RequestHeader(*from.header_);
   } else {
     header_ = NULL;
   }
-  node_id_ = from.node_id_;
-  // @@protoc_insertion_point(copy_constructor:mspb.NodeLoginRequest)
+  ::memcpy(&server_port_, &from.server_port_,
+    static_cast<size_t>(reinterpret_cast<char*>(&admin_port_) -
+    reinterpret_cast<char*>(&server_port_)) + sizeof(admin_port_));
+  // @@protoc_insertion_point(copy_constructor:mspb.GetNodeIdRequest)
 }
 
-void NodeLoginRequest::SharedCtor() {
+void GetNodeIdRequest::SharedCtor() {
+  version_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   ::memset(&header_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&node_id_) -
-      reinterpret_cast<char*>(&header_)) + sizeof(node_id_));
+      reinterpret_cast<char*>(&admin_port_) -
+      reinterpret_cast<char*>(&header_)) + sizeof(admin_port_));
   _cached_size_ = 0;
 }
 
-NodeLoginRequest::~NodeLoginRequest() {
-  // @@protoc_insertion_point(destructor:mspb.NodeLoginRequest)
+GetNodeIdRequest::~GetNodeIdRequest() {
+  // @@protoc_insertion_point(destructor:mspb.GetNodeIdRequest)
   SharedDtor();
 }
 
-void NodeLoginRequest::SharedDtor() {
+void GetNodeIdRequest::SharedDtor() {
+  version_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   if (this != internal_default_instance()) delete header_;
 }
 
-void NodeLoginRequest::SetCachedSize(int size) const {
+void GetNodeIdRequest::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* NodeLoginRequest::descriptor() {
+const ::google::protobuf::Descriptor* GetNodeIdRequest::descriptor() {
   protobuf_mspb_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_mspb_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
 }
 
-const NodeLoginRequest& NodeLoginRequest::default_instance() {
+const GetNodeIdRequest& GetNodeIdRequest::default_instance() {
   protobuf_mspb_2eproto::InitDefaults();
   return *internal_default_instance();
 }
 
-NodeLoginRequest* NodeLoginRequest::New(::google::protobuf::Arena* arena) const {
-  NodeLoginRequest* n = new NodeLoginRequest;
+GetNodeIdRequest* GetNodeIdRequest::New(::google::protobuf::Arena* arena) const {
+  GetNodeIdRequest* n = new GetNodeIdRequest;
   if (arena != NULL) {
     arena->Own(n);
   }
   return n;
 }
 
-void NodeLoginRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:mspb.NodeLoginRequest)
+void GetNodeIdRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:mspb.GetNodeIdRequest)
   ::google::protobuf::uint32 cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
+  version_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   if (GetArenaNoVirtual() == NULL && header_ != NULL) {
     delete header_;
   }
   header_ = NULL;
-  node_id_ = GOOGLE_ULONGLONG(0);
+  ::memset(&server_port_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&admin_port_) -
+      reinterpret_cast<char*>(&server_port_)) + sizeof(admin_port_));
   _internal_metadata_.Clear();
 }
 
-bool NodeLoginRequest::MergePartialFromCodedStream(
+bool GetNodeIdRequest::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:mspb.NodeLoginRequest)
+  // @@protoc_insertion_point(parse_start:mspb.GetNodeIdRequest)
   for (;;) {
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
     tag = p.first;
@@ -8422,14 +11258,58 @@ bool NodeLoginRequest::MergePartialFromCodedStream(
         break;
       }
 
-      // uint64 node_id = 2;
-      case 2: {
+      // uint32 server_port = 2;
+      case 2: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(16u /* 16 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &server_port_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint32 raft_port = 3;
+      case 3: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(24u /* 24 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &raft_port_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint32 admin_port = 4;
+      case 4: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(32u /* 32 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &admin_port_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // string version = 5;
+      case 5: {
         if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(16u /* 16 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
-                 input, &node_id_)));
+            static_cast< ::google::protobuf::uint8>(42u /* 42 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_version()));
+          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+            this->version().data(), static_cast<int>(this->version().length()),
+            ::google::protobuf::internal::WireFormatLite::PARSE,
+            "mspb.GetNodeIdRequest.version"));
         } else {
           goto handle_unusual;
         }
@@ -8448,17 +11328,17 @@ bool NodeLoginRequest::MergePartialFromCodedStream(
     }
   }
 success:
-  // @@protoc_insertion_point(parse_success:mspb.NodeLoginRequest)
+  // @@protoc_insertion_point(parse_success:mspb.GetNodeIdRequest)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:mspb.NodeLoginRequest)
+  // @@protoc_insertion_point(parse_failure:mspb.GetNodeIdRequest)
   return false;
 #undef DO_
 }
 
-void NodeLoginRequest::SerializeWithCachedSizes(
+void GetNodeIdRequest::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:mspb.NodeLoginRequest)
+  // @@protoc_insertion_point(serialize_start:mspb.GetNodeIdRequest)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
@@ -8468,22 +11348,42 @@ void NodeLoginRequest::SerializeWithCachedSizes(
       1, *this->header_, output);
   }
 
-  // uint64 node_id = 2;
-  if (this->node_id() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt64(2, this->node_id(), output);
+  // uint32 server_port = 2;
+  if (this->server_port() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(2, this->server_port(), output);
+  }
+
+  // uint32 raft_port = 3;
+  if (this->raft_port() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(3, this->raft_port(), output);
+  }
+
+  // uint32 admin_port = 4;
+  if (this->admin_port() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(4, this->admin_port(), output);
+  }
+
+  // string version = 5;
+  if (this->version().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+      this->version().data(), static_cast<int>(this->version().length()),
+      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+      "mspb.GetNodeIdRequest.version");
+    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
+      5, this->version(), output);
   }
 
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
     ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
   }
-  // @@protoc_insertion_point(serialize_end:mspb.NodeLoginRequest)
+  // @@protoc_insertion_point(serialize_end:mspb.GetNodeIdRequest)
 }
 
-::google::protobuf::uint8* NodeLoginRequest::InternalSerializeWithCachedSizesToArray(
+::google::protobuf::uint8* GetNodeIdRequest::InternalSerializeWithCachedSizesToArray(
     bool deterministic, ::google::protobuf::uint8* target) const {
   (void)deterministic; // Unused
-  // @@protoc_insertion_point(serialize_to_array_start:mspb.NodeLoginRequest)
+  // @@protoc_insertion_point(serialize_to_array_start:mspb.GetNodeIdRequest)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
@@ -8494,21 +11394,42 @@ void NodeLoginRequest::SerializeWithCachedSizes(
         1, *this->header_, deterministic, target);
   }
 
-  // uint64 node_id = 2;
-  if (this->node_id() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(2, this->node_id(), target);
+  // uint32 server_port = 2;
+  if (this->server_port() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(2, this->server_port(), target);
+  }
+
+  // uint32 raft_port = 3;
+  if (this->raft_port() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(3, this->raft_port(), target);
+  }
+
+  // uint32 admin_port = 4;
+  if (this->admin_port() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(4, this->admin_port(), target);
+  }
+
+  // string version = 5;
+  if (this->version().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+      this->version().data(), static_cast<int>(this->version().length()),
+      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+      "mspb.GetNodeIdRequest.version");
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        5, this->version(), target);
   }
 
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
     target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:mspb.NodeLoginRequest)
+  // @@protoc_insertion_point(serialize_to_array_end:mspb.GetNodeIdRequest)
   return target;
 }
 
-size_t NodeLoginRequest::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:mspb.NodeLoginRequest)
+size_t GetNodeIdRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mspb.GetNodeIdRequest)
   size_t total_size = 0;
 
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
@@ -8516,6 +11437,13 @@ size_t NodeLoginRequest::ByteSizeLong() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
   }
+  // string version = 5;
+  if (this->version().size() > 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::StringSize(
+        this->version());
+  }
+
   // .mspb.RequestHeader header = 1;
   if (this->has_header()) {
     total_size += 1 +
@@ -8523,11 +11451,25 @@ size_t NodeLoginRequest::ByteSizeLong() const {
         *this->header_);
   }
 
-  // uint64 node_id = 2;
-  if (this->node_id() != 0) {
+  // uint32 server_port = 2;
+  if (this->server_port() != 0) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt64Size(
-        this->node_id());
+      ::google::protobuf::internal::WireFormatLite::UInt32Size(
+        this->server_port());
+  }
+
+  // uint32 raft_port = 3;
+  if (this->raft_port() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt32Size(
+        this->raft_port());
+  }
+
+  // uint32 admin_port = 4;
+  if (this->admin_port() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt32Size(
+        this->admin_port());
   }
 
   int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
@@ -8537,126 +11479,220 @@ size_t NodeLoginRequest::ByteSizeLong() const {
   return total_size;
 }
 
-void NodeLoginRequest::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:mspb.NodeLoginRequest)
+void GetNodeIdRequest::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:mspb.GetNodeIdRequest)
   GOOGLE_DCHECK_NE(&from, this);
-  const NodeLoginRequest* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const NodeLoginRequest>(
+  const GetNodeIdRequest* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const GetNodeIdRequest>(
           &from);
   if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:mspb.NodeLoginRequest)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:mspb.GetNodeIdRequest)
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:mspb.NodeLoginRequest)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:mspb.GetNodeIdRequest)
     MergeFrom(*source);
   }
 }
 
-void NodeLoginRequest::MergeFrom(const NodeLoginRequest& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:mspb.NodeLoginRequest)
+void GetNodeIdRequest::MergeFrom(const GetNodeIdRequest& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:mspb.GetNodeIdRequest)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
+  if (from.version().size() > 0) {
+
+    version_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.version_);
+  }
   if (from.has_header()) {
     mutable_header()->::mspb::RequestHeader::MergeFrom(from.header());
   }
-  if (from.node_id() != 0) {
-    set_node_id(from.node_id());
+  if (from.server_port() != 0) {
+    set_server_port(from.server_port());
+  }
+  if (from.raft_port() != 0) {
+    set_raft_port(from.raft_port());
+  }
+  if (from.admin_port() != 0) {
+    set_admin_port(from.admin_port());
   }
 }
 
-void NodeLoginRequest::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:mspb.NodeLoginRequest)
+void GetNodeIdRequest::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:mspb.GetNodeIdRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void NodeLoginRequest::CopyFrom(const NodeLoginRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:mspb.NodeLoginRequest)
+void GetNodeIdRequest::CopyFrom(const GetNodeIdRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mspb.GetNodeIdRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool NodeLoginRequest::IsInitialized() const {
+bool GetNodeIdRequest::IsInitialized() const {
   return true;
 }
 
-void NodeLoginRequest::Swap(NodeLoginRequest* other) {
+void GetNodeIdRequest::Swap(GetNodeIdRequest* other) {
   if (other == this) return;
   InternalSwap(other);
 }
-void NodeLoginRequest::InternalSwap(NodeLoginRequest* other) {
+void GetNodeIdRequest::InternalSwap(GetNodeIdRequest* other) {
   using std::swap;
+  version_.Swap(&other->version_);
   swap(header_, other->header_);
-  swap(node_id_, other->node_id_);
+  swap(server_port_, other->server_port_);
+  swap(raft_port_, other->raft_port_);
+  swap(admin_port_, other->admin_port_);
   _internal_metadata_.Swap(&other->_internal_metadata_);
   swap(_cached_size_, other->_cached_size_);
 }
 
-::google::protobuf::Metadata NodeLoginRequest::GetMetadata() const {
+::google::protobuf::Metadata GetNodeIdRequest::GetMetadata() const {
   protobuf_mspb_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_mspb_2eproto::file_level_metadata[kIndexInFileMessages];
 }
 
-#if PROTOBUF_INLINE_NOT_IN_HEADERS
-// NodeLoginRequest
-
-// .mspb.RequestHeader header = 1;
-bool NodeLoginRequest::has_header() const {
-  return this != internal_default_instance() && header_ != NULL;
+#if PROTOBUF_INLINE_NOT_IN_HEADERS
+// GetNodeIdRequest
+
+// .mspb.RequestHeader header = 1;
+bool GetNodeIdRequest::has_header() const {
+  return this != internal_default_instance() && header_ != NULL;
+}
+void GetNodeIdRequest::clear_header() {
+  if (GetArenaNoVirtual() == NULL && header_ != NULL) delete header_;
+  header_ = NULL;
+}
+const ::mspb::RequestHeader& GetNodeIdRequest::header() const {
+  const ::mspb::RequestHeader* p = header_;
+  // @@protoc_insertion_point(field_get:mspb.GetNodeIdRequest.header)
+  return p != NULL ? *p : *reinterpret_cast<const ::mspb::RequestHeader*>(
+      &::mspb::_RequestHeader_default_instance_);
+}
+::mspb::RequestHeader* GetNodeIdRequest::mutable_header() {
+  
+  if (header_ == NULL) {
+    header_ = new ::mspb::RequestHeader;
+  }
+  // @@protoc_insertion_point(field_mutable:mspb.GetNodeIdRequest.header)
+  return header_;
+}
+::mspb::RequestHeader* GetNodeIdRequest::release_header() {
+  // @@protoc_insertion_point(field_release:mspb.GetNodeIdRequest.header)
+  
+  ::mspb::RequestHeader* temp = header_;
+  header_ = NULL;
+  return temp;
+}
+void GetNodeIdRequest::set_allocated_header(::mspb::RequestHeader* header) {
+  delete header_;
+  header_ = header;
+  if (header) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_set_allocated:mspb.GetNodeIdRequest.header)
+}
+
+// uint32 server_port = 2;
+void GetNodeIdRequest::clear_server_port() {
+  server_port_ = 0u;
+}
+::google::protobuf::uint32 GetNodeIdRequest::server_port() const {
+  // @@protoc_insertion_point(field_get:mspb.GetNodeIdRequest.server_port)
+  return server_port_;
+}
+void GetNodeIdRequest::set_server_port(::google::protobuf::uint32 value) {
+  
+  server_port_ = value;
+  // @@protoc_insertion_point(field_set:mspb.GetNodeIdRequest.server_port)
+}
+
+// uint32 raft_port = 3;
+void GetNodeIdRequest::clear_raft_port() {
+  raft_port_ = 0u;
+}
+::google::protobuf::uint32 GetNodeIdRequest::raft_port() const {
+  // @@protoc_insertion_point(field_get:mspb.GetNodeIdRequest.raft_port)
+  return raft_port_;
+}
+void GetNodeIdRequest::set_raft_port(::google::protobuf::uint32 value) {
+  
+  raft_port_ = value;
+  // @@protoc_insertion_point(field_set:mspb.GetNodeIdRequest.raft_port)
+}
+
+// uint32 admin_port = 4;
+void GetNodeIdRequest::clear_admin_port() {
+  admin_port_ = 0u;
+}
+::google::protobuf::uint32 GetNodeIdRequest::admin_port() const {
+  // @@protoc_insertion_point(field_get:mspb.GetNodeIdRequest.admin_port)
+  return admin_port_;
+}
+void GetNodeIdRequest::set_admin_port(::google::protobuf::uint32 value) {
+  
+  admin_port_ = value;
+  // @@protoc_insertion_point(field_set:mspb.GetNodeIdRequest.admin_port)
+}
+
+// string version = 5;
+void GetNodeIdRequest::clear_version() {
+  version_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-void NodeLoginRequest::clear_header() {
-  if (GetArenaNoVirtual() == NULL && header_ != NULL) delete header_;
-  header_ = NULL;
+const ::std::string& GetNodeIdRequest::version() const {
+  // @@protoc_insertion_point(field_get:mspb.GetNodeIdRequest.version)
+  return version_.GetNoArena();
 }
-const ::mspb::RequestHeader& NodeLoginRequest::header() const {
-  const ::mspb::RequestHeader* p = header_;
-  // @@protoc_insertion_point(field_get:mspb.NodeLoginRequest.header)
-  return p != NULL ? *p : *reinterpret_cast<const ::mspb::RequestHeader*>(
-      &::mspb::_RequestHeader_default_instance_);
+void GetNodeIdRequest::set_version(const ::std::string& value) {
+  
+  version_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:mspb.GetNodeIdRequest.version)
 }
-::mspb::RequestHeader* NodeLoginRequest::mutable_header() {
+#if LANG_CXX11
+void GetNodeIdRequest::set_version(::std::string&& value) {
   
-  if (header_ == NULL) {
-    header_ = new ::mspb::RequestHeader;
-  }
-  // @@protoc_insertion_point(field_mutable:mspb.NodeLoginRequest.header)
-  return header_;
+  version_.SetNoArena(
+    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:mspb.GetNodeIdRequest.version)
 }
-::mspb::RequestHeader* NodeLoginRequest::release_header() {
-  // @@protoc_insertion_point(field_release:mspb.NodeLoginRequest.header)
+#endif
+void GetNodeIdRequest::set_version(const char* value) {
+  GOOGLE_DCHECK(value != NULL);
   
-  ::mspb::RequestHeader* temp = header_;
-  header_ = NULL;
-  return temp;
+  version_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:mspb.GetNodeIdRequest.version)
 }
-void NodeLoginRequest::set_allocated_header(::mspb::RequestHeader* header) {
-  delete header_;
-  header_ = header;
-  if (header) {
+void GetNodeIdRequest::set_version(const char* value, size_t size) {
+  
+  version_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:mspb.GetNodeIdRequest.version)
+}
+::std::string* GetNodeIdRequest::mutable_version() {
+  
+  // @@protoc_insertion_point(field_mutable:mspb.GetNodeIdRequest.version)
+  return version_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+::std::string* GetNodeIdRequest::release_version() {
+  // @@protoc_insertion_point(field_release:mspb.GetNodeIdRequest.version)
+  
+  return version_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+void GetNodeIdRequest::set_allocated_version(::std::string* version) {
+  if (version != NULL) {
     
   } else {
     
   }
-  // @@protoc_insertion_point(field_set_allocated:mspb.NodeLoginRequest.header)
-}
-
-// uint64 node_id = 2;
-void NodeLoginRequest::clear_node_id() {
-  node_id_ = GOOGLE_ULONGLONG(0);
-}
-::google::protobuf::uint64 NodeLoginRequest::node_id() const {
-  // @@protoc_insertion_point(field_get:mspb.NodeLoginRequest.node_id)
-  return node_id_;
-}
-void NodeLoginRequest::set_node_id(::google::protobuf::uint64 value) {
-  
-  node_id_ = value;
-  // @@protoc_insertion_point(field_set:mspb.NodeLoginRequest.node_id)
+  version_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), version);
+  // @@protoc_insertion_point(field_set_allocated:mspb.GetNodeIdRequest.version)
 }
 
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -8664,18 +11700,20 @@ void NodeLoginRequest::set_node_id(::google::protobuf::uint64 value) {
 // ===================================================================
 
 #if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int NodeLoginResponse::kHeaderFieldNumber;
+const int GetNodeIdResponse::kHeaderFieldNumber;
+const int GetNodeIdResponse::kNodeIdFieldNumber;
+const int GetNodeIdResponse::kClearupFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
-NodeLoginResponse::NodeLoginResponse()
+GetNodeIdResponse::GetNodeIdResponse()
   : ::google::protobuf::Message(), _internal_metadata_(NULL) {
   if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
     protobuf_mspb_2eproto::InitDefaults();
   }
   SharedCtor();
-  // @@protoc_insertion_point(constructor:mspb.NodeLoginResponse)
+  // @@protoc_insertion_point(constructor:mspb.GetNodeIdResponse)
 }
-NodeLoginResponse::NodeLoginResponse(const NodeLoginResponse& from)
+GetNodeIdResponse::GetNodeIdResponse(const GetNodeIdResponse& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
       _cached_size_(0) {
@@ -8685,48 +11723,53 @@ NodeLoginResponse::NodeLoginResponse(const NodeLoginResponse& from)
   } else {
     header_ = NULL;
   }
-  // @@protoc_insertion_point(copy_constructor:mspb.NodeLoginResponse)
+  ::memcpy(&node_id_, &from.node_id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&clearup_) -
+    reinterpret_cast<char*>(&node_id_)) + sizeof(clearup_));
+  // @@protoc_insertion_point(copy_constructor:mspb.GetNodeIdResponse)
 }
 
-void NodeLoginResponse::SharedCtor() {
-  header_ = NULL;
+void GetNodeIdResponse::SharedCtor() {
+  ::memset(&header_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&clearup_) -
+      reinterpret_cast<char*>(&header_)) + sizeof(clearup_));
   _cached_size_ = 0;
 }
 
-NodeLoginResponse::~NodeLoginResponse() {
-  // @@protoc_insertion_point(destructor:mspb.NodeLoginResponse)
+GetNodeIdResponse::~GetNodeIdResponse() {
+  // @@protoc_insertion_point(destructor:mspb.GetNodeIdResponse)
   SharedDtor();
 }
 
-void NodeLoginResponse::SharedDtor() {
+void GetNodeIdResponse::SharedDtor() {
   if (this != internal_default_instance()) delete header_;
 }
 
-void NodeLoginResponse::SetCachedSize(int size) const {
+void GetNodeIdResponse::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* NodeLoginResponse::descriptor() {
+const ::google::protobuf::Descriptor* GetNodeIdResponse::descriptor() {
   protobuf_mspb_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_mspb_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
 }
 
-const NodeLoginResponse& NodeLoginResponse::default_instance() {
+const GetNodeIdResponse& GetNodeIdResponse::default_instance() {
   protobuf_mspb_2eproto::InitDefaults();
   return *internal_default_instance();
 }
 
-NodeLoginResponse* NodeLoginResponse::New(::google::protobuf::Arena* arena) const {
-  NodeLoginResponse* n = new NodeLoginResponse;
+GetNodeIdResponse* GetNodeIdResponse::New(::google::protobuf::Arena* arena) const {
+  GetNodeIdResponse* n = new GetNodeIdResponse;
   if (arena != NULL) {
     arena->Own(n);
   }
   return n;
 }
 
-void NodeLoginResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:mspb.NodeLoginResponse)
+void GetNodeIdResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:mspb.GetNodeIdResponse)
   ::google::protobuf::uint32 cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
@@ -8735,14 +11778,17 @@ void NodeLoginResponse::Clear() {
     delete header_;
   }
   header_ = NULL;
+  ::memset(&node_id_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&clearup_) -
+      reinterpret_cast<char*>(&node_id_)) + sizeof(clearup_));
   _internal_metadata_.Clear();
 }
 
-bool NodeLoginResponse::MergePartialFromCodedStream(
+bool GetNodeIdResponse::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:mspb.NodeLoginResponse)
+  // @@protoc_insertion_point(parse_start:mspb.GetNodeIdResponse)
   for (;;) {
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
     tag = p.first;
@@ -8760,6 +11806,34 @@ bool NodeLoginResponse::MergePartialFromCodedStream(
         break;
       }
 
+      // uint64 node_id = 2;
+      case 2: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(16u /* 16 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &node_id_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // bool clearup = 3;
+      case 3: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(24u /* 24 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
+                 input, &clearup_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
       default: {
       handle_unusual:
         if (tag == 0) {
@@ -8772,17 +11846,17 @@ bool NodeLoginResponse::MergePartialFromCodedStream(
     }
   }
 success:
-  // @@protoc_insertion_point(parse_success:mspb.NodeLoginResponse)
+  // @@protoc_insertion_point(parse_success:mspb.GetNodeIdResponse)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:mspb.NodeLoginResponse)
+  // @@protoc_insertion_point(parse_failure:mspb.GetNodeIdResponse)
   return false;
 #undef DO_
 }
 
-void NodeLoginResponse::SerializeWithCachedSizes(
+void GetNodeIdResponse::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:mspb.NodeLoginResponse)
+  // @@protoc_insertion_point(serialize_start:mspb.GetNodeIdResponse)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
@@ -8792,17 +11866,27 @@ void NodeLoginResponse::SerializeWithCachedSizes(
       1, *this->header_, output);
   }
 
+  // uint64 node_id = 2;
+  if (this->node_id() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(2, this->node_id(), output);
+  }
+
+  // bool clearup = 3;
+  if (this->clearup() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteBool(3, this->clearup(), output);
+  }
+
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
     ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
   }
-  // @@protoc_insertion_point(serialize_end:mspb.NodeLoginResponse)
+  // @@protoc_insertion_point(serialize_end:mspb.GetNodeIdResponse)
 }
 
-::google::protobuf::uint8* NodeLoginResponse::InternalSerializeWithCachedSizesToArray(
+::google::protobuf::uint8* GetNodeIdResponse::InternalSerializeWithCachedSizesToArray(
     bool deterministic, ::google::protobuf::uint8* target) const {
   (void)deterministic; // Unused
-  // @@protoc_insertion_point(serialize_to_array_start:mspb.NodeLoginResponse)
+  // @@protoc_insertion_point(serialize_to_array_start:mspb.GetNodeIdResponse)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
@@ -8813,16 +11897,26 @@ void NodeLoginResponse::SerializeWithCachedSizes(
         1, *this->header_, deterministic, target);
   }
 
+  // uint64 node_id = 2;
+  if (this->node_id() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(2, this->node_id(), target);
+  }
+
+  // bool clearup = 3;
+  if (this->clearup() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(3, this->clearup(), target);
+  }
+
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
     target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:mspb.NodeLoginResponse)
+  // @@protoc_insertion_point(serialize_to_array_end:mspb.GetNodeIdResponse)
   return target;
 }
 
-size_t NodeLoginResponse::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:mspb.NodeLoginResponse)
+size_t GetNodeIdResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mspb.GetNodeIdResponse)
   size_t total_size = 0;
 
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
@@ -8837,6 +11931,18 @@ size_t NodeLoginResponse::ByteSizeLong() const {
         *this->header_);
   }
 
+  // uint64 node_id = 2;
+  if (this->node_id() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt64Size(
+        this->node_id());
+  }
+
+  // bool clearup = 3;
+  if (this->clearup() != 0) {
+    total_size += 1 + 1;
+  }
+
   int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = cached_size;
@@ -8844,23 +11950,23 @@ size_t NodeLoginResponse::ByteSizeLong() const {
   return total_size;
 }
 
-void NodeLoginResponse::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:mspb.NodeLoginResponse)
+void GetNodeIdResponse::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:mspb.GetNodeIdResponse)
   GOOGLE_DCHECK_NE(&from, this);
-  const NodeLoginResponse* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const NodeLoginResponse>(
+  const GetNodeIdResponse* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const GetNodeIdResponse>(
           &from);
   if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:mspb.NodeLoginResponse)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:mspb.GetNodeIdResponse)
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:mspb.NodeLoginResponse)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:mspb.GetNodeIdResponse)
     MergeFrom(*source);
   }
 }
 
-void NodeLoginResponse::MergeFrom(const NodeLoginResponse& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:mspb.NodeLoginResponse)
+void GetNodeIdResponse::MergeFrom(const GetNodeIdResponse& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:mspb.GetNodeIdResponse)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   ::google::protobuf::uint32 cached_has_bits = 0;
@@ -8869,75 +11975,83 @@ void NodeLoginResponse::MergeFrom(const NodeLoginResponse& from) {
   if (from.has_header()) {
     mutable_header()->::mspb::ResponseHeader::MergeFrom(from.header());
   }
+  if (from.node_id() != 0) {
+    set_node_id(from.node_id());
+  }
+  if (from.clearup() != 0) {
+    set_clearup(from.clearup());
+  }
 }
 
-void NodeLoginResponse::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:mspb.NodeLoginResponse)
+void GetNodeIdResponse::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:mspb.GetNodeIdResponse)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void NodeLoginResponse::CopyFrom(const NodeLoginResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:mspb.NodeLoginResponse)
+void GetNodeIdResponse::CopyFrom(const GetNodeIdResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mspb.GetNodeIdResponse)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool NodeLoginResponse::IsInitialized() const {
+bool GetNodeIdResponse::IsInitialized() const {
   return true;
 }
 
-void NodeLoginResponse::Swap(NodeLoginResponse* other) {
+void GetNodeIdResponse::Swap(GetNodeIdResponse* other) {
   if (other == this) return;
   InternalSwap(other);
 }
-void NodeLoginResponse::InternalSwap(NodeLoginResponse* other) {
+void GetNodeIdResponse::InternalSwap(GetNodeIdResponse* other) {
   using std::swap;
   swap(header_, other->header_);
+  swap(node_id_, other->node_id_);
+  swap(clearup_, other->clearup_);
   _internal_metadata_.Swap(&other->_internal_metadata_);
   swap(_cached_size_, other->_cached_size_);
 }
 
-::google::protobuf::Metadata NodeLoginResponse::GetMetadata() const {
+::google::protobuf::Metadata GetNodeIdResponse::GetMetadata() const {
   protobuf_mspb_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_mspb_2eproto::file_level_metadata[kIndexInFileMessages];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
-// NodeLoginResponse
+// GetNodeIdResponse
 
 // .mspb.ResponseHeader header = 1;
-bool NodeLoginResponse::has_header() const {
+bool GetNodeIdResponse::has_header() const {
   return this != internal_default_instance() && header_ != NULL;
 }
-void NodeLoginResponse::clear_header() {
+void GetNodeIdResponse::clear_header() {
   if (GetArenaNoVirtual() == NULL && header_ != NULL) delete header_;
   header_ = NULL;
 }
-const ::mspb::ResponseHeader& NodeLoginResponse::header() const {
+const ::mspb::ResponseHeader& GetNodeIdResponse::header() const {
   const ::mspb::ResponseHeader* p = header_;
-  // @@protoc_insertion_point(field_get:mspb.NodeLoginResponse.header)
+  // @@protoc_insertion_point(field_get:mspb.GetNodeIdResponse.header)
   return p != NULL ? *p : *reinterpret_cast<const ::mspb::ResponseHeader*>(
       &::mspb::_ResponseHeader_default_instance_);
 }
-::mspb::ResponseHeader* NodeLoginResponse::mutable_header() {
+::mspb::ResponseHeader* GetNodeIdResponse::mutable_header() {
   
   if (header_ == NULL) {
     header_ = new ::mspb::ResponseHeader;
   }
-  // @@protoc_insertion_point(field_mutable:mspb.NodeLoginResponse.header)
+  // @@protoc_insertion_point(field_mutable:mspb.GetNodeIdResponse.header)
   return header_;
 }
-::mspb::ResponseHeader* NodeLoginResponse::release_header() {
-  // @@protoc_insertion_point(field_release:mspb.NodeLoginResponse.header)
+::mspb::ResponseHeader* GetNodeIdResponse::release_header() {
+  // @@protoc_insertion_point(field_release:mspb.GetNodeIdResponse.header)
   
   ::mspb::ResponseHeader* temp = header_;
   header_ = NULL;
   return temp;
 }
-void NodeLoginResponse::set_allocated_header(::mspb::ResponseHeader* header) {
+void GetNodeIdResponse::set_allocated_header(::mspb::ResponseHeader* header) {
   delete header_;
   header_ = header;
   if (header) {
@@ -8945,7 +12059,35 @@ void NodeLoginResponse::set_allocated_header(::mspb::ResponseHeader* header) {
   } else {
     
   }
-  // @@protoc_insertion_point(field_set_allocated:mspb.NodeLoginResponse.header)
+  // @@protoc_insertion_point(field_set_allocated:mspb.GetNodeIdResponse.header)
+}
+
+// uint64 node_id = 2;
+void GetNodeIdResponse::clear_node_id() {
+  node_id_ = GOOGLE_ULONGLONG(0);
+}
+::google::protobuf::uint64 GetNodeIdResponse::node_id() const {
+  // @@protoc_insertion_point(field_get:mspb.GetNodeIdResponse.node_id)
+  return node_id_;
+}
+void GetNodeIdResponse::set_node_id(::google::protobuf::uint64 value) {
+  
+  node_id_ = value;
+  // @@protoc_insertion_point(field_set:mspb.GetNodeIdResponse.node_id)
+}
+
+// bool clearup = 3;
+void GetNodeIdResponse::clear_clearup() {
+  clearup_ = false;
+}
+bool GetNodeIdResponse::clearup() const {
+  // @@protoc_insertion_point(field_get:mspb.GetNodeIdResponse.clearup)
+  return clearup_;
+}
+void GetNodeIdResponse::set_clearup(bool value) {
+  
+  clearup_ = value;
+  // @@protoc_insertion_point(field_set:mspb.GetNodeIdResponse.clearup)
 }
 
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -8953,104 +12095,103 @@ void NodeLoginResponse::set_allocated_header(::mspb::ResponseHeader* header) {
 // ===================================================================
 
 #if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int GetNodeIdRequest::kHeaderFieldNumber;
-const int GetNodeIdRequest::kServerPortFieldNumber;
-const int GetNodeIdRequest::kRaftPortFieldNumber;
-const int GetNodeIdRequest::kAdminPortFieldNumber;
-const int GetNodeIdRequest::kVersionFieldNumber;
+const int GetRouteRequest::kHeaderFieldNumber;
+const int GetRouteRequest::kDbIdFieldNumber;
+const int GetRouteRequest::kTableIdFieldNumber;
+const int GetRouteRequest::kKeyFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
-GetNodeIdRequest::GetNodeIdRequest()
+GetRouteRequest::GetRouteRequest()
   : ::google::protobuf::Message(), _internal_metadata_(NULL) {
   if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
     protobuf_mspb_2eproto::InitDefaults();
   }
   SharedCtor();
-  // @@protoc_insertion_point(constructor:mspb.GetNodeIdRequest)
+  // @@protoc_insertion_point(constructor:mspb.GetRouteRequest)
 }
-GetNodeIdRequest::GetNodeIdRequest(const GetNodeIdRequest& from)
+GetRouteRequest::GetRouteRequest(const GetRouteRequest& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
       _cached_size_(0) {
   _internal_metadata_.MergeFrom(from._internal_metadata_);
-  version_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.version().size() > 0) {
-    version_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.version_);
+  key_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (from.key().size() > 0) {
+    key_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.key_);
   }
   if (from.has_header()) {
     header_ = new ::mspb::RequestHeader(*from.header_);
   } else {
     header_ = NULL;
   }
-  ::memcpy(&server_port_, &from.server_port_,
-    static_cast<size_t>(reinterpret_cast<char*>(&admin_port_) -
-    reinterpret_cast<char*>(&server_port_)) + sizeof(admin_port_));
-  // @@protoc_insertion_point(copy_constructor:mspb.GetNodeIdRequest)
+  ::memcpy(&db_id_, &from.db_id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&table_id_) -
+    reinterpret_cast<char*>(&db_id_)) + sizeof(table_id_));
+  // @@protoc_insertion_point(copy_constructor:mspb.GetRouteRequest)
 }
 
-void GetNodeIdRequest::SharedCtor() {
-  version_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+void GetRouteRequest::SharedCtor() {
+  key_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   ::memset(&header_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&admin_port_) -
-      reinterpret_cast<char*>(&header_)) + sizeof(admin_port_));
+      reinterpret_cast<char*>(&table_id_) -
+      reinterpret_cast<char*>(&header_)) + sizeof(table_id_));
   _cached_size_ = 0;
 }
 
-GetNodeIdRequest::~GetNodeIdRequest() {
-  // @@protoc_insertion_point(destructor:mspb.GetNodeIdRequest)
+GetRouteRequest::~GetRouteRequest() {
+  // @@protoc_insertion_point(destructor:mspb.GetRouteRequest)
   SharedDtor();
 }
 
-void GetNodeIdRequest::SharedDtor() {
-  version_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+void GetRouteRequest::SharedDtor() {
+  key_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   if (this != internal_default_instance()) delete header_;
 }
 
-void GetNodeIdRequest::SetCachedSize(int size) const {
+void GetRouteRequest::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* GetNodeIdRequest::descriptor() {
+const ::google::protobuf::Descriptor* GetRouteRequest::descriptor() {
   protobuf_mspb_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_mspb_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
 }
 
-const GetNodeIdRequest& GetNodeIdRequest::default_instance() {
+const GetRouteRequest& GetRouteRequest::default_instance() {
   protobuf_mspb_2eproto::InitDefaults();
   return *internal_default_instance();
 }
 
-GetNodeIdRequest* GetNodeIdRequest::New(::google::protobuf::Arena* arena) const {
-  GetNodeIdRequest* n = new GetNodeIdRequest;
+GetRouteRequest* GetRouteRequest::New(::google::protobuf::Arena* arena) const {
+  GetRouteRequest* n = new GetRouteRequest;
   if (arena != NULL) {
     arena->Own(n);
   }
   return n;
 }
 
-void GetNodeIdRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:mspb.GetNodeIdRequest)
+void GetRouteRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:mspb.GetRouteRequest)
   ::google::protobuf::uint32 cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  version_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  key_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   if (GetArenaNoVirtual() == NULL && header_ != NULL) {
     delete header_;
   }
   header_ = NULL;
-  ::memset(&server_port_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&admin_port_) -
-      reinterpret_cast<char*>(&server_port_)) + sizeof(admin_port_));
+  ::memset(&db_id_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&table_id_) -
+      reinterpret_cast<char*>(&db_id_)) + sizeof(table_id_));
   _internal_metadata_.Clear();
 }
 
-bool GetNodeIdRequest::MergePartialFromCodedStream(
+bool GetRouteRequest::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:mspb.GetNodeIdRequest)
+  // @@protoc_insertion_point(parse_start:mspb.GetRouteRequest)
   for (;;) {
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
     tag = p.first;
@@ -9068,58 +12209,40 @@ bool GetNodeIdRequest::MergePartialFromCodedStream(
         break;
       }
 
-      // uint32 server_port = 2;
+      // uint64 db_id = 2;
       case 2: {
         if (static_cast< ::google::protobuf::uint8>(tag) ==
             static_cast< ::google::protobuf::uint8>(16u /* 16 & 0xFF */)) {
 
           DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &server_port_)));
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &db_id_)));
         } else {
           goto handle_unusual;
         }
         break;
       }
 
-      // uint32 raft_port = 3;
+      // uint64 table_id = 3;
       case 3: {
         if (static_cast< ::google::protobuf::uint8>(tag) ==
             static_cast< ::google::protobuf::uint8>(24u /* 24 & 0xFF */)) {
 
           DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &raft_port_)));
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &table_id_)));
         } else {
           goto handle_unusual;
         }
         break;
       }
 
-      // uint32 admin_port = 4;
+      // bytes key = 4;
       case 4: {
         if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(32u /* 32 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &admin_port_)));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // string version = 5;
-      case 5: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(42u /* 42 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_version()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->version().data(), static_cast<int>(this->version().length()),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "mspb.GetNodeIdRequest.version"));
+            static_cast< ::google::protobuf::uint8>(34u /* 34 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
+                input, this->mutable_key()));
         } else {
           goto handle_unusual;
         }
@@ -9138,17 +12261,17 @@ bool GetNodeIdRequest::MergePartialFromCodedStream(
     }
   }
 success:
-  // @@protoc_insertion_point(parse_success:mspb.GetNodeIdRequest)
+  // @@protoc_insertion_point(parse_success:mspb.GetRouteRequest)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:mspb.GetNodeIdRequest)
+  // @@protoc_insertion_point(parse_failure:mspb.GetRouteRequest)
   return false;
 #undef DO_
 }
 
-void GetNodeIdRequest::SerializeWithCachedSizes(
+void GetRouteRequest::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:mspb.GetNodeIdRequest)
+  // @@protoc_insertion_point(serialize_start:mspb.GetRouteRequest)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
@@ -9158,42 +12281,33 @@ void GetNodeIdRequest::SerializeWithCachedSizes(
       1, *this->header_, output);
   }
 
-  // uint32 server_port = 2;
-  if (this->server_port() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(2, this->server_port(), output);
-  }
-
-  // uint32 raft_port = 3;
-  if (this->raft_port() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(3, this->raft_port(), output);
+  // uint64 db_id = 2;
+  if (this->db_id() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(2, this->db_id(), output);
   }
 
-  // uint32 admin_port = 4;
-  if (this->admin_port() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(4, this->admin_port(), output);
+  // uint64 table_id = 3;
+  if (this->table_id() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(3, this->table_id(), output);
   }
 
-  // string version = 5;
-  if (this->version().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->version().data(), static_cast<int>(this->version().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "mspb.GetNodeIdRequest.version");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      5, this->version(), output);
+  // bytes key = 4;
+  if (this->key().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteBytesMaybeAliased(
+      4, this->key(), output);
   }
 
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
     ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
   }
-  // @@protoc_insertion_point(serialize_end:mspb.GetNodeIdRequest)
+  // @@protoc_insertion_point(serialize_end:mspb.GetRouteRequest)
 }
 
-::google::protobuf::uint8* GetNodeIdRequest::InternalSerializeWithCachedSizesToArray(
+::google::protobuf::uint8* GetRouteRequest::InternalSerializeWithCachedSizesToArray(
     bool deterministic, ::google::protobuf::uint8* target) const {
   (void)deterministic; // Unused
-  // @@protoc_insertion_point(serialize_to_array_start:mspb.GetNodeIdRequest)
+  // @@protoc_insertion_point(serialize_to_array_start:mspb.GetRouteRequest)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
@@ -9204,42 +12318,33 @@ void GetNodeIdRequest::SerializeWithCachedSizes(
         1, *this->header_, deterministic, target);
   }
 
-  // uint32 server_port = 2;
-  if (this->server_port() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(2, this->server_port(), target);
-  }
-
-  // uint32 raft_port = 3;
-  if (this->raft_port() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(3, this->raft_port(), target);
+  // uint64 db_id = 2;
+  if (this->db_id() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(2, this->db_id(), target);
   }
 
-  // uint32 admin_port = 4;
-  if (this->admin_port() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(4, this->admin_port(), target);
+  // uint64 table_id = 3;
+  if (this->table_id() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(3, this->table_id(), target);
   }
 
-  // string version = 5;
-  if (this->version().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->version().data(), static_cast<int>(this->version().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "mspb.GetNodeIdRequest.version");
+  // bytes key = 4;
+  if (this->key().size() > 0) {
     target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        5, this->version(), target);
+      ::google::protobuf::internal::WireFormatLite::WriteBytesToArray(
+        4, this->key(), target);
   }
 
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
     target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:mspb.GetNodeIdRequest)
+  // @@protoc_insertion_point(serialize_to_array_end:mspb.GetRouteRequest)
   return target;
 }
 
-size_t GetNodeIdRequest::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:mspb.GetNodeIdRequest)
+size_t GetRouteRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mspb.GetRouteRequest)
   size_t total_size = 0;
 
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
@@ -9247,11 +12352,11 @@ size_t GetNodeIdRequest::ByteSizeLong() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
   }
-  // string version = 5;
-  if (this->version().size() > 0) {
+  // bytes key = 4;
+  if (this->key().size() > 0) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->version());
+      ::google::protobuf::internal::WireFormatLite::BytesSize(
+        this->key());
   }
 
   // .mspb.RequestHeader header = 1;
@@ -9261,25 +12366,18 @@ size_t GetNodeIdRequest::ByteSizeLong() const {
         *this->header_);
   }
 
-  // uint32 server_port = 2;
-  if (this->server_port() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt32Size(
-        this->server_port());
-  }
-
-  // uint32 raft_port = 3;
-  if (this->raft_port() != 0) {
+  // uint64 db_id = 2;
+  if (this->db_id() != 0) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt32Size(
-        this->raft_port());
+      ::google::protobuf::internal::WireFormatLite::UInt64Size(
+        this->db_id());
   }
 
-  // uint32 admin_port = 4;
-  if (this->admin_port() != 0) {
+  // uint64 table_id = 3;
+  if (this->table_id() != 0) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt32Size(
-        this->admin_port());
+      ::google::protobuf::internal::WireFormatLite::UInt64Size(
+        this->table_id());
   }
 
   int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
@@ -9289,117 +12387,113 @@ size_t GetNodeIdRequest::ByteSizeLong() const {
   return total_size;
 }
 
-void GetNodeIdRequest::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:mspb.GetNodeIdRequest)
+void GetRouteRequest::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:mspb.GetRouteRequest)
   GOOGLE_DCHECK_NE(&from, this);
-  const GetNodeIdRequest* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const GetNodeIdRequest>(
+  const GetRouteRequest* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const GetRouteRequest>(
           &from);
   if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:mspb.GetNodeIdRequest)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:mspb.GetRouteRequest)
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:mspb.GetNodeIdRequest)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:mspb.GetRouteRequest)
     MergeFrom(*source);
   }
 }
 
-void GetNodeIdRequest::MergeFrom(const GetNodeIdRequest& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:mspb.GetNodeIdRequest)
+void GetRouteRequest::MergeFrom(const GetRouteRequest& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:mspb.GetRouteRequest)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.version().size() > 0) {
+  if (from.key().size() > 0) {
 
-    version_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.version_);
+    key_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.key_);
   }
   if (from.has_header()) {
     mutable_header()->::mspb::RequestHeader::MergeFrom(from.header());
   }
-  if (from.server_port() != 0) {
-    set_server_port(from.server_port());
-  }
-  if (from.raft_port() != 0) {
-    set_raft_port(from.raft_port());
+  if (from.db_id() != 0) {
+    set_db_id(from.db_id());
   }
-  if (from.admin_port() != 0) {
-    set_admin_port(from.admin_port());
+  if (from.table_id() != 0) {
+    set_table_id(from.table_id());
   }
 }
 
-void GetNodeIdRequest::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:mspb.GetNodeIdRequest)
+void GetRouteRequest::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:mspb.GetRouteRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void GetNodeIdRequest::CopyFrom(const GetNodeIdRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:mspb.GetNodeIdRequest)
+void GetRouteRequest::CopyFrom(const GetRouteRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mspb.GetRouteRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool GetNodeIdRequest::IsInitialized() const {
+bool GetRouteRequest::IsInitialized() const {
   return true;
 }
 
-void GetNodeIdRequest::Swap(GetNodeIdRequest* other) {
+void GetRouteRequest::Swap(GetRouteRequest* other) {
   if (other == this) return;
   InternalSwap(other);
 }
-void GetNodeIdRequest::InternalSwap(GetNodeIdRequest* other) {
+void GetRouteRequest::InternalSwap(GetRouteRequest* other) {
   using std::swap;
-  version_.Swap(&other->version_);
+  key_.Swap(&other->key_);
   swap(header_, other->header_);
-  swap(server_port_, other->server_port_);
-  swap(raft_port_, other->raft_port_);
-  swap(admin_port_, other->admin_port_);
+  swap(db_id_, other->db_id_);
+  swap(table_id_, other->table_id_);
   _internal_metadata_.Swap(&other->_internal_metadata_);
   swap(_cached_size_, other->_cached_size_);
 }
 
-::google::protobuf::Metadata GetNodeIdRequest::GetMetadata() const {
+::google::protobuf::Metadata GetRouteRequest::GetMetadata() const {
   protobuf_mspb_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_mspb_2eproto::file_level_metadata[kIndexInFileMessages];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
-// GetNodeIdRequest
+// GetRouteRequest
 
 // .mspb.RequestHeader header = 1;
-bool GetNodeIdRequest::has_header() const {
+bool GetRouteRequest::has_header() const {
   return this != internal_default_instance() && header_ != NULL;
 }
-void GetNodeIdRequest::clear_header() {
+void GetRouteRequest::clear_header() {
   if (GetArenaNoVirtual() == NULL && header_ != NULL) delete header_;
   header_ = NULL;
 }
-const ::mspb::RequestHeader& GetNodeIdRequest::header() const {
+const ::mspb::RequestHeader& GetRouteRequest::header() const {
   const ::mspb::RequestHeader* p = header_;
-  // @@protoc_insertion_point(field_get:mspb.GetNodeIdRequest.header)
+  // @@protoc_insertion_point(field_get:mspb.GetRouteRequest.header)
   return p != NULL ? *p : *reinterpret_cast<const ::mspb::RequestHeader*>(
       &::mspb::_RequestHeader_default_instance_);
 }
-::mspb::RequestHeader* GetNodeIdRequest::mutable_header() {
+::mspb::RequestHeader* GetRouteRequest::mutable_header() {
   
   if (header_ == NULL) {
     header_ = new ::mspb::RequestHeader;
   }
-  // @@protoc_insertion_point(field_mutable:mspb.GetNodeIdRequest.header)
+  // @@protoc_insertion_point(field_mutable:mspb.GetRouteRequest.header)
   return header_;
 }
-::mspb::RequestHeader* GetNodeIdRequest::release_header() {
-  // @@protoc_insertion_point(field_release:mspb.GetNodeIdRequest.header)
+::mspb::RequestHeader* GetRouteRequest::release_header() {
+  // @@protoc_insertion_point(field_release:mspb.GetRouteRequest.header)
   
   ::mspb::RequestHeader* temp = header_;
   header_ = NULL;
   return temp;
 }
-void GetNodeIdRequest::set_allocated_header(::mspb::RequestHeader* header) {
+void GetRouteRequest::set_allocated_header(::mspb::RequestHeader* header) {
   delete header_;
   header_ = header;
   if (header) {
@@ -9407,102 +12501,88 @@ void GetNodeIdRequest::set_allocated_header(::mspb::RequestHeader* header) {
   } else {
     
   }
-  // @@protoc_insertion_point(field_set_allocated:mspb.GetNodeIdRequest.header)
-}
-
-// uint32 server_port = 2;
-void GetNodeIdRequest::clear_server_port() {
-  server_port_ = 0u;
-}
-::google::protobuf::uint32 GetNodeIdRequest::server_port() const {
-  // @@protoc_insertion_point(field_get:mspb.GetNodeIdRequest.server_port)
-  return server_port_;
-}
-void GetNodeIdRequest::set_server_port(::google::protobuf::uint32 value) {
-  
-  server_port_ = value;
-  // @@protoc_insertion_point(field_set:mspb.GetNodeIdRequest.server_port)
+  // @@protoc_insertion_point(field_set_allocated:mspb.GetRouteRequest.header)
 }
 
-// uint32 raft_port = 3;
-void GetNodeIdRequest::clear_raft_port() {
-  raft_port_ = 0u;
+// uint64 db_id = 2;
+void GetRouteRequest::clear_db_id() {
+  db_id_ = GOOGLE_ULONGLONG(0);
 }
-::google::protobuf::uint32 GetNodeIdRequest::raft_port() const {
-  // @@protoc_insertion_point(field_get:mspb.GetNodeIdRequest.raft_port)
-  return raft_port_;
+::google::protobuf::uint64 GetRouteRequest::db_id() const {
+  // @@protoc_insertion_point(field_get:mspb.GetRouteRequest.db_id)
+  return db_id_;
 }
-void GetNodeIdRequest::set_raft_port(::google::protobuf::uint32 value) {
+void GetRouteRequest::set_db_id(::google::protobuf::uint64 value) {
   
-  raft_port_ = value;
-  // @@protoc_insertion_point(field_set:mspb.GetNodeIdRequest.raft_port)
+  db_id_ = value;
+  // @@protoc_insertion_point(field_set:mspb.GetRouteRequest.db_id)
 }
 
-// uint32 admin_port = 4;
-void GetNodeIdRequest::clear_admin_port() {
-  admin_port_ = 0u;
+// uint64 table_id = 3;
+void GetRouteRequest::clear_table_id() {
+  table_id_ = GOOGLE_ULONGLONG(0);
 }
-::google::protobuf::uint32 GetNodeIdRequest::admin_port() const {
-  // @@protoc_insertion_point(field_get:mspb.GetNodeIdRequest.admin_port)
-  return admin_port_;
+::google::protobuf::uint64 GetRouteRequest::table_id() const {
+  // @@protoc_insertion_point(field_get:mspb.GetRouteRequest.table_id)
+  return table_id_;
 }
-void GetNodeIdRequest::set_admin_port(::google::protobuf::uint32 value) {
+void GetRouteRequest::set_table_id(::google::protobuf::uint64 value) {
   
-  admin_port_ = value;
-  // @@protoc_insertion_point(field_set:mspb.GetNodeIdRequest.admin_port)
+  table_id_ = value;
+  // @@protoc_insertion_point(field_set:mspb.GetRouteRequest.table_id)
 }
 
-// string version = 5;
-void GetNodeIdRequest::clear_version() {
-  version_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+// bytes key = 4;
+void GetRouteRequest::clear_key() {
+  key_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-const ::std::string& GetNodeIdRequest::version() const {
-  // @@protoc_insertion_point(field_get:mspb.GetNodeIdRequest.version)
-  return version_.GetNoArena();
+const ::std::string& GetRouteRequest::key() const {
+  // @@protoc_insertion_point(field_get:mspb.GetRouteRequest.key)
+  return key_.GetNoArena();
 }
-void GetNodeIdRequest::set_version(const ::std::string& value) {
+void GetRouteRequest::set_key(const ::std::string& value) {
   
-  version_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:mspb.GetNodeIdRequest.version)
+  key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:mspb.GetRouteRequest.key)
 }
 #if LANG_CXX11
-void GetNodeIdRequest::set_version(::std::string&& value) {
+void GetRouteRequest::set_key(::std::string&& value) {
   
-  version_.SetNoArena(
+  key_.SetNoArena(
     &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:mspb.GetNodeIdRequest.version)
+  // @@protoc_insertion_point(field_set_rvalue:mspb.GetRouteRequest.key)
 }
 #endif
-void GetNodeIdRequest::set_version(const char* value) {
+void GetRouteRequest::set_key(const char* value) {
   GOOGLE_DCHECK(value != NULL);
   
-  version_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:mspb.GetNodeIdRequest.version)
+  key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:mspb.GetRouteRequest.key)
 }
-void GetNodeIdRequest::set_version(const char* value, size_t size) {
+void GetRouteRequest::set_key(const void* value, size_t size) {
   
-  version_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+  key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
       ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:mspb.GetNodeIdRequest.version)
+  // @@protoc_insertion_point(field_set_pointer:mspb.GetRouteRequest.key)
 }
-::std::string* GetNodeIdRequest::mutable_version() {
+::std::string* GetRouteRequest::mutable_key() {
   
-  // @@protoc_insertion_point(field_mutable:mspb.GetNodeIdRequest.version)
-  return version_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  // @@protoc_insertion_point(field_mutable:mspb.GetRouteRequest.key)
+  return key_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-::std::string* GetNodeIdRequest::release_version() {
-  // @@protoc_insertion_point(field_release:mspb.GetNodeIdRequest.version)
+::std::string* GetRouteRequest::release_key() {
+  // @@protoc_insertion_point(field_release:mspb.GetRouteRequest.key)
   
-  return version_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return key_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-void GetNodeIdRequest::set_allocated_version(::std::string* version) {
-  if (version != NULL) {
+void GetRouteRequest::set_allocated_key(::std::string* key) {
+  if (key != NULL) {
     
   } else {
     
   }
-  version_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), version);
-  // @@protoc_insertion_point(field_set_allocated:mspb.GetNodeIdRequest.version)
+  key_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), key);
+  // @@protoc_insertion_point(field_set_allocated:mspb.GetRouteRequest.key)
 }
 
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -9510,22 +12590,22 @@ void GetNodeIdRequest::set_allocated_version(::std::string* version) {
 // ===================================================================
 
 #if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int GetNodeIdResponse::kHeaderFieldNumber;
-const int GetNodeIdResponse::kNodeIdFieldNumber;
-const int GetNodeIdResponse::kClearupFieldNumber;
+const int GetRouteResponse::kHeaderFieldNumber;
+const int GetRouteResponse::kRoutesFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
-GetNodeIdResponse::GetNodeIdResponse()
+GetRouteResponse::GetRouteResponse()
   : ::google::protobuf::Message(), _internal_metadata_(NULL) {
   if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
     protobuf_mspb_2eproto::InitDefaults();
   }
   SharedCtor();
-  // @@protoc_insertion_point(constructor:mspb.GetNodeIdResponse)
+  // @@protoc_insertion_point(constructor:mspb.GetRouteResponse)
 }
-GetNodeIdResponse::GetNodeIdResponse(const GetNodeIdResponse& from)
+GetRouteResponse::GetRouteResponse(const GetRouteResponse& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
+      routes_(from.routes_),
       _cached_size_(0) {
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   if (from.has_header()) {
@@ -9533,111 +12613,88 @@ GetNodeIdResponse::GetNodeIdResponse(const GetNodeIdResponse& from)
   } else {
     header_ = NULL;
   }
-  ::memcpy(&node_id_, &from.node_id_,
-    static_cast<size_t>(reinterpret_cast<char*>(&clearup_) -
-    reinterpret_cast<char*>(&node_id_)) + sizeof(clearup_));
-  // @@protoc_insertion_point(copy_constructor:mspb.GetNodeIdResponse)
+  // @@protoc_insertion_point(copy_constructor:mspb.GetRouteResponse)
 }
 
-void GetNodeIdResponse::SharedCtor() {
-  ::memset(&header_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&clearup_) -
-      reinterpret_cast<char*>(&header_)) + sizeof(clearup_));
+void GetRouteResponse::SharedCtor() {
+  header_ = NULL;
   _cached_size_ = 0;
 }
 
-GetNodeIdResponse::~GetNodeIdResponse() {
-  // @@protoc_insertion_point(destructor:mspb.GetNodeIdResponse)
+GetRouteResponse::~GetRouteResponse() {
+  // @@protoc_insertion_point(destructor:mspb.GetRouteResponse)
   SharedDtor();
 }
 
-void GetNodeIdResponse::SharedDtor() {
+void GetRouteResponse::SharedDtor() {
   if (this != internal_default_instance()) delete header_;
 }
 
-void GetNodeIdResponse::SetCachedSize(int size) const {
+void GetRouteResponse::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* GetNodeIdResponse::descriptor() {
+const ::google::protobuf::Descriptor* GetRouteResponse::descriptor() {
   protobuf_mspb_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_mspb_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
 }
 
-const GetNodeIdResponse& GetNodeIdResponse::default_instance() {
+const GetRouteResponse& GetRouteResponse::default_instance() {
   protobuf_mspb_2eproto::InitDefaults();
   return *internal_default_instance();
 }
 
-GetNodeIdResponse* GetNodeIdResponse::New(::google::protobuf::Arena* arena) const {
-  GetNodeIdResponse* n = new GetNodeIdResponse;
+GetRouteResponse* GetRouteResponse::New(::google::protobuf::Arena* arena) const {
+  GetRouteResponse* n = new GetRouteResponse;
   if (arena != NULL) {
     arena->Own(n);
   }
   return n;
 }
 
-void GetNodeIdResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:mspb.GetNodeIdResponse)
+void GetRouteResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:mspb.GetRouteResponse)
   ::google::protobuf::uint32 cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
+  routes_.Clear();
   if (GetArenaNoVirtual() == NULL && header_ != NULL) {
     delete header_;
   }
   header_ = NULL;
-  ::memset(&node_id_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&clearup_) -
-      reinterpret_cast<char*>(&node_id_)) + sizeof(clearup_));
   _internal_metadata_.Clear();
 }
 
-bool GetNodeIdResponse::MergePartialFromCodedStream(
+bool GetRouteResponse::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:mspb.GetNodeIdResponse)
+  // @@protoc_insertion_point(parse_start:mspb.GetRouteResponse)
   for (;;) {
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
     tag = p.first;
     if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // .mspb.ResponseHeader header = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_header()));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // uint64 node_id = 2;
-      case 2: {
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // .mspb.ResponseHeader header = 1;
+      case 1: {
         if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(16u /* 16 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
-                 input, &node_id_)));
+            static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_header()));
         } else {
           goto handle_unusual;
         }
         break;
       }
 
-      // bool clearup = 3;
-      case 3: {
+      // repeated .metapb.Route routes = 2;
+      case 2: {
         if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(24u /* 24 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
-                 input, &clearup_)));
+            static_cast< ::google::protobuf::uint8>(18u /* 18 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+                input, add_routes()));
         } else {
           goto handle_unusual;
         }
@@ -9656,17 +12713,17 @@ bool GetNodeIdResponse::MergePartialFromCodedStream(
     }
   }
 success:
-  // @@protoc_insertion_point(parse_success:mspb.GetNodeIdResponse)
+  // @@protoc_insertion_point(parse_success:mspb.GetRouteResponse)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:mspb.GetNodeIdResponse)
+  // @@protoc_insertion_point(parse_failure:mspb.GetRouteResponse)
   return false;
 #undef DO_
 }
 
-void GetNodeIdResponse::SerializeWithCachedSizes(
+void GetRouteResponse::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:mspb.GetNodeIdResponse)
+  // @@protoc_insertion_point(serialize_start:mspb.GetRouteResponse)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
@@ -9676,27 +12733,24 @@ void GetNodeIdResponse::SerializeWithCachedSizes(
       1, *this->header_, output);
   }
 
-  // uint64 node_id = 2;
-  if (this->node_id() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt64(2, this->node_id(), output);
-  }
-
-  // bool clearup = 3;
-  if (this->clearup() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteBool(3, this->clearup(), output);
+  // repeated .metapb.Route routes = 2;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->routes_size()); i < n; i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      2, this->routes(static_cast<int>(i)), output);
   }
 
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
     ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
   }
-  // @@protoc_insertion_point(serialize_end:mspb.GetNodeIdResponse)
+  // @@protoc_insertion_point(serialize_end:mspb.GetRouteResponse)
 }
 
-::google::protobuf::uint8* GetNodeIdResponse::InternalSerializeWithCachedSizesToArray(
+::google::protobuf::uint8* GetRouteResponse::InternalSerializeWithCachedSizesToArray(
     bool deterministic, ::google::protobuf::uint8* target) const {
   (void)deterministic; // Unused
-  // @@protoc_insertion_point(serialize_to_array_start:mspb.GetNodeIdResponse)
+  // @@protoc_insertion_point(serialize_to_array_start:mspb.GetRouteResponse)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
@@ -9707,26 +12761,24 @@ void GetNodeIdResponse::SerializeWithCachedSizes(
         1, *this->header_, deterministic, target);
   }
 
-  // uint64 node_id = 2;
-  if (this->node_id() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(2, this->node_id(), target);
-  }
-
-  // bool clearup = 3;
-  if (this->clearup() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(3, this->clearup(), target);
+  // repeated .metapb.Route routes = 2;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->routes_size()); i < n; i++) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      InternalWriteMessageNoVirtualToArray(
+        2, this->routes(static_cast<int>(i)), deterministic, target);
   }
 
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
     target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:mspb.GetNodeIdResponse)
+  // @@protoc_insertion_point(serialize_to_array_end:mspb.GetRouteResponse)
   return target;
 }
 
-size_t GetNodeIdResponse::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:mspb.GetNodeIdResponse)
+size_t GetRouteResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mspb.GetRouteResponse)
   size_t total_size = 0;
 
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
@@ -9734,6 +12786,17 @@ size_t GetNodeIdResponse::ByteSizeLong() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
   }
+  // repeated .metapb.Route routes = 2;
+  {
+    unsigned int count = static_cast<unsigned int>(this->routes_size());
+    total_size += 1UL * count;
+    for (unsigned int i = 0; i < count; i++) {
+      total_size +=
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->routes(static_cast<int>(i)));
+    }
+  }
+
   // .mspb.ResponseHeader header = 1;
   if (this->has_header()) {
     total_size += 1 +
@@ -9741,18 +12804,6 @@ size_t GetNodeIdResponse::ByteSizeLong() const {
         *this->header_);
   }
 
-  // uint64 node_id = 2;
-  if (this->node_id() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt64Size(
-        this->node_id());
-  }
-
-  // bool clearup = 3;
-  if (this->clearup() != 0) {
-    total_size += 1 + 1;
-  }
-
   int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = cached_size;
@@ -9760,108 +12811,102 @@ size_t GetNodeIdResponse::ByteSizeLong() const {
   return total_size;
 }
 
-void GetNodeIdResponse::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:mspb.GetNodeIdResponse)
+void GetRouteResponse::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:mspb.GetRouteResponse)
   GOOGLE_DCHECK_NE(&from, this);
-  const GetNodeIdResponse* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const GetNodeIdResponse>(
+  const GetRouteResponse* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const GetRouteResponse>(
           &from);
   if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:mspb.GetNodeIdResponse)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:mspb.GetRouteResponse)
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:mspb.GetNodeIdResponse)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:mspb.GetRouteResponse)
     MergeFrom(*source);
   }
 }
 
-void GetNodeIdResponse::MergeFrom(const GetNodeIdResponse& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:mspb.GetNodeIdResponse)
+void GetRouteResponse::MergeFrom(const GetRouteResponse& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:mspb.GetRouteResponse)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
+  routes_.MergeFrom(from.routes_);
   if (from.has_header()) {
     mutable_header()->::mspb::ResponseHeader::MergeFrom(from.header());
   }
-  if (from.node_id() != 0) {
-    set_node_id(from.node_id());
-  }
-  if (from.clearup() != 0) {
-    set_clearup(from.clearup());
-  }
 }
 
-void GetNodeIdResponse::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:mspb.GetNodeIdResponse)
+void GetRouteResponse::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:mspb.GetRouteResponse)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void GetNodeIdResponse::CopyFrom(const GetNodeIdResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:mspb.GetNodeIdResponse)
+void GetRouteResponse::CopyFrom(const GetRouteResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mspb.GetRouteResponse)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool GetNodeIdResponse::IsInitialized() const {
+bool GetRouteResponse::IsInitialized() const {
   return true;
 }
 
-void GetNodeIdResponse::Swap(GetNodeIdResponse* other) {
+void GetRouteResponse::Swap(GetRouteResponse* other) {
   if (other == this) return;
   InternalSwap(other);
 }
-void GetNodeIdResponse::InternalSwap(GetNodeIdResponse* other) {
+void GetRouteResponse::InternalSwap(GetRouteResponse* other) {
   using std::swap;
+  routes_.InternalSwap(&other->routes_);
   swap(header_, other->header_);
-  swap(node_id_, other->node_id_);
-  swap(clearup_, other->clearup_);
   _internal_metadata_.Swap(&other->_internal_metadata_);
   swap(_cached_size_, other->_cached_size_);
 }
 
-::google::protobuf::Metadata GetNodeIdResponse::GetMetadata() const {
+::google::protobuf::Metadata GetRouteResponse::GetMetadata() const {
   protobuf_mspb_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_mspb_2eproto::file_level_metadata[kIndexInFileMessages];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
-// GetNodeIdResponse
+// GetRouteResponse
 
 // .mspb.ResponseHeader header = 1;
-bool GetNodeIdResponse::has_header() const {
+bool GetRouteResponse::has_header() const {
   return this != internal_default_instance() && header_ != NULL;
 }
-void GetNodeIdResponse::clear_header() {
+void GetRouteResponse::clear_header() {
   if (GetArenaNoVirtual() == NULL && header_ != NULL) delete header_;
   header_ = NULL;
 }
-const ::mspb::ResponseHeader& GetNodeIdResponse::header() const {
+const ::mspb::ResponseHeader& GetRouteResponse::header() const {
   const ::mspb::ResponseHeader* p = header_;
-  // @@protoc_insertion_point(field_get:mspb.GetNodeIdResponse.header)
+  // @@protoc_insertion_point(field_get:mspb.GetRouteResponse.header)
   return p != NULL ? *p : *reinterpret_cast<const ::mspb::ResponseHeader*>(
       &::mspb::_ResponseHeader_default_instance_);
 }
-::mspb::ResponseHeader* GetNodeIdResponse::mutable_header() {
+::mspb::ResponseHeader* GetRouteResponse::mutable_header() {
   
   if (header_ == NULL) {
     header_ = new ::mspb::ResponseHeader;
   }
-  // @@protoc_insertion_point(field_mutable:mspb.GetNodeIdResponse.header)
+  // @@protoc_insertion_point(field_mutable:mspb.GetRouteResponse.header)
   return header_;
 }
-::mspb::ResponseHeader* GetNodeIdResponse::release_header() {
-  // @@protoc_insertion_point(field_release:mspb.GetNodeIdResponse.header)
+::mspb::ResponseHeader* GetRouteResponse::release_header() {
+  // @@protoc_insertion_point(field_release:mspb.GetRouteResponse.header)
   
   ::mspb::ResponseHeader* temp = header_;
   header_ = NULL;
   return temp;
 }
-void GetNodeIdResponse::set_allocated_header(::mspb::ResponseHeader* header) {
+void GetRouteResponse::set_allocated_header(::mspb::ResponseHeader* header) {
   delete header_;
   header_ = header;
   if (header) {
@@ -9869,35 +12914,37 @@ void GetNodeIdResponse::set_allocated_header(::mspb::ResponseHeader* header) {
   } else {
     
   }
-  // @@protoc_insertion_point(field_set_allocated:mspb.GetNodeIdResponse.header)
+  // @@protoc_insertion_point(field_set_allocated:mspb.GetRouteResponse.header)
 }
 
-// uint64 node_id = 2;
-void GetNodeIdResponse::clear_node_id() {
-  node_id_ = GOOGLE_ULONGLONG(0);
+// repeated .metapb.Route routes = 2;
+int GetRouteResponse::routes_size() const {
+  return routes_.size();
 }
-::google::protobuf::uint64 GetNodeIdResponse::node_id() const {
-  // @@protoc_insertion_point(field_get:mspb.GetNodeIdResponse.node_id)
-  return node_id_;
+void GetRouteResponse::clear_routes() {
+  routes_.Clear();
 }
-void GetNodeIdResponse::set_node_id(::google::protobuf::uint64 value) {
-  
-  node_id_ = value;
-  // @@protoc_insertion_point(field_set:mspb.GetNodeIdResponse.node_id)
+const ::metapb::Route& GetRouteResponse::routes(int index) const {
+  // @@protoc_insertion_point(field_get:mspb.GetRouteResponse.routes)
+  return routes_.Get(index);
 }
-
-// bool clearup = 3;
-void GetNodeIdResponse::clear_clearup() {
-  clearup_ = false;
+::metapb::Route* GetRouteResponse::mutable_routes(int index) {
+  // @@protoc_insertion_point(field_mutable:mspb.GetRouteResponse.routes)
+  return routes_.Mutable(index);
 }
-bool GetNodeIdResponse::clearup() const {
-  // @@protoc_insertion_point(field_get:mspb.GetNodeIdResponse.clearup)
-  return clearup_;
+::metapb::Route* GetRouteResponse::add_routes() {
+  // @@protoc_insertion_point(field_add:mspb.GetRouteResponse.routes)
+  return routes_.Add();
 }
-void GetNodeIdResponse::set_clearup(bool value) {
-  
-  clearup_ = value;
-  // @@protoc_insertion_point(field_set:mspb.GetNodeIdResponse.clearup)
+::google::protobuf::RepeatedPtrField< ::metapb::Route >*
+GetRouteResponse::mutable_routes() {
+  // @@protoc_insertion_point(field_mutable_list:mspb.GetRouteResponse.routes)
+  return &routes_;
+}
+const ::google::protobuf::RepeatedPtrField< ::metapb::Route >&
+GetRouteResponse::routes() const {
+  // @@protoc_insertion_point(field_list:mspb.GetRouteResponse.routes)
+  return routes_;
 }
 
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -9905,103 +12952,90 @@ void GetNodeIdResponse::set_clearup(bool value) {
 // ===================================================================
 
 #if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int GetRouteRequest::kHeaderFieldNumber;
-const int GetRouteRequest::kDbIdFieldNumber;
-const int GetRouteRequest::kTableIdFieldNumber;
-const int GetRouteRequest::kKeyFieldNumber;
+const int GetNodeRequest::kHeaderFieldNumber;
+const int GetNodeRequest::kIdFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
-GetRouteRequest::GetRouteRequest()
+GetNodeRequest::GetNodeRequest()
   : ::google::protobuf::Message(), _internal_metadata_(NULL) {
   if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
     protobuf_mspb_2eproto::InitDefaults();
   }
   SharedCtor();
-  // @@protoc_insertion_point(constructor:mspb.GetRouteRequest)
+  // @@protoc_insertion_point(constructor:mspb.GetNodeRequest)
 }
-GetRouteRequest::GetRouteRequest(const GetRouteRequest& from)
+GetNodeRequest::GetNodeRequest(const GetNodeRequest& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
       _cached_size_(0) {
   _internal_metadata_.MergeFrom(from._internal_metadata_);
-  key_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.key().size() > 0) {
-    key_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.key_);
-  }
   if (from.has_header()) {
     header_ = new ::mspb::RequestHeader(*from.header_);
   } else {
     header_ = NULL;
   }
-  ::memcpy(&db_id_, &from.db_id_,
-    static_cast<size_t>(reinterpret_cast<char*>(&table_id_) -
-    reinterpret_cast<char*>(&db_id_)) + sizeof(table_id_));
-  // @@protoc_insertion_point(copy_constructor:mspb.GetRouteRequest)
+  id_ = from.id_;
+  // @@protoc_insertion_point(copy_constructor:mspb.GetNodeRequest)
 }
 
-void GetRouteRequest::SharedCtor() {
-  key_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+void GetNodeRequest::SharedCtor() {
   ::memset(&header_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&table_id_) -
-      reinterpret_cast<char*>(&header_)) + sizeof(table_id_));
+      reinterpret_cast<char*>(&id_) -
+      reinterpret_cast<char*>(&header_)) + sizeof(id_));
   _cached_size_ = 0;
 }
 
-GetRouteRequest::~GetRouteRequest() {
-  // @@protoc_insertion_point(destructor:mspb.GetRouteRequest)
+GetNodeRequest::~GetNodeRequest() {
+  // @@protoc_insertion_point(destructor:mspb.GetNodeRequest)
   SharedDtor();
 }
 
-void GetRouteRequest::SharedDtor() {
-  key_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+void GetNodeRequest::SharedDtor() {
   if (this != internal_default_instance()) delete header_;
 }
 
-void GetRouteRequest::SetCachedSize(int size) const {
+void GetNodeRequest::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* GetRouteRequest::descriptor() {
+const ::google::protobuf::Descriptor* GetNodeRequest::descriptor() {
   protobuf_mspb_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_mspb_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
 }
 
-const GetRouteRequest& GetRouteRequest::default_instance() {
+const GetNodeRequest& GetNodeRequest::default_instance() {
   protobuf_mspb_2eproto::InitDefaults();
   return *internal_default_instance();
 }
 
-GetRouteRequest* GetRouteRequest::New(::google::protobuf::Arena* arena) const {
-  GetRouteRequest* n = new GetRouteRequest;
+GetNodeRequest* GetNodeRequest::New(::google::protobuf::Arena* arena) const {
+  GetNodeRequest* n = new GetNodeRequest;
   if (arena != NULL) {
     arena->Own(n);
   }
   return n;
 }
 
-void GetRouteRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:mspb.GetRouteRequest)
+void GetNodeRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:mspb.GetNodeRequest)
   ::google::protobuf::uint32 cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  key_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   if (GetArenaNoVirtual() == NULL && header_ != NULL) {
     delete header_;
   }
   header_ = NULL;
-  ::memset(&db_id_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&table_id_) -
-      reinterpret_cast<char*>(&db_id_)) + sizeof(table_id_));
+  id_ = GOOGLE_ULONGLONG(0);
   _internal_metadata_.Clear();
 }
 
-bool GetRouteRequest::MergePartialFromCodedStream(
+bool GetNodeRequest::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:mspb.GetRouteRequest)
+  // @@protoc_insertion_point(parse_start:mspb.GetNodeRequest)
   for (;;) {
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
     tag = p.first;
@@ -10019,40 +13053,14 @@ bool GetRouteRequest::MergePartialFromCodedStream(
         break;
       }
 
-      // uint64 db_id = 2;
+      // uint64 id = 2;
       case 2: {
         if (static_cast< ::google::protobuf::uint8>(tag) ==
             static_cast< ::google::protobuf::uint8>(16u /* 16 & 0xFF */)) {
 
           DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
                    ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
-                 input, &db_id_)));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // uint64 table_id = 3;
-      case 3: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(24u /* 24 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
-                 input, &table_id_)));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // bytes key = 4;
-      case 4: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(34u /* 34 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
-                input, this->mutable_key()));
+                 input, &id_)));
         } else {
           goto handle_unusual;
         }
@@ -10071,17 +13079,17 @@ bool GetRouteRequest::MergePartialFromCodedStream(
     }
   }
 success:
-  // @@protoc_insertion_point(parse_success:mspb.GetRouteRequest)
+  // @@protoc_insertion_point(parse_success:mspb.GetNodeRequest)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:mspb.GetRouteRequest)
+  // @@protoc_insertion_point(parse_failure:mspb.GetNodeRequest)
   return false;
 #undef DO_
 }
 
-void GetRouteRequest::SerializeWithCachedSizes(
+void GetNodeRequest::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:mspb.GetRouteRequest)
+  // @@protoc_insertion_point(serialize_start:mspb.GetNodeRequest)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
@@ -10091,33 +13099,22 @@ void GetRouteRequest::SerializeWithCachedSizes(
       1, *this->header_, output);
   }
 
-  // uint64 db_id = 2;
-  if (this->db_id() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt64(2, this->db_id(), output);
-  }
-
-  // uint64 table_id = 3;
-  if (this->table_id() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt64(3, this->table_id(), output);
-  }
-
-  // bytes key = 4;
-  if (this->key().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteBytesMaybeAliased(
-      4, this->key(), output);
+  // uint64 id = 2;
+  if (this->id() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(2, this->id(), output);
   }
 
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
     ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
   }
-  // @@protoc_insertion_point(serialize_end:mspb.GetRouteRequest)
+  // @@protoc_insertion_point(serialize_end:mspb.GetNodeRequest)
 }
 
-::google::protobuf::uint8* GetRouteRequest::InternalSerializeWithCachedSizesToArray(
+::google::protobuf::uint8* GetNodeRequest::InternalSerializeWithCachedSizesToArray(
     bool deterministic, ::google::protobuf::uint8* target) const {
   (void)deterministic; // Unused
-  // @@protoc_insertion_point(serialize_to_array_start:mspb.GetRouteRequest)
+  // @@protoc_insertion_point(serialize_to_array_start:mspb.GetNodeRequest)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
@@ -10128,33 +13125,21 @@ void GetRouteRequest::SerializeWithCachedSizes(
         1, *this->header_, deterministic, target);
   }
 
-  // uint64 db_id = 2;
-  if (this->db_id() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(2, this->db_id(), target);
-  }
-
-  // uint64 table_id = 3;
-  if (this->table_id() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(3, this->table_id(), target);
-  }
-
-  // bytes key = 4;
-  if (this->key().size() > 0) {
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteBytesToArray(
-        4, this->key(), target);
+  // uint64 id = 2;
+  if (this->id() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(2, this->id(), target);
   }
 
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
     target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:mspb.GetRouteRequest)
+  // @@protoc_insertion_point(serialize_to_array_end:mspb.GetNodeRequest)
   return target;
 }
 
-size_t GetRouteRequest::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:mspb.GetRouteRequest)
+size_t GetNodeRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mspb.GetNodeRequest)
   size_t total_size = 0;
 
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
@@ -10162,13 +13147,6 @@ size_t GetRouteRequest::ByteSizeLong() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
   }
-  // bytes key = 4;
-  if (this->key().size() > 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::BytesSize(
-        this->key());
-  }
-
   // .mspb.RequestHeader header = 1;
   if (this->has_header()) {
     total_size += 1 +
@@ -10176,18 +13154,11 @@ size_t GetRouteRequest::ByteSizeLong() const {
         *this->header_);
   }
 
-  // uint64 db_id = 2;
-  if (this->db_id() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt64Size(
-        this->db_id());
-  }
-
-  // uint64 table_id = 3;
-  if (this->table_id() != 0) {
+  // uint64 id = 2;
+  if (this->id() != 0) {
     total_size += 1 +
       ::google::protobuf::internal::WireFormatLite::UInt64Size(
-        this->table_id());
+        this->id());
   }
 
   int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
@@ -10197,202 +13168,126 @@ size_t GetRouteRequest::ByteSizeLong() const {
   return total_size;
 }
 
-void GetRouteRequest::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:mspb.GetRouteRequest)
+void GetNodeRequest::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:mspb.GetNodeRequest)
   GOOGLE_DCHECK_NE(&from, this);
-  const GetRouteRequest* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const GetRouteRequest>(
+  const GetNodeRequest* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const GetNodeRequest>(
           &from);
   if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:mspb.GetRouteRequest)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:mspb.GetNodeRequest)
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:mspb.GetRouteRequest)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:mspb.GetNodeRequest)
     MergeFrom(*source);
   }
 }
 
-void GetRouteRequest::MergeFrom(const GetRouteRequest& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:mspb.GetRouteRequest)
+void GetNodeRequest::MergeFrom(const GetNodeRequest& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:mspb.GetNodeRequest)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.key().size() > 0) {
-
-    key_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.key_);
-  }
   if (from.has_header()) {
     mutable_header()->::mspb::RequestHeader::MergeFrom(from.header());
   }
-  if (from.db_id() != 0) {
-    set_db_id(from.db_id());
-  }
-  if (from.table_id() != 0) {
-    set_table_id(from.table_id());
+  if (from.id() != 0) {
+    set_id(from.id());
   }
 }
 
-void GetRouteRequest::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:mspb.GetRouteRequest)
+void GetNodeRequest::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:mspb.GetNodeRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void GetRouteRequest::CopyFrom(const GetRouteRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:mspb.GetRouteRequest)
+void GetNodeRequest::CopyFrom(const GetNodeRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mspb.GetNodeRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool GetRouteRequest::IsInitialized() const {
+bool GetNodeRequest::IsInitialized() const {
   return true;
 }
 
-void GetRouteRequest::Swap(GetRouteRequest* other) {
+void GetNodeRequest::Swap(GetNodeRequest* other) {
   if (other == this) return;
   InternalSwap(other);
 }
-void GetRouteRequest::InternalSwap(GetRouteRequest* other) {
+void GetNodeRequest::InternalSwap(GetNodeRequest* other) {
   using std::swap;
-  key_.Swap(&other->key_);
   swap(header_, other->header_);
-  swap(db_id_, other->db_id_);
-  swap(table_id_, other->table_id_);
+  swap(id_, other->id_);
   _internal_metadata_.Swap(&other->_internal_metadata_);
   swap(_cached_size_, other->_cached_size_);
 }
 
-::google::protobuf::Metadata GetRouteRequest::GetMetadata() const {
+::google::protobuf::Metadata GetNodeRequest::GetMetadata() const {
   protobuf_mspb_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_mspb_2eproto::file_level_metadata[kIndexInFileMessages];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
-// GetRouteRequest
+// GetNodeRequest
 
 // .mspb.RequestHeader header = 1;
-bool GetRouteRequest::has_header() const {
+bool GetNodeRequest::has_header() const {
   return this != internal_default_instance() && header_ != NULL;
 }
-void GetRouteRequest::clear_header() {
-  if (GetArenaNoVirtual() == NULL && header_ != NULL) delete header_;
-  header_ = NULL;
-}
-const ::mspb::RequestHeader& GetRouteRequest::header() const {
-  const ::mspb::RequestHeader* p = header_;
-  // @@protoc_insertion_point(field_get:mspb.GetRouteRequest.header)
-  return p != NULL ? *p : *reinterpret_cast<const ::mspb::RequestHeader*>(
-      &::mspb::_RequestHeader_default_instance_);
-}
-::mspb::RequestHeader* GetRouteRequest::mutable_header() {
-  
-  if (header_ == NULL) {
-    header_ = new ::mspb::RequestHeader;
-  }
-  // @@protoc_insertion_point(field_mutable:mspb.GetRouteRequest.header)
-  return header_;
-}
-::mspb::RequestHeader* GetRouteRequest::release_header() {
-  // @@protoc_insertion_point(field_release:mspb.GetRouteRequest.header)
-  
-  ::mspb::RequestHeader* temp = header_;
-  header_ = NULL;
-  return temp;
-}
-void GetRouteRequest::set_allocated_header(::mspb::RequestHeader* header) {
-  delete header_;
-  header_ = header;
-  if (header) {
-    
-  } else {
-    
-  }
-  // @@protoc_insertion_point(field_set_allocated:mspb.GetRouteRequest.header)
-}
-
-// uint64 db_id = 2;
-void GetRouteRequest::clear_db_id() {
-  db_id_ = GOOGLE_ULONGLONG(0);
-}
-::google::protobuf::uint64 GetRouteRequest::db_id() const {
-  // @@protoc_insertion_point(field_get:mspb.GetRouteRequest.db_id)
-  return db_id_;
-}
-void GetRouteRequest::set_db_id(::google::protobuf::uint64 value) {
-  
-  db_id_ = value;
-  // @@protoc_insertion_point(field_set:mspb.GetRouteRequest.db_id)
-}
-
-// uint64 table_id = 3;
-void GetRouteRequest::clear_table_id() {
-  table_id_ = GOOGLE_ULONGLONG(0);
-}
-::google::protobuf::uint64 GetRouteRequest::table_id() const {
-  // @@protoc_insertion_point(field_get:mspb.GetRouteRequest.table_id)
-  return table_id_;
-}
-void GetRouteRequest::set_table_id(::google::protobuf::uint64 value) {
-  
-  table_id_ = value;
-  // @@protoc_insertion_point(field_set:mspb.GetRouteRequest.table_id)
-}
-
-// bytes key = 4;
-void GetRouteRequest::clear_key() {
-  key_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-const ::std::string& GetRouteRequest::key() const {
-  // @@protoc_insertion_point(field_get:mspb.GetRouteRequest.key)
-  return key_.GetNoArena();
-}
-void GetRouteRequest::set_key(const ::std::string& value) {
-  
-  key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:mspb.GetRouteRequest.key)
-}
-#if LANG_CXX11
-void GetRouteRequest::set_key(::std::string&& value) {
-  
-  key_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:mspb.GetRouteRequest.key)
-}
-#endif
-void GetRouteRequest::set_key(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:mspb.GetRouteRequest.key)
-}
-void GetRouteRequest::set_key(const void* value, size_t size) {
-  
-  key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:mspb.GetRouteRequest.key)
+void GetNodeRequest::clear_header() {
+  if (GetArenaNoVirtual() == NULL && header_ != NULL) delete header_;
+  header_ = NULL;
 }
-::std::string* GetRouteRequest::mutable_key() {
+const ::mspb::RequestHeader& GetNodeRequest::header() const {
+  const ::mspb::RequestHeader* p = header_;
+  // @@protoc_insertion_point(field_get:mspb.GetNodeRequest.header)
+  return p != NULL ? *p : *reinterpret_cast<const ::mspb::RequestHeader*>(
+      &::mspb::_RequestHeader_default_instance_);
+}
+::mspb::RequestHeader* GetNodeRequest::mutable_header() {
   
-  // @@protoc_insertion_point(field_mutable:mspb.GetRouteRequest.key)
-  return key_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (header_ == NULL) {
+    header_ = new ::mspb::RequestHeader;
+  }
+  // @@protoc_insertion_point(field_mutable:mspb.GetNodeRequest.header)
+  return header_;
 }
-::std::string* GetRouteRequest::release_key() {
-  // @@protoc_insertion_point(field_release:mspb.GetRouteRequest.key)
+::mspb::RequestHeader* GetNodeRequest::release_header() {
+  // @@protoc_insertion_point(field_release:mspb.GetNodeRequest.header)
   
-  return key_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::mspb::RequestHeader* temp = header_;
+  header_ = NULL;
+  return temp;
 }
-void GetRouteRequest::set_allocated_key(::std::string* key) {
-  if (key != NULL) {
+void GetNodeRequest::set_allocated_header(::mspb::RequestHeader* header) {
+  delete header_;
+  header_ = header;
+  if (header) {
     
   } else {
     
   }
-  key_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), key);
-  // @@protoc_insertion_point(field_set_allocated:mspb.GetRouteRequest.key)
+  // @@protoc_insertion_point(field_set_allocated:mspb.GetNodeRequest.header)
+}
+
+// uint64 id = 2;
+void GetNodeRequest::clear_id() {
+  id_ = GOOGLE_ULONGLONG(0);
+}
+::google::protobuf::uint64 GetNodeRequest::id() const {
+  // @@protoc_insertion_point(field_get:mspb.GetNodeRequest.id)
+  return id_;
+}
+void GetNodeRequest::set_id(::google::protobuf::uint64 value) {
+  
+  id_ = value;
+  // @@protoc_insertion_point(field_set:mspb.GetNodeRequest.id)
 }
 
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -10400,22 +13295,21 @@ void GetRouteRequest::set_allocated_key(::std::string* key) {
 // ===================================================================
 
 #if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int GetRouteResponse::kHeaderFieldNumber;
-const int GetRouteResponse::kRoutesFieldNumber;
+const int GetNodeResponse::kHeaderFieldNumber;
+const int GetNodeResponse::kNodeFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
-GetRouteResponse::GetRouteResponse()
+GetNodeResponse::GetNodeResponse()
   : ::google::protobuf::Message(), _internal_metadata_(NULL) {
   if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
     protobuf_mspb_2eproto::InitDefaults();
   }
   SharedCtor();
-  // @@protoc_insertion_point(constructor:mspb.GetRouteResponse)
+  // @@protoc_insertion_point(constructor:mspb.GetNodeResponse)
 }
-GetRouteResponse::GetRouteResponse(const GetRouteResponse& from)
+GetNodeResponse::GetNodeResponse(const GetNodeResponse& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
-      routes_(from.routes_),
       _cached_size_(0) {
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   if (from.has_header()) {
@@ -10423,65 +13317,76 @@ GetRouteResponse::GetRouteResponse(const GetRouteResponse& from)
   } else {
     header_ = NULL;
   }
-  // @@protoc_insertion_point(copy_constructor:mspb.GetRouteResponse)
+  if (from.has_node()) {
+    node_ = new ::metapb::Node(*from.node_);
+  } else {
+    node_ = NULL;
+  }
+  // @@protoc_insertion_point(copy_constructor:mspb.GetNodeResponse)
 }
 
-void GetRouteResponse::SharedCtor() {
-  header_ = NULL;
+void GetNodeResponse::SharedCtor() {
+  ::memset(&header_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&node_) -
+      reinterpret_cast<char*>(&header_)) + sizeof(node_));
   _cached_size_ = 0;
 }
 
-GetRouteResponse::~GetRouteResponse() {
-  // @@protoc_insertion_point(destructor:mspb.GetRouteResponse)
+GetNodeResponse::~GetNodeResponse() {
+  // @@protoc_insertion_point(destructor:mspb.GetNodeResponse)
   SharedDtor();
 }
 
-void GetRouteResponse::SharedDtor() {
+void GetNodeResponse::SharedDtor() {
   if (this != internal_default_instance()) delete header_;
+  if (this != internal_default_instance()) delete node_;
 }
 
-void GetRouteResponse::SetCachedSize(int size) const {
+void GetNodeResponse::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* GetRouteResponse::descriptor() {
+const ::google::protobuf::Descriptor* GetNodeResponse::descriptor() {
   protobuf_mspb_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_mspb_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
 }
 
-const GetRouteResponse& GetRouteResponse::default_instance() {
+const GetNodeResponse& GetNodeResponse::default_instance() {
   protobuf_mspb_2eproto::InitDefaults();
   return *internal_default_instance();
 }
 
-GetRouteResponse* GetRouteResponse::New(::google::protobuf::Arena* arena) const {
-  GetRouteResponse* n = new GetRouteResponse;
+GetNodeResponse* GetNodeResponse::New(::google::protobuf::Arena* arena) const {
+  GetNodeResponse* n = new GetNodeResponse;
   if (arena != NULL) {
     arena->Own(n);
   }
   return n;
 }
 
-void GetRouteResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:mspb.GetRouteResponse)
+void GetNodeResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:mspb.GetNodeResponse)
   ::google::protobuf::uint32 cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  routes_.Clear();
   if (GetArenaNoVirtual() == NULL && header_ != NULL) {
     delete header_;
   }
   header_ = NULL;
+  if (GetArenaNoVirtual() == NULL && node_ != NULL) {
+    delete node_;
+  }
+  node_ = NULL;
   _internal_metadata_.Clear();
 }
 
-bool GetRouteResponse::MergePartialFromCodedStream(
+bool GetNodeResponse::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:mspb.GetRouteResponse)
+  // @@protoc_insertion_point(parse_start:mspb.GetNodeResponse)
   for (;;) {
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
     tag = p.first;
@@ -10499,12 +13404,12 @@ bool GetRouteResponse::MergePartialFromCodedStream(
         break;
       }
 
-      // repeated .metapb.Route routes = 2;
+      // .metapb.Node node = 2;
       case 2: {
         if (static_cast< ::google::protobuf::uint8>(tag) ==
             static_cast< ::google::protobuf::uint8>(18u /* 18 & 0xFF */)) {
           DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-                input, add_routes()));
+               input, mutable_node()));
         } else {
           goto handle_unusual;
         }
@@ -10523,17 +13428,17 @@ bool GetRouteResponse::MergePartialFromCodedStream(
     }
   }
 success:
-  // @@protoc_insertion_point(parse_success:mspb.GetRouteResponse)
+  // @@protoc_insertion_point(parse_success:mspb.GetNodeResponse)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:mspb.GetRouteResponse)
+  // @@protoc_insertion_point(parse_failure:mspb.GetNodeResponse)
   return false;
 #undef DO_
 }
 
-void GetRouteResponse::SerializeWithCachedSizes(
+void GetNodeResponse::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:mspb.GetRouteResponse)
+  // @@protoc_insertion_point(serialize_start:mspb.GetNodeResponse)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
@@ -10543,24 +13448,23 @@ void GetRouteResponse::SerializeWithCachedSizes(
       1, *this->header_, output);
   }
 
-  // repeated .metapb.Route routes = 2;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->routes_size()); i < n; i++) {
+  // .metapb.Node node = 2;
+  if (this->has_node()) {
     ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      2, this->routes(static_cast<int>(i)), output);
+      2, *this->node_, output);
   }
 
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
     ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
   }
-  // @@protoc_insertion_point(serialize_end:mspb.GetRouteResponse)
+  // @@protoc_insertion_point(serialize_end:mspb.GetNodeResponse)
 }
 
-::google::protobuf::uint8* GetRouteResponse::InternalSerializeWithCachedSizesToArray(
+::google::protobuf::uint8* GetNodeResponse::InternalSerializeWithCachedSizesToArray(
     bool deterministic, ::google::protobuf::uint8* target) const {
   (void)deterministic; // Unused
-  // @@protoc_insertion_point(serialize_to_array_start:mspb.GetRouteResponse)
+  // @@protoc_insertion_point(serialize_to_array_start:mspb.GetNodeResponse)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
@@ -10571,24 +13475,23 @@ void GetRouteResponse::SerializeWithCachedSizes(
         1, *this->header_, deterministic, target);
   }
 
-  // repeated .metapb.Route routes = 2;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->routes_size()); i < n; i++) {
+  // .metapb.Node node = 2;
+  if (this->has_node()) {
     target = ::google::protobuf::internal::WireFormatLite::
       InternalWriteMessageNoVirtualToArray(
-        2, this->routes(static_cast<int>(i)), deterministic, target);
+        2, *this->node_, deterministic, target);
   }
 
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
     target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:mspb.GetRouteResponse)
+  // @@protoc_insertion_point(serialize_to_array_end:mspb.GetNodeResponse)
   return target;
 }
 
-size_t GetRouteResponse::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:mspb.GetRouteResponse)
+size_t GetNodeResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mspb.GetNodeResponse)
   size_t total_size = 0;
 
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
@@ -10596,17 +13499,6 @@ size_t GetRouteResponse::ByteSizeLong() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
   }
-  // repeated .metapb.Route routes = 2;
-  {
-    unsigned int count = static_cast<unsigned int>(this->routes_size());
-    total_size += 1UL * count;
-    for (unsigned int i = 0; i < count; i++) {
-      total_size +=
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->routes(static_cast<int>(i)));
-    }
-  }
-
   // .mspb.ResponseHeader header = 1;
   if (this->has_header()) {
     total_size += 1 +
@@ -10614,6 +13506,13 @@ size_t GetRouteResponse::ByteSizeLong() const {
         *this->header_);
   }
 
+  // .metapb.Node node = 2;
+  if (this->has_node()) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+        *this->node_);
+  }
+
   int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = cached_size;
@@ -10621,102 +13520,104 @@ size_t GetRouteResponse::ByteSizeLong() const {
   return total_size;
 }
 
-void GetRouteResponse::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:mspb.GetRouteResponse)
+void GetNodeResponse::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:mspb.GetNodeResponse)
   GOOGLE_DCHECK_NE(&from, this);
-  const GetRouteResponse* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const GetRouteResponse>(
+  const GetNodeResponse* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const GetNodeResponse>(
           &from);
   if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:mspb.GetRouteResponse)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:mspb.GetNodeResponse)
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:mspb.GetRouteResponse)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:mspb.GetNodeResponse)
     MergeFrom(*source);
   }
 }
 
-void GetRouteResponse::MergeFrom(const GetRouteResponse& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:mspb.GetRouteResponse)
+void GetNodeResponse::MergeFrom(const GetNodeResponse& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:mspb.GetNodeResponse)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  routes_.MergeFrom(from.routes_);
   if (from.has_header()) {
     mutable_header()->::mspb::ResponseHeader::MergeFrom(from.header());
   }
+  if (from.has_node()) {
+    mutable_node()->::metapb::Node::MergeFrom(from.node());
+  }
 }
 
-void GetRouteResponse::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:mspb.GetRouteResponse)
+void GetNodeResponse::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:mspb.GetNodeResponse)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void GetRouteResponse::CopyFrom(const GetRouteResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:mspb.GetRouteResponse)
+void GetNodeResponse::CopyFrom(const GetNodeResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mspb.GetNodeResponse)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool GetRouteResponse::IsInitialized() const {
+bool GetNodeResponse::IsInitialized() const {
   return true;
 }
 
-void GetRouteResponse::Swap(GetRouteResponse* other) {
+void GetNodeResponse::Swap(GetNodeResponse* other) {
   if (other == this) return;
   InternalSwap(other);
 }
-void GetRouteResponse::InternalSwap(GetRouteResponse* other) {
+void GetNodeResponse::InternalSwap(GetNodeResponse* other) {
   using std::swap;
-  routes_.InternalSwap(&other->routes_);
   swap(header_, other->header_);
+  swap(node_, other->node_);
   _internal_metadata_.Swap(&other->_internal_metadata_);
   swap(_cached_size_, other->_cached_size_);
 }
 
-::google::protobuf::Metadata GetRouteResponse::GetMetadata() const {
+::google::protobuf::Metadata GetNodeResponse::GetMetadata() const {
   protobuf_mspb_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_mspb_2eproto::file_level_metadata[kIndexInFileMessages];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
-// GetRouteResponse
+// GetNodeResponse
 
 // .mspb.ResponseHeader header = 1;
-bool GetRouteResponse::has_header() const {
+bool GetNodeResponse::has_header() const {
   return this != internal_default_instance() && header_ != NULL;
 }
-void GetRouteResponse::clear_header() {
+void GetNodeResponse::clear_header() {
   if (GetArenaNoVirtual() == NULL && header_ != NULL) delete header_;
   header_ = NULL;
 }
-const ::mspb::ResponseHeader& GetRouteResponse::header() const {
+const ::mspb::ResponseHeader& GetNodeResponse::header() const {
   const ::mspb::ResponseHeader* p = header_;
-  // @@protoc_insertion_point(field_get:mspb.GetRouteResponse.header)
+  // @@protoc_insertion_point(field_get:mspb.GetNodeResponse.header)
   return p != NULL ? *p : *reinterpret_cast<const ::mspb::ResponseHeader*>(
       &::mspb::_ResponseHeader_default_instance_);
 }
-::mspb::ResponseHeader* GetRouteResponse::mutable_header() {
+::mspb::ResponseHeader* GetNodeResponse::mutable_header() {
   
   if (header_ == NULL) {
     header_ = new ::mspb::ResponseHeader;
   }
-  // @@protoc_insertion_point(field_mutable:mspb.GetRouteResponse.header)
+  // @@protoc_insertion_point(field_mutable:mspb.GetNodeResponse.header)
   return header_;
 }
-::mspb::ResponseHeader* GetRouteResponse::release_header() {
-  // @@protoc_insertion_point(field_release:mspb.GetRouteResponse.header)
+::mspb::ResponseHeader* GetNodeResponse::release_header() {
+  // @@protoc_insertion_point(field_release:mspb.GetNodeResponse.header)
   
   ::mspb::ResponseHeader* temp = header_;
   header_ = NULL;
   return temp;
 }
-void GetRouteResponse::set_allocated_header(::mspb::ResponseHeader* header) {
+void GetNodeResponse::set_allocated_header(::mspb::ResponseHeader* header) {
   delete header_;
   header_ = header;
   if (header) {
@@ -10724,37 +13625,47 @@ void GetRouteResponse::set_allocated_header(::mspb::ResponseHeader* header) {
   } else {
     
   }
-  // @@protoc_insertion_point(field_set_allocated:mspb.GetRouteResponse.header)
+  // @@protoc_insertion_point(field_set_allocated:mspb.GetNodeResponse.header)
 }
 
-// repeated .metapb.Route routes = 2;
-int GetRouteResponse::routes_size() const {
-  return routes_.size();
-}
-void GetRouteResponse::clear_routes() {
-  routes_.Clear();
-}
-const ::metapb::Route& GetRouteResponse::routes(int index) const {
-  // @@protoc_insertion_point(field_get:mspb.GetRouteResponse.routes)
-  return routes_.Get(index);
+// .metapb.Node node = 2;
+bool GetNodeResponse::has_node() const {
+  return this != internal_default_instance() && node_ != NULL;
 }
-::metapb::Route* GetRouteResponse::mutable_routes(int index) {
-  // @@protoc_insertion_point(field_mutable:mspb.GetRouteResponse.routes)
-  return routes_.Mutable(index);
+void GetNodeResponse::clear_node() {
+  if (GetArenaNoVirtual() == NULL && node_ != NULL) delete node_;
+  node_ = NULL;
 }
-::metapb::Route* GetRouteResponse::add_routes() {
-  // @@protoc_insertion_point(field_add:mspb.GetRouteResponse.routes)
-  return routes_.Add();
+const ::metapb::Node& GetNodeResponse::node() const {
+  const ::metapb::Node* p = node_;
+  // @@protoc_insertion_point(field_get:mspb.GetNodeResponse.node)
+  return p != NULL ? *p : *reinterpret_cast<const ::metapb::Node*>(
+      &::metapb::_Node_default_instance_);
 }
-::google::protobuf::RepeatedPtrField< ::metapb::Route >*
-GetRouteResponse::mutable_routes() {
-  // @@protoc_insertion_point(field_mutable_list:mspb.GetRouteResponse.routes)
-  return &routes_;
+::metapb::Node* GetNodeResponse::mutable_node() {
+  
+  if (node_ == NULL) {
+    node_ = new ::metapb::Node;
+  }
+  // @@protoc_insertion_point(field_mutable:mspb.GetNodeResponse.node)
+  return node_;
 }
-const ::google::protobuf::RepeatedPtrField< ::metapb::Route >&
-GetRouteResponse::routes() const {
-  // @@protoc_insertion_point(field_list:mspb.GetRouteResponse.routes)
-  return routes_;
+::metapb::Node* GetNodeResponse::release_node() {
+  // @@protoc_insertion_point(field_release:mspb.GetNodeResponse.node)
+  
+  ::metapb::Node* temp = node_;
+  node_ = NULL;
+  return temp;
+}
+void GetNodeResponse::set_allocated_node(::metapb::Node* node) {
+  delete node_;
+  node_ = node;
+  if (node) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_set_allocated:mspb.GetNodeResponse.node)
 }
 
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -10762,90 +13673,93 @@ GetRouteResponse::routes() const {
 // ===================================================================
 
 #if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int GetNodeRequest::kHeaderFieldNumber;
-const int GetNodeRequest::kIdFieldNumber;
+const int GetDBRequest::kHeaderFieldNumber;
+const int GetDBRequest::kNameFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
-GetNodeRequest::GetNodeRequest()
+GetDBRequest::GetDBRequest()
   : ::google::protobuf::Message(), _internal_metadata_(NULL) {
   if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
     protobuf_mspb_2eproto::InitDefaults();
   }
   SharedCtor();
-  // @@protoc_insertion_point(constructor:mspb.GetNodeRequest)
+  // @@protoc_insertion_point(constructor:mspb.GetDBRequest)
 }
-GetNodeRequest::GetNodeRequest(const GetNodeRequest& from)
+GetDBRequest::GetDBRequest(const GetDBRequest& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
       _cached_size_(0) {
   _internal_metadata_.MergeFrom(from._internal_metadata_);
+  name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (from.name().size() > 0) {
+    name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.name_);
+  }
   if (from.has_header()) {
     header_ = new ::mspb::RequestHeader(*from.header_);
   } else {
     header_ = NULL;
   }
-  id_ = from.id_;
-  // @@protoc_insertion_point(copy_constructor:mspb.GetNodeRequest)
+  // @@protoc_insertion_point(copy_constructor:mspb.GetDBRequest)
 }
 
-void GetNodeRequest::SharedCtor() {
-  ::memset(&header_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&id_) -
-      reinterpret_cast<char*>(&header_)) + sizeof(id_));
+void GetDBRequest::SharedCtor() {
+  name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  header_ = NULL;
   _cached_size_ = 0;
 }
 
-GetNodeRequest::~GetNodeRequest() {
-  // @@protoc_insertion_point(destructor:mspb.GetNodeRequest)
+GetDBRequest::~GetDBRequest() {
+  // @@protoc_insertion_point(destructor:mspb.GetDBRequest)
   SharedDtor();
 }
 
-void GetNodeRequest::SharedDtor() {
+void GetDBRequest::SharedDtor() {
+  name_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   if (this != internal_default_instance()) delete header_;
 }
 
-void GetNodeRequest::SetCachedSize(int size) const {
+void GetDBRequest::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* GetNodeRequest::descriptor() {
+const ::google::protobuf::Descriptor* GetDBRequest::descriptor() {
   protobuf_mspb_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_mspb_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
 }
 
-const GetNodeRequest& GetNodeRequest::default_instance() {
+const GetDBRequest& GetDBRequest::default_instance() {
   protobuf_mspb_2eproto::InitDefaults();
   return *internal_default_instance();
 }
 
-GetNodeRequest* GetNodeRequest::New(::google::protobuf::Arena* arena) const {
-  GetNodeRequest* n = new GetNodeRequest;
+GetDBRequest* GetDBRequest::New(::google::protobuf::Arena* arena) const {
+  GetDBRequest* n = new GetDBRequest;
   if (arena != NULL) {
     arena->Own(n);
   }
   return n;
 }
 
-void GetNodeRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:mspb.GetNodeRequest)
+void GetDBRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:mspb.GetDBRequest)
   ::google::protobuf::uint32 cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
+  name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   if (GetArenaNoVirtual() == NULL && header_ != NULL) {
     delete header_;
   }
   header_ = NULL;
-  id_ = GOOGLE_ULONGLONG(0);
   _internal_metadata_.Clear();
 }
 
-bool GetNodeRequest::MergePartialFromCodedStream(
+bool GetDBRequest::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:mspb.GetNodeRequest)
+  // @@protoc_insertion_point(parse_start:mspb.GetDBRequest)
   for (;;) {
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
     tag = p.first;
@@ -10863,14 +13777,16 @@ bool GetNodeRequest::MergePartialFromCodedStream(
         break;
       }
 
-      // uint64 id = 2;
+      // string name = 2;
       case 2: {
         if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(16u /* 16 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
-                 input, &id_)));
+            static_cast< ::google::protobuf::uint8>(18u /* 18 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_name()));
+          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+            this->name().data(), static_cast<int>(this->name().length()),
+            ::google::protobuf::internal::WireFormatLite::PARSE,
+            "mspb.GetDBRequest.name"));
         } else {
           goto handle_unusual;
         }
@@ -10889,17 +13805,17 @@ bool GetNodeRequest::MergePartialFromCodedStream(
     }
   }
 success:
-  // @@protoc_insertion_point(parse_success:mspb.GetNodeRequest)
+  // @@protoc_insertion_point(parse_success:mspb.GetDBRequest)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:mspb.GetNodeRequest)
+  // @@protoc_insertion_point(parse_failure:mspb.GetDBRequest)
   return false;
 #undef DO_
 }
 
-void GetNodeRequest::SerializeWithCachedSizes(
+void GetDBRequest::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:mspb.GetNodeRequest)
+  // @@protoc_insertion_point(serialize_start:mspb.GetDBRequest)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
@@ -10909,22 +13825,27 @@ void GetNodeRequest::SerializeWithCachedSizes(
       1, *this->header_, output);
   }
 
-  // uint64 id = 2;
-  if (this->id() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt64(2, this->id(), output);
+  // string name = 2;
+  if (this->name().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+      this->name().data(), static_cast<int>(this->name().length()),
+      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+      "mspb.GetDBRequest.name");
+    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
+      2, this->name(), output);
   }
 
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
     ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
   }
-  // @@protoc_insertion_point(serialize_end:mspb.GetNodeRequest)
+  // @@protoc_insertion_point(serialize_end:mspb.GetDBRequest)
 }
 
-::google::protobuf::uint8* GetNodeRequest::InternalSerializeWithCachedSizesToArray(
+::google::protobuf::uint8* GetDBRequest::InternalSerializeWithCachedSizesToArray(
     bool deterministic, ::google::protobuf::uint8* target) const {
   (void)deterministic; // Unused
-  // @@protoc_insertion_point(serialize_to_array_start:mspb.GetNodeRequest)
+  // @@protoc_insertion_point(serialize_to_array_start:mspb.GetDBRequest)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
@@ -10935,21 +13856,27 @@ void GetNodeRequest::SerializeWithCachedSizes(
         1, *this->header_, deterministic, target);
   }
 
-  // uint64 id = 2;
-  if (this->id() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(2, this->id(), target);
+  // string name = 2;
+  if (this->name().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+      this->name().data(), static_cast<int>(this->name().length()),
+      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+      "mspb.GetDBRequest.name");
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        2, this->name(), target);
   }
 
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
     target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:mspb.GetNodeRequest)
+  // @@protoc_insertion_point(serialize_to_array_end:mspb.GetDBRequest)
   return target;
 }
 
-size_t GetNodeRequest::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:mspb.GetNodeRequest)
+size_t GetDBRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mspb.GetDBRequest)
   size_t total_size = 0;
 
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
@@ -10957,6 +13884,13 @@ size_t GetNodeRequest::ByteSizeLong() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
   }
+  // string name = 2;
+  if (this->name().size() > 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::StringSize(
+        this->name());
+  }
+
   // .mspb.RequestHeader header = 1;
   if (this->has_header()) {
     total_size += 1 +
@@ -10964,13 +13898,6 @@ size_t GetNodeRequest::ByteSizeLong() const {
         *this->header_);
   }
 
-  // uint64 id = 2;
-  if (this->id() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt64Size(
-        this->id());
-  }
-
   int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = cached_size;
@@ -10978,104 +13905,105 @@ size_t GetNodeRequest::ByteSizeLong() const {
   return total_size;
 }
 
-void GetNodeRequest::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:mspb.GetNodeRequest)
+void GetDBRequest::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:mspb.GetDBRequest)
   GOOGLE_DCHECK_NE(&from, this);
-  const GetNodeRequest* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const GetNodeRequest>(
+  const GetDBRequest* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const GetDBRequest>(
           &from);
   if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:mspb.GetNodeRequest)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:mspb.GetDBRequest)
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:mspb.GetNodeRequest)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:mspb.GetDBRequest)
     MergeFrom(*source);
   }
 }
 
-void GetNodeRequest::MergeFrom(const GetNodeRequest& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:mspb.GetNodeRequest)
+void GetDBRequest::MergeFrom(const GetDBRequest& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:mspb.GetDBRequest)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
+  if (from.name().size() > 0) {
+
+    name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.name_);
+  }
   if (from.has_header()) {
     mutable_header()->::mspb::RequestHeader::MergeFrom(from.header());
   }
-  if (from.id() != 0) {
-    set_id(from.id());
-  }
 }
 
-void GetNodeRequest::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:mspb.GetNodeRequest)
+void GetDBRequest::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:mspb.GetDBRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void GetNodeRequest::CopyFrom(const GetNodeRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:mspb.GetNodeRequest)
+void GetDBRequest::CopyFrom(const GetDBRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mspb.GetDBRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool GetNodeRequest::IsInitialized() const {
+bool GetDBRequest::IsInitialized() const {
   return true;
 }
 
-void GetNodeRequest::Swap(GetNodeRequest* other) {
+void GetDBRequest::Swap(GetDBRequest* other) {
   if (other == this) return;
   InternalSwap(other);
 }
-void GetNodeRequest::InternalSwap(GetNodeRequest* other) {
+void GetDBRequest::InternalSwap(GetDBRequest* other) {
   using std::swap;
+  name_.Swap(&other->name_);
   swap(header_, other->header_);
-  swap(id_, other->id_);
   _internal_metadata_.Swap(&other->_internal_metadata_);
   swap(_cached_size_, other->_cached_size_);
 }
 
-::google::protobuf::Metadata GetNodeRequest::GetMetadata() const {
+::google::protobuf::Metadata GetDBRequest::GetMetadata() const {
   protobuf_mspb_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_mspb_2eproto::file_level_metadata[kIndexInFileMessages];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
-// GetNodeRequest
+// GetDBRequest
 
 // .mspb.RequestHeader header = 1;
-bool GetNodeRequest::has_header() const {
+bool GetDBRequest::has_header() const {
   return this != internal_default_instance() && header_ != NULL;
 }
-void GetNodeRequest::clear_header() {
+void GetDBRequest::clear_header() {
   if (GetArenaNoVirtual() == NULL && header_ != NULL) delete header_;
   header_ = NULL;
 }
-const ::mspb::RequestHeader& GetNodeRequest::header() const {
+const ::mspb::RequestHeader& GetDBRequest::header() const {
   const ::mspb::RequestHeader* p = header_;
-  // @@protoc_insertion_point(field_get:mspb.GetNodeRequest.header)
+  // @@protoc_insertion_point(field_get:mspb.GetDBRequest.header)
   return p != NULL ? *p : *reinterpret_cast<const ::mspb::RequestHeader*>(
       &::mspb::_RequestHeader_default_instance_);
 }
-::mspb::RequestHeader* GetNodeRequest::mutable_header() {
+::mspb::RequestHeader* GetDBRequest::mutable_header() {
   
   if (header_ == NULL) {
     header_ = new ::mspb::RequestHeader;
   }
-  // @@protoc_insertion_point(field_mutable:mspb.GetNodeRequest.header)
+  // @@protoc_insertion_point(field_mutable:mspb.GetDBRequest.header)
   return header_;
 }
-::mspb::RequestHeader* GetNodeRequest::release_header() {
-  // @@protoc_insertion_point(field_release:mspb.GetNodeRequest.header)
+::mspb::RequestHeader* GetDBRequest::release_header() {
+  // @@protoc_insertion_point(field_release:mspb.GetDBRequest.header)
   
   ::mspb::RequestHeader* temp = header_;
   header_ = NULL;
   return temp;
 }
-void GetNodeRequest::set_allocated_header(::mspb::RequestHeader* header) {
+void GetDBRequest::set_allocated_header(::mspb::RequestHeader* header) {
   delete header_;
   header_ = header;
   if (header) {
@@ -11083,21 +14011,60 @@ void GetNodeRequest::set_allocated_header(::mspb::RequestHeader* header) {
   } else {
     
   }
-  // @@protoc_insertion_point(field_set_allocated:mspb.GetNodeRequest.header)
-}
-
-// uint64 id = 2;
-void GetNodeRequest::clear_id() {
-  id_ = GOOGLE_ULONGLONG(0);
-}
-::google::protobuf::uint64 GetNodeRequest::id() const {
-  // @@protoc_insertion_point(field_get:mspb.GetNodeRequest.id)
-  return id_;
-}
-void GetNodeRequest::set_id(::google::protobuf::uint64 value) {
-  
-  id_ = value;
-  // @@protoc_insertion_point(field_set:mspb.GetNodeRequest.id)
+  // @@protoc_insertion_point(field_set_allocated:mspb.GetDBRequest.header)
+}
+
+// string name = 2;
+void GetDBRequest::clear_name() {
+  name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+const ::std::string& GetDBRequest::name() const {
+  // @@protoc_insertion_point(field_get:mspb.GetDBRequest.name)
+  return name_.GetNoArena();
+}
+void GetDBRequest::set_name(const ::std::string& value) {
+  
+  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:mspb.GetDBRequest.name)
+}
+#if LANG_CXX11
+void GetDBRequest::set_name(::std::string&& value) {
+  
+  name_.SetNoArena(
+    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:mspb.GetDBRequest.name)
+}
+#endif
+void GetDBRequest::set_name(const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  
+  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:mspb.GetDBRequest.name)
+}
+void GetDBRequest::set_name(const char* value, size_t size) {
+  
+  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:mspb.GetDBRequest.name)
+}
+::std::string* GetDBRequest::mutable_name() {
+  
+  // @@protoc_insertion_point(field_mutable:mspb.GetDBRequest.name)
+  return name_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+::std::string* GetDBRequest::release_name() {
+  // @@protoc_insertion_point(field_release:mspb.GetDBRequest.name)
+  
+  return name_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+void GetDBRequest::set_allocated_name(::std::string* name) {
+  if (name != NULL) {
+    
+  } else {
+    
+  }
+  name_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), name);
+  // @@protoc_insertion_point(field_set_allocated:mspb.GetDBRequest.name)
 }
 
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -11105,19 +14072,19 @@ void GetNodeRequest::set_id(::google::protobuf::uint64 value) {
 // ===================================================================
 
 #if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int GetNodeResponse::kHeaderFieldNumber;
-const int GetNodeResponse::kNodeFieldNumber;
+const int GetDBResponse::kHeaderFieldNumber;
+const int GetDBResponse::kDbFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
-GetNodeResponse::GetNodeResponse()
+GetDBResponse::GetDBResponse()
   : ::google::protobuf::Message(), _internal_metadata_(NULL) {
   if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
     protobuf_mspb_2eproto::InitDefaults();
   }
   SharedCtor();
-  // @@protoc_insertion_point(constructor:mspb.GetNodeResponse)
+  // @@protoc_insertion_point(constructor:mspb.GetDBResponse)
 }
-GetNodeResponse::GetNodeResponse(const GetNodeResponse& from)
+GetDBResponse::GetDBResponse(const GetDBResponse& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
       _cached_size_(0) {
@@ -11127,56 +14094,56 @@ GetNodeResponse::GetNodeResponse(const GetNodeResponse& from)
   } else {
     header_ = NULL;
   }
-  if (from.has_node()) {
-    node_ = new ::metapb::Node(*from.node_);
+  if (from.has_db()) {
+    db_ = new ::metapb::DataBase(*from.db_);
   } else {
-    node_ = NULL;
+    db_ = NULL;
   }
-  // @@protoc_insertion_point(copy_constructor:mspb.GetNodeResponse)
+  // @@protoc_insertion_point(copy_constructor:mspb.GetDBResponse)
 }
 
-void GetNodeResponse::SharedCtor() {
+void GetDBResponse::SharedCtor() {
   ::memset(&header_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&node_) -
-      reinterpret_cast<char*>(&header_)) + sizeof(node_));
+      reinterpret_cast<char*>(&db_) -
+      reinterpret_cast<char*>(&header_)) + sizeof(db_));
   _cached_size_ = 0;
 }
 
-GetNodeResponse::~GetNodeResponse() {
-  // @@protoc_insertion_point(destructor:mspb.GetNodeResponse)
+GetDBResponse::~GetDBResponse() {
+  // @@protoc_insertion_point(destructor:mspb.GetDBResponse)
   SharedDtor();
 }
 
-void GetNodeResponse::SharedDtor() {
+void GetDBResponse::SharedDtor() {
   if (this != internal_default_instance()) delete header_;
-  if (this != internal_default_instance()) delete node_;
+  if (this != internal_default_instance()) delete db_;
 }
 
-void GetNodeResponse::SetCachedSize(int size) const {
+void GetDBResponse::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* GetNodeResponse::descriptor() {
+const ::google::protobuf::Descriptor* GetDBResponse::descriptor() {
   protobuf_mspb_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_mspb_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
 }
 
-const GetNodeResponse& GetNodeResponse::default_instance() {
+const GetDBResponse& GetDBResponse::default_instance() {
   protobuf_mspb_2eproto::InitDefaults();
   return *internal_default_instance();
 }
 
-GetNodeResponse* GetNodeResponse::New(::google::protobuf::Arena* arena) const {
-  GetNodeResponse* n = new GetNodeResponse;
+GetDBResponse* GetDBResponse::New(::google::protobuf::Arena* arena) const {
+  GetDBResponse* n = new GetDBResponse;
   if (arena != NULL) {
     arena->Own(n);
   }
   return n;
 }
 
-void GetNodeResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:mspb.GetNodeResponse)
+void GetDBResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:mspb.GetDBResponse)
   ::google::protobuf::uint32 cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
@@ -11185,18 +14152,18 @@ void GetNodeResponse::Clear() {
     delete header_;
   }
   header_ = NULL;
-  if (GetArenaNoVirtual() == NULL && node_ != NULL) {
-    delete node_;
+  if (GetArenaNoVirtual() == NULL && db_ != NULL) {
+    delete db_;
   }
-  node_ = NULL;
+  db_ = NULL;
   _internal_metadata_.Clear();
 }
 
-bool GetNodeResponse::MergePartialFromCodedStream(
+bool GetDBResponse::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:mspb.GetNodeResponse)
+  // @@protoc_insertion_point(parse_start:mspb.GetDBResponse)
   for (;;) {
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
     tag = p.first;
@@ -11214,12 +14181,12 @@ bool GetNodeResponse::MergePartialFromCodedStream(
         break;
       }
 
-      // .metapb.Node node = 2;
+      // .metapb.DataBase db = 2;
       case 2: {
         if (static_cast< ::google::protobuf::uint8>(tag) ==
             static_cast< ::google::protobuf::uint8>(18u /* 18 & 0xFF */)) {
           DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_node()));
+               input, mutable_db()));
         } else {
           goto handle_unusual;
         }
@@ -11238,17 +14205,17 @@ bool GetNodeResponse::MergePartialFromCodedStream(
     }
   }
 success:
-  // @@protoc_insertion_point(parse_success:mspb.GetNodeResponse)
+  // @@protoc_insertion_point(parse_success:mspb.GetDBResponse)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:mspb.GetNodeResponse)
+  // @@protoc_insertion_point(parse_failure:mspb.GetDBResponse)
   return false;
 #undef DO_
 }
 
-void GetNodeResponse::SerializeWithCachedSizes(
+void GetDBResponse::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:mspb.GetNodeResponse)
+  // @@protoc_insertion_point(serialize_start:mspb.GetDBResponse)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
@@ -11258,23 +14225,23 @@ void GetNodeResponse::SerializeWithCachedSizes(
       1, *this->header_, output);
   }
 
-  // .metapb.Node node = 2;
-  if (this->has_node()) {
+  // .metapb.DataBase db = 2;
+  if (this->has_db()) {
     ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      2, *this->node_, output);
+      2, *this->db_, output);
   }
 
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
     ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
   }
-  // @@protoc_insertion_point(serialize_end:mspb.GetNodeResponse)
+  // @@protoc_insertion_point(serialize_end:mspb.GetDBResponse)
 }
 
-::google::protobuf::uint8* GetNodeResponse::InternalSerializeWithCachedSizesToArray(
+::google::protobuf::uint8* GetDBResponse::InternalSerializeWithCachedSizesToArray(
     bool deterministic, ::google::protobuf::uint8* target) const {
   (void)deterministic; // Unused
-  // @@protoc_insertion_point(serialize_to_array_start:mspb.GetNodeResponse)
+  // @@protoc_insertion_point(serialize_to_array_start:mspb.GetDBResponse)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
@@ -11285,23 +14252,23 @@ void GetNodeResponse::SerializeWithCachedSizes(
         1, *this->header_, deterministic, target);
   }
 
-  // .metapb.Node node = 2;
-  if (this->has_node()) {
+  // .metapb.DataBase db = 2;
+  if (this->has_db()) {
     target = ::google::protobuf::internal::WireFormatLite::
       InternalWriteMessageNoVirtualToArray(
-        2, *this->node_, deterministic, target);
+        2, *this->db_, deterministic, target);
   }
 
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
     target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:mspb.GetNodeResponse)
+  // @@protoc_insertion_point(serialize_to_array_end:mspb.GetDBResponse)
   return target;
 }
 
-size_t GetNodeResponse::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:mspb.GetNodeResponse)
+size_t GetDBResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mspb.GetDBResponse)
   size_t total_size = 0;
 
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
@@ -11316,11 +14283,11 @@ size_t GetNodeResponse::ByteSizeLong() const {
         *this->header_);
   }
 
-  // .metapb.Node node = 2;
-  if (this->has_node()) {
+  // .metapb.DataBase db = 2;
+  if (this->has_db()) {
     total_size += 1 +
       ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-        *this->node_);
+        *this->db_);
   }
 
   int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
@@ -11330,23 +14297,23 @@ size_t GetNodeResponse::ByteSizeLong() const {
   return total_size;
 }
 
-void GetNodeResponse::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:mspb.GetNodeResponse)
+void GetDBResponse::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:mspb.GetDBResponse)
   GOOGLE_DCHECK_NE(&from, this);
-  const GetNodeResponse* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const GetNodeResponse>(
+  const GetDBResponse* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const GetDBResponse>(
           &from);
   if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:mspb.GetNodeResponse)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:mspb.GetDBResponse)
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:mspb.GetNodeResponse)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:mspb.GetDBResponse)
     MergeFrom(*source);
   }
 }
 
-void GetNodeResponse::MergeFrom(const GetNodeResponse& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:mspb.GetNodeResponse)
+void GetDBResponse::MergeFrom(const GetDBResponse& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:mspb.GetDBResponse)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   ::google::protobuf::uint32 cached_has_bits = 0;
@@ -11355,79 +14322,79 @@ void GetNodeResponse::MergeFrom(const GetNodeResponse& from) {
   if (from.has_header()) {
     mutable_header()->::mspb::ResponseHeader::MergeFrom(from.header());
   }
-  if (from.has_node()) {
-    mutable_node()->::metapb::Node::MergeFrom(from.node());
+  if (from.has_db()) {
+    mutable_db()->::metapb::DataBase::MergeFrom(from.db());
   }
 }
 
-void GetNodeResponse::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:mspb.GetNodeResponse)
+void GetDBResponse::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:mspb.GetDBResponse)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void GetNodeResponse::CopyFrom(const GetNodeResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:mspb.GetNodeResponse)
+void GetDBResponse::CopyFrom(const GetDBResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mspb.GetDBResponse)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool GetNodeResponse::IsInitialized() const {
+bool GetDBResponse::IsInitialized() const {
   return true;
 }
 
-void GetNodeResponse::Swap(GetNodeResponse* other) {
+void GetDBResponse::Swap(GetDBResponse* other) {
   if (other == this) return;
   InternalSwap(other);
 }
-void GetNodeResponse::InternalSwap(GetNodeResponse* other) {
+void GetDBResponse::InternalSwap(GetDBResponse* other) {
   using std::swap;
   swap(header_, other->header_);
-  swap(node_, other->node_);
+  swap(db_, other->db_);
   _internal_metadata_.Swap(&other->_internal_metadata_);
   swap(_cached_size_, other->_cached_size_);
 }
 
-::google::protobuf::Metadata GetNodeResponse::GetMetadata() const {
+::google::protobuf::Metadata GetDBResponse::GetMetadata() const {
   protobuf_mspb_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_mspb_2eproto::file_level_metadata[kIndexInFileMessages];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
-// GetNodeResponse
+// GetDBResponse
 
 // .mspb.ResponseHeader header = 1;
-bool GetNodeResponse::has_header() const {
+bool GetDBResponse::has_header() const {
   return this != internal_default_instance() && header_ != NULL;
 }
-void GetNodeResponse::clear_header() {
+void GetDBResponse::clear_header() {
   if (GetArenaNoVirtual() == NULL && header_ != NULL) delete header_;
   header_ = NULL;
 }
-const ::mspb::ResponseHeader& GetNodeResponse::header() const {
+const ::mspb::ResponseHeader& GetDBResponse::header() const {
   const ::mspb::ResponseHeader* p = header_;
-  // @@protoc_insertion_point(field_get:mspb.GetNodeResponse.header)
+  // @@protoc_insertion_point(field_get:mspb.GetDBResponse.header)
   return p != NULL ? *p : *reinterpret_cast<const ::mspb::ResponseHeader*>(
       &::mspb::_ResponseHeader_default_instance_);
 }
-::mspb::ResponseHeader* GetNodeResponse::mutable_header() {
+::mspb::ResponseHeader* GetDBResponse::mutable_header() {
   
   if (header_ == NULL) {
     header_ = new ::mspb::ResponseHeader;
   }
-  // @@protoc_insertion_point(field_mutable:mspb.GetNodeResponse.header)
+  // @@protoc_insertion_point(field_mutable:mspb.GetDBResponse.header)
   return header_;
 }
-::mspb::ResponseHeader* GetNodeResponse::release_header() {
-  // @@protoc_insertion_point(field_release:mspb.GetNodeResponse.header)
+::mspb::ResponseHeader* GetDBResponse::release_header() {
+  // @@protoc_insertion_point(field_release:mspb.GetDBResponse.header)
   
   ::mspb::ResponseHeader* temp = header_;
   header_ = NULL;
   return temp;
 }
-void GetNodeResponse::set_allocated_header(::mspb::ResponseHeader* header) {
+void GetDBResponse::set_allocated_header(::mspb::ResponseHeader* header) {
   delete header_;
   header_ = header;
   if (header) {
@@ -11435,47 +14402,47 @@ void GetNodeResponse::set_allocated_header(::mspb::ResponseHeader* header) {
   } else {
     
   }
-  // @@protoc_insertion_point(field_set_allocated:mspb.GetNodeResponse.header)
+  // @@protoc_insertion_point(field_set_allocated:mspb.GetDBResponse.header)
 }
 
-// .metapb.Node node = 2;
-bool GetNodeResponse::has_node() const {
-  return this != internal_default_instance() && node_ != NULL;
+// .metapb.DataBase db = 2;
+bool GetDBResponse::has_db() const {
+  return this != internal_default_instance() && db_ != NULL;
 }
-void GetNodeResponse::clear_node() {
-  if (GetArenaNoVirtual() == NULL && node_ != NULL) delete node_;
-  node_ = NULL;
+void GetDBResponse::clear_db() {
+  if (GetArenaNoVirtual() == NULL && db_ != NULL) delete db_;
+  db_ = NULL;
 }
-const ::metapb::Node& GetNodeResponse::node() const {
-  const ::metapb::Node* p = node_;
-  // @@protoc_insertion_point(field_get:mspb.GetNodeResponse.node)
-  return p != NULL ? *p : *reinterpret_cast<const ::metapb::Node*>(
-      &::metapb::_Node_default_instance_);
+const ::metapb::DataBase& GetDBResponse::db() const {
+  const ::metapb::DataBase* p = db_;
+  // @@protoc_insertion_point(field_get:mspb.GetDBResponse.db)
+  return p != NULL ? *p : *reinterpret_cast<const ::metapb::DataBase*>(
+      &::metapb::_DataBase_default_instance_);
 }
-::metapb::Node* GetNodeResponse::mutable_node() {
+::metapb::DataBase* GetDBResponse::mutable_db() {
   
-  if (node_ == NULL) {
-    node_ = new ::metapb::Node;
+  if (db_ == NULL) {
+    db_ = new ::metapb::DataBase;
   }
-  // @@protoc_insertion_point(field_mutable:mspb.GetNodeResponse.node)
-  return node_;
+  // @@protoc_insertion_point(field_mutable:mspb.GetDBResponse.db)
+  return db_;
 }
-::metapb::Node* GetNodeResponse::release_node() {
-  // @@protoc_insertion_point(field_release:mspb.GetNodeResponse.node)
+::metapb::DataBase* GetDBResponse::release_db() {
+  // @@protoc_insertion_point(field_release:mspb.GetDBResponse.db)
   
-  ::metapb::Node* temp = node_;
-  node_ = NULL;
+  ::metapb::DataBase* temp = db_;
+  db_ = NULL;
   return temp;
 }
-void GetNodeResponse::set_allocated_node(::metapb::Node* node) {
-  delete node_;
-  node_ = node;
-  if (node) {
+void GetDBResponse::set_allocated_db(::metapb::DataBase* db) {
+  delete db_;
+  db_ = db;
+  if (db) {
     
   } else {
     
   }
-  // @@protoc_insertion_point(field_set_allocated:mspb.GetNodeResponse.node)
+  // @@protoc_insertion_point(field_set_allocated:mspb.GetDBResponse.db)
 }
 
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -11483,81 +14450,89 @@ void GetNodeResponse::set_allocated_node(::metapb::Node* node) {
 // ===================================================================
 
 #if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int GetDBRequest::kHeaderFieldNumber;
-const int GetDBRequest::kNameFieldNumber;
+const int GetTableRequest::kHeaderFieldNumber;
+const int GetTableRequest::kDbNameFieldNumber;
+const int GetTableRequest::kTableNameFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
-GetDBRequest::GetDBRequest()
+GetTableRequest::GetTableRequest()
   : ::google::protobuf::Message(), _internal_metadata_(NULL) {
   if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
     protobuf_mspb_2eproto::InitDefaults();
   }
   SharedCtor();
-  // @@protoc_insertion_point(constructor:mspb.GetDBRequest)
+  // @@protoc_insertion_point(constructor:mspb.GetTableRequest)
 }
-GetDBRequest::GetDBRequest(const GetDBRequest& from)
+GetTableRequest::GetTableRequest(const GetTableRequest& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
       _cached_size_(0) {
   _internal_metadata_.MergeFrom(from._internal_metadata_);
-  name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.name().size() > 0) {
-    name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.name_);
+  db_name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (from.db_name().size() > 0) {
+    db_name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.db_name_);
+  }
+  table_name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (from.table_name().size() > 0) {
+    table_name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.table_name_);
   }
   if (from.has_header()) {
     header_ = new ::mspb::RequestHeader(*from.header_);
   } else {
     header_ = NULL;
   }
-  // @@protoc_insertion_point(copy_constructor:mspb.GetDBRequest)
+  // @@protoc_insertion_point(copy_constructor:mspb.GetTableRequest)
 }
 
-void GetDBRequest::SharedCtor() {
-  name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+void GetTableRequest::SharedCtor() {
+  db_name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  table_name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   header_ = NULL;
   _cached_size_ = 0;
 }
-
-GetDBRequest::~GetDBRequest() {
-  // @@protoc_insertion_point(destructor:mspb.GetDBRequest)
+
+GetTableRequest::~GetTableRequest() {
+  // @@protoc_insertion_point(destructor:mspb.GetTableRequest)
   SharedDtor();
 }
 
-void GetDBRequest::SharedDtor() {
-  name_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+void GetTableRequest::SharedDtor() {
+  db_name_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  table_name_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   if (this != internal_default_instance()) delete header_;
 }
 
-void GetDBRequest::SetCachedSize(int size) const {
+void GetTableRequest::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* GetDBRequest::descriptor() {
+const ::google::protobuf::Descriptor* GetTableRequest::descriptor() {
   protobuf_mspb_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_mspb_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
 }
 
-const GetDBRequest& GetDBRequest::default_instance() {
+const GetTableRequest& GetTableRequest::default_instance() {
   protobuf_mspb_2eproto::InitDefaults();
   return *internal_default_instance();
 }
 
-GetDBRequest* GetDBRequest::New(::google::protobuf::Arena* arena) const {
-  GetDBRequest* n = new GetDBRequest;
+GetTableRequest* GetTableRequest::New(::google::protobuf::Arena* arena) const {
+  GetTableRequest* n = new GetTableRequest;
   if (arena != NULL) {
     arena->Own(n);
   }
   return n;
 }
 
-void GetDBRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:mspb.GetDBRequest)
+void GetTableRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:mspb.GetTableRequest)
   ::google::protobuf::uint32 cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  db_name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  table_name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   if (GetArenaNoVirtual() == NULL && header_ != NULL) {
     delete header_;
   }
@@ -11565,11 +14540,11 @@ void GetDBRequest::Clear() {
   _internal_metadata_.Clear();
 }
 
-bool GetDBRequest::MergePartialFromCodedStream(
+bool GetTableRequest::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:mspb.GetDBRequest)
+  // @@protoc_insertion_point(parse_start:mspb.GetTableRequest)
   for (;;) {
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
     tag = p.first;
@@ -11587,16 +14562,32 @@ bool GetDBRequest::MergePartialFromCodedStream(
         break;
       }
 
-      // string name = 2;
+      // string db_name = 2;
       case 2: {
         if (static_cast< ::google::protobuf::uint8>(tag) ==
             static_cast< ::google::protobuf::uint8>(18u /* 18 & 0xFF */)) {
           DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_name()));
+                input, this->mutable_db_name()));
           DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->name().data(), static_cast<int>(this->name().length()),
+            this->db_name().data(), static_cast<int>(this->db_name().length()),
             ::google::protobuf::internal::WireFormatLite::PARSE,
-            "mspb.GetDBRequest.name"));
+            "mspb.GetTableRequest.db_name"));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // string table_name = 3;
+      case 3: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(26u /* 26 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_table_name()));
+          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+            this->table_name().data(), static_cast<int>(this->table_name().length()),
+            ::google::protobuf::internal::WireFormatLite::PARSE,
+            "mspb.GetTableRequest.table_name"));
         } else {
           goto handle_unusual;
         }
@@ -11615,17 +14606,17 @@ bool GetDBRequest::MergePartialFromCodedStream(
     }
   }
 success:
-  // @@protoc_insertion_point(parse_success:mspb.GetDBRequest)
+  // @@protoc_insertion_point(parse_success:mspb.GetTableRequest)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:mspb.GetDBRequest)
+  // @@protoc_insertion_point(parse_failure:mspb.GetTableRequest)
   return false;
 #undef DO_
 }
 
-void GetDBRequest::SerializeWithCachedSizes(
+void GetTableRequest::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:mspb.GetDBRequest)
+  // @@protoc_insertion_point(serialize_start:mspb.GetTableRequest)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
@@ -11635,27 +14626,37 @@ void GetDBRequest::SerializeWithCachedSizes(
       1, *this->header_, output);
   }
 
-  // string name = 2;
-  if (this->name().size() > 0) {
+  // string db_name = 2;
+  if (this->db_name().size() > 0) {
     ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->name().data(), static_cast<int>(this->name().length()),
+      this->db_name().data(), static_cast<int>(this->db_name().length()),
       ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "mspb.GetDBRequest.name");
+      "mspb.GetTableRequest.db_name");
     ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      2, this->name(), output);
+      2, this->db_name(), output);
+  }
+
+  // string table_name = 3;
+  if (this->table_name().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+      this->table_name().data(), static_cast<int>(this->table_name().length()),
+      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+      "mspb.GetTableRequest.table_name");
+    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
+      3, this->table_name(), output);
   }
 
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
     ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
   }
-  // @@protoc_insertion_point(serialize_end:mspb.GetDBRequest)
+  // @@protoc_insertion_point(serialize_end:mspb.GetTableRequest)
 }
 
-::google::protobuf::uint8* GetDBRequest::InternalSerializeWithCachedSizesToArray(
+::google::protobuf::uint8* GetTableRequest::InternalSerializeWithCachedSizesToArray(
     bool deterministic, ::google::protobuf::uint8* target) const {
   (void)deterministic; // Unused
-  // @@protoc_insertion_point(serialize_to_array_start:mspb.GetDBRequest)
+  // @@protoc_insertion_point(serialize_to_array_start:mspb.GetTableRequest)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
@@ -11666,27 +14667,38 @@ void GetDBRequest::SerializeWithCachedSizes(
         1, *this->header_, deterministic, target);
   }
 
-  // string name = 2;
-  if (this->name().size() > 0) {
+  // string db_name = 2;
+  if (this->db_name().size() > 0) {
     ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->name().data(), static_cast<int>(this->name().length()),
+      this->db_name().data(), static_cast<int>(this->db_name().length()),
       ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "mspb.GetDBRequest.name");
+      "mspb.GetTableRequest.db_name");
     target =
       ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        2, this->name(), target);
+        2, this->db_name(), target);
+  }
+
+  // string table_name = 3;
+  if (this->table_name().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+      this->table_name().data(), static_cast<int>(this->table_name().length()),
+      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+      "mspb.GetTableRequest.table_name");
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        3, this->table_name(), target);
   }
 
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
     target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:mspb.GetDBRequest)
+  // @@protoc_insertion_point(serialize_to_array_end:mspb.GetTableRequest)
   return target;
 }
 
-size_t GetDBRequest::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:mspb.GetDBRequest)
+size_t GetTableRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mspb.GetTableRequest)
   size_t total_size = 0;
 
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
@@ -11694,11 +14706,18 @@ size_t GetDBRequest::ByteSizeLong() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
   }
-  // string name = 2;
-  if (this->name().size() > 0) {
+  // string db_name = 2;
+  if (this->db_name().size() > 0) {
     total_size += 1 +
       ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->name());
+        this->db_name());
+  }
+
+  // string table_name = 3;
+  if (this->table_name().size() > 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::StringSize(
+        this->table_name());
   }
 
   // .mspb.RequestHeader header = 1;
@@ -11715,105 +14734,110 @@ size_t GetDBRequest::ByteSizeLong() const {
   return total_size;
 }
 
-void GetDBRequest::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:mspb.GetDBRequest)
+void GetTableRequest::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:mspb.GetTableRequest)
   GOOGLE_DCHECK_NE(&from, this);
-  const GetDBRequest* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const GetDBRequest>(
+  const GetTableRequest* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const GetTableRequest>(
           &from);
   if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:mspb.GetDBRequest)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:mspb.GetTableRequest)
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:mspb.GetDBRequest)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:mspb.GetTableRequest)
     MergeFrom(*source);
   }
 }
 
-void GetDBRequest::MergeFrom(const GetDBRequest& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:mspb.GetDBRequest)
+void GetTableRequest::MergeFrom(const GetTableRequest& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:mspb.GetTableRequest)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.name().size() > 0) {
+  if (from.db_name().size() > 0) {
 
-    name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.name_);
+    db_name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.db_name_);
+  }
+  if (from.table_name().size() > 0) {
+
+    table_name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.table_name_);
   }
   if (from.has_header()) {
     mutable_header()->::mspb::RequestHeader::MergeFrom(from.header());
   }
 }
 
-void GetDBRequest::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:mspb.GetDBRequest)
+void GetTableRequest::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:mspb.GetTableRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void GetDBRequest::CopyFrom(const GetDBRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:mspb.GetDBRequest)
+void GetTableRequest::CopyFrom(const GetTableRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mspb.GetTableRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool GetDBRequest::IsInitialized() const {
+bool GetTableRequest::IsInitialized() const {
   return true;
 }
 
-void GetDBRequest::Swap(GetDBRequest* other) {
+void GetTableRequest::Swap(GetTableRequest* other) {
   if (other == this) return;
   InternalSwap(other);
 }
-void GetDBRequest::InternalSwap(GetDBRequest* other) {
+void GetTableRequest::InternalSwap(GetTableRequest* other) {
   using std::swap;
-  name_.Swap(&other->name_);
+  db_name_.Swap(&other->db_name_);
+  table_name_.Swap(&other->table_name_);
   swap(header_, other->header_);
   _internal_metadata_.Swap(&other->_internal_metadata_);
   swap(_cached_size_, other->_cached_size_);
 }
 
-::google::protobuf::Metadata GetDBRequest::GetMetadata() const {
+::google::protobuf::Metadata GetTableRequest::GetMetadata() const {
   protobuf_mspb_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_mspb_2eproto::file_level_metadata[kIndexInFileMessages];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
-// GetDBRequest
+// GetTableRequest
 
 // .mspb.RequestHeader header = 1;
-bool GetDBRequest::has_header() const {
+bool GetTableRequest::has_header() const {
   return this != internal_default_instance() && header_ != NULL;
 }
-void GetDBRequest::clear_header() {
+void GetTableRequest::clear_header() {
   if (GetArenaNoVirtual() == NULL && header_ != NULL) delete header_;
   header_ = NULL;
 }
-const ::mspb::RequestHeader& GetDBRequest::header() const {
+const ::mspb::RequestHeader& GetTableRequest::header() const {
   const ::mspb::RequestHeader* p = header_;
-  // @@protoc_insertion_point(field_get:mspb.GetDBRequest.header)
+  // @@protoc_insertion_point(field_get:mspb.GetTableRequest.header)
   return p != NULL ? *p : *reinterpret_cast<const ::mspb::RequestHeader*>(
       &::mspb::_RequestHeader_default_instance_);
 }
-::mspb::RequestHeader* GetDBRequest::mutable_header() {
+::mspb::RequestHeader* GetTableRequest::mutable_header() {
   
   if (header_ == NULL) {
     header_ = new ::mspb::RequestHeader;
   }
-  // @@protoc_insertion_point(field_mutable:mspb.GetDBRequest.header)
+  // @@protoc_insertion_point(field_mutable:mspb.GetTableRequest.header)
   return header_;
 }
-::mspb::RequestHeader* GetDBRequest::release_header() {
-  // @@protoc_insertion_point(field_release:mspb.GetDBRequest.header)
+::mspb::RequestHeader* GetTableRequest::release_header() {
+  // @@protoc_insertion_point(field_release:mspb.GetTableRequest.header)
   
   ::mspb::RequestHeader* temp = header_;
   header_ = NULL;
   return temp;
 }
-void GetDBRequest::set_allocated_header(::mspb::RequestHeader* header) {
+void GetTableRequest::set_allocated_header(::mspb::RequestHeader* header) {
   delete header_;
   header_ = header;
   if (header) {
@@ -11821,60 +14845,113 @@ void GetDBRequest::set_allocated_header(::mspb::RequestHeader* header) {
   } else {
     
   }
-  // @@protoc_insertion_point(field_set_allocated:mspb.GetDBRequest.header)
+  // @@protoc_insertion_point(field_set_allocated:mspb.GetTableRequest.header)
 }
 
-// string name = 2;
-void GetDBRequest::clear_name() {
-  name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+// string db_name = 2;
+void GetTableRequest::clear_db_name() {
+  db_name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-const ::std::string& GetDBRequest::name() const {
-  // @@protoc_insertion_point(field_get:mspb.GetDBRequest.name)
-  return name_.GetNoArena();
+const ::std::string& GetTableRequest::db_name() const {
+  // @@protoc_insertion_point(field_get:mspb.GetTableRequest.db_name)
+  return db_name_.GetNoArena();
+}
+void GetTableRequest::set_db_name(const ::std::string& value) {
+  
+  db_name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:mspb.GetTableRequest.db_name)
+}
+#if LANG_CXX11
+void GetTableRequest::set_db_name(::std::string&& value) {
+  
+  db_name_.SetNoArena(
+    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:mspb.GetTableRequest.db_name)
+}
+#endif
+void GetTableRequest::set_db_name(const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  
+  db_name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:mspb.GetTableRequest.db_name)
+}
+void GetTableRequest::set_db_name(const char* value, size_t size) {
+  
+  db_name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:mspb.GetTableRequest.db_name)
+}
+::std::string* GetTableRequest::mutable_db_name() {
+  
+  // @@protoc_insertion_point(field_mutable:mspb.GetTableRequest.db_name)
+  return db_name_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+::std::string* GetTableRequest::release_db_name() {
+  // @@protoc_insertion_point(field_release:mspb.GetTableRequest.db_name)
+  
+  return db_name_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+void GetTableRequest::set_allocated_db_name(::std::string* db_name) {
+  if (db_name != NULL) {
+    
+  } else {
+    
+  }
+  db_name_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), db_name);
+  // @@protoc_insertion_point(field_set_allocated:mspb.GetTableRequest.db_name)
+}
+
+// string table_name = 3;
+void GetTableRequest::clear_table_name() {
+  table_name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+const ::std::string& GetTableRequest::table_name() const {
+  // @@protoc_insertion_point(field_get:mspb.GetTableRequest.table_name)
+  return table_name_.GetNoArena();
 }
-void GetDBRequest::set_name(const ::std::string& value) {
+void GetTableRequest::set_table_name(const ::std::string& value) {
   
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:mspb.GetDBRequest.name)
+  table_name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:mspb.GetTableRequest.table_name)
 }
 #if LANG_CXX11
-void GetDBRequest::set_name(::std::string&& value) {
+void GetTableRequest::set_table_name(::std::string&& value) {
   
-  name_.SetNoArena(
+  table_name_.SetNoArena(
     &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:mspb.GetDBRequest.name)
+  // @@protoc_insertion_point(field_set_rvalue:mspb.GetTableRequest.table_name)
 }
 #endif
-void GetDBRequest::set_name(const char* value) {
+void GetTableRequest::set_table_name(const char* value) {
   GOOGLE_DCHECK(value != NULL);
   
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:mspb.GetDBRequest.name)
+  table_name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:mspb.GetTableRequest.table_name)
 }
-void GetDBRequest::set_name(const char* value, size_t size) {
+void GetTableRequest::set_table_name(const char* value, size_t size) {
   
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+  table_name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
       ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:mspb.GetDBRequest.name)
+  // @@protoc_insertion_point(field_set_pointer:mspb.GetTableRequest.table_name)
 }
-::std::string* GetDBRequest::mutable_name() {
+::std::string* GetTableRequest::mutable_table_name() {
   
-  // @@protoc_insertion_point(field_mutable:mspb.GetDBRequest.name)
-  return name_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  // @@protoc_insertion_point(field_mutable:mspb.GetTableRequest.table_name)
+  return table_name_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-::std::string* GetDBRequest::release_name() {
-  // @@protoc_insertion_point(field_release:mspb.GetDBRequest.name)
+::std::string* GetTableRequest::release_table_name() {
+  // @@protoc_insertion_point(field_release:mspb.GetTableRequest.table_name)
   
-  return name_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return table_name_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-void GetDBRequest::set_allocated_name(::std::string* name) {
-  if (name != NULL) {
+void GetTableRequest::set_allocated_table_name(::std::string* table_name) {
+  if (table_name != NULL) {
     
   } else {
     
   }
-  name_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), name);
-  // @@protoc_insertion_point(field_set_allocated:mspb.GetDBRequest.name)
+  table_name_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), table_name);
+  // @@protoc_insertion_point(field_set_allocated:mspb.GetTableRequest.table_name)
 }
 
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -11882,78 +14959,76 @@ void GetDBRequest::set_allocated_name(::std::string* name) {
 // ===================================================================
 
 #if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int GetDBResponse::kHeaderFieldNumber;
-const int GetDBResponse::kDbFieldNumber;
+const int GetTableByIdRequest::kHeaderFieldNumber;
+const int GetTableByIdRequest::kDbIdFieldNumber;
+const int GetTableByIdRequest::kTableIdFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
-GetDBResponse::GetDBResponse()
+GetTableByIdRequest::GetTableByIdRequest()
   : ::google::protobuf::Message(), _internal_metadata_(NULL) {
   if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
     protobuf_mspb_2eproto::InitDefaults();
   }
   SharedCtor();
-  // @@protoc_insertion_point(constructor:mspb.GetDBResponse)
+  // @@protoc_insertion_point(constructor:mspb.GetTableByIdRequest)
 }
-GetDBResponse::GetDBResponse(const GetDBResponse& from)
+GetTableByIdRequest::GetTableByIdRequest(const GetTableByIdRequest& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
       _cached_size_(0) {
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   if (from.has_header()) {
-    header_ = new ::mspb::ResponseHeader(*from.header_);
+    header_ = new ::mspb::RequestHeader(*from.header_);
   } else {
     header_ = NULL;
   }
-  if (from.has_db()) {
-    db_ = new ::metapb::DataBase(*from.db_);
-  } else {
-    db_ = NULL;
-  }
-  // @@protoc_insertion_point(copy_constructor:mspb.GetDBResponse)
+  ::memcpy(&db_id_, &from.db_id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&table_id_) -
+    reinterpret_cast<char*>(&db_id_)) + sizeof(table_id_));
+  // @@protoc_insertion_point(copy_constructor:mspb.GetTableByIdRequest)
 }
 
-void GetDBResponse::SharedCtor() {
+void GetTableByIdRequest::SharedCtor() {
   ::memset(&header_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&db_) -
-      reinterpret_cast<char*>(&header_)) + sizeof(db_));
+      reinterpret_cast<char*>(&table_id_) -
+      reinterpret_cast<char*>(&header_)) + sizeof(table_id_));
   _cached_size_ = 0;
 }
 
-GetDBResponse::~GetDBResponse() {
-  // @@protoc_insertion_point(destructor:mspb.GetDBResponse)
+GetTableByIdRequest::~GetTableByIdRequest() {
+  // @@protoc_insertion_point(destructor:mspb.GetTableByIdRequest)
   SharedDtor();
 }
 
-void GetDBResponse::SharedDtor() {
+void GetTableByIdRequest::SharedDtor() {
   if (this != internal_default_instance()) delete header_;
-  if (this != internal_default_instance()) delete db_;
 }
 
-void GetDBResponse::SetCachedSize(int size) const {
+void GetTableByIdRequest::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* GetDBResponse::descriptor() {
+const ::google::protobuf::Descriptor* GetTableByIdRequest::descriptor() {
   protobuf_mspb_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_mspb_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
 }
 
-const GetDBResponse& GetDBResponse::default_instance() {
+const GetTableByIdRequest& GetTableByIdRequest::default_instance() {
   protobuf_mspb_2eproto::InitDefaults();
   return *internal_default_instance();
 }
 
-GetDBResponse* GetDBResponse::New(::google::protobuf::Arena* arena) const {
-  GetDBResponse* n = new GetDBResponse;
+GetTableByIdRequest* GetTableByIdRequest::New(::google::protobuf::Arena* arena) const {
+  GetTableByIdRequest* n = new GetTableByIdRequest;
   if (arena != NULL) {
     arena->Own(n);
   }
   return n;
 }
 
-void GetDBResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:mspb.GetDBResponse)
+void GetTableByIdRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:mspb.GetTableByIdRequest)
   ::google::protobuf::uint32 cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
@@ -11962,24 +15037,23 @@ void GetDBResponse::Clear() {
     delete header_;
   }
   header_ = NULL;
-  if (GetArenaNoVirtual() == NULL && db_ != NULL) {
-    delete db_;
-  }
-  db_ = NULL;
+  ::memset(&db_id_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&table_id_) -
+      reinterpret_cast<char*>(&db_id_)) + sizeof(table_id_));
   _internal_metadata_.Clear();
 }
 
-bool GetDBResponse::MergePartialFromCodedStream(
+bool GetTableByIdRequest::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:mspb.GetDBResponse)
+  // @@protoc_insertion_point(parse_start:mspb.GetTableByIdRequest)
   for (;;) {
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
     tag = p.first;
     if (!p.second) goto handle_unusual;
     switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // .mspb.ResponseHeader header = 1;
+      // .mspb.RequestHeader header = 1;
       case 1: {
         if (static_cast< ::google::protobuf::uint8>(tag) ==
             static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
@@ -11991,12 +15065,28 @@ bool GetDBResponse::MergePartialFromCodedStream(
         break;
       }
 
-      // .metapb.DataBase db = 2;
+      // uint64 db_id = 2;
       case 2: {
         if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(18u /* 18 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_db()));
+            static_cast< ::google::protobuf::uint8>(16u /* 16 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &db_id_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint64 table_id = 3;
+      case 3: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(24u /* 24 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &table_id_)));
         } else {
           goto handle_unusual;
         }
@@ -12015,70 +15105,77 @@ bool GetDBResponse::MergePartialFromCodedStream(
     }
   }
 success:
-  // @@protoc_insertion_point(parse_success:mspb.GetDBResponse)
+  // @@protoc_insertion_point(parse_success:mspb.GetTableByIdRequest)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:mspb.GetDBResponse)
+  // @@protoc_insertion_point(parse_failure:mspb.GetTableByIdRequest)
   return false;
 #undef DO_
 }
 
-void GetDBResponse::SerializeWithCachedSizes(
+void GetTableByIdRequest::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:mspb.GetDBResponse)
+  // @@protoc_insertion_point(serialize_start:mspb.GetTableByIdRequest)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // .mspb.ResponseHeader header = 1;
+  // .mspb.RequestHeader header = 1;
   if (this->has_header()) {
     ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
       1, *this->header_, output);
   }
 
-  // .metapb.DataBase db = 2;
-  if (this->has_db()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      2, *this->db_, output);
+  // uint64 db_id = 2;
+  if (this->db_id() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(2, this->db_id(), output);
+  }
+
+  // uint64 table_id = 3;
+  if (this->table_id() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(3, this->table_id(), output);
   }
 
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
     ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
   }
-  // @@protoc_insertion_point(serialize_end:mspb.GetDBResponse)
+  // @@protoc_insertion_point(serialize_end:mspb.GetTableByIdRequest)
 }
 
-::google::protobuf::uint8* GetDBResponse::InternalSerializeWithCachedSizesToArray(
+::google::protobuf::uint8* GetTableByIdRequest::InternalSerializeWithCachedSizesToArray(
     bool deterministic, ::google::protobuf::uint8* target) const {
   (void)deterministic; // Unused
-  // @@protoc_insertion_point(serialize_to_array_start:mspb.GetDBResponse)
+  // @@protoc_insertion_point(serialize_to_array_start:mspb.GetTableByIdRequest)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // .mspb.ResponseHeader header = 1;
+  // .mspb.RequestHeader header = 1;
   if (this->has_header()) {
     target = ::google::protobuf::internal::WireFormatLite::
       InternalWriteMessageNoVirtualToArray(
         1, *this->header_, deterministic, target);
   }
 
-  // .metapb.DataBase db = 2;
-  if (this->has_db()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageNoVirtualToArray(
-        2, *this->db_, deterministic, target);
+  // uint64 db_id = 2;
+  if (this->db_id() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(2, this->db_id(), target);
+  }
+
+  // uint64 table_id = 3;
+  if (this->table_id() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(3, this->table_id(), target);
   }
 
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
     target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:mspb.GetDBResponse)
+  // @@protoc_insertion_point(serialize_to_array_end:mspb.GetTableByIdRequest)
   return target;
 }
 
-size_t GetDBResponse::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:mspb.GetDBResponse)
+size_t GetTableByIdRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mspb.GetTableByIdRequest)
   size_t total_size = 0;
 
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
@@ -12086,18 +15183,25 @@ size_t GetDBResponse::ByteSizeLong() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
   }
-  // .mspb.ResponseHeader header = 1;
+  // .mspb.RequestHeader header = 1;
   if (this->has_header()) {
     total_size += 1 +
       ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
         *this->header_);
   }
 
-  // .metapb.DataBase db = 2;
-  if (this->has_db()) {
+  // uint64 db_id = 2;
+  if (this->db_id() != 0) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-        *this->db_);
+      ::google::protobuf::internal::WireFormatLite::UInt64Size(
+        this->db_id());
+  }
+
+  // uint64 table_id = 3;
+  if (this->table_id() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt64Size(
+        this->table_id());
   }
 
   int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
@@ -12107,104 +15211,108 @@ size_t GetDBResponse::ByteSizeLong() const {
   return total_size;
 }
 
-void GetDBResponse::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:mspb.GetDBResponse)
+void GetTableByIdRequest::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:mspb.GetTableByIdRequest)
   GOOGLE_DCHECK_NE(&from, this);
-  const GetDBResponse* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const GetDBResponse>(
+  const GetTableByIdRequest* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const GetTableByIdRequest>(
           &from);
   if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:mspb.GetDBResponse)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:mspb.GetTableByIdRequest)
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:mspb.GetDBResponse)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:mspb.GetTableByIdRequest)
     MergeFrom(*source);
   }
 }
 
-void GetDBResponse::MergeFrom(const GetDBResponse& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:mspb.GetDBResponse)
+void GetTableByIdRequest::MergeFrom(const GetTableByIdRequest& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:mspb.GetTableByIdRequest)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
   if (from.has_header()) {
-    mutable_header()->::mspb::ResponseHeader::MergeFrom(from.header());
+    mutable_header()->::mspb::RequestHeader::MergeFrom(from.header());
   }
-  if (from.has_db()) {
-    mutable_db()->::metapb::DataBase::MergeFrom(from.db());
+  if (from.db_id() != 0) {
+    set_db_id(from.db_id());
+  }
+  if (from.table_id() != 0) {
+    set_table_id(from.table_id());
   }
 }
 
-void GetDBResponse::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:mspb.GetDBResponse)
+void GetTableByIdRequest::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:mspb.GetTableByIdRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void GetDBResponse::CopyFrom(const GetDBResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:mspb.GetDBResponse)
+void GetTableByIdRequest::CopyFrom(const GetTableByIdRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mspb.GetTableByIdRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool GetDBResponse::IsInitialized() const {
+bool GetTableByIdRequest::IsInitialized() const {
   return true;
 }
 
-void GetDBResponse::Swap(GetDBResponse* other) {
+void GetTableByIdRequest::Swap(GetTableByIdRequest* other) {
   if (other == this) return;
   InternalSwap(other);
 }
-void GetDBResponse::InternalSwap(GetDBResponse* other) {
+void GetTableByIdRequest::InternalSwap(GetTableByIdRequest* other) {
   using std::swap;
   swap(header_, other->header_);
-  swap(db_, other->db_);
+  swap(db_id_, other->db_id_);
+  swap(table_id_, other->table_id_);
   _internal_metadata_.Swap(&other->_internal_metadata_);
   swap(_cached_size_, other->_cached_size_);
 }
 
-::google::protobuf::Metadata GetDBResponse::GetMetadata() const {
+::google::protobuf::Metadata GetTableByIdRequest::GetMetadata() const {
   protobuf_mspb_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_mspb_2eproto::file_level_metadata[kIndexInFileMessages];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
-// GetDBResponse
+// GetTableByIdRequest
 
-// .mspb.ResponseHeader header = 1;
-bool GetDBResponse::has_header() const {
+// .mspb.RequestHeader header = 1;
+bool GetTableByIdRequest::has_header() const {
   return this != internal_default_instance() && header_ != NULL;
 }
-void GetDBResponse::clear_header() {
+void GetTableByIdRequest::clear_header() {
   if (GetArenaNoVirtual() == NULL && header_ != NULL) delete header_;
   header_ = NULL;
 }
-const ::mspb::ResponseHeader& GetDBResponse::header() const {
-  const ::mspb::ResponseHeader* p = header_;
-  // @@protoc_insertion_point(field_get:mspb.GetDBResponse.header)
-  return p != NULL ? *p : *reinterpret_cast<const ::mspb::ResponseHeader*>(
-      &::mspb::_ResponseHeader_default_instance_);
-}
-::mspb::ResponseHeader* GetDBResponse::mutable_header() {
+const ::mspb::RequestHeader& GetTableByIdRequest::header() const {
+  const ::mspb::RequestHeader* p = header_;
+  // @@protoc_insertion_point(field_get:mspb.GetTableByIdRequest.header)
+  return p != NULL ? *p : *reinterpret_cast<const ::mspb::RequestHeader*>(
+      &::mspb::_RequestHeader_default_instance_);
+}
+::mspb::RequestHeader* GetTableByIdRequest::mutable_header() {
   
   if (header_ == NULL) {
-    header_ = new ::mspb::ResponseHeader;
+    header_ = new ::mspb::RequestHeader;
   }
-  // @@protoc_insertion_point(field_mutable:mspb.GetDBResponse.header)
+  // @@protoc_insertion_point(field_mutable:mspb.GetTableByIdRequest.header)
   return header_;
 }
-::mspb::ResponseHeader* GetDBResponse::release_header() {
-  // @@protoc_insertion_point(field_release:mspb.GetDBResponse.header)
+::mspb::RequestHeader* GetTableByIdRequest::release_header() {
+  // @@protoc_insertion_point(field_release:mspb.GetTableByIdRequest.header)
   
-  ::mspb::ResponseHeader* temp = header_;
+  ::mspb::RequestHeader* temp = header_;
   header_ = NULL;
   return temp;
 }
-void GetDBResponse::set_allocated_header(::mspb::ResponseHeader* header) {
+void GetTableByIdRequest::set_allocated_header(::mspb::RequestHeader* header) {
   delete header_;
   header_ = header;
   if (header) {
@@ -12212,47 +15320,35 @@ void GetDBResponse::set_allocated_header(::mspb::ResponseHeader* header) {
   } else {
     
   }
-  // @@protoc_insertion_point(field_set_allocated:mspb.GetDBResponse.header)
+  // @@protoc_insertion_point(field_set_allocated:mspb.GetTableByIdRequest.header)
 }
 
-// .metapb.DataBase db = 2;
-bool GetDBResponse::has_db() const {
-  return this != internal_default_instance() && db_ != NULL;
-}
-void GetDBResponse::clear_db() {
-  if (GetArenaNoVirtual() == NULL && db_ != NULL) delete db_;
-  db_ = NULL;
+// uint64 db_id = 2;
+void GetTableByIdRequest::clear_db_id() {
+  db_id_ = GOOGLE_ULONGLONG(0);
 }
-const ::metapb::DataBase& GetDBResponse::db() const {
-  const ::metapb::DataBase* p = db_;
-  // @@protoc_insertion_point(field_get:mspb.GetDBResponse.db)
-  return p != NULL ? *p : *reinterpret_cast<const ::metapb::DataBase*>(
-      &::metapb::_DataBase_default_instance_);
+::google::protobuf::uint64 GetTableByIdRequest::db_id() const {
+  // @@protoc_insertion_point(field_get:mspb.GetTableByIdRequest.db_id)
+  return db_id_;
 }
-::metapb::DataBase* GetDBResponse::mutable_db() {
+void GetTableByIdRequest::set_db_id(::google::protobuf::uint64 value) {
   
-  if (db_ == NULL) {
-    db_ = new ::metapb::DataBase;
-  }
-  // @@protoc_insertion_point(field_mutable:mspb.GetDBResponse.db)
-  return db_;
+  db_id_ = value;
+  // @@protoc_insertion_point(field_set:mspb.GetTableByIdRequest.db_id)
 }
-::metapb::DataBase* GetDBResponse::release_db() {
-  // @@protoc_insertion_point(field_release:mspb.GetDBResponse.db)
-  
-  ::metapb::DataBase* temp = db_;
-  db_ = NULL;
-  return temp;
+
+// uint64 table_id = 3;
+void GetTableByIdRequest::clear_table_id() {
+  table_id_ = GOOGLE_ULONGLONG(0);
 }
-void GetDBResponse::set_allocated_db(::metapb::DataBase* db) {
-  delete db_;
-  db_ = db;
-  if (db) {
-    
-  } else {
-    
-  }
-  // @@protoc_insertion_point(field_set_allocated:mspb.GetDBResponse.db)
+::google::protobuf::uint64 GetTableByIdRequest::table_id() const {
+  // @@protoc_insertion_point(field_get:mspb.GetTableByIdRequest.table_id)
+  return table_id_;
+}
+void GetTableByIdRequest::set_table_id(::google::protobuf::uint64 value) {
+  
+  table_id_ = value;
+  // @@protoc_insertion_point(field_set:mspb.GetTableByIdRequest.table_id)
 }
 
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -12260,107 +15356,104 @@ void GetDBResponse::set_allocated_db(::metapb::DataBase* db) {
 // ===================================================================
 
 #if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int GetTableRequest::kHeaderFieldNumber;
-const int GetTableRequest::kDbNameFieldNumber;
-const int GetTableRequest::kTableNameFieldNumber;
+const int GetTableResponse::kHeaderFieldNumber;
+const int GetTableResponse::kTableFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
-GetTableRequest::GetTableRequest()
+GetTableResponse::GetTableResponse()
   : ::google::protobuf::Message(), _internal_metadata_(NULL) {
   if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
     protobuf_mspb_2eproto::InitDefaults();
   }
   SharedCtor();
-  // @@protoc_insertion_point(constructor:mspb.GetTableRequest)
+  // @@protoc_insertion_point(constructor:mspb.GetTableResponse)
 }
-GetTableRequest::GetTableRequest(const GetTableRequest& from)
+GetTableResponse::GetTableResponse(const GetTableResponse& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
       _cached_size_(0) {
   _internal_metadata_.MergeFrom(from._internal_metadata_);
-  db_name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.db_name().size() > 0) {
-    db_name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.db_name_);
-  }
-  table_name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.table_name().size() > 0) {
-    table_name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.table_name_);
-  }
   if (from.has_header()) {
-    header_ = new ::mspb::RequestHeader(*from.header_);
+    header_ = new ::mspb::ResponseHeader(*from.header_);
   } else {
     header_ = NULL;
   }
-  // @@protoc_insertion_point(copy_constructor:mspb.GetTableRequest)
+  if (from.has_table()) {
+    table_ = new ::metapb::Table(*from.table_);
+  } else {
+    table_ = NULL;
+  }
+  // @@protoc_insertion_point(copy_constructor:mspb.GetTableResponse)
 }
 
-void GetTableRequest::SharedCtor() {
-  db_name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  table_name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  header_ = NULL;
+void GetTableResponse::SharedCtor() {
+  ::memset(&header_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&table_) -
+      reinterpret_cast<char*>(&header_)) + sizeof(table_));
   _cached_size_ = 0;
 }
 
-GetTableRequest::~GetTableRequest() {
-  // @@protoc_insertion_point(destructor:mspb.GetTableRequest)
+GetTableResponse::~GetTableResponse() {
+  // @@protoc_insertion_point(destructor:mspb.GetTableResponse)
   SharedDtor();
 }
 
-void GetTableRequest::SharedDtor() {
-  db_name_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  table_name_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+void GetTableResponse::SharedDtor() {
   if (this != internal_default_instance()) delete header_;
+  if (this != internal_default_instance()) delete table_;
 }
 
-void GetTableRequest::SetCachedSize(int size) const {
+void GetTableResponse::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* GetTableRequest::descriptor() {
+const ::google::protobuf::Descriptor* GetTableResponse::descriptor() {
   protobuf_mspb_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_mspb_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
 }
 
-const GetTableRequest& GetTableRequest::default_instance() {
+const GetTableResponse& GetTableResponse::default_instance() {
   protobuf_mspb_2eproto::InitDefaults();
   return *internal_default_instance();
 }
 
-GetTableRequest* GetTableRequest::New(::google::protobuf::Arena* arena) const {
-  GetTableRequest* n = new GetTableRequest;
+GetTableResponse* GetTableResponse::New(::google::protobuf::Arena* arena) const {
+  GetTableResponse* n = new GetTableResponse;
   if (arena != NULL) {
     arena->Own(n);
   }
   return n;
 }
 
-void GetTableRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:mspb.GetTableRequest)
+void GetTableResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:mspb.GetTableResponse)
   ::google::protobuf::uint32 cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  db_name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  table_name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   if (GetArenaNoVirtual() == NULL && header_ != NULL) {
     delete header_;
   }
   header_ = NULL;
+  if (GetArenaNoVirtual() == NULL && table_ != NULL) {
+    delete table_;
+  }
+  table_ = NULL;
   _internal_metadata_.Clear();
 }
 
-bool GetTableRequest::MergePartialFromCodedStream(
+bool GetTableResponse::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:mspb.GetTableRequest)
+  // @@protoc_insertion_point(parse_start:mspb.GetTableResponse)
   for (;;) {
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
     tag = p.first;
     if (!p.second) goto handle_unusual;
     switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // .mspb.RequestHeader header = 1;
+      // .mspb.ResponseHeader header = 1;
       case 1: {
         if (static_cast< ::google::protobuf::uint8>(tag) ==
             static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
@@ -12372,32 +15465,12 @@ bool GetTableRequest::MergePartialFromCodedStream(
         break;
       }
 
-      // string db_name = 2;
+      // .metapb.Table table = 2;
       case 2: {
         if (static_cast< ::google::protobuf::uint8>(tag) ==
             static_cast< ::google::protobuf::uint8>(18u /* 18 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_db_name()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->db_name().data(), static_cast<int>(this->db_name().length()),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "mspb.GetTableRequest.db_name"));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // string table_name = 3;
-      case 3: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(26u /* 26 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_table_name()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->table_name().data(), static_cast<int>(this->table_name().length()),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "mspb.GetTableRequest.table_name"));
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_table()));
         } else {
           goto handle_unusual;
         }
@@ -12416,127 +15489,91 @@ bool GetTableRequest::MergePartialFromCodedStream(
     }
   }
 success:
-  // @@protoc_insertion_point(parse_success:mspb.GetTableRequest)
+  // @@protoc_insertion_point(parse_success:mspb.GetTableResponse)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:mspb.GetTableRequest)
+  // @@protoc_insertion_point(parse_failure:mspb.GetTableResponse)
   return false;
 #undef DO_
 }
 
-void GetTableRequest::SerializeWithCachedSizes(
+void GetTableResponse::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:mspb.GetTableRequest)
+  // @@protoc_insertion_point(serialize_start:mspb.GetTableResponse)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // .mspb.RequestHeader header = 1;
+  // .mspb.ResponseHeader header = 1;
   if (this->has_header()) {
     ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
       1, *this->header_, output);
   }
 
-  // string db_name = 2;
-  if (this->db_name().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->db_name().data(), static_cast<int>(this->db_name().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "mspb.GetTableRequest.db_name");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      2, this->db_name(), output);
-  }
-
-  // string table_name = 3;
-  if (this->table_name().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->table_name().data(), static_cast<int>(this->table_name().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "mspb.GetTableRequest.table_name");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      3, this->table_name(), output);
+  // .metapb.Table table = 2;
+  if (this->has_table()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      2, *this->table_, output);
   }
 
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
     ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
   }
-  // @@protoc_insertion_point(serialize_end:mspb.GetTableRequest)
+  // @@protoc_insertion_point(serialize_end:mspb.GetTableResponse)
 }
 
-::google::protobuf::uint8* GetTableRequest::InternalSerializeWithCachedSizesToArray(
+::google::protobuf::uint8* GetTableResponse::InternalSerializeWithCachedSizesToArray(
     bool deterministic, ::google::protobuf::uint8* target) const {
   (void)deterministic; // Unused
-  // @@protoc_insertion_point(serialize_to_array_start:mspb.GetTableRequest)
+  // @@protoc_insertion_point(serialize_to_array_start:mspb.GetTableResponse)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // .mspb.RequestHeader header = 1;
+  // .mspb.ResponseHeader header = 1;
   if (this->has_header()) {
     target = ::google::protobuf::internal::WireFormatLite::
       InternalWriteMessageNoVirtualToArray(
         1, *this->header_, deterministic, target);
   }
 
-  // string db_name = 2;
-  if (this->db_name().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->db_name().data(), static_cast<int>(this->db_name().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "mspb.GetTableRequest.db_name");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        2, this->db_name(), target);
-  }
-
-  // string table_name = 3;
-  if (this->table_name().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->table_name().data(), static_cast<int>(this->table_name().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "mspb.GetTableRequest.table_name");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        3, this->table_name(), target);
+  // .metapb.Table table = 2;
+  if (this->has_table()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      InternalWriteMessageNoVirtualToArray(
+        2, *this->table_, deterministic, target);
   }
 
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
     target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:mspb.GetTableRequest)
+  // @@protoc_insertion_point(serialize_to_array_end:mspb.GetTableResponse)
   return target;
 }
 
-size_t GetTableRequest::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:mspb.GetTableRequest)
+size_t GetTableResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mspb.GetTableResponse)
   size_t total_size = 0;
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
-  }
-  // string db_name = 2;
-  if (this->db_name().size() > 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->db_name());
-  }
-
-  // string table_name = 3;
-  if (this->table_name().size() > 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->table_name());
+  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
   }
-
-  // .mspb.RequestHeader header = 1;
+  // .mspb.ResponseHeader header = 1;
   if (this->has_header()) {
     total_size += 1 +
       ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
         *this->header_);
   }
 
+  // .metapb.Table table = 2;
+  if (this->has_table()) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+        *this->table_);
+  }
+
   int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = cached_size;
@@ -12544,110 +15581,104 @@ size_t GetTableRequest::ByteSizeLong() const {
   return total_size;
 }
 
-void GetTableRequest::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:mspb.GetTableRequest)
+void GetTableResponse::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:mspb.GetTableResponse)
   GOOGLE_DCHECK_NE(&from, this);
-  const GetTableRequest* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const GetTableRequest>(
+  const GetTableResponse* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const GetTableResponse>(
           &from);
   if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:mspb.GetTableRequest)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:mspb.GetTableResponse)
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:mspb.GetTableRequest)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:mspb.GetTableResponse)
     MergeFrom(*source);
   }
 }
 
-void GetTableRequest::MergeFrom(const GetTableRequest& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:mspb.GetTableRequest)
+void GetTableResponse::MergeFrom(const GetTableResponse& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:mspb.GetTableResponse)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.db_name().size() > 0) {
-
-    db_name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.db_name_);
-  }
-  if (from.table_name().size() > 0) {
-
-    table_name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.table_name_);
-  }
   if (from.has_header()) {
-    mutable_header()->::mspb::RequestHeader::MergeFrom(from.header());
+    mutable_header()->::mspb::ResponseHeader::MergeFrom(from.header());
+  }
+  if (from.has_table()) {
+    mutable_table()->::metapb::Table::MergeFrom(from.table());
   }
 }
 
-void GetTableRequest::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:mspb.GetTableRequest)
+void GetTableResponse::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:mspb.GetTableResponse)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void GetTableRequest::CopyFrom(const GetTableRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:mspb.GetTableRequest)
+void GetTableResponse::CopyFrom(const GetTableResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mspb.GetTableResponse)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool GetTableRequest::IsInitialized() const {
+bool GetTableResponse::IsInitialized() const {
   return true;
 }
 
-void GetTableRequest::Swap(GetTableRequest* other) {
+void GetTableResponse::Swap(GetTableResponse* other) {
   if (other == this) return;
   InternalSwap(other);
 }
-void GetTableRequest::InternalSwap(GetTableRequest* other) {
+void GetTableResponse::InternalSwap(GetTableResponse* other) {
   using std::swap;
-  db_name_.Swap(&other->db_name_);
-  table_name_.Swap(&other->table_name_);
   swap(header_, other->header_);
+  swap(table_, other->table_);
   _internal_metadata_.Swap(&other->_internal_metadata_);
   swap(_cached_size_, other->_cached_size_);
 }
 
-::google::protobuf::Metadata GetTableRequest::GetMetadata() const {
+::google::protobuf::Metadata GetTableResponse::GetMetadata() const {
   protobuf_mspb_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_mspb_2eproto::file_level_metadata[kIndexInFileMessages];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
-// GetTableRequest
+// GetTableResponse
 
-// .mspb.RequestHeader header = 1;
-bool GetTableRequest::has_header() const {
+// .mspb.ResponseHeader header = 1;
+bool GetTableResponse::has_header() const {
   return this != internal_default_instance() && header_ != NULL;
 }
-void GetTableRequest::clear_header() {
+void GetTableResponse::clear_header() {
   if (GetArenaNoVirtual() == NULL && header_ != NULL) delete header_;
   header_ = NULL;
 }
-const ::mspb::RequestHeader& GetTableRequest::header() const {
-  const ::mspb::RequestHeader* p = header_;
-  // @@protoc_insertion_point(field_get:mspb.GetTableRequest.header)
-  return p != NULL ? *p : *reinterpret_cast<const ::mspb::RequestHeader*>(
-      &::mspb::_RequestHeader_default_instance_);
+const ::mspb::ResponseHeader& GetTableResponse::header() const {
+  const ::mspb::ResponseHeader* p = header_;
+  // @@protoc_insertion_point(field_get:mspb.GetTableResponse.header)
+  return p != NULL ? *p : *reinterpret_cast<const ::mspb::ResponseHeader*>(
+      &::mspb::_ResponseHeader_default_instance_);
 }
-::mspb::RequestHeader* GetTableRequest::mutable_header() {
+::mspb::ResponseHeader* GetTableResponse::mutable_header() {
   
   if (header_ == NULL) {
-    header_ = new ::mspb::RequestHeader;
+    header_ = new ::mspb::ResponseHeader;
   }
-  // @@protoc_insertion_point(field_mutable:mspb.GetTableRequest.header)
+  // @@protoc_insertion_point(field_mutable:mspb.GetTableResponse.header)
   return header_;
 }
-::mspb::RequestHeader* GetTableRequest::release_header() {
-  // @@protoc_insertion_point(field_release:mspb.GetTableRequest.header)
+::mspb::ResponseHeader* GetTableResponse::release_header() {
+  // @@protoc_insertion_point(field_release:mspb.GetTableResponse.header)
   
-  ::mspb::RequestHeader* temp = header_;
+  ::mspb::ResponseHeader* temp = header_;
   header_ = NULL;
   return temp;
 }
-void GetTableRequest::set_allocated_header(::mspb::RequestHeader* header) {
+void GetTableResponse::set_allocated_header(::mspb::ResponseHeader* header) {
   delete header_;
   header_ = header;
   if (header) {
@@ -12655,113 +15686,47 @@ void GetTableRequest::set_allocated_header(::mspb::RequestHeader* header) {
   } else {
     
   }
-  // @@protoc_insertion_point(field_set_allocated:mspb.GetTableRequest.header)
+  // @@protoc_insertion_point(field_set_allocated:mspb.GetTableResponse.header)
 }
 
-// string db_name = 2;
-void GetTableRequest::clear_db_name() {
-  db_name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-const ::std::string& GetTableRequest::db_name() const {
-  // @@protoc_insertion_point(field_get:mspb.GetTableRequest.db_name)
-  return db_name_.GetNoArena();
-}
-void GetTableRequest::set_db_name(const ::std::string& value) {
-  
-  db_name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:mspb.GetTableRequest.db_name)
-}
-#if LANG_CXX11
-void GetTableRequest::set_db_name(::std::string&& value) {
-  
-  db_name_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:mspb.GetTableRequest.db_name)
-}
-#endif
-void GetTableRequest::set_db_name(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  db_name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:mspb.GetTableRequest.db_name)
+// .metapb.Table table = 2;
+bool GetTableResponse::has_table() const {
+  return this != internal_default_instance() && table_ != NULL;
 }
-void GetTableRequest::set_db_name(const char* value, size_t size) {
-  
-  db_name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:mspb.GetTableRequest.db_name)
+void GetTableResponse::clear_table() {
+  if (GetArenaNoVirtual() == NULL && table_ != NULL) delete table_;
+  table_ = NULL;
 }
-::std::string* GetTableRequest::mutable_db_name() {
-  
-  // @@protoc_insertion_point(field_mutable:mspb.GetTableRequest.db_name)
-  return db_name_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+const ::metapb::Table& GetTableResponse::table() const {
+  const ::metapb::Table* p = table_;
+  // @@protoc_insertion_point(field_get:mspb.GetTableResponse.table)
+  return p != NULL ? *p : *reinterpret_cast<const ::metapb::Table*>(
+      &::metapb::_Table_default_instance_);
 }
-::std::string* GetTableRequest::release_db_name() {
-  // @@protoc_insertion_point(field_release:mspb.GetTableRequest.db_name)
+::metapb::Table* GetTableResponse::mutable_table() {
   
-  return db_name_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-void GetTableRequest::set_allocated_db_name(::std::string* db_name) {
-  if (db_name != NULL) {
-    
-  } else {
-    
+  if (table_ == NULL) {
+    table_ = new ::metapb::Table;
   }
-  db_name_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), db_name);
-  // @@protoc_insertion_point(field_set_allocated:mspb.GetTableRequest.db_name)
-}
-
-// string table_name = 3;
-void GetTableRequest::clear_table_name() {
-  table_name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-const ::std::string& GetTableRequest::table_name() const {
-  // @@protoc_insertion_point(field_get:mspb.GetTableRequest.table_name)
-  return table_name_.GetNoArena();
-}
-void GetTableRequest::set_table_name(const ::std::string& value) {
-  
-  table_name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:mspb.GetTableRequest.table_name)
-}
-#if LANG_CXX11
-void GetTableRequest::set_table_name(::std::string&& value) {
-  
-  table_name_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:mspb.GetTableRequest.table_name)
-}
-#endif
-void GetTableRequest::set_table_name(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  table_name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:mspb.GetTableRequest.table_name)
-}
-void GetTableRequest::set_table_name(const char* value, size_t size) {
-  
-  table_name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:mspb.GetTableRequest.table_name)
-}
-::std::string* GetTableRequest::mutable_table_name() {
-  
-  // @@protoc_insertion_point(field_mutable:mspb.GetTableRequest.table_name)
-  return table_name_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  // @@protoc_insertion_point(field_mutable:mspb.GetTableResponse.table)
+  return table_;
 }
-::std::string* GetTableRequest::release_table_name() {
-  // @@protoc_insertion_point(field_release:mspb.GetTableRequest.table_name)
+::metapb::Table* GetTableResponse::release_table() {
+  // @@protoc_insertion_point(field_release:mspb.GetTableResponse.table)
   
-  return table_name_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::metapb::Table* temp = table_;
+  table_ = NULL;
+  return temp;
 }
-void GetTableRequest::set_allocated_table_name(::std::string* table_name) {
-  if (table_name != NULL) {
+void GetTableResponse::set_allocated_table(::metapb::Table* table) {
+  delete table_;
+  table_ = table;
+  if (table) {
     
   } else {
     
   }
-  table_name_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), table_name);
-  // @@protoc_insertion_point(field_set_allocated:mspb.GetTableRequest.table_name)
+  // @@protoc_insertion_point(field_set_allocated:mspb.GetTableResponse.table)
 }
 
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -12769,76 +15734,78 @@ void GetTableRequest::set_allocated_table_name(::std::string* table_name) {
 // ===================================================================
 
 #if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int GetTableByIdRequest::kHeaderFieldNumber;
-const int GetTableByIdRequest::kDbIdFieldNumber;
-const int GetTableByIdRequest::kTableIdFieldNumber;
+const int GetTableByIdResponse::kHeaderFieldNumber;
+const int GetTableByIdResponse::kTableFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
-GetTableByIdRequest::GetTableByIdRequest()
+GetTableByIdResponse::GetTableByIdResponse()
   : ::google::protobuf::Message(), _internal_metadata_(NULL) {
   if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
     protobuf_mspb_2eproto::InitDefaults();
   }
   SharedCtor();
-  // @@protoc_insertion_point(constructor:mspb.GetTableByIdRequest)
+  // @@protoc_insertion_point(constructor:mspb.GetTableByIdResponse)
 }
-GetTableByIdRequest::GetTableByIdRequest(const GetTableByIdRequest& from)
+GetTableByIdResponse::GetTableByIdResponse(const GetTableByIdResponse& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
       _cached_size_(0) {
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   if (from.has_header()) {
-    header_ = new ::mspb::RequestHeader(*from.header_);
+    header_ = new ::mspb::ResponseHeader(*from.header_);
   } else {
     header_ = NULL;
   }
-  ::memcpy(&db_id_, &from.db_id_,
-    static_cast<size_t>(reinterpret_cast<char*>(&table_id_) -
-    reinterpret_cast<char*>(&db_id_)) + sizeof(table_id_));
-  // @@protoc_insertion_point(copy_constructor:mspb.GetTableByIdRequest)
+  if (from.has_table()) {
+    table_ = new ::metapb::Table(*from.table_);
+  } else {
+    table_ = NULL;
+  }
+  // @@protoc_insertion_point(copy_constructor:mspb.GetTableByIdResponse)
 }
 
-void GetTableByIdRequest::SharedCtor() {
+void GetTableByIdResponse::SharedCtor() {
   ::memset(&header_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&table_id_) -
-      reinterpret_cast<char*>(&header_)) + sizeof(table_id_));
+      reinterpret_cast<char*>(&table_) -
+      reinterpret_cast<char*>(&header_)) + sizeof(table_));
   _cached_size_ = 0;
 }
 
-GetTableByIdRequest::~GetTableByIdRequest() {
-  // @@protoc_insertion_point(destructor:mspb.GetTableByIdRequest)
+GetTableByIdResponse::~GetTableByIdResponse() {
+  // @@protoc_insertion_point(destructor:mspb.GetTableByIdResponse)
   SharedDtor();
 }
 
-void GetTableByIdRequest::SharedDtor() {
+void GetTableByIdResponse::SharedDtor() {
   if (this != internal_default_instance()) delete header_;
+  if (this != internal_default_instance()) delete table_;
 }
 
-void GetTableByIdRequest::SetCachedSize(int size) const {
+void GetTableByIdResponse::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* GetTableByIdRequest::descriptor() {
+const ::google::protobuf::Descriptor* GetTableByIdResponse::descriptor() {
   protobuf_mspb_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_mspb_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
 }
 
-const GetTableByIdRequest& GetTableByIdRequest::default_instance() {
+const GetTableByIdResponse& GetTableByIdResponse::default_instance() {
   protobuf_mspb_2eproto::InitDefaults();
   return *internal_default_instance();
 }
 
-GetTableByIdRequest* GetTableByIdRequest::New(::google::protobuf::Arena* arena) const {
-  GetTableByIdRequest* n = new GetTableByIdRequest;
+GetTableByIdResponse* GetTableByIdResponse::New(::google::protobuf::Arena* arena) const {
+  GetTableByIdResponse* n = new GetTableByIdResponse;
   if (arena != NULL) {
     arena->Own(n);
   }
   return n;
 }
 
-void GetTableByIdRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:mspb.GetTableByIdRequest)
+void GetTableByIdResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:mspb.GetTableByIdResponse)
   ::google::protobuf::uint32 cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
@@ -12847,23 +15814,24 @@ void GetTableByIdRequest::Clear() {
     delete header_;
   }
   header_ = NULL;
-  ::memset(&db_id_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&table_id_) -
-      reinterpret_cast<char*>(&db_id_)) + sizeof(table_id_));
+  if (GetArenaNoVirtual() == NULL && table_ != NULL) {
+    delete table_;
+  }
+  table_ = NULL;
   _internal_metadata_.Clear();
 }
 
-bool GetTableByIdRequest::MergePartialFromCodedStream(
+bool GetTableByIdResponse::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:mspb.GetTableByIdRequest)
+  // @@protoc_insertion_point(parse_start:mspb.GetTableByIdResponse)
   for (;;) {
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
     tag = p.first;
     if (!p.second) goto handle_unusual;
     switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // .mspb.RequestHeader header = 1;
+      // .mspb.ResponseHeader header = 1;
       case 1: {
         if (static_cast< ::google::protobuf::uint8>(tag) ==
             static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
@@ -12875,28 +15843,12 @@ bool GetTableByIdRequest::MergePartialFromCodedStream(
         break;
       }
 
-      // uint64 db_id = 2;
+      // .metapb.Table table = 2;
       case 2: {
         if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(16u /* 16 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
-                 input, &db_id_)));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // uint64 table_id = 3;
-      case 3: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(24u /* 24 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
-                 input, &table_id_)));
+            static_cast< ::google::protobuf::uint8>(18u /* 18 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_table()));
         } else {
           goto handle_unusual;
         }
@@ -12915,77 +15867,70 @@ bool GetTableByIdRequest::MergePartialFromCodedStream(
     }
   }
 success:
-  // @@protoc_insertion_point(parse_success:mspb.GetTableByIdRequest)
+  // @@protoc_insertion_point(parse_success:mspb.GetTableByIdResponse)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:mspb.GetTableByIdRequest)
+  // @@protoc_insertion_point(parse_failure:mspb.GetTableByIdResponse)
   return false;
 #undef DO_
 }
 
-void GetTableByIdRequest::SerializeWithCachedSizes(
+void GetTableByIdResponse::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:mspb.GetTableByIdRequest)
+  // @@protoc_insertion_point(serialize_start:mspb.GetTableByIdResponse)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // .mspb.RequestHeader header = 1;
+  // .mspb.ResponseHeader header = 1;
   if (this->has_header()) {
     ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
       1, *this->header_, output);
   }
 
-  // uint64 db_id = 2;
-  if (this->db_id() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt64(2, this->db_id(), output);
-  }
-
-  // uint64 table_id = 3;
-  if (this->table_id() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt64(3, this->table_id(), output);
+  // .metapb.Table table = 2;
+  if (this->has_table()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      2, *this->table_, output);
   }
 
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
     ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
   }
-  // @@protoc_insertion_point(serialize_end:mspb.GetTableByIdRequest)
+  // @@protoc_insertion_point(serialize_end:mspb.GetTableByIdResponse)
 }
 
-::google::protobuf::uint8* GetTableByIdRequest::InternalSerializeWithCachedSizesToArray(
+::google::protobuf::uint8* GetTableByIdResponse::InternalSerializeWithCachedSizesToArray(
     bool deterministic, ::google::protobuf::uint8* target) const {
   (void)deterministic; // Unused
-  // @@protoc_insertion_point(serialize_to_array_start:mspb.GetTableByIdRequest)
+  // @@protoc_insertion_point(serialize_to_array_start:mspb.GetTableByIdResponse)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // .mspb.RequestHeader header = 1;
+  // .mspb.ResponseHeader header = 1;
   if (this->has_header()) {
     target = ::google::protobuf::internal::WireFormatLite::
       InternalWriteMessageNoVirtualToArray(
         1, *this->header_, deterministic, target);
   }
 
-  // uint64 db_id = 2;
-  if (this->db_id() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(2, this->db_id(), target);
-  }
-
-  // uint64 table_id = 3;
-  if (this->table_id() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(3, this->table_id(), target);
+  // .metapb.Table table = 2;
+  if (this->has_table()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      InternalWriteMessageNoVirtualToArray(
+        2, *this->table_, deterministic, target);
   }
 
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
     target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:mspb.GetTableByIdRequest)
+  // @@protoc_insertion_point(serialize_to_array_end:mspb.GetTableByIdResponse)
   return target;
 }
 
-size_t GetTableByIdRequest::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:mspb.GetTableByIdRequest)
+size_t GetTableByIdResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mspb.GetTableByIdResponse)
   size_t total_size = 0;
 
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
@@ -12993,25 +15938,18 @@ size_t GetTableByIdRequest::ByteSizeLong() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
   }
-  // .mspb.RequestHeader header = 1;
+  // .mspb.ResponseHeader header = 1;
   if (this->has_header()) {
     total_size += 1 +
       ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
         *this->header_);
   }
 
-  // uint64 db_id = 2;
-  if (this->db_id() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt64Size(
-        this->db_id());
-  }
-
-  // uint64 table_id = 3;
-  if (this->table_id() != 0) {
+  // .metapb.Table table = 2;
+  if (this->has_table()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt64Size(
-        this->table_id());
+      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+        *this->table_);
   }
 
   int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
@@ -13021,108 +15959,104 @@ size_t GetTableByIdRequest::ByteSizeLong() const {
   return total_size;
 }
 
-void GetTableByIdRequest::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:mspb.GetTableByIdRequest)
+void GetTableByIdResponse::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:mspb.GetTableByIdResponse)
   GOOGLE_DCHECK_NE(&from, this);
-  const GetTableByIdRequest* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const GetTableByIdRequest>(
+  const GetTableByIdResponse* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const GetTableByIdResponse>(
           &from);
   if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:mspb.GetTableByIdRequest)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:mspb.GetTableByIdResponse)
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:mspb.GetTableByIdRequest)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:mspb.GetTableByIdResponse)
     MergeFrom(*source);
   }
 }
 
-void GetTableByIdRequest::MergeFrom(const GetTableByIdRequest& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:mspb.GetTableByIdRequest)
+void GetTableByIdResponse::MergeFrom(const GetTableByIdResponse& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:mspb.GetTableByIdResponse)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
   if (from.has_header()) {
-    mutable_header()->::mspb::RequestHeader::MergeFrom(from.header());
-  }
-  if (from.db_id() != 0) {
-    set_db_id(from.db_id());
+    mutable_header()->::mspb::ResponseHeader::MergeFrom(from.header());
   }
-  if (from.table_id() != 0) {
-    set_table_id(from.table_id());
+  if (from.has_table()) {
+    mutable_table()->::metapb::Table::MergeFrom(from.table());
   }
 }
 
-void GetTableByIdRequest::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:mspb.GetTableByIdRequest)
+void GetTableByIdResponse::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:mspb.GetTableByIdResponse)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void GetTableByIdRequest::CopyFrom(const GetTableByIdRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:mspb.GetTableByIdRequest)
+void GetTableByIdResponse::CopyFrom(const GetTableByIdResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mspb.GetTableByIdResponse)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool GetTableByIdRequest::IsInitialized() const {
+bool GetTableByIdResponse::IsInitialized() const {
   return true;
 }
 
-void GetTableByIdRequest::Swap(GetTableByIdRequest* other) {
+void GetTableByIdResponse::Swap(GetTableByIdResponse* other) {
   if (other == this) return;
   InternalSwap(other);
 }
-void GetTableByIdRequest::InternalSwap(GetTableByIdRequest* other) {
+void GetTableByIdResponse::InternalSwap(GetTableByIdResponse* other) {
   using std::swap;
   swap(header_, other->header_);
-  swap(db_id_, other->db_id_);
-  swap(table_id_, other->table_id_);
+  swap(table_, other->table_);
   _internal_metadata_.Swap(&other->_internal_metadata_);
   swap(_cached_size_, other->_cached_size_);
 }
 
-::google::protobuf::Metadata GetTableByIdRequest::GetMetadata() const {
+::google::protobuf::Metadata GetTableByIdResponse::GetMetadata() const {
   protobuf_mspb_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_mspb_2eproto::file_level_metadata[kIndexInFileMessages];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
-// GetTableByIdRequest
+// GetTableByIdResponse
 
-// .mspb.RequestHeader header = 1;
-bool GetTableByIdRequest::has_header() const {
+// .mspb.ResponseHeader header = 1;
+bool GetTableByIdResponse::has_header() const {
   return this != internal_default_instance() && header_ != NULL;
 }
-void GetTableByIdRequest::clear_header() {
+void GetTableByIdResponse::clear_header() {
   if (GetArenaNoVirtual() == NULL && header_ != NULL) delete header_;
   header_ = NULL;
 }
-const ::mspb::RequestHeader& GetTableByIdRequest::header() const {
-  const ::mspb::RequestHeader* p = header_;
-  // @@protoc_insertion_point(field_get:mspb.GetTableByIdRequest.header)
-  return p != NULL ? *p : *reinterpret_cast<const ::mspb::RequestHeader*>(
-      &::mspb::_RequestHeader_default_instance_);
+const ::mspb::ResponseHeader& GetTableByIdResponse::header() const {
+  const ::mspb::ResponseHeader* p = header_;
+  // @@protoc_insertion_point(field_get:mspb.GetTableByIdResponse.header)
+  return p != NULL ? *p : *reinterpret_cast<const ::mspb::ResponseHeader*>(
+      &::mspb::_ResponseHeader_default_instance_);
 }
-::mspb::RequestHeader* GetTableByIdRequest::mutable_header() {
+::mspb::ResponseHeader* GetTableByIdResponse::mutable_header() {
   
   if (header_ == NULL) {
-    header_ = new ::mspb::RequestHeader;
+    header_ = new ::mspb::ResponseHeader;
   }
-  // @@protoc_insertion_point(field_mutable:mspb.GetTableByIdRequest.header)
+  // @@protoc_insertion_point(field_mutable:mspb.GetTableByIdResponse.header)
   return header_;
 }
-::mspb::RequestHeader* GetTableByIdRequest::release_header() {
-  // @@protoc_insertion_point(field_release:mspb.GetTableByIdRequest.header)
+::mspb::ResponseHeader* GetTableByIdResponse::release_header() {
+  // @@protoc_insertion_point(field_release:mspb.GetTableByIdResponse.header)
   
-  ::mspb::RequestHeader* temp = header_;
+  ::mspb::ResponseHeader* temp = header_;
   header_ = NULL;
   return temp;
 }
-void GetTableByIdRequest::set_allocated_header(::mspb::RequestHeader* header) {
+void GetTableByIdResponse::set_allocated_header(::mspb::ResponseHeader* header) {
   delete header_;
   header_ = header;
   if (header) {
@@ -13130,35 +16064,47 @@ void GetTableByIdRequest::set_allocated_header(::mspb::RequestHeader* header) {
   } else {
     
   }
-  // @@protoc_insertion_point(field_set_allocated:mspb.GetTableByIdRequest.header)
+  // @@protoc_insertion_point(field_set_allocated:mspb.GetTableByIdResponse.header)
 }
 
-// uint64 db_id = 2;
-void GetTableByIdRequest::clear_db_id() {
-  db_id_ = GOOGLE_ULONGLONG(0);
-}
-::google::protobuf::uint64 GetTableByIdRequest::db_id() const {
-  // @@protoc_insertion_point(field_get:mspb.GetTableByIdRequest.db_id)
-  return db_id_;
+// .metapb.Table table = 2;
+bool GetTableByIdResponse::has_table() const {
+  return this != internal_default_instance() && table_ != NULL;
 }
-void GetTableByIdRequest::set_db_id(::google::protobuf::uint64 value) {
-  
-  db_id_ = value;
-  // @@protoc_insertion_point(field_set:mspb.GetTableByIdRequest.db_id)
+void GetTableByIdResponse::clear_table() {
+  if (GetArenaNoVirtual() == NULL && table_ != NULL) delete table_;
+  table_ = NULL;
 }
-
-// uint64 table_id = 3;
-void GetTableByIdRequest::clear_table_id() {
-  table_id_ = GOOGLE_ULONGLONG(0);
+const ::metapb::Table& GetTableByIdResponse::table() const {
+  const ::metapb::Table* p = table_;
+  // @@protoc_insertion_point(field_get:mspb.GetTableByIdResponse.table)
+  return p != NULL ? *p : *reinterpret_cast<const ::metapb::Table*>(
+      &::metapb::_Table_default_instance_);
 }
-::google::protobuf::uint64 GetTableByIdRequest::table_id() const {
-  // @@protoc_insertion_point(field_get:mspb.GetTableByIdRequest.table_id)
-  return table_id_;
+::metapb::Table* GetTableByIdResponse::mutable_table() {
+  
+  if (table_ == NULL) {
+    table_ = new ::metapb::Table;
+  }
+  // @@protoc_insertion_point(field_mutable:mspb.GetTableByIdResponse.table)
+  return table_;
 }
-void GetTableByIdRequest::set_table_id(::google::protobuf::uint64 value) {
+::metapb::Table* GetTableByIdResponse::release_table() {
+  // @@protoc_insertion_point(field_release:mspb.GetTableByIdResponse.table)
   
-  table_id_ = value;
-  // @@protoc_insertion_point(field_set:mspb.GetTableByIdRequest.table_id)
+  ::metapb::Table* temp = table_;
+  table_ = NULL;
+  return temp;
+}
+void GetTableByIdResponse::set_allocated_table(::metapb::Table* table) {
+  delete table_;
+  table_ = table;
+  if (table) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_set_allocated:mspb.GetTableByIdResponse.table)
 }
 
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -13166,78 +16112,76 @@ void GetTableByIdRequest::set_table_id(::google::protobuf::uint64 value) {
 // ===================================================================
 
 #if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int GetTableResponse::kHeaderFieldNumber;
-const int GetTableResponse::kTableFieldNumber;
+const int GetColumnsRequest::kHeaderFieldNumber;
+const int GetColumnsRequest::kDbIdFieldNumber;
+const int GetColumnsRequest::kTableIdFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
-GetTableResponse::GetTableResponse()
+GetColumnsRequest::GetColumnsRequest()
   : ::google::protobuf::Message(), _internal_metadata_(NULL) {
   if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
     protobuf_mspb_2eproto::InitDefaults();
   }
   SharedCtor();
-  // @@protoc_insertion_point(constructor:mspb.GetTableResponse)
+  // @@protoc_insertion_point(constructor:mspb.GetColumnsRequest)
 }
-GetTableResponse::GetTableResponse(const GetTableResponse& from)
+GetColumnsRequest::GetColumnsRequest(const GetColumnsRequest& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
       _cached_size_(0) {
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   if (from.has_header()) {
-    header_ = new ::mspb::ResponseHeader(*from.header_);
+    header_ = new ::mspb::RequestHeader(*from.header_);
   } else {
     header_ = NULL;
   }
-  if (from.has_table()) {
-    table_ = new ::metapb::Table(*from.table_);
-  } else {
-    table_ = NULL;
-  }
-  // @@protoc_insertion_point(copy_constructor:mspb.GetTableResponse)
+  ::memcpy(&db_id_, &from.db_id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&table_id_) -
+    reinterpret_cast<char*>(&db_id_)) + sizeof(table_id_));
+  // @@protoc_insertion_point(copy_constructor:mspb.GetColumnsRequest)
 }
 
-void GetTableResponse::SharedCtor() {
+void GetColumnsRequest::SharedCtor() {
   ::memset(&header_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&table_) -
-      reinterpret_cast<char*>(&header_)) + sizeof(table_));
+      reinterpret_cast<char*>(&table_id_) -
+      reinterpret_cast<char*>(&header_)) + sizeof(table_id_));
   _cached_size_ = 0;
 }
 
-GetTableResponse::~GetTableResponse() {
-  // @@protoc_insertion_point(destructor:mspb.GetTableResponse)
+GetColumnsRequest::~GetColumnsRequest() {
+  // @@protoc_insertion_point(destructor:mspb.GetColumnsRequest)
   SharedDtor();
 }
 
-void GetTableResponse::SharedDtor() {
+void GetColumnsRequest::SharedDtor() {
   if (this != internal_default_instance()) delete header_;
-  if (this != internal_default_instance()) delete table_;
 }
 
-void GetTableResponse::SetCachedSize(int size) const {
+void GetColumnsRequest::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* GetTableResponse::descriptor() {
+const ::google::protobuf::Descriptor* GetColumnsRequest::descriptor() {
   protobuf_mspb_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_mspb_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
 }
 
-const GetTableResponse& GetTableResponse::default_instance() {
+const GetColumnsRequest& GetColumnsRequest::default_instance() {
   protobuf_mspb_2eproto::InitDefaults();
   return *internal_default_instance();
 }
 
-GetTableResponse* GetTableResponse::New(::google::protobuf::Arena* arena) const {
-  GetTableResponse* n = new GetTableResponse;
+GetColumnsRequest* GetColumnsRequest::New(::google::protobuf::Arena* arena) const {
+  GetColumnsRequest* n = new GetColumnsRequest;
   if (arena != NULL) {
     arena->Own(n);
   }
   return n;
 }
 
-void GetTableResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:mspb.GetTableResponse)
+void GetColumnsRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:mspb.GetColumnsRequest)
   ::google::protobuf::uint32 cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
@@ -13246,24 +16190,23 @@ void GetTableResponse::Clear() {
     delete header_;
   }
   header_ = NULL;
-  if (GetArenaNoVirtual() == NULL && table_ != NULL) {
-    delete table_;
-  }
-  table_ = NULL;
+  ::memset(&db_id_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&table_id_) -
+      reinterpret_cast<char*>(&db_id_)) + sizeof(table_id_));
   _internal_metadata_.Clear();
 }
 
-bool GetTableResponse::MergePartialFromCodedStream(
+bool GetColumnsRequest::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:mspb.GetTableResponse)
+  // @@protoc_insertion_point(parse_start:mspb.GetColumnsRequest)
   for (;;) {
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
     tag = p.first;
     if (!p.second) goto handle_unusual;
     switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // .mspb.ResponseHeader header = 1;
+      // .mspb.RequestHeader header = 1;
       case 1: {
         if (static_cast< ::google::protobuf::uint8>(tag) ==
             static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
@@ -13275,12 +16218,28 @@ bool GetTableResponse::MergePartialFromCodedStream(
         break;
       }
 
-      // .metapb.Table table = 2;
+      // uint64 db_id = 2;
       case 2: {
         if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(18u /* 18 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_table()));
+            static_cast< ::google::protobuf::uint8>(16u /* 16 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &db_id_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint64 table_id = 3;
+      case 3: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(24u /* 24 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &table_id_)));
         } else {
           goto handle_unusual;
         }
@@ -13299,70 +16258,77 @@ bool GetTableResponse::MergePartialFromCodedStream(
     }
   }
 success:
-  // @@protoc_insertion_point(parse_success:mspb.GetTableResponse)
+  // @@protoc_insertion_point(parse_success:mspb.GetColumnsRequest)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:mspb.GetTableResponse)
+  // @@protoc_insertion_point(parse_failure:mspb.GetColumnsRequest)
   return false;
 #undef DO_
 }
 
-void GetTableResponse::SerializeWithCachedSizes(
+void GetColumnsRequest::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:mspb.GetTableResponse)
+  // @@protoc_insertion_point(serialize_start:mspb.GetColumnsRequest)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // .mspb.ResponseHeader header = 1;
+  // .mspb.RequestHeader header = 1;
   if (this->has_header()) {
     ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
       1, *this->header_, output);
   }
 
-  // .metapb.Table table = 2;
-  if (this->has_table()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      2, *this->table_, output);
+  // uint64 db_id = 2;
+  if (this->db_id() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(2, this->db_id(), output);
+  }
+
+  // uint64 table_id = 3;
+  if (this->table_id() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(3, this->table_id(), output);
   }
 
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
     ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
   }
-  // @@protoc_insertion_point(serialize_end:mspb.GetTableResponse)
+  // @@protoc_insertion_point(serialize_end:mspb.GetColumnsRequest)
 }
 
-::google::protobuf::uint8* GetTableResponse::InternalSerializeWithCachedSizesToArray(
+::google::protobuf::uint8* GetColumnsRequest::InternalSerializeWithCachedSizesToArray(
     bool deterministic, ::google::protobuf::uint8* target) const {
   (void)deterministic; // Unused
-  // @@protoc_insertion_point(serialize_to_array_start:mspb.GetTableResponse)
+  // @@protoc_insertion_point(serialize_to_array_start:mspb.GetColumnsRequest)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // .mspb.ResponseHeader header = 1;
+  // .mspb.RequestHeader header = 1;
   if (this->has_header()) {
     target = ::google::protobuf::internal::WireFormatLite::
       InternalWriteMessageNoVirtualToArray(
         1, *this->header_, deterministic, target);
   }
 
-  // .metapb.Table table = 2;
-  if (this->has_table()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageNoVirtualToArray(
-        2, *this->table_, deterministic, target);
+  // uint64 db_id = 2;
+  if (this->db_id() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(2, this->db_id(), target);
+  }
+
+  // uint64 table_id = 3;
+  if (this->table_id() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(3, this->table_id(), target);
   }
 
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
     target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:mspb.GetTableResponse)
+  // @@protoc_insertion_point(serialize_to_array_end:mspb.GetColumnsRequest)
   return target;
 }
 
-size_t GetTableResponse::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:mspb.GetTableResponse)
+size_t GetColumnsRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mspb.GetColumnsRequest)
   size_t total_size = 0;
 
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
@@ -13370,18 +16336,25 @@ size_t GetTableResponse::ByteSizeLong() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
   }
-  // .mspb.ResponseHeader header = 1;
+  // .mspb.RequestHeader header = 1;
   if (this->has_header()) {
     total_size += 1 +
       ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
         *this->header_);
   }
 
-  // .metapb.Table table = 2;
-  if (this->has_table()) {
+  // uint64 db_id = 2;
+  if (this->db_id() != 0) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-        *this->table_);
+      ::google::protobuf::internal::WireFormatLite::UInt64Size(
+        this->db_id());
+  }
+
+  // uint64 table_id = 3;
+  if (this->table_id() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt64Size(
+        this->table_id());
   }
 
   int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
@@ -13391,152 +16364,144 @@ size_t GetTableResponse::ByteSizeLong() const {
   return total_size;
 }
 
-void GetTableResponse::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:mspb.GetTableResponse)
+void GetColumnsRequest::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:mspb.GetColumnsRequest)
   GOOGLE_DCHECK_NE(&from, this);
-  const GetTableResponse* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const GetTableResponse>(
+  const GetColumnsRequest* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const GetColumnsRequest>(
           &from);
   if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:mspb.GetTableResponse)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:mspb.GetColumnsRequest)
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:mspb.GetTableResponse)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:mspb.GetColumnsRequest)
     MergeFrom(*source);
   }
 }
 
-void GetTableResponse::MergeFrom(const GetTableResponse& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:mspb.GetTableResponse)
+void GetColumnsRequest::MergeFrom(const GetColumnsRequest& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:mspb.GetColumnsRequest)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
   if (from.has_header()) {
-    mutable_header()->::mspb::ResponseHeader::MergeFrom(from.header());
+    mutable_header()->::mspb::RequestHeader::MergeFrom(from.header());
   }
-  if (from.has_table()) {
-    mutable_table()->::metapb::Table::MergeFrom(from.table());
+  if (from.db_id() != 0) {
+    set_db_id(from.db_id());
+  }
+  if (from.table_id() != 0) {
+    set_table_id(from.table_id());
   }
 }
 
-void GetTableResponse::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:mspb.GetTableResponse)
+void GetColumnsRequest::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:mspb.GetColumnsRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void GetTableResponse::CopyFrom(const GetTableResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:mspb.GetTableResponse)
+void GetColumnsRequest::CopyFrom(const GetColumnsRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mspb.GetColumnsRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool GetTableResponse::IsInitialized() const {
+bool GetColumnsRequest::IsInitialized() const {
   return true;
 }
 
-void GetTableResponse::Swap(GetTableResponse* other) {
+void GetColumnsRequest::Swap(GetColumnsRequest* other) {
   if (other == this) return;
   InternalSwap(other);
 }
-void GetTableResponse::InternalSwap(GetTableResponse* other) {
+void GetColumnsRequest::InternalSwap(GetColumnsRequest* other) {
   using std::swap;
   swap(header_, other->header_);
-  swap(table_, other->table_);
+  swap(db_id_, other->db_id_);
+  swap(table_id_, other->table_id_);
   _internal_metadata_.Swap(&other->_internal_metadata_);
   swap(_cached_size_, other->_cached_size_);
 }
 
-::google::protobuf::Metadata GetTableResponse::GetMetadata() const {
+::google::protobuf::Metadata GetColumnsRequest::GetMetadata() const {
   protobuf_mspb_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_mspb_2eproto::file_level_metadata[kIndexInFileMessages];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
-// GetTableResponse
+// GetColumnsRequest
 
-// .mspb.ResponseHeader header = 1;
-bool GetTableResponse::has_header() const {
+// .mspb.RequestHeader header = 1;
+bool GetColumnsRequest::has_header() const {
   return this != internal_default_instance() && header_ != NULL;
 }
-void GetTableResponse::clear_header() {
+void GetColumnsRequest::clear_header() {
   if (GetArenaNoVirtual() == NULL && header_ != NULL) delete header_;
   header_ = NULL;
 }
-const ::mspb::ResponseHeader& GetTableResponse::header() const {
-  const ::mspb::ResponseHeader* p = header_;
-  // @@protoc_insertion_point(field_get:mspb.GetTableResponse.header)
-  return p != NULL ? *p : *reinterpret_cast<const ::mspb::ResponseHeader*>(
-      &::mspb::_ResponseHeader_default_instance_);
+const ::mspb::RequestHeader& GetColumnsRequest::header() const {
+  const ::mspb::RequestHeader* p = header_;
+  // @@protoc_insertion_point(field_get:mspb.GetColumnsRequest.header)
+  return p != NULL ? *p : *reinterpret_cast<const ::mspb::RequestHeader*>(
+      &::mspb::_RequestHeader_default_instance_);
 }
-::mspb::ResponseHeader* GetTableResponse::mutable_header() {
+::mspb::RequestHeader* GetColumnsRequest::mutable_header() {
   
   if (header_ == NULL) {
-    header_ = new ::mspb::ResponseHeader;
+    header_ = new ::mspb::RequestHeader;
   }
-  // @@protoc_insertion_point(field_mutable:mspb.GetTableResponse.header)
+  // @@protoc_insertion_point(field_mutable:mspb.GetColumnsRequest.header)
   return header_;
-}
-::mspb::ResponseHeader* GetTableResponse::release_header() {
-  // @@protoc_insertion_point(field_release:mspb.GetTableResponse.header)
-  
-  ::mspb::ResponseHeader* temp = header_;
-  header_ = NULL;
-  return temp;
-}
-void GetTableResponse::set_allocated_header(::mspb::ResponseHeader* header) {
-  delete header_;
-  header_ = header;
-  if (header) {
-    
-  } else {
-    
-  }
-  // @@protoc_insertion_point(field_set_allocated:mspb.GetTableResponse.header)
-}
-
-// .metapb.Table table = 2;
-bool GetTableResponse::has_table() const {
-  return this != internal_default_instance() && table_ != NULL;
-}
-void GetTableResponse::clear_table() {
-  if (GetArenaNoVirtual() == NULL && table_ != NULL) delete table_;
-  table_ = NULL;
-}
-const ::metapb::Table& GetTableResponse::table() const {
-  const ::metapb::Table* p = table_;
-  // @@protoc_insertion_point(field_get:mspb.GetTableResponse.table)
-  return p != NULL ? *p : *reinterpret_cast<const ::metapb::Table*>(
-      &::metapb::_Table_default_instance_);
-}
-::metapb::Table* GetTableResponse::mutable_table() {
-  
-  if (table_ == NULL) {
-    table_ = new ::metapb::Table;
-  }
-  // @@protoc_insertion_point(field_mutable:mspb.GetTableResponse.table)
-  return table_;
-}
-::metapb::Table* GetTableResponse::release_table() {
-  // @@protoc_insertion_point(field_release:mspb.GetTableResponse.table)
+}
+::mspb::RequestHeader* GetColumnsRequest::release_header() {
+  // @@protoc_insertion_point(field_release:mspb.GetColumnsRequest.header)
   
-  ::metapb::Table* temp = table_;
-  table_ = NULL;
+  ::mspb::RequestHeader* temp = header_;
+  header_ = NULL;
   return temp;
 }
-void GetTableResponse::set_allocated_table(::metapb::Table* table) {
-  delete table_;
-  table_ = table;
-  if (table) {
+void GetColumnsRequest::set_allocated_header(::mspb::RequestHeader* header) {
+  delete header_;
+  header_ = header;
+  if (header) {
     
   } else {
     
   }
-  // @@protoc_insertion_point(field_set_allocated:mspb.GetTableResponse.table)
+  // @@protoc_insertion_point(field_set_allocated:mspb.GetColumnsRequest.header)
+}
+
+// uint64 db_id = 2;
+void GetColumnsRequest::clear_db_id() {
+  db_id_ = GOOGLE_ULONGLONG(0);
+}
+::google::protobuf::uint64 GetColumnsRequest::db_id() const {
+  // @@protoc_insertion_point(field_get:mspb.GetColumnsRequest.db_id)
+  return db_id_;
+}
+void GetColumnsRequest::set_db_id(::google::protobuf::uint64 value) {
+  
+  db_id_ = value;
+  // @@protoc_insertion_point(field_set:mspb.GetColumnsRequest.db_id)
+}
+
+// uint64 table_id = 3;
+void GetColumnsRequest::clear_table_id() {
+  table_id_ = GOOGLE_ULONGLONG(0);
+}
+::google::protobuf::uint64 GetColumnsRequest::table_id() const {
+  // @@protoc_insertion_point(field_get:mspb.GetColumnsRequest.table_id)
+  return table_id_;
+}
+void GetColumnsRequest::set_table_id(::google::protobuf::uint64 value) {
+  
+  table_id_ = value;
+  // @@protoc_insertion_point(field_set:mspb.GetColumnsRequest.table_id)
 }
 
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -13544,21 +16509,22 @@ void GetTableResponse::set_allocated_table(::metapb::Table* table) {
 // ===================================================================
 
 #if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int GetTableByIdResponse::kHeaderFieldNumber;
-const int GetTableByIdResponse::kTableFieldNumber;
+const int GetColumnsResponse::kHeaderFieldNumber;
+const int GetColumnsResponse::kColumnsFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
-GetTableByIdResponse::GetTableByIdResponse()
+GetColumnsResponse::GetColumnsResponse()
   : ::google::protobuf::Message(), _internal_metadata_(NULL) {
   if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
     protobuf_mspb_2eproto::InitDefaults();
   }
   SharedCtor();
-  // @@protoc_insertion_point(constructor:mspb.GetTableByIdResponse)
+  // @@protoc_insertion_point(constructor:mspb.GetColumnsResponse)
 }
-GetTableByIdResponse::GetTableByIdResponse(const GetTableByIdResponse& from)
+GetColumnsResponse::GetColumnsResponse(const GetColumnsResponse& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
+      columns_(from.columns_),
       _cached_size_(0) {
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   if (from.has_header()) {
@@ -13566,76 +16532,65 @@ GetTableByIdResponse::GetTableByIdResponse(const GetTableByIdResponse& from)
   } else {
     header_ = NULL;
   }
-  if (from.has_table()) {
-    table_ = new ::metapb::Table(*from.table_);
-  } else {
-    table_ = NULL;
-  }
-  // @@protoc_insertion_point(copy_constructor:mspb.GetTableByIdResponse)
+  // @@protoc_insertion_point(copy_constructor:mspb.GetColumnsResponse)
 }
 
-void GetTableByIdResponse::SharedCtor() {
-  ::memset(&header_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&table_) -
-      reinterpret_cast<char*>(&header_)) + sizeof(table_));
+void GetColumnsResponse::SharedCtor() {
+  header_ = NULL;
   _cached_size_ = 0;
 }
 
-GetTableByIdResponse::~GetTableByIdResponse() {
-  // @@protoc_insertion_point(destructor:mspb.GetTableByIdResponse)
+GetColumnsResponse::~GetColumnsResponse() {
+  // @@protoc_insertion_point(destructor:mspb.GetColumnsResponse)
   SharedDtor();
 }
 
-void GetTableByIdResponse::SharedDtor() {
+void GetColumnsResponse::SharedDtor() {
   if (this != internal_default_instance()) delete header_;
-  if (this != internal_default_instance()) delete table_;
 }
 
-void GetTableByIdResponse::SetCachedSize(int size) const {
+void GetColumnsResponse::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* GetTableByIdResponse::descriptor() {
+const ::google::protobuf::Descriptor* GetColumnsResponse::descriptor() {
   protobuf_mspb_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_mspb_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
 }
 
-const GetTableByIdResponse& GetTableByIdResponse::default_instance() {
+const GetColumnsResponse& GetColumnsResponse::default_instance() {
   protobuf_mspb_2eproto::InitDefaults();
   return *internal_default_instance();
 }
 
-GetTableByIdResponse* GetTableByIdResponse::New(::google::protobuf::Arena* arena) const {
-  GetTableByIdResponse* n = new GetTableByIdResponse;
+GetColumnsResponse* GetColumnsResponse::New(::google::protobuf::Arena* arena) const {
+  GetColumnsResponse* n = new GetColumnsResponse;
   if (arena != NULL) {
     arena->Own(n);
   }
   return n;
 }
 
-void GetTableByIdResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:mspb.GetTableByIdResponse)
+void GetColumnsResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:mspb.GetColumnsResponse)
   ::google::protobuf::uint32 cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
+  columns_.Clear();
   if (GetArenaNoVirtual() == NULL && header_ != NULL) {
     delete header_;
   }
   header_ = NULL;
-  if (GetArenaNoVirtual() == NULL && table_ != NULL) {
-    delete table_;
-  }
-  table_ = NULL;
   _internal_metadata_.Clear();
 }
 
-bool GetTableByIdResponse::MergePartialFromCodedStream(
+bool GetColumnsResponse::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:mspb.GetTableByIdResponse)
+  // @@protoc_insertion_point(parse_start:mspb.GetColumnsResponse)
   for (;;) {
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
     tag = p.first;
@@ -13653,12 +16608,12 @@ bool GetTableByIdResponse::MergePartialFromCodedStream(
         break;
       }
 
-      // .metapb.Table table = 2;
+      // repeated .metapb.Column columns = 2;
       case 2: {
         if (static_cast< ::google::protobuf::uint8>(tag) ==
             static_cast< ::google::protobuf::uint8>(18u /* 18 & 0xFF */)) {
           DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_table()));
+                input, add_columns()));
         } else {
           goto handle_unusual;
         }
@@ -13677,17 +16632,17 @@ bool GetTableByIdResponse::MergePartialFromCodedStream(
     }
   }
 success:
-  // @@protoc_insertion_point(parse_success:mspb.GetTableByIdResponse)
+  // @@protoc_insertion_point(parse_success:mspb.GetColumnsResponse)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:mspb.GetTableByIdResponse)
+  // @@protoc_insertion_point(parse_failure:mspb.GetColumnsResponse)
   return false;
 #undef DO_
 }
 
-void GetTableByIdResponse::SerializeWithCachedSizes(
+void GetColumnsResponse::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:mspb.GetTableByIdResponse)
+  // @@protoc_insertion_point(serialize_start:mspb.GetColumnsResponse)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
@@ -13697,23 +16652,24 @@ void GetTableByIdResponse::SerializeWithCachedSizes(
       1, *this->header_, output);
   }
 
-  // .metapb.Table table = 2;
-  if (this->has_table()) {
+  // repeated .metapb.Column columns = 2;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->columns_size()); i < n; i++) {
     ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      2, *this->table_, output);
+      2, this->columns(static_cast<int>(i)), output);
   }
 
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
     ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
   }
-  // @@protoc_insertion_point(serialize_end:mspb.GetTableByIdResponse)
+  // @@protoc_insertion_point(serialize_end:mspb.GetColumnsResponse)
 }
 
-::google::protobuf::uint8* GetTableByIdResponse::InternalSerializeWithCachedSizesToArray(
+::google::protobuf::uint8* GetColumnsResponse::InternalSerializeWithCachedSizesToArray(
     bool deterministic, ::google::protobuf::uint8* target) const {
   (void)deterministic; // Unused
-  // @@protoc_insertion_point(serialize_to_array_start:mspb.GetTableByIdResponse)
+  // @@protoc_insertion_point(serialize_to_array_start:mspb.GetColumnsResponse)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
@@ -13724,23 +16680,24 @@ void GetTableByIdResponse::SerializeWithCachedSizes(
         1, *this->header_, deterministic, target);
   }
 
-  // .metapb.Table table = 2;
-  if (this->has_table()) {
+  // repeated .metapb.Column columns = 2;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->columns_size()); i < n; i++) {
     target = ::google::protobuf::internal::WireFormatLite::
       InternalWriteMessageNoVirtualToArray(
-        2, *this->table_, deterministic, target);
+        2, this->columns(static_cast<int>(i)), deterministic, target);
   }
 
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
     target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:mspb.GetTableByIdResponse)
+  // @@protoc_insertion_point(serialize_to_array_end:mspb.GetColumnsResponse)
   return target;
 }
 
-size_t GetTableByIdResponse::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:mspb.GetTableByIdResponse)
+size_t GetColumnsResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mspb.GetColumnsResponse)
   size_t total_size = 0;
 
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
@@ -13748,6 +16705,17 @@ size_t GetTableByIdResponse::ByteSizeLong() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
   }
+  // repeated .metapb.Column columns = 2;
+  {
+    unsigned int count = static_cast<unsigned int>(this->columns_size());
+    total_size += 1UL * count;
+    for (unsigned int i = 0; i < count; i++) {
+      total_size +=
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->columns(static_cast<int>(i)));
+    }
+  }
+
   // .mspb.ResponseHeader header = 1;
   if (this->has_header()) {
     total_size += 1 +
@@ -13755,13 +16723,6 @@ size_t GetTableByIdResponse::ByteSizeLong() const {
         *this->header_);
   }
 
-  // .metapb.Table table = 2;
-  if (this->has_table()) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-        *this->table_);
-  }
-
   int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = cached_size;
@@ -13769,152 +16730,140 @@ size_t GetTableByIdResponse::ByteSizeLong() const {
   return total_size;
 }
 
-void GetTableByIdResponse::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:mspb.GetTableByIdResponse)
+void GetColumnsResponse::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:mspb.GetColumnsResponse)
   GOOGLE_DCHECK_NE(&from, this);
-  const GetTableByIdResponse* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const GetTableByIdResponse>(
+  const GetColumnsResponse* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const GetColumnsResponse>(
           &from);
   if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:mspb.GetTableByIdResponse)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:mspb.GetColumnsResponse)
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:mspb.GetTableByIdResponse)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:mspb.GetColumnsResponse)
     MergeFrom(*source);
   }
 }
 
-void GetTableByIdResponse::MergeFrom(const GetTableByIdResponse& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:mspb.GetTableByIdResponse)
+void GetColumnsResponse::MergeFrom(const GetColumnsResponse& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:mspb.GetColumnsResponse)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
+  columns_.MergeFrom(from.columns_);
   if (from.has_header()) {
     mutable_header()->::mspb::ResponseHeader::MergeFrom(from.header());
   }
-  if (from.has_table()) {
-    mutable_table()->::metapb::Table::MergeFrom(from.table());
-  }
 }
 
-void GetTableByIdResponse::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:mspb.GetTableByIdResponse)
+void GetColumnsResponse::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:mspb.GetColumnsResponse)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void GetTableByIdResponse::CopyFrom(const GetTableByIdResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:mspb.GetTableByIdResponse)
+void GetColumnsResponse::CopyFrom(const GetColumnsResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mspb.GetColumnsResponse)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool GetTableByIdResponse::IsInitialized() const {
+bool GetColumnsResponse::IsInitialized() const {
   return true;
 }
 
-void GetTableByIdResponse::Swap(GetTableByIdResponse* other) {
+void GetColumnsResponse::Swap(GetColumnsResponse* other) {
   if (other == this) return;
   InternalSwap(other);
 }
-void GetTableByIdResponse::InternalSwap(GetTableByIdResponse* other) {
+void GetColumnsResponse::InternalSwap(GetColumnsResponse* other) {
   using std::swap;
+  columns_.InternalSwap(&other->columns_);
   swap(header_, other->header_);
-  swap(table_, other->table_);
   _internal_metadata_.Swap(&other->_internal_metadata_);
   swap(_cached_size_, other->_cached_size_);
 }
 
-::google::protobuf::Metadata GetTableByIdResponse::GetMetadata() const {
+::google::protobuf::Metadata GetColumnsResponse::GetMetadata() const {
   protobuf_mspb_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_mspb_2eproto::file_level_metadata[kIndexInFileMessages];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
-// GetTableByIdResponse
+// GetColumnsResponse
 
 // .mspb.ResponseHeader header = 1;
-bool GetTableByIdResponse::has_header() const {
+bool GetColumnsResponse::has_header() const {
   return this != internal_default_instance() && header_ != NULL;
 }
-void GetTableByIdResponse::clear_header() {
+void GetColumnsResponse::clear_header() {
   if (GetArenaNoVirtual() == NULL && header_ != NULL) delete header_;
   header_ = NULL;
 }
-const ::mspb::ResponseHeader& GetTableByIdResponse::header() const {
+const ::mspb::ResponseHeader& GetColumnsResponse::header() const {
   const ::mspb::ResponseHeader* p = header_;
-  // @@protoc_insertion_point(field_get:mspb.GetTableByIdResponse.header)
+  // @@protoc_insertion_point(field_get:mspb.GetColumnsResponse.header)
   return p != NULL ? *p : *reinterpret_cast<const ::mspb::ResponseHeader*>(
       &::mspb::_ResponseHeader_default_instance_);
 }
-::mspb::ResponseHeader* GetTableByIdResponse::mutable_header() {
+::mspb::ResponseHeader* GetColumnsResponse::mutable_header() {
   
   if (header_ == NULL) {
     header_ = new ::mspb::ResponseHeader;
   }
-  // @@protoc_insertion_point(field_mutable:mspb.GetTableByIdResponse.header)
+  // @@protoc_insertion_point(field_mutable:mspb.GetColumnsResponse.header)
   return header_;
 }
-::mspb::ResponseHeader* GetTableByIdResponse::release_header() {
-  // @@protoc_insertion_point(field_release:mspb.GetTableByIdResponse.header)
+::mspb::ResponseHeader* GetColumnsResponse::release_header() {
+  // @@protoc_insertion_point(field_release:mspb.GetColumnsResponse.header)
   
   ::mspb::ResponseHeader* temp = header_;
   header_ = NULL;
   return temp;
 }
-void GetTableByIdResponse::set_allocated_header(::mspb::ResponseHeader* header) {
-  delete header_;
-  header_ = header;
-  if (header) {
-    
-  } else {
-    
-  }
-  // @@protoc_insertion_point(field_set_allocated:mspb.GetTableByIdResponse.header)
-}
-
-// .metapb.Table table = 2;
-bool GetTableByIdResponse::has_table() const {
-  return this != internal_default_instance() && table_ != NULL;
-}
-void GetTableByIdResponse::clear_table() {
-  if (GetArenaNoVirtual() == NULL && table_ != NULL) delete table_;
-  table_ = NULL;
-}
-const ::metapb::Table& GetTableByIdResponse::table() const {
-  const ::metapb::Table* p = table_;
-  // @@protoc_insertion_point(field_get:mspb.GetTableByIdResponse.table)
-  return p != NULL ? *p : *reinterpret_cast<const ::metapb::Table*>(
-      &::metapb::_Table_default_instance_);
-}
-::metapb::Table* GetTableByIdResponse::mutable_table() {
-  
-  if (table_ == NULL) {
-    table_ = new ::metapb::Table;
-  }
-  // @@protoc_insertion_point(field_mutable:mspb.GetTableByIdResponse.table)
-  return table_;
-}
-::metapb::Table* GetTableByIdResponse::release_table() {
-  // @@protoc_insertion_point(field_release:mspb.GetTableByIdResponse.table)
-  
-  ::metapb::Table* temp = table_;
-  table_ = NULL;
-  return temp;
-}
-void GetTableByIdResponse::set_allocated_table(::metapb::Table* table) {
-  delete table_;
-  table_ = table;
-  if (table) {
+void GetColumnsResponse::set_allocated_header(::mspb::ResponseHeader* header) {
+  delete header_;
+  header_ = header;
+  if (header) {
     
   } else {
     
   }
-  // @@protoc_insertion_point(field_set_allocated:mspb.GetTableByIdResponse.table)
+  // @@protoc_insertion_point(field_set_allocated:mspb.GetColumnsResponse.header)
+}
+
+// repeated .metapb.Column columns = 2;
+int GetColumnsResponse::columns_size() const {
+  return columns_.size();
+}
+void GetColumnsResponse::clear_columns() {
+  columns_.Clear();
+}
+const ::metapb::Column& GetColumnsResponse::columns(int index) const {
+  // @@protoc_insertion_point(field_get:mspb.GetColumnsResponse.columns)
+  return columns_.Get(index);
+}
+::metapb::Column* GetColumnsResponse::mutable_columns(int index) {
+  // @@protoc_insertion_point(field_mutable:mspb.GetColumnsResponse.columns)
+  return columns_.Mutable(index);
+}
+::metapb::Column* GetColumnsResponse::add_columns() {
+  // @@protoc_insertion_point(field_add:mspb.GetColumnsResponse.columns)
+  return columns_.Add();
+}
+::google::protobuf::RepeatedPtrField< ::metapb::Column >*
+GetColumnsResponse::mutable_columns() {
+  // @@protoc_insertion_point(field_mutable_list:mspb.GetColumnsResponse.columns)
+  return &columns_;
+}
+const ::google::protobuf::RepeatedPtrField< ::metapb::Column >&
+GetColumnsResponse::columns() const {
+  // @@protoc_insertion_point(field_list:mspb.GetColumnsResponse.columns)
+  return columns_;
 }
 
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -13922,24 +16871,29 @@ void GetTableByIdResponse::set_allocated_table(::metapb::Table* table) {
 // ===================================================================
 
 #if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int GetColumnsRequest::kHeaderFieldNumber;
-const int GetColumnsRequest::kDbIdFieldNumber;
-const int GetColumnsRequest::kTableIdFieldNumber;
+const int GetColumnByNameRequest::kHeaderFieldNumber;
+const int GetColumnByNameRequest::kDbIdFieldNumber;
+const int GetColumnByNameRequest::kTableIdFieldNumber;
+const int GetColumnByNameRequest::kColNameFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
-GetColumnsRequest::GetColumnsRequest()
+GetColumnByNameRequest::GetColumnByNameRequest()
   : ::google::protobuf::Message(), _internal_metadata_(NULL) {
   if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
     protobuf_mspb_2eproto::InitDefaults();
   }
   SharedCtor();
-  // @@protoc_insertion_point(constructor:mspb.GetColumnsRequest)
+  // @@protoc_insertion_point(constructor:mspb.GetColumnByNameRequest)
 }
-GetColumnsRequest::GetColumnsRequest(const GetColumnsRequest& from)
+GetColumnByNameRequest::GetColumnByNameRequest(const GetColumnByNameRequest& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
       _cached_size_(0) {
   _internal_metadata_.MergeFrom(from._internal_metadata_);
+  col_name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (from.col_name().size() > 0) {
+    col_name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.col_name_);
+  }
   if (from.has_header()) {
     header_ = new ::mspb::RequestHeader(*from.header_);
   } else {
@@ -13948,54 +16902,57 @@ GetColumnsRequest::GetColumnsRequest(const GetColumnsRequest& from)
   ::memcpy(&db_id_, &from.db_id_,
     static_cast<size_t>(reinterpret_cast<char*>(&table_id_) -
     reinterpret_cast<char*>(&db_id_)) + sizeof(table_id_));
-  // @@protoc_insertion_point(copy_constructor:mspb.GetColumnsRequest)
+  // @@protoc_insertion_point(copy_constructor:mspb.GetColumnByNameRequest)
 }
 
-void GetColumnsRequest::SharedCtor() {
+void GetColumnByNameRequest::SharedCtor() {
+  col_name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   ::memset(&header_, 0, static_cast<size_t>(
       reinterpret_cast<char*>(&table_id_) -
       reinterpret_cast<char*>(&header_)) + sizeof(table_id_));
   _cached_size_ = 0;
 }
 
-GetColumnsRequest::~GetColumnsRequest() {
-  // @@protoc_insertion_point(destructor:mspb.GetColumnsRequest)
+GetColumnByNameRequest::~GetColumnByNameRequest() {
+  // @@protoc_insertion_point(destructor:mspb.GetColumnByNameRequest)
   SharedDtor();
 }
 
-void GetColumnsRequest::SharedDtor() {
+void GetColumnByNameRequest::SharedDtor() {
+  col_name_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   if (this != internal_default_instance()) delete header_;
 }
 
-void GetColumnsRequest::SetCachedSize(int size) const {
+void GetColumnByNameRequest::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* GetColumnsRequest::descriptor() {
+const ::google::protobuf::Descriptor* GetColumnByNameRequest::descriptor() {
   protobuf_mspb_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_mspb_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
 }
 
-const GetColumnsRequest& GetColumnsRequest::default_instance() {
+const GetColumnByNameRequest& GetColumnByNameRequest::default_instance() {
   protobuf_mspb_2eproto::InitDefaults();
   return *internal_default_instance();
 }
 
-GetColumnsRequest* GetColumnsRequest::New(::google::protobuf::Arena* arena) const {
-  GetColumnsRequest* n = new GetColumnsRequest;
+GetColumnByNameRequest* GetColumnByNameRequest::New(::google::protobuf::Arena* arena) const {
+  GetColumnByNameRequest* n = new GetColumnByNameRequest;
   if (arena != NULL) {
     arena->Own(n);
   }
   return n;
 }
 
-void GetColumnsRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:mspb.GetColumnsRequest)
+void GetColumnByNameRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:mspb.GetColumnByNameRequest)
   ::google::protobuf::uint32 cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
+  col_name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   if (GetArenaNoVirtual() == NULL && header_ != NULL) {
     delete header_;
   }
@@ -14006,11 +16963,11 @@ void GetColumnsRequest::Clear() {
   _internal_metadata_.Clear();
 }
 
-bool GetColumnsRequest::MergePartialFromCodedStream(
+bool GetColumnByNameRequest::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:mspb.GetColumnsRequest)
+  // @@protoc_insertion_point(parse_start:mspb.GetColumnByNameRequest)
   for (;;) {
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
     tag = p.first;
@@ -14056,6 +17013,22 @@ bool GetColumnsRequest::MergePartialFromCodedStream(
         break;
       }
 
+      // string col_name = 4;
+      case 4: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(34u /* 34 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_col_name()));
+          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+            this->col_name().data(), static_cast<int>(this->col_name().length()),
+            ::google::protobuf::internal::WireFormatLite::PARSE,
+            "mspb.GetColumnByNameRequest.col_name"));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
       default: {
       handle_unusual:
         if (tag == 0) {
@@ -14068,17 +17041,17 @@ bool GetColumnsRequest::MergePartialFromCodedStream(
     }
   }
 success:
-  // @@protoc_insertion_point(parse_success:mspb.GetColumnsRequest)
+  // @@protoc_insertion_point(parse_success:mspb.GetColumnByNameRequest)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:mspb.GetColumnsRequest)
+  // @@protoc_insertion_point(parse_failure:mspb.GetColumnByNameRequest)
   return false;
 #undef DO_
 }
 
-void GetColumnsRequest::SerializeWithCachedSizes(
+void GetColumnByNameRequest::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:mspb.GetColumnsRequest)
+  // @@protoc_insertion_point(serialize_start:mspb.GetColumnByNameRequest)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
@@ -14098,17 +17071,27 @@ void GetColumnsRequest::SerializeWithCachedSizes(
     ::google::protobuf::internal::WireFormatLite::WriteUInt64(3, this->table_id(), output);
   }
 
+  // string col_name = 4;
+  if (this->col_name().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+      this->col_name().data(), static_cast<int>(this->col_name().length()),
+      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+      "mspb.GetColumnByNameRequest.col_name");
+    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
+      4, this->col_name(), output);
+  }
+
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
     ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
   }
-  // @@protoc_insertion_point(serialize_end:mspb.GetColumnsRequest)
+  // @@protoc_insertion_point(serialize_end:mspb.GetColumnByNameRequest)
 }
 
-::google::protobuf::uint8* GetColumnsRequest::InternalSerializeWithCachedSizesToArray(
+::google::protobuf::uint8* GetColumnByNameRequest::InternalSerializeWithCachedSizesToArray(
     bool deterministic, ::google::protobuf::uint8* target) const {
   (void)deterministic; // Unused
-  // @@protoc_insertion_point(serialize_to_array_start:mspb.GetColumnsRequest)
+  // @@protoc_insertion_point(serialize_to_array_start:mspb.GetColumnByNameRequest)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
@@ -14129,16 +17112,27 @@ void GetColumnsRequest::SerializeWithCachedSizes(
     target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(3, this->table_id(), target);
   }
 
+  // string col_name = 4;
+  if (this->col_name().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+      this->col_name().data(), static_cast<int>(this->col_name().length()),
+      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+      "mspb.GetColumnByNameRequest.col_name");
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        4, this->col_name(), target);
+  }
+
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
     target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:mspb.GetColumnsRequest)
+  // @@protoc_insertion_point(serialize_to_array_end:mspb.GetColumnByNameRequest)
   return target;
 }
 
-size_t GetColumnsRequest::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:mspb.GetColumnsRequest)
+size_t GetColumnByNameRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mspb.GetColumnByNameRequest)
   size_t total_size = 0;
 
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
@@ -14146,6 +17140,13 @@ size_t GetColumnsRequest::ByteSizeLong() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
   }
+  // string col_name = 4;
+  if (this->col_name().size() > 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::StringSize(
+        this->col_name());
+  }
+
   // .mspb.RequestHeader header = 1;
   if (this->has_header()) {
     total_size += 1 +
@@ -14174,28 +17175,32 @@ size_t GetColumnsRequest::ByteSizeLong() const {
   return total_size;
 }
 
-void GetColumnsRequest::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:mspb.GetColumnsRequest)
+void GetColumnByNameRequest::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:mspb.GetColumnByNameRequest)
   GOOGLE_DCHECK_NE(&from, this);
-  const GetColumnsRequest* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const GetColumnsRequest>(
+  const GetColumnByNameRequest* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const GetColumnByNameRequest>(
           &from);
   if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:mspb.GetColumnsRequest)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:mspb.GetColumnByNameRequest)
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:mspb.GetColumnsRequest)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:mspb.GetColumnByNameRequest)
     MergeFrom(*source);
   }
 }
 
-void GetColumnsRequest::MergeFrom(const GetColumnsRequest& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:mspb.GetColumnsRequest)
+void GetColumnByNameRequest::MergeFrom(const GetColumnByNameRequest& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:mspb.GetColumnByNameRequest)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
+  if (from.col_name().size() > 0) {
+
+    col_name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.col_name_);
+  }
   if (from.has_header()) {
     mutable_header()->::mspb::RequestHeader::MergeFrom(from.header());
   }
@@ -14207,30 +17212,31 @@ void GetColumnsRequest::MergeFrom(const GetColumnsRequest& from) {
   }
 }
 
-void GetColumnsRequest::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:mspb.GetColumnsRequest)
+void GetColumnByNameRequest::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:mspb.GetColumnByNameRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void GetColumnsRequest::CopyFrom(const GetColumnsRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:mspb.GetColumnsRequest)
+void GetColumnByNameRequest::CopyFrom(const GetColumnByNameRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mspb.GetColumnByNameRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool GetColumnsRequest::IsInitialized() const {
+bool GetColumnByNameRequest::IsInitialized() const {
   return true;
 }
 
-void GetColumnsRequest::Swap(GetColumnsRequest* other) {
+void GetColumnByNameRequest::Swap(GetColumnByNameRequest* other) {
   if (other == this) return;
   InternalSwap(other);
 }
-void GetColumnsRequest::InternalSwap(GetColumnsRequest* other) {
+void GetColumnByNameRequest::InternalSwap(GetColumnByNameRequest* other) {
   using std::swap;
+  col_name_.Swap(&other->col_name_);
   swap(header_, other->header_);
   swap(db_id_, other->db_id_);
   swap(table_id_, other->table_id_);
@@ -14238,44 +17244,44 @@ void GetColumnsRequest::InternalSwap(GetColumnsRequest* other) {
   swap(_cached_size_, other->_cached_size_);
 }
 
-::google::protobuf::Metadata GetColumnsRequest::GetMetadata() const {
+::google::protobuf::Metadata GetColumnByNameRequest::GetMetadata() const {
   protobuf_mspb_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_mspb_2eproto::file_level_metadata[kIndexInFileMessages];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
-// GetColumnsRequest
+// GetColumnByNameRequest
 
 // .mspb.RequestHeader header = 1;
-bool GetColumnsRequest::has_header() const {
+bool GetColumnByNameRequest::has_header() const {
   return this != internal_default_instance() && header_ != NULL;
 }
-void GetColumnsRequest::clear_header() {
+void GetColumnByNameRequest::clear_header() {
   if (GetArenaNoVirtual() == NULL && header_ != NULL) delete header_;
   header_ = NULL;
 }
-const ::mspb::RequestHeader& GetColumnsRequest::header() const {
+const ::mspb::RequestHeader& GetColumnByNameRequest::header() const {
   const ::mspb::RequestHeader* p = header_;
-  // @@protoc_insertion_point(field_get:mspb.GetColumnsRequest.header)
+  // @@protoc_insertion_point(field_get:mspb.GetColumnByNameRequest.header)
   return p != NULL ? *p : *reinterpret_cast<const ::mspb::RequestHeader*>(
       &::mspb::_RequestHeader_default_instance_);
 }
-::mspb::RequestHeader* GetColumnsRequest::mutable_header() {
+::mspb::RequestHeader* GetColumnByNameRequest::mutable_header() {
   
   if (header_ == NULL) {
     header_ = new ::mspb::RequestHeader;
   }
-  // @@protoc_insertion_point(field_mutable:mspb.GetColumnsRequest.header)
+  // @@protoc_insertion_point(field_mutable:mspb.GetColumnByNameRequest.header)
   return header_;
 }
-::mspb::RequestHeader* GetColumnsRequest::release_header() {
-  // @@protoc_insertion_point(field_release:mspb.GetColumnsRequest.header)
+::mspb::RequestHeader* GetColumnByNameRequest::release_header() {
+  // @@protoc_insertion_point(field_release:mspb.GetColumnByNameRequest.header)
   
   ::mspb::RequestHeader* temp = header_;
   header_ = NULL;
   return temp;
 }
-void GetColumnsRequest::set_allocated_header(::mspb::RequestHeader* header) {
+void GetColumnByNameRequest::set_allocated_header(::mspb::RequestHeader* header) {
   delete header_;
   header_ = header;
   if (header) {
@@ -14283,35 +17289,88 @@ void GetColumnsRequest::set_allocated_header(::mspb::RequestHeader* header) {
   } else {
     
   }
-  // @@protoc_insertion_point(field_set_allocated:mspb.GetColumnsRequest.header)
+  // @@protoc_insertion_point(field_set_allocated:mspb.GetColumnByNameRequest.header)
 }
 
 // uint64 db_id = 2;
-void GetColumnsRequest::clear_db_id() {
+void GetColumnByNameRequest::clear_db_id() {
   db_id_ = GOOGLE_ULONGLONG(0);
 }
-::google::protobuf::uint64 GetColumnsRequest::db_id() const {
-  // @@protoc_insertion_point(field_get:mspb.GetColumnsRequest.db_id)
+::google::protobuf::uint64 GetColumnByNameRequest::db_id() const {
+  // @@protoc_insertion_point(field_get:mspb.GetColumnByNameRequest.db_id)
   return db_id_;
 }
-void GetColumnsRequest::set_db_id(::google::protobuf::uint64 value) {
+void GetColumnByNameRequest::set_db_id(::google::protobuf::uint64 value) {
+  
+  db_id_ = value;
+  // @@protoc_insertion_point(field_set:mspb.GetColumnByNameRequest.db_id)
+}
+
+// uint64 table_id = 3;
+void GetColumnByNameRequest::clear_table_id() {
+  table_id_ = GOOGLE_ULONGLONG(0);
+}
+::google::protobuf::uint64 GetColumnByNameRequest::table_id() const {
+  // @@protoc_insertion_point(field_get:mspb.GetColumnByNameRequest.table_id)
+  return table_id_;
+}
+void GetColumnByNameRequest::set_table_id(::google::protobuf::uint64 value) {
+  
+  table_id_ = value;
+  // @@protoc_insertion_point(field_set:mspb.GetColumnByNameRequest.table_id)
+}
+
+// string col_name = 4;
+void GetColumnByNameRequest::clear_col_name() {
+  col_name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+const ::std::string& GetColumnByNameRequest::col_name() const {
+  // @@protoc_insertion_point(field_get:mspb.GetColumnByNameRequest.col_name)
+  return col_name_.GetNoArena();
+}
+void GetColumnByNameRequest::set_col_name(const ::std::string& value) {
+  
+  col_name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:mspb.GetColumnByNameRequest.col_name)
+}
+#if LANG_CXX11
+void GetColumnByNameRequest::set_col_name(::std::string&& value) {
+  
+  col_name_.SetNoArena(
+    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:mspb.GetColumnByNameRequest.col_name)
+}
+#endif
+void GetColumnByNameRequest::set_col_name(const char* value) {
+  GOOGLE_DCHECK(value != NULL);
   
-  db_id_ = value;
-  // @@protoc_insertion_point(field_set:mspb.GetColumnsRequest.db_id)
+  col_name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:mspb.GetColumnByNameRequest.col_name)
 }
-
-// uint64 table_id = 3;
-void GetColumnsRequest::clear_table_id() {
-  table_id_ = GOOGLE_ULONGLONG(0);
+void GetColumnByNameRequest::set_col_name(const char* value, size_t size) {
+  
+  col_name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:mspb.GetColumnByNameRequest.col_name)
 }
-::google::protobuf::uint64 GetColumnsRequest::table_id() const {
-  // @@protoc_insertion_point(field_get:mspb.GetColumnsRequest.table_id)
-  return table_id_;
+::std::string* GetColumnByNameRequest::mutable_col_name() {
+  
+  // @@protoc_insertion_point(field_mutable:mspb.GetColumnByNameRequest.col_name)
+  return col_name_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-void GetColumnsRequest::set_table_id(::google::protobuf::uint64 value) {
+::std::string* GetColumnByNameRequest::release_col_name() {
+  // @@protoc_insertion_point(field_release:mspb.GetColumnByNameRequest.col_name)
   
-  table_id_ = value;
-  // @@protoc_insertion_point(field_set:mspb.GetColumnsRequest.table_id)
+  return col_name_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+void GetColumnByNameRequest::set_allocated_col_name(::std::string* col_name) {
+  if (col_name != NULL) {
+    
+  } else {
+    
+  }
+  col_name_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), col_name);
+  // @@protoc_insertion_point(field_set_allocated:mspb.GetColumnByNameRequest.col_name)
 }
 
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -14319,22 +17378,21 @@ void GetColumnsRequest::set_table_id(::google::protobuf::uint64 value) {
 // ===================================================================
 
 #if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int GetColumnsResponse::kHeaderFieldNumber;
-const int GetColumnsResponse::kColumnsFieldNumber;
+const int GetColumnByNameResponse::kHeaderFieldNumber;
+const int GetColumnByNameResponse::kColumnFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
-GetColumnsResponse::GetColumnsResponse()
+GetColumnByNameResponse::GetColumnByNameResponse()
   : ::google::protobuf::Message(), _internal_metadata_(NULL) {
   if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
     protobuf_mspb_2eproto::InitDefaults();
   }
   SharedCtor();
-  // @@protoc_insertion_point(constructor:mspb.GetColumnsResponse)
+  // @@protoc_insertion_point(constructor:mspb.GetColumnByNameResponse)
 }
-GetColumnsResponse::GetColumnsResponse(const GetColumnsResponse& from)
+GetColumnByNameResponse::GetColumnByNameResponse(const GetColumnByNameResponse& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
-      columns_(from.columns_),
       _cached_size_(0) {
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   if (from.has_header()) {
@@ -14342,65 +17400,76 @@ GetColumnsResponse::GetColumnsResponse(const GetColumnsResponse& from)
   } else {
     header_ = NULL;
   }
-  // @@protoc_insertion_point(copy_constructor:mspb.GetColumnsResponse)
+  if (from.has_column()) {
+    column_ = new ::metapb::Column(*from.column_);
+  } else {
+    column_ = NULL;
+  }
+  // @@protoc_insertion_point(copy_constructor:mspb.GetColumnByNameResponse)
 }
 
-void GetColumnsResponse::SharedCtor() {
-  header_ = NULL;
+void GetColumnByNameResponse::SharedCtor() {
+  ::memset(&header_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&column_) -
+      reinterpret_cast<char*>(&header_)) + sizeof(column_));
   _cached_size_ = 0;
 }
 
-GetColumnsResponse::~GetColumnsResponse() {
-  // @@protoc_insertion_point(destructor:mspb.GetColumnsResponse)
+GetColumnByNameResponse::~GetColumnByNameResponse() {
+  // @@protoc_insertion_point(destructor:mspb.GetColumnByNameResponse)
   SharedDtor();
 }
 
-void GetColumnsResponse::SharedDtor() {
+void GetColumnByNameResponse::SharedDtor() {
   if (this != internal_default_instance()) delete header_;
+  if (this != internal_default_instance()) delete column_;
 }
 
-void GetColumnsResponse::SetCachedSize(int size) const {
+void GetColumnByNameResponse::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* GetColumnsResponse::descriptor() {
+const ::google::protobuf::Descriptor* GetColumnByNameResponse::descriptor() {
   protobuf_mspb_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_mspb_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
 }
 
-const GetColumnsResponse& GetColumnsResponse::default_instance() {
+const GetColumnByNameResponse& GetColumnByNameResponse::default_instance() {
   protobuf_mspb_2eproto::InitDefaults();
   return *internal_default_instance();
 }
 
-GetColumnsResponse* GetColumnsResponse::New(::google::protobuf::Arena* arena) const {
-  GetColumnsResponse* n = new GetColumnsResponse;
+GetColumnByNameResponse* GetColumnByNameResponse::New(::google::protobuf::Arena* arena) const {
+  GetColumnByNameResponse* n = new GetColumnByNameResponse;
   if (arena != NULL) {
     arena->Own(n);
   }
   return n;
 }
 
-void GetColumnsResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:mspb.GetColumnsResponse)
+void GetColumnByNameResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:mspb.GetColumnByNameResponse)
   ::google::protobuf::uint32 cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  columns_.Clear();
   if (GetArenaNoVirtual() == NULL && header_ != NULL) {
     delete header_;
   }
   header_ = NULL;
+  if (GetArenaNoVirtual() == NULL && column_ != NULL) {
+    delete column_;
+  }
+  column_ = NULL;
   _internal_metadata_.Clear();
 }
 
-bool GetColumnsResponse::MergePartialFromCodedStream(
+bool GetColumnByNameResponse::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:mspb.GetColumnsResponse)
+  // @@protoc_insertion_point(parse_start:mspb.GetColumnByNameResponse)
   for (;;) {
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
     tag = p.first;
@@ -14418,12 +17487,12 @@ bool GetColumnsResponse::MergePartialFromCodedStream(
         break;
       }
 
-      // repeated .metapb.Column columns = 2;
+      // .metapb.Column column = 2;
       case 2: {
         if (static_cast< ::google::protobuf::uint8>(tag) ==
             static_cast< ::google::protobuf::uint8>(18u /* 18 & 0xFF */)) {
           DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-                input, add_columns()));
+               input, mutable_column()));
         } else {
           goto handle_unusual;
         }
@@ -14442,17 +17511,17 @@ bool GetColumnsResponse::MergePartialFromCodedStream(
     }
   }
 success:
-  // @@protoc_insertion_point(parse_success:mspb.GetColumnsResponse)
+  // @@protoc_insertion_point(parse_success:mspb.GetColumnByNameResponse)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:mspb.GetColumnsResponse)
+  // @@protoc_insertion_point(parse_failure:mspb.GetColumnByNameResponse)
   return false;
 #undef DO_
 }
 
-void GetColumnsResponse::SerializeWithCachedSizes(
+void GetColumnByNameResponse::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:mspb.GetColumnsResponse)
+  // @@protoc_insertion_point(serialize_start:mspb.GetColumnByNameResponse)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
@@ -14462,24 +17531,23 @@ void GetColumnsResponse::SerializeWithCachedSizes(
       1, *this->header_, output);
   }
 
-  // repeated .metapb.Column columns = 2;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->columns_size()); i < n; i++) {
+  // .metapb.Column column = 2;
+  if (this->has_column()) {
     ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      2, this->columns(static_cast<int>(i)), output);
+      2, *this->column_, output);
   }
 
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
     ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
   }
-  // @@protoc_insertion_point(serialize_end:mspb.GetColumnsResponse)
+  // @@protoc_insertion_point(serialize_end:mspb.GetColumnByNameResponse)
 }
 
-::google::protobuf::uint8* GetColumnsResponse::InternalSerializeWithCachedSizesToArray(
+::google::protobuf::uint8* GetColumnByNameResponse::InternalSerializeWithCachedSizesToArray(
     bool deterministic, ::google::protobuf::uint8* target) const {
   (void)deterministic; // Unused
-  // @@protoc_insertion_point(serialize_to_array_start:mspb.GetColumnsResponse)
+  // @@protoc_insertion_point(serialize_to_array_start:mspb.GetColumnByNameResponse)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
@@ -14490,24 +17558,23 @@ void GetColumnsResponse::SerializeWithCachedSizes(
         1, *this->header_, deterministic, target);
   }
 
-  // repeated .metapb.Column columns = 2;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->columns_size()); i < n; i++) {
+  // .metapb.Column column = 2;
+  if (this->has_column()) {
     target = ::google::protobuf::internal::WireFormatLite::
       InternalWriteMessageNoVirtualToArray(
-        2, this->columns(static_cast<int>(i)), deterministic, target);
+        2, *this->column_, deterministic, target);
   }
 
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
     target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:mspb.GetColumnsResponse)
+  // @@protoc_insertion_point(serialize_to_array_end:mspb.GetColumnByNameResponse)
   return target;
 }
 
-size_t GetColumnsResponse::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:mspb.GetColumnsResponse)
+size_t GetColumnByNameResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mspb.GetColumnByNameResponse)
   size_t total_size = 0;
 
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
@@ -14515,17 +17582,6 @@ size_t GetColumnsResponse::ByteSizeLong() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
   }
-  // repeated .metapb.Column columns = 2;
-  {
-    unsigned int count = static_cast<unsigned int>(this->columns_size());
-    total_size += 1UL * count;
-    for (unsigned int i = 0; i < count; i++) {
-      total_size +=
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->columns(static_cast<int>(i)));
-    }
-  }
-
   // .mspb.ResponseHeader header = 1;
   if (this->has_header()) {
     total_size += 1 +
@@ -14533,6 +17589,13 @@ size_t GetColumnsResponse::ByteSizeLong() const {
         *this->header_);
   }
 
+  // .metapb.Column column = 2;
+  if (this->has_column()) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+        *this->column_);
+  }
+
   int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = cached_size;
@@ -14540,102 +17603,104 @@ size_t GetColumnsResponse::ByteSizeLong() const {
   return total_size;
 }
 
-void GetColumnsResponse::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:mspb.GetColumnsResponse)
+void GetColumnByNameResponse::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:mspb.GetColumnByNameResponse)
   GOOGLE_DCHECK_NE(&from, this);
-  const GetColumnsResponse* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const GetColumnsResponse>(
+  const GetColumnByNameResponse* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const GetColumnByNameResponse>(
           &from);
   if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:mspb.GetColumnsResponse)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:mspb.GetColumnByNameResponse)
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:mspb.GetColumnsResponse)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:mspb.GetColumnByNameResponse)
     MergeFrom(*source);
   }
 }
 
-void GetColumnsResponse::MergeFrom(const GetColumnsResponse& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:mspb.GetColumnsResponse)
+void GetColumnByNameResponse::MergeFrom(const GetColumnByNameResponse& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:mspb.GetColumnByNameResponse)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  columns_.MergeFrom(from.columns_);
   if (from.has_header()) {
     mutable_header()->::mspb::ResponseHeader::MergeFrom(from.header());
   }
+  if (from.has_column()) {
+    mutable_column()->::metapb::Column::MergeFrom(from.column());
+  }
 }
 
-void GetColumnsResponse::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:mspb.GetColumnsResponse)
+void GetColumnByNameResponse::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:mspb.GetColumnByNameResponse)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void GetColumnsResponse::CopyFrom(const GetColumnsResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:mspb.GetColumnsResponse)
+void GetColumnByNameResponse::CopyFrom(const GetColumnByNameResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mspb.GetColumnByNameResponse)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool GetColumnsResponse::IsInitialized() const {
+bool GetColumnByNameResponse::IsInitialized() const {
   return true;
 }
 
-void GetColumnsResponse::Swap(GetColumnsResponse* other) {
+void GetColumnByNameResponse::Swap(GetColumnByNameResponse* other) {
   if (other == this) return;
   InternalSwap(other);
 }
-void GetColumnsResponse::InternalSwap(GetColumnsResponse* other) {
+void GetColumnByNameResponse::InternalSwap(GetColumnByNameResponse* other) {
   using std::swap;
-  columns_.InternalSwap(&other->columns_);
   swap(header_, other->header_);
+  swap(column_, other->column_);
   _internal_metadata_.Swap(&other->_internal_metadata_);
   swap(_cached_size_, other->_cached_size_);
 }
 
-::google::protobuf::Metadata GetColumnsResponse::GetMetadata() const {
+::google::protobuf::Metadata GetColumnByNameResponse::GetMetadata() const {
   protobuf_mspb_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_mspb_2eproto::file_level_metadata[kIndexInFileMessages];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
-// GetColumnsResponse
+// GetColumnByNameResponse
 
 // .mspb.ResponseHeader header = 1;
-bool GetColumnsResponse::has_header() const {
+bool GetColumnByNameResponse::has_header() const {
   return this != internal_default_instance() && header_ != NULL;
 }
-void GetColumnsResponse::clear_header() {
+void GetColumnByNameResponse::clear_header() {
   if (GetArenaNoVirtual() == NULL && header_ != NULL) delete header_;
   header_ = NULL;
 }
-const ::mspb::ResponseHeader& GetColumnsResponse::header() const {
+const ::mspb::ResponseHeader& GetColumnByNameResponse::header() const {
   const ::mspb::ResponseHeader* p = header_;
-  // @@protoc_insertion_point(field_get:mspb.GetColumnsResponse.header)
+  // @@protoc_insertion_point(field_get:mspb.GetColumnByNameResponse.header)
   return p != NULL ? *p : *reinterpret_cast<const ::mspb::ResponseHeader*>(
       &::mspb::_ResponseHeader_default_instance_);
 }
-::mspb::ResponseHeader* GetColumnsResponse::mutable_header() {
+::mspb::ResponseHeader* GetColumnByNameResponse::mutable_header() {
   
   if (header_ == NULL) {
     header_ = new ::mspb::ResponseHeader;
   }
-  // @@protoc_insertion_point(field_mutable:mspb.GetColumnsResponse.header)
+  // @@protoc_insertion_point(field_mutable:mspb.GetColumnByNameResponse.header)
   return header_;
 }
-::mspb::ResponseHeader* GetColumnsResponse::release_header() {
-  // @@protoc_insertion_point(field_release:mspb.GetColumnsResponse.header)
+::mspb::ResponseHeader* GetColumnByNameResponse::release_header() {
+  // @@protoc_insertion_point(field_release:mspb.GetColumnByNameResponse.header)
   
   ::mspb::ResponseHeader* temp = header_;
   header_ = NULL;
   return temp;
 }
-void GetColumnsResponse::set_allocated_header(::mspb::ResponseHeader* header) {
+void GetColumnByNameResponse::set_allocated_header(::mspb::ResponseHeader* header) {
   delete header_;
   header_ = header;
   if (header) {
@@ -14643,37 +17708,47 @@ void GetColumnsResponse::set_allocated_header(::mspb::ResponseHeader* header) {
   } else {
     
   }
-  // @@protoc_insertion_point(field_set_allocated:mspb.GetColumnsResponse.header)
+  // @@protoc_insertion_point(field_set_allocated:mspb.GetColumnByNameResponse.header)
 }
 
-// repeated .metapb.Column columns = 2;
-int GetColumnsResponse::columns_size() const {
-  return columns_.size();
-}
-void GetColumnsResponse::clear_columns() {
-  columns_.Clear();
+// .metapb.Column column = 2;
+bool GetColumnByNameResponse::has_column() const {
+  return this != internal_default_instance() && column_ != NULL;
 }
-const ::metapb::Column& GetColumnsResponse::columns(int index) const {
-  // @@protoc_insertion_point(field_get:mspb.GetColumnsResponse.columns)
-  return columns_.Get(index);
+void GetColumnByNameResponse::clear_column() {
+  if (GetArenaNoVirtual() == NULL && column_ != NULL) delete column_;
+  column_ = NULL;
 }
-::metapb::Column* GetColumnsResponse::mutable_columns(int index) {
-  // @@protoc_insertion_point(field_mutable:mspb.GetColumnsResponse.columns)
-  return columns_.Mutable(index);
+const ::metapb::Column& GetColumnByNameResponse::column() const {
+  const ::metapb::Column* p = column_;
+  // @@protoc_insertion_point(field_get:mspb.GetColumnByNameResponse.column)
+  return p != NULL ? *p : *reinterpret_cast<const ::metapb::Column*>(
+      &::metapb::_Column_default_instance_);
 }
-::metapb::Column* GetColumnsResponse::add_columns() {
-  // @@protoc_insertion_point(field_add:mspb.GetColumnsResponse.columns)
-  return columns_.Add();
+::metapb::Column* GetColumnByNameResponse::mutable_column() {
+  
+  if (column_ == NULL) {
+    column_ = new ::metapb::Column;
+  }
+  // @@protoc_insertion_point(field_mutable:mspb.GetColumnByNameResponse.column)
+  return column_;
 }
-::google::protobuf::RepeatedPtrField< ::metapb::Column >*
-GetColumnsResponse::mutable_columns() {
-  // @@protoc_insertion_point(field_mutable_list:mspb.GetColumnsResponse.columns)
-  return &columns_;
+::metapb::Column* GetColumnByNameResponse::release_column() {
+  // @@protoc_insertion_point(field_release:mspb.GetColumnByNameResponse.column)
+  
+  ::metapb::Column* temp = column_;
+  column_ = NULL;
+  return temp;
 }
-const ::google::protobuf::RepeatedPtrField< ::metapb::Column >&
-GetColumnsResponse::columns() const {
-  // @@protoc_insertion_point(field_list:mspb.GetColumnsResponse.columns)
-  return columns_;
+void GetColumnByNameResponse::set_allocated_column(::metapb::Column* column) {
+  delete column_;
+  column_ = column;
+  if (column) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_set_allocated:mspb.GetColumnByNameResponse.column)
 }
 
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -14681,103 +17756,96 @@ GetColumnsResponse::columns() const {
 // ===================================================================
 
 #if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int GetColumnByNameRequest::kHeaderFieldNumber;
-const int GetColumnByNameRequest::kDbIdFieldNumber;
-const int GetColumnByNameRequest::kTableIdFieldNumber;
-const int GetColumnByNameRequest::kColNameFieldNumber;
+const int GetColumnByIdRequest::kHeaderFieldNumber;
+const int GetColumnByIdRequest::kDbIdFieldNumber;
+const int GetColumnByIdRequest::kTableIdFieldNumber;
+const int GetColumnByIdRequest::kColIdFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
-GetColumnByNameRequest::GetColumnByNameRequest()
+GetColumnByIdRequest::GetColumnByIdRequest()
   : ::google::protobuf::Message(), _internal_metadata_(NULL) {
   if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
     protobuf_mspb_2eproto::InitDefaults();
   }
   SharedCtor();
-  // @@protoc_insertion_point(constructor:mspb.GetColumnByNameRequest)
+  // @@protoc_insertion_point(constructor:mspb.GetColumnByIdRequest)
 }
-GetColumnByNameRequest::GetColumnByNameRequest(const GetColumnByNameRequest& from)
+GetColumnByIdRequest::GetColumnByIdRequest(const GetColumnByIdRequest& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
       _cached_size_(0) {
   _internal_metadata_.MergeFrom(from._internal_metadata_);
-  col_name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.col_name().size() > 0) {
-    col_name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.col_name_);
-  }
   if (from.has_header()) {
     header_ = new ::mspb::RequestHeader(*from.header_);
   } else {
     header_ = NULL;
   }
   ::memcpy(&db_id_, &from.db_id_,
-    static_cast<size_t>(reinterpret_cast<char*>(&table_id_) -
-    reinterpret_cast<char*>(&db_id_)) + sizeof(table_id_));
-  // @@protoc_insertion_point(copy_constructor:mspb.GetColumnByNameRequest)
+    static_cast<size_t>(reinterpret_cast<char*>(&col_id_) -
+    reinterpret_cast<char*>(&db_id_)) + sizeof(col_id_));
+  // @@protoc_insertion_point(copy_constructor:mspb.GetColumnByIdRequest)
 }
 
-void GetColumnByNameRequest::SharedCtor() {
-  col_name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+void GetColumnByIdRequest::SharedCtor() {
   ::memset(&header_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&table_id_) -
-      reinterpret_cast<char*>(&header_)) + sizeof(table_id_));
+      reinterpret_cast<char*>(&col_id_) -
+      reinterpret_cast<char*>(&header_)) + sizeof(col_id_));
   _cached_size_ = 0;
 }
 
-GetColumnByNameRequest::~GetColumnByNameRequest() {
-  // @@protoc_insertion_point(destructor:mspb.GetColumnByNameRequest)
+GetColumnByIdRequest::~GetColumnByIdRequest() {
+  // @@protoc_insertion_point(destructor:mspb.GetColumnByIdRequest)
   SharedDtor();
 }
 
-void GetColumnByNameRequest::SharedDtor() {
-  col_name_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+void GetColumnByIdRequest::SharedDtor() {
   if (this != internal_default_instance()) delete header_;
 }
 
-void GetColumnByNameRequest::SetCachedSize(int size) const {
+void GetColumnByIdRequest::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* GetColumnByNameRequest::descriptor() {
+const ::google::protobuf::Descriptor* GetColumnByIdRequest::descriptor() {
   protobuf_mspb_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_mspb_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
 }
 
-const GetColumnByNameRequest& GetColumnByNameRequest::default_instance() {
+const GetColumnByIdRequest& GetColumnByIdRequest::default_instance() {
   protobuf_mspb_2eproto::InitDefaults();
   return *internal_default_instance();
 }
 
-GetColumnByNameRequest* GetColumnByNameRequest::New(::google::protobuf::Arena* arena) const {
-  GetColumnByNameRequest* n = new GetColumnByNameRequest;
+GetColumnByIdRequest* GetColumnByIdRequest::New(::google::protobuf::Arena* arena) const {
+  GetColumnByIdRequest* n = new GetColumnByIdRequest;
   if (arena != NULL) {
     arena->Own(n);
   }
   return n;
 }
 
-void GetColumnByNameRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:mspb.GetColumnByNameRequest)
+void GetColumnByIdRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:mspb.GetColumnByIdRequest)
   ::google::protobuf::uint32 cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  col_name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   if (GetArenaNoVirtual() == NULL && header_ != NULL) {
     delete header_;
   }
   header_ = NULL;
   ::memset(&db_id_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&table_id_) -
-      reinterpret_cast<char*>(&db_id_)) + sizeof(table_id_));
+      reinterpret_cast<char*>(&col_id_) -
+      reinterpret_cast<char*>(&db_id_)) + sizeof(col_id_));
   _internal_metadata_.Clear();
 }
 
-bool GetColumnByNameRequest::MergePartialFromCodedStream(
+bool GetColumnByIdRequest::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:mspb.GetColumnByNameRequest)
+  // @@protoc_insertion_point(parse_start:mspb.GetColumnByIdRequest)
   for (;;) {
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
     tag = p.first;
@@ -14823,16 +17891,14 @@ bool GetColumnByNameRequest::MergePartialFromCodedStream(
         break;
       }
 
-      // string col_name = 4;
+      // uint64 col_id = 4;
       case 4: {
         if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(34u /* 34 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_col_name()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->col_name().data(), static_cast<int>(this->col_name().length()),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "mspb.GetColumnByNameRequest.col_name"));
+            static_cast< ::google::protobuf::uint8>(32u /* 32 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &col_id_)));
         } else {
           goto handle_unusual;
         }
@@ -14851,17 +17917,17 @@ bool GetColumnByNameRequest::MergePartialFromCodedStream(
     }
   }
 success:
-  // @@protoc_insertion_point(parse_success:mspb.GetColumnByNameRequest)
+  // @@protoc_insertion_point(parse_success:mspb.GetColumnByIdRequest)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:mspb.GetColumnByNameRequest)
+  // @@protoc_insertion_point(parse_failure:mspb.GetColumnByIdRequest)
   return false;
 #undef DO_
 }
 
-void GetColumnByNameRequest::SerializeWithCachedSizes(
+void GetColumnByIdRequest::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:mspb.GetColumnByNameRequest)
+  // @@protoc_insertion_point(serialize_start:mspb.GetColumnByIdRequest)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
@@ -14881,27 +17947,22 @@ void GetColumnByNameRequest::SerializeWithCachedSizes(
     ::google::protobuf::internal::WireFormatLite::WriteUInt64(3, this->table_id(), output);
   }
 
-  // string col_name = 4;
-  if (this->col_name().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->col_name().data(), static_cast<int>(this->col_name().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "mspb.GetColumnByNameRequest.col_name");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      4, this->col_name(), output);
+  // uint64 col_id = 4;
+  if (this->col_id() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(4, this->col_id(), output);
   }
 
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
     ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
   }
-  // @@protoc_insertion_point(serialize_end:mspb.GetColumnByNameRequest)
+  // @@protoc_insertion_point(serialize_end:mspb.GetColumnByIdRequest)
 }
 
-::google::protobuf::uint8* GetColumnByNameRequest::InternalSerializeWithCachedSizesToArray(
+::google::protobuf::uint8* GetColumnByIdRequest::InternalSerializeWithCachedSizesToArray(
     bool deterministic, ::google::protobuf::uint8* target) const {
   (void)deterministic; // Unused
-  // @@protoc_insertion_point(serialize_to_array_start:mspb.GetColumnByNameRequest)
+  // @@protoc_insertion_point(serialize_to_array_start:mspb.GetColumnByIdRequest)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
@@ -14922,27 +17983,21 @@ void GetColumnByNameRequest::SerializeWithCachedSizes(
     target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(3, this->table_id(), target);
   }
 
-  // string col_name = 4;
-  if (this->col_name().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->col_name().data(), static_cast<int>(this->col_name().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "mspb.GetColumnByNameRequest.col_name");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        4, this->col_name(), target);
+  // uint64 col_id = 4;
+  if (this->col_id() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(4, this->col_id(), target);
   }
 
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
     target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:mspb.GetColumnByNameRequest)
+  // @@protoc_insertion_point(serialize_to_array_end:mspb.GetColumnByIdRequest)
   return target;
 }
 
-size_t GetColumnByNameRequest::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:mspb.GetColumnByNameRequest)
+size_t GetColumnByIdRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mspb.GetColumnByIdRequest)
   size_t total_size = 0;
 
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
@@ -14950,13 +18005,6 @@ size_t GetColumnByNameRequest::ByteSizeLong() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
   }
-  // string col_name = 4;
-  if (this->col_name().size() > 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->col_name());
-  }
-
   // .mspb.RequestHeader header = 1;
   if (this->has_header()) {
     total_size += 1 +
@@ -14978,6 +18026,13 @@ size_t GetColumnByNameRequest::ByteSizeLong() const {
         this->table_id());
   }
 
+  // uint64 col_id = 4;
+  if (this->col_id() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt64Size(
+        this->col_id());
+  }
+
   int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = cached_size;
@@ -14985,32 +18040,28 @@ size_t GetColumnByNameRequest::ByteSizeLong() const {
   return total_size;
 }
 
-void GetColumnByNameRequest::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:mspb.GetColumnByNameRequest)
+void GetColumnByIdRequest::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:mspb.GetColumnByIdRequest)
   GOOGLE_DCHECK_NE(&from, this);
-  const GetColumnByNameRequest* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const GetColumnByNameRequest>(
+  const GetColumnByIdRequest* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const GetColumnByIdRequest>(
           &from);
   if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:mspb.GetColumnByNameRequest)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:mspb.GetColumnByIdRequest)
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:mspb.GetColumnByNameRequest)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:mspb.GetColumnByIdRequest)
     MergeFrom(*source);
   }
 }
 
-void GetColumnByNameRequest::MergeFrom(const GetColumnByNameRequest& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:mspb.GetColumnByNameRequest)
+void GetColumnByIdRequest::MergeFrom(const GetColumnByIdRequest& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:mspb.GetColumnByIdRequest)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.col_name().size() > 0) {
-
-    col_name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.col_name_);
-  }
   if (from.has_header()) {
     mutable_header()->::mspb::RequestHeader::MergeFrom(from.header());
   }
@@ -15020,78 +18071,81 @@ void GetColumnByNameRequest::MergeFrom(const GetColumnByNameRequest& from) {
   if (from.table_id() != 0) {
     set_table_id(from.table_id());
   }
+  if (from.col_id() != 0) {
+    set_col_id(from.col_id());
+  }
 }
 
-void GetColumnByNameRequest::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:mspb.GetColumnByNameRequest)
+void GetColumnByIdRequest::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:mspb.GetColumnByIdRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void GetColumnByNameRequest::CopyFrom(const GetColumnByNameRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:mspb.GetColumnByNameRequest)
+void GetColumnByIdRequest::CopyFrom(const GetColumnByIdRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mspb.GetColumnByIdRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool GetColumnByNameRequest::IsInitialized() const {
+bool GetColumnByIdRequest::IsInitialized() const {
   return true;
 }
 
-void GetColumnByNameRequest::Swap(GetColumnByNameRequest* other) {
+void GetColumnByIdRequest::Swap(GetColumnByIdRequest* other) {
   if (other == this) return;
   InternalSwap(other);
 }
-void GetColumnByNameRequest::InternalSwap(GetColumnByNameRequest* other) {
+void GetColumnByIdRequest::InternalSwap(GetColumnByIdRequest* other) {
   using std::swap;
-  col_name_.Swap(&other->col_name_);
   swap(header_, other->header_);
   swap(db_id_, other->db_id_);
   swap(table_id_, other->table_id_);
+  swap(col_id_, other->col_id_);
   _internal_metadata_.Swap(&other->_internal_metadata_);
   swap(_cached_size_, other->_cached_size_);
 }
 
-::google::protobuf::Metadata GetColumnByNameRequest::GetMetadata() const {
+::google::protobuf::Metadata GetColumnByIdRequest::GetMetadata() const {
   protobuf_mspb_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_mspb_2eproto::file_level_metadata[kIndexInFileMessages];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
-// GetColumnByNameRequest
+// GetColumnByIdRequest
 
 // .mspb.RequestHeader header = 1;
-bool GetColumnByNameRequest::has_header() const {
+bool GetColumnByIdRequest::has_header() const {
   return this != internal_default_instance() && header_ != NULL;
 }
-void GetColumnByNameRequest::clear_header() {
+void GetColumnByIdRequest::clear_header() {
   if (GetArenaNoVirtual() == NULL && header_ != NULL) delete header_;
   header_ = NULL;
 }
-const ::mspb::RequestHeader& GetColumnByNameRequest::header() const {
+const ::mspb::RequestHeader& GetColumnByIdRequest::header() const {
   const ::mspb::RequestHeader* p = header_;
-  // @@protoc_insertion_point(field_get:mspb.GetColumnByNameRequest.header)
+  // @@protoc_insertion_point(field_get:mspb.GetColumnByIdRequest.header)
   return p != NULL ? *p : *reinterpret_cast<const ::mspb::RequestHeader*>(
       &::mspb::_RequestHeader_default_instance_);
 }
-::mspb::RequestHeader* GetColumnByNameRequest::mutable_header() {
+::mspb::RequestHeader* GetColumnByIdRequest::mutable_header() {
   
   if (header_ == NULL) {
     header_ = new ::mspb::RequestHeader;
   }
-  // @@protoc_insertion_point(field_mutable:mspb.GetColumnByNameRequest.header)
+  // @@protoc_insertion_point(field_mutable:mspb.GetColumnByIdRequest.header)
   return header_;
 }
-::mspb::RequestHeader* GetColumnByNameRequest::release_header() {
-  // @@protoc_insertion_point(field_release:mspb.GetColumnByNameRequest.header)
+::mspb::RequestHeader* GetColumnByIdRequest::release_header() {
+  // @@protoc_insertion_point(field_release:mspb.GetColumnByIdRequest.header)
   
   ::mspb::RequestHeader* temp = header_;
   header_ = NULL;
   return temp;
 }
-void GetColumnByNameRequest::set_allocated_header(::mspb::RequestHeader* header) {
+void GetColumnByIdRequest::set_allocated_header(::mspb::RequestHeader* header) {
   delete header_;
   header_ = header;
   if (header) {
@@ -15099,88 +18153,49 @@ void GetColumnByNameRequest::set_allocated_header(::mspb::RequestHeader* header)
   } else {
     
   }
-  // @@protoc_insertion_point(field_set_allocated:mspb.GetColumnByNameRequest.header)
+  // @@protoc_insertion_point(field_set_allocated:mspb.GetColumnByIdRequest.header)
 }
 
 // uint64 db_id = 2;
-void GetColumnByNameRequest::clear_db_id() {
+void GetColumnByIdRequest::clear_db_id() {
   db_id_ = GOOGLE_ULONGLONG(0);
 }
-::google::protobuf::uint64 GetColumnByNameRequest::db_id() const {
-  // @@protoc_insertion_point(field_get:mspb.GetColumnByNameRequest.db_id)
+::google::protobuf::uint64 GetColumnByIdRequest::db_id() const {
+  // @@protoc_insertion_point(field_get:mspb.GetColumnByIdRequest.db_id)
   return db_id_;
 }
-void GetColumnByNameRequest::set_db_id(::google::protobuf::uint64 value) {
+void GetColumnByIdRequest::set_db_id(::google::protobuf::uint64 value) {
   
   db_id_ = value;
-  // @@protoc_insertion_point(field_set:mspb.GetColumnByNameRequest.db_id)
+  // @@protoc_insertion_point(field_set:mspb.GetColumnByIdRequest.db_id)
 }
 
 // uint64 table_id = 3;
-void GetColumnByNameRequest::clear_table_id() {
+void GetColumnByIdRequest::clear_table_id() {
   table_id_ = GOOGLE_ULONGLONG(0);
 }
-::google::protobuf::uint64 GetColumnByNameRequest::table_id() const {
-  // @@protoc_insertion_point(field_get:mspb.GetColumnByNameRequest.table_id)
-  return table_id_;
-}
-void GetColumnByNameRequest::set_table_id(::google::protobuf::uint64 value) {
-  
-  table_id_ = value;
-  // @@protoc_insertion_point(field_set:mspb.GetColumnByNameRequest.table_id)
-}
-
-// string col_name = 4;
-void GetColumnByNameRequest::clear_col_name() {
-  col_name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-const ::std::string& GetColumnByNameRequest::col_name() const {
-  // @@protoc_insertion_point(field_get:mspb.GetColumnByNameRequest.col_name)
-  return col_name_.GetNoArena();
-}
-void GetColumnByNameRequest::set_col_name(const ::std::string& value) {
-  
-  col_name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:mspb.GetColumnByNameRequest.col_name)
-}
-#if LANG_CXX11
-void GetColumnByNameRequest::set_col_name(::std::string&& value) {
-  
-  col_name_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:mspb.GetColumnByNameRequest.col_name)
-}
-#endif
-void GetColumnByNameRequest::set_col_name(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  col_name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:mspb.GetColumnByNameRequest.col_name)
-}
-void GetColumnByNameRequest::set_col_name(const char* value, size_t size) {
-  
-  col_name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:mspb.GetColumnByNameRequest.col_name)
+::google::protobuf::uint64 GetColumnByIdRequest::table_id() const {
+  // @@protoc_insertion_point(field_get:mspb.GetColumnByIdRequest.table_id)
+  return table_id_;
 }
-::std::string* GetColumnByNameRequest::mutable_col_name() {
+void GetColumnByIdRequest::set_table_id(::google::protobuf::uint64 value) {
   
-  // @@protoc_insertion_point(field_mutable:mspb.GetColumnByNameRequest.col_name)
-  return col_name_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  table_id_ = value;
+  // @@protoc_insertion_point(field_set:mspb.GetColumnByIdRequest.table_id)
 }
-::std::string* GetColumnByNameRequest::release_col_name() {
-  // @@protoc_insertion_point(field_release:mspb.GetColumnByNameRequest.col_name)
-  
-  return col_name_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+
+// uint64 col_id = 4;
+void GetColumnByIdRequest::clear_col_id() {
+  col_id_ = GOOGLE_ULONGLONG(0);
 }
-void GetColumnByNameRequest::set_allocated_col_name(::std::string* col_name) {
-  if (col_name != NULL) {
-    
-  } else {
-    
-  }
-  col_name_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), col_name);
-  // @@protoc_insertion_point(field_set_allocated:mspb.GetColumnByNameRequest.col_name)
+::google::protobuf::uint64 GetColumnByIdRequest::col_id() const {
+  // @@protoc_insertion_point(field_get:mspb.GetColumnByIdRequest.col_id)
+  return col_id_;
+}
+void GetColumnByIdRequest::set_col_id(::google::protobuf::uint64 value) {
+  
+  col_id_ = value;
+  // @@protoc_insertion_point(field_set:mspb.GetColumnByIdRequest.col_id)
 }
 
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -15188,19 +18203,19 @@ void GetColumnByNameRequest::set_allocated_col_name(::std::string* col_name) {
 // ===================================================================
 
 #if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int GetColumnByNameResponse::kHeaderFieldNumber;
-const int GetColumnByNameResponse::kColumnFieldNumber;
+const int GetColumnByIdResponse::kHeaderFieldNumber;
+const int GetColumnByIdResponse::kColumnFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
-GetColumnByNameResponse::GetColumnByNameResponse()
+GetColumnByIdResponse::GetColumnByIdResponse()
   : ::google::protobuf::Message(), _internal_metadata_(NULL) {
   if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
     protobuf_mspb_2eproto::InitDefaults();
   }
   SharedCtor();
-  // @@protoc_insertion_point(constructor:mspb.GetColumnByNameResponse)
+  // @@protoc_insertion_point(constructor:mspb.GetColumnByIdResponse)
 }
-GetColumnByNameResponse::GetColumnByNameResponse(const GetColumnByNameResponse& from)
+GetColumnByIdResponse::GetColumnByIdResponse(const GetColumnByIdResponse& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
       _cached_size_(0) {
@@ -15215,51 +18230,51 @@ GetColumnByNameResponse::GetColumnByNameResponse(const GetColumnByNameResponse&
   } else {
     column_ = NULL;
   }
-  // @@protoc_insertion_point(copy_constructor:mspb.GetColumnByNameResponse)
+  // @@protoc_insertion_point(copy_constructor:mspb.GetColumnByIdResponse)
 }
 
-void GetColumnByNameResponse::SharedCtor() {
+void GetColumnByIdResponse::SharedCtor() {
   ::memset(&header_, 0, static_cast<size_t>(
       reinterpret_cast<char*>(&column_) -
       reinterpret_cast<char*>(&header_)) + sizeof(column_));
   _cached_size_ = 0;
 }
 
-GetColumnByNameResponse::~GetColumnByNameResponse() {
-  // @@protoc_insertion_point(destructor:mspb.GetColumnByNameResponse)
+GetColumnByIdResponse::~GetColumnByIdResponse() {
+  // @@protoc_insertion_point(destructor:mspb.GetColumnByIdResponse)
   SharedDtor();
 }
 
-void GetColumnByNameResponse::SharedDtor() {
+void GetColumnByIdResponse::SharedDtor() {
   if (this != internal_default_instance()) delete header_;
   if (this != internal_default_instance()) delete column_;
 }
 
-void GetColumnByNameResponse::SetCachedSize(int size) const {
+void GetColumnByIdResponse::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* GetColumnByNameResponse::descriptor() {
+const ::google::protobuf::Descriptor* GetColumnByIdResponse::descriptor() {
   protobuf_mspb_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_mspb_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
 }
 
-const GetColumnByNameResponse& GetColumnByNameResponse::default_instance() {
+const GetColumnByIdResponse& GetColumnByIdResponse::default_instance() {
   protobuf_mspb_2eproto::InitDefaults();
   return *internal_default_instance();
 }
 
-GetColumnByNameResponse* GetColumnByNameResponse::New(::google::protobuf::Arena* arena) const {
-  GetColumnByNameResponse* n = new GetColumnByNameResponse;
+GetColumnByIdResponse* GetColumnByIdResponse::New(::google::protobuf::Arena* arena) const {
+  GetColumnByIdResponse* n = new GetColumnByIdResponse;
   if (arena != NULL) {
     arena->Own(n);
   }
   return n;
 }
 
-void GetColumnByNameResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:mspb.GetColumnByNameResponse)
+void GetColumnByIdResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:mspb.GetColumnByIdResponse)
   ::google::protobuf::uint32 cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
@@ -15275,11 +18290,11 @@ void GetColumnByNameResponse::Clear() {
   _internal_metadata_.Clear();
 }
 
-bool GetColumnByNameResponse::MergePartialFromCodedStream(
+bool GetColumnByIdResponse::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:mspb.GetColumnByNameResponse)
+  // @@protoc_insertion_point(parse_start:mspb.GetColumnByIdResponse)
   for (;;) {
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
     tag = p.first;
@@ -15321,17 +18336,17 @@ bool GetColumnByNameResponse::MergePartialFromCodedStream(
     }
   }
 success:
-  // @@protoc_insertion_point(parse_success:mspb.GetColumnByNameResponse)
+  // @@protoc_insertion_point(parse_success:mspb.GetColumnByIdResponse)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:mspb.GetColumnByNameResponse)
+  // @@protoc_insertion_point(parse_failure:mspb.GetColumnByIdResponse)
   return false;
 #undef DO_
 }
 
-void GetColumnByNameResponse::SerializeWithCachedSizes(
+void GetColumnByIdResponse::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:mspb.GetColumnByNameResponse)
+  // @@protoc_insertion_point(serialize_start:mspb.GetColumnByIdResponse)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
@@ -15351,13 +18366,13 @@ void GetColumnByNameResponse::SerializeWithCachedSizes(
     ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
   }
-  // @@protoc_insertion_point(serialize_end:mspb.GetColumnByNameResponse)
+  // @@protoc_insertion_point(serialize_end:mspb.GetColumnByIdResponse)
 }
 
-::google::protobuf::uint8* GetColumnByNameResponse::InternalSerializeWithCachedSizesToArray(
+::google::protobuf::uint8* GetColumnByIdResponse::InternalSerializeWithCachedSizesToArray(
     bool deterministic, ::google::protobuf::uint8* target) const {
   (void)deterministic; // Unused
-  // @@protoc_insertion_point(serialize_to_array_start:mspb.GetColumnByNameResponse)
+  // @@protoc_insertion_point(serialize_to_array_start:mspb.GetColumnByIdResponse)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
@@ -15379,12 +18394,12 @@ void GetColumnByNameResponse::SerializeWithCachedSizes(
     target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:mspb.GetColumnByNameResponse)
+  // @@protoc_insertion_point(serialize_to_array_end:mspb.GetColumnByIdResponse)
   return target;
 }
 
-size_t GetColumnByNameResponse::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:mspb.GetColumnByNameResponse)
+size_t GetColumnByIdResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mspb.GetColumnByIdResponse)
   size_t total_size = 0;
 
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
@@ -15413,23 +18428,23 @@ size_t GetColumnByNameResponse::ByteSizeLong() const {
   return total_size;
 }
 
-void GetColumnByNameResponse::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:mspb.GetColumnByNameResponse)
+void GetColumnByIdResponse::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:mspb.GetColumnByIdResponse)
   GOOGLE_DCHECK_NE(&from, this);
-  const GetColumnByNameResponse* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const GetColumnByNameResponse>(
+  const GetColumnByIdResponse* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const GetColumnByIdResponse>(
           &from);
   if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:mspb.GetColumnByNameResponse)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:mspb.GetColumnByIdResponse)
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:mspb.GetColumnByNameResponse)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:mspb.GetColumnByIdResponse)
     MergeFrom(*source);
   }
 }
 
-void GetColumnByNameResponse::MergeFrom(const GetColumnByNameResponse& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:mspb.GetColumnByNameResponse)
+void GetColumnByIdResponse::MergeFrom(const GetColumnByIdResponse& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:mspb.GetColumnByIdResponse)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   ::google::protobuf::uint32 cached_has_bits = 0;
@@ -15443,29 +18458,29 @@ void GetColumnByNameResponse::MergeFrom(const GetColumnByNameResponse& from) {
   }
 }
 
-void GetColumnByNameResponse::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:mspb.GetColumnByNameResponse)
+void GetColumnByIdResponse::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:mspb.GetColumnByIdResponse)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void GetColumnByNameResponse::CopyFrom(const GetColumnByNameResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:mspb.GetColumnByNameResponse)
+void GetColumnByIdResponse::CopyFrom(const GetColumnByIdResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mspb.GetColumnByIdResponse)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool GetColumnByNameResponse::IsInitialized() const {
+bool GetColumnByIdResponse::IsInitialized() const {
   return true;
 }
 
-void GetColumnByNameResponse::Swap(GetColumnByNameResponse* other) {
+void GetColumnByIdResponse::Swap(GetColumnByIdResponse* other) {
   if (other == this) return;
   InternalSwap(other);
 }
-void GetColumnByNameResponse::InternalSwap(GetColumnByNameResponse* other) {
+void GetColumnByIdResponse::InternalSwap(GetColumnByIdResponse* other) {
   using std::swap;
   swap(header_, other->header_);
   swap(column_, other->column_);
@@ -15473,44 +18488,44 @@ void GetColumnByNameResponse::InternalSwap(GetColumnByNameResponse* other) {
   swap(_cached_size_, other->_cached_size_);
 }
 
-::google::protobuf::Metadata GetColumnByNameResponse::GetMetadata() const {
+::google::protobuf::Metadata GetColumnByIdResponse::GetMetadata() const {
   protobuf_mspb_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_mspb_2eproto::file_level_metadata[kIndexInFileMessages];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
-// GetColumnByNameResponse
+// GetColumnByIdResponse
 
 // .mspb.ResponseHeader header = 1;
-bool GetColumnByNameResponse::has_header() const {
+bool GetColumnByIdResponse::has_header() const {
   return this != internal_default_instance() && header_ != NULL;
 }
-void GetColumnByNameResponse::clear_header() {
+void GetColumnByIdResponse::clear_header() {
   if (GetArenaNoVirtual() == NULL && header_ != NULL) delete header_;
   header_ = NULL;
 }
-const ::mspb::ResponseHeader& GetColumnByNameResponse::header() const {
+const ::mspb::ResponseHeader& GetColumnByIdResponse::header() const {
   const ::mspb::ResponseHeader* p = header_;
-  // @@protoc_insertion_point(field_get:mspb.GetColumnByNameResponse.header)
+  // @@protoc_insertion_point(field_get:mspb.GetColumnByIdResponse.header)
   return p != NULL ? *p : *reinterpret_cast<const ::mspb::ResponseHeader*>(
       &::mspb::_ResponseHeader_default_instance_);
 }
-::mspb::ResponseHeader* GetColumnByNameResponse::mutable_header() {
+::mspb::ResponseHeader* GetColumnByIdResponse::mutable_header() {
   
   if (header_ == NULL) {
     header_ = new ::mspb::ResponseHeader;
   }
-  // @@protoc_insertion_point(field_mutable:mspb.GetColumnByNameResponse.header)
+  // @@protoc_insertion_point(field_mutable:mspb.GetColumnByIdResponse.header)
   return header_;
 }
-::mspb::ResponseHeader* GetColumnByNameResponse::release_header() {
-  // @@protoc_insertion_point(field_release:mspb.GetColumnByNameResponse.header)
+::mspb::ResponseHeader* GetColumnByIdResponse::release_header() {
+  // @@protoc_insertion_point(field_release:mspb.GetColumnByIdResponse.header)
   
   ::mspb::ResponseHeader* temp = header_;
   header_ = NULL;
   return temp;
 }
-void GetColumnByNameResponse::set_allocated_header(::mspb::ResponseHeader* header) {
+void GetColumnByIdResponse::set_allocated_header(::mspb::ResponseHeader* header) {
   delete header_;
   header_ = header;
   if (header) {
@@ -15518,39 +18533,39 @@ void GetColumnByNameResponse::set_allocated_header(::mspb::ResponseHeader* heade
   } else {
     
   }
-  // @@protoc_insertion_point(field_set_allocated:mspb.GetColumnByNameResponse.header)
+  // @@protoc_insertion_point(field_set_allocated:mspb.GetColumnByIdResponse.header)
 }
 
 // .metapb.Column column = 2;
-bool GetColumnByNameResponse::has_column() const {
+bool GetColumnByIdResponse::has_column() const {
   return this != internal_default_instance() && column_ != NULL;
 }
-void GetColumnByNameResponse::clear_column() {
+void GetColumnByIdResponse::clear_column() {
   if (GetArenaNoVirtual() == NULL && column_ != NULL) delete column_;
   column_ = NULL;
 }
-const ::metapb::Column& GetColumnByNameResponse::column() const {
+const ::metapb::Column& GetColumnByIdResponse::column() const {
   const ::metapb::Column* p = column_;
-  // @@protoc_insertion_point(field_get:mspb.GetColumnByNameResponse.column)
+  // @@protoc_insertion_point(field_get:mspb.GetColumnByIdResponse.column)
   return p != NULL ? *p : *reinterpret_cast<const ::metapb::Column*>(
       &::metapb::_Column_default_instance_);
 }
-::metapb::Column* GetColumnByNameResponse::mutable_column() {
+::metapb::Column* GetColumnByIdResponse::mutable_column() {
   
   if (column_ == NULL) {
     column_ = new ::metapb::Column;
   }
-  // @@protoc_insertion_point(field_mutable:mspb.GetColumnByNameResponse.column)
+  // @@protoc_insertion_point(field_mutable:mspb.GetColumnByIdResponse.column)
   return column_;
 }
-::metapb::Column* GetColumnByNameResponse::release_column() {
-  // @@protoc_insertion_point(field_release:mspb.GetColumnByNameResponse.column)
+::metapb::Column* GetColumnByIdResponse::release_column() {
+  // @@protoc_insertion_point(field_release:mspb.GetColumnByIdResponse.column)
   
   ::metapb::Column* temp = column_;
   column_ = NULL;
   return temp;
 }
-void GetColumnByNameResponse::set_allocated_column(::metapb::Column* column) {
+void GetColumnByIdResponse::set_allocated_column(::metapb::Column* column) {
   delete column_;
   column_ = column;
   if (column) {
@@ -15558,7 +18573,7 @@ void GetColumnByNameResponse::set_allocated_column(::metapb::Column* column) {
   } else {
     
   }
-  // @@protoc_insertion_point(field_set_allocated:mspb.GetColumnByNameResponse.column)
+  // @@protoc_insertion_point(field_set_allocated:mspb.GetColumnByIdResponse.column)
 }
 
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -15566,23 +18581,24 @@ void GetColumnByNameResponse::set_allocated_column(::metapb::Column* column) {
 // ===================================================================
 
 #if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int GetColumnByIdRequest::kHeaderFieldNumber;
-const int GetColumnByIdRequest::kDbIdFieldNumber;
-const int GetColumnByIdRequest::kTableIdFieldNumber;
-const int GetColumnByIdRequest::kColIdFieldNumber;
+const int AddColumnRequest::kHeaderFieldNumber;
+const int AddColumnRequest::kDbIdFieldNumber;
+const int AddColumnRequest::kTableIdFieldNumber;
+const int AddColumnRequest::kColumnsFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
-GetColumnByIdRequest::GetColumnByIdRequest()
+AddColumnRequest::AddColumnRequest()
   : ::google::protobuf::Message(), _internal_metadata_(NULL) {
   if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
     protobuf_mspb_2eproto::InitDefaults();
   }
   SharedCtor();
-  // @@protoc_insertion_point(constructor:mspb.GetColumnByIdRequest)
+  // @@protoc_insertion_point(constructor:mspb.AddColumnRequest)
 }
-GetColumnByIdRequest::GetColumnByIdRequest(const GetColumnByIdRequest& from)
+AddColumnRequest::AddColumnRequest(const AddColumnRequest& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
+      columns_(from.columns_),
       _cached_size_(0) {
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   if (from.has_header()) {
@@ -15591,71 +18607,72 @@ GetColumnByIdRequest::GetColumnByIdRequest(const GetColumnByIdRequest& from)
     header_ = NULL;
   }
   ::memcpy(&db_id_, &from.db_id_,
-    static_cast<size_t>(reinterpret_cast<char*>(&col_id_) -
-    reinterpret_cast<char*>(&db_id_)) + sizeof(col_id_));
-  // @@protoc_insertion_point(copy_constructor:mspb.GetColumnByIdRequest)
+    static_cast<size_t>(reinterpret_cast<char*>(&table_id_) -
+    reinterpret_cast<char*>(&db_id_)) + sizeof(table_id_));
+  // @@protoc_insertion_point(copy_constructor:mspb.AddColumnRequest)
 }
 
-void GetColumnByIdRequest::SharedCtor() {
+void AddColumnRequest::SharedCtor() {
   ::memset(&header_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&col_id_) -
-      reinterpret_cast<char*>(&header_)) + sizeof(col_id_));
+      reinterpret_cast<char*>(&table_id_) -
+      reinterpret_cast<char*>(&header_)) + sizeof(table_id_));
   _cached_size_ = 0;
 }
 
-GetColumnByIdRequest::~GetColumnByIdRequest() {
-  // @@protoc_insertion_point(destructor:mspb.GetColumnByIdRequest)
+AddColumnRequest::~AddColumnRequest() {
+  // @@protoc_insertion_point(destructor:mspb.AddColumnRequest)
   SharedDtor();
 }
 
-void GetColumnByIdRequest::SharedDtor() {
+void AddColumnRequest::SharedDtor() {
   if (this != internal_default_instance()) delete header_;
 }
 
-void GetColumnByIdRequest::SetCachedSize(int size) const {
+void AddColumnRequest::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* GetColumnByIdRequest::descriptor() {
+const ::google::protobuf::Descriptor* AddColumnRequest::descriptor() {
   protobuf_mspb_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_mspb_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
 }
 
-const GetColumnByIdRequest& GetColumnByIdRequest::default_instance() {
+const AddColumnRequest& AddColumnRequest::default_instance() {
   protobuf_mspb_2eproto::InitDefaults();
   return *internal_default_instance();
 }
 
-GetColumnByIdRequest* GetColumnByIdRequest::New(::google::protobuf::Arena* arena) const {
-  GetColumnByIdRequest* n = new GetColumnByIdRequest;
+AddColumnRequest* AddColumnRequest::New(::google::protobuf::Arena* arena) const {
+  AddColumnRequest* n = new AddColumnRequest;
   if (arena != NULL) {
     arena->Own(n);
   }
   return n;
 }
 
-void GetColumnByIdRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:mspb.GetColumnByIdRequest)
+void AddColumnRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:mspb.AddColumnRequest)
   ::google::protobuf::uint32 cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
+  columns_.Clear();
   if (GetArenaNoVirtual() == NULL && header_ != NULL) {
     delete header_;
   }
   header_ = NULL;
   ::memset(&db_id_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&col_id_) -
-      reinterpret_cast<char*>(&db_id_)) + sizeof(col_id_));
+      reinterpret_cast<char*>(&table_id_) -
+      reinterpret_cast<char*>(&db_id_)) + sizeof(table_id_));
   _internal_metadata_.Clear();
 }
 
-bool GetColumnByIdRequest::MergePartialFromCodedStream(
+bool AddColumnRequest::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:mspb.GetColumnByIdRequest)
+  // @@protoc_insertion_point(parse_start:mspb.AddColumnRequest)
   for (;;) {
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
     tag = p.first;
@@ -15701,14 +18718,12 @@ bool GetColumnByIdRequest::MergePartialFromCodedStream(
         break;
       }
 
-      // uint64 col_id = 4;
+      // repeated .metapb.Column columns = 4;
       case 4: {
         if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(32u /* 32 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
-                 input, &col_id_)));
+            static_cast< ::google::protobuf::uint8>(34u /* 34 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+                input, add_columns()));
         } else {
           goto handle_unusual;
         }
@@ -15727,17 +18742,17 @@ bool GetColumnByIdRequest::MergePartialFromCodedStream(
     }
   }
 success:
-  // @@protoc_insertion_point(parse_success:mspb.GetColumnByIdRequest)
+  // @@protoc_insertion_point(parse_success:mspb.AddColumnRequest)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:mspb.GetColumnByIdRequest)
+  // @@protoc_insertion_point(parse_failure:mspb.AddColumnRequest)
   return false;
 #undef DO_
 }
 
-void GetColumnByIdRequest::SerializeWithCachedSizes(
+void AddColumnRequest::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:mspb.GetColumnByIdRequest)
+  // @@protoc_insertion_point(serialize_start:mspb.AddColumnRequest)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
@@ -15757,22 +18772,24 @@ void GetColumnByIdRequest::SerializeWithCachedSizes(
     ::google::protobuf::internal::WireFormatLite::WriteUInt64(3, this->table_id(), output);
   }
 
-  // uint64 col_id = 4;
-  if (this->col_id() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt64(4, this->col_id(), output);
+  // repeated .metapb.Column columns = 4;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->columns_size()); i < n; i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      4, this->columns(static_cast<int>(i)), output);
   }
 
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
     ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
   }
-  // @@protoc_insertion_point(serialize_end:mspb.GetColumnByIdRequest)
+  // @@protoc_insertion_point(serialize_end:mspb.AddColumnRequest)
 }
 
-::google::protobuf::uint8* GetColumnByIdRequest::InternalSerializeWithCachedSizesToArray(
+::google::protobuf::uint8* AddColumnRequest::InternalSerializeWithCachedSizesToArray(
     bool deterministic, ::google::protobuf::uint8* target) const {
   (void)deterministic; // Unused
-  // @@protoc_insertion_point(serialize_to_array_start:mspb.GetColumnByIdRequest)
+  // @@protoc_insertion_point(serialize_to_array_start:mspb.AddColumnRequest)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
@@ -15793,21 +18810,24 @@ void GetColumnByIdRequest::SerializeWithCachedSizes(
     target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(3, this->table_id(), target);
   }
 
-  // uint64 col_id = 4;
-  if (this->col_id() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(4, this->col_id(), target);
+  // repeated .metapb.Column columns = 4;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->columns_size()); i < n; i++) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      InternalWriteMessageNoVirtualToArray(
+        4, this->columns(static_cast<int>(i)), deterministic, target);
   }
 
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
     target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:mspb.GetColumnByIdRequest)
+  // @@protoc_insertion_point(serialize_to_array_end:mspb.AddColumnRequest)
   return target;
 }
 
-size_t GetColumnByIdRequest::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:mspb.GetColumnByIdRequest)
+size_t AddColumnRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mspb.AddColumnRequest)
   size_t total_size = 0;
 
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
@@ -15815,6 +18835,17 @@ size_t GetColumnByIdRequest::ByteSizeLong() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
   }
+  // repeated .metapb.Column columns = 4;
+  {
+    unsigned int count = static_cast<unsigned int>(this->columns_size());
+    total_size += 1UL * count;
+    for (unsigned int i = 0; i < count; i++) {
+      total_size +=
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->columns(static_cast<int>(i)));
+    }
+  }
+
   // .mspb.RequestHeader header = 1;
   if (this->has_header()) {
     total_size += 1 +
@@ -15836,13 +18867,6 @@ size_t GetColumnByIdRequest::ByteSizeLong() const {
         this->table_id());
   }
 
-  // uint64 col_id = 4;
-  if (this->col_id() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt64Size(
-        this->col_id());
-  }
-
   int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = cached_size;
@@ -15850,28 +18874,29 @@ size_t GetColumnByIdRequest::ByteSizeLong() const {
   return total_size;
 }
 
-void GetColumnByIdRequest::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:mspb.GetColumnByIdRequest)
+void AddColumnRequest::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:mspb.AddColumnRequest)
   GOOGLE_DCHECK_NE(&from, this);
-  const GetColumnByIdRequest* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const GetColumnByIdRequest>(
+  const AddColumnRequest* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const AddColumnRequest>(
           &from);
   if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:mspb.GetColumnByIdRequest)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:mspb.AddColumnRequest)
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:mspb.GetColumnByIdRequest)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:mspb.AddColumnRequest)
     MergeFrom(*source);
   }
 }
 
-void GetColumnByIdRequest::MergeFrom(const GetColumnByIdRequest& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:mspb.GetColumnByIdRequest)
+void AddColumnRequest::MergeFrom(const AddColumnRequest& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:mspb.AddColumnRequest)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
+  columns_.MergeFrom(from.columns_);
   if (from.has_header()) {
     mutable_header()->::mspb::RequestHeader::MergeFrom(from.header());
   }
@@ -15881,81 +18906,78 @@ void GetColumnByIdRequest::MergeFrom(const GetColumnByIdRequest& from) {
   if (from.table_id() != 0) {
     set_table_id(from.table_id());
   }
-  if (from.col_id() != 0) {
-    set_col_id(from.col_id());
-  }
 }
 
-void GetColumnByIdRequest::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:mspb.GetColumnByIdRequest)
+void AddColumnRequest::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:mspb.AddColumnRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void GetColumnByIdRequest::CopyFrom(const GetColumnByIdRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:mspb.GetColumnByIdRequest)
+void AddColumnRequest::CopyFrom(const AddColumnRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mspb.AddColumnRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool GetColumnByIdRequest::IsInitialized() const {
+bool AddColumnRequest::IsInitialized() const {
   return true;
 }
 
-void GetColumnByIdRequest::Swap(GetColumnByIdRequest* other) {
+void AddColumnRequest::Swap(AddColumnRequest* other) {
   if (other == this) return;
   InternalSwap(other);
 }
-void GetColumnByIdRequest::InternalSwap(GetColumnByIdRequest* other) {
+void AddColumnRequest::InternalSwap(AddColumnRequest* other) {
   using std::swap;
+  columns_.InternalSwap(&other->columns_);
   swap(header_, other->header_);
   swap(db_id_, other->db_id_);
   swap(table_id_, other->table_id_);
-  swap(col_id_, other->col_id_);
   _internal_metadata_.Swap(&other->_internal_metadata_);
   swap(_cached_size_, other->_cached_size_);
 }
 
-::google::protobuf::Metadata GetColumnByIdRequest::GetMetadata() const {
+::google::protobuf::Metadata AddColumnRequest::GetMetadata() const {
   protobuf_mspb_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_mspb_2eproto::file_level_metadata[kIndexInFileMessages];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
-// GetColumnByIdRequest
+// AddColumnRequest
 
 // .mspb.RequestHeader header = 1;
-bool GetColumnByIdRequest::has_header() const {
+bool AddColumnRequest::has_header() const {
   return this != internal_default_instance() && header_ != NULL;
 }
-void GetColumnByIdRequest::clear_header() {
+void AddColumnRequest::clear_header() {
   if (GetArenaNoVirtual() == NULL && header_ != NULL) delete header_;
   header_ = NULL;
 }
-const ::mspb::RequestHeader& GetColumnByIdRequest::header() const {
+const ::mspb::RequestHeader& AddColumnRequest::header() const {
   const ::mspb::RequestHeader* p = header_;
-  // @@protoc_insertion_point(field_get:mspb.GetColumnByIdRequest.header)
+  // @@protoc_insertion_point(field_get:mspb.AddColumnRequest.header)
   return p != NULL ? *p : *reinterpret_cast<const ::mspb::RequestHeader*>(
       &::mspb::_RequestHeader_default_instance_);
 }
-::mspb::RequestHeader* GetColumnByIdRequest::mutable_header() {
+::mspb::RequestHeader* AddColumnRequest::mutable_header() {
   
   if (header_ == NULL) {
     header_ = new ::mspb::RequestHeader;
   }
-  // @@protoc_insertion_point(field_mutable:mspb.GetColumnByIdRequest.header)
+  // @@protoc_insertion_point(field_mutable:mspb.AddColumnRequest.header)
   return header_;
 }
-::mspb::RequestHeader* GetColumnByIdRequest::release_header() {
-  // @@protoc_insertion_point(field_release:mspb.GetColumnByIdRequest.header)
+::mspb::RequestHeader* AddColumnRequest::release_header() {
+  // @@protoc_insertion_point(field_release:mspb.AddColumnRequest.header)
   
   ::mspb::RequestHeader* temp = header_;
   header_ = NULL;
   return temp;
 }
-void GetColumnByIdRequest::set_allocated_header(::mspb::RequestHeader* header) {
+void AddColumnRequest::set_allocated_header(::mspb::RequestHeader* header) {
   delete header_;
   header_ = header;
   if (header) {
@@ -15963,49 +18985,65 @@ void GetColumnByIdRequest::set_allocated_header(::mspb::RequestHeader* header) {
   } else {
     
   }
-  // @@protoc_insertion_point(field_set_allocated:mspb.GetColumnByIdRequest.header)
+  // @@protoc_insertion_point(field_set_allocated:mspb.AddColumnRequest.header)
 }
 
 // uint64 db_id = 2;
-void GetColumnByIdRequest::clear_db_id() {
+void AddColumnRequest::clear_db_id() {
   db_id_ = GOOGLE_ULONGLONG(0);
 }
-::google::protobuf::uint64 GetColumnByIdRequest::db_id() const {
-  // @@protoc_insertion_point(field_get:mspb.GetColumnByIdRequest.db_id)
+::google::protobuf::uint64 AddColumnRequest::db_id() const {
+  // @@protoc_insertion_point(field_get:mspb.AddColumnRequest.db_id)
   return db_id_;
 }
-void GetColumnByIdRequest::set_db_id(::google::protobuf::uint64 value) {
+void AddColumnRequest::set_db_id(::google::protobuf::uint64 value) {
   
   db_id_ = value;
-  // @@protoc_insertion_point(field_set:mspb.GetColumnByIdRequest.db_id)
+  // @@protoc_insertion_point(field_set:mspb.AddColumnRequest.db_id)
 }
 
 // uint64 table_id = 3;
-void GetColumnByIdRequest::clear_table_id() {
+void AddColumnRequest::clear_table_id() {
   table_id_ = GOOGLE_ULONGLONG(0);
 }
-::google::protobuf::uint64 GetColumnByIdRequest::table_id() const {
-  // @@protoc_insertion_point(field_get:mspb.GetColumnByIdRequest.table_id)
+::google::protobuf::uint64 AddColumnRequest::table_id() const {
+  // @@protoc_insertion_point(field_get:mspb.AddColumnRequest.table_id)
   return table_id_;
 }
-void GetColumnByIdRequest::set_table_id(::google::protobuf::uint64 value) {
+void AddColumnRequest::set_table_id(::google::protobuf::uint64 value) {
   
   table_id_ = value;
-  // @@protoc_insertion_point(field_set:mspb.GetColumnByIdRequest.table_id)
+  // @@protoc_insertion_point(field_set:mspb.AddColumnRequest.table_id)
 }
 
-// uint64 col_id = 4;
-void GetColumnByIdRequest::clear_col_id() {
-  col_id_ = GOOGLE_ULONGLONG(0);
+// repeated .metapb.Column columns = 4;
+int AddColumnRequest::columns_size() const {
+  return columns_.size();
 }
-::google::protobuf::uint64 GetColumnByIdRequest::col_id() const {
-  // @@protoc_insertion_point(field_get:mspb.GetColumnByIdRequest.col_id)
-  return col_id_;
+void AddColumnRequest::clear_columns() {
+  columns_.Clear();
 }
-void GetColumnByIdRequest::set_col_id(::google::protobuf::uint64 value) {
-  
-  col_id_ = value;
-  // @@protoc_insertion_point(field_set:mspb.GetColumnByIdRequest.col_id)
+const ::metapb::Column& AddColumnRequest::columns(int index) const {
+  // @@protoc_insertion_point(field_get:mspb.AddColumnRequest.columns)
+  return columns_.Get(index);
+}
+::metapb::Column* AddColumnRequest::mutable_columns(int index) {
+  // @@protoc_insertion_point(field_mutable:mspb.AddColumnRequest.columns)
+  return columns_.Mutable(index);
+}
+::metapb::Column* AddColumnRequest::add_columns() {
+  // @@protoc_insertion_point(field_add:mspb.AddColumnRequest.columns)
+  return columns_.Add();
+}
+::google::protobuf::RepeatedPtrField< ::metapb::Column >*
+AddColumnRequest::mutable_columns() {
+  // @@protoc_insertion_point(field_mutable_list:mspb.AddColumnRequest.columns)
+  return &columns_;
+}
+const ::google::protobuf::RepeatedPtrField< ::metapb::Column >&
+AddColumnRequest::columns() const {
+  // @@protoc_insertion_point(field_list:mspb.AddColumnRequest.columns)
+  return columns_;
 }
 
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -16013,21 +19051,22 @@ void GetColumnByIdRequest::set_col_id(::google::protobuf::uint64 value) {
 // ===================================================================
 
 #if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int GetColumnByIdResponse::kHeaderFieldNumber;
-const int GetColumnByIdResponse::kColumnFieldNumber;
+const int AddColumnResponse::kHeaderFieldNumber;
+const int AddColumnResponse::kColumnsFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
-GetColumnByIdResponse::GetColumnByIdResponse()
+AddColumnResponse::AddColumnResponse()
   : ::google::protobuf::Message(), _internal_metadata_(NULL) {
   if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
     protobuf_mspb_2eproto::InitDefaults();
   }
   SharedCtor();
-  // @@protoc_insertion_point(constructor:mspb.GetColumnByIdResponse)
+  // @@protoc_insertion_point(constructor:mspb.AddColumnResponse)
 }
-GetColumnByIdResponse::GetColumnByIdResponse(const GetColumnByIdResponse& from)
+AddColumnResponse::AddColumnResponse(const AddColumnResponse& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
+      columns_(from.columns_),
       _cached_size_(0) {
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   if (from.has_header()) {
@@ -16035,76 +19074,65 @@ GetColumnByIdResponse::GetColumnByIdResponse(const GetColumnByIdResponse& from)
   } else {
     header_ = NULL;
   }
-  if (from.has_column()) {
-    column_ = new ::metapb::Column(*from.column_);
-  } else {
-    column_ = NULL;
-  }
-  // @@protoc_insertion_point(copy_constructor:mspb.GetColumnByIdResponse)
+  // @@protoc_insertion_point(copy_constructor:mspb.AddColumnResponse)
 }
 
-void GetColumnByIdResponse::SharedCtor() {
-  ::memset(&header_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&column_) -
-      reinterpret_cast<char*>(&header_)) + sizeof(column_));
+void AddColumnResponse::SharedCtor() {
+  header_ = NULL;
   _cached_size_ = 0;
 }
 
-GetColumnByIdResponse::~GetColumnByIdResponse() {
-  // @@protoc_insertion_point(destructor:mspb.GetColumnByIdResponse)
+AddColumnResponse::~AddColumnResponse() {
+  // @@protoc_insertion_point(destructor:mspb.AddColumnResponse)
   SharedDtor();
 }
 
-void GetColumnByIdResponse::SharedDtor() {
+void AddColumnResponse::SharedDtor() {
   if (this != internal_default_instance()) delete header_;
-  if (this != internal_default_instance()) delete column_;
 }
 
-void GetColumnByIdResponse::SetCachedSize(int size) const {
+void AddColumnResponse::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* GetColumnByIdResponse::descriptor() {
+const ::google::protobuf::Descriptor* AddColumnResponse::descriptor() {
   protobuf_mspb_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_mspb_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
 }
 
-const GetColumnByIdResponse& GetColumnByIdResponse::default_instance() {
+const AddColumnResponse& AddColumnResponse::default_instance() {
   protobuf_mspb_2eproto::InitDefaults();
   return *internal_default_instance();
 }
 
-GetColumnByIdResponse* GetColumnByIdResponse::New(::google::protobuf::Arena* arena) const {
-  GetColumnByIdResponse* n = new GetColumnByIdResponse;
+AddColumnResponse* AddColumnResponse::New(::google::protobuf::Arena* arena) const {
+  AddColumnResponse* n = new AddColumnResponse;
   if (arena != NULL) {
     arena->Own(n);
   }
   return n;
 }
 
-void GetColumnByIdResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:mspb.GetColumnByIdResponse)
+void AddColumnResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:mspb.AddColumnResponse)
   ::google::protobuf::uint32 cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
+  columns_.Clear();
   if (GetArenaNoVirtual() == NULL && header_ != NULL) {
     delete header_;
   }
   header_ = NULL;
-  if (GetArenaNoVirtual() == NULL && column_ != NULL) {
-    delete column_;
-  }
-  column_ = NULL;
   _internal_metadata_.Clear();
 }
 
-bool GetColumnByIdResponse::MergePartialFromCodedStream(
+bool AddColumnResponse::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:mspb.GetColumnByIdResponse)
+  // @@protoc_insertion_point(parse_start:mspb.AddColumnResponse)
   for (;;) {
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
     tag = p.first;
@@ -16122,12 +19150,12 @@ bool GetColumnByIdResponse::MergePartialFromCodedStream(
         break;
       }
 
-      // .metapb.Column column = 2;
+      // repeated .metapb.Column columns = 2;
       case 2: {
         if (static_cast< ::google::protobuf::uint8>(tag) ==
             static_cast< ::google::protobuf::uint8>(18u /* 18 & 0xFF */)) {
           DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_column()));
+                input, add_columns()));
         } else {
           goto handle_unusual;
         }
@@ -16146,17 +19174,17 @@ bool GetColumnByIdResponse::MergePartialFromCodedStream(
     }
   }
 success:
-  // @@protoc_insertion_point(parse_success:mspb.GetColumnByIdResponse)
+  // @@protoc_insertion_point(parse_success:mspb.AddColumnResponse)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:mspb.GetColumnByIdResponse)
+  // @@protoc_insertion_point(parse_failure:mspb.AddColumnResponse)
   return false;
 #undef DO_
 }
 
-void GetColumnByIdResponse::SerializeWithCachedSizes(
+void AddColumnResponse::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:mspb.GetColumnByIdResponse)
+  // @@protoc_insertion_point(serialize_start:mspb.AddColumnResponse)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
@@ -16166,23 +19194,24 @@ void GetColumnByIdResponse::SerializeWithCachedSizes(
       1, *this->header_, output);
   }
 
-  // .metapb.Column column = 2;
-  if (this->has_column()) {
+  // repeated .metapb.Column columns = 2;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->columns_size()); i < n; i++) {
     ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      2, *this->column_, output);
+      2, this->columns(static_cast<int>(i)), output);
   }
 
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
     ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
   }
-  // @@protoc_insertion_point(serialize_end:mspb.GetColumnByIdResponse)
+  // @@protoc_insertion_point(serialize_end:mspb.AddColumnResponse)
 }
 
-::google::protobuf::uint8* GetColumnByIdResponse::InternalSerializeWithCachedSizesToArray(
+::google::protobuf::uint8* AddColumnResponse::InternalSerializeWithCachedSizesToArray(
     bool deterministic, ::google::protobuf::uint8* target) const {
   (void)deterministic; // Unused
-  // @@protoc_insertion_point(serialize_to_array_start:mspb.GetColumnByIdResponse)
+  // @@protoc_insertion_point(serialize_to_array_start:mspb.AddColumnResponse)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
@@ -16193,23 +19222,24 @@ void GetColumnByIdResponse::SerializeWithCachedSizes(
         1, *this->header_, deterministic, target);
   }
 
-  // .metapb.Column column = 2;
-  if (this->has_column()) {
+  // repeated .metapb.Column columns = 2;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->columns_size()); i < n; i++) {
     target = ::google::protobuf::internal::WireFormatLite::
       InternalWriteMessageNoVirtualToArray(
-        2, *this->column_, deterministic, target);
+        2, this->columns(static_cast<int>(i)), deterministic, target);
   }
 
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
     target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:mspb.GetColumnByIdResponse)
+  // @@protoc_insertion_point(serialize_to_array_end:mspb.AddColumnResponse)
   return target;
 }
 
-size_t GetColumnByIdResponse::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:mspb.GetColumnByIdResponse)
+size_t AddColumnResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mspb.AddColumnResponse)
   size_t total_size = 0;
 
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
@@ -16217,6 +19247,17 @@ size_t GetColumnByIdResponse::ByteSizeLong() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
   }
+  // repeated .metapb.Column columns = 2;
+  {
+    unsigned int count = static_cast<unsigned int>(this->columns_size());
+    total_size += 1UL * count;
+    for (unsigned int i = 0; i < count; i++) {
+      total_size +=
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->columns(static_cast<int>(i)));
+    }
+  }
+
   // .mspb.ResponseHeader header = 1;
   if (this->has_header()) {
     total_size += 1 +
@@ -16224,13 +19265,6 @@ size_t GetColumnByIdResponse::ByteSizeLong() const {
         *this->header_);
   }
 
-  // .metapb.Column column = 2;
-  if (this->has_column()) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-        *this->column_);
-  }
-
   int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = cached_size;
@@ -16238,104 +19272,102 @@ size_t GetColumnByIdResponse::ByteSizeLong() const {
   return total_size;
 }
 
-void GetColumnByIdResponse::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:mspb.GetColumnByIdResponse)
+void AddColumnResponse::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:mspb.AddColumnResponse)
   GOOGLE_DCHECK_NE(&from, this);
-  const GetColumnByIdResponse* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const GetColumnByIdResponse>(
+  const AddColumnResponse* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const AddColumnResponse>(
           &from);
   if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:mspb.GetColumnByIdResponse)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:mspb.AddColumnResponse)
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:mspb.GetColumnByIdResponse)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:mspb.AddColumnResponse)
     MergeFrom(*source);
   }
 }
 
-void GetColumnByIdResponse::MergeFrom(const GetColumnByIdResponse& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:mspb.GetColumnByIdResponse)
+void AddColumnResponse::MergeFrom(const AddColumnResponse& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:mspb.AddColumnResponse)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
+  columns_.MergeFrom(from.columns_);
   if (from.has_header()) {
     mutable_header()->::mspb::ResponseHeader::MergeFrom(from.header());
   }
-  if (from.has_column()) {
-    mutable_column()->::metapb::Column::MergeFrom(from.column());
-  }
 }
 
-void GetColumnByIdResponse::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:mspb.GetColumnByIdResponse)
+void AddColumnResponse::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:mspb.AddColumnResponse)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void GetColumnByIdResponse::CopyFrom(const GetColumnByIdResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:mspb.GetColumnByIdResponse)
+void AddColumnResponse::CopyFrom(const AddColumnResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mspb.AddColumnResponse)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool GetColumnByIdResponse::IsInitialized() const {
+bool AddColumnResponse::IsInitialized() const {
   return true;
 }
 
-void GetColumnByIdResponse::Swap(GetColumnByIdResponse* other) {
+void AddColumnResponse::Swap(AddColumnResponse* other) {
   if (other == this) return;
   InternalSwap(other);
 }
-void GetColumnByIdResponse::InternalSwap(GetColumnByIdResponse* other) {
+void AddColumnResponse::InternalSwap(AddColumnResponse* other) {
   using std::swap;
+  columns_.InternalSwap(&other->columns_);
   swap(header_, other->header_);
-  swap(column_, other->column_);
   _internal_metadata_.Swap(&other->_internal_metadata_);
   swap(_cached_size_, other->_cached_size_);
 }
 
-::google::protobuf::Metadata GetColumnByIdResponse::GetMetadata() const {
+::google::protobuf::Metadata AddColumnResponse::GetMetadata() const {
   protobuf_mspb_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_mspb_2eproto::file_level_metadata[kIndexInFileMessages];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
-// GetColumnByIdResponse
+// AddColumnResponse
 
 // .mspb.ResponseHeader header = 1;
-bool GetColumnByIdResponse::has_header() const {
+bool AddColumnResponse::has_header() const {
   return this != internal_default_instance() && header_ != NULL;
 }
-void GetColumnByIdResponse::clear_header() {
+void AddColumnResponse::clear_header() {
   if (GetArenaNoVirtual() == NULL && header_ != NULL) delete header_;
   header_ = NULL;
 }
-const ::mspb::ResponseHeader& GetColumnByIdResponse::header() const {
+const ::mspb::ResponseHeader& AddColumnResponse::header() const {
   const ::mspb::ResponseHeader* p = header_;
-  // @@protoc_insertion_point(field_get:mspb.GetColumnByIdResponse.header)
+  // @@protoc_insertion_point(field_get:mspb.AddColumnResponse.header)
   return p != NULL ? *p : *reinterpret_cast<const ::mspb::ResponseHeader*>(
       &::mspb::_ResponseHeader_default_instance_);
 }
-::mspb::ResponseHeader* GetColumnByIdResponse::mutable_header() {
+::mspb::ResponseHeader* AddColumnResponse::mutable_header() {
   
   if (header_ == NULL) {
     header_ = new ::mspb::ResponseHeader;
   }
-  // @@protoc_insertion_point(field_mutable:mspb.GetColumnByIdResponse.header)
+  // @@protoc_insertion_point(field_mutable:mspb.AddColumnResponse.header)
   return header_;
 }
-::mspb::ResponseHeader* GetColumnByIdResponse::release_header() {
-  // @@protoc_insertion_point(field_release:mspb.GetColumnByIdResponse.header)
+::mspb::ResponseHeader* AddColumnResponse::release_header() {
+  // @@protoc_insertion_point(field_release:mspb.AddColumnResponse.header)
   
   ::mspb::ResponseHeader* temp = header_;
   header_ = NULL;
   return temp;
 }
-void GetColumnByIdResponse::set_allocated_header(::mspb::ResponseHeader* header) {
+void AddColumnResponse::set_allocated_header(::mspb::ResponseHeader* header) {
   delete header_;
   header_ = header;
   if (header) {
@@ -16343,47 +19375,37 @@ void GetColumnByIdResponse::set_allocated_header(::mspb::ResponseHeader* header)
   } else {
     
   }
-  // @@protoc_insertion_point(field_set_allocated:mspb.GetColumnByIdResponse.header)
+  // @@protoc_insertion_point(field_set_allocated:mspb.AddColumnResponse.header)
 }
 
-// .metapb.Column column = 2;
-bool GetColumnByIdResponse::has_column() const {
-  return this != internal_default_instance() && column_ != NULL;
+// repeated .metapb.Column columns = 2;
+int AddColumnResponse::columns_size() const {
+  return columns_.size();
 }
-void GetColumnByIdResponse::clear_column() {
-  if (GetArenaNoVirtual() == NULL && column_ != NULL) delete column_;
-  column_ = NULL;
+void AddColumnResponse::clear_columns() {
+  columns_.Clear();
 }
-const ::metapb::Column& GetColumnByIdResponse::column() const {
-  const ::metapb::Column* p = column_;
-  // @@protoc_insertion_point(field_get:mspb.GetColumnByIdResponse.column)
-  return p != NULL ? *p : *reinterpret_cast<const ::metapb::Column*>(
-      &::metapb::_Column_default_instance_);
+const ::metapb::Column& AddColumnResponse::columns(int index) const {
+  // @@protoc_insertion_point(field_get:mspb.AddColumnResponse.columns)
+  return columns_.Get(index);
 }
-::metapb::Column* GetColumnByIdResponse::mutable_column() {
-  
-  if (column_ == NULL) {
-    column_ = new ::metapb::Column;
-  }
-  // @@protoc_insertion_point(field_mutable:mspb.GetColumnByIdResponse.column)
-  return column_;
+::metapb::Column* AddColumnResponse::mutable_columns(int index) {
+  // @@protoc_insertion_point(field_mutable:mspb.AddColumnResponse.columns)
+  return columns_.Mutable(index);
 }
-::metapb::Column* GetColumnByIdResponse::release_column() {
-  // @@protoc_insertion_point(field_release:mspb.GetColumnByIdResponse.column)
-  
-  ::metapb::Column* temp = column_;
-  column_ = NULL;
-  return temp;
+::metapb::Column* AddColumnResponse::add_columns() {
+  // @@protoc_insertion_point(field_add:mspb.AddColumnResponse.columns)
+  return columns_.Add();
 }
-void GetColumnByIdResponse::set_allocated_column(::metapb::Column* column) {
-  delete column_;
-  column_ = column;
-  if (column) {
-    
-  } else {
-    
-  }
-  // @@protoc_insertion_point(field_set_allocated:mspb.GetColumnByIdResponse.column)
+::google::protobuf::RepeatedPtrField< ::metapb::Column >*
+AddColumnResponse::mutable_columns() {
+  // @@protoc_insertion_point(field_mutable_list:mspb.AddColumnResponse.columns)
+  return &columns_;
+}
+const ::google::protobuf::RepeatedPtrField< ::metapb::Column >&
+AddColumnResponse::columns() const {
+  // @@protoc_insertion_point(field_list:mspb.AddColumnResponse.columns)
+  return columns_;
 }
 
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -16391,24 +19413,22 @@ void GetColumnByIdResponse::set_allocated_column(::metapb::Column* column) {
 // ===================================================================
 
 #if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int AddColumnRequest::kHeaderFieldNumber;
-const int AddColumnRequest::kDbIdFieldNumber;
-const int AddColumnRequest::kTableIdFieldNumber;
-const int AddColumnRequest::kColumnsFieldNumber;
+const int TruncateTableRequest::kHeaderFieldNumber;
+const int TruncateTableRequest::kDbIdFieldNumber;
+const int TruncateTableRequest::kTableIdFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
-AddColumnRequest::AddColumnRequest()
+TruncateTableRequest::TruncateTableRequest()
   : ::google::protobuf::Message(), _internal_metadata_(NULL) {
   if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
     protobuf_mspb_2eproto::InitDefaults();
   }
   SharedCtor();
-  // @@protoc_insertion_point(constructor:mspb.AddColumnRequest)
+  // @@protoc_insertion_point(constructor:mspb.TruncateTableRequest)
 }
-AddColumnRequest::AddColumnRequest(const AddColumnRequest& from)
+TruncateTableRequest::TruncateTableRequest(const TruncateTableRequest& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
-      columns_(from.columns_),
       _cached_size_(0) {
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   if (from.has_header()) {
@@ -16419,55 +19439,54 @@ AddColumnRequest::AddColumnRequest(const AddColumnRequest& from)
   ::memcpy(&db_id_, &from.db_id_,
     static_cast<size_t>(reinterpret_cast<char*>(&table_id_) -
     reinterpret_cast<char*>(&db_id_)) + sizeof(table_id_));
-  // @@protoc_insertion_point(copy_constructor:mspb.AddColumnRequest)
+  // @@protoc_insertion_point(copy_constructor:mspb.TruncateTableRequest)
 }
 
-void AddColumnRequest::SharedCtor() {
+void TruncateTableRequest::SharedCtor() {
   ::memset(&header_, 0, static_cast<size_t>(
       reinterpret_cast<char*>(&table_id_) -
       reinterpret_cast<char*>(&header_)) + sizeof(table_id_));
   _cached_size_ = 0;
 }
 
-AddColumnRequest::~AddColumnRequest() {
-  // @@protoc_insertion_point(destructor:mspb.AddColumnRequest)
+TruncateTableRequest::~TruncateTableRequest() {
+  // @@protoc_insertion_point(destructor:mspb.TruncateTableRequest)
   SharedDtor();
 }
 
-void AddColumnRequest::SharedDtor() {
+void TruncateTableRequest::SharedDtor() {
   if (this != internal_default_instance()) delete header_;
 }
 
-void AddColumnRequest::SetCachedSize(int size) const {
+void TruncateTableRequest::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* AddColumnRequest::descriptor() {
+const ::google::protobuf::Descriptor* TruncateTableRequest::descriptor() {
   protobuf_mspb_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_mspb_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
 }
 
-const AddColumnRequest& AddColumnRequest::default_instance() {
+const TruncateTableRequest& TruncateTableRequest::default_instance() {
   protobuf_mspb_2eproto::InitDefaults();
   return *internal_default_instance();
 }
 
-AddColumnRequest* AddColumnRequest::New(::google::protobuf::Arena* arena) const {
-  AddColumnRequest* n = new AddColumnRequest;
+TruncateTableRequest* TruncateTableRequest::New(::google::protobuf::Arena* arena) const {
+  TruncateTableRequest* n = new TruncateTableRequest;
   if (arena != NULL) {
     arena->Own(n);
   }
   return n;
 }
 
-void AddColumnRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:mspb.AddColumnRequest)
+void TruncateTableRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:mspb.TruncateTableRequest)
   ::google::protobuf::uint32 cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  columns_.Clear();
   if (GetArenaNoVirtual() == NULL && header_ != NULL) {
     delete header_;
   }
@@ -16478,11 +19497,11 @@ void AddColumnRequest::Clear() {
   _internal_metadata_.Clear();
 }
 
-bool AddColumnRequest::MergePartialFromCodedStream(
+bool TruncateTableRequest::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:mspb.AddColumnRequest)
+  // @@protoc_insertion_point(parse_start:mspb.TruncateTableRequest)
   for (;;) {
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
     tag = p.first;
@@ -16528,18 +19547,6 @@ bool AddColumnRequest::MergePartialFromCodedStream(
         break;
       }
 
-      // repeated .metapb.Column columns = 4;
-      case 4: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(34u /* 34 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-                input, add_columns()));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
       default: {
       handle_unusual:
         if (tag == 0) {
@@ -16552,17 +19559,17 @@ bool AddColumnRequest::MergePartialFromCodedStream(
     }
   }
 success:
-  // @@protoc_insertion_point(parse_success:mspb.AddColumnRequest)
+  // @@protoc_insertion_point(parse_success:mspb.TruncateTableRequest)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:mspb.AddColumnRequest)
+  // @@protoc_insertion_point(parse_failure:mspb.TruncateTableRequest)
   return false;
 #undef DO_
 }
 
-void AddColumnRequest::SerializeWithCachedSizes(
+void TruncateTableRequest::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:mspb.AddColumnRequest)
+  // @@protoc_insertion_point(serialize_start:mspb.TruncateTableRequest)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
@@ -16582,24 +19589,17 @@ void AddColumnRequest::SerializeWithCachedSizes(
     ::google::protobuf::internal::WireFormatLite::WriteUInt64(3, this->table_id(), output);
   }
 
-  // repeated .metapb.Column columns = 4;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->columns_size()); i < n; i++) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      4, this->columns(static_cast<int>(i)), output);
-  }
-
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
     ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
   }
-  // @@protoc_insertion_point(serialize_end:mspb.AddColumnRequest)
+  // @@protoc_insertion_point(serialize_end:mspb.TruncateTableRequest)
 }
 
-::google::protobuf::uint8* AddColumnRequest::InternalSerializeWithCachedSizesToArray(
+::google::protobuf::uint8* TruncateTableRequest::InternalSerializeWithCachedSizesToArray(
     bool deterministic, ::google::protobuf::uint8* target) const {
   (void)deterministic; // Unused
-  // @@protoc_insertion_point(serialize_to_array_start:mspb.AddColumnRequest)
+  // @@protoc_insertion_point(serialize_to_array_start:mspb.TruncateTableRequest)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
@@ -16620,24 +19620,16 @@ void AddColumnRequest::SerializeWithCachedSizes(
     target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(3, this->table_id(), target);
   }
 
-  // repeated .metapb.Column columns = 4;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->columns_size()); i < n; i++) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageNoVirtualToArray(
-        4, this->columns(static_cast<int>(i)), deterministic, target);
-  }
-
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
     target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:mspb.AddColumnRequest)
+  // @@protoc_insertion_point(serialize_to_array_end:mspb.TruncateTableRequest)
   return target;
 }
 
-size_t AddColumnRequest::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:mspb.AddColumnRequest)
+size_t TruncateTableRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mspb.TruncateTableRequest)
   size_t total_size = 0;
 
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
@@ -16645,17 +19637,6 @@ size_t AddColumnRequest::ByteSizeLong() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
   }
-  // repeated .metapb.Column columns = 4;
-  {
-    unsigned int count = static_cast<unsigned int>(this->columns_size());
-    total_size += 1UL * count;
-    for (unsigned int i = 0; i < count; i++) {
-      total_size +=
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->columns(static_cast<int>(i)));
-    }
-  }
-
   // .mspb.RequestHeader header = 1;
   if (this->has_header()) {
     total_size += 1 +
@@ -16684,29 +19665,28 @@ size_t AddColumnRequest::ByteSizeLong() const {
   return total_size;
 }
 
-void AddColumnRequest::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:mspb.AddColumnRequest)
+void TruncateTableRequest::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:mspb.TruncateTableRequest)
   GOOGLE_DCHECK_NE(&from, this);
-  const AddColumnRequest* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const AddColumnRequest>(
+  const TruncateTableRequest* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const TruncateTableRequest>(
           &from);
   if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:mspb.AddColumnRequest)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:mspb.TruncateTableRequest)
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:mspb.AddColumnRequest)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:mspb.TruncateTableRequest)
     MergeFrom(*source);
   }
 }
 
-void AddColumnRequest::MergeFrom(const AddColumnRequest& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:mspb.AddColumnRequest)
+void TruncateTableRequest::MergeFrom(const TruncateTableRequest& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:mspb.TruncateTableRequest)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  columns_.MergeFrom(from.columns_);
   if (from.has_header()) {
     mutable_header()->::mspb::RequestHeader::MergeFrom(from.header());
   }
@@ -16718,31 +19698,30 @@ void AddColumnRequest::MergeFrom(const AddColumnRequest& from) {
   }
 }
 
-void AddColumnRequest::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:mspb.AddColumnRequest)
+void TruncateTableRequest::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:mspb.TruncateTableRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void AddColumnRequest::CopyFrom(const AddColumnRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:mspb.AddColumnRequest)
+void TruncateTableRequest::CopyFrom(const TruncateTableRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mspb.TruncateTableRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool AddColumnRequest::IsInitialized() const {
+bool TruncateTableRequest::IsInitialized() const {
   return true;
 }
 
-void AddColumnRequest::Swap(AddColumnRequest* other) {
+void TruncateTableRequest::Swap(TruncateTableRequest* other) {
   if (other == this) return;
   InternalSwap(other);
 }
-void AddColumnRequest::InternalSwap(AddColumnRequest* other) {
+void TruncateTableRequest::InternalSwap(TruncateTableRequest* other) {
   using std::swap;
-  columns_.InternalSwap(&other->columns_);
   swap(header_, other->header_);
   swap(db_id_, other->db_id_);
   swap(table_id_, other->table_id_);
@@ -16750,44 +19729,44 @@ void AddColumnRequest::InternalSwap(AddColumnRequest* other) {
   swap(_cached_size_, other->_cached_size_);
 }
 
-::google::protobuf::Metadata AddColumnRequest::GetMetadata() const {
+::google::protobuf::Metadata TruncateTableRequest::GetMetadata() const {
   protobuf_mspb_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_mspb_2eproto::file_level_metadata[kIndexInFileMessages];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
-// AddColumnRequest
+// TruncateTableRequest
 
 // .mspb.RequestHeader header = 1;
-bool AddColumnRequest::has_header() const {
+bool TruncateTableRequest::has_header() const {
   return this != internal_default_instance() && header_ != NULL;
 }
-void AddColumnRequest::clear_header() {
+void TruncateTableRequest::clear_header() {
   if (GetArenaNoVirtual() == NULL && header_ != NULL) delete header_;
   header_ = NULL;
 }
-const ::mspb::RequestHeader& AddColumnRequest::header() const {
+const ::mspb::RequestHeader& TruncateTableRequest::header() const {
   const ::mspb::RequestHeader* p = header_;
-  // @@protoc_insertion_point(field_get:mspb.AddColumnRequest.header)
+  // @@protoc_insertion_point(field_get:mspb.TruncateTableRequest.header)
   return p != NULL ? *p : *reinterpret_cast<const ::mspb::RequestHeader*>(
       &::mspb::_RequestHeader_default_instance_);
 }
-::mspb::RequestHeader* AddColumnRequest::mutable_header() {
+::mspb::RequestHeader* TruncateTableRequest::mutable_header() {
   
   if (header_ == NULL) {
     header_ = new ::mspb::RequestHeader;
   }
-  // @@protoc_insertion_point(field_mutable:mspb.AddColumnRequest.header)
+  // @@protoc_insertion_point(field_mutable:mspb.TruncateTableRequest.header)
   return header_;
 }
-::mspb::RequestHeader* AddColumnRequest::release_header() {
-  // @@protoc_insertion_point(field_release:mspb.AddColumnRequest.header)
+::mspb::RequestHeader* TruncateTableRequest::release_header() {
+  // @@protoc_insertion_point(field_release:mspb.TruncateTableRequest.header)
   
   ::mspb::RequestHeader* temp = header_;
   header_ = NULL;
   return temp;
 }
-void AddColumnRequest::set_allocated_header(::mspb::RequestHeader* header) {
+void TruncateTableRequest::set_allocated_header(::mspb::RequestHeader* header) {
   delete header_;
   header_ = header;
   if (header) {
@@ -16795,65 +19774,35 @@ void AddColumnRequest::set_allocated_header(::mspb::RequestHeader* header) {
   } else {
     
   }
-  // @@protoc_insertion_point(field_set_allocated:mspb.AddColumnRequest.header)
+  // @@protoc_insertion_point(field_set_allocated:mspb.TruncateTableRequest.header)
 }
 
 // uint64 db_id = 2;
-void AddColumnRequest::clear_db_id() {
+void TruncateTableRequest::clear_db_id() {
   db_id_ = GOOGLE_ULONGLONG(0);
 }
-::google::protobuf::uint64 AddColumnRequest::db_id() const {
-  // @@protoc_insertion_point(field_get:mspb.AddColumnRequest.db_id)
+::google::protobuf::uint64 TruncateTableRequest::db_id() const {
+  // @@protoc_insertion_point(field_get:mspb.TruncateTableRequest.db_id)
   return db_id_;
 }
-void AddColumnRequest::set_db_id(::google::protobuf::uint64 value) {
+void TruncateTableRequest::set_db_id(::google::protobuf::uint64 value) {
   
   db_id_ = value;
-  // @@protoc_insertion_point(field_set:mspb.AddColumnRequest.db_id)
+  // @@protoc_insertion_point(field_set:mspb.TruncateTableRequest.db_id)
 }
 
 // uint64 table_id = 3;
-void AddColumnRequest::clear_table_id() {
+void TruncateTableRequest::clear_table_id() {
   table_id_ = GOOGLE_ULONGLONG(0);
 }
-::google::protobuf::uint64 AddColumnRequest::table_id() const {
-  // @@protoc_insertion_point(field_get:mspb.AddColumnRequest.table_id)
+::google::protobuf::uint64 TruncateTableRequest::table_id() const {
+  // @@protoc_insertion_point(field_get:mspb.TruncateTableRequest.table_id)
   return table_id_;
 }
-void AddColumnRequest::set_table_id(::google::protobuf::uint64 value) {
+void TruncateTableRequest::set_table_id(::google::protobuf::uint64 value) {
   
   table_id_ = value;
-  // @@protoc_insertion_point(field_set:mspb.AddColumnRequest.table_id)
-}
-
-// repeated .metapb.Column columns = 4;
-int AddColumnRequest::columns_size() const {
-  return columns_.size();
-}
-void AddColumnRequest::clear_columns() {
-  columns_.Clear();
-}
-const ::metapb::Column& AddColumnRequest::columns(int index) const {
-  // @@protoc_insertion_point(field_get:mspb.AddColumnRequest.columns)
-  return columns_.Get(index);
-}
-::metapb::Column* AddColumnRequest::mutable_columns(int index) {
-  // @@protoc_insertion_point(field_mutable:mspb.AddColumnRequest.columns)
-  return columns_.Mutable(index);
-}
-::metapb::Column* AddColumnRequest::add_columns() {
-  // @@protoc_insertion_point(field_add:mspb.AddColumnRequest.columns)
-  return columns_.Add();
-}
-::google::protobuf::RepeatedPtrField< ::metapb::Column >*
-AddColumnRequest::mutable_columns() {
-  // @@protoc_insertion_point(field_mutable_list:mspb.AddColumnRequest.columns)
-  return &columns_;
-}
-const ::google::protobuf::RepeatedPtrField< ::metapb::Column >&
-AddColumnRequest::columns() const {
-  // @@protoc_insertion_point(field_list:mspb.AddColumnRequest.columns)
-  return columns_;
+  // @@protoc_insertion_point(field_set:mspb.TruncateTableRequest.table_id)
 }
 
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -16861,22 +19810,20 @@ AddColumnRequest::columns() const {
 // ===================================================================
 
 #if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int AddColumnResponse::kHeaderFieldNumber;
-const int AddColumnResponse::kColumnsFieldNumber;
+const int TruncateTableResponse::kHeaderFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
-AddColumnResponse::AddColumnResponse()
+TruncateTableResponse::TruncateTableResponse()
   : ::google::protobuf::Message(), _internal_metadata_(NULL) {
   if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
     protobuf_mspb_2eproto::InitDefaults();
   }
   SharedCtor();
-  // @@protoc_insertion_point(constructor:mspb.AddColumnResponse)
+  // @@protoc_insertion_point(constructor:mspb.TruncateTableResponse)
 }
-AddColumnResponse::AddColumnResponse(const AddColumnResponse& from)
+TruncateTableResponse::TruncateTableResponse(const TruncateTableResponse& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
-      columns_(from.columns_),
       _cached_size_(0) {
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   if (from.has_header()) {
@@ -16884,53 +19831,52 @@ AddColumnResponse::AddColumnResponse(const AddColumnResponse& from)
   } else {
     header_ = NULL;
   }
-  // @@protoc_insertion_point(copy_constructor:mspb.AddColumnResponse)
+  // @@protoc_insertion_point(copy_constructor:mspb.TruncateTableResponse)
 }
 
-void AddColumnResponse::SharedCtor() {
+void TruncateTableResponse::SharedCtor() {
   header_ = NULL;
   _cached_size_ = 0;
 }
 
-AddColumnResponse::~AddColumnResponse() {
-  // @@protoc_insertion_point(destructor:mspb.AddColumnResponse)
+TruncateTableResponse::~TruncateTableResponse() {
+  // @@protoc_insertion_point(destructor:mspb.TruncateTableResponse)
   SharedDtor();
 }
 
-void AddColumnResponse::SharedDtor() {
+void TruncateTableResponse::SharedDtor() {
   if (this != internal_default_instance()) delete header_;
 }
 
-void AddColumnResponse::SetCachedSize(int size) const {
+void TruncateTableResponse::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* AddColumnResponse::descriptor() {
+const ::google::protobuf::Descriptor* TruncateTableResponse::descriptor() {
   protobuf_mspb_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_mspb_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
 }
 
-const AddColumnResponse& AddColumnResponse::default_instance() {
+const TruncateTableResponse& TruncateTableResponse::default_instance() {
   protobuf_mspb_2eproto::InitDefaults();
   return *internal_default_instance();
 }
 
-AddColumnResponse* AddColumnResponse::New(::google::protobuf::Arena* arena) const {
-  AddColumnResponse* n = new AddColumnResponse;
+TruncateTableResponse* TruncateTableResponse::New(::google::protobuf::Arena* arena) const {
+  TruncateTableResponse* n = new TruncateTableResponse;
   if (arena != NULL) {
     arena->Own(n);
   }
   return n;
 }
 
-void AddColumnResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:mspb.AddColumnResponse)
+void TruncateTableResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:mspb.TruncateTableResponse)
   ::google::protobuf::uint32 cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  columns_.Clear();
   if (GetArenaNoVirtual() == NULL && header_ != NULL) {
     delete header_;
   }
@@ -16938,11 +19884,11 @@ void AddColumnResponse::Clear() {
   _internal_metadata_.Clear();
 }
 
-bool AddColumnResponse::MergePartialFromCodedStream(
+bool TruncateTableResponse::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:mspb.AddColumnResponse)
+  // @@protoc_insertion_point(parse_start:mspb.TruncateTableResponse)
   for (;;) {
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
     tag = p.first;
@@ -16960,18 +19906,6 @@ bool AddColumnResponse::MergePartialFromCodedStream(
         break;
       }
 
-      // repeated .metapb.Column columns = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(18u /* 18 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-                input, add_columns()));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
       default: {
       handle_unusual:
         if (tag == 0) {
@@ -16984,17 +19918,17 @@ bool AddColumnResponse::MergePartialFromCodedStream(
     }
   }
 success:
-  // @@protoc_insertion_point(parse_success:mspb.AddColumnResponse)
+  // @@protoc_insertion_point(parse_success:mspb.TruncateTableResponse)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:mspb.AddColumnResponse)
+  // @@protoc_insertion_point(parse_failure:mspb.TruncateTableResponse)
   return false;
 #undef DO_
 }
 
-void AddColumnResponse::SerializeWithCachedSizes(
+void TruncateTableResponse::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:mspb.AddColumnResponse)
+  // @@protoc_insertion_point(serialize_start:mspb.TruncateTableResponse)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
@@ -17004,24 +19938,17 @@ void AddColumnResponse::SerializeWithCachedSizes(
       1, *this->header_, output);
   }
 
-  // repeated .metapb.Column columns = 2;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->columns_size()); i < n; i++) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      2, this->columns(static_cast<int>(i)), output);
-  }
-
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
     ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
   }
-  // @@protoc_insertion_point(serialize_end:mspb.AddColumnResponse)
+  // @@protoc_insertion_point(serialize_end:mspb.TruncateTableResponse)
 }
 
-::google::protobuf::uint8* AddColumnResponse::InternalSerializeWithCachedSizesToArray(
+::google::protobuf::uint8* TruncateTableResponse::InternalSerializeWithCachedSizesToArray(
     bool deterministic, ::google::protobuf::uint8* target) const {
   (void)deterministic; // Unused
-  // @@protoc_insertion_point(serialize_to_array_start:mspb.AddColumnResponse)
+  // @@protoc_insertion_point(serialize_to_array_start:mspb.TruncateTableResponse)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
@@ -17032,24 +19959,16 @@ void AddColumnResponse::SerializeWithCachedSizes(
         1, *this->header_, deterministic, target);
   }
 
-  // repeated .metapb.Column columns = 2;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->columns_size()); i < n; i++) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageNoVirtualToArray(
-        2, this->columns(static_cast<int>(i)), deterministic, target);
-  }
-
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
     target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:mspb.AddColumnResponse)
+  // @@protoc_insertion_point(serialize_to_array_end:mspb.TruncateTableResponse)
   return target;
 }
 
-size_t AddColumnResponse::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:mspb.AddColumnResponse)
+size_t TruncateTableResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mspb.TruncateTableResponse)
   size_t total_size = 0;
 
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
@@ -17057,17 +19976,6 @@ size_t AddColumnResponse::ByteSizeLong() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
   }
-  // repeated .metapb.Column columns = 2;
-  {
-    unsigned int count = static_cast<unsigned int>(this->columns_size());
-    total_size += 1UL * count;
-    for (unsigned int i = 0; i < count; i++) {
-      total_size +=
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->columns(static_cast<int>(i)));
-    }
-  }
-
   // .mspb.ResponseHeader header = 1;
   if (this->has_header()) {
     total_size += 1 +
@@ -17082,102 +19990,100 @@ size_t AddColumnResponse::ByteSizeLong() const {
   return total_size;
 }
 
-void AddColumnResponse::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:mspb.AddColumnResponse)
+void TruncateTableResponse::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:mspb.TruncateTableResponse)
   GOOGLE_DCHECK_NE(&from, this);
-  const AddColumnResponse* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const AddColumnResponse>(
+  const TruncateTableResponse* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const TruncateTableResponse>(
           &from);
   if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:mspb.AddColumnResponse)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:mspb.TruncateTableResponse)
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:mspb.AddColumnResponse)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:mspb.TruncateTableResponse)
     MergeFrom(*source);
   }
 }
 
-void AddColumnResponse::MergeFrom(const AddColumnResponse& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:mspb.AddColumnResponse)
+void TruncateTableResponse::MergeFrom(const TruncateTableResponse& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:mspb.TruncateTableResponse)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  columns_.MergeFrom(from.columns_);
   if (from.has_header()) {
     mutable_header()->::mspb::ResponseHeader::MergeFrom(from.header());
   }
 }
 
-void AddColumnResponse::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:mspb.AddColumnResponse)
+void TruncateTableResponse::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:mspb.TruncateTableResponse)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void AddColumnResponse::CopyFrom(const AddColumnResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:mspb.AddColumnResponse)
+void TruncateTableResponse::CopyFrom(const TruncateTableResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mspb.TruncateTableResponse)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool AddColumnResponse::IsInitialized() const {
+bool TruncateTableResponse::IsInitialized() const {
   return true;
 }
 
-void AddColumnResponse::Swap(AddColumnResponse* other) {
+void TruncateTableResponse::Swap(TruncateTableResponse* other) {
   if (other == this) return;
   InternalSwap(other);
 }
-void AddColumnResponse::InternalSwap(AddColumnResponse* other) {
+void TruncateTableResponse::InternalSwap(TruncateTableResponse* other) {
   using std::swap;
-  columns_.InternalSwap(&other->columns_);
   swap(header_, other->header_);
   _internal_metadata_.Swap(&other->_internal_metadata_);
   swap(_cached_size_, other->_cached_size_);
 }
 
-::google::protobuf::Metadata AddColumnResponse::GetMetadata() const {
+::google::protobuf::Metadata TruncateTableResponse::GetMetadata() const {
   protobuf_mspb_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_mspb_2eproto::file_level_metadata[kIndexInFileMessages];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
-// AddColumnResponse
+// TruncateTableResponse
 
 // .mspb.ResponseHeader header = 1;
-bool AddColumnResponse::has_header() const {
+bool TruncateTableResponse::has_header() const {
   return this != internal_default_instance() && header_ != NULL;
 }
-void AddColumnResponse::clear_header() {
+void TruncateTableResponse::clear_header() {
   if (GetArenaNoVirtual() == NULL && header_ != NULL) delete header_;
   header_ = NULL;
 }
-const ::mspb::ResponseHeader& AddColumnResponse::header() const {
+const ::mspb::ResponseHeader& TruncateTableResponse::header() const {
   const ::mspb::ResponseHeader* p = header_;
-  // @@protoc_insertion_point(field_get:mspb.AddColumnResponse.header)
+  // @@protoc_insertion_point(field_get:mspb.TruncateTableResponse.header)
   return p != NULL ? *p : *reinterpret_cast<const ::mspb::ResponseHeader*>(
       &::mspb::_ResponseHeader_default_instance_);
 }
-::mspb::ResponseHeader* AddColumnResponse::mutable_header() {
+::mspb::ResponseHeader* TruncateTableResponse::mutable_header() {
   
   if (header_ == NULL) {
     header_ = new ::mspb::ResponseHeader;
   }
-  // @@protoc_insertion_point(field_mutable:mspb.AddColumnResponse.header)
+  // @@protoc_insertion_point(field_mutable:mspb.TruncateTableResponse.header)
   return header_;
 }
-::mspb::ResponseHeader* AddColumnResponse::release_header() {
-  // @@protoc_insertion_point(field_release:mspb.AddColumnResponse.header)
+::mspb::ResponseHeader* TruncateTableResponse::release_header() {
+  // @@protoc_insertion_point(field_release:mspb.TruncateTableResponse.header)
   
   ::mspb::ResponseHeader* temp = header_;
   header_ = NULL;
   return temp;
 }
-void AddColumnResponse::set_allocated_header(::mspb::ResponseHeader* header) {
+void TruncateTableResponse::set_allocated_header(::mspb::ResponseHeader* header) {
   delete header_;
   header_ = header;
   if (header) {
@@ -17185,37 +20091,7 @@ void AddColumnResponse::set_allocated_header(::mspb::ResponseHeader* header) {
   } else {
     
   }
-  // @@protoc_insertion_point(field_set_allocated:mspb.AddColumnResponse.header)
-}
-
-// repeated .metapb.Column columns = 2;
-int AddColumnResponse::columns_size() const {
-  return columns_.size();
-}
-void AddColumnResponse::clear_columns() {
-  columns_.Clear();
-}
-const ::metapb::Column& AddColumnResponse::columns(int index) const {
-  // @@protoc_insertion_point(field_get:mspb.AddColumnResponse.columns)
-  return columns_.Get(index);
-}
-::metapb::Column* AddColumnResponse::mutable_columns(int index) {
-  // @@protoc_insertion_point(field_mutable:mspb.AddColumnResponse.columns)
-  return columns_.Mutable(index);
-}
-::metapb::Column* AddColumnResponse::add_columns() {
-  // @@protoc_insertion_point(field_add:mspb.AddColumnResponse.columns)
-  return columns_.Add();
-}
-::google::protobuf::RepeatedPtrField< ::metapb::Column >*
-AddColumnResponse::mutable_columns() {
-  // @@protoc_insertion_point(field_mutable_list:mspb.AddColumnResponse.columns)
-  return &columns_;
-}
-const ::google::protobuf::RepeatedPtrField< ::metapb::Column >&
-AddColumnResponse::columns() const {
-  // @@protoc_insertion_point(field_list:mspb.AddColumnResponse.columns)
-  return columns_;
+  // @@protoc_insertion_point(field_set_allocated:mspb.TruncateTableResponse.header)
 }
 
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -17223,95 +20099,93 @@ AddColumnResponse::columns() const {
 // ===================================================================
 
 #if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int TruncateTableRequest::kHeaderFieldNumber;
-const int TruncateTableRequest::kDbIdFieldNumber;
-const int TruncateTableRequest::kTableIdFieldNumber;
+const int CreateDatabaseRequest::kHeaderFieldNumber;
+const int CreateDatabaseRequest::kDbNameFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
-TruncateTableRequest::TruncateTableRequest()
+CreateDatabaseRequest::CreateDatabaseRequest()
   : ::google::protobuf::Message(), _internal_metadata_(NULL) {
   if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
     protobuf_mspb_2eproto::InitDefaults();
   }
   SharedCtor();
-  // @@protoc_insertion_point(constructor:mspb.TruncateTableRequest)
+  // @@protoc_insertion_point(constructor:mspb.CreateDatabaseRequest)
 }
-TruncateTableRequest::TruncateTableRequest(const TruncateTableRequest& from)
+CreateDatabaseRequest::CreateDatabaseRequest(const CreateDatabaseRequest& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
       _cached_size_(0) {
   _internal_metadata_.MergeFrom(from._internal_metadata_);
+  db_name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (from.db_name().size() > 0) {
+    db_name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.db_name_);
+  }
   if (from.has_header()) {
     header_ = new ::mspb::RequestHeader(*from.header_);
   } else {
     header_ = NULL;
   }
-  ::memcpy(&db_id_, &from.db_id_,
-    static_cast<size_t>(reinterpret_cast<char*>(&table_id_) -
-    reinterpret_cast<char*>(&db_id_)) + sizeof(table_id_));
-  // @@protoc_insertion_point(copy_constructor:mspb.TruncateTableRequest)
+  // @@protoc_insertion_point(copy_constructor:mspb.CreateDatabaseRequest)
 }
 
-void TruncateTableRequest::SharedCtor() {
-  ::memset(&header_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&table_id_) -
-      reinterpret_cast<char*>(&header_)) + sizeof(table_id_));
+void CreateDatabaseRequest::SharedCtor() {
+  db_name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  header_ = NULL;
   _cached_size_ = 0;
 }
 
-TruncateTableRequest::~TruncateTableRequest() {
-  // @@protoc_insertion_point(destructor:mspb.TruncateTableRequest)
+CreateDatabaseRequest::~CreateDatabaseRequest() {
+  // @@protoc_insertion_point(destructor:mspb.CreateDatabaseRequest)
   SharedDtor();
 }
 
-void TruncateTableRequest::SharedDtor() {
+void CreateDatabaseRequest::SharedDtor() {
+  db_name_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   if (this != internal_default_instance()) delete header_;
 }
 
-void TruncateTableRequest::SetCachedSize(int size) const {
+void CreateDatabaseRequest::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* TruncateTableRequest::descriptor() {
+const ::google::protobuf::Descriptor* CreateDatabaseRequest::descriptor() {
   protobuf_mspb_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_mspb_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
 }
 
-const TruncateTableRequest& TruncateTableRequest::default_instance() {
+const CreateDatabaseRequest& CreateDatabaseRequest::default_instance() {
   protobuf_mspb_2eproto::InitDefaults();
   return *internal_default_instance();
 }
 
-TruncateTableRequest* TruncateTableRequest::New(::google::protobuf::Arena* arena) const {
-  TruncateTableRequest* n = new TruncateTableRequest;
+CreateDatabaseRequest* CreateDatabaseRequest::New(::google::protobuf::Arena* arena) const {
+  CreateDatabaseRequest* n = new CreateDatabaseRequest;
   if (arena != NULL) {
     arena->Own(n);
   }
   return n;
 }
 
-void TruncateTableRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:mspb.TruncateTableRequest)
+void CreateDatabaseRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:mspb.CreateDatabaseRequest)
   ::google::protobuf::uint32 cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
+  db_name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   if (GetArenaNoVirtual() == NULL && header_ != NULL) {
     delete header_;
   }
   header_ = NULL;
-  ::memset(&db_id_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&table_id_) -
-      reinterpret_cast<char*>(&db_id_)) + sizeof(table_id_));
   _internal_metadata_.Clear();
 }
 
-bool TruncateTableRequest::MergePartialFromCodedStream(
+bool CreateDatabaseRequest::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:mspb.TruncateTableRequest)
+  // @@protoc_insertion_point(parse_start:mspb.CreateDatabaseRequest)
   for (;;) {
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
     tag = p.first;
@@ -17329,28 +20203,16 @@ bool TruncateTableRequest::MergePartialFromCodedStream(
         break;
       }
 
-      // uint64 db_id = 2;
+      // string db_name = 2;
       case 2: {
         if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(16u /* 16 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
-                 input, &db_id_)));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // uint64 table_id = 3;
-      case 3: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(24u /* 24 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
-                 input, &table_id_)));
+            static_cast< ::google::protobuf::uint8>(18u /* 18 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_db_name()));
+          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+            this->db_name().data(), static_cast<int>(this->db_name().length()),
+            ::google::protobuf::internal::WireFormatLite::PARSE,
+            "mspb.CreateDatabaseRequest.db_name"));
         } else {
           goto handle_unusual;
         }
@@ -17369,17 +20231,17 @@ bool TruncateTableRequest::MergePartialFromCodedStream(
     }
   }
 success:
-  // @@protoc_insertion_point(parse_success:mspb.TruncateTableRequest)
+  // @@protoc_insertion_point(parse_success:mspb.CreateDatabaseRequest)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:mspb.TruncateTableRequest)
+  // @@protoc_insertion_point(parse_failure:mspb.CreateDatabaseRequest)
   return false;
 #undef DO_
 }
 
-void TruncateTableRequest::SerializeWithCachedSizes(
+void CreateDatabaseRequest::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:mspb.TruncateTableRequest)
+  // @@protoc_insertion_point(serialize_start:mspb.CreateDatabaseRequest)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
@@ -17389,27 +20251,27 @@ void TruncateTableRequest::SerializeWithCachedSizes(
       1, *this->header_, output);
   }
 
-  // uint64 db_id = 2;
-  if (this->db_id() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt64(2, this->db_id(), output);
-  }
-
-  // uint64 table_id = 3;
-  if (this->table_id() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt64(3, this->table_id(), output);
+  // string db_name = 2;
+  if (this->db_name().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+      this->db_name().data(), static_cast<int>(this->db_name().length()),
+      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+      "mspb.CreateDatabaseRequest.db_name");
+    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
+      2, this->db_name(), output);
   }
 
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
     ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
   }
-  // @@protoc_insertion_point(serialize_end:mspb.TruncateTableRequest)
+  // @@protoc_insertion_point(serialize_end:mspb.CreateDatabaseRequest)
 }
 
-::google::protobuf::uint8* TruncateTableRequest::InternalSerializeWithCachedSizesToArray(
+::google::protobuf::uint8* CreateDatabaseRequest::InternalSerializeWithCachedSizesToArray(
     bool deterministic, ::google::protobuf::uint8* target) const {
   (void)deterministic; // Unused
-  // @@protoc_insertion_point(serialize_to_array_start:mspb.TruncateTableRequest)
+  // @@protoc_insertion_point(serialize_to_array_start:mspb.CreateDatabaseRequest)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
@@ -17420,26 +20282,27 @@ void TruncateTableRequest::SerializeWithCachedSizes(
         1, *this->header_, deterministic, target);
   }
 
-  // uint64 db_id = 2;
-  if (this->db_id() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(2, this->db_id(), target);
-  }
-
-  // uint64 table_id = 3;
-  if (this->table_id() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(3, this->table_id(), target);
+  // string db_name = 2;
+  if (this->db_name().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+      this->db_name().data(), static_cast<int>(this->db_name().length()),
+      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+      "mspb.CreateDatabaseRequest.db_name");
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        2, this->db_name(), target);
   }
 
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
     target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:mspb.TruncateTableRequest)
+  // @@protoc_insertion_point(serialize_to_array_end:mspb.CreateDatabaseRequest)
   return target;
 }
 
-size_t TruncateTableRequest::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:mspb.TruncateTableRequest)
+size_t CreateDatabaseRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mspb.CreateDatabaseRequest)
   size_t total_size = 0;
 
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
@@ -17447,6 +20310,13 @@ size_t TruncateTableRequest::ByteSizeLong() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
   }
+  // string db_name = 2;
+  if (this->db_name().size() > 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::StringSize(
+        this->db_name());
+  }
+
   // .mspb.RequestHeader header = 1;
   if (this->has_header()) {
     total_size += 1 +
@@ -17454,20 +20324,6 @@ size_t TruncateTableRequest::ByteSizeLong() const {
         *this->header_);
   }
 
-  // uint64 db_id = 2;
-  if (this->db_id() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt64Size(
-        this->db_id());
-  }
-
-  // uint64 table_id = 3;
-  if (this->table_id() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt64Size(
-        this->table_id());
-  }
-
   int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = cached_size;
@@ -17475,144 +20331,166 @@ size_t TruncateTableRequest::ByteSizeLong() const {
   return total_size;
 }
 
-void TruncateTableRequest::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:mspb.TruncateTableRequest)
+void CreateDatabaseRequest::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:mspb.CreateDatabaseRequest)
   GOOGLE_DCHECK_NE(&from, this);
-  const TruncateTableRequest* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const TruncateTableRequest>(
+  const CreateDatabaseRequest* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const CreateDatabaseRequest>(
           &from);
   if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:mspb.TruncateTableRequest)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:mspb.CreateDatabaseRequest)
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:mspb.TruncateTableRequest)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:mspb.CreateDatabaseRequest)
     MergeFrom(*source);
   }
 }
 
-void TruncateTableRequest::MergeFrom(const TruncateTableRequest& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:mspb.TruncateTableRequest)
+void CreateDatabaseRequest::MergeFrom(const CreateDatabaseRequest& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:mspb.CreateDatabaseRequest)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
+  if (from.db_name().size() > 0) {
+
+    db_name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.db_name_);
+  }
   if (from.has_header()) {
     mutable_header()->::mspb::RequestHeader::MergeFrom(from.header());
   }
-  if (from.db_id() != 0) {
-    set_db_id(from.db_id());
-  }
-  if (from.table_id() != 0) {
-    set_table_id(from.table_id());
-  }
 }
 
-void TruncateTableRequest::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:mspb.TruncateTableRequest)
+void CreateDatabaseRequest::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:mspb.CreateDatabaseRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void TruncateTableRequest::CopyFrom(const TruncateTableRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:mspb.TruncateTableRequest)
+void CreateDatabaseRequest::CopyFrom(const CreateDatabaseRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mspb.CreateDatabaseRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool TruncateTableRequest::IsInitialized() const {
+bool CreateDatabaseRequest::IsInitialized() const {
   return true;
 }
 
-void TruncateTableRequest::Swap(TruncateTableRequest* other) {
+void CreateDatabaseRequest::Swap(CreateDatabaseRequest* other) {
   if (other == this) return;
   InternalSwap(other);
 }
-void TruncateTableRequest::InternalSwap(TruncateTableRequest* other) {
+void CreateDatabaseRequest::InternalSwap(CreateDatabaseRequest* other) {
   using std::swap;
+  db_name_.Swap(&other->db_name_);
   swap(header_, other->header_);
-  swap(db_id_, other->db_id_);
-  swap(table_id_, other->table_id_);
   _internal_metadata_.Swap(&other->_internal_metadata_);
   swap(_cached_size_, other->_cached_size_);
 }
 
-::google::protobuf::Metadata TruncateTableRequest::GetMetadata() const {
+::google::protobuf::Metadata CreateDatabaseRequest::GetMetadata() const {
   protobuf_mspb_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_mspb_2eproto::file_level_metadata[kIndexInFileMessages];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
-// TruncateTableRequest
+// CreateDatabaseRequest
 
 // .mspb.RequestHeader header = 1;
-bool TruncateTableRequest::has_header() const {
+bool CreateDatabaseRequest::has_header() const {
   return this != internal_default_instance() && header_ != NULL;
 }
-void TruncateTableRequest::clear_header() {
+void CreateDatabaseRequest::clear_header() {
   if (GetArenaNoVirtual() == NULL && header_ != NULL) delete header_;
   header_ = NULL;
 }
-const ::mspb::RequestHeader& TruncateTableRequest::header() const {
+const ::mspb::RequestHeader& CreateDatabaseRequest::header() const {
   const ::mspb::RequestHeader* p = header_;
-  // @@protoc_insertion_point(field_get:mspb.TruncateTableRequest.header)
+  // @@protoc_insertion_point(field_get:mspb.CreateDatabaseRequest.header)
   return p != NULL ? *p : *reinterpret_cast<const ::mspb::RequestHeader*>(
       &::mspb::_RequestHeader_default_instance_);
 }
-::mspb::RequestHeader* TruncateTableRequest::mutable_header() {
+::mspb::RequestHeader* CreateDatabaseRequest::mutable_header() {
+  
+  if (header_ == NULL) {
+    header_ = new ::mspb::RequestHeader;
+  }
+  // @@protoc_insertion_point(field_mutable:mspb.CreateDatabaseRequest.header)
+  return header_;
+}
+::mspb::RequestHeader* CreateDatabaseRequest::release_header() {
+  // @@protoc_insertion_point(field_release:mspb.CreateDatabaseRequest.header)
+  
+  ::mspb::RequestHeader* temp = header_;
+  header_ = NULL;
+  return temp;
+}
+void CreateDatabaseRequest::set_allocated_header(::mspb::RequestHeader* header) {
+  delete header_;
+  header_ = header;
+  if (header) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_set_allocated:mspb.CreateDatabaseRequest.header)
+}
+
+// string db_name = 2;
+void CreateDatabaseRequest::clear_db_name() {
+  db_name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+const ::std::string& CreateDatabaseRequest::db_name() const {
+  // @@protoc_insertion_point(field_get:mspb.CreateDatabaseRequest.db_name)
+  return db_name_.GetNoArena();
+}
+void CreateDatabaseRequest::set_db_name(const ::std::string& value) {
+  
+  db_name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:mspb.CreateDatabaseRequest.db_name)
+}
+#if LANG_CXX11
+void CreateDatabaseRequest::set_db_name(::std::string&& value) {
+  
+  db_name_.SetNoArena(
+    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:mspb.CreateDatabaseRequest.db_name)
+}
+#endif
+void CreateDatabaseRequest::set_db_name(const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  
+  db_name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:mspb.CreateDatabaseRequest.db_name)
+}
+void CreateDatabaseRequest::set_db_name(const char* value, size_t size) {
   
-  if (header_ == NULL) {
-    header_ = new ::mspb::RequestHeader;
-  }
-  // @@protoc_insertion_point(field_mutable:mspb.TruncateTableRequest.header)
-  return header_;
+  db_name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:mspb.CreateDatabaseRequest.db_name)
 }
-::mspb::RequestHeader* TruncateTableRequest::release_header() {
-  // @@protoc_insertion_point(field_release:mspb.TruncateTableRequest.header)
+::std::string* CreateDatabaseRequest::mutable_db_name() {
   
-  ::mspb::RequestHeader* temp = header_;
-  header_ = NULL;
-  return temp;
+  // @@protoc_insertion_point(field_mutable:mspb.CreateDatabaseRequest.db_name)
+  return db_name_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-void TruncateTableRequest::set_allocated_header(::mspb::RequestHeader* header) {
-  delete header_;
-  header_ = header;
-  if (header) {
+::std::string* CreateDatabaseRequest::release_db_name() {
+  // @@protoc_insertion_point(field_release:mspb.CreateDatabaseRequest.db_name)
+  
+  return db_name_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+void CreateDatabaseRequest::set_allocated_db_name(::std::string* db_name) {
+  if (db_name != NULL) {
     
   } else {
     
   }
-  // @@protoc_insertion_point(field_set_allocated:mspb.TruncateTableRequest.header)
-}
-
-// uint64 db_id = 2;
-void TruncateTableRequest::clear_db_id() {
-  db_id_ = GOOGLE_ULONGLONG(0);
-}
-::google::protobuf::uint64 TruncateTableRequest::db_id() const {
-  // @@protoc_insertion_point(field_get:mspb.TruncateTableRequest.db_id)
-  return db_id_;
-}
-void TruncateTableRequest::set_db_id(::google::protobuf::uint64 value) {
-  
-  db_id_ = value;
-  // @@protoc_insertion_point(field_set:mspb.TruncateTableRequest.db_id)
-}
-
-// uint64 table_id = 3;
-void TruncateTableRequest::clear_table_id() {
-  table_id_ = GOOGLE_ULONGLONG(0);
-}
-::google::protobuf::uint64 TruncateTableRequest::table_id() const {
-  // @@protoc_insertion_point(field_get:mspb.TruncateTableRequest.table_id)
-  return table_id_;
-}
-void TruncateTableRequest::set_table_id(::google::protobuf::uint64 value) {
-  
-  table_id_ = value;
-  // @@protoc_insertion_point(field_set:mspb.TruncateTableRequest.table_id)
+  db_name_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), db_name);
+  // @@protoc_insertion_point(field_set_allocated:mspb.CreateDatabaseRequest.db_name)
 }
 
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -17620,18 +20498,18 @@ void TruncateTableRequest::set_table_id(::google::protobuf::uint64 value) {
 // ===================================================================
 
 #if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int TruncateTableResponse::kHeaderFieldNumber;
+const int CreateDatabaseResponse::kHeaderFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
-TruncateTableResponse::TruncateTableResponse()
+CreateDatabaseResponse::CreateDatabaseResponse()
   : ::google::protobuf::Message(), _internal_metadata_(NULL) {
   if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
     protobuf_mspb_2eproto::InitDefaults();
   }
   SharedCtor();
-  // @@protoc_insertion_point(constructor:mspb.TruncateTableResponse)
+  // @@protoc_insertion_point(constructor:mspb.CreateDatabaseResponse)
 }
-TruncateTableResponse::TruncateTableResponse(const TruncateTableResponse& from)
+CreateDatabaseResponse::CreateDatabaseResponse(const CreateDatabaseResponse& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
       _cached_size_(0) {
@@ -17641,48 +20519,48 @@ TruncateTableResponse::TruncateTableResponse(const TruncateTableResponse& from)
   } else {
     header_ = NULL;
   }
-  // @@protoc_insertion_point(copy_constructor:mspb.TruncateTableResponse)
+  // @@protoc_insertion_point(copy_constructor:mspb.CreateDatabaseResponse)
 }
 
-void TruncateTableResponse::SharedCtor() {
+void CreateDatabaseResponse::SharedCtor() {
   header_ = NULL;
   _cached_size_ = 0;
 }
 
-TruncateTableResponse::~TruncateTableResponse() {
-  // @@protoc_insertion_point(destructor:mspb.TruncateTableResponse)
+CreateDatabaseResponse::~CreateDatabaseResponse() {
+  // @@protoc_insertion_point(destructor:mspb.CreateDatabaseResponse)
   SharedDtor();
 }
 
-void TruncateTableResponse::SharedDtor() {
+void CreateDatabaseResponse::SharedDtor() {
   if (this != internal_default_instance()) delete header_;
 }
 
-void TruncateTableResponse::SetCachedSize(int size) const {
+void CreateDatabaseResponse::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* TruncateTableResponse::descriptor() {
+const ::google::protobuf::Descriptor* CreateDatabaseResponse::descriptor() {
   protobuf_mspb_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_mspb_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
 }
 
-const TruncateTableResponse& TruncateTableResponse::default_instance() {
+const CreateDatabaseResponse& CreateDatabaseResponse::default_instance() {
   protobuf_mspb_2eproto::InitDefaults();
   return *internal_default_instance();
 }
 
-TruncateTableResponse* TruncateTableResponse::New(::google::protobuf::Arena* arena) const {
-  TruncateTableResponse* n = new TruncateTableResponse;
+CreateDatabaseResponse* CreateDatabaseResponse::New(::google::protobuf::Arena* arena) const {
+  CreateDatabaseResponse* n = new CreateDatabaseResponse;
   if (arena != NULL) {
     arena->Own(n);
   }
   return n;
 }
 
-void TruncateTableResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:mspb.TruncateTableResponse)
+void CreateDatabaseResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:mspb.CreateDatabaseResponse)
   ::google::protobuf::uint32 cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
@@ -17694,11 +20572,11 @@ void TruncateTableResponse::Clear() {
   _internal_metadata_.Clear();
 }
 
-bool TruncateTableResponse::MergePartialFromCodedStream(
+bool CreateDatabaseResponse::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:mspb.TruncateTableResponse)
+  // @@protoc_insertion_point(parse_start:mspb.CreateDatabaseResponse)
   for (;;) {
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
     tag = p.first;
@@ -17728,17 +20606,17 @@ bool TruncateTableResponse::MergePartialFromCodedStream(
     }
   }
 success:
-  // @@protoc_insertion_point(parse_success:mspb.TruncateTableResponse)
+  // @@protoc_insertion_point(parse_success:mspb.CreateDatabaseResponse)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:mspb.TruncateTableResponse)
+  // @@protoc_insertion_point(parse_failure:mspb.CreateDatabaseResponse)
   return false;
 #undef DO_
 }
 
-void TruncateTableResponse::SerializeWithCachedSizes(
+void CreateDatabaseResponse::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:mspb.TruncateTableResponse)
+  // @@protoc_insertion_point(serialize_start:mspb.CreateDatabaseResponse)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
@@ -17752,13 +20630,13 @@ void TruncateTableResponse::SerializeWithCachedSizes(
     ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
   }
-  // @@protoc_insertion_point(serialize_end:mspb.TruncateTableResponse)
+  // @@protoc_insertion_point(serialize_end:mspb.CreateDatabaseResponse)
 }
 
-::google::protobuf::uint8* TruncateTableResponse::InternalSerializeWithCachedSizesToArray(
+::google::protobuf::uint8* CreateDatabaseResponse::InternalSerializeWithCachedSizesToArray(
     bool deterministic, ::google::protobuf::uint8* target) const {
   (void)deterministic; // Unused
-  // @@protoc_insertion_point(serialize_to_array_start:mspb.TruncateTableResponse)
+  // @@protoc_insertion_point(serialize_to_array_start:mspb.CreateDatabaseResponse)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
@@ -17773,12 +20651,12 @@ void TruncateTableResponse::SerializeWithCachedSizes(
     target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:mspb.TruncateTableResponse)
+  // @@protoc_insertion_point(serialize_to_array_end:mspb.CreateDatabaseResponse)
   return target;
 }
 
-size_t TruncateTableResponse::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:mspb.TruncateTableResponse)
+size_t CreateDatabaseResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mspb.CreateDatabaseResponse)
   size_t total_size = 0;
 
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
@@ -17800,23 +20678,23 @@ size_t TruncateTableResponse::ByteSizeLong() const {
   return total_size;
 }
 
-void TruncateTableResponse::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:mspb.TruncateTableResponse)
+void CreateDatabaseResponse::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:mspb.CreateDatabaseResponse)
   GOOGLE_DCHECK_NE(&from, this);
-  const TruncateTableResponse* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const TruncateTableResponse>(
+  const CreateDatabaseResponse* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const CreateDatabaseResponse>(
           &from);
   if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:mspb.TruncateTableResponse)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:mspb.CreateDatabaseResponse)
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:mspb.TruncateTableResponse)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:mspb.CreateDatabaseResponse)
     MergeFrom(*source);
   }
 }
 
-void TruncateTableResponse::MergeFrom(const TruncateTableResponse& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:mspb.TruncateTableResponse)
+void CreateDatabaseResponse::MergeFrom(const CreateDatabaseResponse& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:mspb.CreateDatabaseResponse)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   ::google::protobuf::uint32 cached_has_bits = 0;
@@ -17827,73 +20705,73 @@ void TruncateTableResponse::MergeFrom(const TruncateTableResponse& from) {
   }
 }
 
-void TruncateTableResponse::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:mspb.TruncateTableResponse)
+void CreateDatabaseResponse::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:mspb.CreateDatabaseResponse)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void TruncateTableResponse::CopyFrom(const TruncateTableResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:mspb.TruncateTableResponse)
+void CreateDatabaseResponse::CopyFrom(const CreateDatabaseResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mspb.CreateDatabaseResponse)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool TruncateTableResponse::IsInitialized() const {
+bool CreateDatabaseResponse::IsInitialized() const {
   return true;
 }
 
-void TruncateTableResponse::Swap(TruncateTableResponse* other) {
+void CreateDatabaseResponse::Swap(CreateDatabaseResponse* other) {
   if (other == this) return;
   InternalSwap(other);
 }
-void TruncateTableResponse::InternalSwap(TruncateTableResponse* other) {
+void CreateDatabaseResponse::InternalSwap(CreateDatabaseResponse* other) {
   using std::swap;
   swap(header_, other->header_);
   _internal_metadata_.Swap(&other->_internal_metadata_);
   swap(_cached_size_, other->_cached_size_);
 }
 
-::google::protobuf::Metadata TruncateTableResponse::GetMetadata() const {
+::google::protobuf::Metadata CreateDatabaseResponse::GetMetadata() const {
   protobuf_mspb_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_mspb_2eproto::file_level_metadata[kIndexInFileMessages];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
-// TruncateTableResponse
+// CreateDatabaseResponse
 
 // .mspb.ResponseHeader header = 1;
-bool TruncateTableResponse::has_header() const {
+bool CreateDatabaseResponse::has_header() const {
   return this != internal_default_instance() && header_ != NULL;
 }
-void TruncateTableResponse::clear_header() {
+void CreateDatabaseResponse::clear_header() {
   if (GetArenaNoVirtual() == NULL && header_ != NULL) delete header_;
   header_ = NULL;
 }
-const ::mspb::ResponseHeader& TruncateTableResponse::header() const {
+const ::mspb::ResponseHeader& CreateDatabaseResponse::header() const {
   const ::mspb::ResponseHeader* p = header_;
-  // @@protoc_insertion_point(field_get:mspb.TruncateTableResponse.header)
+  // @@protoc_insertion_point(field_get:mspb.CreateDatabaseResponse.header)
   return p != NULL ? *p : *reinterpret_cast<const ::mspb::ResponseHeader*>(
       &::mspb::_ResponseHeader_default_instance_);
 }
-::mspb::ResponseHeader* TruncateTableResponse::mutable_header() {
+::mspb::ResponseHeader* CreateDatabaseResponse::mutable_header() {
   
   if (header_ == NULL) {
     header_ = new ::mspb::ResponseHeader;
   }
-  // @@protoc_insertion_point(field_mutable:mspb.TruncateTableResponse.header)
+  // @@protoc_insertion_point(field_mutable:mspb.CreateDatabaseResponse.header)
   return header_;
 }
-::mspb::ResponseHeader* TruncateTableResponse::release_header() {
-  // @@protoc_insertion_point(field_release:mspb.TruncateTableResponse.header)
+::mspb::ResponseHeader* CreateDatabaseResponse::release_header() {
+  // @@protoc_insertion_point(field_release:mspb.CreateDatabaseResponse.header)
   
   ::mspb::ResponseHeader* temp = header_;
   header_ = NULL;
   return temp;
 }
-void TruncateTableResponse::set_allocated_header(::mspb::ResponseHeader* header) {
+void CreateDatabaseResponse::set_allocated_header(::mspb::ResponseHeader* header) {
   delete header_;
   header_ = header;
   if (header) {
@@ -17901,7 +20779,7 @@ void TruncateTableResponse::set_allocated_header(::mspb::ResponseHeader* header)
   } else {
     
   }
-  // @@protoc_insertion_point(field_set_allocated:mspb.TruncateTableResponse.header)
+  // @@protoc_insertion_point(field_set_allocated:mspb.CreateDatabaseResponse.header)
 }
 
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -17909,19 +20787,21 @@ void TruncateTableResponse::set_allocated_header(::mspb::ResponseHeader* header)
 // ===================================================================
 
 #if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int CreateDatabaseRequest::kHeaderFieldNumber;
-const int CreateDatabaseRequest::kDbNameFieldNumber;
+const int CreateTableRequest::kHeaderFieldNumber;
+const int CreateTableRequest::kDbNameFieldNumber;
+const int CreateTableRequest::kTableNameFieldNumber;
+const int CreateTableRequest::kPropertiesFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
-CreateDatabaseRequest::CreateDatabaseRequest()
+CreateTableRequest::CreateTableRequest()
   : ::google::protobuf::Message(), _internal_metadata_(NULL) {
   if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
     protobuf_mspb_2eproto::InitDefaults();
   }
   SharedCtor();
-  // @@protoc_insertion_point(constructor:mspb.CreateDatabaseRequest)
+  // @@protoc_insertion_point(constructor:mspb.CreateTableRequest)
 }
-CreateDatabaseRequest::CreateDatabaseRequest(const CreateDatabaseRequest& from)
+CreateTableRequest::CreateTableRequest(const CreateTableRequest& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
       _cached_size_(0) {
@@ -17930,60 +20810,74 @@ CreateDatabaseRequest::CreateDatabaseRequest(const CreateDatabaseRequest& from)
   if (from.db_name().size() > 0) {
     db_name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.db_name_);
   }
+  table_name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (from.table_name().size() > 0) {
+    table_name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.table_name_);
+  }
+  properties_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (from.properties().size() > 0) {
+    properties_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.properties_);
+  }
   if (from.has_header()) {
     header_ = new ::mspb::RequestHeader(*from.header_);
   } else {
     header_ = NULL;
   }
-  // @@protoc_insertion_point(copy_constructor:mspb.CreateDatabaseRequest)
+  // @@protoc_insertion_point(copy_constructor:mspb.CreateTableRequest)
 }
 
-void CreateDatabaseRequest::SharedCtor() {
+void CreateTableRequest::SharedCtor() {
   db_name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  table_name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  properties_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   header_ = NULL;
   _cached_size_ = 0;
 }
 
-CreateDatabaseRequest::~CreateDatabaseRequest() {
-  // @@protoc_insertion_point(destructor:mspb.CreateDatabaseRequest)
+CreateTableRequest::~CreateTableRequest() {
+  // @@protoc_insertion_point(destructor:mspb.CreateTableRequest)
   SharedDtor();
 }
 
-void CreateDatabaseRequest::SharedDtor() {
+void CreateTableRequest::SharedDtor() {
   db_name_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  table_name_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  properties_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   if (this != internal_default_instance()) delete header_;
 }
 
-void CreateDatabaseRequest::SetCachedSize(int size) const {
+void CreateTableRequest::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* CreateDatabaseRequest::descriptor() {
+const ::google::protobuf::Descriptor* CreateTableRequest::descriptor() {
   protobuf_mspb_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_mspb_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
 }
 
-const CreateDatabaseRequest& CreateDatabaseRequest::default_instance() {
+const CreateTableRequest& CreateTableRequest::default_instance() {
   protobuf_mspb_2eproto::InitDefaults();
   return *internal_default_instance();
 }
 
-CreateDatabaseRequest* CreateDatabaseRequest::New(::google::protobuf::Arena* arena) const {
-  CreateDatabaseRequest* n = new CreateDatabaseRequest;
+CreateTableRequest* CreateTableRequest::New(::google::protobuf::Arena* arena) const {
+  CreateTableRequest* n = new CreateTableRequest;
   if (arena != NULL) {
     arena->Own(n);
   }
   return n;
 }
 
-void CreateDatabaseRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:mspb.CreateDatabaseRequest)
+void CreateTableRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:mspb.CreateTableRequest)
   ::google::protobuf::uint32 cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   db_name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  table_name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  properties_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   if (GetArenaNoVirtual() == NULL && header_ != NULL) {
     delete header_;
   }
@@ -17991,11 +20885,11 @@ void CreateDatabaseRequest::Clear() {
   _internal_metadata_.Clear();
 }
 
-bool CreateDatabaseRequest::MergePartialFromCodedStream(
+bool CreateTableRequest::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:mspb.CreateDatabaseRequest)
+  // @@protoc_insertion_point(parse_start:mspb.CreateTableRequest)
   for (;;) {
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
     tag = p.first;
@@ -18013,16 +20907,48 @@ bool CreateDatabaseRequest::MergePartialFromCodedStream(
         break;
       }
 
-      // string db_name = 2;
-      case 2: {
+      // string db_name = 2;
+      case 2: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(18u /* 18 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_db_name()));
+          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+            this->db_name().data(), static_cast<int>(this->db_name().length()),
+            ::google::protobuf::internal::WireFormatLite::PARSE,
+            "mspb.CreateTableRequest.db_name"));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // string table_name = 3;
+      case 3: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(26u /* 26 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_table_name()));
+          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+            this->table_name().data(), static_cast<int>(this->table_name().length()),
+            ::google::protobuf::internal::WireFormatLite::PARSE,
+            "mspb.CreateTableRequest.table_name"));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // string properties = 4;
+      case 4: {
         if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(18u /* 18 & 0xFF */)) {
+            static_cast< ::google::protobuf::uint8>(34u /* 34 & 0xFF */)) {
           DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_db_name()));
+                input, this->mutable_properties()));
           DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->db_name().data(), static_cast<int>(this->db_name().length()),
+            this->properties().data(), static_cast<int>(this->properties().length()),
             ::google::protobuf::internal::WireFormatLite::PARSE,
-            "mspb.CreateDatabaseRequest.db_name"));
+            "mspb.CreateTableRequest.properties"));
         } else {
           goto handle_unusual;
         }
@@ -18041,17 +20967,17 @@ bool CreateDatabaseRequest::MergePartialFromCodedStream(
     }
   }
 success:
-  // @@protoc_insertion_point(parse_success:mspb.CreateDatabaseRequest)
+  // @@protoc_insertion_point(parse_success:mspb.CreateTableRequest)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:mspb.CreateDatabaseRequest)
+  // @@protoc_insertion_point(parse_failure:mspb.CreateTableRequest)
   return false;
 #undef DO_
 }
 
-void CreateDatabaseRequest::SerializeWithCachedSizes(
+void CreateTableRequest::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:mspb.CreateDatabaseRequest)
+  // @@protoc_insertion_point(serialize_start:mspb.CreateTableRequest)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
@@ -18066,22 +20992,42 @@ void CreateDatabaseRequest::SerializeWithCachedSizes(
     ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
       this->db_name().data(), static_cast<int>(this->db_name().length()),
       ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "mspb.CreateDatabaseRequest.db_name");
+      "mspb.CreateTableRequest.db_name");
     ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
       2, this->db_name(), output);
   }
 
+  // string table_name = 3;
+  if (this->table_name().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+      this->table_name().data(), static_cast<int>(this->table_name().length()),
+      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+      "mspb.CreateTableRequest.table_name");
+    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
+      3, this->table_name(), output);
+  }
+
+  // string properties = 4;
+  if (this->properties().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+      this->properties().data(), static_cast<int>(this->properties().length()),
+      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+      "mspb.CreateTableRequest.properties");
+    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
+      4, this->properties(), output);
+  }
+
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
     ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
   }
-  // @@protoc_insertion_point(serialize_end:mspb.CreateDatabaseRequest)
+  // @@protoc_insertion_point(serialize_end:mspb.CreateTableRequest)
 }
 
-::google::protobuf::uint8* CreateDatabaseRequest::InternalSerializeWithCachedSizesToArray(
+::google::protobuf::uint8* CreateTableRequest::InternalSerializeWithCachedSizesToArray(
     bool deterministic, ::google::protobuf::uint8* target) const {
   (void)deterministic; // Unused
-  // @@protoc_insertion_point(serialize_to_array_start:mspb.CreateDatabaseRequest)
+  // @@protoc_insertion_point(serialize_to_array_start:mspb.CreateTableRequest)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
@@ -18097,22 +21043,44 @@ void CreateDatabaseRequest::SerializeWithCachedSizes(
     ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
       this->db_name().data(), static_cast<int>(this->db_name().length()),
       ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "mspb.CreateDatabaseRequest.db_name");
+      "mspb.CreateTableRequest.db_name");
     target =
       ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
         2, this->db_name(), target);
   }
 
+  // string table_name = 3;
+  if (this->table_name().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+      this->table_name().data(), static_cast<int>(this->table_name().length()),
+      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+      "mspb.CreateTableRequest.table_name");
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        3, this->table_name(), target);
+  }
+
+  // string properties = 4;
+  if (this->properties().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+      this->properties().data(), static_cast<int>(this->properties().length()),
+      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+      "mspb.CreateTableRequest.properties");
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        4, this->properties(), target);
+  }
+
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
     target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:mspb.CreateDatabaseRequest)
+  // @@protoc_insertion_point(serialize_to_array_end:mspb.CreateTableRequest)
   return target;
 }
 
-size_t CreateDatabaseRequest::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:mspb.CreateDatabaseRequest)
+size_t CreateTableRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mspb.CreateTableRequest)
   size_t total_size = 0;
 
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
@@ -18127,6 +21095,20 @@ size_t CreateDatabaseRequest::ByteSizeLong() const {
         this->db_name());
   }
 
+  // string table_name = 3;
+  if (this->table_name().size() > 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::StringSize(
+        this->table_name());
+  }
+
+  // string properties = 4;
+  if (this->properties().size() > 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::StringSize(
+        this->properties());
+  }
+
   // .mspb.RequestHeader header = 1;
   if (this->has_header()) {
     total_size += 1 +
@@ -18141,23 +21123,23 @@ size_t CreateDatabaseRequest::ByteSizeLong() const {
   return total_size;
 }
 
-void CreateDatabaseRequest::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:mspb.CreateDatabaseRequest)
+void CreateTableRequest::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:mspb.CreateTableRequest)
   GOOGLE_DCHECK_NE(&from, this);
-  const CreateDatabaseRequest* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const CreateDatabaseRequest>(
+  const CreateTableRequest* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const CreateTableRequest>(
           &from);
   if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:mspb.CreateDatabaseRequest)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:mspb.CreateTableRequest)
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:mspb.CreateDatabaseRequest)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:mspb.CreateTableRequest)
     MergeFrom(*source);
   }
 }
 
-void CreateDatabaseRequest::MergeFrom(const CreateDatabaseRequest& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:mspb.CreateDatabaseRequest)
+void CreateTableRequest::MergeFrom(const CreateTableRequest& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:mspb.CreateTableRequest)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   ::google::protobuf::uint32 cached_has_bits = 0;
@@ -18167,140 +21149,256 @@ void CreateDatabaseRequest::MergeFrom(const CreateDatabaseRequest& from) {
 
     db_name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.db_name_);
   }
+  if (from.table_name().size() > 0) {
+
+    table_name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.table_name_);
+  }
+  if (from.properties().size() > 0) {
+
+    properties_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.properties_);
+  }
   if (from.has_header()) {
     mutable_header()->::mspb::RequestHeader::MergeFrom(from.header());
   }
 }
 
-void CreateDatabaseRequest::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:mspb.CreateDatabaseRequest)
+void CreateTableRequest::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:mspb.CreateTableRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void CreateDatabaseRequest::CopyFrom(const CreateDatabaseRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:mspb.CreateDatabaseRequest)
+void CreateTableRequest::CopyFrom(const CreateTableRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mspb.CreateTableRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool CreateDatabaseRequest::IsInitialized() const {
+bool CreateTableRequest::IsInitialized() const {
   return true;
 }
 
-void CreateDatabaseRequest::Swap(CreateDatabaseRequest* other) {
+void CreateTableRequest::Swap(CreateTableRequest* other) {
   if (other == this) return;
   InternalSwap(other);
 }
-void CreateDatabaseRequest::InternalSwap(CreateDatabaseRequest* other) {
+void CreateTableRequest::InternalSwap(CreateTableRequest* other) {
   using std::swap;
   db_name_.Swap(&other->db_name_);
+  table_name_.Swap(&other->table_name_);
+  properties_.Swap(&other->properties_);
   swap(header_, other->header_);
   _internal_metadata_.Swap(&other->_internal_metadata_);
   swap(_cached_size_, other->_cached_size_);
 }
 
-::google::protobuf::Metadata CreateDatabaseRequest::GetMetadata() const {
+::google::protobuf::Metadata CreateTableRequest::GetMetadata() const {
   protobuf_mspb_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_mspb_2eproto::file_level_metadata[kIndexInFileMessages];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
-// CreateDatabaseRequest
+// CreateTableRequest
 
 // .mspb.RequestHeader header = 1;
-bool CreateDatabaseRequest::has_header() const {
+bool CreateTableRequest::has_header() const {
   return this != internal_default_instance() && header_ != NULL;
 }
-void CreateDatabaseRequest::clear_header() {
+void CreateTableRequest::clear_header() {
   if (GetArenaNoVirtual() == NULL && header_ != NULL) delete header_;
   header_ = NULL;
 }
-const ::mspb::RequestHeader& CreateDatabaseRequest::header() const {
+const ::mspb::RequestHeader& CreateTableRequest::header() const {
   const ::mspb::RequestHeader* p = header_;
-  // @@protoc_insertion_point(field_get:mspb.CreateDatabaseRequest.header)
+  // @@protoc_insertion_point(field_get:mspb.CreateTableRequest.header)
   return p != NULL ? *p : *reinterpret_cast<const ::mspb::RequestHeader*>(
       &::mspb::_RequestHeader_default_instance_);
 }
-::mspb::RequestHeader* CreateDatabaseRequest::mutable_header() {
+::mspb::RequestHeader* CreateTableRequest::mutable_header() {
   
   if (header_ == NULL) {
     header_ = new ::mspb::RequestHeader;
   }
-  // @@protoc_insertion_point(field_mutable:mspb.CreateDatabaseRequest.header)
+  // @@protoc_insertion_point(field_mutable:mspb.CreateTableRequest.header)
   return header_;
 }
-::mspb::RequestHeader* CreateDatabaseRequest::release_header() {
-  // @@protoc_insertion_point(field_release:mspb.CreateDatabaseRequest.header)
+::mspb::RequestHeader* CreateTableRequest::release_header() {
+  // @@protoc_insertion_point(field_release:mspb.CreateTableRequest.header)
+  
+  ::mspb::RequestHeader* temp = header_;
+  header_ = NULL;
+  return temp;
+}
+void CreateTableRequest::set_allocated_header(::mspb::RequestHeader* header) {
+  delete header_;
+  header_ = header;
+  if (header) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_set_allocated:mspb.CreateTableRequest.header)
+}
+
+// string db_name = 2;
+void CreateTableRequest::clear_db_name() {
+  db_name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+const ::std::string& CreateTableRequest::db_name() const {
+  // @@protoc_insertion_point(field_get:mspb.CreateTableRequest.db_name)
+  return db_name_.GetNoArena();
+}
+void CreateTableRequest::set_db_name(const ::std::string& value) {
+  
+  db_name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:mspb.CreateTableRequest.db_name)
+}
+#if LANG_CXX11
+void CreateTableRequest::set_db_name(::std::string&& value) {
+  
+  db_name_.SetNoArena(
+    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:mspb.CreateTableRequest.db_name)
+}
+#endif
+void CreateTableRequest::set_db_name(const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  
+  db_name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:mspb.CreateTableRequest.db_name)
+}
+void CreateTableRequest::set_db_name(const char* value, size_t size) {
+  
+  db_name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:mspb.CreateTableRequest.db_name)
+}
+::std::string* CreateTableRequest::mutable_db_name() {
+  
+  // @@protoc_insertion_point(field_mutable:mspb.CreateTableRequest.db_name)
+  return db_name_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+::std::string* CreateTableRequest::release_db_name() {
+  // @@protoc_insertion_point(field_release:mspb.CreateTableRequest.db_name)
+  
+  return db_name_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+void CreateTableRequest::set_allocated_db_name(::std::string* db_name) {
+  if (db_name != NULL) {
+    
+  } else {
+    
+  }
+  db_name_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), db_name);
+  // @@protoc_insertion_point(field_set_allocated:mspb.CreateTableRequest.db_name)
+}
+
+// string table_name = 3;
+void CreateTableRequest::clear_table_name() {
+  table_name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+const ::std::string& CreateTableRequest::table_name() const {
+  // @@protoc_insertion_point(field_get:mspb.CreateTableRequest.table_name)
+  return table_name_.GetNoArena();
+}
+void CreateTableRequest::set_table_name(const ::std::string& value) {
+  
+  table_name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:mspb.CreateTableRequest.table_name)
+}
+#if LANG_CXX11
+void CreateTableRequest::set_table_name(::std::string&& value) {
+  
+  table_name_.SetNoArena(
+    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:mspb.CreateTableRequest.table_name)
+}
+#endif
+void CreateTableRequest::set_table_name(const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  
+  table_name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:mspb.CreateTableRequest.table_name)
+}
+void CreateTableRequest::set_table_name(const char* value, size_t size) {
+  
+  table_name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:mspb.CreateTableRequest.table_name)
+}
+::std::string* CreateTableRequest::mutable_table_name() {
+  
+  // @@protoc_insertion_point(field_mutable:mspb.CreateTableRequest.table_name)
+  return table_name_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+::std::string* CreateTableRequest::release_table_name() {
+  // @@protoc_insertion_point(field_release:mspb.CreateTableRequest.table_name)
   
-  ::mspb::RequestHeader* temp = header_;
-  header_ = NULL;
-  return temp;
+  return table_name_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-void CreateDatabaseRequest::set_allocated_header(::mspb::RequestHeader* header) {
-  delete header_;
-  header_ = header;
-  if (header) {
+void CreateTableRequest::set_allocated_table_name(::std::string* table_name) {
+  if (table_name != NULL) {
     
   } else {
     
   }
-  // @@protoc_insertion_point(field_set_allocated:mspb.CreateDatabaseRequest.header)
+  table_name_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), table_name);
+  // @@protoc_insertion_point(field_set_allocated:mspb.CreateTableRequest.table_name)
 }
 
-// string db_name = 2;
-void CreateDatabaseRequest::clear_db_name() {
-  db_name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+// string properties = 4;
+void CreateTableRequest::clear_properties() {
+  properties_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-const ::std::string& CreateDatabaseRequest::db_name() const {
-  // @@protoc_insertion_point(field_get:mspb.CreateDatabaseRequest.db_name)
-  return db_name_.GetNoArena();
+const ::std::string& CreateTableRequest::properties() const {
+  // @@protoc_insertion_point(field_get:mspb.CreateTableRequest.properties)
+  return properties_.GetNoArena();
 }
-void CreateDatabaseRequest::set_db_name(const ::std::string& value) {
+void CreateTableRequest::set_properties(const ::std::string& value) {
   
-  db_name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:mspb.CreateDatabaseRequest.db_name)
+  properties_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:mspb.CreateTableRequest.properties)
 }
 #if LANG_CXX11
-void CreateDatabaseRequest::set_db_name(::std::string&& value) {
+void CreateTableRequest::set_properties(::std::string&& value) {
   
-  db_name_.SetNoArena(
+  properties_.SetNoArena(
     &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:mspb.CreateDatabaseRequest.db_name)
+  // @@protoc_insertion_point(field_set_rvalue:mspb.CreateTableRequest.properties)
 }
 #endif
-void CreateDatabaseRequest::set_db_name(const char* value) {
+void CreateTableRequest::set_properties(const char* value) {
   GOOGLE_DCHECK(value != NULL);
   
-  db_name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:mspb.CreateDatabaseRequest.db_name)
+  properties_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:mspb.CreateTableRequest.properties)
 }
-void CreateDatabaseRequest::set_db_name(const char* value, size_t size) {
+void CreateTableRequest::set_properties(const char* value, size_t size) {
   
-  db_name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+  properties_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
       ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:mspb.CreateDatabaseRequest.db_name)
+  // @@protoc_insertion_point(field_set_pointer:mspb.CreateTableRequest.properties)
 }
-::std::string* CreateDatabaseRequest::mutable_db_name() {
+::std::string* CreateTableRequest::mutable_properties() {
   
-  // @@protoc_insertion_point(field_mutable:mspb.CreateDatabaseRequest.db_name)
-  return db_name_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  // @@protoc_insertion_point(field_mutable:mspb.CreateTableRequest.properties)
+  return properties_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-::std::string* CreateDatabaseRequest::release_db_name() {
-  // @@protoc_insertion_point(field_release:mspb.CreateDatabaseRequest.db_name)
+::std::string* CreateTableRequest::release_properties() {
+  // @@protoc_insertion_point(field_release:mspb.CreateTableRequest.properties)
   
-  return db_name_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return properties_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-void CreateDatabaseRequest::set_allocated_db_name(::std::string* db_name) {
-  if (db_name != NULL) {
+void CreateTableRequest::set_allocated_properties(::std::string* properties) {
+  if (properties != NULL) {
     
   } else {
     
   }
-  db_name_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), db_name);
-  // @@protoc_insertion_point(field_set_allocated:mspb.CreateDatabaseRequest.db_name)
+  properties_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), properties);
+  // @@protoc_insertion_point(field_set_allocated:mspb.CreateTableRequest.properties)
 }
 
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -18308,18 +21406,18 @@ void CreateDatabaseRequest::set_allocated_db_name(::std::string* db_name) {
 // ===================================================================
 
 #if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int CreateDatabaseResponse::kHeaderFieldNumber;
+const int CreateTableResponse::kHeaderFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
-CreateDatabaseResponse::CreateDatabaseResponse()
+CreateTableResponse::CreateTableResponse()
   : ::google::protobuf::Message(), _internal_metadata_(NULL) {
   if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
     protobuf_mspb_2eproto::InitDefaults();
   }
   SharedCtor();
-  // @@protoc_insertion_point(constructor:mspb.CreateDatabaseResponse)
+  // @@protoc_insertion_point(constructor:mspb.CreateTableResponse)
 }
-CreateDatabaseResponse::CreateDatabaseResponse(const CreateDatabaseResponse& from)
+CreateTableResponse::CreateTableResponse(const CreateTableResponse& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
       _cached_size_(0) {
@@ -18329,48 +21427,48 @@ CreateDatabaseResponse::CreateDatabaseResponse(const CreateDatabaseResponse& fro
   } else {
     header_ = NULL;
   }
-  // @@protoc_insertion_point(copy_constructor:mspb.CreateDatabaseResponse)
+  // @@protoc_insertion_point(copy_constructor:mspb.CreateTableResponse)
 }
 
-void CreateDatabaseResponse::SharedCtor() {
+void CreateTableResponse::SharedCtor() {
   header_ = NULL;
   _cached_size_ = 0;
 }
 
-CreateDatabaseResponse::~CreateDatabaseResponse() {
-  // @@protoc_insertion_point(destructor:mspb.CreateDatabaseResponse)
+CreateTableResponse::~CreateTableResponse() {
+  // @@protoc_insertion_point(destructor:mspb.CreateTableResponse)
   SharedDtor();
 }
 
-void CreateDatabaseResponse::SharedDtor() {
+void CreateTableResponse::SharedDtor() {
   if (this != internal_default_instance()) delete header_;
 }
 
-void CreateDatabaseResponse::SetCachedSize(int size) const {
+void CreateTableResponse::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* CreateDatabaseResponse::descriptor() {
+const ::google::protobuf::Descriptor* CreateTableResponse::descriptor() {
   protobuf_mspb_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_mspb_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
 }
 
-const CreateDatabaseResponse& CreateDatabaseResponse::default_instance() {
+const CreateTableResponse& CreateTableResponse::default_instance() {
   protobuf_mspb_2eproto::InitDefaults();
   return *internal_default_instance();
 }
 
-CreateDatabaseResponse* CreateDatabaseResponse::New(::google::protobuf::Arena* arena) const {
-  CreateDatabaseResponse* n = new CreateDatabaseResponse;
+CreateTableResponse* CreateTableResponse::New(::google::protobuf::Arena* arena) const {
+  CreateTableResponse* n = new CreateTableResponse;
   if (arena != NULL) {
     arena->Own(n);
   }
   return n;
 }
 
-void CreateDatabaseResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:mspb.CreateDatabaseResponse)
+void CreateTableResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:mspb.CreateTableResponse)
   ::google::protobuf::uint32 cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
@@ -18382,11 +21480,11 @@ void CreateDatabaseResponse::Clear() {
   _internal_metadata_.Clear();
 }
 
-bool CreateDatabaseResponse::MergePartialFromCodedStream(
+bool CreateTableResponse::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:mspb.CreateDatabaseResponse)
+  // @@protoc_insertion_point(parse_start:mspb.CreateTableResponse)
   for (;;) {
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
     tag = p.first;
@@ -18416,17 +21514,17 @@ bool CreateDatabaseResponse::MergePartialFromCodedStream(
     }
   }
 success:
-  // @@protoc_insertion_point(parse_success:mspb.CreateDatabaseResponse)
+  // @@protoc_insertion_point(parse_success:mspb.CreateTableResponse)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:mspb.CreateDatabaseResponse)
+  // @@protoc_insertion_point(parse_failure:mspb.CreateTableResponse)
   return false;
 #undef DO_
 }
 
-void CreateDatabaseResponse::SerializeWithCachedSizes(
+void CreateTableResponse::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:mspb.CreateDatabaseResponse)
+  // @@protoc_insertion_point(serialize_start:mspb.CreateTableResponse)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
@@ -18440,13 +21538,13 @@ void CreateDatabaseResponse::SerializeWithCachedSizes(
     ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
   }
-  // @@protoc_insertion_point(serialize_end:mspb.CreateDatabaseResponse)
+  // @@protoc_insertion_point(serialize_end:mspb.CreateTableResponse)
 }
 
-::google::protobuf::uint8* CreateDatabaseResponse::InternalSerializeWithCachedSizesToArray(
+::google::protobuf::uint8* CreateTableResponse::InternalSerializeWithCachedSizesToArray(
     bool deterministic, ::google::protobuf::uint8* target) const {
   (void)deterministic; // Unused
-  // @@protoc_insertion_point(serialize_to_array_start:mspb.CreateDatabaseResponse)
+  // @@protoc_insertion_point(serialize_to_array_start:mspb.CreateTableResponse)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
@@ -18461,12 +21559,12 @@ void CreateDatabaseResponse::SerializeWithCachedSizes(
     target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:mspb.CreateDatabaseResponse)
+  // @@protoc_insertion_point(serialize_to_array_end:mspb.CreateTableResponse)
   return target;
 }
 
-size_t CreateDatabaseResponse::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:mspb.CreateDatabaseResponse)
+size_t CreateTableResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mspb.CreateTableResponse)
   size_t total_size = 0;
 
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
@@ -18488,23 +21586,23 @@ size_t CreateDatabaseResponse::ByteSizeLong() const {
   return total_size;
 }
 
-void CreateDatabaseResponse::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:mspb.CreateDatabaseResponse)
+void CreateTableResponse::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:mspb.CreateTableResponse)
   GOOGLE_DCHECK_NE(&from, this);
-  const CreateDatabaseResponse* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const CreateDatabaseResponse>(
+  const CreateTableResponse* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const CreateTableResponse>(
           &from);
   if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:mspb.CreateDatabaseResponse)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:mspb.CreateTableResponse)
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:mspb.CreateDatabaseResponse)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:mspb.CreateTableResponse)
     MergeFrom(*source);
   }
 }
 
-void CreateDatabaseResponse::MergeFrom(const CreateDatabaseResponse& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:mspb.CreateDatabaseResponse)
+void CreateTableResponse::MergeFrom(const CreateTableResponse& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:mspb.CreateTableResponse)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   ::google::protobuf::uint32 cached_has_bits = 0;
@@ -18515,73 +21613,73 @@ void CreateDatabaseResponse::MergeFrom(const CreateDatabaseResponse& from) {
   }
 }
 
-void CreateDatabaseResponse::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:mspb.CreateDatabaseResponse)
+void CreateTableResponse::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:mspb.CreateTableResponse)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void CreateDatabaseResponse::CopyFrom(const CreateDatabaseResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:mspb.CreateDatabaseResponse)
+void CreateTableResponse::CopyFrom(const CreateTableResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mspb.CreateTableResponse)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool CreateDatabaseResponse::IsInitialized() const {
+bool CreateTableResponse::IsInitialized() const {
   return true;
 }
 
-void CreateDatabaseResponse::Swap(CreateDatabaseResponse* other) {
+void CreateTableResponse::Swap(CreateTableResponse* other) {
   if (other == this) return;
   InternalSwap(other);
 }
-void CreateDatabaseResponse::InternalSwap(CreateDatabaseResponse* other) {
+void CreateTableResponse::InternalSwap(CreateTableResponse* other) {
   using std::swap;
   swap(header_, other->header_);
   _internal_metadata_.Swap(&other->_internal_metadata_);
   swap(_cached_size_, other->_cached_size_);
 }
 
-::google::protobuf::Metadata CreateDatabaseResponse::GetMetadata() const {
+::google::protobuf::Metadata CreateTableResponse::GetMetadata() const {
   protobuf_mspb_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_mspb_2eproto::file_level_metadata[kIndexInFileMessages];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
-// CreateDatabaseResponse
+// CreateTableResponse
 
 // .mspb.ResponseHeader header = 1;
-bool CreateDatabaseResponse::has_header() const {
+bool CreateTableResponse::has_header() const {
   return this != internal_default_instance() && header_ != NULL;
 }
-void CreateDatabaseResponse::clear_header() {
+void CreateTableResponse::clear_header() {
   if (GetArenaNoVirtual() == NULL && header_ != NULL) delete header_;
   header_ = NULL;
 }
-const ::mspb::ResponseHeader& CreateDatabaseResponse::header() const {
+const ::mspb::ResponseHeader& CreateTableResponse::header() const {
   const ::mspb::ResponseHeader* p = header_;
-  // @@protoc_insertion_point(field_get:mspb.CreateDatabaseResponse.header)
+  // @@protoc_insertion_point(field_get:mspb.CreateTableResponse.header)
   return p != NULL ? *p : *reinterpret_cast<const ::mspb::ResponseHeader*>(
       &::mspb::_ResponseHeader_default_instance_);
 }
-::mspb::ResponseHeader* CreateDatabaseResponse::mutable_header() {
+::mspb::ResponseHeader* CreateTableResponse::mutable_header() {
   
   if (header_ == NULL) {
     header_ = new ::mspb::ResponseHeader;
   }
-  // @@protoc_insertion_point(field_mutable:mspb.CreateDatabaseResponse.header)
+  // @@protoc_insertion_point(field_mutable:mspb.CreateTableResponse.header)
   return header_;
 }
-::mspb::ResponseHeader* CreateDatabaseResponse::release_header() {
-  // @@protoc_insertion_point(field_release:mspb.CreateDatabaseResponse.header)
+::mspb::ResponseHeader* CreateTableResponse::release_header() {
+  // @@protoc_insertion_point(field_release:mspb.CreateTableResponse.header)
   
   ::mspb::ResponseHeader* temp = header_;
   header_ = NULL;
   return temp;
 }
-void CreateDatabaseResponse::set_allocated_header(::mspb::ResponseHeader* header) {
+void CreateTableResponse::set_allocated_header(::mspb::ResponseHeader* header) {
   delete header_;
   header_ = header;
   if (header) {
@@ -18589,7 +21687,7 @@ void CreateDatabaseResponse::set_allocated_header(::mspb::ResponseHeader* header
   } else {
     
   }
-  // @@protoc_insertion_point(field_set_allocated:mspb.CreateDatabaseResponse.header)
+  // @@protoc_insertion_point(field_set_allocated:mspb.CreateTableResponse.header)
 }
 
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -18597,109 +21695,96 @@ void CreateDatabaseResponse::set_allocated_header(::mspb::ResponseHeader* header
 // ===================================================================
 
 #if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int CreateTableRequest::kHeaderFieldNumber;
-const int CreateTableRequest::kDbNameFieldNumber;
-const int CreateTableRequest::kTableNameFieldNumber;
-const int CreateTableRequest::kPropertiesFieldNumber;
+const int GetAutoIncIdRequest::kHeaderFieldNumber;
+const int GetAutoIncIdRequest::kDbIdFieldNumber;
+const int GetAutoIncIdRequest::kTableIdFieldNumber;
+const int GetAutoIncIdRequest::kSizeFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
-CreateTableRequest::CreateTableRequest()
+GetAutoIncIdRequest::GetAutoIncIdRequest()
   : ::google::protobuf::Message(), _internal_metadata_(NULL) {
   if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
     protobuf_mspb_2eproto::InitDefaults();
   }
   SharedCtor();
-  // @@protoc_insertion_point(constructor:mspb.CreateTableRequest)
+  // @@protoc_insertion_point(constructor:mspb.GetAutoIncIdRequest)
 }
-CreateTableRequest::CreateTableRequest(const CreateTableRequest& from)
+GetAutoIncIdRequest::GetAutoIncIdRequest(const GetAutoIncIdRequest& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
       _cached_size_(0) {
   _internal_metadata_.MergeFrom(from._internal_metadata_);
-  db_name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.db_name().size() > 0) {
-    db_name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.db_name_);
-  }
-  table_name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.table_name().size() > 0) {
-    table_name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.table_name_);
-  }
-  properties_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.properties().size() > 0) {
-    properties_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.properties_);
-  }
   if (from.has_header()) {
     header_ = new ::mspb::RequestHeader(*from.header_);
   } else {
     header_ = NULL;
   }
-  // @@protoc_insertion_point(copy_constructor:mspb.CreateTableRequest)
+  ::memcpy(&db_id_, &from.db_id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&size_) -
+    reinterpret_cast<char*>(&db_id_)) + sizeof(size_));
+  // @@protoc_insertion_point(copy_constructor:mspb.GetAutoIncIdRequest)
 }
 
-void CreateTableRequest::SharedCtor() {
-  db_name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  table_name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  properties_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  header_ = NULL;
+void GetAutoIncIdRequest::SharedCtor() {
+  ::memset(&header_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&size_) -
+      reinterpret_cast<char*>(&header_)) + sizeof(size_));
   _cached_size_ = 0;
 }
 
-CreateTableRequest::~CreateTableRequest() {
-  // @@protoc_insertion_point(destructor:mspb.CreateTableRequest)
+GetAutoIncIdRequest::~GetAutoIncIdRequest() {
+  // @@protoc_insertion_point(destructor:mspb.GetAutoIncIdRequest)
   SharedDtor();
 }
 
-void CreateTableRequest::SharedDtor() {
-  db_name_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  table_name_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  properties_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+void GetAutoIncIdRequest::SharedDtor() {
   if (this != internal_default_instance()) delete header_;
 }
 
-void CreateTableRequest::SetCachedSize(int size) const {
+void GetAutoIncIdRequest::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* CreateTableRequest::descriptor() {
+const ::google::protobuf::Descriptor* GetAutoIncIdRequest::descriptor() {
   protobuf_mspb_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_mspb_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
 }
 
-const CreateTableRequest& CreateTableRequest::default_instance() {
+const GetAutoIncIdRequest& GetAutoIncIdRequest::default_instance() {
   protobuf_mspb_2eproto::InitDefaults();
   return *internal_default_instance();
 }
 
-CreateTableRequest* CreateTableRequest::New(::google::protobuf::Arena* arena) const {
-  CreateTableRequest* n = new CreateTableRequest;
+GetAutoIncIdRequest* GetAutoIncIdRequest::New(::google::protobuf::Arena* arena) const {
+  GetAutoIncIdRequest* n = new GetAutoIncIdRequest;
   if (arena != NULL) {
     arena->Own(n);
   }
   return n;
 }
 
-void CreateTableRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:mspb.CreateTableRequest)
+void GetAutoIncIdRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:mspb.GetAutoIncIdRequest)
   ::google::protobuf::uint32 cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  db_name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  table_name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  properties_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   if (GetArenaNoVirtual() == NULL && header_ != NULL) {
     delete header_;
   }
   header_ = NULL;
+  ::memset(&db_id_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&size_) -
+      reinterpret_cast<char*>(&db_id_)) + sizeof(size_));
   _internal_metadata_.Clear();
 }
 
-bool CreateTableRequest::MergePartialFromCodedStream(
+bool GetAutoIncIdRequest::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:mspb.CreateTableRequest)
+  // @@protoc_insertion_point(parse_start:mspb.GetAutoIncIdRequest)
   for (;;) {
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
     tag = p.first;
@@ -18717,48 +21802,42 @@ bool CreateTableRequest::MergePartialFromCodedStream(
         break;
       }
 
-      // string db_name = 2;
+      // uint64 db_id = 2;
       case 2: {
         if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(18u /* 18 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_db_name()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->db_name().data(), static_cast<int>(this->db_name().length()),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "mspb.CreateTableRequest.db_name"));
+            static_cast< ::google::protobuf::uint8>(16u /* 16 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &db_id_)));
         } else {
           goto handle_unusual;
         }
         break;
       }
 
-      // string table_name = 3;
+      // uint64 table_id = 3;
       case 3: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(26u /* 26 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_table_name()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->table_name().data(), static_cast<int>(this->table_name().length()),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "mspb.CreateTableRequest.table_name"));
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(24u /* 24 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &table_id_)));
         } else {
           goto handle_unusual;
         }
         break;
       }
 
-      // string properties = 4;
+      // uint32 size = 4;
       case 4: {
         if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(34u /* 34 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_properties()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->properties().data(), static_cast<int>(this->properties().length()),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "mspb.CreateTableRequest.properties"));
+            static_cast< ::google::protobuf::uint8>(32u /* 32 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &size_)));
         } else {
           goto handle_unusual;
         }
@@ -18777,17 +21856,17 @@ bool CreateTableRequest::MergePartialFromCodedStream(
     }
   }
 success:
-  // @@protoc_insertion_point(parse_success:mspb.CreateTableRequest)
+  // @@protoc_insertion_point(parse_success:mspb.GetAutoIncIdRequest)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:mspb.CreateTableRequest)
+  // @@protoc_insertion_point(parse_failure:mspb.GetAutoIncIdRequest)
   return false;
 #undef DO_
 }
 
-void CreateTableRequest::SerializeWithCachedSizes(
+void GetAutoIncIdRequest::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:mspb.CreateTableRequest)
+  // @@protoc_insertion_point(serialize_start:mspb.GetAutoIncIdRequest)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
@@ -18797,47 +21876,32 @@ void CreateTableRequest::SerializeWithCachedSizes(
       1, *this->header_, output);
   }
 
-  // string db_name = 2;
-  if (this->db_name().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->db_name().data(), static_cast<int>(this->db_name().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "mspb.CreateTableRequest.db_name");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      2, this->db_name(), output);
+  // uint64 db_id = 2;
+  if (this->db_id() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(2, this->db_id(), output);
   }
 
-  // string table_name = 3;
-  if (this->table_name().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->table_name().data(), static_cast<int>(this->table_name().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "mspb.CreateTableRequest.table_name");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      3, this->table_name(), output);
+  // uint64 table_id = 3;
+  if (this->table_id() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(3, this->table_id(), output);
   }
 
-  // string properties = 4;
-  if (this->properties().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->properties().data(), static_cast<int>(this->properties().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "mspb.CreateTableRequest.properties");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      4, this->properties(), output);
+  // uint32 size = 4;
+  if (this->size() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(4, this->size(), output);
   }
 
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
     ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
   }
-  // @@protoc_insertion_point(serialize_end:mspb.CreateTableRequest)
+  // @@protoc_insertion_point(serialize_end:mspb.GetAutoIncIdRequest)
 }
 
-::google::protobuf::uint8* CreateTableRequest::InternalSerializeWithCachedSizesToArray(
+::google::protobuf::uint8* GetAutoIncIdRequest::InternalSerializeWithCachedSizesToArray(
     bool deterministic, ::google::protobuf::uint8* target) const {
   (void)deterministic; // Unused
-  // @@protoc_insertion_point(serialize_to_array_start:mspb.CreateTableRequest)
+  // @@protoc_insertion_point(serialize_to_array_start:mspb.GetAutoIncIdRequest)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
@@ -18848,49 +21912,31 @@ void CreateTableRequest::SerializeWithCachedSizes(
         1, *this->header_, deterministic, target);
   }
 
-  // string db_name = 2;
-  if (this->db_name().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->db_name().data(), static_cast<int>(this->db_name().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "mspb.CreateTableRequest.db_name");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        2, this->db_name(), target);
+  // uint64 db_id = 2;
+  if (this->db_id() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(2, this->db_id(), target);
   }
 
-  // string table_name = 3;
-  if (this->table_name().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->table_name().data(), static_cast<int>(this->table_name().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "mspb.CreateTableRequest.table_name");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        3, this->table_name(), target);
+  // uint64 table_id = 3;
+  if (this->table_id() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(3, this->table_id(), target);
   }
 
-  // string properties = 4;
-  if (this->properties().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->properties().data(), static_cast<int>(this->properties().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "mspb.CreateTableRequest.properties");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        4, this->properties(), target);
+  // uint32 size = 4;
+  if (this->size() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(4, this->size(), target);
   }
 
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
     target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:mspb.CreateTableRequest)
+  // @@protoc_insertion_point(serialize_to_array_end:mspb.GetAutoIncIdRequest)
   return target;
 }
 
-size_t CreateTableRequest::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:mspb.CreateTableRequest)
+size_t GetAutoIncIdRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mspb.GetAutoIncIdRequest)
   size_t total_size = 0;
 
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
@@ -18898,32 +21944,32 @@ size_t CreateTableRequest::ByteSizeLong() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
   }
-  // string db_name = 2;
-  if (this->db_name().size() > 0) {
+  // .mspb.RequestHeader header = 1;
+  if (this->has_header()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->db_name());
+      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+        *this->header_);
   }
 
-  // string table_name = 3;
-  if (this->table_name().size() > 0) {
+  // uint64 db_id = 2;
+  if (this->db_id() != 0) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->table_name());
+      ::google::protobuf::internal::WireFormatLite::UInt64Size(
+        this->db_id());
   }
 
-  // string properties = 4;
-  if (this->properties().size() > 0) {
+  // uint64 table_id = 3;
+  if (this->table_id() != 0) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->properties());
+      ::google::protobuf::internal::WireFormatLite::UInt64Size(
+        this->table_id());
   }
 
-  // .mspb.RequestHeader header = 1;
-  if (this->has_header()) {
+  // uint32 size = 4;
+  if (this->size() != 0) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-        *this->header_);
+      ::google::protobuf::internal::WireFormatLite::UInt32Size(
+        this->size());
   }
 
   int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
@@ -18933,282 +21979,162 @@ size_t CreateTableRequest::ByteSizeLong() const {
   return total_size;
 }
 
-void CreateTableRequest::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:mspb.CreateTableRequest)
+void GetAutoIncIdRequest::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:mspb.GetAutoIncIdRequest)
   GOOGLE_DCHECK_NE(&from, this);
-  const CreateTableRequest* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const CreateTableRequest>(
+  const GetAutoIncIdRequest* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const GetAutoIncIdRequest>(
           &from);
   if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:mspb.CreateTableRequest)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:mspb.GetAutoIncIdRequest)
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:mspb.CreateTableRequest)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:mspb.GetAutoIncIdRequest)
     MergeFrom(*source);
   }
 }
 
-void CreateTableRequest::MergeFrom(const CreateTableRequest& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:mspb.CreateTableRequest)
+void GetAutoIncIdRequest::MergeFrom(const GetAutoIncIdRequest& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:mspb.GetAutoIncIdRequest)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.db_name().size() > 0) {
-
-    db_name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.db_name_);
-  }
-  if (from.table_name().size() > 0) {
-
-    table_name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.table_name_);
-  }
-  if (from.properties().size() > 0) {
-
-    properties_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.properties_);
-  }
   if (from.has_header()) {
     mutable_header()->::mspb::RequestHeader::MergeFrom(from.header());
   }
-}
-
-void CreateTableRequest::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:mspb.CreateTableRequest)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-void CreateTableRequest::CopyFrom(const CreateTableRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:mspb.CreateTableRequest)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-bool CreateTableRequest::IsInitialized() const {
-  return true;
-}
-
-void CreateTableRequest::Swap(CreateTableRequest* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
-void CreateTableRequest::InternalSwap(CreateTableRequest* other) {
-  using std::swap;
-  db_name_.Swap(&other->db_name_);
-  table_name_.Swap(&other->table_name_);
-  properties_.Swap(&other->properties_);
-  swap(header_, other->header_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  swap(_cached_size_, other->_cached_size_);
-}
-
-::google::protobuf::Metadata CreateTableRequest::GetMetadata() const {
-  protobuf_mspb_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_mspb_2eproto::file_level_metadata[kIndexInFileMessages];
-}
-
-#if PROTOBUF_INLINE_NOT_IN_HEADERS
-// CreateTableRequest
-
-// .mspb.RequestHeader header = 1;
-bool CreateTableRequest::has_header() const {
-  return this != internal_default_instance() && header_ != NULL;
-}
-void CreateTableRequest::clear_header() {
-  if (GetArenaNoVirtual() == NULL && header_ != NULL) delete header_;
-  header_ = NULL;
-}
-const ::mspb::RequestHeader& CreateTableRequest::header() const {
-  const ::mspb::RequestHeader* p = header_;
-  // @@protoc_insertion_point(field_get:mspb.CreateTableRequest.header)
-  return p != NULL ? *p : *reinterpret_cast<const ::mspb::RequestHeader*>(
-      &::mspb::_RequestHeader_default_instance_);
-}
-::mspb::RequestHeader* CreateTableRequest::mutable_header() {
-  
-  if (header_ == NULL) {
-    header_ = new ::mspb::RequestHeader;
-  }
-  // @@protoc_insertion_point(field_mutable:mspb.CreateTableRequest.header)
-  return header_;
-}
-::mspb::RequestHeader* CreateTableRequest::release_header() {
-  // @@protoc_insertion_point(field_release:mspb.CreateTableRequest.header)
-  
-  ::mspb::RequestHeader* temp = header_;
-  header_ = NULL;
-  return temp;
-}
-void CreateTableRequest::set_allocated_header(::mspb::RequestHeader* header) {
-  delete header_;
-  header_ = header;
-  if (header) {
-    
-  } else {
-    
+  if (from.db_id() != 0) {
+    set_db_id(from.db_id());
+  }
+  if (from.table_id() != 0) {
+    set_table_id(from.table_id());
+  }
+  if (from.size() != 0) {
+    set_size(from.size());
   }
-  // @@protoc_insertion_point(field_set_allocated:mspb.CreateTableRequest.header)
-}
-
-// string db_name = 2;
-void CreateTableRequest::clear_db_name() {
-  db_name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-const ::std::string& CreateTableRequest::db_name() const {
-  // @@protoc_insertion_point(field_get:mspb.CreateTableRequest.db_name)
-  return db_name_.GetNoArena();
-}
-void CreateTableRequest::set_db_name(const ::std::string& value) {
-  
-  db_name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:mspb.CreateTableRequest.db_name)
-}
-#if LANG_CXX11
-void CreateTableRequest::set_db_name(::std::string&& value) {
-  
-  db_name_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:mspb.CreateTableRequest.db_name)
-}
-#endif
-void CreateTableRequest::set_db_name(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  db_name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:mspb.CreateTableRequest.db_name)
-}
-void CreateTableRequest::set_db_name(const char* value, size_t size) {
-  
-  db_name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:mspb.CreateTableRequest.db_name)
 }
-::std::string* CreateTableRequest::mutable_db_name() {
-  
-  // @@protoc_insertion_point(field_mutable:mspb.CreateTableRequest.db_name)
-  return db_name_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+
+void GetAutoIncIdRequest::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:mspb.GetAutoIncIdRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
 }
-::std::string* CreateTableRequest::release_db_name() {
-  // @@protoc_insertion_point(field_release:mspb.CreateTableRequest.db_name)
-  
-  return db_name_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+
+void GetAutoIncIdRequest::CopyFrom(const GetAutoIncIdRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mspb.GetAutoIncIdRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
 }
-void CreateTableRequest::set_allocated_db_name(::std::string* db_name) {
-  if (db_name != NULL) {
-    
-  } else {
-    
-  }
-  db_name_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), db_name);
-  // @@protoc_insertion_point(field_set_allocated:mspb.CreateTableRequest.db_name)
+
+bool GetAutoIncIdRequest::IsInitialized() const {
+  return true;
 }
 
-// string table_name = 3;
-void CreateTableRequest::clear_table_name() {
-  table_name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+void GetAutoIncIdRequest::Swap(GetAutoIncIdRequest* other) {
+  if (other == this) return;
+  InternalSwap(other);
 }
-const ::std::string& CreateTableRequest::table_name() const {
-  // @@protoc_insertion_point(field_get:mspb.CreateTableRequest.table_name)
-  return table_name_.GetNoArena();
+void GetAutoIncIdRequest::InternalSwap(GetAutoIncIdRequest* other) {
+  using std::swap;
+  swap(header_, other->header_);
+  swap(db_id_, other->db_id_);
+  swap(table_id_, other->table_id_);
+  swap(size_, other->size_);
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  swap(_cached_size_, other->_cached_size_);
 }
-void CreateTableRequest::set_table_name(const ::std::string& value) {
-  
-  table_name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:mspb.CreateTableRequest.table_name)
+
+::google::protobuf::Metadata GetAutoIncIdRequest::GetMetadata() const {
+  protobuf_mspb_2eproto::protobuf_AssignDescriptorsOnce();
+  return protobuf_mspb_2eproto::file_level_metadata[kIndexInFileMessages];
 }
-#if LANG_CXX11
-void CreateTableRequest::set_table_name(::std::string&& value) {
-  
-  table_name_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:mspb.CreateTableRequest.table_name)
+
+#if PROTOBUF_INLINE_NOT_IN_HEADERS
+// GetAutoIncIdRequest
+
+// .mspb.RequestHeader header = 1;
+bool GetAutoIncIdRequest::has_header() const {
+  return this != internal_default_instance() && header_ != NULL;
 }
-#endif
-void CreateTableRequest::set_table_name(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  table_name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:mspb.CreateTableRequest.table_name)
+void GetAutoIncIdRequest::clear_header() {
+  if (GetArenaNoVirtual() == NULL && header_ != NULL) delete header_;
+  header_ = NULL;
 }
-void CreateTableRequest::set_table_name(const char* value, size_t size) {
-  
-  table_name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:mspb.CreateTableRequest.table_name)
+const ::mspb::RequestHeader& GetAutoIncIdRequest::header() const {
+  const ::mspb::RequestHeader* p = header_;
+  // @@protoc_insertion_point(field_get:mspb.GetAutoIncIdRequest.header)
+  return p != NULL ? *p : *reinterpret_cast<const ::mspb::RequestHeader*>(
+      &::mspb::_RequestHeader_default_instance_);
 }
-::std::string* CreateTableRequest::mutable_table_name() {
+::mspb::RequestHeader* GetAutoIncIdRequest::mutable_header() {
   
-  // @@protoc_insertion_point(field_mutable:mspb.CreateTableRequest.table_name)
-  return table_name_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (header_ == NULL) {
+    header_ = new ::mspb::RequestHeader;
+  }
+  // @@protoc_insertion_point(field_mutable:mspb.GetAutoIncIdRequest.header)
+  return header_;
 }
-::std::string* CreateTableRequest::release_table_name() {
-  // @@protoc_insertion_point(field_release:mspb.CreateTableRequest.table_name)
+::mspb::RequestHeader* GetAutoIncIdRequest::release_header() {
+  // @@protoc_insertion_point(field_release:mspb.GetAutoIncIdRequest.header)
   
-  return table_name_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::mspb::RequestHeader* temp = header_;
+  header_ = NULL;
+  return temp;
 }
-void CreateTableRequest::set_allocated_table_name(::std::string* table_name) {
-  if (table_name != NULL) {
+void GetAutoIncIdRequest::set_allocated_header(::mspb::RequestHeader* header) {
+  delete header_;
+  header_ = header;
+  if (header) {
     
   } else {
     
   }
-  table_name_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), table_name);
-  // @@protoc_insertion_point(field_set_allocated:mspb.CreateTableRequest.table_name)
+  // @@protoc_insertion_point(field_set_allocated:mspb.GetAutoIncIdRequest.header)
 }
 
-// string properties = 4;
-void CreateTableRequest::clear_properties() {
-  properties_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+// uint64 db_id = 2;
+void GetAutoIncIdRequest::clear_db_id() {
+  db_id_ = GOOGLE_ULONGLONG(0);
 }
-const ::std::string& CreateTableRequest::properties() const {
-  // @@protoc_insertion_point(field_get:mspb.CreateTableRequest.properties)
-  return properties_.GetNoArena();
+::google::protobuf::uint64 GetAutoIncIdRequest::db_id() const {
+  // @@protoc_insertion_point(field_get:mspb.GetAutoIncIdRequest.db_id)
+  return db_id_;
 }
-void CreateTableRequest::set_properties(const ::std::string& value) {
+void GetAutoIncIdRequest::set_db_id(::google::protobuf::uint64 value) {
   
-  properties_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:mspb.CreateTableRequest.properties)
+  db_id_ = value;
+  // @@protoc_insertion_point(field_set:mspb.GetAutoIncIdRequest.db_id)
 }
-#if LANG_CXX11
-void CreateTableRequest::set_properties(::std::string&& value) {
-  
-  properties_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:mspb.CreateTableRequest.properties)
+
+// uint64 table_id = 3;
+void GetAutoIncIdRequest::clear_table_id() {
+  table_id_ = GOOGLE_ULONGLONG(0);
 }
-#endif
-void CreateTableRequest::set_properties(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  properties_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:mspb.CreateTableRequest.properties)
+::google::protobuf::uint64 GetAutoIncIdRequest::table_id() const {
+  // @@protoc_insertion_point(field_get:mspb.GetAutoIncIdRequest.table_id)
+  return table_id_;
 }
-void CreateTableRequest::set_properties(const char* value, size_t size) {
+void GetAutoIncIdRequest::set_table_id(::google::protobuf::uint64 value) {
   
-  properties_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:mspb.CreateTableRequest.properties)
+  table_id_ = value;
+  // @@protoc_insertion_point(field_set:mspb.GetAutoIncIdRequest.table_id)
 }
-::std::string* CreateTableRequest::mutable_properties() {
-  
-  // @@protoc_insertion_point(field_mutable:mspb.CreateTableRequest.properties)
-  return properties_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+
+// uint32 size = 4;
+void GetAutoIncIdRequest::clear_size() {
+  size_ = 0u;
 }
-::std::string* CreateTableRequest::release_properties() {
-  // @@protoc_insertion_point(field_release:mspb.CreateTableRequest.properties)
-  
-  return properties_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+::google::protobuf::uint32 GetAutoIncIdRequest::size() const {
+  // @@protoc_insertion_point(field_get:mspb.GetAutoIncIdRequest.size)
+  return size_;
 }
-void CreateTableRequest::set_allocated_properties(::std::string* properties) {
-  if (properties != NULL) {
-    
-  } else {
-    
-  }
-  properties_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), properties);
-  // @@protoc_insertion_point(field_set_allocated:mspb.CreateTableRequest.properties)
+void GetAutoIncIdRequest::set_size(::google::protobuf::uint32 value) {
+  
+  size_ = value;
+  // @@protoc_insertion_point(field_set:mspb.GetAutoIncIdRequest.size)
 }
 
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -19216,20 +22142,22 @@ void CreateTableRequest::set_allocated_properties(::std::string* properties) {
 // ===================================================================
 
 #if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int CreateTableResponse::kHeaderFieldNumber;
+const int GetAutoIncIdResponse::kHeaderFieldNumber;
+const int GetAutoIncIdResponse::kIdsFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
-CreateTableResponse::CreateTableResponse()
+GetAutoIncIdResponse::GetAutoIncIdResponse()
   : ::google::protobuf::Message(), _internal_metadata_(NULL) {
   if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
     protobuf_mspb_2eproto::InitDefaults();
   }
   SharedCtor();
-  // @@protoc_insertion_point(constructor:mspb.CreateTableResponse)
+  // @@protoc_insertion_point(constructor:mspb.GetAutoIncIdResponse)
 }
-CreateTableResponse::CreateTableResponse(const CreateTableResponse& from)
+GetAutoIncIdResponse::GetAutoIncIdResponse(const GetAutoIncIdResponse& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
+      ids_(from.ids_),
       _cached_size_(0) {
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   if (from.has_header()) {
@@ -19237,52 +22165,53 @@ CreateTableResponse::CreateTableResponse(const CreateTableResponse& from)
   } else {
     header_ = NULL;
   }
-  // @@protoc_insertion_point(copy_constructor:mspb.CreateTableResponse)
+  // @@protoc_insertion_point(copy_constructor:mspb.GetAutoIncIdResponse)
 }
 
-void CreateTableResponse::SharedCtor() {
+void GetAutoIncIdResponse::SharedCtor() {
   header_ = NULL;
   _cached_size_ = 0;
 }
 
-CreateTableResponse::~CreateTableResponse() {
-  // @@protoc_insertion_point(destructor:mspb.CreateTableResponse)
+GetAutoIncIdResponse::~GetAutoIncIdResponse() {
+  // @@protoc_insertion_point(destructor:mspb.GetAutoIncIdResponse)
   SharedDtor();
 }
 
-void CreateTableResponse::SharedDtor() {
+void GetAutoIncIdResponse::SharedDtor() {
   if (this != internal_default_instance()) delete header_;
 }
 
-void CreateTableResponse::SetCachedSize(int size) const {
+void GetAutoIncIdResponse::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* CreateTableResponse::descriptor() {
+const ::google::protobuf::Descriptor* GetAutoIncIdResponse::descriptor() {
   protobuf_mspb_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_mspb_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
 }
 
-const CreateTableResponse& CreateTableResponse::default_instance() {
+const GetAutoIncIdResponse& GetAutoIncIdResponse::default_instance() {
   protobuf_mspb_2eproto::InitDefaults();
   return *internal_default_instance();
 }
 
-CreateTableResponse* CreateTableResponse::New(::google::protobuf::Arena* arena) const {
-  CreateTableResponse* n = new CreateTableResponse;
+GetAutoIncIdResponse* GetAutoIncIdResponse::New(::google::protobuf::Arena* arena) const {
+  GetAutoIncIdResponse* n = new GetAutoIncIdResponse;
   if (arena != NULL) {
     arena->Own(n);
   }
   return n;
 }
 
-void CreateTableResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:mspb.CreateTableResponse)
+void GetAutoIncIdResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:mspb.GetAutoIncIdResponse)
   ::google::protobuf::uint32 cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
+  ids_.Clear();
   if (GetArenaNoVirtual() == NULL && header_ != NULL) {
     delete header_;
   }
@@ -19290,11 +22219,11 @@ void CreateTableResponse::Clear() {
   _internal_metadata_.Clear();
 }
 
-bool CreateTableResponse::MergePartialFromCodedStream(
+bool GetAutoIncIdResponse::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:mspb.CreateTableResponse)
+  // @@protoc_insertion_point(parse_start:mspb.GetAutoIncIdResponse)
   for (;;) {
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
     tag = p.first;
@@ -19312,6 +22241,25 @@ bool CreateTableResponse::MergePartialFromCodedStream(
         break;
       }
 
+      // repeated uint64 ids = 2;
+      case 2: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(18u /* 18 & 0xFF */)) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPackedPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, this->mutable_ids())));
+        } else if (
+            static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(16u /* 16 & 0xFF */)) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadRepeatedPrimitiveNoInline<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 1, 18u, input, this->mutable_ids())));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
       default: {
       handle_unusual:
         if (tag == 0) {
@@ -19324,17 +22272,17 @@ bool CreateTableResponse::MergePartialFromCodedStream(
     }
   }
 success:
-  // @@protoc_insertion_point(parse_success:mspb.CreateTableResponse)
+  // @@protoc_insertion_point(parse_success:mspb.GetAutoIncIdResponse)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:mspb.CreateTableResponse)
+  // @@protoc_insertion_point(parse_failure:mspb.GetAutoIncIdResponse)
   return false;
 #undef DO_
 }
 
-void CreateTableResponse::SerializeWithCachedSizes(
+void GetAutoIncIdResponse::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:mspb.CreateTableResponse)
+  // @@protoc_insertion_point(serialize_start:mspb.GetAutoIncIdResponse)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
@@ -19344,17 +22292,28 @@ void CreateTableResponse::SerializeWithCachedSizes(
       1, *this->header_, output);
   }
 
+  // repeated uint64 ids = 2;
+  if (this->ids_size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteTag(2, ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
+    output->WriteVarint32(static_cast< ::google::protobuf::uint32>(
+        _ids_cached_byte_size_));
+  }
+  for (int i = 0, n = this->ids_size(); i < n; i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64NoTag(
+      this->ids(i), output);
+  }
+
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
     ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
   }
-  // @@protoc_insertion_point(serialize_end:mspb.CreateTableResponse)
+  // @@protoc_insertion_point(serialize_end:mspb.GetAutoIncIdResponse)
 }
 
-::google::protobuf::uint8* CreateTableResponse::InternalSerializeWithCachedSizesToArray(
+::google::protobuf::uint8* GetAutoIncIdResponse::InternalSerializeWithCachedSizesToArray(
     bool deterministic, ::google::protobuf::uint8* target) const {
   (void)deterministic; // Unused
-  // @@protoc_insertion_point(serialize_to_array_start:mspb.CreateTableResponse)
+  // @@protoc_insertion_point(serialize_to_array_start:mspb.GetAutoIncIdResponse)
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
@@ -19365,16 +22324,29 @@ void CreateTableResponse::SerializeWithCachedSizes(
         1, *this->header_, deterministic, target);
   }
 
+  // repeated uint64 ids = 2;
+  if (this->ids_size() > 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteTagToArray(
+      2,
+      ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
+      target);
+    target = ::google::protobuf::io::CodedOutputStream::WriteVarint32ToArray(
+        static_cast< ::google::protobuf::uint32>(
+            _ids_cached_byte_size_), target);
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteUInt64NoTagToArray(this->ids_, target);
+  }
+
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
     target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:mspb.CreateTableResponse)
+  // @@protoc_insertion_point(serialize_to_array_end:mspb.GetAutoIncIdResponse)
   return target;
 }
 
-size_t CreateTableResponse::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:mspb.CreateTableResponse)
+size_t GetAutoIncIdResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mspb.GetAutoIncIdResponse)
   size_t total_size = 0;
 
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
@@ -19382,6 +22354,22 @@ size_t CreateTableResponse::ByteSizeLong() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
   }
+  // repeated uint64 ids = 2;
+  {
+    size_t data_size = ::google::protobuf::internal::WireFormatLite::
+      UInt64Size(this->ids_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(
+            static_cast< ::google::protobuf::int32>(data_size));
+    }
+    int cached_size = ::google::protobuf::internal::ToCachedSize(data_size);
+    GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+    _ids_cached_byte_size_ = cached_size;
+    GOOGLE_SAFE_CONCURRENT_WRITES_END();
+    total_size += data_size;
+  }
+
   // .mspb.ResponseHeader header = 1;
   if (this->has_header()) {
     total_size += 1 +
@@ -19396,100 +22384,102 @@ size_t CreateTableResponse::ByteSizeLong() const {
   return total_size;
 }
 
-void CreateTableResponse::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:mspb.CreateTableResponse)
+void GetAutoIncIdResponse::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:mspb.GetAutoIncIdResponse)
   GOOGLE_DCHECK_NE(&from, this);
-  const CreateTableResponse* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const CreateTableResponse>(
+  const GetAutoIncIdResponse* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const GetAutoIncIdResponse>(
           &from);
   if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:mspb.CreateTableResponse)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:mspb.GetAutoIncIdResponse)
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:mspb.CreateTableResponse)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:mspb.GetAutoIncIdResponse)
     MergeFrom(*source);
   }
 }
 
-void CreateTableResponse::MergeFrom(const CreateTableResponse& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:mspb.CreateTableResponse)
+void GetAutoIncIdResponse::MergeFrom(const GetAutoIncIdResponse& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:mspb.GetAutoIncIdResponse)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
+  ids_.MergeFrom(from.ids_);
   if (from.has_header()) {
     mutable_header()->::mspb::ResponseHeader::MergeFrom(from.header());
   }
 }
 
-void CreateTableResponse::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:mspb.CreateTableResponse)
+void GetAutoIncIdResponse::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:mspb.GetAutoIncIdResponse)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void CreateTableResponse::CopyFrom(const CreateTableResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:mspb.CreateTableResponse)
+void GetAutoIncIdResponse::CopyFrom(const GetAutoIncIdResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mspb.GetAutoIncIdResponse)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool CreateTableResponse::IsInitialized() const {
+bool GetAutoIncIdResponse::IsInitialized() const {
   return true;
 }
 
-void CreateTableResponse::Swap(CreateTableResponse* other) {
+void GetAutoIncIdResponse::Swap(GetAutoIncIdResponse* other) {
   if (other == this) return;
   InternalSwap(other);
 }
-void CreateTableResponse::InternalSwap(CreateTableResponse* other) {
+void GetAutoIncIdResponse::InternalSwap(GetAutoIncIdResponse* other) {
   using std::swap;
+  ids_.InternalSwap(&other->ids_);
   swap(header_, other->header_);
   _internal_metadata_.Swap(&other->_internal_metadata_);
   swap(_cached_size_, other->_cached_size_);
 }
 
-::google::protobuf::Metadata CreateTableResponse::GetMetadata() const {
+::google::protobuf::Metadata GetAutoIncIdResponse::GetMetadata() const {
   protobuf_mspb_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_mspb_2eproto::file_level_metadata[kIndexInFileMessages];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
-// CreateTableResponse
+// GetAutoIncIdResponse
 
 // .mspb.ResponseHeader header = 1;
-bool CreateTableResponse::has_header() const {
+bool GetAutoIncIdResponse::has_header() const {
   return this != internal_default_instance() && header_ != NULL;
 }
-void CreateTableResponse::clear_header() {
+void GetAutoIncIdResponse::clear_header() {
   if (GetArenaNoVirtual() == NULL && header_ != NULL) delete header_;
   header_ = NULL;
 }
-const ::mspb::ResponseHeader& CreateTableResponse::header() const {
+const ::mspb::ResponseHeader& GetAutoIncIdResponse::header() const {
   const ::mspb::ResponseHeader* p = header_;
-  // @@protoc_insertion_point(field_get:mspb.CreateTableResponse.header)
+  // @@protoc_insertion_point(field_get:mspb.GetAutoIncIdResponse.header)
   return p != NULL ? *p : *reinterpret_cast<const ::mspb::ResponseHeader*>(
       &::mspb::_ResponseHeader_default_instance_);
 }
-::mspb::ResponseHeader* CreateTableResponse::mutable_header() {
+::mspb::ResponseHeader* GetAutoIncIdResponse::mutable_header() {
   
   if (header_ == NULL) {
     header_ = new ::mspb::ResponseHeader;
   }
-  // @@protoc_insertion_point(field_mutable:mspb.CreateTableResponse.header)
+  // @@protoc_insertion_point(field_mutable:mspb.GetAutoIncIdResponse.header)
   return header_;
 }
-::mspb::ResponseHeader* CreateTableResponse::release_header() {
-  // @@protoc_insertion_point(field_release:mspb.CreateTableResponse.header)
+::mspb::ResponseHeader* GetAutoIncIdResponse::release_header() {
+  // @@protoc_insertion_point(field_release:mspb.GetAutoIncIdResponse.header)
   
   ::mspb::ResponseHeader* temp = header_;
   header_ = NULL;
   return temp;
 }
-void CreateTableResponse::set_allocated_header(::mspb::ResponseHeader* header) {
+void GetAutoIncIdResponse::set_allocated_header(::mspb::ResponseHeader* header) {
   delete header_;
   header_ = header;
   if (header) {
@@ -19497,7 +22487,37 @@ void CreateTableResponse::set_allocated_header(::mspb::ResponseHeader* header) {
   } else {
     
   }
-  // @@protoc_insertion_point(field_set_allocated:mspb.CreateTableResponse.header)
+  // @@protoc_insertion_point(field_set_allocated:mspb.GetAutoIncIdResponse.header)
+}
+
+// repeated uint64 ids = 2;
+int GetAutoIncIdResponse::ids_size() const {
+  return ids_.size();
+}
+void GetAutoIncIdResponse::clear_ids() {
+  ids_.Clear();
+}
+::google::protobuf::uint64 GetAutoIncIdResponse::ids(int index) const {
+  // @@protoc_insertion_point(field_get:mspb.GetAutoIncIdResponse.ids)
+  return ids_.Get(index);
+}
+void GetAutoIncIdResponse::set_ids(int index, ::google::protobuf::uint64 value) {
+  ids_.Set(index, value);
+  // @@protoc_insertion_point(field_set:mspb.GetAutoIncIdResponse.ids)
+}
+void GetAutoIncIdResponse::add_ids(::google::protobuf::uint64 value) {
+  ids_.Add(value);
+  // @@protoc_insertion_point(field_add:mspb.GetAutoIncIdResponse.ids)
+}
+const ::google::protobuf::RepeatedField< ::google::protobuf::uint64 >&
+GetAutoIncIdResponse::ids() const {
+  // @@protoc_insertion_point(field_list:mspb.GetAutoIncIdResponse.ids)
+  return ids_;
+}
+::google::protobuf::RepeatedField< ::google::protobuf::uint64 >*
+GetAutoIncIdResponse::mutable_ids() {
+  // @@protoc_insertion_point(field_mutable_list:mspb.GetAutoIncIdResponse.ids)
+  return &ids_;
 }
 
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -45,6 +45,12 @@ extern AskSplitRequestDefaultTypeInternal _AskSplitRequest_default_instance_;
 class AskSplitResponse;
 class AskSplitResponseDefaultTypeInternal;
 extern AskSplitResponseDefaultTypeInternal _AskSplitResponse_default_instance_;
+class BatchRangeHeartbeatRequest;
+class BatchRangeHeartbeatRequestDefaultTypeInternal;
+extern BatchRangeHeartbeatRequestDefaultTypeInternal _BatchRangeHeartbeatRequest_default_instance_;
+class BatchRangeHeartbeatResponse;
+class BatchRangeHeartbeatResponseDefaultTypeInternal;
+extern BatchRangeHeartbeatResponseDefaultTypeInternal _BatchRangeHeartbeatResponse_default_instance_;
 class CreateDatabaseRequest;
 class CreateDatabaseRequestDefaultTypeInternal;
 extern CreateDatabaseRequestDefaultTypeInternal _CreateDatabaseRequest_default_instance_;
@@ -60,6 +66,12 @@ extern CreateTableResponseDefaultTypeInternal _CreateTableResponse_default_insta
 class Error;
 class ErrorDefaultTypeInternal;
 extern ErrorDefaultTypeInternal _Error_default_instance_;
+class GetAutoIncIdRequest;
+class GetAutoIncIdRequestDefaultTypeInternal;
+extern GetAutoIncIdRequestDefaultTypeInternal _GetAutoIncIdRequest_default_instance_;
+class GetAutoIncIdResponse;
+class GetAutoIncIdResponseDefaultTypeInternal;
+extern GetAutoIncIdResponseDefaultTypeInternal _GetAutoIncIdResponse_default_instance_;
 class GetColumnByIdRequest;
 class GetColumnByIdRequestDefaultTypeInternal;
 extern GetColumnByIdRequestDefaultTypeInternal _GetColumnByIdRequest_default_instance_;
@@ -1064,6 +1076,267 @@ class RangeHeartbeatResponse : public ::google::protobuf::Message /* @@protoc_in
 };
 // -------------------------------------------------------------------
 
+class BatchRangeHeartbeatRequest : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:mspb.BatchRangeHeartbeatRequest) */ {
+ public:
+  BatchRangeHeartbeatRequest();
+  virtual ~BatchRangeHeartbeatRequest();
+
+  BatchRangeHeartbeatRequest(const BatchRangeHeartbeatRequest& from);
+
+  inline BatchRangeHeartbeatRequest& operator=(const BatchRangeHeartbeatRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  #if LANG_CXX11
+  BatchRangeHeartbeatRequest(BatchRangeHeartbeatRequest&& from) noexcept
+    : BatchRangeHeartbeatRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline BatchRangeHeartbeatRequest& operator=(BatchRangeHeartbeatRequest&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+  #endif
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const BatchRangeHeartbeatRequest& default_instance();
+
+  static inline const BatchRangeHeartbeatRequest* internal_default_instance() {
+    return reinterpret_cast<const BatchRangeHeartbeatRequest*>(
+               &_BatchRangeHeartbeatRequest_default_instance_);
+  }
+  static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
+    7;
+
+  void Swap(BatchRangeHeartbeatRequest* other);
+  friend void swap(BatchRangeHeartbeatRequest& a, BatchRangeHeartbeatRequest& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline BatchRangeHeartbeatRequest* New() const PROTOBUF_FINAL { return New(NULL); }
+
+  BatchRangeHeartbeatRequest* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
+  void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  void CopyFrom(const BatchRangeHeartbeatRequest& from);
+  void MergeFrom(const BatchRangeHeartbeatRequest& from);
+  void Clear() PROTOBUF_FINAL;
+  bool IsInitialized() const PROTOBUF_FINAL;
+
+  size_t ByteSizeLong() const PROTOBUF_FINAL;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* target) const PROTOBUF_FINAL;
+  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const PROTOBUF_FINAL;
+  void InternalSwap(BatchRangeHeartbeatRequest* other);
+  private:
+  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
+    return NULL;
+  }
+  inline void* MaybeArenaPtr() const {
+    return NULL;
+  }
+  public:
+
+  ::google::protobuf::Metadata GetMetadata() const PROTOBUF_FINAL;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // repeated .mspb.RangeHeartbeatRequest heartbeats = 3;
+  int heartbeats_size() const;
+  void clear_heartbeats();
+  static const int kHeartbeatsFieldNumber = 3;
+  const ::mspb::RangeHeartbeatRequest& heartbeats(int index) const;
+  ::mspb::RangeHeartbeatRequest* mutable_heartbeats(int index);
+  ::mspb::RangeHeartbeatRequest* add_heartbeats();
+  ::google::protobuf::RepeatedPtrField< ::mspb::RangeHeartbeatRequest >*
+      mutable_heartbeats();
+  const ::google::protobuf::RepeatedPtrField< ::mspb::RangeHeartbeatRequest >&
+      heartbeats() const;
+
+  // repeated uint64 unchanged_ranges = 4;
+  int unchanged_ranges_size() const;
+  void clear_unchanged_ranges();
+  static const int kUnchangedRangesFieldNumber = 4;
+  ::google::protobuf::uint64 unchanged_ranges(int index) const;
+  void set_unchanged_ranges(int index, ::google::protobuf::uint64 value);
+  void add_unchanged_ranges(::google::protobuf::uint64 value);
+  const ::google::protobuf::RepeatedField< ::google::protobuf::uint64 >&
+      unchanged_ranges() const;
+  ::google::protobuf::RepeatedField< ::google::protobuf::uint64 >*
+      mutable_unchanged_ranges();
+
+  // .mspb.RequestHeader header = 1;
+  bool has_header() const;
+  void clear_header();
+  static const int kHeaderFieldNumber = 1;
+  const ::mspb::RequestHeader& header() const;
+  ::mspb::RequestHeader* mutable_header();
+  ::mspb::RequestHeader* release_header();
+  void set_allocated_header(::mspb::RequestHeader* header);
+
+  // uint64 node_id = 2;
+  void clear_node_id();
+  static const int kNodeIdFieldNumber = 2;
+  ::google::protobuf::uint64 node_id() const;
+  void set_node_id(::google::protobuf::uint64 value);
+
+  // @@protoc_insertion_point(class_scope:mspb.BatchRangeHeartbeatRequest)
+ private:
+
+  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  ::google::protobuf::RepeatedPtrField< ::mspb::RangeHeartbeatRequest > heartbeats_;
+  ::google::protobuf::RepeatedField< ::google::protobuf::uint64 > unchanged_ranges_;
+  mutable int _unchanged_ranges_cached_byte_size_;
+  ::mspb::RequestHeader* header_;
+  ::google::protobuf::uint64 node_id_;
+  mutable int _cached_size_;
+  friend struct protobuf_mspb_2eproto::TableStruct;
+};
+// -------------------------------------------------------------------
+
+class BatchRangeHeartbeatResponse : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:mspb.BatchRangeHeartbeatResponse) */ {
+ public:
+  BatchRangeHeartbeatResponse();
+  virtual ~BatchRangeHeartbeatResponse();
+
+  BatchRangeHeartbeatResponse(const BatchRangeHeartbeatResponse& from);
+
+  inline BatchRangeHeartbeatResponse& operator=(const BatchRangeHeartbeatResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  #if LANG_CXX11
+  BatchRangeHeartbeatResponse(BatchRangeHeartbeatResponse&& from) noexcept
+    : BatchRangeHeartbeatResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline BatchRangeHeartbeatResponse& operator=(BatchRangeHeartbeatResponse&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+  #endif
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const BatchRangeHeartbeatResponse& default_instance();
+
+  static inline const BatchRangeHeartbeatResponse* internal_default_instance() {
+    return reinterpret_cast<const BatchRangeHeartbeatResponse*>(
+               &_BatchRangeHeartbeatResponse_default_instance_);
+  }
+  static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
+    8;
+
+  void Swap(BatchRangeHeartbeatResponse* other);
+  friend void swap(BatchRangeHeartbeatResponse& a, BatchRangeHeartbeatResponse& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline BatchRangeHeartbeatResponse* New() const PROTOBUF_FINAL { return New(NULL); }
+
+  BatchRangeHeartbeatResponse* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
+  void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  void CopyFrom(const BatchRangeHeartbeatResponse& from);
+  void MergeFrom(const BatchRangeHeartbeatResponse& from);
+  void Clear() PROTOBUF_FINAL;
+  bool IsInitialized() const PROTOBUF_FINAL;
+
+  size_t ByteSizeLong() const PROTOBUF_FINAL;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* target) const PROTOBUF_FINAL;
+  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const PROTOBUF_FINAL;
+  void InternalSwap(BatchRangeHeartbeatResponse* other);
+  private:
+  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
+    return NULL;
+  }
+  inline void* MaybeArenaPtr() const {
+    return NULL;
+  }
+  public:
+
+  ::google::protobuf::Metadata GetMetadata() const PROTOBUF_FINAL;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // repeated .mspb.RangeHeartbeatResponse responses = 2;
+  int responses_size() const;
+  void clear_responses();
+  static const int kResponsesFieldNumber = 2;
+  const ::mspb::RangeHeartbeatResponse& responses(int index) const;
+  ::mspb::RangeHeartbeatResponse* mutable_responses(int index);
+  ::mspb::RangeHeartbeatResponse* add_responses();
+  ::google::protobuf::RepeatedPtrField< ::mspb::RangeHeartbeatResponse >*
+      mutable_responses();
+  const ::google::protobuf::RepeatedPtrField< ::mspb::RangeHeartbeatResponse >&
+      responses() const;
+
+  // repeated uint64 full_required = 3;
+  int full_required_size() const;
+  void clear_full_required();
+  static const int kFullRequiredFieldNumber = 3;
+  ::google::protobuf::uint64 full_required(int index) const;
+  void set_full_required(int index, ::google::protobuf::uint64 value);
+  void add_full_required(::google::protobuf::uint64 value);
+  const ::google::protobuf::RepeatedField< ::google::protobuf::uint64 >&
+      full_required() const;
+  ::google::protobuf::RepeatedField< ::google::protobuf::uint64 >*
+      mutable_full_required();
+
+  // .mspb.ResponseHeader header = 1;
+  bool has_header() const;
+  void clear_header();
+  static const int kHeaderFieldNumber = 1;
+  const ::mspb::ResponseHeader& header() const;
+  ::mspb::ResponseHeader* mutable_header();
+  ::mspb::ResponseHeader* release_header();
+  void set_allocated_header(::mspb::ResponseHeader* header);
+
+  // @@protoc_insertion_point(class_scope:mspb.BatchRangeHeartbeatResponse)
+ private:
+
+  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  ::google::protobuf::RepeatedPtrField< ::mspb::RangeHeartbeatResponse > responses_;
+  ::google::protobuf::RepeatedField< ::google::protobuf::uint64 > full_required_;
+  mutable int _full_required_cached_byte_size_;
+  ::mspb::ResponseHeader* header_;
+  mutable int _cached_size_;
+  friend struct protobuf_mspb_2eproto::TableStruct;
+};
+// -------------------------------------------------------------------
+
 class NodeStats : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:mspb.NodeStats) */ {
  public:
   NodeStats();
@@ -1098,7 +1371,7 @@ class NodeStats : public ::google::protobuf::Message /* @@protoc_insertion_point
                &_NodeStats_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
-    7;
+    9;
 
   void Swap(NodeStats* other);
   friend void swap(NodeStats& a, NodeStats& b) {
@@ -1235,6 +1508,138 @@ class NodeStats : public ::google::protobuf::Message /* @@protoc_insertion_point
   ::google::protobuf::uint32 start() const;
   void set_start(::google::protobuf::uint32 value);
 
+  // double cpu_usage = 16;
+  void clear_cpu_usage();
+  static const int kCpuUsageFieldNumber = 16;
+  double cpu_usage() const;
+  void set_cpu_usage(double value);
+
+  // double process_cpu_usage = 17;
+  void clear_process_cpu_usage();
+  static const int kProcessCpuUsageFieldNumber = 17;
+  double process_cpu_usage() const;
+  void set_process_cpu_usage(double value);
+
+  // double disk_util = 19;
+  void clear_disk_util();
+  static const int kDiskUtilFieldNumber = 19;
+  double disk_util() const;
+  void set_disk_util(double value);
+
+  // double disk_read_latency_ms = 20;
+  void clear_disk_read_latency_ms();
+  static const int kDiskReadLatencyMsFieldNumber = 20;
+  double disk_read_latency_ms() const;
+  void set_disk_read_latency_ms(double value);
+
+  // double disk_write_latency_ms = 21;
+  void clear_disk_write_latency_ms();
+  static const int kDiskWriteLatencyMsFieldNumber = 21;
+  double disk_write_latency_ms() const;
+  void set_disk_write_latency_ms(double value);
+
+  // uint64 disk_read_bytes = 22;
+  void clear_disk_read_bytes();
+  static const int kDiskReadBytesFieldNumber = 22;
+  ::google::protobuf::uint64 disk_read_bytes() const;
+  void set_disk_read_bytes(::google::protobuf::uint64 value);
+
+  // uint64 disk_write_bytes = 23;
+  void clear_disk_write_bytes();
+  static const int kDiskWriteBytesFieldNumber = 23;
+  ::google::protobuf::uint64 disk_write_bytes() const;
+  void set_disk_write_bytes(::google::protobuf::uint64 value);
+
+  // uint64 net_in_bytes = 24;
+  void clear_net_in_bytes();
+  static const int kNetInBytesFieldNumber = 24;
+  ::google::protobuf::uint64 net_in_bytes() const;
+  void set_net_in_bytes(::google::protobuf::uint64 value);
+
+  // uint64 net_out_bytes = 25;
+  void clear_net_out_bytes();
+  static const int kNetOutBytesFieldNumber = 25;
+  ::google::protobuf::uint64 net_out_bytes() const;
+  void set_net_out_bytes(::google::protobuf::uint64 value);
+
+  // uint64 perf_samples = 26;
+  void clear_perf_samples();
+  static const int kPerfSamplesFieldNumber = 26;
+  ::google::protobuf::uint64 perf_samples() const;
+  void set_perf_samples(::google::protobuf::uint64 value);
+
+  // uint64 perf_block_cache_hits = 27;
+  void clear_perf_block_cache_hits();
+  static const int kPerfBlockCacheHitsFieldNumber = 27;
+  ::google::protobuf::uint64 perf_block_cache_hits() const;
+  void set_perf_block_cache_hits(::google::protobuf::uint64 value);
+
+  // uint64 perf_block_reads = 28;
+  void clear_perf_block_reads();
+  static const int kPerfBlockReadsFieldNumber = 28;
+  ::google::protobuf::uint64 perf_block_reads() const;
+  void set_perf_block_reads(::google::protobuf::uint64 value);
+
+  // uint64 perf_block_read_bytes = 29;
+  void clear_perf_block_read_bytes();
+  static const int kPerfBlockReadBytesFieldNumber = 29;
+  ::google::protobuf::uint64 perf_block_read_bytes() const;
+  void set_perf_block_read_bytes(::google::protobuf::uint64 value);
+
+  // uint64 perf_block_read_nanos = 30;
+  void clear_perf_block_read_nanos();
+  static const int kPerfBlockReadNanosFieldNumber = 30;
+  ::google::protobuf::uint64 perf_block_read_nanos() const;
+  void set_perf_block_read_nanos(::google::protobuf::uint64 value);
+
+  // uint64 perf_memtable_nanos = 31;
+  void clear_perf_memtable_nanos();
+  static const int kPerfMemtableNanosFieldNumber = 31;
+  ::google::protobuf::uint64 perf_memtable_nanos() const;
+  void set_perf_memtable_nanos(::google::protobuf::uint64 value);
+
+  // uint64 perf_sst_nanos = 32;
+  void clear_perf_sst_nanos();
+  static const int kPerfSstNanosFieldNumber = 32;
+  ::google::protobuf::uint64 perf_sst_nanos() const;
+  void set_perf_sst_nanos(::google::protobuf::uint64 value);
+
+  // uint64 perf_iter_seek_nanos = 33;
+  void clear_perf_iter_seek_nanos();
+  static const int kPerfIterSeekNanosFieldNumber = 33;
+  ::google::protobuf::uint64 perf_iter_seek_nanos() const;
+  void set_perf_iter_seek_nanos(::google::protobuf::uint64 value);
+
+  // uint64 perf_keys_skipped = 34;
+  void clear_perf_keys_skipped();
+  static const int kPerfKeysSkippedFieldNumber = 34;
+  ::google::protobuf::uint64 perf_keys_skipped() const;
+  void set_perf_keys_skipped(::google::protobuf::uint64 value);
+
+  // uint64 perf_deletes_skipped = 35;
+  void clear_perf_deletes_skipped();
+  static const int kPerfDeletesSkippedFieldNumber = 35;
+  ::google::protobuf::uint64 perf_deletes_skipped() const;
+  void set_perf_deletes_skipped(::google::protobuf::uint64 value);
+
+  // uint64 perf_io_read_bytes = 36;
+  void clear_perf_io_read_bytes();
+  static const int kPerfIoReadBytesFieldNumber = 36;
+  ::google::protobuf::uint64 perf_io_read_bytes() const;
+  void set_perf_io_read_bytes(::google::protobuf::uint64 value);
+
+  // uint64 perf_io_read_nanos = 37;
+  void clear_perf_io_read_nanos();
+  static const int kPerfIoReadNanosFieldNumber = 37;
+  ::google::protobuf::uint64 perf_io_read_nanos() const;
+  void set_perf_io_read_nanos(::google::protobuf::uint64 value);
+
+  // uint32 cpu_count = 18;
+  void clear_cpu_count();
+  static const int kCpuCountFieldNumber = 18;
+  ::google::protobuf::uint32 cpu_count() const;
+  void set_cpu_count(::google::protobuf::uint32 value);
+
   // @@protoc_insertion_point(class_scope:mspb.NodeStats)
  private:
 
@@ -1254,6 +1659,28 @@ class NodeStats : public ::google::protobuf::Message /* @@protoc_insertion_point
   ::google::protobuf::uint64 keys_read_;
   bool is_busy_;
   ::google::protobuf::uint32 start_;
+  double cpu_usage_;
+  double process_cpu_usage_;
+  double disk_util_;
+  double disk_read_latency_ms_;
+  double disk_write_latency_ms_;
+  ::google::protobuf::uint64 disk_read_bytes_;
+  ::google::protobuf::uint64 disk_write_bytes_;
+  ::google::protobuf::uint64 net_in_bytes_;
+  ::google::protobuf::uint64 net_out_bytes_;
+  ::google::protobuf::uint64 perf_samples_;
+  ::google::protobuf::uint64 perf_block_cache_hits_;
+  ::google::protobuf::uint64 perf_block_reads_;
+  ::google::protobuf::uint64 perf_block_read_bytes_;
+  ::google::protobuf::uint64 perf_block_read_nanos_;
+  ::google::protobuf::uint64 perf_memtable_nanos_;
+  ::google::protobuf::uint64 perf_sst_nanos_;
+  ::google::protobuf::uint64 perf_iter_seek_nanos_;
+  ::google::protobuf::uint64 perf_keys_skipped_;
+  ::google::protobuf::uint64 perf_deletes_skipped_;
+  ::google::protobuf::uint64 perf_io_read_bytes_;
+  ::google::protobuf::uint64 perf_io_read_nanos_;
+  ::google::protobuf::uint32 cpu_count_;
   mutable int _cached_size_;
   friend struct protobuf_mspb_2eproto::TableStruct;
 };
@@ -1293,7 +1720,7 @@ class NodeHeartbeatRequest : public ::google::protobuf::Message /* @@protoc_inse
                &_NodeHeartbeatRequest_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
-    8;
+    10;
 
   void Swap(NodeHeartbeatRequest* other);
   friend void swap(NodeHeartbeatRequest& a, NodeHeartbeatRequest& b) {
@@ -1424,7 +1851,7 @@ class NodeHeartbeatResponse : public ::google::protobuf::Message /* @@protoc_ins
                &_NodeHeartbeatResponse_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
-    9;
+    11;
 
   void Swap(NodeHeartbeatResponse* other);
   friend void swap(NodeHeartbeatResponse& a, NodeHeartbeatResponse& b) {
@@ -1545,7 +1972,7 @@ class AskSplitRequest : public ::google::protobuf::Message /* @@protoc_insertion
                &_AskSplitRequest_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
-    10;
+    12;
 
   void Swap(AskSplitRequest* other);
   friend void swap(AskSplitRequest& a, AskSplitRequest& b) {
@@ -1670,7 +2097,7 @@ class AskSplitResponse : public ::google::protobuf::Message /* @@protoc_insertio
                &_AskSplitResponse_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
-    11;
+    13;
 
   void Swap(AskSplitResponse* other);
   friend void swap(AskSplitResponse& a, AskSplitResponse& b) {
@@ -1816,7 +2243,7 @@ class ReportSplitRequest : public ::google::protobuf::Message /* @@protoc_insert
                &_ReportSplitRequest_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
-    12;
+    14;
 
   void Swap(ReportSplitRequest* other);
   friend void swap(ReportSplitRequest& a, ReportSplitRequest& b) {
@@ -1936,7 +2363,7 @@ class ReportSplitResponse : public ::google::protobuf::Message /* @@protoc_inser
                &_ReportSplitResponse_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
-    13;
+    15;
 
   void Swap(ReportSplitResponse* other);
   friend void swap(ReportSplitResponse& a, ReportSplitResponse& b) {
@@ -2036,7 +2463,7 @@ class NodeLoginRequest : public ::google::protobuf::Message /* @@protoc_insertio
                &_NodeLoginRequest_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
-    14;
+    16;
 
   void Swap(NodeLoginRequest* other);
   friend void swap(NodeLoginRequest& a, NodeLoginRequest& b) {
@@ -2143,7 +2570,7 @@ class NodeLoginResponse : public ::google::protobuf::Message /* @@protoc_inserti
                &_NodeLoginResponse_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
-    15;
+    17;
 
   void Swap(NodeLoginResponse* other);
   friend void swap(NodeLoginResponse& a, NodeLoginResponse& b) {
@@ -2243,7 +2670,7 @@ class GetNodeIdRequest : public ::google::protobuf::Message /* @@protoc_insertio
                &_GetNodeIdRequest_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
-    16;
+    18;
 
   void Swap(GetNodeIdRequest* other);
   friend void swap(GetNodeIdRequest& a, GetNodeIdRequest& b) {
@@ -2379,7 +2806,7 @@ class GetNodeIdResponse : public ::google::protobuf::Message /* @@protoc_inserti
                &_GetNodeIdResponse_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
-    17;
+    19;
 
   void Swap(GetNodeIdResponse* other);
   friend void swap(GetNodeIdResponse& a, GetNodeIdResponse& b) {
@@ -2493,7 +2920,7 @@ class GetRouteRequest : public ::google::protobuf::Message /* @@protoc_insertion
                &_GetRouteRequest_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
-    18;
+    20;
 
   void Swap(GetRouteRequest* other);
   friend void swap(GetRouteRequest& a, GetRouteRequest& b) {
@@ -2622,7 +3049,7 @@ class GetRouteResponse : public ::google::protobuf::Message /* @@protoc_insertio
                &_GetRouteResponse_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
-    19;
+    21;
 
   void Swap(GetRouteResponse* other);
   friend void swap(GetRouteResponse& a, GetRouteResponse& b) {
@@ -2735,7 +3162,7 @@ class GetNodeRequest : public ::google::protobuf::Message /* @@protoc_insertion_
                &_GetNodeRequest_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
-    20;
+    22;
 
   void Swap(GetNodeRequest* other);
   friend void swap(GetNodeRequest& a, GetNodeRequest& b) {
@@ -2842,7 +3269,7 @@ class GetNodeResponse : public ::google::protobuf::Message /* @@protoc_insertion
                &_GetNodeResponse_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
-    21;
+    23;
 
   void Swap(GetNodeResponse* other);
   friend void swap(GetNodeResponse& a, GetNodeResponse& b) {
@@ -2952,7 +3379,7 @@ class GetDBRequest : public ::google::protobuf::Message /* @@protoc_insertion_po
                &_GetDBRequest_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
-    22;
+    24;
 
   void Swap(GetDBRequest* other);
   friend void swap(GetDBRequest& a, GetDBRequest& b) {
@@ -3067,7 +3494,7 @@ class GetDBResponse : public ::google::protobuf::Message /* @@protoc_insertion_p
                &_GetDBResponse_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
-    23;
+    25;
 
   void Swap(GetDBResponse* other);
   friend void swap(GetDBResponse& a, GetDBResponse& b) {
@@ -3177,7 +3604,7 @@ class GetTableRequest : public ::google::protobuf::Message /* @@protoc_insertion
                &_GetTableRequest_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
-    24;
+    26;
 
   void Swap(GetTableRequest* other);
   friend void swap(GetTableRequest& a, GetTableRequest& b) {
@@ -3307,7 +3734,7 @@ class GetTableByIdRequest : public ::google::protobuf::Message /* @@protoc_inser
                &_GetTableByIdRequest_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
-    25;
+    27;
 
   void Swap(GetTableByIdRequest* other);
   friend void swap(GetTableByIdRequest& a, GetTableByIdRequest& b) {
@@ -3421,7 +3848,7 @@ class GetTableResponse : public ::google::protobuf::Message /* @@protoc_insertio
                &_GetTableResponse_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
-    26;
+    28;
 
   void Swap(GetTableResponse* other);
   friend void swap(GetTableResponse& a, GetTableResponse& b) {
@@ -3531,7 +3958,7 @@ class GetTableByIdResponse : public ::google::protobuf::Message /* @@protoc_inse
                &_GetTableByIdResponse_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
-    27;
+    29;
 
   void Swap(GetTableByIdResponse* other);
   friend void swap(GetTableByIdResponse& a, GetTableByIdResponse& b) {
@@ -3641,7 +4068,7 @@ class GetColumnsRequest : public ::google::protobuf::Message /* @@protoc_inserti
                &_GetColumnsRequest_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
-    28;
+    30;
 
   void Swap(GetColumnsRequest* other);
   friend void swap(GetColumnsRequest& a, GetColumnsRequest& b) {
@@ -3755,7 +4182,7 @@ class GetColumnsResponse : public ::google::protobuf::Message /* @@protoc_insert
                &_GetColumnsResponse_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
-    29;
+    31;
 
   void Swap(GetColumnsResponse* other);
   friend void swap(GetColumnsResponse& a, GetColumnsResponse& b) {
@@ -3868,7 +4295,7 @@ class GetColumnByNameRequest : public ::google::protobuf::Message /* @@protoc_in
                &_GetColumnByNameRequest_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
-    30;
+    32;
 
   void Swap(GetColumnByNameRequest* other);
   friend void swap(GetColumnByNameRequest& a, GetColumnByNameRequest& b) {
@@ -3997,7 +4424,7 @@ class GetColumnByNameResponse : public ::google::protobuf::Message /* @@protoc_i
                &_GetColumnByNameResponse_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
-    31;
+    33;
 
   void Swap(GetColumnByNameResponse* other);
   friend void swap(GetColumnByNameResponse& a, GetColumnByNameResponse& b) {
@@ -4107,7 +4534,7 @@ class GetColumnByIdRequest : public ::google::protobuf::Message /* @@protoc_inse
                &_GetColumnByIdRequest_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
-    32;
+    34;
 
   void Swap(GetColumnByIdRequest* other);
   friend void swap(GetColumnByIdRequest& a, GetColumnByIdRequest& b) {
@@ -4228,7 +4655,7 @@ class GetColumnByIdResponse : public ::google::protobuf::Message /* @@protoc_ins
                &_GetColumnByIdResponse_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
-    33;
+    35;
 
   void Swap(GetColumnByIdResponse* other);
   friend void swap(GetColumnByIdResponse& a, GetColumnByIdResponse& b) {
@@ -4338,7 +4765,7 @@ class AddColumnRequest : public ::google::protobuf::Message /* @@protoc_insertio
                &_AddColumnRequest_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
-    34;
+    36;
 
   void Swap(AddColumnRequest* other);
   friend void swap(AddColumnRequest& a, AddColumnRequest& b) {
@@ -4465,7 +4892,7 @@ class AddColumnResponse : public ::google::protobuf::Message /* @@protoc_inserti
                &_AddColumnResponse_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
-    35;
+    37;
 
   void Swap(AddColumnResponse* other);
   friend void swap(AddColumnResponse& a, AddColumnResponse& b) {
@@ -4578,7 +5005,7 @@ class TruncateTableRequest : public ::google::protobuf::Message /* @@protoc_inse
                &_TruncateTableRequest_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
-    36;
+    38;
 
   void Swap(TruncateTableRequest* other);
   friend void swap(TruncateTableRequest& a, TruncateTableRequest& b) {
@@ -4692,7 +5119,7 @@ class TruncateTableResponse : public ::google::protobuf::Message /* @@protoc_ins
                &_TruncateTableResponse_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
-    37;
+    39;
 
   void Swap(TruncateTableResponse* other);
   friend void swap(TruncateTableResponse& a, TruncateTableResponse& b) {
@@ -4792,7 +5219,7 @@ class CreateDatabaseRequest : public ::google::protobuf::Message /* @@protoc_ins
                &_CreateDatabaseRequest_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
-    38;
+    40;
 
   void Swap(CreateDatabaseRequest* other);
   friend void swap(CreateDatabaseRequest& a, CreateDatabaseRequest& b) {
@@ -4907,7 +5334,7 @@ class CreateDatabaseResponse : public ::google::protobuf::Message /* @@protoc_in
                &_CreateDatabaseResponse_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
-    39;
+    41;
 
   void Swap(CreateDatabaseResponse* other);
   friend void swap(CreateDatabaseResponse& a, CreateDatabaseResponse& b) {
@@ -5007,7 +5434,7 @@ class CreateTableRequest : public ::google::protobuf::Message /* @@protoc_insert
                &_CreateTableRequest_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
-    40;
+    42;
 
   void Swap(CreateTableRequest* other);
   friend void swap(CreateTableRequest& a, CreateTableRequest& b) {
@@ -5152,7 +5579,7 @@ class CreateTableResponse : public ::google::protobuf::Message /* @@protoc_inser
                &_CreateTableResponse_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
-    41;
+    43;
 
   void Swap(CreateTableResponse* other);
   friend void swap(CreateTableResponse& a, CreateTableResponse& b) {
@@ -5218,24 +5645,24 @@ class CreateTableResponse : public ::google::protobuf::Message /* @@protoc_inser
 };
 // -------------------------------------------------------------------
 
-class RequestHeader : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:mspb.RequestHeader) */ {
+class GetAutoIncIdRequest : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:mspb.GetAutoIncIdRequest) */ {
  public:
-  RequestHeader();
-  virtual ~RequestHeader();
+  GetAutoIncIdRequest();
+  virtual ~GetAutoIncIdRequest();
 
-  RequestHeader(const RequestHeader& from);
+  GetAutoIncIdRequest(const GetAutoIncIdRequest& from);
 
-  inline RequestHeader& operator=(const RequestHeader& from) {
+  inline GetAutoIncIdRequest& operator=(const GetAutoIncIdRequest& from) {
     CopyFrom(from);
     return *this;
   }
   #if LANG_CXX11
-  RequestHeader(RequestHeader&& from) noexcept
-    : RequestHeader() {
+  GetAutoIncIdRequest(GetAutoIncIdRequest&& from) noexcept
+    : GetAutoIncIdRequest() {
     *this = ::std::move(from);
   }
 
-  inline RequestHeader& operator=(RequestHeader&& from) noexcept {
+  inline GetAutoIncIdRequest& operator=(GetAutoIncIdRequest&& from) noexcept {
     if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
       if (this != &from) InternalSwap(&from);
     } else {
@@ -5245,14 +5672,249 @@ class RequestHeader : public ::google::protobuf::Message /* @@protoc_insertion_p
   }
   #endif
   static const ::google::protobuf::Descriptor* descriptor();
-  static const RequestHeader& default_instance();
+  static const GetAutoIncIdRequest& default_instance();
 
-  static inline const RequestHeader* internal_default_instance() {
-    return reinterpret_cast<const RequestHeader*>(
-               &_RequestHeader_default_instance_);
+  static inline const GetAutoIncIdRequest* internal_default_instance() {
+    return reinterpret_cast<const GetAutoIncIdRequest*>(
+               &_GetAutoIncIdRequest_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
-    42;
+    44;
+
+  void Swap(GetAutoIncIdRequest* other);
+  friend void swap(GetAutoIncIdRequest& a, GetAutoIncIdRequest& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline GetAutoIncIdRequest* New() const PROTOBUF_FINAL { return New(NULL); }
+
+  GetAutoIncIdRequest* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
+  void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  void CopyFrom(const GetAutoIncIdRequest& from);
+  void MergeFrom(const GetAutoIncIdRequest& from);
+  void Clear() PROTOBUF_FINAL;
+  bool IsInitialized() const PROTOBUF_FINAL;
+
+  size_t ByteSizeLong() const PROTOBUF_FINAL;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* target) const PROTOBUF_FINAL;
+  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const PROTOBUF_FINAL;
+  void InternalSwap(GetAutoIncIdRequest* other);
+  private:
+  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
+    return NULL;
+  }
+  inline void* MaybeArenaPtr() const {
+    return NULL;
+  }
+  public:
+
+  ::google::protobuf::Metadata GetMetadata() const PROTOBUF_FINAL;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // .mspb.RequestHeader header = 1;
+  bool has_header() const;
+  void clear_header();
+  static const int kHeaderFieldNumber = 1;
+  const ::mspb::RequestHeader& header() const;
+  ::mspb::RequestHeader* mutable_header();
+  ::mspb::RequestHeader* release_header();
+  void set_allocated_header(::mspb::RequestHeader* header);
+
+  // uint64 db_id = 2;
+  void clear_db_id();
+  static const int kDbIdFieldNumber = 2;
+  ::google::protobuf::uint64 db_id() const;
+  void set_db_id(::google::protobuf::uint64 value);
+
+  // uint64 table_id = 3;
+  void clear_table_id();
+  static const int kTableIdFieldNumber = 3;
+  ::google::protobuf::uint64 table_id() const;
+  void set_table_id(::google::protobuf::uint64 value);
+
+  // uint32 size = 4;
+  void clear_size();
+  static const int kSizeFieldNumber = 4;
+  ::google::protobuf::uint32 size() const;
+  void set_size(::google::protobuf::uint32 value);
+
+  // @@protoc_insertion_point(class_scope:mspb.GetAutoIncIdRequest)
+ private:
+
+  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  ::mspb::RequestHeader* header_;
+  ::google::protobuf::uint64 db_id_;
+  ::google::protobuf::uint64 table_id_;
+  ::google::protobuf::uint32 size_;
+  mutable int _cached_size_;
+  friend struct protobuf_mspb_2eproto::TableStruct;
+};
+// -------------------------------------------------------------------
+
+class GetAutoIncIdResponse : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:mspb.GetAutoIncIdResponse) */ {
+ public:
+  GetAutoIncIdResponse();
+  virtual ~GetAutoIncIdResponse();
+
+  GetAutoIncIdResponse(const GetAutoIncIdResponse& from);
+
+  inline GetAutoIncIdResponse& operator=(const GetAutoIncIdResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  #if LANG_CXX11
+  GetAutoIncIdResponse(GetAutoIncIdResponse&& from) noexcept
+    : GetAutoIncIdResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline GetAutoIncIdResponse& operator=(GetAutoIncIdResponse&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+  #endif
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const GetAutoIncIdResponse& default_instance();
+
+  static inline const GetAutoIncIdResponse* internal_default_instance() {
+    return reinterpret_cast<const GetAutoIncIdResponse*>(
+               &_GetAutoIncIdResponse_default_instance_);
+  }
+  static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
+    45;
+
+  void Swap(GetAutoIncIdResponse* other);
+  friend void swap(GetAutoIncIdResponse& a, GetAutoIncIdResponse& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline GetAutoIncIdResponse* New() const PROTOBUF_FINAL { return New(NULL); }
+
+  GetAutoIncIdResponse* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
+  void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  void CopyFrom(const GetAutoIncIdResponse& from);
+  void MergeFrom(const GetAutoIncIdResponse& from);
+  void Clear() PROTOBUF_FINAL;
+  bool IsInitialized() const PROTOBUF_FINAL;
+
+  size_t ByteSizeLong() const PROTOBUF_FINAL;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* target) const PROTOBUF_FINAL;
+  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const PROTOBUF_FINAL;
+  void InternalSwap(GetAutoIncIdResponse* other);
+  private:
+  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
+    return NULL;
+  }
+  inline void* MaybeArenaPtr() const {
+    return NULL;
+  }
+  public:
+
+  ::google::protobuf::Metadata GetMetadata() const PROTOBUF_FINAL;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // repeated uint64 ids = 2;
+  int ids_size() const;
+  void clear_ids();
+  static const int kIdsFieldNumber = 2;
+  ::google::protobuf::uint64 ids(int index) const;
+  void set_ids(int index, ::google::protobuf::uint64 value);
+  void add_ids(::google::protobuf::uint64 value);
+  const ::google::protobuf::RepeatedField< ::google::protobuf::uint64 >&
+      ids() const;
+  ::google::protobuf::RepeatedField< ::google::protobuf::uint64 >*
+      mutable_ids();
+
+  // .mspb.ResponseHeader header = 1;
+  bool has_header() const;
+  void clear_header();
+  static const int kHeaderFieldNumber = 1;
+  const ::mspb::ResponseHeader& header() const;
+  ::mspb::ResponseHeader* mutable_header();
+  ::mspb::ResponseHeader* release_header();
+  void set_allocated_header(::mspb::ResponseHeader* header);
+
+  // @@protoc_insertion_point(class_scope:mspb.GetAutoIncIdResponse)
+ private:
+
+  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  ::google::protobuf::RepeatedField< ::google::protobuf::uint64 > ids_;
+  mutable int _ids_cached_byte_size_;
+  ::mspb::ResponseHeader* header_;
+  mutable int _cached_size_;
+  friend struct protobuf_mspb_2eproto::TableStruct;
+};
+// -------------------------------------------------------------------
+
+class RequestHeader : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:mspb.RequestHeader) */ {
+ public:
+  RequestHeader();
+  virtual ~RequestHeader();
+
+  RequestHeader(const RequestHeader& from);
+
+  inline RequestHeader& operator=(const RequestHeader& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  #if LANG_CXX11
+  RequestHeader(RequestHeader&& from) noexcept
+    : RequestHeader() {
+    *this = ::std::move(from);
+  }
+
+  inline RequestHeader& operator=(RequestHeader&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+  #endif
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const RequestHeader& default_instance();
+
+  static inline const RequestHeader* internal_default_instance() {
+    return reinterpret_cast<const RequestHeader*>(
+               &_RequestHeader_default_instance_);
+  }
+  static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
+    46;
 
   void Swap(RequestHeader* other);
   friend void swap(RequestHeader& a, RequestHeader& b) {
@@ -5349,7 +6011,7 @@ class ResponseHeader : public ::google::protobuf::Message /* @@protoc_insertion_
                &_ResponseHeader_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
-    43;
+    47;
 
   void Swap(ResponseHeader* other);
   friend void swap(ResponseHeader& a, ResponseHeader& b) {
@@ -5456,7 +6118,7 @@ class LeaderHint : public ::google::protobuf::Message /* @@protoc_insertion_poin
                &_LeaderHint_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
-    44;
+    48;
 
   void Swap(LeaderHint* other);
   friend void swap(LeaderHint& a, LeaderHint& b) {
@@ -5568,7 +6230,7 @@ class NoLeader : public ::google::protobuf::Message /* @@protoc_insertion_point(
                &_NoLeader_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
-    45;
+    49;
 
   void Swap(NoLeader* other);
   friend void swap(NoLeader& a, NoLeader& b) {
@@ -5658,7 +6320,7 @@ class Error : public ::google::protobuf::Message /* @@protoc_insertion_point(cla
                &_Error_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
-    46;
+    50;
 
   void Swap(Error* other);
   friend void swap(Error& a, Error& b) {
@@ -6489,28 +7151,250 @@ inline const ::taskpb::Task& RangeHeartbeatResponse::task() const {
 }
 inline ::taskpb::Task* RangeHeartbeatResponse::mutable_task() {
   
-  if (task_ == NULL) {
-    task_ = new ::taskpb::Task;
+  if (task_ == NULL) {
+    task_ = new ::taskpb::Task;
+  }
+  // @@protoc_insertion_point(field_mutable:mspb.RangeHeartbeatResponse.task)
+  return task_;
+}
+inline ::taskpb::Task* RangeHeartbeatResponse::release_task() {
+  // @@protoc_insertion_point(field_release:mspb.RangeHeartbeatResponse.task)
+  
+  ::taskpb::Task* temp = task_;
+  task_ = NULL;
+  return temp;
+}
+inline void RangeHeartbeatResponse::set_allocated_task(::taskpb::Task* task) {
+  delete task_;
+  task_ = task;
+  if (task) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_set_allocated:mspb.RangeHeartbeatResponse.task)
+}
+
+// -------------------------------------------------------------------
+
+// BatchRangeHeartbeatRequest
+
+// .mspb.RequestHeader header = 1;
+inline bool BatchRangeHeartbeatRequest::has_header() const {
+  return this != internal_default_instance() && header_ != NULL;
+}
+inline void BatchRangeHeartbeatRequest::clear_header() {
+  if (GetArenaNoVirtual() == NULL && header_ != NULL) delete header_;
+  header_ = NULL;
+}
+inline const ::mspb::RequestHeader& BatchRangeHeartbeatRequest::header() const {
+  const ::mspb::RequestHeader* p = header_;
+  // @@protoc_insertion_point(field_get:mspb.BatchRangeHeartbeatRequest.header)
+  return p != NULL ? *p : *reinterpret_cast<const ::mspb::RequestHeader*>(
+      &::mspb::_RequestHeader_default_instance_);
+}
+inline ::mspb::RequestHeader* BatchRangeHeartbeatRequest::mutable_header() {
+  
+  if (header_ == NULL) {
+    header_ = new ::mspb::RequestHeader;
+  }
+  // @@protoc_insertion_point(field_mutable:mspb.BatchRangeHeartbeatRequest.header)
+  return header_;
+}
+inline ::mspb::RequestHeader* BatchRangeHeartbeatRequest::release_header() {
+  // @@protoc_insertion_point(field_release:mspb.BatchRangeHeartbeatRequest.header)
+  
+  ::mspb::RequestHeader* temp = header_;
+  header_ = NULL;
+  return temp;
+}
+inline void BatchRangeHeartbeatRequest::set_allocated_header(::mspb::RequestHeader* header) {
+  delete header_;
+  header_ = header;
+  if (header) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_set_allocated:mspb.BatchRangeHeartbeatRequest.header)
+}
+
+// uint64 node_id = 2;
+inline void BatchRangeHeartbeatRequest::clear_node_id() {
+  node_id_ = GOOGLE_ULONGLONG(0);
+}
+inline ::google::protobuf::uint64 BatchRangeHeartbeatRequest::node_id() const {
+  // @@protoc_insertion_point(field_get:mspb.BatchRangeHeartbeatRequest.node_id)
+  return node_id_;
+}
+inline void BatchRangeHeartbeatRequest::set_node_id(::google::protobuf::uint64 value) {
+  
+  node_id_ = value;
+  // @@protoc_insertion_point(field_set:mspb.BatchRangeHeartbeatRequest.node_id)
+}
+
+// repeated .mspb.RangeHeartbeatRequest heartbeats = 3;
+inline int BatchRangeHeartbeatRequest::heartbeats_size() const {
+  return heartbeats_.size();
+}
+inline void BatchRangeHeartbeatRequest::clear_heartbeats() {
+  heartbeats_.Clear();
+}
+inline const ::mspb::RangeHeartbeatRequest& BatchRangeHeartbeatRequest::heartbeats(int index) const {
+  // @@protoc_insertion_point(field_get:mspb.BatchRangeHeartbeatRequest.heartbeats)
+  return heartbeats_.Get(index);
+}
+inline ::mspb::RangeHeartbeatRequest* BatchRangeHeartbeatRequest::mutable_heartbeats(int index) {
+  // @@protoc_insertion_point(field_mutable:mspb.BatchRangeHeartbeatRequest.heartbeats)
+  return heartbeats_.Mutable(index);
+}
+inline ::mspb::RangeHeartbeatRequest* BatchRangeHeartbeatRequest::add_heartbeats() {
+  // @@protoc_insertion_point(field_add:mspb.BatchRangeHeartbeatRequest.heartbeats)
+  return heartbeats_.Add();
+}
+inline ::google::protobuf::RepeatedPtrField< ::mspb::RangeHeartbeatRequest >*
+BatchRangeHeartbeatRequest::mutable_heartbeats() {
+  // @@protoc_insertion_point(field_mutable_list:mspb.BatchRangeHeartbeatRequest.heartbeats)
+  return &heartbeats_;
+}
+inline const ::google::protobuf::RepeatedPtrField< ::mspb::RangeHeartbeatRequest >&
+BatchRangeHeartbeatRequest::heartbeats() const {
+  // @@protoc_insertion_point(field_list:mspb.BatchRangeHeartbeatRequest.heartbeats)
+  return heartbeats_;
+}
+
+// repeated uint64 unchanged_ranges = 4;
+inline int BatchRangeHeartbeatRequest::unchanged_ranges_size() const {
+  return unchanged_ranges_.size();
+}
+inline void BatchRangeHeartbeatRequest::clear_unchanged_ranges() {
+  unchanged_ranges_.Clear();
+}
+inline ::google::protobuf::uint64 BatchRangeHeartbeatRequest::unchanged_ranges(int index) const {
+  // @@protoc_insertion_point(field_get:mspb.BatchRangeHeartbeatRequest.unchanged_ranges)
+  return unchanged_ranges_.Get(index);
+}
+inline void BatchRangeHeartbeatRequest::set_unchanged_ranges(int index, ::google::protobuf::uint64 value) {
+  unchanged_ranges_.Set(index, value);
+  // @@protoc_insertion_point(field_set:mspb.BatchRangeHeartbeatRequest.unchanged_ranges)
+}
+inline void BatchRangeHeartbeatRequest::add_unchanged_ranges(::google::protobuf::uint64 value) {
+  unchanged_ranges_.Add(value);
+  // @@protoc_insertion_point(field_add:mspb.BatchRangeHeartbeatRequest.unchanged_ranges)
+}
+inline const ::google::protobuf::RepeatedField< ::google::protobuf::uint64 >&
+BatchRangeHeartbeatRequest::unchanged_ranges() const {
+  // @@protoc_insertion_point(field_list:mspb.BatchRangeHeartbeatRequest.unchanged_ranges)
+  return unchanged_ranges_;
+}
+inline ::google::protobuf::RepeatedField< ::google::protobuf::uint64 >*
+BatchRangeHeartbeatRequest::mutable_unchanged_ranges() {
+  // @@protoc_insertion_point(field_mutable_list:mspb.BatchRangeHeartbeatRequest.unchanged_ranges)
+  return &unchanged_ranges_;
+}
+
+// -------------------------------------------------------------------
+
+// BatchRangeHeartbeatResponse
+
+// .mspb.ResponseHeader header = 1;
+inline bool BatchRangeHeartbeatResponse::has_header() const {
+  return this != internal_default_instance() && header_ != NULL;
+}
+inline void BatchRangeHeartbeatResponse::clear_header() {
+  if (GetArenaNoVirtual() == NULL && header_ != NULL) delete header_;
+  header_ = NULL;
+}
+inline const ::mspb::ResponseHeader& BatchRangeHeartbeatResponse::header() const {
+  const ::mspb::ResponseHeader* p = header_;
+  // @@protoc_insertion_point(field_get:mspb.BatchRangeHeartbeatResponse.header)
+  return p != NULL ? *p : *reinterpret_cast<const ::mspb::ResponseHeader*>(
+      &::mspb::_ResponseHeader_default_instance_);
+}
+inline ::mspb::ResponseHeader* BatchRangeHeartbeatResponse::mutable_header() {
+  
+  if (header_ == NULL) {
+    header_ = new ::mspb::ResponseHeader;
   }
-  // @@protoc_insertion_point(field_mutable:mspb.RangeHeartbeatResponse.task)
-  return task_;
+  // @@protoc_insertion_point(field_mutable:mspb.BatchRangeHeartbeatResponse.header)
+  return header_;
 }
-inline ::taskpb::Task* RangeHeartbeatResponse::release_task() {
-  // @@protoc_insertion_point(field_release:mspb.RangeHeartbeatResponse.task)
+inline ::mspb::ResponseHeader* BatchRangeHeartbeatResponse::release_header() {
+  // @@protoc_insertion_point(field_release:mspb.BatchRangeHeartbeatResponse.header)
   
-  ::taskpb::Task* temp = task_;
-  task_ = NULL;
+  ::mspb::ResponseHeader* temp = header_;
+  header_ = NULL;
   return temp;
 }
-inline void RangeHeartbeatResponse::set_allocated_task(::taskpb::Task* task) {
-  delete task_;
-  task_ = task;
-  if (task) {
+inline void BatchRangeHeartbeatResponse::set_allocated_header(::mspb::ResponseHeader* header) {
+  delete header_;
+  header_ = header;
+  if (header) {
     
   } else {
     
   }
-  // @@protoc_insertion_point(field_set_allocated:mspb.RangeHeartbeatResponse.task)
+  // @@protoc_insertion_point(field_set_allocated:mspb.BatchRangeHeartbeatResponse.header)
+}
+
+// repeated .mspb.RangeHeartbeatResponse responses = 2;
+inline int BatchRangeHeartbeatResponse::responses_size() const {
+  return responses_.size();
+}
+inline void BatchRangeHeartbeatResponse::clear_responses() {
+  responses_.Clear();
+}
+inline const ::mspb::RangeHeartbeatResponse& BatchRangeHeartbeatResponse::responses(int index) const {
+  // @@protoc_insertion_point(field_get:mspb.BatchRangeHeartbeatResponse.responses)
+  return responses_.Get(index);
+}
+inline ::mspb::RangeHeartbeatResponse* BatchRangeHeartbeatResponse::mutable_responses(int index) {
+  // @@protoc_insertion_point(field_mutable:mspb.BatchRangeHeartbeatResponse.responses)
+  return responses_.Mutable(index);
+}
+inline ::mspb::RangeHeartbeatResponse* BatchRangeHeartbeatResponse::add_responses() {
+  // @@protoc_insertion_point(field_add:mspb.BatchRangeHeartbeatResponse.responses)
+  return responses_.Add();
+}
+inline ::google::protobuf::RepeatedPtrField< ::mspb::RangeHeartbeatResponse >*
+BatchRangeHeartbeatResponse::mutable_responses() {
+  // @@protoc_insertion_point(field_mutable_list:mspb.BatchRangeHeartbeatResponse.responses)
+  return &responses_;
+}
+inline const ::google::protobuf::RepeatedPtrField< ::mspb::RangeHeartbeatResponse >&
+BatchRangeHeartbeatResponse::responses() const {
+  // @@protoc_insertion_point(field_list:mspb.BatchRangeHeartbeatResponse.responses)
+  return responses_;
+}
+
+// repeated uint64 full_required = 3;
+inline int BatchRangeHeartbeatResponse::full_required_size() const {
+  return full_required_.size();
+}
+inline void BatchRangeHeartbeatResponse::clear_full_required() {
+  full_required_.Clear();
+}
+inline ::google::protobuf::uint64 BatchRangeHeartbeatResponse::full_required(int index) const {
+  // @@protoc_insertion_point(field_get:mspb.BatchRangeHeartbeatResponse.full_required)
+  return full_required_.Get(index);
+}
+inline void BatchRangeHeartbeatResponse::set_full_required(int index, ::google::protobuf::uint64 value) {
+  full_required_.Set(index, value);
+  // @@protoc_insertion_point(field_set:mspb.BatchRangeHeartbeatResponse.full_required)
+}
+inline void BatchRangeHeartbeatResponse::add_full_required(::google::protobuf::uint64 value) {
+  full_required_.Add(value);
+  // @@protoc_insertion_point(field_add:mspb.BatchRangeHeartbeatResponse.full_required)
+}
+inline const ::google::protobuf::RepeatedField< ::google::protobuf::uint64 >&
+BatchRangeHeartbeatResponse::full_required() const {
+  // @@protoc_insertion_point(field_list:mspb.BatchRangeHeartbeatResponse.full_required)
+  return full_required_;
+}
+inline ::google::protobuf::RepeatedField< ::google::protobuf::uint64 >*
+BatchRangeHeartbeatResponse::mutable_full_required() {
+  // @@protoc_insertion_point(field_mutable_list:mspb.BatchRangeHeartbeatResponse.full_required)
+  return &full_required_;
 }
 
 // -------------------------------------------------------------------
@@ -6727,6 +7611,314 @@ inline void NodeStats::set_start(::google::protobuf::uint32 value) {
   // @@protoc_insertion_point(field_set:mspb.NodeStats.start)
 }
 
+// double cpu_usage = 16;
+inline void NodeStats::clear_cpu_usage() {
+  cpu_usage_ = 0;
+}
+inline double NodeStats::cpu_usage() const {
+  // @@protoc_insertion_point(field_get:mspb.NodeStats.cpu_usage)
+  return cpu_usage_;
+}
+inline void NodeStats::set_cpu_usage(double value) {
+  
+  cpu_usage_ = value;
+  // @@protoc_insertion_point(field_set:mspb.NodeStats.cpu_usage)
+}
+
+// double process_cpu_usage = 17;
+inline void NodeStats::clear_process_cpu_usage() {
+  process_cpu_usage_ = 0;
+}
+inline double NodeStats::process_cpu_usage() const {
+  // @@protoc_insertion_point(field_get:mspb.NodeStats.process_cpu_usage)
+  return process_cpu_usage_;
+}
+inline void NodeStats::set_process_cpu_usage(double value) {
+  
+  process_cpu_usage_ = value;
+  // @@protoc_insertion_point(field_set:mspb.NodeStats.process_cpu_usage)
+}
+
+// uint32 cpu_count = 18;
+inline void NodeStats::clear_cpu_count() {
+  cpu_count_ = 0u;
+}
+inline ::google::protobuf::uint32 NodeStats::cpu_count() const {
+  // @@protoc_insertion_point(field_get:mspb.NodeStats.cpu_count)
+  return cpu_count_;
+}
+inline void NodeStats::set_cpu_count(::google::protobuf::uint32 value) {
+  
+  cpu_count_ = value;
+  // @@protoc_insertion_point(field_set:mspb.NodeStats.cpu_count)
+}
+
+// double disk_util = 19;
+inline void NodeStats::clear_disk_util() {
+  disk_util_ = 0;
+}
+inline double NodeStats::disk_util() const {
+  // @@protoc_insertion_point(field_get:mspb.NodeStats.disk_util)
+  return disk_util_;
+}
+inline void NodeStats::set_disk_util(double value) {
+  
+  disk_util_ = value;
+  // @@protoc_insertion_point(field_set:mspb.NodeStats.disk_util)
+}
+
+// double disk_read_latency_ms = 20;
+inline void NodeStats::clear_disk_read_latency_ms() {
+  disk_read_latency_ms_ = 0;
+}
+inline double NodeStats::disk_read_latency_ms() const {
+  // @@protoc_insertion_point(field_get:mspb.NodeStats.disk_read_latency_ms)
+  return disk_read_latency_ms_;
+}
+inline void NodeStats::set_disk_read_latency_ms(double value) {
+  
+  disk_read_latency_ms_ = value;
+  // @@protoc_insertion_point(field_set:mspb.NodeStats.disk_read_latency_ms)
+}
+
+// double disk_write_latency_ms = 21;
+inline void NodeStats::clear_disk_write_latency_ms() {
+  disk_write_latency_ms_ = 0;
+}
+inline double NodeStats::disk_write_latency_ms() const {
+  // @@protoc_insertion_point(field_get:mspb.NodeStats.disk_write_latency_ms)
+  return disk_write_latency_ms_;
+}
+inline void NodeStats::set_disk_write_latency_ms(double value) {
+  
+  disk_write_latency_ms_ = value;
+  // @@protoc_insertion_point(field_set:mspb.NodeStats.disk_write_latency_ms)
+}
+
+// uint64 disk_read_bytes = 22;
+inline void NodeStats::clear_disk_read_bytes() {
+  disk_read_bytes_ = GOOGLE_ULONGLONG(0);
+}
+inline ::google::protobuf::uint64 NodeStats::disk_read_bytes() const {
+  // @@protoc_insertion_point(field_get:mspb.NodeStats.disk_read_bytes)
+  return disk_read_bytes_;
+}
+inline void NodeStats::set_disk_read_bytes(::google::protobuf::uint64 value) {
+  
+  disk_read_bytes_ = value;
+  // @@protoc_insertion_point(field_set:mspb.NodeStats.disk_read_bytes)
+}
+
+// uint64 disk_write_bytes = 23;
+inline void NodeStats::clear_disk_write_bytes() {
+  disk_write_bytes_ = GOOGLE_ULONGLONG(0);
+}
+inline ::google::protobuf::uint64 NodeStats::disk_write_bytes() const {
+  // @@protoc_insertion_point(field_get:mspb.NodeStats.disk_write_bytes)
+  return disk_write_bytes_;
+}
+inline void NodeStats::set_disk_write_bytes(::google::protobuf::uint64 value) {
+  
+  disk_write_bytes_ = value;
+  // @@protoc_insertion_point(field_set:mspb.NodeStats.disk_write_bytes)
+}
+
+// uint64 net_in_bytes = 24;
+inline void NodeStats::clear_net_in_bytes() {
+  net_in_bytes_ = GOOGLE_ULONGLONG(0);
+}
+inline ::google::protobuf::uint64 NodeStats::net_in_bytes() const {
+  // @@protoc_insertion_point(field_get:mspb.NodeStats.net_in_bytes)
+  return net_in_bytes_;
+}
+inline void NodeStats::set_net_in_bytes(::google::protobuf::uint64 value) {
+  
+  net_in_bytes_ = value;
+  // @@protoc_insertion_point(field_set:mspb.NodeStats.net_in_bytes)
+}
+
+// uint64 net_out_bytes = 25;
+inline void NodeStats::clear_net_out_bytes() {
+  net_out_bytes_ = GOOGLE_ULONGLONG(0);
+}
+inline ::google::protobuf::uint64 NodeStats::net_out_bytes() const {
+  // @@protoc_insertion_point(field_get:mspb.NodeStats.net_out_bytes)
+  return net_out_bytes_;
+}
+inline void NodeStats::set_net_out_bytes(::google::protobuf::uint64 value) {
+  
+  net_out_bytes_ = value;
+  // @@protoc_insertion_point(field_set:mspb.NodeStats.net_out_bytes)
+}
+
+// uint64 perf_samples = 26;
+inline void NodeStats::clear_perf_samples() {
+  perf_samples_ = GOOGLE_ULONGLONG(0);
+}
+inline ::google::protobuf::uint64 NodeStats::perf_samples() const {
+  // @@protoc_insertion_point(field_get:mspb.NodeStats.perf_samples)
+  return perf_samples_;
+}
+inline void NodeStats::set_perf_samples(::google::protobuf::uint64 value) {
+  
+  perf_samples_ = value;
+  // @@protoc_insertion_point(field_set:mspb.NodeStats.perf_samples)
+}
+
+// uint64 perf_block_cache_hits = 27;
+inline void NodeStats::clear_perf_block_cache_hits() {
+  perf_block_cache_hits_ = GOOGLE_ULONGLONG(0);
+}
+inline ::google::protobuf::uint64 NodeStats::perf_block_cache_hits() const {
+  // @@protoc_insertion_point(field_get:mspb.NodeStats.perf_block_cache_hits)
+  return perf_block_cache_hits_;
+}
+inline void NodeStats::set_perf_block_cache_hits(::google::protobuf::uint64 value) {
+  
+  perf_block_cache_hits_ = value;
+  // @@protoc_insertion_point(field_set:mspb.NodeStats.perf_block_cache_hits)
+}
+
+// uint64 perf_block_reads = 28;
+inline void NodeStats::clear_perf_block_reads() {
+  perf_block_reads_ = GOOGLE_ULONGLONG(0);
+}
+inline ::google::protobuf::uint64 NodeStats::perf_block_reads() const {
+  // @@protoc_insertion_point(field_get:mspb.NodeStats.perf_block_reads)
+  return perf_block_reads_;
+}
+inline void NodeStats::set_perf_block_reads(::google::protobuf::uint64 value) {
+  
+  perf_block_reads_ = value;
+  // @@protoc_insertion_point(field_set:mspb.NodeStats.perf_block_reads)
+}
+
+// uint64 perf_block_read_bytes = 29;
+inline void NodeStats::clear_perf_block_read_bytes() {
+  perf_block_read_bytes_ = GOOGLE_ULONGLONG(0);
+}
+inline ::google::protobuf::uint64 NodeStats::perf_block_read_bytes() const {
+  // @@protoc_insertion_point(field_get:mspb.NodeStats.perf_block_read_bytes)
+  return perf_block_read_bytes_;
+}
+inline void NodeStats::set_perf_block_read_bytes(::google::protobuf::uint64 value) {
+  
+  perf_block_read_bytes_ = value;
+  // @@protoc_insertion_point(field_set:mspb.NodeStats.perf_block_read_bytes)
+}
+
+// uint64 perf_block_read_nanos = 30;
+inline void NodeStats::clear_perf_block_read_nanos() {
+  perf_block_read_nanos_ = GOOGLE_ULONGLONG(0);
+}
+inline ::google::protobuf::uint64 NodeStats::perf_block_read_nanos() const {
+  // @@protoc_insertion_point(field_get:mspb.NodeStats.perf_block_read_nanos)
+  return perf_block_read_nanos_;
+}
+inline void NodeStats::set_perf_block_read_nanos(::google::protobuf::uint64 value) {
+  
+  perf_block_read_nanos_ = value;
+  // @@protoc_insertion_point(field_set:mspb.NodeStats.perf_block_read_nanos)
+}
+
+// uint64 perf_memtable_nanos = 31;
+inline void NodeStats::clear_perf_memtable_nanos() {
+  perf_memtable_nanos_ = GOOGLE_ULONGLONG(0);
+}
+inline ::google::protobuf::uint64 NodeStats::perf_memtable_nanos() const {
+  // @@protoc_insertion_point(field_get:mspb.NodeStats.perf_memtable_nanos)
+  return perf_memtable_nanos_;
+}
+inline void NodeStats::set_perf_memtable_nanos(::google::protobuf::uint64 value) {
+  
+  perf_memtable_nanos_ = value;
+  // @@protoc_insertion_point(field_set:mspb.NodeStats.perf_memtable_nanos)
+}
+
+// uint64 perf_sst_nanos = 32;
+inline void NodeStats::clear_perf_sst_nanos() {
+  perf_sst_nanos_ = GOOGLE_ULONGLONG(0);
+}
+inline ::google::protobuf::uint64 NodeStats::perf_sst_nanos() const {
+  // @@protoc_insertion_point(field_get:mspb.NodeStats.perf_sst_nanos)
+  return perf_sst_nanos_;
+}
+inline void NodeStats::set_perf_sst_nanos(::google::protobuf::uint64 value) {
+  
+  perf_sst_nanos_ = value;
+  // @@protoc_insertion_point(field_set:mspb.NodeStats.perf_sst_nanos)
+}
+
+// uint64 perf_iter_seek_nanos = 33;
+inline void NodeStats::clear_perf_iter_seek_nanos() {
+  perf_iter_seek_nanos_ = GOOGLE_ULONGLONG(0);
+}
+inline ::google::protobuf::uint64 NodeStats::perf_iter_seek_nanos() const {
+  // @@protoc_insertion_point(field_get:mspb.NodeStats.perf_iter_seek_nanos)
+  return perf_iter_seek_nanos_;
+}
+inline void NodeStats::set_perf_iter_seek_nanos(::google::protobuf::uint64 value) {
+  
+  perf_iter_seek_nanos_ = value;
+  // @@protoc_insertion_point(field_set:mspb.NodeStats.perf_iter_seek_nanos)
+}
+
+// uint64 perf_keys_skipped = 34;
+inline void NodeStats::clear_perf_keys_skipped() {
+  perf_keys_skipped_ = GOOGLE_ULONGLONG(0);
+}
+inline ::google::protobuf::uint64 NodeStats::perf_keys_skipped() const {
+  // @@protoc_insertion_point(field_get:mspb.NodeStats.perf_keys_skipped)
+  return perf_keys_skipped_;
+}
+inline void NodeStats::set_perf_keys_skipped(::google::protobuf::uint64 value) {
+  
+  perf_keys_skipped_ = value;
+  // @@protoc_insertion_point(field_set:mspb.NodeStats.perf_keys_skipped)
+}
+
+// uint64 perf_deletes_skipped = 35;
+inline void NodeStats::clear_perf_deletes_skipped() {
+  perf_deletes_skipped_ = GOOGLE_ULONGLONG(0);
+}
+inline ::google::protobuf::uint64 NodeStats::perf_deletes_skipped() const {
+  // @@protoc_insertion_point(field_get:mspb.NodeStats.perf_deletes_skipped)
+  return perf_deletes_skipped_;
+}
+inline void NodeStats::set_perf_deletes_skipped(::google::protobuf::uint64 value) {
+  
+  perf_deletes_skipped_ = value;
+  // @@protoc_insertion_point(field_set:mspb.NodeStats.perf_deletes_skipped)
+}
+
+// uint64 perf_io_read_bytes = 36;
+inline void NodeStats::clear_perf_io_read_bytes() {
+  perf_io_read_bytes_ = GOOGLE_ULONGLONG(0);
+}
+inline ::google::protobuf::uint64 NodeStats::perf_io_read_bytes() const {
+  // @@protoc_insertion_point(field_get:mspb.NodeStats.perf_io_read_bytes)
+  return perf_io_read_bytes_;
+}
+inline void NodeStats::set_perf_io_read_bytes(::google::protobuf::uint64 value) {
+  
+  perf_io_read_bytes_ = value;
+  // @@protoc_insertion_point(field_set:mspb.NodeStats.perf_io_read_bytes)
+}
+
+// uint64 perf_io_read_nanos = 37;
+inline void NodeStats::clear_perf_io_read_nanos() {
+  perf_io_read_nanos_ = GOOGLE_ULONGLONG(0);
+}
+inline ::google::protobuf::uint64 NodeStats::perf_io_read_nanos() const {
+  // @@protoc_insertion_point(field_get:mspb.NodeStats.perf_io_read_nanos)
+  return perf_io_read_nanos_;
+}
+inline void NodeStats::set_perf_io_read_nanos(::google::protobuf::uint64 value) {
+  
+  perf_io_read_nanos_ = value;
+  // @@protoc_insertion_point(field_set:mspb.NodeStats.perf_io_read_nanos)
+}
+
 // -------------------------------------------------------------------
 
 // NodeHeartbeatRequest
@@ -9861,6 +11053,166 @@ inline void CreateTableResponse::set_allocated_header(::mspb::ResponseHeader* he
 
 // -------------------------------------------------------------------
 
+// GetAutoIncIdRequest
+
+// .mspb.RequestHeader header = 1;
+inline bool GetAutoIncIdRequest::has_header() const {
+  return this != internal_default_instance() && header_ != NULL;
+}
+inline void GetAutoIncIdRequest::clear_header() {
+  if (GetArenaNoVirtual() == NULL && header_ != NULL) delete header_;
+  header_ = NULL;
+}
+inline const ::mspb::RequestHeader& GetAutoIncIdRequest::header() const {
+  const ::mspb::RequestHeader* p = header_;
+  // @@protoc_insertion_point(field_get:mspb.GetAutoIncIdRequest.header)
+  return p != NULL ? *p : *reinterpret_cast<const ::mspb::RequestHeader*>(
+      &::mspb::_RequestHeader_default_instance_);
+}
+inline ::mspb::RequestHeader* GetAutoIncIdRequest::mutable_header() {
+  
+  if (header_ == NULL) {
+    header_ = new ::mspb::RequestHeader;
+  }
+  // @@protoc_insertion_point(field_mutable:mspb.GetAutoIncIdRequest.header)
+  return header_;
+}
+inline ::mspb::RequestHeader* GetAutoIncIdRequest::release_header() {
+  // @@protoc_insertion_point(field_release:mspb.GetAutoIncIdRequest.header)
+  
+  ::mspb::RequestHeader* temp = header_;
+  header_ = NULL;
+  return temp;
+}
+inline void GetAutoIncIdRequest::set_allocated_header(::mspb::RequestHeader* header) {
+  delete header_;
+  header_ = header;
+  if (header) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_set_allocated:mspb.GetAutoIncIdRequest.header)
+}
+
+// uint64 db_id = 2;
+inline void GetAutoIncIdRequest::clear_db_id() {
+  db_id_ = GOOGLE_ULONGLONG(0);
+}
+inline ::google::protobuf::uint64 GetAutoIncIdRequest::db_id() const {
+  // @@protoc_insertion_point(field_get:mspb.GetAutoIncIdRequest.db_id)
+  return db_id_;
+}
+inline void GetAutoIncIdRequest::set_db_id(::google::protobuf::uint64 value) {
+  
+  db_id_ = value;
+  // @@protoc_insertion_point(field_set:mspb.GetAutoIncIdRequest.db_id)
+}
+
+// uint64 table_id = 3;
+inline void GetAutoIncIdRequest::clear_table_id() {
+  table_id_ = GOOGLE_ULONGLONG(0);
+}
+inline ::google::protobuf::uint64 GetAutoIncIdRequest::table_id() const {
+  // @@protoc_insertion_point(field_get:mspb.GetAutoIncIdRequest.table_id)
+  return table_id_;
+}
+inline void GetAutoIncIdRequest::set_table_id(::google::protobuf::uint64 value) {
+  
+  table_id_ = value;
+  // @@protoc_insertion_point(field_set:mspb.GetAutoIncIdRequest.table_id)
+}
+
+// uint32 size = 4;
+inline void GetAutoIncIdRequest::clear_size() {
+  size_ = 0u;
+}
+inline ::google::protobuf::uint32 GetAutoIncIdRequest::size() const {
+  // @@protoc_insertion_point(field_get:mspb.GetAutoIncIdRequest.size)
+  return size_;
+}
+inline void GetAutoIncIdRequest::set_size(::google::protobuf::uint32 value) {
+  
+  size_ = value;
+  // @@protoc_insertion_point(field_set:mspb.GetAutoIncIdRequest.size)
+}
+
+// -------------------------------------------------------------------
+
+// GetAutoIncIdResponse
+
+// .mspb.ResponseHeader header = 1;
+inline bool GetAutoIncIdResponse::has_header() const {
+  return this != internal_default_instance() && header_ != NULL;
+}
+inline void GetAutoIncIdResponse::clear_header() {
+  if (GetArenaNoVirtual() == NULL && header_ != NULL) delete header_;
+  header_ = NULL;
+}
+inline const ::mspb::ResponseHeader& GetAutoIncIdResponse::header() const {
+  const ::mspb::ResponseHeader* p = header_;
+  // @@protoc_insertion_point(field_get:mspb.GetAutoIncIdResponse.header)
+  return p != NULL ? *p : *reinterpret_cast<const ::mspb::ResponseHeader*>(
+      &::mspb::_ResponseHeader_default_instance_);
+}
+inline ::mspb::ResponseHeader* GetAutoIncIdResponse::mutable_header() {
+  
+  if (header_ == NULL) {
+    header_ = new ::mspb::ResponseHeader;
+  }
+  // @@protoc_insertion_point(field_mutable:mspb.GetAutoIncIdResponse.header)
+  return header_;
+}
+inline ::mspb::ResponseHeader* GetAutoIncIdResponse::release_header() {
+  // @@protoc_insertion_point(field_release:mspb.GetAutoIncIdResponse.header)
+  
+  ::mspb::ResponseHeader* temp = header_;
+  header_ = NULL;
+  return temp;
+}
+inline void GetAutoIncIdResponse::set_allocated_header(::mspb::ResponseHeader* header) {
+  delete header_;
+  header_ = header;
+  if (header) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_set_allocated:mspb.GetAutoIncIdResponse.header)
+}
+
+// repeated uint64 ids = 2;
+inline int GetAutoIncIdResponse::ids_size() const {
+  return ids_.size();
+}
+inline void GetAutoIncIdResponse::clear_ids() {
+  ids_.Clear();
+}
+inline ::google::protobuf::uint64 GetAutoIncIdResponse::ids(int index) const {
+  // @@protoc_insertion_point(field_get:mspb.GetAutoIncIdResponse.ids)
+  return ids_.Get(index);
+}
+inline void GetAutoIncIdResponse::set_ids(int index, ::google::protobuf::uint64 value) {
+  ids_.Set(index, value);
+  // @@protoc_insertion_point(field_set:mspb.GetAutoIncIdResponse.ids)
+}
+inline void GetAutoIncIdResponse::add_ids(::google::protobuf::uint64 value) {
+  ids_.Add(value);
+  // @@protoc_insertion_point(field_add:mspb.GetAutoIncIdResponse.ids)
+}
+inline const ::google::protobuf::RepeatedField< ::google::protobuf::uint64 >&
+GetAutoIncIdResponse::ids() const {
+  // @@protoc_insertion_point(field_list:mspb.GetAutoIncIdResponse.ids)
+  return ids_;
+}
+inline ::google::protobuf::RepeatedField< ::google::protobuf::uint64 >*
+GetAutoIncIdResponse::mutable_ids() {
+  // @@protoc_insertion_point(field_mutable_list:mspb.GetAutoIncIdResponse.ids)
+  return &ids_;
+}
+
+// -------------------------------------------------------------------
+
 // RequestHeader
 
 // uint64 cluster_id = 1;
@@ -10190,6 +11542,14 @@ inline void Error::set_allocated_no_leader(::mspb::NoLeader* no_leader) {
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
@@ -48,6 +48,16 @@ public:
  ::google::protobuf::internal::ExplicitlyConstructed<LeaderChangeResponse>
      _instance;
 } _LeaderChangeResponse_default_instance_;
+class LockReapRequestDefaultTypeInternal {
+public:
+ ::google::protobuf::internal::ExplicitlyConstructed<LockReapRequest>
+     _instance;
+} _LockReapRequest_default_instance_;
+class ReapLockDefaultTypeInternal {
+public:
+ ::google::protobuf::internal::ExplicitlyConstructed<ReapLock>
+     _instance;
+} _ReapLock_default_instance_;
 class CmdIDDefaultTypeInternal {
 public:
  ::google::protobuf::internal::ExplicitlyConstructed<CmdID>
@@ -79,8 +89,8 @@ namespace protobuf_raft_5fcmdpb_2eproto {
 
 namespace {
 
-::google::protobuf::Metadata file_level_metadata[11];
-const ::google::protobuf::EnumDescriptor* file_level_enum_descriptors[1];
+::google::protobuf::Metadata file_level_metadata[13];
+const ::google::protobuf::EnumDescriptor* file_level_enum_descriptors[2];
 
 }  // namespace
 
@@ -106,6 +116,8 @@ PROTOBUF_CONSTEXPR_VAR ::google::protobuf::internal::ParseTable const
   { NULL, NULL, 0, -1, -1, -1, -1, NULL, false },
   { NULL, NULL, 0, -1, -1, -1, -1, NULL, false },
   { NULL, NULL, 0, -1, -1, -1, -1, NULL, false },
+  { NULL, NULL, 0, -1, -1, -1, -1, NULL, false },
+  { NULL, NULL, 0, -1, -1, -1, -1, NULL, false },
 };
 
 const ::google::protobuf::uint32 TableStruct::offsets[] GOOGLE_ATTRIBUTE_SECTION_VARIABLE(protodesc_cold) = {
@@ -128,6 +140,9 @@ const ::google::protobuf::uint32 TableStruct::offsets[] GOOGLE_ATTRIBUTE_SECTION
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MergeRequest, commit_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MergeRequest, target_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MergeRequest, source_),
   ~0u,  // no _has_bits_
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MergeResponse, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -146,6 +161,19 @@ const ::google::protobuf::uint32 TableStruct::offsets[] GOOGLE_ATTRIBUTE_SECTION
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   ~0u,  // no _has_bits_
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(LockReapRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(LockReapRequest, locks_),
+  ~0u,  // no _has_bits_
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ReapLock, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ReapLock, key_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ReapLock, id_),
+  ~0u,  // no _has_bits_
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdID, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
@@ -176,6 +204,8 @@ const ::google::protobuf::uint32 TableStruct::offsets[] GOOGLE_ATTRIBUTE_SECTION
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Command, kv_delete_req_),
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Command, kv_batch_del_req_),
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Command, kv_range_del_req_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Command, kv_incr_req_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Command, kv_append_req_),
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Command, admin_split_req_),
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Command, admin_merge_req_),
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Command, admin_leader_change_req_),
@@ -183,6 +213,8 @@ const ::google::protobuf::uint32 TableStruct::offsets[] GOOGLE_ATTRIBUTE_SECTION
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Command, lock_update_req_),
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Command, unlock_req_),
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Command, unlock_force_req_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Command, lock_reap_req_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Command, expire_at_),
   ~0u,  // no _has_bits_
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PeerTask, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -203,19 +235,22 @@ const ::google::protobuf::uint32 TableStruct::offsets[] GOOGLE_ATTRIBUTE_SECTION
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SnapshotContext, meta_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SnapshotContext, value_format_),
 };
 static const ::google::protobuf::internal::MigrationSchema schemas[] GOOGLE_ATTRIBUTE_SECTION_VARIABLE(protodesc_cold) = {
   { 0, -1, sizeof(SplitRequest)},
   { 9, -1, sizeof(SplitResponse)},
   { 14, -1, sizeof(MergeRequest)},
-  { 19, -1, sizeof(MergeResponse)},
-  { 24, -1, sizeof(LeaderChangeRequest)},
-  { 31, -1, sizeof(LeaderChangeResponse)},
-  { 36, -1, sizeof(CmdID)},
-  { 43, -1, sizeof(Command)},
-  { 74, -1, sizeof(PeerTask)},
-  { 81, -1, sizeof(SnapshotKVPair)},
-  { 88, -1, sizeof(SnapshotContext)},
+  { 22, -1, sizeof(MergeResponse)},
+  { 27, -1, sizeof(LeaderChangeRequest)},
+  { 34, -1, sizeof(LeaderChangeResponse)},
+  { 39, -1, sizeof(LockReapRequest)},
+  { 45, -1, sizeof(ReapLock)},
+  { 52, -1, sizeof(CmdID)},
+  { 59, -1, sizeof(Command)},
+  { 94, -1, sizeof(PeerTask)},
+  { 101, -1, sizeof(SnapshotKVPair)},
+  { 108, -1, sizeof(SnapshotContext)},
 };
 
 static ::google::protobuf::Message const * const file_default_instances[] = {
@@ -225,6 +260,8 @@ static ::google::protobuf::Message const * const file_default_instances[] = {
   reinterpret_cast<const ::google::protobuf::Message*>(&_MergeResponse_default_instance_),
   reinterpret_cast<const ::google::protobuf::Message*>(&_LeaderChangeRequest_default_instance_),
   reinterpret_cast<const ::google::protobuf::Message*>(&_LeaderChangeResponse_default_instance_),
+  reinterpret_cast<const ::google::protobuf::Message*>(&_LockReapRequest_default_instance_),
+  reinterpret_cast<const ::google::protobuf::Message*>(&_ReapLock_default_instance_),
   reinterpret_cast<const ::google::protobuf::Message*>(&_CmdID_default_instance_),
   reinterpret_cast<const ::google::protobuf::Message*>(&_Command_default_instance_),
   reinterpret_cast<const ::google::protobuf::Message*>(&_PeerTask_default_instance_),
@@ -250,7 +287,7 @@ void protobuf_AssignDescriptorsOnce() {
 void protobuf_RegisterTypes(const ::std::string&) GOOGLE_ATTRIBUTE_COLD;
 void protobuf_RegisterTypes(const ::std::string&) {
   protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::internal::RegisterAllTypes(file_level_metadata, 11);
+  ::google::protobuf::internal::RegisterAllTypes(file_level_metadata, 13);
 }
 
 }  // namespace
@@ -272,7 +309,11 @@ void TableStruct::InitDefaultsImpl() {
   ::google::protobuf::internal::OnShutdownDestroyMessage(
       &_LeaderChangeRequest_default_instance_);_LeaderChangeResponse_default_instance_._instance.DefaultConstruct();
   ::google::protobuf::internal::OnShutdownDestroyMessage(
-      &_LeaderChangeResponse_default_instance_);_CmdID_default_instance_._instance.DefaultConstruct();
+      &_LeaderChangeResponse_default_instance_);_LockReapRequest_default_instance_._instance.DefaultConstruct();
+  ::google::protobuf::internal::OnShutdownDestroyMessage(
+      &_LockReapRequest_default_instance_);_ReapLock_default_instance_._instance.DefaultConstruct();
+  ::google::protobuf::internal::OnShutdownDestroyMessage(
+      &_ReapLock_default_instance_);_CmdID_default_instance_._instance.DefaultConstruct();
   ::google::protobuf::internal::OnShutdownDestroyMessage(
       &_CmdID_default_instance_);_Command_default_instance_._instance.DefaultConstruct();
   ::google::protobuf::internal::OnShutdownDestroyMessage(
@@ -286,6 +327,10 @@ void TableStruct::InitDefaultsImpl() {
       ::metapb::RangeEpoch::internal_default_instance());
   _SplitRequest_default_instance_._instance.get_mutable()->new_range_ = const_cast< ::metapb::Range*>(
       ::metapb::Range::internal_default_instance());
+  _MergeRequest_default_instance_._instance.get_mutable()->target_ = const_cast< ::metapb::Range*>(
+      ::metapb::Range::internal_default_instance());
+  _MergeRequest_default_instance_._instance.get_mutable()->source_ = const_cast< ::metapb::Range*>(
+      ::metapb::Range::internal_default_instance());
   _LeaderChangeRequest_default_instance_._instance.get_mutable()->epoch_ = const_cast< ::metapb::RangeEpoch*>(
       ::metapb::RangeEpoch::internal_default_instance());
   _Command_default_instance_._instance.get_mutable()->cmd_id_ = const_cast< ::raft_cmdpb::CmdID*>(
@@ -324,6 +369,10 @@ void TableStruct::InitDefaultsImpl() {
       ::kvrpcpb::KvBatchDeleteRequest::internal_default_instance());
   _Command_default_instance_._instance.get_mutable()->kv_range_del_req_ = const_cast< ::kvrpcpb::KvRangeDeleteRequest*>(
       ::kvrpcpb::KvRangeDeleteRequest::internal_default_instance());
+  _Command_default_instance_._instance.get_mutable()->kv_incr_req_ = const_cast< ::kvrpcpb::KvIncrRequest*>(
+      ::kvrpcpb::KvIncrRequest::internal_default_instance());
+  _Command_default_instance_._instance.get_mutable()->kv_append_req_ = const_cast< ::kvrpcpb::KvAppendRequest*>(
+      ::kvrpcpb::KvAppendRequest::internal_default_instance());
   _Command_default_instance_._instance.get_mutable()->admin_split_req_ = const_cast< ::raft_cmdpb::SplitRequest*>(
       ::raft_cmdpb::SplitRequest::internal_default_instance());
   _Command_default_instance_._instance.get_mutable()->admin_merge_req_ = const_cast< ::raft_cmdpb::MergeRequest*>(
@@ -338,6 +387,8 @@ void TableStruct::InitDefaultsImpl() {
       ::kvrpcpb::UnlockRequest::internal_default_instance());
   _Command_default_instance_._instance.get_mutable()->unlock_force_req_ = const_cast< ::kvrpcpb::UnlockForceRequest*>(
       ::kvrpcpb::UnlockForceRequest::internal_default_instance());
+  _Command_default_instance_._instance.get_mutable()->lock_reap_req_ = const_cast< ::raft_cmdpb::LockReapRequest*>(
+      ::raft_cmdpb::LockReapRequest::internal_default_instance());
   _PeerTask_default_instance_._instance.get_mutable()->verify_epoch_ = const_cast< ::metapb::RangeEpoch*>(
       ::metapb::RangeEpoch::internal_default_instance());
   _PeerTask_default_instance_._instance.get_mutable()->peer_ = const_cast< ::metapb::Peer*>(
@@ -358,61 +409,74 @@ void AddDescriptorsImpl() {
       "roto\032\rkvrpcpb.proto\"v\n\014SplitRequest\022\016\n\006l"
       "eader\030\001 \001(\004\022\021\n\tsplit_key\030\002 \001(\014\022!\n\005epoch\030"
       "\003 \001(\0132\022.metapb.RangeEpoch\022 \n\tnew_range\030\004"
-      " \001(\0132\r.metapb.Range\"\017\n\rSplitResponse\"\016\n\014"
-      "MergeRequest\"\017\n\rMergeResponse\"J\n\023LeaderC"
-      "hangeRequest\022\020\n\010range_id\030\001 \001(\004\022!\n\005epoch\030"
-      "\002 \001(\0132\022.metapb.RangeEpoch\"\026\n\024LeaderChang"
-      "eResponse\"%\n\005CmdID\022\017\n\007node_id\030\001 \001(\004\022\013\n\003s"
-      "eq\030\002 \001(\004\"\210\n\n\007Command\022!\n\006cmd_id\030\001 \001(\0132\021.r"
-      "aft_cmdpb.CmdID\022%\n\010cmd_type\030\002 \001(\0162\023.raft"
-      "_cmdpb.CmdType\022(\n\014verify_epoch\030\003 \001(\0132\022.m"
-      "etapb.RangeEpoch\0220\n\016kv_raw_get_req\030\004 \001(\013"
-      "2\030.kvrpcpb.KvRawGetRequest\0220\n\016kv_raw_put"
-      "_req\030\005 \001(\0132\030.kvrpcpb.KvRawPutRequest\0226\n\021"
-      "kv_raw_delete_req\030\006 \001(\0132\033.kvrpcpb.KvRawD"
-      "eleteRequest\0228\n\022kv_raw_execute_req\030\007 \001(\013"
-      "2\034.kvrpcpb.KvRawExecuteRequest\022*\n\nselect"
-      "_req\030\010 \001(\0132\026.kvrpcpb.SelectRequest\022*\n\nin"
-      "sert_req\030\t \001(\0132\026.kvrpcpb.InsertRequest\022*"
-      "\n\ndelete_req\030\n \001(\0132\026.kvrpcpb.DeleteReque"
-      "st\0225\n\020batch_insert_req\030\013 \001(\0132\033.kvrpcpb.B"
-      "atchInsertRequest\022)\n\nkv_set_req\030\014 \001(\0132\025."
-      "kvrpcpb.KvSetRequest\022)\n\nkv_get_req\030\r \001(\013"
-      "2\025.kvrpcpb.KvGetRequest\0224\n\020kv_batch_set_"
-      "req\030\016 \001(\0132\032.kvrpcpb.KvBatchSetRequest\0224\n"
-      "\020kv_batch_get_req\030\017 \001(\0132\032.kvrpcpb.KvBatc"
-      "hGetRequest\022+\n\013kv_scan_req\030\020 \001(\0132\026.kvrpc"
-      "pb.KvScanRequest\022/\n\rkv_delete_req\030\021 \001(\0132"
-      "\030.kvrpcpb.KvDeleteRequest\0227\n\020kv_batch_de"
-      "l_req\030\022 \001(\0132\035.kvrpcpb.KvBatchDeleteReque"
-      "st\0227\n\020kv_range_del_req\030\023 \001(\0132\035.kvrpcpb.K"
-      "vRangeDeleteRequest\0221\n\017admin_split_req\030\036"
-      " \001(\0132\030.raft_cmdpb.SplitRequest\0221\n\017admin_"
-      "merge_req\030\037 \001(\0132\030.raft_cmdpb.MergeReques"
-      "t\022@\n\027admin_leader_change_req\030  \001(\0132\037.raf"
-      "t_cmdpb.LeaderChangeRequest\022&\n\010lock_req\030"
-      "( \001(\0132\024.kvrpcpb.LockRequest\0223\n\017lock_upda"
-      "te_req\030) \001(\0132\032.kvrpcpb.LockUpdateRequest"
-      "\022*\n\nunlock_req\030* \001(\0132\026.kvrpcpb.UnlockReq"
-      "uest\0225\n\020unlock_force_req\030+ \001(\0132\033.kvrpcpb"
-      ".UnlockForceRequest\"P\n\010PeerTask\022(\n\014verif"
-      "y_epoch\030\001 \001(\0132\022.metapb.RangeEpoch\022\032\n\004pee"
-      "r\030\002 \001(\0132\014.metapb.Peer\",\n\016SnapshotKVPair\022"
-      "\013\n\003key\030\001 \001(\014\022\r\n\005value\030\002 \001(\014\".\n\017SnapshotC"
-      "ontext\022\033\n\004meta\030\001 \001(\0132\r.metapb.Range*\371\002\n\007"
-      "CmdType\022\013\n\007Invalid\020\000\022\n\n\006RawGet\020\001\022\n\n\006RawP"
-      "ut\020\002\022\r\n\tRawDelete\020\003\022\016\n\nRawExecute\020\004\022\n\n\006S"
-      "elect\020\007\022\n\n\006Insert\020\010\022\n\n\006Delete\020\t\022\n\n\006Updat"
-      "e\020\n\022\013\n\007Replace\020\013\022\017\n\013BatchInsert\020\014\022\t\n\005KvS"
-      "et\020\r\022\t\n\005KvGet\020\016\022\016\n\nKvBatchSet\020\017\022\016\n\nKvBat"
-      "chGet\020\020\022\n\n\006KvScan\020\021\022\014\n\010KvDelete\020\022\022\016\n\nKvB"
-      "atchDel\020\023\022\016\n\nKvRangeDel\020\024\022\016\n\nAdminSplit\020"
-      "\036\022\016\n\nAdminMerge\020\037\022\025\n\021AdminLeaderChange\020 "
-      "\022\010\n\004Lock\020(\022\016\n\nLockUpdate\020)\022\n\n\006Unlock\020*\022\017"
-      "\n\013UnlockForce\020+b\006proto3"
+      " \001(\0132\r.metapb.Range\"\017\n\rSplitResponse\"\\\n\014"
+      "MergeRequest\022\016\n\006commit\030\001 \001(\010\022\035\n\006target\030\002"
+      " \001(\0132\r.metapb.Range\022\035\n\006source\030\003 \001(\0132\r.me"
+      "tapb.Range\"\017\n\rMergeResponse\"J\n\023LeaderCha"
+      "ngeRequest\022\020\n\010range_id\030\001 \001(\004\022!\n\005epoch\030\002 "
+      "\001(\0132\022.metapb.RangeEpoch\"\026\n\024LeaderChangeR"
+      "esponse\"6\n\017LockReapRequest\022#\n\005locks\030\001 \003("
+      "\0132\024.raft_cmdpb.ReapLock\"#\n\010ReapLock\022\013\n\003k"
+      "ey\030\001 \001(\014\022\n\n\002id\030\002 \001(\t\"%\n\005CmdID\022\017\n\007node_id"
+      "\030\001 \001(\004\022\013\n\003seq\030\002 \001(\004\"\255\013\n\007Command\022!\n\006cmd_i"
+      "d\030\001 \001(\0132\021.raft_cmdpb.CmdID\022%\n\010cmd_type\030\002"
+      " \001(\0162\023.raft_cmdpb.CmdType\022(\n\014verify_epoc"
+      "h\030\003 \001(\0132\022.metapb.RangeEpoch\0220\n\016kv_raw_ge"
+      "t_req\030\004 \001(\0132\030.kvrpcpb.KvRawGetRequest\0220\n"
+      "\016kv_raw_put_req\030\005 \001(\0132\030.kvrpcpb.KvRawPut"
+      "Request\0226\n\021kv_raw_delete_req\030\006 \001(\0132\033.kvr"
+      "pcpb.KvRawDeleteRequest\0228\n\022kv_raw_execut"
+      "e_req\030\007 \001(\0132\034.kvrpcpb.KvRawExecuteReques"
+      "t\022*\n\nselect_req\030\010 \001(\0132\026.kvrpcpb.SelectRe"
+      "quest\022*\n\ninsert_req\030\t \001(\0132\026.kvrpcpb.Inse"
+      "rtRequest\022*\n\ndelete_req\030\n \001(\0132\026.kvrpcpb."
+      "DeleteRequest\0225\n\020batch_insert_req\030\013 \001(\0132"
+      "\033.kvrpcpb.BatchInsertRequest\022)\n\nkv_set_r"
+      "eq\030\014 \001(\0132\025.kvrpcpb.KvSetRequest\022)\n\nkv_ge"
+      "t_req\030\r \001(\0132\025.kvrpcpb.KvGetRequest\0224\n\020kv"
+      "_batch_set_req\030\016 \001(\0132\032.kvrpcpb.KvBatchSe"
+      "tRequest\0224\n\020kv_batch_get_req\030\017 \001(\0132\032.kvr"
+      "pcpb.KvBatchGetRequest\022+\n\013kv_scan_req\030\020 "
+      "\001(\0132\026.kvrpcpb.KvScanRequest\022/\n\rkv_delete"
+      "_req\030\021 \001(\0132\030.kvrpcpb.KvDeleteRequest\0227\n\020"
+      "kv_batch_del_req\030\022 \001(\0132\035.kvrpcpb.KvBatch"
+      "DeleteRequest\0227\n\020kv_range_del_req\030\023 \001(\0132"
+      "\035.kvrpcpb.KvRangeDeleteRequest\022+\n\013kv_inc"
+      "r_req\030\025 \001(\0132\026.kvrpcpb.KvIncrRequest\022/\n\rk"
+      "v_append_req\030\026 \001(\0132\030.kvrpcpb.KvAppendReq"
+      "uest\0221\n\017admin_split_req\030\036 \001(\0132\030.raft_cmd"
+      "pb.SplitRequest\0221\n\017admin_merge_req\030\037 \001(\013"
+      "2\030.raft_cmdpb.MergeRequest\022@\n\027admin_lead"
+      "er_change_req\030  \001(\0132\037.raft_cmdpb.LeaderC"
+      "hangeRequest\022&\n\010lock_req\030( \001(\0132\024.kvrpcpb"
+      ".LockRequest\0223\n\017lock_update_req\030) \001(\0132\032."
+      "kvrpcpb.LockUpdateRequest\022*\n\nunlock_req\030"
+      "* \001(\0132\026.kvrpcpb.UnlockRequest\0225\n\020unlock_"
+      "force_req\030+ \001(\0132\033.kvrpcpb.UnlockForceReq"
+      "uest\0222\n\rlock_reap_req\030, \001(\0132\033.raft_cmdpb"
+      ".LockReapRequest\022\021\n\texpire_at\0302 \001(\004\"P\n\010P"
+      "eerTask\022(\n\014verify_epoch\030\001 \001(\0132\022.metapb.R"
+      "angeEpoch\022\032\n\004peer\030\002 \001(\0132\014.metapb.Peer\",\n"
+      "\016SnapshotKVPair\022\013\n\003key\030\001 \001(\014\022\r\n\005value\030\002 "
+      "\001(\014\"e\n\017SnapshotContext\022\033\n\004meta\030\001 \001(\0132\r.m"
+      "etapb.Range\0225\n\014value_format\030\002 \001(\0162\037.raft"
+      "_cmdpb.SnapshotValueFormat*\241\003\n\007CmdType\022\013"
+      "\n\007Invalid\020\000\022\n\n\006RawGet\020\001\022\n\n\006RawPut\020\002\022\r\n\tR"
+      "awDelete\020\003\022\016\n\nRawExecute\020\004\022\n\n\006Select\020\007\022\n"
+      "\n\006Insert\020\010\022\n\n\006Delete\020\t\022\n\n\006Update\020\n\022\013\n\007Re"
+      "place\020\013\022\017\n\013BatchInsert\020\014\022\t\n\005KvSet\020\r\022\t\n\005K"
+      "vGet\020\016\022\016\n\nKvBatchSet\020\017\022\016\n\nKvBatchGet\020\020\022\n"
+      "\n\006KvScan\020\021\022\014\n\010KvDelete\020\022\022\016\n\nKvBatchDel\020\023"
+      "\022\016\n\nKvRangeDel\020\024\022\n\n\006KvIncr\020\026\022\014\n\010KvAppend"
+      "\020\027\022\016\n\nAdminSplit\020\036\022\016\n\nAdminMerge\020\037\022\025\n\021Ad"
+      "minLeaderChange\020 \022\010\n\004Lock\020(\022\016\n\nLockUpdat"
+      "e\020)\022\n\n\006Unlock\020*\022\017\n\013UnlockForce\020+\022\014\n\010Lock"
+      "Reap\020,*F\n\023SnapshotValueFormat\022\017\n\013SVF_Unk"
+      "nown\020\000\022\013\n\007SVF_Raw\020\001\022\021\n\rSVF_TtlHeader\020\002b\006"
+      "proto3"
   };
   ::google::protobuf::DescriptorPool::InternalAddGeneratedFile(
-      descriptor, 2223);
+      descriptor, 2726);
   ::google::protobuf::MessageFactory::InternalRegisterGeneratedFile(
     "raft_cmdpb.proto", &protobuf_RegisterTypes);
   ::metapb::protobuf_metapb_2eproto::AddDescriptors();
@@ -458,6 +522,8 @@ bool CmdType_IsValid(int value) {
     case 18:
     case 19:
     case 20:
+    case 22:
+    case 23:
     case 30:
     case 31:
     case 32:
@@ -465,6 +531,22 @@ bool CmdType_IsValid(int value) {
     case 41:
     case 42:
     case 43:
+    case 44:
+      return true;
+    default:
+      return false;
+  }
+}
+
+const ::google::protobuf::EnumDescriptor* SnapshotValueFormat_descriptor() {
+  protobuf_raft_5fcmdpb_2eproto::protobuf_AssignDescriptorsOnce();
+  return protobuf_raft_5fcmdpb_2eproto::file_level_enum_descriptors[1];
+}
+bool SnapshotValueFormat_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
       return true;
     default:
       return false;
@@ -1199,6 +1281,9 @@ void SplitResponse::InternalSwap(SplitResponse* other) {
 // ===================================================================
 
 #if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int MergeRequest::kCommitFieldNumber;
+const int MergeRequest::kTargetFieldNumber;
+const int MergeRequest::kSourceFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
 MergeRequest::MergeRequest()
@@ -1214,10 +1299,24 @@ MergeRequest::MergeRequest(const MergeRequest& from)
       _internal_metadata_(NULL),
       _cached_size_(0) {
   _internal_metadata_.MergeFrom(from._internal_metadata_);
+  if (from.has_target()) {
+    target_ = new ::metapb::Range(*from.target_);
+  } else {
+    target_ = NULL;
+  }
+  if (from.has_source()) {
+    source_ = new ::metapb::Range(*from.source_);
+  } else {
+    source_ = NULL;
+  }
+  commit_ = from.commit_;
   // @@protoc_insertion_point(copy_constructor:raft_cmdpb.MergeRequest)
 }
 
 void MergeRequest::SharedCtor() {
+  ::memset(&target_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&commit_) -
+      reinterpret_cast<char*>(&target_)) + sizeof(commit_));
   _cached_size_ = 0;
 }
 
@@ -1227,6 +1326,8 @@ MergeRequest::~MergeRequest() {
 }
 
 void MergeRequest::SharedDtor() {
+  if (this != internal_default_instance()) delete target_;
+  if (this != internal_default_instance()) delete source_;
 }
 
 void MergeRequest::SetCachedSize(int size) const {
@@ -1258,6 +1359,15 @@ void MergeRequest::Clear() {
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
+  if (GetArenaNoVirtual() == NULL && target_ != NULL) {
+    delete target_;
+  }
+  target_ = NULL;
+  if (GetArenaNoVirtual() == NULL && source_ != NULL) {
+    delete source_;
+  }
+  source_ = NULL;
+  commit_ = false;
   _internal_metadata_.Clear();
 }
 
@@ -1270,12 +1380,55 @@ bool MergeRequest::MergePartialFromCodedStream(
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
     tag = p.first;
     if (!p.second) goto handle_unusual;
-  handle_unusual:
-    if (tag == 0) {
-      goto success;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // bool commit = 1;
+      case 1: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(8u /* 8 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
+                 input, &commit_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // .metapb.Range target = 2;
+      case 2: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(18u /* 18 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_target()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // .metapb.Range source = 3;
+      case 3: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(26u /* 26 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_source()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, _internal_metadata_.mutable_unknown_fields()));
+        break;
+      }
     }
-    DO_(::google::protobuf::internal::WireFormat::SkipField(
-          input, tag, _internal_metadata_.mutable_unknown_fields()));
   }
 success:
   // @@protoc_insertion_point(parse_success:raft_cmdpb.MergeRequest)
@@ -1292,6 +1445,23 @@ void MergeRequest::SerializeWithCachedSizes(
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
+  // bool commit = 1;
+  if (this->commit() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteBool(1, this->commit(), output);
+  }
+
+  // .metapb.Range target = 2;
+  if (this->has_target()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      2, *this->target_, output);
+  }
+
+  // .metapb.Range source = 3;
+  if (this->has_source()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      3, *this->source_, output);
+  }
+
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
     ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
@@ -1306,6 +1476,25 @@ void MergeRequest::SerializeWithCachedSizes(
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
+  // bool commit = 1;
+  if (this->commit() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(1, this->commit(), target);
+  }
+
+  // .metapb.Range target = 2;
+  if (this->has_target()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      InternalWriteMessageNoVirtualToArray(
+        2, *this->target_, deterministic, target);
+  }
+
+  // .metapb.Range source = 3;
+  if (this->has_source()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      InternalWriteMessageNoVirtualToArray(
+        3, *this->source_, deterministic, target);
+  }
+
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
     target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
@@ -1323,6 +1512,25 @@ size_t MergeRequest::ByteSizeLong() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
   }
+  // .metapb.Range target = 2;
+  if (this->has_target()) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+        *this->target_);
+  }
+
+  // .metapb.Range source = 3;
+  if (this->has_source()) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+        *this->source_);
+  }
+
+  // bool commit = 1;
+  if (this->commit() != 0) {
+    total_size += 1 + 1;
+  }
+
   int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = cached_size;
@@ -1352,6 +1560,15 @@ void MergeRequest::MergeFrom(const MergeRequest& from) {
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
+  if (from.has_target()) {
+    mutable_target()->::metapb::Range::MergeFrom(from.target());
+  }
+  if (from.has_source()) {
+    mutable_source()->::metapb::Range::MergeFrom(from.source());
+  }
+  if (from.commit() != 0) {
+    set_commit(from.commit());
+  }
 }
 
 void MergeRequest::CopyFrom(const ::google::protobuf::Message& from) {
@@ -1378,6 +1595,9 @@ void MergeRequest::Swap(MergeRequest* other) {
 }
 void MergeRequest::InternalSwap(MergeRequest* other) {
   using std::swap;
+  swap(target_, other->target_);
+  swap(source_, other->source_);
+  swap(commit_, other->commit_);
   _internal_metadata_.Swap(&other->_internal_metadata_);
   swap(_cached_size_, other->_cached_size_);
 }
@@ -1390,6 +1610,100 @@ void MergeRequest::InternalSwap(MergeRequest* other) {
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
 // MergeRequest
 
+// bool commit = 1;
+void MergeRequest::clear_commit() {
+  commit_ = false;
+}
+bool MergeRequest::commit() const {
+  // @@protoc_insertion_point(field_get:raft_cmdpb.MergeRequest.commit)
+  return commit_;
+}
+void MergeRequest::set_commit(bool value) {
+  
+  commit_ = value;
+  // @@protoc_insertion_point(field_set:raft_cmdpb.MergeRequest.commit)
+}
+
+// .metapb.Range target = 2;
+bool MergeRequest::has_target() const {
+  return this != internal_default_instance() && target_ != NULL;
+}
+void MergeRequest::clear_target() {
+  if (GetArenaNoVirtual() == NULL && target_ != NULL) delete target_;
+  target_ = NULL;
+}
+const ::metapb::Range& MergeRequest::target() const {
+  const ::metapb::Range* p = target_;
+  // @@protoc_insertion_point(field_get:raft_cmdpb.MergeRequest.target)
+  return p != NULL ? *p : *reinterpret_cast<const ::metapb::Range*>(
+      &::metapb::_Range_default_instance_);
+}
+::metapb::Range* MergeRequest::mutable_target() {
+  
+  if (target_ == NULL) {
+    target_ = new ::metapb::Range;
+  }
+  // @@protoc_insertion_point(field_mutable:raft_cmdpb.MergeRequest.target)
+  return target_;
+}
+::metapb::Range* MergeRequest::release_target() {
+  // @@protoc_insertion_point(field_release:raft_cmdpb.MergeRequest.target)
+  
+  ::metapb::Range* temp = target_;
+  target_ = NULL;
+  return temp;
+}
+void MergeRequest::set_allocated_target(::metapb::Range* target) {
+  delete target_;
+  target_ = target;
+  if (target) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_set_allocated:raft_cmdpb.MergeRequest.target)
+}
+
+// .metapb.Range source = 3;
+bool MergeRequest::has_source() const {
+  return this != internal_default_instance() && source_ != NULL;
+}
+void MergeRequest::clear_source() {
+  if (GetArenaNoVirtual() == NULL && source_ != NULL) delete source_;
+  source_ = NULL;
+}
+const ::metapb::Range& MergeRequest::source() const {
+  const ::metapb::Range* p = source_;
+  // @@protoc_insertion_point(field_get:raft_cmdpb.MergeRequest.source)
+  return p != NULL ? *p : *reinterpret_cast<const ::metapb::Range*>(
+      &::metapb::_Range_default_instance_);
+}
+::metapb::Range* MergeRequest::mutable_source() {
+  
+  if (source_ == NULL) {
+    source_ = new ::metapb::Range;
+  }
+  // @@protoc_insertion_point(field_mutable:raft_cmdpb.MergeRequest.source)
+  return source_;
+}
+::metapb::Range* MergeRequest::release_source() {
+  // @@protoc_insertion_point(field_release:raft_cmdpb.MergeRequest.source)
+  
+  ::metapb::Range* temp = source_;
+  source_ = NULL;
+  return temp;
+}
+void MergeRequest::set_allocated_source(::metapb::Range* source) {
+  delete source_;
+  source_ = source;
+  if (source) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_set_allocated:raft_cmdpb.MergeRequest.source)
+}
+
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
 
 // ===================================================================
@@ -2065,65 +2379,748 @@ size_t LeaderChangeResponse::ByteSizeLong() const {
   return total_size;
 }
 
-void LeaderChangeResponse::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:raft_cmdpb.LeaderChangeResponse)
+void LeaderChangeResponse::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:raft_cmdpb.LeaderChangeResponse)
+  GOOGLE_DCHECK_NE(&from, this);
+  const LeaderChangeResponse* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const LeaderChangeResponse>(
+          &from);
+  if (source == NULL) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:raft_cmdpb.LeaderChangeResponse)
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:raft_cmdpb.LeaderChangeResponse)
+    MergeFrom(*source);
+  }
+}
+
+void LeaderChangeResponse::MergeFrom(const LeaderChangeResponse& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:raft_cmdpb.LeaderChangeResponse)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+}
+
+void LeaderChangeResponse::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:raft_cmdpb.LeaderChangeResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void LeaderChangeResponse::CopyFrom(const LeaderChangeResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:raft_cmdpb.LeaderChangeResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool LeaderChangeResponse::IsInitialized() const {
+  return true;
+}
+
+void LeaderChangeResponse::Swap(LeaderChangeResponse* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void LeaderChangeResponse::InternalSwap(LeaderChangeResponse* other) {
+  using std::swap;
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  swap(_cached_size_, other->_cached_size_);
+}
+
+::google::protobuf::Metadata LeaderChangeResponse::GetMetadata() const {
+  protobuf_raft_5fcmdpb_2eproto::protobuf_AssignDescriptorsOnce();
+  return protobuf_raft_5fcmdpb_2eproto::file_level_metadata[kIndexInFileMessages];
+}
+
+#if PROTOBUF_INLINE_NOT_IN_HEADERS
+// LeaderChangeResponse
+
+#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
+
+// ===================================================================
+
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int LockReapRequest::kLocksFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+LockReapRequest::LockReapRequest()
+  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
+  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
+    protobuf_raft_5fcmdpb_2eproto::InitDefaults();
+  }
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:raft_cmdpb.LockReapRequest)
+}
+LockReapRequest::LockReapRequest(const LockReapRequest& from)
+  : ::google::protobuf::Message(),
+      _internal_metadata_(NULL),
+      locks_(from.locks_),
+      _cached_size_(0) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:raft_cmdpb.LockReapRequest)
+}
+
+void LockReapRequest::SharedCtor() {
+  _cached_size_ = 0;
+}
+
+LockReapRequest::~LockReapRequest() {
+  // @@protoc_insertion_point(destructor:raft_cmdpb.LockReapRequest)
+  SharedDtor();
+}
+
+void LockReapRequest::SharedDtor() {
+}
+
+void LockReapRequest::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* LockReapRequest::descriptor() {
+  protobuf_raft_5fcmdpb_2eproto::protobuf_AssignDescriptorsOnce();
+  return protobuf_raft_5fcmdpb_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
+}
+
+const LockReapRequest& LockReapRequest::default_instance() {
+  protobuf_raft_5fcmdpb_2eproto::InitDefaults();
+  return *internal_default_instance();
+}
+
+LockReapRequest* LockReapRequest::New(::google::protobuf::Arena* arena) const {
+  LockReapRequest* n = new LockReapRequest;
+  if (arena != NULL) {
+    arena->Own(n);
+  }
+  return n;
+}
+
+void LockReapRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:raft_cmdpb.LockReapRequest)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  locks_.Clear();
+  _internal_metadata_.Clear();
+}
+
+bool LockReapRequest::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  // @@protoc_insertion_point(parse_start:raft_cmdpb.LockReapRequest)
+  for (;;) {
+    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // repeated .raft_cmdpb.ReapLock locks = 1;
+      case 1: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+                input, add_locks()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, _internal_metadata_.mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:raft_cmdpb.LockReapRequest)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:raft_cmdpb.LockReapRequest)
+  return false;
+#undef DO_
+}
+
+void LockReapRequest::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:raft_cmdpb.LockReapRequest)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .raft_cmdpb.ReapLock locks = 1;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->locks_size()); i < n; i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      1, this->locks(static_cast<int>(i)), output);
+  }
+
+  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
+  }
+  // @@protoc_insertion_point(serialize_end:raft_cmdpb.LockReapRequest)
+}
+
+::google::protobuf::uint8* LockReapRequest::InternalSerializeWithCachedSizesToArray(
+    bool deterministic, ::google::protobuf::uint8* target) const {
+  (void)deterministic; // Unused
+  // @@protoc_insertion_point(serialize_to_array_start:raft_cmdpb.LockReapRequest)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .raft_cmdpb.ReapLock locks = 1;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->locks_size()); i < n; i++) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      InternalWriteMessageNoVirtualToArray(
+        1, this->locks(static_cast<int>(i)), deterministic, target);
+  }
+
+  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:raft_cmdpb.LockReapRequest)
+  return target;
+}
+
+size_t LockReapRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:raft_cmdpb.LockReapRequest)
+  size_t total_size = 0;
+
+  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
+  }
+  // repeated .raft_cmdpb.ReapLock locks = 1;
+  {
+    unsigned int count = static_cast<unsigned int>(this->locks_size());
+    total_size += 1UL * count;
+    for (unsigned int i = 0; i < count; i++) {
+      total_size +=
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->locks(static_cast<int>(i)));
+    }
+  }
+
+  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = cached_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void LockReapRequest::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:raft_cmdpb.LockReapRequest)
+  GOOGLE_DCHECK_NE(&from, this);
+  const LockReapRequest* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const LockReapRequest>(
+          &from);
+  if (source == NULL) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:raft_cmdpb.LockReapRequest)
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:raft_cmdpb.LockReapRequest)
+    MergeFrom(*source);
+  }
+}
+
+void LockReapRequest::MergeFrom(const LockReapRequest& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:raft_cmdpb.LockReapRequest)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  locks_.MergeFrom(from.locks_);
+}
+
+void LockReapRequest::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:raft_cmdpb.LockReapRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void LockReapRequest::CopyFrom(const LockReapRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:raft_cmdpb.LockReapRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool LockReapRequest::IsInitialized() const {
+  return true;
+}
+
+void LockReapRequest::Swap(LockReapRequest* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void LockReapRequest::InternalSwap(LockReapRequest* other) {
+  using std::swap;
+  locks_.InternalSwap(&other->locks_);
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  swap(_cached_size_, other->_cached_size_);
+}
+
+::google::protobuf::Metadata LockReapRequest::GetMetadata() const {
+  protobuf_raft_5fcmdpb_2eproto::protobuf_AssignDescriptorsOnce();
+  return protobuf_raft_5fcmdpb_2eproto::file_level_metadata[kIndexInFileMessages];
+}
+
+#if PROTOBUF_INLINE_NOT_IN_HEADERS
+// LockReapRequest
+
+// repeated .raft_cmdpb.ReapLock locks = 1;
+int LockReapRequest::locks_size() const {
+  return locks_.size();
+}
+void LockReapRequest::clear_locks() {
+  locks_.Clear();
+}
+const ::raft_cmdpb::ReapLock& LockReapRequest::locks(int index) const {
+  // @@protoc_insertion_point(field_get:raft_cmdpb.LockReapRequest.locks)
+  return locks_.Get(index);
+}
+::raft_cmdpb::ReapLock* LockReapRequest::mutable_locks(int index) {
+  // @@protoc_insertion_point(field_mutable:raft_cmdpb.LockReapRequest.locks)
+  return locks_.Mutable(index);
+}
+::raft_cmdpb::ReapLock* LockReapRequest::add_locks() {
+  // @@protoc_insertion_point(field_add:raft_cmdpb.LockReapRequest.locks)
+  return locks_.Add();
+}
+::google::protobuf::RepeatedPtrField< ::raft_cmdpb::ReapLock >*
+LockReapRequest::mutable_locks() {
+  // @@protoc_insertion_point(field_mutable_list:raft_cmdpb.LockReapRequest.locks)
+  return &locks_;
+}
+const ::google::protobuf::RepeatedPtrField< ::raft_cmdpb::ReapLock >&
+LockReapRequest::locks() const {
+  // @@protoc_insertion_point(field_list:raft_cmdpb.LockReapRequest.locks)
+  return locks_;
+}
+
+#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
+
+// ===================================================================
+
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int ReapLock::kKeyFieldNumber;
+const int ReapLock::kIdFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+ReapLock::ReapLock()
+  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
+  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
+    protobuf_raft_5fcmdpb_2eproto::InitDefaults();
+  }
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:raft_cmdpb.ReapLock)
+}
+ReapLock::ReapLock(const ReapLock& from)
+  : ::google::protobuf::Message(),
+      _internal_metadata_(NULL),
+      _cached_size_(0) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  key_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (from.key().size() > 0) {
+    key_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.key_);
+  }
+  id_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (from.id().size() > 0) {
+    id_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.id_);
+  }
+  // @@protoc_insertion_point(copy_constructor:raft_cmdpb.ReapLock)
+}
+
+void ReapLock::SharedCtor() {
+  key_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  id_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _cached_size_ = 0;
+}
+
+ReapLock::~ReapLock() {
+  // @@protoc_insertion_point(destructor:raft_cmdpb.ReapLock)
+  SharedDtor();
+}
+
+void ReapLock::SharedDtor() {
+  key_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  id_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+
+void ReapLock::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* ReapLock::descriptor() {
+  protobuf_raft_5fcmdpb_2eproto::protobuf_AssignDescriptorsOnce();
+  return protobuf_raft_5fcmdpb_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
+}
+
+const ReapLock& ReapLock::default_instance() {
+  protobuf_raft_5fcmdpb_2eproto::InitDefaults();
+  return *internal_default_instance();
+}
+
+ReapLock* ReapLock::New(::google::protobuf::Arena* arena) const {
+  ReapLock* n = new ReapLock;
+  if (arena != NULL) {
+    arena->Own(n);
+  }
+  return n;
+}
+
+void ReapLock::Clear() {
+// @@protoc_insertion_point(message_clear_start:raft_cmdpb.ReapLock)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  key_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  id_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _internal_metadata_.Clear();
+}
+
+bool ReapLock::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  // @@protoc_insertion_point(parse_start:raft_cmdpb.ReapLock)
+  for (;;) {
+    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // bytes key = 1;
+      case 1: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
+                input, this->mutable_key()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // string id = 2;
+      case 2: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(18u /* 18 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_id()));
+          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+            this->id().data(), static_cast<int>(this->id().length()),
+            ::google::protobuf::internal::WireFormatLite::PARSE,
+            "raft_cmdpb.ReapLock.id"));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, _internal_metadata_.mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:raft_cmdpb.ReapLock)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:raft_cmdpb.ReapLock)
+  return false;
+#undef DO_
+}
+
+void ReapLock::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:raft_cmdpb.ReapLock)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bytes key = 1;
+  if (this->key().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteBytesMaybeAliased(
+      1, this->key(), output);
+  }
+
+  // string id = 2;
+  if (this->id().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+      this->id().data(), static_cast<int>(this->id().length()),
+      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+      "raft_cmdpb.ReapLock.id");
+    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
+      2, this->id(), output);
+  }
+
+  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
+  }
+  // @@protoc_insertion_point(serialize_end:raft_cmdpb.ReapLock)
+}
+
+::google::protobuf::uint8* ReapLock::InternalSerializeWithCachedSizesToArray(
+    bool deterministic, ::google::protobuf::uint8* target) const {
+  (void)deterministic; // Unused
+  // @@protoc_insertion_point(serialize_to_array_start:raft_cmdpb.ReapLock)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bytes key = 1;
+  if (this->key().size() > 0) {
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteBytesToArray(
+        1, this->key(), target);
+  }
+
+  // string id = 2;
+  if (this->id().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+      this->id().data(), static_cast<int>(this->id().length()),
+      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+      "raft_cmdpb.ReapLock.id");
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        2, this->id(), target);
+  }
+
+  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:raft_cmdpb.ReapLock)
+  return target;
+}
+
+size_t ReapLock::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:raft_cmdpb.ReapLock)
+  size_t total_size = 0;
+
+  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
+  }
+  // bytes key = 1;
+  if (this->key().size() > 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::BytesSize(
+        this->key());
+  }
+
+  // string id = 2;
+  if (this->id().size() > 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::StringSize(
+        this->id());
+  }
+
+  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = cached_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void ReapLock::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:raft_cmdpb.ReapLock)
   GOOGLE_DCHECK_NE(&from, this);
-  const LeaderChangeResponse* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const LeaderChangeResponse>(
+  const ReapLock* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const ReapLock>(
           &from);
   if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:raft_cmdpb.LeaderChangeResponse)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:raft_cmdpb.ReapLock)
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:raft_cmdpb.LeaderChangeResponse)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:raft_cmdpb.ReapLock)
     MergeFrom(*source);
   }
 }
 
-void LeaderChangeResponse::MergeFrom(const LeaderChangeResponse& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:raft_cmdpb.LeaderChangeResponse)
+void ReapLock::MergeFrom(const ReapLock& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:raft_cmdpb.ReapLock)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
+  if (from.key().size() > 0) {
+
+    key_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.key_);
+  }
+  if (from.id().size() > 0) {
+
+    id_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.id_);
+  }
 }
 
-void LeaderChangeResponse::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:raft_cmdpb.LeaderChangeResponse)
+void ReapLock::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:raft_cmdpb.ReapLock)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void LeaderChangeResponse::CopyFrom(const LeaderChangeResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:raft_cmdpb.LeaderChangeResponse)
+void ReapLock::CopyFrom(const ReapLock& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:raft_cmdpb.ReapLock)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool LeaderChangeResponse::IsInitialized() const {
+bool ReapLock::IsInitialized() const {
   return true;
 }
 
-void LeaderChangeResponse::Swap(LeaderChangeResponse* other) {
+void ReapLock::Swap(ReapLock* other) {
   if (other == this) return;
   InternalSwap(other);
 }
-void LeaderChangeResponse::InternalSwap(LeaderChangeResponse* other) {
+void ReapLock::InternalSwap(ReapLock* other) {
   using std::swap;
+  key_.Swap(&other->key_);
+  id_.Swap(&other->id_);
   _internal_metadata_.Swap(&other->_internal_metadata_);
   swap(_cached_size_, other->_cached_size_);
 }
 
-::google::protobuf::Metadata LeaderChangeResponse::GetMetadata() const {
+::google::protobuf::Metadata ReapLock::GetMetadata() const {
   protobuf_raft_5fcmdpb_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_raft_5fcmdpb_2eproto::file_level_metadata[kIndexInFileMessages];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
-// LeaderChangeResponse
+// ReapLock
+
+// bytes key = 1;
+void ReapLock::clear_key() {
+  key_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+const ::std::string& ReapLock::key() const {
+  // @@protoc_insertion_point(field_get:raft_cmdpb.ReapLock.key)
+  return key_.GetNoArena();
+}
+void ReapLock::set_key(const ::std::string& value) {
+  
+  key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:raft_cmdpb.ReapLock.key)
+}
+#if LANG_CXX11
+void ReapLock::set_key(::std::string&& value) {
+  
+  key_.SetNoArena(
+    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:raft_cmdpb.ReapLock.key)
+}
+#endif
+void ReapLock::set_key(const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  
+  key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:raft_cmdpb.ReapLock.key)
+}
+void ReapLock::set_key(const void* value, size_t size) {
+  
+  key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:raft_cmdpb.ReapLock.key)
+}
+::std::string* ReapLock::mutable_key() {
+  
+  // @@protoc_insertion_point(field_mutable:raft_cmdpb.ReapLock.key)
+  return key_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+::std::string* ReapLock::release_key() {
+  // @@protoc_insertion_point(field_release:raft_cmdpb.ReapLock.key)
+  
+  return key_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+void ReapLock::set_allocated_key(::std::string* key) {
+  if (key != NULL) {
+    
+  } else {
+    
+  }
+  key_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), key);
+  // @@protoc_insertion_point(field_set_allocated:raft_cmdpb.ReapLock.key)
+}
+
+// string id = 2;
+void ReapLock::clear_id() {
+  id_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+const ::std::string& ReapLock::id() const {
+  // @@protoc_insertion_point(field_get:raft_cmdpb.ReapLock.id)
+  return id_.GetNoArena();
+}
+void ReapLock::set_id(const ::std::string& value) {
+  
+  id_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:raft_cmdpb.ReapLock.id)
+}
+#if LANG_CXX11
+void ReapLock::set_id(::std::string&& value) {
+  
+  id_.SetNoArena(
+    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:raft_cmdpb.ReapLock.id)
+}
+#endif
+void ReapLock::set_id(const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  
+  id_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:raft_cmdpb.ReapLock.id)
+}
+void ReapLock::set_id(const char* value, size_t size) {
+  
+  id_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:raft_cmdpb.ReapLock.id)
+}
+::std::string* ReapLock::mutable_id() {
+  
+  // @@protoc_insertion_point(field_mutable:raft_cmdpb.ReapLock.id)
+  return id_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+::std::string* ReapLock::release_id() {
+  // @@protoc_insertion_point(field_release:raft_cmdpb.ReapLock.id)
+  
+  return id_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+void ReapLock::set_allocated_id(::std::string* id) {
+  if (id != NULL) {
+    
+  } else {
+    
+  }
+  id_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), id);
+  // @@protoc_insertion_point(field_set_allocated:raft_cmdpb.ReapLock.id)
+}
 
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
 
@@ -2459,6 +3456,8 @@ const int Command::kKvScanReqFieldNumber;
 const int Command::kKvDeleteReqFieldNumber;
 const int Command::kKvBatchDelReqFieldNumber;
 const int Command::kKvRangeDelReqFieldNumber;
+const int Command::kKvIncrReqFieldNumber;
+const int Command::kKvAppendReqFieldNumber;
 const int Command::kAdminSplitReqFieldNumber;
 const int Command::kAdminMergeReqFieldNumber;
 const int Command::kAdminLeaderChangeReqFieldNumber;
@@ -2466,6 +3465,8 @@ const int Command::kLockReqFieldNumber;
 const int Command::kLockUpdateReqFieldNumber;
 const int Command::kUnlockReqFieldNumber;
 const int Command::kUnlockForceReqFieldNumber;
+const int Command::kLockReapReqFieldNumber;
+const int Command::kExpireAtFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
 Command::Command()
@@ -2571,6 +3572,16 @@ Command::Command(const Command& from)
   } else {
     kv_range_del_req_ = NULL;
   }
+  if (from.has_kv_incr_req()) {
+    kv_incr_req_ = new ::kvrpcpb::KvIncrRequest(*from.kv_incr_req_);
+  } else {
+    kv_incr_req_ = NULL;
+  }
+  if (from.has_kv_append_req()) {
+    kv_append_req_ = new ::kvrpcpb::KvAppendRequest(*from.kv_append_req_);
+  } else {
+    kv_append_req_ = NULL;
+  }
   if (from.has_admin_split_req()) {
     admin_split_req_ = new ::raft_cmdpb::SplitRequest(*from.admin_split_req_);
   } else {
@@ -2606,7 +3617,14 @@ Command::Command(const Command& from)
   } else {
     unlock_force_req_ = NULL;
   }
-  cmd_type_ = from.cmd_type_;
+  if (from.has_lock_reap_req()) {
+    lock_reap_req_ = new ::raft_cmdpb::LockReapRequest(*from.lock_reap_req_);
+  } else {
+    lock_reap_req_ = NULL;
+  }
+  ::memcpy(&expire_at_, &from.expire_at_,
+    static_cast<size_t>(reinterpret_cast<char*>(&cmd_type_) -
+    reinterpret_cast<char*>(&expire_at_)) + sizeof(cmd_type_));
   // @@protoc_insertion_point(copy_constructor:raft_cmdpb.Command)
 }
 
@@ -2641,6 +3659,8 @@ void Command::SharedDtor() {
   if (this != internal_default_instance()) delete kv_delete_req_;
   if (this != internal_default_instance()) delete kv_batch_del_req_;
   if (this != internal_default_instance()) delete kv_range_del_req_;
+  if (this != internal_default_instance()) delete kv_incr_req_;
+  if (this != internal_default_instance()) delete kv_append_req_;
   if (this != internal_default_instance()) delete admin_split_req_;
   if (this != internal_default_instance()) delete admin_merge_req_;
   if (this != internal_default_instance()) delete admin_leader_change_req_;
@@ -2648,6 +3668,7 @@ void Command::SharedDtor() {
   if (this != internal_default_instance()) delete lock_update_req_;
   if (this != internal_default_instance()) delete unlock_req_;
   if (this != internal_default_instance()) delete unlock_force_req_;
+  if (this != internal_default_instance()) delete lock_reap_req_;
 }
 
 void Command::SetCachedSize(int size) const {
@@ -2751,6 +3772,14 @@ void Command::Clear() {
     delete kv_range_del_req_;
   }
   kv_range_del_req_ = NULL;
+  if (GetArenaNoVirtual() == NULL && kv_incr_req_ != NULL) {
+    delete kv_incr_req_;
+  }
+  kv_incr_req_ = NULL;
+  if (GetArenaNoVirtual() == NULL && kv_append_req_ != NULL) {
+    delete kv_append_req_;
+  }
+  kv_append_req_ = NULL;
   if (GetArenaNoVirtual() == NULL && admin_split_req_ != NULL) {
     delete admin_split_req_;
   }
@@ -2779,7 +3808,13 @@ void Command::Clear() {
     delete unlock_force_req_;
   }
   unlock_force_req_ = NULL;
-  cmd_type_ = 0;
+  if (GetArenaNoVirtual() == NULL && lock_reap_req_ != NULL) {
+    delete lock_reap_req_;
+  }
+  lock_reap_req_ = NULL;
+  ::memset(&expire_at_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&cmd_type_) -
+      reinterpret_cast<char*>(&expire_at_)) + sizeof(cmd_type_));
   _internal_metadata_.Clear();
 }
 
@@ -3024,6 +4059,30 @@ bool Command::MergePartialFromCodedStream(
         break;
       }
 
+      // .kvrpcpb.KvIncrRequest kv_incr_req = 21;
+      case 21: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(170u /* 170 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_kv_incr_req()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // .kvrpcpb.KvAppendRequest kv_append_req = 22;
+      case 22: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(178u /* 178 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_kv_append_req()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
       // .raft_cmdpb.SplitRequest admin_split_req = 30;
       case 30: {
         if (static_cast< ::google::protobuf::uint8>(tag) ==
@@ -3108,6 +4167,32 @@ bool Command::MergePartialFromCodedStream(
         break;
       }
 
+      // .raft_cmdpb.LockReapRequest lock_reap_req = 44;
+      case 44: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(98u /* 354 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_lock_reap_req()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint64 expire_at = 50;
+      case 50: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(144u /* 400 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &expire_at_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
       default: {
       handle_unusual:
         if (tag == 0) {
@@ -3248,6 +4333,18 @@ void Command::SerializeWithCachedSizes(
       19, *this->kv_range_del_req_, output);
   }
 
+  // .kvrpcpb.KvIncrRequest kv_incr_req = 21;
+  if (this->has_kv_incr_req()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      21, *this->kv_incr_req_, output);
+  }
+
+  // .kvrpcpb.KvAppendRequest kv_append_req = 22;
+  if (this->has_kv_append_req()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      22, *this->kv_append_req_, output);
+  }
+
   // .raft_cmdpb.SplitRequest admin_split_req = 30;
   if (this->has_admin_split_req()) {
     ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
@@ -3290,6 +4387,17 @@ void Command::SerializeWithCachedSizes(
       43, *this->unlock_force_req_, output);
   }
 
+  // .raft_cmdpb.LockReapRequest lock_reap_req = 44;
+  if (this->has_lock_reap_req()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      44, *this->lock_reap_req_, output);
+  }
+
+  // uint64 expire_at = 50;
+  if (this->expire_at() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(50, this->expire_at(), output);
+  }
+
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
     ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
@@ -3436,6 +4544,20 @@ void Command::SerializeWithCachedSizes(
         19, *this->kv_range_del_req_, deterministic, target);
   }
 
+  // .kvrpcpb.KvIncrRequest kv_incr_req = 21;
+  if (this->has_kv_incr_req()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      InternalWriteMessageNoVirtualToArray(
+        21, *this->kv_incr_req_, deterministic, target);
+  }
+
+  // .kvrpcpb.KvAppendRequest kv_append_req = 22;
+  if (this->has_kv_append_req()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      InternalWriteMessageNoVirtualToArray(
+        22, *this->kv_append_req_, deterministic, target);
+  }
+
   // .raft_cmdpb.SplitRequest admin_split_req = 30;
   if (this->has_admin_split_req()) {
     target = ::google::protobuf::internal::WireFormatLite::
@@ -3485,6 +4607,18 @@ void Command::SerializeWithCachedSizes(
         43, *this->unlock_force_req_, deterministic, target);
   }
 
+  // .raft_cmdpb.LockReapRequest lock_reap_req = 44;
+  if (this->has_lock_reap_req()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      InternalWriteMessageNoVirtualToArray(
+        44, *this->lock_reap_req_, deterministic, target);
+  }
+
+  // uint64 expire_at = 50;
+  if (this->expire_at() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(50, this->expire_at(), target);
+  }
+
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
     target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
@@ -3628,6 +4762,20 @@ size_t Command::ByteSizeLong() const {
         *this->kv_range_del_req_);
   }
 
+  // .kvrpcpb.KvIncrRequest kv_incr_req = 21;
+  if (this->has_kv_incr_req()) {
+    total_size += 2 +
+      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+        *this->kv_incr_req_);
+  }
+
+  // .kvrpcpb.KvAppendRequest kv_append_req = 22;
+  if (this->has_kv_append_req()) {
+    total_size += 2 +
+      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+        *this->kv_append_req_);
+  }
+
   // .raft_cmdpb.SplitRequest admin_split_req = 30;
   if (this->has_admin_split_req()) {
     total_size += 2 +
@@ -3677,6 +4825,20 @@ size_t Command::ByteSizeLong() const {
         *this->unlock_force_req_);
   }
 
+  // .raft_cmdpb.LockReapRequest lock_reap_req = 44;
+  if (this->has_lock_reap_req()) {
+    total_size += 2 +
+      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+        *this->lock_reap_req_);
+  }
+
+  // uint64 expire_at = 50;
+  if (this->expire_at() != 0) {
+    total_size += 2 +
+      ::google::protobuf::internal::WireFormatLite::UInt64Size(
+        this->expire_at());
+  }
+
   // .raft_cmdpb.CmdType cmd_type = 2;
   if (this->cmd_type() != 0) {
     total_size += 1 +
@@ -3766,6 +4928,12 @@ void Command::MergeFrom(const Command& from) {
   if (from.has_kv_range_del_req()) {
     mutable_kv_range_del_req()->::kvrpcpb::KvRangeDeleteRequest::MergeFrom(from.kv_range_del_req());
   }
+  if (from.has_kv_incr_req()) {
+    mutable_kv_incr_req()->::kvrpcpb::KvIncrRequest::MergeFrom(from.kv_incr_req());
+  }
+  if (from.has_kv_append_req()) {
+    mutable_kv_append_req()->::kvrpcpb::KvAppendRequest::MergeFrom(from.kv_append_req());
+  }
   if (from.has_admin_split_req()) {
     mutable_admin_split_req()->::raft_cmdpb::SplitRequest::MergeFrom(from.admin_split_req());
   }
@@ -3787,6 +4955,12 @@ void Command::MergeFrom(const Command& from) {
   if (from.has_unlock_force_req()) {
     mutable_unlock_force_req()->::kvrpcpb::UnlockForceRequest::MergeFrom(from.unlock_force_req());
   }
+  if (from.has_lock_reap_req()) {
+    mutable_lock_reap_req()->::raft_cmdpb::LockReapRequest::MergeFrom(from.lock_reap_req());
+  }
+  if (from.expire_at() != 0) {
+    set_expire_at(from.expire_at());
+  }
   if (from.cmd_type() != 0) {
     set_cmd_type(from.cmd_type());
   }
@@ -3834,6 +5008,8 @@ void Command::InternalSwap(Command* other) {
   swap(kv_delete_req_, other->kv_delete_req_);
   swap(kv_batch_del_req_, other->kv_batch_del_req_);
   swap(kv_range_del_req_, other->kv_range_del_req_);
+  swap(kv_incr_req_, other->kv_incr_req_);
+  swap(kv_append_req_, other->kv_append_req_);
   swap(admin_split_req_, other->admin_split_req_);
   swap(admin_merge_req_, other->admin_merge_req_);
   swap(admin_leader_change_req_, other->admin_leader_change_req_);
@@ -3841,6 +5017,8 @@ void Command::InternalSwap(Command* other) {
   swap(lock_update_req_, other->lock_update_req_);
   swap(unlock_req_, other->unlock_req_);
   swap(unlock_force_req_, other->unlock_force_req_);
+  swap(lock_reap_req_, other->lock_reap_req_);
+  swap(expire_at_, other->expire_at_);
   swap(cmd_type_, other->cmd_type_);
   _internal_metadata_.Swap(&other->_internal_metadata_);
   swap(_cached_size_, other->_cached_size_);
@@ -4588,6 +5766,86 @@ void Command::set_allocated_kv_range_del_req(::kvrpcpb::KvRangeDeleteRequest* kv
   // @@protoc_insertion_point(field_set_allocated:raft_cmdpb.Command.kv_range_del_req)
 }
 
+// .kvrpcpb.KvIncrRequest kv_incr_req = 21;
+bool Command::has_kv_incr_req() const {
+  return this != internal_default_instance() && kv_incr_req_ != NULL;
+}
+void Command::clear_kv_incr_req() {
+  if (GetArenaNoVirtual() == NULL && kv_incr_req_ != NULL) delete kv_incr_req_;
+  kv_incr_req_ = NULL;
+}
+const ::kvrpcpb::KvIncrRequest& Command::kv_incr_req() const {
+  const ::kvrpcpb::KvIncrRequest* p = kv_incr_req_;
+  // @@protoc_insertion_point(field_get:raft_cmdpb.Command.kv_incr_req)
+  return p != NULL ? *p : *reinterpret_cast<const ::kvrpcpb::KvIncrRequest*>(
+      &::kvrpcpb::_KvIncrRequest_default_instance_);
+}
+::kvrpcpb::KvIncrRequest* Command::mutable_kv_incr_req() {
+  
+  if (kv_incr_req_ == NULL) {
+    kv_incr_req_ = new ::kvrpcpb::KvIncrRequest;
+  }
+  // @@protoc_insertion_point(field_mutable:raft_cmdpb.Command.kv_incr_req)
+  return kv_incr_req_;
+}
+::kvrpcpb::KvIncrRequest* Command::release_kv_incr_req() {
+  // @@protoc_insertion_point(field_release:raft_cmdpb.Command.kv_incr_req)
+  
+  ::kvrpcpb::KvIncrRequest* temp = kv_incr_req_;
+  kv_incr_req_ = NULL;
+  return temp;
+}
+void Command::set_allocated_kv_incr_req(::kvrpcpb::KvIncrRequest* kv_incr_req) {
+  delete kv_incr_req_;
+  kv_incr_req_ = kv_incr_req;
+  if (kv_incr_req) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_set_allocated:raft_cmdpb.Command.kv_incr_req)
+}
+
+// .kvrpcpb.KvAppendRequest kv_append_req = 22;
+bool Command::has_kv_append_req() const {
+  return this != internal_default_instance() && kv_append_req_ != NULL;
+}
+void Command::clear_kv_append_req() {
+  if (GetArenaNoVirtual() == NULL && kv_append_req_ != NULL) delete kv_append_req_;
+  kv_append_req_ = NULL;
+}
+const ::kvrpcpb::KvAppendRequest& Command::kv_append_req() const {
+  const ::kvrpcpb::KvAppendRequest* p = kv_append_req_;
+  // @@protoc_insertion_point(field_get:raft_cmdpb.Command.kv_append_req)
+  return p != NULL ? *p : *reinterpret_cast<const ::kvrpcpb::KvAppendRequest*>(
+      &::kvrpcpb::_KvAppendRequest_default_instance_);
+}
+::kvrpcpb::KvAppendRequest* Command::mutable_kv_append_req() {
+  
+  if (kv_append_req_ == NULL) {
+    kv_append_req_ = new ::kvrpcpb::KvAppendRequest;
+  }
+  // @@protoc_insertion_point(field_mutable:raft_cmdpb.Command.kv_append_req)
+  return kv_append_req_;
+}
+::kvrpcpb::KvAppendRequest* Command::release_kv_append_req() {
+  // @@protoc_insertion_point(field_release:raft_cmdpb.Command.kv_append_req)
+  
+  ::kvrpcpb::KvAppendRequest* temp = kv_append_req_;
+  kv_append_req_ = NULL;
+  return temp;
+}
+void Command::set_allocated_kv_append_req(::kvrpcpb::KvAppendRequest* kv_append_req) {
+  delete kv_append_req_;
+  kv_append_req_ = kv_append_req;
+  if (kv_append_req) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_set_allocated:raft_cmdpb.Command.kv_append_req)
+}
+
 // .raft_cmdpb.SplitRequest admin_split_req = 30;
 bool Command::has_admin_split_req() const {
   return this != internal_default_instance() && admin_split_req_ != NULL;
@@ -4868,6 +6126,60 @@ void Command::set_allocated_unlock_force_req(::kvrpcpb::UnlockForceRequest* unlo
   // @@protoc_insertion_point(field_set_allocated:raft_cmdpb.Command.unlock_force_req)
 }
 
+// .raft_cmdpb.LockReapRequest lock_reap_req = 44;
+bool Command::has_lock_reap_req() const {
+  return this != internal_default_instance() && lock_reap_req_ != NULL;
+}
+void Command::clear_lock_reap_req() {
+  if (GetArenaNoVirtual() == NULL && lock_reap_req_ != NULL) delete lock_reap_req_;
+  lock_reap_req_ = NULL;
+}
+const ::raft_cmdpb::LockReapRequest& Command::lock_reap_req() const {
+  const ::raft_cmdpb::LockReapRequest* p = lock_reap_req_;
+  // @@protoc_insertion_point(field_get:raft_cmdpb.Command.lock_reap_req)
+  return p != NULL ? *p : *reinterpret_cast<const ::raft_cmdpb::LockReapRequest*>(
+      &::raft_cmdpb::_LockReapRequest_default_instance_);
+}
+::raft_cmdpb::LockReapRequest* Command::mutable_lock_reap_req() {
+  
+  if (lock_reap_req_ == NULL) {
+    lock_reap_req_ = new ::raft_cmdpb::LockReapRequest;
+  }
+  // @@protoc_insertion_point(field_mutable:raft_cmdpb.Command.lock_reap_req)
+  return lock_reap_req_;
+}
+::raft_cmdpb::LockReapRequest* Command::release_lock_reap_req() {
+  // @@protoc_insertion_point(field_release:raft_cmdpb.Command.lock_reap_req)
+  
+  ::raft_cmdpb::LockReapRequest* temp = lock_reap_req_;
+  lock_reap_req_ = NULL;
+  return temp;
+}
+void Command::set_allocated_lock_reap_req(::raft_cmdpb::LockReapRequest* lock_reap_req) {
+  delete lock_reap_req_;
+  lock_reap_req_ = lock_reap_req;
+  if (lock_reap_req) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_set_allocated:raft_cmdpb.Command.lock_reap_req)
+}
+
+// uint64 expire_at = 50;
+void Command::clear_expire_at() {
+  expire_at_ = GOOGLE_ULONGLONG(0);
+}
+::google::protobuf::uint64 Command::expire_at() const {
+  // @@protoc_insertion_point(field_get:raft_cmdpb.Command.expire_at)
+  return expire_at_;
+}
+void Command::set_expire_at(::google::protobuf::uint64 value) {
+  
+  expire_at_ = value;
+  // @@protoc_insertion_point(field_set:raft_cmdpb.Command.expire_at)
+}
+
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
 
 // ===================================================================
@@ -5649,6 +6961,7 @@ void SnapshotKVPair::set_allocated_value(::std::string* value) {
 
 #if !defined(_MSC_VER) || _MSC_VER >= 1900
 const int SnapshotContext::kMetaFieldNumber;
+const int SnapshotContext::kValueFormatFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
 SnapshotContext::SnapshotContext()
@@ -5669,11 +6982,14 @@ SnapshotContext::SnapshotContext(const SnapshotContext& from)
   } else {
     meta_ = NULL;
   }
+  value_format_ = from.value_format_;
   // @@protoc_insertion_point(copy_constructor:raft_cmdpb.SnapshotContext)
 }
 
 void SnapshotContext::SharedCtor() {
-  meta_ = NULL;
+  ::memset(&meta_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&value_format_) -
+      reinterpret_cast<char*>(&meta_)) + sizeof(value_format_));
   _cached_size_ = 0;
 }
 
@@ -5719,6 +7035,7 @@ void SnapshotContext::Clear() {
     delete meta_;
   }
   meta_ = NULL;
+  value_format_ = 0;
   _internal_metadata_.Clear();
 }
 
@@ -5744,6 +7061,21 @@ bool SnapshotContext::MergePartialFromCodedStream(
         break;
       }
 
+      // .raft_cmdpb.SnapshotValueFormat value_format = 2;
+      case 2: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(16u /* 16 & 0xFF */)) {
+          int value;
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
+                 input, &value)));
+          set_value_format(static_cast< ::raft_cmdpb::SnapshotValueFormat >(value));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
       default: {
       handle_unusual:
         if (tag == 0) {
@@ -5776,6 +7108,12 @@ void SnapshotContext::SerializeWithCachedSizes(
       1, *this->meta_, output);
   }
 
+  // .raft_cmdpb.SnapshotValueFormat value_format = 2;
+  if (this->value_format() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteEnum(
+      2, this->value_format(), output);
+  }
+
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
     ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
@@ -5797,6 +7135,12 @@ void SnapshotContext::SerializeWithCachedSizes(
         1, *this->meta_, deterministic, target);
   }
 
+  // .raft_cmdpb.SnapshotValueFormat value_format = 2;
+  if (this->value_format() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
+      2, this->value_format(), target);
+  }
+
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
     target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
@@ -5821,6 +7165,12 @@ size_t SnapshotContext::ByteSizeLong() const {
         *this->meta_);
   }
 
+  // .raft_cmdpb.SnapshotValueFormat value_format = 2;
+  if (this->value_format() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::EnumSize(this->value_format());
+  }
+
   int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = cached_size;
@@ -5853,6 +7203,9 @@ void SnapshotContext::MergeFrom(const SnapshotContext& from) {
   if (from.has_meta()) {
     mutable_meta()->::metapb::Range::MergeFrom(from.meta());
   }
+  if (from.value_format() != 0) {
+    set_value_format(from.value_format());
+  }
 }
 
 void SnapshotContext::CopyFrom(const ::google::protobuf::Message& from) {
@@ -5880,6 +7233,7 @@ void SnapshotContext::Swap(SnapshotContext* other) {
 void SnapshotContext::InternalSwap(SnapshotContext* other) {
   using std::swap;
   swap(meta_, other->meta_);
+  swap(value_format_, other->value_format_);
   _internal_metadata_.Swap(&other->_internal_metadata_);
   swap(_cached_size_, other->_cached_size_);
 }
@@ -5932,6 +7286,20 @@ void SnapshotContext::set_allocated_meta(::metapb::Range* meta) {
   // @@protoc_insertion_point(field_set_allocated:raft_cmdpb.SnapshotContext.meta)
 }
 
+// .raft_cmdpb.SnapshotValueFormat value_format = 2;
+void SnapshotContext::clear_value_format() {
+  value_format_ = 0;
+}
+::raft_cmdpb::SnapshotValueFormat SnapshotContext::value_format() const {
+  // @@protoc_insertion_point(field_get:raft_cmdpb.SnapshotContext.value_format)
+  return static_cast< ::raft_cmdpb::SnapshotValueFormat >(value_format_);
+}
+void SnapshotContext::set_value_format(::raft_cmdpb::SnapshotValueFormat value) {
+  
+  value_format_ = value;
+  // @@protoc_insertion_point(field_set:raft_cmdpb.SnapshotContext.value_format)
+}
+
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
 
 // @@protoc_insertion_point(namespace_scope)
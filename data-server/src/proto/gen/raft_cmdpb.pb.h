@@ -46,6 +46,9 @@ extern LeaderChangeRequestDefaultTypeInternal _LeaderChangeRequest_default_insta
 class LeaderChangeResponse;
 class LeaderChangeResponseDefaultTypeInternal;
 extern LeaderChangeResponseDefaultTypeInternal _LeaderChangeResponse_default_instance_;
+class LockReapRequest;
+class LockReapRequestDefaultTypeInternal;
+extern LockReapRequestDefaultTypeInternal _LockReapRequest_default_instance_;
 class MergeRequest;
 class MergeRequestDefaultTypeInternal;
 extern MergeRequestDefaultTypeInternal _MergeRequest_default_instance_;
@@ -55,6 +58,9 @@ extern MergeResponseDefaultTypeInternal _MergeResponse_default_instance_;
 class PeerTask;
 class PeerTaskDefaultTypeInternal;
 extern PeerTaskDefaultTypeInternal _PeerTask_default_instance_;
+class ReapLock;
+class ReapLockDefaultTypeInternal;
+extern ReapLockDefaultTypeInternal _ReapLock_default_instance_;
 class SnapshotContext;
 class SnapshotContextDefaultTypeInternal;
 extern SnapshotContextDefaultTypeInternal _SnapshotContext_default_instance_;
@@ -106,6 +112,8 @@ enum CmdType {
   KvDelete = 18,
   KvBatchDel = 19,
   KvRangeDel = 20,
+  KvIncr = 22,
+  KvAppend = 23,
   AdminSplit = 30,
   AdminMerge = 31,
   AdminLeaderChange = 32,
@@ -113,12 +121,13 @@ enum CmdType {
   LockUpdate = 41,
   Unlock = 42,
   UnlockForce = 43,
+  LockReap = 44,
   CmdType_INT_MIN_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32min,
   CmdType_INT_MAX_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32max
 };
 bool CmdType_IsValid(int value);
 const CmdType CmdType_MIN = Invalid;
-const CmdType CmdType_MAX = UnlockForce;
+const CmdType CmdType_MAX = LockReap;
 const int CmdType_ARRAYSIZE = CmdType_MAX + 1;
 
 const ::google::protobuf::EnumDescriptor* CmdType_descriptor();
@@ -131,6 +140,28 @@ inline bool CmdType_Parse(
   return ::google::protobuf::internal::ParseNamedEnum<CmdType>(
     CmdType_descriptor(), name, value);
 }
+enum SnapshotValueFormat {
+  SVF_Unknown = 0,
+  SVF_Raw = 1,
+  SVF_TtlHeader = 2,
+  SnapshotValueFormat_INT_MIN_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32min,
+  SnapshotValueFormat_INT_MAX_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32max
+};
+bool SnapshotValueFormat_IsValid(int value);
+const SnapshotValueFormat SnapshotValueFormat_MIN = SVF_Unknown;
+const SnapshotValueFormat SnapshotValueFormat_MAX = SVF_TtlHeader;
+const int SnapshotValueFormat_ARRAYSIZE = SnapshotValueFormat_MAX + 1;
+
+const ::google::protobuf::EnumDescriptor* SnapshotValueFormat_descriptor();
+inline const ::std::string& SnapshotValueFormat_Name(SnapshotValueFormat value) {
+  return ::google::protobuf::internal::NameOfEnum(
+    SnapshotValueFormat_descriptor(), value);
+}
+inline bool SnapshotValueFormat_Parse(
+    const ::std::string& name, SnapshotValueFormat* value) {
+  return ::google::protobuf::internal::ParseNamedEnum<SnapshotValueFormat>(
+    SnapshotValueFormat_descriptor(), name, value);
+}
 // ===================================================================
 
 class SplitRequest : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:raft_cmdpb.SplitRequest) */ {
@@ -436,10 +467,37 @@ class MergeRequest : public ::google::protobuf::Message /* @@protoc_insertion_po
 
   // accessors -------------------------------------------------------
 
+  // .metapb.Range target = 2;
+  bool has_target() const;
+  void clear_target();
+  static const int kTargetFieldNumber = 2;
+  const ::metapb::Range& target() const;
+  ::metapb::Range* mutable_target();
+  ::metapb::Range* release_target();
+  void set_allocated_target(::metapb::Range* target);
+
+  // .metapb.Range source = 3;
+  bool has_source() const;
+  void clear_source();
+  static const int kSourceFieldNumber = 3;
+  const ::metapb::Range& source() const;
+  ::metapb::Range* mutable_source();
+  ::metapb::Range* release_source();
+  void set_allocated_source(::metapb::Range* source);
+
+  // bool commit = 1;
+  void clear_commit();
+  static const int kCommitFieldNumber = 1;
+  bool commit() const;
+  void set_commit(bool value);
+
   // @@protoc_insertion_point(class_scope:raft_cmdpb.MergeRequest)
  private:
 
   ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  ::metapb::Range* target_;
+  ::metapb::Range* source_;
+  bool commit_;
   mutable int _cached_size_;
   friend struct protobuf_raft_5fcmdpb_2eproto::TableStruct;
 };
@@ -732,6 +790,229 @@ class LeaderChangeResponse : public ::google::protobuf::Message /* @@protoc_inse
 };
 // -------------------------------------------------------------------
 
+class LockReapRequest : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:raft_cmdpb.LockReapRequest) */ {
+ public:
+  LockReapRequest();
+  virtual ~LockReapRequest();
+
+  LockReapRequest(const LockReapRequest& from);
+
+  inline LockReapRequest& operator=(const LockReapRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  #if LANG_CXX11
+  LockReapRequest(LockReapRequest&& from) noexcept
+    : LockReapRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline LockReapRequest& operator=(LockReapRequest&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+  #endif
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const LockReapRequest& default_instance();
+
+  static inline const LockReapRequest* internal_default_instance() {
+    return reinterpret_cast<const LockReapRequest*>(
+               &_LockReapRequest_default_instance_);
+  }
+  static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
+    6;
+
+  void Swap(LockReapRequest* other);
+  friend void swap(LockReapRequest& a, LockReapRequest& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline LockReapRequest* New() const PROTOBUF_FINAL { return New(NULL); }
+
+  LockReapRequest* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
+  void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  void CopyFrom(const LockReapRequest& from);
+  void MergeFrom(const LockReapRequest& from);
+  void Clear() PROTOBUF_FINAL;
+  bool IsInitialized() const PROTOBUF_FINAL;
+
+  size_t ByteSizeLong() const PROTOBUF_FINAL;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* target) const PROTOBUF_FINAL;
+  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const PROTOBUF_FINAL;
+  void InternalSwap(LockReapRequest* other);
+  private:
+  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
+    return NULL;
+  }
+  inline void* MaybeArenaPtr() const {
+    return NULL;
+  }
+  public:
+
+  ::google::protobuf::Metadata GetMetadata() const PROTOBUF_FINAL;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // repeated .raft_cmdpb.ReapLock locks = 1;
+  int locks_size() const;
+  void clear_locks();
+  static const int kLocksFieldNumber = 1;
+  const ::raft_cmdpb::ReapLock& locks(int index) const;
+  ::raft_cmdpb::ReapLock* mutable_locks(int index);
+  ::raft_cmdpb::ReapLock* add_locks();
+  ::google::protobuf::RepeatedPtrField< ::raft_cmdpb::ReapLock >*
+      mutable_locks();
+  const ::google::protobuf::RepeatedPtrField< ::raft_cmdpb::ReapLock >&
+      locks() const;
+
+  // @@protoc_insertion_point(class_scope:raft_cmdpb.LockReapRequest)
+ private:
+
+  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  ::google::protobuf::RepeatedPtrField< ::raft_cmdpb::ReapLock > locks_;
+  mutable int _cached_size_;
+  friend struct protobuf_raft_5fcmdpb_2eproto::TableStruct;
+};
+// -------------------------------------------------------------------
+
+class ReapLock : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:raft_cmdpb.ReapLock) */ {
+ public:
+  ReapLock();
+  virtual ~ReapLock();
+
+  ReapLock(const ReapLock& from);
+
+  inline ReapLock& operator=(const ReapLock& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  #if LANG_CXX11
+  ReapLock(ReapLock&& from) noexcept
+    : ReapLock() {
+    *this = ::std::move(from);
+  }
+
+  inline ReapLock& operator=(ReapLock&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+  #endif
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const ReapLock& default_instance();
+
+  static inline const ReapLock* internal_default_instance() {
+    return reinterpret_cast<const ReapLock*>(
+               &_ReapLock_default_instance_);
+  }
+  static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
+    7;
+
+  void Swap(ReapLock* other);
+  friend void swap(ReapLock& a, ReapLock& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline ReapLock* New() const PROTOBUF_FINAL { return New(NULL); }
+
+  ReapLock* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
+  void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  void CopyFrom(const ReapLock& from);
+  void MergeFrom(const ReapLock& from);
+  void Clear() PROTOBUF_FINAL;
+  bool IsInitialized() const PROTOBUF_FINAL;
+
+  size_t ByteSizeLong() const PROTOBUF_FINAL;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* target) const PROTOBUF_FINAL;
+  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const PROTOBUF_FINAL;
+  void InternalSwap(ReapLock* other);
+  private:
+  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
+    return NULL;
+  }
+  inline void* MaybeArenaPtr() const {
+    return NULL;
+  }
+  public:
+
+  ::google::protobuf::Metadata GetMetadata() const PROTOBUF_FINAL;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // bytes key = 1;
+  void clear_key();
+  static const int kKeyFieldNumber = 1;
+  const ::std::string& key() const;
+  void set_key(const ::std::string& value);
+  #if LANG_CXX11
+  void set_key(::std::string&& value);
+  #endif
+  void set_key(const char* value);
+  void set_key(const void* value, size_t size);
+  ::std::string* mutable_key();
+  ::std::string* release_key();
+  void set_allocated_key(::std::string* key);
+
+  // string id = 2;
+  void clear_id();
+  static const int kIdFieldNumber = 2;
+  const ::std::string& id() const;
+  void set_id(const ::std::string& value);
+  #if LANG_CXX11
+  void set_id(::std::string&& value);
+  #endif
+  void set_id(const char* value);
+  void set_id(const char* value, size_t size);
+  ::std::string* mutable_id();
+  ::std::string* release_id();
+  void set_allocated_id(::std::string* id);
+
+  // @@protoc_insertion_point(class_scope:raft_cmdpb.ReapLock)
+ private:
+
+  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  ::google::protobuf::internal::ArenaStringPtr key_;
+  ::google::protobuf::internal::ArenaStringPtr id_;
+  mutable int _cached_size_;
+  friend struct protobuf_raft_5fcmdpb_2eproto::TableStruct;
+};
+// -------------------------------------------------------------------
+
 class CmdID : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:raft_cmdpb.CmdID) */ {
  public:
   CmdID();
@@ -766,7 +1047,7 @@ class CmdID : public ::google::protobuf::Message /* @@protoc_insertion_point(cla
                &_CmdID_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
-    6;
+    8;
 
   void Swap(CmdID* other);
   friend void swap(CmdID& a, CmdID& b) {
@@ -870,7 +1151,7 @@ class Command : public ::google::protobuf::Message /* @@protoc_insertion_point(c
                &_Command_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
-    7;
+    9;
 
   void Swap(Command* other);
   friend void swap(Command& a, Command& b) {
@@ -1079,6 +1360,24 @@ class Command : public ::google::protobuf::Message /* @@protoc_insertion_point(c
   ::kvrpcpb::KvRangeDeleteRequest* release_kv_range_del_req();
   void set_allocated_kv_range_del_req(::kvrpcpb::KvRangeDeleteRequest* kv_range_del_req);
 
+  // .kvrpcpb.KvIncrRequest kv_incr_req = 21;
+  bool has_kv_incr_req() const;
+  void clear_kv_incr_req();
+  static const int kKvIncrReqFieldNumber = 21;
+  const ::kvrpcpb::KvIncrRequest& kv_incr_req() const;
+  ::kvrpcpb::KvIncrRequest* mutable_kv_incr_req();
+  ::kvrpcpb::KvIncrRequest* release_kv_incr_req();
+  void set_allocated_kv_incr_req(::kvrpcpb::KvIncrRequest* kv_incr_req);
+
+  // .kvrpcpb.KvAppendRequest kv_append_req = 22;
+  bool has_kv_append_req() const;
+  void clear_kv_append_req();
+  static const int kKvAppendReqFieldNumber = 22;
+  const ::kvrpcpb::KvAppendRequest& kv_append_req() const;
+  ::kvrpcpb::KvAppendRequest* mutable_kv_append_req();
+  ::kvrpcpb::KvAppendRequest* release_kv_append_req();
+  void set_allocated_kv_append_req(::kvrpcpb::KvAppendRequest* kv_append_req);
+
   // .raft_cmdpb.SplitRequest admin_split_req = 30;
   bool has_admin_split_req() const;
   void clear_admin_split_req();
@@ -1142,6 +1441,21 @@ class Command : public ::google::protobuf::Message /* @@protoc_insertion_point(c
   ::kvrpcpb::UnlockForceRequest* release_unlock_force_req();
   void set_allocated_unlock_force_req(::kvrpcpb::UnlockForceRequest* unlock_force_req);
 
+  // .raft_cmdpb.LockReapRequest lock_reap_req = 44;
+  bool has_lock_reap_req() const;
+  void clear_lock_reap_req();
+  static const int kLockReapReqFieldNumber = 44;
+  const ::raft_cmdpb::LockReapRequest& lock_reap_req() const;
+  ::raft_cmdpb::LockReapRequest* mutable_lock_reap_req();
+  ::raft_cmdpb::LockReapRequest* release_lock_reap_req();
+  void set_allocated_lock_reap_req(::raft_cmdpb::LockReapRequest* lock_reap_req);
+
+  // uint64 expire_at = 50;
+  void clear_expire_at();
+  static const int kExpireAtFieldNumber = 50;
+  ::google::protobuf::uint64 expire_at() const;
+  void set_expire_at(::google::protobuf::uint64 value);
+
   // .raft_cmdpb.CmdType cmd_type = 2;
   void clear_cmd_type();
   static const int kCmdTypeFieldNumber = 2;
@@ -1170,6 +1484,8 @@ class Command : public ::google::protobuf::Message /* @@protoc_insertion_point(c
   ::kvrpcpb::KvDeleteRequest* kv_delete_req_;
   ::kvrpcpb::KvBatchDeleteRequest* kv_batch_del_req_;
   ::kvrpcpb::KvRangeDeleteRequest* kv_range_del_req_;
+  ::kvrpcpb::KvIncrRequest* kv_incr_req_;
+  ::kvrpcpb::KvAppendRequest* kv_append_req_;
   ::raft_cmdpb::SplitRequest* admin_split_req_;
   ::raft_cmdpb::MergeRequest* admin_merge_req_;
   ::raft_cmdpb::LeaderChangeRequest* admin_leader_change_req_;
@@ -1177,6 +1493,8 @@ class Command : public ::google::protobuf::Message /* @@protoc_insertion_point(c
   ::kvrpcpb::LockUpdateRequest* lock_update_req_;
   ::kvrpcpb::UnlockRequest* unlock_req_;
   ::kvrpcpb::UnlockForceRequest* unlock_force_req_;
+  ::raft_cmdpb::LockReapRequest* lock_reap_req_;
+  ::google::protobuf::uint64 expire_at_;
   int cmd_type_;
   mutable int _cached_size_;
   friend struct protobuf_raft_5fcmdpb_2eproto::TableStruct;
@@ -1217,7 +1535,7 @@ class PeerTask : public ::google::protobuf::Message /* @@protoc_insertion_point(
                &_PeerTask_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
-    8;
+    10;
 
   void Swap(PeerTask* other);
   friend void swap(PeerTask& a, PeerTask& b) {
@@ -1327,7 +1645,7 @@ class SnapshotKVPair : public ::google::protobuf::Message /* @@protoc_insertion_
                &_SnapshotKVPair_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
-    9;
+    11;
 
   void Swap(SnapshotKVPair* other);
   friend void swap(SnapshotKVPair& a, SnapshotKVPair& b) {
@@ -1447,7 +1765,7 @@ class SnapshotContext : public ::google::protobuf::Message /* @@protoc_insertion
                &_SnapshotContext_default_instance_);
   }
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
-    10;
+    12;
 
   void Swap(SnapshotContext* other);
   friend void swap(SnapshotContext& a, SnapshotContext& b) {
@@ -1503,11 +1821,18 @@ class SnapshotContext : public ::google::protobuf::Message /* @@protoc_insertion
   ::metapb::Range* release_meta();
   void set_allocated_meta(::metapb::Range* meta);
 
+  // .raft_cmdpb.SnapshotValueFormat value_format = 2;
+  void clear_value_format();
+  static const int kValueFormatFieldNumber = 2;
+  ::raft_cmdpb::SnapshotValueFormat value_format() const;
+  void set_value_format(::raft_cmdpb::SnapshotValueFormat value);
+
   // @@protoc_insertion_point(class_scope:raft_cmdpb.SnapshotContext)
  private:
 
   ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
   ::metapb::Range* meta_;
+  int value_format_;
   mutable int _cached_size_;
   friend struct protobuf_raft_5fcmdpb_2eproto::TableStruct;
 };
@@ -1678,6 +2003,100 @@ inline void SplitRequest::set_allocated_new_range(::metapb::Range* new_range) {
 
 // MergeRequest
 
+// bool commit = 1;
+inline void MergeRequest::clear_commit() {
+  commit_ = false;
+}
+inline bool MergeRequest::commit() const {
+  // @@protoc_insertion_point(field_get:raft_cmdpb.MergeRequest.commit)
+  return commit_;
+}
+inline void MergeRequest::set_commit(bool value) {
+  
+  commit_ = value;
+  // @@protoc_insertion_point(field_set:raft_cmdpb.MergeRequest.commit)
+}
+
+// .metapb.Range target = 2;
+inline bool MergeRequest::has_target() const {
+  return this != internal_default_instance() && target_ != NULL;
+}
+inline void MergeRequest::clear_target() {
+  if (GetArenaNoVirtual() == NULL && target_ != NULL) delete target_;
+  target_ = NULL;
+}
+inline const ::metapb::Range& MergeRequest::target() const {
+  const ::metapb::Range* p = target_;
+  // @@protoc_insertion_point(field_get:raft_cmdpb.MergeRequest.target)
+  return p != NULL ? *p : *reinterpret_cast<const ::metapb::Range*>(
+      &::metapb::_Range_default_instance_);
+}
+inline ::metapb::Range* MergeRequest::mutable_target() {
+  
+  if (target_ == NULL) {
+    target_ = new ::metapb::Range;
+  }
+  // @@protoc_insertion_point(field_mutable:raft_cmdpb.MergeRequest.target)
+  return target_;
+}
+inline ::metapb::Range* MergeRequest::release_target() {
+  // @@protoc_insertion_point(field_release:raft_cmdpb.MergeRequest.target)
+  
+  ::metapb::Range* temp = target_;
+  target_ = NULL;
+  return temp;
+}
+inline void MergeRequest::set_allocated_target(::metapb::Range* target) {
+  delete target_;
+  target_ = target;
+  if (target) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_set_allocated:raft_cmdpb.MergeRequest.target)
+}
+
+// .metapb.Range source = 3;
+inline bool MergeRequest::has_source() const {
+  return this != internal_default_instance() && source_ != NULL;
+}
+inline void MergeRequest::clear_source() {
+  if (GetArenaNoVirtual() == NULL && source_ != NULL) delete source_;
+  source_ = NULL;
+}
+inline const ::metapb::Range& MergeRequest::source() const {
+  const ::metapb::Range* p = source_;
+  // @@protoc_insertion_point(field_get:raft_cmdpb.MergeRequest.source)
+  return p != NULL ? *p : *reinterpret_cast<const ::metapb::Range*>(
+      &::metapb::_Range_default_instance_);
+}
+inline ::metapb::Range* MergeRequest::mutable_source() {
+  
+  if (source_ == NULL) {
+    source_ = new ::metapb::Range;
+  }
+  // @@protoc_insertion_point(field_mutable:raft_cmdpb.MergeRequest.source)
+  return source_;
+}
+inline ::metapb::Range* MergeRequest::release_source() {
+  // @@protoc_insertion_point(field_release:raft_cmdpb.MergeRequest.source)
+  
+  ::metapb::Range* temp = source_;
+  source_ = NULL;
+  return temp;
+}
+inline void MergeRequest::set_allocated_source(::metapb::Range* source) {
+  delete source_;
+  source_ = source;
+  if (source) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_set_allocated:raft_cmdpb.MergeRequest.source)
+}
+
 // -------------------------------------------------------------------
 
 // MergeResponse
@@ -1746,6 +2165,150 @@ inline void LeaderChangeRequest::set_allocated_epoch(::metapb::RangeEpoch* epoch
 
 // -------------------------------------------------------------------
 
+// LockReapRequest
+
+// repeated .raft_cmdpb.ReapLock locks = 1;
+inline int LockReapRequest::locks_size() const {
+  return locks_.size();
+}
+inline void LockReapRequest::clear_locks() {
+  locks_.Clear();
+}
+inline const ::raft_cmdpb::ReapLock& LockReapRequest::locks(int index) const {
+  // @@protoc_insertion_point(field_get:raft_cmdpb.LockReapRequest.locks)
+  return locks_.Get(index);
+}
+inline ::raft_cmdpb::ReapLock* LockReapRequest::mutable_locks(int index) {
+  // @@protoc_insertion_point(field_mutable:raft_cmdpb.LockReapRequest.locks)
+  return locks_.Mutable(index);
+}
+inline ::raft_cmdpb::ReapLock* LockReapRequest::add_locks() {
+  // @@protoc_insertion_point(field_add:raft_cmdpb.LockReapRequest.locks)
+  return locks_.Add();
+}
+inline ::google::protobuf::RepeatedPtrField< ::raft_cmdpb::ReapLock >*
+LockReapRequest::mutable_locks() {
+  // @@protoc_insertion_point(field_mutable_list:raft_cmdpb.LockReapRequest.locks)
+  return &locks_;
+}
+inline const ::google::protobuf::RepeatedPtrField< ::raft_cmdpb::ReapLock >&
+LockReapRequest::locks() const {
+  // @@protoc_insertion_point(field_list:raft_cmdpb.LockReapRequest.locks)
+  return locks_;
+}
+
+// -------------------------------------------------------------------
+
+// ReapLock
+
+// bytes key = 1;
+inline void ReapLock::clear_key() {
+  key_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline const ::std::string& ReapLock::key() const {
+  // @@protoc_insertion_point(field_get:raft_cmdpb.ReapLock.key)
+  return key_.GetNoArena();
+}
+inline void ReapLock::set_key(const ::std::string& value) {
+  
+  key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:raft_cmdpb.ReapLock.key)
+}
+#if LANG_CXX11
+inline void ReapLock::set_key(::std::string&& value) {
+  
+  key_.SetNoArena(
+    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:raft_cmdpb.ReapLock.key)
+}
+#endif
+inline void ReapLock::set_key(const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  
+  key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:raft_cmdpb.ReapLock.key)
+}
+inline void ReapLock::set_key(const void* value, size_t size) {
+  
+  key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:raft_cmdpb.ReapLock.key)
+}
+inline ::std::string* ReapLock::mutable_key() {
+  
+  // @@protoc_insertion_point(field_mutable:raft_cmdpb.ReapLock.key)
+  return key_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline ::std::string* ReapLock::release_key() {
+  // @@protoc_insertion_point(field_release:raft_cmdpb.ReapLock.key)
+  
+  return key_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline void ReapLock::set_allocated_key(::std::string* key) {
+  if (key != NULL) {
+    
+  } else {
+    
+  }
+  key_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), key);
+  // @@protoc_insertion_point(field_set_allocated:raft_cmdpb.ReapLock.key)
+}
+
+// string id = 2;
+inline void ReapLock::clear_id() {
+  id_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline const ::std::string& ReapLock::id() const {
+  // @@protoc_insertion_point(field_get:raft_cmdpb.ReapLock.id)
+  return id_.GetNoArena();
+}
+inline void ReapLock::set_id(const ::std::string& value) {
+  
+  id_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:raft_cmdpb.ReapLock.id)
+}
+#if LANG_CXX11
+inline void ReapLock::set_id(::std::string&& value) {
+  
+  id_.SetNoArena(
+    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:raft_cmdpb.ReapLock.id)
+}
+#endif
+inline void ReapLock::set_id(const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  
+  id_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:raft_cmdpb.ReapLock.id)
+}
+inline void ReapLock::set_id(const char* value, size_t size) {
+  
+  id_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:raft_cmdpb.ReapLock.id)
+}
+inline ::std::string* ReapLock::mutable_id() {
+  
+  // @@protoc_insertion_point(field_mutable:raft_cmdpb.ReapLock.id)
+  return id_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline ::std::string* ReapLock::release_id() {
+  // @@protoc_insertion_point(field_release:raft_cmdpb.ReapLock.id)
+  
+  return id_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline void ReapLock::set_allocated_id(::std::string* id) {
+  if (id != NULL) {
+    
+  } else {
+    
+  }
+  id_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), id);
+  // @@protoc_insertion_point(field_set_allocated:raft_cmdpb.ReapLock.id)
+}
+
+// -------------------------------------------------------------------
+
 // CmdID
 
 // uint64 node_id = 1;
@@ -2514,6 +3077,86 @@ inline void Command::set_allocated_kv_range_del_req(::kvrpcpb::KvRangeDeleteRequ
   // @@protoc_insertion_point(field_set_allocated:raft_cmdpb.Command.kv_range_del_req)
 }
 
+// .kvrpcpb.KvIncrRequest kv_incr_req = 21;
+inline bool Command::has_kv_incr_req() const {
+  return this != internal_default_instance() && kv_incr_req_ != NULL;
+}
+inline void Command::clear_kv_incr_req() {
+  if (GetArenaNoVirtual() == NULL && kv_incr_req_ != NULL) delete kv_incr_req_;
+  kv_incr_req_ = NULL;
+}
+inline const ::kvrpcpb::KvIncrRequest& Command::kv_incr_req() const {
+  const ::kvrpcpb::KvIncrRequest* p = kv_incr_req_;
+  // @@protoc_insertion_point(field_get:raft_cmdpb.Command.kv_incr_req)
+  return p != NULL ? *p : *reinterpret_cast<const ::kvrpcpb::KvIncrRequest*>(
+      &::kvrpcpb::_KvIncrRequest_default_instance_);
+}
+inline ::kvrpcpb::KvIncrRequest* Command::mutable_kv_incr_req() {
+  
+  if (kv_incr_req_ == NULL) {
+    kv_incr_req_ = new ::kvrpcpb::KvIncrRequest;
+  }
+  // @@protoc_insertion_point(field_mutable:raft_cmdpb.Command.kv_incr_req)
+  return kv_incr_req_;
+}
+inline ::kvrpcpb::KvIncrRequest* Command::release_kv_incr_req() {
+  // @@protoc_insertion_point(field_release:raft_cmdpb.Command.kv_incr_req)
+  
+  ::kvrpcpb::KvIncrRequest* temp = kv_incr_req_;
+  kv_incr_req_ = NULL;
+  return temp;
+}
+inline void Command::set_allocated_kv_incr_req(::kvrpcpb::KvIncrRequest* kv_incr_req) {
+  delete kv_incr_req_;
+  kv_incr_req_ = kv_incr_req;
+  if (kv_incr_req) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_set_allocated:raft_cmdpb.Command.kv_incr_req)
+}
+
+// .kvrpcpb.KvAppendRequest kv_append_req = 22;
+inline bool Command::has_kv_append_req() const {
+  return this != internal_default_instance() && kv_append_req_ != NULL;
+}
+inline void Command::clear_kv_append_req() {
+  if (GetArenaNoVirtual() == NULL && kv_append_req_ != NULL) delete kv_append_req_;
+  kv_append_req_ = NULL;
+}
+inline const ::kvrpcpb::KvAppendRequest& Command::kv_append_req() const {
+  const ::kvrpcpb::KvAppendRequest* p = kv_append_req_;
+  // @@protoc_insertion_point(field_get:raft_cmdpb.Command.kv_append_req)
+  return p != NULL ? *p : *reinterpret_cast<const ::kvrpcpb::KvAppendRequest*>(
+      &::kvrpcpb::_KvAppendRequest_default_instance_);
+}
+inline ::kvrpcpb::KvAppendRequest* Command::mutable_kv_append_req() {
+  
+  if (kv_append_req_ == NULL) {
+    kv_append_req_ = new ::kvrpcpb::KvAppendRequest;
+  }
+  // @@protoc_insertion_point(field_mutable:raft_cmdpb.Command.kv_append_req)
+  return kv_append_req_;
+}
+inline ::kvrpcpb::KvAppendRequest* Command::release_kv_append_req() {
+  // @@protoc_insertion_point(field_release:raft_cmdpb.Command.kv_append_req)
+  
+  ::kvrpcpb::KvAppendRequest* temp = kv_append_req_;
+  kv_append_req_ = NULL;
+  return temp;
+}
+inline void Command::set_allocated_kv_append_req(::kvrpcpb::KvAppendRequest* kv_append_req) {
+  delete kv_append_req_;
+  kv_append_req_ = kv_append_req;
+  if (kv_append_req) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_set_allocated:raft_cmdpb.Command.kv_append_req)
+}
+
 // .raft_cmdpb.SplitRequest admin_split_req = 30;
 inline bool Command::has_admin_split_req() const {
   return this != internal_default_instance() && admin_split_req_ != NULL;
@@ -2794,6 +3437,60 @@ inline void Command::set_allocated_unlock_force_req(::kvrpcpb::UnlockForceReques
   // @@protoc_insertion_point(field_set_allocated:raft_cmdpb.Command.unlock_force_req)
 }
 
+// .raft_cmdpb.LockReapRequest lock_reap_req = 44;
+inline bool Command::has_lock_reap_req() const {
+  return this != internal_default_instance() && lock_reap_req_ != NULL;
+}
+inline void Command::clear_lock_reap_req() {
+  if (GetArenaNoVirtual() == NULL && lock_reap_req_ != NULL) delete lock_reap_req_;
+  lock_reap_req_ = NULL;
+}
+inline const ::raft_cmdpb::LockReapRequest& Command::lock_reap_req() const {
+  const ::raft_cmdpb::LockReapRequest* p = lock_reap_req_;
+  // @@protoc_insertion_point(field_get:raft_cmdpb.Command.lock_reap_req)
+  return p != NULL ? *p : *reinterpret_cast<const ::raft_cmdpb::LockReapRequest*>(
+      &::raft_cmdpb::_LockReapRequest_default_instance_);
+}
+inline ::raft_cmdpb::LockReapRequest* Command::mutable_lock_reap_req() {
+  
+  if (lock_reap_req_ == NULL) {
+    lock_reap_req_ = new ::raft_cmdpb::LockReapRequest;
+  }
+  // @@protoc_insertion_point(field_mutable:raft_cmdpb.Command.lock_reap_req)
+  return lock_reap_req_;
+}
+inline ::raft_cmdpb::LockReapRequest* Command::release_lock_reap_req() {
+  // @@protoc_insertion_point(field_release:raft_cmdpb.Command.lock_reap_req)
+  
+  ::raft_cmdpb::LockReapRequest* temp = lock_reap_req_;
+  lock_reap_req_ = NULL;
+  return temp;
+}
+inline void Command::set_allocated_lock_reap_req(::raft_cmdpb::LockReapRequest* lock_reap_req) {
+  delete lock_reap_req_;
+  lock_reap_req_ = lock_reap_req;
+  if (lock_reap_req) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_set_allocated:raft_cmdpb.Command.lock_reap_req)
+}
+
+// uint64 expire_at = 50;
+inline void Command::clear_expire_at() {
+  expire_at_ = GOOGLE_ULONGLONG(0);
+}
+inline ::google::protobuf::uint64 Command::expire_at() const {
+  // @@protoc_insertion_point(field_get:raft_cmdpb.Command.expire_at)
+  return expire_at_;
+}
+inline void Command::set_expire_at(::google::protobuf::uint64 value) {
+  
+  expire_at_ = value;
+  // @@protoc_insertion_point(field_set:raft_cmdpb.Command.expire_at)
+}
+
 // -------------------------------------------------------------------
 
 // PeerTask
@@ -3032,6 +3729,20 @@ inline void SnapshotContext::set_allocated_meta(::metapb::Range* meta) {
   // @@protoc_insertion_point(field_set_allocated:raft_cmdpb.SnapshotContext.meta)
 }
 
+// .raft_cmdpb.SnapshotValueFormat value_format = 2;
+inline void SnapshotContext::clear_value_format() {
+  value_format_ = 0;
+}
+inline ::raft_cmdpb::SnapshotValueFormat SnapshotContext::value_format() const {
+  // @@protoc_insertion_point(field_get:raft_cmdpb.SnapshotContext.value_format)
+  return static_cast< ::raft_cmdpb::SnapshotValueFormat >(value_format_);
+}
+inline void SnapshotContext::set_value_format(::raft_cmdpb::SnapshotValueFormat value) {
+  
+  value_format_ = value;
+  // @@protoc_insertion_point(field_set:raft_cmdpb.SnapshotContext.value_format)
+}
+
 #ifdef __GNUC__
   #pragma GCC diagnostic pop
 #endif  // __GNUC__
@@ -3056,6 +3767,10 @@ inline void SnapshotContext::set_allocated_meta(::metapb::Range* meta) {
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
@@ -3070,6 +3785,11 @@ template <>
 inline const EnumDescriptor* GetEnumDescriptor< ::raft_cmdpb::CmdType>() {
   return ::raft_cmdpb::CmdType_descriptor();
 }
+template <> struct is_proto_enum< ::raft_cmdpb::SnapshotValueFormat> : ::google::protobuf::internal::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::raft_cmdpb::SnapshotValueFormat>() {
+  return ::raft_cmdpb::SnapshotValueFormat_descriptor();
+}
 
 }  // namespace protobuf
 }  // namespace google
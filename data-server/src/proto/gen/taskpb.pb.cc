@@ -84,6 +84,7 @@ const ::google::protobuf::uint32 TableStruct::offsets[] GOOGLE_ATTRIBUTE_SECTION
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TaskRangeMerge, source_id_),
   ~0u,  // no _has_bits_
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TaskRangeDelete, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -122,11 +123,11 @@ const ::google::protobuf::uint32 TableStruct::offsets[] GOOGLE_ATTRIBUTE_SECTION
 };
 static const ::google::protobuf::internal::MigrationSchema schemas[] GOOGLE_ATTRIBUTE_SECTION_VARIABLE(protodesc_cold) = {
   { 0, -1, sizeof(TaskRangeMerge)},
-  { 5, -1, sizeof(TaskRangeDelete)},
-  { 11, -1, sizeof(TaskRangeLeaderTransfer)},
-  { 17, -1, sizeof(TaskRangeAddPeer)},
-  { 23, -1, sizeof(TaskRangeDelPeer)},
-  { 29, -1, sizeof(Task)},
+  { 6, -1, sizeof(TaskRangeDelete)},
+  { 12, -1, sizeof(TaskRangeLeaderTransfer)},
+  { 18, -1, sizeof(TaskRangeAddPeer)},
+  { 24, -1, sizeof(TaskRangeDelPeer)},
+  { 30, -1, sizeof(Task)},
 };
 
 static ::google::protobuf::Message const * const file_default_instances[] = {
@@ -203,26 +204,27 @@ namespace {
 void AddDescriptorsImpl() {
   InitDefaults();
   static const char descriptor[] GOOGLE_ATTRIBUTE_SECTION_VARIABLE(protodesc_cold) = {
-      "\n\014taskpb.proto\022\006taskpb\032\014metapb.proto\"\020\n\016"
-      "TaskRangeMerge\"#\n\017TaskRangeDelete\022\020\n\010ran"
-      "ge_id\030\001 \001(\004\";\n\027TaskRangeLeaderTransfer\022 "
-      "\n\nexp_leader\030\001 \001(\0132\014.metapb.Peer\".\n\020Task"
-      "RangeAddPeer\022\032\n\004peer\030\001 \001(\0132\014.metapb.Peer"
-      "\".\n\020TaskRangeDelPeer\022\032\n\004peer\030\001 \001(\0132\014.met"
-      "apb.Peer\"\246\002\n\004Task\022\036\n\004type\030\001 \001(\0162\020.taskpb"
-      ".TaskType\022+\n\013range_merge\030\002 \001(\0132\026.taskpb."
-      "TaskRangeMerge\022-\n\014range_delete\030\003 \001(\0132\027.t"
-      "askpb.TaskRangeDelete\022>\n\025range_leader_tr"
-      "ansfer\030\004 \001(\0132\037.taskpb.TaskRangeLeaderTra"
-      "nsfer\0220\n\016range_add_peer\030\005 \001(\0132\030.taskpb.T"
-      "askRangeAddPeer\0220\n\016range_del_peer\030\006 \001(\0132"
-      "\030.taskpb.TaskRangeDelPeer*w\n\010TaskType\022\r\n"
-      "\tEmptyTask\020\000\022\016\n\nRangeMerge\020\001\022\017\n\013RangeDel"
-      "ete\020\002\022\027\n\023RangeLeaderTransfer\020\003\022\020\n\014RangeA"
-      "ddPeer\020\004\022\020\n\014RangeDelPeer\020\005b\006proto3"
+      "\n\014taskpb.proto\022\006taskpb\032\014metapb.proto\"#\n\016"
+      "TaskRangeMerge\022\021\n\tsource_id\030\001 \001(\004\"#\n\017Tas"
+      "kRangeDelete\022\020\n\010range_id\030\001 \001(\004\";\n\027TaskRa"
+      "ngeLeaderTransfer\022 \n\nexp_leader\030\001 \001(\0132\014."
+      "metapb.Peer\".\n\020TaskRangeAddPeer\022\032\n\004peer\030"
+      "\001 \001(\0132\014.metapb.Peer\".\n\020TaskRangeDelPeer\022"
+      "\032\n\004peer\030\001 \001(\0132\014.metapb.Peer\"\246\002\n\004Task\022\036\n\004"
+      "type\030\001 \001(\0162\020.taskpb.TaskType\022+\n\013range_me"
+      "rge\030\002 \001(\0132\026.taskpb.TaskRangeMerge\022-\n\014ran"
+      "ge_delete\030\003 \001(\0132\027.taskpb.TaskRangeDelete"
+      "\022>\n\025range_leader_transfer\030\004 \001(\0132\037.taskpb"
+      ".TaskRangeLeaderTransfer\0220\n\016range_add_pe"
+      "er\030\005 \001(\0132\030.taskpb.TaskRangeAddPeer\0220\n\016ra"
+      "nge_del_peer\030\006 \001(\0132\030.taskpb.TaskRangeDel"
+      "Peer*w\n\010TaskType\022\r\n\tEmptyTask\020\000\022\016\n\nRange"
+      "Merge\020\001\022\017\n\013RangeDelete\020\002\022\027\n\023RangeLeaderT"
+      "ransfer\020\003\022\020\n\014RangeAddPeer\020\004\022\020\n\014RangeDelP"
+      "eer\020\005b\006proto3"
   };
   ::google::protobuf::DescriptorPool::InternalAddGeneratedFile(
-      descriptor, 674);
+      descriptor, 693);
   ::google::protobuf::MessageFactory::InternalRegisterGeneratedFile(
     "taskpb.proto", &protobuf_RegisterTypes);
   ::metapb::protobuf_metapb_2eproto::AddDescriptors();
@@ -264,6 +266,7 @@ bool TaskType_IsValid(int value) {
 // ===================================================================
 
 #if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int TaskRangeMerge::kSourceIdFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
 TaskRangeMerge::TaskRangeMerge()
@@ -279,10 +282,12 @@ TaskRangeMerge::TaskRangeMerge(const TaskRangeMerge& from)
       _internal_metadata_(NULL),
       _cached_size_(0) {
   _internal_metadata_.MergeFrom(from._internal_metadata_);
+  source_id_ = from.source_id_;
   // @@protoc_insertion_point(copy_constructor:taskpb.TaskRangeMerge)
 }
 
 void TaskRangeMerge::SharedCtor() {
+  source_id_ = GOOGLE_ULONGLONG(0);
   _cached_size_ = 0;
 }
 
@@ -323,6 +328,7 @@ void TaskRangeMerge::Clear() {
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
+  source_id_ = GOOGLE_ULONGLONG(0);
   _internal_metadata_.Clear();
 }
 
@@ -335,12 +341,31 @@ bool TaskRangeMerge::MergePartialFromCodedStream(
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
     tag = p.first;
     if (!p.second) goto handle_unusual;
-  handle_unusual:
-    if (tag == 0) {
-      goto success;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // uint64 source_id = 1;
+      case 1: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(8u /* 8 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &source_id_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, _internal_metadata_.mutable_unknown_fields()));
+        break;
+      }
     }
-    DO_(::google::protobuf::internal::WireFormat::SkipField(
-          input, tag, _internal_metadata_.mutable_unknown_fields()));
   }
 success:
   // @@protoc_insertion_point(parse_success:taskpb.TaskRangeMerge)
@@ -357,6 +382,11 @@ void TaskRangeMerge::SerializeWithCachedSizes(
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
+  // uint64 source_id = 1;
+  if (this->source_id() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(1, this->source_id(), output);
+  }
+
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
     ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
@@ -371,6 +401,11 @@ void TaskRangeMerge::SerializeWithCachedSizes(
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
+  // uint64 source_id = 1;
+  if (this->source_id() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(1, this->source_id(), target);
+  }
+
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
     target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
@@ -388,6 +423,13 @@ size_t TaskRangeMerge::ByteSizeLong() const {
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
   }
+  // uint64 source_id = 1;
+  if (this->source_id() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt64Size(
+        this->source_id());
+  }
+
   int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = cached_size;
@@ -417,6 +459,9 @@ void TaskRangeMerge::MergeFrom(const TaskRangeMerge& from) {
   ::google::protobuf::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
+  if (from.source_id() != 0) {
+    set_source_id(from.source_id());
+  }
 }
 
 void TaskRangeMerge::CopyFrom(const ::google::protobuf::Message& from) {
@@ -443,6 +488,7 @@ void TaskRangeMerge::Swap(TaskRangeMerge* other) {
 }
 void TaskRangeMerge::InternalSwap(TaskRangeMerge* other) {
   using std::swap;
+  swap(source_id_, other->source_id_);
   _internal_metadata_.Swap(&other->_internal_metadata_);
   swap(_cached_size_, other->_cached_size_);
 }
@@ -455,6 +501,20 @@ void TaskRangeMerge::InternalSwap(TaskRangeMerge* other) {
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
 // TaskRangeMerge
 
+// uint64 source_id = 1;
+void TaskRangeMerge::clear_source_id() {
+  source_id_ = GOOGLE_ULONGLONG(0);
+}
+::google::protobuf::uint64 TaskRangeMerge::source_id() const {
+  // @@protoc_insertion_point(field_get:taskpb.TaskRangeMerge.source_id)
+  return source_id_;
+}
+void TaskRangeMerge::set_source_id(::google::protobuf::uint64 value) {
+  
+  source_id_ = value;
+  // @@protoc_insertion_point(field_set:taskpb.TaskRangeMerge.source_id)
+}
+
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
 
 // ===================================================================
@@ -178,10 +178,17 @@ class TaskRangeMerge : public ::google::protobuf::Message /* @@protoc_insertion_
 
   // accessors -------------------------------------------------------
 
+  // uint64 source_id = 1;
+  void clear_source_id();
+  static const int kSourceIdFieldNumber = 1;
+  ::google::protobuf::uint64 source_id() const;
+  void set_source_id(::google::protobuf::uint64 value);
+
   // @@protoc_insertion_point(class_scope:taskpb.TaskRangeMerge)
  private:
 
   ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  ::google::protobuf::uint64 source_id_;
   mutable int _cached_size_;
   friend struct protobuf_taskpb_2eproto::TableStruct;
 };
@@ -741,6 +748,20 @@ class Task : public ::google::protobuf::Message /* @@protoc_insertion_point(clas
 #endif  // __GNUC__
 // TaskRangeMerge
 
+// uint64 source_id = 1;
+inline void TaskRangeMerge::clear_source_id() {
+  source_id_ = GOOGLE_ULONGLONG(0);
+}
+inline ::google::protobuf::uint64 TaskRangeMerge::source_id() const {
+  // @@protoc_insertion_point(field_get:taskpb.TaskRangeMerge.source_id)
+  return source_id_;
+}
+inline void TaskRangeMerge::set_source_id(::google::protobuf::uint64 value) {
+  
+  source_id_ = value;
+  // @@protoc_insertion_point(field_set:taskpb.TaskRangeMerge.source_id)
+}
+
 // -------------------------------------------------------------------
 
 // TaskRangeDelete
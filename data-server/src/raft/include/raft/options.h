@@ -85,6 +85,11 @@ struct RaftServerOptions {
     // 复制batch数量（按字节大小）
     uint64_t max_size_per_msg = 1024 * 1024;
 
+    // 每个副本在途日志的最大字节数，0表示只按条数控制
+    // 实际窗口根据副本的确认延迟在[max_size_per_msg, max_inflight_bytes]之间调整，
+    // 所有副本的窗口都满时新的提议返回kBusy
+    uint64_t max_inflight_bytes = 0;
+
     // raft一致性线程数量
     uint8_t consensus_threads_num = 4;
     // raft一致性队列长度
@@ -97,6 +102,19 @@ struct RaftServerOptions {
     // apply队列长度
     size_t apply_queue_capacity = 100000;
 
+    // 根据一致性线程的负载，把raft从繁忙的线程迁移到空闲的线程
+    bool enable_thread_balance = false;
+    // 负载检查周期
+    std::chrono::seconds balance_interval = std::chrono::seconds(10);
+    // 最忙和最闲线程的忙碌度（百分比）相差超过此值才迁移
+    unsigned balance_threshold_percent = 30;
+
+    // leader在持久化线程里异步写raft日志，与向follower复制并行进行,
+    // leader自身的复制进度(match)在日志写完后才推进
+    bool leader_async_persist = false;
+    // 持久化线程数量
+    uint8_t persist_threads_num = 4;
+
     TransportOptions transport_options;
     SnapshotOptions snapshot_options;
 
@@ -127,6 +145,10 @@ struct RaftOptions {
     // 日志创建时的起始index
     uint64_t initial_first_index = 0;
 
+    // 同一个raft排队中的多条小命令合并成一条日志，合并后不超过该大小
+    // 0表示不合并；开启后状态机需要处理合并的命令（见raft/types.h DecodeBatchCommand)
+    size_t max_batch_bytes = 0;
+
     // 已应用的位置，用于raft启动时recover
     uint64_t applied = 0;
 
@@ -21,7 +21,9 @@ public:
 
     virtual Status TryToLeader() = 0;
 
-    virtual Status Submit(std::string& cmd) = 0;
+    // batchable为false时该命令单独作为一条日志，不与其他命令合并
+    // （见RaftOptions::max_batch_bytes）
+    virtual Status Submit(std::string& cmd, bool batchable = true) = 0;
     virtual Status ChangeMemeber(const ConfChange& conf) = 0;
 
     virtual void GetStatus(RaftStatus* status) const = 0;
@@ -33,5 +33,16 @@ struct ConfChange {
     std::string ToString() const;
 };
 
+// 开启RaftOptions::max_batch_bytes后，多条命令可能被合并到一条日志里
+// 合并后的格式: 0x00 + N * (4字节长度(大端) + 命令)
+// 状态机的命令不能以0x00开头（protobuf序列化后的非空消息满足）
+// 合并只是减少日志条数，不提供原子性：状态机依次应用其中的命令，
+// 需要自己保证中途失败后整条日志重新应用是安全的
+bool IsBatchCommand(const std::string& data);
+// 把cmd追加到entry中，entry不是合并格式时先转换
+void AppendBatchCommand(std::string* entry, const std::string& cmd);
+// 拆分合并的命令，格式错误返回false
+bool DecodeBatchCommand(const std::string& data, std::vector<std::string>* cmds);
+
 } /* namespace raft */
 } /* namespace sharkstore */
@@ -11,6 +11,7 @@ namespace impl {
 struct RaftContext {
     WorkThread *consensus_thread = nullptr;
     WorkThread *apply_thread = nullptr;
+    WorkThread *persist_thread = nullptr;
     SnapshotManager *snapshot_manager = nullptr;
     transport::Transport *msg_sender = nullptr;
 };
@@ -19,6 +19,7 @@ RaftFsm::RaftFsm(const RaftServerOptions& sops, const RaftOptions& ops)
       rops_(ops),
       node_id_(sops.node_id),
       id_(ops.id),
+      async_persist_(sops.leader_async_persist && !ops.use_memory_storage),
       sm_(ops.statemachine) {
     auto s = start();
     if (!s.ok()) {
@@ -567,7 +568,9 @@ Status RaftFsm::applyConfChange(const EntryPtr& e) {
 
 std::unique_ptr<Replica> RaftFsm::newReplica(const Peer& peer, bool is_leader) const {
     if (is_leader) {
-        auto r = std::unique_ptr<Replica>(new Replica(peer, sops_.max_inflight_msgs));
+        auto r = std::unique_ptr<Replica>(new Replica(peer, sops_.max_inflight_msgs,
+                                                         sops_.max_inflight_bytes,
+                                                         sops_.max_size_per_msg));
         auto lasti = raft_log_->lastIndex();
         r->set_next(lasti + 1);
         if (peer.node_id == node_id_) {
@@ -36,6 +36,13 @@ public:
     pb::HardState GetHardState() const;
     Status Persist(bool persist_hardstate);
 
+    // leader是否在持久化线程里异步写日志
+    bool AsyncPersist() const { return async_persist_ && state_ == FsmState::kLeader; }
+    // 日志异步写完成，推进leader自身的复制进度
+    void StableTo(uint64_t index, uint64_t term);
+    // leader到所有follower的复制窗口（按字节）都已满
+    bool ReplicationSaturated() const;
+
     std::vector<Peer> GetPeers() const;
     RaftStatus GetStatus() const;
 
@@ -119,6 +126,7 @@ private:
     RaftOptions rops_;
     const uint64_t node_id_ = 0;
     const uint64_t id_ = 0;
+    const bool async_persist_ = false;
     std::shared_ptr<StateMachine> sm_;
 
     bool is_learner_ = false;
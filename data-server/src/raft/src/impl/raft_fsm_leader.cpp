@@ -288,8 +288,12 @@ void RaftFsm::sendAppend(uint64_t to, Replica& pr) {
             switch (pr.state()) {
                 case ReplicaState::kReplicate: {
                     uint64_t last = msg->entries(msg->entries_size() - 1).index();
+                    uint64_t bytes = 0;
+                    for (const auto& e : msg->entries()) {
+                        bytes += e.data().size();
+                    }
                     pr.update(last);
-                    pr.inflight().add(last);
+                    pr.inflight().add(last, bytes);
                     break;
                 }
                 case ReplicaState::kProbe:
@@ -311,10 +315,47 @@ void RaftFsm::appendEntry(const std::vector<EntryPtr>& ents) {
               ents.size());
 
     raft_log_->append(ents);
-    replicas_[node_id_]->maybeUpdate(raft_log_->lastIndex(), raft_log_->committed());
+    // 异步持久化时，leader自身的进度等日志写完后在StableTo里推进
+    if (!async_persist_) {
+        replicas_[node_id_]->maybeUpdate(raft_log_->lastIndex(), raft_log_->committed());
+    }
     maybeCommit();
 }
 
+void RaftFsm::StableTo(uint64_t index, uint64_t term) {
+    raft_log_->stableTo(index, term);
+
+    // 写完之前可能已经换了term或者不再是leader
+    if (state_ != FsmState::kLeader || term != term_) {
+        return;
+    }
+    auto it = replicas_.find(node_id_);
+    if (it == replicas_.end()) {
+        return;
+    }
+    if (it->second->maybeUpdate(index, raft_log_->committed())) {
+        if (maybeCommit()) {
+            bcastAppend();  // commit位置有更新，通知followers
+        }
+    }
+}
+
+bool RaftFsm::ReplicationSaturated() const {
+    if (state_ != FsmState::kLeader || sops_.max_inflight_bytes == 0) {
+        return false;
+    }
+    bool has_follower = false;
+    for (const auto& r : replicas_) {
+        if (r.first == node_id_) continue;
+        has_follower = true;
+        auto& pr = *r.second;
+        if (pr.state() != ReplicaState::kReplicate || !pr.inflight().full()) {
+            return false;
+        }
+    }
+    return has_follower;
+}
+
 static uint64_t unixNano() {
     auto now = std::chrono::system_clock::now();
     auto count = std::chrono::time_point_cast<std::chrono::nanoseconds>(now).time_since_epoch().count();
@@ -1,5 +1,6 @@
 #include "raft_impl.h"
 
+#include <algorithm>
 #include <sstream>
 
 #include "logger.h"
@@ -17,7 +18,11 @@ namespace impl {
 
 RaftImpl::RaftImpl(const RaftServerOptions& sops, const RaftOptions& ops,
                    const RaftContext& ctx)
-    : sops_(sops), ops_(ops), ctx_(ctx), fsm_(new RaftFsm(sops, ops)) {
+    : sops_(sops),
+      ops_(ops),
+      ctx_(ctx),
+      consensus_thread_(ctx.consensus_thread),
+      fsm_(new RaftFsm(sops, ops)) {
     initPublish();
 }
 
@@ -49,7 +54,8 @@ void RaftImpl::post(const std::function<void()>& f) {
     w.owner = ops_.id;
     w.stopped = &stopped_;
     w.f0 = f;
-    ctx_.consensus_thread->post(w);
+    std::lock_guard<std::mutex> lock(thread_mu_);
+    consensus_thread_->post(w);
 }
 
 bool RaftImpl::tryPost(const std::function<void()>& f) {
@@ -57,18 +63,54 @@ bool RaftImpl::tryPost(const std::function<void()>& f) {
     w.owner = ops_.id;
     w.stopped = &stopped_;
     w.f0 = f;
-    return ctx_.consensus_thread->tryPost(w);
+    std::lock_guard<std::mutex> lock(thread_mu_);
+    return consensus_thread_->tryPost(w);
 }
 
-Status RaftImpl::Submit(std::string& cmd) {
+WorkThread* RaftImpl::ConsensusThread() const {
+    std::lock_guard<std::mutex> lock(thread_mu_);
+    return consensus_thread_;
+}
+
+void RaftImpl::MigrateTo(WorkThread* to) {
+    // 在当前线程上执行迁移，此时本raft没有其他任务在运行
+    post(std::bind(&RaftImpl::migrate, shared_from_this(), to));
+}
+
+void RaftImpl::migrate(WorkThread* to) {
+    std::lock_guard<std::mutex> lock(thread_mu_);
+    auto from = consensus_thread_;
+    if (from == to) return;
+
+    std::vector<Work> works;
+    from->extract(ops_.id, &works);
+    to->postBatch(works);
+    consensus_thread_ = to;
+
+    LOG_INFO("raft[%llu] migrated to another consensus thread, %lu pending works moved",
+             ops_.id, works.size());
+}
+
+Status RaftImpl::Submit(std::string& cmd, bool batchable) {
     if (stopped_) {
         return Status(Status::kShutdownInProgress, "raft is removed",
                       std::to_string(ops_.id));
     }
 
-    if (ctx_.consensus_thread->submit(
+    // 复制跟不上，反压给上层，避免日志在leader内存里堆积
+    if (saturated_) {
+        return Status(Status::kBusy, "replication window full", std::to_string(ops_.id));
+    }
+
+    bool ok = false;
+    {
+        std::lock_guard<std::mutex> lock(thread_mu_);
+        ok = consensus_thread_->submit(
             ops_.id, &stopped_,
-            std::bind(&RaftImpl::Step, shared_from_this(), std::placeholders::_1), cmd)) {
+            std::bind(&RaftImpl::Step, shared_from_this(), std::placeholders::_1), cmd,
+            ops_.max_batch_bytes, batchable);
+    }
+    if (ok) {
         return Status::OK();
     } else {
         return Status(Status::kBusy);
@@ -137,6 +179,10 @@ void RaftImpl::Step(MessagePtr msg) {
     }
 
     fsm_->Step(msg);
+    handleReady();
+}
+
+void RaftImpl::handleReady() {
     fsm_->GetReady(&ready_);
 
     // 发送消息
@@ -156,6 +202,8 @@ void RaftImpl::Step(MessagePtr msg) {
 
     // 持久化
     persist();
+
+    saturated_ = fsm_->ReplicationSaturated();
 }
 
 void RaftImpl::sendMessages() {
@@ -239,6 +287,15 @@ void RaftImpl::apply() {
 
 // 持久化
 void RaftImpl::persist() {
+    if (ctx_.persist_thread != nullptr && fsm_->AsyncPersist()) {
+        persistAsync();
+        return;
+    }
+
+    // 同步持久化前先等之前的异步写完成，保证日志按顺序落盘
+    waitPersisting();
+    persisting_index_ = 0;
+
     auto hs = fsm_->GetHardState();
     bool hs_changed = prev_hard_state_.term() != hs.term() ||
                       prev_hard_state_.vote() != hs.vote() ||
@@ -250,6 +307,83 @@ void RaftImpl::persist() {
     if (!s.ok()) throw RaftException(s);
 }
 
+void RaftImpl::persistAsync() {
+    {
+        std::lock_guard<std::mutex> lock(persist_mu_);
+        // 上一批还没写完，写完后会在onPersisted里再次调用
+        if (persisting_) return;
+    }
+
+    // 跳过已经交给持久化线程的日志
+    std::vector<EntryPtr> ents;
+    fsm_->raft_log_->unstableEntries(&ents);
+    auto it = std::find_if(ents.begin(), ents.end(), [this](const EntryPtr& e) {
+        return e->index() > persisting_index_;
+    });
+    ents.erase(ents.begin(), it);
+
+    auto hs = fsm_->GetHardState();
+    bool hs_changed = prev_hard_state_.term() != hs.term() ||
+                      prev_hard_state_.vote() != hs.vote() ||
+                      prev_hard_state_.commit() != hs.commit();
+    if (ents.empty() && !hs_changed) return;
+    if (hs_changed) {
+        prev_hard_state_ = hs;
+    }
+
+    uint64_t index = 0, term = 0;
+    if (!ents.empty()) {
+        index = ents.back()->index();
+        term = ents.back()->term();
+        persisting_index_ = index;
+    }
+    {
+        std::lock_guard<std::mutex> lock(persist_mu_);
+        persisting_ = true;
+    }
+
+    auto self = shared_from_this();
+    auto storage = fsm_->storage_;
+    Work w;
+    w.owner = ops_.id;
+    w.stopped = &stopped_;
+    w.f0 = [self, storage, ents, hs, hs_changed, index, term] {
+        Status s;
+        if (!ents.empty()) {
+            s = storage->StoreEntries(ents);
+            if (!s.ok()) s = Status(Status::kIOError, "store entries", s.ToString());
+        }
+        if (s.ok() && hs_changed) {
+            s = storage->StoreHardState(hs);
+            if (!s.ok()) s = Status(Status::kIOError, "store hardstate", s.ToString());
+        }
+        {
+            std::lock_guard<std::mutex> lock(self->persist_mu_);
+            self->persisting_ = false;
+        }
+        self->persist_cv_.notify_all();
+        self->post(std::bind(&RaftImpl::onPersisted, self, index, term, s));
+    };
+    ctx_.persist_thread->post(w);
+}
+
+void RaftImpl::waitPersisting() {
+    std::unique_lock<std::mutex> lock(persist_mu_);
+    while (persisting_ && !stopped_) {
+        persist_cv_.wait_for(lock, std::chrono::milliseconds(100));
+    }
+}
+
+void RaftImpl::onPersisted(uint64_t index, uint64_t term, const Status& s) {
+    if (!s.ok()) throw RaftException(s);
+
+    if (index > 0) {
+        fsm_->StableTo(index, term);
+    }
+    // 推进commit、发送写完期间积累的日志
+    handleReady();
+}
+
 void RaftImpl::publish() {
     // leader或term有变化，更新leader和term
     bool leader_changed = false;
@@ -1,6 +1,8 @@
 _Pragma("once");
 
+#include <condition_variable>
 #include <list>
+#include <mutex>
 #include "raft/options.h"
 #include "raft/raft.h"
 
@@ -31,7 +33,7 @@ public:
 
     Status TryToLeader() override;
 
-    Status Submit(std::string& cmd) override;
+    Status Submit(std::string& cmd, bool batchable = true) override;
     Status ChangeMemeber(const ConfChange& conf) override;
 
     bool IsLeader() const override { return sops_.node_id == bulletin_board_.Leader(); }
@@ -52,6 +54,12 @@ public:
     // 删除raft日志
     Status Destroy(bool backup);
 
+    // 当前所在的一致性线程
+    WorkThread* ConsensusThread() const;
+    WorkThread* ApplyThread() const { return ctx_.apply_thread; }
+    // 迁移到另一个一致性线程，在当前线程上处理完已经开始的任务后切换
+    void MigrateTo(WorkThread* to);
+
 public:
     void RecvMsg(MessagePtr msg);
     void Tick(MessagePtr msg);
@@ -65,6 +73,7 @@ private:
 
     void post(const std::function<void()>& f);
     bool tryPost(const std::function<void()>& f);
+    void migrate(WorkThread* to);
 
     void smApply(const EntryPtr& e);
 
@@ -72,7 +81,15 @@ private:
     void sendSnapshot();
     void applySnapshot();
 
+    void handleReady();
+
     void persist();
+    // leader把未持久化的日志交给持久化线程，同一时刻最多一个在写
+    void persistAsync();
+    // 等待正在进行的异步持久化写完
+    void waitPersisting();
+    void onPersisted(uint64_t index, uint64_t term, const Status& s);
+
     void apply();
     void publish();
 
@@ -83,7 +100,14 @@ private:
     const RaftOptions ops_;
     const RaftContext ctx_;
 
+    // 一致性线程可以被迁移，投递任务时需要持有thread_mu_,
+    // 保证迁移时旧线程队列里的任务整体搬到新线程且顺序不变
+    mutable std::mutex thread_mu_;
+    WorkThread* consensus_thread_ = nullptr;
+
     std::atomic<bool> stopped_ = {false};
+    // 所有follower的复制窗口已满，由一致性线程更新
+    std::atomic<bool> saturated_ = {false};
 
     BulletinBoard bulletin_board_;
 
@@ -91,6 +115,13 @@ private:
 
     Ready ready_;
     pb::HardState prev_hard_state_;
+
+    // 异步持久化状态，persisting_由持久化线程清除
+    std::mutex persist_mu_;
+    std::condition_variable persist_cv_;
+    bool persisting_ = false;
+    // 已经交给持久化线程的最大日志index
+    uint64_t persisting_index_ = 0;
     bool conf_changed_ = false;
     std::atomic<uint64_t> tick_count_ = {0};
 };
@@ -1,5 +1,6 @@
 #include "replica.h"
 
+#include <algorithm>
 #include <sstream>
 #include "raft_exception.h"
 
@@ -7,45 +8,87 @@ namespace sharkstore {
 namespace raft {
 namespace impl {
 
-Inflight::Inflight(int max) : capacity_(max), buffer_(max) {}
+Inflight::Inflight(int max, uint64_t max_bytes, uint64_t min_bytes)
+    : capacity_(max),
+      buffer_(max),
+      max_window_(max_bytes),
+      min_window_(std::min(min_bytes, max_bytes)),
+      window_(max_bytes) {}
 
-void Inflight::add(uint64_t index) {
+void Inflight::add(uint64_t index, uint64_t bytes) {
     if (full()) {
         throw RaftException("inflight.add cannot add into a full inflights.");
     }
 
     int idx = (start_ + count_) % capacity_;
-    buffer_[idx] = index;
+    buffer_[idx].index = index;
+    buffer_[idx].bytes = bytes;
+    if (max_window_ > 0) {
+        buffer_[idx].sent_time = std::chrono::steady_clock::now();
+    }
+    bytes_ += bytes;
     ++count_;
 }
 
 void Inflight::freeTo(uint64_t index) {
-    if (0 == count_ || index < buffer_[start_]) {
+    if (0 == count_ || index < buffer_[start_].index) {
         return;
     }
-    int i = 0, idx = start_;
+    int i = 0, idx = start_, last = start_;
     for (; i < count_; ++i) {
-        if (index < buffer_[idx]) {
+        if (index < buffer_[idx].index) {
             break;
         }
+        bytes_ -= buffer_[idx].bytes;
+        last = idx;
         ++idx;
         idx %= capacity_;
     }
     count_ -= i;
     start_ = idx;
+
+    if (max_window_ > 0) {
+        adjustWindow(std::chrono::steady_clock::now() - buffer_[last].sent_time);
+    }
 }
 
-void Inflight::freeFirstOne() { freeTo(buffer_[start_]); }
+void Inflight::freeFirstOne() {
+    if (count_ > 0) {
+        freeTo(buffer_[start_].index);
+    }
+}
 
-bool Inflight::full() const { return count_ == capacity_; }
+bool Inflight::full() const {
+    if (count_ == capacity_) {
+        return true;
+    }
+    // 至少允许一条消息在途
+    return max_window_ > 0 && count_ > 0 && bytes_ >= window_;
+}
 
 void Inflight::reset() {
     count_ = 0;
     start_ = 0;
+    bytes_ = 0;
 }
 
-Replica::Replica(const Peer& peer, int max_inflight)
-    : peer_(peer), inflight_(max_inflight) {}
+void Inflight::adjustWindow(std::chrono::steady_clock::duration latency) {
+    if (latency < min_latency_) {
+        min_latency_ = latency;
+    } else {
+        // 基准缓慢跟随，避免一次偶然的低延迟导致窗口一直无法恢复
+        min_latency_ += (latency - min_latency_) / 64;
+    }
+    if (latency <= min_latency_ * 2) {
+        window_ = std::min(window_ + min_window_, max_window_);
+    } else if (latency > min_latency_ * 4) {
+        window_ = std::max(window_ / 2, min_window_);
+    }
+}
+
+Replica::Replica(const Peer& peer, int max_inflight, uint64_t max_inflight_bytes,
+                 uint64_t min_inflight_bytes)
+    : peer_(peer), inflight_(max_inflight, max_inflight_bytes, min_inflight_bytes) {}
 
 void Replica::resetState(ReplicaState state) {
     paused_ = false;
@@ -149,6 +192,9 @@ std::string Replica::ToString() const {
     ss << "next=" << next_ << ", match=" << match_ << ", commit=" << committed_
        << ", state=" << ReplicateStateName(state_)
        << ", pendingSnapshot=" << pendingSnap_;
+    if (inflight_.window() > 0) {
+        ss << ", inflight=" << inflight_.bytes() << "/" << inflight_.window();
+    }
     return ss.str();
 }
 
@@ -1,5 +1,6 @@
 _Pragma("once");
 
+#include <chrono>
 #include "raft.pb.h"
 #include "raft_types.h"
 
@@ -9,27 +10,51 @@ namespace impl {
 
 class Inflight {
 public:
-    explicit Inflight(int max);
+    // max: 最多在途的消息个数
+    // max_bytes: 在途字节数窗口的上限，0表示不按字节控制
+    // min_bytes: 窗口的下限
+    explicit Inflight(int max, uint64_t max_bytes = 0, uint64_t min_bytes = 0);
 
     Inflight(const Inflight&) = delete;
     Inflight& operator=(const Inflight&) = delete;
 
-    void add(uint64_t index);
+    void add(uint64_t index, uint64_t bytes = 0);
     void freeTo(uint64_t index);
     void freeFirstOne();
     bool full() const;
     void reset();
 
+    uint64_t bytes() const { return bytes_; }
+    uint64_t window() const { return window_; }
+
+private:
+    // 根据确认延迟调整窗口：
+    // 延迟接近观察到的最小值时窗口加性增长，明显变大时减半
+    void adjustWindow(std::chrono::steady_clock::duration latency);
+
 private:
-    const int capacity_ = 0;        // 循环buffer的大小
-    std::vector<uint64_t> buffer_;  // 循环buffer
+    struct Item {
+        uint64_t index = 0;
+        uint64_t bytes = 0;
+        std::chrono::steady_clock::time_point sent_time;
+    };
+
+    const int capacity_ = 0;    // 循环buffer的大小
+    std::vector<Item> buffer_;  // 循环buffer
     int start_ = 0;
     int count_ = 0;
+
+    const uint64_t max_window_ = 0;
+    const uint64_t min_window_ = 0;
+    uint64_t window_ = 0;  // 当前窗口
+    uint64_t bytes_ = 0;   // 在途字节数
+    std::chrono::steady_clock::duration min_latency_ = std::chrono::steady_clock::duration::max();
 };
 
 class Replica {
 public:
-    explicit Replica(const Peer& peer, int max_inflight = 0);
+    explicit Replica(const Peer& peer, int max_inflight = 0,
+                     uint64_t max_inflight_bytes = 0, uint64_t min_inflight_bytes = 0);
     ~Replica() = default;
 
     Replica(const Replica&) = delete;
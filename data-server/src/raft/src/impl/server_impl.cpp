@@ -1,5 +1,7 @@
 #include "server_impl.h"
 
+#include <cassert>
+#include <map>
 #include <thread>
 
 #include "logger.h"
@@ -28,6 +30,9 @@ RaftServerImpl::~RaftServerImpl() {
     for (auto t : apply_threads_) {
         delete t;
     }
+    for (auto t : persist_threads_) {
+        delete t;
+    }
 }
 
 Status RaftServerImpl::Start() {
@@ -54,6 +59,16 @@ Status RaftServerImpl::Start() {
     LOG_INFO("raft[server] %d apply threads start. queue capacity=%d",
              ops_.apply_threads_num, ops_.apply_queue_capacity);
 
+    // 初始化leader日志持久化线程池
+    if (ops_.leader_async_persist) {
+        for (int i = 0; i < ops_.persist_threads_num; ++i) {
+            auto t = new WorkThread(this, ops_.consensus_queue_capacity,
+                                    std::string("raft-persist:") + std::to_string(i));
+            persist_threads_.push_back(t);
+        }
+        LOG_INFO("raft[server] %d persist threads start.", ops_.persist_threads_num);
+    }
+
     // start transport
     if (ops_.transport_options.use_inprocess_transport) {
         transport_.reset(new transport::InProcessTransport(ops_.node_id));
@@ -74,6 +89,7 @@ Status RaftServerImpl::Start() {
     snapshot_manager_.reset(new SnapshotManager(ops_.snapshot_options));
 
     running_ = true;
+    last_balance_ = std::chrono::steady_clock::now();
     tick_thr_.reset(new std::thread([this]() {
         tickRoutine(); }));
 
@@ -95,6 +111,10 @@ Status RaftServerImpl::Stop() {
         t->shutdown();
     }
 
+    for (auto& t : persist_threads_) {
+        t->shutdown();
+    }
+
     if (snapshot_manager_ != nullptr) {
         snapshot_manager_.reset(nullptr);
     }
@@ -112,7 +132,6 @@ Status RaftServerImpl::CreateRaft(const RaftOptions& ops, std::shared_ptr<Raft>*
         return status;
     }
 
-    uint64_t counter = 0;
     {
         std::unique_lock<sharkstore::shared_mutex> lock(rafts_mu_);
         auto it = all_rafts_.find(ops.id);
@@ -123,15 +142,17 @@ Status RaftServerImpl::CreateRaft(const RaftOptions& ops, std::shared_ptr<Raft>*
         if (!ret.second) {
             return Status(Status::kDuplicate, "raft is creating", std::to_string(ops.id));
         }
-        counter = create_count_++;
     }
 
     RaftContext ctx;
     ctx.msg_sender = transport_.get();
     ctx.snapshot_manager = snapshot_manager_.get();
-    ctx.consensus_thread = consensus_threads_[counter % consensus_threads_.size()];
+    ctx.consensus_thread = selectThread(consensus_threads_, true);
     if (!ops_.apply_in_place) {
-        ctx.apply_thread = apply_threads_[counter % apply_threads_.size()];
+        ctx.apply_thread = selectThread(apply_threads_, false);
+    }
+    if (!persist_threads_.empty() && !ops.use_memory_storage) {
+        ctx.persist_thread = persist_threads_[ops.id % persist_threads_.size()];
     }
 
     std::shared_ptr<RaftImpl> r;
@@ -346,7 +367,86 @@ void RaftServerImpl::tickRoutine() {
         sendHeartbeat(rafts);
         stepTick(rafts);
         printMetrics();
+        balanceThreads(rafts);
+    }
+}
+
+WorkThread* RaftServerImpl::selectThread(const std::vector<WorkThread*>& threads,
+                                         bool consensus) const {
+    assert(!threads.empty());
+    std::map<WorkThread*, size_t> counts;
+    for (auto t : threads) {
+        counts[t] = 0;
     }
+    {
+        sharkstore::shared_lock<sharkstore::shared_mutex> lock(rafts_mu_);
+        for (const auto& r : all_rafts_) {
+            auto t = consensus ? r.second->ConsensusThread() : r.second->ApplyThread();
+            auto it = counts.find(t);
+            if (it != counts.end()) ++it->second;
+        }
+    }
+    // 个数相同时选排在前面的
+    WorkThread* selected = threads[0];
+    for (auto t : threads) {
+        if (counts[t] < counts[selected]) {
+            selected = t;
+        }
+    }
+    return selected;
+}
+
+void RaftServerImpl::balanceThreads(const RaftMapType& rafts) {
+    if (!ops_.enable_thread_balance || consensus_threads_.size() < 2) {
+        return;
+    }
+
+    auto now = std::chrono::steady_clock::now();
+    if (now - last_balance_ < ops_.balance_interval) {
+        return;
+    }
+    auto period = std::chrono::duration_cast<std::chrono::microseconds>(now - last_balance_).count();
+    last_balance_ = now;
+    if (period <= 0) return;
+
+    // 收集各线程负载
+    size_t n = consensus_threads_.size();
+    std::vector<uint64_t> busy(n, 0);
+    std::vector<std::unordered_map<uint64_t, uint64_t>> owner_busy(n);
+    size_t hot = 0, cold = 0;
+    for (size_t i = 0; i < n; ++i) {
+        busy[i] = consensus_threads_[i]->collectLoad(&owner_busy[i]);
+        if (busy[i] > busy[hot]) hot = i;
+        if (busy[i] < busy[cold]) cold = i;
+    }
+
+    uint64_t hot_percent = busy[hot] * 100 / period;
+    uint64_t cold_percent = busy[cold] * 100 / period;
+    if (hot == cold || hot_percent < cold_percent + ops_.balance_threshold_percent) {
+        return;
+    }
+
+    // 在最忙的线程上选一个raft: 负载不超过两个线程差值的一半，且尽量大,
+    // 迁移后两个线程更接近，避免来回迁移
+    uint64_t gap = (busy[hot] - busy[cold]) / 2;
+    uint64_t target = 0, target_busy = 0;
+    for (const auto& kv : owner_busy[hot]) {
+        if (kv.second <= gap && kv.second > target_busy) {
+            target = kv.first;
+            target_busy = kv.second;
+        }
+    }
+    if (target == 0) return;
+
+    auto it = rafts.find(target);
+    if (it == rafts.end() || it->second->ConsensusThread() != consensus_threads_[hot]) {
+        return;
+    }
+
+    LOG_INFO("raft[balance] migrate raft[%lu](busy %lu%%) from consensus thread %lu(%lu%%) "
+             "to %lu(%lu%%)",
+             target, target_busy * 100 / period, hot, hot_percent, cold, cold_percent);
+    it->second->MigrateTo(consensus_threads_[cold]);
 }
 
 void RaftServerImpl::printMetrics() {
@@ -1,6 +1,7 @@
 _Pragma("once");
 
 #include <atomic>
+#include <chrono>
 #include <thread>
 #include <unordered_map>
 #include <unordered_set>
@@ -54,6 +55,11 @@ private:
 
     void stepTick(const RaftMapType& rafts);
     void printMetrics();
+
+    // 选择管理raft个数最少的线程
+    WorkThread* selectThread(const std::vector<WorkThread*>& threads, bool consensus) const;
+    // 按负载在一致性线程间迁移raft
+    void balanceThreads(const RaftMapType& rafts);
     void tickRoutine();
 
 private:
@@ -62,7 +68,6 @@ private:
 
     RaftMapType all_rafts_;
     std::unordered_set<uint64_t> creating_rafts_;  // 正在被创建的
-    uint64_t create_count_ = 0;
     mutable sharkstore::shared_mutex rafts_mu_;
 
     std::unique_ptr<transport::Transport> transport_;
@@ -70,6 +75,9 @@ private:
 
     std::vector<WorkThread*> consensus_threads_;
     std::vector<WorkThread*> apply_threads_;
+    std::vector<WorkThread*> persist_threads_;
+
+    std::chrono::steady_clock::time_point last_balance_;
 
     MessagePtr tick_msg_;
     // TODO: more tick threads or put ticks into consensus_threads
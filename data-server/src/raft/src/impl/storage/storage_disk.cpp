@@ -213,6 +213,7 @@ Status DiskStorage::closeLogs() {
 }
 
 Status DiskStorage::StoreHardState(const pb::HardState& hs) {
+    std::lock_guard<std::mutex> lock(mu_);
     if (ops_.readonly) {
         return Status(Status::kNotSupported, "store hard state", "read only");
     }
@@ -231,6 +232,7 @@ Status DiskStorage::StoreHardState(const pb::HardState& hs) {
 }
 
 Status DiskStorage::InitialState(pb::HardState* hs) const {
+    std::lock_guard<std::mutex> lock(mu_);
     *hs = hard_state_;
     return Status::OK();
 }
@@ -266,6 +268,7 @@ Status DiskStorage::save(const EntryPtr& e) {
 }
 
 Status DiskStorage::StoreEntries(const std::vector<EntryPtr>& entries) {
+    std::lock_guard<std::mutex> lock(mu_);
     if (ops_.readonly) {
         return Status(Status::kNotSupported, "store entries", "read only");
     }
@@ -290,7 +293,7 @@ Status DiskStorage::StoreEntries(const std::vector<EntryPtr>& entries) {
             }
         }
         if (truncate_index != 0) {
-            s = Truncate(truncate_index);
+            s = doTruncate(truncate_index);
             if (!s.ok()) {
                 return Status(Status::kIOError, "truncate log file", s.ToString());
             }
@@ -340,6 +343,11 @@ Status DiskStorage::StoreEntries(const std::vector<EntryPtr>& entries) {
 }
 
 Status DiskStorage::Term(uint64_t index, uint64_t* term, bool* is_compacted) const {
+    std::lock_guard<std::mutex> lock(mu_);
+    return getTerm(index, term, is_compacted);
+}
+
+Status DiskStorage::getTerm(uint64_t index, uint64_t* term, bool* is_compacted) const {
     if (index < trunc_meta_.index()) {
         *term = 0;
         *is_compacted = true;
@@ -362,17 +370,20 @@ Status DiskStorage::Term(uint64_t index, uint64_t* term, bool* is_compacted) con
 }
 
 Status DiskStorage::FirstIndex(uint64_t* index) const {
+    std::lock_guard<std::mutex> lock(mu_);
     *index = trunc_meta_.index() + 1;
     return Status::OK();
 }
 
 Status DiskStorage::LastIndex(uint64_t* index) const {
+    std::lock_guard<std::mutex> lock(mu_);
     *index = std::max(last_index_, trunc_meta_.index());
     return Status::OK();
 }
 
 Status DiskStorage::Entries(uint64_t lo, uint64_t hi, uint64_t max_size,
                             std::vector<EntryPtr>* entries, bool* is_compacted) const {
+    std::lock_guard<std::mutex> lock(mu_);
     if (lo <= trunc_meta_.index()) {
         *is_compacted = true;
         return Status::OK();
@@ -485,6 +496,11 @@ Status DiskStorage::truncateAll() {
 }
 
 Status DiskStorage::Truncate(uint64_t index) {
+    std::lock_guard<std::mutex> lock(mu_);
+    return doTruncate(index);
+}
+
+Status DiskStorage::doTruncate(uint64_t index) {
     if (ops_.readonly) {
         return Status(Status::kNotSupported, "truncate", "read only");
     }
@@ -502,7 +518,7 @@ Status DiskStorage::Truncate(uint64_t index) {
     // 获取truncate index对应的term
     uint64_t term = 0;
     bool is_compacted = false;
-    auto s = Term(index, &term, &is_compacted);
+    auto s = getTerm(index, &term, &is_compacted);
     if (!s.ok()) {
         return s;
     } else if (is_compacted) {
@@ -534,6 +550,7 @@ Status DiskStorage::Truncate(uint64_t index) {
 }
 
 Status DiskStorage::ApplySnapshot(const pb::SnapshotMeta& meta) {
+    std::lock_guard<std::mutex> lock(mu_);
     if (ops_.readonly) {
         return Status(Status::kNotSupported, "apply snapshot", "read only");
     }
@@ -564,18 +581,21 @@ Status DiskStorage::ApplySnapshot(const pb::SnapshotMeta& meta) {
 }
 
 void DiskStorage::AppliedTo(uint64_t applied) {
+    std::lock_guard<std::mutex> lock(mu_);
     if (applied > applied_) {
         applied_ = applied;
     }
 }
 
 Status DiskStorage::Close() {
+    std::lock_guard<std::mutex> lock(mu_);
     auto s = meta_file_.Close();
     if (!s.ok()) return s;
     return closeLogs();
 }
 
 Status DiskStorage::Destroy(bool backup) {
+    std::lock_guard<std::mutex> lock(mu_);
     if (ops_.readonly) {
         return Status(Status::kNotSupported, "destroy", "read only");
     }
@@ -1,6 +1,7 @@
 _Pragma("once");
 
 #include <atomic>
+#include <mutex>
 #include "meta_file.h"
 #include "storage.h"
 
@@ -88,6 +89,9 @@ private:
     Status tryRotate();
     Status save(const EntryPtr& e);
 
+    Status getTerm(uint64_t index, uint64_t* term, bool* is_compacted) const;
+    Status doTruncate(uint64_t index);
+
 private:
     const uint64_t id_ = 0;
     const std::string path_;
@@ -102,6 +106,10 @@ private:
     uint64_t last_index_ = 0;
 
     std::atomic<bool> destroyed_ = {false};
+
+    // leader异步持久化时StoreEntries/StoreHardState在持久化线程中执行,
+    // 与raft线程上的读取、截断并发
+    mutable std::mutex mu_;
 };
 
 } /* namespace storage */
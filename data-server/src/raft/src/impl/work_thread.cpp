@@ -1,6 +1,7 @@
 #include "work_thread.h"
 
 #include <assert.h>
+#include <chrono>
 #include <thread>
 #include "base/util.h"
 #include "logger.h"
@@ -36,7 +37,7 @@ WorkThread::~WorkThread() { shutdown(); }
 
 bool WorkThread::submit(uint64_t owner, std::atomic<bool>* stopped,
                         const std::function<void(MessagePtr&)>& f1,
-                        std::string& cmd) {
+                        std::string& cmd, size_t max_batch_bytes, bool batchable) {
     MessagePtr msg(new pb::Message);
     msg->set_type(pb::LOCAL_MSG_PROP);
 
@@ -46,7 +47,15 @@ bool WorkThread::submit(uint64_t owner, std::atomic<bool>* stopped,
         if (!running_) return false;
 
         auto it = batch_pos_.find(owner);
-        if (it != batch_pos_.end() &&
+        pb::Entry* last = nullptr;
+        if (it != batch_pos_.end() && max_batch_bytes > 0 && batchable) {
+            last = it->second->mutable_entries(it->second->entries_size() - 1);
+        }
+        if (last != nullptr &&
+            last->data().size() + cmd.size() + 16 <= max_batch_bytes) {
+            // 合并到同一条日志（16: 预留合并格式的头部）
+            AppendBatchCommand(last->mutable_data(), cmd);
+        } else if (it != batch_pos_.end() &&
             it->second->entries_size() < kMaxBatchSize) {
             // 可以合并
             auto entry = it->second->add_entries();
@@ -64,10 +73,14 @@ bool WorkThread::submit(uint64_t owner, std::atomic<bool>* stopped,
             w.stopped = stopped;
             w.f1 = f1;
             w.msg = msg;
-            queue_.push(w);
+            queue_.push_back(w);
             batch_pos_[owner] = msg;
             notify = true;
         }
+        if (!batchable) {
+            // 该命令单独一条日志，之后的命令不能再合并进来
+            batch_pos_.erase(owner);
+        }
     }
     if (notify) {
         cv_.notify_one();
@@ -82,7 +95,7 @@ bool WorkThread::tryPost(const Work& w) {
         if (queue_.size() >= capacity_) {
             return false;
         } else {
-            queue_.push(w);
+            queue_.push_back(w);
         }
     }
     cv_.notify_one();
@@ -93,7 +106,7 @@ void WorkThread::post(const Work& w) {
     {
         std::lock_guard<std::mutex> lock(mu_);
         if (!running_) return;
-        queue_.push(w);
+        queue_.push_back(w);
     }
     cv_.notify_one();
 }
@@ -105,7 +118,7 @@ void WorkThread::waitPost(const Work& w) {
     }
 
     if (running_) {
-        queue_.push(w);
+        queue_.push_back(w);
         lock.unlock();
         cv_.notify_one();
     }
@@ -119,6 +132,14 @@ void WorkThread::shutdown() {
     }
     cv_.notify_one();
     thr_->join();
+
+    // 丢弃未执行的任务，释放其持有的raft（及状态机）
+    std::deque<Work> pending;
+    {
+        std::lock_guard<std::mutex> lock(mu_);
+        pending.swap(queue_);
+        batch_pos_.clear();
+    }
 }
 
 bool WorkThread::pull(Work* w) {
@@ -129,7 +150,7 @@ bool WorkThread::pull(Work* w) {
     }
     if (!running_) return false;
     *w = queue_.front();
-    queue_.pop();
+    queue_.pop_front();
 
     if (w->msg != nullptr && w->msg->type() == pb::LOCAL_MSG_PROP) {
         assert(w->owner != 0);
@@ -149,6 +170,7 @@ void WorkThread::run() {
     while (true) {
         Work work;
         if (pull(&work)) {
+            auto begin = std::chrono::steady_clock::now();
             try {
                 work.Do();
             } catch (RaftException& e) {
@@ -157,6 +179,9 @@ void WorkThread::run() {
                           work.owner, e.what());
                 server_->RemoveRaft(work.owner);
             }
+            auto elapsed = std::chrono::steady_clock::now() - begin;
+            addBusy(work.owner,
+                    std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count());
         } else {
             // shutdown
             return;
@@ -169,6 +194,47 @@ int WorkThread::size() const {
     return queue_.size();
 }
 
+void WorkThread::extract(uint64_t owner, std::vector<Work>* works) {
+    std::lock_guard<std::mutex> lock(mu_);
+    for (auto it = queue_.begin(); it != queue_.end();) {
+        if (it->owner == owner) {
+            works->push_back(*it);
+            it = queue_.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    // 已经取走的消息不能再合并新的提议
+    batch_pos_.erase(owner);
+}
+
+void WorkThread::postBatch(const std::vector<Work>& works) {
+    if (works.empty()) return;
+    {
+        std::lock_guard<std::mutex> lock(mu_);
+        if (!running_) return;
+        queue_.insert(queue_.end(), works.begin(), works.end());
+    }
+    cv_.notify_one();
+}
+
+void WorkThread::addBusy(uint64_t owner, uint64_t micros) {
+    std::lock_guard<std::mutex> lock(load_mu_);
+    busy_micros_ += micros;
+    owner_busy_[owner] += micros;
+}
+
+uint64_t WorkThread::collectLoad(std::unordered_map<uint64_t, uint64_t>* owner_busy) {
+    std::lock_guard<std::mutex> lock(load_mu_);
+    auto busy = busy_micros_;
+    busy_micros_ = 0;
+    if (owner_busy != nullptr) {
+        owner_busy->swap(owner_busy_);
+    }
+    owner_busy_.clear();
+    return busy;
+}
+
 } /* namespace impl */
 } /* namespace raft */
 } /* namespace sharkstore */
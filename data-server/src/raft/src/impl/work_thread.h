@@ -2,12 +2,13 @@ _Pragma("once");
 
 #include <atomic>
 #include <condition_variable>
+#include <deque>
 #include <memory>
 #include <mutex>
-#include <queue>
 #include <thread>
 #include <functional>
 #include <unordered_map>
+#include <vector>
 #include "raft_types.h"
 
 namespace sharkstore {
@@ -41,7 +42,8 @@ public:
     WorkThread& operator=(const WorkThread&) = delete;
 
     bool submit(uint64_t owner, std::atomic<bool>* stopped,
-                const std::function<void(MessagePtr&)>& f1, std::string& cmd);
+                const std::function<void(MessagePtr&)>& f1, std::string& cmd,
+                size_t max_batch_bytes = 0, bool batchable = true);
 
     bool tryPost(const Work& w);
     void post(const Work& w);
@@ -49,9 +51,18 @@ public:
     void shutdown();
     int size() const;
 
+    // 取出队列中属于owner的所有任务（保持顺序），用于把raft迁移到其他线程
+    void extract(uint64_t owner, std::vector<Work>* works);
+    // 按顺序放入一批任务，不受队列容量限制
+    void postBatch(const std::vector<Work>& works);
+
+    // 返回上次收集以来线程的忙碌时间以及各个owner占用的时间（微秒）
+    uint64_t collectLoad(std::unordered_map<uint64_t, uint64_t>* owner_busy);
+
 private:
     bool pull(Work* w);
     void run();
+    void addBusy(uint64_t owner, uint64_t micros);
 
 private:
     RaftServerImpl* server_ = nullptr;
@@ -59,11 +70,16 @@ private:
 
     std::unique_ptr<std::thread> thr_;
     bool running_ = false;
-    std::queue<Work> queue_;
+    std::deque<Work> queue_;
     // 记录每个range最近一条LOCAL_MSG_PROP消息，便于batch合并
     std::unordered_map<uint64_t, MessagePtr> batch_pos_;
     mutable std::mutex mu_;
     std::condition_variable cv_;
+
+    // 负载统计
+    std::mutex load_mu_;
+    uint64_t busy_micros_ = 0;
+    std::unordered_map<uint64_t, uint64_t> owner_busy_;
 };
 
 } /* namespace impl */
@@ -72,6 +72,11 @@ Status RaftServerOptions::Validate() const {
                       "max size per msg");
     }
 
+    if (max_inflight_bytes > 0 && max_inflight_bytes < max_size_per_msg) {
+        return Status(Status::kInvalidArgument, "raft server options",
+                      "max inflight bytes less than max size per msg");
+    }
+
     if (consensus_threads_num == 0) {
         return Status(Status::kInvalidArgument, "raft server options",
                       "consensus threads num");
@@ -92,6 +97,22 @@ Status RaftServerOptions::Validate() const {
         }
     }
 
+    if (enable_thread_balance) {
+        if (balance_interval.count() <= 0) {
+            return Status(Status::kInvalidArgument, "raft server options",
+                          "balance interval");
+        }
+        if (balance_threshold_percent == 0 || balance_threshold_percent >= 100) {
+            return Status(Status::kInvalidArgument, "raft server options",
+                          "balance threshold percent");
+        }
+    }
+
+    if (leader_async_persist && persist_threads_num == 0) {
+        return Status(Status::kInvalidArgument, "raft server options",
+                      "persist threads num");
+    }
+
     auto s = snapshot_options.Validate();
     if (!s.ok()) return s;
 
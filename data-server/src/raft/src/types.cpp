@@ -61,5 +61,48 @@ std::string ConfChange::ToString() const {
     return ss.str();
 }
 
+static const char kBatchCommandMagic = '\0';
+static const size_t kBatchCommandLenSize = 4;
+
+static void appendBatchItem(std::string* entry, const char* data, size_t len) {
+    for (int i = kBatchCommandLenSize - 1; i >= 0; --i) {
+        entry->push_back(static_cast<char>((len >> (i * 8)) & 0xFF));
+    }
+    entry->append(data, len);
+}
+
+bool IsBatchCommand(const std::string& data) {
+    return !data.empty() && data[0] == kBatchCommandMagic;
+}
+
+void AppendBatchCommand(std::string* entry, const std::string& cmd) {
+    if (!IsBatchCommand(*entry)) {
+        std::string first;
+        first.swap(*entry);
+        entry->reserve(1 + 2 * kBatchCommandLenSize + first.size() + cmd.size());
+        entry->push_back(kBatchCommandMagic);
+        appendBatchItem(entry, first.data(), first.size());
+    }
+    appendBatchItem(entry, cmd.data(), cmd.size());
+}
+
+bool DecodeBatchCommand(const std::string& data, std::vector<std::string>* cmds) {
+    if (!IsBatchCommand(data)) return false;
+
+    size_t offset = 1;
+    while (offset < data.size()) {
+        if (data.size() - offset < kBatchCommandLenSize) return false;
+        size_t len = 0;
+        for (size_t i = 0; i < kBatchCommandLenSize; ++i) {
+            len = (len << 8) | static_cast<unsigned char>(data[offset + i]);
+        }
+        offset += kBatchCommandLenSize;
+        if (data.size() - offset < len) return false;
+        cmds->emplace_back(data, offset, len);
+        offset += len;
+    }
+    return true;
+}
+
 } /* namespace raft */
 } /* namespace sharkstore */
@@ -0,0 +1,405 @@
+// raft日志存储的性能测试，直接测试DiskStorage和LogFile，不经过raft
+//
+// 用法: raft-storage-bench [-d dir] [-n entries] [-g groups] [-e group_entries]
+//                          [-f log_file_size] [-c case1,case2...]
+// case: append, logfile, read, truncate, recover，默认全部
+//
+// 每个测试项输出一行json，便于脚本收集比较，如：
+// {"case":"append","entry_size":256,"batch":1,"sync":false,"count":100000,
+//  "ops_per_sec":..., "mb_per_sec":..., "latency_us":{"avg":...,"p50":...,...}}
+
+#include <errno.h>
+#include <getopt.h>
+#include <stdlib.h>
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "base/util.h"
+#include "raft/src/impl/logger.h"
+#include "raft/src/impl/storage/log_file.h"
+#include "raft/src/impl/storage/storage_disk.h"
+
+using namespace sharkstore;
+using namespace sharkstore::raft;
+using namespace sharkstore::raft::impl;
+using namespace sharkstore::raft::impl::storage;
+
+namespace {
+
+struct BenchOptions {
+    std::string dir = "/tmp";
+    uint64_t entries = 100000;      // append/read测试的日志条数
+    uint64_t groups = 100;          // recover测试的raft个数
+    uint64_t group_entries = 1000;  // recover测试每个raft的日志条数
+    size_t log_file_size = 1024 * 1024 * 16;
+    std::set<std::string> cases;
+};
+
+BenchOptions bench_ops;
+
+using Clock = std::chrono::steady_clock;
+
+uint64_t elapsedMicros(const Clock::time_point& start) {
+    return std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - start)
+        .count();
+}
+
+// 收集每次操作的耗时（微秒），输出吞吐和分位数
+class Recorder {
+public:
+    void Add(uint64_t micros) { latencies_.push_back(micros); }
+
+    // total_micros: 总耗时；ops: 操作次数（如日志条数）；bytes: 数据量
+    std::string ToJson(uint64_t total_micros, uint64_t ops, uint64_t bytes) {
+        std::sort(latencies_.begin(), latencies_.end());
+        uint64_t sum = 0;
+        for (auto l : latencies_) sum += l;
+
+        double secs = total_micros > 0 ? total_micros / 1000000.0 : 1e-6;
+        std::ostringstream ss;
+        ss << "\"count\":" << ops << ",\"total_ms\":" << total_micros / 1000
+           << ",\"ops_per_sec\":" << static_cast<uint64_t>(ops / secs)
+           << ",\"mb_per_sec\":" << bytes / secs / (1024 * 1024)
+           << ",\"latency_us\":{\"avg\":" << (latencies_.empty() ? 0 : sum / latencies_.size())
+           << ",\"p50\":" << percentile(0.5) << ",\"p90\":" << percentile(0.9)
+           << ",\"p99\":" << percentile(0.99) << ",\"p999\":" << percentile(0.999)
+           << ",\"max\":" << (latencies_.empty() ? 0 : latencies_.back()) << "}";
+        return ss.str();
+    }
+
+private:
+    uint64_t percentile(double p) const {
+        if (latencies_.empty()) return 0;
+        size_t idx = static_cast<size_t>(p * latencies_.size());
+        return latencies_[std::min(idx, latencies_.size() - 1)];
+    }
+
+private:
+    std::vector<uint64_t> latencies_;
+};
+
+void report(const std::string& name, const std::string& params, const std::string& result) {
+    std::cout << "{\"case\":\"" << name << "\"";
+    if (!params.empty()) std::cout << "," << params;
+    std::cout << "," << result << "}" << std::endl;
+}
+
+void checkStatus(const Status& s, const std::string& what) {
+    if (!s.ok()) {
+        std::cerr << what << " failed: " << s.ToString() << std::endl;
+        exit(EXIT_FAILURE);
+    }
+}
+
+std::string makeTempDir(const std::string& name) {
+    std::string path = JoinFilePath({bench_ops.dir, "raft_storage_bench_" + name + "_XXXXXX"});
+    std::vector<char> buf(path.begin(), path.end());
+    buf.push_back('\0');
+    if (mkdtemp(buf.data()) == NULL) {
+        std::cerr << "create temp dir " << path << " failed: " << strErrno(errno) << std::endl;
+        exit(EXIT_FAILURE);
+    }
+    return std::string(buf.data());
+}
+
+// 预先生成数据，避免计入测试时间
+std::vector<EntryPtr> makeEntries(uint64_t lo, uint64_t count, size_t entry_size) {
+    std::vector<EntryPtr> entries;
+    entries.reserve(count);
+    auto data = randomString(entry_size);
+    for (uint64_t i = 0; i < count; ++i) {
+        EntryPtr e(new pb::Entry);
+        e->set_index(lo + i);
+        e->set_term(1);
+        e->set_type(pb::ENTRY_NORMAL);
+        e->set_data(data);
+        entries.push_back(e);
+    }
+    return entries;
+}
+
+std::unique_ptr<DiskStorage> openStorage(const std::string& path, bool sync,
+                                         uint64_t id = 1) {
+    DiskStorage::Options ops;
+    ops.log_file_size = bench_ops.log_file_size;
+    ops.always_sync = sync;
+    std::unique_ptr<DiskStorage> ds(new DiskStorage(id, path, ops));
+    checkStatus(ds->Open(), "open storage");
+    return ds;
+}
+
+void destroyStorage(std::unique_ptr<DiskStorage>& ds, const std::string& path) {
+    checkStatus(ds->Destroy(false), "destroy storage");
+    ds.reset();
+    RemoveDirAll(path.c_str());
+}
+
+// 按条目大小、每次写入条数、是否sync测试DiskStorage::StoreEntries
+void benchAppend() {
+    for (size_t entry_size : {64, 256, 1024, 4096, 16384}) {
+        for (size_t batch : {1, 16}) {
+            for (bool sync : {false, true}) {
+                // sync时磁盘较慢，减少写入量
+                uint64_t count = sync ? std::min<uint64_t>(bench_ops.entries, 5000)
+                                      : bench_ops.entries;
+                auto entries = makeEntries(1, count, entry_size);
+
+                auto path = makeTempDir("append");
+                auto ds = openStorage(path, sync);
+
+                Recorder rec;
+                auto begin = Clock::now();
+                for (uint64_t i = 0; i < count; i += batch) {
+                    auto end = std::min<uint64_t>(i + batch, count);
+                    std::vector<EntryPtr> ents(entries.begin() + i, entries.begin() + end);
+                    auto start = Clock::now();
+                    checkStatus(ds->StoreEntries(ents), "store entries");
+                    rec.Add(elapsedMicros(start));
+                }
+                auto total = elapsedMicros(begin);
+
+                std::ostringstream params;
+                params << "\"entry_size\":" << entry_size << ",\"batch\":" << batch
+                       << ",\"sync\":" << (sync ? "true" : "false");
+                report("append", params.str(), rec.ToJson(total, count, count * entry_size));
+
+                destroyStorage(ds, path);
+            }
+        }
+    }
+}
+
+// 直接测试LogFile的Append+Flush以及随机Get
+void benchLogFile() {
+    for (size_t entry_size : {256, 4096}) {
+        // 一个文件内的条数
+        uint64_t count = std::min<uint64_t>(bench_ops.entries,
+                                            bench_ops.log_file_size / (entry_size + 64));
+        auto entries = makeEntries(1, count, entry_size);
+
+        auto path = makeTempDir("logfile");
+        std::unique_ptr<LogFile> lf(new LogFile(path, 1, 1));
+        checkStatus(lf->Open(false, true), "open log file");
+
+        Recorder append_rec;
+        auto begin = Clock::now();
+        for (const auto& e : entries) {
+            auto start = Clock::now();
+            checkStatus(lf->Append(e), "log file append");
+            checkStatus(lf->Flush(), "log file flush");
+            append_rec.Add(elapsedMicros(start));
+        }
+        auto total = elapsedMicros(begin);
+        std::ostringstream params;
+        params << "\"op\":\"append\",\"entry_size\":" << entry_size;
+        report("logfile", params.str(), append_rec.ToJson(total, count, count * entry_size));
+
+        Recorder get_rec;
+        begin = Clock::now();
+        for (uint64_t i = 0; i < count; ++i) {
+            uint64_t index = 1 + static_cast<uint64_t>(randomInt()) % count;
+            EntryPtr e;
+            auto start = Clock::now();
+            checkStatus(lf->Get(index, &e), "log file get");
+            get_rec.Add(elapsedMicros(start));
+        }
+        total = elapsedMicros(begin);
+        params.str("");
+        params << "\"op\":\"random_get\",\"entry_size\":" << entry_size;
+        report("logfile", params.str(), get_rec.ToJson(total, count, count * entry_size));
+
+        checkStatus(lf->Destroy(), "destroy log file");
+        lf.reset();
+        RemoveDirAll(path.c_str());
+    }
+}
+
+// Entries读取模式：顺序批量读（follower追日志），随机单条读，读最新的日志（正常复制）
+void benchRead() {
+    const size_t entry_size = 256;
+    const uint64_t count = bench_ops.entries;
+    auto path = makeTempDir("read");
+    auto ds = openStorage(path, false);
+    checkStatus(ds->StoreEntries(makeEntries(1, count, entry_size)), "store entries");
+
+    struct Pattern {
+        std::string name;
+        uint64_t batch;
+    };
+    for (const auto& p : {Pattern{"sequential", 64}, Pattern{"random", 1},
+                          Pattern{"tail", 16}}) {
+        Recorder rec;
+        uint64_t ops = 0, read_entries = 0;
+        auto begin = Clock::now();
+        for (uint64_t lo = 1; lo <= count; lo += p.batch, ++ops) {
+            uint64_t start_index = lo;
+            if (p.name == "random") {
+                start_index = 1 + static_cast<uint64_t>(randomInt()) % count;
+            } else if (p.name == "tail") {
+                start_index = count - p.batch + 1;
+            }
+            uint64_t hi = std::min(start_index + p.batch, count + 1);
+            std::vector<EntryPtr> ents;
+            bool compacted = false;
+            auto start = Clock::now();
+            checkStatus(ds->Entries(start_index, hi, std::numeric_limits<uint64_t>::max(),
+                                    &ents, &compacted),
+                        "read entries");
+            rec.Add(elapsedMicros(start));
+            read_entries += ents.size();
+        }
+        auto total = elapsedMicros(begin);
+        std::ostringstream params;
+        params << "\"pattern\":\"" << p.name << "\",\"batch\":" << p.batch
+               << ",\"entry_size\":" << entry_size << ",\"entries\":" << read_entries;
+        report("read", params.str(), rec.ToJson(total, ops, read_entries * entry_size));
+    }
+
+    destroyStorage(ds, path);
+}
+
+// 截断：每次截断大约一个日志文件的日志
+void benchTruncate() {
+    const size_t entry_size = 1024;
+    const uint64_t count = bench_ops.entries;
+    auto path = makeTempDir("truncate");
+    auto ds = openStorage(path, false);
+    checkStatus(ds->StoreEntries(makeEntries(1, count, entry_size)), "store entries");
+    ds->AppliedTo(count);
+
+    uint64_t files = ds->FilesCount();
+    uint64_t step = std::max<uint64_t>(1, count / std::max<uint64_t>(files, 1));
+
+    Recorder rec;
+    uint64_t ops = 0;
+    auto begin = Clock::now();
+    for (uint64_t index = step; index < count; index += step, ++ops) {
+        auto start = Clock::now();
+        checkStatus(ds->Truncate(index), "truncate");
+        rec.Add(elapsedMicros(start));
+    }
+    auto total = elapsedMicros(begin);
+
+    std::ostringstream params;
+    params << "\"files\":" << files << ",\"step\":" << step;
+    report("truncate", params.str(), rec.ToJson(total, ops, 0));
+
+    destroyStorage(ds, path);
+}
+
+// 重启恢复：N个raft各写入M条日志，关闭后测量重新打开的时间
+void benchRecover() {
+    const size_t entry_size = 256;
+    const uint64_t groups = bench_ops.groups;
+    const uint64_t count = bench_ops.group_entries;
+
+    auto path = makeTempDir("recover");
+    auto entries = makeEntries(1, count, entry_size);
+    std::vector<std::string> paths;
+    for (uint64_t id = 1; id <= groups; ++id) {
+        auto group_path = JoinFilePath({path, std::to_string(id)});
+        auto ds = openStorage(group_path, false, id);
+        checkStatus(ds->StoreEntries(entries), "store entries");
+        checkStatus(ds->Close(), "close storage");
+        paths.push_back(group_path);
+    }
+
+    Recorder rec;
+    std::vector<std::unique_ptr<DiskStorage>> opened;
+    auto begin = Clock::now();
+    for (uint64_t i = 0; i < groups; ++i) {
+        auto start = Clock::now();
+        opened.push_back(openStorage(paths[i], false, i + 1));
+        rec.Add(elapsedMicros(start));
+    }
+    auto total = elapsedMicros(begin);
+
+    std::ostringstream params;
+    params << "\"groups\":" << groups << ",\"group_entries\":" << count
+           << ",\"entry_size\":" << entry_size;
+    report("recover", params.str(), rec.ToJson(total, groups, groups * count * entry_size));
+
+    for (auto& ds : opened) {
+        checkStatus(ds->Destroy(false), "destroy storage");
+    }
+    RemoveDirAll(path.c_str());
+}
+
+void usage(const char* prog) {
+    std::cerr << "Usage: " << prog
+              << " [-d dir] [-n entries] [-g groups] [-e group_entries]"
+                 " [-f log_file_size] [-c append,logfile,read,truncate,recover]"
+              << std::endl;
+}
+
+void parseOptions(int argc, char* argv[]) {
+    int opt = 0;
+    while ((opt = getopt(argc, argv, "d:n:g:e:f:c:h")) != -1) {
+        switch (opt) {
+            case 'd':
+                bench_ops.dir = optarg;
+                break;
+            case 'n':
+                bench_ops.entries = strtoull(optarg, NULL, 10);
+                break;
+            case 'g':
+                bench_ops.groups = strtoull(optarg, NULL, 10);
+                break;
+            case 'e':
+                bench_ops.group_entries = strtoull(optarg, NULL, 10);
+                break;
+            case 'f': {
+                int64_t value = 0;
+                if (ParseBytesValue(optarg, &value) != 0 || value <= 0) {
+                    usage(argv[0]);
+                    exit(EXIT_FAILURE);
+                }
+                bench_ops.log_file_size = static_cast<size_t>(value);
+                break;
+            }
+            case 'c': {
+                std::istringstream ss(optarg);
+                std::string name;
+                while (std::getline(ss, name, ',')) {
+                    if (!name.empty()) bench_ops.cases.insert(name);
+                }
+                break;
+            }
+            default:
+                usage(argv[0]);
+                exit(opt == 'h' ? EXIT_SUCCESS : EXIT_FAILURE);
+        }
+    }
+    if (bench_ops.entries == 0 || bench_ops.groups == 0 || bench_ops.group_entries == 0) {
+        usage(argv[0]);
+        exit(EXIT_FAILURE);
+    }
+}
+
+bool enabled(const std::string& name) {
+    return bench_ops.cases.empty() || bench_ops.cases.count(name) > 0;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    // 不打印debug日志
+    SetLogger(new impl::StdLogger(impl::StdLogger::Level::kWarn));
+
+    parseOptions(argc, argv);
+
+    if (enabled("append")) benchAppend();
+    if (enabled("logfile")) benchLogFile();
+    if (enabled("read")) benchRead();
+    if (enabled("truncate")) benchTruncate();
+    if (enabled("recover")) benchRecover();
+
+    return 0;
+}
@@ -57,4 +57,28 @@ TEST(RaftTypes, ConfChangeCoding) {
         ASSERT_EQ(cc2.context, cc.context);
     }
 }
+
+TEST(RaftTypes, BatchCommand) {
+    std::vector<std::string> origin;
+    std::string entry = "a";
+    origin.push_back(entry);
+    ASSERT_FALSE(IsBatchCommand(entry));
+    for (int i = 0; i < 10; ++i) {
+        auto cmd = "b" + randomString(i * 100);
+        AppendBatchCommand(&entry, cmd);
+        origin.push_back(cmd);
+        ASSERT_TRUE(IsBatchCommand(entry));
+    }
+
+    std::vector<std::string> cmds;
+    ASSERT_TRUE(DecodeBatchCommand(entry, &cmds));
+    ASSERT_EQ(cmds, origin);
+
+    // 截断的数据
+    entry.pop_back();
+    cmds.clear();
+    ASSERT_FALSE(DecodeBatchCommand(entry, &cmds));
+    ASSERT_FALSE(DecodeBatchCommand("abc", &cmds));
+}
+
 }
@@ -1,4 +1,5 @@
 #include <gtest/gtest.h>
+#include <thread>
 
 #include "base/util.h"
 #include "raft/src/impl/replica.h"
@@ -122,4 +123,44 @@ TEST(Replica, Inflight) {
     ASSERT_TRUE(inflight.full());
 }
 
+TEST(Replica, InflightBytes) {
+    Replica replica(testutil::RandomPeer(), 100, 1000, 100);
+    auto& inflight = replica.inflight();
+    ASSERT_EQ(inflight.window(), 1000U);
+
+    // 单条消息超过窗口也可以发送
+    inflight.add(1, 2000);
+    ASSERT_TRUE(inflight.full());
+    inflight.freeTo(1);
+    ASSERT_EQ(inflight.bytes(), 0U);
+    ASSERT_FALSE(inflight.full());
+
+    inflight.add(2, 400);
+    inflight.add(3, 400);
+    ASSERT_FALSE(inflight.full());
+    inflight.add(4, 300);
+    ASSERT_TRUE(inflight.full());
+    inflight.freeTo(2);
+    ASSERT_EQ(inflight.bytes(), 700U);
+    ASSERT_FALSE(inflight.full());
+    inflight.freeTo(4);
+    ASSERT_EQ(inflight.bytes(), 0U);
+    ASSERT_EQ(inflight.window(), 1000U);
+
+    // 确认延迟变大，窗口减半
+    inflight.add(5, 100);
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    inflight.freeTo(5);
+    ASSERT_EQ(inflight.window(), 500U);
+
+    // 恢复后加性增长
+    inflight.add(6, 100);
+    inflight.freeTo(6);
+    ASSERT_EQ(inflight.window(), 600U);
+
+    inflight.add(7, 100);
+    inflight.reset();
+    ASSERT_EQ(inflight.bytes(), 0U);
+}
+
 }  // namespace
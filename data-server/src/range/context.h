@@ -33,6 +33,10 @@ public:
     virtual SplitPolicy* GetSplitPolicy() = 0;
 
     virtual rocksdb::DB *DBInstance() = 0;
+    // 表独立的column family, 返回空表示使用default column family
+    virtual std::shared_ptr<rocksdb::ColumnFamilyHandle> TableColumnFamily(uint64_t table_id) {
+        return nullptr;
+    }
     virtual master::Worker* MasterClient() = 0;
     virtual raft::RaftServer* RaftServer() = 0;
     virtual storage::MetaStore* MetaStore() = 0;
@@ -52,6 +56,9 @@ public:
     virtual Status SplitRange(uint64_t range_id, const raft_cmdpb::SplitRequest &req, uint64_t raft_index) {
         return Status(Status::kNotSupported);
     }
+
+    // merge: 被合并的range已冻结或已被吸收，由server异步检查并销毁
+    virtual void RetireMergedRange(uint64_t source_id) {}
 };
 
 }  // namespace range
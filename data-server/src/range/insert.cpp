@@ -44,7 +44,7 @@ void Range::Insert(common::ProtoMessage *msg, kvrpcpb::DsInsertRequest &req) {
         RANGE_LOG_ERROR("Insert raft submit error: %s", ret.ToString().c_str());
 
         auto resp = new kvrpcpb::DsInsertResponse;
-        SendError(msg, req.header(), resp, RaftFailError());
+        SendError(msg, req.header(), resp, SubmitFailError(ret));
     }
 }
 
@@ -66,7 +66,7 @@ Status Range::ApplyInsert(const raft_cmdpb::Command &cmd) {
             break;
         }
 
-        ret = store_->Insert(req, &affected_keys);
+        ret = store_->Insert(req, &affected_keys, cmd.expire_at());
         auto etime = get_micro_second();
         context_->Statistics()->PushTime(HistogramType::kStore, etime - btime);
 
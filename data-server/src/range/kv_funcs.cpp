@@ -50,7 +50,7 @@ void Range::KVSet(common::ProtoMessage *msg, kvrpcpb::DsKvSetRequest &req) {
         if (!ret.ok()) {
             RANGE_LOG_ERROR("KVSet raft submit error: %s", ret.ToString().c_str());
 
-            err = RaftFailError();
+            err = SubmitFailError(ret);
         }
     } while (false);
 
@@ -84,7 +84,7 @@ Status Range::ApplyKVSet(const raft_cmdpb::Command &cmd) {
                 affected_keys = 1;
             }
         }
-        ret = store_->Put(req.kv().key(), req.kv().value());
+        ret = store_->Put(req.kv().key(), req.kv().value(), cmd.expire_at());
         context_->Statistics()->PushTime(HistogramType::kStore, get_micro_second() - btime);
 
         if (cmd.cmd_id().node_id() == node_id_) {
@@ -107,6 +107,7 @@ Status Range::ApplyKVSet(const raft_cmdpb::Command &cmd) {
 void Range::KVGet(common::ProtoMessage *msg, kvrpcpb::DsKvGetRequest &req) {
     context_->Statistics()->PushTime(HistogramType::kQWait,
                                    get_micro_second() - msg->begin_time);
+    storage::PerfScope perf(msg->header.func_id, store_->GetPerfCounter());
 
     errorpb::Error *err = nullptr;
     auto ds_resp = new kvrpcpb::DsKvGetResponse;
@@ -169,14 +170,14 @@ void Range::KVBatchSet(common::ProtoMessage *msg,
         if (!ret.ok()) {
             RANGE_LOG_ERROR("KVBatchSet raft submit error: %s", ret.ToString().c_str());
 
-            err = RaftFailError();
+            err = SubmitFailError(ret);
         }
     } while (false);
 
     if (err != nullptr) {
         RANGE_LOG_WARN("KVBatchSet error: %s", err->message().c_str());
         auto resp = new kvrpcpb::DsKvBatchSetResponse;
-        SendError(msg, req.header(), resp, RaftFailError());
+        SendError(msg, req.header(), resp, err);
     }
 }
 
@@ -198,12 +199,22 @@ Status Range::ApplyKVBatchSet(const raft_cmdpb::Command &cmd) {
             break;
         }
 
+        std::vector<Status> exists;
+        if (existCase != kvrpcpb::EC_Force) {
+            std::vector<std::string> keys, values;
+            keys.reserve(req.kvs_size());
+            for (int i = 0, count = req.kvs_size(); i < count; ++i) {
+                keys.push_back(req.kvs(i).key());
+            }
+            exists = store_->MultiGet(keys, &values);
+        }
+
         std::vector<std::pair<std::string, std::string>> keyValues;
         for (int i = 0, count = req.kvs_size(); i < count; ++i) {
-            auto kv = req.kvs(i);
+            auto &kv = req.kvs(i);
             do {
-                if (req.case_() != kvrpcpb::EC_Force) {
-                    bool bExists = store_->KeyExists(kv.key());
+                if (existCase != kvrpcpb::EC_Force) {
+                    bool bExists = exists[i].ok();
                     if ((existCase == kvrpcpb::EC_Exists && !bExists) ||
                         (existCase == kvrpcpb::EC_NotExists && bExists)) {
                         break;
@@ -219,7 +230,7 @@ Status Range::ApplyKVBatchSet(const raft_cmdpb::Command &cmd) {
             } while (false);
         }
 
-        ret = store_->BatchSet(keyValues);
+        ret = store_->BatchSet(keyValues, cmd.expire_at());
         context_->Statistics()->PushTime(HistogramType::kStore,
                                        get_micro_second() - btime);
 
@@ -250,6 +261,7 @@ void Range::KVBatchGet(common::ProtoMessage *msg,
                        kvrpcpb::DsKvBatchGetRequest &req) {
     context_->Statistics()->PushTime(HistogramType::kQWait,
                                    get_micro_second() - msg->begin_time);
+    storage::PerfScope perf(msg->header.func_id, store_->GetPerfCounter());
 
     errorpb::Error *err = nullptr;
     auto ds_resp = new kvrpcpb::DsKvBatchGetResponse;
@@ -260,21 +272,30 @@ void Range::KVBatchGet(common::ProtoMessage *msg,
     uint64_t total_size = 0;
     auto keys_size = req.req().keys_size();
 
+    std::vector<std::string> keys;
+    keys.reserve(keys_size);
     for (int i = 0; i < keys_size; ++i) {
         auto &key = req.req().keys(i);
         if (key.empty() || !KeyInRange(key)) {
             RANGE_LOG_WARN("KVBatchGet error: %s not in range", key.c_str());
         } else {
-            auto kv = ds_resp->mutable_resp()->add_kvs();
-            auto btime = get_micro_second();
-            auto ret = store_->Get(key, kv->mutable_value());
-            kv->set_key(std::move(key));
-            count++;
-            total_size += kv->key().size() + kv->value().size();
-            total_time += get_micro_second() - btime;
+            keys.push_back(key);
         }
     }
 
+    std::vector<std::string> values;
+    auto btime = get_micro_second();
+    store_->MultiGet(keys, &values);
+    total_time += get_micro_second() - btime;
+
+    for (size_t i = 0; i < keys.size(); ++i) {
+        auto kv = ds_resp->mutable_resp()->add_kvs();
+        kv->set_key(std::move(keys[i]));
+        kv->set_value(std::move(values[i]));
+        count++;
+        total_size += kv->key().size() + kv->value().size();
+    }
+
     context_->Statistics()->PushTime(HistogramType::kStore, total_time);
 
     common::SetResponseHeader(req.header(), header, err);
@@ -308,7 +329,7 @@ void Range::KVDelete(common::ProtoMessage *msg,
         });
         if (!ret.ok()) {
             RANGE_LOG_ERROR("KVDelete raft submit error: %s", ret.ToString().c_str());
-            err = RaftFailError();
+            err = SubmitFailError(ret);
         }
     } while (false);
 
@@ -399,7 +420,7 @@ void Range::KVBatchDelete(common::ProtoMessage *msg,
         RANGE_LOG_ERROR("Insert raft submit error: %s", ret.ToString().c_str());
 
         auto resp = new kvrpcpb::DsKvBatchDeleteResponse;
-        SendError(msg, req.header(), resp, RaftFailError());
+        SendError(msg, req.header(), resp, SubmitFailError(ret));
     }
 }
 
@@ -412,7 +433,8 @@ Status Range::ApplyKVBatchDelete(const raft_cmdpb::Command &cmd) {
 
     do {
         auto &req = cmd.kv_batch_del_req();
-        std::vector<std::string> delKeys(req.keys_size());
+        std::vector<std::string> delKeys;
+        delKeys.reserve(req.keys_size());
 
         auto &epoch = cmd.verify_epoch();
         if (!EpochIsEqual(epoch, err)) {
@@ -420,17 +442,19 @@ Status Range::ApplyKVBatchDelete(const raft_cmdpb::Command &cmd) {
             break;
         }
 
-        for (int i = 0, count = req.keys_size(); i < count; ++i) {
-            auto &key = req.keys(i);
-            if (req.case_() == kvrpcpb::EC_Exists ||
-                req.case_() == kvrpcpb::EC_AnyCase) {
-                if (store_->KeyExists(key)) {
+        if (req.case_() == kvrpcpb::EC_Exists ||
+            req.case_() == kvrpcpb::EC_AnyCase) {
+            std::vector<std::string> keys(req.keys().begin(), req.keys().end());
+            std::vector<std::string> values;
+            auto exists = store_->MultiGet(keys, &values);
+            for (size_t i = 0; i < keys.size(); ++i) {
+                if (exists[i].ok()) {
                     ++affected_keys;
-                    delKeys.push_back(std::move(key));
+                    delKeys.push_back(std::move(keys[i]));
                 }
-            } else {
-                delKeys.push_back(std::move(key));
             }
+        } else {
+            delKeys.assign(req.keys().begin(), req.keys().end());
         }
 
         ret = store_->BatchDelete(delKeys);
@@ -493,7 +517,7 @@ void Range::KVRangeDelete(common::ProtoMessage *msg,
         RANGE_LOG_ERROR("KVRangeDelet raft submit error: %s", ret.ToString().c_str());
 
         auto resp = new kvrpcpb::DsKvRangeDeleteResponse;
-        SendError(msg, req.header(), resp, RaftFailError());
+        SendError(msg, req.header(), resp, SubmitFailError(ret));
     }
 }
 
@@ -555,19 +579,202 @@ Status Range::ApplyKVRangeDelete(const raft_cmdpb::Command &cmd) {
     return ret;
 }
 
+void Range::KVIncr(common::ProtoMessage *msg, kvrpcpb::DsKvIncrRequest &req) {
+    context_->Statistics()->PushTime(HistogramType::kQWait,
+                                   get_micro_second() - msg->begin_time);
+
+    if (!CheckWriteable()) {
+        auto resp = new kvrpcpb::DsKvIncrResponse;
+        resp->mutable_resp()->set_code(Status::kNoLeftSpace);
+        return SendError(msg, req.header(), resp, nullptr);
+    }
+
+    auto &key = req.req().key();
+    errorpb::Error *err = nullptr;
+
+    do {
+        if (!VerifyLeader(err)) {
+            break;
+        }
+
+        if (key.empty() || !KeyInRange(key, err)) {
+            break;
+        }
+
+        auto epoch = req.header().range_epoch();
+        if (!EpochIsEqual(epoch, err)) {
+            break;
+        }
+
+        auto ret = SubmitCmd(msg, req.header(), [&req](raft_cmdpb::Command &cmd) {
+            cmd.set_cmd_type(raft_cmdpb::CmdType::KvIncr);
+            cmd.set_allocated_kv_incr_req(req.release_req());
+        });
+
+        if (!ret.ok()) {
+            RANGE_LOG_ERROR("KVIncr raft submit error: %s", ret.ToString().c_str());
+
+            err = SubmitFailError(ret);
+        }
+    } while (false);
+
+    if (err != nullptr) {
+        RANGE_LOG_WARN("KVIncr error: %s", err->message().c_str());
+        auto resp = new kvrpcpb::DsKvIncrResponse;
+        SendError(msg, req.header(), resp, err);
+    }
+}
+
+Status Range::ApplyKVIncr(const raft_cmdpb::Command &cmd, uint64_t index) {
+    Status ret;
+    errorpb::Error *err = nullptr;
+
+    auto &req = cmd.kv_incr_req();
+    auto btime = get_micro_second();
+    do {
+        auto &epoch = cmd.verify_epoch();
+        if (!EpochIsEqual(epoch, err)) {
+            RANGE_LOG_WARN("ApplyKVIncr error: %s", err->message().c_str());
+            break;
+        }
+
+        ret = store_->Increment(req.key(), req.delta(), index);
+        context_->Statistics()->PushTime(HistogramType::kStore, get_micro_second() - btime);
+
+        if (!ret.ok()) {
+            RANGE_LOG_ERROR("ApplyKVIncr failed, code:%d, msg:%s", ret.code(),
+                            ret.ToString().c_str());
+            break;
+        }
+
+        if (cmd.cmd_id().node_id() == node_id_) {
+            CheckSplit(req.key().size() + sizeof(int64_t));
+        }
+    } while (false);
+
+    if (cmd.cmd_id().node_id() == node_id_) {
+        auto resp = new kvrpcpb::DsKvIncrResponse;
+        resp->mutable_resp()->set_code(static_cast<int>(ret.code()));
+        ReplySubmit(cmd, resp, err, btime);
+    } else if (err != nullptr) {
+        delete err;
+    }
+    return ret;
+}
+
+void Range::KVAppend(common::ProtoMessage *msg, kvrpcpb::DsKvAppendRequest &req) {
+    context_->Statistics()->PushTime(HistogramType::kQWait,
+                                   get_micro_second() - msg->begin_time);
+
+    if (!CheckWriteable()) {
+        auto resp = new kvrpcpb::DsKvAppendResponse;
+        resp->mutable_resp()->set_code(Status::kNoLeftSpace);
+        return SendError(msg, req.header(), resp, nullptr);
+    }
+
+    auto &key = req.req().key();
+    errorpb::Error *err = nullptr;
+
+    do {
+        if (!VerifyLeader(err)) {
+            break;
+        }
+
+        if (key.empty() || !KeyInRange(key, err)) {
+            break;
+        }
+
+        auto epoch = req.header().range_epoch();
+        if (!EpochIsEqual(epoch, err)) {
+            break;
+        }
+
+        auto ret = SubmitCmd(msg, req.header(), [&req](raft_cmdpb::Command &cmd) {
+            cmd.set_cmd_type(raft_cmdpb::CmdType::KvAppend);
+            cmd.set_allocated_kv_append_req(req.release_req());
+        });
+
+        if (!ret.ok()) {
+            RANGE_LOG_ERROR("KVAppend raft submit error: %s", ret.ToString().c_str());
+
+            err = SubmitFailError(ret);
+        }
+    } while (false);
+
+    if (err != nullptr) {
+        RANGE_LOG_WARN("KVAppend error: %s", err->message().c_str());
+        auto resp = new kvrpcpb::DsKvAppendResponse;
+        SendError(msg, req.header(), resp, err);
+    }
+}
+
+Status Range::ApplyKVAppend(const raft_cmdpb::Command &cmd, uint64_t index) {
+    Status ret;
+    errorpb::Error *err = nullptr;
+
+    auto &req = cmd.kv_append_req();
+    auto btime = get_micro_second();
+    do {
+        auto &epoch = cmd.verify_epoch();
+        if (!EpochIsEqual(epoch, err)) {
+            RANGE_LOG_WARN("ApplyKVAppend error: %s", err->message().c_str());
+            break;
+        }
+
+        ret = store_->Append(req.key(), req.value(), index);
+        context_->Statistics()->PushTime(HistogramType::kStore, get_micro_second() - btime);
+
+        if (!ret.ok()) {
+            RANGE_LOG_ERROR("ApplyKVAppend failed, code:%d, msg:%s", ret.code(),
+                            ret.ToString().c_str());
+            break;
+        }
+
+        if (cmd.cmd_id().node_id() == node_id_) {
+            CheckSplit(req.key().size() + req.value().size());
+        }
+    } while (false);
+
+    if (cmd.cmd_id().node_id() == node_id_) {
+        auto resp = new kvrpcpb::DsKvAppendResponse;
+        resp->mutable_resp()->set_code(static_cast<int>(ret.code()));
+        ReplySubmit(cmd, resp, err, btime);
+    } else if (err != nullptr) {
+        delete err;
+    }
+    return ret;
+}
+
 void Range::KVScan(common::ProtoMessage *msg, kvrpcpb::DsKvScanRequest &req) {
     context_->Statistics()->PushTime(HistogramType::kQWait,
                                    get_micro_second() - msg->begin_time);
+    storage::PerfScope perf(msg->header.func_id, store_->GetPerfCounter());
 
     errorpb::Error *err = nullptr;
     auto ds_resp = new kvrpcpb::DsKvScanResponse;
+    auto resp = ds_resp->mutable_resp();
     auto start = std::max(req.req().start(), start_key_);
     auto limit = std::min(req.req().limit(), meta_.GetEndKey());
-    std::unique_ptr<storage::Iterator> iterator(
-        store_->NewIterator(start, limit));
 
+    // 分页扫描可以读同一个快照
+    storage::SnapshotPtr snapshot;
+    uint64_t snapshot_id = 0;
+    auto s = store_->AcquireSnapshot(req.req().open_snapshot(), req.req().snapshot_id(),
+                                     &snapshot, &snapshot_id);
+    if (!s.ok()) {
+        RANGE_LOG_WARN("KVScan error: %s", s.ToString().c_str());
+        resp->set_code(static_cast<int>(s.code()));
+        common::SetResponseHeader(req.header(), ds_resp->mutable_header(), err);
+        context_->SocketSession()->Send(msg, ds_resp);
+        return;
+    }
+    resp->set_snapshot_id(snapshot_id);
+
+    // 接着上一页的位置续扫, 省去重新seek
     int max_count = checkMaxCount(req.req().max_count());
-    auto resp = ds_resp->mutable_resp();
+    storage::Store::ScanCursor cursor;
+    auto iterator = store_->OpenScanCursor(start, limit, static_cast<uint64_t>(max_count),
+                                           snapshot_id, std::move(snapshot), &cursor);
 
     uint64_t count = 0;
     uint64_t total_size = 0;
@@ -584,6 +791,7 @@ void Range::KVScan(common::ProtoMessage *msg, kvrpcpb::DsKvScanRequest &req) {
 
     if (resp->kvs_size() > 0) {
         resp->set_last_key(resp->kvs(resp->kvs_size() - 1).key());
+        store_->PutScanCursor(cursor, resp->last_key(), std::move(limit), std::move(iterator));
     }
 
     common::SetResponseHeader(req.header(), ds_resp->mutable_header(), err);
@@ -17,24 +17,49 @@ enum {
     LOCK_EPOCH_ERROR
 };
 
-const int DEFAULT_LOCK_DELETE_TIME_MILLSEC = 3000;
+// 每轮最多清理的过期锁个数
+static const size_t kMaxLockReapPerRound = 1000;
+// 清理命令提交后未生效时的重试间隔（毫秒）
+static const int64_t kLockReapRetryMillsec = 3000;
 
 using namespace sharkstore::monitor;
 
-kvrpcpb::LockValue *Range::LockGet(const std::string &key) {
-    FLOG_DEBUG("lock get: key[%s]", EncodeToHex(key).c_str());
+bool Range::LockRead(const std::string &key, kvrpcpb::LockValue *value) {
+    // leader上首次使用时加载索引，在apply线程中加载保证与后续写入有序
+    if (is_leader_ && !lock_index_.Loaded()) {
+        auto btime = get_micro_second();
+        auto s = lock_index_.Load(store_.get());
+        if (!s.ok()) {
+            RANGE_LOG_WARN("load lock index failed: %s", s.ToString().c_str());
+        } else {
+            RANGE_LOG_INFO("load lock index: %lu locks, take %ld us",
+                           lock_index_.Size(), get_micro_second() - btime);
+        }
+    }
+    if (lock_index_.Loaded()) {
+        return lock_index_.Get(key, value);
+    }
+
     std::string val;
     auto ret = store_->Get(key, &val);
     if (!ret.ok()) {
         FLOG_WARN("lock get: no key[%s]", EncodeToHex(key).c_str());
-        return nullptr;
+        return false;
     }
 
     FLOG_DEBUG("lock get ok: key[%s] val[%s]", EncodeToHex(key).c_str(),
                EncodeToHex(val).c_str());
-    auto req = new (kvrpcpb::LockValue);
-    if (!req->ParseFromString(val)) {
+    if (!LockIndex::ParseLock(val, value)) {
         FLOG_WARN("key[%s] value parse failed", EncodeToHex(key).c_str());
+        return false;
+    }
+    return true;
+}
+
+kvrpcpb::LockValue *Range::LockGet(const std::string &key) {
+    FLOG_DEBUG("lock get: key[%s]", EncodeToHex(key).c_str());
+    std::unique_ptr<kvrpcpb::LockValue> req(new kvrpcpb::LockValue);
+    if (!LockRead(key, req.get())) {
         return nullptr;
     }
 
@@ -52,7 +77,38 @@ kvrpcpb::LockValue *Range::LockGet(const std::string &key) {
 
     FLOG_DEBUG("lock get parse: key[%s] val[%s]",
                EncodeToHex(key).c_str(), req->DebugString().c_str());
-    return req;
+    return req.release();
+}
+
+void Range::ReapExpiredLocks() {
+    if (!is_leader_ || !valid_ || !lock_index_.Loaded()) {
+        return;
+    }
+
+    std::vector<std::pair<std::string, std::string>> locks;
+    lock_index_.CollectExpired(getticks(), kMaxLockReapPerRound, kLockReapRetryMillsec, &locks);
+    if (locks.empty()) {
+        return;
+    }
+
+    // 是否过期只在leader上判断，清理的key及锁id随命令复制，
+    // 各副本apply时不再依赖本地时钟，删除的锁相同
+    raft_cmdpb::Command cmd;
+    cmd.set_cmd_type(raft_cmdpb::CmdType::LockReap);
+    meta_.GetEpoch(cmd.mutable_verify_epoch());
+    auto req = cmd.mutable_lock_reap_req();
+    for (auto &lock : locks) {
+        auto item = req->add_locks();
+        item->set_key(std::move(lock.first));
+        item->set_id(std::move(lock.second));
+    }
+    auto s = Submit(cmd);
+    if (!s.ok()) {
+        RANGE_LOG_WARN("submit reap %lu expired locks failed: %s", locks.size(),
+                       s.ToString().c_str());
+        return;
+    }
+    RANGE_LOG_INFO("reap expired locks: %lu submitted", locks.size());
 }
 
 void Range::Lock(common::ProtoMessage *msg, kvrpcpb::DsLockRequest &req) {
@@ -88,7 +144,7 @@ void Range::Lock(common::ProtoMessage *msg, kvrpcpb::DsLockRequest &req) {
         if (!ret.ok()) {
             FLOG_ERROR("range[%" PRIu64 "] Lock raft submit error: %s", id_, ret.ToString().c_str());
 
-            err = RaftFailError();
+            err = SubmitFailError(ret);
         }
     } while (false);
 
@@ -114,7 +170,7 @@ Status Range::ApplyLock(const raft_cmdpb::Command &cmd) {
             resp->mutable_resp()->set_error(err->message());
             break;
         }
-        auto val = LockGet(req.key());
+        std::unique_ptr<kvrpcpb::LockValue> val(LockGet(req.key()));
         // 允许相同id的重复执行lock
         if (val != nullptr) {
             if (val->delete_flag()) {
@@ -145,7 +201,7 @@ Status Range::ApplyLock(const raft_cmdpb::Command &cmd) {
             req.mutable_value()->set_delete_time(req.value().delete_time() +
                                                  getticks());
         }
-        ret = store_->Put(req.key(), req.value().SerializeAsString());
+        ret = store_->Put(req.key(), req.value().SerializeAsString(), cmd.expire_at());
         context_->Statistics()->PushTime(HistogramType::kStore,
                                        get_micro_second() - btime);
         if (!ret.ok()) {
@@ -155,20 +211,20 @@ Status Range::ApplyLock(const raft_cmdpb::Command &cmd) {
             resp->mutable_resp()->set_error("lock failed");
             break;
         }
+        lock_index_.Put(req.key(), req.value());
 
         if (cmd.cmd_id().node_id() == node_id_) {
             auto len = req.key().size() + req.value().ByteSizeLong();
             CheckSplit(len);
         }
-        delete val;
-
         FLOG_INFO("Range %" PRIu64 "  ApplyLock: lock [%s] is locked by %s",
                   id_, req.key().c_str(), req.by().c_str());
     } while (false);
 
     if (cmd.cmd_id().node_id() == node_id_) {
         ReplySubmit(cmd, resp, err, atime);
-    } else if (err != nullptr) {
+    } else {
+        delete resp;
         delete err;
     }
     return ret;
@@ -208,7 +264,7 @@ void Range::LockUpdate(common::ProtoMessage *msg,
         if (!ret.ok()) {
             FLOG_ERROR("range[%" PRIu64 "] LockUpdate raft submit error: %s", id_, ret.ToString().c_str());
 
-            err = RaftFailError();
+            err = SubmitFailError(ret);
         }
     } while (false);
 
@@ -236,7 +292,7 @@ Status Range::ApplyLockUpdate(const raft_cmdpb::Command &cmd) {
             break;
         }
 
-        auto val = LockGet(req.key());
+        std::unique_ptr<kvrpcpb::LockValue> val(LockGet(req.key()));
         if (val == nullptr) {
             FLOG_WARN("ApplyLockUpdate error: lock [%s] is not existed",
                       req.key().c_str());
@@ -267,7 +323,7 @@ Status Range::ApplyLockUpdate(const raft_cmdpb::Command &cmd) {
         }
 
         auto btime = get_micro_second();
-        ret = store_->Put(req.key(), val->SerializeAsString());
+        ret = store_->Put(req.key(), val->SerializeAsString(), cmd.expire_at());
         context_->Statistics()->PushTime(HistogramType::kStore,
                                        get_micro_second() - btime);
         if (!ret.ok()) {
@@ -277,20 +333,20 @@ Status Range::ApplyLockUpdate(const raft_cmdpb::Command &cmd) {
             resp->mutable_resp()->set_error("lock update failed");
             break;
         }
+        lock_index_.Put(req.key(), *val);
 
         if (cmd.cmd_id().node_id() == node_id_) {
             auto len = req.key().size() + req.ByteSizeLong();
             CheckSplit(len);
         }
-        delete val;
-
         FLOG_INFO("Range %" PRIu64 "  ApplyLockUpdate: lock [%s] is update",
                   id_, req.key().c_str());
     } while (false);
 
     if (cmd.cmd_id().node_id() == node_id_) {
         ReplySubmit(cmd, resp, err, atime);
-    } else if (err != nullptr) {
+    } else {
+        delete resp;
         delete err;
     }
     return ret;
@@ -317,7 +373,7 @@ void Range::Unlock(common::ProtoMessage *msg, kvrpcpb::DsUnlockRequest &req) {
         });
         if (!ret.ok()) {
             FLOG_ERROR("range[%" PRIu64 "] Unlock raft submit error: %s", id_, ret.ToString().c_str());
-            err = RaftFailError();
+            err = SubmitFailError(ret);
         }
     } while (false);
 
@@ -347,7 +403,7 @@ Status Range::ApplyUnlock(const raft_cmdpb::Command &cmd) {
             break;
         }
 
-        auto val = LockGet(req.key());
+        std::unique_ptr<kvrpcpb::LockValue> val(LockGet(req.key()));
         if (val == nullptr) {
             FLOG_WARN("Range %" PRIu64
                       "  ApplyUnlock error: lock [%s] is not existed",
@@ -389,15 +445,15 @@ Status Range::ApplyUnlock(const raft_cmdpb::Command &cmd) {
             resp->mutable_resp()->set_update_time(val->update_time());
             break;
         }
-        delete val;
-
+        lock_index_.Erase(req.key());
         FLOG_INFO("Range %" PRIu64 "  ApplyUnlock: lock [%s] is unlock by %s",
                   id_, req.key().c_str(), req.by().c_str());
     } while (false);
 
     if (cmd.cmd_id().node_id() == node_id_) {
         ReplySubmit(cmd, resp, err, atime);
-    } else if (err != nullptr) {
+    } else {
+        delete resp;
         delete err;
     }
     return ret;
@@ -426,7 +482,7 @@ void Range::UnlockForce(common::ProtoMessage *msg,
         if (!ret.ok()) {
             FLOG_ERROR("range[%" PRIu64 "] UnlockForce raft submit error: %s",
                        id_, ret.ToString().c_str());
-            err = RaftFailError();
+            err = SubmitFailError(ret);
         }
     } while (false);
 
@@ -455,7 +511,7 @@ Status Range::ApplyUnlockForce(const raft_cmdpb::Command &cmd) {
             break;
         }
 
-        auto val = LockGet(req.key());
+        std::unique_ptr<kvrpcpb::LockValue> val(LockGet(req.key()));
         if (val == nullptr) {
             FLOG_WARN("Range %" PRIu64
                       "  ApplyUnlockForce error: lock [%s] is not existed",
@@ -475,7 +531,7 @@ Status Range::ApplyUnlockForce(const raft_cmdpb::Command &cmd) {
         auto btime = get_micro_second();
         // do not really delete until the deleted time
         val->set_delete_flag(true);
-        ret = store_->Put(req.key(), val->SerializeAsString());
+        ret = store_->Put(req.key(), val->SerializeAsString(), cmd.expire_at());
         context_->Statistics()->PushTime(HistogramType::kStore,
                                        get_micro_second() - btime);
         if (!ret.ok()) {
@@ -487,8 +543,7 @@ Status Range::ApplyUnlockForce(const raft_cmdpb::Command &cmd) {
             resp->mutable_resp()->set_update_time(val->update_time());
             break;
         }
-        delete val;
-
+        lock_index_.Put(req.key(), *val);
         FLOG_INFO("Range %" PRIu64
                   "  ApplyUnlockForce: lock [%s] is force unlocked by %s",
                   id_, req.key().c_str(), req.by().c_str());
@@ -496,12 +551,115 @@ Status Range::ApplyUnlockForce(const raft_cmdpb::Command &cmd) {
 
     if (cmd.cmd_id().node_id() == node_id_) {
         ReplySubmit(cmd, resp, err, atime);
-    } else if (err != nullptr) {
+    } else {
+        delete resp;
         delete err;
     }
     return ret;
 }
 
+Status Range::ApplyLockReap(const raft_cmdpb::Command &cmd) {
+    errorpb::Error *err = nullptr;
+    if (!EpochIsEqual(cmd.verify_epoch(), err)) {
+        // 未清理的锁在leader上会再次到期，下一轮重新提交
+        RANGE_LOG_WARN("ApplyLockReap error: %s", err->message().c_str());
+        delete err;
+        return Status::OK();
+    }
+
+    size_t reaped = 0;
+    for (const auto &lock : cmd.lock_reap_req().locks()) {
+        // 只删除锁id一致的，清理期间被其他owner重新加上的锁保留
+        kvrpcpb::LockValue val;
+        if (!LockRead(lock.key(), &val) || val.id() != lock.id()) {
+            continue;
+        }
+        auto ret = store_->Delete(lock.key());
+        if (!ret.ok()) {
+            RANGE_LOG_ERROR("ApplyLockReap failed, code:%d, msg:%s", ret.code(),
+                            ret.ToString().c_str());
+            return ret;
+        }
+        lock_index_.Erase(lock.key());
+        ++reaped;
+    }
+    RANGE_LOG_DEBUG("ApplyLockReap: %lu/%d expired locks reaped", reaped,
+                    cmd.lock_reap_req().locks_size());
+    return Status::OK();
+}
+
+void Range::syncLockIndex(const raft_cmdpb::Command &cmd) {
+    std::vector<const std::string *> keys;
+    const std::string *start = nullptr;
+    const std::string *limit = nullptr;
+    switch (cmd.cmd_type()) {
+        case raft_cmdpb::CmdType::RawPut:
+            keys.push_back(&cmd.kv_raw_put_req().key());
+            break;
+        case raft_cmdpb::CmdType::RawDelete:
+            keys.push_back(&cmd.kv_raw_delete_req().key());
+            break;
+        case raft_cmdpb::CmdType::Insert:
+            for (const auto &row : cmd.insert_req().rows()) {
+                keys.push_back(&row.key());
+            }
+            break;
+        case raft_cmdpb::CmdType::Delete:
+            if (!cmd.delete_req().key().empty()) {
+                keys.push_back(&cmd.delete_req().key());
+            } else {
+                start = &cmd.delete_req().scope().start();
+                limit = &cmd.delete_req().scope().limit();
+            }
+            break;
+        case raft_cmdpb::CmdType::KvSet:
+            keys.push_back(&cmd.kv_set_req().kv().key());
+            break;
+        case raft_cmdpb::CmdType::KvBatchSet:
+            for (const auto &kv : cmd.kv_batch_set_req().kvs()) {
+                keys.push_back(&kv.key());
+            }
+            break;
+        case raft_cmdpb::CmdType::KvDelete:
+            keys.push_back(&cmd.kv_delete_req().key());
+            break;
+        case raft_cmdpb::CmdType::KvBatchDel:
+            for (const auto &key : cmd.kv_batch_del_req().keys()) {
+                keys.push_back(&key);
+            }
+            break;
+        case raft_cmdpb::CmdType::KvRangeDel:
+            start = &cmd.kv_range_del_req().start();
+            limit = &cmd.kv_range_del_req().limit();
+            break;
+        case raft_cmdpb::CmdType::KvIncr:
+            keys.push_back(&cmd.kv_incr_req().key());
+            break;
+        case raft_cmdpb::CmdType::KvAppend:
+            keys.push_back(&cmd.kv_append_req().key());
+            break;
+        default:
+            break;
+    }
+
+    // 按范围删除（可能有条件或数量限制）涉及到锁时无法逐个同步，重置后重新加载
+    if (start != nullptr && lock_index_.HasLock(*start, *limit)) {
+        RANGE_LOG_INFO("%s overlaps locks, reset lock index",
+                       raft_cmdpb::CmdType_Name(cmd.cmd_type()).c_str());
+        lock_index_.Reset();
+        return;
+    }
+    for (auto key : keys) {
+        std::string data;
+        kvrpcpb::LockValue value;
+        if (store_->Get(*key, &data).ok() && LockIndex::ParseLock(data, &value)) {
+            lock_index_.Put(*key, value);
+        } else {
+            lock_index_.Erase(*key);
+        }
+    }
+}
+
 void Range::LockScan(common::ProtoMessage *msg, kvrpcpb::DsLockScanRequest &req) {
     FLOG_DEBUG("lock scan: %s", req.DebugString().c_str());
     context_->Statistics()->PushTime(HistogramType::kQWait, get_micro_second() - msg->begin_time);
@@ -510,25 +668,33 @@ void Range::LockScan(common::ProtoMessage *msg, kvrpcpb::DsLockScanRequest &req)
     auto ds_resp = new kvrpcpb::DsLockScanResponse;
     auto start = std::max(req.req().start(), start_key_);
     auto limit = std::min(req.req().limit(), meta_.GetEndKey());
-    std::unique_ptr<storage::Iterator> iterator(store_->NewIterator(start, limit));
 
     int max_count = checkMaxCount(static_cast<int64_t >(req.req().count()));
     auto resp = ds_resp->mutable_resp();
 
-    uint64_t count = 0;
-    uint64_t total_size = 0;
-
-    for (int i = 0; iterator->Valid() && i < max_count; ++i) {
-        auto kv = resp->add_info();
-        FLOG_DEBUG("scan key: %s", iterator->key().c_str());
-        kv->set_key(std::move(iterator->key()));
-        kv->mutable_value()->ParseFromString(iterator->value());
-
-        count++;
-        total_size += iterator->key().length()+iterator->value().length();
+    // 索引已加载时直接从内存扫描，否则扫描存储，两者返回的锁相同
+    if (lock_index_.Loaded()) {
+        lock_index_.Scan(start, limit, static_cast<size_t>(max_count), resp);
+    } else {
+        std::unique_ptr<storage::Iterator> iterator(store_->NewIterator(start, limit));
+        kvrpcpb::LockValue value;
+        for (int i = 0; iterator->Valid() && i < max_count; iterator->Next()) {
+            if (!LockIndex::ParseLock(iterator->value(), &value)) {
+                continue;
+            }
+            auto info = resp->add_info();
+            info->set_key(iterator->key());
+            info->mutable_value()->Swap(&value);
+            ++i;
+        }
+    }
 
-        iterator->Next();
+    uint64_t total_size = 0;
+    for (const auto& info : resp->info()) {
+        total_size += info.key().size() + info.value().ByteSizeLong();
     }
+    FLOG_DEBUG("range[%" PRIu64 "] lock scan: %d locks, %" PRIu64 " bytes", id_,
+               resp->info_size(), total_size);
 
     if (resp->info_size() > 0) {
         auto lastIdx = resp->info_size()-1;
@@ -0,0 +1,237 @@
+#include "lock_index.h"
+
+#include <memory>
+
+#include "frame/sf_logger.h"
+#include "frame/sf_util.h"
+
+namespace sharkstore {
+namespace dataserver {
+namespace range {
+
+ExpireWheel::ExpireWheel(int64_t tick_ms) : tick_ms_(tick_ms > 0 ? tick_ms : 1) {}
+
+void ExpireWheel::Reset(int64_t now_ms) {
+    for (int level = 0; level < kLevels; ++level) {
+        for (int64_t i = 0; i < kSlots; ++i) {
+            std::vector<Item>().swap(slots_[level][i]);
+        }
+    }
+    std::vector<Item>().swap(overdue_);
+    size_ = 0;
+    current_ = now_ms / tick_ms_;
+}
+
+void ExpireWheel::Add(const std::string& key, int64_t deadline_ms) {
+    place(Item(key, deadline_ms));
+    ++size_;
+}
+
+void ExpireWheel::place(Item&& item) {
+    int64_t ticks = item.deadline / tick_ms_;
+    if (ticks <= current_) {
+        overdue_.push_back(std::move(item));
+        return;
+    }
+
+    int64_t diff = ticks - current_;
+    for (int level = 0; level < kLevels; ++level) {
+        int shift = kSlotBits * (level + 1);
+        if (level == kLevels - 1) {
+            // 超出时间轮范围的先放在最远处，下放时再重新计算
+            int64_t max_diff = (static_cast<int64_t>(1) << shift) - 1;
+            if (diff > max_diff) {
+                ticks = current_ + max_diff;
+            }
+        } else if (diff >= (static_cast<int64_t>(1) << shift)) {
+            continue;
+        }
+        auto idx = (ticks >> (kSlotBits * level)) & kSlotMask;
+        slots_[level][idx].push_back(std::move(item));
+        return;
+    }
+}
+
+void ExpireWheel::Advance(int64_t now_ms, std::vector<Item>* expired) {
+    int64_t target = now_ms / tick_ms_;
+    while (current_ < target) {
+        if (size_ == overdue_.size()) {  // 轮上为空，直接跳到目标tick
+            current_ = target;
+            break;
+        }
+
+        ++current_;
+        // 高层的槽到期后下放到低层
+        for (int level = 1; level < kLevels; ++level) {
+            int64_t mask = (static_cast<int64_t>(1) << (kSlotBits * level)) - 1;
+            if ((current_ & mask) != 0) {
+                break;
+            }
+            auto idx = (current_ >> (kSlotBits * level)) & kSlotMask;
+            std::vector<Item> items;
+            items.swap(slots_[level][idx]);
+            for (auto& item : items) {
+                place(std::move(item));
+            }
+        }
+
+        auto& slot = slots_[0][current_ & kSlotMask];
+        for (auto& item : slot) {
+            expired->push_back(std::move(item));
+        }
+        size_ -= slot.size();
+        slot.clear();
+    }
+
+    for (auto& item : overdue_) {
+        expired->push_back(std::move(item));
+    }
+    size_ -= overdue_.size();
+    overdue_.clear();
+}
+
+bool LockIndex::Loaded() const {
+    std::lock_guard<std::mutex> lock(mu_);
+    return loaded_;
+}
+
+bool LockIndex::ParseLock(const std::string& data, kvrpcpb::LockValue* value) {
+    return value->ParseFromString(data) && !value->id().empty();
+}
+
+Status LockIndex::Load(storage::Store* store) {
+    std::map<std::string, Entry> locks;
+    std::unique_ptr<storage::Iterator> it(store->NewIterator());
+    for (; it->Valid(); it->Next()) {
+        Entry e;
+        if (!ParseLock(it->value(), &e.value)) {
+            continue;
+        }
+        e.deadline = ExpireTime(e.value);
+        locks.emplace(it->key(), std::move(e));
+    }
+    auto s = it->status();
+    if (!s.ok()) {
+        return s;
+    }
+
+    std::lock_guard<std::mutex> lock(mu_);
+    locks_.swap(locks);
+    wheel_.Reset(getticks());
+    for (const auto& kv : locks_) {
+        wheel_.Add(kv.first, kv.second.deadline);
+    }
+    loaded_ = true;
+    return Status::OK();
+}
+
+void LockIndex::Reset() {
+    std::lock_guard<std::mutex> lock(mu_);
+    loaded_ = false;
+    std::map<std::string, Entry>().swap(locks_);
+    wheel_.Reset(0);
+}
+
+bool LockIndex::Get(const std::string& key, kvrpcpb::LockValue* value) const {
+    std::lock_guard<std::mutex> lock(mu_);
+    auto it = locks_.find(key);
+    if (it == locks_.end()) {
+        return false;
+    }
+    value->CopyFrom(it->second.value);
+    return true;
+}
+
+void LockIndex::Put(const std::string& key, const kvrpcpb::LockValue& value) {
+    std::lock_guard<std::mutex> lock(mu_);
+    if (!loaded_) {
+        return;
+    }
+    if (value.id().empty()) {
+        locks_.erase(key);
+    } else {
+        put(key, value);
+    }
+}
+
+void LockIndex::put(const std::string& key, const kvrpcpb::LockValue& value) {
+    auto& e = locks_[key];
+    e.value.CopyFrom(value);
+    auto deadline = ExpireTime(value);
+    // 时间轮中旧的到期条目在到期时按deadline不匹配丢弃
+    if (deadline != e.deadline) {
+        e.deadline = deadline;
+        wheel_.Add(key, deadline);
+    }
+}
+
+void LockIndex::Erase(const std::string& key) {
+    std::lock_guard<std::mutex> lock(mu_);
+    locks_.erase(key);
+}
+
+bool LockIndex::HasLock(const std::string& start, const std::string& limit) const {
+    std::lock_guard<std::mutex> lock(mu_);
+    auto it = locks_.lower_bound(start);
+    return it != locks_.end() && (limit.empty() || it->first < limit);
+}
+
+size_t LockIndex::Scan(const std::string& start, const std::string& limit, size_t max_count,
+                       kvrpcpb::LockScanResponse* resp) const {
+    std::lock_guard<std::mutex> lock(mu_);
+    size_t count = 0;
+    for (auto it = locks_.lower_bound(start);
+         it != locks_.end() && (limit.empty() || it->first < limit) && count < max_count; ++it, ++count) {
+        auto info = resp->add_info();
+        info->set_key(it->first);
+        info->mutable_value()->CopyFrom(it->second.value);
+    }
+    return count;
+}
+
+void LockIndex::CollectExpired(int64_t now, size_t max_count, int64_t retry_ms,
+                               std::vector<std::pair<std::string, std::string>>* locks) {
+    std::lock_guard<std::mutex> lock(mu_);
+    if (!loaded_) {
+        return;
+    }
+
+    std::vector<ExpireWheel::Item> items;
+    wheel_.Advance(now, &items);
+    for (auto& item : items) {
+        auto it = locks_.find(item.key);
+        if (it == locks_.end() || it->second.deadline != item.deadline) {
+            continue;  // 已删除或已更新
+        }
+        if (locks->size() >= max_count || !IsExpired(it->second.value, now)) {
+            // 超出本轮数量或tick内尚未到期的，下一轮再处理
+            wheel_.Add(item.key, item.deadline);
+            continue;
+        }
+        locks->emplace_back(item.key, it->second.value.id());
+        it->second.deadline = now + retry_ms;
+        wheel_.Add(item.key, it->second.deadline);
+    }
+}
+
+size_t LockIndex::Size() const {
+    std::lock_guard<std::mutex> lock(mu_);
+    return locks_.size();
+}
+
+int64_t LockIndex::ExpireTime(const kvrpcpb::LockValue& value) {
+    // 与LockGet的判断一致：now - update_time > DEFAULT_LOCK_DELETE_TIME_MILLSEC
+    int64_t expire = value.update_time() + DEFAULT_LOCK_DELETE_TIME_MILLSEC + 1;
+    if (value.delete_time() > 0 && value.delete_time() < expire) {
+        expire = value.delete_time();
+    }
+    return expire;
+}
+
+bool LockIndex::IsExpired(const kvrpcpb::LockValue& value, int64_t now) {
+    return now >= ExpireTime(value);
+}
+
+}  // namespace range
+}  // namespace dataserver
+}  // namespace sharkstore
@@ -0,0 +1,130 @@
+_Pragma("once");
+
+#include <stdint.h>
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "base/status.h"
+#include "storage/store.h"
+#include "proto/gen/kvrpcpb.pb.h"
+
+namespace sharkstore {
+namespace dataserver {
+namespace range {
+
+// 锁超过该时间未更新即视为失效（毫秒）
+static const int64_t DEFAULT_LOCK_DELETE_TIME_MILLSEC = 3000;
+
+// 分层时间轮，按到期时间（毫秒）调度key
+// 共kLevels层，每层64个槽，第0层每槽一个tick，第n层每槽64^n个tick
+// 超出最高层范围的条目放在最高层，下放时重新计算位置
+class ExpireWheel {
+public:
+    struct Item {
+        std::string key;
+        int64_t deadline = 0;
+
+        Item() = default;
+        Item(const std::string& k, int64_t d) : key(k), deadline(d) {}
+    };
+
+    static const int64_t kDefaultTickMs = 100;
+
+    explicit ExpireWheel(int64_t tick_ms = kDefaultTickMs);
+
+    ExpireWheel(const ExpireWheel&) = delete;
+    ExpireWheel& operator=(const ExpireWheel&) = delete;
+
+    // 清空并把当前时间设为now
+    void Reset(int64_t now_ms);
+
+    // 到期时间不晚于当前tick的条目在下次Advance时立即返回
+    void Add(const std::string& key, int64_t deadline_ms);
+
+    // 推进到now，到期的条目追加到expired
+    void Advance(int64_t now_ms, std::vector<Item>* expired);
+
+    size_t Size() const { return size_; }
+
+private:
+    static const int kLevels = 4;
+    static const int kSlotBits = 6;
+    static const int64_t kSlots = 1 << kSlotBits;
+    static const int64_t kSlotMask = kSlots - 1;
+
+    void place(Item&& item);
+
+private:
+    const int64_t tick_ms_;
+    int64_t current_ = 0;  // 当前tick
+    size_t size_ = 0;
+
+    std::vector<Item> overdue_;
+    std::vector<Item> slots_[kLevels][kSlots];
+};
+
+// range内锁的内存索引，leader上用于加速锁的检查及主动清理过期锁
+// 首次使用时从存储全量加载，之后由各lock apply路径同步维护；
+// 非lock命令写入的key逐个同步，按范围删除涉及到锁时重置，下次使用时重新加载
+// 索引中的内容与从存储按ParseLock读出的一致
+class LockIndex {
+public:
+    LockIndex() = default;
+
+    LockIndex(const LockIndex&) = delete;
+    LockIndex& operator=(const LockIndex&) = delete;
+
+    bool Loaded() const;
+
+    // 解析存储中的值，不是锁（解析失败或没有锁id）时返回false
+    static bool ParseLock(const std::string& data, kvrpcpb::LockValue* value);
+
+    // 从存储重建索引，不是锁的值忽略
+    Status Load(storage::Store* store);
+    // 清空并置为未加载（失去leader、分裂、应用快照时）
+    void Reset();
+
+    // 返回原始的锁（不检查是否过期）
+    bool Get(const std::string& key, kvrpcpb::LockValue* value) const;
+    // value不是锁（没有锁id）时删除
+    void Put(const std::string& key, const kvrpcpb::LockValue& value);
+    void Erase(const std::string& key);
+    // [start, limit)内是否有锁，limit为空表示不限
+    bool HasLock(const std::string& start, const std::string& limit) const;
+
+    // 扫描[start, limit)内的锁，返回条数
+    size_t Scan(const std::string& start, const std::string& limit, size_t max_count,
+                kvrpcpb::LockScanResponse* resp) const;
+
+    // 收集已过期的锁（key和锁id），最多max_count个
+    // 收集的锁在retry_ms后会再次到期，以防清理命令未能提交
+    void CollectExpired(int64_t now, size_t max_count, int64_t retry_ms,
+                        std::vector<std::pair<std::string, std::string>>* locks);
+
+    size_t Size() const;
+
+    // 锁的失效时间（毫秒）
+    static int64_t ExpireTime(const kvrpcpb::LockValue& value);
+    static bool IsExpired(const kvrpcpb::LockValue& value, int64_t now);
+
+private:
+    struct Entry {
+        kvrpcpb::LockValue value;
+        int64_t deadline = 0;
+    };
+
+    void put(const std::string& key, const kvrpcpb::LockValue& value);
+
+private:
+    mutable std::mutex mu_;
+    bool loaded_ = false;
+    std::map<std::string, Entry> locks_;
+    ExpireWheel wheel_;
+};
+
+}  // namespace range
+}  // namespace dataserver
+}  // namespace sharkstore
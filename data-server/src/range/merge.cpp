@@ -0,0 +1,308 @@
+#include "range.h"
+
+#include <algorithm>
+
+#include "base/util.h"
+#include "storage/meta_store.h"
+
+#include "range_logger.h"
+
+namespace sharkstore {
+namespace dataserver {
+namespace range {
+
+// 等待被合并range冻结的最大心跳次数
+static const int kMaxMergeWaitHeartbeats = 6;
+
+// 合并流程（target为左侧range，source为右侧相邻range，两者leader都在本节点）：
+// 1. source提交AdminMerge(freeze)冻结自己：版本号加一，之后的命令回复stale epoch
+// 2. source所有副本都已提交冻结日志后，target提交AdminMerge(commit)吸收source的key范围
+//    副本上source可能尚未应用冻结日志，target应用commit时暂缓，等本地source冻结后再按序应用，
+//    保证source冻结前的写入先于target合并后的写入
+// 3. 各节点上source冻结且target吸收后，本地销毁source（数据已在共享的rocksdb中，不删除），
+//    master在target的心跳中看到合并后的范围后删除source的路由
+Status Range::Merge(const std::shared_ptr<Range> &source) {
+    if (!valid_ || !source->valid_) {
+        return Status(Status::kInvalid, "range is invalid", "");
+    }
+    if (!is_leader_ || !source->is_leader_) {
+        return Status(Status::kNotLeader, "merge need both leaders on this node", "");
+    }
+    if (merge_source_ != 0 || merged_into_ != 0 || merge_pending_ != 0 ||
+        source->merge_source_ != 0 || source->merged_into_ != 0) {
+        return Status(Status::kExisted, "merge in progress", "");
+    }
+
+    auto meta = meta_.Get();
+    auto src = source->options();
+    if (src.table_id() != meta.table_id() || src.start_key() != meta.end_key()) {
+        return Status(Status::kInvalidArgument, "not adjacent range", std::to_string(src.id()));
+    }
+
+    // 副本需在相同的节点上
+    std::vector<uint64_t> nodes, src_nodes;
+    for (const auto &peer : meta.peers()) {
+        nodes.push_back(peer.node_id());
+    }
+    for (const auto &peer : src.peers()) {
+        src_nodes.push_back(peer.node_id());
+    }
+    std::sort(nodes.begin(), nodes.end());
+    std::sort(src_nodes.begin(), src_nodes.end());
+    if (nodes != src_nodes) {
+        return Status(Status::kInvalidArgument, "replica set mismatch", std::to_string(src.id()));
+    }
+
+    raft_cmdpb::Command cmd;
+    cmd.set_cmd_type(raft_cmdpb::CmdType::AdminMerge);
+    cmd.mutable_verify_epoch()->CopyFrom(src.range_epoch());
+    auto req = cmd.mutable_admin_merge_req();
+    req->set_commit(false);
+    req->mutable_target()->CopyFrom(meta);
+    req->mutable_source()->CopyFrom(src);
+    auto s = source->Submit(cmd);
+    if (!s.ok()) {
+        return s;
+    }
+
+    merge_wait_ = 0;
+    merge_source_ = src.id();
+
+    RANGE_LOG_INFO("merge begin, source range: %" PRIu64 ", key range[%s - %s]",
+            src.id(), EncodeToHex(src.start_key()).c_str(), EncodeToHex(src.end_key()).c_str());
+    return Status::OK();
+}
+
+bool Range::MergeFrozenCommitted() {
+    if (!is_leader_ || merged_into_ == 0) {
+        return false;
+    }
+
+    raft::RaftStatus rs;
+    raft_->GetStatus(&rs);
+    if (rs.leader != node_id_) {
+        return false;
+    }
+    for (const auto &pr : rs.replicas) {
+        if (pr.second.commit < merge_index_) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void Range::CheckMerge() {
+    // 冻结后target的leader换过，由source重新发起后续流程
+    if (merged_into_ != 0) {
+        auto target = context_->FindRange(merged_into_);
+        if (target != nullptr && target->is_leader_ && target->merge_source_ == 0 &&
+            target->meta_.GetEndKey() != meta_.GetEndKey()) {
+            target->merge_wait_ = 0;
+            target->merge_source_ = id_;
+        }
+        return;
+    }
+
+    uint64_t source_id = merge_source_;
+    if (source_id == 0 || !is_leader_) {
+        return;
+    }
+
+    auto source = context_->FindRange(source_id);
+    if (source == nullptr) {
+        RANGE_LOG_WARN("merge source range %" PRIu64 " not found, abort", source_id);
+        merge_source_ = 0;
+        return;
+    }
+    if (source->merged_into_ != id_) {
+        if (++merge_wait_ > kMaxMergeWaitHeartbeats) {
+            RANGE_LOG_WARN("merge source range %" PRIu64 " not frozen, abort", source_id);
+            merge_source_ = 0;
+        }
+        return;
+    }
+    if (!source->MergeFrozenCommitted()) {
+        return;
+    }
+
+    raft_cmdpb::Command cmd;
+    cmd.set_cmd_type(raft_cmdpb::CmdType::AdminMerge);
+    meta_.GetEpoch(cmd.mutable_verify_epoch());
+    auto req = cmd.mutable_admin_merge_req();
+    req->set_commit(true);
+    meta_.Get(req->mutable_target());
+    source->meta_.Get(req->mutable_source());
+    auto s = Submit(cmd);
+    if (!s.ok()) {
+        RANGE_LOG_WARN("submit merge source range %" PRIu64 " failed: %s",
+                source_id, s.ToString().c_str());
+        return;
+    }
+    merge_source_ = 0;
+}
+
+Status Range::ApplyMerge(const raft_cmdpb::Command &cmd, uint64_t index) {
+    const auto &req = cmd.admin_merge_req();
+    if (!EpochIsEqual(cmd.verify_epoch())) {
+        RANGE_LOG_WARN("ApplyMerge(target: %" PRIu64 ", source: %" PRIu64 ") epoch is changed: "
+                "%" PRIu64 " != %" PRIu64, req.target().id(), req.source().id(),
+                cmd.verify_epoch().version(), meta_.GetVersion());
+        return Status::OK();
+    }
+
+    if (req.commit()) {
+        return ApplyMergeCommit(req);
+    } else {
+        return ApplyMergeFreeze(req, index);
+    }
+}
+
+Status Range::ApplyMergeFreeze(const raft_cmdpb::MergeRequest &req, uint64_t index) {
+    const auto &target = req.target();
+    if (merged_into_ != 0) {
+        return Status::OK();
+    }
+    if (req.source().id() != id_ || target.end_key() != start_key_) {
+        RANGE_LOG_ERROR("ApplyMerge(target: %" PRIu64 ") not adjacent: [%s - %s]", target.id(),
+                EncodeToHex(target.start_key()).c_str(), EncodeToHex(target.end_key()).c_str());
+        return Status::OK();
+    }
+
+    auto s = context_->MetaStore()->SaveMergeState(id_, target.id());
+    if (!s.ok()) {
+        RANGE_LOG_ERROR("save merge state failed: %s", s.ToString().c_str());
+        return s;
+    }
+
+    auto meta = meta_.Get();
+    meta.mutable_range_epoch()->set_version(meta.range_epoch().version() + 1);
+    s = SaveMeta(meta);
+    if (!s.ok()) {
+        RANGE_LOG_ERROR("save merge meta failed: %s", s.ToString().c_str());
+        return Status(Status::kIOError, "save range meta", "");
+    }
+    meta_.SetVersion(meta.range_epoch().version());
+
+    merge_index_ = index;
+    merged_into_ = target.id();
+
+    lock_index_.Reset();
+    store_->GetLoadSampler()->Stop();
+
+    RANGE_LOG_INFO("ApplyMerge frozen, merge into range %" PRIu64 ", version: %" PRIu64,
+            target.id(), meta_.GetVersion());
+
+    // 本地target可能已在等待冻结
+    auto rng = context_->FindRange(target.id());
+    if (rng != nullptr) {
+        rng->ResumeMerge(id_);
+    }
+
+    context_->RetireMergedRange(id_);
+    return Status::OK();
+}
+
+Status Range::ApplyMergeCommit(const raft_cmdpb::MergeRequest &req) {
+    const auto &source = req.source();
+    if (merged_into_ != 0) {
+        RANGE_LOG_WARN("ApplyMerge(source: %" PRIu64 ") range is frozen", source.id());
+        return Status::OK();
+    }
+
+    auto meta = meta_.Get();
+    if (req.target().id() != id_ || source.table_id() != meta.table_id() ||
+        source.start_key() != meta.end_key()) {
+        RANGE_LOG_ERROR("ApplyMerge(source: %" PRIu64 ") not adjacent: [%s - %s]", source.id(),
+                EncodeToHex(source.start_key()).c_str(), EncodeToHex(source.end_key()).c_str());
+        return Status::OK();
+    }
+
+    // 本地source尚未应用冻结日志，其之前的写入可能还未应用，暂缓
+    bool frozen = true;
+    auto rng = context_->FindRange(source.id());
+    if (rng != nullptr) {
+        frozen = rng->merged_into_ == id_;
+    } else {
+        // 重启恢复时source可能尚未加载，以持久化的状态为准
+        metapb::Range src_meta;
+        if (context_->MetaStore()->GetRange(source.id(), &src_meta).ok()) {
+            uint64_t merged_into = 0;
+            context_->MetaStore()->LoadMergeState(source.id(), &merged_into);
+            frozen = merged_into == id_;
+        }
+    }
+    if (!frozen) {
+        RANGE_LOG_INFO("ApplyMerge(source: %" PRIu64 ") wait local source frozen", source.id());
+        merge_pending_ = source.id();
+        return Status::OK();
+    }
+
+    auto version = std::max(meta.range_epoch().version(), source.range_epoch().version()) + 1;
+    meta.set_end_key(source.end_key());
+    meta.mutable_range_epoch()->set_version(version);
+    auto s = SaveMeta(meta);
+    if (!s.ok()) {
+        RANGE_LOG_ERROR("save merge meta failed: %s", s.ToString().c_str());
+        return Status(Status::kIOError, "save range meta", "");
+    }
+
+    meta_.Merge(source.end_key(), version);
+    store_->SetEndKey(source.end_key());
+    lock_index_.Reset();
+    store_->GetLoadSampler()->Stop();
+
+    if (is_leader_) {
+        if (rng != nullptr) {
+            real_size_ += rng->real_size_;
+        }
+        context_->ScheduleHeartbeat(id_, false);
+    }
+
+    RANGE_LOG_INFO("ApplyMerge(source: %" PRIu64 ") end, key range[%s - %s], version: %" PRIu64,
+            source.id(), EncodeToHex(start_key_).c_str(), EncodeToHex(source.end_key()).c_str(),
+            version);
+
+    context_->RetireMergedRange(source.id());
+    return Status::OK();
+}
+
+void Range::ResumeMerge(uint64_t source_id) {
+    std::lock_guard<std::mutex> lock(merge_mu_);
+    if (merge_pending_ != source_id) {
+        return;
+    }
+    merge_pending_ = 0;
+
+    RANGE_LOG_INFO("merge source range %" PRIu64 " frozen, resume %zu pending entries",
+            source_id, merge_pending_cmds_.size());
+
+    while (!merge_pending_cmds_.empty()) {
+        const auto &entry = merge_pending_cmds_.front();
+        auto s = applyEntry(entry.second, entry.first);
+        if (!s.ok()) {
+            RANGE_LOG_ERROR("apply pending entry at index %" PRIu64 " failed: %s",
+                    entry.first, s.ToString().c_str());
+            merge_pending_ = source_id;
+            return;
+        }
+        // 又一条合并日志需要等待，从它开始继续暂缓
+        if (merge_pending_ != 0) {
+            return;
+        }
+        merge_pending_cmds_.pop_front();
+    }
+}
+
+void Range::ReplyMerged(const raft_cmdpb::Command &cmd) {
+    if (cmd.cmd_id().node_id() != node_id_) {
+        return;
+    }
+    auto ctx = submit_queue_.Remove(cmd.cmd_id().seq());
+    if (ctx != nullptr) {
+        ctx->SendError(context_->SocketSession(), StaleEpochError(cmd.verify_epoch()));
+    }
+}
+
+}  // namespace range
+}  // namespace dataserver
+}  // namespace sharkstore
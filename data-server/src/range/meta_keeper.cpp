@@ -1,17 +1,54 @@
 #include "meta_keeper.h"
 
+#include <cassert>
 #include <mutex>
 #include <sstream>
 
+#include "base/rcu.h"
 #include "base/util.h"
 
 namespace sharkstore {
 namespace dataserver {
 namespace range {
 
-MetaKeeper::MetaKeeper(const metapb::Range& m) : meta_(m) {}
+// 所有range的元数据快照共用，写者很少（分裂、成员变更、leader变化）
+static RcuDomain& snapshotRcu() {
+    static RcuDomain rcu;
+    return rcu;
+}
+
+MetaKeeper::MetaKeeper(const metapb::Range& m) : meta_(m) {
+    snapshot_ = newSnapshot();
+}
+
+MetaKeeper::MetaKeeper(metapb::Range&& m) : meta_(std::move(m)) {
+    snapshot_ = newSnapshot();
+}
 
-MetaKeeper::MetaKeeper(metapb::Range&& m) : meta_(std::move(m)) {}
+MetaKeeper::~MetaKeeper() {
+    delete snapshot_.load();
+}
+
+MetaSnapshot* MetaKeeper::newSnapshot() const {
+    auto snap = new MetaSnapshot;
+    snap->table_id = meta_.table_id();
+    snap->start_key = meta_.start_key();
+    snap->end_key = meta_.end_key();
+    snap->version = meta_.range_epoch().version();
+    snap->conf_ver = meta_.range_epoch().conf_ver();
+    snap->leader = leader_;
+    snap->term = term_;
+    return snap;
+}
+
+MetaSnapshot* MetaKeeper::publish() {
+    return snapshot_.exchange(newSnapshot());
+}
+
+void MetaKeeper::retire(MetaSnapshot* old) {
+    // 不等待读者，旧快照在发布前进入的读者退出后由后台线程释放
+    snapshotRcu().Retire([old] { delete old; });
+}
 
 metapb::Range MetaKeeper::Get() const {
     sharkstore::shared_lock<sharkstore::shared_mutex> lock(rw_lock_);
@@ -27,11 +64,17 @@ void MetaKeeper::Get(metapb::Range *out) const {
 void MetaKeeper::Set(const metapb::Range& to) {
     std::unique_lock<sharkstore::shared_mutex> lock(rw_lock_);
     meta_ = to;
+    auto old = publish();
+    lock.unlock();
+    retire(old);
 }
 
 void MetaKeeper::Set(metapb::Range&& to) {
     std::unique_lock<sharkstore::shared_mutex> lock(rw_lock_);
     meta_ = std::move(to);
+    auto old = publish();
+    lock.unlock();
+    retire(old);
 }
 
 void MetaKeeper::GetEpoch(metapb::RangeEpoch* epoch) const {
@@ -40,28 +83,56 @@ void MetaKeeper::GetEpoch(metapb::RangeEpoch* epoch) const {
 }
 
 uint64_t MetaKeeper::GetConfVer() const {
-    sharkstore::shared_lock<sharkstore::shared_mutex> lock(rw_lock_);
-    return meta_.range_epoch().conf_ver();
+    RcuDomain::ReadGuard guard(snapshotRcu());
+    return snapshot_.load()->conf_ver;
 }
 
 uint64_t MetaKeeper::GetVersion() const {
-    sharkstore::shared_lock<sharkstore::shared_mutex> lock(rw_lock_);
-    return meta_.range_epoch().version();
+    RcuDomain::ReadGuard guard(snapshotRcu());
+    return snapshot_.load()->version;
 }
 
 uint64_t MetaKeeper::GetTableID() const {
-    sharkstore::shared_lock<sharkstore::shared_mutex> lock(rw_lock_);
-    return meta_.table_id();
+    RcuDomain::ReadGuard guard(snapshotRcu());
+    return snapshot_.load()->table_id;
 }
 
 std::string MetaKeeper::GetStartKey() const {
-    sharkstore::shared_lock<sharkstore::shared_mutex> lock(rw_lock_);
-    return meta_.start_key();
+    RcuDomain::ReadGuard guard(snapshotRcu());
+    return snapshot_.load()->start_key;
 }
 
 std::string MetaKeeper::GetEndKey() const {
-    sharkstore::shared_lock<sharkstore::shared_mutex> lock(rw_lock_);
-    return meta_.end_key();
+    RcuDomain::ReadGuard guard(snapshotRcu());
+    return snapshot_.load()->end_key;
+}
+
+int MetaKeeper::CompareKey(const std::string& key) const {
+    RcuDomain::ReadGuard guard(snapshotRcu());
+    auto snap = snapshot_.load();
+    if (key < snap->start_key) {
+        return -1;
+    } else if (key >= snap->end_key) {
+        return 1;
+    } else {
+        return 0;
+    }
+}
+
+void MetaKeeper::SetLeaderTerm(uint64_t leader, uint64_t term) {
+    std::unique_lock<sharkstore::shared_mutex> lock(rw_lock_);
+    leader_ = leader;
+    term_ = term;
+    auto old = publish();
+    lock.unlock();
+    retire(old);
+}
+
+void MetaKeeper::GetLeaderTerm(uint64_t* leader, uint64_t* term) const {
+    RcuDomain::ReadGuard guard(snapshotRcu());
+    auto snap = snapshot_.load();
+    *leader = snap->leader;
+    *term = snap->term;
 }
 
 Status MetaKeeper::verifyConfVer(uint64_t conf_ver) const {
@@ -100,6 +171,9 @@ Status MetaKeeper::AddPeer(const metapb::Peer& peer, uint64_t verify_conf_ver) {
     // add
     meta_.add_peers()->CopyFrom(peer);
     meta_.mutable_range_epoch()->set_conf_ver(verify_conf_ver + 1);
+    auto old = publish();
+    lock.unlock();
+    retire(old);
 
     return Status::OK();
 }
@@ -117,6 +191,9 @@ Status MetaKeeper::DelPeer(const metapb::Peer& peer, uint64_t verify_conf_ver) {
         if (same_node && same_id) {
             meta_.mutable_peers()->erase(it);
             meta_.mutable_range_epoch()->set_conf_ver(verify_conf_ver + 1);
+            auto old = publish();
+            lock.unlock();
+            retire(old);
             return Status::OK();
         }
     }
@@ -211,6 +288,29 @@ void MetaKeeper::Split(const std::string& end_key, uint64_t new_version) {
 
     meta_.set_end_key(end_key);
     meta_.mutable_range_epoch()->set_version(new_version);
+    auto old = publish();
+    lock.unlock();
+    retire(old);
+}
+
+void MetaKeeper::Merge(const std::string& end_key, uint64_t new_version) {
+    std::unique_lock<sharkstore::shared_mutex> lock(rw_lock_);
+
+    assert(end_key > meta_.end_key());
+    meta_.set_end_key(end_key);
+    meta_.mutable_range_epoch()->set_version(new_version);
+    auto old = publish();
+    lock.unlock();
+    retire(old);
+}
+
+void MetaKeeper::SetVersion(uint64_t new_version) {
+    std::unique_lock<sharkstore::shared_mutex> lock(rw_lock_);
+
+    meta_.mutable_range_epoch()->set_version(new_version);
+    auto old = publish();
+    lock.unlock();
+    retire(old);
 }
 
 std::string MetaKeeper::ToString() const {
@@ -1,5 +1,7 @@
 _Pragma("once");
 
+#include <atomic>
+
 #include "base/shared_mutex.h"
 #include "base/status.h"
 #include "proto/gen/metapb.pb.h"
@@ -8,13 +10,25 @@ namespace sharkstore {
 namespace dataserver {
 namespace range {
 
+// 请求校验用的不可变元数据快照，每次修改后整体替换
+struct MetaSnapshot {
+    uint64_t table_id = 0;
+    std::string start_key;
+    std::string end_key;
+    uint64_t version = 0;
+    uint64_t conf_ver = 0;
+    uint64_t leader = 0;
+    uint64_t term = 0;
+};
+
 // MetaKeeper:
 // manager query and update operation to metapb::Range
+// 表id、key范围、epoch及leader从快照中无锁读取（RCU），其余通过读写锁访问完整的meta
 class MetaKeeper {
 public:
     explicit MetaKeeper(const metapb::Range& m);
     explicit MetaKeeper(metapb::Range&& m);
-    ~MetaKeeper() = default;
+    ~MetaKeeper();
 
     MetaKeeper(const MetaKeeper&) = delete;
     MetaKeeper& operator=(const MetaKeeper&) = delete;
@@ -32,6 +46,13 @@ public:
     uint64_t GetConfVer() const;
     uint64_t GetVersion() const;
 
+    // key小于start key返回-1，不小于end key返回1，在范围内返回0（不复制key）
+    int CompareKey(const std::string& key) const;
+
+    // raft leader变化时更新
+    void SetLeaderTerm(uint64_t leader, uint64_t term);
+    void GetLeaderTerm(uint64_t* leader, uint64_t* term) const;
+
     Status AddPeer(const metapb::Peer& peer, uint64_t verify_conf_ver);
     Status DelPeer(const metapb::Peer& peer, uint64_t verify_conf_ver);
     Status PromotePeer(uint64_t node_id, uint64_t peer_id);
@@ -42,6 +63,9 @@ public:
 
     Status CheckSplit(const std::string& end_key, uint64_t version) const;
     void Split(const std::string& end_key, uint64_t new_version);
+    // 合并右侧相邻的range，end_key为其end key
+    void Merge(const std::string& end_key, uint64_t new_version);
+    void SetVersion(uint64_t new_version);
 
     std::string ToString() const;
 
@@ -51,9 +75,19 @@ private:
     // unlocked
     Status verifyVersion(uint64_t version) const;
 
+    MetaSnapshot* newSnapshot() const;
+    // 由meta_重新生成快照并替换，返回旧的快照，调用方需持有写锁
+    MetaSnapshot* publish();
+    // 释放写锁后调用，旧快照在当前读者退出后由后台回收
+    static void retire(MetaSnapshot* old);
+
 private:
     mutable shared_mutex rw_lock_;
     metapb::Range meta_;
+    uint64_t leader_ = 0;
+    uint64_t term_ = 0;
+
+    std::atomic<MetaSnapshot*> snapshot_ = {nullptr};
 };
 
 }  // namespace range
@@ -19,13 +19,35 @@ static const int kDownPeerThresholdSecs = 50;
 // 磁盘使用率大于百分之92停写
 static const uint64_t kStopWriteFsUsagePercent = 92;
 
+// 能否与其他命令合并为一条日志
+// 合并的日志中各命令分别写入，apply index最后保存，中途失败或重启时整条日志重新应用，
+// 因此只合并重复应用结果不变的命令（put、delete等）；
+// admin命令改变range本身，incr/append及锁操作重复应用结果会变，都单独一条日志
+static bool isBatchable(raft_cmdpb::CmdType type) {
+    switch (type) {
+        case raft_cmdpb::CmdType::AdminSplit:
+        case raft_cmdpb::CmdType::AdminMerge:
+        case raft_cmdpb::CmdType::AdminLeaderChange:
+        case raft_cmdpb::CmdType::KvIncr:
+        case raft_cmdpb::CmdType::KvAppend:
+        case raft_cmdpb::CmdType::Lock:
+        case raft_cmdpb::CmdType::LockUpdate:
+        case raft_cmdpb::CmdType::Unlock:
+        case raft_cmdpb::CmdType::UnlockForce:
+            return false;
+        default:
+            return true;
+    }
+}
+
 Range::Range(RangeContext* context, const metapb::Range &meta) :
     context_(context),
     node_id_(context_->GetNodeID()),
     id_(meta.id()),
     start_key_(meta.start_key()),
     meta_(meta),
-    store_(new storage::Store(meta, context->DBInstance())) {
+    store_(new storage::Store(meta, context->DBInstance(),
+                              context->TableColumnFamily(meta.table_id()))) {
 }
 
 Range::~Range() {}
@@ -36,6 +58,17 @@ Status Range::Initialize(uint64_t leader, uint64_t log_start_index) {
     if (!s.ok()) {
         return Status(Status::kCorruption, "load applied", s.ToString());
     }
+    // incr/append与数据原子保存的apply index，写入后、保存到meta前重启时比meta中的新
+    uint64_t data_applied = 0;
+    s = store_->LoadApplyIndex(&data_applied);
+    if (!s.ok()) {
+        return Status(Status::kCorruption, "load data applied", s.ToString());
+    }
+    if (data_applied > apply_index_) {
+        RANGE_LOG_INFO("applied %" PRIu64 " from data db, %" PRIu64 " in meta",
+                       data_applied, apply_index_);
+        apply_index_ = data_applied;
+    }
 
     // 创建起始日志之前的日志都算作被应用过的
     if (log_start_index > 1 && log_start_index - 1 > apply_index_) {
@@ -46,6 +79,17 @@ Status Range::Initialize(uint64_t leader, uint64_t log_start_index) {
         }
     }
 
+    // 加载合并状态，已冻结的range等待被合并方销毁
+    uint64_t merged_into = 0;
+    s = context_->MetaStore()->LoadMergeState(id_, &merged_into);
+    if (!s.ok()) {
+        return Status(Status::kCorruption, "load merge state", s.ToString());
+    }
+    if (merged_into != 0) {
+        merge_index_ = apply_index_;
+        merged_into_ = merged_into;
+    }
+
     // 初始化raft
     raft::RaftOptions options;
     options.id = id_;
@@ -56,6 +100,7 @@ Status Range::Initialize(uint64_t leader, uint64_t log_start_index) {
     options.max_log_files = ds_config.raft_config.max_log_files;
     options.allow_log_corrupt = ds_config.raft_config.allow_log_corrupt > 0;
     options.initial_first_index = log_start_index;
+    options.max_batch_bytes = ds_config.raft_config.max_batch_bytes;
     options.storage_path = JoinFilePath(std::vector<std::string>{
         std::string(ds_config.raft_config.log_path), std::to_string(meta_.GetTableID()),
         std::to_string(id_)});
@@ -81,6 +126,9 @@ Status Range::Initialize(uint64_t leader, uint64_t log_start_index) {
         return Status(Status::kInvalidArgument, "create raft", s.ToString());
     }
 
+    if (leader != 0) {
+        meta_.SetLeaderTerm(leader, options.term);
+    }
     if (leader == node_id_) {
         context_->Statistics()->IncrLeaderCount();
         is_leader_ = true;
@@ -108,6 +156,9 @@ void Range::Heartbeat() {
         context_->ScheduleHeartbeat(id_, true);
     }
 
+    ReapExpiredLocks();
+    CheckMerge();
+
     // clear async apply expired task
     ClearExpiredContext();
 }
@@ -172,7 +223,19 @@ bool Range::PushHeartBeatMessage() {
     stats->set_keys_written(store_stat.keys_write_per_sec);
     stats->set_bytes_written(store_stat.bytes_write_per_sec);
 
-    context_->MasterClient()->AsyncRangeHeartbeat(req);
+    store_->ExpireCursors();
+    store_->ExpireSnapshots();
+
+    CheckLoadSplit(store_stat);
+
+    // 内容与上次发送的相同（如空闲range）时只发送range id，由master沿用已有的信息
+    auto hash = std::hash<std::string>()(req.SerializeAsString());
+    if (hash == last_hb_hash_) {
+        context_->MasterClient()->AsyncRangeHeartbeatUnchanged(id_);
+    } else {
+        last_hb_hash_ = hash;
+        context_->MasterClient()->AsyncRangeHeartbeat(req);
+    }
 
     return true;
 }
@@ -191,29 +254,57 @@ Status Range::Apply(const raft_cmdpb::Command &cmd, uint64_t index) {
             return ApplyUnlock(cmd);
         case raft_cmdpb::CmdType::UnlockForce:
             return ApplyUnlockForce(cmd);
+        case raft_cmdpb::CmdType::LockReap:
+            return ApplyLockReap(cmd);
+        default:
+            break;
+    }
 
+    Status ret;
+    switch (cmd.cmd_type()) {
         case raft_cmdpb::CmdType::RawPut:
-            return ApplyRawPut(cmd);
+            ret = ApplyRawPut(cmd);
+            break;
         case raft_cmdpb::CmdType::RawDelete:
-            return ApplyRawDelete(cmd);
+            ret = ApplyRawDelete(cmd);
+            break;
         case raft_cmdpb::CmdType::Insert:
-            return ApplyInsert(cmd);
+            ret = ApplyInsert(cmd);
+            break;
         case raft_cmdpb::CmdType::Delete:
-            return ApplyDelete(cmd);
+            ret = ApplyDelete(cmd);
+            break;
         case raft_cmdpb::CmdType::KvSet:
-            return ApplyKVSet(cmd);
+            ret = ApplyKVSet(cmd);
+            break;
         case raft_cmdpb::CmdType::KvBatchSet:
-            return ApplyKVBatchSet(cmd);
+            ret = ApplyKVBatchSet(cmd);
+            break;
         case raft_cmdpb::CmdType::KvDelete:
-            return ApplyKVDelete(cmd);
+            ret = ApplyKVDelete(cmd);
+            break;
         case raft_cmdpb::CmdType::KvBatchDel:
-            return ApplyKVBatchDelete(cmd);
+            ret = ApplyKVBatchDelete(cmd);
+            break;
         case raft_cmdpb::CmdType::KvRangeDel:
-            return ApplyKVRangeDelete(cmd);
+            ret = ApplyKVRangeDelete(cmd);
+            break;
+        case raft_cmdpb::CmdType::KvIncr:
+            ret = ApplyKVIncr(cmd, index);
+            break;
+        case raft_cmdpb::CmdType::KvAppend:
+            ret = ApplyKVAppend(cmd, index);
+            break;
         default:
             RANGE_LOG_ERROR("Apply cmd type error %s", CmdType_Name(cmd.cmd_type()).c_str());
             return Status(Status::kNotSupported, "cmd type not supported", "");
     }
+
+    // 非lock命令可能覆盖或删除锁的key
+    if (lock_index_.Loaded()) {
+        syncLockIndex(cmd);
+    }
+    return ret;
 }
 
 Status Range::Apply(const std::string &cmd, uint64_t index) {
@@ -222,23 +313,48 @@ Status Range::Apply(const std::string &cmd, uint64_t index) {
         return Status(Status::kInvalid, "range is invalid", "");
     }
 
-    auto start = std::chrono::system_clock::now();
+    std::lock_guard<std::mutex> lock(merge_mu_);
+    if (merge_pending_ == 0) {
+        auto s = applyEntry(cmd, index);
+        if (!s.ok() || merge_pending_ == 0) {
+            return s;
+        }
+    }
+    // 合并日志需等待本地source冻结，连同之后的日志暂缓应用（见ResumeMerge）
+    merge_pending_cmds_.emplace_back(index, cmd);
+    return Status::OK();
+}
 
-    raft_cmdpb::Command raft_cmd;
-    common::GetMessage(cmd.data(), cmd.size(), &raft_cmd);
+Status Range::applyEntry(const std::string &cmd, uint64_t index) {
+    auto start = std::chrono::system_clock::now();
 
+    std::string cmd_desc;
     Status ret;
-    if (raft_cmd.cmd_type() == raft_cmdpb::CmdType::AdminSplit) {
-        ret = ApplySplit(raft_cmd, index);
+    if (raft::IsBatchCommand(cmd)) {
+        // 多条命令合并的日志，依次应用后统一更新apply index
+        // 中途失败或重启时已应用的命令随整条日志重新应用，
+        // 只有重复应用结果不变的命令才会被合并（见isBatchable）
+        std::vector<std::string> cmds;
+        if (!raft::DecodeBatchCommand(cmd, &cmds)) {
+            RANGE_LOG_ERROR("decode batch command at index %" PRIu64 " failed", index);
+            return Status(Status::kCorruption, "decode batch command", std::to_string(index));
+        }
+        for (const auto &c : cmds) {
+            ret = ApplyCommand(c, index, nullptr);
+            if (!ret.ok()) {
+                return ret;
+            }
+        }
+        cmd_desc = "batch(" + std::to_string(cmds.size()) + ")";
     } else {
-        auto ret = Apply(raft_cmd, index);
-        // 非IO错误(致命），不给raft返回错误，不然raft会停止自己
-        if (!ret.ok() && ret.code() != Status::kIOError) {
-            ret = Status::OK();
+        ret = ApplyCommand(cmd, index, &cmd_desc);
+        if (!ret.ok()) {
+            return ret;
+        }
+        // 合并日志暂缓应用，由调用者暂存，不更新apply index
+        if (merge_pending_ != 0) {
+            return Status::OK();
         }
-    }
-    if (!ret.ok()) {
-        return ret;
     }
 
     apply_index_ = index;
@@ -253,19 +369,49 @@ Status Range::Apply(const std::string &cmd, uint64_t index) {
         std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
     if (elapsed_usec > kTimeTakeWarnThresoldUSec) {
         RANGE_LOG_WARN("apply takes too long(%ld ms), type: %s.", elapsed_usec / 1000,
-                  raft_cmdpb::CmdType_Name(raft_cmd.cmd_type()).c_str());
+                  cmd_desc.c_str());
     }
 
     return Status::OK();
 }
 
+Status Range::ApplyCommand(const std::string &cmd, uint64_t index, std::string *cmd_desc) {
+    raft_cmdpb::Command raft_cmd;
+    common::GetMessage(cmd.data(), cmd.size(), &raft_cmd);
+    if (cmd_desc != nullptr) {
+        *cmd_desc = raft_cmdpb::CmdType_Name(raft_cmd.cmd_type());
+    }
+
+    Status ret;
+    if (raft_cmd.cmd_type() == raft_cmdpb::CmdType::AdminMerge) {
+        ret = ApplyMerge(raft_cmd, index);
+    } else if (merged_into_ != 0) {
+        // 已冻结等待被合并，数据归属合并方，丢弃冻结后提交的命令
+        RANGE_LOG_WARN("range is merged into %" PRIu64 ", skip cmd %s at index %" PRIu64,
+                merged_into_.load(), raft_cmdpb::CmdType_Name(raft_cmd.cmd_type()).c_str(), index);
+        ReplyMerged(raft_cmd);
+    } else if (raft_cmd.cmd_type() == raft_cmdpb::CmdType::AdminSplit) {
+        ret = ApplySplit(raft_cmd, index);
+    } else {
+        ret = Apply(raft_cmd, index);
+        // 非IO错误(致命），不给raft返回错误，不然raft会停止自己
+        if (!ret.ok() && ret.code() != Status::kIOError) {
+            ret = Status::OK();
+        }
+    }
+    return ret;
+}
+
 Status Range::Submit(const raft_cmdpb::Command &cmd) {
+    if (merged_into_ != 0) {
+        return Status(Status::kNotLeader, "range is merged", std::to_string(merged_into_));
+    }
     if (is_leader_) {
         std::string str_cmd = std::move(cmd.SerializeAsString());
         if (str_cmd.empty()) {
             return Status(Status::kCorruption, "protobuf serialize failed", "");
         }
-        return raft_->Submit(str_cmd);
+        return raft_->Submit(str_cmd, isBatchable(cmd.cmd_type()));
         // return Apply(cmd,0);
     } else {
         return Status(Status::kNotLeader, "Not Leader", "");
@@ -280,6 +426,8 @@ Status Range::SubmitCmd(common::ProtoMessage *msg, const kvrpcpb::RequestHeader&
     // set verify epoch
     auto epoch = new metapb::RangeEpoch(header.range_epoch());
     cmd.set_allocated_verify_epoch(epoch);
+    // TTL表的到期时间在leader上计算，apply时各副本使用同一个值
+    cmd.set_expire_at(store_->TtlExpireAt());
 
     // add to queue
     auto seq = submit_queue_.Add(header, cmd.cmd_type(), msg);
@@ -297,6 +445,8 @@ Status Range::SubmitCmd(common::ProtoMessage *msg, const kvrpcpb::RequestHeader&
 void Range::OnLeaderChange(uint64_t leader, uint64_t term) {
     RANGE_LOG_INFO("Leader Change to Node %" PRIu64, leader);
 
+    meta_.SetLeaderTerm(leader, term);
+
     if (!valid_) {
         RANGE_LOG_ERROR("is invalid!");
         return;
@@ -305,6 +455,7 @@ void Range::OnLeaderChange(uint64_t leader, uint64_t term) {
     if (leader == node_id_) {
         if (!is_leader_) {  // check leader to leader
             is_leader_ = true;
+            last_hb_hash_ = 0;
 
             store_->ResetMetric();
 
@@ -315,6 +466,10 @@ void Range::OnLeaderChange(uint64_t leader, uint64_t term) {
     } else {
         if (is_leader_) {
             is_leader_ = false;
+            store_->ClearCursors();
+            store_->ClearSnapshots();
+            store_->GetLoadSampler()->Stop();
+            lock_index_.Reset();
             context_->Statistics()->DecrLeaderCount();
         }
     }
@@ -323,8 +478,9 @@ void Range::OnLeaderChange(uint64_t leader, uint64_t term) {
 std::shared_ptr<raft::Snapshot> Range::GetSnapshot() {
     raft_cmdpb::SnapshotContext ctx;
     meta_.Get(ctx.mutable_meta());
+    ctx.set_value_format(store_->TtlHeader() ? raft_cmdpb::SVF_TtlHeader : raft_cmdpb::SVF_Raw);
     return std::shared_ptr<raft::Snapshot>(
-        new Snapshot(apply_index_, std::move(ctx), store_->NewIterator()));
+        new Snapshot(apply_index_, std::move(ctx), store_->NewRawIterator()));
 }
 
 Status Range::ApplySnapshotStart(const std::string &context) {
@@ -335,16 +491,40 @@ Status Range::ApplySnapshotStart(const std::string &context) {
         return Status(Status::kInvalid, "range is invalid", "");
     }
 
+    lock_index_.Reset();
+    snap_loader_.reset();
+    {
+        // 快照已包含合并后的数据，不再等待本地source
+        std::lock_guard<std::mutex> lock(merge_mu_);
+        merge_pending_ = 0;
+        merge_pending_cmds_.clear();
+    }
     auto s = store_->Truncate();
     if (!s.ok()) {
         return s;
     }
+    if (ds_config.rocksdb_config.ingest_snapshot) {
+        snap_loader_.reset(new storage::BulkLoader(store_.get(), storage::BulkLoader::DefaultDir(),
+                                                   ds_config.rocksdb_config.target_file_size_base));
+    }
 
     raft_cmdpb::SnapshotContext ctx;
     if (!ctx.ParseFromString(context)) {
         return Status(Status::kCorruption, "parse snapshot context", "pb return false");
     }
 
+    // 与leader的table_ttl配置不一致时，把快照中的值转换为本地的格式
+    snap_ttl_header_ = store_->TtlHeader();
+    if (ctx.value_format() != raft_cmdpb::SVF_Unknown) {
+        snap_ttl_header_ = (ctx.value_format() == raft_cmdpb::SVF_TtlHeader);
+    }
+    if (snap_ttl_header_ != store_->TtlHeader()) {
+        RANGE_LOG_WARN("snapshot value format %s mismatch, "
+                       "check rocksdb.table_ttl of table %" PRIu64,
+                       raft_cmdpb::SnapshotValueFormat_Name(ctx.value_format()).c_str(),
+                       ctx.meta().table_id());
+    }
+
     meta_.Set(ctx.meta());
     s = SaveMeta(ctx.meta()) ;
     if (!s.ok()) {
@@ -363,7 +543,25 @@ Status Range::ApplySnapshotData(const std::vector<std::string> &datas) {
         return Status(Status::kInvalid, "range is invalid", "");
     }
 
-    return store_->ApplySnapshot(datas);
+    if (snap_loader_ == nullptr) {
+        return store_->ApplySnapshot(datas, snap_ttl_header_);
+    }
+
+    // 快照数据按key有序，写入sst文件，结束时一次导入
+    for (const auto &data : datas) {
+        raft_cmdpb::SnapshotKVPair p;
+        if (!p.ParseFromString(data)) {
+            return Status(Status::kCorruption, "apply snapshot data", "deserilize return false");
+        }
+        if (!store_->ConvertSnapshotValue(snap_ttl_header_, p.mutable_value())) {
+            continue;
+        }
+        auto s = snap_loader_->AddRaw(p.key(), p.value());
+        if (!s.ok()) {
+            return s;
+        }
+    }
+    return Status::OK();
 }
 
 Status Range::ApplySnapshotFinish(uint64_t index) {
@@ -374,6 +572,17 @@ Status Range::ApplySnapshotFinish(uint64_t index) {
         return Status(Status::kInvalid, "range is invalid", "");
     }
 
+    if (snap_loader_ != nullptr) {
+        std::unique_ptr<storage::BulkLoader> loader(std::move(snap_loader_));
+        auto s = loader->Ingest();
+        if (!s.ok()) {
+            RANGE_LOG_ERROR("ingest snapshot failed(%s)!", s.ToString().c_str());
+            return s;
+        }
+        RANGE_LOG_INFO("ingest snapshot %" PRIu64 " keys, %" PRIu64 " bytes",
+                       loader->Count(), loader->Bytes());
+    }
+
     apply_index_ = index;
     auto s = context_->MetaStore()->SaveApplyIndex(id_, index);
     if (!s.ok()) {
@@ -388,8 +597,10 @@ Status Range::SaveMeta(const metapb::Range &meta) {
     return context_->MetaStore()->AddRange(meta);
 }
 
-Status Range::Destroy() {
+Status Range::Destroy(bool truncate) {
     valid_ = false;
+    lock_index_.Reset();
+    snap_loader_.reset();
 
     ClearExpiredContext();
 
@@ -400,14 +611,28 @@ Status Range::Destroy() {
     }
     raft_.reset();
 
-    s = store_->Truncate();
-    if (!s.ok()) {
-        RANGE_LOG_ERROR("truncate store fail: %s", s.ToString().c_str());
-        return s;
+    if (truncate) {
+        s = store_->Truncate();
+        if (!s.ok()) {
+            RANGE_LOG_ERROR("truncate store fail: %s", s.ToString().c_str());
+            return s;
+        }
     }
     s = context_->MetaStore()->DeleteApplyIndex(id_);
     if (!s.ok()) {
         RANGE_LOG_ERROR("truncate delete apply fail: %s", s.ToString().c_str());
+        return s;
+    }
+    s = store_->DeleteApplyIndex();
+    if (!s.ok()) {
+        RANGE_LOG_ERROR("delete data apply index fail: %s", s.ToString().c_str());
+        return s;
+    }
+    if (merged_into_ != 0) {
+        s = context_->MetaStore()->DeleteMergeState(id_);
+        if (!s.ok()) {
+            RANGE_LOG_ERROR("delete merge state fail: %s", s.ToString().c_str());
+        }
     }
     return s;
 }
@@ -439,7 +664,7 @@ void Range::GetReplica(metapb::Replica *rep) {
 
 bool Range::VerifyLeader(errorpb::Error *&err) {
     uint64_t leader, term;
-    raft_->GetLeaderTerm(&leader, &term);
+    meta_.GetLeaderTerm(&leader, &term);
 
     // we are leader
     if (leader == node_id_) return true;
@@ -466,16 +691,14 @@ bool Range::CheckWriteable() {
 }
 
 bool Range::KeyInRange(const std::string &key) {
-    if (key < start_key_) {
+    auto ret = meta_.CompareKey(key);
+    if (ret < 0) {
         RANGE_LOG_WARN("key: %s less than start_key:%s, out of range",
                   EncodeToHex(key).c_str(), EncodeToHex(start_key_).c_str());
         return false;
-    }
-
-    auto end_key = meta_.GetEndKey();
-    if (key >= end_key) {
+    } else if (ret > 0) {
         RANGE_LOG_WARN("key: %s greater than end_key:%s, out of range",
-                  EncodeToHex(key).c_str(), EncodeToHex(end_key).c_str());
+                  EncodeToHex(key).c_str(), EncodeToHex(meta_.GetEndKey()).c_str());
         return false;
     }
 
@@ -555,6 +778,16 @@ errorpb::Error *Range::RaftFailError() {
     return err;
 }
 
+errorpb::Error *Range::SubmitFailError(const Status &s) {
+    if (s.code() != Status::kBusy) {
+        return RaftFailError();
+    }
+    errorpb::Error *err = new errorpb::Error;
+    err->set_message("server is busy");
+    err->mutable_server_is_busy()->set_reason(s.ToString());
+    return err;
+}
+
 errorpb::Error *Range::StaleEpochError(const metapb::RangeEpoch &epoch) {
     errorpb::Error *err = new errorpb::Error;
     std::string msg = "stale epoch, req version:";
@@ -572,6 +805,12 @@ errorpb::Error *Range::StaleEpochError(const metapb::RangeEpoch &epoch) {
             auto split_meta = split_range->options();
             stale_epoch->set_allocated_new_range(new metapb::Range(std::move(split_meta)));
         }
+    } else if (merged_into_ != 0) {
+        auto target = context_->FindRange(merged_into_);
+        if (target) {
+            auto target_meta = target->options();
+            stale_epoch->set_allocated_new_range(new metapb::Range(std::move(target_meta)));
+        }
     }
 
     return err;
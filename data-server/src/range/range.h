@@ -2,6 +2,8 @@ _Pragma("once");
 
 #include <stdint.h>
 #include <atomic>
+#include <deque>
+#include <mutex>
 #include <string>
 
 #include "frame/sf_logger.h"
@@ -12,6 +14,7 @@ _Pragma("once");
 
 #include "common/socket_session.h"
 
+#include "storage/bulk_loader.h"
 #include "storage/store.h"
 
 #include "raft/raft.h"
@@ -22,6 +25,7 @@ _Pragma("once");
 #include "proto/gen/kvrpcpb.pb.h"
 #include "proto/gen/mspb.pb.h"
 
+#include "lock_index.h"
 #include "meta_keeper.h"
 #include "context.h"
 #include "submit.h"
@@ -88,6 +92,8 @@ public:
     void KVDelete(common::ProtoMessage *msg, kvrpcpb::DsKvDeleteRequest &req);
     void KVBatchDelete(common::ProtoMessage *msg, kvrpcpb::DsKvBatchDeleteRequest &req);
     void KVRangeDelete(common::ProtoMessage *msg, kvrpcpb::DsKvRangeDeleteRequest &req);
+    void KVIncr(common::ProtoMessage *msg, kvrpcpb::DsKvIncrRequest &req);
+    void KVAppend(common::ProtoMessage *msg, kvrpcpb::DsKvAppendRequest &req);
     void KVScan(common::ProtoMessage *msg, kvrpcpb::DsKvScanRequest &req);
 
 public:
@@ -117,6 +123,8 @@ private:
                      const std::function<void(raft_cmdpb::Command &cmd)> &init);
 
     Status Apply(const raft_cmdpb::Command &cmd, uint64_t index);
+    // 解析并应用单条命令，cmd_desc返回命令类型
+    Status ApplyCommand(const std::string &cmd, uint64_t index, std::string *cmd_desc);
 
     Status ApplyRawPut(const raft_cmdpb::Command &cmd);
     Status ApplyRawDelete(const raft_cmdpb::Command &cmd);
@@ -135,17 +143,46 @@ private:
     Status ApplyKVDelete(const raft_cmdpb::Command &cmd);
     Status ApplyKVBatchDelete(const raft_cmdpb::Command &cmd);
     Status ApplyKVRangeDelete(const raft_cmdpb::Command &cmd);
+    // 与写入原子地保存apply index，重启后不会重复应用
+    Status ApplyKVIncr(const raft_cmdpb::Command &cmd, uint64_t index);
+    Status ApplyKVAppend(const raft_cmdpb::Command &cmd, uint64_t index);
 
     Status ApplyLock(const raft_cmdpb::Command &cmd);
     Status ApplyLockUpdate(const raft_cmdpb::Command &cmd);
     Status ApplyUnlock(const raft_cmdpb::Command &cmd);
     Status ApplyUnlockForce(const raft_cmdpb::Command &cmd);
+    Status ApplyLockReap(const raft_cmdpb::Command &cmd);
+
+    // 读取锁（不检查过期），leader上优先从内存索引读取
+    bool LockRead(const std::string &key, kvrpcpb::LockValue *value);
+    // 通过raft清理内存索引中已过期的锁
+    void ReapExpiredLocks();
+    // 非lock命令应用后同步锁索引：重新读取涉及的key，
+    // 按范围删除时只在范围内有锁时重置索引
+    void syncLockIndex(const raft_cmdpb::Command &cmd);
 
     // split func
     void CheckSplit(uint64_t size);
+    // 按负载分裂，stat为本次心跳周期的读写统计
+    void CheckLoadSplit(const storage::MetricStat &stat);
     void AskSplit(std::string &&key, metapb::Range&& meta);
     void ReportSplit(const metapb::Range &new_range);
 
+    // merge func
+    Status ApplyMerge(const raft_cmdpb::Command &cmd, uint64_t index);
+    // 被合并方冻结，不再接受新的命令
+    Status ApplyMergeFreeze(const raft_cmdpb::MergeRequest &req, uint64_t index);
+    // 合并方吸收被合并方的key范围，本地source未冻结时暂缓应用
+    Status ApplyMergeCommit(const raft_cmdpb::MergeRequest &req);
+    // 冻结日志是否已在所有副本上提交
+    bool MergeFrozenCommitted();
+    void CheckMerge();
+    // 冻结后丢弃的命令，回复stale epoch让客户端刷新路由后重试
+    void ReplyMerged(const raft_cmdpb::Command &cmd);
+
+    // 应用一条日志并保存apply index，调用方须持有merge_mu_
+    Status applyEntry(const std::string &cmd, uint64_t index);
+
     int64_t checkMaxCount(int64_t maxCount) {
         if (maxCount <= 0) maxCount = std::numeric_limits<int64_t>::max();
         if (maxCount > max_count_) {
@@ -187,8 +224,16 @@ public:
 
     void ResetStatisSize();
     void Heartbeat();
+    // 下次心跳发送完整内容
+    void ResetHeartbeat() { last_hb_hash_ = 0; }
+
+    // 合并右侧相邻的source，两者的leader都须在本节点
+    Status Merge(const std::shared_ptr<Range> &source);
+    // 本地source已冻结，按序应用暂缓的日志；失败时保留剩余日志，可再次调用
+    void ResumeMerge(uint64_t source_id);
 
-    Status Destroy();
+    // truncate为false时不删除数据(由调用方整体删除所在的column family)
+    Status Destroy(bool truncate = true);
 
     // get private member
 public:
@@ -201,6 +246,13 @@ public:
     void GetReplica(metapb::Replica *rep);
     uint64_t GetSplitRangeID() const { return split_range_id_; }
     size_t GetSubmitQueueSize() const { return submit_queue_.Size(); }
+    void GetPerfStat(storage::PerfStat *stat) const { store_->GetPerfCounter()->Get(stat); }
+    size_t GetSnapshotCount() const { return store_->SnapshotCount(); }
+    uint64_t ApproximateSize() const { return store_->ApproximateSize(start_key_, meta_.GetEndKey()); }
+    // 已冻结并合并到的range id，未合并时为0
+    uint64_t MergedInto() const { return merged_into_; }
+    // 等待本地冻结的source range id，未等待时为0
+    uint64_t MergePending() const { return merge_pending_; }
 
 private:
     bool VerifyLeader(errorpb::Error *&err);
@@ -216,6 +268,8 @@ private:
     Status SaveMeta(const metapb::Range &meta);
 
     errorpb::Error *RaftFailError();
+    // raft submit失败，繁忙（队列满或复制窗口满）时返回ServerIsBusy
+    errorpb::Error *SubmitFailError(const Status &s);
     errorpb::Error *NoLeaderError();
     errorpb::Error *NotLeaderError(metapb::Peer &&peer);
     errorpb::Error *KeyNotInRange(const std::string &key);
@@ -244,10 +298,26 @@ private:
     std::atomic<bool> statis_flag_ = {false};
     std::atomic<uint64_t> statis_size_ = {0};
     uint64_t split_range_id_ = 0;
+    int64_t load_hot_since_ = 0; // 负载持续超过阈值的开始时间，只在心跳中访问
+    std::atomic<size_t> last_hb_hash_ = {0}; // 上次发送的完整心跳内容的hash，为0时发送完整心跳
+
+    std::atomic<uint64_t> merged_into_ = {0};  // 冻结后合并到的range
+    std::atomic<uint64_t> merge_index_ = {0};  // 冻结日志的index
+    std::atomic<uint64_t> merge_source_ = {0}; // 正在合并的source range
+    int merge_wait_ = 0;
+    // 合并日志已提交但本地source尚未应用冻结时，暂缓应用之后的日志，
+    // 以保证source冻结前的写入先于target合并后的写入；apply index不前进，重启后重新应用
+    std::mutex merge_mu_;
+    std::atomic<uint64_t> merge_pending_ = {0};
+    std::deque<std::pair<uint64_t, std::string>> merge_pending_cmds_;  // (index, cmd)
 
     SubmitQueue submit_queue_;
 
     std::unique_ptr<storage::Store> store_;
+    // 以导入sst方式应用中的快照，须先于store_析构
+    std::unique_ptr<storage::BulkLoader> snap_loader_;
+    bool snap_ttl_header_ = false;  // 正在apply的快照中的值是否带有TTL值头
+    LockIndex lock_index_;
     std::shared_ptr<raft::Raft> raft_;
 
     int64_t max_count_ = 1000;
@@ -106,7 +106,7 @@ Status Range::ApplyRawPut(const raft_cmdpb::Command &cmd) {
             break;
         }
 
-        ret = store_->Put(req.key(), req.value());
+        ret = store_->Put(req.key(), req.value(), cmd.expire_at());
         context_->Statistics()->PushTime(HistogramType::kStore,
                                        get_micro_second() - btime);
 
@@ -42,6 +42,7 @@ void Range::Select(common::ProtoMessage *msg, kvrpcpb::DsSelectRequest &req) {
 
     auto btime = get_micro_second();
     context_->Statistics()->PushTime(HistogramType::kQWait, btime - msg->begin_time);
+    storage::PerfScope perf(msg->header.func_id, store_->GetPerfCounter());
 
     auto ds_resp = new kvrpcpb::DsSelectResponse;
     auto header = ds_resp->mutable_header();
@@ -5,6 +5,7 @@
 #include "server/range_server.h"
 #include "server/server.h"
 #include "base/util.h"
+#include "common/ds_config.h"
 
 #include "stats.h"
 #include "range_logger.h"
@@ -28,6 +29,46 @@ void Range::CheckSplit(uint64_t size) {
     }
 }
 
+void Range::CheckLoadSplit(const storage::MetricStat &stat) {
+    auto policy = context_->GetSplitPolicy();
+    auto sampler = store_->GetLoadSampler();
+    auto threshold = policy->LoadSplitQPS();
+    auto qps = stat.keys_read_per_sec + stat.keys_write_per_sec;
+    // 保持key第一部分的分裂方式暂不支持按负载分裂
+    if (!policy->Enabled() || threshold == 0 ||
+        policy->GetSplitKeyType() != SplitKeyType::kNormal || qps < threshold) {
+        load_hot_since_ = 0;
+        sampler->Stop();
+        return;
+    }
+
+    auto now = getticks();
+    if (load_hot_since_ == 0 || !sampler->Running()) {
+        load_hot_since_ = now;
+        sampler->Start();
+        return;
+    }
+    if (now - load_hot_since_ < static_cast<int64_t>(policy->LoadSplitDuration() * 1000)) {
+        return;
+    }
+
+    auto split_key = sampler->SplitKey();
+    auto count = sampler->Count();
+    // 无论是否分裂都重新开始统计
+    load_hot_since_ = 0;
+    sampler->Stop();
+
+    if (split_key.empty() || split_key <= start_key_ || !KeyInRange(split_key)) {
+        RANGE_LOG_INFO("load split: no balanced split key, qps: %" PRIu64 ", sampled: %" PRIu64,
+                qps, count);
+        return;
+    }
+
+    RANGE_LOG_INFO("load split: qps: %" PRIu64 ", sampled: %" PRIu64 ", split key: %s",
+            qps, count, EncodeToHex(split_key).c_str());
+    AskSplit(std::move(split_key), meta_.Get());
+}
+
 void Range::ResetStatisSize() {
     // split size is split size, not half of split size
     // amicable sequence writing and random writing
@@ -37,10 +78,12 @@ void Range::ResetStatisSize() {
 
     std::string split_key;
     auto type = context_->GetSplitPolicy()->GetSplitKeyType();
-    if (type == SplitKeyType::kNormal) {
-        real_size_ = store_->StatisSize(split_key, context_->GetSplitPolicy()->SplitSize());
+    auto decode = type != SplitKeyType::kNormal;
+    // blob db的value不在sst中，估算不准确，仍然全量统计
+    if (ds_config.range_config.approximate_statis && ds_config.rocksdb_config.storage_type == 0) {
+        real_size_ = store_->ApproximateStatisSize(split_key, context_->GetSplitPolicy()->SplitSize(), decode);
     } else {
-        real_size_ = store_->StatisSize(split_key, context_->GetSplitPolicy()->SplitSize(), true);
+        real_size_ = store_->StatisSize(split_key, context_->GetSplitPolicy()->SplitSize(), decode);
     }
 
     RANGE_LOG_DEBUG("policy: %s/%s, real size: %" PRIu64,
@@ -57,6 +100,10 @@ void Range::ResetStatisSize() {
     statis_size_ = 0;
     // when real size >= max size, we need split with split size
     if (real_size_ >= context_->GetSplitPolicy()->MaxSize()) {
+        if (split_key.empty()) {
+            RANGE_LOG_WARN("ResetStatisSize no split key found, real size: %" PRIu64, real_size_);
+            return;
+        }
         return AskSplit(std::move(split_key), std::move(meta));
     }
 }
@@ -191,6 +238,9 @@ Status Range::ApplySplit(const raft_cmdpb::Command &cmd, uint64_t index) {
 
     meta_.Split(req.split_key(), req.epoch().version());
     store_->SetEndKey(req.split_key());
+    // 分出去的锁不再属于本range，重新加载
+    lock_index_.Reset();
+    store_->GetLoadSampler()->Stop();
 
     if (req.leader() == node_id_) {
         ReportSplit(req.new_range());
@@ -28,6 +28,11 @@ public:
     virtual uint64_t MaxSize() const = 0;
 
     virtual SplitKeyType GetSplitKeyType() = 0;
+
+    // 按负载分裂：range每秒读写key数持续LoadSplitDuration秒超过LoadSplitQPS时，
+    // 按访问key采样选出左右负载均衡的分裂点，为0表示关闭
+    virtual uint64_t LoadSplitQPS() const { return 0; }
+    virtual uint64_t LoadSplitDuration() const { return 0; }
 };
 
 std::unique_ptr<SplitPolicy> NewDisableSplitPolicy();
@@ -21,10 +21,7 @@ SubmitContext::~SubmitContext() {
     delete msg_;
 }
 
-void SubmitContext::SendTimeout(common::SocketSession* session) {
-    auto err = new errorpb::Error;
-    err->set_message("request timeout");
-    err->mutable_timeout();
+void SubmitContext::SendError(common::SocketSession* session, errorpb::Error *err) {
     switch (type_) {
         case raft_cmdpb::CmdType::RawPut:
             Reply(session, new kvrpcpb::DsKvRawPutResponse, err);
@@ -38,12 +35,52 @@ void SubmitContext::SendTimeout(common::SocketSession* session) {
         case raft_cmdpb::CmdType::Delete:
             Reply(session, new kvrpcpb::DsDeleteResponse, err);
             break;
+        case raft_cmdpb::CmdType::KvSet:
+            Reply(session, new kvrpcpb::DsKvSetResponse, err);
+            break;
+        case raft_cmdpb::CmdType::KvBatchSet:
+            Reply(session, new kvrpcpb::DsKvBatchSetResponse, err);
+            break;
+        case raft_cmdpb::CmdType::KvDelete:
+            Reply(session, new kvrpcpb::DsKvDeleteResponse, err);
+            break;
+        case raft_cmdpb::CmdType::KvBatchDel:
+            Reply(session, new kvrpcpb::DsKvBatchDeleteResponse, err);
+            break;
+        case raft_cmdpb::CmdType::KvRangeDel:
+            Reply(session, new kvrpcpb::DsKvRangeDeleteResponse, err);
+            break;
+        case raft_cmdpb::CmdType::KvIncr:
+            Reply(session, new kvrpcpb::DsKvIncrResponse, err);
+            break;
+        case raft_cmdpb::CmdType::KvAppend:
+            Reply(session, new kvrpcpb::DsKvAppendResponse, err);
+            break;
+        case raft_cmdpb::CmdType::Lock:
+            Reply(session, new kvrpcpb::DsLockResponse, err);
+            break;
+        case raft_cmdpb::CmdType::LockUpdate:
+            Reply(session, new kvrpcpb::DsLockUpdateResponse, err);
+            break;
+        case raft_cmdpb::CmdType::Unlock:
+            Reply(session, new kvrpcpb::DsUnlockResponse, err);
+            break;
+        case raft_cmdpb::CmdType::UnlockForce:
+            Reply(session, new kvrpcpb::DsUnlockForceResponse, err);
+            break;
         default:
-            FLOG_ERROR("SubmitContext::SendTimeout: unknown cmd type: %d", static_cast<int>(type_));
+            FLOG_ERROR("SubmitContext::SendError: unknown cmd type: %d", static_cast<int>(type_));
             delete err;
     }
 }
 
+void SubmitContext::SendTimeout(common::SocketSession* session) {
+    auto err = new errorpb::Error;
+    err->set_message("request timeout");
+    err->mutable_timeout();
+    SendError(session, err);
+}
+
 void SubmitContext::CheckExecuteTime(uint64_t rangeID, int64_t thresold_usecs) {
     auto take = get_micro_second() - msg_->begin_time;
     if (take > thresold_usecs) {
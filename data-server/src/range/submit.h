@@ -44,6 +44,8 @@ public:
         msg_ = nullptr;
     }
 
+    // 按命令类型回复错误，命令未被应用(超时、range已冻结等)时使用
+    void SendError(common::SocketSession* session, errorpb::Error *err);
     void SendTimeout(common::SocketSession* session);
 
     void CheckExecuteTime(uint64_t rangeID, int64_t thresold_usecs);
@@ -38,6 +38,8 @@ struct ContextServer {
     rocksdb::DB *rocks_db = nullptr;
     std::shared_ptr<rocksdb::Cache> block_cache;  // rocksdb block cache
     std::shared_ptr<rocksdb::Cache> row_cache; // rocksdb row cache
+    std::shared_ptr<rocksdb::Cache> block_cache_compressed; // rocksdb compressed block cache
+    std::shared_ptr<rocksdb::Cache> high_pri_block_cache; // block cache of high priority tables
     std::shared_ptr<rocksdb::Statistics> db_stats; // rocksdb stats
     storage::MetaStore *meta_store = nullptr;
 
@@ -31,6 +31,14 @@ public:
         return ds_config.range_config.access_mode == 0 ?
             range::SplitKeyType::kNormal : range::SplitKeyType::kKeepFirstPart;
     }
+
+    uint64_t LoadSplitQPS() const override {
+        return ds_config.range_config.load_split_qps;
+    }
+
+    uint64_t LoadSplitDuration() const override {
+        return ds_config.range_config.load_split_duration;
+    }
 };
 
 RangeContextImpl::RangeContextImpl(ContextServer *s) :
@@ -42,6 +50,10 @@ uint64_t RangeContextImpl::GetFSUsagePercent() const {
     return server_->run_status->GetFilesystemUsedPercent();
 }
 
+std::shared_ptr<rocksdb::ColumnFamilyHandle> RangeContextImpl::TableColumnFamily(uint64_t table_id) {
+    return server_->range_server->GetTableColumnFamily(table_id);
+}
+
 void RangeContextImpl::ScheduleHeartbeat(uint64_t range_id, bool delay) {
     auto expire = delay ? ds_config.hb_config.range_interval * 1000 + getticks() :
             getticks();
@@ -62,6 +74,11 @@ Status RangeContextImpl::SplitRange(uint64_t range_id, const raft_cmdpb::SplitRe
     return server_->range_server->SplitRange(range_id, req, raft_index);
 }
 
+// merge
+void RangeContextImpl::RetireMergedRange(uint64_t source_id) {
+    server_->range_server->RetireMergedRange(source_id);
+}
+
 }  // namespace server
 }  // namespace dataserver
 }  // namespace sharkstore
@@ -17,6 +17,7 @@ public:
     range::SplitPolicy* GetSplitPolicy() override { return split_policy_.get(); }
 
     rocksdb::DB *DBInstance() override { return server_->rocks_db; }
+    std::shared_ptr<rocksdb::ColumnFamilyHandle> TableColumnFamily(uint64_t table_id) override;
     master::Worker* MasterClient() override  { return server_->master_worker; }
     raft::RaftServer* RaftServer() override { return server_->raft_server; }
     storage::MetaStore* MetaStore() override { return server_->meta_store; }
@@ -35,6 +36,9 @@ public:
     Status SplitRange(uint64_t range_id, const raft_cmdpb::SplitRequest &req,
             uint64_t raft_index) override;
 
+    // merge
+    void RetireMergedRange(uint64_t source_id) override;
+
 private:
     ContextServer* server_ = nullptr;
     std::unique_ptr<range::SplitPolicy> split_policy_;
@@ -1,12 +1,16 @@
 #include "range_server.h"
 
+#include <algorithm>
 #include <chrono>
+#include <cinttypes>
 #include <future>
 #include <thread>
 
 #include <google/protobuf/io/zero_copy_stream_impl_lite.h>
 #include <rocksdb/advanced_options.h>
 #include <rocksdb/cache.h>
+#include <rocksdb/filter_policy.h>
+#include <rocksdb/slice_transform.h>
 #include <rocksdb/table.h>
 #include <rocksdb/utilities/db_ttl.h>
 #include <rocksdb/utilities/blob_db/blob_db.h>
@@ -21,7 +25,11 @@
 #include "proto/gen/funcpb.pb.h"
 #include "proto/gen/metapb.pb.h"
 #include "proto/gen/schpb.pb.h"
+#include "storage/bulk_loader.h"
+#include "storage/merge_operator.h"
 #include "storage/metric.h"
+#include "storage/perf_stats.h"
+#include "storage/ttl.h"
 #include "run_status.h"
 
 #include "server.h"
@@ -33,6 +41,8 @@ namespace server {
 
 static const std::string kMetaPathSuffix = "meta";
 static const std::string kDataPathSuffix = "data";
+// 关闭db时等待range释放column family handle的最长时间
+static const int kReleaseCFWaitMs = 3000;
 
 int RangeServer::Init(ContextServer *context) {
     FLOG_INFO("RangeServer Init begin ...");
@@ -76,6 +86,12 @@ int RangeServer::Init(ContextServer *context) {
         FLOG_ERROR("load range metas failed(%s)", ret.ToString().c_str());
         return -1;
     }
+    // TTL表的值头是必需的，不能在已有数据的表上开启TTL
+    ret = storage::CheckTableTtl(meta_store_, range_metas);
+    if (!ret.ok()) {
+        FLOG_ERROR("check rocksdb table_ttl failed(%s)", ret.ToString().c_str());
+        return -1;
+    }
     if (recover(range_metas) != 0) {
         FLOG_ERROR("load local range meta failed");
         return -1;
@@ -147,13 +163,17 @@ void RangeServer::Stop() {
         range_heartbeat_.join();
     }
 
-    CloseDB();
-
     auto it = ranges_.begin();
     while (it != ranges_.end()) {
         it->second->Shutdown();
         it = ranges_.erase(it);
     }
+    publishRoutes();
+    // 旧的路由仍持有range，回收后range才释放
+    routes_.Flush();
+
+    // range持有column family handle，需要在关闭db之前释放
+    CloseDB();
 
     if (meta_store_ != nullptr) {
         delete meta_store_;
@@ -180,16 +200,47 @@ void RangeServer::buildDBOptions(rocksdb::Options& ops) {
     // table options include block_size, block_cache_size, etc
     rocksdb::BlockBasedTableOptions table_options;
     table_options.block_size = ds_config.rocksdb_config.block_size;
-    context_->block_cache =
-            rocksdb::NewLRUCache(ds_config.rocksdb_config.block_cache_size);
+    context_->block_cache = rocksdb::NewLRUCache(ds_config.rocksdb_config.block_cache_size, -1,
+            false, ds_config.rocksdb_config.block_cache_high_pri_ratio);
     if (ds_config.rocksdb_config.block_cache_size > 0) {
         table_options.block_cache = context_->block_cache;
     }
     if (ds_config.rocksdb_config.cache_index_and_filter_blocks){
         table_options.cache_index_and_filter_blocks = true;
+        // index、filter放在高优先级池中，不会被大量的数据块挤出
+        if (ds_config.rocksdb_config.block_cache_high_pri_ratio > 0) {
+            table_options.cache_index_and_filter_blocks_with_high_priority = true;
+        }
+    }
+    if (ds_config.rocksdb_config.block_cache_compressed_size > 0) {
+        context_->block_cache_compressed =
+                rocksdb::NewLRUCache(ds_config.rocksdb_config.block_cache_compressed_size);
+        table_options.block_cache_compressed = context_->block_cache_compressed;
+    }
+    if (ds_config.rocksdb_config.bloom_bits_per_key > 0) {
+        table_options.filter_policy.reset(
+                rocksdb::NewBloomFilterPolicy(ds_config.rocksdb_config.bloom_bits_per_key, false));
     }
     ops.table_factory.reset(rocksdb::NewBlockBasedTableFactory(table_options));
 
+    // 高优先级表的column family使用独立的block cache，其他参数相同
+    if (storage::HasHighPriTables()) {
+        context_->high_pri_block_cache = rocksdb::NewLRUCache(
+                ds_config.rocksdb_config.high_pri_block_cache_size, -1, false,
+                ds_config.rocksdb_config.block_cache_high_pri_ratio);
+        auto high_pri_options = table_options;
+        high_pri_options.block_cache = context_->high_pri_block_cache;
+        high_pri_table_factory_.reset(rocksdb::NewBlockBasedTableFactory(high_pri_options));
+    }
+
+    // prefix bloom: 按表前缀(以及可选的主键前缀)过滤, 同时作用于memtable和sst
+    if (ds_config.rocksdb_config.prefix_extractor_len > 0) {
+        ops.prefix_extractor.reset(rocksdb::NewCappedPrefixTransform(
+                static_cast<size_t>(ds_config.rocksdb_config.prefix_extractor_len)));
+        ops.memtable_prefix_bloom_size_ratio =
+                ds_config.rocksdb_config.memtable_prefix_bloom_size_ratio;
+    }
+
     // row_cache
     if (ds_config.rocksdb_config.row_cache_size > 0){
         context_->row_cache =
@@ -197,6 +248,15 @@ void RangeServer::buildDBOptions(rocksdb::Options& ops) {
         ops.row_cache = context_->row_cache;
     }
 
+    // kv原子计数/追加
+    ops.merge_operator = storage::NewKvMergeOperator();
+
+    // 按表的TTL，过期的值在compaction时删除
+    if (storage::HasTableTtl()) {
+        static storage::TtlCompactionFilter ttl_filter;
+        ops.compaction_filter = &ttl_filter;
+    }
+
     ops.max_open_files = ds_config.rocksdb_config.max_open_files;
     ops.create_if_missing = true;
     ops.use_fsync = true;
@@ -263,12 +323,83 @@ int RangeServer::OpenDB() {
         return -1;
     }
 
+    auto s = storage::InitTableTtl(ds_config.rocksdb_config.table_ttl);
+    if (!s.ok()) {
+        FLOG_ERROR("invalid rocksdb table_ttl: %s", s.ToString().c_str());
+        return -1;
+    }
+    s = storage::InitLowPriTables(ds_config.rocksdb_config.low_pri_tables);
+    if (!s.ok()) {
+        FLOG_ERROR("invalid rocksdb low_pri_tables: %s", s.ToString().c_str());
+        return -1;
+    }
+    s = storage::InitHighPriTables(ds_config.rocksdb_config.high_pri_tables);
+    if (!s.ok()) {
+        FLOG_ERROR("invalid rocksdb high_pri_tables: %s", s.ToString().c_str());
+        return -1;
+    }
+    if (storage::HasHighPriTables() &&
+        (ds_config.rocksdb_config.storage_type != 0 ||
+         ds_config.rocksdb_config.high_pri_block_cache_size == 0)) {
+        FLOG_ERROR("rocksdb high_pri_tables only works with storage_type = 0 and "
+                   "high_pri_block_cache_size > 0");
+        return -1;
+    }
+    if (storage::HasTableTtl() &&
+        (ds_config.rocksdb_config.storage_type != 0 || ds_config.rocksdb_config.ttl != 0)) {
+        FLOG_ERROR("rocksdb table_ttl only works with storage_type = 0 and ttl = 0");
+        return -1;
+    }
+    if (ds_config.rocksdb_config.ingest_snapshot &&
+        (ds_config.rocksdb_config.storage_type != 0 || ds_config.rocksdb_config.ttl != 0)) {
+        FLOG_ERROR("rocksdb ingest_snapshot only works with storage_type = 0 and ttl = 0");
+        return -1;
+    }
+    // 上次退出时未导入的文件
+    storage::BulkLoader::Cleanup(storage::BulkLoader::DefaultDir());
+
     rocksdb::Options ops;
     buildDBOptions(ops);
+    cf_options_ = rocksdb::ColumnFamilyOptions(ops);
+    high_pri_cf_options_ = cf_options_;
+    if (high_pri_table_factory_) {
+        high_pri_cf_options_.table_factory = high_pri_table_factory_;
+    }
+
+    // 加载已有的column family（rocksdb.cf_per_table开启或高优先级表每个表一个）
+    // 按名称中的table id取各表的参数
+    std::vector<std::string> cf_names;
+    auto list_ret = rocksdb::DB::ListColumnFamilies(ops, db_path, &cf_names);
+    if (!list_ret.ok() || cf_names.empty()) {
+        cf_names = {rocksdb::kDefaultColumnFamilyName};
+    }
+    std::vector<rocksdb::ColumnFamilyDescriptor> cf_descs;
+    for (const auto& name : cf_names) {
+        uint64_t table_id = 0;
+        if (storage::TableColumnFamilies::ParseName(name, &table_id)) {
+            cf_descs.emplace_back(name, tableCFOptions(table_id));
+        } else {
+            cf_descs.emplace_back(name, cf_options_);
+        }
+    }
+    std::vector<rocksdb::ColumnFamilyHandle *> cf_handles;
+
+    if (ds_config.rocksdb_config.storage_type != 0) {
+        if (cf_descs.size() > 1) {
+            FLOG_ERROR("rocksdb storage_type(%d) doesn't support table column families, found %lu",
+                       ds_config.rocksdb_config.storage_type, cf_descs.size() - 1);
+            return -1;
+        }
+        if (ds_config.rocksdb_config.cf_per_table) {
+            FLOG_WARN("rocksdb cf_per_table is disabled by storage_type(%d).",
+                      ds_config.rocksdb_config.storage_type);
+            ds_config.rocksdb_config.cf_per_table = false;
+        }
+    }
 
     if (ds_config.rocksdb_config.storage_type == 0){
         if (ds_config.rocksdb_config.ttl == 0) {
-            auto ret = rocksdb::DB::Open(ops, db_path, &db_);
+            auto ret = rocksdb::DB::Open(ops, db_path, cf_descs, &cf_handles, &db_);
             if (!ret.ok()) {
                 FLOG_ERROR("open rocksdb(%s) failed(%s)", db_path.c_str(),
                            ret.ToString().c_str());
@@ -277,8 +408,9 @@ int RangeServer::OpenDB() {
         } else if (ds_config.rocksdb_config.ttl > 0) {
             FLOG_WARN("rocksdb ttl enabled. ttl=%d", ds_config.rocksdb_config.ttl);
             rocksdb::DBWithTTL *ttl_db = nullptr;
-            auto ret =
-                rocksdb::DBWithTTL::Open(ops, db_path, &ttl_db, ds_config.rocksdb_config.ttl);
+            std::vector<int32_t> ttls(cf_descs.size(), ds_config.rocksdb_config.ttl);
+            auto ret = rocksdb::DBWithTTL::Open(ops, db_path, cf_descs, &cf_handles,
+                                                &ttl_db, ttls);
             if (!ret.ok()) {
                 FLOG_ERROR("open rocksdb(%s) failed(%s)", db_path.c_str(),
                            ret.ToString().c_str());
@@ -330,15 +462,50 @@ int RangeServer::OpenDB() {
         FLOG_ERROR("invalid rocksdb storage_type(%d)", ds_config.rocksdb_config.storage_type);
         return -1;
     }
+
+    table_cfs_.Load(db_, cf_handles);
     return 0;
 }
 
+const rocksdb::ColumnFamilyOptions& RangeServer::tableCFOptions(uint64_t table_id) const {
+    return storage::IsHighPriTable(table_id) ? high_pri_cf_options_ : cf_options_;
+}
+
 void RangeServer::CloseDB() {
     if (db_ != nullptr) {
+        // 先销毁column family handle再关闭db，仍被持有的handle等待一段时间后强制销毁
+        auto s = table_cfs_.Release(kReleaseCFWaitMs);
+        if (!s.ok()) {
+            FLOG_WARN("release rocksdb column families: %s", s.ToString().c_str());
+        }
         delete db_;
+        db_ = nullptr;
     }
 }
 
+std::shared_ptr<rocksdb::ColumnFamilyHandle> RangeServer::GetTableColumnFamily(uint64_t table_id) {
+    return table_cfs_.Get(table_id);
+}
+
+std::vector<std::shared_ptr<rocksdb::ColumnFamilyHandle>> RangeServer::GetAllTableColumnFamilies() {
+    return table_cfs_.GetAll();
+}
+
+Status RangeServer::SetTableOptions(uint64_t table_id,
+                                    const std::unordered_map<std::string, std::string>& options) {
+    return table_cfs_.SetOptions(table_id, options);
+}
+
+bool RangeServer::hasTableRange(uint64_t table_id, uint64_t exclude_range_id) const {
+    for (const auto& r : ranges_) {
+        if (r.first != static_cast<int64_t>(exclude_range_id) &&
+            r.second->options().table_id() == table_id) {
+            return true;
+        }
+    }
+    return false;
+}
+
 void RangeServer::Clear() {
     FLOG_WARN("clear range data!");
 
@@ -434,6 +601,12 @@ void RangeServer::DealTask(common::ProtoMessage *msg) {
         case funcpb::kFuncKvRangeDel:
             KVRangeDelete(msg);
             break;
+        case funcpb::kFuncKvIncr:
+            KVIncr(msg);
+            break;
+        case funcpb::kFuncKvAppend:
+            KVAppend(msg);
+            break;
         case funcpb::kFuncKvScan:
             KVScan(msg);
             break;
@@ -519,6 +692,17 @@ Status RangeServer::CreateRange(const metapb::Range &range, uint64_t leader,
         return Status(Status::kDuplicate, "range is exist", "");
     }
 
+    // 表在本节点上的第一个range，按需为其创建独立的column family
+    // 已有range的表保持原来的位置(default或者表的column family)
+    if ((ds_config.rocksdb_config.cf_per_table || storage::IsHighPriTable(range.table_id())) &&
+        GetTableColumnFamily(range.table_id()) == nullptr && !hasTableRange(range.table_id())) {
+        auto s = table_cfs_.Create(range.table_id(), tableCFOptions(range.table_id()),
+                                   ds_config.rocksdb_config.ttl);
+        if (!s.ok()) {
+            return s;
+        }
+    }
+
     auto rng = std::make_shared<range::Range>(range_context_.get(), range);
     // 初始化range
     auto ret = rng->Initialize(leader, log_start_index);
@@ -529,6 +713,7 @@ Status RangeServer::CreateRange(const metapb::Range &range, uint64_t leader,
     }
 
     ranges_[range.id()] = rng;
+    publishRoutes();
 
     FLOG_INFO("create new range[%" PRIu64 "] success.", range.id());
 
@@ -577,12 +762,21 @@ Status RangeServer::DeleteRange(uint64_t range_id, uint64_t peer_id) {
         }
 
         meta_store_->DelRange(range_id);
-        auto s = rng->Destroy();
+
+        // 表在本节点的最后一个range，直接drop整个column family
+        auto meta = rng->options();
+        bool drop_cf = GetTableColumnFamily(meta.table_id()) != nullptr &&
+                       !hasTableRange(meta.table_id(), range_id);
+        auto s = rng->Destroy(!drop_cf);
         if (!s.ok()) {
             FLOG_INFO("delete range[%" PRIu64 "] truncate failed.", range_id);
             return s;
         } else {
             ranges_.erase(it);
+            publishRoutes();
+        }
+        if (drop_cf) {
+            table_cfs_.Drop(meta.table_id(), meta.start_key(), meta.end_key());
         }
     } while (false);
 
@@ -626,6 +820,7 @@ int RangeServer::OfflineRange(uint64_t range_id) {
         // current: Shutdown replaced
         rng->Shutdown();
         ranges_.erase(it);
+        publishRoutes();
 
     } while (false);
 
@@ -651,6 +846,7 @@ int RangeServer::CloseRange(uint64_t range_id) {
         // current: Shutdown replaced
         rng->Shutdown();
         ranges_.erase(it);
+        publishRoutes();
 
     } while (false);
 
@@ -758,34 +954,45 @@ void RangeServer::SetLogLevel(common::ProtoMessage *msg) {
 }
 
 size_t RangeServer::GetRangesSize() const {
-    sharkstore::shared_lock<sharkstore::shared_mutex> lock(rw_lock_);
-    return ranges_.size();
+    return routes_.Size();
 }
 
 std::shared_ptr<range::Range> RangeServer::Find(uint64_t range_id) {
-    sharkstore::shared_lock<sharkstore::shared_mutex> lock(rw_lock_);
+    RouteTable::ReadGuard guard(routes_);
 
-    auto it = ranges_.find(range_id);
-    if (it == ranges_.end()) {
-        for (auto itr = ranges_.begin(); itr != ranges_.end(); itr++) {
-            FLOG_DEBUG("current range cache range_id:%" PRIu64 " ", itr->first);
-        }
+    auto rng = routes_.Get(range_id);
+    if (rng == nullptr) {
         return nullptr;
     }
 
-    if (!it->second->valid()) {
+    if (!rng->valid()) {
         FLOG_WARN("RangeHeartbeat range_id %" PRIu64 " is invalid", range_id);
 
         return nullptr;
     }
 
-    return it->second;
+    return rng->shared_from_this();
+}
+
+std::shared_ptr<range::Range> RangeServer::FindByKey(const std::string &key) {
+    RouteTable::ReadGuard guard(routes_);
+
+    auto rng = routes_.GetByKey(key);
+    if (rng == nullptr || !rng->valid()) {
+        return nullptr;
+    }
+    return rng->shared_from_this();
+}
+
+void RangeServer::publishRoutes() {
+    routes_.Publish(ranges_);
 }
 
 void RangeServer::RawGet(common::ProtoMessage *msg) {
     kvrpcpb::DsKvRawGetRequest req;
     kvrpcpb::DsKvRawGetResponse *resp;
 
+    RouteTable::ReadGuard guard(routes_);
     auto range = CheckAndDecodeRequest("RawGet", req, resp, msg);
     if (range != nullptr) {
         range->RawGet(msg, req);
@@ -796,6 +1003,7 @@ void RangeServer::RawPut(common::ProtoMessage *msg) {
     kvrpcpb::DsKvRawPutRequest req;
     kvrpcpb::DsKvRawPutResponse *resp;
 
+    RouteTable::ReadGuard guard(routes_);
     auto range = CheckAndDecodeRequest("RawPut", req, resp, msg);
     if (range != nullptr) {
         range->RawPut(msg, req);
@@ -806,6 +1014,7 @@ void RangeServer::RawDelete(common::ProtoMessage *msg) {
     kvrpcpb::DsKvRawDeleteRequest req;
     kvrpcpb::DsKvRawDeleteResponse *resp;
 
+    RouteTable::ReadGuard guard(routes_);
     auto range = CheckAndDecodeRequest("RawDelete", req, resp, msg);
     if (range != nullptr) {
         range->RawDelete(msg, req);
@@ -816,6 +1025,7 @@ void RangeServer::Insert(common::ProtoMessage *msg) {
     kvrpcpb::DsInsertRequest req;
     kvrpcpb::DsInsertResponse *resp;
 
+    RouteTable::ReadGuard guard(routes_);
     auto range = CheckAndDecodeRequest("Insert", req, resp, msg);
     if (range != nullptr) {
         range->Insert(msg, req);
@@ -826,6 +1036,7 @@ void RangeServer::Select(common::ProtoMessage *msg) {
     kvrpcpb::DsSelectRequest req;
     kvrpcpb::DsSelectResponse *resp;
 
+    RouteTable::ReadGuard guard(routes_);
     auto range = CheckAndDecodeRequest("Select", req, resp, msg);
     if (range != nullptr) {
         range->Select(msg, req);
@@ -836,6 +1047,7 @@ void RangeServer::Delete(common::ProtoMessage *msg) {
     kvrpcpb::DsDeleteRequest req;
     kvrpcpb::DsKvDeleteResponse *resp;
 
+    RouteTable::ReadGuard guard(routes_);
     auto range = CheckAndDecodeRequest("Delete", req, resp, msg);
     if (range != nullptr) {
         range->Delete(msg, req);
@@ -843,7 +1055,7 @@ void RangeServer::Delete(common::ProtoMessage *msg) {
 }
 
 template <class RequestT, class ResponseT>
-std::shared_ptr<range::Range> RangeServer::CheckAndDecodeRequest(
+range::Range *RangeServer::CheckAndDecodeRequest(
     const char *func_name, RequestT &request, ResponseT *&respone,
     common::ProtoMessage *msg) {
     if (!common::GetMessage(msg->body.data(), msg->body.size(),
@@ -864,8 +1076,8 @@ std::shared_ptr<range::Range> RangeServer::CheckAndDecodeRequest(
         return nullptr;
     }
 
-    auto range = Find(request.header().range_id());
-    if (range == nullptr) {
+    auto range = routes_.Get(request.header().range_id());
+    if (range == nullptr || !range->valid()) {
         FLOG_ERROR("%s request not found range_id %" PRIu64 " failed", func_name,
                    request.header().range_id());
         respone = new ResponseT;
@@ -881,6 +1093,7 @@ void RangeServer::Lock(common::ProtoMessage *msg) {
     kvrpcpb::DsLockRequest req;
     kvrpcpb::DsLockResponse *resp;
 
+    RouteTable::ReadGuard guard(routes_);
     auto range = CheckAndDecodeRequest("Lock", req, resp, msg);
     if (range != nullptr) {
         range->Lock(msg, req);
@@ -891,6 +1104,7 @@ void RangeServer::LockUpdate(common::ProtoMessage *msg) {
     kvrpcpb::DsLockUpdateRequest req;
     kvrpcpb::DsLockUpdateResponse *resp;
 
+    RouteTable::ReadGuard guard(routes_);
     auto range = CheckAndDecodeRequest("LockUpdate", req, resp, msg);
     if (range != nullptr) {
         range->LockUpdate(msg, req);
@@ -901,6 +1115,7 @@ void RangeServer::Unlock(common::ProtoMessage *msg) {
     kvrpcpb::DsUnlockRequest req;
     kvrpcpb::DsUnlockResponse *resp;
 
+    RouteTable::ReadGuard guard(routes_);
     auto range = CheckAndDecodeRequest("Unlock", req, resp, msg);
     if (range != nullptr) {
         range->Unlock(msg, req);
@@ -911,6 +1126,7 @@ void RangeServer::UnlockForce(common::ProtoMessage *msg) {
     kvrpcpb::DsUnlockForceRequest req;
     kvrpcpb::DsUnlockForceResponse *resp;
 
+    RouteTable::ReadGuard guard(routes_);
     auto range = CheckAndDecodeRequest("UnlockForce", req, resp, msg);
     if (range != nullptr) {
         range->UnlockForce(msg, req);
@@ -921,6 +1137,7 @@ void RangeServer::LockScan(common::ProtoMessage *msg) {
     kvrpcpb::DsLockScanRequest req;
     kvrpcpb::DsLockScanResponse *resp;
 
+    RouteTable::ReadGuard guard(routes_);
     auto range = CheckAndDecodeRequest("LockScan", req, resp, msg);
     if (range != nullptr) {
         range->LockScan(msg, req);
@@ -931,6 +1148,7 @@ void RangeServer::KVSet(common::ProtoMessage *msg) {
     kvrpcpb::DsKvSetRequest req;
     kvrpcpb::DsKvSetResponse *resp;
 
+    RouteTable::ReadGuard guard(routes_);
     auto range = CheckAndDecodeRequest("KVSet", req, resp, msg);
     if (range != nullptr) {
         range->KVSet(msg, req);
@@ -941,6 +1159,7 @@ void RangeServer::KVGet(common::ProtoMessage *msg) {
     kvrpcpb::DsKvGetRequest req;
     kvrpcpb::DsKvGetResponse *resp;
 
+    RouteTable::ReadGuard guard(routes_);
     auto range = CheckAndDecodeRequest("KVGet", req, resp, msg);
     if (range != nullptr) {
         range->KVGet(msg, req);
@@ -951,6 +1170,7 @@ void RangeServer::KVBatchSet(common::ProtoMessage *msg) {
     kvrpcpb::DsKvBatchSetRequest req;
     kvrpcpb::DsKvBatchSetResponse *resp;
 
+    RouteTable::ReadGuard guard(routes_);
     auto range = CheckAndDecodeRequest("KVBatchSet", req, resp, msg);
     if (range != nullptr) {
         range->KVBatchSet(msg, req);
@@ -961,6 +1181,7 @@ void RangeServer::KVBatchGet(common::ProtoMessage *msg) {
     kvrpcpb::DsKvBatchGetRequest req;
     kvrpcpb::DsKvBatchGetResponse *resp;
 
+    RouteTable::ReadGuard guard(routes_);
     auto range = CheckAndDecodeRequest("KVBatchGet", req, resp, msg);
     if (range != nullptr) {
         range->KVBatchGet(msg, req);
@@ -971,6 +1192,7 @@ void RangeServer::KVDelete(common::ProtoMessage *msg) {
     kvrpcpb::DsKvDeleteRequest req;
     kvrpcpb::DsKvDeleteResponse *resp;
 
+    RouteTable::ReadGuard guard(routes_);
     auto range = CheckAndDecodeRequest("KVDelete", req, resp, msg);
     if (range != nullptr) {
         range->KVDelete(msg, req);
@@ -981,6 +1203,7 @@ void RangeServer::KVBatchDelete(common::ProtoMessage *msg) {
     kvrpcpb::DsKvBatchDeleteRequest req;
     kvrpcpb::DsKvBatchDeleteResponse *resp;
 
+    RouteTable::ReadGuard guard(routes_);
     auto range = CheckAndDecodeRequest("KVBatchDelete", req, resp, msg);
     if (range != nullptr) {
         range->KVBatchDelete(msg, req);
@@ -991,16 +1214,40 @@ void RangeServer::KVRangeDelete(common::ProtoMessage *msg) {
     kvrpcpb::DsKvRangeDeleteRequest req;
     kvrpcpb::DsKvRangeDeleteResponse *resp;
 
+    RouteTable::ReadGuard guard(routes_);
     auto range = CheckAndDecodeRequest("KVRangeDelete", req, resp, msg);
     if (range != nullptr) {
         range->KVRangeDelete(msg, req);
     }
 }
 
+void RangeServer::KVIncr(common::ProtoMessage *msg) {
+    kvrpcpb::DsKvIncrRequest req;
+    kvrpcpb::DsKvIncrResponse *resp;
+
+    RouteTable::ReadGuard guard(routes_);
+    auto range = CheckAndDecodeRequest("KVIncr", req, resp, msg);
+    if (range != nullptr) {
+        range->KVIncr(msg, req);
+    }
+}
+
+void RangeServer::KVAppend(common::ProtoMessage *msg) {
+    kvrpcpb::DsKvAppendRequest req;
+    kvrpcpb::DsKvAppendResponse *resp;
+
+    RouteTable::ReadGuard guard(routes_);
+    auto range = CheckAndDecodeRequest("KVAppend", req, resp, msg);
+    if (range != nullptr) {
+        range->KVAppend(msg, req);
+    }
+}
+
 void RangeServer::KVScan(common::ProtoMessage *msg) {
     kvrpcpb::DsKvScanRequest req;
     kvrpcpb::DsKvScanResponse *resp;
 
+    RouteTable::ReadGuard guard(routes_);
     auto range = CheckAndDecodeRequest("KVScan", req, resp, msg);
     if (range != nullptr) {
         range->KVScan(msg, req);
@@ -1061,6 +1308,7 @@ void RangeServer::RangeNotFound(const kvrpcpb::RequestHeader &req,
     common::SetResponseHeader(req, resp, err);
 }
 
+// 恢复完成后统一发布路由
 Status RangeServer::recover(const metapb::Range& meta) {
     auto rng = std::make_shared<range::Range>(range_context_.get(), meta);
     auto s = rng->Initialize(0);
@@ -1071,6 +1319,10 @@ Status RangeServer::recover(const metapb::Range& meta) {
     if (!ret.second) {
         return Status(Status::kDuplicate, "save range", std::to_string(meta.id()));
     }
+    // 重启前已冻结的range，合并方已吸收的话销毁
+    if (rng->MergedInto() != 0) {
+        RetireMergedRange(meta.id());
+    }
     return Status::OK();
 }
 
@@ -1129,6 +1381,11 @@ int RangeServer::recover(const std::vector<metapb::Range> &metas) {
         if (!s.ok()) last_error = s;
     }
 
+    {
+        std::unique_lock<sharkstore::shared_mutex> lock(rw_lock_);
+        publishRoutes();
+    }
+
     auto took_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
             std::chrono::system_clock::now() - begin).count();
 
@@ -1151,12 +1408,24 @@ int RangeServer::recover(const std::vector<metapb::Range> &metas) {
 }
 
 void RangeServer::Heartbeat() {
-    uint64_t range_id = 0;
+    std::vector<uint64_t> range_ids;
     int interval = ds_config.hb_config.range_interval;
 
     while (g_continue_flag) {
+        std::vector<uint64_t> retires;
         {
             std::unique_lock<std::mutex> lock(queue_mutex_);
+            retires.swap(merge_retire_queue_);
+        }
+        for (auto id : retires) {
+            retireMergedRange(id);
+        }
+
+        {
+            std::unique_lock<std::mutex> lock(queue_mutex_);
+            if (!merge_retire_queue_.empty()) {
+                continue;
+            }
             if (range_heartbeat_queue_.empty()) {
                 queue_cond_.wait_for(lock, std::chrono::seconds(interval));
                 continue;
@@ -1171,13 +1440,19 @@ void RangeServer::Heartbeat() {
                 continue;
             }
 
-            range_heartbeat_queue_.pop();
-            range_id = hb.second;
+            // 一次取出所有到期的range，其心跳由master worker合并发送
+            range_ids.clear();
+            while (!range_heartbeat_queue_.empty() && range_heartbeat_queue_.top().first <= now) {
+                range_ids.push_back(range_heartbeat_queue_.top().second);
+                range_heartbeat_queue_.pop();
+            }
         }
 
-        auto range = Find(range_id);
-        if (range != nullptr) {
-            range->Heartbeat();
+        for (auto range_id : range_ids) {
+            auto range = Find(range_id);
+            if (range != nullptr) {
+                range->Heartbeat();
+            }
         }
     }
 
@@ -1191,6 +1466,58 @@ void RangeServer::LeaderQueuePush(uint64_t leader, time_t expire) {
     queue_cond_.notify_all();
 }
 
+void RangeServer::RetireMergedRange(uint64_t source_id) {
+    std::unique_lock<std::mutex> lock(queue_mutex_);
+    merge_retire_queue_.push_back(source_id);
+
+    queue_cond_.notify_all();
+}
+
+void RangeServer::retireMergedRange(uint64_t source_id) {
+    // 本地target暂缓应用的日志未能全部恢复时（见Range::ResumeMerge），在此重试
+    auto source_range = Find(source_id);
+    if (source_range != nullptr && source_range->MergedInto() != 0) {
+        auto target_range = Find(source_range->MergedInto());
+        if (target_range != nullptr && target_range->MergePending() == source_id) {
+            target_range->ResumeMerge(source_id);
+        }
+    }
+
+    std::unique_lock<sharkstore::shared_mutex> lock(rw_lock_);
+
+    auto it = ranges_.find(source_id);
+    if (it == ranges_.end()) {
+        return;
+    }
+    auto source = it->second;
+    auto target_id = source->MergedInto();
+    if (target_id == 0) {
+        return;
+    }
+    auto target = ranges_.find(target_id);
+    if (target == ranges_.end()) {
+        FLOG_WARN("retire merged range[%" PRIu64 "]: target range[%" PRIu64 "] not found.",
+                  source_id, target_id);
+        return;
+    }
+    // target尚未应用合并，等待其apply后再次触发
+    if (target->second->options().end_key() != source->options().end_key()) {
+        return;
+    }
+
+    meta_store_->DelRange(source_id);
+    // 数据已归属target，不能删除
+    auto s = source->Destroy(false);
+    if (!s.ok()) {
+        FLOG_ERROR("retire merged range[%" PRIu64 "] failed: %s", source_id, s.ToString().c_str());
+        return;
+    }
+    ranges_.erase(it);
+    publishRoutes();
+
+    FLOG_INFO("retire merged range[%" PRIu64 "] into range[%" PRIu64 "] success.", source_id, target_id);
+}
+
 void RangeServer::StatisPush(uint64_t range_id) {
     std::lock_guard<std::mutex> lock(statis_mutex_);
     statis_queue_.push(range_id);
@@ -1202,6 +1529,13 @@ void RangeServer::OnNodeHeartbeatResp(const mspb::NodeHeartbeatResponse &resp) {
     FLOG_INFO("Recv NodeHeartbeat Response from master server.");
 }
 
+void RangeServer::OnRangeHeartbeatFullRequired(uint64_t range_id) {
+    auto range = Find(range_id);
+    if (range != nullptr) {
+        range->ResetHeartbeat();
+    }
+}
+
 void RangeServer::OnRangeHeartbeatResp(const mspb::RangeHeartbeatResponse &resp) {
     if (!resp.has_task()) {
         return;
@@ -1223,10 +1557,30 @@ void RangeServer::OnRangeHeartbeatResp(const mspb::RangeHeartbeatResponse &resp)
         case taskpb::TaskType::EmptyTask:
             FLOG_DEBUG("RangeHeartbeat task empty.");
             break;
-        case taskpb::TaskType::RangeMerge:
-            FLOG_DEBUG("RangeHeartbeat task RangeMerge.");
-            // TODO
+        case taskpb::TaskType::RangeMerge: {
+            FLOG_INFO("RangeHeartbeat task RangeMerge. range id: %" PRIu64, resp.range_id());
+            // 合并右侧相邻的range
+            auto source_id = resp.task().range_merge().source_id();
+            auto source = Find(source_id);
+            if (source == nullptr || source->options().start_key() != range->options().end_key()) {
+                FLOG_WARN("RangeHeartbeat task RangeMerge: range id %" PRIu64 " source %" PRIu64
+                          " is not right neighbor", resp.range_id(), source_id);
+                break;
+            }
+            // master的大小统计可能不准（重启后从零累计），合并后不应马上再分裂
+            auto size = range->ApproximateSize() + source->ApproximateSize();
+            if (size >= range_context_->GetSplitPolicy()->SplitSize()) {
+                FLOG_WARN("RangeHeartbeat task RangeMerge: range id %" PRIu64 " source %" PRIu64
+                          " too large to merge: %" PRIu64, resp.range_id(), source_id, size);
+                break;
+            }
+            auto s = range->Merge(source);
+            if (!s.ok()) {
+                FLOG_WARN("RangeHeartbeat task RangeMerge: range id %" PRIu64 " merge failed: %s",
+                          resp.range_id(), s.ToString().c_str());
+            }
             break;
+        }
         case taskpb::TaskType::RangeDelete:
             FLOG_INFO("RangeHeartbeat task RangeDelete. range id: %" PRIu64,
                        resp.range_id());
@@ -1302,6 +1656,52 @@ void RangeServer::CollectNodeHeartbeat(mspb::NodeHeartbeatRequest *req) {
     stats->set_keys_written(mstat.keys_write_per_sec);
     stats->set_bytes_written(mstat.bytes_write_per_sec);
 
+    // collect system stats, 读取RunStatus最近一次的采样结果
+    monitor::ProcStats proc;
+    if (context_->run_status->GetProcStats(&proc)) {
+        stats->set_cpu_usage(proc.cpu_usage);
+        stats->set_process_cpu_usage(proc.proc_cpu_usage);
+        stats->set_cpu_count(proc.cpu_count);
+        double disk_util = 0, read_latency = 0, write_latency = 0;
+        double read_bytes = 0, write_bytes = 0;
+        for (int i = 0; i < proc.disk_count; ++i) {
+            const auto &disk = proc.disks[i];
+            disk_util = std::max(disk_util, disk.util);
+            read_latency = std::max(read_latency, disk.read_latency_ms);
+            write_latency = std::max(write_latency, disk.write_latency_ms);
+            read_bytes += disk.read_bytes_sec;
+            write_bytes += disk.write_bytes_sec;
+        }
+        stats->set_disk_util(disk_util);
+        stats->set_disk_read_latency_ms(read_latency);
+        stats->set_disk_write_latency_ms(write_latency);
+        stats->set_disk_read_bytes(static_cast<uint64_t>(read_bytes));
+        stats->set_disk_write_bytes(static_cast<uint64_t>(write_bytes));
+        double rx = 0, tx = 0;
+        for (int i = 0; i < proc.nic_count; ++i) {
+            rx += proc.nics[i].rx_bytes_sec;
+            tx += proc.nics[i].tx_bytes_sec;
+        }
+        stats->set_net_in_bytes(static_cast<uint64_t>(rx));
+        stats->set_net_out_bytes(static_cast<uint64_t>(tx));
+    }
+
+    // collect sampled rocksdb perf stats
+    storage::PerfStat perf;
+    storage::GetTotalPerfStats(&perf);
+    stats->set_perf_samples(perf.samples);
+    stats->set_perf_block_cache_hits(perf.block_cache_hits);
+    stats->set_perf_block_reads(perf.block_reads);
+    stats->set_perf_block_read_bytes(perf.block_read_bytes);
+    stats->set_perf_block_read_nanos(perf.block_read_nanos);
+    stats->set_perf_memtable_nanos(perf.memtable_nanos);
+    stats->set_perf_sst_nanos(perf.sst_nanos);
+    stats->set_perf_iter_seek_nanos(perf.iter_seek_nanos);
+    stats->set_perf_keys_skipped(perf.keys_skipped);
+    stats->set_perf_deletes_skipped(perf.deletes_skipped);
+    stats->set_perf_io_read_bytes(perf.io_read_bytes);
+    stats->set_perf_io_read_nanos(perf.io_read_nanos);
+
     stats->set_is_busy(false);
 }
 
@@ -3,6 +3,7 @@
 
 #include <atomic>
 #include <condition_variable>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <queue>
@@ -17,9 +18,11 @@
 #include "base/status.h"
 #include "master/task_handler.h"
 #include "range/range.h"
+#include "storage/column_families.h"
 #include "storage/meta_store.h"
 
 #include "context_server.h"
+#include "route_table.h"
 
 namespace sharkstore {
 namespace dataserver {
@@ -46,17 +49,31 @@ public:
 
     size_t GetRangesSize() const;
     std::shared_ptr<range::Range> Find(uint64_t range_id);
+    // 返回key所在的range
+    std::shared_ptr<range::Range> FindByKey(const std::string &key);
+
+    // 表独立的column family(rocksdb.cf_per_table开启时创建), 没有则返回nullptr
+    std::shared_ptr<rocksdb::ColumnFamilyHandle> GetTableColumnFamily(uint64_t table_id);
+    std::vector<std::shared_ptr<rocksdb::ColumnFamilyHandle>> GetAllTableColumnFamilies();
+    Status SetTableOptions(uint64_t table_id,
+                           const std::unordered_map<std::string, std::string>& options);
 
     void OnNodeHeartbeatResp(const mspb::NodeHeartbeatResponse &) override;
     void OnRangeHeartbeatResp(const mspb::RangeHeartbeatResponse &) override;
+    void OnRangeHeartbeatFullRequired(uint64_t range_id) override;
     void OnAskSplitResp(const mspb::AskSplitResponse &) override;
     void CollectNodeHeartbeat(mspb::NodeHeartbeatRequest *req) override;
 
 private:
     void buildDBOptions(rocksdb::Options& ops);
+    // 表的column family参数，高优先级表使用独立的block cache
+    const rocksdb::ColumnFamilyOptions& tableCFOptions(uint64_t table_id) const;
     int OpenDB();
     void CloseDB();
 
+    // 调用方需持有rw_lock_写锁
+    bool hasTableRange(uint64_t table_id, uint64_t exclude_range_id = 0) const;
+
     Status recover(const metapb::Range& meta);
     int recover(const std::vector<metapb::Range> &metas);
 
@@ -80,6 +97,8 @@ private:
     void KVDelete(common::ProtoMessage *msg);
     void KVBatchDelete(common::ProtoMessage *msg);
     void KVRangeDelete(common::ProtoMessage *msg);
+    void KVIncr(common::ProtoMessage *msg);
+    void KVAppend(common::ProtoMessage *msg);
     void KVScan(common::ProtoMessage *msg);
 
     void TimeOut(const kvrpcpb::RequestHeader &req,
@@ -87,8 +106,9 @@ private:
     void RangeNotFound(const kvrpcpb::RequestHeader &req,
                        kvrpcpb::ResponseHeader *resp);
 
+    // 调用方需持有RouteTable::ReadGuard，返回的range在guard析构前有效
     template <class RequestT, class ResponseT>
-    std::shared_ptr<range::Range> CheckAndDecodeRequest(
+    range::Range *CheckAndDecodeRequest(
         const char *ReqName, RequestT &request, ResponseT *&respone,
         common::ProtoMessage *msg);
 
@@ -98,6 +118,9 @@ public:
 
     void LeaderQueuePush(uint64_t leader, time_t expire);
 
+    // 合并完成后销毁被合并的range，在心跳线程中异步执行
+    void RetireMergedRange(uint64_t source_id);
+
 private:  // admin
     void CreateRange(common::ProtoMessage *msg);
     void DeleteRange(common::ProtoMessage *msg);
@@ -115,10 +138,16 @@ private:  // admin
     int OfflineRange(uint64_t range_id);
 
     void Heartbeat();
+    // source已冻结且target已吸收其key范围时，销毁source（不删除数据）
+    void retireMergedRange(uint64_t source_id);
+    // ranges_变更后重建路由，调用方需持有rw_lock_
+    void publishRoutes();
 
 private:
     mutable shared_mutex rw_lock_;
     std::unordered_map<int64_t, std::shared_ptr<range::Range>> ranges_;
+    // ranges_的只读快照，请求路径上无锁查找
+    RouteTable routes_;
 
     std::mutex statis_mutex_;
     std::condition_variable statis_cond_;
@@ -130,11 +159,16 @@ private:
     typedef std::pair<time_t, uint64_t> tr;
     std::priority_queue<tr, std::vector<tr>, std::greater<tr>>
         range_heartbeat_queue_;
+    std::vector<uint64_t> merge_retire_queue_;  // 受queue_mutex_保护
 
     std::vector<std::thread> worker_;
     std::thread range_heartbeat_;
 
     rocksdb::DB *db_ = nullptr;
+    rocksdb::ColumnFamilyOptions cf_options_;
+    rocksdb::ColumnFamilyOptions high_pri_cf_options_;
+    std::shared_ptr<rocksdb::TableFactory> high_pri_table_factory_;
+    storage::TableColumnFamilies table_cfs_;
     storage::MetaStore *meta_store_ = nullptr;
 
     ContextServer *context_ = nullptr;
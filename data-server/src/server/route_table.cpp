@@ -0,0 +1,66 @@
+#include "route_table.h"
+
+namespace sharkstore {
+namespace dataserver {
+namespace server {
+
+RouteTable::RouteTable() : snapshot_(new Snapshot) {}
+
+RouteTable::~RouteTable() {
+    rcu_.Barrier();
+    delete snapshot_.load();
+}
+
+range::Range* RouteTable::Get(uint64_t range_id) const {
+    auto snap = snapshot_.load();
+    auto it = snap->ranges.find(static_cast<int64_t>(range_id));
+    if (it == snap->ranges.end()) {
+        return nullptr;
+    }
+    return it->second.get();
+}
+
+range::Range* RouteTable::GetByKey(const std::string& key) const {
+    auto snap = snapshot_.load();
+    // start key不大于key的最后一个range
+    auto it = snap->key_index.upper_bound(key);
+    if (it == snap->key_index.begin()) {
+        return nullptr;
+    }
+    --it;
+    if (!it->second.end_key.empty() && key >= it->second.end_key) {
+        return nullptr;
+    }
+    return it->second.range;
+}
+
+size_t RouteTable::Size() const {
+    RcuDomain::ReadGuard guard(rcu_);
+    return snapshot_.load()->ranges.size();
+}
+
+void RouteTable::Publish(const RangeMap& ranges) {
+    std::unique_ptr<Snapshot> snap(new Snapshot);
+    snap->ranges = ranges;
+    for (const auto& r : ranges) {
+        auto meta = r.second->options();
+        auto& entry = snap->key_index[meta.start_key()];
+        // 分裂过程中可能短暂出现相同start key的range，取版本较新的
+        if (entry.range == nullptr || meta.range_epoch().version() > entry.version) {
+            entry.end_key = meta.end_key();
+            entry.version = meta.range_epoch().version();
+            entry.range = r.second.get();
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(publish_mu_);
+    auto old = snapshot_.exchange(snap.release());
+    // 发布在rw_lock_及raft apply路径上，不能等待读者
+    rcu_.Retire([old] { delete old; });
+}
+
+void RouteTable::Flush() { rcu_.Barrier(); }
+
+}  // namespace server
+}  // namespace dataserver
+}  // namespace sharkstore
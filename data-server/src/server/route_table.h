@@ -0,0 +1,70 @@
+_Pragma("once");
+
+#include <stdint.h>
+#include <atomic>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "base/rcu.h"
+#include "range/range.h"
+
+namespace sharkstore {
+namespace dataserver {
+namespace server {
+
+// range路由表，按range id或key查找range
+// 路由是不可变的快照，增删range（创建、删除、分裂、合并）后整体重建再发布
+// 读者在ReadGuard内无锁访问，不复制shared_ptr
+class RouteTable {
+public:
+    typedef std::unordered_map<int64_t, std::shared_ptr<range::Range>> RangeMap;
+
+    class ReadGuard : public RcuDomain::ReadGuard {
+    public:
+        explicit ReadGuard(RouteTable& table) : RcuDomain::ReadGuard(table.rcu_) {}
+    };
+
+    RouteTable();
+    ~RouteTable();
+
+    RouteTable(const RouteTable&) = delete;
+    RouteTable& operator=(const RouteTable&) = delete;
+
+    // 以下查找需在ReadGuard内调用，返回的指针在guard析构前有效
+    range::Range* Get(uint64_t range_id) const;
+    // 返回key所在的range，不存在时返回nullptr
+    range::Range* GetByKey(const std::string& key) const;
+
+    size_t Size() const;
+
+    // 以ranges重建路由并发布，不等待读者，旧的路由（及其持有的range）由后台回收
+    void Publish(const RangeMap& ranges);
+    // 等待旧的路由全部回收，返回时其中的range引用都已释放
+    // 不能在ReadGuard内调用
+    void Flush();
+
+private:
+    struct KeyEntry {
+        std::string end_key;
+        uint64_t version = 0;
+        range::Range* range = nullptr;
+    };
+
+    struct Snapshot {
+        RangeMap ranges;
+        // key: start key
+        std::map<std::string, KeyEntry> key_index;
+    };
+
+private:
+    std::atomic<Snapshot*> snapshot_;
+    std::mutex publish_mu_;
+    mutable RcuDomain rcu_;
+};
+
+}  // namespace server
+}  // namespace dataserver
+}  // namespace sharkstore
@@ -1,5 +1,6 @@
 #include "run_status.h"
 
+#include <algorithm>
 #include <chrono>
 #include <thread>
 
@@ -50,6 +51,7 @@ void RunStatus::Stop() {
 void RunStatus::run() {
     while (g_continue_flag) {
         updateFSUsagePercent();
+        updateProcStats();
         printDBMetric();
         context_->worker->PrintQueueSize();
         printStatistics();
@@ -87,6 +89,40 @@ void RunStatus::updateFSUsagePercent() {
     }
 }
 
+void RunStatus::updateProcStats() {
+    monitor::ProcStats stats;
+    if (!system_status_.SampleProcStats(&stats) || stats.elapsed_ms <= 0) {
+        return;
+    }
+
+    double disk_util = 0, disk_latency = 0;
+    for (int i = 0; i < stats.disk_count; ++i) {
+        disk_util = std::max(disk_util, stats.disks[i].util);
+        disk_latency = std::max(disk_latency,
+                std::max(stats.disks[i].read_latency_ms, stats.disks[i].write_latency_ms));
+    }
+    double rx = 0, tx = 0;
+    for (int i = 0; i < stats.nic_count; ++i) {
+        rx += stats.nics[i].rx_bytes_sec;
+        tx += stats.nics[i].tx_bytes_sec;
+    }
+    FLOG_INFO("system stats: cpu=%.1f%%, process cpu=%.1f%%, max disk util=%.1f%%, "
+              "max disk latency=%.2fms, net rx=%.0fB/s, tx=%.0fB/s",
+              stats.cpu_usage, stats.proc_cpu_usage, disk_util, disk_latency, rx, tx);
+
+    std::lock_guard<std::mutex> lock(proc_stats_mu_);
+    proc_stats_ = stats;
+}
+
+bool RunStatus::GetProcStats(monitor::ProcStats* stats) {
+    std::lock_guard<std::mutex> lock(proc_stats_mu_);
+    if (proc_stats_.elapsed_ms <= 0) {
+        return false;
+    }
+    *stats = proc_stats_;
+    return true;
+}
+
 void RunStatus::printStatistics() {
     FLOG_INFO("\n%s", statistics_.ToString().c_str());
     statistics_.Reset();
@@ -101,10 +137,13 @@ void RunStatus::printDBMetric() {
     std::string mem_table_usage;
     db->GetProperty("rocksdb.cur-size-all-mem-tables", &mem_table_usage);
     FLOG_INFO("rocksdb memory usages: table-readers=%s, memtables=%s, "
-              "block-cache=%lu, pinned=%lu, row-cache=%lu",
+              "block-cache=%lu, pinned=%lu, compressed-block-cache=%lu, "
+              "high-pri-block-cache=%lu, row-cache=%lu",
               tr_mem_usage.c_str(), mem_table_usage.c_str(),
               context_->block_cache->GetUsage(),
               context_->block_cache->GetPinnedUsage(),
+              (context_->block_cache_compressed ? context_->block_cache_compressed->GetUsage() : 0),
+              (context_->high_pri_block_cache ? context_->high_pri_block_cache->GetUsage() : 0),
               (context_->row_cache ? context_->row_cache->GetUsage() : 0));
 
     auto stat = context_->db_stats;
@@ -117,6 +156,12 @@ void RunStatus::printDBMetric() {
                   stat->getAndResetTickerCount(rocksdb::BLOCK_CACHE_HIT),
                   stat->getAndResetTickerCount(rocksdb::BLOCK_CACHE_MISS));
 
+        if (context_->block_cache_compressed) {
+            FLOG_INFO("rocksdb compressed block-cache stats: hit=%" PRIu64 ", miss=%" PRIu64,
+                      stat->getAndResetTickerCount(rocksdb::BLOCK_CACHE_COMPRESSED_HIT),
+                      stat->getAndResetTickerCount(rocksdb::BLOCK_CACHE_COMPRESSED_MISS));
+        }
+
         FLOG_INFO("rockdb get histograms: %s", stat->getHistogramString(rocksdb::DB_GET).c_str());
         FLOG_INFO("rockdb write histograms: %s", stat->getHistogramString(rocksdb::DB_WRITE).c_str());
         stat->Reset();
@@ -44,6 +44,9 @@ public:
     bool GetFilesystemUsage(FileSystemUsage* usage);
     uint64_t GetFilesystemUsedPercent() const { return fs_usage_percent_.load();}
 
+    // 最近一个统计周期的cpu、磁盘、网卡速率
+    bool GetProcStats(monitor::ProcStats* stats);
+
     void IncrLeaderCount() override { ++leader_count_; }
     void DecrLeaderCount() override { --leader_count_; }
     uint64_t GetLeaderCount() const { return leader_count_; }
@@ -55,6 +58,7 @@ public:
 private:
     void run();
     void updateFSUsagePercent();
+    void updateProcStats();
     void printStatistics();
     void printDBMetric();
 
@@ -66,6 +70,9 @@ private:
 
     std::atomic<uint64_t> fs_usage_percent_ = {0};
 
+    std::mutex proc_stats_mu_;
+    monitor::ProcStats proc_stats_;
+
     std::atomic<uint64_t> leader_count_ = {0};
     std::atomic<uint64_t> split_count_ = {0};
 
@@ -65,8 +65,15 @@ bool DataServer::startRaftServer() {
     ops.consensus_queue_capacity = ds_config.raft_config.consensus_queue;
     ops.apply_threads_num = static_cast<uint8_t>(ds_config.raft_config.apply_threads);
     ops.apply_queue_capacity = ds_config.raft_config.apply_queue;
+    ops.enable_thread_balance = ds_config.raft_config.thread_balance;
+    ops.balance_interval = std::chrono::seconds(ds_config.raft_config.balance_interval);
+    ops.balance_threshold_percent =
+        static_cast<unsigned>(ds_config.raft_config.balance_threshold);
+    ops.leader_async_persist = ds_config.raft_config.leader_async_persist;
+    ops.persist_threads_num = static_cast<uint8_t>(ds_config.raft_config.persist_threads);
     ops.tick_interval = std::chrono::milliseconds(ds_config.raft_config.tick_interval_ms);
     ops.max_size_per_msg = ds_config.raft_config.max_msg_size;
+    ops.max_inflight_bytes = ds_config.raft_config.max_inflight_bytes;
 
     ops.transport_options.listen_port = static_cast<uint16_t>(ds_config.raft_config.port);
     ops.transport_options.send_io_threads = ds_config.raft_config.transport_send_threads;
@@ -175,12 +182,13 @@ void DataServer::Stop() {
     if (context_->worker != nullptr) {
         context_->worker->Stop();
     }
-    if (context_->range_server != nullptr) {
-        context_->range_server->Stop();
-    }
+    // 先停止raft，不再有apply等任务访问range，range及其db句柄才能安全释放
     if (context_->raft_server != nullptr) {
         context_->raft_server->Stop();
     }
+    if (context_->range_server != nullptr) {
+        context_->range_server->Stop();
+    }
     if (context_->master_worker != nullptr) {
         context_->master_worker->Stop();
     }
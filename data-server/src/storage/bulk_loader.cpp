@@ -0,0 +1,152 @@
+#include "bulk_loader.h"
+
+#include <errno.h>
+#include <stdio.h>
+#include <atomic>
+
+#include "base/util.h"
+#include "common/ds_config.h"
+#include "store.h"
+#include "ttl.h"
+
+namespace sharkstore {
+namespace dataserver {
+namespace storage {
+
+// 进程内的文件序号，目录在启动时清空，不会与之前的文件重名
+static std::atomic<uint64_t> g_ingest_file_seq{0};
+
+BulkLoader::BulkLoader(Store* store, std::string dir, uint64_t file_size)
+    : store_(store), dir_(std::move(dir)), file_size_(file_size) {}
+
+BulkLoader::~BulkLoader() {
+    writer_.reset();
+    if (!current_file_.empty()) {
+        remove(current_file_.c_str());
+    }
+    for (const auto& file : files_) {
+        remove(file.c_str());
+    }
+}
+
+std::string BulkLoader::DefaultDir() {
+    return JoinFilePath({ds_config.rocksdb_config.path, "ingest"});
+}
+
+void BulkLoader::Cleanup(const std::string& dir) {
+    if (CheckDirExist(dir) == 0) {
+        RemoveDirAll(dir.c_str());
+    }
+}
+
+Status BulkLoader::Add(const std::string& key, const std::string& value, uint64_t expire_at) {
+    if (key < store_->start_key_ || key >= store_->GetEndKey()) {
+        return Status(Status::kOutOfBound, "bulk load key", EncodeToHex(key));
+    }
+    if (store_->ttl_ != kNoTtl) {
+        return AddRaw(key, store_->ttlValue(value, expire_at));
+    }
+    return AddRaw(key, value);
+}
+
+Status BulkLoader::AddRaw(const std::string& key, const std::string& value) {
+    if (count_ > 0 && key <= last_key_) {
+        return Status(Status::kInvalidArgument, "bulk load key not in order", EncodeToHex(key));
+    }
+
+    if (writer_ == nullptr) {
+        auto s = openFile();
+        if (!s.ok()) {
+            return s;
+        }
+    }
+
+    auto ret = writer_->Put(key, value);
+    if (!ret.ok()) {
+        return Status(Status::kIOError, "sst file put", ret.ToString());
+    }
+    last_key_ = key;
+    ++count_;
+    bytes_ += key.size() + value.size();
+
+    if (writer_->FileSize() >= file_size_) {
+        return finishFile();
+    }
+    return Status::OK();
+}
+
+Status BulkLoader::openFile() {
+    // rocksdb的blob db及DBWithTTL的值有各自的格式，不能直接导入sst
+    if (ds_config.rocksdb_config.storage_type != 0 || ds_config.rocksdb_config.ttl > 0) {
+        return Status(Status::kNotSupported, "bulk load", "blob db or db with ttl");
+    }
+
+    if (MakeDirAll(dir_, 0755) != 0) {
+        return Status(Status::kIOError, "create ingest dir", strErrno(errno));
+    }
+
+    auto db = store_->db_;
+    auto ops = db->GetOptions(store_->cf_);
+    std::unique_ptr<rocksdb::SstFileWriter> writer(
+            new rocksdb::SstFileWriter(rocksdb::EnvOptions(), ops, store_->cf_));
+    auto file = JoinFilePath({dir_, std::to_string(store_->range_id_) + "_" +
+                                           std::to_string(++g_ingest_file_seq) + ".sst"});
+    auto ret = writer->Open(file);
+    if (!ret.ok()) {
+        return Status(Status::kIOError, "open sst file", ret.ToString());
+    }
+    writer_ = std::move(writer);
+    current_file_ = std::move(file);
+    return Status::OK();
+}
+
+Status BulkLoader::finishFile() {
+    if (writer_ == nullptr) {
+        return Status::OK();
+    }
+    auto ret = writer_->Finish();
+    writer_.reset();
+    if (!ret.ok()) {
+        remove(current_file_.c_str());
+        current_file_.clear();
+        return Status(Status::kIOError, "finish sst file", ret.ToString());
+    }
+    files_.push_back(std::move(current_file_));
+    current_file_.clear();
+    return Status::OK();
+}
+
+Status BulkLoader::Ingest() {
+    auto s = finishFile();
+    if (!s.ok() || files_.empty()) {
+        return s;
+    }
+
+    // 文件在同一文件系统下时以硬链接方式移入db目录，导入成功后原文件即被删除
+    rocksdb::IngestExternalFileOptions opts;
+    opts.move_files = true;
+    rocksdb::Status ret;
+    s = store_->compactDeletedRange();
+    if (s.ok()) {
+        ret = store_->db_->IngestExternalFile(store_->cf_, files_, opts);
+    }
+    for (const auto& file : files_) {
+        remove(file.c_str());
+    }
+    files_.clear();
+    if (!s.ok()) {
+        return s;
+    }
+    if (!ret.ok()) {
+        return Status(Status::kIOError, "ingest sst files", ret.ToString());
+    }
+
+    store_->bumpWriteVersion();
+    store_->ClearCursors();
+    store_->addMetricWrite(count_, bytes_);
+    return Status::OK();
+}
+
+}  // namespace storage
+}  // namespace dataserver
+}  // namespace sharkstore
@@ -0,0 +1,66 @@
+_Pragma("once");
+
+#include <stdint.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <rocksdb/sst_file_writer.h>
+
+#include "base/status.h"
+
+namespace sharkstore {
+namespace dataserver {
+namespace storage {
+
+class Store;
+
+// 批量导入：在本地用SstFileWriter把数据写成sst文件，再通过IngestExternalFile
+// 一次性原子地导入store，不经过WAL和memtable
+// key必须严格递增；单个文件超过file_size后切换到下一个文件
+// 未导入的文件在析构时删除
+class BulkLoader {
+public:
+    BulkLoader(Store* store, std::string dir, uint64_t file_size);
+    ~BulkLoader();
+
+    BulkLoader(const BulkLoader&) = delete;
+    BulkLoader& operator=(const BulkLoader&) = delete;
+
+    // 与Store::Put一致，TTL表的值会加上到期时间头（expire_at由命令携带）
+    Status Add(const std::string& key, const std::string& value, uint64_t expire_at = 0);
+    // 值原样写入，不检查key的范围（如快照中的数据，已带有TTL值头）
+    Status AddRaw(const std::string& key, const std::string& value);
+
+    // 结束写入并导入所有文件，导入之前store范围内已有的同名key被覆盖
+    Status Ingest();
+
+    uint64_t Count() const { return count_; }
+    uint64_t Bytes() const { return bytes_; }
+
+    // 导入文件的临时目录，在rocksdb目录下，保证导入时可以硬链接
+    static std::string DefaultDir();
+    // 删除目录下残留的导入文件（如进程在导入前退出）
+    static void Cleanup(const std::string& dir);
+
+private:
+    Status openFile();
+    Status finishFile();
+
+private:
+    Store* store_;
+    const std::string dir_;
+    const uint64_t file_size_;
+
+    std::unique_ptr<rocksdb::SstFileWriter> writer_;
+    std::string current_file_;
+    std::vector<std::string> files_;  // 已写完待导入的文件
+
+    std::string last_key_;
+    uint64_t count_ = 0;
+    uint64_t bytes_ = 0;
+};
+
+}  // namespace storage
+}  // namespace dataserver
+}  // namespace sharkstore
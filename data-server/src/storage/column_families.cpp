@@ -0,0 +1,193 @@
+#include "column_families.h"
+
+#include <chrono>
+#include <cinttypes>
+#include <thread>
+
+#include <rocksdb/utilities/db_ttl.h>
+
+#include "frame/sf_logger.h"
+
+namespace sharkstore {
+namespace dataserver {
+namespace storage {
+
+static const std::string kTableCFPrefix = "table_";
+
+std::string TableColumnFamilies::Name(uint64_t table_id) {
+    return kTableCFPrefix + std::to_string(table_id);
+}
+
+bool TableColumnFamilies::ParseName(const std::string& name, uint64_t* table_id) {
+    return sscanf(name.c_str(), "table_%" SCNu64, table_id) == 1 &&
+           name == Name(*table_id);
+}
+
+ColumnFamilyPtr TableColumnFamilies::hold(rocksdb::ColumnFamilyHandle* handle) {
+    auto owner = owner_;
+    return ColumnFamilyPtr(handle, [owner](rocksdb::ColumnFamilyHandle* h) {
+        std::lock_guard<std::mutex> lock(owner->mu);
+        // 已被Release强制销毁
+        if (owner->db != nullptr) {
+            owner->db->DestroyColumnFamilyHandle(h);
+        }
+    });
+}
+
+void TableColumnFamilies::Load(rocksdb::DB* db,
+                               const std::vector<rocksdb::ColumnFamilyHandle*>& handles) {
+    db_ = db;
+    {
+        std::lock_guard<std::mutex> lock(owner_->mu);
+        owner_->db = db;
+    }
+    std::lock_guard<std::mutex> lock(mu_);
+    for (auto handle : handles) {
+        if (handle->GetName() == rocksdb::kDefaultColumnFamilyName) {
+            db->DestroyColumnFamilyHandle(handle);
+            continue;
+        }
+        uint64_t table_id = 0;
+        if (!ParseName(handle->GetName(), &table_id)) {
+            FLOG_WARN("unknown rocksdb column family: %s", handle->GetName().c_str());
+            db->DestroyColumnFamilyHandle(handle);
+            continue;
+        }
+        cfs_.emplace(table_id, hold(handle));
+        FLOG_INFO("rocksdb column family %s loaded.", handle->GetName().c_str());
+    }
+}
+
+ColumnFamilyPtr TableColumnFamilies::Get(uint64_t table_id) const {
+    std::lock_guard<std::mutex> lock(mu_);
+    auto it = cfs_.find(table_id);
+    if (it != cfs_.end()) {
+        return it->second;
+    }
+    return nullptr;
+}
+
+std::vector<ColumnFamilyPtr> TableColumnFamilies::GetAll() const {
+    std::vector<ColumnFamilyPtr> cfs;
+    std::lock_guard<std::mutex> lock(mu_);
+    for (const auto& p : cfs_) {
+        cfs.push_back(p.second);
+    }
+    return cfs;
+}
+
+Status TableColumnFamilies::Create(uint64_t table_id, const rocksdb::ColumnFamilyOptions& options,
+                                   int ttl) {
+    auto name = Name(table_id);
+    rocksdb::ColumnFamilyHandle* handle = nullptr;
+    rocksdb::Status s;
+    if (ttl > 0) {
+        auto ttl_db = static_cast<rocksdb::DBWithTTL*>(db_);
+        s = ttl_db->CreateColumnFamilyWithTtl(options, name, &handle, ttl);
+    } else {
+        s = db_->CreateColumnFamily(options, name, &handle);
+    }
+    if (!s.ok()) {
+        FLOG_ERROR("create rocksdb column family %s failed: %s", name.c_str(),
+                   s.ToString().c_str());
+        return Status(Status::kIOError, "create column family", s.ToString());
+    }
+
+    std::lock_guard<std::mutex> lock(mu_);
+    cfs_[table_id] = hold(handle);
+    FLOG_INFO("rocksdb column family %s created.", name.c_str());
+    return Status::OK();
+}
+
+Status TableColumnFamilies::Drop(uint64_t table_id, const std::string& start_key,
+                                 const std::string& end_key) {
+    ColumnFamilyPtr cf;
+    {
+        std::lock_guard<std::mutex> lock(mu_);
+        auto it = cfs_.find(table_id);
+        if (it == cfs_.end()) {
+            return Status(Status::kNotFound, "table column family", std::to_string(table_id));
+        }
+        cf = it->second;
+        cfs_.erase(it);
+    }
+
+    auto s = db_->DropColumnFamily(cf.get());
+    if (s.ok()) {
+        FLOG_INFO("rocksdb column family %s dropped.", cf->GetName().c_str());
+        return Status::OK();
+    }
+
+    FLOG_ERROR("drop rocksdb column family %s failed: %s", cf->GetName().c_str(),
+               s.ToString().c_str());
+    auto ret = Status(Status::kIOError, "drop column family", s.ToString());
+    s = db_->DeleteRange(rocksdb::WriteOptions(), cf.get(), start_key, end_key);
+    if (!s.ok()) {
+        FLOG_ERROR("delete range in column family %s failed: %s", cf->GetName().c_str(),
+                   s.ToString().c_str());
+    }
+    std::lock_guard<std::mutex> lock(mu_);
+    cfs_.emplace(table_id, std::move(cf));
+    return ret;
+}
+
+Status TableColumnFamilies::SetOptions(
+        uint64_t table_id, const std::unordered_map<std::string, std::string>& options) {
+    auto cf = Get(table_id);
+    if (cf == nullptr) {
+        return Status(Status::kNotFound, "table column family", std::to_string(table_id));
+    }
+    auto s = db_->SetOptions(cf.get(), options);
+    if (!s.ok()) {
+        return Status(Status::kIOError, "SetOptions", s.ToString());
+    }
+    return Status::OK();
+}
+
+Status TableColumnFamilies::Release(int wait_ms) {
+    std::vector<std::weak_ptr<rocksdb::ColumnFamilyHandle>> released;
+    {
+        std::lock_guard<std::mutex> lock(mu_);
+        for (const auto& p : cfs_) {
+            released.emplace_back(p.second);
+        }
+        cfs_.clear();
+    }
+
+    auto in_use = [&released] {
+        size_t count = 0;
+        for (const auto& cf : released) {
+            if (!cf.expired()) ++count;
+        }
+        return count;
+    };
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(wait_ms);
+    while (in_use() > 0 && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    // 仍被持有的handle在这里销毁，持有者之后释放时不再访问db
+    std::vector<ColumnFamilyPtr> held;  // 在释放owner锁之后析构
+    {
+        std::lock_guard<std::mutex> lock(owner_->mu);
+        for (const auto& w : released) {
+            auto cf = w.lock();
+            if (cf != nullptr) {
+                FLOG_WARN("rocksdb column family %s is still in use, destroy it.",
+                          cf->GetName().c_str());
+                owner_->db->DestroyColumnFamilyHandle(cf.get());
+                held.push_back(std::move(cf));
+            }
+        }
+        owner_->db = nullptr;
+    }
+
+    if (!held.empty()) {
+        return Status(Status::kBusy, "column family handles in use", std::to_string(held.size()));
+    }
+    return Status::OK();
+}
+
+}  // namespace storage
+}  // namespace dataserver
+}  // namespace sharkstore
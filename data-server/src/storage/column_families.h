@@ -0,0 +1,73 @@
+_Pragma("once");
+
+#include <stdint.h>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <rocksdb/db.h>
+
+#include "base/status.h"
+
+namespace sharkstore {
+namespace dataserver {
+namespace storage {
+
+using ColumnFamilyPtr = std::shared_ptr<rocksdb::ColumnFamilyHandle>;
+
+// 按表的column family（rocksdb.cf_per_table），名称为table_{table_id}
+// handle以shared_ptr分给各range的Store，最后一个持有者释放时销毁handle
+// 关闭db之前必须先Release，Release之后所有handle都已销毁
+class TableColumnFamilies {
+public:
+    TableColumnFamilies() = default;
+    ~TableColumnFamilies() = default;
+
+    TableColumnFamilies(const TableColumnFamilies&) = delete;
+    TableColumnFamilies& operator=(const TableColumnFamilies&) = delete;
+
+    static std::string Name(uint64_t table_id);
+    // 解析column family名称中的table id，不是表的column family时返回false
+    static bool ParseName(const std::string& name, uint64_t* table_id);
+
+    // 接管打开db时返回的handles，default及无法识别的handle直接销毁
+    void Load(rocksdb::DB* db, const std::vector<rocksdb::ColumnFamilyHandle*>& handles);
+
+    // 没有时返回nullptr
+    ColumnFamilyPtr Get(uint64_t table_id) const;
+    std::vector<ColumnFamilyPtr> GetAll() const;
+
+    // ttl大于0时db为DBWithTTL
+    Status Create(uint64_t table_id, const rocksdb::ColumnFamilyOptions& options, int ttl);
+    // drop失败时退回到删除[start_key, end_key)的数据，column family保留以便后续复用
+    Status Drop(uint64_t table_id, const std::string& start_key, const std::string& end_key);
+    Status SetOptions(uint64_t table_id,
+                      const std::unordered_map<std::string, std::string>& options);
+
+    // 释放所有handle，之后不能再使用
+    // 最多等待wait_ms让其他持有者（如未析构的range）释放，超时后仍强制销毁并返回kBusy
+    // 无论结果如何，返回后都可以关闭db
+    Status Release(int wait_ms = 0);
+
+private:
+    // 实际销毁handle的一方，Release后db为空，持有者之后的释放不再访问db
+    struct HandleOwner {
+        std::mutex mu;
+        rocksdb::DB* db = nullptr;
+    };
+
+    ColumnFamilyPtr hold(rocksdb::ColumnFamilyHandle* handle);
+
+private:
+    rocksdb::DB* db_ = nullptr;
+    std::shared_ptr<HandleOwner> owner_ = std::make_shared<HandleOwner>();
+    mutable std::mutex mu_;
+    std::map<uint64_t, ColumnFamilyPtr> cfs_;
+};
+
+}  // namespace storage
+}  // namespace dataserver
+}  // namespace sharkstore
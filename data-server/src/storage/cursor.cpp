@@ -0,0 +1,127 @@
+#include "cursor.h"
+
+#include "common/ds_config.h"
+
+namespace sharkstore {
+namespace dataserver {
+namespace storage {
+
+std::unique_ptr<RowFetcher> CursorCache::TakeFetcher(const std::string& signature,
+                                                     uint64_t offset, uint64_t version,
+                                                     bool* paging) {
+    std::unique_ptr<RowFetcher> fetcher;
+    std::list<Cursor> taken;
+    auto now = std::chrono::steady_clock::now();
+
+    std::lock_guard<std::mutex> lock(mu_);
+    expire(now);
+    for (auto it = cursors_.begin(); it != cursors_.end(); ++it) {
+        if (it->signature.empty() || it->offset != offset || it->signature != signature) {
+            continue;
+        }
+        *paging = true;
+        // 暂存之后range有写入，迭代器读不到新数据，不能续读
+        if (it->fetcher && it->version == version) {
+            fetcher = std::move(it->fetcher);
+        }
+        taken.splice(taken.end(), cursors_, it);
+        break;
+    }
+    return fetcher;
+}
+
+void CursorCache::PutFetcher(std::string signature, uint64_t offset, uint64_t version,
+                             std::unique_ptr<RowFetcher> fetcher) {
+    Cursor cursor;
+    cursor.version = version;
+    cursor.signature = std::move(signature);
+    cursor.offset = offset;
+    cursor.fetcher = std::move(fetcher);
+    put(std::move(cursor));
+}
+
+std::unique_ptr<Iterator> CursorCache::TakeIterator(const std::string& start,
+                                                    const std::string& limit,
+                                                    uint64_t snapshot_id, uint64_t version,
+                                                    bool* paging) {
+    std::unique_ptr<Iterator> iter;
+    std::list<Cursor> taken;
+    auto now = std::chrono::steady_clock::now();
+
+    std::lock_guard<std::mutex> lock(mu_);
+    expire(now);
+    for (auto it = cursors_.begin(); it != cursors_.end(); ++it) {
+        if (!it->signature.empty() || it->limit != limit || it->snapshot_id != snapshot_id ||
+            start <= it->last_key || start > it->next_key) {
+            continue;
+        }
+        *paging = true;
+        // 读快照的游标不受之后写入的影响
+        if (it->iter && (it->snapshot_id != 0 || it->version == version)) {
+            iter = std::move(it->iter);
+        }
+        taken.splice(taken.end(), cursors_, it);
+        break;
+    }
+    return iter;
+}
+
+void CursorCache::PutIterator(std::string last_key, std::string next_key, std::string limit,
+                              uint64_t snapshot_id, uint64_t version,
+                              std::unique_ptr<Iterator> iter) {
+    Cursor cursor;
+    cursor.version = version;
+    cursor.snapshot_id = snapshot_id;
+    cursor.last_key = std::move(last_key);
+    cursor.next_key = std::move(next_key);
+    cursor.limit = std::move(limit);
+    cursor.iter = std::move(iter);
+    put(std::move(cursor));
+}
+
+void CursorCache::put(Cursor&& cursor) {
+    size_t capacity = static_cast<size_t>(ds_config.range_config.max_cursors);
+    if (capacity == 0) return;
+
+    auto now = std::chrono::steady_clock::now();
+    cursor.expire_at = now + std::chrono::milliseconds(ds_config.range_config.cursor_ttl_ms);
+
+    // 被淘汰的游标在锁外析构
+    std::list<Cursor> evicted;
+    {
+        std::lock_guard<std::mutex> lock(mu_);
+        expire(now);
+        cursors_.push_back(std::move(cursor));
+        while (cursors_.size() > capacity) {
+            evicted.splice(evicted.end(), cursors_, cursors_.begin());
+        }
+    }
+}
+
+void CursorCache::expire(const TimePoint& now) {
+    while (!cursors_.empty() && cursors_.front().expire_at <= now) {
+        cursors_.pop_front();
+    }
+}
+
+void CursorCache::Expire() {
+    std::lock_guard<std::mutex> lock(mu_);
+    expire(std::chrono::steady_clock::now());
+}
+
+void CursorCache::Clear() {
+    std::list<Cursor> cursors;
+    {
+        std::lock_guard<std::mutex> lock(mu_);
+        cursors.swap(cursors_);
+    }
+}
+
+size_t CursorCache::Size() const {
+    std::lock_guard<std::mutex> lock(mu_);
+    return cursors_.size();
+}
+
+} /* namespace storage */
+} /* namespace dataserver */
+} /* namespace sharkstore */
@@ -0,0 +1,87 @@
+_Pragma("once");
+
+#include <chrono>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "iterator.h"
+#include "row_fetcher.h"
+
+namespace sharkstore {
+namespace dataserver {
+namespace storage {
+
+// 服务端游标缓存
+// 分页读取(select带offset、kv scan按last_key续扫)时, 把上一页读完后的迭代器暂存起来,
+// 下一页请求能接上时直接续读, 省掉重新seek以及跳过offset行的开销.
+// 只有确认在分页时才暂存迭代器: 第一页结束时只记下结束位置(不持有迭代器),
+// 下一页接上了这个位置, 说明客户端确实在翻页, 这一页结束时才暂存迭代器.
+// 游标带有创建迭代器前store的写版本, 之后range有任何写入时不再续读,
+// 保证续读的页能看到之前完成的写入(读快照的游标除外); 游标的数量和存活时间都有上限,
+// 避免长期钉住memtable和sst文件
+class CursorCache {
+public:
+    CursorCache() = default;
+    ~CursorCache() = default;
+
+    CursorCache(const CursorCache&) = delete;
+    CursorCache& operator=(const CursorCache&) = delete;
+
+    // select游标: signature相同且已经消费了offset行的游标才能续读
+    // paging返回是否接上了上一页(无论能否续读)
+    std::unique_ptr<RowFetcher> TakeFetcher(const std::string& signature, uint64_t offset,
+                                            uint64_t version, bool* paging);
+    // fetcher为空时只记下结束位置
+    void PutFetcher(std::string signature, uint64_t offset, uint64_t version,
+                    std::unique_ptr<RowFetcher> fetcher);
+
+    // scan游标: 上一页返回的最后一个key为last_key, 迭代器当前停在next_key,
+    // 新请求的start落在(last_key, next_key]且limit、读取的快照相同时可以续读
+    std::unique_ptr<Iterator> TakeIterator(const std::string& start, const std::string& limit,
+                                           uint64_t snapshot_id, uint64_t version,
+                                           bool* paging);
+    // iter为空时只记下结束位置
+    void PutIterator(std::string last_key, std::string next_key, std::string limit,
+                     uint64_t snapshot_id, uint64_t version, std::unique_ptr<Iterator> iter);
+
+    // 清理过期的游标
+    void Expire();
+    // range边界变化或数据被清空时调用
+    void Clear();
+
+    size_t Size() const;
+
+private:
+    using TimePoint = std::chrono::time_point<std::chrono::steady_clock>;
+
+    struct Cursor {
+        TimePoint expire_at;
+        uint64_t version = 0;
+
+        // select, fetcher为空时只是上一页结束的位置
+        std::string signature;
+        uint64_t offset = 0;
+        std::unique_ptr<RowFetcher> fetcher;
+
+        // scan, iter为空时只是上一页结束的位置
+        std::string last_key;
+        std::string next_key;
+        std::string limit;
+        uint64_t snapshot_id = 0;
+        std::unique_ptr<Iterator> iter;
+    };
+
+    void put(Cursor&& cursor);
+    void expire(const TimePoint& now);
+
+private:
+    mutable std::mutex mu_;
+    // 按放入时间排序, 超出容量时淘汰最老的
+    std::list<Cursor> cursors_;
+};
+
+} /* namespace storage */
+} /* namespace dataserver */
+} /* namespace sharkstore */
@@ -1,12 +1,16 @@
 #include "iterator.h"
 
+#include <time.h>
+
+#include "ttl.h"
+
 namespace sharkstore {
 namespace dataserver {
 namespace storage {
 
 Iterator::Iterator(rocksdb::Iterator* it, const std::string& start,
-                   const std::string& limit)
-    : rit_(it), limit_(limit) {
+                   const std::string& limit, bool ttl, SnapshotPtr snapshot)
+    : rit_(it), limit_(limit), ttl_(ttl), snapshot_(std::move(snapshot)) {
     assert(!start.empty());
     assert(!limit.empty());
     rit_->Seek(start);
@@ -14,7 +18,33 @@ Iterator::Iterator(rocksdb::Iterator* it, const std::string& start,
 
 Iterator::~Iterator() { delete rit_; }
 
-bool Iterator::Valid() { return rit_->Valid() && (key() < limit_); }
+bool Iterator::Valid() {
+    if (ttl_) {
+        skipExpired();
+    }
+    return rit_->Valid() && (key() < limit_);
+}
+
+void Iterator::skipExpired() {
+    auto now = static_cast<uint64_t>(time(nullptr));
+    uint64_t expire_at = 0;
+    while (rit_->Valid() && rit_->key().compare(limit_) < 0) {
+        auto v = rit_->value();
+        if (!DecodeTtlHeader(v.data(), v.size(), &expire_at) || !TtlExpired(expire_at, now)) {
+            break;
+        }
+        rit_->Next();
+    }
+}
+
+size_t Iterator::headerSize() {
+    if (!ttl_) {
+        return 0;
+    }
+    uint64_t expire_at = 0;
+    auto v = rit_->value();
+    return DecodeTtlHeader(v.data(), v.size(), &expire_at) ? kTtlHeaderSize : 0;
+}
 
 void Iterator::Next() { rit_->Next(); }
 
@@ -27,11 +57,15 @@ Status Iterator::status() {
 
 std::string Iterator::key() { return rit_->key().ToString(); }
 
-std::string Iterator::value() { return rit_->value().ToString(); }
+std::string Iterator::value() {
+    auto v = rit_->value();
+    auto n = headerSize();
+    return std::string(v.data() + n, v.size() - n);
+}
 
 uint64_t Iterator::key_size() { return rit_->key().size(); }
 
-uint64_t Iterator::value_size() { return rit_->value().size(); }
+uint64_t Iterator::value_size() { return rit_->value().size() - headerSize(); }
 
 } /* namespace storage */
 } /* namespace dataserver */
@@ -2,6 +2,7 @@ _Pragma("once");
 
 #include <rocksdb/db.h>
 #include "base/status.h"
+#include "snapshot_cache.h"
 
 namespace sharkstore {
 namespace dataserver {
@@ -11,8 +12,10 @@ class Metric;
 
 class Iterator {
 public:
+    // ttl为true时跳过已过期的值，并去掉返回值的TTL值头
+    // snapshot不为空时为创建it所用的快照，由迭代器持有到析构
     Iterator(rocksdb::Iterator* it, const std::string& start,
-             const std::string& limit);
+             const std::string& limit, bool ttl = false, SnapshotPtr snapshot = nullptr);
     ~Iterator();
 
     bool Valid();
@@ -25,9 +28,15 @@ public:
     uint64_t key_size();
     uint64_t value_size();
 
+private:
+    void skipExpired();
+    size_t headerSize();
+
 private:
     rocksdb::Iterator* rit_ = nullptr;
     const std::string limit_;
+    const bool ttl_ = false;
+    SnapshotPtr snapshot_;
 };
 
 } /* namespace storage */
@@ -0,0 +1,103 @@
+#include "load_sampler.h"
+
+#include <cmath>
+
+namespace sharkstore {
+namespace dataserver {
+namespace storage {
+
+// 候选点至少要统计到该比例的访问才参与选择（蓄水池中后替换进来的统计较少）
+static const double kMinSampleRatio = 0.25;
+// 左右访问差占比超过该值视为无法均衡
+static const double kMaxImbalance = 0.6;
+// 总访问数不足时不给出分裂点
+static const uint64_t kMinSplitCount = 100;
+
+LoadSampler::LoadSampler(size_t max_samples, uint32_t sample_rate)
+    : max_samples_(max_samples > 0 ? max_samples : 1),
+      sample_rate_(sample_rate > 0 ? sample_rate : 1),
+      rng_(std::random_device()()) {}
+
+// 每个线程各自的随机数，决定是否抽取时不需要加锁
+static bool hitSample(uint32_t rate) {
+    if (rate <= 1) return true;
+    static thread_local std::minstd_rand rng(std::random_device{}());
+    return rng() % rate == 0;
+}
+
+void LoadSampler::Start() {
+    std::lock_guard<std::mutex> lock(mu_);
+    count_ = 0;
+    samples_.clear();
+    running_ = true;
+}
+
+void LoadSampler::Stop() {
+    if (!running_) return;
+
+    std::lock_guard<std::mutex> lock(mu_);
+    running_ = false;
+    count_ = 0;
+    std::vector<Sample>().swap(samples_);
+}
+
+void LoadSampler::Add(const std::string& key) {
+    if (!running_ || !hitSample(sample_rate_)) return;
+
+    std::lock_guard<std::mutex> lock(mu_);
+    if (!running_) return;
+
+    ++count_;
+    for (auto& s : samples_) {
+        if (key < s.key) {
+            ++s.left;
+        } else {
+            ++s.right;
+        }
+    }
+
+    if (samples_.size() < max_samples_) {
+        Sample s;
+        s.key = key;
+        samples_.push_back(std::move(s));
+    } else {
+        auto r = rng_() % count_;
+        if (r < max_samples_) {
+            samples_[r] = Sample();
+            samples_[r].key = key;
+        }
+    }
+}
+
+std::string LoadSampler::SplitKey() const {
+    std::lock_guard<std::mutex> lock(mu_);
+    if (count_ < kMinSplitCount) {
+        return std::string();
+    }
+
+    const Sample* best = nullptr;
+    double best_imbalance = kMaxImbalance;
+    for (const auto& s : samples_) {
+        auto total = s.left + s.right;
+        if (s.left == 0 || s.right == 0 ||
+            static_cast<double>(total) < static_cast<double>(count_) * kMinSampleRatio) {
+            continue;
+        }
+        auto imbalance = std::fabs(static_cast<double>(s.left) - static_cast<double>(s.right)) /
+                         static_cast<double>(total);
+        if (imbalance <= best_imbalance) {
+            best_imbalance = imbalance;
+            best = &s;
+        }
+    }
+    return best != nullptr ? best->key : std::string();
+}
+
+uint64_t LoadSampler::Count() const {
+    std::lock_guard<std::mutex> lock(mu_);
+    return count_;
+}
+
+}  // namespace storage
+}  // namespace dataserver
+}  // namespace sharkstore
@@ -0,0 +1,61 @@
+_Pragma("once");
+
+#include <atomic>
+#include <mutex>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace sharkstore {
+namespace dataserver {
+namespace storage {
+
+// 热点range访问key的采样，用于按负载分裂
+// 用蓄水池采样保留一组访问过的key作为候选分裂点，
+// 每次访问统计落在各候选点左右两侧的次数，左右最均衡的候选点即为分裂点
+// 访问按1/sample_rate的概率随机抽取后才加锁统计，均匀抽样不改变左右的比例
+class LoadSampler {
+public:
+    static const size_t kDefaultMaxSamples = 20;
+    static const uint32_t kDefaultSampleRate = 16;
+
+    explicit LoadSampler(size_t max_samples = kDefaultMaxSamples,
+                         uint32_t sample_rate = kDefaultSampleRate);
+
+    LoadSampler(const LoadSampler&) = delete;
+    LoadSampler& operator=(const LoadSampler&) = delete;
+
+    // 清空之前的统计并开始采样
+    void Start();
+    void Stop();
+    bool Running() const { return running_; }
+
+    // 按概率抽取，未抽中时不加锁
+    void Add(const std::string& key);
+
+    // 返回左右访问最均衡的候选点，统计不足或都不够均衡（如单key热点）时返回空
+    std::string SplitKey() const;
+
+    // 抽取到的访问次数
+    uint64_t Count() const;
+
+private:
+    struct Sample {
+        std::string key;
+        uint64_t left = 0;   // 小于key的访问次数
+        uint64_t right = 0;  // 大于等于key的访问次数
+    };
+
+    const size_t max_samples_;
+    const uint32_t sample_rate_;
+    std::atomic<bool> running_ = {false};
+
+    mutable std::mutex mu_;
+    uint64_t count_ = 0;
+    std::vector<Sample> samples_;
+    std::mt19937_64 rng_;
+};
+
+}  // namespace storage
+}  // namespace dataserver
+}  // namespace sharkstore
@@ -0,0 +1,125 @@
+#include "merge_operator.h"
+
+#include <stdlib.h>
+
+#include "common/ds_encoding.h"
+
+namespace sharkstore {
+namespace dataserver {
+namespace storage {
+
+static bool decodeIncr(const rocksdb::Slice& operand, int64_t* delta) {
+    if (operand.size() != 9 || operand[0] != KvMergeOperator::kMergeIncr) {
+        return false;
+    }
+    std::string buf(operand.data(), operand.size());
+    size_t offset = 1;
+    uint64_t value = 0;
+    if (!DecodeUint64Ascending(buf, offset, &value)) {
+        return false;
+    }
+    *delta = static_cast<int64_t>(value);
+    return true;
+}
+
+static int64_t parseCounter(const rocksdb::Slice& value) {
+    if (value.empty() || value.size() > 20) {
+        return 0;
+    }
+    std::string str(value.data(), value.size());
+    char* end = nullptr;
+    int64_t n = strtoll(str.c_str(), &end, 10);
+    return (end != nullptr && *end == '\0') ? n : 0;
+}
+
+std::string KvMergeOperator::EncodeIncr(int64_t delta) {
+    std::string buf;
+    buf.push_back(kMergeIncr);
+    EncodeUint64Ascending(&buf, static_cast<uint64_t>(delta));
+    return buf;
+}
+
+std::string KvMergeOperator::EncodeAppend(const std::string& value) {
+    std::string buf;
+    buf.reserve(value.size() + 1);
+    buf.push_back(kMergeAppend);
+    buf.append(value);
+    return buf;
+}
+
+bool KvMergeOperator::FullMergeV2(const MergeOperationInput& merge_in,
+                                  MergeOperationOutput* merge_out) const {
+    auto& result = merge_out->new_value;
+    result.clear();
+    if (merge_in.existing_value != nullptr) {
+        result.assign(merge_in.existing_value->data(), merge_in.existing_value->size());
+    }
+
+    // 连续的incr在整数上累加（按无符号相加，溢出时回绕），遇到append时再转回字符串
+    bool is_counter = false;
+    uint64_t counter = 0;
+    for (const auto& op : merge_in.operand_list) {
+        int64_t delta = 0;
+        if (decodeIncr(op, &delta)) {
+            if (!is_counter) {
+                counter = static_cast<uint64_t>(parseCounter(result));
+                is_counter = true;
+            }
+            counter += static_cast<uint64_t>(delta);
+        } else if (!op.empty() && op[0] == kMergeAppend) {
+            if (is_counter) {
+                result = std::to_string(static_cast<int64_t>(counter));
+                is_counter = false;
+            }
+            result.append(op.data() + 1, op.size() - 1);
+        }
+    }
+    if (is_counter) {
+        result = std::to_string(static_cast<int64_t>(counter));
+    }
+    return true;
+}
+
+bool KvMergeOperator::PartialMergeMulti(const rocksdb::Slice& key,
+                                        const std::deque<rocksdb::Slice>& operand_list,
+                                        std::string* new_value, rocksdb::Logger* logger) const {
+    if (operand_list.empty()) {
+        return false;
+    }
+
+    // 只合并同类的操作数，混用时留给FullMerge处理
+    if (operand_list.front().empty()) {
+        return false;
+    }
+    const char type = operand_list.front()[0];
+    if (type == kMergeIncr) {
+        uint64_t sum = 0;
+        for (const auto& op : operand_list) {
+            int64_t delta = 0;
+            if (!decodeIncr(op, &delta)) {
+                return false;
+            }
+            sum += static_cast<uint64_t>(delta);
+        }
+        *new_value = EncodeIncr(static_cast<int64_t>(sum));
+        return true;
+    } else if (type == kMergeAppend) {
+        new_value->assign(1, kMergeAppend);
+        for (const auto& op : operand_list) {
+            if (op.empty() || op[0] != kMergeAppend) {
+                return false;
+            }
+            new_value->append(op.data() + 1, op.size() - 1);
+        }
+        return true;
+    }
+    return false;
+}
+
+std::shared_ptr<rocksdb::MergeOperator> NewKvMergeOperator() {
+    return std::make_shared<KvMergeOperator>();
+}
+
+}  // namespace storage
+}  // namespace dataserver
+}  // namespace sharkstore
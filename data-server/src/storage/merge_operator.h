@@ -0,0 +1,44 @@
+_Pragma("once");
+
+#include <stdint.h>
+#include <deque>
+#include <memory>
+#include <string>
+
+#include <rocksdb/merge_operator.h>
+
+namespace sharkstore {
+namespace dataserver {
+namespace storage {
+
+// kv的原子读改写，通过rocksdb merge实现，写入时不需要读取旧值
+// 每个操作数第一个字节为操作类型：
+//   kMergeIncr   后跟8字节有符号增量，值按十进制整数解释（与redis incr一致），
+//                key不存在或旧值不是整数时从0开始，溢出时回绕
+//   kMergeAppend 后跟追加的内容
+// 两种操作混用时按顺序依次作用在值上
+class KvMergeOperator : public rocksdb::MergeOperator {
+public:
+    static const char kMergeIncr = 'i';
+    static const char kMergeAppend = 'a';
+
+    static std::string EncodeIncr(int64_t delta);
+    static std::string EncodeAppend(const std::string& value);
+
+    bool FullMergeV2(const MergeOperationInput& merge_in,
+                     MergeOperationOutput* merge_out) const override;
+
+    bool PartialMergeMulti(const rocksdb::Slice& key,
+                           const std::deque<rocksdb::Slice>& operand_list,
+                           std::string* new_value, rocksdb::Logger* logger) const override;
+
+    bool AllowSingleOperand() const override { return true; }
+
+    const char* Name() const override { return "sharkstore.KvMergeOperator"; }
+};
+
+std::shared_ptr<rocksdb::MergeOperator> NewKvMergeOperator();
+
+}  // namespace storage
+}  // namespace dataserver
+}  // namespace sharkstore
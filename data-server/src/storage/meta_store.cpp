@@ -186,6 +186,74 @@ Status MetaStore::DeleteApplyIndex(uint64_t range_id) {
     }
 }
 
+Status MetaStore::SaveMergeState(uint64_t range_id, uint64_t target_id) {
+    std::string key = kRangeMergePrefix + std::to_string(range_id);
+    auto ret =
+        db_->Put(write_options_, key, std::to_string(target_id));
+    if (ret.ok()) {
+        return Status::OK();
+    } else {
+        return Status(Status::kIOError, "meta save merge", ret.ToString());
+    }
+}
+
+Status MetaStore::LoadMergeState(uint64_t range_id, uint64_t *target_id) {
+    std::string key = kRangeMergePrefix + std::to_string(range_id);
+    std::string value;
+    auto ret = db_->Get(rocksdb::ReadOptions(), key, &value);
+    if (ret.ok()) {
+        try {
+            *target_id = std::stoull(value);
+        } catch (std::exception &e) {
+            return Status(Status::kCorruption, "invalid merge state", EncodeToHex(value));
+        }
+        return Status::OK();
+    } else if (ret.IsNotFound()) {
+        *target_id = 0;
+        return Status::OK();
+    } else {
+        return Status(Status::kIOError, "meta load merge", ret.ToString());
+    }
+}
+
+Status MetaStore::DeleteMergeState(uint64_t range_id) {
+    std::string key = kRangeMergePrefix + std::to_string(range_id);
+    auto ret = db_->Delete(write_options_, key);
+    if (ret.ok()) {
+        return Status::OK();
+    } else {
+        return Status(Status::kIOError, "meta delete merge", ret.ToString());
+    }
+}
+
+Status MetaStore::AddTtlTable(uint64_t table_id) {
+    std::string key = kTtlTablePrefix + std::to_string(table_id);
+    auto ret = db_->Put(write_options_, key, "");
+    if (ret.ok()) {
+        return Status::OK();
+    } else {
+        return Status(Status::kIOError, "meta save ttl table", ret.ToString());
+    }
+}
+
+Status MetaStore::GetTtlTables(std::vector<uint64_t>* table_ids) {
+    std::unique_ptr<rocksdb::Iterator> it(db_->NewIterator(rocksdb::ReadOptions()));
+    it->Seek(kTtlTablePrefix);
+    while (it->Valid() && it->key().starts_with(kTtlTablePrefix)) {
+        auto id = it->key().ToString().substr(kTtlTablePrefix.size());
+        try {
+            table_ids->push_back(std::stoull(id));
+        } catch (std::exception &e) {
+            return Status(Status::kCorruption, "invalid ttl table", EncodeToHex(id));
+        }
+        it->Next();
+    }
+    if (!it->status().ok()) {
+        return Status(Status::kIOError, "iterator", it->status().ToString());
+    }
+    return Status::OK();
+}
+
 }  // namespace storage
 }  // namespace dataserver
 }  // namespace sharkstore
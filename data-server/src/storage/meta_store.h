@@ -16,6 +16,8 @@ namespace storage {
 static const std::string kRangeMetaPrefix = "\x02";
 static const std::string kRangeApplyPrefix = "\x03";
 static const std::string kNodeIDKey = "\x04NodeID";
+static const std::string kRangeMergePrefix = "\x05";
+static const std::string kTtlTablePrefix = "\x06";
 
 class MetaStore {
 public:
@@ -41,6 +43,15 @@ public:
     Status LoadApplyIndex(uint64_t range_id, uint64_t* apply_index);
     Status DeleteApplyIndex(uint64_t range_id);
 
+    // range合并时被合并的range记录其合并到的range id，不存在时为0
+    Status SaveMergeState(uint64_t range_id, uint64_t target_id);
+    Status LoadMergeState(uint64_t range_id, uint64_t* target_id);
+    Status DeleteMergeState(uint64_t range_id);
+
+    // 开启过TTL的表，这些表的值都带有TTL值头
+    Status AddTtlTable(uint64_t table_id);
+    Status GetTtlTables(std::vector<uint64_t>* table_ids);
+
 private:
     const std::string path_;
     rocksdb::WriteOptions write_options_;
@@ -0,0 +1,105 @@
+#include "perf_stats.h"
+
+#include <rocksdb/iostats_context.h>
+#include <rocksdb/perf_context.h>
+#include <rocksdb/perf_level.h>
+
+#include "common/ds_config.h"
+
+namespace sharkstore {
+namespace dataserver {
+namespace storage {
+
+void PerfStat::Add(const PerfStat& other) {
+    samples += other.samples;
+    block_cache_hits += other.block_cache_hits;
+    block_reads += other.block_reads;
+    block_read_bytes += other.block_read_bytes;
+    block_read_nanos += other.block_read_nanos;
+    memtable_nanos += other.memtable_nanos;
+    sst_nanos += other.sst_nanos;
+    iter_seek_nanos += other.iter_seek_nanos;
+    keys_skipped += other.keys_skipped;
+    deletes_skipped += other.deletes_skipped;
+    io_read_bytes += other.io_read_bytes;
+    io_read_nanos += other.io_read_nanos;
+}
+
+void PerfCounter::Add(const PerfStat& stat) {
+    std::lock_guard<std::mutex> lock(mu_);
+    stat_.Add(stat);
+}
+
+void PerfCounter::Get(PerfStat* stat) const {
+    std::lock_guard<std::mutex> lock(mu_);
+    *stat = stat_;
+}
+
+static std::mutex g_func_perf_mu;
+static std::map<int, PerfStat> g_func_perf_stats;
+
+void GetFuncPerfStats(std::map<int, PerfStat>* stats) {
+    std::lock_guard<std::mutex> lock(g_func_perf_mu);
+    *stats = g_func_perf_stats;
+}
+
+void GetTotalPerfStats(PerfStat* stat) {
+    std::lock_guard<std::mutex> lock(g_func_perf_mu);
+    *stat = PerfStat();
+    for (const auto& it : g_func_perf_stats) {
+        stat->Add(it.second);
+    }
+}
+
+// 每个线程的请求计数，及当前是否在采样中（嵌套的作用域不重复采样）
+static thread_local uint64_t t_perf_requests = 0;
+static thread_local bool t_perf_sampling = false;
+
+PerfScope::PerfScope(int func_id, PerfCounter* counter) : func_id_(func_id), counter_(counter) {
+    auto rate = ds_config.rocksdb_config.perf_sample_rate;
+    if (rate <= 0 || t_perf_sampling || ++t_perf_requests % rate != 0) {
+        return;
+    }
+
+    sampled_ = true;
+    t_perf_sampling = true;
+    prev_level_ = static_cast<int>(rocksdb::GetPerfLevel());
+    rocksdb::SetPerfLevel(rocksdb::kEnableTimeExceptForMutex);
+    rocksdb::get_perf_context()->Reset();
+    rocksdb::get_iostats_context()->Reset();
+}
+
+PerfScope::~PerfScope() {
+    if (!sampled_) {
+        return;
+    }
+
+    const auto pc = rocksdb::get_perf_context();
+    const auto ioc = rocksdb::get_iostats_context();
+    PerfStat stat;
+    stat.samples = 1;
+    stat.block_cache_hits = pc->block_cache_hit_count;
+    stat.block_reads = pc->block_read_count;
+    stat.block_read_bytes = pc->block_read_byte;
+    stat.block_read_nanos = pc->block_read_time;
+    stat.memtable_nanos = pc->get_from_memtable_time + pc->seek_on_memtable_time;
+    stat.sst_nanos = pc->get_from_output_files_time;
+    stat.iter_seek_nanos = pc->seek_internal_seek_time + pc->find_next_user_entry_time;
+    stat.keys_skipped = pc->internal_key_skipped_count;
+    stat.deletes_skipped = pc->internal_delete_skipped_count;
+    stat.io_read_bytes = ioc->bytes_read;
+    stat.io_read_nanos = ioc->read_nanos;
+
+    rocksdb::SetPerfLevel(static_cast<rocksdb::PerfLevel>(prev_level_));
+    t_perf_sampling = false;
+
+    if (counter_ != nullptr) {
+        counter_->Add(stat);
+    }
+    std::lock_guard<std::mutex> lock(g_func_perf_mu);
+    g_func_perf_stats[func_id_].Add(stat);
+}
+
+}  // namespace storage
+}  // namespace dataserver
+}  // namespace sharkstore
@@ -0,0 +1,69 @@
+_Pragma("once");
+
+#include <stdint.h>
+#include <map>
+#include <mutex>
+
+namespace sharkstore {
+namespace dataserver {
+namespace storage {
+
+// 采样请求的rocksdb PerfContext、IOStatsContext累计值
+struct PerfStat {
+    uint64_t samples = 0;           // 采样的请求数
+    uint64_t block_cache_hits = 0;
+    uint64_t block_reads = 0;       // 未命中block cache，从文件读取的block数
+    uint64_t block_read_bytes = 0;
+    uint64_t block_read_nanos = 0;
+    uint64_t memtable_nanos = 0;    // 在memtable中查找的耗时
+    uint64_t sst_nanos = 0;         // 点查在sst文件中查找的耗时
+    uint64_t iter_seek_nanos = 0;   // 迭代器seek及跳过无效key的耗时
+    uint64_t keys_skipped = 0;      // 迭代时跳过的旧版本key
+    uint64_t deletes_skipped = 0;   // 迭代时跳过的删除标记
+    uint64_t io_read_bytes = 0;
+    uint64_t io_read_nanos = 0;
+
+    void Add(const PerfStat& other);
+};
+
+// 一组请求（同一请求类型或同一range）的采样统计，只累加不清零
+class PerfCounter {
+public:
+    void Add(const PerfStat& stat);
+    void Get(PerfStat* stat) const;
+
+private:
+    mutable std::mutex mu_;
+    PerfStat stat_;
+};
+
+// 取得按请求类型（func id）聚合的统计
+void GetFuncPerfStats(std::map<int, PerfStat>* stats);
+
+// 取得所有请求类型的累计统计之和
+void GetTotalPerfStats(PerfStat* stat);
+
+// 在作用域内采样一次请求的rocksdb PerfContext和IOStatsContext
+// 每个线程每rocksdb.perf_sample_rate个请求采样一个，0表示关闭
+// 读请求在工作线程中同步执行，作用域内的rocksdb调用都会计入
+// 结果累加到请求类型的全局统计和range的统计（counter不为空时）
+class PerfScope {
+public:
+    PerfScope(int func_id, PerfCounter* counter);
+    ~PerfScope();
+
+    PerfScope(const PerfScope&) = delete;
+    PerfScope& operator=(const PerfScope&) = delete;
+
+    bool Sampled() const { return sampled_; }
+
+private:
+    const int func_id_;
+    PerfCounter* const counter_;
+    bool sampled_ = false;
+    int prev_level_ = 0;
+};
+
+}  // namespace storage
+}  // namespace dataserver
+}  // namespace sharkstore
@@ -11,16 +11,19 @@ namespace storage {
 
 static const size_t kIteratorTooManyKeys = 1000;
 
-RowFetcher::RowFetcher(Store& s, const kvrpcpb::SelectRequest& req)
+RowFetcher::RowFetcher(Store& s, const kvrpcpb::SelectRequest& req, SnapshotPtr snapshot)
     : store_(s),
-      decoder_(s.GetPrimaryKeys(), req.field_list(), req.where_filters()) {
-    init(req.key(), req.scope());
+      decoder_(s.GetPrimaryKeys(), req.field_list(), req.where_filters()),
+      snapshot_(std::move(snapshot)) {
+    // 没有limit的（包括聚合）按全范围扫描
+    uint64_t rows = req.has_limit() ? req.limit().offset() + req.limit().count() : 0;
+    init(req.key(), req.scope(), rows);
 }
 
 RowFetcher::RowFetcher(Store& s, const kvrpcpb::DeleteRequest& req)
     : store_(s),
       decoder_(s.GetPrimaryKeys(), req.where_filters()) {
-    init(req.key(), req.scope());
+    init(req.key(), req.scope(), 0);
 }
 
 RowFetcher::~RowFetcher() { delete iter_; }
@@ -37,12 +40,13 @@ Status RowFetcher::Next(RowResult* result, bool* over) {
     }
 }
 
-void RowFetcher::init(const std::string& key, const ::kvrpcpb::Scope& scope) {
+void RowFetcher::init(const std::string& key, const ::kvrpcpb::Scope& scope,
+                      uint64_t expected_rows) {
     if (!key.empty()) {
         key_ = key;
         return;
     }
-    iter_ = store_.NewIterator(scope);
+    iter_ = store_.NewScanIterator(scope.start(), scope.limit(), expected_rows, snapshot_);
 }
 
 Status RowFetcher::nextOneKey(RowResult* result, bool* over) {
@@ -55,7 +59,7 @@ Status RowFetcher::nextOneKey(RowResult* result, bool* over) {
     }
 
     std::string buf;
-    last_status_ = store_.Get(key_, &buf);
+    last_status_ = store_.Get(key_, &buf, snapshot_.get());
     iter_count_++;
     if (last_status_.code() == Status::kNotFound) {
         last_status_ = Status::OK();
@@ -84,6 +88,10 @@ Status RowFetcher::nextScope(RowResult* result, bool* over) {
         auto value = iter_->value();
 
         store_.addMetricRead(1, key.size() + value.size());
+        if (!sampled_) {
+            store_.sampleKey(key);
+            sampled_ = true;
+        }
         // check iterator too many keys
         ++iter_count_;
         if (iter_count_ % kIteratorTooManyKeys == kIteratorTooManyKeys - 1) {
@@ -11,7 +11,8 @@ namespace storage {
 
 class RowFetcher {
 public:
-    RowFetcher(Store& s, const kvrpcpb::SelectRequest& req);
+    // snapshot不为空时读取该快照
+    RowFetcher(Store& s, const kvrpcpb::SelectRequest& req, SnapshotPtr snapshot = nullptr);
     RowFetcher(Store& s, const kvrpcpb::DeleteRequest& req);
 
     ~RowFetcher();
@@ -21,8 +22,11 @@ public:
 
     Status Next(RowResult* result, bool* over);
 
+    // 翻页续用时调用，新请求扫描到的第一个key重新参与负载采样
+    void ResetSample() { sampled_ = false; }
+
 private:
-    void init(const std::string& key, const ::kvrpcpb::Scope& scope);
+    void init(const std::string& key, const ::kvrpcpb::Scope& scope, uint64_t expected_rows);
     Status nextOneKey(RowResult* result, bool* over);
     Status nextScope(RowResult* result, bool* over);
 
@@ -32,9 +36,11 @@ private:
 
     std::string key_;
     Iterator* iter_ = nullptr;
+    SnapshotPtr snapshot_;  // 快照读的select读取的快照
     Status last_status_;
     bool matched_ = false;
     size_t iter_count_ = 0;
+    bool sampled_ = false;  // 一次扫描请求只采样一次
 };
 
 } /* namespace storage */
@@ -0,0 +1,85 @@
+#include "snapshot_cache.h"
+
+#include <atomic>
+
+#include "common/ds_config.h"
+#include "frame/sf_util.h"
+
+namespace sharkstore {
+namespace dataserver {
+namespace storage {
+
+// 以启动时间（微秒）为起点，重启后分配的id不会与之前的重复
+static std::atomic<uint64_t> g_snapshot_id{static_cast<uint64_t>(get_micro_second())};
+
+SnapshotPtr SnapshotCache::Open(uint64_t* id) {
+    size_t capacity = static_cast<size_t>(ds_config.range_config.max_snapshots);
+    if (capacity == 0) return nullptr;
+
+    auto now = std::chrono::steady_clock::now();
+    auto db = db_;
+    Entry entry;
+    entry.id = ++g_snapshot_id;
+    entry.snapshot = SnapshotPtr(db->GetSnapshot(),
+                                 [db](const rocksdb::Snapshot* s) { db->ReleaseSnapshot(s); });
+    entry.expire_at = now + std::chrono::milliseconds(ds_config.range_config.snapshot_ttl_ms);
+    *id = entry.id;
+    auto snapshot = entry.snapshot;
+
+    // 被淘汰的快照在锁外释放
+    std::list<Entry> evicted;
+    std::lock_guard<std::mutex> lock(mu_);
+    expire(now, &evicted);
+    entries_.push_back(std::move(entry));
+    while (entries_.size() > capacity) {
+        evicted.splice(evicted.end(), entries_, entries_.begin());
+    }
+    return snapshot;
+}
+
+SnapshotPtr SnapshotCache::Get(uint64_t id) {
+    auto now = std::chrono::steady_clock::now();
+    auto expire_at = now + std::chrono::milliseconds(ds_config.range_config.snapshot_ttl_ms);
+
+    std::list<Entry> expired;
+    std::lock_guard<std::mutex> lock(mu_);
+    expire(now, &expired);
+    for (auto it = entries_.begin(); it != entries_.end(); ++it) {
+        if (it->id == id) {
+            it->expire_at = expire_at;
+            entries_.splice(entries_.end(), entries_, it);
+            return entries_.back().snapshot;
+        }
+    }
+    return nullptr;
+}
+
+void SnapshotCache::expire(const TimePoint& now, std::list<Entry>* expired) {
+    // 按使用时间排序，空闲时间固定，头部最先过期
+    while (!entries_.empty() && entries_.front().expire_at <= now) {
+        expired->splice(expired->end(), entries_, entries_.begin());
+    }
+}
+
+void SnapshotCache::Expire() {
+    std::list<Entry> expired;
+    std::lock_guard<std::mutex> lock(mu_);
+    expire(std::chrono::steady_clock::now(), &expired);
+}
+
+void SnapshotCache::Clear() {
+    std::list<Entry> entries;
+    {
+        std::lock_guard<std::mutex> lock(mu_);
+        entries.swap(entries_);
+    }
+}
+
+size_t SnapshotCache::Size() const {
+    std::lock_guard<std::mutex> lock(mu_);
+    return entries_.size();
+}
+
+}  // namespace storage
+}  // namespace dataserver
+}  // namespace sharkstore
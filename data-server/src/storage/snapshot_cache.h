@@ -0,0 +1,64 @@
+_Pragma("once");
+
+#include <chrono>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <stdint.h>
+
+#include <rocksdb/db.h>
+
+namespace sharkstore {
+namespace dataserver {
+namespace storage {
+
+using SnapshotPtr = std::shared_ptr<const rocksdb::Snapshot>;
+
+// 缓存的rocksdb快照，用于一致的时间点读
+// 快照由请求显式创建（select的open_snapshot），以返回的id读取同一个快照；
+// 导出等分页读取即使游标过期或被淘汰，各页看到的也是同一份数据
+// 快照数量(range.max_snapshots)和空闲时间(range.snapshot_ttl_ms)有上限，
+// 超出数量时淘汰最久未使用的；被淘汰的快照在仍在使用它的读取结束后释放
+// 快照不再存在时Get返回空，由调用方返回错误，不会换成新的快照
+class SnapshotCache {
+public:
+    explicit SnapshotCache(rocksdb::DB* db) : db_(db) {}
+    ~SnapshotCache() = default;
+
+    SnapshotCache(const SnapshotCache&) = delete;
+    SnapshotCache& operator=(const SnapshotCache&) = delete;
+
+    // 创建快照，id在进程内唯一且不与重启前的重复；快照读关闭时返回空
+    SnapshotPtr Open(uint64_t* id);
+    // 取id对应的快照，已过期或被淘汰时返回空
+    SnapshotPtr Get(uint64_t id);
+
+    // 清理空闲超时的快照
+    void Expire();
+    // 数据被清空时调用
+    void Clear();
+
+    size_t Size() const;
+
+private:
+    using TimePoint = std::chrono::time_point<std::chrono::steady_clock>;
+
+    struct Entry {
+        uint64_t id = 0;
+        SnapshotPtr snapshot;
+        TimePoint expire_at;
+    };
+
+    void expire(const TimePoint& now, std::list<Entry>* expired);
+
+private:
+    rocksdb::DB* const db_;
+
+    mutable std::mutex mu_;
+    // 按最近使用时间排序，最近使用的在尾部
+    std::list<Entry> entries_;
+};
+
+}  // namespace storage
+}  // namespace dataserver
+}  // namespace sharkstore
@@ -1,14 +1,25 @@
 #include "store.h"
+
+#include <time.h>
+#include <algorithm>
+#include <cinttypes>
+#include <set>
+#include <sstream>
 #include <common/ds_config.h>
+#include <rocksdb/table_properties.h>
 
 #include "aggregate_calc.h"
+#include "cursor.h"
 #include "base/util.h"
 #include "common/ds_config.h"
 #include "common/ds_encoding.h"
 #include "field_value.h"
+#include "frame/sf_logger.h"
+#include "merge_operator.h"
 #include "proto/gen/raft_cmdpb.pb.h"
 #include "proto/gen/redispb.pb.h"
 #include "row_fetcher.h"
+#include "ttl.h"
 
 namespace sharkstore {
 
@@ -17,25 +28,83 @@ namespace storage {
 
 static const size_t kDefaultMaxSelectLimit = 10000;
 
-//声明一个KEY
-static std::string GetRealKey(std::string& key) {
-    if (key.size() <= kRowPrefixLength) return "";
+static std::set<uint64_t> g_low_pri_tables;
+
+static std::set<uint64_t> g_high_pri_tables;
+
+// 解析逗号分隔的table id
+static Status parseTables(const std::string& conf, const char* what,
+                          std::set<uint64_t>* tables) {
+    std::stringstream ss(conf);
+    std::string item;
+    while (std::getline(ss, item, ',')) {
+        if (item.find_first_not_of(" \t") == std::string::npos) {
+            continue;
+        }
+        try {
+            tables->insert(std::stoull(item));
+        } catch (std::exception& e) {
+            return Status(Status::kInvalidArgument, what, item);
+        }
+    }
+    return Status::OK();
+}
+
+Status InitLowPriTables(const std::string& conf) {
+    std::set<uint64_t> tables;
+    auto s = parseTables(conf, "low priority table", &tables);
+    if (s.ok()) {
+        g_low_pri_tables.swap(tables);
+    }
+    return s;
+}
+
+bool IsLowPriTable(uint64_t table_id) {
+    return g_low_pri_tables.find(table_id) != g_low_pri_tables.end();
+}
+
+Status InitHighPriTables(const std::string& conf) {
+    std::set<uint64_t> tables;
+    auto s = parseTables(conf, "high priority table", &tables);
+    if (s.ok()) {
+        g_high_pri_tables.swap(tables);
+    }
+    return s;
+}
+
+bool IsHighPriTable(uint64_t table_id) {
+    return g_high_pri_tables.find(table_id) != g_high_pri_tables.end();
+}
+
+bool HasHighPriTables() { return !g_high_pri_tables.empty(); }
+
+//声明一个KEY, 解码到real_key中（复用其内存）, 失败时real_key为空
+static void GetRealKey(const std::string& key, std::string* real_key) {
+    real_key->clear();
+    if (key.size() <= kRowPrefixLength) return;
     size_t pos = kRowPrefixLength;
     // skip ns
-    if (!DecodeVarintAscending(key, pos, nullptr)) return "";
-    std::string realKey;
-    if (!DecodeBytesAscending(key, pos, &realKey)) return "";
+    if (!DecodeVarintAscending(key, pos, nullptr)) return;
+    if (!DecodeBytesAscending(key, pos, real_key)) {
+        real_key->clear();
+        return;
+    }
     int64_t type = 0;
-    if (!DecodeVarintAscending(key, pos, &type)) return "";
-
-    return realKey;
+    if (!DecodeVarintAscending(key, pos, &type)) real_key->clear();
 }
 
-Store::Store(const metapb::Range& meta, rocksdb::DB* db)
+Store::Store(const metapb::Range& meta, rocksdb::DB* db,
+             std::shared_ptr<rocksdb::ColumnFamilyHandle> cf)
     : range_id_(meta.id()),
       start_key_(meta.start_key()),
       end_key_(meta.end_key()),
-      db_(db) {
+      db_(db),
+      cf_holder_(std::move(cf)),
+      cf_(cf_holder_ ? cf_holder_.get() : db->DefaultColumnFamily()),
+      ttl_(GetTableTtl(meta.table_id())),
+      low_pri_(IsLowPriTable(meta.table_id())),
+      cursors_(new CursorCache),
+      snapshots_(new SnapshotCache(db)) {
     assert(!start_key_.empty());
     assert(!end_key_.empty());
     assert(meta.primary_keys_size() > 0);
@@ -48,10 +117,17 @@ Store::Store(const metapb::Range& meta, rocksdb::DB* db)
 
 Store::~Store() {}
 
-Status Store::Get(const std::string& key, std::string* value) {
-    rocksdb::Status s = db_->Get(rocksdb::ReadOptions(ds_config.rocksdb_config.read_checksum,true), key, value);
+Status Store::Get(const std::string& key, std::string* value,
+                  const rocksdb::Snapshot* snapshot) {
+    rocksdb::ReadOptions opts(ds_config.rocksdb_config.read_checksum, true);
+    opts.snapshot = snapshot;
+    rocksdb::Status s = db_->Get(opts, cf_, key, value);
     if (s.ok()) {
         addMetricRead(1, key.size() + value->size());
+        if (ttl_ != kNoTtl && !stripTtl(value)) {
+            return Status(Status::kNotFound);
+        }
+        sampleKey(key);
         return Status::OK();
     } else if (s.IsNotFound()) {
         return Status(Status::kNotFound);
@@ -60,26 +136,94 @@ Status Store::Get(const std::string& key, std::string* value) {
     }
 }
 
-Status Store::Put(const std::string& key, const std::string& value) {
+Status Store::Put(const std::string& key, const std::string& value, uint64_t expire_at) {
     rocksdb::Status s;
     if(ds_config.rocksdb_config.storage_type == 1 && ds_config.rocksdb_config.ttl > 0){
         auto *blobdb = static_cast<rocksdb::blob_db::BlobDB*>(db_);
         s = blobdb->PutWithTTL(write_options_,rocksdb::Slice(key),rocksdb::Slice(value),ds_config.rocksdb_config.ttl);
-    }else{
-        s = db_->Put(write_options_, key, value);
+    } else if (ttl_ != kNoTtl) {
+        s = db_->Put(write_options_, cf_, key, ttlValue(value, expire_at));
+    } else {
+        s = db_->Put(write_options_, cf_, key, value);
     }
 
     if (s.ok()) {
+        bumpWriteVersion();
         addMetricWrite(1, key.size() + value.size());
+        sampleKey(key);
         return Status::OK();
     }
     return Status(Status::kIOError, "put", s.ToString());
 }
 
+Status Store::Increment(const std::string& key, int64_t delta, uint64_t apply_index) {
+    return merge(key, KvMergeOperator::EncodeIncr(delta), apply_index);
+}
+
+Status Store::Append(const std::string& key, const std::string& value, uint64_t apply_index) {
+    return merge(key, KvMergeOperator::EncodeAppend(value), apply_index);
+}
+
+Status Store::merge(const std::string& key, const std::string& operand, uint64_t apply_index) {
+    if (ds_config.rocksdb_config.storage_type != 0) {
+        return Status(Status::kNotSupported, "merge", "blob db");
+    }
+    if (ttl_ != kNoTtl) {
+        return Status(Status::kNotSupported, "merge", "ttl table");
+    }
+    rocksdb::WriteBatch batch;
+    batch.Merge(cf_, key, operand);
+    if (apply_index != 0) {
+        batch.Put(cf_, applyIndexKey(), std::to_string(apply_index));
+    }
+    auto s = db_->Write(write_options_, &batch);
+    if (s.ok()) {
+        bumpWriteVersion();
+        addMetricWrite(1, key.size() + operand.size());
+        sampleKey(key);
+        return Status::OK();
+    }
+    return Status(Status::kIOError, "merge", s.ToString());
+}
+
+std::string Store::applyIndexKey() const {
+    std::string key(1, '\x00');
+    key.append("apply");
+    EncodeUint64Ascending(&key, range_id_);
+    return key;
+}
+
+Status Store::LoadApplyIndex(uint64_t* apply_index) {
+    std::string value;
+    auto s = db_->Get(rocksdb::ReadOptions(), cf_, applyIndexKey(), &value);
+    if (s.IsNotFound()) {
+        *apply_index = 0;
+        return Status::OK();
+    } else if (!s.ok()) {
+        return Status(Status::kIOError, "load apply index", s.ToString());
+    }
+    try {
+        *apply_index = std::stoull(value);
+    } catch (std::exception& e) {
+        return Status(Status::kCorruption, "invalid apply index", EncodeToHex(value));
+    }
+    return Status::OK();
+}
+
+Status Store::DeleteApplyIndex() {
+    auto s = db_->Delete(write_options_, cf_, applyIndexKey());
+    if (!s.ok()) {
+        return Status(Status::kIOError, "delete apply index", s.ToString());
+    }
+    return Status::OK();
+}
+
 Status Store::Delete(const std::string& key) {
-    rocksdb::Status s = db_->Delete(write_options_, key);
+    rocksdb::Status s = db_->Delete(write_options_, cf_, key);
     if (s.ok()) {
+        bumpWriteVersion();
         addMetricWrite(1, key.size());
+        sampleKey(key);
         return Status::OK();
     } else if (s.IsNotFound()) {
         return Status(Status::kNotFound);
@@ -88,28 +232,91 @@ Status Store::Delete(const std::string& key) {
     }
 }
 
-Status Store::Insert(const kvrpcpb::InsertRequest& req, uint64_t* affected) {
+std::vector<Status> Store::MultiGet(const std::vector<std::string>& keys,
+                                    std::vector<std::string>* values) {
+    values->clear();
+    values->resize(keys.size());
+    std::vector<Status> result(keys.size());
+    if (keys.empty()) return result;
+
+    // 按key排序后再读, 相邻的key大概率落在同一个data block, 减少block cache查找
+    std::vector<size_t> order(keys.size());
+    for (size_t i = 0; i < order.size(); ++i) {
+        order[i] = i;
+    }
+    std::sort(order.begin(), order.end(),
+              [&keys](size_t a, size_t b) { return keys[a] < keys[b]; });
+
+    std::vector<rocksdb::Slice> sorted_keys;
+    sorted_keys.reserve(keys.size());
+    for (auto idx : order) {
+        sorted_keys.emplace_back(keys[idx]);
+    }
+    std::vector<rocksdb::ColumnFamilyHandle*> cfs(keys.size(), cf_);
+    std::vector<std::string> sorted_values;
+
+    // rocksdb MultiGet内部整批只取一次sequence, 所有key读到的是同一时刻的视图
+    auto ss = db_->MultiGet(rocksdb::ReadOptions(ds_config.rocksdb_config.read_checksum, true),
+                            cfs, sorted_keys, &sorted_values);
+
+    uint64_t keys_read = 0;
+    uint64_t bytes_read = 0;
+    for (size_t i = 0; i < order.size(); ++i) {
+        auto idx = order[i];
+        if (ss[i].ok() && ttl_ != kNoTtl && !stripTtl(&sorted_values[i])) {
+            result[idx] = Status(Status::kNotFound);
+        } else if (ss[i].ok()) {
+            (*values)[idx].swap(sorted_values[i]);
+            sampleKey(keys[idx]);
+            ++keys_read;
+            bytes_read += keys[idx].size() + (*values)[idx].size();
+        } else if (ss[i].IsNotFound()) {
+            result[idx] = Status(Status::kNotFound);
+        } else {
+            result[idx] = Status(Status::kIOError, "multi get", ss[i].ToString());
+        }
+    }
+    addMetricRead(keys_read, bytes_read);
+    return result;
+}
+
+Status Store::checkDuplicate(const kvrpcpb::InsertRequest& req) {
+    std::vector<std::string> keys;
+    keys.reserve(req.rows_size());
+    for (int i = 0; i < req.rows_size(); ++i) {
+        keys.push_back(req.rows(i).key());
+    }
+    std::vector<std::string> values;
+    auto ss = MultiGet(keys, &values);
+    for (const auto& s : ss) {
+        if (s.ok()) {
+            return Status(Status::kDuplicate);
+        } else if (s.code() != Status::kNotFound) {
+            return s;
+        }
+    }
+    return Status::OK();
+}
+
+Status Store::Insert(const kvrpcpb::InsertRequest& req, uint64_t* affected,
+                     uint64_t expire_at) {
     if(ds_config.rocksdb_config.storage_type == 1 && ds_config.rocksdb_config.ttl > 0){
         auto *blobdb = static_cast<rocksdb::blob_db::BlobDB*>(db_);
-        std::string value;
         rocksdb::Status s;
         bool check_dup = req.check_duplicate();
         *affected = 0;
+        if (check_dup) {
+            auto ret = checkDuplicate(req);
+            if (!ret.ok()) return ret;
+        }
         for (int i = 0; i < req.rows_size(); ++i) {
             const kvrpcpb::KeyValue& kv = req.rows(i);
-            if (check_dup) {
-                s = db_->Get(rocksdb::ReadOptions(ds_config.rocksdb_config.read_checksum,true), kv.key(), &value);
-                if (s.ok()) {
-                    return Status(Status::kDuplicate);
-                } else if (!s.IsNotFound()) {
-                    return Status(Status::kIOError, "get", s.ToString());
-                }
-            }
             s = blobdb->PutWithTTL(write_options_,rocksdb::Slice(kv.key()),rocksdb::Slice(kv.value()),ds_config.rocksdb_config.ttl);
             if (!s.ok()) {
                 return Status(Status::kIOError, "blobdb put", s.ToString());
             }else{
                 addMetricWrite(*affected, kv.key().size()+kv.value().size());
+                sampleKey(kv.key());
                 *affected = *affected + 1;
             }
 
@@ -122,30 +329,31 @@ Status Store::Insert(const kvrpcpb::InsertRequest& req, uint64_t* affected) {
     uint64_t bytes_written = 0;
     rocksdb::WriteBatch batch;
     rocksdb::Status s;
-    std::string value;
     bool check_dup = req.check_duplicate();
     *affected = 0;
+    if (check_dup) {
+        auto ret = checkDuplicate(req);
+        if (!ret.ok()) return ret;
+    }
     for (int i = 0; i < req.rows_size(); ++i) {
         const kvrpcpb::KeyValue& kv = req.rows(i);
-        if (check_dup) {
-            s = db_->Get(rocksdb::ReadOptions(ds_config.rocksdb_config.read_checksum,true), kv.key(), &value);
-            if (s.ok()) {
-                return Status(Status::kDuplicate);
-            } else if (!s.IsNotFound()) {
-                return Status(Status::kIOError, "get", s.ToString());
-            }
+        if (ttl_ != kNoTtl) {
+            s = batch.Put(cf_, kv.key(), ttlValue(kv.value(), expire_at));
+        } else {
+            s = batch.Put(cf_, kv.key(), kv.value());
         }
-        s = batch.Put(kv.key(), kv.value());
         if (!s.ok()) {
             return Status(Status::kIOError, "batch put", s.ToString());
         }
         *affected = *affected + 1;
         bytes_written += (kv.key().size(), kv.value().size());
+        sampleKey(kv.key());
     }
     s = db_->Write(write_options_, &batch);
     if (!s.ok()) {
         return Status(Status::kIOError, "batch write", s.ToString());
     } else {
+        bumpWriteVersion();
         addMetricWrite(*affected, bytes_written);
         return Status::OK();
     }
@@ -166,9 +374,38 @@ static void addRow(const kvrpcpb::SelectRequest& req,
     row->set_fields(buf);
 }
 
+// 除limit外完全相同的select请求才能共用一个游标
+// proxy给每个请求都设置新的timestamp，不参与匹配；
+// 但timestamp用作快照句柄时，不同快照的游标不能混用
+std::string Store::cursorSignature(const kvrpcpb::SelectRequest& req, uint64_t snapshot_id) {
+    kvrpcpb::SelectRequest sig_req(req);
+    sig_req.clear_limit();
+    // proxy每个请求都带有新的timestamp，不参与匹配
+    sig_req.clear_timestamp();
+    sig_req.clear_open_snapshot();
+    sig_req.set_snapshot_id(snapshot_id);
+    return sig_req.SerializeAsString();
+}
+
+Status Store::AcquireSnapshot(bool open_snapshot, uint64_t snapshot_id, SnapshotPtr* snapshot,
+                              uint64_t* id) {
+    if (snapshot_id != 0) {
+        *snapshot = GetSnapshot(snapshot_id);
+        if (*snapshot == nullptr) {
+            return Status(Status::kExpired, "read snapshot", std::to_string(snapshot_id));
+        }
+        *id = snapshot_id;
+    } else if (open_snapshot) {
+        *snapshot = OpenSnapshot(id);
+        if (*snapshot == nullptr) {
+            return Status(Status::kNotSupported, "read snapshot", "range.max_snapshots is 0");
+        }
+    }
+    return Status::OK();
+}
+
 Status Store::selectSimple(const kvrpcpb::SelectRequest& req,
-                           kvrpcpb::SelectResponse* resp) {
-    RowFetcher f(*this, req);
+                           kvrpcpb::SelectResponse* resp, SnapshotPtr snapshot) {
     Status s;
     std::unique_ptr<RowResult> r(new RowResult);
     bool over = false;
@@ -176,9 +413,31 @@ Status Store::selectSimple(const kvrpcpb::SelectRequest& req,
     uint64_t all = 0;
     uint64_t limit = req.has_limit() ? req.limit().count() : kDefaultMaxSelectLimit;
     uint64_t offset = req.has_limit() ? req.limit().offset() : 0;
+
+    // 按scope分页读取时, 上一页停下的位置正好是本页的offset, 直接续读
+    // 写版本在创建迭代器之前读取
+    std::string signature;
+    std::unique_ptr<RowFetcher> f;
+    auto version = write_version_.load(std::memory_order_acquire);
+    bool paging = false;
+    bool use_cursor = req.key().empty() && ds_config.range_config.max_cursors > 0;
+    if (use_cursor) {
+        signature = cursorSignature(req, resp->snapshot_id());
+        if (offset > 0) {
+            f = cursors_->TakeFetcher(signature, offset, version, &paging);
+            if (f != nullptr) {
+                all = offset;
+                f->ResetSample();
+            }
+        }
+    }
+    if (f == nullptr) {
+        f.reset(new RowFetcher(*this, req, std::move(snapshot)));
+    }
+
     while (!over && s.ok()) {
         over = false;
-        s = f.Next(r.get(), &over);
+        s = f->Next(r.get(), &over);
         if (s.ok() && !over) {
             ++all;
             if (all > offset) {
@@ -188,11 +447,18 @@ Status Store::selectSimple(const kvrpcpb::SelectRequest& req,
         }
     }
     resp->set_offset(all);
+
+    // 因为limit提前结束, 后面可能还有数据, 留给下一页
+    // 第一页只记下结束位置, 确认在翻页后才暂存迭代器
+    if (use_cursor && s.ok() && !over) {
+        if (!paging) f.reset();
+        cursors_->PutFetcher(std::move(signature), all, version, std::move(f));
+    }
     return s;
 }
 
 Status Store::selectAggre(const kvrpcpb::SelectRequest& req,
-                          kvrpcpb::SelectResponse* resp) {
+                          kvrpcpb::SelectResponse* resp, SnapshotPtr snapshot) {
     // 暂时不支持带group by的聚合函数
     if (req.group_bys_size() > 0) {
         return Status(Status::kNotSupported, "select",
@@ -216,7 +482,7 @@ Status Store::selectAggre(const kvrpcpb::SelectRequest& req,
         }
     }
 
-    RowFetcher f(*this, req);
+    RowFetcher f(*this, req, std::move(snapshot));
     Status s;
     std::unique_ptr<RowResult> r(new RowResult);
     bool over = false;
@@ -274,10 +540,21 @@ Status Store::Select(const kvrpcpb::SelectRequest& req,
     if (has_aggre && has_column) {
         return Status(Status::kNotSupported, "select",
                       "mixture of aggregate and column select field");
-    } else if (has_column) {
-        return selectSimple(req, resp);
+    }
+
+    SnapshotPtr snapshot;
+    uint64_t snapshot_id = 0;
+    auto s = AcquireSnapshot(req.open_snapshot(), req.snapshot_id(), &snapshot, &snapshot_id);
+    if (!s.ok()) {
+        return s;
+    }
+    if (snapshot_id != 0) {
+        resp->set_snapshot_id(snapshot_id);
+    }
+    if (has_column) {
+        return selectSimple(req, resp, std::move(snapshot));
     } else {
-        return selectAggre(req, resp);
+        return selectAggre(req, resp, std::move(snapshot));
     }
 }
 
@@ -295,7 +572,7 @@ Status Store::DeleteRows(const kvrpcpb::DeleteRequest& req,
         s = f.Next(r.get(), &over);
         if (s.ok() && !over) {
             assert(!r->Key().empty());
-            batch.Delete(r->Key());
+            batch.Delete(cf_, r->Key());
             ++(*affected);
             bytes_written += r->Key().size();
         }
@@ -306,6 +583,7 @@ Status Store::DeleteRows(const kvrpcpb::DeleteRequest& req,
         if (!rs.ok()) {
             s = Status(Status::kIOError, "delete batch write", rs.ToString());
         } else {
+            bumpWriteVersion();
             addMetricWrite(*affected, bytes_written);
         }
     }
@@ -317,24 +595,57 @@ Status Store::Truncate() {
     rocksdb::WriteOptions op;
 
     std::unique_lock<std::mutex> lock(key_lock_);
-    auto family = db_->DefaultColumnFamily();
+    auto family = cf_;
 
     assert(!start_key_.empty());
     assert(!end_key_.empty());
     assert(start_key_ < end_key_);
 
+    cursors_->Clear();
+    snapshots_->Clear();
     auto s = db_->DeleteRange(op, family, start_key_, end_key_);
+    bumpWriteVersion();
     if (!s.ok()) {
         return Status(Status::kIOError, "delete range", s.ToString());
     }
+    range_deleted_ = true;
 
     return Status::OK();
 };
 
+Status Store::compactDeletedRange() {
+    if (!range_deleted_) {
+        return Status::OK();
+    }
+
+    std::string start, end;
+    {
+        std::unique_lock<std::mutex> lock(key_lock_);
+        start = start_key_;
+        end = end_key_;
+    }
+
+    auto s = db_->Flush(rocksdb::FlushOptions(), cf_);
+    if (!s.ok()) {
+        return Status(Status::kIOError, "flush", s.ToString());
+    }
+    rocksdb::Slice begin_slice(start), end_slice(end);
+    rocksdb::CompactRangeOptions ops;
+    ops.bottommost_level_compaction = rocksdb::BottommostLevelCompaction::kForce;
+    s = db_->CompactRange(ops, cf_, &begin_slice, &end_slice);
+    if (!s.ok()) {
+        return Status(Status::kIOError, "compact range", s.ToString());
+    }
+    range_deleted_ = false;
+    return Status::OK();
+}
+
 void Store::SetEndKey(std::string end_key) {
     std::unique_lock<std::mutex> lock(key_lock_);
     assert(start_key_ < end_key);
     end_key_ = std::move(end_key);
+    // 游标的迭代器边界还是旧的end key
+    cursors_->Clear();
 }
 
 std::string Store::GetEndKey() const {
@@ -342,67 +653,51 @@ std::string Store::GetEndKey() const {
     return end_key_;
 }
 
-uint64_t Store::StatisSize(std::string& split_key, uint64_t split_size) {
-    uint64_t len = 0;
-
-    // The number of the same characters is greater than
-    // the length of start_key_ and more than 5,
-    // then the length of the split_key is
-    // start_key_.length() + 5
-    auto max_len = start_key_.length() + 5;
-
-    std::unique_ptr<Iterator> it(NewIterator());
-
-    while (it->Valid()) {
-        len += it->key_size();
-        len += it->value_size();
+uint64_t Store::scanSplitKey(Iterator* it, uint64_t len, uint64_t split_size,
+                             bool decode, std::string& split_key) {
+    if (!decode) {
+        // The number of the same characters is greater than
+        // the length of start_key_ and more than 5,
+        // then the length of the split_key is
+        // start_key_.length() + 5
+        auto max_len = start_key_.length() + 5;
+
+        while (it->Valid()) {
+            len += it->key_size();
+            len += it->value_size();
+
+            if (len > split_size) {
+                split_key = std::move(it->key());
+                it->Next();
+                break;
+            }
 
-        if (len > split_size) {
-            split_key = std::move(it->key());
             it->Next();
-            break;
         }
 
-        it->Next();
-    }
-
-    if (it->Valid() && !split_key.empty()) {
-        split_key = SliceSeparate(it->key(), split_key, max_len);
-    } else {
-        split_key.clear();
-    }
-
-    while (it->Valid()) {
-        len += it->key_size();
-        len += it->value_size();
-
-        it->Next();
+        if (it->Valid() && !split_key.empty()) {
+            split_key = SliceSeparate(it->key(), split_key, max_len);
+        } else {
+            split_key.clear();
+        }
+        return len;
     }
 
-    return len;
-}
-uint64_t Store::StatisSize(std::string& split_key, uint64_t split_size,
-                           bool decode) {
-    uint64_t len = 0;
     std::string cur_real_key = "";  //解析后的实际KEY
     std::string pre_real_key = "";
     std::string curkey = "";  //未解析得到的KEY
 
-    auto max_len = start_key_.length() + 5;
-
-    std::unique_ptr<Iterator> it(NewIterator());
-
     while (it->Valid()) {
         len += it->key_size();
         len += it->value_size();
 
         //由编码后的KEY，解析当前实际KEY
         curkey = std::move(it->key());
-        pre_real_key = std::move(cur_real_key);
-        cur_real_key = std::move(GetRealKey(curkey));
+        pre_real_key.swap(cur_real_key);
+        GetRealKey(curkey, &cur_real_key);
 
         if (len > split_size) {
-            split_key = std::move(curkey);
+            split_key = curkey;
             if ((!pre_real_key.empty()) && (cur_real_key != pre_real_key)) {
                 it->Next();
                 break;
@@ -415,6 +710,18 @@ uint64_t Store::StatisSize(std::string& split_key, uint64_t split_size,
     if (!it->Valid()) {
         split_key.clear();
     }
+    return len;
+}
+
+uint64_t Store::StatisSize(std::string& split_key, uint64_t split_size) {
+    return StatisSize(split_key, split_size, false);
+}
+
+uint64_t Store::StatisSize(std::string& split_key, uint64_t split_size,
+                           bool decode) {
+    std::unique_ptr<Iterator> it(NewIterator());
+
+    auto len = scanSplitKey(it.get(), 0, split_size, decode, split_key);
 
     while (it->Valid()) {
         len += it->key_size();
@@ -426,25 +733,149 @@ uint64_t Store::StatisSize(std::string& split_key, uint64_t split_size,
     return len;
 }
 
-Iterator* Store::NewIterator(const kvrpcpb::Scope& scope) {
-    auto it = db_->NewIterator(rocksdb::ReadOptions(ds_config.rocksdb_config.read_checksum,true));
-    std::string start = scope.start();
-    std::string limit = scope.limit();
-    if (start.empty() || start < start_key_) {
-        start = start_key_;
+uint64_t Store::ApproximateSize(const std::string& start, const std::string& limit) {
+    return approximateSize(start, limit, rawSizeRatio(start, limit));
+}
+
+double Store::rawSizeRatio(const std::string& start, const std::string& limit) {
+    rocksdb::Range r(start, limit);
+    rocksdb::TablePropertiesCollection props;
+    auto s = db_->GetPropertiesOfTablesInRange(cf_, &r, 1, &props);
+    if (!s.ok()) {
+        FLOG_WARN("range[%" PRIu64 "] get table properties failed: %s", range_id_,
+                  s.ToString().c_str());
+        return 1.0;
     }
 
-    {
-        std::unique_lock<std::mutex> lock(key_lock_);
-        if (limit.empty() || limit > end_key_) {
-            limit = end_key_;
+    uint64_t raw_size = 0;
+    uint64_t data_size = 0;
+    for (const auto& p : props) {
+        const auto& tp = *p.second;
+        // raw_key_size中每个key带有8字节的internal key后缀（sequence及类型）
+        auto key_size = tp.raw_key_size > tp.num_entries * 8
+                            ? tp.raw_key_size - tp.num_entries * 8 : 0;
+        raw_size += key_size + tp.raw_value_size;
+        data_size += tp.data_size;
+    }
+    if (raw_size == 0 || data_size == 0) {
+        return 1.0;
+    }
+    return static_cast<double>(raw_size) / static_cast<double>(data_size);
+}
+
+uint64_t Store::approximateSize(const std::string& start, const std::string& limit,
+                                double raw_ratio) {
+    rocksdb::Range r(start, limit);
+    uint64_t file_size = 0;
+    uint64_t mem_size = 0;
+    db_->GetApproximateSizes(cf_, &r, 1, &file_size, rocksdb::DB::INCLUDE_FILES);
+    db_->GetApproximateSizes(cf_, &r, 1, &mem_size, rocksdb::DB::INCLUDE_MEMTABLES);
+    return static_cast<uint64_t>(static_cast<double>(file_size) * raw_ratio) + mem_size;
+}
+
+void Store::sampleSplitKeys(const std::string& start, const std::string& limit,
+                            std::vector<std::string>* keys) {
+    std::vector<rocksdb::LiveFileMetaData> files;
+    db_->GetLiveFilesMetaData(&files);
+
+    const auto& cf_name = cf_->GetName();
+    for (const auto& f : files) {
+        if (f.column_family_name != cf_name) {
+            continue;
+        }
+        if (f.smallestkey > start && f.smallestkey < limit) {
+            keys->push_back(f.smallestkey);
+        }
+        if (f.largestkey > start && f.largestkey < limit) {
+            keys->push_back(f.largestkey);
         }
     }
-    return new Iterator(it, start, limit);
+    std::sort(keys->begin(), keys->end());
+    keys->erase(std::unique(keys->begin(), keys->end()), keys->end());
+}
+
+uint64_t Store::ApproximateStatisSize(std::string& split_key, uint64_t split_size,
+                                      bool decode) {
+    split_key.clear();
+
+    auto end_key = GetEndKey();
+    // 整个range的换算比例只计算一次，二分采样点时沿用
+    auto raw_ratio = rawSizeRatio(start_key_, end_key);
+    auto total = approximateSize(start_key_, end_key, raw_ratio);
+    if (total <= split_size) {
+        return total;
+    }
+
+    // 以sst文件的边界key为采样点，二分找到估算大小不超过split_size的最后一个采样点，
+    // 从该点开始扫描到分裂点即可
+    std::vector<std::string> samples;
+    sampleSplitKeys(start_key_, end_key, &samples);
+
+    std::string scan_start = start_key_;
+    uint64_t base = 0;
+    size_t lo = 0, hi = samples.size();
+    while (lo < hi) {
+        auto mid = lo + (hi - lo) / 2;
+        auto size = approximateSize(start_key_, samples[mid], raw_ratio);
+        if (size <= split_size) {
+            scan_start = samples[mid];
+            base = size;
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+
+    std::unique_ptr<Iterator> it(NewIterator(scan_start, end_key));
+    auto len = scanSplitKey(it.get(), base, split_size, decode, split_key);
+    // 估算偏小时扫描到了range末尾，以扫描结果为准
+    return std::max(total, len);
+}
+
+// [start, limit)内的key如果都和start有相同的前缀(prefix_extractor_len),
+// 迭代时可以只在该前缀内查找, 从而使用prefix bloom过滤
+static bool inSamePrefix(const std::string& start, const std::string& limit) {
+    auto len = static_cast<size_t>(ds_config.rocksdb_config.prefix_extractor_len);
+    if (len == 0 || start.size() < len) {
+        return false;
+    }
+    // 计算前缀的后继: 去掉末尾的0xff后最后一个字节加1
+    std::string next = start.substr(0, len);
+    while (!next.empty() && static_cast<uint8_t>(next.back()) == 0xff) {
+        next.pop_back();
+    }
+    if (next.empty()) {
+        return true;
+    }
+    next.back() = static_cast<char>(static_cast<uint8_t>(next.back()) + 1);
+    return limit <= next;
+}
+
+Iterator* Store::NewIterator(const kvrpcpb::Scope& scope) {
+    return NewIterator(scope.start(), scope.limit());
 }
 
 Iterator* Store::NewIterator(std::string start, std::string limit) {
-    auto it = db_->NewIterator(rocksdb::ReadOptions(ds_config.rocksdb_config.read_checksum,true));
+    return newIterator(std::move(start), std::move(limit), ttl_ != kNoTtl);
+}
+
+Iterator* Store::NewRawIterator() {
+    return newIterator(std::string(), std::string(), false);
+}
+
+Iterator* Store::NewScanIterator(std::string start, std::string limit, uint64_t expected_rows,
+                                 SnapshotPtr snapshot) {
+    bool fill_cache = !low_pri_;
+    auto large = static_cast<uint64_t>(ds_config.rocksdb_config.large_scan_rows);
+    if (large > 0 && (expected_rows == 0 || expected_rows > large)) {
+        fill_cache = false;
+    }
+    return newIterator(std::move(start), std::move(limit), ttl_ != kNoTtl, fill_cache,
+                       std::move(snapshot));
+}
+
+Iterator* Store::newIterator(std::string start, std::string limit, bool ttl, bool fill_cache,
+                             SnapshotPtr snapshot) {
     if (start.empty() || start < start_key_) {
         start = start_key_;
     }
@@ -455,7 +886,17 @@ Iterator* Store::NewIterator(std::string start, std::string limit) {
             limit = end_key_;
         }
     }
-    return new Iterator(it, start, limit);
+
+    rocksdb::ReadOptions opts(ds_config.rocksdb_config.read_checksum, fill_cache);
+    opts.prefix_same_as_start = inSamePrefix(start, limit);
+    // 设置了prefix_extractor时，跨前缀的迭代必须按全序查找，
+    // 否则可能漏掉不在当前前缀内的key
+    if (ds_config.rocksdb_config.prefix_extractor_len > 0) {
+        opts.total_order_seek = !opts.prefix_same_as_start;
+    }
+    opts.snapshot = snapshot.get();
+    auto it = db_->NewIterator(opts, cf_);
+    return new Iterator(it, start, limit, ttl, std::move(snapshot));
 }
 
 Status Store::BatchDelete(const std::vector<std::string>& keys) {
@@ -466,12 +907,14 @@ Status Store::BatchDelete(const std::vector<std::string>& keys) {
 
     rocksdb::WriteBatch batch;
     for (auto& key : keys) {
-        batch.Delete(key);
+        batch.Delete(cf_, key);
+        sampleKey(key);
         ++keys_written;
         bytes_written += key.size();
     }
     auto ret = db_->Write(write_options_, &batch);
     if (ret.ok()) {
+        bumpWriteVersion();
         addMetricWrite(keys_written, bytes_written);
         return Status::OK();
     } else {
@@ -481,14 +924,21 @@ Status Store::BatchDelete(const std::vector<std::string>& keys) {
 
 bool Store::KeyExists(const std::string& key) {
     rocksdb::PinnableSlice value;
-    auto ret = db_->Get(rocksdb::ReadOptions(ds_config.rocksdb_config.read_checksum,true), db_->DefaultColumnFamily(), key,
+    auto ret = db_->Get(rocksdb::ReadOptions(ds_config.rocksdb_config.read_checksum,true), cf_, key,
                         &value);
     addMetricRead(1, key.size() + value.size());
+    sampleKey(key);
+    if (ret.ok() && ttl_ != kNoTtl) {
+        uint64_t expire_at = 0;
+        return !DecodeTtlHeader(value.data(), value.size(), &expire_at) ||
+               !TtlExpired(expire_at, static_cast<uint64_t>(time(nullptr)));
+    }
     return ret.ok();
 }
 
 Status Store::BatchSet(
-    const std::vector<std::pair<std::string, std::string>>& keyValues) {
+    const std::vector<std::pair<std::string, std::string>>& keyValues,
+    uint64_t expire_at) {
     if (keyValues.empty()) return Status::OK();
 
     uint64_t keys_written = 0;
@@ -496,12 +946,18 @@ Status Store::BatchSet(
 
     rocksdb::WriteBatch batch;
     for (auto& kv : keyValues) {
-        batch.Put(kv.first, kv.second);
+        if (ttl_ != kNoTtl) {
+            batch.Put(cf_, kv.first, ttlValue(kv.second, expire_at));
+        } else {
+            batch.Put(cf_, kv.first, kv.second);
+        }
+        sampleKey(kv.first);
         ++keys_written;
         bytes_written += (kv.first.size() + kv.second.size());
     }
     auto ret = db_->Write(write_options_, &batch);
     if (ret.ok()) {
+        bumpWriteVersion();
         addMetricWrite(keys_written, bytes_written);
         return Status::OK();
     } else {
@@ -510,30 +966,101 @@ Status Store::BatchSet(
 }
 
 Status Store::RangeDelete(const std::string& start, const std::string& limit) {
-    auto ret = db_->DeleteRange(write_options_, db_->DefaultColumnFamily(),
-                                start, limit);
+    auto ret = db_->DeleteRange(write_options_, cf_, start, limit);
+    bumpWriteVersion();
     return Status(ret.ok() ? Status::OK() : Status(Status::kUnknown));
 }
 
-Status Store::ApplySnapshot(const std::vector<std::string>& datas) {
+uint64_t Store::TtlExpireAt() const {
+    return ttl_ > 0 ? static_cast<uint64_t>(time(nullptr) + ttl_) : 0;
+}
+
+bool Store::TtlHeader() const { return ttl_ != kNoTtl; }
+
+std::string Store::ttlValue(const std::string& value, uint64_t expire_at) const {
+    std::string buf;
+    buf.reserve(kTtlHeaderSize + value.size());
+    EncodeTtlHeader(&buf, expire_at);
+    buf.append(value);
+    return buf;
+}
+
+bool Store::stripTtl(std::string* value) const {
+    uint64_t expire_at = 0;
+    if (!DecodeTtlHeader(value->data(), value->size(), &expire_at)) {
+        return true;
+    }
+    if (TtlExpired(expire_at, static_cast<uint64_t>(time(nullptr)))) {
+        return false;
+    }
+    value->erase(0, kTtlHeaderSize);
+    return true;
+}
+
+bool Store::ConvertSnapshotValue(bool ttl_header, std::string* value) const {
+    if (ttl_header == TtlHeader()) {
+        return true;
+    } else if (ttl_header) {
+        return stripTtl(value);
+    } else {
+        *value = ttlValue(*value, 0);
+        return true;
+    }
+}
+
+Status Store::ApplySnapshot(const std::vector<std::string>& datas, bool ttl_header) {
     rocksdb::WriteBatch batch;
     for (const auto& data : datas) {
         raft_cmdpb::SnapshotKVPair p;
         if (!p.ParseFromString(data)) {
             return Status(Status::kCorruption, "apply snapshot data",
                           "deserilize return false");
-        } else {
-            batch.Put(p.key(), p.value());
+        } else if (ConvertSnapshotValue(ttl_header, p.mutable_value())) {
+            batch.Put(cf_, p.key(), p.value());
         }
     }
     auto ret = db_->Write(write_options_, &batch);
     if (!ret.ok()) {
         return Status(Status::kIOError, "snap batch write", ret.ToString());
     } else {
+        bumpWriteVersion();
         return Status::OK();
     }
 }
 
+std::unique_ptr<Iterator> Store::OpenScanCursor(const std::string& start,
+                                                const std::string& limit,
+                                                uint64_t expected_rows, uint64_t snapshot_id,
+                                                SnapshotPtr snapshot, ScanCursor* cursor) {
+    // 写版本在创建迭代器之前读取
+    cursor->version = write_version_.load(std::memory_order_acquire);
+    cursor->snapshot_id = snapshot_id;
+    cursor->paging = false;
+    std::unique_ptr<Iterator> iter;
+    if (ds_config.range_config.max_cursors > 0) {
+        iter = cursors_->TakeIterator(start, limit, snapshot_id, cursor->version,
+                                      &cursor->paging);
+    }
+    if (iter == nullptr) {
+        iter.reset(NewScanIterator(start, limit, expected_rows, std::move(snapshot)));
+    }
+    return iter;
+}
+
+void Store::PutScanCursor(const ScanCursor& cursor, std::string last_key, std::string limit,
+                          std::unique_ptr<Iterator> iter) {
+    if (ds_config.range_config.max_cursors <= 0 || !iter->Valid()) return;
+    auto next_key = iter->key();
+    // 第一页只记下结束位置, 确认在翻页后才暂存迭代器
+    if (!cursor.paging) iter.reset();
+    cursors_->PutIterator(std::move(last_key), std::move(next_key), std::move(limit),
+                          cursor.snapshot_id, cursor.version, std::move(iter));
+}
+
+void Store::ExpireCursors() { cursors_->Expire(); }
+
+void Store::ClearCursors() { cursors_->Clear(); }
+
 void Store::addMetricRead(uint64_t keys, uint64_t bytes) {
     metric_.AddRead(keys, bytes);
     g_metric.AddRead(keys, bytes);
@@ -2,10 +2,15 @@ _Pragma("once");
 
 #include <rocksdb/db.h>
 #include <rocksdb/utilities/blob_db/blob_db.h>
+#include <atomic>
+#include <memory>
 #include <mutex>
 
 #include "iterator.h"
+#include "load_sampler.h"
 #include "metric.h"
+#include "perf_stats.h"
+#include "snapshot_cache.h"
 #include "proto/gen/kvrpcpb.pb.h"
 
 namespace sharkstore {
@@ -15,19 +20,49 @@ namespace storage {
 // 行前缀长度: 1字节特殊标记+8字节table id
 static const size_t kRowPrefixLength = 9;
 
+// 解析低优先级表的配置（逗号分隔的table id），这些表的扫描不填充block cache
+// 只在打开db之前调用，之后只读
+Status InitLowPriTables(const std::string& conf);
+bool IsLowPriTable(uint64_t table_id);
+
+// 解析高优先级表的配置（逗号分隔的table id），这些表使用独立的column family及block cache
+// 只在打开db之前调用，之后只读
+Status InitHighPriTables(const std::string& conf);
+bool IsHighPriTable(uint64_t table_id);
+bool HasHighPriTables();
+
+class CursorCache;
+
 class Store {
 public:
-    Store(const metapb::Range& meta, rocksdb::DB* db);
+    // cf为空时使用db的default column family
+    Store(const metapb::Range& meta, rocksdb::DB* db,
+          std::shared_ptr<rocksdb::ColumnFamilyHandle> cf = nullptr);
     ~Store();
 
     Store(const Store&) = delete;
     Store& operator=(const Store&) = delete;
 
-    Status Get(const std::string& key, std::string* value);
-    Status Put(const std::string& key, const std::string& value);
+    // snapshot不为空时读取该快照时的数据
+    Status Get(const std::string& key, std::string* value,
+               const rocksdb::Snapshot* snapshot = nullptr);
+    // expire_at: TTL表的值的到期时间（unix秒，0表示不过期），由命令携带，非TTL表忽略
+    Status Put(const std::string& key, const std::string& value, uint64_t expire_at = 0);
     Status Delete(const std::string& key);
-
-    Status Insert(const kvrpcpb::InsertRequest& req, uint64_t* affected);
+    // 原子加/追加，通过rocksdb merge写入，不读取旧值（db需配置KvMergeOperator）
+    // 重复应用结果会变，apply_index不为0时与写入在同一个WriteBatch中保存range的apply index，
+    // 重启后不会重放已写入的命令
+    Status Increment(const std::string& key, int64_t delta, uint64_t apply_index = 0);
+    Status Append(const std::string& key, const std::string& value, uint64_t apply_index = 0);
+    // 与数据原子写入的apply index（见Increment），没有时为0
+    Status LoadApplyIndex(uint64_t* apply_index);
+    Status DeleteApplyIndex();
+    // 批量读取, 返回值与keys一一对应(kNotFound表示不存在)
+    std::vector<Status> MultiGet(const std::vector<std::string>& keys,
+                                 std::vector<std::string>* values);
+
+    Status Insert(const kvrpcpb::InsertRequest& req, uint64_t* affected,
+                  uint64_t expire_at = 0);
     Status Select(const kvrpcpb::SelectRequest& req,
                   kvrpcpb::SelectResponse* resp);
     Status DeleteRows(const kvrpcpb::DeleteRequest& req, uint64_t* affected);
@@ -40,35 +75,124 @@ public:
         return primary_keys_;
     }
 
+    // TTL表新写入的值的到期时间，由leader提交命令时计算一次并随命令复制，
+    // 保证各副本及重放日志时写入相同的值；不是TTL表或TTL为0时返回0
+    uint64_t TtlExpireAt() const;
+    // 本节点上该表的值是否带有TTL值头
+    bool TtlHeader() const;
+    // 把快照中的值（ttl_header为是否带有TTL值头）转换为本地的格式：
+    // 去掉值头时已过期的值返回false；加上的值头不过期
+    bool ConvertSnapshotValue(bool ttl_header, std::string* value) const;
+
     uint64_t StatisSize(std::string& split_key, uint64_t split_size);
     uint64_t StatisSize(std::string& split_key, uint64_t split_size,
                         bool decode);  // fjf 2018-01-31
 
+    // rocksdb估算的[start, limit)大小，不读取数据
+    // sst文件中是压缩后的大小，按文件属性中未压缩的key、value大小换算成与StatisSize
+    // 相同口径的逻辑大小（key+value），再加上memtable的大小
+    uint64_t ApproximateSize(const std::string& start, const std::string& limit);
+    // 同StatisSize，但总大小为估算值，分裂点通过sst边界采样定位后只扫描其附近
+    uint64_t ApproximateStatisSize(std::string& split_key, uint64_t split_size,
+                                   bool decode);
+
     void ResetMetric() { metric_.Reset(); }
     void CollectMetric(MetricStat* stat) { metric_.Collect(stat); }
 
+    // 访问key采样，用于按负载分裂
+    LoadSampler* GetLoadSampler() { return &load_sampler_; }
+    PerfCounter* GetPerfCounter() { return &perf_counter_; }
+
 public:
     Iterator* NewIterator(const ::kvrpcpb::Scope& scope);
     Iterator* NewIterator(std::string start = std::string(),
                           std::string limit = std::string());
+    // 不过滤TTL的迭代器，返回的值带有TTL值头，用于生成快照
+    Iterator* NewRawIterator();
+    // 扫描用的迭代器，expected_rows为预计读取的行数（0表示不限制）
+    // 大范围扫描及低优先级表的扫描不填充block cache，避免挤出在线业务的热点数据
+    Iterator* NewScanIterator(std::string start, std::string limit, uint64_t expected_rows,
+                              SnapshotPtr snapshot = nullptr);
     Status BatchDelete(const std::vector<std::string>& keys);
     bool KeyExists(const std::string& key);
     Status BatchSet(
-        const std::vector<std::pair<std::string, std::string>>& keyValues);
+        const std::vector<std::pair<std::string, std::string>>& keyValues,
+        uint64_t expire_at = 0);
     Status RangeDelete(const std::string& start, const std::string& limit);
 
-    Status ApplySnapshot(const std::vector<std::string>& datas);
+    Status ApplySnapshot(const std::vector<std::string>& datas, bool ttl_header);
+
+    // kv scan分页续读的状态, OpenScanCursor时填入, PutScanCursor时传回
+    struct ScanCursor {
+        uint64_t version = 0;      // 创建迭代器前的写版本
+        uint64_t snapshot_id = 0;  // 读取的快照, 0表示不使用快照
+        bool paging = false;       // 是否接上了上一页
+    };
+    // 能接上[start, limit)之前读同一快照的游标时直接续读, 否则新建迭代器
+    std::unique_ptr<Iterator> OpenScanCursor(const std::string& start, const std::string& limit,
+                                             uint64_t expected_rows, uint64_t snapshot_id,
+                                             SnapshotPtr snapshot, ScanCursor* cursor);
+    // 本页结束后调用, last_key为本页返回的最后一个key, 迭代器还有数据时留给下一页
+    void PutScanCursor(const ScanCursor& cursor, std::string last_key, std::string limit,
+                       std::unique_ptr<Iterator> iter);
+    void ExpireCursors();
+    void ClearCursors();
+
+    // 时间点读：创建快照并返回其id，快照读关闭时返回空
+    SnapshotPtr OpenSnapshot(uint64_t* id) { return snapshots_->Open(id); }
+    // 取id对应的快照，已过期、被淘汰或leader切换后返回空
+    SnapshotPtr GetSnapshot(uint64_t id) { return snapshots_->Get(id); }
+    void ExpireSnapshots() { snapshots_->Expire(); }
+    void ClearSnapshots() { snapshots_->Clear(); }
+    // 按请求的open_snapshot/snapshot_id取读取的快照，id返回快照的id（不使用快照时不变）
+    // 快照已不存在时返回kExpired，快照读关闭时返回kNotSupported
+    Status AcquireSnapshot(bool open_snapshot, uint64_t snapshot_id, SnapshotPtr* snapshot,
+                           uint64_t* id);
+    size_t SnapshotCount() const { return snapshots_->Size(); }
 
 private:
     friend class RowFetcher;
-
+    friend class BulkLoader;
+
+    Status merge(const std::string& key, const std::string& operand, uint64_t apply_index);
+    // 以0x00（无效的存储前缀）开头，不在任何range的key范围内
+    std::string applyIndexKey() const;
+
+    Iterator* newIterator(std::string start, std::string limit, bool ttl,
+                          bool fill_cache = true, SnapshotPtr snapshot = nullptr);
+    // TTL表的值加上到期时间头
+    std::string ttlValue(const std::string& value, uint64_t expire_at) const;
+    // 去掉TTL值头，已过期时返回false（TTL表的值都有值头，不合法的值原样返回）
+    bool stripTtl(std::string* value) const;
+
+    Status checkDuplicate(const kvrpcpb::InsertRequest& req);
+
+    // 从it开始累加大小（初始为len），超过split_size后确定分裂点，返回累加的大小
+    uint64_t scanSplitKey(Iterator* it, uint64_t len, uint64_t split_size,
+                          bool decode, std::string& split_key);
+    // 取(start, limit)内sst文件的边界key作为分裂点的采样
+    void sampleSplitKeys(const std::string& start, const std::string& limit,
+                         std::vector<std::string>* keys);
+    // 与[start, limit)有交集的sst文件中逻辑大小与磁盘上数据大小的比例，没有sst时为1
+    double rawSizeRatio(const std::string& start, const std::string& limit);
+    uint64_t approximateSize(const std::string& start, const std::string& limit,
+                             double raw_ratio);
+
+    // 游标按请求（去掉limit、timestamp）及读取的快照匹配
+    static std::string cursorSignature(const kvrpcpb::SelectRequest& req, uint64_t snapshot_id);
     Status selectSimple(const kvrpcpb::SelectRequest& req,
-                        kvrpcpb::SelectResponse* resp);
+                        kvrpcpb::SelectResponse* resp, SnapshotPtr snapshot);
     Status selectAggre(const kvrpcpb::SelectRequest& req,
-                       kvrpcpb::SelectResponse* resp);
+                       kvrpcpb::SelectResponse* resp, SnapshotPtr snapshot);
 
     void addMetricRead(uint64_t keys, uint64_t bytes);
     void addMetricWrite(uint64_t keys, uint64_t bytes);
+    // 每次写入后调用，之前暂存的游标不再续读
+    void bumpWriteVersion() { write_version_.fetch_add(1, std::memory_order_release); }
+    void sampleKey(const std::string& key) { load_sampler_.Add(key); }
+    // Truncate之后第一次导入sst文件前调用：flush并compact整个范围，清除DeleteRange的tombstone
+    // rocksdb 5.11中导入的文件可能被未清除的range tombstone覆盖而读不到
+    Status compactDeletedRange();
 
 private:
     const uint64_t range_id_;
@@ -78,11 +202,25 @@ private:
     mutable std::mutex key_lock_;
 
     rocksdb::DB* db_;
+    // 持有column family handle, 保证store存活期间handle不被销毁
+    std::shared_ptr<rocksdb::ColumnFamilyHandle> cf_holder_;
+    rocksdb::ColumnFamilyHandle* cf_ = nullptr;
     rocksdb::WriteOptions write_options_;
+    const int64_t ttl_;  // 表的TTL（秒），kNoTtl表示不是TTL表
+    const bool low_pri_;
 
     std::vector<metapb::Column> primary_keys_;
 
     Metric metric_;
+    LoadSampler load_sampler_;
+    PerfCounter perf_counter_;
+
+    std::atomic<uint64_t> write_version_{0};
+    std::atomic<bool> range_deleted_{false};  // Truncate之后还未compact
+
+    // 放在最后, 保证游标先于db handle析构
+    std::unique_ptr<CursorCache> cursors_;
+    std::unique_ptr<SnapshotCache> snapshots_;
 };
 
 } /* namespace storage */
@@ -0,0 +1,125 @@
+#include "ttl.h"
+
+#include <time.h>
+#include <map>
+#include <set>
+#include <sstream>
+
+#include "common/ds_encoding.h"
+#include "meta_store.h"
+#include "store.h"
+
+namespace sharkstore {
+namespace dataserver {
+namespace storage {
+
+static std::map<uint64_t, int64_t> g_table_ttls;
+
+Status InitTableTtl(const std::string& conf) {
+    std::map<uint64_t, int64_t> ttls;
+    std::stringstream ss(conf);
+    std::string item;
+    while (std::getline(ss, item, ',')) {
+        if (item.find_first_not_of(" \t") == std::string::npos) {
+            continue;
+        }
+        auto pos = item.find(':');
+        if (pos == std::string::npos) {
+            return Status(Status::kInvalidArgument, "table ttl", item);
+        }
+        try {
+            auto table_id = std::stoull(item.substr(0, pos));
+            auto ttl = std::stoll(item.substr(pos + 1));
+            if (ttl < 0) {
+                return Status(Status::kInvalidArgument, "table ttl", item);
+            }
+            ttls[table_id] = ttl;
+        } catch (std::exception& e) {
+            return Status(Status::kInvalidArgument, "table ttl", item);
+        }
+    }
+    g_table_ttls.swap(ttls);
+    return Status::OK();
+}
+
+bool HasTableTtl() { return !g_table_ttls.empty(); }
+
+int64_t GetTableTtl(uint64_t table_id) {
+    auto it = g_table_ttls.find(table_id);
+    return it == g_table_ttls.end() ? kNoTtl : it->second;
+}
+
+Status CheckTableTtl(MetaStore* meta_store, const std::vector<metapb::Range>& metas) {
+    std::vector<uint64_t> marked;
+    auto s = meta_store->GetTtlTables(&marked);
+    if (!s.ok()) {
+        return s;
+    }
+    std::set<uint64_t> ttl_tables(marked.begin(), marked.end());
+    for (auto table_id : ttl_tables) {
+        if (g_table_ttls.find(table_id) == g_table_ttls.end()) {
+            return Status(Status::kInvalidArgument, "ttl table removed from table_ttl",
+                          std::to_string(table_id));
+        }
+    }
+
+    std::set<uint64_t> tables_with_data;
+    for (const auto& meta : metas) {
+        tables_with_data.insert(meta.table_id());
+    }
+    for (const auto& t : g_table_ttls) {
+        if (ttl_tables.find(t.first) != ttl_tables.end()) {
+            continue;
+        }
+        if (tables_with_data.find(t.first) != tables_with_data.end()) {
+            return Status(Status::kInvalidArgument, "enable ttl on table with data",
+                          std::to_string(t.first));
+        }
+        s = meta_store->AddTtlTable(t.first);
+        if (!s.ok()) {
+            return s;
+        }
+    }
+    return Status::OK();
+}
+
+void EncodeTtlHeader(std::string* buf, uint64_t expire_at) {
+    buf->push_back(kTtlValueTag);
+    EncodeUint64Ascending(buf, expire_at);
+}
+
+bool DecodeTtlHeader(const char* data, size_t size, uint64_t* expire_at) {
+    if (size < kTtlHeaderSize || data[0] != kTtlValueTag) {
+        return false;
+    }
+    uint64_t v = 0;
+    for (size_t i = 1; i < kTtlHeaderSize; ++i) {
+        v = (v << 8) | static_cast<uint8_t>(data[i]);
+    }
+    *expire_at = v;
+    return true;
+}
+
+bool TtlCompactionFilter::Filter(int level, const rocksdb::Slice& key,
+                                 const rocksdb::Slice& existing_value, std::string* new_value,
+                                 bool* value_changed) const {
+    if (key.size() < kRowPrefixLength) {
+        return false;
+    }
+    uint64_t table_id = 0;
+    for (size_t i = 1; i < kRowPrefixLength; ++i) {
+        table_id = (table_id << 8) | static_cast<uint8_t>(key[i]);
+    }
+    if (GetTableTtl(table_id) == kNoTtl) {
+        return false;
+    }
+    uint64_t expire_at = 0;
+    if (!DecodeTtlHeader(existing_value.data(), existing_value.size(), &expire_at)) {
+        return false;
+    }
+    return TtlExpired(expire_at, static_cast<uint64_t>(time(nullptr)));
+}
+
+}  // namespace storage
+}  // namespace dataserver
+}  // namespace sharkstore
@@ -0,0 +1,61 @@
+_Pragma("once");
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+#include <rocksdb/compaction_filter.h>
+
+#include "base/status.h"
+#include "proto/gen/metapb.pb.h"
+
+namespace sharkstore {
+namespace dataserver {
+namespace storage {
+
+class MetaStore;
+
+// 按表配置的TTL（rocksdb.table_ttl，仅用于storage_type = 0）
+// TTL表的每个值前面都有到期时间头：kTtlValueTag + 8字节到期时间（unix秒，0表示不过期），
+// 到期时间由leader提交命令时计算并随命令复制，读取时过滤已过期的值并去掉值头，
+// compaction时删除已过期的值
+// 值头对TTL表是必需的（见CheckTableTtl），读取时不需要猜测值是否带有值头
+static const char kTtlValueTag = '\x7f';
+static const size_t kTtlHeaderSize = 9;
+static const int64_t kNoTtl = -1;
+
+// 解析table_ttl配置，格式：table_id:seconds[,table_id:seconds...]，seconds为0表示不过期
+// 只在打开db之前调用，之后只读
+Status InitTableTtl(const std::string& conf);
+bool HasTableTtl();
+// 表的TTL（秒），不是TTL表时返回kNoTtl
+int64_t GetTableTtl(uint64_t table_id);
+
+// 启动时检查table_ttl，在加载range之前调用：
+// 已有数据（本节点上已有该表的range）且未开启过TTL的表不能开启TTL，
+// 开启过TTL的表不能从table_ttl中去掉（不需要过期时把TTL设为0），
+// 检查通过后在meta中记录新开启TTL的表
+// 只检查本节点启动时已有的range；之后通过快照收到的range，快照上下文带有leader上值的格式，
+// 与本地不一致时apply快照时转换（见Store::ConvertSnapshotValue）
+Status CheckTableTtl(MetaStore* meta_store, const std::vector<metapb::Range>& metas);
+
+void EncodeTtlHeader(std::string* buf, uint64_t expire_at);
+// 值头不合法时返回false
+bool DecodeTtlHeader(const char* data, size_t size, uint64_t* expire_at);
+
+inline bool TtlExpired(uint64_t expire_at, uint64_t now) {
+    return expire_at != 0 && expire_at <= now;
+}
+
+// 删除TTL表中已过期的值，按key的表前缀确定所属的表
+class TtlCompactionFilter : public rocksdb::CompactionFilter {
+public:
+    bool Filter(int level, const rocksdb::Slice& key, const rocksdb::Slice& existing_value,
+                std::string* new_value, bool* value_changed) const override;
+
+    const char* Name() const override { return "sharkstore.TtlCompactionFilter"; }
+};
+
+}  // namespace storage
+}  // namespace dataserver
+}  // namespace sharkstore
@@ -0,0 +1,521 @@
+// Range请求处理的性能测试
+//
+// 通过真实的Range、真实的raft（内存日志 + 进程内transport）和临时rocksdb，
+// 测试RawGet/KVSet/KVBatchGet/Select/Insert的处理性能，不经过网络
+//
+// 用法: range_bench [-t rawget,kvset,kvbatchget,select,insert] [-c concurrency]
+//                   [-n requests] [-r preload_rows] [-k key_size] [-v value_size]
+//                   [-b batch_keys] [-s key|scan|match] [-l log_level]
+//
+// 每个测试项输出一行json，如：
+// {"case":"kvset","concurrency":8,"key_size":32,"value_size":128,"count":100000,
+//  "errors":0,"ops_per_sec":...,"latency_us":{"avg":...,"p50":...,"p99":...,"p999":...}}
+
+#include <getopt.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <set>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#include <fastcommon/shared_func.h>
+#include <rocksdb/db.h>
+
+#include "base/util.h"
+#include "common/ds_config.h"
+#include "common/socket_session.h"
+#include "frame/sf_logger.h"
+#include "raft/raft.h"
+#include "raft/server.h"
+#include "range/range.h"
+#include "storage/meta_store.h"
+
+#include "helper/helper_util.h"
+#include "helper/mock/master_worker_mock.h"
+#include "helper/query_builder.h"
+#include "helper/table.h"
+
+using namespace sharkstore;
+using namespace sharkstore::dataserver;
+using namespace sharkstore::dataserver::range;
+using namespace sharkstore::test::helper;
+
+namespace {
+
+struct BenchOptions {
+    std::set<std::string> cases;
+    size_t concurrency = 8;
+    uint64_t requests = 100000;
+    uint64_t preload_rows = 10000;
+    size_t key_size = 32;
+    size_t value_size = 128;
+    size_t batch_keys = 16;
+    std::string select_shape = "key";
+    std::string log_level = "warn";
+};
+
+BenchOptions bench_ops;
+
+using Clock = std::chrono::steady_clock;
+
+// 收到响应时唤醒发送请求的线程，并记录是否出错
+class BenchSession : public common::SocketSession {
+public:
+    void Send(common::ProtoMessage *msg, google::protobuf::Message *resp) override {
+        bool ok = !hasError(*resp);
+        auto msg_id = msg->msg_id;
+        delete msg;
+        delete resp;
+
+        std::lock_guard<std::mutex> lock(mu_);
+        done_[msg_id] = ok;
+        cv_.notify_all();
+    }
+
+    // 等待msg_id的响应，返回是否成功
+    bool Wait(int64_t msg_id) {
+        std::unique_lock<std::mutex> lock(mu_);
+        std::map<int64_t, bool>::iterator it;
+        cv_.wait(lock, [&] { return (it = done_.find(msg_id)) != done_.end(); });
+        bool ok = it->second;
+        done_.erase(it);
+        return ok;
+    }
+
+private:
+    static bool hasError(const google::protobuf::Message &resp) {
+        auto field = resp.GetDescriptor()->FindFieldByName("header");
+        if (field == nullptr || field->type() != google::protobuf::FieldDescriptor::TYPE_MESSAGE) {
+            return false;
+        }
+        auto &header = resp.GetReflection()->GetMessage(resp, field);
+        auto header_resp = dynamic_cast<const kvrpcpb::ResponseHeader *>(&header);
+        return header_resp != nullptr && header_resp->has_error();
+    }
+
+private:
+    std::mutex mu_;
+    std::condition_variable cv_;
+    std::map<int64_t, bool> done_;
+};
+
+// 创建的raft都使用内存日志
+class BenchRaftServer : public raft::RaftServer {
+public:
+    explicit BenchRaftServer(std::unique_ptr<raft::RaftServer> server)
+        : server_(std::move(server)) {}
+
+    Status Start() override { return server_->Start(); }
+    Status Stop() override { return server_->Stop(); }
+
+    Status CreateRaft(const raft::RaftOptions &ops, std::shared_ptr<raft::Raft> *raft) override {
+        auto copy = ops;
+        copy.use_memory_storage = true;
+        return server_->CreateRaft(copy, raft);
+    }
+    Status RemoveRaft(uint64_t id) override { return server_->RemoveRaft(id); }
+    Status DestroyRaft(uint64_t id, bool backup) override {
+        return server_->DestroyRaft(id, backup);
+    }
+    std::shared_ptr<raft::Raft> FindRaft(uint64_t id) const override {
+        return server_->FindRaft(id);
+    }
+    void GetStatus(raft::ServerStatus *status) const override { server_->GetStatus(status); }
+
+private:
+    std::unique_ptr<raft::RaftServer> server_;
+};
+
+class BenchContext : public RangeContext {
+public:
+    Status Init() {
+        char path[] = "/tmp/sharkstore_ds_range_bench_XXXXXX";
+        if (mkdtemp(path) == NULL) {
+            return Status(Status::kIOError, "mkdtemp", strErrno(errno));
+        }
+        path_ = path;
+
+        rocksdb::Options ops;
+        ops.create_if_missing = true;
+        auto s = rocksdb::DB::Open(ops, JoinFilePath({path_, "data"}), &db_);
+        if (!s.ok()) {
+            return Status(Status::kIOError, "open rocksdb", s.ToString());
+        }
+        meta_store_.reset(new storage::MetaStore(JoinFilePath({path_, "meta"})));
+        auto ret = meta_store_->Open();
+        if (!ret.ok()) return ret;
+
+        raft::RaftServerOptions rops;
+        rops.node_id = GetNodeID();
+        rops.transport_options.use_inprocess_transport = true;
+        raft_server_.reset(new BenchRaftServer(raft::CreateRaftServer(rops)));
+        ret = raft_server_->Start();
+        if (!ret.ok()) return ret;
+
+        master_worker_.reset(new test::mock::MasterWorkerMock);
+        session_.reset(new BenchSession);
+        range_stats_.reset(new RangeStats);
+        split_policy_ = NewDisableSplitPolicy();
+        return Status::OK();
+    }
+
+    void Destroy() {
+        range_.reset();
+        if (raft_server_) raft_server_->Stop();
+        delete db_;
+        db_ = nullptr;
+        if (!path_.empty()) RemoveDirAll(path_.c_str());
+    }
+
+    Status CreateRange(const metapb::Range &meta) {
+        range_ = std::make_shared<Range>(this, meta);
+        return range_->Initialize(GetNodeID(), 0);
+    }
+    std::shared_ptr<Range> GetRange() const { return range_; }
+    BenchSession *Session() { return session_.get(); }
+
+    uint64_t GetNodeID() const override { return 1; }
+    SplitPolicy *GetSplitPolicy() override { return split_policy_.get(); }
+    rocksdb::DB *DBInstance() override { return db_; }
+    master::Worker *MasterClient() override { return master_worker_.get(); }
+    raft::RaftServer *RaftServer() override { return raft_server_.get(); }
+    storage::MetaStore *MetaStore() override { return meta_store_.get(); }
+    common::SocketSession *SocketSession() override { return session_.get(); }
+    RangeStats *Statistics() override { return range_stats_.get(); }
+    uint64_t GetFSUsagePercent() const override { return 0; }
+    void ScheduleHeartbeat(uint64_t range_id, bool delay) override {}
+    void ScheduleCheckSize(uint64_t range_id) override {}
+    std::shared_ptr<Range> FindRange(uint64_t range_id) override {
+        return (range_ && range_id == range_->options().id()) ? range_ : nullptr;
+    }
+
+private:
+    std::string path_;
+    rocksdb::DB *db_ = nullptr;
+    std::unique_ptr<storage::MetaStore> meta_store_;
+    std::unique_ptr<raft::RaftServer> raft_server_;
+    std::unique_ptr<master::Worker> master_worker_;
+    std::unique_ptr<BenchSession> session_;
+    std::unique_ptr<RangeStats> range_stats_;
+    std::unique_ptr<SplitPolicy> split_policy_;
+    std::shared_ptr<Range> range_;
+};
+
+class Bench {
+public:
+    Bench(BenchContext *context, Table *table) : context_(context), table_(table) {
+        range_ = context_->GetRange();
+        auto meta = range_->options();
+        epoch_ = meta.range_epoch();
+        EncodeKeyPrefix(&key_prefix_, table_->GetID());
+    }
+
+    // 运行一个测试项，gen生成第i个请求并交给range处理
+    using RequestFunc = std::function<void(uint64_t i, common::ProtoMessage *msg)>;
+
+    void Run(const std::string &name, const std::string &params, uint64_t count,
+             const RequestFunc &func) {
+        std::atomic<uint64_t> next(0);
+        std::atomic<uint64_t> errors(0);
+        std::vector<std::vector<uint64_t>> latencies(bench_ops.concurrency);
+
+        auto begin = Clock::now();
+        std::vector<std::thread> threads;
+        for (size_t t = 0; t < bench_ops.concurrency; ++t) {
+            threads.emplace_back([&, t] {
+                while (true) {
+                    auto i = next.fetch_add(1);
+                    if (i >= count) break;
+                    auto msg = newMsg();
+                    auto msg_id = msg->msg_id;
+                    auto start = Clock::now();
+                    func(i, msg);
+                    if (!context_->Session()->Wait(msg_id)) {
+                        ++errors;
+                    }
+                    latencies[t].push_back(std::chrono::duration_cast<std::chrono::microseconds>(
+                                               Clock::now() - start).count());
+                }
+            });
+        }
+        for (auto &th : threads) {
+            th.join();
+        }
+        auto total = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - begin)
+                         .count();
+
+        std::vector<uint64_t> all;
+        for (auto &l : latencies) {
+            all.insert(all.end(), l.begin(), l.end());
+        }
+        report(name, params, count, errors, total, &all);
+    }
+
+    void MakeHeader(kvrpcpb::RequestHeader *header) {
+        header->set_range_id(range_->options().id());
+        header->mutable_range_epoch()->CopyFrom(epoch_);
+    }
+
+    // 第i个key，按key_size补齐
+    std::string Key(uint64_t i) const {
+        auto key = key_prefix_ + std::to_string(i % bench_ops.preload_rows);
+        if (key.size() < bench_ops.key_size) {
+            key.append(bench_ops.key_size - key.size(), 'k');
+        }
+        return key;
+    }
+
+    Range *GetRange() { return range_.get(); }
+    Table *GetTable() { return table_; }
+
+private:
+    common::ProtoMessage *newMsg() {
+        auto msg = new common::ProtoMessage;
+        msg->begin_time = get_micro_second();
+        msg->expire_time = getticks() + 10000;
+        msg->msg_id = msg_seq_.fetch_add(1);
+        msg->header.msg_id = msg->msg_id;
+        return msg;
+    }
+
+    static uint64_t percentile(const std::vector<uint64_t> &sorted, double p) {
+        if (sorted.empty()) return 0;
+        auto idx = static_cast<size_t>(p * sorted.size());
+        return sorted[std::min(idx, sorted.size() - 1)];
+    }
+
+    static void report(const std::string &name, const std::string &params, uint64_t count,
+                       uint64_t errors, uint64_t total_micros, std::vector<uint64_t> *lats) {
+        std::sort(lats->begin(), lats->end());
+        uint64_t sum = 0;
+        for (auto l : *lats) sum += l;
+        double secs = total_micros > 0 ? total_micros / 1000000.0 : 1e-6;
+
+        std::cout << "{\"case\":\"" << name << "\",\"concurrency\":" << bench_ops.concurrency;
+        if (!params.empty()) std::cout << "," << params;
+        std::cout << ",\"count\":" << count << ",\"errors\":" << errors
+                  << ",\"total_ms\":" << total_micros / 1000
+                  << ",\"ops_per_sec\":" << static_cast<uint64_t>(count / secs)
+                  << ",\"latency_us\":{\"avg\":" << (lats->empty() ? 0 : sum / lats->size())
+                  << ",\"p50\":" << percentile(*lats, 0.5)
+                  << ",\"p90\":" << percentile(*lats, 0.9)
+                  << ",\"p99\":" << percentile(*lats, 0.99)
+                  << ",\"p999\":" << percentile(*lats, 0.999)
+                  << ",\"max\":" << (lats->empty() ? 0 : lats->back()) << "}}" << std::endl;
+    }
+
+private:
+    BenchContext *context_ = nullptr;
+    Table *table_ = nullptr;
+    std::shared_ptr<Range> range_;
+    metapb::RangeEpoch epoch_;
+    std::string key_prefix_;
+    std::atomic<int64_t> msg_seq_ = {1};
+};
+
+std::string kvParams() {
+    std::ostringstream ss;
+    ss << "\"key_size\":" << bench_ops.key_size << ",\"value_size\":" << bench_ops.value_size;
+    return ss.str();
+}
+
+void benchKVSet(Bench *bench, const std::string &name, uint64_t count) {
+    auto value = randomString(bench_ops.value_size);
+    bench->Run(name, kvParams(), count, [&](uint64_t i, common::ProtoMessage *msg) {
+        kvrpcpb::DsKvSetRequest req;
+        bench->MakeHeader(req.mutable_header());
+        req.mutable_req()->mutable_kv()->set_key(bench->Key(i));
+        req.mutable_req()->mutable_kv()->set_value(value);
+        bench->GetRange()->KVSet(msg, req);
+    });
+}
+
+void benchRawGet(Bench *bench) {
+    bench->Run("rawget", kvParams(), bench_ops.requests,
+               [&](uint64_t i, common::ProtoMessage *msg) {
+                   kvrpcpb::DsKvRawGetRequest req;
+                   bench->MakeHeader(req.mutable_header());
+                   req.mutable_req()->set_key(bench->Key(static_cast<uint64_t>(randomInt())));
+                   bench->GetRange()->RawGet(msg, req);
+               });
+}
+
+void benchKVBatchGet(Bench *bench) {
+    auto params = kvParams() + ",\"batch_keys\":" + std::to_string(bench_ops.batch_keys);
+    bench->Run("kvbatchget", params, bench_ops.requests,
+               [&](uint64_t i, common::ProtoMessage *msg) {
+                   kvrpcpb::DsKvBatchGetRequest req;
+                   bench->MakeHeader(req.mutable_header());
+                   for (size_t k = 0; k < bench_ops.batch_keys; ++k) {
+                       req.mutable_req()->add_keys(
+                           bench->Key(static_cast<uint64_t>(randomInt())));
+                   }
+                   bench->GetRange()->KVBatchGet(msg, req);
+               });
+}
+
+void benchInsert(Bench *bench, const std::string &name, uint64_t count) {
+    auto name_value = randomString(bench_ops.value_size);
+    auto params = "\"value_size\":" + std::to_string(bench_ops.value_size);
+    bench->Run(name, params, count, [&](uint64_t i, common::ProtoMessage *msg) {
+        kvrpcpb::DsInsertRequest req;
+        bench->MakeHeader(req.mutable_header());
+        InsertRequestBuilder builder(bench->GetTable());
+        builder.AddRow({std::to_string(i), name_value, std::to_string(i % 1000)});
+        *req.mutable_req() = builder.Build();
+        bench->GetRange()->Insert(msg, req);
+    });
+}
+
+void benchSelect(Bench *bench) {
+    auto params = "\"shape\":\"" + bench_ops.select_shape + "\",\"rows\":" +
+                  std::to_string(bench_ops.preload_rows);
+    bench->Run("select", params, bench_ops.requests, [&](uint64_t i, common::ProtoMessage *msg) {
+        kvrpcpb::DsSelectRequest req;
+        bench->MakeHeader(req.mutable_header());
+        SelectRequestBuilder builder(bench->GetTable());
+        builder.AddAllFields();
+        auto id = static_cast<uint64_t>(randomInt()) % bench_ops.preload_rows;
+        if (bench_ops.select_shape == "key") {
+            builder.SetKey({std::to_string(id)});
+        } else {
+            // 范围扫描，match形状额外带一个过滤条件
+            builder.SetScope({std::to_string(id)}, {std::to_string(id + 100)});
+            if (bench_ops.select_shape == "match") {
+                builder.AddMatch("balance", kvrpcpb::Larger, "500");
+            }
+            builder.AddLimit(100);
+        }
+        *req.mutable_req() = builder.Build();
+        bench->GetRange()->Select(msg, req);
+    });
+}
+
+// 等待range成为leader
+bool waitLeader(BenchContext *context, uint64_t range_id) {
+    for (int i = 0; i < 100; ++i) {
+        auto raft = context->RaftServer()->FindRaft(range_id);
+        if (raft && raft->IsLeader()) {
+            // range在OnLeaderChange回调里更新leader状态
+            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+            return true;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    }
+    return false;
+}
+
+void usage(const char *prog) {
+    std::cerr << "Usage: " << prog
+              << " [-t rawget,kvset,kvbatchget,select,insert] [-c concurrency] [-n requests]"
+                 " [-r preload_rows] [-k key_size] [-v value_size] [-b batch_keys]"
+                 " [-s key|scan|match] [-l log_level]"
+              << std::endl;
+}
+
+void parseOptions(int argc, char *argv[]) {
+    int opt = 0;
+    while ((opt = getopt(argc, argv, "t:c:n:r:k:v:b:s:l:h")) != -1) {
+        switch (opt) {
+            case 't': {
+                std::istringstream ss(optarg);
+                std::string name;
+                while (std::getline(ss, name, ',')) {
+                    if (!name.empty()) bench_ops.cases.insert(name);
+                }
+                break;
+            }
+            case 'c':
+                bench_ops.concurrency = strtoul(optarg, NULL, 10);
+                break;
+            case 'n':
+                bench_ops.requests = strtoull(optarg, NULL, 10);
+                break;
+            case 'r':
+                bench_ops.preload_rows = strtoull(optarg, NULL, 10);
+                break;
+            case 'k':
+                bench_ops.key_size = strtoul(optarg, NULL, 10);
+                break;
+            case 'v':
+                bench_ops.value_size = strtoul(optarg, NULL, 10);
+                break;
+            case 'b':
+                bench_ops.batch_keys = strtoul(optarg, NULL, 10);
+                break;
+            case 's':
+                bench_ops.select_shape = optarg;
+                break;
+            case 'l':
+                bench_ops.log_level = optarg;
+                break;
+            default:
+                usage(argv[0]);
+                exit(opt == 'h' ? EXIT_SUCCESS : EXIT_FAILURE);
+        }
+    }
+    if (bench_ops.concurrency == 0 || bench_ops.requests == 0 || bench_ops.preload_rows == 0 ||
+        (bench_ops.select_shape != "key" && bench_ops.select_shape != "scan" &&
+         bench_ops.select_shape != "match")) {
+        usage(argv[0]);
+        exit(EXIT_FAILURE);
+    }
+}
+
+bool enabled(const std::string &name) {
+    return bench_ops.cases.empty() || bench_ops.cases.count(name) > 0;
+}
+
+}  // namespace
+
+int main(int argc, char *argv[]) {
+    parseOptions(argc, argv);
+
+    log_init2();
+    std::vector<char> level(bench_ops.log_level.begin(), bench_ops.log_level.end());
+    level.push_back('\0');
+    set_log_level(level.data());
+
+    BenchContext context;
+    auto s = context.Init();
+    if (!s.ok()) {
+        std::cerr << "init context failed: " << s.ToString() << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    auto table = CreateAccountTable();
+    auto meta = MakeRangeMeta(table.get(), 1);
+    s = context.CreateRange(meta);
+    if (!s.ok() || !waitLeader(&context, meta.id())) {
+        std::cerr << "create range failed: " << s.ToString() << std::endl;
+        context.Destroy();
+        return EXIT_FAILURE;
+    }
+
+    Bench bench(&context, table.get());
+
+    // 预先写入数据，读请求按key随机命中
+    if (enabled("rawget") || enabled("kvbatchget") || enabled("kvset")) {
+        benchKVSet(&bench, enabled("kvset") ? "kvset" : "preload_kv",
+                   std::max(bench_ops.requests, bench_ops.preload_rows));
+    }
+    if (enabled("rawget")) benchRawGet(&bench);
+    if (enabled("kvbatchget")) benchKVBatchGet(&bench);
+
+    if (enabled("select") || enabled("insert")) {
+        benchInsert(&bench, enabled("insert") ? "insert" : "preload_rows",
+                    std::max(enabled("insert") ? bench_ops.requests : 0, bench_ops.preload_rows));
+    }
+    if (enabled("select")) benchSelect(&bench);
+
+    context.Destroy();
+    return 0;
+}
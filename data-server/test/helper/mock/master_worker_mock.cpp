@@ -31,6 +31,11 @@ void MasterWorkerMock::AsyncNodeHeartbeat(const mspb::NodeHeartbeatRequest &req)
 }
 
 void MasterWorkerMock::AsyncRangeHeartbeat(const mspb::RangeHeartbeatRequest &req) {
+    ++full_range_hbs_;
+}
+
+void MasterWorkerMock::AsyncRangeHeartbeatUnchanged(uint64_t range_id) {
+    ++unchanged_range_hbs_;
 }
 
 void MasterWorkerMock::AsyncAskSplit(const mspb::AskSplitRequest &req) {
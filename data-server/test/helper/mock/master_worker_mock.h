@@ -22,8 +22,17 @@ public:
 
     void AsyncNodeHeartbeat(const mspb::NodeHeartbeatRequest &req) override;
     void AsyncRangeHeartbeat(const mspb::RangeHeartbeatRequest &req) override;
+    void AsyncRangeHeartbeatUnchanged(uint64_t range_id) override;
     void AsyncAskSplit(const mspb::AskSplitRequest &req) override;
     void AsyncReportSplit(const mspb::ReportSplitRequest &req) override;
+
+    // 收到的完整range心跳及内容没有变化的range心跳的次数
+    size_t FullRangeHeartbeats() const { return full_range_hbs_; }
+    size_t UnchangedRangeHeartbeats() const { return unchanged_range_hbs_; }
+
+private:
+    size_t full_range_hbs_ = 0;
+    size_t unchanged_range_hbs_ = 0;
 };
 
 }
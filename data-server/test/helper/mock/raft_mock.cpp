@@ -2,7 +2,8 @@
 
 RaftMock::RaftMock(const RaftOptions& ops) : ops_(ops) {}
 
-Status RaftMock::Submit(std::string& cmd) {
+Status RaftMock::Submit(std::string& cmd, bool batchable) {
+    last_batchable_ = batchable;
     ops_.statemachine->Apply(cmd, 1);
     return Status::OK();
 }
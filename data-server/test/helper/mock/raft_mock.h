@@ -17,16 +17,23 @@ public:
     bool IsLeader() const override;
     Status TryToLeader() override { return Status::OK(); }
 
-    Status Submit(std::string& cmd) override ;
+    Status Submit(std::string& cmd, bool batchable = true) override ;
     Status ChangeMemeber(const ConfChange& conf) override ;
 
-    void GetStatus(RaftStatus* status) const override {}
+    void GetStatus(RaftStatus* status) const override {
+        status->leader = leader_;
+        status->term = term_;
+    }
 
     void Truncate(uint64_t index) override {}
 
+    // 最近一次Submit的命令能否与其他命令合并
+    bool LastBatchable() const { return last_batchable_; }
+
 private:
     RaftOptions ops_;
     uint64_t leader_ = 0;
     uint64_t term_ = 0;
+    bool last_batchable_ = true;
 };
 #endif  //__RAFT_MOCK_H__
@@ -3,6 +3,7 @@
 #include <unistd.h>
 
 #include "base/util.h"
+#include "storage/merge_operator.h"
 #include "storage/meta_store.h"
 #include "range/split_policy.h"
 #include "range/range.h"
@@ -30,6 +31,7 @@ Status RangeContextMock::Init() {
     path_ = path;
     rocksdb::Options ops;
     ops.create_if_missing = true;
+    ops.merge_operator = storage::NewKvMergeOperator();
     auto s = rocksdb::DB::Open(ops, JoinFilePath({path_, "data"}), &db_);
     if (!s.ok()) {
         return Status(Status::kIOError, "open rocksdb", s.ToString());
@@ -105,6 +107,16 @@ Status RangeContextMock::SplitRange(uint64_t range_id, const raft_cmdpb::SplitRe
     return Status::OK();
 }
 
+void RangeContextMock::RetireMergedRange(uint64_t source_id) {
+    std::lock_guard<std::mutex> lock(mu_);
+    retired_ranges_.push_back(source_id);
+}
+
+std::vector<uint64_t> RangeContextMock::RetiredRanges() {
+    std::lock_guard<std::mutex> lock(mu_);
+    return retired_ranges_;
+}
+
 }
 }
 }
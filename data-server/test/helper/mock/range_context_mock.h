@@ -2,6 +2,7 @@ _Pragma("once");
 
 #include <atomic>
 #include <mutex>
+#include <vector>
 
 #include "range/context.h"
 #include "raft/server.h"
@@ -42,6 +43,10 @@ public:
     std::shared_ptr<Range> FindRange(uint64_t range_id) override;
     Status SplitRange(uint64_t range_id, const raft_cmdpb::SplitRequest &req, uint64_t raft_index) override;
 
+    // 只记录，不销毁
+    void RetireMergedRange(uint64_t source_id) override;
+    std::vector<uint64_t> RetiredRanges();
+
 private:
     std::string path_;
     rocksdb::DB *db_ = nullptr;
@@ -55,6 +60,7 @@ private:
     std::atomic<uint64_t> fs_usage_percent_ = {0};
 
     std::map<uint64_t, std::shared_ptr<Range>> ranges_;
+    std::vector<uint64_t> retired_ranges_;
     std::mutex mu_;
 };
 
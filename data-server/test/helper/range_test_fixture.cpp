@@ -187,6 +187,18 @@ Status RangeTestFixture::TestDelete(DsDeleteRequest& req, DsDeleteResponse* resp
     return getResult(resp);
 }
 
+Status RangeTestFixture::TestKVIncr(DsKvIncrRequest& req, DsKvIncrResponse* resp) {
+    auto msg = NewMsg(req);
+    range_->KVIncr(msg, req);
+    return getResult(resp);
+}
+
+Status RangeTestFixture::TestKVAppend(DsKvAppendRequest& req, DsKvAppendResponse* resp) {
+    auto msg = NewMsg(req);
+    range_->KVAppend(msg, req);
+    return getResult(resp);
+}
+
 
 } /* namespace helper */
 } /* namespace test */
@@ -31,6 +31,8 @@ protected:
     Status TestInsert(DsInsertRequest &req, DsInsertResponse *resp);
     Status TestSelect(DsSelectRequest& req, DsSelectResponse* resp);
     Status TestDelete(DsDeleteRequest& req, DsDeleteResponse* resp);
+    Status TestKVIncr(DsKvIncrRequest& req, DsKvIncrResponse* resp);
+    Status TestKVAppend(DsKvAppendRequest& req, DsKvAppendResponse* resp);
 
 private:
     Status getResult(google::protobuf::Message *resp);
@@ -2,6 +2,7 @@
 
 #include "query_parser.h"
 #include "helper_util.h"
+#include "storage/merge_operator.h"
 
 namespace sharkstore {
 namespace test {
@@ -25,6 +26,7 @@ void StoreTestFixture::SetUp() {
     rocksdb::Options ops;
     ops.create_if_missing = true;
     ops.error_if_exists = true;
+    ops.merge_operator = sharkstore::dataserver::storage::NewKvMergeOperator();
     auto s = rocksdb::DB::Open(ops, tmp, &db_);
     ASSERT_TRUE(s.ok());
 
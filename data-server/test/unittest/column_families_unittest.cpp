@@ -0,0 +1,217 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include <thread>
+
+#include <rocksdb/cache.h>
+#include <rocksdb/table.h>
+
+#include "base/status.h"
+#include "base/util.h"
+#include "storage/column_families.h"
+
+int main(int argc, char *argv[]) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+namespace {
+
+using namespace sharkstore;
+using namespace sharkstore::dataserver;
+using namespace sharkstore::dataserver::storage;
+
+class ColumnFamiliesTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        char path[] = "/tmp/sharkstore_ds_cf_test_XXXXXX";
+        char *tmp = mkdtemp(path);
+        ASSERT_TRUE(tmp != NULL);
+        tmp_dir_ = tmp;
+        openDB();
+    }
+
+    void TearDown() override {
+        closeDB();
+        if (!tmp_dir_.empty()) {
+            RemoveDirAll(tmp_dir_.c_str());
+        }
+    }
+
+    // 与RangeServer::OpenDB一致，打开已有的所有column family
+    void openDB() {
+        rocksdb::Options ops;
+        ops.create_if_missing = true;
+        std::vector<std::string> names;
+        auto ret = rocksdb::DB::ListColumnFamilies(ops, tmp_dir_, &names);
+        if (!ret.ok() || names.empty()) {
+            names = {rocksdb::kDefaultColumnFamilyName};
+        }
+        std::vector<rocksdb::ColumnFamilyDescriptor> descs;
+        for (const auto &name : names) {
+            descs.emplace_back(name, rocksdb::ColumnFamilyOptions(ops));
+        }
+        std::vector<rocksdb::ColumnFamilyHandle *> handles;
+        ret = rocksdb::DB::Open(ops, tmp_dir_, descs, &handles, &db_);
+        ASSERT_TRUE(ret.ok()) << ret.ToString();
+        cfs_.reset(new TableColumnFamilies);
+        cfs_->Load(db_, handles);
+    }
+
+    void closeDB() {
+        if (db_ != nullptr) {
+            auto s = cfs_->Release();
+            ASSERT_TRUE(s.ok()) << s.ToString();
+            cfs_.reset();
+            delete db_;
+            db_ = nullptr;
+        }
+    }
+
+protected:
+    std::string tmp_dir_;
+    rocksdb::DB *db_ = nullptr;
+    std::unique_ptr<TableColumnFamilies> cfs_;
+};
+
+TEST_F(ColumnFamiliesTest, Name) {
+    uint64_t table_id = 0;
+    ASSERT_EQ(TableColumnFamilies::Name(123), "table_123");
+    ASSERT_TRUE(TableColumnFamilies::ParseName("table_123", &table_id));
+    ASSERT_EQ(table_id, 123U);
+    ASSERT_FALSE(TableColumnFamilies::ParseName(rocksdb::kDefaultColumnFamilyName, &table_id));
+    ASSERT_FALSE(TableColumnFamilies::ParseName("table_123x", &table_id));
+    ASSERT_FALSE(TableColumnFamilies::ParseName("table_0123", &table_id));
+}
+
+TEST_F(ColumnFamiliesTest, CreateAndRecover) {
+    ASSERT_TRUE(cfs_->Get(1) == nullptr);
+    auto s = cfs_->Create(1, rocksdb::ColumnFamilyOptions(), 0);
+    ASSERT_TRUE(s.ok()) << s.ToString();
+    s = cfs_->Create(2, rocksdb::ColumnFamilyOptions(), 0);
+    ASSERT_TRUE(s.ok()) << s.ToString();
+    ASSERT_EQ(cfs_->GetAll().size(), 2U);
+
+    // 数据只在表的column family中
+    auto cf = cfs_->Get(1);
+    ASSERT_TRUE(cf != nullptr);
+    auto ret = db_->Put(rocksdb::WriteOptions(), cf.get(), "k1", "v1");
+    ASSERT_TRUE(ret.ok()) << ret.ToString();
+    std::string value;
+    ret = db_->Get(rocksdb::ReadOptions(), "k1", &value);
+    ASSERT_TRUE(ret.IsNotFound());
+    cf.reset();
+
+    // 重启后column family及其中的数据恢复
+    closeDB();
+    openDB();
+    ASSERT_EQ(cfs_->GetAll().size(), 2U);
+    cf = cfs_->Get(1);
+    ASSERT_TRUE(cf != nullptr);
+    ASSERT_EQ(cf->GetName(), "table_1");
+    ret = db_->Get(rocksdb::ReadOptions(), cf.get(), "k1", &value);
+    ASSERT_TRUE(ret.ok()) << ret.ToString();
+    ASSERT_EQ(value, "v1");
+}
+
+TEST_F(ColumnFamiliesTest, Drop) {
+    auto s = cfs_->Create(1, rocksdb::ColumnFamilyOptions(), 0);
+    ASSERT_TRUE(s.ok()) << s.ToString();
+
+    // range仍持有handle时也可以drop，handle在range释放后销毁
+    auto cf = cfs_->Get(1);
+    s = cfs_->Drop(1, "a", "z");
+    ASSERT_TRUE(s.ok()) << s.ToString();
+    ASSERT_TRUE(cfs_->Get(1) == nullptr);
+    s = cfs_->Drop(1, "a", "z");
+    ASSERT_EQ(s.code(), Status::kNotFound);
+    cf.reset();
+
+    closeDB();
+    openDB();
+    ASSERT_TRUE(cfs_->Get(1) == nullptr);
+
+    // 同一个表可以再次创建
+    s = cfs_->Create(1, rocksdb::ColumnFamilyOptions(), 0);
+    ASSERT_TRUE(s.ok()) << s.ToString();
+}
+
+TEST_F(ColumnFamiliesTest, SetOptions) {
+    auto s = cfs_->SetOptions(1, {{"disable_auto_compactions", "true"}});
+    ASSERT_EQ(s.code(), Status::kNotFound);
+
+    s = cfs_->Create(1, rocksdb::ColumnFamilyOptions(), 0);
+    ASSERT_TRUE(s.ok()) << s.ToString();
+    s = cfs_->Create(2, rocksdb::ColumnFamilyOptions(), 0);
+    ASSERT_TRUE(s.ok()) << s.ToString();
+    s = cfs_->SetOptions(1, {{"disable_auto_compactions", "true"}});
+    ASSERT_TRUE(s.ok()) << s.ToString();
+    s = cfs_->SetOptions(1, {{"no_such_option", "1"}});
+    ASSERT_FALSE(s.ok());
+
+    // 只影响该表
+    auto cf1 = cfs_->Get(1);
+    auto cf2 = cfs_->Get(2);
+    ASSERT_TRUE(db_->GetOptions(cf1.get()).disable_auto_compactions);
+    ASSERT_FALSE(db_->GetOptions(cf2.get()).disable_auto_compactions);
+}
+
+TEST_F(ColumnFamiliesTest, PerTableOptions) {
+    // 表1使用独立的block cache（rocksdb.high_pri_tables）
+    auto cache = rocksdb::NewLRUCache(8 << 20);
+    rocksdb::BlockBasedTableOptions table_options;
+    table_options.block_cache = cache;
+    rocksdb::ColumnFamilyOptions high_pri;
+    high_pri.table_factory.reset(rocksdb::NewBlockBasedTableFactory(table_options));
+    auto s = cfs_->Create(1, high_pri, 0);
+    ASSERT_TRUE(s.ok()) << s.ToString();
+    s = cfs_->Create(2, rocksdb::ColumnFamilyOptions(), 0);
+    ASSERT_TRUE(s.ok()) << s.ToString();
+
+    auto cf1 = cfs_->Get(1);
+    auto cf2 = cfs_->Get(2);
+    for (auto cf : {cf1, cf2}) {
+        auto ret = db_->Put(rocksdb::WriteOptions(), cf.get(), "k1", std::string(1000, 'a'));
+        ASSERT_TRUE(ret.ok()) << ret.ToString();
+        ret = db_->Flush(rocksdb::FlushOptions(), cf.get());
+        ASSERT_TRUE(ret.ok()) << ret.ToString();
+    }
+
+    // 其他表的读取不占用该cache
+    std::string value;
+    auto ret = db_->Get(rocksdb::ReadOptions(), cf2.get(), "k1", &value);
+    ASSERT_TRUE(ret.ok()) << ret.ToString();
+    ASSERT_EQ(cache->GetUsage(), 0U);
+    ret = db_->Get(rocksdb::ReadOptions(), cf1.get(), "k1", &value);
+    ASSERT_TRUE(ret.ok()) << ret.ToString();
+    ASSERT_GT(cache->GetUsage(), 0U);
+}
+
+TEST_F(ColumnFamiliesTest, ReleaseInUse) {
+    auto s = cfs_->Create(1, rocksdb::ColumnFamilyOptions(), 0);
+    ASSERT_TRUE(s.ok()) << s.ToString();
+
+    auto cf = cfs_->Get(1);
+    s = cfs_->Release(50);
+    ASSERT_EQ(s.code(), Status::kBusy);
+    ASSERT_TRUE(cfs_->Get(1) == nullptr);
+    // handle已被强制销毁，关闭db后持有者再释放不会访问db
+    closeDB();
+    cf.reset();
+}
+
+TEST_F(ColumnFamiliesTest, ReleaseWait) {
+    auto s = cfs_->Create(1, rocksdb::ColumnFamilyOptions(), 0);
+    ASSERT_TRUE(s.ok()) << s.ToString();
+
+    auto cf = cfs_->Get(1);
+    std::thread holder([&cf] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        cf.reset();
+    });
+    // 等待期间持有者释放
+    s = cfs_->Release(5000);
+    holder.join();
+    ASSERT_TRUE(s.ok()) << s.ToString();
+}
+
+} /* namespace  */
@@ -3,6 +3,7 @@
 #include <iomanip>
 #include <iostream>
 #include <limits>
+#include <vector>
 
 #include "common/ds_encoding.h"
 
@@ -193,5 +194,58 @@ TEST(Encoding, AscInt) {
     ASSERT_EQ(value, 1);
 }
 
+TEST(Encoding, AscBytes) {
+    std::string buf;
+    EncodeBytesAscending(&buf, "a\0b", 3);
+    ASSERT_EQ(toHex(buf), "126100ff620001");
+
+    std::string value;
+    size_t offset = 0;
+    ASSERT_TRUE(DecodeBytesAscending(buf, offset, &value));
+    ASSERT_EQ(offset, buf.size());
+    ASSERT_EQ(value, std::string("a\0b", 3));
+
+    // 覆盖分块查找的边界: 长度跨越16/32字节, 转义字节落在块内不同位置
+    for (size_t len = 0; len < 100; ++len) {
+        for (size_t zero_pos = 0; zero_pos <= len; zero_pos += 7) {
+            std::string origin(len, 'x');
+            if (zero_pos < len) origin[zero_pos] = '\x00';
+            if (len > 40) origin[len - 1] = '\x00';
+
+            std::string encoded("prefix");
+            EncodeBytesAscending(&encoded, origin.data(), origin.size());
+            EncodeVarintAscending(&encoded, 1);
+
+            std::string decoded("abc");
+            offset = 6;
+            ASSERT_TRUE(DecodeBytesAscending(encoded, offset, &decoded));
+            ASSERT_EQ(decoded, "abc" + origin);
+            int64_t i = 0;
+            ASSERT_TRUE(DecodeVarintAscending(encoded, offset, &i));
+            ASSERT_EQ(i, 1);
+            ASSERT_EQ(offset, encoded.size());
+
+            std::vector<char> out(encoded.size());
+            size_t out_len = 0;
+            offset = 6;
+            ASSERT_TRUE(DecodeBytesAscending(encoded.data(), encoded.size(), offset,
+                                             out.data(), &out_len));
+            ASSERT_EQ(std::string(out.data(), out_len), origin);
+        }
+    }
+
+    // 缺少结束符或非法转义
+    std::string bad;
+    EncodeBytesAscending(&bad, "abc", 3);
+    bad.pop_back();
+    offset = 0;
+    value.clear();
+    ASSERT_FALSE(DecodeBytesAscending(bad, offset, &value));
+    ASSERT_TRUE(value.empty());
+    bad.push_back('\x02');
+    offset = 0;
+    ASSERT_FALSE(DecodeBytesAscending(bad, offset, nullptr));
+}
+
 // end namespace
 }
\ No newline at end of file
@@ -0,0 +1,148 @@
+#include <gtest/gtest.h>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "helper/store_test_fixture.h"
+#include "helper/table.h"
+#include "range/lock_index.h"
+
+int main(int argc, char* argv[]) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+namespace {
+
+using namespace sharkstore::dataserver::range;
+using namespace sharkstore::test::helper;
+
+TEST(ExpireWheel, Advance) {
+    const int64_t start = 1000000;
+    ExpireWheel wheel(10);
+    wheel.Reset(start);
+
+    // 覆盖各层及超出时间轮范围的到期时间
+    std::vector<int64_t> delays = {0, 5, 10, 630, 650, 41000, 2700000, 200000000};
+    for (size_t i = 0; i < delays.size(); ++i) {
+        wheel.Add(std::to_string(i), start + delays[i]);
+    }
+    ASSERT_EQ(wheel.Size(), delays.size());
+
+    std::vector<ExpireWheel::Item> expired;
+    wheel.Advance(start, &expired);
+    ASSERT_EQ(expired.size(), 2U);  // 0, 5在当前tick内
+
+    std::set<std::string> seen;
+    for (const auto& item : expired) {
+        seen.insert(item.key);
+    }
+    int64_t now = start;
+    while (wheel.Size() > 0) {
+        now += 7;
+        expired.clear();
+        wheel.Advance(now, &expired);
+        for (const auto& item : expired) {
+            // 不早于到期时间所在的tick，也不晚于一个tick
+            ASSERT_LE(item.deadline / 10, now / 10) << item.key;
+            ASSERT_GT(item.deadline + 10, now - 7) << item.key;
+            seen.insert(item.key);
+        }
+        ASSERT_LE(now, start + 200000000 + 10);
+    }
+    ASSERT_EQ(seen.size(), delays.size());
+}
+
+TEST(ExpireWheel, Overdue) {
+    ExpireWheel wheel(100);
+    wheel.Reset(5000);
+    wheel.Add("a", 100);
+    wheel.Add("b", 5200);
+
+    std::vector<ExpireWheel::Item> expired;
+    wheel.Advance(5000, &expired);
+    ASSERT_EQ(expired.size(), 1U);
+    ASSERT_EQ(expired[0].key, "a");
+
+    expired.clear();
+    wheel.Advance(5199, &expired);
+    ASSERT_TRUE(expired.empty());
+    wheel.Advance(5200, &expired);
+    ASSERT_EQ(expired.size(), 1U);
+    ASSERT_EQ(expired[0].key, "b");
+    ASSERT_EQ(wheel.Size(), 0U);
+}
+
+TEST(LockIndex, ExpireTime) {
+    kvrpcpb::LockValue value;
+    value.set_update_time(1000);
+    ASSERT_EQ(LockIndex::ExpireTime(value), 1000 + DEFAULT_LOCK_DELETE_TIME_MILLSEC + 1);
+    ASSERT_FALSE(LockIndex::IsExpired(value, 1000 + DEFAULT_LOCK_DELETE_TIME_MILLSEC));
+    ASSERT_TRUE(LockIndex::IsExpired(value, 1000 + DEFAULT_LOCK_DELETE_TIME_MILLSEC + 1));
+
+    value.set_delete_time(2000);
+    ASSERT_EQ(LockIndex::ExpireTime(value), 2000);
+    ASSERT_TRUE(LockIndex::IsExpired(value, 2000));
+
+    // 未加载时不维护
+    LockIndex index;
+    index.Put("a", value);
+    ASSERT_FALSE(index.Loaded());
+    ASSERT_FALSE(index.Get("a", &value));
+}
+
+class LockIndexStoreTest : public StoreTestFixture {
+public:
+    LockIndexStoreTest() : StoreTestFixture(CreateAccountTable()) {}
+
+protected:
+    std::string key(const std::string& suffix) { return meta_.start_key() + suffix; }
+
+    void putLock(const std::string& suffix, const std::string& id) {
+        kvrpcpb::LockValue value;
+        value.set_id(id);
+        value.set_update_time(1000);
+        auto s = store_->Put(key(suffix), value.SerializeAsString());
+        ASSERT_TRUE(s.ok()) << s.ToString();
+    }
+};
+
+TEST_F(LockIndexStoreTest, MatchStorage) {
+    putLock("a", "lock-a");
+    putLock("b", "");  // 没有锁id，不是锁
+    auto s = store_->Put(key("c"), "\xff\xff\xff");  // 不是LockValue
+    ASSERT_TRUE(s.ok()) << s.ToString();
+    putLock("d", "lock-d");
+
+    // 从存储按ParseLock读出的锁
+    std::vector<std::string> expected;
+    std::unique_ptr<sharkstore::dataserver::storage::Iterator> it(store_->NewIterator());
+    kvrpcpb::LockValue value;
+    for (; it->Valid(); it->Next()) {
+        if (LockIndex::ParseLock(it->value(), &value)) {
+            expected.push_back(it->key());
+        }
+    }
+    ASSERT_EQ(expected, std::vector<std::string>({key("a"), key("d")}));
+
+    LockIndex index;
+    s = index.Load(store_);
+    ASSERT_TRUE(s.ok()) << s.ToString();
+    ASSERT_EQ(index.Size(), 2U);
+
+    kvrpcpb::LockScanResponse resp;
+    ASSERT_EQ(index.Scan(meta_.start_key(), meta_.end_key(), 10, &resp), 2U);
+    ASSERT_EQ(resp.info(0).key(), key("a"));
+    ASSERT_EQ(resp.info(1).key(), key("d"));
+
+    // 没有锁id的值写入后与重新加载的结果一致
+    value.Clear();
+    index.Put(key("a"), value);
+    index.Put(key("b"), value);
+    ASSERT_EQ(index.Size(), 1U);
+    ASSERT_FALSE(index.Get(key("a"), &value));
+    ASSERT_TRUE(index.Get(key("d"), &value));
+    ASSERT_EQ(value.id(), "lock-d");
+}
+
+} /* namespace  */
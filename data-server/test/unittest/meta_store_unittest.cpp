@@ -5,6 +5,7 @@
 #include "base/util.h"
 #include "common/ds_encoding.h"
 #include "storage/meta_store.h"
+#include "storage/ttl.h"
 
 int main(int argc, char *argv[]) {
     testing::InitGoogleTest(&argc, argv);
@@ -78,6 +79,59 @@ TEST_F(MetaStoreTest, ApplyIndex) {
     ASSERT_EQ(applied, 0);
 }
 
+TEST_F(MetaStoreTest, MergeState) {
+    uint64_t range_id = sharkstore::randomInt();
+    uint64_t target = 1;
+    auto s = store_->LoadMergeState(range_id, &target);
+    ASSERT_TRUE(s.ok()) << s.ToString();
+    ASSERT_EQ(target, 0);
+
+    uint64_t save_target = sharkstore::randomInt();
+    s = store_->SaveMergeState(range_id, save_target);
+    ASSERT_TRUE(s.ok()) << s.ToString();
+
+    s = store_->LoadMergeState(range_id, &target);
+    ASSERT_TRUE(s.ok()) << s.ToString();
+    ASSERT_EQ(target, save_target);
+
+    s = store_->DeleteMergeState(range_id);
+    ASSERT_TRUE(s.ok()) << s.ToString();
+
+    s = store_->LoadMergeState(range_id, &target);
+    ASSERT_TRUE(s.ok()) << s.ToString();
+    ASSERT_EQ(target, 0);
+}
+
+TEST_F(MetaStoreTest, TtlTable) {
+    std::vector<metapb::Range> metas(1);
+    metas[0].set_id(1);
+    metas[0].set_table_id(2);
+
+    // 本节点上没有数据的表可以开启TTL，并记录到meta中
+    ASSERT_TRUE(InitTableTtl("1:100").ok());
+    auto s = CheckTableTtl(store_, metas);
+    ASSERT_TRUE(s.ok()) << s.ToString();
+    std::vector<uint64_t> tables;
+    s = store_->GetTtlTables(&tables);
+    ASSERT_TRUE(s.ok()) << s.ToString();
+    ASSERT_EQ(tables, std::vector<uint64_t>{1});
+
+    // 已有数据的表不能开启TTL
+    ASSERT_TRUE(InitTableTtl("1:100,2:100").ok());
+    s = CheckTableTtl(store_, metas);
+    ASSERT_EQ(s.code(), Status::kInvalidArgument);
+
+    // 开启过TTL的表不能去掉，TTL可以修改
+    ASSERT_TRUE(InitTableTtl("").ok());
+    s = CheckTableTtl(store_, metas);
+    ASSERT_EQ(s.code(), Status::kInvalidArgument);
+    ASSERT_TRUE(InitTableTtl("1:0").ok());
+    s = CheckTableTtl(store_, metas);
+    ASSERT_TRUE(s.ok()) << s.ToString();
+
+    ASSERT_TRUE(InitTableTtl("").ok());
+}
+
 static metapb::Range genRange(uint64_t i) {
     metapb::Range rng;
     rng.set_id(i);
@@ -1,6 +1,8 @@
+#include <unistd.h>
 #include <gtest/gtest.h>
 
 #include "monitor/isystemstatus.h"
+#include "monitor/proc_sampler.h"
 #include "monitor/statistics.h"
 
 int main(int argc, char* argv[]) {
@@ -28,4 +30,65 @@ TEST(Monitor, Statistics) {
     s.ToString();
 }
 
+#ifdef __linux__
+TEST(Monitor, ProcParse) {
+    ProcCounters c;
+    std::string stat = "cpu  10 0 10 70 10 0 0 0 0 0\n"
+                       "cpu0 5 0 5 35 5 0 0 0 0 0\n"
+                       "cpu1 5 0 5 35 5 0 0 0 0 0\n"
+                       "intr 1 2\n";
+    ASSERT_TRUE(ProcSampler::ParseStat(stat.data(), stat.size(), &c));
+    ASSERT_EQ(c.cpu.total, 100);
+    ASSERT_EQ(c.cpu.idle, 80);
+    ASSERT_EQ(c.cpu_count, 2);
+
+    std::string self = "123 (a b) c) S 1 1 1 0 -1 4194560 100 0 0 0 7 3 0 0 20 0 1 0\n";
+    ASSERT_TRUE(ProcSampler::ParseSelfStat(self.data(), self.size(), &c));
+    ASSERT_EQ(c.proc_cpu, 10);
+
+    std::string disk = "   7       0 loop0 1 0 2 0 0 0 0 0 0 0 0\n"
+                       "   8       0 sda 100 0 800 50 200 0 1600 400 0 300 450\n"
+                       "   8       1 sda1 90 0 700 40 190 0 1500 390 0 290 430\n";
+    ASSERT_TRUE(ProcSampler::ParseDiskStats(disk.data(), disk.size(), &c));
+    ASSERT_EQ(c.disk_count, 1);
+    ASSERT_STREQ(c.disks[0].name, "sda");
+    ASSERT_EQ(c.disks[0].write_ms, 400);
+    ASSERT_EQ(c.disks[0].io_ms, 300);
+
+    std::string net = "Inter-|   Receive |  Transmit\n"
+                      " face |bytes packets\n"
+                      "    lo: 1 2 3 4 5 6 7 8 9 10 11 12 13 14 15 16\n"
+                      "  eth0:1000 10 1 2 0 0 0 0 2000 20 3 4 0 0 0 0\n";
+    ASSERT_TRUE(ProcSampler::ParseNetDev(net.data(), net.size(), &c));
+    ASSERT_EQ(c.nic_count, 1);
+    ASSERT_STREQ(c.nics[0].name, "eth0");
+    ASSERT_EQ(c.nics[0].tx_bytes, 2000);
+
+    // 一秒内读写各10次
+    ProcCounters next = c;
+    next.time_ms = c.time_ms + 1000;
+    next.disks[0].reads += 10;
+    next.disks[0].read_ms += 50;
+    next.disks[0].writes += 10;
+    next.disks[0].io_ms += 500;
+    ProcStats stats;
+    ProcSampler::Diff(c, next, &stats);
+    ASSERT_EQ(stats.disk_count, 1);
+    ASSERT_DOUBLE_EQ(stats.disks[0].read_iops, 10);
+    ASSERT_DOUBLE_EQ(stats.disks[0].read_latency_ms, 5);
+    ASSERT_DOUBLE_EQ(stats.disks[0].util, 50);
+}
+
+TEST(Monitor, ProcSample) {
+    ProcSampler sampler;
+    ProcStats stats;
+    ASSERT_TRUE(sampler.Sample(&stats));
+    ASSERT_EQ(stats.elapsed_ms, 0);
+    usleep(100 * 1000);
+    ASSERT_TRUE(sampler.Sample(&stats));
+    ASSERT_GT(stats.elapsed_ms, 0);
+    ASSERT_GT(stats.cpu_count, 0);
+}
+#endif
+
 } /* namespace  */
@@ -0,0 +1,127 @@
+#include <gtest/gtest.h>
+
+#include "helper/cpp_permission.h"
+
+#include "base/status.h"
+#include "master/client.h"
+#include "master/worker_impl.h"
+#include "range/range.h"
+
+#include "helper/mock/master_worker_mock.h"
+#include "helper/range_test_fixture.h"
+
+int main(int argc, char* argv[]) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+namespace {
+
+using namespace sharkstore;
+using namespace sharkstore::test::helper;
+using namespace sharkstore::test::mock;
+using namespace sharkstore::dataserver;
+
+mspb::RangeHeartbeatRequest makeHeartbeat(uint64_t range_id, size_t payload) {
+    mspb::RangeHeartbeatRequest hb;
+    hb.mutable_range()->set_id(range_id);
+    hb.mutable_range()->set_start_key(std::string(payload, 'a'));
+    return hb;
+}
+
+TEST(RangeHeartbeat, Split) {
+    std::map<uint64_t, mspb::RangeHeartbeatRequest> hbs;
+    size_t hb_size = 0;
+    for (uint64_t id = 1; id <= 5; ++id) {
+        hbs[id] = makeHeartbeat(id, 100);
+        hb_size = hbs[id].ByteSizeLong();
+    }
+
+    // 每个请求最多放两个完整心跳，内容没有变化的range都在第一个请求中
+    auto reqs = master::SplitRangeHeartbeats(9, std::move(hbs), {7, 8}, hb_size * 2);
+    ASSERT_EQ(reqs.size(), 3U);
+    ASSERT_EQ(reqs[0].unchanged_ranges_size(), 2);
+    std::vector<uint64_t> ids;
+    for (const auto& req : reqs) {
+        ASSERT_EQ(req.node_id(), 9U);
+        ASSERT_LE(req.heartbeats_size(), 2);
+        for (const auto& hb : req.heartbeats()) {
+            ids.push_back(hb.range().id());
+        }
+    }
+    ASSERT_EQ(reqs[1].unchanged_ranges_size(), 0);
+    ASSERT_EQ(ids, std::vector<uint64_t>({1, 2, 3, 4, 5}));
+
+    // 单个心跳超过上限时独占一个请求
+    hbs.clear();
+    hbs[1] = makeHeartbeat(1, 1000);
+    hbs[2] = makeHeartbeat(2, 10);
+    hbs[3] = makeHeartbeat(3, 10);
+    reqs = master::SplitRangeHeartbeats(9, std::move(hbs), {}, 500);
+    ASSERT_EQ(reqs.size(), 2U);
+    ASSERT_EQ(reqs[0].heartbeats_size(), 1);
+    ASSERT_EQ(reqs[0].heartbeats(0).range().id(), 1U);
+    ASSERT_EQ(reqs[1].heartbeats_size(), 2);
+
+    // 只有内容没有变化的range
+    hbs.clear();
+    reqs = master::SplitRangeHeartbeats(9, std::move(hbs), {1}, 500);
+    ASSERT_EQ(reqs.size(), 1U);
+    ASSERT_EQ(reqs[0].heartbeats_size(), 0);
+    ASSERT_EQ(reqs[0].unchanged_ranges_size(), 1);
+}
+
+TEST(RangeHeartbeat, BatchUnsupported) {
+    master::Client client({"127.0.0.1:1"});
+    ASSERT_TRUE(client.BatchRangeHeartbeatSupported());
+
+    // 旧版本的master返回UNIMPLEMENTED后改用RangeHeartbeat
+    client.setBatchRangeHeartbeatUnsupported();
+    ASSERT_FALSE(client.BatchRangeHeartbeatSupported());
+
+    // 一段时间后再尝试
+    client.batch_hb_unsupported_at_ -= std::chrono::seconds(61);
+    ASSERT_TRUE(client.BatchRangeHeartbeatSupported());
+
+    // leader变化后再尝试
+    client.setBatchRangeHeartbeatUnsupported();
+    client.set_leader("127.0.0.1:2");
+    ASSERT_TRUE(client.BatchRangeHeartbeatSupported());
+}
+
+class RangeHeartbeatTest : public RangeTestFixture {
+protected:
+    void SetUp() override {
+        RangeTestFixture::SetUp();
+        SetLeader(range_->node_id_);
+    }
+
+    MasterWorkerMock* master() {
+        return static_cast<MasterWorkerMock*>(context_->MasterClient());
+    }
+};
+
+TEST_F(RangeHeartbeatTest, Unchanged) {
+    ASSERT_TRUE(range_->PushHeartBeatMessage());
+    ASSERT_EQ(master()->FullRangeHeartbeats(), 1U);
+
+    // 内容没有变化时只发送range id
+    ASSERT_TRUE(range_->PushHeartBeatMessage());
+    ASSERT_EQ(master()->FullRangeHeartbeats(), 1U);
+    ASSERT_EQ(master()->UnchangedRangeHeartbeats(), 1U);
+
+    // master要求完整心跳（或完整心跳未送达）后重发完整心跳
+    range_->ResetHeartbeat();
+    ASSERT_TRUE(range_->PushHeartBeatMessage());
+    ASSERT_EQ(master()->FullRangeHeartbeats(), 2U);
+    ASSERT_TRUE(range_->PushHeartBeatMessage());
+    ASSERT_EQ(master()->UnchangedRangeHeartbeats(), 2U);
+
+    // 内容变化（term变化）时发送完整心跳
+    SetLeader(range_->node_id_);
+    ASSERT_TRUE(range_->PushHeartBeatMessage());
+    ASSERT_EQ(master()->FullRangeHeartbeats(), 3U);
+    ASSERT_EQ(master()->UnchangedRangeHeartbeats(), 2U);
+}
+
+} /* namespace  */
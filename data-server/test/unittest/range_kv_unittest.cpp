@@ -0,0 +1,127 @@
+#include <gtest/gtest.h>
+#include <fastcommon/shared_func.h>
+
+#include "helper/cpp_permission.h"
+
+#include "base/status.h"
+#include "base/util.h"
+#include "common/ds_config.h"
+#include "range/range.h"
+#include "storage/store.h"
+
+#include "helper/helper_util.h"
+#include "helper/mock/raft_mock.h"
+#include "helper/range_test_fixture.h"
+
+int main(int argc, char* argv[]) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+namespace {
+
+using namespace sharkstore;
+using namespace sharkstore::test::helper;
+using namespace sharkstore::dataserver;
+
+class RangeKVTest : public RangeTestFixture {
+protected:
+    void SetUp() override {
+        RangeTestFixture::SetUp();
+        SetLeader(range_->node_id_);
+    }
+
+    std::string makeKey(const std::string& suffix) {
+        std::string key;
+        EncodeKeyPrefix(&key, table_->GetID());
+        key += suffix;
+        return key;
+    }
+};
+
+TEST_F(RangeKVTest, IncrAppend) {
+    auto key = makeKey("counter");
+    for (auto delta : {10, -3}) {
+        DsKvIncrRequest req;
+        MakeHeader(req.mutable_header());
+        req.mutable_req()->set_key(key);
+        req.mutable_req()->set_delta(delta);
+        DsKvIncrResponse resp;
+        auto s = TestKVIncr(req, &resp);
+        ASSERT_TRUE(s.ok()) << s.ToString();
+        ASSERT_FALSE(resp.header().has_error()) << resp.header().error().ShortDebugString();
+        ASSERT_EQ(resp.resp().code(), Status::kOk);
+        // 重复应用结果会变，不与其他命令合并为一条日志
+        auto raft = std::static_pointer_cast<RaftMock>(range_->raft_);
+        ASSERT_FALSE(raft->LastBatchable());
+    }
+    std::string value;
+    auto s = range_->store_->Get(key, &value);
+    ASSERT_TRUE(s.ok()) << s.ToString();
+    ASSERT_EQ(value, "7");
+
+    {
+        DsKvAppendRequest req;
+        MakeHeader(req.mutable_header());
+        req.mutable_req()->set_key(key);
+        req.mutable_req()->set_value("abc");
+        DsKvAppendResponse resp;
+        s = TestKVAppend(req, &resp);
+        ASSERT_TRUE(s.ok()) << s.ToString();
+        ASSERT_FALSE(resp.header().has_error()) << resp.header().error().ShortDebugString();
+        ASSERT_EQ(resp.resp().code(), Status::kOk);
+    }
+    s = range_->store_->Get(key, &value);
+    ASSERT_TRUE(s.ok()) << s.ToString();
+    ASSERT_EQ(value, "7abc");
+
+    // key不在range内
+    {
+        DsKvIncrRequest req;
+        MakeHeader(req.mutable_header());
+        req.mutable_req()->set_key(range_->meta_.GetEndKey());
+        req.mutable_req()->set_delta(1);
+        DsKvIncrResponse resp;
+        s = TestKVIncr(req, &resp);
+        ASSERT_TRUE(s.ok()) << s.ToString();
+        ASSERT_TRUE(resp.header().has_error());
+        ASSERT_TRUE(resp.header().error().has_key_not_in_range());
+    }
+}
+
+TEST_F(RangeKVTest, IncrReplay) {
+    auto key = makeKey("counter");
+    raft_cmdpb::Command cmd;
+    cmd.set_cmd_type(raft_cmdpb::CmdType::KvIncr);
+    cmd.mutable_verify_epoch()->CopyFrom(range_->options().range_epoch());
+    cmd.mutable_kv_incr_req()->set_key(key);
+    cmd.mutable_kv_incr_req()->set_delta(5);
+    std::string data;
+    cmd.SerializeToString(&data);
+    auto s = range_->Apply(data, 20);
+    ASSERT_TRUE(s.ok()) << s.ToString();
+
+    // 模拟写入数据后、保存apply index到meta前重启
+    s = context_->MetaStore()->SaveApplyIndex(range_->id_, 19);
+    ASSERT_TRUE(s.ok()) << s.ToString();
+    auto rng = std::make_shared<Range>(context_.get(), range_->options());
+    s = rng->Initialize(0, 0);
+    ASSERT_TRUE(s.ok()) << s.ToString();
+    ASSERT_EQ(rng->apply_index_, 20U);
+
+    // raft只重放apply index之后的日志，incr不会再应用一次
+    std::string value;
+    s = rng->store_->Get(key, &value);
+    ASSERT_TRUE(s.ok()) << s.ToString();
+    ASSERT_EQ(value, "5");
+
+    // range删除时一并删除
+    s = rng->Destroy(false);
+    ASSERT_TRUE(s.ok()) << s.ToString();
+    uint64_t applied = 0;
+    s = rng->store_->LoadApplyIndex(&applied);
+    ASSERT_TRUE(s.ok()) << s.ToString();
+    ASSERT_EQ(applied, 0U);
+}
+
+} /* namespace  */
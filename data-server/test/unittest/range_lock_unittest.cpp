@@ -0,0 +1,159 @@
+#include <gtest/gtest.h>
+#include <fastcommon/shared_func.h>
+
+#include "helper/cpp_permission.h"
+
+#include "base/status.h"
+#include "base/util.h"
+#include "common/ds_config.h"
+#include "frame/sf_util.h"
+#include "range/range.h"
+#include "storage/store.h"
+
+#include "helper/helper_util.h"
+#include "helper/mock/raft_mock.h"
+#include "helper/range_test_fixture.h"
+
+int main(int argc, char* argv[]) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+namespace {
+
+using namespace sharkstore;
+using namespace sharkstore::test::helper;
+using namespace sharkstore::dataserver;
+
+class RangeLockTest : public RangeTestFixture {
+protected:
+    void SetUp() override {
+        RangeTestFixture::SetUp();
+        SetLeader(range_->node_id_);
+    }
+
+    std::string makeKey(const std::string& suffix) {
+        std::string key;
+        EncodeKeyPrefix(&key, table_->GetID());
+        key += suffix;
+        return key;
+    }
+
+    Status apply(const raft_cmdpb::Command& cmd) {
+        std::string data;
+        cmd.SerializeToString(&data);
+        return range_->Apply(data, ++index_);
+    }
+
+    raft_cmdpb::Command makeCmd(raft_cmdpb::CmdType type) {
+        raft_cmdpb::Command cmd;
+        cmd.set_cmd_type(type);
+        cmd.mutable_verify_epoch()->CopyFrom(range_->options().range_epoch());
+        return cmd;
+    }
+
+    void lock(const std::string& key, const std::string& id) {
+        auto cmd = makeCmd(raft_cmdpb::CmdType::Lock);
+        cmd.mutable_lock_req()->set_key(key);
+        cmd.mutable_lock_req()->mutable_value()->set_id(id);
+        auto s = apply(cmd);
+        ASSERT_TRUE(s.ok()) << s.ToString();
+    }
+
+    void set(const std::string& key, const std::string& value) {
+        auto cmd = makeCmd(raft_cmdpb::CmdType::KvSet);
+        cmd.mutable_kv_set_req()->mutable_kv()->set_key(key);
+        cmd.mutable_kv_set_req()->mutable_kv()->set_value(value);
+        cmd.mutable_kv_set_req()->set_case_(kvrpcpb::EC_Force);
+        auto s = apply(cmd);
+        ASSERT_TRUE(s.ok()) << s.ToString();
+    }
+
+    void rangeDelete(const std::string& start, const std::string& limit) {
+        auto cmd = makeCmd(raft_cmdpb::CmdType::KvRangeDel);
+        cmd.mutable_kv_range_del_req()->set_start(start);
+        cmd.mutable_kv_range_del_req()->set_limit(limit);
+        auto s = apply(cmd);
+        ASSERT_TRUE(s.ok()) << s.ToString();
+    }
+
+protected:
+    uint64_t index_ = 10;
+};
+
+TEST_F(RangeLockTest, SyncIndex) {
+    lock(makeKey("a"), "id-a");
+    ASSERT_TRUE(range_->lock_index_.Loaded());
+
+    // 非lock命令写入的key逐个同步，不重置索引
+    set(makeKey("b"), "value");
+    ASSERT_TRUE(range_->lock_index_.Loaded());
+    ASSERT_EQ(range_->lock_index_.Size(), 1U);
+
+    kvrpcpb::LockValue value;
+    value.set_id("id-c");
+    set(makeKey("c"), value.SerializeAsString());
+    ASSERT_TRUE(range_->lock_index_.Loaded());
+    ASSERT_TRUE(range_->lock_index_.Get(makeKey("c"), &value));
+
+    set(makeKey("a"), "value");
+    ASSERT_TRUE(range_->lock_index_.Loaded());
+    ASSERT_FALSE(range_->lock_index_.Get(makeKey("a"), &value));
+    ASSERT_EQ(range_->lock_index_.Size(), 1U);
+
+    // 范围删除不涉及锁时保留索引
+    rangeDelete(makeKey("d"), makeKey("e"));
+    ASSERT_TRUE(range_->lock_index_.Loaded());
+
+    // 涉及锁时重置，与存储一致
+    rangeDelete(makeKey("b"), makeKey("d"));
+    ASSERT_FALSE(range_->lock_index_.Loaded());
+    ASSERT_FALSE(range_->LockRead(makeKey("c"), &value));
+    ASSERT_TRUE(range_->lock_index_.Loaded());
+    ASSERT_EQ(range_->lock_index_.Size(), 0U);
+}
+
+TEST_F(RangeLockTest, Reap) {
+    lock(makeKey("a"), "id-a");
+    lock(makeKey("b"), "id-b");
+
+    // 只删除列出的、锁id一致的key，不在apply时判断是否过期
+    auto cmd = makeCmd(raft_cmdpb::CmdType::LockReap);
+    auto item = cmd.mutable_lock_reap_req()->add_locks();
+    item->set_key(makeKey("a"));
+    item->set_id("id-a");
+    item = cmd.mutable_lock_reap_req()->add_locks();
+    item->set_key(makeKey("b"));
+    item->set_id("id-other");
+    auto s = apply(cmd);
+    ASSERT_TRUE(s.ok()) << s.ToString();
+
+    std::string value;
+    s = range_->store_->Get(makeKey("a"), &value);
+    ASSERT_EQ(s.code(), Status::kNotFound);
+    s = range_->store_->Get(makeKey("b"), &value);
+    ASSERT_TRUE(s.ok()) << s.ToString();
+    ASSERT_EQ(range_->lock_index_.Size(), 1U);
+}
+
+TEST_F(RangeLockTest, ReapExpired) {
+    // 已过期的锁
+    kvrpcpb::LockValue value;
+    value.set_id("id-a");
+    value.set_update_time(1000);
+    auto s = range_->store_->Put(makeKey("a"), value.SerializeAsString());
+    ASSERT_TRUE(s.ok()) << s.ToString();
+    lock(makeKey("b"), "id-b");
+    ASSERT_EQ(range_->lock_index_.Size(), 2U);
+
+    // leader判断过期后提交清理命令（mock中立即apply）
+    range_->ReapExpiredLocks();
+    std::string data;
+    s = range_->store_->Get(makeKey("a"), &data);
+    ASSERT_EQ(s.code(), Status::kNotFound);
+    s = range_->store_->Get(makeKey("b"), &data);
+    ASSERT_TRUE(s.ok()) << s.ToString();
+    ASSERT_EQ(range_->lock_index_.Size(), 1U);
+}
+
+} /* namespace  */
@@ -0,0 +1,236 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <fastcommon/shared_func.h>
+
+#include "helper/cpp_permission.h"
+
+#include "base/status.h"
+#include "base/util.h"
+#include "common/ds_config.h"
+#include "frame/sf_util.h"
+#include "range/range.h"
+#include "storage/meta_store.h"
+#include "storage/store.h"
+
+#include "helper/helper_util.h"
+#include "helper/mock/raft_mock.h"
+#include "helper/mock/socket_session_mock.h"
+#include "helper/range_test_fixture.h"
+
+int main(int argc, char* argv[]) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+namespace {
+
+using namespace sharkstore;
+using namespace sharkstore::test::helper;
+using namespace sharkstore::dataserver;
+
+// range_(1)分裂出source_(2)，两者的leader都在本节点，再把source_合并回range_
+class RangeMergeTest : public RangeTestFixture {
+protected:
+    void SetUp() override {
+        RangeTestFixture::SetUp();
+        SetLeader(range_->node_id_);
+
+        auto s = Split();
+        ASSERT_TRUE(s.ok()) << s.ToString();
+        source_ = context_->FindRange(range_->split_range_id_);
+        ASSERT_TRUE(source_ != nullptr);
+        auto r = std::static_pointer_cast<RaftMock>(source_->raft_);
+        r->SetLeaderTerm(source_->node_id_, term_);
+        source_->is_leader_ = true;
+    }
+
+    void TearDown() override {
+        source_.reset();
+        RangeTestFixture::TearDown();
+    }
+
+    std::string makeKey(const std::string& suffix) {
+        std::string key;
+        EncodeKeyPrefix(&key, table_->GetID());
+        key += suffix;
+        return key;
+    }
+
+    raft_cmdpb::Command makeMergeCmd(bool commit, const metapb::Range& target,
+                                     const metapb::Range& source) {
+        raft_cmdpb::Command cmd;
+        cmd.set_cmd_type(raft_cmdpb::CmdType::AdminMerge);
+        if (commit) {
+            cmd.mutable_verify_epoch()->CopyFrom(target.range_epoch());
+        } else {
+            cmd.mutable_verify_epoch()->CopyFrom(source.range_epoch());
+        }
+        auto req = cmd.mutable_admin_merge_req();
+        req->set_commit(commit);
+        req->mutable_target()->CopyFrom(target);
+        req->mutable_source()->CopyFrom(source);
+        return cmd;
+    }
+
+    raft_cmdpb::Command makeSetCmd(const metapb::RangeEpoch& epoch, const std::string& key,
+                                   const std::string& value) {
+        raft_cmdpb::Command cmd;
+        cmd.set_cmd_type(raft_cmdpb::CmdType::KvSet);
+        cmd.mutable_verify_epoch()->CopyFrom(epoch);
+        auto req = cmd.mutable_kv_set_req();
+        req->mutable_kv()->set_key(key);
+        req->mutable_kv()->set_value(value);
+        req->set_case_(kvrpcpb::EC_Force);
+        return cmd;
+    }
+
+    // 模拟副本上按日志顺序应用
+    Status apply(const std::shared_ptr<Range>& rng, const raft_cmdpb::Command& cmd,
+                 uint64_t index) {
+        std::string data;
+        cmd.SerializeToString(&data);
+        return rng->Apply(data, index);
+    }
+
+    size_t retiredCount(uint64_t range_id) {
+        auto ids = context_->RetiredRanges();
+        return std::count(ids.begin(), ids.end(), range_id);
+    }
+
+protected:
+    std::shared_ptr<Range> source_;
+};
+
+TEST_F(RangeMergeTest, Merge) {
+    auto target_meta = range_->options();
+    auto source_meta = source_->options();
+
+    auto s = source_->store_->Put(makeKey("q"), "value");
+    ASSERT_TRUE(s.ok()) << s.ToString();
+
+    // 第一步：source冻结
+    s = range_->Merge(source_);
+    ASSERT_TRUE(s.ok()) << s.ToString();
+    ASSERT_EQ(source_->merged_into_, range_->id_);
+    ASSERT_EQ(source_->meta_.GetVersion(), source_meta.range_epoch().version() + 1);
+    ASSERT_EQ(range_->merge_source_, source_->id_);
+    uint64_t merged_into = 0;
+    s = context_->MetaStore()->LoadMergeState(source_->id_, &merged_into);
+    ASSERT_TRUE(s.ok()) << s.ToString();
+    ASSERT_EQ(merged_into, range_->id_);
+    ASSERT_EQ(retiredCount(source_->id_), 1U);
+
+    // 进行中不能再次发起
+    s = range_->Merge(source_);
+    ASSERT_EQ(s.code(), Status::kExisted);
+
+    // 第二步：target吸收source的范围
+    range_->CheckMerge();
+    ASSERT_EQ(range_->merge_source_, 0U);
+    ASSERT_EQ(range_->meta_.GetEndKey(), source_meta.end_key());
+    ASSERT_EQ(range_->store_->GetEndKey(), source_meta.end_key());
+    auto version = std::max(target_meta.range_epoch().version(),
+                            source_meta.range_epoch().version() + 1) + 1;
+    ASSERT_EQ(range_->meta_.GetVersion(), version);
+    ASSERT_EQ(retiredCount(source_->id_), 2U);
+
+    metapb::Range saved;
+    s = context_->MetaStore()->GetRange(range_->id_, &saved);
+    ASSERT_TRUE(s.ok()) << s.ToString();
+    ASSERT_EQ(saved.end_key(), source_meta.end_key());
+    ASSERT_EQ(saved.range_epoch().version(), version);
+
+    // source的数据归属target
+    std::string value;
+    s = range_->store_->Get(makeKey("q"), &value);
+    ASSERT_TRUE(s.ok()) << s.ToString();
+    ASSERT_EQ(value, "value");
+}
+
+TEST_F(RangeMergeTest, WaitSourceFrozen) {
+    auto target_meta = range_->options();
+    auto source_meta = source_->options();
+    auto frozen_meta = source_meta;
+    frozen_meta.mutable_range_epoch()->set_version(source_meta.range_epoch().version() + 1);
+
+    auto freeze = makeMergeCmd(false, target_meta, source_meta);
+    auto commit = makeMergeCmd(true, target_meta, frozen_meta);
+    // source冻结前的写入
+    auto old_set = makeSetCmd(source_meta.range_epoch(), makeKey("q"), "old");
+    // target合并后对同一个key的写入
+    auto epoch = target_meta.range_epoch();
+    epoch.set_version(std::max(target_meta.range_epoch().version(),
+                               frozen_meta.range_epoch().version()) + 1);
+    auto new_set = makeSetCmd(epoch, makeKey("q"), "new");
+
+    // 落后的副本：target先应用到合并日志，本地source还未冻结
+    auto apply_index = range_->apply_index_;
+    auto s = apply(range_, commit, 100);
+    ASSERT_TRUE(s.ok()) << s.ToString();
+    ASSERT_EQ(range_->MergePending(), source_->id_);
+    ASSERT_EQ(range_->meta_.GetEndKey(), target_meta.end_key());
+    s = apply(range_, new_set, 101);
+    ASSERT_TRUE(s.ok()) << s.ToString();
+    ASSERT_EQ(range_->apply_index_, apply_index);
+    std::string value;
+    s = range_->store_->Get(makeKey("q"), &value);
+    ASSERT_EQ(s.code(), Status::kNotFound);
+
+    // 本地source应用冻结前的写入和冻结日志后，target按序恢复应用
+    s = apply(source_, old_set, 50);
+    ASSERT_TRUE(s.ok()) << s.ToString();
+    s = apply(source_, freeze, 51);
+    ASSERT_TRUE(s.ok()) << s.ToString();
+    ASSERT_EQ(range_->MergePending(), 0U);
+    ASSERT_TRUE(range_->merge_pending_cmds_.empty());
+    ASSERT_EQ(range_->meta_.GetEndKey(), source_meta.end_key());
+    ASSERT_EQ(range_->apply_index_, 101U);
+
+    s = range_->store_->Get(makeKey("q"), &value);
+    ASSERT_TRUE(s.ok()) << s.ToString();
+    ASSERT_EQ(value, "new");
+}
+
+TEST_F(RangeMergeTest, ReplyAfterFrozen) {
+    auto source_meta = source_->options();
+
+    // 冻结前提交的请求
+    kvrpcpb::DsKvSetRequest req;
+    req.mutable_header()->set_range_id(source_->id_);
+    req.mutable_header()->mutable_range_epoch()->CopyFrom(source_meta.range_epoch());
+    req.mutable_req()->mutable_kv()->set_key(makeKey("q"));
+    req.mutable_req()->mutable_kv()->set_value("value");
+    req.mutable_req()->set_case_(kvrpcpb::EC_Force);
+
+    auto msg = new common::ProtoMessage;
+    msg->begin_time = getticks();
+    msg->expire_time = getticks() + 1000;
+    msg->session_id = randomInt();
+    msg->header.msg_id = randomInt();
+    msg->msg_id = msg->header.msg_id;
+    auto seq = source_->submit_queue_.Add(req.header(), raft_cmdpb::CmdType::KvSet, msg);
+
+    auto s = range_->Merge(source_);
+    ASSERT_TRUE(s.ok()) << s.ToString();
+
+    // 冻结后才应用，回复stale epoch，不再写入
+    auto cmd = makeSetCmd(source_meta.range_epoch(), makeKey("q"), "value");
+    cmd.mutable_cmd_id()->set_node_id(source_->node_id_);
+    cmd.mutable_cmd_id()->set_seq(seq);
+    s = apply(source_, cmd, 10);
+    ASSERT_TRUE(s.ok()) << s.ToString();
+
+    kvrpcpb::DsKvSetResponse resp;
+    s = getResult(&resp);
+    ASSERT_TRUE(s.ok()) << s.ToString();
+    ASSERT_TRUE(resp.header().has_error());
+    ASSERT_TRUE(resp.header().error().has_stale_epoch());
+    ASSERT_EQ(resp.header().error().stale_epoch().new_range().id(), range_->id_);
+    ASSERT_TRUE(source_->submit_queue_.Remove(seq) == nullptr);
+
+    std::string value;
+    s = source_->store_->Get(makeKey("q"), &value);
+    ASSERT_EQ(s.code(), Status::kNotFound);
+}
+
+} /* namespace  */
@@ -158,5 +158,40 @@ TEST(RangeMetaKeeper, Split) {
     ASSERT_EQ(keeper.GetEndKey(), "c");
 }
 
+TEST(RangeMetaKeeper, Snapshot) {
+    auto meta = randMeta();
+    MetaKeeper keeper(meta);
+
+    ASSERT_EQ(keeper.CompareKey("a"), -1);
+    ASSERT_EQ(keeper.CompareKey("b"), 0);
+    ASSERT_EQ(keeper.CompareKey("d"), 0);
+    ASSERT_EQ(keeper.CompareKey("e"), 1);
+
+    keeper.Split("c", meta.range_epoch().version() + 1);
+    ASSERT_EQ(keeper.CompareKey("d"), 1);
+    keeper.Merge("e", meta.range_epoch().version() + 2);
+    ASSERT_EQ(keeper.CompareKey("d"), 0);
+    ASSERT_EQ(keeper.GetVersion(), meta.range_epoch().version() + 2);
+
+    uint64_t leader = 1, term = 1;
+    keeper.GetLeaderTerm(&leader, &term);
+    ASSERT_EQ(leader, 0U);
+    ASSERT_EQ(term, 0U);
+    keeper.SetLeaderTerm(101, 3);
+    keeper.GetLeaderTerm(&leader, &term);
+    ASSERT_EQ(leader, 101U);
+    ASSERT_EQ(term, 3U);
+
+    // 成员变更后leader保持
+    metapb::Peer peer;
+    peer.set_id(4);
+    peer.set_node_id(104);
+    auto s = keeper.AddPeer(peer, meta.range_epoch().conf_ver());
+    ASSERT_TRUE(s.ok()) << s.ToString();
+    ASSERT_EQ(keeper.GetConfVer(), meta.range_epoch().conf_ver() + 1);
+    keeper.GetLeaderTerm(&leader, &term);
+    ASSERT_EQ(leader, 101U);
+}
+
 
 }
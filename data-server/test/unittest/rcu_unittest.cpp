@@ -0,0 +1,113 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "base/rcu.h"
+
+int main(int argc, char* argv[]) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+namespace {
+
+using namespace sharkstore;
+
+struct Value {
+    std::atomic<bool> alive = {true};
+    uint64_t version = 0;
+
+    ~Value() { alive = false; }
+};
+
+TEST(RCU, NestedGuard) {
+    RcuDomain rcu;
+    {
+        RcuDomain::ReadGuard g1(rcu);
+        RcuDomain::ReadGuard g2(rcu);
+    }
+    rcu.Synchronize();
+}
+
+TEST(RCU, PublishAndReclaim) {
+    RcuDomain rcu;
+    std::atomic<Value*> current(new Value);
+    std::atomic<bool> stop(false);
+    std::atomic<uint64_t> reads(0);
+    std::atomic<uint64_t> errors(0);
+
+    std::vector<std::thread> readers;
+    for (int i = 0; i < 4; ++i) {
+        readers.emplace_back([&] {
+            while (!stop) {
+                RcuDomain::ReadGuard guard(rcu);
+                auto v = current.load();
+                auto version = v->version;
+                std::this_thread::yield();
+                if (!v->alive || v->version != version) {
+                    ++errors;
+                }
+                ++reads;
+            }
+        });
+    }
+
+    while (reads == 0) {
+        std::this_thread::yield();
+    }
+    for (uint64_t i = 1; i <= 200; ++i) {
+        auto v = new Value;
+        v->version = i;
+        std::unique_ptr<Value> old(current.exchange(v));
+        rcu.Synchronize();
+        old->version = 0;  // 无读者后改写，读者若仍在访问可以检测到
+    }
+    stop = true;
+    for (auto& t : readers) {
+        t.join();
+    }
+    delete current.load();
+
+    ASSERT_GT(reads.load(), 0U);
+    ASSERT_EQ(errors.load(), 0U);
+}
+
+TEST(RCU, Retire) {
+    RcuDomain rcu;
+    std::atomic<int> reclaimed(0);
+    std::atomic<bool> entered(false);
+    std::atomic<bool> release(false);
+
+    // 读者退出前不回收
+    std::thread reader([&] {
+        RcuDomain::ReadGuard guard(rcu);
+        entered = true;
+        while (!release) {
+            std::this_thread::yield();
+        }
+    });
+    while (!entered) {
+        std::this_thread::yield();
+    }
+    rcu.Retire([&] { ++reclaimed; });
+    rcu.Retire([&] { ++reclaimed; });
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    ASSERT_EQ(reclaimed.load(), 0);
+
+    release = true;
+    reader.join();
+    rcu.Barrier();
+    ASSERT_EQ(reclaimed.load(), 2);
+
+    // 析构时执行剩余的回收
+    std::unique_ptr<RcuDomain> domain(new RcuDomain);
+    domain->Retire([&] { ++reclaimed; });
+    domain.reset();
+    ASSERT_EQ(reclaimed.load(), 3);
+}
+
+} /* namespace */
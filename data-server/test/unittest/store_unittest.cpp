@@ -1,7 +1,18 @@
 #include <gtest/gtest.h>
+#include <map>
+
+#include <rocksdb/filter_policy.h>
+#include <rocksdb/slice_transform.h>
+#include <rocksdb/table.h>
 
 #include "base/util.h"
+#include "common/ds_config.h"
+#include "helper/query_parser.h"
 #include "helper/store_test_fixture.h"
+#include "proto/gen/raft_cmdpb.pb.h"
+#include "storage/bulk_loader.h"
+#include "storage/cursor.h"
+#include "storage/ttl.h"
 
 int main(int argc, char* argv[]) {
     testing::InitGoogleTest(&argc, argv);
@@ -59,6 +70,514 @@ TEST_F(StoreTest, KeyValue) {
     ASSERT_EQ(s.code(), sharkstore::Status::kNotFound);
 }
 
+TEST_F(StoreTest, Merge) {
+    std::string key = sharkstore::randomString(32);
+    auto s = store_->Increment(key, 10);
+    ASSERT_TRUE(s.ok()) << s.ToString();
+    s = store_->Increment(key, -3);
+    ASSERT_TRUE(s.ok()) << s.ToString();
+
+    std::string actual_value;
+    s = store_->Get(key, &actual_value);
+    ASSERT_TRUE(s.ok()) << s.ToString();
+    ASSERT_EQ(actual_value, "7");
+
+    // 基于已有的值
+    s = store_->Put(key, "100");
+    ASSERT_TRUE(s.ok());
+    s = store_->Increment(key, 1);
+    ASSERT_TRUE(s.ok());
+    s = store_->Get(key, &actual_value);
+    ASSERT_TRUE(s.ok());
+    ASSERT_EQ(actual_value, "101");
+
+    s = store_->Append(key, "abc");
+    ASSERT_TRUE(s.ok());
+    s = store_->Get(key, &actual_value);
+    ASSERT_TRUE(s.ok());
+    ASSERT_EQ(actual_value, "101abc");
+}
+
+TEST_F(StoreTest, TableTtl) {
+    ASSERT_FALSE(storage::InitTableTtl("1:a").ok());
+    ASSERT_TRUE(storage::InitTableTtl("1:10, 2:0").ok());
+    ASSERT_EQ(storage::GetTableTtl(1), 10);
+    ASSERT_EQ(storage::GetTableTtl(2), 0);
+    ASSERT_EQ(storage::GetTableTtl(3), storage::kNoTtl);
+
+    // store_在开启TTL之前创建，读写的是原始的值
+    auto s = storage::InitTableTtl(std::to_string(meta_.table_id()) + ":100");
+    ASSERT_TRUE(s.ok()) << s.ToString();
+    storage::Store ttl_store(meta_, db_);
+
+    // 写入命令携带的到期时间，而不是apply时的时间
+    auto expire_at = ttl_store.TtlExpireAt();
+    ASSERT_GE(expire_at, static_cast<uint64_t>(time(nullptr) + 100));
+    std::string key1 = meta_.start_key() + "a";
+    s = ttl_store.Put(key1, "v", expire_at);
+    ASSERT_TRUE(s.ok()) << s.ToString();
+    std::string value;
+    s = ttl_store.Get(key1, &value);
+    ASSERT_TRUE(s.ok()) << s.ToString();
+    ASSERT_EQ(value, "v");
+    std::string raw1;
+    s = store_->Get(key1, &raw1);
+    ASSERT_TRUE(s.ok());
+    ASSERT_EQ(raw1.size(), storage::kTtlHeaderSize + 1);
+    uint64_t raw_expire_at = 0;
+    ASSERT_TRUE(storage::DecodeTtlHeader(raw1.data(), raw1.size(), &raw_expire_at));
+    ASSERT_EQ(raw_expire_at, expire_at);
+
+    // 已过期的值
+    std::string key2 = meta_.start_key() + "b";
+    std::string raw2;
+    storage::EncodeTtlHeader(&raw2, 1);
+    raw2.append("x");
+    s = store_->Put(key2, raw2);
+    ASSERT_TRUE(s.ok());
+    s = ttl_store.Get(key2, &value);
+    ASSERT_EQ(s.code(), sharkstore::Status::kNotFound);
+    ASSERT_FALSE(ttl_store.KeyExists(key2));
+
+    std::unique_ptr<storage::Iterator> it(ttl_store.NewIterator());
+    ASSERT_TRUE(it->Valid());
+    ASSERT_EQ(it->key(), key1);
+    ASSERT_EQ(it->value(), "v");
+    it->Next();
+    ASSERT_FALSE(it->Valid());
+
+    storage::TtlCompactionFilter filter;
+    std::string new_value;
+    bool changed = false;
+    ASSERT_FALSE(filter.Filter(0, key1, raw1, &new_value, &changed));
+    ASSERT_TRUE(filter.Filter(0, key2, raw2, &new_value, &changed));
+
+    ASSERT_TRUE(storage::InitTableTtl("").ok());
+}
+
+TEST_F(StoreTest, TtlSnapshot) {
+    auto s = storage::InitTableTtl(std::to_string(meta_.table_id()) + ":100");
+    ASSERT_TRUE(s.ok()) << s.ToString();
+    storage::Store ttl_store(meta_, db_);
+    ASSERT_TRUE(ttl_store.TtlHeader());
+    ASSERT_FALSE(store_->TtlHeader());
+
+    auto pair = [](const std::string& key, const std::string& value) {
+        raft_cmdpb::SnapshotKVPair p;
+        p.set_key(key);
+        p.set_value(value);
+        return p.SerializeAsString();
+    };
+    std::string key1 = meta_.start_key() + "a";
+    std::string key2 = meta_.start_key() + "b";
+
+    // leader上不是TTL表：加上不过期的值头
+    s = ttl_store.ApplySnapshot({pair(key1, "v1")}, false);
+    ASSERT_TRUE(s.ok()) << s.ToString();
+    std::string value;
+    s = ttl_store.Get(key1, &value);
+    ASSERT_TRUE(s.ok()) << s.ToString();
+    ASSERT_EQ(value, "v1");
+    s = store_->Get(key1, &value);
+    ASSERT_TRUE(s.ok()) << s.ToString();
+    uint64_t expire_at = 1;
+    ASSERT_TRUE(storage::DecodeTtlHeader(value.data(), value.size(), &expire_at));
+    ASSERT_EQ(expire_at, 0U);
+
+    // leader上是TTL表：去掉值头，丢弃已过期的值
+    std::string raw1, raw2;
+    storage::EncodeTtlHeader(&raw1, ttl_store.TtlExpireAt());
+    raw1.append("v2");
+    storage::EncodeTtlHeader(&raw2, 1);
+    raw2.append("x");
+    s = store_->ApplySnapshot({pair(key1, raw1), pair(key2, raw2)}, true);
+    ASSERT_TRUE(s.ok()) << s.ToString();
+    s = store_->Get(key1, &value);
+    ASSERT_TRUE(s.ok()) << s.ToString();
+    ASSERT_EQ(value, "v2");
+    s = store_->Get(key2, &value);
+    ASSERT_EQ(s.code(), sharkstore::Status::kNotFound);
+
+    // 格式相同时原样写入
+    s = ttl_store.ApplySnapshot({pair(key2, raw2)}, true);
+    ASSERT_TRUE(s.ok()) << s.ToString();
+    s = store_->Get(key2, &value);
+    ASSERT_TRUE(s.ok()) << s.ToString();
+    ASSERT_EQ(value, raw2);
+
+    ASSERT_TRUE(storage::InitTableTtl("").ok());
+}
+
+TEST_F(StoreTest, ScanFillCache) {
+    ASSERT_FALSE(storage::InitLowPriTables("1,x").ok());
+    ASSERT_TRUE(storage::InitLowPriTables("1, 2").ok());
+    ASSERT_TRUE(storage::IsLowPriTable(2));
+    ASSERT_FALSE(storage::IsLowPriTable(3));
+
+    for (int i = 0; i < 10; ++i) {
+        auto s = store_->Put(meta_.start_key() + std::to_string(i), std::to_string(i));
+        ASSERT_TRUE(s.ok()) << s.ToString();
+    }
+
+    // 不填充cache只影响缓存，不影响读取的结果
+    auto old_large_scan_rows = ds_config.rocksdb_config.large_scan_rows;
+    ds_config.rocksdb_config.large_scan_rows = 5;
+    for (uint64_t rows : {0, 3, 100}) {
+        std::unique_ptr<storage::Iterator> it(store_->NewScanIterator("", "", rows));
+        int count = 0;
+        for (; it->Valid(); it->Next()) {
+            ASSERT_EQ(it->key(), meta_.start_key() + std::to_string(count));
+            ++count;
+        }
+        ASSERT_EQ(count, 10);
+    }
+    ds_config.rocksdb_config.large_scan_rows = old_large_scan_rows;
+    ASSERT_TRUE(storage::InitLowPriTables("").ok());
+}
+
+TEST_F(StoreTest, PrefixSeek) {
+    // 前缀为表前缀加主键的第一个字节
+    auto old_prefix_len = ds_config.rocksdb_config.prefix_extractor_len;
+    auto prefix_len = meta_.start_key().size() + 1;
+    ds_config.rocksdb_config.prefix_extractor_len = static_cast<int>(prefix_len);
+
+    char path[] = "/tmp/sharkstore_ds_prefix_test_XXXXXX";
+    char* tmp = mkdtemp(path);
+    ASSERT_TRUE(tmp != NULL);
+    rocksdb::Options ops;
+    ops.create_if_missing = true;
+    ops.prefix_extractor.reset(rocksdb::NewCappedPrefixTransform(prefix_len));
+    ops.memtable_prefix_bloom_size_ratio = 0.1;
+    rocksdb::BlockBasedTableOptions table_options;
+    table_options.filter_policy.reset(rocksdb::NewBloomFilterPolicy(10, false));
+    ops.table_factory.reset(rocksdb::NewBlockBasedTableFactory(table_options));
+    rocksdb::DB* db = nullptr;
+    auto ret = rocksdb::DB::Open(ops, tmp, &db);
+    ASSERT_TRUE(ret.ok()) << ret.ToString();
+
+    {
+        storage::Store store(meta_, db);
+        // 每个前缀写入后flush，分布在多个sst中
+        std::vector<std::string> keys;
+        for (char p = 'a'; p <= 'e'; ++p) {
+            for (int i = 0; i < 3; ++i) {
+                std::string key = meta_.start_key() + p + std::to_string(i);
+                auto s = store.Put(key, "v");
+                ASSERT_TRUE(s.ok()) << s.ToString();
+                keys.push_back(key);
+            }
+            ret = db->Flush(rocksdb::FlushOptions());
+            ASSERT_TRUE(ret.ok()) << ret.ToString();
+        }
+
+        auto scan = [&store](const std::string& start, const std::string& limit) {
+            std::vector<std::string> result;
+            std::unique_ptr<storage::Iterator> it(store.NewIterator(start, limit));
+            for (; it->Valid(); it->Next()) {
+                result.push_back(it->key());
+            }
+            return result;
+        };
+
+        // 跨前缀的扫描
+        ASSERT_EQ(scan("", ""), keys);
+        auto result = scan(meta_.start_key() + "b1", meta_.start_key() + "d1");
+        ASSERT_EQ(result, std::vector<std::string>(keys.begin() + 4, keys.begin() + 10));
+        // 起始key的前缀不存在
+        result = scan(meta_.start_key() + "a9", meta_.start_key() + "c");
+        ASSERT_EQ(result, std::vector<std::string>(keys.begin() + 3, keys.begin() + 6));
+        // 前缀内的扫描
+        result = scan(meta_.start_key() + "c", meta_.start_key() + "d");
+        ASSERT_EQ(result, std::vector<std::string>(keys.begin() + 6, keys.begin() + 9));
+    }
+
+    delete db;
+    rocksdb::DestroyDB(tmp, rocksdb::Options());
+    ds_config.rocksdb_config.prefix_extractor_len = old_prefix_len;
+}
+
+TEST_F(StoreTest, PerfSample) {
+    std::string key = meta_.start_key() + "a";
+    auto s = store_->Put(key, "v");
+    ASSERT_TRUE(s.ok()) << s.ToString();
+
+    const int kFuncId = 12345;
+    auto old_rate = ds_config.rocksdb_config.perf_sample_rate;
+    ds_config.rocksdb_config.perf_sample_rate = 2;
+    int sampled = 0;
+    for (int i = 0; i < 10; ++i) {
+        storage::PerfScope perf(kFuncId, store_->GetPerfCounter());
+        if (perf.Sampled()) {
+            ++sampled;
+            // 嵌套的作用域不重复采样
+            storage::PerfScope nested(kFuncId + 1, nullptr);
+            ASSERT_FALSE(nested.Sampled());
+        }
+        std::string value;
+        s = store_->Get(key, &value);
+        ASSERT_TRUE(s.ok()) << s.ToString();
+    }
+    ASSERT_EQ(sampled, 5);
+
+    ds_config.rocksdb_config.perf_sample_rate = 0;
+    {
+        storage::PerfScope perf(kFuncId, store_->GetPerfCounter());
+        ASSERT_FALSE(perf.Sampled());
+    }
+    ds_config.rocksdb_config.perf_sample_rate = old_rate;
+
+    storage::PerfStat stat;
+    store_->GetPerfCounter()->Get(&stat);
+    ASSERT_EQ(stat.samples, 5U);
+    ASSERT_GT(stat.memtable_nanos + stat.sst_nanos, 0U);
+
+    std::map<int, storage::PerfStat> funcs;
+    storage::GetFuncPerfStats(&funcs);
+    ASSERT_EQ(funcs[kFuncId].samples, 5U);
+    ASSERT_EQ(funcs.count(kFuncId + 1), 0U);
+
+    // 节点心跳上报所有请求类型之和
+    storage::PerfStat total;
+    storage::GetTotalPerfStats(&total);
+    uint64_t samples = 0;
+    for (const auto& p : funcs) {
+        samples += p.second.samples;
+    }
+    ASSERT_EQ(total.samples, samples);
+}
+
+TEST_F(StoreTest, BulkLoad) {
+    auto dir = db_->GetName() + "/ingest";
+    auto s = store_->Put(meta_.start_key() + "01", "old");
+    ASSERT_TRUE(s.ok()) << s.ToString();
+
+    {
+        // 文件很小，每个key一个sst文件
+        storage::BulkLoader loader(store_, dir, 1);
+        for (int i = 0; i < 10; ++i) {
+            char key[8];
+            snprintf(key, sizeof(key), "%02d", i);
+            s = loader.Add(meta_.start_key() + key, std::to_string(i));
+            ASSERT_TRUE(s.ok()) << s.ToString();
+        }
+        s = loader.Add(meta_.start_key() + "00", "x");
+        ASSERT_EQ(s.code(), sharkstore::Status::kInvalidArgument);
+        s = loader.Add(meta_.end_key(), "x");
+        ASSERT_EQ(s.code(), sharkstore::Status::kOutOfBound);
+        ASSERT_EQ(loader.Count(), 10U);
+
+        std::string value;
+        s = store_->Get(meta_.start_key() + "02", &value);
+        ASSERT_EQ(s.code(), sharkstore::Status::kNotFound);
+
+        s = loader.Ingest();
+        ASSERT_TRUE(s.ok()) << s.ToString();
+    }
+
+    std::string value;
+    s = store_->Get(meta_.start_key() + "01", &value);
+    ASSERT_TRUE(s.ok()) << s.ToString();
+    ASSERT_EQ(value, "1");
+    std::unique_ptr<storage::Iterator> it(store_->NewIterator());
+    int count = 0;
+    for (; it->Valid(); it->Next()) {
+        ++count;
+    }
+    ASSERT_EQ(count, 10);
+
+    // 未导入的文件在析构时删除
+    {
+        storage::BulkLoader loader(store_, dir, 1024);
+        s = loader.Add(meta_.start_key() + "20", "v");
+        ASSERT_TRUE(s.ok()) << s.ToString();
+    }
+    s = store_->Get(meta_.start_key() + "20", &value);
+    ASSERT_EQ(s.code(), sharkstore::Status::kNotFound);
+    storage::BulkLoader::Cleanup(dir);
+}
+
+TEST_F(StoreTest, BulkLoadAfterTruncate) {
+    auto dir = db_->GetName() + "/ingest";
+    for (int i = 0; i < 10; ++i) {
+        auto s = store_->Put(meta_.start_key() + std::to_string(i), "old");
+        ASSERT_TRUE(s.ok()) << s.ToString();
+    }
+    // 与应用快照一致：先Truncate再导入，tombstone已落盘
+    auto s = store_->Truncate();
+    ASSERT_TRUE(s.ok()) << s.ToString();
+    auto ret = db_->Flush(rocksdb::FlushOptions());
+    ASSERT_TRUE(ret.ok()) << ret.ToString();
+
+    {
+        storage::BulkLoader loader(store_, dir, 1024);
+        for (int i = 0; i < 10; ++i) {
+            s = loader.Add(meta_.start_key() + std::to_string(i), std::to_string(i));
+            ASSERT_TRUE(s.ok()) << s.ToString();
+        }
+        s = loader.Ingest();
+        ASSERT_TRUE(s.ok()) << s.ToString();
+    }
+
+    for (int i = 0; i < 10; ++i) {
+        std::string value;
+        s = store_->Get(meta_.start_key() + std::to_string(i), &value);
+        ASSERT_TRUE(s.ok()) << s.ToString();
+        ASSERT_EQ(value, std::to_string(i));
+    }
+    std::unique_ptr<storage::Iterator> it(store_->NewIterator());
+    int count = 0;
+    for (; it->Valid(); it->Next()) {
+        ++count;
+    }
+    ASSERT_EQ(count, 10);
+    storage::BulkLoader::Cleanup(dir);
+}
+
+TEST_F(StoreTest, SnapshotRead) {
+    auto old_max_snapshots = ds_config.range_config.max_snapshots;
+    auto old_snapshot_ttl = ds_config.range_config.snapshot_ttl_ms;
+    ds_config.range_config.max_snapshots = 0;
+    ds_config.range_config.snapshot_ttl_ms = 10000;
+    uint64_t id1 = 0, id2 = 0, id3 = 0;
+    ASSERT_TRUE(store_->OpenSnapshot(&id1) == nullptr);
+
+    ds_config.range_config.max_snapshots = 2;
+    std::string key1 = meta_.start_key() + "a";
+    std::string key2 = meta_.start_key() + "b";
+    auto s = store_->Put(key1, "1");
+    ASSERT_TRUE(s.ok()) << s.ToString();
+
+    auto snap = store_->OpenSnapshot(&id1);
+    ASSERT_TRUE(snap != nullptr);
+    ASSERT_NE(id1, 0U);
+    ASSERT_EQ(store_->GetSnapshot(id1), snap);
+    s = store_->Put(key1, "2");
+    ASSERT_TRUE(s.ok()) << s.ToString();
+    s = store_->Put(key2, "2");
+    ASSERT_TRUE(s.ok()) << s.ToString();
+
+    std::string value;
+    s = store_->Get(key1, &value, snap.get());
+    ASSERT_TRUE(s.ok()) << s.ToString();
+    ASSERT_EQ(value, "1");
+    s = store_->Get(key2, &value, snap.get());
+    ASSERT_EQ(s.code(), sharkstore::Status::kNotFound);
+    s = store_->Get(key1, &value);
+    ASSERT_TRUE(s.ok()) << s.ToString();
+    ASSERT_EQ(value, "2");
+
+    // 迭代器持有快照，快照被淘汰后仍然读取快照时的数据
+    // 被淘汰的id不会换成新的快照
+    std::unique_ptr<storage::Iterator> it(store_->NewScanIterator("", "", 0, snap));
+    store_->OpenSnapshot(&id2);
+    store_->OpenSnapshot(&id3);
+    ASSERT_NE(id1, id2);
+    ASSERT_NE(id2, id3);
+    ASSERT_EQ(store_->SnapshotCount(), 2U);
+    ASSERT_TRUE(store_->GetSnapshot(id1) == nullptr);
+    snap.reset();
+    ASSERT_TRUE(it->Valid());
+    ASSERT_EQ(it->key(), key1);
+    ASSERT_EQ(it->value(), "1");
+    it->Next();
+    ASSERT_FALSE(it->Valid());
+
+    store_->ClearSnapshots();
+    ASSERT_EQ(store_->SnapshotCount(), 0U);
+    ds_config.range_config.max_snapshots = old_max_snapshots;
+    ds_config.range_config.snapshot_ttl_ms = old_snapshot_ttl;
+}
+
+TEST_F(StoreTest, SelectSnapshot) {
+    InsertSomeRows();
+
+    auto old_max_snapshots = ds_config.range_config.max_snapshots;
+    auto old_snapshot_ttl = ds_config.range_config.snapshot_ttl_ms;
+    ds_config.range_config.max_snapshots = 0;
+    ds_config.range_config.snapshot_ttl_ms = 10000;
+
+    SelectRequestBuilder builder(table_.get());
+    builder.AddAllFields();
+    builder.AddLimit(10);
+    auto req = builder.Build();
+    req.set_open_snapshot(true);
+    kvrpcpb::SelectResponse resp;
+    auto s = store_->Select(req, &resp);
+    ASSERT_EQ(s.code(), sharkstore::Status::kNotSupported);
+
+    // 第一页创建快照，之后的写入对后面的页不可见
+    ds_config.range_config.max_snapshots = 2;
+    resp.Clear();
+    s = store_->Select(req, &resp);
+    ASSERT_TRUE(s.ok()) << s.ToString();
+    auto snapshot_id = resp.snapshot_id();
+    ASSERT_NE(snapshot_id, 0U);
+    ASSERT_EQ(resp.rows_size(), 10);
+
+    s = testDelete(
+            [](DeleteRequestBuilder& b) {
+                b.SetKey({"15"});
+            },
+            1
+    );
+    ASSERT_TRUE(s.ok()) << s.ToString();
+
+    req.set_open_snapshot(false);
+    req.set_snapshot_id(snapshot_id);
+    req.mutable_limit()->set_offset(10);
+    resp.Clear();
+    s = store_->Select(req, &resp);
+    ASSERT_TRUE(s.ok()) << s.ToString();
+    ASSERT_EQ(resp.snapshot_id(), snapshot_id);
+    SelectResultParser parser(req, resp);
+    s = parser.Match({rows_.begin() + 10, rows_.begin() + 20});
+    ASSERT_TRUE(s.ok()) << s.ToString();
+
+    // 快照不存在（如leader切换）时返回错误，而不是读取新的快照
+    store_->ClearSnapshots();
+    resp.Clear();
+    s = store_->Select(req, &resp);
+    ASSERT_EQ(s.code(), sharkstore::Status::kExpired);
+
+    ds_config.range_config.max_snapshots = old_max_snapshots;
+    ds_config.range_config.snapshot_ttl_ms = old_snapshot_ttl;
+}
+
+TEST_F(StoreTest, MultiGet) {
+    std::map<std::string, std::string> kvs;
+    for (int i = 0; i < 100; ++i) {
+        std::string key = sharkstore::randomString(32);
+        std::string value = sharkstore::randomString(64);
+        auto s = store_->Put(key, value);
+        ASSERT_TRUE(s.ok());
+        kvs.emplace(key, value);
+    }
+
+    // 乱序, 并混入不存在的key
+    std::vector<std::string> keys;
+    for (auto it = kvs.rbegin(); it != kvs.rend(); ++it) {
+        keys.push_back(it->first);
+        keys.push_back(sharkstore::randomString(33));
+    }
+    std::vector<std::string> values;
+    auto ss = store_->MultiGet(keys, &values);
+    ASSERT_EQ(ss.size(), keys.size());
+    ASSERT_EQ(values.size(), keys.size());
+    for (size_t i = 0; i < keys.size(); ++i) {
+        if (i % 2 == 0) {
+            ASSERT_TRUE(ss[i].ok()) << ss[i].ToString();
+            ASSERT_EQ(values[i], kvs[keys[i]]);
+        } else {
+            ASSERT_EQ(ss[i].code(), sharkstore::Status::kNotFound);
+            ASSERT_TRUE(values[i].empty());
+        }
+    }
+
+    ss = store_->MultiGet(std::vector<std::string>(), &values);
+    ASSERT_TRUE(ss.empty());
+    ASSERT_TRUE(values.empty());
+}
+
 TEST_F(StoreTest, Insert) {
     // one
     auto s = testInsert({{"1", "user1", "1.1"}});
@@ -245,6 +764,213 @@ TEST_F(StoreTest, SelectLimit) {
     ASSERT_TRUE(s.ok()) << s.ToString();
 }
 
+TEST_F(StoreTest, SelectPaging) {
+    InsertSomeRows();
+
+    auto old_max_cursors = ds_config.range_config.max_cursors;
+    auto old_cursor_ttl = ds_config.range_config.cursor_ttl_ms;
+    ds_config.range_config.max_cursors = 4;
+    ds_config.range_config.cursor_ttl_ms = 10000;
+
+    // 逐页读取, 后一页从上一页缓存的游标续读
+    for (size_t page = 0; page < rows_.size() / 10; ++page) {
+        std::vector<std::vector<std::string>> expected(
+                rows_.begin() + page * 10, rows_.begin() + (page + 1) * 10);
+        auto s = testSelect(
+                [page](SelectRequestBuilder& b) {
+                    b.AddAllFields();
+                    b.AddLimit(10, page * 10);
+                },
+                expected
+        );
+        ASSERT_TRUE(s.ok()) << "page " << page << ": " << s.ToString();
+
+        // 穿插一个offset不连续的请求, 不能误用游标
+        s = testSelect(
+                [](SelectRequestBuilder& b) {
+                    b.AddAllFields();
+                    b.AddLimit(2, 3);
+                },
+                {rows_[3], rows_[4]}
+        );
+        ASSERT_TRUE(s.ok()) << s.ToString();
+    }
+
+    // 游标被清理后重新seek
+    store_->ClearCursors();
+    auto s = testSelect(
+            [](SelectRequestBuilder& b) {
+                b.AddAllFields();
+                b.AddLimit(3, 20);
+            },
+            {rows_[20], rows_[21], rows_[22]}
+    );
+    ASSERT_TRUE(s.ok()) << s.ToString();
+
+    ds_config.range_config.max_cursors = old_max_cursors;
+    ds_config.range_config.cursor_ttl_ms = old_cursor_ttl;
+}
+
+TEST_F(StoreTest, SelectPagingWrite) {
+    InsertSomeRows();
+
+    auto old_max_cursors = ds_config.range_config.max_cursors;
+    auto old_cursor_ttl = ds_config.range_config.cursor_ttl_ms;
+    ds_config.range_config.max_cursors = 4;
+    ds_config.range_config.cursor_ttl_ms = 10000;
+
+    for (size_t page = 0; page < 2; ++page) {
+        auto s = testSelect(
+                [page](SelectRequestBuilder& b) {
+                    b.AddAllFields();
+                    b.AddLimit(10, page * 10);
+                },
+                {rows_.begin() + page * 10, rows_.begin() + (page + 1) * 10}
+        );
+        ASSERT_TRUE(s.ok()) << "page " << page << ": " << s.ToString();
+    }
+
+    // 暂存游标之后的写入，下一页必须能看到
+    auto s = testDelete(
+            [](DeleteRequestBuilder& b) {
+                b.SetKey({"25"});
+            },
+            1
+    );
+    ASSERT_TRUE(s.ok()) << s.ToString();
+
+    std::vector<std::vector<std::string>> expected(rows_.begin() + 20, rows_.begin() + 24);
+    expected.insert(expected.end(), rows_.begin() + 25, rows_.begin() + 31);
+    s = testSelect(
+            [](SelectRequestBuilder& b) {
+                b.AddAllFields();
+                b.AddLimit(10, 20);
+            },
+            expected
+    );
+    ASSERT_TRUE(s.ok()) << s.ToString();
+
+    ds_config.range_config.max_cursors = old_max_cursors;
+    ds_config.range_config.cursor_ttl_ms = old_cursor_ttl;
+}
+
+TEST_F(StoreTest, CursorCache) {
+    auto old_max_cursors = ds_config.range_config.max_cursors;
+    auto old_cursor_ttl = ds_config.range_config.cursor_ttl_ms;
+    ds_config.range_config.max_cursors = 4;
+    ds_config.range_config.cursor_ttl_ms = 10000;
+
+    for (int i = 0; i < 10; ++i) {
+        auto s = store_->Put(meta_.start_key() + std::to_string(i), "v");
+        ASSERT_TRUE(s.ok()) << s.ToString();
+    }
+    auto key = [this](int i) { return meta_.start_key() + std::to_string(i); };
+
+    storage::CursorCache cache;
+    bool paging = false;
+    // 只记下了结束位置，接上时没有迭代器可以续读
+    cache.PutIterator(key(2), key(3), "", 0, 1, nullptr);
+    ASSERT_TRUE(cache.TakeIterator(key(3), "x", 0, 1, &paging) == nullptr);
+    ASSERT_FALSE(paging);
+    ASSERT_TRUE(cache.TakeIterator(key(3), "", 0, 1, &paging) == nullptr);
+    ASSERT_TRUE(paging);
+    ASSERT_EQ(cache.Size(), 0U);
+
+    // 写版本相同时续读
+    std::unique_ptr<storage::Iterator> it(store_->NewIterator(key(5), ""));
+    cache.PutIterator(key(4), key(5), "", 0, 1, std::move(it));
+    paging = false;
+    it = cache.TakeIterator(key(5), "", 0, 1, &paging);
+    ASSERT_TRUE(paging);
+    ASSERT_TRUE(it != nullptr);
+    ASSERT_EQ(it->key(), key(5));
+
+    // 之后有写入，不能续读
+    cache.PutIterator(key(4), key(5), "", 0, 1, std::move(it));
+    paging = false;
+    it = cache.TakeIterator(key(5), "", 0, 2, &paging);
+    ASSERT_TRUE(paging);
+    ASSERT_TRUE(it == nullptr);
+    ASSERT_EQ(cache.Size(), 0U);
+
+    // 读快照的游标只给读同一快照的请求续读，之后有写入也可以续读
+    it.reset(store_->NewIterator(key(5), ""));
+    cache.PutIterator(key(4), key(5), "", 7, 1, std::move(it));
+    it = cache.TakeIterator(key(5), "", 0, 1, &paging);
+    ASSERT_TRUE(it == nullptr);
+    ASSERT_EQ(cache.Size(), 1U);
+    paging = false;
+    it = cache.TakeIterator(key(5), "", 7, 2, &paging);
+    ASSERT_TRUE(paging);
+    ASSERT_TRUE(it != nullptr);
+    ASSERT_EQ(cache.Size(), 0U);
+
+    ds_config.range_config.max_cursors = old_max_cursors;
+    ds_config.range_config.cursor_ttl_ms = old_cursor_ttl;
+}
+
+TEST_F(StoreTest, ScanSnapshot) {
+    auto old_max_cursors = ds_config.range_config.max_cursors;
+    auto old_max_snapshots = ds_config.range_config.max_snapshots;
+    auto old_snapshot_ttl = ds_config.range_config.snapshot_ttl_ms;
+    ds_config.range_config.max_cursors = 0;
+    ds_config.range_config.max_snapshots = 0;
+    ds_config.range_config.snapshot_ttl_ms = 10000;
+
+    auto key = [this](int i) { return meta_.start_key() + std::to_string(i); };
+    for (int i = 0; i < 4; ++i) {
+        auto s = store_->Put(key(i), "1");
+        ASSERT_TRUE(s.ok()) << s.ToString();
+    }
+
+    storage::SnapshotPtr snap;
+    uint64_t id = 0;
+    auto s = store_->AcquireSnapshot(true, 0, &snap, &id);
+    ASSERT_EQ(s.code(), sharkstore::Status::kNotSupported);
+
+    // 第一页创建快照
+    ds_config.range_config.max_snapshots = 2;
+    s = store_->AcquireSnapshot(true, 0, &snap, &id);
+    ASSERT_TRUE(s.ok()) << s.ToString();
+    ASSERT_NE(id, 0U);
+    storage::Store::ScanCursor cursor;
+    auto it = store_->OpenScanCursor(key(0), "", 2, id, snap, &cursor);
+    ASSERT_EQ(cursor.snapshot_id, id);
+    ASSERT_TRUE(it->Valid());
+    ASSERT_EQ(it->key(), key(0));
+    it.reset();
+
+    // 之后的写入对后面的页不可见（不经过游标缓存重新创建迭代器）
+    s = store_->Put(key(2), "2");
+    ASSERT_TRUE(s.ok()) << s.ToString();
+    s = store_->Put(key(5), "2");
+    ASSERT_TRUE(s.ok()) << s.ToString();
+
+    uint64_t next_id = 0;
+    snap.reset();
+    s = store_->AcquireSnapshot(false, id, &snap, &next_id);
+    ASSERT_TRUE(s.ok()) << s.ToString();
+    ASSERT_EQ(next_id, id);
+    it = store_->OpenScanCursor(key(2), "", 2, id, snap, &cursor);
+    std::vector<std::pair<std::string, std::string>> kvs;
+    for (; it->Valid(); it->Next()) {
+        kvs.emplace_back(it->key(), it->value());
+    }
+    ASSERT_EQ(kvs.size(), 2U);
+    ASSERT_EQ(kvs[0].first, key(2));
+    ASSERT_EQ(kvs[0].second, "1");
+    ASSERT_EQ(kvs[1].first, key(3));
+
+    // 快照不存在时返回错误
+    store_->ClearSnapshots();
+    s = store_->AcquireSnapshot(false, id, &snap, &next_id);
+    ASSERT_EQ(s.code(), sharkstore::Status::kExpired);
+
+    ds_config.range_config.max_cursors = old_max_cursors;
+    ds_config.range_config.max_snapshots = old_max_snapshots;
+    ds_config.range_config.snapshot_ttl_ms = old_snapshot_ttl;
+}
+
 TEST_F(StoreTest, SelectWhere) {
     InsertSomeRows();
 
@@ -624,5 +1350,114 @@ TEST_F(StoreTest, DeleteWhere) {
     ASSERT_TRUE(s.ok()) << s.ToString();
 }
 
+TEST_F(StoreTest, ApproximateStatisSize) {
+    // 2000个约1KB的kv
+    for (int i = 0; i < 2000; ++i) {
+        char suffix[16] = {'\0'};
+        snprintf(suffix, 16, "%06d", i);
+        auto s = store_->Put(meta_.start_key() + suffix, sharkstore::randomString(1000));
+        ASSERT_TRUE(s.ok()) << s.ToString();
+    }
+
+    const uint64_t split_size = 1024 * 1024;
+    std::string split_key;
+    auto real_size = store_->StatisSize(split_key, split_size, false);
+    ASSERT_FALSE(split_key.empty());
+
+    std::string approximate_key;
+    auto approximate_size = store_->ApproximateStatisSize(approximate_key, split_size, false);
+    ASSERT_GT(approximate_size, real_size / 2);
+    ASSERT_LT(approximate_size, real_size * 2);
+    ASSERT_FALSE(approximate_key.empty());
+    ASSERT_GT(approximate_key, meta_.start_key());
+    ASSERT_LT(approximate_key, meta_.end_key());
+
+    // 小于split size时不分裂
+    approximate_key.clear();
+    store_->ApproximateStatisSize(approximate_key, real_size * 4, false);
+    ASSERT_TRUE(approximate_key.empty());
+}
+
+TEST_F(StoreTest, ApproximateSizeCompressed) {
+    // 压缩率很高的value，落盘后sst大小远小于逻辑大小
+    for (int i = 0; i < 2000; ++i) {
+        char suffix[16] = {'\0'};
+        snprintf(suffix, 16, "%06d", i);
+        auto s = store_->Put(meta_.start_key() + suffix, std::string(1000, 'a' + i % 26));
+        ASSERT_TRUE(s.ok()) << s.ToString();
+    }
+    auto ret = db_->Flush(rocksdb::FlushOptions());
+    ASSERT_TRUE(ret.ok()) << ret.ToString();
+
+    std::string split_key;
+    auto real_size = store_->StatisSize(split_key, UINT64_MAX, false);
+    auto size = store_->ApproximateSize(meta_.start_key(), meta_.end_key());
+    ASSERT_GT(size, real_size / 2);
+    ASSERT_LT(size, real_size * 2);
+}
+
+TEST(LoadSampler, SplitKey) {
+    storage::LoadSampler sampler(storage::LoadSampler::kDefaultMaxSamples, 1);
+    sampler.Add("a");
+    ASSERT_EQ(sampler.Count(), 0U);
+
+    sampler.Start();
+    // 均匀访问key 000~999，分裂点应在中间附近
+    for (int round = 0; round < 10; ++round) {
+        for (int i = 0; i < 1000; ++i) {
+            char key[8] = {'\0'};
+            snprintf(key, 8, "%03d", i);
+            sampler.Add(key);
+        }
+    }
+    auto split_key = sampler.SplitKey();
+    ASSERT_FALSE(split_key.empty());
+    ASSERT_GT(split_key, "200");
+    ASSERT_LT(split_key, "800");
+
+    // 单key热点无法均衡
+    sampler.Start();
+    for (int i = 0; i < 10000; ++i) {
+        sampler.Add("hot");
+    }
+    ASSERT_TRUE(sampler.SplitKey().empty());
+
+    sampler.Stop();
+    ASSERT_FALSE(sampler.Running());
+    ASSERT_EQ(sampler.Count(), 0U);
+}
+
+TEST(LoadSampler, SampleRate) {
+    storage::LoadSampler sampler;
+    sampler.Start();
+    for (int round = 0; round < 100; ++round) {
+        for (int i = 0; i < 1000; ++i) {
+            char key[8] = {'\0'};
+            snprintf(key, 8, "%03d", i);
+            sampler.Add(key);
+        }
+    }
+    // 只抽取约1/kDefaultSampleRate的访问，分裂点不受影响
+    auto expected = 100000 / storage::LoadSampler::kDefaultSampleRate;
+    ASSERT_GT(sampler.Count(), expected / 2);
+    ASSERT_LT(sampler.Count(), expected * 2);
+    auto split_key = sampler.SplitKey();
+    ASSERT_FALSE(split_key.empty());
+    ASSERT_GT(split_key, "200");
+    ASSERT_LT(split_key, "800");
+}
+
+TEST_F(StoreTest, SampleScanOnce) {
+    InsertSomeRows();
+    auto sampler = store_->GetLoadSampler();
+    sampler->Start();
+    // 一次扫描请求只采样一次（按概率抽取，最多计一次）
+    for (int i = 0; i < 10; ++i) {
+        auto s = testSelect([](SelectRequestBuilder& b) { b.AddAllFields(); }, rows_);
+        ASSERT_TRUE(s.ok()) << s.ToString();
+    }
+    ASSERT_LE(sampler->Count(), 10U);
+    sampler->Stop();
+}
 
 } /* namespace  */
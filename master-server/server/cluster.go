@@ -809,6 +809,23 @@ func (c *Cluster) storeDeleteRange(r *metapb.Range) error {
 	return b.Commit()
 }
 
+// storeMergedRange 合并后被吸收的range只删除路由，数据已归属合并方，不回收副本
+func (c *Cluster) storeMergedRange(r *metapb.Range) error {
+	b := c.store.NewBatch()
+
+	key := []byte(fmt.Sprintf("%s%d", PREFIX_RANGE, r.GetId()))
+	deletedKey := []byte(fmt.Sprintf("%s%d", PREFIX_DELETED_RANGE, r.GetId()))
+	rng := deepcopy.Iface(r).(*metapb.Range)
+	data, err := proto.Marshal(rng)
+	if err != nil {
+		return err
+	}
+	b.Delete(key)
+	b.Put(deletedKey, data)
+
+	return b.Commit()
+}
+
 func (c *Cluster) storeReplaceRange(old, new *metapb.Range, toGc []*metapb.Peer) error {
 	b := c.store.NewBatch()
 
@@ -1,6 +1,7 @@
 package server
 
 import (
+	"bytes"
 	"fmt"
 	"master-server/http_reply"
 	"model/pkg/ds_admin"
@@ -49,6 +50,31 @@ func (c *Cluster) memDeleteRange(r *metapb.Range) {
 	c.deletedRanges.Add(r)
 }
 
+func (c *Cluster) memMergedRange(r *metapb.Range) {
+	c.DeleteRange(r.GetId())
+	c.deletedRanges.Add(r)
+}
+
+// removeMergedRanges 删除已被r合并的range的路由
+func (c *Cluster) removeMergedRanges(r *Range) {
+	for _, other := range c.GetTableAllRanges(r.GetTableId()) {
+		if other.GetId() == r.GetId() {
+			continue
+		}
+		if bytes.Compare(other.GetStartKey(), r.GetStartKey()) < 0 ||
+			bytes.Compare(other.GetEndKey(), r.GetEndKey()) > 0 {
+			continue
+		}
+		rngCopy := deepcopy.Iface(other.Range).(*metapb.Range)
+		if err := c.storeMergedRange(rngCopy); err != nil {
+			log.Error("store merged range[%d] failed, err[%v]", other.GetId(), err)
+			continue
+		}
+		c.memMergedRange(rngCopy)
+		log.Info("range[%d] is merged into range[%d], route deleted", other.GetId(), r.GetId())
+	}
+}
+
 func (c *Cluster) ReplaceRange(old *metapb.Range, new *Range, toGc []*metapb.Peer) {
 	defer func() {
 		if r := recover(); r != nil {
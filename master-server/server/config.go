@@ -26,6 +26,7 @@ const (
 	defaultNodeRangeBalanceTime      = 2 * time.Minute
 	defaultStorageAvailableThreshold = 20
 	defaultWriteByteOpsThreshold     = 30 * 1024 * 1024
+	defaultMergeRangeSizeThreshold   = 16 * 1024 * 1024
 )
 const DefaultFactor = 0.75
 
@@ -87,6 +88,8 @@ max-range-down-time = "600s"
 node-range-balance-time = "120s"
 storage-available-threshold = 20
 writeByte-ops-threshold = 31457280
+# merge adjacent idle ranges whose total size is less than it, disabled with auto split
+merge-range-size-threshold = 16777216
 
 [replication]
 # The number of replicas for each region.
@@ -341,6 +344,8 @@ type ScheduleConfig struct {
 	NodeRangeBalanceTime      util.Duration `toml:"node-range-balance-time,omitempty" json:"node-range-balance-time"`
 	StorageAvailableThreshold uint64        `toml:"storage-available-threshold,omitempty" json:"storage-available-threshold"`
 	WriteByteOpsThreshold     uint64        `toml:"writeByte-ops-threshold,omitempty" json:"writeByte-ops-threshold"`
+	// MergeRangeSizeThreshold merge adjacent idle ranges whose total size is less than it.
+	MergeRangeSizeThreshold uint64 `toml:"merge-range-size-threshold,omitempty" json:"merge-range-size-threshold"`
 }
 
 func (c *ScheduleConfig) adjust() {
@@ -354,6 +359,7 @@ func (c *ScheduleConfig) adjust() {
 	adjustDuration(&c.NodeRangeBalanceTime, defaultNodeRangeBalanceTime)
 	adjustUint64(&c.StorageAvailableThreshold, defaultStorageAvailableThreshold)
 	adjustUint64(&c.WriteByteOpsThreshold, defaultWriteByteOpsThreshold)
+	adjustUint64(&c.MergeRangeSizeThreshold, defaultMergeRangeSizeThreshold)
 
 }
 
@@ -395,6 +401,7 @@ type scheduleOption struct {
 	ReplicaScheduleLimit      uint64
 	StorageAvailableThreshold uint64
 	WriteByteOpsThreshold     uint64
+	MergeRangeSizeThreshold   uint64
 	//rep *Replication
 	MaxReplicas uint64
 	MetricAddr  string
@@ -413,6 +420,7 @@ func newScheduleOption(cfg *Config) *scheduleOption {
 		NodeRangeBalanceTime:      cfg.Schedule.NodeRangeBalanceTime.Duration,
 		StorageAvailableThreshold: cfg.Schedule.StorageAvailableThreshold,
 		WriteByteOpsThreshold:cfg.Schedule.WriteByteOpsThreshold,
+		MergeRangeSizeThreshold: cfg.Schedule.MergeRangeSizeThreshold,
 		MetricAddr: cfg.Metric.Address,
 		MetricInterval: cfg.Metric.Interval.Duration,
 		MaxReplicas: cfg.Replication.MaxReplicas,
@@ -462,6 +470,10 @@ func (o *scheduleOption) GetWriteByteOpsThreshold() uint64 {
 	return o.WriteByteOpsThreshold
 }
 
+func (o *scheduleOption) GetMergeRangeSizeThreshold() uint64 {
+	return o.MergeRangeSizeThreshold
+}
+
 func (o *scheduleOption) GetLeaderScheduleLimit() uint64 {
 	return o.LeaderScheduleLimit
 }
@@ -1,6 +1,7 @@
 package server
 
 import (
+	"bytes"
 	"fmt"
 	"model/pkg/metapb"
 	"time"
@@ -159,5 +160,52 @@ func (manager *hb_range_manager) CheckRange(cluster *Cluster, r *Range) *TaskCha
 		return NewTaskChain(id, r.GetId(), "hb-same-ip", NewAddPeerTask())
 	}
 
-	return nil
+	return manager.checkMerge(cluster, r)
+}
+
+// checkMerge 小且无写入的range与右侧相邻的range合并
+func (manager *hb_range_manager) checkMerge(cluster *Cluster, r *Range) *TaskChain {
+	threshold := cluster.opt.GetMergeRangeSizeThreshold()
+	if threshold == 0 || cluster.autoSplitUnable {
+		return nil
+	}
+	if !r.IsHealthy() || r.State != metapb.RangeState_R_Normal ||
+		r.ApproximateSize >= threshold || r.BytesWritten > 0 {
+		return nil
+	}
+
+	source := cluster.SearchRange(r.GetEndKey())
+	if source == nil || source.GetId() == r.GetId() || source.GetTableId() != r.GetTableId() ||
+		!bytes.Equal(source.GetStartKey(), r.GetEndKey()) {
+		return nil
+	}
+	if !source.IsHealthy() || source.State != metapb.RangeState_R_Normal ||
+		source.ApproximateSize >= threshold || source.BytesWritten > 0 ||
+		r.ApproximateSize+source.ApproximateSize >= threshold {
+		return nil
+	}
+	if cluster.taskManager.Find(source.GetId()) != nil {
+		return nil
+	}
+
+	// 副本须在相同的节点上
+	nodes := r.GetNodeIds()
+	srcNodes := source.GetNodeIds()
+	if len(nodes) != len(srcNodes) {
+		return nil
+	}
+	for id := range nodes {
+		if _, ok := srcNodes[id]; !ok {
+			return nil
+		}
+	}
+
+	id, err := cluster.GenId()
+	if err != nil {
+		log.Error("rangeId:%d,%s", r.GetId(), err.Error())
+		return nil
+	}
+	log.Info("range %d merge right neighbor %d, size: %d + %d", r.GetId(), source.GetId(),
+		r.ApproximateSize, source.ApproximateSize)
+	return NewTaskChain(id, r.GetId(), "hb-merge-range", NewMergeRangeTask(source.GetId()))
 }
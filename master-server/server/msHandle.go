@@ -285,12 +285,18 @@ func (service *Server) handleRangeHeartbeat(ctx context.Context, req *mspb.Range
 			}
 		}
 
+		mergedFrom := r.GetRangeEpoch().GetVersion() > rng.GetRangeEpoch().GetVersion() &&
+			bytes.Compare(r.GetEndKey(), rng.GetEndKey()) > 0
 		rng.Range = r
 		rng.Term = req.GetTerm()
 		rng.PeersStatus = req.GetPeersStatus()
 		rng.Leader = req.GetLeader()
 
 		cluster.AddRange(rng)
+		// 合并了右侧的range，删除被合并range的路由
+		if mergedFrom {
+			cluster.removeMergedRanges(rng)
+		}
 	}
 	rng.LastHbTimeTS = time.Now()
 	cluster.updateStatus(rng, req.GetStats())
@@ -308,6 +314,48 @@ func (service *Server) handleRangeHeartbeat(ctx context.Context, req *mspb.Range
 	return
 }
 
+// handleBatchRangeHeartbeat 处理一个节点合并发送的range心跳
+// 没有变化的range只带id，用缓存中的信息构造心跳，缓存中没有时要求下次发送完整心跳
+func (service *Server) handleBatchRangeHeartbeat(ctx context.Context, req *mspb.BatchRangeHeartbeatRequest) (resp *mspb.BatchRangeHeartbeatResponse) {
+	log.Debug("[HB] batch range heartbeat from node[%d] ip[%s], changed: %d, unchanged: %d",
+		req.GetNodeId(), util.GetIpFromContext(ctx), len(req.GetHeartbeats()), len(req.GetUnchangedRanges()))
+
+	resp = &mspb.BatchRangeHeartbeatResponse{Header: &mspb.ResponseHeader{}}
+	for _, hb := range req.GetHeartbeats() {
+		if r := service.handleRangeHeartbeat(ctx, hb); r.GetTask() != nil {
+			resp.Responses = append(resp.Responses, r)
+		}
+	}
+
+	cluster := service.cluster
+	for _, id := range req.GetUnchangedRanges() {
+		rng := cluster.FindRange(id)
+		// 本master还没有收到过该range的心跳（如刚切换为leader），或者leader已不在该节点
+		if rng == nil || rng.LastHbTimeTS.IsZero() || rng.GetLeader().GetNodeId() != req.GetNodeId() {
+			resp.FullRequired = append(resp.FullRequired, id)
+			continue
+		}
+		hb := &mspb.RangeHeartbeatRequest{
+			Header:      req.GetHeader(),
+			Range:       rng.Range,
+			Leader:      rng.Leader,
+			Term:        rng.Term,
+			PeersStatus: rng.PeersStatus,
+			Stats: &mspb.RangeStats{
+				BytesWritten:    rng.BytesWritten,
+				BytesRead:       rng.BytesRead,
+				KeysWritten:     rng.KeysWritten,
+				KeysRead:        rng.KeysRead,
+				ApproximateSize: rng.ApproximateSize,
+			},
+		}
+		if r := service.handleRangeHeartbeat(ctx, hb); r.GetTask() != nil {
+			resp.Responses = append(resp.Responses, r)
+		}
+	}
+	return
+}
+
 func (service *Server) handleAskSplit(ctx context.Context, req *mspb.AskSplitRequest) (resp *mspb.AskSplitResponse, err error) {
 	cluster := service.cluster
 	//集群不允许分裂
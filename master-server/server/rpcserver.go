@@ -52,6 +52,15 @@ func (service *Server) RangeHeartbeat(ctx context.Context, req *mspb.RangeHeartb
 	return resp, nil
 }
 
+func (service *Server) BatchRangeHeartbeat(ctx context.Context, req *mspb.BatchRangeHeartbeatRequest) (*mspb.BatchRangeHeartbeatResponse, error) {
+	if err := service.checkClusterValid(); err != nil {
+		resp := &mspb.BatchRangeHeartbeatResponse{Header: &mspb.ResponseHeader{Error: err}}
+		return resp, nil
+	}
+	resp := service.handleBatchRangeHeartbeat(ctx, req)
+	return resp, nil
+}
+
 func (service *Server) AskSplit(ctx context.Context, req *mspb.AskSplitRequest) (*mspb.AskSplitResponse, error) {
 	if err := service.checkClusterValid(); err != nil {
 		resp := &mspb.AskSplitResponse{Header: &mspb.ResponseHeader{Error: err}}
@@ -19,6 +19,8 @@ const (
 	TaskTypeChangeLeader
 	// TaskTypeDeleteRange delete range
 	TaskTypeDeleteRange
+	// TaskTypeMergeRange merge range
+	TaskTypeMergeRange
 )
 
 // String task type to string name
@@ -32,6 +34,8 @@ func (t TaskType) String() string {
 		return "change leader"
 	case TaskTypeDeleteRange:
 		return "delete range"
+	case TaskTypeMergeRange:
+		return "merge range"
 	default:
 		return "unknown"
 	}
@@ -65,6 +69,8 @@ const (
 	WaitRangeDeleted
 	// WaitLeaderChanged wait leader moved
 	WaitLeaderChanged
+	// WaitRangeMerged wait range merged
+	WaitRangeMerged
 )
 
 // String to string name
@@ -91,6 +97,8 @@ func (ts TaskState) String() string {
 		return "wait range deleted"
 	case WaitLeaderChanged:
 		return "wait leader changed"
+	case WaitRangeMerged:
+		return "wait range merged"
 	default:
 		return "unknown"
 	}
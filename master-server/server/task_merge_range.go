@@ -0,0 +1,106 @@
+package server
+
+import (
+	"bytes"
+	"fmt"
+	"time"
+	"util/log"
+
+	"model/pkg/taskpb"
+)
+
+const (
+	defaultMergeRangeTaskTimeout          = time.Second * time.Duration(120)
+	defaultMaxMergeChangeLeaderRetryTimes = 3
+)
+
+// MergeRangeTask merge the right adjacent range into the range
+// ds要求两者的leader在同一节点，先把source的leader迁到target的leader节点上
+type MergeRangeTask struct {
+	*BaseTask
+	sourceID uint64
+
+	leaderRetries int
+}
+
+// NewMergeRangeTask new merge range task
+func NewMergeRangeTask(sourceID uint64) *MergeRangeTask {
+	return &MergeRangeTask{
+		BaseTask: newBaseTask(TaskTypeMergeRange, defaultMergeRangeTaskTimeout),
+		sourceID: sourceID,
+	}
+}
+
+func (t *MergeRangeTask) String() string {
+	return fmt.Sprintf("{%s, \"source\": %d}", t.BaseTask.String(), t.sourceID)
+}
+
+// Step step
+func (t *MergeRangeTask) Step(cluster *Cluster, r *Range) (over bool, task *taskpb.Task) {
+	switch t.GetState() {
+	case TaskStateStart, WaitLeaderChanged:
+		return t.stepLeader(cluster, r)
+	case WaitRangeMerged:
+		return t.stepWaitMerged(cluster, r)
+	default:
+		log.Error("%s unexpceted merge range task state: %s", t.logID, t.state.String())
+	}
+	return
+}
+
+func (t *MergeRangeTask) issueTask() *taskpb.Task {
+	return &taskpb.Task{
+		Type: taskpb.TaskType_RangeMerge,
+		RangeMerge: &taskpb.TaskRangeMerge{
+			SourceId: t.sourceID,
+		},
+	}
+}
+
+func (t *MergeRangeTask) stepLeader(cluster *Cluster, r *Range) (over bool, task *taskpb.Task) {
+	source := cluster.FindRange(t.sourceID)
+	if source == nil || !bytes.Equal(source.GetStartKey(), r.GetEndKey()) {
+		log.Warn("%s source range(%d) is not right neighbor", t.logID, t.sourceID)
+		t.state = TaskStateCanceled
+		return true, nil
+	}
+
+	leaderNode := r.GetLeader().GetNodeId()
+	if source.GetLeader().GetNodeId() == leaderNode {
+		log.Info("%s source range(%d) leader is on node %d, start merge", t.logID, t.sourceID, leaderNode)
+		t.state = WaitRangeMerged
+		return false, t.issueTask()
+	}
+
+	if t.leaderRetries >= defaultMaxMergeChangeLeaderRetryTimes {
+		log.Info("%s canceled(max change leader retry reached). source leader: %d, leader: %d",
+			t.logID, source.GetLeader().GetNodeId(), leaderNode)
+		t.state = TaskStateCanceled
+		return true, nil
+	}
+	t.leaderRetries++
+
+	node := cluster.FindNodeById(leaderNode)
+	if node == nil {
+		log.Warn("%s could not find leader node(%d)", t.logID, leaderNode)
+		t.state = TaskStateCanceled
+		return true, nil
+	}
+	log.Info("%s try to change source range(%d) leader to %d, current: %d",
+		t.logID, t.sourceID, leaderNode, source.GetLeader().GetNodeId())
+	//TODO:可能对堵塞时间比较长
+	cluster.cli.TransferLeader(node.GetServerAddr(), t.sourceID)
+	t.state = WaitLeaderChanged
+	return false, nil
+}
+
+func (t *MergeRangeTask) stepWaitMerged(cluster *Cluster, r *Range) (over bool, task *taskpb.Task) {
+	// source的路由在range心跳处理中删除（见Cluster.removeMergedRanges）
+	if cluster.FindRange(t.sourceID) == nil {
+		log.Info("%s merge finished, key range[%v - %v]", t.logID, r.GetStartKey(), r.GetEndKey())
+		t.state = TaskStateFinished
+		return true, nil
+	}
+	// ds上合并进行中时忽略重复的任务
+	return false, t.issueTask()
+}
@@ -52,6 +52,8 @@ const (
 	FunctionID_kFuncKvBatchDel          FunctionID = 105
 	FunctionID_kFuncKvRangeDel          FunctionID = 106
 	FunctionID_kFuncKvScan              FunctionID = 107
+	FunctionID_kFuncKvIncr              FunctionID = 109
+	FunctionID_kFuncKvAppend            FunctionID = 110
 	FunctionID_kFuncLock                FunctionID = 200
 	FunctionID_kFuncLockUpdate          FunctionID = 201
 	FunctionID_kFuncUnlock              FunctionID = 202
@@ -87,6 +89,8 @@ var FunctionID_name = map[int32]string{
 	105:  "kFuncKvBatchDel",
 	106:  "kFuncKvRangeDel",
 	107:  "kFuncKvScan",
+	109:  "kFuncKvIncr",
+	110:  "kFuncKvAppend",
 	200:  "kFuncLock",
 	201:  "kFuncLockUpdate",
 	202:  "kFuncUnlock",
@@ -121,6 +125,8 @@ var FunctionID_value = map[string]int32{
 	"kFuncKvBatchDel":          105,
 	"kFuncKvRangeDel":          106,
 	"kFuncKvScan":              107,
+	"kFuncKvIncr":              109,
+	"kFuncKvAppend":            110,
 	"kFuncLock":                200,
 	"kFuncLockUpdate":          201,
 	"kFuncUnlock":              202,
@@ -149,32 +155,33 @@ func init() {
 func init() { proto.RegisterFile("funcpb.proto", fileDescriptorFuncpb) }
 
 var fileDescriptorFuncpb = []byte{
-	// 426 bytes of a gzipped FileDescriptorProto
-	0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0x5c, 0x92, 0x4b, 0x72, 0xd3, 0x40,
-	0x10, 0x86, 0x23, 0x1e, 0x51, 0xd1, 0x71, 0xec, 0xa6, 0x31, 0x14, 0x50, 0x85, 0x0f, 0xc0, 0x02,
-	0x16, 0x9c, 0x80, 0x60, 0x12, 0x5c, 0x76, 0x41, 0xca, 0x86, 0x03, 0x8c, 0x47, 0x2d, 0xc5, 0x58,
-	0xcc, 0xb8, 0x26, 0x6d, 0x87, 0x63, 0xb0, 0xe4, 0x48, 0xe1, 0xb1, 0x80, 0x1b, 0x50, 0x66, 0xc5,
-	0x9b, 0x23, 0xa4, 0x66, 0xa4, 0x8c, 0x55, 0xd9, 0xa9, 0xbf, 0xf9, 0xff, 0xd6, 0x3f, 0xdd, 0x03,
-	0xad, 0x7c, 0x69, 0xf4, 0x62, 0xfa, 0x60, 0xe1, 0xac, 0x58, 0xda, 0xae, 0xaa, 0xbb, 0xdd, 0xc2,
-	0x16, 0x36, 0xa0, 0x87, 0xfe, 0xab, 0x3a, 0xbd, 0xff, 0xee, 0x2a, 0xc0, 0xfe, 0xd2, 0x68, 0x99,
-	0x59, 0x33, 0xe8, 0x13, 0x41, 0x7b, 0xee, 0xcb, 0x67, 0xac, 0x9c, 0x4c, 0x59, 0x09, 0x6e, 0x51,
-	0x07, 0x76, 0x02, 0x1b, 0xab, 0x93, 0x03, 0x16, 0x4c, 0x9a, 0xe0, 0x70, 0x29, 0x78, 0x29, 0xba,
-	0xc6, 0xea, 0xa4, 0xcf, 0x25, 0x0b, 0xe3, 0x65, 0xba, 0x01, 0x9d, 0x73, 0xf6, 0xf4, 0x2d, 0xeb,
-	0xa5, 0x30, 0x5e, 0x89, 0xce, 0x09, 0x97, 0xac, 0x05, 0x21, 0x82, 0x81, 0x39, 0x66, 0x27, 0xb8,
-	0x13, 0x41, 0xdd, 0xa7, 0x15, 0xc1, 0xab, 0x45, 0xa6, 0x84, 0x71, 0x97, 0x10, 0x5a, 0xc3, 0xd0,
-	0x98, 0x17, 0xa5, 0xd2, 0x8c, 0x6d, 0x6a, 0x03, 0x04, 0xc9, 0x70, 0x35, 0x61, 0xc1, 0xac, 0x51,
-	0xfb, 0xbc, 0x1c, 0xa3, 0x0c, 0x57, 0x7b, 0x4a, 0xf4, 0x91, 0x17, 0xe5, 0x17, 0xa1, 0x57, 0x16,
-	0x0d, 0x67, 0x9f, 0x4b, 0x3c, 0xba, 0x28, 0xf2, 0x70, 0xd6, 0x80, 0x63, 0x65, 0x0a, 0xf6, 0xf0,
-	0x75, 0x8c, 0x39, 0x5c, 0x4d, 0xb4, 0x32, 0x38, 0xa7, 0x36, 0x5c, 0x0b, 0x60, 0x64, 0xf5, 0x1c,
-	0x4f, 0x13, 0xea, 0xd6, 0x2e, 0x5f, 0xd7, 0x77, 0xf9, 0x90, 0x10, 0x9e, 0xdf, 0xce, 0x94, 0x5e,
-	0xf7, 0x31, 0xa1, 0x9b, 0x80, 0x0d, 0xb2, 0x6f, 0x9d, 0x66, 0xfc, 0x94, 0x10, 0xc1, 0x6e, 0xb4,
-	0x87, 0x3f, 0x7c, 0xde, 0x48, 0x9f, 0x38, 0x56, 0xc2, 0x21, 0x0c, 0xfe, 0x48, 0x23, 0xae, 0x46,
-	0x58, 0xe1, 0x9f, 0x29, 0xdd, 0x83, 0xdb, 0xf5, 0x42, 0x4c, 0xc1, 0x2f, 0x9d, 0x32, 0xc7, 0x39,
-	0xbb, 0x11, 0xab, 0x8c, 0x1d, 0xfe, 0xda, 0xb8, 0xaa, 0x6c, 0x95, 0xeb, 0xf7, 0x06, 0x1f, 0xb0,
-	0x1c, 0x32, 0xbb, 0x81, 0xc9, 0x2d, 0xfe, 0x49, 0xe9, 0x0e, 0x74, 0xeb, 0x45, 0xca, 0x73, 0x9b,
-	0xf1, 0xc8, 0x16, 0x23, 0x5e, 0x71, 0x89, 0x7f, 0x53, 0xba, 0x05, 0xd7, 0xc3, 0xd1, 0x8b, 0x3c,
-	0x2f, 0x67, 0xa6, 0xee, 0xf4, 0x6f, 0xc3, 0xeb, 0xbd, 0x55, 0xfc, 0x7f, 0x4a, 0x9d, 0x7a, 0xe6,
-	0x8f, 0xb3, 0x37, 0x33, 0x83, 0x5f, 0x3b, 0x7b, 0x78, 0xba, 0xee, 0x25, 0x5f, 0xd6, 0xbd, 0xe4,
-	0xdb, 0xba, 0x97, 0xbc, 0xff, 0xde, 0xdb, 0x9a, 0x6e, 0x87, 0xb7, 0xfa, 0xe8, 0x2c, 0x00, 0x00,
-	0xff, 0xff, 0xc0, 0x6f, 0xce, 0xac, 0xd9, 0x02, 0x00, 0x00,
+	// 443 bytes of a gzipped FileDescriptorProto
+	0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0x5c, 0x92, 0x5d, 0x72, 0xd3, 0x30,
+	0x14, 0x85, 0x6b, 0x7e, 0xea, 0x41, 0x4d, 0x93, 0xdb, 0x4b, 0x60, 0x80, 0x19, 0xb2, 0x00, 0x1e,
+	0xe0, 0x81, 0x15, 0xb4, 0x84, 0x96, 0x4c, 0x32, 0xd0, 0x49, 0x60, 0x01, 0x8a, 0x7c, 0xed, 0x86,
+	0xb8, 0x92, 0x47, 0xbd, 0x49, 0x59, 0x0a, 0x0b, 0x61, 0x11, 0xe5, 0xe7, 0x01, 0x76, 0xc0, 0x84,
+	0x27, 0xfe, 0x59, 0x02, 0x23, 0x59, 0x55, 0x3c, 0x79, 0xf3, 0xfd, 0x74, 0xce, 0xf5, 0xb1, 0x8e,
+	0x45, 0x2b, 0x5f, 0x68, 0x55, 0x4d, 0x1f, 0x56, 0xd6, 0xb0, 0xc1, 0xed, 0x7a, 0xba, 0xd7, 0x2d,
+	0x4c, 0x61, 0x3c, 0x7a, 0xe4, 0x9e, 0xea, 0xd3, 0x07, 0xef, 0xae, 0x0b, 0x71, 0xb8, 0xd0, 0x8a,
+	0x67, 0x46, 0x0f, 0xfa, 0x88, 0xa2, 0x3d, 0x77, 0xe3, 0x33, 0x92, 0x96, 0xa7, 0x24, 0x19, 0xb6,
+	0xb0, 0x23, 0x76, 0x3c, 0x1b, 0xcb, 0xf3, 0x23, 0x62, 0x48, 0x9a, 0xe0, 0x78, 0xc1, 0x70, 0x25,
+	0xba, 0xc6, 0xf2, 0xbc, 0x4f, 0x25, 0x31, 0xc1, 0x55, 0xbc, 0x29, 0x3a, 0x97, 0xec, 0xe9, 0x1b,
+	0x52, 0x0b, 0x26, 0xb8, 0x16, 0x9d, 0x13, 0x2a, 0x49, 0x31, 0x88, 0x08, 0x06, 0xfa, 0x8c, 0x2c,
+	0xc3, 0x4e, 0x04, 0x61, 0x4f, 0x2b, 0x82, 0x57, 0x55, 0x26, 0x99, 0x60, 0x17, 0x41, 0xb4, 0x86,
+	0x7e, 0x31, 0x55, 0xa5, 0x54, 0x04, 0x6d, 0x6c, 0x0b, 0xe1, 0x25, 0xc3, 0xe5, 0x84, 0x18, 0xb2,
+	0xc6, 0xec, 0xf2, 0x52, 0x8c, 0x32, 0x5c, 0x1e, 0x48, 0x56, 0x27, 0x4e, 0x94, 0x6f, 0x42, 0xa7,
+	0x2c, 0x1a, 0xce, 0x3e, 0x95, 0x70, 0xb2, 0x29, 0x72, 0x70, 0xd6, 0x80, 0x63, 0xa9, 0x0b, 0x72,
+	0xf0, 0x75, 0x8c, 0x39, 0x5c, 0x4e, 0x94, 0xd4, 0x30, 0x6f, 0x80, 0x81, 0x56, 0x16, 0x4e, 0x71,
+	0x4f, 0xec, 0x06, 0xb0, 0x5f, 0x55, 0xa4, 0x33, 0xd0, 0xd8, 0x16, 0x37, 0x3c, 0x1a, 0x19, 0x35,
+	0x87, 0x8b, 0x04, 0xbb, 0x61, 0xb3, 0x9b, 0xc3, 0xf7, 0xbe, 0x4f, 0x10, 0x2e, 0x6f, 0x40, 0x97,
+	0x4e, 0xf7, 0x21, 0xc1, 0x5b, 0x02, 0x1a, 0xe4, 0xd0, 0x58, 0x45, 0xf0, 0x31, 0x41, 0x0c, 0x6f,
+	0x70, 0x76, 0x9f, 0xe2, 0xd3, 0x5a, 0xfa, 0xc4, 0x92, 0x64, 0xf2, 0x81, 0xe1, 0x7b, 0x1a, 0x71,
+	0x7d, 0xcd, 0x35, 0xfe, 0x91, 0xe2, 0x7d, 0x71, 0x27, 0x94, 0xa6, 0x0b, 0x7a, 0x69, 0xa5, 0x3e,
+	0xcb, 0xc9, 0x8e, 0x48, 0x66, 0x64, 0xe1, 0xe7, 0xda, 0x55, 0x67, 0xab, 0x5d, 0xbf, 0xd6, 0xf8,
+	0x88, 0xf8, 0x98, 0xc8, 0x0e, 0x74, 0x6e, 0xe0, 0x77, 0x8a, 0x77, 0x45, 0x37, 0x94, 0xcd, 0xcf,
+	0x4d, 0x46, 0x23, 0x53, 0x8c, 0x68, 0x49, 0x25, 0xfc, 0x49, 0xf1, 0xb6, 0xd8, 0xf3, 0x47, 0x2f,
+	0xf2, 0xbc, 0x9c, 0xe9, 0xb0, 0xe9, 0xef, 0x9a, 0x87, 0x6e, 0x6b, 0xfe, 0x2f, 0xc5, 0x4e, 0xe8,
+	0x65, 0x3f, 0x3b, 0x9d, 0x69, 0xf8, 0xd2, 0x39, 0x80, 0x8b, 0x55, 0x2f, 0xf9, 0xbc, 0xea, 0x25,
+	0x5f, 0x57, 0xbd, 0xe4, 0xed, 0xb7, 0xde, 0xd6, 0x74, 0xdb, 0xff, 0xcf, 0x8f, 0xff, 0x07, 0x00,
+	0x00, 0xff, 0xff, 0xb0, 0xce, 0xe4, 0x01, 0xfd, 0x02, 0x00, 0x00,
 }
@@ -83,6 +83,14 @@
 		KvRangeDeleteResponse
 		DsKvRangeDeleteRequest
 		DsKvRangeDeleteResponse
+		KvIncrRequest
+		KvIncrResponse
+		DsKvIncrRequest
+		DsKvIncrResponse
+		KvAppendRequest
+		KvAppendResponse
+		DsKvAppendRequest
+		DsKvAppendResponse
 		LockValue
 		LockRequest
 		DsLockRequest
@@ -913,6 +921,10 @@ type SelectRequest struct {
 	GroupBys     []*metapb.Column     `protobuf:"bytes,5,rep,name=group_bys,json=groupBys" json:"group_bys,omitempty"`
 	Limit        *Limit               `protobuf:"bytes,6,opt,name=limit" json:"limit,omitempty"`
 	Timestamp    *timestamp.Timestamp `protobuf:"bytes,7,opt,name=timestamp" json:"timestamp,omitempty"`
+	// 快照读（如分页导出）：open_snapshot为true时在读取前创建快照，响应中返回snapshot_id，
+	// 之后的请求带上snapshot_id读取同一个快照；快照已过期、被淘汰或leader已切换时返回kExpired
+	OpenSnapshot bool   `protobuf:"varint,8,opt,name=open_snapshot,json=openSnapshot,proto3" json:"open_snapshot,omitempty"`
+	SnapshotId   uint64 `protobuf:"varint,9,opt,name=snapshot_id,json=snapshotId,proto3" json:"snapshot_id,omitempty"`
 }
 
 func (m *SelectRequest) Reset()                    { *m = SelectRequest{} }
@@ -969,6 +981,20 @@ func (m *SelectRequest) GetTimestamp() *timestamp.Timestamp {
 	return nil
 }
 
+func (m *SelectRequest) GetOpenSnapshot() bool {
+	if m != nil {
+		return m.OpenSnapshot
+	}
+	return false
+}
+
+func (m *SelectRequest) GetSnapshotId() uint64 {
+	if m != nil {
+		return m.SnapshotId
+	}
+	return 0
+}
+
 type Row struct {
 	Key          []byte  `protobuf:"bytes,1,opt,name=key,proto3" json:"key,omitempty"`
 	Fields       []byte  `protobuf:"bytes,2,opt,name=fields,proto3" json:"fields,omitempty"`
@@ -1033,6 +1059,8 @@ type SelectResponse struct {
 	Rows []*Row `protobuf:"bytes,2,rep,name=rows" json:"rows,omitempty"`
 	// for limit, offset in the range
 	Offset uint64 `protobuf:"varint,3,opt,name=offset,proto3" json:"offset,omitempty"`
+	// open_snapshot时创建的快照
+	SnapshotId uint64 `protobuf:"varint,4,opt,name=snapshot_id,json=snapshotId,proto3" json:"snapshot_id,omitempty"`
 }
 
 func (m *SelectResponse) Reset()                    { *m = SelectResponse{} }
@@ -1061,6 +1089,13 @@ func (m *SelectResponse) GetOffset() uint64 {
 	return 0
 }
 
+func (m *SelectResponse) GetSnapshotId() uint64 {
+	if m != nil {
+		return m.SnapshotId
+	}
+	return 0
+}
+
 type KeyValue struct {
 	Key      []byte `protobuf:"bytes,1,opt,name=Key,proto3" json:"Key,omitempty"`
 	Value    []byte `protobuf:"bytes,2,opt,name=Value,proto3" json:"Value,omitempty"`
@@ -1840,6 +1875,9 @@ type KvScanRequest struct {
 	KeyOnly bool `protobuf:"varint,4,opt,name=key_only,json=keyOnly,proto3" json:"key_only,omitempty"`
 	// -1 表示不限制
 	MaxCount int64 `protobuf:"varint,5,opt,name=max_count,json=maxCount,proto3" json:"max_count,omitempty"`
+	// 分页扫描读同一个快照，用法同SelectRequest
+	OpenSnapshot bool   `protobuf:"varint,6,opt,name=open_snapshot,json=openSnapshot,proto3" json:"open_snapshot,omitempty"`
+	SnapshotId   uint64 `protobuf:"varint,7,opt,name=snapshot_id,json=snapshotId,proto3" json:"snapshot_id,omitempty"`
 }
 
 func (m *KvScanRequest) Reset()                    { *m = KvScanRequest{} }
@@ -1882,6 +1920,20 @@ func (m *KvScanRequest) GetMaxCount() int64 {
 	return 0
 }
 
+func (m *KvScanRequest) GetOpenSnapshot() bool {
+	if m != nil {
+		return m.OpenSnapshot
+	}
+	return false
+}
+
+func (m *KvScanRequest) GetSnapshotId() uint64 {
+	if m != nil {
+		return m.SnapshotId
+	}
+	return 0
+}
+
 type KvScanResponse struct {
 	Code int32 `protobuf:"varint,1,opt,name=code,proto3" json:"code,omitempty"`
 	// when count_only  == true
@@ -1889,6 +1941,8 @@ type KvScanResponse struct {
 	Kvs   []*RedisKeyValue `protobuf:"bytes,3,rep,name=kvs" json:"kvs,omitempty"`
 	// 可能扫描返回的数据量很大，需要迭代
 	LastKey []byte `protobuf:"bytes,4,opt,name=last_key,json=lastKey,proto3" json:"last_key,omitempty"`
+	// open_snapshot时创建的快照
+	SnapshotId uint64 `protobuf:"varint,5,opt,name=snapshot_id,json=snapshotId,proto3" json:"snapshot_id,omitempty"`
 }
 
 func (m *KvScanResponse) Reset()                    { *m = KvScanResponse{} }
@@ -1924,6 +1978,13 @@ func (m *KvScanResponse) GetLastKey() []byte {
 	return nil
 }
 
+func (m *KvScanResponse) GetSnapshotId() uint64 {
+	if m != nil {
+		return m.SnapshotId
+	}
+	return 0
+}
+
 type DsKvScanRequest struct {
 	Header *RequestHeader `protobuf:"bytes,1,opt,name=header" json:"header,omitempty"`
 	Req    *KvScanRequest `protobuf:"bytes,2,opt,name=req" json:"req,omitempty"`
@@ -2290,6 +2351,184 @@ func (m *DsKvRangeDeleteResponse) GetResp() *KvRangeDeleteResponse {
 	return nil
 }
 
+// 原子加：值按十进制整数解释（key不存在或不是整数时从0开始）加上delta，apply时不读取旧值（rocksdb merge）
+type KvIncrRequest struct {
+	Key   []byte `protobuf:"bytes,1,opt,name=key,proto3" json:"key,omitempty"`
+	Delta int64  `protobuf:"varint,2,opt,name=delta,proto3" json:"delta,omitempty"`
+}
+
+func (m *KvIncrRequest) Reset()                    { *m = KvIncrRequest{} }
+func (m *KvIncrRequest) String() string            { return proto.CompactTextString(m) }
+func (*KvIncrRequest) ProtoMessage()               {}
+func (*KvIncrRequest) Descriptor() ([]byte, []int) { return fileDescriptorKvrpcpb, []int{75} }
+
+func (m *KvIncrRequest) GetKey() []byte {
+	if m != nil {
+		return m.Key
+	}
+	return nil
+}
+
+func (m *KvIncrRequest) GetDelta() int64 {
+	if m != nil {
+		return m.Delta
+	}
+	return 0
+}
+
+type KvIncrResponse struct {
+	Code int32 `protobuf:"varint,1,opt,name=code,proto3" json:"code,omitempty"`
+}
+
+func (m *KvIncrResponse) Reset()                    { *m = KvIncrResponse{} }
+func (m *KvIncrResponse) String() string            { return proto.CompactTextString(m) }
+func (*KvIncrResponse) ProtoMessage()               {}
+func (*KvIncrResponse) Descriptor() ([]byte, []int) { return fileDescriptorKvrpcpb, []int{76} }
+
+func (m *KvIncrResponse) GetCode() int32 {
+	if m != nil {
+		return m.Code
+	}
+	return 0
+}
+
+type DsKvIncrRequest struct {
+	Header *RequestHeader `protobuf:"bytes,1,opt,name=header" json:"header,omitempty"`
+	Req    *KvIncrRequest `protobuf:"bytes,2,opt,name=req" json:"req,omitempty"`
+}
+
+func (m *DsKvIncrRequest) Reset()                    { *m = DsKvIncrRequest{} }
+func (m *DsKvIncrRequest) String() string            { return proto.CompactTextString(m) }
+func (*DsKvIncrRequest) ProtoMessage()               {}
+func (*DsKvIncrRequest) Descriptor() ([]byte, []int) { return fileDescriptorKvrpcpb, []int{77} }
+
+func (m *DsKvIncrRequest) GetHeader() *RequestHeader {
+	if m != nil {
+		return m.Header
+	}
+	return nil
+}
+
+func (m *DsKvIncrRequest) GetReq() *KvIncrRequest {
+	if m != nil {
+		return m.Req
+	}
+	return nil
+}
+
+type DsKvIncrResponse struct {
+	Header *ResponseHeader `protobuf:"bytes,1,opt,name=header" json:"header,omitempty"`
+	Resp   *KvIncrResponse `protobuf:"bytes,2,opt,name=resp" json:"resp,omitempty"`
+}
+
+func (m *DsKvIncrResponse) Reset()                    { *m = DsKvIncrResponse{} }
+func (m *DsKvIncrResponse) String() string            { return proto.CompactTextString(m) }
+func (*DsKvIncrResponse) ProtoMessage()               {}
+func (*DsKvIncrResponse) Descriptor() ([]byte, []int) { return fileDescriptorKvrpcpb, []int{78} }
+
+func (m *DsKvIncrResponse) GetHeader() *ResponseHeader {
+	if m != nil {
+		return m.Header
+	}
+	return nil
+}
+
+func (m *DsKvIncrResponse) GetResp() *KvIncrResponse {
+	if m != nil {
+		return m.Resp
+	}
+	return nil
+}
+
+// 追加：value追加到已有值的末尾（不存在时即为value），apply时不读取旧值（rocksdb merge）
+type KvAppendRequest struct {
+	Key   []byte `protobuf:"bytes,1,opt,name=key,proto3" json:"key,omitempty"`
+	Value []byte `protobuf:"bytes,2,opt,name=value,proto3" json:"value,omitempty"`
+}
+
+func (m *KvAppendRequest) Reset()                    { *m = KvAppendRequest{} }
+func (m *KvAppendRequest) String() string            { return proto.CompactTextString(m) }
+func (*KvAppendRequest) ProtoMessage()               {}
+func (*KvAppendRequest) Descriptor() ([]byte, []int) { return fileDescriptorKvrpcpb, []int{79} }
+
+func (m *KvAppendRequest) GetKey() []byte {
+	if m != nil {
+		return m.Key
+	}
+	return nil
+}
+
+func (m *KvAppendRequest) GetValue() []byte {
+	if m != nil {
+		return m.Value
+	}
+	return nil
+}
+
+type KvAppendResponse struct {
+	Code int32 `protobuf:"varint,1,opt,name=code,proto3" json:"code,omitempty"`
+}
+
+func (m *KvAppendResponse) Reset()                    { *m = KvAppendResponse{} }
+func (m *KvAppendResponse) String() string            { return proto.CompactTextString(m) }
+func (*KvAppendResponse) ProtoMessage()               {}
+func (*KvAppendResponse) Descriptor() ([]byte, []int) { return fileDescriptorKvrpcpb, []int{80} }
+
+func (m *KvAppendResponse) GetCode() int32 {
+	if m != nil {
+		return m.Code
+	}
+	return 0
+}
+
+type DsKvAppendRequest struct {
+	Header *RequestHeader   `protobuf:"bytes,1,opt,name=header" json:"header,omitempty"`
+	Req    *KvAppendRequest `protobuf:"bytes,2,opt,name=req" json:"req,omitempty"`
+}
+
+func (m *DsKvAppendRequest) Reset()                    { *m = DsKvAppendRequest{} }
+func (m *DsKvAppendRequest) String() string            { return proto.CompactTextString(m) }
+func (*DsKvAppendRequest) ProtoMessage()               {}
+func (*DsKvAppendRequest) Descriptor() ([]byte, []int) { return fileDescriptorKvrpcpb, []int{81} }
+
+func (m *DsKvAppendRequest) GetHeader() *RequestHeader {
+	if m != nil {
+		return m.Header
+	}
+	return nil
+}
+
+func (m *DsKvAppendRequest) GetReq() *KvAppendRequest {
+	if m != nil {
+		return m.Req
+	}
+	return nil
+}
+
+type DsKvAppendResponse struct {
+	Header *ResponseHeader   `protobuf:"bytes,1,opt,name=header" json:"header,omitempty"`
+	Resp   *KvAppendResponse `protobuf:"bytes,2,opt,name=resp" json:"resp,omitempty"`
+}
+
+func (m *DsKvAppendResponse) Reset()                    { *m = DsKvAppendResponse{} }
+func (m *DsKvAppendResponse) String() string            { return proto.CompactTextString(m) }
+func (*DsKvAppendResponse) ProtoMessage()               {}
+func (*DsKvAppendResponse) Descriptor() ([]byte, []int) { return fileDescriptorKvrpcpb, []int{82} }
+
+func (m *DsKvAppendResponse) GetHeader() *ResponseHeader {
+	if m != nil {
+		return m.Header
+	}
+	return nil
+}
+
+func (m *DsKvAppendResponse) GetResp() *KvAppendResponse {
+	if m != nil {
+		return m.Resp
+	}
+	return nil
+}
+
 type LockValue struct {
 	Value      []byte `protobuf:"bytes,2,opt,name=value,proto3" json:"value,omitempty"`
 	Id         string `protobuf:"bytes,3,opt,name=id,proto3" json:"id,omitempty"`
@@ -2301,7 +2540,7 @@ type LockValue struct {
 func (m *LockValue) Reset()                    { *m = LockValue{} }
 func (m *LockValue) String() string            { return proto.CompactTextString(m) }
 func (*LockValue) ProtoMessage()               {}
-func (*LockValue) Descriptor() ([]byte, []int) { return fileDescriptorKvrpcpb, []int{75} }
+func (*LockValue) Descriptor() ([]byte, []int) { return fileDescriptorKvrpcpb, []int{83} }
 
 func (m *LockValue) GetValue() []byte {
 	if m != nil {
@@ -2348,7 +2587,7 @@ type LockRequest struct {
 func (m *LockRequest) Reset()                    { *m = LockRequest{} }
 func (m *LockRequest) String() string            { return proto.CompactTextString(m) }
 func (*LockRequest) ProtoMessage()               {}
-func (*LockRequest) Descriptor() ([]byte, []int) { return fileDescriptorKvrpcpb, []int{76} }
+func (*LockRequest) Descriptor() ([]byte, []int) { return fileDescriptorKvrpcpb, []int{84} }
 
 func (m *LockRequest) GetKey() []byte {
 	if m != nil {
@@ -2386,7 +2625,7 @@ type DsLockRequest struct {
 func (m *DsLockRequest) Reset()                    { *m = DsLockRequest{} }
 func (m *DsLockRequest) String() string            { return proto.CompactTextString(m) }
 func (*DsLockRequest) ProtoMessage()               {}
-func (*DsLockRequest) Descriptor() ([]byte, []int) { return fileDescriptorKvrpcpb, []int{77} }
+func (*DsLockRequest) Descriptor() ([]byte, []int) { return fileDescriptorKvrpcpb, []int{85} }
 
 func (m *DsLockRequest) GetHeader() *RequestHeader {
 	if m != nil {
@@ -2412,7 +2651,7 @@ type LockResponse struct {
 func (m *LockResponse) Reset()                    { *m = LockResponse{} }
 func (m *LockResponse) String() string            { return proto.CompactTextString(m) }
 func (*LockResponse) ProtoMessage()               {}
-func (*LockResponse) Descriptor() ([]byte, []int) { return fileDescriptorKvrpcpb, []int{78} }
+func (*LockResponse) Descriptor() ([]byte, []int) { return fileDescriptorKvrpcpb, []int{86} }
 
 func (m *LockResponse) GetCode() int64 {
 	if m != nil {
@@ -2450,7 +2689,7 @@ type LockInfo struct {
 func (m *LockInfo) Reset()                    { *m = LockInfo{} }
 func (m *LockInfo) String() string            { return proto.CompactTextString(m) }
 func (*LockInfo) ProtoMessage()               {}
-func (*LockInfo) Descriptor() ([]byte, []int) { return fileDescriptorKvrpcpb, []int{79} }
+func (*LockInfo) Descriptor() ([]byte, []int) { return fileDescriptorKvrpcpb, []int{87} }
 
 func (m *LockInfo) GetKey() []byte {
 	if m != nil {
@@ -2474,7 +2713,7 @@ type LockScanResponse struct {
 func (m *LockScanResponse) Reset()                    { *m = LockScanResponse{} }
 func (m *LockScanResponse) String() string            { return proto.CompactTextString(m) }
 func (*LockScanResponse) ProtoMessage()               {}
-func (*LockScanResponse) Descriptor() ([]byte, []int) { return fileDescriptorKvrpcpb, []int{80} }
+func (*LockScanResponse) Descriptor() ([]byte, []int) { return fileDescriptorKvrpcpb, []int{88} }
 
 func (m *LockScanResponse) GetInfo() []*LockInfo {
 	if m != nil {
@@ -2498,7 +2737,7 @@ type DsLockResponse struct {
 func (m *DsLockResponse) Reset()                    { *m = DsLockResponse{} }
 func (m *DsLockResponse) String() string            { return proto.CompactTextString(m) }
 func (*DsLockResponse) ProtoMessage()               {}
-func (*DsLockResponse) Descriptor() ([]byte, []int) { return fileDescriptorKvrpcpb, []int{81} }
+func (*DsLockResponse) Descriptor() ([]byte, []int) { return fileDescriptorKvrpcpb, []int{89} }
 
 func (m *DsLockResponse) GetHeader() *ResponseHeader {
 	if m != nil {
@@ -2525,7 +2764,7 @@ type LockUpdateRequest struct {
 func (m *LockUpdateRequest) Reset()                    { *m = LockUpdateRequest{} }
 func (m *LockUpdateRequest) String() string            { return proto.CompactTextString(m) }
 func (*LockUpdateRequest) ProtoMessage()               {}
-func (*LockUpdateRequest) Descriptor() ([]byte, []int) { return fileDescriptorKvrpcpb, []int{82} }
+func (*LockUpdateRequest) Descriptor() ([]byte, []int) { return fileDescriptorKvrpcpb, []int{90} }
 
 func (m *LockUpdateRequest) GetKey() []byte {
 	if m != nil {
@@ -2570,7 +2809,7 @@ type DsLockUpdateRequest struct {
 func (m *DsLockUpdateRequest) Reset()                    { *m = DsLockUpdateRequest{} }
 func (m *DsLockUpdateRequest) String() string            { return proto.CompactTextString(m) }
 func (*DsLockUpdateRequest) ProtoMessage()               {}
-func (*DsLockUpdateRequest) Descriptor() ([]byte, []int) { return fileDescriptorKvrpcpb, []int{83} }
+func (*DsLockUpdateRequest) Descriptor() ([]byte, []int) { return fileDescriptorKvrpcpb, []int{91} }
 
 func (m *DsLockUpdateRequest) GetHeader() *RequestHeader {
 	if m != nil {
@@ -2594,7 +2833,7 @@ type DsLockUpdateResponse struct {
 func (m *DsLockUpdateResponse) Reset()                    { *m = DsLockUpdateResponse{} }
 func (m *DsLockUpdateResponse) String() string            { return proto.CompactTextString(m) }
 func (*DsLockUpdateResponse) ProtoMessage()               {}
-func (*DsLockUpdateResponse) Descriptor() ([]byte, []int) { return fileDescriptorKvrpcpb, []int{84} }
+func (*DsLockUpdateResponse) Descriptor() ([]byte, []int) { return fileDescriptorKvrpcpb, []int{92} }
 
 func (m *DsLockUpdateResponse) GetHeader() *ResponseHeader {
 	if m != nil {
@@ -2620,7 +2859,7 @@ type UnlockRequest struct {
 func (m *UnlockRequest) Reset()                    { *m = UnlockRequest{} }
 func (m *UnlockRequest) String() string            { return proto.CompactTextString(m) }
 func (*UnlockRequest) ProtoMessage()               {}
-func (*UnlockRequest) Descriptor() ([]byte, []int) { return fileDescriptorKvrpcpb, []int{85} }
+func (*UnlockRequest) Descriptor() ([]byte, []int) { return fileDescriptorKvrpcpb, []int{93} }
 
 func (m *UnlockRequest) GetKey() []byte {
 	if m != nil {
@@ -2658,7 +2897,7 @@ type DsUnlockRequest struct {
 func (m *DsUnlockRequest) Reset()                    { *m = DsUnlockRequest{} }
 func (m *DsUnlockRequest) String() string            { return proto.CompactTextString(m) }
 func (*DsUnlockRequest) ProtoMessage()               {}
-func (*DsUnlockRequest) Descriptor() ([]byte, []int) { return fileDescriptorKvrpcpb, []int{86} }
+func (*DsUnlockRequest) Descriptor() ([]byte, []int) { return fileDescriptorKvrpcpb, []int{94} }
 
 func (m *DsUnlockRequest) GetHeader() *RequestHeader {
 	if m != nil {
@@ -2682,7 +2921,7 @@ type DsUnlockResponse struct {
 func (m *DsUnlockResponse) Reset()                    { *m = DsUnlockResponse{} }
 func (m *DsUnlockResponse) String() string            { return proto.CompactTextString(m) }
 func (*DsUnlockResponse) ProtoMessage()               {}
-func (*DsUnlockResponse) Descriptor() ([]byte, []int) { return fileDescriptorKvrpcpb, []int{87} }
+func (*DsUnlockResponse) Descriptor() ([]byte, []int) { return fileDescriptorKvrpcpb, []int{95} }
 
 func (m *DsUnlockResponse) GetHeader() *ResponseHeader {
 	if m != nil {
@@ -2707,7 +2946,7 @@ type UnlockForceRequest struct {
 func (m *UnlockForceRequest) Reset()                    { *m = UnlockForceRequest{} }
 func (m *UnlockForceRequest) String() string            { return proto.CompactTextString(m) }
 func (*UnlockForceRequest) ProtoMessage()               {}
-func (*UnlockForceRequest) Descriptor() ([]byte, []int) { return fileDescriptorKvrpcpb, []int{88} }
+func (*UnlockForceRequest) Descriptor() ([]byte, []int) { return fileDescriptorKvrpcpb, []int{96} }
 
 func (m *UnlockForceRequest) GetKey() []byte {
 	if m != nil {
@@ -2738,7 +2977,7 @@ type DsUnlockForceRequest struct {
 func (m *DsUnlockForceRequest) Reset()                    { *m = DsUnlockForceRequest{} }
 func (m *DsUnlockForceRequest) String() string            { return proto.CompactTextString(m) }
 func (*DsUnlockForceRequest) ProtoMessage()               {}
-func (*DsUnlockForceRequest) Descriptor() ([]byte, []int) { return fileDescriptorKvrpcpb, []int{89} }
+func (*DsUnlockForceRequest) Descriptor() ([]byte, []int) { return fileDescriptorKvrpcpb, []int{97} }
 
 func (m *DsUnlockForceRequest) GetHeader() *RequestHeader {
 	if m != nil {
@@ -2762,7 +3001,7 @@ type DsUnlockForceResponse struct {
 func (m *DsUnlockForceResponse) Reset()                    { *m = DsUnlockForceResponse{} }
 func (m *DsUnlockForceResponse) String() string            { return proto.CompactTextString(m) }
 func (*DsUnlockForceResponse) ProtoMessage()               {}
-func (*DsUnlockForceResponse) Descriptor() ([]byte, []int) { return fileDescriptorKvrpcpb, []int{90} }
+func (*DsUnlockForceResponse) Descriptor() ([]byte, []int) { return fileDescriptorKvrpcpb, []int{98} }
 
 func (m *DsUnlockForceResponse) GetHeader() *ResponseHeader {
 	if m != nil {
@@ -2787,7 +3026,7 @@ type LockScanRequest struct {
 func (m *LockScanRequest) Reset()                    { *m = LockScanRequest{} }
 func (m *LockScanRequest) String() string            { return proto.CompactTextString(m) }
 func (*LockScanRequest) ProtoMessage()               {}
-func (*LockScanRequest) Descriptor() ([]byte, []int) { return fileDescriptorKvrpcpb, []int{91} }
+func (*LockScanRequest) Descriptor() ([]byte, []int) { return fileDescriptorKvrpcpb, []int{99} }
 
 func (m *LockScanRequest) GetStart() []byte {
 	if m != nil {
@@ -2818,7 +3057,7 @@ type DsLockScanRequest struct {
 func (m *DsLockScanRequest) Reset()                    { *m = DsLockScanRequest{} }
 func (m *DsLockScanRequest) String() string            { return proto.CompactTextString(m) }
 func (*DsLockScanRequest) ProtoMessage()               {}
-func (*DsLockScanRequest) Descriptor() ([]byte, []int) { return fileDescriptorKvrpcpb, []int{92} }
+func (*DsLockScanRequest) Descriptor() ([]byte, []int) { return fileDescriptorKvrpcpb, []int{100} }
 
 func (m *DsLockScanRequest) GetHeader() *RequestHeader {
 	if m != nil {
@@ -2842,7 +3081,7 @@ type DsLockScanResponse struct {
 func (m *DsLockScanResponse) Reset()                    { *m = DsLockScanResponse{} }
 func (m *DsLockScanResponse) String() string            { return proto.CompactTextString(m) }
 func (*DsLockScanResponse) ProtoMessage()               {}
-func (*DsLockScanResponse) Descriptor() ([]byte, []int) { return fileDescriptorKvrpcpb, []int{93} }
+func (*DsLockScanResponse) Descriptor() ([]byte, []int) { return fileDescriptorKvrpcpb, []int{101} }
 
 func (m *DsLockScanResponse) GetHeader() *ResponseHeader {
 	if m != nil {
@@ -2934,6 +3173,14 @@ func init() {
 	proto.RegisterType((*KvRangeDeleteResponse)(nil), "kvrpcpb.KvRangeDeleteResponse")
 	proto.RegisterType((*DsKvRangeDeleteRequest)(nil), "kvrpcpb.DsKvRangeDeleteRequest")
 	proto.RegisterType((*DsKvRangeDeleteResponse)(nil), "kvrpcpb.DsKvRangeDeleteResponse")
+	proto.RegisterType((*KvIncrRequest)(nil), "kvrpcpb.KvIncrRequest")
+	proto.RegisterType((*KvIncrResponse)(nil), "kvrpcpb.KvIncrResponse")
+	proto.RegisterType((*DsKvIncrRequest)(nil), "kvrpcpb.DsKvIncrRequest")
+	proto.RegisterType((*DsKvIncrResponse)(nil), "kvrpcpb.DsKvIncrResponse")
+	proto.RegisterType((*KvAppendRequest)(nil), "kvrpcpb.KvAppendRequest")
+	proto.RegisterType((*KvAppendResponse)(nil), "kvrpcpb.KvAppendResponse")
+	proto.RegisterType((*DsKvAppendRequest)(nil), "kvrpcpb.DsKvAppendRequest")
+	proto.RegisterType((*DsKvAppendResponse)(nil), "kvrpcpb.DsKvAppendResponse")
 	proto.RegisterType((*LockValue)(nil), "kvrpcpb.LockValue")
 	proto.RegisterType((*LockRequest)(nil), "kvrpcpb.LockRequest")
 	proto.RegisterType((*DsLockRequest)(nil), "kvrpcpb.DsLockRequest")
@@ -3904,6 +4151,21 @@ func (m *SelectRequest) MarshalTo(dAtA []byte) (int, error) {
 		}
 		i += n29
 	}
+	if m.OpenSnapshot {
+		dAtA[i] = 0x40
+		i++
+		if m.OpenSnapshot {
+			dAtA[i] = 1
+		} else {
+			dAtA[i] = 0
+		}
+		i++
+	}
+	if m.SnapshotId != 0 {
+		dAtA[i] = 0x48
+		i++
+		i = encodeVarintKvrpcpb(dAtA, i, uint64(m.SnapshotId))
+	}
 	return i, nil
 }
 
@@ -4030,6 +4292,11 @@ func (m *SelectResponse) MarshalTo(dAtA []byte) (int, error) {
 		i++
 		i = encodeVarintKvrpcpb(dAtA, i, uint64(m.Offset))
 	}
+	if m.SnapshotId != 0 {
+		dAtA[i] = 0x20
+		i++
+		i = encodeVarintKvrpcpb(dAtA, i, uint64(m.SnapshotId))
+	}
 	return i, nil
 }
 
@@ -5163,6 +5430,21 @@ func (m *KvScanRequest) MarshalTo(dAtA []byte) (int, error) {
 		i++
 		i = encodeVarintKvrpcpb(dAtA, i, uint64(m.MaxCount))
 	}
+	if m.OpenSnapshot {
+		dAtA[i] = 0x30
+		i++
+		if m.OpenSnapshot {
+			dAtA[i] = 1
+		} else {
+			dAtA[i] = 0
+		}
+		i++
+	}
+	if m.SnapshotId != 0 {
+		dAtA[i] = 0x38
+		i++
+		i = encodeVarintKvrpcpb(dAtA, i, uint64(m.SnapshotId))
+	}
 	return i, nil
 }
 
@@ -5209,6 +5491,11 @@ func (m *KvScanResponse) MarshalTo(dAtA []byte) (int, error) {
 		i = encodeVarintKvrpcpb(dAtA, i, uint64(len(m.LastKey)))
 		i += copy(dAtA[i:], m.LastKey)
 	}
+	if m.SnapshotId != 0 {
+		dAtA[i] = 0x28
+		i++
+		i = encodeVarintKvrpcpb(dAtA, i, uint64(m.SnapshotId))
+	}
 	return i, nil
 }
 
@@ -5706,7 +5993,7 @@ func (m *DsKvRangeDeleteResponse) MarshalTo(dAtA []byte) (int, error) {
 	return i, nil
 }
 
-func (m *LockValue) Marshal() (dAtA []byte, err error) {
+func (m *KvIncrRequest) Marshal() (dAtA []byte, err error) {
 	size := m.Size()
 	dAtA = make([]byte, size)
 	n, err := m.MarshalTo(dAtA)
@@ -5716,47 +6003,49 @@ func (m *LockValue) Marshal() (dAtA []byte, err error) {
 	return dAtA[:n], nil
 }
 
-func (m *LockValue) MarshalTo(dAtA []byte) (int, error) {
+func (m *KvIncrRequest) MarshalTo(dAtA []byte) (int, error) {
 	var i int
 	_ = i
 	var l int
 	_ = l
-	if len(m.Value) > 0 {
-		dAtA[i] = 0x12
-		i++
-		i = encodeVarintKvrpcpb(dAtA, i, uint64(len(m.Value)))
-		i += copy(dAtA[i:], m.Value)
-	}
-	if len(m.Id) > 0 {
-		dAtA[i] = 0x1a
+	if len(m.Key) > 0 {
+		dAtA[i] = 0xa
 		i++
-		i = encodeVarintKvrpcpb(dAtA, i, uint64(len(m.Id)))
-		i += copy(dAtA[i:], m.Id)
+		i = encodeVarintKvrpcpb(dAtA, i, uint64(len(m.Key)))
+		i += copy(dAtA[i:], m.Key)
 	}
-	if m.DeleteTime != 0 {
-		dAtA[i] = 0x20
+	if m.Delta != 0 {
+		dAtA[i] = 0x10
 		i++
-		i = encodeVarintKvrpcpb(dAtA, i, uint64(m.DeleteTime))
+		i = encodeVarintKvrpcpb(dAtA, i, uint64(m.Delta))
 	}
-	if m.UpdateTime != 0 {
-		dAtA[i] = 0x28
-		i++
-		i = encodeVarintKvrpcpb(dAtA, i, uint64(m.UpdateTime))
+	return i, nil
+}
+
+func (m *KvIncrResponse) Marshal() (dAtA []byte, err error) {
+	size := m.Size()
+	dAtA = make([]byte, size)
+	n, err := m.MarshalTo(dAtA)
+	if err != nil {
+		return nil, err
 	}
-	if m.DeleteFlag {
-		dAtA[i] = 0x30
-		i++
-		if m.DeleteFlag {
-			dAtA[i] = 1
-		} else {
-			dAtA[i] = 0
-		}
+	return dAtA[:n], nil
+}
+
+func (m *KvIncrResponse) MarshalTo(dAtA []byte) (int, error) {
+	var i int
+	_ = i
+	var l int
+	_ = l
+	if m.Code != 0 {
+		dAtA[i] = 0x8
 		i++
+		i = encodeVarintKvrpcpb(dAtA, i, uint64(m.Code))
 	}
 	return i, nil
 }
 
-func (m *LockRequest) Marshal() (dAtA []byte, err error) {
+func (m *DsKvIncrRequest) Marshal() (dAtA []byte, err error) {
 	size := m.Size()
 	dAtA = make([]byte, size)
 	n, err := m.MarshalTo(dAtA)
@@ -5766,47 +6055,35 @@ func (m *LockRequest) Marshal() (dAtA []byte, err error) {
 	return dAtA[:n], nil
 }
 
-func (m *LockRequest) MarshalTo(dAtA []byte) (int, error) {
+func (m *DsKvIncrRequest) MarshalTo(dAtA []byte) (int, error) {
 	var i int
 	_ = i
 	var l int
 	_ = l
-	if len(m.Key) > 0 {
+	if m.Header != nil {
 		dAtA[i] = 0xa
 		i++
-		i = encodeVarintKvrpcpb(dAtA, i, uint64(len(m.Key)))
-		i += copy(dAtA[i:], m.Key)
-	}
-	if m.Value != nil {
-		dAtA[i] = 0x12
-		i++
-		i = encodeVarintKvrpcpb(dAtA, i, uint64(m.Value.Size()))
-		n80, err := m.Value.MarshalTo(dAtA[i:])
+		i = encodeVarintKvrpcpb(dAtA, i, uint64(m.Header.Size()))
+		n80, err := m.Header.MarshalTo(dAtA[i:])
 		if err != nil {
 			return 0, err
 		}
 		i += n80
 	}
-	if m.Timestamp != nil {
-		dAtA[i] = 0x52
+	if m.Req != nil {
+		dAtA[i] = 0x12
 		i++
-		i = encodeVarintKvrpcpb(dAtA, i, uint64(m.Timestamp.Size()))
-		n81, err := m.Timestamp.MarshalTo(dAtA[i:])
+		i = encodeVarintKvrpcpb(dAtA, i, uint64(m.Req.Size()))
+		n81, err := m.Req.MarshalTo(dAtA[i:])
 		if err != nil {
 			return 0, err
 		}
 		i += n81
 	}
-	if len(m.By) > 0 {
-		dAtA[i] = 0x5a
-		i++
-		i = encodeVarintKvrpcpb(dAtA, i, uint64(len(m.By)))
-		i += copy(dAtA[i:], m.By)
-	}
 	return i, nil
 }
 
-func (m *DsLockRequest) Marshal() (dAtA []byte, err error) {
+func (m *DsKvIncrResponse) Marshal() (dAtA []byte, err error) {
 	size := m.Size()
 	dAtA = make([]byte, size)
 	n, err := m.MarshalTo(dAtA)
@@ -5816,7 +6093,7 @@ func (m *DsLockRequest) Marshal() (dAtA []byte, err error) {
 	return dAtA[:n], nil
 }
 
-func (m *DsLockRequest) MarshalTo(dAtA []byte) (int, error) {
+func (m *DsKvIncrResponse) MarshalTo(dAtA []byte) (int, error) {
 	var i int
 	_ = i
 	var l int
@@ -5831,11 +6108,11 @@ func (m *DsLockRequest) MarshalTo(dAtA []byte) (int, error) {
 		}
 		i += n82
 	}
-	if m.Req != nil {
+	if m.Resp != nil {
 		dAtA[i] = 0x12
 		i++
-		i = encodeVarintKvrpcpb(dAtA, i, uint64(m.Req.Size()))
-		n83, err := m.Req.MarshalTo(dAtA[i:])
+		i = encodeVarintKvrpcpb(dAtA, i, uint64(m.Resp.Size()))
+		n83, err := m.Resp.MarshalTo(dAtA[i:])
 		if err != nil {
 			return 0, err
 		}
@@ -5844,7 +6121,7 @@ func (m *DsLockRequest) MarshalTo(dAtA []byte) (int, error) {
 	return i, nil
 }
 
-func (m *LockResponse) Marshal() (dAtA []byte, err error) {
+func (m *KvAppendRequest) Marshal() (dAtA []byte, err error) {
 	size := m.Size()
 	dAtA = make([]byte, size)
 	n, err := m.MarshalTo(dAtA)
@@ -5854,37 +6131,27 @@ func (m *LockResponse) Marshal() (dAtA []byte, err error) {
 	return dAtA[:n], nil
 }
 
-func (m *LockResponse) MarshalTo(dAtA []byte) (int, error) {
+func (m *KvAppendRequest) MarshalTo(dAtA []byte) (int, error) {
 	var i int
 	_ = i
 	var l int
 	_ = l
-	if m.Code != 0 {
-		dAtA[i] = 0x8
-		i++
-		i = encodeVarintKvrpcpb(dAtA, i, uint64(m.Code))
-	}
-	if len(m.Error) > 0 {
-		dAtA[i] = 0x12
+	if len(m.Key) > 0 {
+		dAtA[i] = 0xa
 		i++
-		i = encodeVarintKvrpcpb(dAtA, i, uint64(len(m.Error)))
-		i += copy(dAtA[i:], m.Error)
+		i = encodeVarintKvrpcpb(dAtA, i, uint64(len(m.Key)))
+		i += copy(dAtA[i:], m.Key)
 	}
 	if len(m.Value) > 0 {
-		dAtA[i] = 0x1a
+		dAtA[i] = 0x12
 		i++
 		i = encodeVarintKvrpcpb(dAtA, i, uint64(len(m.Value)))
 		i += copy(dAtA[i:], m.Value)
 	}
-	if m.UpdateTime != 0 {
-		dAtA[i] = 0x20
-		i++
-		i = encodeVarintKvrpcpb(dAtA, i, uint64(m.UpdateTime))
-	}
 	return i, nil
 }
 
-func (m *LockInfo) Marshal() (dAtA []byte, err error) {
+func (m *KvAppendResponse) Marshal() (dAtA []byte, err error) {
 	size := m.Size()
 	dAtA = make([]byte, size)
 	n, err := m.MarshalTo(dAtA)
@@ -5894,31 +6161,20 @@ func (m *LockInfo) Marshal() (dAtA []byte, err error) {
 	return dAtA[:n], nil
 }
 
-func (m *LockInfo) MarshalTo(dAtA []byte) (int, error) {
+func (m *KvAppendResponse) MarshalTo(dAtA []byte) (int, error) {
 	var i int
 	_ = i
 	var l int
 	_ = l
-	if len(m.Key) > 0 {
-		dAtA[i] = 0xa
-		i++
-		i = encodeVarintKvrpcpb(dAtA, i, uint64(len(m.Key)))
-		i += copy(dAtA[i:], m.Key)
-	}
-	if m.Value != nil {
-		dAtA[i] = 0x12
+	if m.Code != 0 {
+		dAtA[i] = 0x8
 		i++
-		i = encodeVarintKvrpcpb(dAtA, i, uint64(m.Value.Size()))
-		n84, err := m.Value.MarshalTo(dAtA[i:])
-		if err != nil {
-			return 0, err
-		}
-		i += n84
+		i = encodeVarintKvrpcpb(dAtA, i, uint64(m.Code))
 	}
 	return i, nil
 }
 
-func (m *LockScanResponse) Marshal() (dAtA []byte, err error) {
+func (m *DsKvAppendRequest) Marshal() (dAtA []byte, err error) {
 	size := m.Size()
 	dAtA = make([]byte, size)
 	n, err := m.MarshalTo(dAtA)
@@ -5928,33 +6184,35 @@ func (m *LockScanResponse) Marshal() (dAtA []byte, err error) {
 	return dAtA[:n], nil
 }
 
-func (m *LockScanResponse) MarshalTo(dAtA []byte) (int, error) {
+func (m *DsKvAppendRequest) MarshalTo(dAtA []byte) (int, error) {
 	var i int
 	_ = i
 	var l int
 	_ = l
-	if len(m.Info) > 0 {
-		for _, msg := range m.Info {
-			dAtA[i] = 0xa
-			i++
-			i = encodeVarintKvrpcpb(dAtA, i, uint64(msg.Size()))
-			n, err := msg.MarshalTo(dAtA[i:])
-			if err != nil {
-				return 0, err
-			}
-			i += n
+	if m.Header != nil {
+		dAtA[i] = 0xa
+		i++
+		i = encodeVarintKvrpcpb(dAtA, i, uint64(m.Header.Size()))
+		n84, err := m.Header.MarshalTo(dAtA[i:])
+		if err != nil {
+			return 0, err
 		}
+		i += n84
 	}
-	if len(m.LastKey) > 0 {
+	if m.Req != nil {
 		dAtA[i] = 0x12
 		i++
-		i = encodeVarintKvrpcpb(dAtA, i, uint64(len(m.LastKey)))
-		i += copy(dAtA[i:], m.LastKey)
+		i = encodeVarintKvrpcpb(dAtA, i, uint64(m.Req.Size()))
+		n85, err := m.Req.MarshalTo(dAtA[i:])
+		if err != nil {
+			return 0, err
+		}
+		i += n85
 	}
 	return i, nil
 }
 
-func (m *DsLockResponse) Marshal() (dAtA []byte, err error) {
+func (m *DsKvAppendResponse) Marshal() (dAtA []byte, err error) {
 	size := m.Size()
 	dAtA = make([]byte, size)
 	n, err := m.MarshalTo(dAtA)
@@ -5964,7 +6222,7 @@ func (m *DsLockResponse) Marshal() (dAtA []byte, err error) {
 	return dAtA[:n], nil
 }
 
-func (m *DsLockResponse) MarshalTo(dAtA []byte) (int, error) {
+func (m *DsKvAppendResponse) MarshalTo(dAtA []byte) (int, error) {
 	var i int
 	_ = i
 	var l int
@@ -5973,26 +6231,26 @@ func (m *DsLockResponse) MarshalTo(dAtA []byte) (int, error) {
 		dAtA[i] = 0xa
 		i++
 		i = encodeVarintKvrpcpb(dAtA, i, uint64(m.Header.Size()))
-		n85, err := m.Header.MarshalTo(dAtA[i:])
+		n86, err := m.Header.MarshalTo(dAtA[i:])
 		if err != nil {
 			return 0, err
 		}
-		i += n85
+		i += n86
 	}
 	if m.Resp != nil {
 		dAtA[i] = 0x12
 		i++
 		i = encodeVarintKvrpcpb(dAtA, i, uint64(m.Resp.Size()))
-		n86, err := m.Resp.MarshalTo(dAtA[i:])
+		n87, err := m.Resp.MarshalTo(dAtA[i:])
 		if err != nil {
 			return 0, err
 		}
-		i += n86
+		i += n87
 	}
 	return i, nil
 }
 
-func (m *LockUpdateRequest) Marshal() (dAtA []byte, err error) {
+func (m *LockValue) Marshal() (dAtA []byte, err error) {
 	size := m.Size()
 	dAtA = make([]byte, size)
 	n, err := m.MarshalTo(dAtA)
@@ -6002,16 +6260,16 @@ func (m *LockUpdateRequest) Marshal() (dAtA []byte, err error) {
 	return dAtA[:n], nil
 }
 
-func (m *LockUpdateRequest) MarshalTo(dAtA []byte) (int, error) {
+func (m *LockValue) MarshalTo(dAtA []byte) (int, error) {
 	var i int
 	_ = i
 	var l int
 	_ = l
-	if len(m.Key) > 0 {
-		dAtA[i] = 0xa
+	if len(m.Value) > 0 {
+		dAtA[i] = 0x12
 		i++
-		i = encodeVarintKvrpcpb(dAtA, i, uint64(len(m.Key)))
-		i += copy(dAtA[i:], m.Key)
+		i = encodeVarintKvrpcpb(dAtA, i, uint64(len(m.Value)))
+		i += copy(dAtA[i:], m.Value)
 	}
 	if len(m.Id) > 0 {
 		dAtA[i] = 0x1a
@@ -6019,31 +6277,30 @@ func (m *LockUpdateRequest) MarshalTo(dAtA []byte) (int, error) {
 		i = encodeVarintKvrpcpb(dAtA, i, uint64(len(m.Id)))
 		i += copy(dAtA[i:], m.Id)
 	}
+	if m.DeleteTime != 0 {
+		dAtA[i] = 0x20
+		i++
+		i = encodeVarintKvrpcpb(dAtA, i, uint64(m.DeleteTime))
+	}
 	if m.UpdateTime != 0 {
 		dAtA[i] = 0x28
 		i++
 		i = encodeVarintKvrpcpb(dAtA, i, uint64(m.UpdateTime))
 	}
-	if len(m.UpdateValue) > 0 {
-		dAtA[i] = 0x32
-		i++
-		i = encodeVarintKvrpcpb(dAtA, i, uint64(len(m.UpdateValue)))
-		i += copy(dAtA[i:], m.UpdateValue)
-	}
-	if m.Timestamp != nil {
-		dAtA[i] = 0x52
+	if m.DeleteFlag {
+		dAtA[i] = 0x30
 		i++
-		i = encodeVarintKvrpcpb(dAtA, i, uint64(m.Timestamp.Size()))
-		n87, err := m.Timestamp.MarshalTo(dAtA[i:])
-		if err != nil {
-			return 0, err
+		if m.DeleteFlag {
+			dAtA[i] = 1
+		} else {
+			dAtA[i] = 0
 		}
-		i += n87
+		i++
 	}
 	return i, nil
 }
 
-func (m *DsLockUpdateRequest) Marshal() (dAtA []byte, err error) {
+func (m *LockRequest) Marshal() (dAtA []byte, err error) {
 	size := m.Size()
 	dAtA = make([]byte, size)
 	n, err := m.MarshalTo(dAtA)
@@ -6053,35 +6310,47 @@ func (m *DsLockUpdateRequest) Marshal() (dAtA []byte, err error) {
 	return dAtA[:n], nil
 }
 
-func (m *DsLockUpdateRequest) MarshalTo(dAtA []byte) (int, error) {
+func (m *LockRequest) MarshalTo(dAtA []byte) (int, error) {
 	var i int
 	_ = i
 	var l int
 	_ = l
-	if m.Header != nil {
+	if len(m.Key) > 0 {
 		dAtA[i] = 0xa
 		i++
-		i = encodeVarintKvrpcpb(dAtA, i, uint64(m.Header.Size()))
-		n88, err := m.Header.MarshalTo(dAtA[i:])
+		i = encodeVarintKvrpcpb(dAtA, i, uint64(len(m.Key)))
+		i += copy(dAtA[i:], m.Key)
+	}
+	if m.Value != nil {
+		dAtA[i] = 0x12
+		i++
+		i = encodeVarintKvrpcpb(dAtA, i, uint64(m.Value.Size()))
+		n88, err := m.Value.MarshalTo(dAtA[i:])
 		if err != nil {
 			return 0, err
 		}
 		i += n88
 	}
-	if m.Req != nil {
-		dAtA[i] = 0x12
+	if m.Timestamp != nil {
+		dAtA[i] = 0x52
 		i++
-		i = encodeVarintKvrpcpb(dAtA, i, uint64(m.Req.Size()))
-		n89, err := m.Req.MarshalTo(dAtA[i:])
+		i = encodeVarintKvrpcpb(dAtA, i, uint64(m.Timestamp.Size()))
+		n89, err := m.Timestamp.MarshalTo(dAtA[i:])
 		if err != nil {
 			return 0, err
 		}
 		i += n89
 	}
+	if len(m.By) > 0 {
+		dAtA[i] = 0x5a
+		i++
+		i = encodeVarintKvrpcpb(dAtA, i, uint64(len(m.By)))
+		i += copy(dAtA[i:], m.By)
+	}
 	return i, nil
 }
 
-func (m *DsLockUpdateResponse) Marshal() (dAtA []byte, err error) {
+func (m *DsLockRequest) Marshal() (dAtA []byte, err error) {
 	size := m.Size()
 	dAtA = make([]byte, size)
 	n, err := m.MarshalTo(dAtA)
@@ -6091,7 +6360,7 @@ func (m *DsLockUpdateResponse) Marshal() (dAtA []byte, err error) {
 	return dAtA[:n], nil
 }
 
-func (m *DsLockUpdateResponse) MarshalTo(dAtA []byte) (int, error) {
+func (m *DsLockRequest) MarshalTo(dAtA []byte) (int, error) {
 	var i int
 	_ = i
 	var l int
@@ -6106,11 +6375,11 @@ func (m *DsLockUpdateResponse) MarshalTo(dAtA []byte) (int, error) {
 		}
 		i += n90
 	}
-	if m.Resp != nil {
+	if m.Req != nil {
 		dAtA[i] = 0x12
 		i++
-		i = encodeVarintKvrpcpb(dAtA, i, uint64(m.Resp.Size()))
-		n91, err := m.Resp.MarshalTo(dAtA[i:])
+		i = encodeVarintKvrpcpb(dAtA, i, uint64(m.Req.Size()))
+		n91, err := m.Req.MarshalTo(dAtA[i:])
 		if err != nil {
 			return 0, err
 		}
@@ -6119,7 +6388,7 @@ func (m *DsLockUpdateResponse) MarshalTo(dAtA []byte) (int, error) {
 	return i, nil
 }
 
-func (m *UnlockRequest) Marshal() (dAtA []byte, err error) {
+func (m *LockResponse) Marshal() (dAtA []byte, err error) {
 	size := m.Size()
 	dAtA = make([]byte, size)
 	n, err := m.MarshalTo(dAtA)
@@ -6129,43 +6398,37 @@ func (m *UnlockRequest) Marshal() (dAtA []byte, err error) {
 	return dAtA[:n], nil
 }
 
-func (m *UnlockRequest) MarshalTo(dAtA []byte) (int, error) {
+func (m *LockResponse) MarshalTo(dAtA []byte) (int, error) {
 	var i int
 	_ = i
 	var l int
 	_ = l
-	if len(m.Key) > 0 {
-		dAtA[i] = 0xa
+	if m.Code != 0 {
+		dAtA[i] = 0x8
 		i++
-		i = encodeVarintKvrpcpb(dAtA, i, uint64(len(m.Key)))
-		i += copy(dAtA[i:], m.Key)
+		i = encodeVarintKvrpcpb(dAtA, i, uint64(m.Code))
 	}
-	if len(m.Id) > 0 {
-		dAtA[i] = 0x1a
+	if len(m.Error) > 0 {
+		dAtA[i] = 0x12
 		i++
-		i = encodeVarintKvrpcpb(dAtA, i, uint64(len(m.Id)))
-		i += copy(dAtA[i:], m.Id)
+		i = encodeVarintKvrpcpb(dAtA, i, uint64(len(m.Error)))
+		i += copy(dAtA[i:], m.Error)
 	}
-	if m.Timestamp != nil {
-		dAtA[i] = 0x52
+	if len(m.Value) > 0 {
+		dAtA[i] = 0x1a
 		i++
-		i = encodeVarintKvrpcpb(dAtA, i, uint64(m.Timestamp.Size()))
-		n92, err := m.Timestamp.MarshalTo(dAtA[i:])
-		if err != nil {
-			return 0, err
-		}
-		i += n92
+		i = encodeVarintKvrpcpb(dAtA, i, uint64(len(m.Value)))
+		i += copy(dAtA[i:], m.Value)
 	}
-	if len(m.By) > 0 {
-		dAtA[i] = 0x5a
+	if m.UpdateTime != 0 {
+		dAtA[i] = 0x20
 		i++
-		i = encodeVarintKvrpcpb(dAtA, i, uint64(len(m.By)))
-		i += copy(dAtA[i:], m.By)
+		i = encodeVarintKvrpcpb(dAtA, i, uint64(m.UpdateTime))
 	}
 	return i, nil
 }
 
-func (m *DsUnlockRequest) Marshal() (dAtA []byte, err error) {
+func (m *LockInfo) Marshal() (dAtA []byte, err error) {
 	size := m.Size()
 	dAtA = make([]byte, size)
 	n, err := m.MarshalTo(dAtA)
@@ -6175,35 +6438,31 @@ func (m *DsUnlockRequest) Marshal() (dAtA []byte, err error) {
 	return dAtA[:n], nil
 }
 
-func (m *DsUnlockRequest) MarshalTo(dAtA []byte) (int, error) {
+func (m *LockInfo) MarshalTo(dAtA []byte) (int, error) {
 	var i int
 	_ = i
 	var l int
 	_ = l
-	if m.Header != nil {
+	if len(m.Key) > 0 {
 		dAtA[i] = 0xa
 		i++
-		i = encodeVarintKvrpcpb(dAtA, i, uint64(m.Header.Size()))
-		n93, err := m.Header.MarshalTo(dAtA[i:])
-		if err != nil {
-			return 0, err
-		}
-		i += n93
+		i = encodeVarintKvrpcpb(dAtA, i, uint64(len(m.Key)))
+		i += copy(dAtA[i:], m.Key)
 	}
-	if m.Req != nil {
+	if m.Value != nil {
 		dAtA[i] = 0x12
 		i++
-		i = encodeVarintKvrpcpb(dAtA, i, uint64(m.Req.Size()))
-		n94, err := m.Req.MarshalTo(dAtA[i:])
+		i = encodeVarintKvrpcpb(dAtA, i, uint64(m.Value.Size()))
+		n92, err := m.Value.MarshalTo(dAtA[i:])
 		if err != nil {
 			return 0, err
 		}
-		i += n94
+		i += n92
 	}
 	return i, nil
 }
 
-func (m *DsUnlockResponse) Marshal() (dAtA []byte, err error) {
+func (m *LockScanResponse) Marshal() (dAtA []byte, err error) {
 	size := m.Size()
 	dAtA = make([]byte, size)
 	n, err := m.MarshalTo(dAtA)
@@ -6213,35 +6472,33 @@ func (m *DsUnlockResponse) Marshal() (dAtA []byte, err error) {
 	return dAtA[:n], nil
 }
 
-func (m *DsUnlockResponse) MarshalTo(dAtA []byte) (int, error) {
+func (m *LockScanResponse) MarshalTo(dAtA []byte) (int, error) {
 	var i int
 	_ = i
 	var l int
 	_ = l
-	if m.Header != nil {
-		dAtA[i] = 0xa
-		i++
-		i = encodeVarintKvrpcpb(dAtA, i, uint64(m.Header.Size()))
-		n95, err := m.Header.MarshalTo(dAtA[i:])
-		if err != nil {
-			return 0, err
+	if len(m.Info) > 0 {
+		for _, msg := range m.Info {
+			dAtA[i] = 0xa
+			i++
+			i = encodeVarintKvrpcpb(dAtA, i, uint64(msg.Size()))
+			n, err := msg.MarshalTo(dAtA[i:])
+			if err != nil {
+				return 0, err
+			}
+			i += n
 		}
-		i += n95
 	}
-	if m.Resp != nil {
+	if len(m.LastKey) > 0 {
 		dAtA[i] = 0x12
 		i++
-		i = encodeVarintKvrpcpb(dAtA, i, uint64(m.Resp.Size()))
-		n96, err := m.Resp.MarshalTo(dAtA[i:])
-		if err != nil {
-			return 0, err
-		}
-		i += n96
+		i = encodeVarintKvrpcpb(dAtA, i, uint64(len(m.LastKey)))
+		i += copy(dAtA[i:], m.LastKey)
 	}
 	return i, nil
 }
 
-func (m *UnlockForceRequest) Marshal() (dAtA []byte, err error) {
+func (m *DsLockResponse) Marshal() (dAtA []byte, err error) {
 	size := m.Size()
 	dAtA = make([]byte, size)
 	n, err := m.MarshalTo(dAtA)
@@ -6251,37 +6508,35 @@ func (m *UnlockForceRequest) Marshal() (dAtA []byte, err error) {
 	return dAtA[:n], nil
 }
 
-func (m *UnlockForceRequest) MarshalTo(dAtA []byte) (int, error) {
+func (m *DsLockResponse) MarshalTo(dAtA []byte) (int, error) {
 	var i int
 	_ = i
 	var l int
 	_ = l
-	if len(m.Key) > 0 {
+	if m.Header != nil {
 		dAtA[i] = 0xa
 		i++
-		i = encodeVarintKvrpcpb(dAtA, i, uint64(len(m.Key)))
-		i += copy(dAtA[i:], m.Key)
-	}
-	if m.Timestamp != nil {
-		dAtA[i] = 0x52
-		i++
-		i = encodeVarintKvrpcpb(dAtA, i, uint64(m.Timestamp.Size()))
-		n97, err := m.Timestamp.MarshalTo(dAtA[i:])
+		i = encodeVarintKvrpcpb(dAtA, i, uint64(m.Header.Size()))
+		n93, err := m.Header.MarshalTo(dAtA[i:])
 		if err != nil {
 			return 0, err
 		}
-		i += n97
+		i += n93
 	}
-	if len(m.By) > 0 {
-		dAtA[i] = 0x5a
+	if m.Resp != nil {
+		dAtA[i] = 0x12
 		i++
-		i = encodeVarintKvrpcpb(dAtA, i, uint64(len(m.By)))
-		i += copy(dAtA[i:], m.By)
+		i = encodeVarintKvrpcpb(dAtA, i, uint64(m.Resp.Size()))
+		n94, err := m.Resp.MarshalTo(dAtA[i:])
+		if err != nil {
+			return 0, err
+		}
+		i += n94
 	}
 	return i, nil
 }
 
-func (m *DsUnlockForceRequest) Marshal() (dAtA []byte, err error) {
+func (m *LockUpdateRequest) Marshal() (dAtA []byte, err error) {
 	size := m.Size()
 	dAtA = make([]byte, size)
 	n, err := m.MarshalTo(dAtA)
@@ -6291,7 +6546,58 @@ func (m *DsUnlockForceRequest) Marshal() (dAtA []byte, err error) {
 	return dAtA[:n], nil
 }
 
-func (m *DsUnlockForceRequest) MarshalTo(dAtA []byte) (int, error) {
+func (m *LockUpdateRequest) MarshalTo(dAtA []byte) (int, error) {
+	var i int
+	_ = i
+	var l int
+	_ = l
+	if len(m.Key) > 0 {
+		dAtA[i] = 0xa
+		i++
+		i = encodeVarintKvrpcpb(dAtA, i, uint64(len(m.Key)))
+		i += copy(dAtA[i:], m.Key)
+	}
+	if len(m.Id) > 0 {
+		dAtA[i] = 0x1a
+		i++
+		i = encodeVarintKvrpcpb(dAtA, i, uint64(len(m.Id)))
+		i += copy(dAtA[i:], m.Id)
+	}
+	if m.UpdateTime != 0 {
+		dAtA[i] = 0x28
+		i++
+		i = encodeVarintKvrpcpb(dAtA, i, uint64(m.UpdateTime))
+	}
+	if len(m.UpdateValue) > 0 {
+		dAtA[i] = 0x32
+		i++
+		i = encodeVarintKvrpcpb(dAtA, i, uint64(len(m.UpdateValue)))
+		i += copy(dAtA[i:], m.UpdateValue)
+	}
+	if m.Timestamp != nil {
+		dAtA[i] = 0x52
+		i++
+		i = encodeVarintKvrpcpb(dAtA, i, uint64(m.Timestamp.Size()))
+		n95, err := m.Timestamp.MarshalTo(dAtA[i:])
+		if err != nil {
+			return 0, err
+		}
+		i += n95
+	}
+	return i, nil
+}
+
+func (m *DsLockUpdateRequest) Marshal() (dAtA []byte, err error) {
+	size := m.Size()
+	dAtA = make([]byte, size)
+	n, err := m.MarshalTo(dAtA)
+	if err != nil {
+		return nil, err
+	}
+	return dAtA[:n], nil
+}
+
+func (m *DsLockUpdateRequest) MarshalTo(dAtA []byte) (int, error) {
 	var i int
 	_ = i
 	var l int
@@ -6300,26 +6606,26 @@ func (m *DsUnlockForceRequest) MarshalTo(dAtA []byte) (int, error) {
 		dAtA[i] = 0xa
 		i++
 		i = encodeVarintKvrpcpb(dAtA, i, uint64(m.Header.Size()))
-		n98, err := m.Header.MarshalTo(dAtA[i:])
+		n96, err := m.Header.MarshalTo(dAtA[i:])
 		if err != nil {
 			return 0, err
 		}
-		i += n98
+		i += n96
 	}
 	if m.Req != nil {
 		dAtA[i] = 0x12
 		i++
 		i = encodeVarintKvrpcpb(dAtA, i, uint64(m.Req.Size()))
-		n99, err := m.Req.MarshalTo(dAtA[i:])
+		n97, err := m.Req.MarshalTo(dAtA[i:])
 		if err != nil {
 			return 0, err
 		}
-		i += n99
+		i += n97
 	}
 	return i, nil
 }
 
-func (m *DsUnlockForceResponse) Marshal() (dAtA []byte, err error) {
+func (m *DsLockUpdateResponse) Marshal() (dAtA []byte, err error) {
 	size := m.Size()
 	dAtA = make([]byte, size)
 	n, err := m.MarshalTo(dAtA)
@@ -6329,7 +6635,7 @@ func (m *DsUnlockForceResponse) Marshal() (dAtA []byte, err error) {
 	return dAtA[:n], nil
 }
 
-func (m *DsUnlockForceResponse) MarshalTo(dAtA []byte) (int, error) {
+func (m *DsLockUpdateResponse) MarshalTo(dAtA []byte) (int, error) {
 	var i int
 	_ = i
 	var l int
@@ -6338,26 +6644,26 @@ func (m *DsUnlockForceResponse) MarshalTo(dAtA []byte) (int, error) {
 		dAtA[i] = 0xa
 		i++
 		i = encodeVarintKvrpcpb(dAtA, i, uint64(m.Header.Size()))
-		n100, err := m.Header.MarshalTo(dAtA[i:])
+		n98, err := m.Header.MarshalTo(dAtA[i:])
 		if err != nil {
 			return 0, err
 		}
-		i += n100
+		i += n98
 	}
 	if m.Resp != nil {
 		dAtA[i] = 0x12
 		i++
 		i = encodeVarintKvrpcpb(dAtA, i, uint64(m.Resp.Size()))
-		n101, err := m.Resp.MarshalTo(dAtA[i:])
+		n99, err := m.Resp.MarshalTo(dAtA[i:])
 		if err != nil {
 			return 0, err
 		}
-		i += n101
+		i += n99
 	}
 	return i, nil
 }
 
-func (m *LockScanRequest) Marshal() (dAtA []byte, err error) {
+func (m *UnlockRequest) Marshal() (dAtA []byte, err error) {
 	size := m.Size()
 	dAtA = make([]byte, size)
 	n, err := m.MarshalTo(dAtA)
@@ -6367,32 +6673,43 @@ func (m *LockScanRequest) Marshal() (dAtA []byte, err error) {
 	return dAtA[:n], nil
 }
 
-func (m *LockScanRequest) MarshalTo(dAtA []byte) (int, error) {
+func (m *UnlockRequest) MarshalTo(dAtA []byte) (int, error) {
 	var i int
 	_ = i
 	var l int
 	_ = l
-	if len(m.Start) > 0 {
+	if len(m.Key) > 0 {
 		dAtA[i] = 0xa
 		i++
-		i = encodeVarintKvrpcpb(dAtA, i, uint64(len(m.Start)))
-		i += copy(dAtA[i:], m.Start)
+		i = encodeVarintKvrpcpb(dAtA, i, uint64(len(m.Key)))
+		i += copy(dAtA[i:], m.Key)
 	}
-	if len(m.Limit) > 0 {
-		dAtA[i] = 0x12
+	if len(m.Id) > 0 {
+		dAtA[i] = 0x1a
 		i++
-		i = encodeVarintKvrpcpb(dAtA, i, uint64(len(m.Limit)))
-		i += copy(dAtA[i:], m.Limit)
+		i = encodeVarintKvrpcpb(dAtA, i, uint64(len(m.Id)))
+		i += copy(dAtA[i:], m.Id)
 	}
-	if m.Count != 0 {
-		dAtA[i] = 0x18
+	if m.Timestamp != nil {
+		dAtA[i] = 0x52
 		i++
-		i = encodeVarintKvrpcpb(dAtA, i, uint64(m.Count))
+		i = encodeVarintKvrpcpb(dAtA, i, uint64(m.Timestamp.Size()))
+		n100, err := m.Timestamp.MarshalTo(dAtA[i:])
+		if err != nil {
+			return 0, err
+		}
+		i += n100
+	}
+	if len(m.By) > 0 {
+		dAtA[i] = 0x5a
+		i++
+		i = encodeVarintKvrpcpb(dAtA, i, uint64(len(m.By)))
+		i += copy(dAtA[i:], m.By)
 	}
 	return i, nil
 }
 
-func (m *DsLockScanRequest) Marshal() (dAtA []byte, err error) {
+func (m *DsUnlockRequest) Marshal() (dAtA []byte, err error) {
 	size := m.Size()
 	dAtA = make([]byte, size)
 	n, err := m.MarshalTo(dAtA)
@@ -6402,7 +6719,7 @@ func (m *DsLockScanRequest) Marshal() (dAtA []byte, err error) {
 	return dAtA[:n], nil
 }
 
-func (m *DsLockScanRequest) MarshalTo(dAtA []byte) (int, error) {
+func (m *DsUnlockRequest) MarshalTo(dAtA []byte) (int, error) {
 	var i int
 	_ = i
 	var l int
@@ -6411,26 +6728,26 @@ func (m *DsLockScanRequest) MarshalTo(dAtA []byte) (int, error) {
 		dAtA[i] = 0xa
 		i++
 		i = encodeVarintKvrpcpb(dAtA, i, uint64(m.Header.Size()))
-		n102, err := m.Header.MarshalTo(dAtA[i:])
+		n101, err := m.Header.MarshalTo(dAtA[i:])
 		if err != nil {
 			return 0, err
 		}
-		i += n102
+		i += n101
 	}
 	if m.Req != nil {
 		dAtA[i] = 0x12
 		i++
 		i = encodeVarintKvrpcpb(dAtA, i, uint64(m.Req.Size()))
-		n103, err := m.Req.MarshalTo(dAtA[i:])
+		n102, err := m.Req.MarshalTo(dAtA[i:])
 		if err != nil {
 			return 0, err
 		}
-		i += n103
+		i += n102
 	}
 	return i, nil
 }
 
-func (m *DsLockScanResponse) Marshal() (dAtA []byte, err error) {
+func (m *DsUnlockResponse) Marshal() (dAtA []byte, err error) {
 	size := m.Size()
 	dAtA = make([]byte, size)
 	n, err := m.MarshalTo(dAtA)
@@ -6440,7 +6757,7 @@ func (m *DsLockScanResponse) Marshal() (dAtA []byte, err error) {
 	return dAtA[:n], nil
 }
 
-func (m *DsLockScanResponse) MarshalTo(dAtA []byte) (int, error) {
+func (m *DsUnlockResponse) MarshalTo(dAtA []byte) (int, error) {
 	var i int
 	_ = i
 	var l int
@@ -6449,131 +6766,358 @@ func (m *DsLockScanResponse) MarshalTo(dAtA []byte) (int, error) {
 		dAtA[i] = 0xa
 		i++
 		i = encodeVarintKvrpcpb(dAtA, i, uint64(m.Header.Size()))
-		n104, err := m.Header.MarshalTo(dAtA[i:])
+		n103, err := m.Header.MarshalTo(dAtA[i:])
 		if err != nil {
 			return 0, err
 		}
-		i += n104
+		i += n103
 	}
 	if m.Resp != nil {
 		dAtA[i] = 0x12
 		i++
 		i = encodeVarintKvrpcpb(dAtA, i, uint64(m.Resp.Size()))
-		n105, err := m.Resp.MarshalTo(dAtA[i:])
+		n104, err := m.Resp.MarshalTo(dAtA[i:])
 		if err != nil {
 			return 0, err
 		}
-		i += n105
+		i += n104
 	}
 	return i, nil
 }
 
-func encodeVarintKvrpcpb(dAtA []byte, offset int, v uint64) int {
-	for v >= 1<<7 {
-		dAtA[offset] = uint8(v&0x7f | 0x80)
-		v >>= 7
-		offset++
-	}
-	dAtA[offset] = uint8(v)
-	return offset + 1
-}
-func (m *KvPair) Size() (n int) {
-	var l int
-	_ = l
-	l = len(m.Key)
-	if l > 0 {
-		n += 1 + l + sovKvrpcpb(uint64(l))
-	}
-	l = len(m.Value)
-	if l > 0 {
-		n += 1 + l + sovKvrpcpb(uint64(l))
+func (m *UnlockForceRequest) Marshal() (dAtA []byte, err error) {
+	size := m.Size()
+	dAtA = make([]byte, size)
+	n, err := m.MarshalTo(dAtA)
+	if err != nil {
+		return nil, err
 	}
-	return n
+	return dAtA[:n], nil
 }
 
-func (m *RequestHeader) Size() (n int) {
+func (m *UnlockForceRequest) MarshalTo(dAtA []byte) (int, error) {
+	var i int
+	_ = i
 	var l int
 	_ = l
-	if m.ClusterId != 0 {
-		n += 1 + sovKvrpcpb(uint64(m.ClusterId))
+	if len(m.Key) > 0 {
+		dAtA[i] = 0xa
+		i++
+		i = encodeVarintKvrpcpb(dAtA, i, uint64(len(m.Key)))
+		i += copy(dAtA[i:], m.Key)
 	}
 	if m.Timestamp != nil {
-		l = m.Timestamp.Size()
-		n += 1 + l + sovKvrpcpb(uint64(l))
-	}
-	if m.TraceId != 0 {
-		n += 1 + sovKvrpcpb(uint64(m.TraceId))
-	}
-	if m.RangeId != 0 {
-		n += 1 + sovKvrpcpb(uint64(m.RangeId))
+		dAtA[i] = 0x52
+		i++
+		i = encodeVarintKvrpcpb(dAtA, i, uint64(m.Timestamp.Size()))
+		n105, err := m.Timestamp.MarshalTo(dAtA[i:])
+		if err != nil {
+			return 0, err
+		}
+		i += n105
 	}
-	if m.RangeEpoch != nil {
-		l = m.RangeEpoch.Size()
-		n += 1 + l + sovKvrpcpb(uint64(l))
+	if len(m.By) > 0 {
+		dAtA[i] = 0x5a
+		i++
+		i = encodeVarintKvrpcpb(dAtA, i, uint64(len(m.By)))
+		i += copy(dAtA[i:], m.By)
 	}
-	return n
+	return i, nil
 }
 
-func (m *ResponseHeader) Size() (n int) {
-	var l int
-	_ = l
-	if m.ClusterId != 0 {
-		n += 1 + sovKvrpcpb(uint64(m.ClusterId))
-	}
-	if m.Timestamp != nil {
-		l = m.Timestamp.Size()
-		n += 1 + l + sovKvrpcpb(uint64(l))
-	}
-	if m.TraceId != 0 {
-		n += 1 + sovKvrpcpb(uint64(m.TraceId))
-	}
-	if m.Now != nil {
-		l = m.Now.Size()
-		n += 1 + l + sovKvrpcpb(uint64(l))
-	}
-	if m.Error != nil {
-		l = m.Error.Size()
-		n += 1 + l + sovKvrpcpb(uint64(l))
+func (m *DsUnlockForceRequest) Marshal() (dAtA []byte, err error) {
+	size := m.Size()
+	dAtA = make([]byte, size)
+	n, err := m.MarshalTo(dAtA)
+	if err != nil {
+		return nil, err
 	}
-	return n
+	return dAtA[:n], nil
 }
 
-func (m *DsKvRawGetRequest) Size() (n int) {
+func (m *DsUnlockForceRequest) MarshalTo(dAtA []byte) (int, error) {
+	var i int
+	_ = i
 	var l int
 	_ = l
 	if m.Header != nil {
-		l = m.Header.Size()
-		n += 1 + l + sovKvrpcpb(uint64(l))
+		dAtA[i] = 0xa
+		i++
+		i = encodeVarintKvrpcpb(dAtA, i, uint64(m.Header.Size()))
+		n106, err := m.Header.MarshalTo(dAtA[i:])
+		if err != nil {
+			return 0, err
+		}
+		i += n106
 	}
 	if m.Req != nil {
-		l = m.Req.Size()
-		n += 1 + l + sovKvrpcpb(uint64(l))
+		dAtA[i] = 0x12
+		i++
+		i = encodeVarintKvrpcpb(dAtA, i, uint64(m.Req.Size()))
+		n107, err := m.Req.MarshalTo(dAtA[i:])
+		if err != nil {
+			return 0, err
+		}
+		i += n107
 	}
-	return n
+	return i, nil
 }
 
-func (m *DsKvRawGetResponse) Size() (n int) {
-	var l int
-	_ = l
-	if m.Header != nil {
-		l = m.Header.Size()
-		n += 1 + l + sovKvrpcpb(uint64(l))
-	}
-	if m.Resp != nil {
-		l = m.Resp.Size()
-		n += 1 + l + sovKvrpcpb(uint64(l))
+func (m *DsUnlockForceResponse) Marshal() (dAtA []byte, err error) {
+	size := m.Size()
+	dAtA = make([]byte, size)
+	n, err := m.MarshalTo(dAtA)
+	if err != nil {
+		return nil, err
 	}
-	return n
+	return dAtA[:n], nil
 }
 
-func (m *KvRawGetRequest) Size() (n int) {
+func (m *DsUnlockForceResponse) MarshalTo(dAtA []byte) (int, error) {
+	var i int
+	_ = i
 	var l int
 	_ = l
-	l = len(m.Key)
-	if l > 0 {
-		n += 1 + l + sovKvrpcpb(uint64(l))
-	}
-	return n
+	if m.Header != nil {
+		dAtA[i] = 0xa
+		i++
+		i = encodeVarintKvrpcpb(dAtA, i, uint64(m.Header.Size()))
+		n108, err := m.Header.MarshalTo(dAtA[i:])
+		if err != nil {
+			return 0, err
+		}
+		i += n108
+	}
+	if m.Resp != nil {
+		dAtA[i] = 0x12
+		i++
+		i = encodeVarintKvrpcpb(dAtA, i, uint64(m.Resp.Size()))
+		n109, err := m.Resp.MarshalTo(dAtA[i:])
+		if err != nil {
+			return 0, err
+		}
+		i += n109
+	}
+	return i, nil
+}
+
+func (m *LockScanRequest) Marshal() (dAtA []byte, err error) {
+	size := m.Size()
+	dAtA = make([]byte, size)
+	n, err := m.MarshalTo(dAtA)
+	if err != nil {
+		return nil, err
+	}
+	return dAtA[:n], nil
+}
+
+func (m *LockScanRequest) MarshalTo(dAtA []byte) (int, error) {
+	var i int
+	_ = i
+	var l int
+	_ = l
+	if len(m.Start) > 0 {
+		dAtA[i] = 0xa
+		i++
+		i = encodeVarintKvrpcpb(dAtA, i, uint64(len(m.Start)))
+		i += copy(dAtA[i:], m.Start)
+	}
+	if len(m.Limit) > 0 {
+		dAtA[i] = 0x12
+		i++
+		i = encodeVarintKvrpcpb(dAtA, i, uint64(len(m.Limit)))
+		i += copy(dAtA[i:], m.Limit)
+	}
+	if m.Count != 0 {
+		dAtA[i] = 0x18
+		i++
+		i = encodeVarintKvrpcpb(dAtA, i, uint64(m.Count))
+	}
+	return i, nil
+}
+
+func (m *DsLockScanRequest) Marshal() (dAtA []byte, err error) {
+	size := m.Size()
+	dAtA = make([]byte, size)
+	n, err := m.MarshalTo(dAtA)
+	if err != nil {
+		return nil, err
+	}
+	return dAtA[:n], nil
+}
+
+func (m *DsLockScanRequest) MarshalTo(dAtA []byte) (int, error) {
+	var i int
+	_ = i
+	var l int
+	_ = l
+	if m.Header != nil {
+		dAtA[i] = 0xa
+		i++
+		i = encodeVarintKvrpcpb(dAtA, i, uint64(m.Header.Size()))
+		n110, err := m.Header.MarshalTo(dAtA[i:])
+		if err != nil {
+			return 0, err
+		}
+		i += n110
+	}
+	if m.Req != nil {
+		dAtA[i] = 0x12
+		i++
+		i = encodeVarintKvrpcpb(dAtA, i, uint64(m.Req.Size()))
+		n111, err := m.Req.MarshalTo(dAtA[i:])
+		if err != nil {
+			return 0, err
+		}
+		i += n111
+	}
+	return i, nil
+}
+
+func (m *DsLockScanResponse) Marshal() (dAtA []byte, err error) {
+	size := m.Size()
+	dAtA = make([]byte, size)
+	n, err := m.MarshalTo(dAtA)
+	if err != nil {
+		return nil, err
+	}
+	return dAtA[:n], nil
+}
+
+func (m *DsLockScanResponse) MarshalTo(dAtA []byte) (int, error) {
+	var i int
+	_ = i
+	var l int
+	_ = l
+	if m.Header != nil {
+		dAtA[i] = 0xa
+		i++
+		i = encodeVarintKvrpcpb(dAtA, i, uint64(m.Header.Size()))
+		n112, err := m.Header.MarshalTo(dAtA[i:])
+		if err != nil {
+			return 0, err
+		}
+		i += n112
+	}
+	if m.Resp != nil {
+		dAtA[i] = 0x12
+		i++
+		i = encodeVarintKvrpcpb(dAtA, i, uint64(m.Resp.Size()))
+		n113, err := m.Resp.MarshalTo(dAtA[i:])
+		if err != nil {
+			return 0, err
+		}
+		i += n113
+	}
+	return i, nil
+}
+
+func encodeVarintKvrpcpb(dAtA []byte, offset int, v uint64) int {
+	for v >= 1<<7 {
+		dAtA[offset] = uint8(v&0x7f | 0x80)
+		v >>= 7
+		offset++
+	}
+	dAtA[offset] = uint8(v)
+	return offset + 1
+}
+func (m *KvPair) Size() (n int) {
+	var l int
+	_ = l
+	l = len(m.Key)
+	if l > 0 {
+		n += 1 + l + sovKvrpcpb(uint64(l))
+	}
+	l = len(m.Value)
+	if l > 0 {
+		n += 1 + l + sovKvrpcpb(uint64(l))
+	}
+	return n
+}
+
+func (m *RequestHeader) Size() (n int) {
+	var l int
+	_ = l
+	if m.ClusterId != 0 {
+		n += 1 + sovKvrpcpb(uint64(m.ClusterId))
+	}
+	if m.Timestamp != nil {
+		l = m.Timestamp.Size()
+		n += 1 + l + sovKvrpcpb(uint64(l))
+	}
+	if m.TraceId != 0 {
+		n += 1 + sovKvrpcpb(uint64(m.TraceId))
+	}
+	if m.RangeId != 0 {
+		n += 1 + sovKvrpcpb(uint64(m.RangeId))
+	}
+	if m.RangeEpoch != nil {
+		l = m.RangeEpoch.Size()
+		n += 1 + l + sovKvrpcpb(uint64(l))
+	}
+	return n
+}
+
+func (m *ResponseHeader) Size() (n int) {
+	var l int
+	_ = l
+	if m.ClusterId != 0 {
+		n += 1 + sovKvrpcpb(uint64(m.ClusterId))
+	}
+	if m.Timestamp != nil {
+		l = m.Timestamp.Size()
+		n += 1 + l + sovKvrpcpb(uint64(l))
+	}
+	if m.TraceId != 0 {
+		n += 1 + sovKvrpcpb(uint64(m.TraceId))
+	}
+	if m.Now != nil {
+		l = m.Now.Size()
+		n += 1 + l + sovKvrpcpb(uint64(l))
+	}
+	if m.Error != nil {
+		l = m.Error.Size()
+		n += 1 + l + sovKvrpcpb(uint64(l))
+	}
+	return n
+}
+
+func (m *DsKvRawGetRequest) Size() (n int) {
+	var l int
+	_ = l
+	if m.Header != nil {
+		l = m.Header.Size()
+		n += 1 + l + sovKvrpcpb(uint64(l))
+	}
+	if m.Req != nil {
+		l = m.Req.Size()
+		n += 1 + l + sovKvrpcpb(uint64(l))
+	}
+	return n
+}
+
+func (m *DsKvRawGetResponse) Size() (n int) {
+	var l int
+	_ = l
+	if m.Header != nil {
+		l = m.Header.Size()
+		n += 1 + l + sovKvrpcpb(uint64(l))
+	}
+	if m.Resp != nil {
+		l = m.Resp.Size()
+		n += 1 + l + sovKvrpcpb(uint64(l))
+	}
+	return n
+}
+
+func (m *KvRawGetRequest) Size() (n int) {
+	var l int
+	_ = l
+	l = len(m.Key)
+	if l > 0 {
+		n += 1 + l + sovKvrpcpb(uint64(l))
+	}
+	return n
 }
 
 func (m *KvRawGetResponse) Size() (n int) {
@@ -6860,6 +7404,12 @@ func (m *SelectRequest) Size() (n int) {
 		l = m.Timestamp.Size()
 		n += 1 + l + sovKvrpcpb(uint64(l))
 	}
+	if m.OpenSnapshot {
+		n += 2
+	}
+	if m.SnapshotId != 0 {
+		n += 1 + sovKvrpcpb(uint64(m.SnapshotId))
+	}
 	return n
 }
 
@@ -6913,6 +7463,9 @@ func (m *SelectResponse) Size() (n int) {
 	if m.Offset != 0 {
 		n += 1 + sovKvrpcpb(uint64(m.Offset))
 	}
+	if m.SnapshotId != 0 {
+		n += 1 + sovKvrpcpb(uint64(m.SnapshotId))
+	}
 	return n
 }
 
@@ -7375,6 +7928,12 @@ func (m *KvScanRequest) Size() (n int) {
 	if m.MaxCount != 0 {
 		n += 1 + sovKvrpcpb(uint64(m.MaxCount))
 	}
+	if m.OpenSnapshot {
+		n += 2
+	}
+	if m.SnapshotId != 0 {
+		n += 1 + sovKvrpcpb(uint64(m.SnapshotId))
+	}
 	return n
 }
 
@@ -7397,6 +7956,9 @@ func (m *KvScanResponse) Size() (n int) {
 	if l > 0 {
 		n += 1 + l + sovKvrpcpb(uint64(l))
 	}
+	if m.SnapshotId != 0 {
+		n += 1 + sovKvrpcpb(uint64(m.SnapshotId))
+	}
 	return n
 }
 
@@ -7600,36 +8162,137 @@ func (m *DsKvRangeDeleteResponse) Size() (n int) {
 	return n
 }
 
-func (m *LockValue) Size() (n int) {
+func (m *KvIncrRequest) Size() (n int) {
 	var l int
 	_ = l
-	l = len(m.Value)
-	if l > 0 {
-		n += 1 + l + sovKvrpcpb(uint64(l))
-	}
-	l = len(m.Id)
+	l = len(m.Key)
 	if l > 0 {
 		n += 1 + l + sovKvrpcpb(uint64(l))
 	}
-	if m.DeleteTime != 0 {
-		n += 1 + sovKvrpcpb(uint64(m.DeleteTime))
-	}
-	if m.UpdateTime != 0 {
-		n += 1 + sovKvrpcpb(uint64(m.UpdateTime))
-	}
-	if m.DeleteFlag {
-		n += 2
+	if m.Delta != 0 {
+		n += 1 + sovKvrpcpb(uint64(m.Delta))
 	}
 	return n
 }
 
-func (m *LockRequest) Size() (n int) {
+func (m *KvIncrResponse) Size() (n int) {
 	var l int
 	_ = l
-	l = len(m.Key)
-	if l > 0 {
-		n += 1 + l + sovKvrpcpb(uint64(l))
-	}
+	if m.Code != 0 {
+		n += 1 + sovKvrpcpb(uint64(m.Code))
+	}
+	return n
+}
+
+func (m *DsKvIncrRequest) Size() (n int) {
+	var l int
+	_ = l
+	if m.Header != nil {
+		l = m.Header.Size()
+		n += 1 + l + sovKvrpcpb(uint64(l))
+	}
+	if m.Req != nil {
+		l = m.Req.Size()
+		n += 1 + l + sovKvrpcpb(uint64(l))
+	}
+	return n
+}
+
+func (m *DsKvIncrResponse) Size() (n int) {
+	var l int
+	_ = l
+	if m.Header != nil {
+		l = m.Header.Size()
+		n += 1 + l + sovKvrpcpb(uint64(l))
+	}
+	if m.Resp != nil {
+		l = m.Resp.Size()
+		n += 1 + l + sovKvrpcpb(uint64(l))
+	}
+	return n
+}
+
+func (m *KvAppendRequest) Size() (n int) {
+	var l int
+	_ = l
+	l = len(m.Key)
+	if l > 0 {
+		n += 1 + l + sovKvrpcpb(uint64(l))
+	}
+	l = len(m.Value)
+	if l > 0 {
+		n += 1 + l + sovKvrpcpb(uint64(l))
+	}
+	return n
+}
+
+func (m *KvAppendResponse) Size() (n int) {
+	var l int
+	_ = l
+	if m.Code != 0 {
+		n += 1 + sovKvrpcpb(uint64(m.Code))
+	}
+	return n
+}
+
+func (m *DsKvAppendRequest) Size() (n int) {
+	var l int
+	_ = l
+	if m.Header != nil {
+		l = m.Header.Size()
+		n += 1 + l + sovKvrpcpb(uint64(l))
+	}
+	if m.Req != nil {
+		l = m.Req.Size()
+		n += 1 + l + sovKvrpcpb(uint64(l))
+	}
+	return n
+}
+
+func (m *DsKvAppendResponse) Size() (n int) {
+	var l int
+	_ = l
+	if m.Header != nil {
+		l = m.Header.Size()
+		n += 1 + l + sovKvrpcpb(uint64(l))
+	}
+	if m.Resp != nil {
+		l = m.Resp.Size()
+		n += 1 + l + sovKvrpcpb(uint64(l))
+	}
+	return n
+}
+
+func (m *LockValue) Size() (n int) {
+	var l int
+	_ = l
+	l = len(m.Value)
+	if l > 0 {
+		n += 1 + l + sovKvrpcpb(uint64(l))
+	}
+	l = len(m.Id)
+	if l > 0 {
+		n += 1 + l + sovKvrpcpb(uint64(l))
+	}
+	if m.DeleteTime != 0 {
+		n += 1 + sovKvrpcpb(uint64(m.DeleteTime))
+	}
+	if m.UpdateTime != 0 {
+		n += 1 + sovKvrpcpb(uint64(m.UpdateTime))
+	}
+	if m.DeleteFlag {
+		n += 2
+	}
+	return n
+}
+
+func (m *LockRequest) Size() (n int) {
+	var l int
+	_ = l
+	l = len(m.Key)
+	if l > 0 {
+		n += 1 + l + sovKvrpcpb(uint64(l))
+	}
 	if m.Value != nil {
 		l = m.Value.Size()
 		n += 1 + l + sovKvrpcpb(uint64(l))
@@ -7914,23 +8577,727 @@ func (m *DsLockScanResponse) Size() (n int) {
 		l = m.Resp.Size()
 		n += 1 + l + sovKvrpcpb(uint64(l))
 	}
-	return n
-}
+	return n
+}
+
+func sovKvrpcpb(x uint64) (n int) {
+	for {
+		n++
+		x >>= 7
+		if x == 0 {
+			break
+		}
+	}
+	return n
+}
+func sozKvrpcpb(x uint64) (n int) {
+	return sovKvrpcpb(uint64((x << 1) ^ uint64((int64(x) >> 63))))
+}
+func (m *KvPair) Unmarshal(dAtA []byte) error {
+	l := len(dAtA)
+	iNdEx := 0
+	for iNdEx < l {
+		preIndex := iNdEx
+		var wire uint64
+		for shift := uint(0); ; shift += 7 {
+			if shift >= 64 {
+				return ErrIntOverflowKvrpcpb
+			}
+			if iNdEx >= l {
+				return io.ErrUnexpectedEOF
+			}
+			b := dAtA[iNdEx]
+			iNdEx++
+			wire |= (uint64(b) & 0x7F) << shift
+			if b < 0x80 {
+				break
+			}
+		}
+		fieldNum := int32(wire >> 3)
+		wireType := int(wire & 0x7)
+		if wireType == 4 {
+			return fmt.Errorf("proto: KvPair: wiretype end group for non-group")
+		}
+		if fieldNum <= 0 {
+			return fmt.Errorf("proto: KvPair: illegal tag %d (wire type %d)", fieldNum, wire)
+		}
+		switch fieldNum {
+		case 1:
+			if wireType != 2 {
+				return fmt.Errorf("proto: wrong wireType = %d for field Key", wireType)
+			}
+			var byteLen int
+			for shift := uint(0); ; shift += 7 {
+				if shift >= 64 {
+					return ErrIntOverflowKvrpcpb
+				}
+				if iNdEx >= l {
+					return io.ErrUnexpectedEOF
+				}
+				b := dAtA[iNdEx]
+				iNdEx++
+				byteLen |= (int(b) & 0x7F) << shift
+				if b < 0x80 {
+					break
+				}
+			}
+			if byteLen < 0 {
+				return ErrInvalidLengthKvrpcpb
+			}
+			postIndex := iNdEx + byteLen
+			if postIndex > l {
+				return io.ErrUnexpectedEOF
+			}
+			m.Key = append(m.Key[:0], dAtA[iNdEx:postIndex]...)
+			if m.Key == nil {
+				m.Key = []byte{}
+			}
+			iNdEx = postIndex
+		case 2:
+			if wireType != 2 {
+				return fmt.Errorf("proto: wrong wireType = %d for field Value", wireType)
+			}
+			var byteLen int
+			for shift := uint(0); ; shift += 7 {
+				if shift >= 64 {
+					return ErrIntOverflowKvrpcpb
+				}
+				if iNdEx >= l {
+					return io.ErrUnexpectedEOF
+				}
+				b := dAtA[iNdEx]
+				iNdEx++
+				byteLen |= (int(b) & 0x7F) << shift
+				if b < 0x80 {
+					break
+				}
+			}
+			if byteLen < 0 {
+				return ErrInvalidLengthKvrpcpb
+			}
+			postIndex := iNdEx + byteLen
+			if postIndex > l {
+				return io.ErrUnexpectedEOF
+			}
+			m.Value = append(m.Value[:0], dAtA[iNdEx:postIndex]...)
+			if m.Value == nil {
+				m.Value = []byte{}
+			}
+			iNdEx = postIndex
+		default:
+			iNdEx = preIndex
+			skippy, err := skipKvrpcpb(dAtA[iNdEx:])
+			if err != nil {
+				return err
+			}
+			if skippy < 0 {
+				return ErrInvalidLengthKvrpcpb
+			}
+			if (iNdEx + skippy) > l {
+				return io.ErrUnexpectedEOF
+			}
+			iNdEx += skippy
+		}
+	}
+
+	if iNdEx > l {
+		return io.ErrUnexpectedEOF
+	}
+	return nil
+}
+func (m *RequestHeader) Unmarshal(dAtA []byte) error {
+	l := len(dAtA)
+	iNdEx := 0
+	for iNdEx < l {
+		preIndex := iNdEx
+		var wire uint64
+		for shift := uint(0); ; shift += 7 {
+			if shift >= 64 {
+				return ErrIntOverflowKvrpcpb
+			}
+			if iNdEx >= l {
+				return io.ErrUnexpectedEOF
+			}
+			b := dAtA[iNdEx]
+			iNdEx++
+			wire |= (uint64(b) & 0x7F) << shift
+			if b < 0x80 {
+				break
+			}
+		}
+		fieldNum := int32(wire >> 3)
+		wireType := int(wire & 0x7)
+		if wireType == 4 {
+			return fmt.Errorf("proto: RequestHeader: wiretype end group for non-group")
+		}
+		if fieldNum <= 0 {
+			return fmt.Errorf("proto: RequestHeader: illegal tag %d (wire type %d)", fieldNum, wire)
+		}
+		switch fieldNum {
+		case 1:
+			if wireType != 0 {
+				return fmt.Errorf("proto: wrong wireType = %d for field ClusterId", wireType)
+			}
+			m.ClusterId = 0
+			for shift := uint(0); ; shift += 7 {
+				if shift >= 64 {
+					return ErrIntOverflowKvrpcpb
+				}
+				if iNdEx >= l {
+					return io.ErrUnexpectedEOF
+				}
+				b := dAtA[iNdEx]
+				iNdEx++
+				m.ClusterId |= (uint64(b) & 0x7F) << shift
+				if b < 0x80 {
+					break
+				}
+			}
+		case 2:
+			if wireType != 2 {
+				return fmt.Errorf("proto: wrong wireType = %d for field Timestamp", wireType)
+			}
+			var msglen int
+			for shift := uint(0); ; shift += 7 {
+				if shift >= 64 {
+					return ErrIntOverflowKvrpcpb
+				}
+				if iNdEx >= l {
+					return io.ErrUnexpectedEOF
+				}
+				b := dAtA[iNdEx]
+				iNdEx++
+				msglen |= (int(b) & 0x7F) << shift
+				if b < 0x80 {
+					break
+				}
+			}
+			if msglen < 0 {
+				return ErrInvalidLengthKvrpcpb
+			}
+			postIndex := iNdEx + msglen
+			if postIndex > l {
+				return io.ErrUnexpectedEOF
+			}
+			if m.Timestamp == nil {
+				m.Timestamp = &timestamp.Timestamp{}
+			}
+			if err := m.Timestamp.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
+				return err
+			}
+			iNdEx = postIndex
+		case 3:
+			if wireType != 0 {
+				return fmt.Errorf("proto: wrong wireType = %d for field TraceId", wireType)
+			}
+			m.TraceId = 0
+			for shift := uint(0); ; shift += 7 {
+				if shift >= 64 {
+					return ErrIntOverflowKvrpcpb
+				}
+				if iNdEx >= l {
+					return io.ErrUnexpectedEOF
+				}
+				b := dAtA[iNdEx]
+				iNdEx++
+				m.TraceId |= (uint64(b) & 0x7F) << shift
+				if b < 0x80 {
+					break
+				}
+			}
+		case 4:
+			if wireType != 0 {
+				return fmt.Errorf("proto: wrong wireType = %d for field RangeId", wireType)
+			}
+			m.RangeId = 0
+			for shift := uint(0); ; shift += 7 {
+				if shift >= 64 {
+					return ErrIntOverflowKvrpcpb
+				}
+				if iNdEx >= l {
+					return io.ErrUnexpectedEOF
+				}
+				b := dAtA[iNdEx]
+				iNdEx++
+				m.RangeId |= (uint64(b) & 0x7F) << shift
+				if b < 0x80 {
+					break
+				}
+			}
+		case 5:
+			if wireType != 2 {
+				return fmt.Errorf("proto: wrong wireType = %d for field RangeEpoch", wireType)
+			}
+			var msglen int
+			for shift := uint(0); ; shift += 7 {
+				if shift >= 64 {
+					return ErrIntOverflowKvrpcpb
+				}
+				if iNdEx >= l {
+					return io.ErrUnexpectedEOF
+				}
+				b := dAtA[iNdEx]
+				iNdEx++
+				msglen |= (int(b) & 0x7F) << shift
+				if b < 0x80 {
+					break
+				}
+			}
+			if msglen < 0 {
+				return ErrInvalidLengthKvrpcpb
+			}
+			postIndex := iNdEx + msglen
+			if postIndex > l {
+				return io.ErrUnexpectedEOF
+			}
+			if m.RangeEpoch == nil {
+				m.RangeEpoch = &metapb.RangeEpoch{}
+			}
+			if err := m.RangeEpoch.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
+				return err
+			}
+			iNdEx = postIndex
+		default:
+			iNdEx = preIndex
+			skippy, err := skipKvrpcpb(dAtA[iNdEx:])
+			if err != nil {
+				return err
+			}
+			if skippy < 0 {
+				return ErrInvalidLengthKvrpcpb
+			}
+			if (iNdEx + skippy) > l {
+				return io.ErrUnexpectedEOF
+			}
+			iNdEx += skippy
+		}
+	}
+
+	if iNdEx > l {
+		return io.ErrUnexpectedEOF
+	}
+	return nil
+}
+func (m *ResponseHeader) Unmarshal(dAtA []byte) error {
+	l := len(dAtA)
+	iNdEx := 0
+	for iNdEx < l {
+		preIndex := iNdEx
+		var wire uint64
+		for shift := uint(0); ; shift += 7 {
+			if shift >= 64 {
+				return ErrIntOverflowKvrpcpb
+			}
+			if iNdEx >= l {
+				return io.ErrUnexpectedEOF
+			}
+			b := dAtA[iNdEx]
+			iNdEx++
+			wire |= (uint64(b) & 0x7F) << shift
+			if b < 0x80 {
+				break
+			}
+		}
+		fieldNum := int32(wire >> 3)
+		wireType := int(wire & 0x7)
+		if wireType == 4 {
+			return fmt.Errorf("proto: ResponseHeader: wiretype end group for non-group")
+		}
+		if fieldNum <= 0 {
+			return fmt.Errorf("proto: ResponseHeader: illegal tag %d (wire type %d)", fieldNum, wire)
+		}
+		switch fieldNum {
+		case 1:
+			if wireType != 0 {
+				return fmt.Errorf("proto: wrong wireType = %d for field ClusterId", wireType)
+			}
+			m.ClusterId = 0
+			for shift := uint(0); ; shift += 7 {
+				if shift >= 64 {
+					return ErrIntOverflowKvrpcpb
+				}
+				if iNdEx >= l {
+					return io.ErrUnexpectedEOF
+				}
+				b := dAtA[iNdEx]
+				iNdEx++
+				m.ClusterId |= (uint64(b) & 0x7F) << shift
+				if b < 0x80 {
+					break
+				}
+			}
+		case 2:
+			if wireType != 2 {
+				return fmt.Errorf("proto: wrong wireType = %d for field Timestamp", wireType)
+			}
+			var msglen int
+			for shift := uint(0); ; shift += 7 {
+				if shift >= 64 {
+					return ErrIntOverflowKvrpcpb
+				}
+				if iNdEx >= l {
+					return io.ErrUnexpectedEOF
+				}
+				b := dAtA[iNdEx]
+				iNdEx++
+				msglen |= (int(b) & 0x7F) << shift
+				if b < 0x80 {
+					break
+				}
+			}
+			if msglen < 0 {
+				return ErrInvalidLengthKvrpcpb
+			}
+			postIndex := iNdEx + msglen
+			if postIndex > l {
+				return io.ErrUnexpectedEOF
+			}
+			if m.Timestamp == nil {
+				m.Timestamp = &timestamp.Timestamp{}
+			}
+			if err := m.Timestamp.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
+				return err
+			}
+			iNdEx = postIndex
+		case 3:
+			if wireType != 0 {
+				return fmt.Errorf("proto: wrong wireType = %d for field TraceId", wireType)
+			}
+			m.TraceId = 0
+			for shift := uint(0); ; shift += 7 {
+				if shift >= 64 {
+					return ErrIntOverflowKvrpcpb
+				}
+				if iNdEx >= l {
+					return io.ErrUnexpectedEOF
+				}
+				b := dAtA[iNdEx]
+				iNdEx++
+				m.TraceId |= (uint64(b) & 0x7F) << shift
+				if b < 0x80 {
+					break
+				}
+			}
+		case 4:
+			if wireType != 2 {
+				return fmt.Errorf("proto: wrong wireType = %d for field Now", wireType)
+			}
+			var msglen int
+			for shift := uint(0); ; shift += 7 {
+				if shift >= 64 {
+					return ErrIntOverflowKvrpcpb
+				}
+				if iNdEx >= l {
+					return io.ErrUnexpectedEOF
+				}
+				b := dAtA[iNdEx]
+				iNdEx++
+				msglen |= (int(b) & 0x7F) << shift
+				if b < 0x80 {
+					break
+				}
+			}
+			if msglen < 0 {
+				return ErrInvalidLengthKvrpcpb
+			}
+			postIndex := iNdEx + msglen
+			if postIndex > l {
+				return io.ErrUnexpectedEOF
+			}
+			if m.Now == nil {
+				m.Now = &timestamp.Timestamp{}
+			}
+			if err := m.Now.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
+				return err
+			}
+			iNdEx = postIndex
+		case 5:
+			if wireType != 2 {
+				return fmt.Errorf("proto: wrong wireType = %d for field Error", wireType)
+			}
+			var msglen int
+			for shift := uint(0); ; shift += 7 {
+				if shift >= 64 {
+					return ErrIntOverflowKvrpcpb
+				}
+				if iNdEx >= l {
+					return io.ErrUnexpectedEOF
+				}
+				b := dAtA[iNdEx]
+				iNdEx++
+				msglen |= (int(b) & 0x7F) << shift
+				if b < 0x80 {
+					break
+				}
+			}
+			if msglen < 0 {
+				return ErrInvalidLengthKvrpcpb
+			}
+			postIndex := iNdEx + msglen
+			if postIndex > l {
+				return io.ErrUnexpectedEOF
+			}
+			if m.Error == nil {
+				m.Error = &errorpb.Error{}
+			}
+			if err := m.Error.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
+				return err
+			}
+			iNdEx = postIndex
+		default:
+			iNdEx = preIndex
+			skippy, err := skipKvrpcpb(dAtA[iNdEx:])
+			if err != nil {
+				return err
+			}
+			if skippy < 0 {
+				return ErrInvalidLengthKvrpcpb
+			}
+			if (iNdEx + skippy) > l {
+				return io.ErrUnexpectedEOF
+			}
+			iNdEx += skippy
+		}
+	}
+
+	if iNdEx > l {
+		return io.ErrUnexpectedEOF
+	}
+	return nil
+}
+func (m *DsKvRawGetRequest) Unmarshal(dAtA []byte) error {
+	l := len(dAtA)
+	iNdEx := 0
+	for iNdEx < l {
+		preIndex := iNdEx
+		var wire uint64
+		for shift := uint(0); ; shift += 7 {
+			if shift >= 64 {
+				return ErrIntOverflowKvrpcpb
+			}
+			if iNdEx >= l {
+				return io.ErrUnexpectedEOF
+			}
+			b := dAtA[iNdEx]
+			iNdEx++
+			wire |= (uint64(b) & 0x7F) << shift
+			if b < 0x80 {
+				break
+			}
+		}
+		fieldNum := int32(wire >> 3)
+		wireType := int(wire & 0x7)
+		if wireType == 4 {
+			return fmt.Errorf("proto: DsKvRawGetRequest: wiretype end group for non-group")
+		}
+		if fieldNum <= 0 {
+			return fmt.Errorf("proto: DsKvRawGetRequest: illegal tag %d (wire type %d)", fieldNum, wire)
+		}
+		switch fieldNum {
+		case 1:
+			if wireType != 2 {
+				return fmt.Errorf("proto: wrong wireType = %d for field Header", wireType)
+			}
+			var msglen int
+			for shift := uint(0); ; shift += 7 {
+				if shift >= 64 {
+					return ErrIntOverflowKvrpcpb
+				}
+				if iNdEx >= l {
+					return io.ErrUnexpectedEOF
+				}
+				b := dAtA[iNdEx]
+				iNdEx++
+				msglen |= (int(b) & 0x7F) << shift
+				if b < 0x80 {
+					break
+				}
+			}
+			if msglen < 0 {
+				return ErrInvalidLengthKvrpcpb
+			}
+			postIndex := iNdEx + msglen
+			if postIndex > l {
+				return io.ErrUnexpectedEOF
+			}
+			if m.Header == nil {
+				m.Header = &RequestHeader{}
+			}
+			if err := m.Header.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
+				return err
+			}
+			iNdEx = postIndex
+		case 2:
+			if wireType != 2 {
+				return fmt.Errorf("proto: wrong wireType = %d for field Req", wireType)
+			}
+			var msglen int
+			for shift := uint(0); ; shift += 7 {
+				if shift >= 64 {
+					return ErrIntOverflowKvrpcpb
+				}
+				if iNdEx >= l {
+					return io.ErrUnexpectedEOF
+				}
+				b := dAtA[iNdEx]
+				iNdEx++
+				msglen |= (int(b) & 0x7F) << shift
+				if b < 0x80 {
+					break
+				}
+			}
+			if msglen < 0 {
+				return ErrInvalidLengthKvrpcpb
+			}
+			postIndex := iNdEx + msglen
+			if postIndex > l {
+				return io.ErrUnexpectedEOF
+			}
+			if m.Req == nil {
+				m.Req = &KvRawGetRequest{}
+			}
+			if err := m.Req.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
+				return err
+			}
+			iNdEx = postIndex
+		default:
+			iNdEx = preIndex
+			skippy, err := skipKvrpcpb(dAtA[iNdEx:])
+			if err != nil {
+				return err
+			}
+			if skippy < 0 {
+				return ErrInvalidLengthKvrpcpb
+			}
+			if (iNdEx + skippy) > l {
+				return io.ErrUnexpectedEOF
+			}
+			iNdEx += skippy
+		}
+	}
+
+	if iNdEx > l {
+		return io.ErrUnexpectedEOF
+	}
+	return nil
+}
+func (m *DsKvRawGetResponse) Unmarshal(dAtA []byte) error {
+	l := len(dAtA)
+	iNdEx := 0
+	for iNdEx < l {
+		preIndex := iNdEx
+		var wire uint64
+		for shift := uint(0); ; shift += 7 {
+			if shift >= 64 {
+				return ErrIntOverflowKvrpcpb
+			}
+			if iNdEx >= l {
+				return io.ErrUnexpectedEOF
+			}
+			b := dAtA[iNdEx]
+			iNdEx++
+			wire |= (uint64(b) & 0x7F) << shift
+			if b < 0x80 {
+				break
+			}
+		}
+		fieldNum := int32(wire >> 3)
+		wireType := int(wire & 0x7)
+		if wireType == 4 {
+			return fmt.Errorf("proto: DsKvRawGetResponse: wiretype end group for non-group")
+		}
+		if fieldNum <= 0 {
+			return fmt.Errorf("proto: DsKvRawGetResponse: illegal tag %d (wire type %d)", fieldNum, wire)
+		}
+		switch fieldNum {
+		case 1:
+			if wireType != 2 {
+				return fmt.Errorf("proto: wrong wireType = %d for field Header", wireType)
+			}
+			var msglen int
+			for shift := uint(0); ; shift += 7 {
+				if shift >= 64 {
+					return ErrIntOverflowKvrpcpb
+				}
+				if iNdEx >= l {
+					return io.ErrUnexpectedEOF
+				}
+				b := dAtA[iNdEx]
+				iNdEx++
+				msglen |= (int(b) & 0x7F) << shift
+				if b < 0x80 {
+					break
+				}
+			}
+			if msglen < 0 {
+				return ErrInvalidLengthKvrpcpb
+			}
+			postIndex := iNdEx + msglen
+			if postIndex > l {
+				return io.ErrUnexpectedEOF
+			}
+			if m.Header == nil {
+				m.Header = &ResponseHeader{}
+			}
+			if err := m.Header.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
+				return err
+			}
+			iNdEx = postIndex
+		case 2:
+			if wireType != 2 {
+				return fmt.Errorf("proto: wrong wireType = %d for field Resp", wireType)
+			}
+			var msglen int
+			for shift := uint(0); ; shift += 7 {
+				if shift >= 64 {
+					return ErrIntOverflowKvrpcpb
+				}
+				if iNdEx >= l {
+					return io.ErrUnexpectedEOF
+				}
+				b := dAtA[iNdEx]
+				iNdEx++
+				msglen |= (int(b) & 0x7F) << shift
+				if b < 0x80 {
+					break
+				}
+			}
+			if msglen < 0 {
+				return ErrInvalidLengthKvrpcpb
+			}
+			postIndex := iNdEx + msglen
+			if postIndex > l {
+				return io.ErrUnexpectedEOF
+			}
+			if m.Resp == nil {
+				m.Resp = &KvRawGetResponse{}
+			}
+			if err := m.Resp.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
+				return err
+			}
+			iNdEx = postIndex
+		default:
+			iNdEx = preIndex
+			skippy, err := skipKvrpcpb(dAtA[iNdEx:])
+			if err != nil {
+				return err
+			}
+			if skippy < 0 {
+				return ErrInvalidLengthKvrpcpb
+			}
+			if (iNdEx + skippy) > l {
+				return io.ErrUnexpectedEOF
+			}
+			iNdEx += skippy
+		}
+	}
 
-func sovKvrpcpb(x uint64) (n int) {
-	for {
-		n++
-		x >>= 7
-		if x == 0 {
-			break
-		}
+	if iNdEx > l {
+		return io.ErrUnexpectedEOF
 	}
-	return n
-}
-func sozKvrpcpb(x uint64) (n int) {
-	return sovKvrpcpb(uint64((x << 1) ^ uint64((int64(x) >> 63))))
+	return nil
 }
-func (m *KvPair) Unmarshal(dAtA []byte) error {
+func (m *KvRawGetRequest) Unmarshal(dAtA []byte) error {
 	l := len(dAtA)
 	iNdEx := 0
 	for iNdEx < l {
@@ -7953,10 +9320,10 @@ func (m *KvPair) Unmarshal(dAtA []byte) error {
 		fieldNum := int32(wire >> 3)
 		wireType := int(wire & 0x7)
 		if wireType == 4 {
-			return fmt.Errorf("proto: KvPair: wiretype end group for non-group")
+			return fmt.Errorf("proto: KvRawGetRequest: wiretype end group for non-group")
 		}
 		if fieldNum <= 0 {
-			return fmt.Errorf("proto: KvPair: illegal tag %d (wire type %d)", fieldNum, wire)
+			return fmt.Errorf("proto: KvRawGetRequest: illegal tag %d (wire type %d)", fieldNum, wire)
 		}
 		switch fieldNum {
 		case 1:
@@ -7990,6 +9357,75 @@ func (m *KvPair) Unmarshal(dAtA []byte) error {
 				m.Key = []byte{}
 			}
 			iNdEx = postIndex
+		default:
+			iNdEx = preIndex
+			skippy, err := skipKvrpcpb(dAtA[iNdEx:])
+			if err != nil {
+				return err
+			}
+			if skippy < 0 {
+				return ErrInvalidLengthKvrpcpb
+			}
+			if (iNdEx + skippy) > l {
+				return io.ErrUnexpectedEOF
+			}
+			iNdEx += skippy
+		}
+	}
+
+	if iNdEx > l {
+		return io.ErrUnexpectedEOF
+	}
+	return nil
+}
+func (m *KvRawGetResponse) Unmarshal(dAtA []byte) error {
+	l := len(dAtA)
+	iNdEx := 0
+	for iNdEx < l {
+		preIndex := iNdEx
+		var wire uint64
+		for shift := uint(0); ; shift += 7 {
+			if shift >= 64 {
+				return ErrIntOverflowKvrpcpb
+			}
+			if iNdEx >= l {
+				return io.ErrUnexpectedEOF
+			}
+			b := dAtA[iNdEx]
+			iNdEx++
+			wire |= (uint64(b) & 0x7F) << shift
+			if b < 0x80 {
+				break
+			}
+		}
+		fieldNum := int32(wire >> 3)
+		wireType := int(wire & 0x7)
+		if wireType == 4 {
+			return fmt.Errorf("proto: KvRawGetResponse: wiretype end group for non-group")
+		}
+		if fieldNum <= 0 {
+			return fmt.Errorf("proto: KvRawGetResponse: illegal tag %d (wire type %d)", fieldNum, wire)
+		}
+		switch fieldNum {
+		case 1:
+			if wireType != 0 {
+				return fmt.Errorf("proto: wrong wireType = %d for field Code", wireType)
+			}
+			m.Code = 0
+			for shift := uint(0); ; shift += 7 {
+				if shift >= 64 {
+					return ErrIntOverflowKvrpcpb
+				}
+				if iNdEx >= l {
+					return io.ErrUnexpectedEOF
+				}
+				b := dAtA[iNdEx]
+				iNdEx++
+				m.Code |= (int32(b) & 0x7F) << shift
+				if b < 0x80 {
+					break
+				}
+			}
 		case 2:
 			if wireType != 2 {
 				return fmt.Errorf("proto: wrong wireType = %d for field Value", wireType)
@@ -8042,7 +9478,7 @@ func (m *KvPair) Unmarshal(dAtA []byte) error {
 	}
 	return nil
 }
-func (m *RequestHeader) Unmarshal(dAtA []byte) error {
+func (m *DsKvRawPutRequest) Unmarshal(dAtA []byte) error {
 	l := len(dAtA)
 	iNdEx := 0
 	for iNdEx < l {
@@ -8065,17 +9501,17 @@ func (m *RequestHeader) Unmarshal(dAtA []byte) error {
 		fieldNum := int32(wire >> 3)
 		wireType := int(wire & 0x7)
 		if wireType == 4 {
-			return fmt.Errorf("proto: RequestHeader: wiretype end group for non-group")
+			return fmt.Errorf("proto: DsKvRawPutRequest: wiretype end group for non-group")
 		}
 		if fieldNum <= 0 {
-			return fmt.Errorf("proto: RequestHeader: illegal tag %d (wire type %d)", fieldNum, wire)
+			return fmt.Errorf("proto: DsKvRawPutRequest: illegal tag %d (wire type %d)", fieldNum, wire)
 		}
 		switch fieldNum {
 		case 1:
-			if wireType != 0 {
-				return fmt.Errorf("proto: wrong wireType = %d for field ClusterId", wireType)
+			if wireType != 2 {
+				return fmt.Errorf("proto: wrong wireType = %d for field Header", wireType)
 			}
-			m.ClusterId = 0
+			var msglen int
 			for shift := uint(0); ; shift += 7 {
 				if shift >= 64 {
 					return ErrIntOverflowKvrpcpb
@@ -8085,14 +9521,28 @@ func (m *RequestHeader) Unmarshal(dAtA []byte) error {
 				}
 				b := dAtA[iNdEx]
 				iNdEx++
-				m.ClusterId |= (uint64(b) & 0x7F) << shift
+				msglen |= (int(b) & 0x7F) << shift
 				if b < 0x80 {
 					break
 				}
 			}
+			if msglen < 0 {
+				return ErrInvalidLengthKvrpcpb
+			}
+			postIndex := iNdEx + msglen
+			if postIndex > l {
+				return io.ErrUnexpectedEOF
+			}
+			if m.Header == nil {
+				m.Header = &RequestHeader{}
+			}
+			if err := m.Header.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
+				return err
+			}
+			iNdEx = postIndex
 		case 2:
 			if wireType != 2 {
-				return fmt.Errorf("proto: wrong wireType = %d for field Timestamp", wireType)
+				return fmt.Errorf("proto: wrong wireType = %d for field Req", wireType)
 			}
 			var msglen int
 			for shift := uint(0); ; shift += 7 {
@@ -8116,37 +9566,68 @@ func (m *RequestHeader) Unmarshal(dAtA []byte) error {
 			if postIndex > l {
 				return io.ErrUnexpectedEOF
 			}
-			if m.Timestamp == nil {
-				m.Timestamp = &timestamp.Timestamp{}
+			if m.Req == nil {
+				m.Req = &KvRawPutRequest{}
 			}
-			if err := m.Timestamp.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
+			if err := m.Req.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
 				return err
 			}
 			iNdEx = postIndex
-		case 3:
-			if wireType != 0 {
-				return fmt.Errorf("proto: wrong wireType = %d for field TraceId", wireType)
+		default:
+			iNdEx = preIndex
+			skippy, err := skipKvrpcpb(dAtA[iNdEx:])
+			if err != nil {
+				return err
 			}
-			m.TraceId = 0
-			for shift := uint(0); ; shift += 7 {
-				if shift >= 64 {
-					return ErrIntOverflowKvrpcpb
-				}
-				if iNdEx >= l {
-					return io.ErrUnexpectedEOF
-				}
-				b := dAtA[iNdEx]
-				iNdEx++
-				m.TraceId |= (uint64(b) & 0x7F) << shift
-				if b < 0x80 {
-					break
-				}
+			if skippy < 0 {
+				return ErrInvalidLengthKvrpcpb
 			}
-		case 4:
-			if wireType != 0 {
-				return fmt.Errorf("proto: wrong wireType = %d for field RangeId", wireType)
+			if (iNdEx + skippy) > l {
+				return io.ErrUnexpectedEOF
 			}
-			m.RangeId = 0
+			iNdEx += skippy
+		}
+	}
+
+	if iNdEx > l {
+		return io.ErrUnexpectedEOF
+	}
+	return nil
+}
+func (m *DsKvRawPutResponse) Unmarshal(dAtA []byte) error {
+	l := len(dAtA)
+	iNdEx := 0
+	for iNdEx < l {
+		preIndex := iNdEx
+		var wire uint64
+		for shift := uint(0); ; shift += 7 {
+			if shift >= 64 {
+				return ErrIntOverflowKvrpcpb
+			}
+			if iNdEx >= l {
+				return io.ErrUnexpectedEOF
+			}
+			b := dAtA[iNdEx]
+			iNdEx++
+			wire |= (uint64(b) & 0x7F) << shift
+			if b < 0x80 {
+				break
+			}
+		}
+		fieldNum := int32(wire >> 3)
+		wireType := int(wire & 0x7)
+		if wireType == 4 {
+			return fmt.Errorf("proto: DsKvRawPutResponse: wiretype end group for non-group")
+		}
+		if fieldNum <= 0 {
+			return fmt.Errorf("proto: DsKvRawPutResponse: illegal tag %d (wire type %d)", fieldNum, wire)
+		}
+		switch fieldNum {
+		case 1:
+			if wireType != 2 {
+				return fmt.Errorf("proto: wrong wireType = %d for field Header", wireType)
+			}
+			var msglen int
 			for shift := uint(0); ; shift += 7 {
 				if shift >= 64 {
 					return ErrIntOverflowKvrpcpb
@@ -8156,14 +9637,28 @@ func (m *RequestHeader) Unmarshal(dAtA []byte) error {
 				}
 				b := dAtA[iNdEx]
 				iNdEx++
-				m.RangeId |= (uint64(b) & 0x7F) << shift
+				msglen |= (int(b) & 0x7F) << shift
 				if b < 0x80 {
 					break
 				}
 			}
-		case 5:
+			if msglen < 0 {
+				return ErrInvalidLengthKvrpcpb
+			}
+			postIndex := iNdEx + msglen
+			if postIndex > l {
+				return io.ErrUnexpectedEOF
+			}
+			if m.Header == nil {
+				m.Header = &ResponseHeader{}
+			}
+			if err := m.Header.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
+				return err
+			}
+			iNdEx = postIndex
+		case 2:
 			if wireType != 2 {
-				return fmt.Errorf("proto: wrong wireType = %d for field RangeEpoch", wireType)
+				return fmt.Errorf("proto: wrong wireType = %d for field Resp", wireType)
 			}
 			var msglen int
 			for shift := uint(0); ; shift += 7 {
@@ -8187,10 +9682,10 @@ func (m *RequestHeader) Unmarshal(dAtA []byte) error {
 			if postIndex > l {
 				return io.ErrUnexpectedEOF
 			}
-			if m.RangeEpoch == nil {
-				m.RangeEpoch = &metapb.RangeEpoch{}
+			if m.Resp == nil {
+				m.Resp = &KvRawPutResponse{}
 			}
-			if err := m.RangeEpoch.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
+			if err := m.Resp.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
 				return err
 			}
 			iNdEx = postIndex
@@ -8215,7 +9710,7 @@ func (m *RequestHeader) Unmarshal(dAtA []byte) error {
 	}
 	return nil
 }
-func (m *ResponseHeader) Unmarshal(dAtA []byte) error {
+func (m *KvRawPutRequest) Unmarshal(dAtA []byte) error {
 	l := len(dAtA)
 	iNdEx := 0
 	for iNdEx < l {
@@ -8238,36 +9733,17 @@ func (m *ResponseHeader) Unmarshal(dAtA []byte) error {
 		fieldNum := int32(wire >> 3)
 		wireType := int(wire & 0x7)
 		if wireType == 4 {
-			return fmt.Errorf("proto: ResponseHeader: wiretype end group for non-group")
+			return fmt.Errorf("proto: KvRawPutRequest: wiretype end group for non-group")
 		}
 		if fieldNum <= 0 {
-			return fmt.Errorf("proto: ResponseHeader: illegal tag %d (wire type %d)", fieldNum, wire)
+			return fmt.Errorf("proto: KvRawPutRequest: illegal tag %d (wire type %d)", fieldNum, wire)
 		}
 		switch fieldNum {
 		case 1:
-			if wireType != 0 {
-				return fmt.Errorf("proto: wrong wireType = %d for field ClusterId", wireType)
-			}
-			m.ClusterId = 0
-			for shift := uint(0); ; shift += 7 {
-				if shift >= 64 {
-					return ErrIntOverflowKvrpcpb
-				}
-				if iNdEx >= l {
-					return io.ErrUnexpectedEOF
-				}
-				b := dAtA[iNdEx]
-				iNdEx++
-				m.ClusterId |= (uint64(b) & 0x7F) << shift
-				if b < 0x80 {
-					break
-				}
-			}
-		case 2:
 			if wireType != 2 {
-				return fmt.Errorf("proto: wrong wireType = %d for field Timestamp", wireType)
+				return fmt.Errorf("proto: wrong wireType = %d for field Key", wireType)
 			}
-			var msglen int
+			var byteLen int
 			for shift := uint(0); ; shift += 7 {
 				if shift >= 64 {
 					return ErrIntOverflowKvrpcpb
@@ -8277,49 +9753,28 @@ func (m *ResponseHeader) Unmarshal(dAtA []byte) error {
 				}
 				b := dAtA[iNdEx]
 				iNdEx++
-				msglen |= (int(b) & 0x7F) << shift
+				byteLen |= (int(b) & 0x7F) << shift
 				if b < 0x80 {
 					break
 				}
 			}
-			if msglen < 0 {
+			if byteLen < 0 {
 				return ErrInvalidLengthKvrpcpb
 			}
-			postIndex := iNdEx + msglen
+			postIndex := iNdEx + byteLen
 			if postIndex > l {
 				return io.ErrUnexpectedEOF
 			}
-			if m.Timestamp == nil {
-				m.Timestamp = &timestamp.Timestamp{}
-			}
-			if err := m.Timestamp.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
-				return err
+			m.Key = append(m.Key[:0], dAtA[iNdEx:postIndex]...)
+			if m.Key == nil {
+				m.Key = []byte{}
 			}
 			iNdEx = postIndex
-		case 3:
-			if wireType != 0 {
-				return fmt.Errorf("proto: wrong wireType = %d for field TraceId", wireType)
-			}
-			m.TraceId = 0
-			for shift := uint(0); ; shift += 7 {
-				if shift >= 64 {
-					return ErrIntOverflowKvrpcpb
-				}
-				if iNdEx >= l {
-					return io.ErrUnexpectedEOF
-				}
-				b := dAtA[iNdEx]
-				iNdEx++
-				m.TraceId |= (uint64(b) & 0x7F) << shift
-				if b < 0x80 {
-					break
-				}
-			}
-		case 4:
+		case 2:
 			if wireType != 2 {
-				return fmt.Errorf("proto: wrong wireType = %d for field Now", wireType)
+				return fmt.Errorf("proto: wrong wireType = %d for field Value", wireType)
 			}
-			var msglen int
+			var byteLen int
 			for shift := uint(0); ; shift += 7 {
 				if shift >= 64 {
 					return ErrIntOverflowKvrpcpb
@@ -8329,30 +9784,78 @@ func (m *ResponseHeader) Unmarshal(dAtA []byte) error {
 				}
 				b := dAtA[iNdEx]
 				iNdEx++
-				msglen |= (int(b) & 0x7F) << shift
+				byteLen |= (int(b) & 0x7F) << shift
 				if b < 0x80 {
 					break
 				}
 			}
-			if msglen < 0 {
+			if byteLen < 0 {
 				return ErrInvalidLengthKvrpcpb
 			}
-			postIndex := iNdEx + msglen
+			postIndex := iNdEx + byteLen
 			if postIndex > l {
 				return io.ErrUnexpectedEOF
 			}
-			if m.Now == nil {
-				m.Now = &timestamp.Timestamp{}
+			m.Value = append(m.Value[:0], dAtA[iNdEx:postIndex]...)
+			if m.Value == nil {
+				m.Value = []byte{}
 			}
-			if err := m.Now.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
+			iNdEx = postIndex
+		default:
+			iNdEx = preIndex
+			skippy, err := skipKvrpcpb(dAtA[iNdEx:])
+			if err != nil {
 				return err
 			}
-			iNdEx = postIndex
-		case 5:
-			if wireType != 2 {
-				return fmt.Errorf("proto: wrong wireType = %d for field Error", wireType)
+			if skippy < 0 {
+				return ErrInvalidLengthKvrpcpb
 			}
-			var msglen int
+			if (iNdEx + skippy) > l {
+				return io.ErrUnexpectedEOF
+			}
+			iNdEx += skippy
+		}
+	}
+
+	if iNdEx > l {
+		return io.ErrUnexpectedEOF
+	}
+	return nil
+}
+func (m *KvRawPutResponse) Unmarshal(dAtA []byte) error {
+	l := len(dAtA)
+	iNdEx := 0
+	for iNdEx < l {
+		preIndex := iNdEx
+		var wire uint64
+		for shift := uint(0); ; shift += 7 {
+			if shift >= 64 {
+				return ErrIntOverflowKvrpcpb
+			}
+			if iNdEx >= l {
+				return io.ErrUnexpectedEOF
+			}
+			b := dAtA[iNdEx]
+			iNdEx++
+			wire |= (uint64(b) & 0x7F) << shift
+			if b < 0x80 {
+				break
+			}
+		}
+		fieldNum := int32(wire >> 3)
+		wireType := int(wire & 0x7)
+		if wireType == 4 {
+			return fmt.Errorf("proto: KvRawPutResponse: wiretype end group for non-group")
+		}
+		if fieldNum <= 0 {
+			return fmt.Errorf("proto: KvRawPutResponse: illegal tag %d (wire type %d)", fieldNum, wire)
+		}
+		switch fieldNum {
+		case 1:
+			if wireType != 0 {
+				return fmt.Errorf("proto: wrong wireType = %d for field Code", wireType)
+			}
+			m.Code = 0
 			for shift := uint(0); ; shift += 7 {
 				if shift >= 64 {
 					return ErrIntOverflowKvrpcpb
@@ -8362,25 +9865,11 @@ func (m *ResponseHeader) Unmarshal(dAtA []byte) error {
 				}
 				b := dAtA[iNdEx]
 				iNdEx++
-				msglen |= (int(b) & 0x7F) << shift
+				m.Code |= (int32(b) & 0x7F) << shift
 				if b < 0x80 {
 					break
 				}
 			}
-			if msglen < 0 {
-				return ErrInvalidLengthKvrpcpb
-			}
-			postIndex := iNdEx + msglen
-			if postIndex > l {
-				return io.ErrUnexpectedEOF
-			}
-			if m.Error == nil {
-				m.Error = &errorpb.Error{}
-			}
-			if err := m.Error.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
-				return err
-			}
-			iNdEx = postIndex
 		default:
 			iNdEx = preIndex
 			skippy, err := skipKvrpcpb(dAtA[iNdEx:])
@@ -8402,7 +9891,7 @@ func (m *ResponseHeader) Unmarshal(dAtA []byte) error {
 	}
 	return nil
 }
-func (m *DsKvRawGetRequest) Unmarshal(dAtA []byte) error {
+func (m *DsKvRawDeleteRequest) Unmarshal(dAtA []byte) error {
 	l := len(dAtA)
 	iNdEx := 0
 	for iNdEx < l {
@@ -8425,10 +9914,10 @@ func (m *DsKvRawGetRequest) Unmarshal(dAtA []byte) error {
 		fieldNum := int32(wire >> 3)
 		wireType := int(wire & 0x7)
 		if wireType == 4 {
-			return fmt.Errorf("proto: DsKvRawGetRequest: wiretype end group for non-group")
+			return fmt.Errorf("proto: DsKvRawDeleteRequest: wiretype end group for non-group")
 		}
 		if fieldNum <= 0 {
-			return fmt.Errorf("proto: DsKvRawGetRequest: illegal tag %d (wire type %d)", fieldNum, wire)
+			return fmt.Errorf("proto: DsKvRawDeleteRequest: illegal tag %d (wire type %d)", fieldNum, wire)
 		}
 		switch fieldNum {
 		case 1:
@@ -8491,7 +9980,7 @@ func (m *DsKvRawGetRequest) Unmarshal(dAtA []byte) error {
 				return io.ErrUnexpectedEOF
 			}
 			if m.Req == nil {
-				m.Req = &KvRawGetRequest{}
+				m.Req = &KvRawDeleteRequest{}
 			}
 			if err := m.Req.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
 				return err
@@ -8518,7 +10007,7 @@ func (m *DsKvRawGetRequest) Unmarshal(dAtA []byte) error {
 	}
 	return nil
 }
-func (m *DsKvRawGetResponse) Unmarshal(dAtA []byte) error {
+func (m *DsKvRawDeleteResponse) Unmarshal(dAtA []byte) error {
 	l := len(dAtA)
 	iNdEx := 0
 	for iNdEx < l {
@@ -8541,10 +10030,10 @@ func (m *DsKvRawGetResponse) Unmarshal(dAtA []byte) error {
 		fieldNum := int32(wire >> 3)
 		wireType := int(wire & 0x7)
 		if wireType == 4 {
-			return fmt.Errorf("proto: DsKvRawGetResponse: wiretype end group for non-group")
+			return fmt.Errorf("proto: DsKvRawDeleteResponse: wiretype end group for non-group")
 		}
 		if fieldNum <= 0 {
-			return fmt.Errorf("proto: DsKvRawGetResponse: illegal tag %d (wire type %d)", fieldNum, wire)
+			return fmt.Errorf("proto: DsKvRawDeleteResponse: illegal tag %d (wire type %d)", fieldNum, wire)
 		}
 		switch fieldNum {
 		case 1:
@@ -8607,7 +10096,7 @@ func (m *DsKvRawGetResponse) Unmarshal(dAtA []byte) error {
 				return io.ErrUnexpectedEOF
 			}
 			if m.Resp == nil {
-				m.Resp = &KvRawGetResponse{}
+				m.Resp = &KvRawDeleteResponse{}
 			}
 			if err := m.Resp.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
 				return err
@@ -8634,7 +10123,7 @@ func (m *DsKvRawGetResponse) Unmarshal(dAtA []byte) error {
 	}
 	return nil
 }
-func (m *KvRawGetRequest) Unmarshal(dAtA []byte) error {
+func (m *KvRawDeleteRequest) Unmarshal(dAtA []byte) error {
 	l := len(dAtA)
 	iNdEx := 0
 	for iNdEx < l {
@@ -8657,10 +10146,10 @@ func (m *KvRawGetRequest) Unmarshal(dAtA []byte) error {
 		fieldNum := int32(wire >> 3)
 		wireType := int(wire & 0x7)
 		if wireType == 4 {
-			return fmt.Errorf("proto: KvRawGetRequest: wiretype end group for non-group")
+			return fmt.Errorf("proto: KvRawDeleteRequest: wiretype end group for non-group")
 		}
 		if fieldNum <= 0 {
-			return fmt.Errorf("proto: KvRawGetRequest: illegal tag %d (wire type %d)", fieldNum, wire)
+			return fmt.Errorf("proto: KvRawDeleteRequest: illegal tag %d (wire type %d)", fieldNum, wire)
 		}
 		switch fieldNum {
 		case 1:
@@ -8715,7 +10204,7 @@ func (m *KvRawGetRequest) Unmarshal(dAtA []byte) error {
 	}
 	return nil
 }
-func (m *KvRawGetResponse) Unmarshal(dAtA []byte) error {
+func (m *KvRawDeleteResponse) Unmarshal(dAtA []byte) error {
 	l := len(dAtA)
 	iNdEx := 0
 	for iNdEx < l {
@@ -8738,17 +10227,86 @@ func (m *KvRawGetResponse) Unmarshal(dAtA []byte) error {
 		fieldNum := int32(wire >> 3)
 		wireType := int(wire & 0x7)
 		if wireType == 4 {
-			return fmt.Errorf("proto: KvRawGetResponse: wiretype end group for non-group")
+			return fmt.Errorf("proto: KvRawDeleteResponse: wiretype end group for non-group")
+		}
+		if fieldNum <= 0 {
+			return fmt.Errorf("proto: KvRawDeleteResponse: illegal tag %d (wire type %d)", fieldNum, wire)
+		}
+		switch fieldNum {
+		case 1:
+			if wireType != 0 {
+				return fmt.Errorf("proto: wrong wireType = %d for field Code", wireType)
+			}
+			m.Code = 0
+			for shift := uint(0); ; shift += 7 {
+				if shift >= 64 {
+					return ErrIntOverflowKvrpcpb
+				}
+				if iNdEx >= l {
+					return io.ErrUnexpectedEOF
+				}
+				b := dAtA[iNdEx]
+				iNdEx++
+				m.Code |= (int32(b) & 0x7F) << shift
+				if b < 0x80 {
+					break
+				}
+			}
+		default:
+			iNdEx = preIndex
+			skippy, err := skipKvrpcpb(dAtA[iNdEx:])
+			if err != nil {
+				return err
+			}
+			if skippy < 0 {
+				return ErrInvalidLengthKvrpcpb
+			}
+			if (iNdEx + skippy) > l {
+				return io.ErrUnexpectedEOF
+			}
+			iNdEx += skippy
+		}
+	}
+
+	if iNdEx > l {
+		return io.ErrUnexpectedEOF
+	}
+	return nil
+}
+func (m *KvPairRawExecute) Unmarshal(dAtA []byte) error {
+	l := len(dAtA)
+	iNdEx := 0
+	for iNdEx < l {
+		preIndex := iNdEx
+		var wire uint64
+		for shift := uint(0); ; shift += 7 {
+			if shift >= 64 {
+				return ErrIntOverflowKvrpcpb
+			}
+			if iNdEx >= l {
+				return io.ErrUnexpectedEOF
+			}
+			b := dAtA[iNdEx]
+			iNdEx++
+			wire |= (uint64(b) & 0x7F) << shift
+			if b < 0x80 {
+				break
+			}
+		}
+		fieldNum := int32(wire >> 3)
+		wireType := int(wire & 0x7)
+		if wireType == 4 {
+			return fmt.Errorf("proto: KvPairRawExecute: wiretype end group for non-group")
 		}
 		if fieldNum <= 0 {
-			return fmt.Errorf("proto: KvRawGetResponse: illegal tag %d (wire type %d)", fieldNum, wire)
+			return fmt.Errorf("proto: KvPairRawExecute: illegal tag %d (wire type %d)", fieldNum, wire)
 		}
 		switch fieldNum {
 		case 1:
 			if wireType != 0 {
-				return fmt.Errorf("proto: wrong wireType = %d for field Code", wireType)
+				return fmt.Errorf("proto: wrong wireType = %d for field Do", wireType)
 			}
-			m.Code = 0
+			m.Do = 0
 			for shift := uint(0); ; shift += 7 {
 				if shift >= 64 {
 					return ErrIntOverflowKvrpcpb
@@ -8758,16 +10316,16 @@ func (m *KvRawGetResponse) Unmarshal(dAtA []byte) error {
 				}
 				b := dAtA[iNdEx]
 				iNdEx++
-				m.Code |= (int32(b) & 0x7F) << shift
+				m.Do |= (ExecuteType(b) & 0x7F) << shift
 				if b < 0x80 {
 					break
 				}
 			}
 		case 2:
 			if wireType != 2 {
-				return fmt.Errorf("proto: wrong wireType = %d for field Value", wireType)
+				return fmt.Errorf("proto: wrong wireType = %d for field KvPair", wireType)
 			}
-			var byteLen int
+			var msglen int
 			for shift := uint(0); ; shift += 7 {
 				if shift >= 64 {
 					return ErrIntOverflowKvrpcpb
@@ -8777,21 +10335,23 @@ func (m *KvRawGetResponse) Unmarshal(dAtA []byte) error {
 				}
 				b := dAtA[iNdEx]
 				iNdEx++
-				byteLen |= (int(b) & 0x7F) << shift
+				msglen |= (int(b) & 0x7F) << shift
 				if b < 0x80 {
 					break
 				}
 			}
-			if byteLen < 0 {
+			if msglen < 0 {
 				return ErrInvalidLengthKvrpcpb
 			}
-			postIndex := iNdEx + byteLen
+			postIndex := iNdEx + msglen
 			if postIndex > l {
 				return io.ErrUnexpectedEOF
 			}
-			m.Value = append(m.Value[:0], dAtA[iNdEx:postIndex]...)
-			if m.Value == nil {
-				m.Value = []byte{}
+			if m.KvPair == nil {
+				m.KvPair = &KvPair{}
+			}
+			if err := m.KvPair.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
+				return err
 			}
 			iNdEx = postIndex
 		default:
@@ -8815,7 +10375,7 @@ func (m *KvRawGetResponse) Unmarshal(dAtA []byte) error {
 	}
 	return nil
 }
-func (m *DsKvRawPutRequest) Unmarshal(dAtA []byte) error {
+func (m *DsKvRawExecuteRequest) Unmarshal(dAtA []byte) error {
 	l := len(dAtA)
 	iNdEx := 0
 	for iNdEx < l {
@@ -8838,10 +10398,10 @@ func (m *DsKvRawPutRequest) Unmarshal(dAtA []byte) error {
 		fieldNum := int32(wire >> 3)
 		wireType := int(wire & 0x7)
 		if wireType == 4 {
-			return fmt.Errorf("proto: DsKvRawPutRequest: wiretype end group for non-group")
+			return fmt.Errorf("proto: DsKvRawExecuteRequest: wiretype end group for non-group")
 		}
 		if fieldNum <= 0 {
-			return fmt.Errorf("proto: DsKvRawPutRequest: illegal tag %d (wire type %d)", fieldNum, wire)
+			return fmt.Errorf("proto: DsKvRawExecuteRequest: illegal tag %d (wire type %d)", fieldNum, wire)
 		}
 		switch fieldNum {
 		case 1:
@@ -8904,7 +10464,7 @@ func (m *DsKvRawPutRequest) Unmarshal(dAtA []byte) error {
 				return io.ErrUnexpectedEOF
 			}
 			if m.Req == nil {
-				m.Req = &KvRawPutRequest{}
+				m.Req = &KvRawExecuteRequest{}
 			}
 			if err := m.Req.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
 				return err
@@ -8931,7 +10491,7 @@ func (m *DsKvRawPutRequest) Unmarshal(dAtA []byte) error {
 	}
 	return nil
 }
-func (m *DsKvRawPutResponse) Unmarshal(dAtA []byte) error {
+func (m *DsKvRawExecuteResponse) Unmarshal(dAtA []byte) error {
 	l := len(dAtA)
 	iNdEx := 0
 	for iNdEx < l {
@@ -8954,10 +10514,10 @@ func (m *DsKvRawPutResponse) Unmarshal(dAtA []byte) error {
 		fieldNum := int32(wire >> 3)
 		wireType := int(wire & 0x7)
 		if wireType == 4 {
-			return fmt.Errorf("proto: DsKvRawPutResponse: wiretype end group for non-group")
+			return fmt.Errorf("proto: DsKvRawExecuteResponse: wiretype end group for non-group")
 		}
 		if fieldNum <= 0 {
-			return fmt.Errorf("proto: DsKvRawPutResponse: illegal tag %d (wire type %d)", fieldNum, wire)
+			return fmt.Errorf("proto: DsKvRawExecuteResponse: illegal tag %d (wire type %d)", fieldNum, wire)
 		}
 		switch fieldNum {
 		case 1:
@@ -9020,7 +10580,7 @@ func (m *DsKvRawPutResponse) Unmarshal(dAtA []byte) error {
 				return io.ErrUnexpectedEOF
 			}
 			if m.Resp == nil {
-				m.Resp = &KvRawPutResponse{}
+				m.Resp = &KvRawExecuteResponse{}
 			}
 			if err := m.Resp.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
 				return err
@@ -9047,7 +10607,7 @@ func (m *DsKvRawPutResponse) Unmarshal(dAtA []byte) error {
 	}
 	return nil
 }
-func (m *KvRawPutRequest) Unmarshal(dAtA []byte) error {
+func (m *KvRawExecuteRequest) Unmarshal(dAtA []byte) error {
 	l := len(dAtA)
 	iNdEx := 0
 	for iNdEx < l {
@@ -9070,48 +10630,17 @@ func (m *KvRawPutRequest) Unmarshal(dAtA []byte) error {
 		fieldNum := int32(wire >> 3)
 		wireType := int(wire & 0x7)
 		if wireType == 4 {
-			return fmt.Errorf("proto: KvRawPutRequest: wiretype end group for non-group")
+			return fmt.Errorf("proto: KvRawExecuteRequest: wiretype end group for non-group")
 		}
 		if fieldNum <= 0 {
-			return fmt.Errorf("proto: KvRawPutRequest: illegal tag %d (wire type %d)", fieldNum, wire)
+			return fmt.Errorf("proto: KvRawExecuteRequest: illegal tag %d (wire type %d)", fieldNum, wire)
 		}
 		switch fieldNum {
 		case 1:
 			if wireType != 2 {
-				return fmt.Errorf("proto: wrong wireType = %d for field Key", wireType)
-			}
-			var byteLen int
-			for shift := uint(0); ; shift += 7 {
-				if shift >= 64 {
-					return ErrIntOverflowKvrpcpb
-				}
-				if iNdEx >= l {
-					return io.ErrUnexpectedEOF
-				}
-				b := dAtA[iNdEx]
-				iNdEx++
-				byteLen |= (int(b) & 0x7F) << shift
-				if b < 0x80 {
-					break
-				}
-			}
-			if byteLen < 0 {
-				return ErrInvalidLengthKvrpcpb
-			}
-			postIndex := iNdEx + byteLen
-			if postIndex > l {
-				return io.ErrUnexpectedEOF
-			}
-			m.Key = append(m.Key[:0], dAtA[iNdEx:postIndex]...)
-			if m.Key == nil {
-				m.Key = []byte{}
-			}
-			iNdEx = postIndex
-		case 2:
-			if wireType != 2 {
-				return fmt.Errorf("proto: wrong wireType = %d for field Value", wireType)
+				return fmt.Errorf("proto: wrong wireType = %d for field Execs", wireType)
 			}
-			var byteLen int
+			var msglen int
 			for shift := uint(0); ; shift += 7 {
 				if shift >= 64 {
 					return ErrIntOverflowKvrpcpb
@@ -9121,21 +10650,21 @@ func (m *KvRawPutRequest) Unmarshal(dAtA []byte) error {
 				}
 				b := dAtA[iNdEx]
 				iNdEx++
-				byteLen |= (int(b) & 0x7F) << shift
+				msglen |= (int(b) & 0x7F) << shift
 				if b < 0x80 {
 					break
 				}
 			}
-			if byteLen < 0 {
+			if msglen < 0 {
 				return ErrInvalidLengthKvrpcpb
 			}
-			postIndex := iNdEx + byteLen
+			postIndex := iNdEx + msglen
 			if postIndex > l {
 				return io.ErrUnexpectedEOF
 			}
-			m.Value = append(m.Value[:0], dAtA[iNdEx:postIndex]...)
-			if m.Value == nil {
-				m.Value = []byte{}
+			m.Execs = append(m.Execs, &KvPairRawExecute{})
+			if err := m.Execs[len(m.Execs)-1].Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
+				return err
 			}
 			iNdEx = postIndex
 		default:
@@ -9159,7 +10688,7 @@ func (m *KvRawPutRequest) Unmarshal(dAtA []byte) error {
 	}
 	return nil
 }
-func (m *KvRawPutResponse) Unmarshal(dAtA []byte) error {
+func (m *KvRawExecuteResponse) Unmarshal(dAtA []byte) error {
 	l := len(dAtA)
 	iNdEx := 0
 	for iNdEx < l {
@@ -9182,10 +10711,10 @@ func (m *KvRawPutResponse) Unmarshal(dAtA []byte) error {
 		fieldNum := int32(wire >> 3)
 		wireType := int(wire & 0x7)
 		if wireType == 4 {
-			return fmt.Errorf("proto: KvRawPutResponse: wiretype end group for non-group")
+			return fmt.Errorf("proto: KvRawExecuteResponse: wiretype end group for non-group")
 		}
 		if fieldNum <= 0 {
-			return fmt.Errorf("proto: KvRawPutResponse: illegal tag %d (wire type %d)", fieldNum, wire)
+			return fmt.Errorf("proto: KvRawExecuteResponse: illegal tag %d (wire type %d)", fieldNum, wire)
 		}
 		switch fieldNum {
 		case 1:
@@ -9228,7 +10757,7 @@ func (m *KvRawPutResponse) Unmarshal(dAtA []byte) error {
 	}
 	return nil
 }
-func (m *DsKvRawDeleteRequest) Unmarshal(dAtA []byte) error {
+func (m *Scope) Unmarshal(dAtA []byte) error {
 	l := len(dAtA)
 	iNdEx := 0
 	for iNdEx < l {
@@ -9251,17 +10780,17 @@ func (m *DsKvRawDeleteRequest) Unmarshal(dAtA []byte) error {
 		fieldNum := int32(wire >> 3)
 		wireType := int(wire & 0x7)
 		if wireType == 4 {
-			return fmt.Errorf("proto: DsKvRawDeleteRequest: wiretype end group for non-group")
+			return fmt.Errorf("proto: Scope: wiretype end group for non-group")
 		}
 		if fieldNum <= 0 {
-			return fmt.Errorf("proto: DsKvRawDeleteRequest: illegal tag %d (wire type %d)", fieldNum, wire)
+			return fmt.Errorf("proto: Scope: illegal tag %d (wire type %d)", fieldNum, wire)
 		}
 		switch fieldNum {
 		case 1:
 			if wireType != 2 {
-				return fmt.Errorf("proto: wrong wireType = %d for field Header", wireType)
+				return fmt.Errorf("proto: wrong wireType = %d for field Start", wireType)
 			}
-			var msglen int
+			var byteLen int
 			for shift := uint(0); ; shift += 7 {
 				if shift >= 64 {
 					return ErrIntOverflowKvrpcpb
@@ -9271,30 +10800,28 @@ func (m *DsKvRawDeleteRequest) Unmarshal(dAtA []byte) error {
 				}
 				b := dAtA[iNdEx]
 				iNdEx++
-				msglen |= (int(b) & 0x7F) << shift
+				byteLen |= (int(b) & 0x7F) << shift
 				if b < 0x80 {
 					break
 				}
 			}
-			if msglen < 0 {
+			if byteLen < 0 {
 				return ErrInvalidLengthKvrpcpb
 			}
-			postIndex := iNdEx + msglen
+			postIndex := iNdEx + byteLen
 			if postIndex > l {
 				return io.ErrUnexpectedEOF
 			}
-			if m.Header == nil {
-				m.Header = &RequestHeader{}
-			}
-			if err := m.Header.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
-				return err
+			m.Start = append(m.Start[:0], dAtA[iNdEx:postIndex]...)
+			if m.Start == nil {
+				m.Start = []byte{}
 			}
 			iNdEx = postIndex
 		case 2:
 			if wireType != 2 {
-				return fmt.Errorf("proto: wrong wireType = %d for field Req", wireType)
+				return fmt.Errorf("proto: wrong wireType = %d for field Limit", wireType)
 			}
-			var msglen int
+			var byteLen int
 			for shift := uint(0); ; shift += 7 {
 				if shift >= 64 {
 					return ErrIntOverflowKvrpcpb
@@ -9304,23 +10831,21 @@ func (m *DsKvRawDeleteRequest) Unmarshal(dAtA []byte) error {
 				}
 				b := dAtA[iNdEx]
 				iNdEx++
-				msglen |= (int(b) & 0x7F) << shift
+				byteLen |= (int(b) & 0x7F) << shift
 				if b < 0x80 {
 					break
 				}
 			}
-			if msglen < 0 {
+			if byteLen < 0 {
 				return ErrInvalidLengthKvrpcpb
 			}
-			postIndex := iNdEx + msglen
+			postIndex := iNdEx + byteLen
 			if postIndex > l {
 				return io.ErrUnexpectedEOF
 			}
-			if m.Req == nil {
-				m.Req = &KvRawDeleteRequest{}
-			}
-			if err := m.Req.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
-				return err
+			m.Limit = append(m.Limit[:0], dAtA[iNdEx:postIndex]...)
+			if m.Limit == nil {
+				m.Limit = []byte{}
 			}
 			iNdEx = postIndex
 		default:
@@ -9344,7 +10869,7 @@ func (m *DsKvRawDeleteRequest) Unmarshal(dAtA []byte) error {
 	}
 	return nil
 }
-func (m *DsKvRawDeleteResponse) Unmarshal(dAtA []byte) error {
+func (m *SelectField) Unmarshal(dAtA []byte) error {
 	l := len(dAtA)
 	iNdEx := 0
 	for iNdEx < l {
@@ -9367,17 +10892,36 @@ func (m *DsKvRawDeleteResponse) Unmarshal(dAtA []byte) error {
 		fieldNum := int32(wire >> 3)
 		wireType := int(wire & 0x7)
 		if wireType == 4 {
-			return fmt.Errorf("proto: DsKvRawDeleteResponse: wiretype end group for non-group")
+			return fmt.Errorf("proto: SelectField: wiretype end group for non-group")
 		}
 		if fieldNum <= 0 {
-			return fmt.Errorf("proto: DsKvRawDeleteResponse: illegal tag %d (wire type %d)", fieldNum, wire)
+			return fmt.Errorf("proto: SelectField: illegal tag %d (wire type %d)", fieldNum, wire)
 		}
 		switch fieldNum {
 		case 1:
+			if wireType != 0 {
+				return fmt.Errorf("proto: wrong wireType = %d for field Typ", wireType)
+			}
+			m.Typ = 0
+			for shift := uint(0); ; shift += 7 {
+				if shift >= 64 {
+					return ErrIntOverflowKvrpcpb
+				}
+				if iNdEx >= l {
+					return io.ErrUnexpectedEOF
+				}
+				b := dAtA[iNdEx]
+				iNdEx++
+				m.Typ |= (SelectField_Type(b) & 0x7F) << shift
+				if b < 0x80 {
+					break
+				}
+			}
+		case 2:
 			if wireType != 2 {
-				return fmt.Errorf("proto: wrong wireType = %d for field Header", wireType)
+				return fmt.Errorf("proto: wrong wireType = %d for field AggreFunc", wireType)
 			}
-			var msglen int
+			var stringLen uint64
 			for shift := uint(0); ; shift += 7 {
 				if shift >= 64 {
 					return ErrIntOverflowKvrpcpb
@@ -9387,28 +10931,24 @@ func (m *DsKvRawDeleteResponse) Unmarshal(dAtA []byte) error {
 				}
 				b := dAtA[iNdEx]
 				iNdEx++
-				msglen |= (int(b) & 0x7F) << shift
+				stringLen |= (uint64(b) & 0x7F) << shift
 				if b < 0x80 {
 					break
 				}
 			}
-			if msglen < 0 {
+			intStringLen := int(stringLen)
+			if intStringLen < 0 {
 				return ErrInvalidLengthKvrpcpb
 			}
-			postIndex := iNdEx + msglen
+			postIndex := iNdEx + intStringLen
 			if postIndex > l {
 				return io.ErrUnexpectedEOF
 			}
-			if m.Header == nil {
-				m.Header = &ResponseHeader{}
-			}
-			if err := m.Header.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
-				return err
-			}
+			m.AggreFunc = string(dAtA[iNdEx:postIndex])
 			iNdEx = postIndex
-		case 2:
+		case 3:
 			if wireType != 2 {
-				return fmt.Errorf("proto: wrong wireType = %d for field Resp", wireType)
+				return fmt.Errorf("proto: wrong wireType = %d for field Column", wireType)
 			}
 			var msglen int
 			for shift := uint(0); ; shift += 7 {
@@ -9432,10 +10972,10 @@ func (m *DsKvRawDeleteResponse) Unmarshal(dAtA []byte) error {
 			if postIndex > l {
 				return io.ErrUnexpectedEOF
 			}
-			if m.Resp == nil {
-				m.Resp = &KvRawDeleteResponse{}
+			if m.Column == nil {
+				m.Column = &metapb.Column{}
 			}
-			if err := m.Resp.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
+			if err := m.Column.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
 				return err
 			}
 			iNdEx = postIndex
@@ -9460,7 +11000,7 @@ func (m *DsKvRawDeleteResponse) Unmarshal(dAtA []byte) error {
 	}
 	return nil
 }
-func (m *KvRawDeleteRequest) Unmarshal(dAtA []byte) error {
+func (m *Match) Unmarshal(dAtA []byte) error {
 	l := len(dAtA)
 	iNdEx := 0
 	for iNdEx < l {
@@ -9483,15 +11023,48 @@ func (m *KvRawDeleteRequest) Unmarshal(dAtA []byte) error {
 		fieldNum := int32(wire >> 3)
 		wireType := int(wire & 0x7)
 		if wireType == 4 {
-			return fmt.Errorf("proto: KvRawDeleteRequest: wiretype end group for non-group")
+			return fmt.Errorf("proto: Match: wiretype end group for non-group")
 		}
 		if fieldNum <= 0 {
-			return fmt.Errorf("proto: KvRawDeleteRequest: illegal tag %d (wire type %d)", fieldNum, wire)
+			return fmt.Errorf("proto: Match: illegal tag %d (wire type %d)", fieldNum, wire)
 		}
 		switch fieldNum {
 		case 1:
 			if wireType != 2 {
-				return fmt.Errorf("proto: wrong wireType = %d for field Key", wireType)
+				return fmt.Errorf("proto: wrong wireType = %d for field Column", wireType)
+			}
+			var msglen int
+			for shift := uint(0); ; shift += 7 {
+				if shift >= 64 {
+					return ErrIntOverflowKvrpcpb
+				}
+				if iNdEx >= l {
+					return io.ErrUnexpectedEOF
+				}
+				b := dAtA[iNdEx]
+				iNdEx++
+				msglen |= (int(b) & 0x7F) << shift
+				if b < 0x80 {
+					break
+				}
+			}
+			if msglen < 0 {
+				return ErrInvalidLengthKvrpcpb
+			}
+			postIndex := iNdEx + msglen
+			if postIndex > l {
+				return io.ErrUnexpectedEOF
+			}
+			if m.Column == nil {
+				m.Column = &metapb.Column{}
+			}
+			if err := m.Column.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
+				return err
+			}
+			iNdEx = postIndex
+		case 2:
+			if wireType != 2 {
+				return fmt.Errorf("proto: wrong wireType = %d for field Threshold", wireType)
 			}
 			var byteLen int
 			for shift := uint(0); ; shift += 7 {
@@ -9515,11 +11088,30 @@ func (m *KvRawDeleteRequest) Unmarshal(dAtA []byte) error {
 			if postIndex > l {
 				return io.ErrUnexpectedEOF
 			}
-			m.Key = append(m.Key[:0], dAtA[iNdEx:postIndex]...)
-			if m.Key == nil {
-				m.Key = []byte{}
+			m.Threshold = append(m.Threshold[:0], dAtA[iNdEx:postIndex]...)
+			if m.Threshold == nil {
+				m.Threshold = []byte{}
+			}
+			iNdEx = postIndex
+		case 3:
+			if wireType != 0 {
+				return fmt.Errorf("proto: wrong wireType = %d for field MatchType", wireType)
+			}
+			m.MatchType = 0
+			for shift := uint(0); ; shift += 7 {
+				if shift >= 64 {
+					return ErrIntOverflowKvrpcpb
+				}
+				if iNdEx >= l {
+					return io.ErrUnexpectedEOF
+				}
+				b := dAtA[iNdEx]
+				iNdEx++
+				m.MatchType |= (MatchType(b) & 0x7F) << shift
+				if b < 0x80 {
+					break
+				}
 			}
-			iNdEx = postIndex
 		default:
 			iNdEx = preIndex
 			skippy, err := skipKvrpcpb(dAtA[iNdEx:])
@@ -9541,7 +11133,7 @@ func (m *KvRawDeleteRequest) Unmarshal(dAtA []byte) error {
 	}
 	return nil
 }
-func (m *KvRawDeleteResponse) Unmarshal(dAtA []byte) error {
+func (m *Limit) Unmarshal(dAtA []byte) error {
 	l := len(dAtA)
 	iNdEx := 0
 	for iNdEx < l {
@@ -9564,17 +11156,17 @@ func (m *KvRawDeleteResponse) Unmarshal(dAtA []byte) error {
 		fieldNum := int32(wire >> 3)
 		wireType := int(wire & 0x7)
 		if wireType == 4 {
-			return fmt.Errorf("proto: KvRawDeleteResponse: wiretype end group for non-group")
+			return fmt.Errorf("proto: Limit: wiretype end group for non-group")
 		}
 		if fieldNum <= 0 {
-			return fmt.Errorf("proto: KvRawDeleteResponse: illegal tag %d (wire type %d)", fieldNum, wire)
+			return fmt.Errorf("proto: Limit: illegal tag %d (wire type %d)", fieldNum, wire)
 		}
 		switch fieldNum {
 		case 1:
 			if wireType != 0 {
-				return fmt.Errorf("proto: wrong wireType = %d for field Code", wireType)
+				return fmt.Errorf("proto: wrong wireType = %d for field Offset", wireType)
 			}
-			m.Code = 0
+			m.Offset = 0
 			for shift := uint(0); ; shift += 7 {
 				if shift >= 64 {
 					return ErrIntOverflowKvrpcpb
@@ -9584,7 +11176,26 @@ func (m *KvRawDeleteResponse) Unmarshal(dAtA []byte) error {
 				}
 				b := dAtA[iNdEx]
 				iNdEx++
-				m.Code |= (int32(b) & 0x7F) << shift
+				m.Offset |= (uint64(b) & 0x7F) << shift
+				if b < 0x80 {
+					break
+				}
+			}
+		case 2:
+			if wireType != 0 {
+				return fmt.Errorf("proto: wrong wireType = %d for field Count", wireType)
+			}
+			m.Count = 0
+			for shift := uint(0); ; shift += 7 {
+				if shift >= 64 {
+					return ErrIntOverflowKvrpcpb
+				}
+				if iNdEx >= l {
+					return io.ErrUnexpectedEOF
+				}
+				b := dAtA[iNdEx]
+				iNdEx++
+				m.Count |= (uint64(b) & 0x7F) << shift
 				if b < 0x80 {
 					break
 				}
@@ -9610,7 +11221,7 @@ func (m *KvRawDeleteResponse) Unmarshal(dAtA []byte) error {
 	}
 	return nil
 }
-func (m *KvPairRawExecute) Unmarshal(dAtA []byte) error {
+func (m *DsSelectRequest) Unmarshal(dAtA []byte) error {
 	l := len(dAtA)
 	iNdEx := 0
 	for iNdEx < l {
@@ -9633,17 +11244,17 @@ func (m *KvPairRawExecute) Unmarshal(dAtA []byte) error {
 		fieldNum := int32(wire >> 3)
 		wireType := int(wire & 0x7)
 		if wireType == 4 {
-			return fmt.Errorf("proto: KvPairRawExecute: wiretype end group for non-group")
+			return fmt.Errorf("proto: DsSelectRequest: wiretype end group for non-group")
 		}
 		if fieldNum <= 0 {
-			return fmt.Errorf("proto: KvPairRawExecute: illegal tag %d (wire type %d)", fieldNum, wire)
+			return fmt.Errorf("proto: DsSelectRequest: illegal tag %d (wire type %d)", fieldNum, wire)
 		}
 		switch fieldNum {
 		case 1:
-			if wireType != 0 {
-				return fmt.Errorf("proto: wrong wireType = %d for field Do", wireType)
+			if wireType != 2 {
+				return fmt.Errorf("proto: wrong wireType = %d for field Header", wireType)
 			}
-			m.Do = 0
+			var msglen int
 			for shift := uint(0); ; shift += 7 {
 				if shift >= 64 {
 					return ErrIntOverflowKvrpcpb
@@ -9653,14 +11264,28 @@ func (m *KvPairRawExecute) Unmarshal(dAtA []byte) error {
 				}
 				b := dAtA[iNdEx]
 				iNdEx++
-				m.Do |= (ExecuteType(b) & 0x7F) << shift
+				msglen |= (int(b) & 0x7F) << shift
 				if b < 0x80 {
 					break
 				}
 			}
+			if msglen < 0 {
+				return ErrInvalidLengthKvrpcpb
+			}
+			postIndex := iNdEx + msglen
+			if postIndex > l {
+				return io.ErrUnexpectedEOF
+			}
+			if m.Header == nil {
+				m.Header = &RequestHeader{}
+			}
+			if err := m.Header.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
+				return err
+			}
+			iNdEx = postIndex
 		case 2:
 			if wireType != 2 {
-				return fmt.Errorf("proto: wrong wireType = %d for field KvPair", wireType)
+				return fmt.Errorf("proto: wrong wireType = %d for field Req", wireType)
 			}
 			var msglen int
 			for shift := uint(0); ; shift += 7 {
@@ -9684,10 +11309,10 @@ func (m *KvPairRawExecute) Unmarshal(dAtA []byte) error {
 			if postIndex > l {
 				return io.ErrUnexpectedEOF
 			}
-			if m.KvPair == nil {
-				m.KvPair = &KvPair{}
+			if m.Req == nil {
+				m.Req = &SelectRequest{}
 			}
-			if err := m.KvPair.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
+			if err := m.Req.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
 				return err
 			}
 			iNdEx = postIndex
@@ -9712,7 +11337,7 @@ func (m *KvPairRawExecute) Unmarshal(dAtA []byte) error {
 	}
 	return nil
 }
-func (m *DsKvRawExecuteRequest) Unmarshal(dAtA []byte) error {
+func (m *SelectRequest) Unmarshal(dAtA []byte) error {
 	l := len(dAtA)
 	iNdEx := 0
 	for iNdEx < l {
@@ -9735,15 +11360,46 @@ func (m *DsKvRawExecuteRequest) Unmarshal(dAtA []byte) error {
 		fieldNum := int32(wire >> 3)
 		wireType := int(wire & 0x7)
 		if wireType == 4 {
-			return fmt.Errorf("proto: DsKvRawExecuteRequest: wiretype end group for non-group")
+			return fmt.Errorf("proto: SelectRequest: wiretype end group for non-group")
 		}
 		if fieldNum <= 0 {
-			return fmt.Errorf("proto: DsKvRawExecuteRequest: illegal tag %d (wire type %d)", fieldNum, wire)
+			return fmt.Errorf("proto: SelectRequest: illegal tag %d (wire type %d)", fieldNum, wire)
 		}
 		switch fieldNum {
 		case 1:
 			if wireType != 2 {
-				return fmt.Errorf("proto: wrong wireType = %d for field Header", wireType)
+				return fmt.Errorf("proto: wrong wireType = %d for field Key", wireType)
+			}
+			var byteLen int
+			for shift := uint(0); ; shift += 7 {
+				if shift >= 64 {
+					return ErrIntOverflowKvrpcpb
+				}
+				if iNdEx >= l {
+					return io.ErrUnexpectedEOF
+				}
+				b := dAtA[iNdEx]
+				iNdEx++
+				byteLen |= (int(b) & 0x7F) << shift
+				if b < 0x80 {
+					break
+				}
+			}
+			if byteLen < 0 {
+				return ErrInvalidLengthKvrpcpb
+			}
+			postIndex := iNdEx + byteLen
+			if postIndex > l {
+				return io.ErrUnexpectedEOF
+			}
+			m.Key = append(m.Key[:0], dAtA[iNdEx:postIndex]...)
+			if m.Key == nil {
+				m.Key = []byte{}
+			}
+			iNdEx = postIndex
+		case 2:
+			if wireType != 2 {
+				return fmt.Errorf("proto: wrong wireType = %d for field Scope", wireType)
 			}
 			var msglen int
 			for shift := uint(0); ; shift += 7 {
@@ -9767,16 +11423,16 @@ func (m *DsKvRawExecuteRequest) Unmarshal(dAtA []byte) error {
 			if postIndex > l {
 				return io.ErrUnexpectedEOF
 			}
-			if m.Header == nil {
-				m.Header = &RequestHeader{}
+			if m.Scope == nil {
+				m.Scope = &Scope{}
 			}
-			if err := m.Header.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
+			if err := m.Scope.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
 				return err
 			}
 			iNdEx = postIndex
-		case 2:
+		case 3:
 			if wireType != 2 {
-				return fmt.Errorf("proto: wrong wireType = %d for field Req", wireType)
+				return fmt.Errorf("proto: wrong wireType = %d for field FieldList", wireType)
 			}
 			var msglen int
 			for shift := uint(0); ; shift += 7 {
@@ -9800,66 +11456,109 @@ func (m *DsKvRawExecuteRequest) Unmarshal(dAtA []byte) error {
 			if postIndex > l {
 				return io.ErrUnexpectedEOF
 			}
-			if m.Req == nil {
-				m.Req = &KvRawExecuteRequest{}
-			}
-			if err := m.Req.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
+			m.FieldList = append(m.FieldList, &SelectField{})
+			if err := m.FieldList[len(m.FieldList)-1].Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
 				return err
 			}
 			iNdEx = postIndex
-		default:
-			iNdEx = preIndex
-			skippy, err := skipKvrpcpb(dAtA[iNdEx:])
-			if err != nil {
+		case 4:
+			if wireType != 2 {
+				return fmt.Errorf("proto: wrong wireType = %d for field WhereFilters", wireType)
+			}
+			var msglen int
+			for shift := uint(0); ; shift += 7 {
+				if shift >= 64 {
+					return ErrIntOverflowKvrpcpb
+				}
+				if iNdEx >= l {
+					return io.ErrUnexpectedEOF
+				}
+				b := dAtA[iNdEx]
+				iNdEx++
+				msglen |= (int(b) & 0x7F) << shift
+				if b < 0x80 {
+					break
+				}
+			}
+			if msglen < 0 {
+				return ErrInvalidLengthKvrpcpb
+			}
+			postIndex := iNdEx + msglen
+			if postIndex > l {
+				return io.ErrUnexpectedEOF
+			}
+			m.WhereFilters = append(m.WhereFilters, &Match{})
+			if err := m.WhereFilters[len(m.WhereFilters)-1].Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
 				return err
 			}
-			if skippy < 0 {
+			iNdEx = postIndex
+		case 5:
+			if wireType != 2 {
+				return fmt.Errorf("proto: wrong wireType = %d for field GroupBys", wireType)
+			}
+			var msglen int
+			for shift := uint(0); ; shift += 7 {
+				if shift >= 64 {
+					return ErrIntOverflowKvrpcpb
+				}
+				if iNdEx >= l {
+					return io.ErrUnexpectedEOF
+				}
+				b := dAtA[iNdEx]
+				iNdEx++
+				msglen |= (int(b) & 0x7F) << shift
+				if b < 0x80 {
+					break
+				}
+			}
+			if msglen < 0 {
 				return ErrInvalidLengthKvrpcpb
 			}
-			if (iNdEx + skippy) > l {
+			postIndex := iNdEx + msglen
+			if postIndex > l {
 				return io.ErrUnexpectedEOF
 			}
-			iNdEx += skippy
-		}
-	}
-
-	if iNdEx > l {
-		return io.ErrUnexpectedEOF
-	}
-	return nil
-}
-func (m *DsKvRawExecuteResponse) Unmarshal(dAtA []byte) error {
-	l := len(dAtA)
-	iNdEx := 0
-	for iNdEx < l {
-		preIndex := iNdEx
-		var wire uint64
-		for shift := uint(0); ; shift += 7 {
-			if shift >= 64 {
-				return ErrIntOverflowKvrpcpb
+			m.GroupBys = append(m.GroupBys, &metapb.Column{})
+			if err := m.GroupBys[len(m.GroupBys)-1].Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
+				return err
 			}
-			if iNdEx >= l {
+			iNdEx = postIndex
+		case 6:
+			if wireType != 2 {
+				return fmt.Errorf("proto: wrong wireType = %d for field Limit", wireType)
+			}
+			var msglen int
+			for shift := uint(0); ; shift += 7 {
+				if shift >= 64 {
+					return ErrIntOverflowKvrpcpb
+				}
+				if iNdEx >= l {
+					return io.ErrUnexpectedEOF
+				}
+				b := dAtA[iNdEx]
+				iNdEx++
+				msglen |= (int(b) & 0x7F) << shift
+				if b < 0x80 {
+					break
+				}
+			}
+			if msglen < 0 {
+				return ErrInvalidLengthKvrpcpb
+			}
+			postIndex := iNdEx + msglen
+			if postIndex > l {
 				return io.ErrUnexpectedEOF
 			}
-			b := dAtA[iNdEx]
-			iNdEx++
-			wire |= (uint64(b) & 0x7F) << shift
-			if b < 0x80 {
-				break
+			if m.Limit == nil {
+				m.Limit = &Limit{}
 			}
-		}
-		fieldNum := int32(wire >> 3)
-		wireType := int(wire & 0x7)
-		if wireType == 4 {
-			return fmt.Errorf("proto: DsKvRawExecuteResponse: wiretype end group for non-group")
-		}
-		if fieldNum <= 0 {
-			return fmt.Errorf("proto: DsKvRawExecuteResponse: illegal tag %d (wire type %d)", fieldNum, wire)
-		}
-		switch fieldNum {
-		case 1:
+			if err := m.Limit.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
+				return err
+			}
+			iNdEx = postIndex
+		case 7:
 			if wireType != 2 {
-				return fmt.Errorf("proto: wrong wireType = %d for field Header", wireType)
+				return fmt.Errorf("proto: wrong wireType = %d for field Timestamp", wireType)
 			}
 			var msglen int
 			for shift := uint(0); ; shift += 7 {
@@ -9883,18 +11582,18 @@ func (m *DsKvRawExecuteResponse) Unmarshal(dAtA []byte) error {
 			if postIndex > l {
 				return io.ErrUnexpectedEOF
 			}
-			if m.Header == nil {
-				m.Header = &ResponseHeader{}
+			if m.Timestamp == nil {
+				m.Timestamp = &timestamp.Timestamp{}
 			}
-			if err := m.Header.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
+			if err := m.Timestamp.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
 				return err
 			}
 			iNdEx = postIndex
-		case 2:
-			if wireType != 2 {
-				return fmt.Errorf("proto: wrong wireType = %d for field Resp", wireType)
+		case 8:
+			if wireType != 0 {
+				return fmt.Errorf("proto: wrong wireType = %d for field OpenSnapshot", wireType)
 			}
-			var msglen int
+			var v int
 			for shift := uint(0); ; shift += 7 {
 				if shift >= 64 {
 					return ErrIntOverflowKvrpcpb
@@ -9904,25 +11603,31 @@ func (m *DsKvRawExecuteResponse) Unmarshal(dAtA []byte) error {
 				}
 				b := dAtA[iNdEx]
 				iNdEx++
-				msglen |= (int(b) & 0x7F) << shift
+				v |= (int(b) & 0x7F) << shift
 				if b < 0x80 {
 					break
 				}
 			}
-			if msglen < 0 {
-				return ErrInvalidLengthKvrpcpb
-			}
-			postIndex := iNdEx + msglen
-			if postIndex > l {
-				return io.ErrUnexpectedEOF
-			}
-			if m.Resp == nil {
-				m.Resp = &KvRawExecuteResponse{}
+			m.OpenSnapshot = bool(v != 0)
+		case 9:
+			if wireType != 0 {
+				return fmt.Errorf("proto: wrong wireType = %d for field SnapshotId", wireType)
 			}
-			if err := m.Resp.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
-				return err
+			m.SnapshotId = 0
+			for shift := uint(0); ; shift += 7 {
+				if shift >= 64 {
+					return ErrIntOverflowKvrpcpb
+				}
+				if iNdEx >= l {
+					return io.ErrUnexpectedEOF
+				}
+				b := dAtA[iNdEx]
+				iNdEx++
+				m.SnapshotId |= (uint64(b) & 0x7F) << shift
+				if b < 0x80 {
+					break
+				}
 			}
-			iNdEx = postIndex
 		default:
 			iNdEx = preIndex
 			skippy, err := skipKvrpcpb(dAtA[iNdEx:])
@@ -9944,7 +11649,7 @@ func (m *DsKvRawExecuteResponse) Unmarshal(dAtA []byte) error {
 	}
 	return nil
 }
-func (m *KvRawExecuteRequest) Unmarshal(dAtA []byte) error {
+func (m *Row) Unmarshal(dAtA []byte) error {
 	l := len(dAtA)
 	iNdEx := 0
 	for iNdEx < l {
@@ -9967,17 +11672,17 @@ func (m *KvRawExecuteRequest) Unmarshal(dAtA []byte) error {
 		fieldNum := int32(wire >> 3)
 		wireType := int(wire & 0x7)
 		if wireType == 4 {
-			return fmt.Errorf("proto: KvRawExecuteRequest: wiretype end group for non-group")
+			return fmt.Errorf("proto: Row: wiretype end group for non-group")
 		}
 		if fieldNum <= 0 {
-			return fmt.Errorf("proto: KvRawExecuteRequest: illegal tag %d (wire type %d)", fieldNum, wire)
+			return fmt.Errorf("proto: Row: illegal tag %d (wire type %d)", fieldNum, wire)
 		}
 		switch fieldNum {
 		case 1:
 			if wireType != 2 {
-				return fmt.Errorf("proto: wrong wireType = %d for field Execs", wireType)
+				return fmt.Errorf("proto: wrong wireType = %d for field Key", wireType)
 			}
-			var msglen int
+			var byteLen int
 			for shift := uint(0); ; shift += 7 {
 				if shift >= 64 {
 					return ErrIntOverflowKvrpcpb
@@ -9987,78 +11692,28 @@ func (m *KvRawExecuteRequest) Unmarshal(dAtA []byte) error {
 				}
 				b := dAtA[iNdEx]
 				iNdEx++
-				msglen |= (int(b) & 0x7F) << shift
+				byteLen |= (int(b) & 0x7F) << shift
 				if b < 0x80 {
 					break
 				}
 			}
-			if msglen < 0 {
+			if byteLen < 0 {
 				return ErrInvalidLengthKvrpcpb
 			}
-			postIndex := iNdEx + msglen
+			postIndex := iNdEx + byteLen
 			if postIndex > l {
 				return io.ErrUnexpectedEOF
 			}
-			m.Execs = append(m.Execs, &KvPairRawExecute{})
-			if err := m.Execs[len(m.Execs)-1].Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
-				return err
+			m.Key = append(m.Key[:0], dAtA[iNdEx:postIndex]...)
+			if m.Key == nil {
+				m.Key = []byte{}
 			}
 			iNdEx = postIndex
-		default:
-			iNdEx = preIndex
-			skippy, err := skipKvrpcpb(dAtA[iNdEx:])
-			if err != nil {
-				return err
-			}
-			if skippy < 0 {
-				return ErrInvalidLengthKvrpcpb
-			}
-			if (iNdEx + skippy) > l {
-				return io.ErrUnexpectedEOF
-			}
-			iNdEx += skippy
-		}
-	}
-
-	if iNdEx > l {
-		return io.ErrUnexpectedEOF
-	}
-	return nil
-}
-func (m *KvRawExecuteResponse) Unmarshal(dAtA []byte) error {
-	l := len(dAtA)
-	iNdEx := 0
-	for iNdEx < l {
-		preIndex := iNdEx
-		var wire uint64
-		for shift := uint(0); ; shift += 7 {
-			if shift >= 64 {
-				return ErrIntOverflowKvrpcpb
-			}
-			if iNdEx >= l {
-				return io.ErrUnexpectedEOF
-			}
-			b := dAtA[iNdEx]
-			iNdEx++
-			wire |= (uint64(b) & 0x7F) << shift
-			if b < 0x80 {
-				break
-			}
-		}
-		fieldNum := int32(wire >> 3)
-		wireType := int(wire & 0x7)
-		if wireType == 4 {
-			return fmt.Errorf("proto: KvRawExecuteResponse: wiretype end group for non-group")
-		}
-		if fieldNum <= 0 {
-			return fmt.Errorf("proto: KvRawExecuteResponse: illegal tag %d (wire type %d)", fieldNum, wire)
-		}
-		switch fieldNum {
-		case 1:
-			if wireType != 0 {
-				return fmt.Errorf("proto: wrong wireType = %d for field Code", wireType)
+		case 2:
+			if wireType != 2 {
+				return fmt.Errorf("proto: wrong wireType = %d for field Fields", wireType)
 			}
-			m.Code = 0
+			var byteLen int
 			for shift := uint(0); ; shift += 7 {
 				if shift >= 64 {
 					return ErrIntOverflowKvrpcpb
@@ -10068,11 +11723,85 @@ func (m *KvRawExecuteResponse) Unmarshal(dAtA []byte) error {
 				}
 				b := dAtA[iNdEx]
 				iNdEx++
-				m.Code |= (int32(b) & 0x7F) << shift
+				byteLen |= (int(b) & 0x7F) << shift
 				if b < 0x80 {
 					break
 				}
 			}
+			if byteLen < 0 {
+				return ErrInvalidLengthKvrpcpb
+			}
+			postIndex := iNdEx + byteLen
+			if postIndex > l {
+				return io.ErrUnexpectedEOF
+			}
+			m.Fields = append(m.Fields[:0], dAtA[iNdEx:postIndex]...)
+			if m.Fields == nil {
+				m.Fields = []byte{}
+			}
+			iNdEx = postIndex
+		case 3:
+			if wireType == 0 {
+				var v int64
+				for shift := uint(0); ; shift += 7 {
+					if shift >= 64 {
+						return ErrIntOverflowKvrpcpb
+					}
+					if iNdEx >= l {
+						return io.ErrUnexpectedEOF
+					}
+					b := dAtA[iNdEx]
+					iNdEx++
+					v |= (int64(b) & 0x7F) << shift
+					if b < 0x80 {
+						break
+					}
+				}
+				m.AggredCounts = append(m.AggredCounts, v)
+			} else if wireType == 2 {
+				var packedLen int
+				for shift := uint(0); ; shift += 7 {
+					if shift >= 64 {
+						return ErrIntOverflowKvrpcpb
+					}
+					if iNdEx >= l {
+						return io.ErrUnexpectedEOF
+					}
+					b := dAtA[iNdEx]
+					iNdEx++
+					packedLen |= (int(b) & 0x7F) << shift
+					if b < 0x80 {
+						break
+					}
+				}
+				if packedLen < 0 {
+					return ErrInvalidLengthKvrpcpb
+				}
+				postIndex := iNdEx + packedLen
+				if postIndex > l {
+					return io.ErrUnexpectedEOF
+				}
+				for iNdEx < postIndex {
+					var v int64
+					for shift := uint(0); ; shift += 7 {
+						if shift >= 64 {
+							return ErrIntOverflowKvrpcpb
+						}
+						if iNdEx >= l {
+							return io.ErrUnexpectedEOF
+						}
+						b := dAtA[iNdEx]
+						iNdEx++
+						v |= (int64(b) & 0x7F) << shift
+						if b < 0x80 {
+							break
+						}
+					}
+					m.AggredCounts = append(m.AggredCounts, v)
+				}
+			} else {
+				return fmt.Errorf("proto: wrong wireType = %d for field AggredCounts", wireType)
+			}
 		default:
 			iNdEx = preIndex
 			skippy, err := skipKvrpcpb(dAtA[iNdEx:])
@@ -10094,7 +11823,7 @@ func (m *KvRawExecuteResponse) Unmarshal(dAtA []byte) error {
 	}
 	return nil
 }
-func (m *Scope) Unmarshal(dAtA []byte) error {
+func (m *DsSelectResponse) Unmarshal(dAtA []byte) error {
 	l := len(dAtA)
 	iNdEx := 0
 	for iNdEx < l {
@@ -10117,17 +11846,17 @@ func (m *Scope) Unmarshal(dAtA []byte) error {
 		fieldNum := int32(wire >> 3)
 		wireType := int(wire & 0x7)
 		if wireType == 4 {
-			return fmt.Errorf("proto: Scope: wiretype end group for non-group")
+			return fmt.Errorf("proto: DsSelectResponse: wiretype end group for non-group")
 		}
 		if fieldNum <= 0 {
-			return fmt.Errorf("proto: Scope: illegal tag %d (wire type %d)", fieldNum, wire)
+			return fmt.Errorf("proto: DsSelectResponse: illegal tag %d (wire type %d)", fieldNum, wire)
 		}
 		switch fieldNum {
 		case 1:
 			if wireType != 2 {
-				return fmt.Errorf("proto: wrong wireType = %d for field Start", wireType)
+				return fmt.Errorf("proto: wrong wireType = %d for field Header", wireType)
 			}
-			var byteLen int
+			var msglen int
 			for shift := uint(0); ; shift += 7 {
 				if shift >= 64 {
 					return ErrIntOverflowKvrpcpb
@@ -10137,28 +11866,30 @@ func (m *Scope) Unmarshal(dAtA []byte) error {
 				}
 				b := dAtA[iNdEx]
 				iNdEx++
-				byteLen |= (int(b) & 0x7F) << shift
+				msglen |= (int(b) & 0x7F) << shift
 				if b < 0x80 {
 					break
 				}
 			}
-			if byteLen < 0 {
+			if msglen < 0 {
 				return ErrInvalidLengthKvrpcpb
 			}
-			postIndex := iNdEx + byteLen
+			postIndex := iNdEx + msglen
 			if postIndex > l {
 				return io.ErrUnexpectedEOF
 			}
-			m.Start = append(m.Start[:0], dAtA[iNdEx:postIndex]...)
-			if m.Start == nil {
-				m.Start = []byte{}
+			if m.Header == nil {
+				m.Header = &ResponseHeader{}
+			}
+			if err := m.Header.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
+				return err
 			}
 			iNdEx = postIndex
 		case 2:
 			if wireType != 2 {
-				return fmt.Errorf("proto: wrong wireType = %d for field Limit", wireType)
+				return fmt.Errorf("proto: wrong wireType = %d for field Resp", wireType)
 			}
-			var byteLen int
+			var msglen int
 			for shift := uint(0); ; shift += 7 {
 				if shift >= 64 {
 					return ErrIntOverflowKvrpcpb
@@ -10168,21 +11899,23 @@ func (m *Scope) Unmarshal(dAtA []byte) error {
 				}
 				b := dAtA[iNdEx]
 				iNdEx++
-				byteLen |= (int(b) & 0x7F) << shift
+				msglen |= (int(b) & 0x7F) << shift
 				if b < 0x80 {
 					break
 				}
 			}
-			if byteLen < 0 {
+			if msglen < 0 {
 				return ErrInvalidLengthKvrpcpb
 			}
-			postIndex := iNdEx + byteLen
+			postIndex := iNdEx + msglen
 			if postIndex > l {
 				return io.ErrUnexpectedEOF
 			}
-			m.Limit = append(m.Limit[:0], dAtA[iNdEx:postIndex]...)
-			if m.Limit == nil {
-				m.Limit = []byte{}
+			if m.Resp == nil {
+				m.Resp = &SelectResponse{}
+			}
+			if err := m.Resp.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
+				return err
 			}
 			iNdEx = postIndex
 		default:
@@ -10206,7 +11939,7 @@ func (m *Scope) Unmarshal(dAtA []byte) error {
 	}
 	return nil
 }
-func (m *SelectField) Unmarshal(dAtA []byte) error {
+func (m *SelectResponse) Unmarshal(dAtA []byte) error {
 	l := len(dAtA)
 	iNdEx := 0
 	for iNdEx < l {
@@ -10229,17 +11962,17 @@ func (m *SelectField) Unmarshal(dAtA []byte) error {
 		fieldNum := int32(wire >> 3)
 		wireType := int(wire & 0x7)
 		if wireType == 4 {
-			return fmt.Errorf("proto: SelectField: wiretype end group for non-group")
+			return fmt.Errorf("proto: SelectResponse: wiretype end group for non-group")
 		}
 		if fieldNum <= 0 {
-			return fmt.Errorf("proto: SelectField: illegal tag %d (wire type %d)", fieldNum, wire)
+			return fmt.Errorf("proto: SelectResponse: illegal tag %d (wire type %d)", fieldNum, wire)
 		}
 		switch fieldNum {
 		case 1:
 			if wireType != 0 {
-				return fmt.Errorf("proto: wrong wireType = %d for field Typ", wireType)
+				return fmt.Errorf("proto: wrong wireType = %d for field Code", wireType)
 			}
-			m.Typ = 0
+			m.Code = 0
 			for shift := uint(0); ; shift += 7 {
 				if shift >= 64 {
 					return ErrIntOverflowKvrpcpb
@@ -10249,16 +11982,16 @@ func (m *SelectField) Unmarshal(dAtA []byte) error {
 				}
 				b := dAtA[iNdEx]
 				iNdEx++
-				m.Typ |= (SelectField_Type(b) & 0x7F) << shift
+				m.Code |= (int32(b) & 0x7F) << shift
 				if b < 0x80 {
 					break
 				}
 			}
 		case 2:
 			if wireType != 2 {
-				return fmt.Errorf("proto: wrong wireType = %d for field AggreFunc", wireType)
+				return fmt.Errorf("proto: wrong wireType = %d for field Rows", wireType)
 			}
-			var stringLen uint64
+			var msglen int
 			for shift := uint(0); ; shift += 7 {
 				if shift >= 64 {
 					return ErrIntOverflowKvrpcpb
@@ -10268,26 +12001,28 @@ func (m *SelectField) Unmarshal(dAtA []byte) error {
 				}
 				b := dAtA[iNdEx]
 				iNdEx++
-				stringLen |= (uint64(b) & 0x7F) << shift
+				msglen |= (int(b) & 0x7F) << shift
 				if b < 0x80 {
 					break
 				}
 			}
-			intStringLen := int(stringLen)
-			if intStringLen < 0 {
+			if msglen < 0 {
 				return ErrInvalidLengthKvrpcpb
 			}
-			postIndex := iNdEx + intStringLen
+			postIndex := iNdEx + msglen
 			if postIndex > l {
 				return io.ErrUnexpectedEOF
 			}
-			m.AggreFunc = string(dAtA[iNdEx:postIndex])
+			m.Rows = append(m.Rows, &Row{})
+			if err := m.Rows[len(m.Rows)-1].Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
+				return err
+			}
 			iNdEx = postIndex
 		case 3:
-			if wireType != 2 {
-				return fmt.Errorf("proto: wrong wireType = %d for field Column", wireType)
+			if wireType != 0 {
+				return fmt.Errorf("proto: wrong wireType = %d for field Offset", wireType)
 			}
-			var msglen int
+			m.Offset = 0
 			for shift := uint(0); ; shift += 7 {
 				if shift >= 64 {
 					return ErrIntOverflowKvrpcpb
@@ -10297,25 +12032,30 @@ func (m *SelectField) Unmarshal(dAtA []byte) error {
 				}
 				b := dAtA[iNdEx]
 				iNdEx++
-				msglen |= (int(b) & 0x7F) << shift
+				m.Offset |= (uint64(b) & 0x7F) << shift
 				if b < 0x80 {
 					break
 				}
 			}
-			if msglen < 0 {
-				return ErrInvalidLengthKvrpcpb
-			}
-			postIndex := iNdEx + msglen
-			if postIndex > l {
-				return io.ErrUnexpectedEOF
-			}
-			if m.Column == nil {
-				m.Column = &metapb.Column{}
+		case 4:
+			if wireType != 0 {
+				return fmt.Errorf("proto: wrong wireType = %d for field SnapshotId", wireType)
 			}
-			if err := m.Column.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
-				return err
+			m.SnapshotId = 0
+			for shift := uint(0); ; shift += 7 {
+				if shift >= 64 {
+					return ErrIntOverflowKvrpcpb
+				}
+				if iNdEx >= l {
+					return io.ErrUnexpectedEOF
+				}
+				b := dAtA[iNdEx]
+				iNdEx++
+				m.SnapshotId |= (uint64(b) & 0x7F) << shift
+				if b < 0x80 {
+					break
+				}
 			}
-			iNdEx = postIndex
 		default:
 			iNdEx = preIndex
 			skippy, err := skipKvrpcpb(dAtA[iNdEx:])
@@ -10337,7 +12077,7 @@ func (m *SelectField) Unmarshal(dAtA []byte) error {
 	}
 	return nil
 }
-func (m *Match) Unmarshal(dAtA []byte) error {
+func (m *KeyValue) Unmarshal(dAtA []byte) error {
 	l := len(dAtA)
 	iNdEx := 0
 	for iNdEx < l {
@@ -10360,17 +12100,17 @@ func (m *Match) Unmarshal(dAtA []byte) error {
 		fieldNum := int32(wire >> 3)
 		wireType := int(wire & 0x7)
 		if wireType == 4 {
-			return fmt.Errorf("proto: Match: wiretype end group for non-group")
+			return fmt.Errorf("proto: KeyValue: wiretype end group for non-group")
 		}
 		if fieldNum <= 0 {
-			return fmt.Errorf("proto: Match: illegal tag %d (wire type %d)", fieldNum, wire)
+			return fmt.Errorf("proto: KeyValue: illegal tag %d (wire type %d)", fieldNum, wire)
 		}
 		switch fieldNum {
 		case 1:
 			if wireType != 2 {
-				return fmt.Errorf("proto: wrong wireType = %d for field Column", wireType)
+				return fmt.Errorf("proto: wrong wireType = %d for field Key", wireType)
 			}
-			var msglen int
+			var byteLen int
 			for shift := uint(0); ; shift += 7 {
 				if shift >= 64 {
 					return ErrIntOverflowKvrpcpb
@@ -10380,28 +12120,26 @@ func (m *Match) Unmarshal(dAtA []byte) error {
 				}
 				b := dAtA[iNdEx]
 				iNdEx++
-				msglen |= (int(b) & 0x7F) << shift
+				byteLen |= (int(b) & 0x7F) << shift
 				if b < 0x80 {
 					break
 				}
 			}
-			if msglen < 0 {
+			if byteLen < 0 {
 				return ErrInvalidLengthKvrpcpb
 			}
-			postIndex := iNdEx + msglen
+			postIndex := iNdEx + byteLen
 			if postIndex > l {
 				return io.ErrUnexpectedEOF
 			}
-			if m.Column == nil {
-				m.Column = &metapb.Column{}
-			}
-			if err := m.Column.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
-				return err
+			m.Key = append(m.Key[:0], dAtA[iNdEx:postIndex]...)
+			if m.Key == nil {
+				m.Key = []byte{}
 			}
 			iNdEx = postIndex
 		case 2:
 			if wireType != 2 {
-				return fmt.Errorf("proto: wrong wireType = %d for field Threshold", wireType)
+				return fmt.Errorf("proto: wrong wireType = %d for field Value", wireType)
 			}
 			var byteLen int
 			for shift := uint(0); ; shift += 7 {
@@ -10425,16 +12163,16 @@ func (m *Match) Unmarshal(dAtA []byte) error {
 			if postIndex > l {
 				return io.ErrUnexpectedEOF
 			}
-			m.Threshold = append(m.Threshold[:0], dAtA[iNdEx:postIndex]...)
-			if m.Threshold == nil {
-				m.Threshold = []byte{}
+			m.Value = append(m.Value[:0], dAtA[iNdEx:postIndex]...)
+			if m.Value == nil {
+				m.Value = []byte{}
 			}
 			iNdEx = postIndex
 		case 3:
 			if wireType != 0 {
-				return fmt.Errorf("proto: wrong wireType = %d for field MatchType", wireType)
+				return fmt.Errorf("proto: wrong wireType = %d for field ExpireAt", wireType)
 			}
-			m.MatchType = 0
+			m.ExpireAt = 0
 			for shift := uint(0); ; shift += 7 {
 				if shift >= 64 {
 					return ErrIntOverflowKvrpcpb
@@ -10444,7 +12182,7 @@ func (m *Match) Unmarshal(dAtA []byte) error {
 				}
 				b := dAtA[iNdEx]
 				iNdEx++
-				m.MatchType |= (MatchType(b) & 0x7F) << shift
+				m.ExpireAt |= (int64(b) & 0x7F) << shift
 				if b < 0x80 {
 					break
 				}
@@ -10470,7 +12208,7 @@ func (m *Match) Unmarshal(dAtA []byte) error {
 	}
 	return nil
 }
-func (m *Limit) Unmarshal(dAtA []byte) error {
+func (m *DsInsertRequest) Unmarshal(dAtA []byte) error {
 	l := len(dAtA)
 	iNdEx := 0
 	for iNdEx < l {
@@ -10493,17 +12231,17 @@ func (m *Limit) Unmarshal(dAtA []byte) error {
 		fieldNum := int32(wire >> 3)
 		wireType := int(wire & 0x7)
 		if wireType == 4 {
-			return fmt.Errorf("proto: Limit: wiretype end group for non-group")
+			return fmt.Errorf("proto: DsInsertRequest: wiretype end group for non-group")
 		}
 		if fieldNum <= 0 {
-			return fmt.Errorf("proto: Limit: illegal tag %d (wire type %d)", fieldNum, wire)
+			return fmt.Errorf("proto: DsInsertRequest: illegal tag %d (wire type %d)", fieldNum, wire)
 		}
 		switch fieldNum {
 		case 1:
-			if wireType != 0 {
-				return fmt.Errorf("proto: wrong wireType = %d for field Offset", wireType)
+			if wireType != 2 {
+				return fmt.Errorf("proto: wrong wireType = %d for field Header", wireType)
 			}
-			m.Offset = 0
+			var msglen int
 			for shift := uint(0); ; shift += 7 {
 				if shift >= 64 {
 					return ErrIntOverflowKvrpcpb
@@ -10513,16 +12251,30 @@ func (m *Limit) Unmarshal(dAtA []byte) error {
 				}
 				b := dAtA[iNdEx]
 				iNdEx++
-				m.Offset |= (uint64(b) & 0x7F) << shift
+				msglen |= (int(b) & 0x7F) << shift
 				if b < 0x80 {
 					break
 				}
 			}
+			if msglen < 0 {
+				return ErrInvalidLengthKvrpcpb
+			}
+			postIndex := iNdEx + msglen
+			if postIndex > l {
+				return io.ErrUnexpectedEOF
+			}
+			if m.Header == nil {
+				m.Header = &RequestHeader{}
+			}
+			if err := m.Header.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
+				return err
+			}
+			iNdEx = postIndex
 		case 2:
-			if wireType != 0 {
-				return fmt.Errorf("proto: wrong wireType = %d for field Count", wireType)
+			if wireType != 2 {
+				return fmt.Errorf("proto: wrong wireType = %d for field Req", wireType)
 			}
-			m.Count = 0
+			var msglen int
 			for shift := uint(0); ; shift += 7 {
 				if shift >= 64 {
 					return ErrIntOverflowKvrpcpb
@@ -10532,11 +12284,25 @@ func (m *Limit) Unmarshal(dAtA []byte) error {
 				}
 				b := dAtA[iNdEx]
 				iNdEx++
-				m.Count |= (uint64(b) & 0x7F) << shift
+				msglen |= (int(b) & 0x7F) << shift
 				if b < 0x80 {
 					break
 				}
 			}
+			if msglen < 0 {
+				return ErrInvalidLengthKvrpcpb
+			}
+			postIndex := iNdEx + msglen
+			if postIndex > l {
+				return io.ErrUnexpectedEOF
+			}
+			if m.Req == nil {
+				m.Req = &InsertRequest{}
+			}
+			if err := m.Req.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
+				return err
+			}
+			iNdEx = postIndex
 		default:
 			iNdEx = preIndex
 			skippy, err := skipKvrpcpb(dAtA[iNdEx:])
@@ -10558,7 +12324,7 @@ func (m *Limit) Unmarshal(dAtA []byte) error {
 	}
 	return nil
 }
-func (m *DsSelectRequest) Unmarshal(dAtA []byte) error {
+func (m *DsInsertResponse) Unmarshal(dAtA []byte) error {
 	l := len(dAtA)
 	iNdEx := 0
 	for iNdEx < l {
@@ -10581,10 +12347,10 @@ func (m *DsSelectRequest) Unmarshal(dAtA []byte) error {
 		fieldNum := int32(wire >> 3)
 		wireType := int(wire & 0x7)
 		if wireType == 4 {
-			return fmt.Errorf("proto: DsSelectRequest: wiretype end group for non-group")
+			return fmt.Errorf("proto: DsInsertResponse: wiretype end group for non-group")
 		}
 		if fieldNum <= 0 {
-			return fmt.Errorf("proto: DsSelectRequest: illegal tag %d (wire type %d)", fieldNum, wire)
+			return fmt.Errorf("proto: DsInsertResponse: illegal tag %d (wire type %d)", fieldNum, wire)
 		}
 		switch fieldNum {
 		case 1:
@@ -10614,7 +12380,7 @@ func (m *DsSelectRequest) Unmarshal(dAtA []byte) error {
 				return io.ErrUnexpectedEOF
 			}
 			if m.Header == nil {
-				m.Header = &RequestHeader{}
+				m.Header = &ResponseHeader{}
 			}
 			if err := m.Header.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
 				return err
@@ -10622,7 +12388,7 @@ func (m *DsSelectRequest) Unmarshal(dAtA []byte) error {
 			iNdEx = postIndex
 		case 2:
 			if wireType != 2 {
-				return fmt.Errorf("proto: wrong wireType = %d for field Req", wireType)
+				return fmt.Errorf("proto: wrong wireType = %d for field Resp", wireType)
 			}
 			var msglen int
 			for shift := uint(0); ; shift += 7 {
@@ -10646,10 +12412,10 @@ func (m *DsSelectRequest) Unmarshal(dAtA []byte) error {
 			if postIndex > l {
 				return io.ErrUnexpectedEOF
 			}
-			if m.Req == nil {
-				m.Req = &SelectRequest{}
+			if m.Resp == nil {
+				m.Resp = &InsertResponse{}
 			}
-			if err := m.Req.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
+			if err := m.Resp.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
 				return err
 			}
 			iNdEx = postIndex
@@ -10674,7 +12440,7 @@ func (m *DsSelectRequest) Unmarshal(dAtA []byte) error {
 	}
 	return nil
 }
-func (m *SelectRequest) Unmarshal(dAtA []byte) error {
+func (m *InsertRequest) Unmarshal(dAtA []byte) error {
 	l := len(dAtA)
 	iNdEx := 0
 	for iNdEx < l {
@@ -10697,17 +12463,17 @@ func (m *SelectRequest) Unmarshal(dAtA []byte) error {
 		fieldNum := int32(wire >> 3)
 		wireType := int(wire & 0x7)
 		if wireType == 4 {
-			return fmt.Errorf("proto: SelectRequest: wiretype end group for non-group")
+			return fmt.Errorf("proto: InsertRequest: wiretype end group for non-group")
 		}
 		if fieldNum <= 0 {
-			return fmt.Errorf("proto: SelectRequest: illegal tag %d (wire type %d)", fieldNum, wire)
+			return fmt.Errorf("proto: InsertRequest: illegal tag %d (wire type %d)", fieldNum, wire)
 		}
 		switch fieldNum {
 		case 1:
 			if wireType != 2 {
-				return fmt.Errorf("proto: wrong wireType = %d for field Key", wireType)
+				return fmt.Errorf("proto: wrong wireType = %d for field Rows", wireType)
 			}
-			var byteLen int
+			var msglen int
 			for shift := uint(0); ; shift += 7 {
 				if shift >= 64 {
 					return ErrIntOverflowKvrpcpb
@@ -10717,28 +12483,28 @@ func (m *SelectRequest) Unmarshal(dAtA []byte) error {
 				}
 				b := dAtA[iNdEx]
 				iNdEx++
-				byteLen |= (int(b) & 0x7F) << shift
+				msglen |= (int(b) & 0x7F) << shift
 				if b < 0x80 {
 					break
 				}
 			}
-			if byteLen < 0 {
+			if msglen < 0 {
 				return ErrInvalidLengthKvrpcpb
 			}
-			postIndex := iNdEx + byteLen
+			postIndex := iNdEx + msglen
 			if postIndex > l {
 				return io.ErrUnexpectedEOF
 			}
-			m.Key = append(m.Key[:0], dAtA[iNdEx:postIndex]...)
-			if m.Key == nil {
-				m.Key = []byte{}
+			m.Rows = append(m.Rows, &KeyValue{})
+			if err := m.Rows[len(m.Rows)-1].Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
+				return err
 			}
 			iNdEx = postIndex
 		case 2:
-			if wireType != 2 {
-				return fmt.Errorf("proto: wrong wireType = %d for field Scope", wireType)
+			if wireType != 0 {
+				return fmt.Errorf("proto: wrong wireType = %d for field CheckDuplicate", wireType)
 			}
-			var msglen int
+			var v int
 			for shift := uint(0); ; shift += 7 {
 				if shift >= 64 {
 					return ErrIntOverflowKvrpcpb
@@ -10748,28 +12514,15 @@ func (m *SelectRequest) Unmarshal(dAtA []byte) error {
 				}
 				b := dAtA[iNdEx]
 				iNdEx++
-				msglen |= (int(b) & 0x7F) << shift
+				v |= (int(b) & 0x7F) << shift
 				if b < 0x80 {
 					break
 				}
 			}
-			if msglen < 0 {
-				return ErrInvalidLengthKvrpcpb
-			}
-			postIndex := iNdEx + msglen
-			if postIndex > l {
-				return io.ErrUnexpectedEOF
-			}
-			if m.Scope == nil {
-				m.Scope = &Scope{}
-			}
-			if err := m.Scope.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
-				return err
-			}
-			iNdEx = postIndex
+			m.CheckDuplicate = bool(v != 0)
 		case 3:
 			if wireType != 2 {
-				return fmt.Errorf("proto: wrong wireType = %d for field FieldList", wireType)
+				return fmt.Errorf("proto: wrong wireType = %d for field Timestamp", wireType)
 			}
 			var msglen int
 			for shift := uint(0); ; shift += 7 {
@@ -10793,16 +12546,68 @@ func (m *SelectRequest) Unmarshal(dAtA []byte) error {
 			if postIndex > l {
 				return io.ErrUnexpectedEOF
 			}
-			m.FieldList = append(m.FieldList, &SelectField{})
-			if err := m.FieldList[len(m.FieldList)-1].Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
+			if m.Timestamp == nil {
+				m.Timestamp = &timestamp.Timestamp{}
+			}
+			if err := m.Timestamp.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
 				return err
 			}
 			iNdEx = postIndex
-		case 4:
-			if wireType != 2 {
-				return fmt.Errorf("proto: wrong wireType = %d for field WhereFilters", wireType)
+		default:
+			iNdEx = preIndex
+			skippy, err := skipKvrpcpb(dAtA[iNdEx:])
+			if err != nil {
+				return err
+			}
+			if skippy < 0 {
+				return ErrInvalidLengthKvrpcpb
+			}
+			if (iNdEx + skippy) > l {
+				return io.ErrUnexpectedEOF
+			}
+			iNdEx += skippy
+		}
+	}
+
+	if iNdEx > l {
+		return io.ErrUnexpectedEOF
+	}
+	return nil
+}
+func (m *InsertResponse) Unmarshal(dAtA []byte) error {
+	l := len(dAtA)
+	iNdEx := 0
+	for iNdEx < l {
+		preIndex := iNdEx
+		var wire uint64
+		for shift := uint(0); ; shift += 7 {
+			if shift >= 64 {
+				return ErrIntOverflowKvrpcpb
+			}
+			if iNdEx >= l {
+				return io.ErrUnexpectedEOF
+			}
+			b := dAtA[iNdEx]
+			iNdEx++
+			wire |= (uint64(b) & 0x7F) << shift
+			if b < 0x80 {
+				break
+			}
+		}
+		fieldNum := int32(wire >> 3)
+		wireType := int(wire & 0x7)
+		if wireType == 4 {
+			return fmt.Errorf("proto: InsertResponse: wiretype end group for non-group")
+		}
+		if fieldNum <= 0 {
+			return fmt.Errorf("proto: InsertResponse: illegal tag %d (wire type %d)", fieldNum, wire)
+		}
+		switch fieldNum {
+		case 1:
+			if wireType != 0 {
+				return fmt.Errorf("proto: wrong wireType = %d for field Code", wireType)
 			}
-			var msglen int
+			m.Code = 0
 			for shift := uint(0); ; shift += 7 {
 				if shift >= 64 {
 					return ErrIntOverflowKvrpcpb
@@ -10812,28 +12617,16 @@ func (m *SelectRequest) Unmarshal(dAtA []byte) error {
 				}
 				b := dAtA[iNdEx]
 				iNdEx++
-				msglen |= (int(b) & 0x7F) << shift
+				m.Code |= (int32(b) & 0x7F) << shift
 				if b < 0x80 {
 					break
 				}
 			}
-			if msglen < 0 {
-				return ErrInvalidLengthKvrpcpb
-			}
-			postIndex := iNdEx + msglen
-			if postIndex > l {
-				return io.ErrUnexpectedEOF
-			}
-			m.WhereFilters = append(m.WhereFilters, &Match{})
-			if err := m.WhereFilters[len(m.WhereFilters)-1].Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
-				return err
-			}
-			iNdEx = postIndex
-		case 5:
-			if wireType != 2 {
-				return fmt.Errorf("proto: wrong wireType = %d for field GroupBys", wireType)
+		case 2:
+			if wireType != 0 {
+				return fmt.Errorf("proto: wrong wireType = %d for field AffectedKeys", wireType)
 			}
-			var msglen int
+			m.AffectedKeys = 0
 			for shift := uint(0); ; shift += 7 {
 				if shift >= 64 {
 					return ErrIntOverflowKvrpcpb
@@ -10843,28 +12636,16 @@ func (m *SelectRequest) Unmarshal(dAtA []byte) error {
 				}
 				b := dAtA[iNdEx]
 				iNdEx++
-				msglen |= (int(b) & 0x7F) << shift
+				m.AffectedKeys |= (uint64(b) & 0x7F) << shift
 				if b < 0x80 {
 					break
 				}
 			}
-			if msglen < 0 {
-				return ErrInvalidLengthKvrpcpb
-			}
-			postIndex := iNdEx + msglen
-			if postIndex > l {
-				return io.ErrUnexpectedEOF
-			}
-			m.GroupBys = append(m.GroupBys, &metapb.Column{})
-			if err := m.GroupBys[len(m.GroupBys)-1].Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
-				return err
-			}
-			iNdEx = postIndex
-		case 6:
+		case 3:
 			if wireType != 2 {
-				return fmt.Errorf("proto: wrong wireType = %d for field Limit", wireType)
+				return fmt.Errorf("proto: wrong wireType = %d for field DuplicateKey", wireType)
 			}
-			var msglen int
+			var byteLen int
 			for shift := uint(0); ; shift += 7 {
 				if shift >= 64 {
 					return ErrIntOverflowKvrpcpb
@@ -10874,28 +12655,76 @@ func (m *SelectRequest) Unmarshal(dAtA []byte) error {
 				}
 				b := dAtA[iNdEx]
 				iNdEx++
-				msglen |= (int(b) & 0x7F) << shift
+				byteLen |= (int(b) & 0x7F) << shift
 				if b < 0x80 {
 					break
 				}
 			}
-			if msglen < 0 {
+			if byteLen < 0 {
 				return ErrInvalidLengthKvrpcpb
 			}
-			postIndex := iNdEx + msglen
+			postIndex := iNdEx + byteLen
 			if postIndex > l {
 				return io.ErrUnexpectedEOF
 			}
-			if m.Limit == nil {
-				m.Limit = &Limit{}
+			m.DuplicateKey = append(m.DuplicateKey[:0], dAtA[iNdEx:postIndex]...)
+			if m.DuplicateKey == nil {
+				m.DuplicateKey = []byte{}
 			}
-			if err := m.Limit.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
+			iNdEx = postIndex
+		default:
+			iNdEx = preIndex
+			skippy, err := skipKvrpcpb(dAtA[iNdEx:])
+			if err != nil {
 				return err
 			}
-			iNdEx = postIndex
-		case 7:
+			if skippy < 0 {
+				return ErrInvalidLengthKvrpcpb
+			}
+			if (iNdEx + skippy) > l {
+				return io.ErrUnexpectedEOF
+			}
+			iNdEx += skippy
+		}
+	}
+
+	if iNdEx > l {
+		return io.ErrUnexpectedEOF
+	}
+	return nil
+}
+func (m *BatchInsertRequest) Unmarshal(dAtA []byte) error {
+	l := len(dAtA)
+	iNdEx := 0
+	for iNdEx < l {
+		preIndex := iNdEx
+		var wire uint64
+		for shift := uint(0); ; shift += 7 {
+			if shift >= 64 {
+				return ErrIntOverflowKvrpcpb
+			}
+			if iNdEx >= l {
+				return io.ErrUnexpectedEOF
+			}
+			b := dAtA[iNdEx]
+			iNdEx++
+			wire |= (uint64(b) & 0x7F) << shift
+			if b < 0x80 {
+				break
+			}
+		}
+		fieldNum := int32(wire >> 3)
+		wireType := int(wire & 0x7)
+		if wireType == 4 {
+			return fmt.Errorf("proto: BatchInsertRequest: wiretype end group for non-group")
+		}
+		if fieldNum <= 0 {
+			return fmt.Errorf("proto: BatchInsertRequest: illegal tag %d (wire type %d)", fieldNum, wire)
+		}
+		switch fieldNum {
+		case 1:
 			if wireType != 2 {
-				return fmt.Errorf("proto: wrong wireType = %d for field Timestamp", wireType)
+				return fmt.Errorf("proto: wrong wireType = %d for field Reqs", wireType)
 			}
 			var msglen int
 			for shift := uint(0); ; shift += 7 {
@@ -10919,10 +12748,8 @@ func (m *SelectRequest) Unmarshal(dAtA []byte) error {
 			if postIndex > l {
 				return io.ErrUnexpectedEOF
 			}
-			if m.Timestamp == nil {
-				m.Timestamp = &timestamp.Timestamp{}
-			}
-			if err := m.Timestamp.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
+			m.Reqs = append(m.Reqs, &InsertRequest{})
+			if err := m.Reqs[len(m.Reqs)-1].Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
 				return err
 			}
 			iNdEx = postIndex
@@ -10947,7 +12774,7 @@ func (m *SelectRequest) Unmarshal(dAtA []byte) error {
 	}
 	return nil
 }
-func (m *Row) Unmarshal(dAtA []byte) error {
+func (m *BatchInsertResponse) Unmarshal(dAtA []byte) error {
 	l := len(dAtA)
 	iNdEx := 0
 	for iNdEx < l {
@@ -10970,48 +12797,17 @@ func (m *Row) Unmarshal(dAtA []byte) error {
 		fieldNum := int32(wire >> 3)
 		wireType := int(wire & 0x7)
 		if wireType == 4 {
-			return fmt.Errorf("proto: Row: wiretype end group for non-group")
+			return fmt.Errorf("proto: BatchInsertResponse: wiretype end group for non-group")
 		}
 		if fieldNum <= 0 {
-			return fmt.Errorf("proto: Row: illegal tag %d (wire type %d)", fieldNum, wire)
+			return fmt.Errorf("proto: BatchInsertResponse: illegal tag %d (wire type %d)", fieldNum, wire)
 		}
 		switch fieldNum {
-		case 1:
-			if wireType != 2 {
-				return fmt.Errorf("proto: wrong wireType = %d for field Key", wireType)
-			}
-			var byteLen int
-			for shift := uint(0); ; shift += 7 {
-				if shift >= 64 {
-					return ErrIntOverflowKvrpcpb
-				}
-				if iNdEx >= l {
-					return io.ErrUnexpectedEOF
-				}
-				b := dAtA[iNdEx]
-				iNdEx++
-				byteLen |= (int(b) & 0x7F) << shift
-				if b < 0x80 {
-					break
-				}
-			}
-			if byteLen < 0 {
-				return ErrInvalidLengthKvrpcpb
-			}
-			postIndex := iNdEx + byteLen
-			if postIndex > l {
-				return io.ErrUnexpectedEOF
-			}
-			m.Key = append(m.Key[:0], dAtA[iNdEx:postIndex]...)
-			if m.Key == nil {
-				m.Key = []byte{}
-			}
-			iNdEx = postIndex
 		case 2:
 			if wireType != 2 {
-				return fmt.Errorf("proto: wrong wireType = %d for field Fields", wireType)
+				return fmt.Errorf("proto: wrong wireType = %d for field Resps", wireType)
 			}
-			var byteLen int
+			var msglen int
 			for shift := uint(0); ; shift += 7 {
 				if shift >= 64 {
 					return ErrIntOverflowKvrpcpb
@@ -11021,85 +12817,23 @@ func (m *Row) Unmarshal(dAtA []byte) error {
 				}
 				b := dAtA[iNdEx]
 				iNdEx++
-				byteLen |= (int(b) & 0x7F) << shift
+				msglen |= (int(b) & 0x7F) << shift
 				if b < 0x80 {
 					break
 				}
 			}
-			if byteLen < 0 {
+			if msglen < 0 {
 				return ErrInvalidLengthKvrpcpb
 			}
-			postIndex := iNdEx + byteLen
+			postIndex := iNdEx + msglen
 			if postIndex > l {
 				return io.ErrUnexpectedEOF
 			}
-			m.Fields = append(m.Fields[:0], dAtA[iNdEx:postIndex]...)
-			if m.Fields == nil {
-				m.Fields = []byte{}
+			m.Resps = append(m.Resps, &InsertResponse{})
+			if err := m.Resps[len(m.Resps)-1].Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
+				return err
 			}
 			iNdEx = postIndex
-		case 3:
-			if wireType == 0 {
-				var v int64
-				for shift := uint(0); ; shift += 7 {
-					if shift >= 64 {
-						return ErrIntOverflowKvrpcpb
-					}
-					if iNdEx >= l {
-						return io.ErrUnexpectedEOF
-					}
-					b := dAtA[iNdEx]
-					iNdEx++
-					v |= (int64(b) & 0x7F) << shift
-					if b < 0x80 {
-						break
-					}
-				}
-				m.AggredCounts = append(m.AggredCounts, v)
-			} else if wireType == 2 {
-				var packedLen int
-				for shift := uint(0); ; shift += 7 {
-					if shift >= 64 {
-						return ErrIntOverflowKvrpcpb
-					}
-					if iNdEx >= l {
-						return io.ErrUnexpectedEOF
-					}
-					b := dAtA[iNdEx]
-					iNdEx++
-					packedLen |= (int(b) & 0x7F) << shift
-					if b < 0x80 {
-						break
-					}
-				}
-				if packedLen < 0 {
-					return ErrInvalidLengthKvrpcpb
-				}
-				postIndex := iNdEx + packedLen
-				if postIndex > l {
-					return io.ErrUnexpectedEOF
-				}
-				for iNdEx < postIndex {
-					var v int64
-					for shift := uint(0); ; shift += 7 {
-						if shift >= 64 {
-							return ErrIntOverflowKvrpcpb
-						}
-						if iNdEx >= l {
-							return io.ErrUnexpectedEOF
-						}
-						b := dAtA[iNdEx]
-						iNdEx++
-						v |= (int64(b) & 0x7F) << shift
-						if b < 0x80 {
-							break
-						}
-					}
-					m.AggredCounts = append(m.AggredCounts, v)
-				}
-			} else {
-				return fmt.Errorf("proto: wrong wireType = %d for field AggredCounts", wireType)
-			}
 		default:
 			iNdEx = preIndex
 			skippy, err := skipKvrpcpb(dAtA[iNdEx:])
@@ -11121,7 +12855,7 @@ func (m *Row) Unmarshal(dAtA []byte) error {
 	}
 	return nil
 }
-func (m *DsSelectResponse) Unmarshal(dAtA []byte) error {
+func (m *DsDeleteRequest) Unmarshal(dAtA []byte) error {
 	l := len(dAtA)
 	iNdEx := 0
 	for iNdEx < l {
@@ -11144,10 +12878,10 @@ func (m *DsSelectResponse) Unmarshal(dAtA []byte) error {
 		fieldNum := int32(wire >> 3)
 		wireType := int(wire & 0x7)
 		if wireType == 4 {
-			return fmt.Errorf("proto: DsSelectResponse: wiretype end group for non-group")
+			return fmt.Errorf("proto: DsDeleteRequest: wiretype end group for non-group")
 		}
 		if fieldNum <= 0 {
-			return fmt.Errorf("proto: DsSelectResponse: illegal tag %d (wire type %d)", fieldNum, wire)
+			return fmt.Errorf("proto: DsDeleteRequest: illegal tag %d (wire type %d)", fieldNum, wire)
 		}
 		switch fieldNum {
 		case 1:
@@ -11177,7 +12911,7 @@ func (m *DsSelectResponse) Unmarshal(dAtA []byte) error {
 				return io.ErrUnexpectedEOF
 			}
 			if m.Header == nil {
-				m.Header = &ResponseHeader{}
+				m.Header = &RequestHeader{}
 			}
 			if err := m.Header.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
 				return err
@@ -11185,7 +12919,7 @@ func (m *DsSelectResponse) Unmarshal(dAtA []byte) error {
 			iNdEx = postIndex
 		case 2:
 			if wireType != 2 {
-				return fmt.Errorf("proto: wrong wireType = %d for field Resp", wireType)
+				return fmt.Errorf("proto: wrong wireType = %d for field Req", wireType)
 			}
 			var msglen int
 			for shift := uint(0); ; shift += 7 {
@@ -11209,10 +12943,10 @@ func (m *DsSelectResponse) Unmarshal(dAtA []byte) error {
 			if postIndex > l {
 				return io.ErrUnexpectedEOF
 			}
-			if m.Resp == nil {
-				m.Resp = &SelectResponse{}
+			if m.Req == nil {
+				m.Req = &DeleteRequest{}
 			}
-			if err := m.Resp.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
+			if err := m.Req.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
 				return err
 			}
 			iNdEx = postIndex
@@ -11237,7 +12971,7 @@ func (m *DsSelectResponse) Unmarshal(dAtA []byte) error {
 	}
 	return nil
 }
-func (m *SelectResponse) Unmarshal(dAtA []byte) error {
+func (m *DsDeleteResponse) Unmarshal(dAtA []byte) error {
 	l := len(dAtA)
 	iNdEx := 0
 	for iNdEx < l {
@@ -11260,17 +12994,17 @@ func (m *SelectResponse) Unmarshal(dAtA []byte) error {
 		fieldNum := int32(wire >> 3)
 		wireType := int(wire & 0x7)
 		if wireType == 4 {
-			return fmt.Errorf("proto: SelectResponse: wiretype end group for non-group")
+			return fmt.Errorf("proto: DsDeleteResponse: wiretype end group for non-group")
 		}
 		if fieldNum <= 0 {
-			return fmt.Errorf("proto: SelectResponse: illegal tag %d (wire type %d)", fieldNum, wire)
+			return fmt.Errorf("proto: DsDeleteResponse: illegal tag %d (wire type %d)", fieldNum, wire)
 		}
 		switch fieldNum {
 		case 1:
-			if wireType != 0 {
-				return fmt.Errorf("proto: wrong wireType = %d for field Code", wireType)
+			if wireType != 2 {
+				return fmt.Errorf("proto: wrong wireType = %d for field Header", wireType)
 			}
-			m.Code = 0
+			var msglen int
 			for shift := uint(0); ; shift += 7 {
 				if shift >= 64 {
 					return ErrIntOverflowKvrpcpb
@@ -11280,14 +13014,28 @@ func (m *SelectResponse) Unmarshal(dAtA []byte) error {
 				}
 				b := dAtA[iNdEx]
 				iNdEx++
-				m.Code |= (int32(b) & 0x7F) << shift
+				msglen |= (int(b) & 0x7F) << shift
 				if b < 0x80 {
 					break
 				}
 			}
+			if msglen < 0 {
+				return ErrInvalidLengthKvrpcpb
+			}
+			postIndex := iNdEx + msglen
+			if postIndex > l {
+				return io.ErrUnexpectedEOF
+			}
+			if m.Header == nil {
+				m.Header = &ResponseHeader{}
+			}
+			if err := m.Header.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
+				return err
+			}
+			iNdEx = postIndex
 		case 2:
 			if wireType != 2 {
-				return fmt.Errorf("proto: wrong wireType = %d for field Rows", wireType)
+				return fmt.Errorf("proto: wrong wireType = %d for field Resp", wireType)
 			}
 			var msglen int
 			for shift := uint(0); ; shift += 7 {
@@ -11311,30 +13059,13 @@ func (m *SelectResponse) Unmarshal(dAtA []byte) error {
 			if postIndex > l {
 				return io.ErrUnexpectedEOF
 			}
-			m.Rows = append(m.Rows, &Row{})
-			if err := m.Rows[len(m.Rows)-1].Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
+			if m.Resp == nil {
+				m.Resp = &DeleteResponse{}
+			}
+			if err := m.Resp.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
 				return err
 			}
 			iNdEx = postIndex
-		case 3:
-			if wireType != 0 {
-				return fmt.Errorf("proto: wrong wireType = %d for field Offset", wireType)
-			}
-			m.Offset = 0
-			for shift := uint(0); ; shift += 7 {
-				if shift >= 64 {
-					return ErrIntOverflowKvrpcpb
-				}
-				if iNdEx >= l {
-					return io.ErrUnexpectedEOF
-				}
-				b := dAtA[iNdEx]
-				iNdEx++
-				m.Offset |= (uint64(b) & 0x7F) << shift
-				if b < 0x80 {
-					break
-				}
-			}
 		default:
 			iNdEx = preIndex
 			skippy, err := skipKvrpcpb(dAtA[iNdEx:])
@@ -11356,7 +13087,7 @@ func (m *SelectResponse) Unmarshal(dAtA []byte) error {
 	}
 	return nil
 }
-func (m *KeyValue) Unmarshal(dAtA []byte) error {
+func (m *DeleteRequest) Unmarshal(dAtA []byte) error {
 	l := len(dAtA)
 	iNdEx := 0
 	for iNdEx < l {
@@ -11379,10 +13110,10 @@ func (m *KeyValue) Unmarshal(dAtA []byte) error {
 		fieldNum := int32(wire >> 3)
 		wireType := int(wire & 0x7)
 		if wireType == 4 {
-			return fmt.Errorf("proto: KeyValue: wiretype end group for non-group")
+			return fmt.Errorf("proto: DeleteRequest: wiretype end group for non-group")
 		}
 		if fieldNum <= 0 {
-			return fmt.Errorf("proto: KeyValue: illegal tag %d (wire type %d)", fieldNum, wire)
+			return fmt.Errorf("proto: DeleteRequest: illegal tag %d (wire type %d)", fieldNum, wire)
 		}
 		switch fieldNum {
 		case 1:
@@ -11418,9 +13149,9 @@ func (m *KeyValue) Unmarshal(dAtA []byte) error {
 			iNdEx = postIndex
 		case 2:
 			if wireType != 2 {
-				return fmt.Errorf("proto: wrong wireType = %d for field Value", wireType)
+				return fmt.Errorf("proto: wrong wireType = %d for field Scope", wireType)
 			}
-			var byteLen int
+			var msglen int
 			for shift := uint(0); ; shift += 7 {
 				if shift >= 64 {
 					return ErrIntOverflowKvrpcpb
@@ -11430,95 +13161,28 @@ func (m *KeyValue) Unmarshal(dAtA []byte) error {
 				}
 				b := dAtA[iNdEx]
 				iNdEx++
-				byteLen |= (int(b) & 0x7F) << shift
+				msglen |= (int(b) & 0x7F) << shift
 				if b < 0x80 {
 					break
 				}
 			}
-			if byteLen < 0 {
+			if msglen < 0 {
 				return ErrInvalidLengthKvrpcpb
 			}
-			postIndex := iNdEx + byteLen
+			postIndex := iNdEx + msglen
 			if postIndex > l {
 				return io.ErrUnexpectedEOF
 			}
-			m.Value = append(m.Value[:0], dAtA[iNdEx:postIndex]...)
-			if m.Value == nil {
-				m.Value = []byte{}
-			}
-			iNdEx = postIndex
-		case 3:
-			if wireType != 0 {
-				return fmt.Errorf("proto: wrong wireType = %d for field ExpireAt", wireType)
-			}
-			m.ExpireAt = 0
-			for shift := uint(0); ; shift += 7 {
-				if shift >= 64 {
-					return ErrIntOverflowKvrpcpb
-				}
-				if iNdEx >= l {
-					return io.ErrUnexpectedEOF
-				}
-				b := dAtA[iNdEx]
-				iNdEx++
-				m.ExpireAt |= (int64(b) & 0x7F) << shift
-				if b < 0x80 {
-					break
-				}
+			if m.Scope == nil {
+				m.Scope = &Scope{}
 			}
-		default:
-			iNdEx = preIndex
-			skippy, err := skipKvrpcpb(dAtA[iNdEx:])
-			if err != nil {
+			if err := m.Scope.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
 				return err
 			}
-			if skippy < 0 {
-				return ErrInvalidLengthKvrpcpb
-			}
-			if (iNdEx + skippy) > l {
-				return io.ErrUnexpectedEOF
-			}
-			iNdEx += skippy
-		}
-	}
-
-	if iNdEx > l {
-		return io.ErrUnexpectedEOF
-	}
-	return nil
-}
-func (m *DsInsertRequest) Unmarshal(dAtA []byte) error {
-	l := len(dAtA)
-	iNdEx := 0
-	for iNdEx < l {
-		preIndex := iNdEx
-		var wire uint64
-		for shift := uint(0); ; shift += 7 {
-			if shift >= 64 {
-				return ErrIntOverflowKvrpcpb
-			}
-			if iNdEx >= l {
-				return io.ErrUnexpectedEOF
-			}
-			b := dAtA[iNdEx]
-			iNdEx++
-			wire |= (uint64(b) & 0x7F) << shift
-			if b < 0x80 {
-				break
-			}
-		}
-		fieldNum := int32(wire >> 3)
-		wireType := int(wire & 0x7)
-		if wireType == 4 {
-			return fmt.Errorf("proto: DsInsertRequest: wiretype end group for non-group")
-		}
-		if fieldNum <= 0 {
-			return fmt.Errorf("proto: DsInsertRequest: illegal tag %d (wire type %d)", fieldNum, wire)
-		}
-		switch fieldNum {
-		case 1:
+			iNdEx = postIndex
+		case 3:
 			if wireType != 2 {
-				return fmt.Errorf("proto: wrong wireType = %d for field Header", wireType)
+				return fmt.Errorf("proto: wrong wireType = %d for field WhereFilters", wireType)
 			}
 			var msglen int
 			for shift := uint(0); ; shift += 7 {
@@ -11542,16 +13206,76 @@ func (m *DsInsertRequest) Unmarshal(dAtA []byte) error {
 			if postIndex > l {
 				return io.ErrUnexpectedEOF
 			}
-			if m.Header == nil {
-				m.Header = &RequestHeader{}
-			}
-			if err := m.Header.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
+			m.WhereFilters = append(m.WhereFilters, &Match{})
+			if err := m.WhereFilters[len(m.WhereFilters)-1].Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
 				return err
 			}
 			iNdEx = postIndex
-		case 2:
+		case 4:
+			if wireType == 0 {
+				var v uint64
+				for shift := uint(0); ; shift += 7 {
+					if shift >= 64 {
+						return ErrIntOverflowKvrpcpb
+					}
+					if iNdEx >= l {
+						return io.ErrUnexpectedEOF
+					}
+					b := dAtA[iNdEx]
+					iNdEx++
+					v |= (uint64(b) & 0x7F) << shift
+					if b < 0x80 {
+						break
+					}
+				}
+				m.Indexs = append(m.Indexs, v)
+			} else if wireType == 2 {
+				var packedLen int
+				for shift := uint(0); ; shift += 7 {
+					if shift >= 64 {
+						return ErrIntOverflowKvrpcpb
+					}
+					if iNdEx >= l {
+						return io.ErrUnexpectedEOF
+					}
+					b := dAtA[iNdEx]
+					iNdEx++
+					packedLen |= (int(b) & 0x7F) << shift
+					if b < 0x80 {
+						break
+					}
+				}
+				if packedLen < 0 {
+					return ErrInvalidLengthKvrpcpb
+				}
+				postIndex := iNdEx + packedLen
+				if postIndex > l {
+					return io.ErrUnexpectedEOF
+				}
+				for iNdEx < postIndex {
+					var v uint64
+					for shift := uint(0); ; shift += 7 {
+						if shift >= 64 {
+							return ErrIntOverflowKvrpcpb
+						}
+						if iNdEx >= l {
+							return io.ErrUnexpectedEOF
+						}
+						b := dAtA[iNdEx]
+						iNdEx++
+						v |= (uint64(b) & 0x7F) << shift
+						if b < 0x80 {
+							break
+						}
+					}
+					m.Indexs = append(m.Indexs, v)
+				}
+			} else {
+				return fmt.Errorf("proto: wrong wireType = %d for field Indexs", wireType)
+			}
+		case 10:
 			if wireType != 2 {
-				return fmt.Errorf("proto: wrong wireType = %d for field Req", wireType)
+				return fmt.Errorf("proto: wrong wireType = %d for field Timestamp", wireType)
 			}
 			var msglen int
 			for shift := uint(0); ; shift += 7 {
@@ -11575,10 +13299,10 @@ func (m *DsInsertRequest) Unmarshal(dAtA []byte) error {
 			if postIndex > l {
 				return io.ErrUnexpectedEOF
 			}
-			if m.Req == nil {
-				m.Req = &InsertRequest{}
+			if m.Timestamp == nil {
+				m.Timestamp = &timestamp.Timestamp{}
 			}
-			if err := m.Req.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
+			if err := m.Timestamp.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
 				return err
 			}
 			iNdEx = postIndex
@@ -11603,7 +13327,7 @@ func (m *DsInsertRequest) Unmarshal(dAtA []byte) error {
 	}
 	return nil
 }
-func (m *DsInsertResponse) Unmarshal(dAtA []byte) error {
+func (m *DeleteResponse) Unmarshal(dAtA []byte) error {
 	l := len(dAtA)
 	iNdEx := 0
 	for iNdEx < l {
@@ -11626,17 +13350,17 @@ func (m *DsInsertResponse) Unmarshal(dAtA []byte) error {
 		fieldNum := int32(wire >> 3)
 		wireType := int(wire & 0x7)
 		if wireType == 4 {
-			return fmt.Errorf("proto: DsInsertResponse: wiretype end group for non-group")
+			return fmt.Errorf("proto: DeleteResponse: wiretype end group for non-group")
 		}
 		if fieldNum <= 0 {
-			return fmt.Errorf("proto: DsInsertResponse: illegal tag %d (wire type %d)", fieldNum, wire)
+			return fmt.Errorf("proto: DeleteResponse: illegal tag %d (wire type %d)", fieldNum, wire)
 		}
 		switch fieldNum {
 		case 1:
-			if wireType != 2 {
-				return fmt.Errorf("proto: wrong wireType = %d for field Header", wireType)
+			if wireType != 0 {
+				return fmt.Errorf("proto: wrong wireType = %d for field Code", wireType)
 			}
-			var msglen int
+			m.Code = 0
 			for shift := uint(0); ; shift += 7 {
 				if shift >= 64 {
 					return ErrIntOverflowKvrpcpb
@@ -11646,30 +13370,16 @@ func (m *DsInsertResponse) Unmarshal(dAtA []byte) error {
 				}
 				b := dAtA[iNdEx]
 				iNdEx++
-				msglen |= (int(b) & 0x7F) << shift
+				m.Code |= (int32(b) & 0x7F) << shift
 				if b < 0x80 {
 					break
 				}
 			}
-			if msglen < 0 {
-				return ErrInvalidLengthKvrpcpb
-			}
-			postIndex := iNdEx + msglen
-			if postIndex > l {
-				return io.ErrUnexpectedEOF
-			}
-			if m.Header == nil {
-				m.Header = &ResponseHeader{}
-			}
-			if err := m.Header.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
-				return err
-			}
-			iNdEx = postIndex
 		case 2:
-			if wireType != 2 {
-				return fmt.Errorf("proto: wrong wireType = %d for field Resp", wireType)
+			if wireType != 0 {
+				return fmt.Errorf("proto: wrong wireType = %d for field AffectedKeys", wireType)
 			}
-			var msglen int
+			m.AffectedKeys = 0
 			for shift := uint(0); ; shift += 7 {
 				if shift >= 64 {
 					return ErrIntOverflowKvrpcpb
@@ -11679,25 +13389,11 @@ func (m *DsInsertResponse) Unmarshal(dAtA []byte) error {
 				}
 				b := dAtA[iNdEx]
 				iNdEx++
-				msglen |= (int(b) & 0x7F) << shift
+				m.AffectedKeys |= (uint64(b) & 0x7F) << shift
 				if b < 0x80 {
 					break
 				}
 			}
-			if msglen < 0 {
-				return ErrInvalidLengthKvrpcpb
-			}
-			postIndex := iNdEx + msglen
-			if postIndex > l {
-				return io.ErrUnexpectedEOF
-			}
-			if m.Resp == nil {
-				m.Resp = &InsertResponse{}
-			}
-			if err := m.Resp.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
-				return err
-			}
-			iNdEx = postIndex
 		default:
 			iNdEx = preIndex
 			skippy, err := skipKvrpcpb(dAtA[iNdEx:])
@@ -11719,7 +13415,7 @@ func (m *DsInsertResponse) Unmarshal(dAtA []byte) error {
 	}
 	return nil
 }
-func (m *InsertRequest) Unmarshal(dAtA []byte) error {
+func (m *Field) Unmarshal(dAtA []byte) error {
 	l := len(dAtA)
 	iNdEx := 0
 	for iNdEx < l {
@@ -11742,48 +13438,17 @@ func (m *InsertRequest) Unmarshal(dAtA []byte) error {
 		fieldNum := int32(wire >> 3)
 		wireType := int(wire & 0x7)
 		if wireType == 4 {
-			return fmt.Errorf("proto: InsertRequest: wiretype end group for non-group")
+			return fmt.Errorf("proto: Field: wiretype end group for non-group")
 		}
 		if fieldNum <= 0 {
-			return fmt.Errorf("proto: InsertRequest: illegal tag %d (wire type %d)", fieldNum, wire)
+			return fmt.Errorf("proto: Field: illegal tag %d (wire type %d)", fieldNum, wire)
 		}
 		switch fieldNum {
 		case 1:
-			if wireType != 2 {
-				return fmt.Errorf("proto: wrong wireType = %d for field Rows", wireType)
-			}
-			var msglen int
-			for shift := uint(0); ; shift += 7 {
-				if shift >= 64 {
-					return ErrIntOverflowKvrpcpb
-				}
-				if iNdEx >= l {
-					return io.ErrUnexpectedEOF
-				}
-				b := dAtA[iNdEx]
-				iNdEx++
-				msglen |= (int(b) & 0x7F) << shift
-				if b < 0x80 {
-					break
-				}
-			}
-			if msglen < 0 {
-				return ErrInvalidLengthKvrpcpb
-			}
-			postIndex := iNdEx + msglen
-			if postIndex > l {
-				return io.ErrUnexpectedEOF
-			}
-			m.Rows = append(m.Rows, &KeyValue{})
-			if err := m.Rows[len(m.Rows)-1].Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
-				return err
-			}
-			iNdEx = postIndex
-		case 2:
 			if wireType != 0 {
-				return fmt.Errorf("proto: wrong wireType = %d for field CheckDuplicate", wireType)
+				return fmt.Errorf("proto: wrong wireType = %d for field ColumnId", wireType)
 			}
-			var v int
+			m.ColumnId = 0
 			for shift := uint(0); ; shift += 7 {
 				if shift >= 64 {
 					return ErrIntOverflowKvrpcpb
@@ -11793,17 +13458,16 @@ func (m *InsertRequest) Unmarshal(dAtA []byte) error {
 				}
 				b := dAtA[iNdEx]
 				iNdEx++
-				v |= (int(b) & 0x7F) << shift
+				m.ColumnId |= (uint64(b) & 0x7F) << shift
 				if b < 0x80 {
 					break
 				}
 			}
-			m.CheckDuplicate = bool(v != 0)
-		case 3:
+		case 2:
 			if wireType != 2 {
-				return fmt.Errorf("proto: wrong wireType = %d for field Timestamp", wireType)
+				return fmt.Errorf("proto: wrong wireType = %d for field Value", wireType)
 			}
-			var msglen int
+			var byteLen int
 			for shift := uint(0); ; shift += 7 {
 				if shift >= 64 {
 					return ErrIntOverflowKvrpcpb
@@ -11813,23 +13477,21 @@ func (m *InsertRequest) Unmarshal(dAtA []byte) error {
 				}
 				b := dAtA[iNdEx]
 				iNdEx++
-				msglen |= (int(b) & 0x7F) << shift
+				byteLen |= (int(b) & 0x7F) << shift
 				if b < 0x80 {
 					break
 				}
 			}
-			if msglen < 0 {
+			if byteLen < 0 {
 				return ErrInvalidLengthKvrpcpb
 			}
-			postIndex := iNdEx + msglen
+			postIndex := iNdEx + byteLen
 			if postIndex > l {
 				return io.ErrUnexpectedEOF
 			}
-			if m.Timestamp == nil {
-				m.Timestamp = &timestamp.Timestamp{}
-			}
-			if err := m.Timestamp.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
-				return err
+			m.Value = append(m.Value[:0], dAtA[iNdEx:postIndex]...)
+			if m.Value == nil {
+				m.Value = []byte{}
 			}
 			iNdEx = postIndex
 		default:
@@ -11853,7 +13515,7 @@ func (m *InsertRequest) Unmarshal(dAtA []byte) error {
 	}
 	return nil
 }
-func (m *InsertResponse) Unmarshal(dAtA []byte) error {
+func (m *RedisKeyValue) Unmarshal(dAtA []byte) error {
 	l := len(dAtA)
 	iNdEx := 0
 	for iNdEx < l {
@@ -11876,17 +13538,17 @@ func (m *InsertResponse) Unmarshal(dAtA []byte) error {
 		fieldNum := int32(wire >> 3)
 		wireType := int(wire & 0x7)
 		if wireType == 4 {
-			return fmt.Errorf("proto: InsertResponse: wiretype end group for non-group")
+			return fmt.Errorf("proto: RedisKeyValue: wiretype end group for non-group")
 		}
 		if fieldNum <= 0 {
-			return fmt.Errorf("proto: InsertResponse: illegal tag %d (wire type %d)", fieldNum, wire)
+			return fmt.Errorf("proto: RedisKeyValue: illegal tag %d (wire type %d)", fieldNum, wire)
 		}
 		switch fieldNum {
 		case 1:
-			if wireType != 0 {
-				return fmt.Errorf("proto: wrong wireType = %d for field Code", wireType)
+			if wireType != 2 {
+				return fmt.Errorf("proto: wrong wireType = %d for field Key", wireType)
 			}
-			m.Code = 0
+			var byteLen int
 			for shift := uint(0); ; shift += 7 {
 				if shift >= 64 {
 					return ErrIntOverflowKvrpcpb
@@ -11896,33 +13558,26 @@ func (m *InsertResponse) Unmarshal(dAtA []byte) error {
 				}
 				b := dAtA[iNdEx]
 				iNdEx++
-				m.Code |= (int32(b) & 0x7F) << shift
+				byteLen |= (int(b) & 0x7F) << shift
 				if b < 0x80 {
 					break
 				}
 			}
-		case 2:
-			if wireType != 0 {
-				return fmt.Errorf("proto: wrong wireType = %d for field AffectedKeys", wireType)
+			if byteLen < 0 {
+				return ErrInvalidLengthKvrpcpb
 			}
-			m.AffectedKeys = 0
-			for shift := uint(0); ; shift += 7 {
-				if shift >= 64 {
-					return ErrIntOverflowKvrpcpb
-				}
-				if iNdEx >= l {
-					return io.ErrUnexpectedEOF
-				}
-				b := dAtA[iNdEx]
-				iNdEx++
-				m.AffectedKeys |= (uint64(b) & 0x7F) << shift
-				if b < 0x80 {
-					break
-				}
+			postIndex := iNdEx + byteLen
+			if postIndex > l {
+				return io.ErrUnexpectedEOF
 			}
-		case 3:
+			m.Key = append(m.Key[:0], dAtA[iNdEx:postIndex]...)
+			if m.Key == nil {
+				m.Key = []byte{}
+			}
+			iNdEx = postIndex
+		case 2:
 			if wireType != 2 {
-				return fmt.Errorf("proto: wrong wireType = %d for field DuplicateKey", wireType)
+				return fmt.Errorf("proto: wrong wireType = %d for field Value", wireType)
 			}
 			var byteLen int
 			for shift := uint(0); ; shift += 7 {
@@ -11946,9 +13601,9 @@ func (m *InsertResponse) Unmarshal(dAtA []byte) error {
 			if postIndex > l {
 				return io.ErrUnexpectedEOF
 			}
-			m.DuplicateKey = append(m.DuplicateKey[:0], dAtA[iNdEx:postIndex]...)
-			if m.DuplicateKey == nil {
-				m.DuplicateKey = []byte{}
+			m.Value = append(m.Value[:0], dAtA[iNdEx:postIndex]...)
+			if m.Value == nil {
+				m.Value = []byte{}
 			}
 			iNdEx = postIndex
 		default:
@@ -11972,7 +13627,7 @@ func (m *InsertResponse) Unmarshal(dAtA []byte) error {
 	}
 	return nil
 }
-func (m *BatchInsertRequest) Unmarshal(dAtA []byte) error {
+func (m *RedisDo) Unmarshal(dAtA []byte) error {
 	l := len(dAtA)
 	iNdEx := 0
 	for iNdEx < l {
@@ -11995,17 +13650,17 @@ func (m *BatchInsertRequest) Unmarshal(dAtA []byte) error {
 		fieldNum := int32(wire >> 3)
 		wireType := int(wire & 0x7)
 		if wireType == 4 {
-			return fmt.Errorf("proto: BatchInsertRequest: wiretype end group for non-group")
+			return fmt.Errorf("proto: RedisDo: wiretype end group for non-group")
 		}
 		if fieldNum <= 0 {
-			return fmt.Errorf("proto: BatchInsertRequest: illegal tag %d (wire type %d)", fieldNum, wire)
+			return fmt.Errorf("proto: RedisDo: illegal tag %d (wire type %d)", fieldNum, wire)
 		}
 		switch fieldNum {
 		case 1:
 			if wireType != 2 {
-				return fmt.Errorf("proto: wrong wireType = %d for field Reqs", wireType)
+				return fmt.Errorf("proto: wrong wireType = %d for field Key", wireType)
 			}
-			var msglen int
+			var byteLen int
 			for shift := uint(0); ; shift += 7 {
 				if shift >= 64 {
 					return ErrIntOverflowKvrpcpb
@@ -12015,23 +13670,92 @@ func (m *BatchInsertRequest) Unmarshal(dAtA []byte) error {
 				}
 				b := dAtA[iNdEx]
 				iNdEx++
-				msglen |= (int(b) & 0x7F) << shift
+				byteLen |= (int(b) & 0x7F) << shift
 				if b < 0x80 {
 					break
 				}
 			}
-			if msglen < 0 {
+			if byteLen < 0 {
 				return ErrInvalidLengthKvrpcpb
 			}
-			postIndex := iNdEx + msglen
+			postIndex := iNdEx + byteLen
 			if postIndex > l {
 				return io.ErrUnexpectedEOF
 			}
-			m.Reqs = append(m.Reqs, &InsertRequest{})
-			if err := m.Reqs[len(m.Reqs)-1].Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
-				return err
+			m.Key = append(m.Key[:0], dAtA[iNdEx:postIndex]...)
+			if m.Key == nil {
+				m.Key = []byte{}
+			}
+			iNdEx = postIndex
+		case 2:
+			if wireType != 2 {
+				return fmt.Errorf("proto: wrong wireType = %d for field Value", wireType)
+			}
+			var byteLen int
+			for shift := uint(0); ; shift += 7 {
+				if shift >= 64 {
+					return ErrIntOverflowKvrpcpb
+				}
+				if iNdEx >= l {
+					return io.ErrUnexpectedEOF
+				}
+				b := dAtA[iNdEx]
+				iNdEx++
+				byteLen |= (int(b) & 0x7F) << shift
+				if b < 0x80 {
+					break
+				}
+			}
+			if byteLen < 0 {
+				return ErrInvalidLengthKvrpcpb
+			}
+			postIndex := iNdEx + byteLen
+			if postIndex > l {
+				return io.ErrUnexpectedEOF
+			}
+			m.Value = append(m.Value[:0], dAtA[iNdEx:postIndex]...)
+			if m.Value == nil {
+				m.Value = []byte{}
 			}
 			iNdEx = postIndex
+		case 3:
+			if wireType != 0 {
+				return fmt.Errorf("proto: wrong wireType = %d for field Op", wireType)
+			}
+			m.Op = 0
+			for shift := uint(0); ; shift += 7 {
+				if shift >= 64 {
+					return ErrIntOverflowKvrpcpb
+				}
+				if iNdEx >= l {
+					return io.ErrUnexpectedEOF
+				}
+				b := dAtA[iNdEx]
+				iNdEx++
+				m.Op |= (Operation(b) & 0x7F) << shift
+				if b < 0x80 {
+					break
+				}
+			}
+		case 4:
+			if wireType != 0 {
+				return fmt.Errorf("proto: wrong wireType = %d for field Case", wireType)
+			}
+			m.Case = 0
+			for shift := uint(0); ; shift += 7 {
+				if shift >= 64 {
+					return ErrIntOverflowKvrpcpb
+				}
+				if iNdEx >= l {
+					return io.ErrUnexpectedEOF
+				}
+				b := dAtA[iNdEx]
+				iNdEx++
+				m.Case |= (ExistCase(b) & 0x7F) << shift
+				if b < 0x80 {
+					break
+				}
+			}
 		default:
 			iNdEx = preIndex
 			skippy, err := skipKvrpcpb(dAtA[iNdEx:])
@@ -12053,7 +13777,7 @@ func (m *BatchInsertRequest) Unmarshal(dAtA []byte) error {
 	}
 	return nil
 }
-func (m *BatchInsertResponse) Unmarshal(dAtA []byte) error {
+func (m *KvSetRequest) Unmarshal(dAtA []byte) error {
 	l := len(dAtA)
 	iNdEx := 0
 	for iNdEx < l {
@@ -12076,15 +13800,15 @@ func (m *BatchInsertResponse) Unmarshal(dAtA []byte) error {
 		fieldNum := int32(wire >> 3)
 		wireType := int(wire & 0x7)
 		if wireType == 4 {
-			return fmt.Errorf("proto: BatchInsertResponse: wiretype end group for non-group")
+			return fmt.Errorf("proto: KvSetRequest: wiretype end group for non-group")
 		}
 		if fieldNum <= 0 {
-			return fmt.Errorf("proto: BatchInsertResponse: illegal tag %d (wire type %d)", fieldNum, wire)
+			return fmt.Errorf("proto: KvSetRequest: illegal tag %d (wire type %d)", fieldNum, wire)
 		}
 		switch fieldNum {
-		case 2:
+		case 1:
 			if wireType != 2 {
-				return fmt.Errorf("proto: wrong wireType = %d for field Resps", wireType)
+				return fmt.Errorf("proto: wrong wireType = %d for field Kv", wireType)
 			}
 			var msglen int
 			for shift := uint(0); ; shift += 7 {
@@ -12108,11 +13832,32 @@ func (m *BatchInsertResponse) Unmarshal(dAtA []byte) error {
 			if postIndex > l {
 				return io.ErrUnexpectedEOF
 			}
-			m.Resps = append(m.Resps, &InsertResponse{})
-			if err := m.Resps[len(m.Resps)-1].Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
+			if m.Kv == nil {
+				m.Kv = &RedisKeyValue{}
+			}
+			if err := m.Kv.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
 				return err
 			}
-			iNdEx = postIndex
+			iNdEx = postIndex
+		case 2:
+			if wireType != 0 {
+				return fmt.Errorf("proto: wrong wireType = %d for field Case", wireType)
+			}
+			m.Case = 0
+			for shift := uint(0); ; shift += 7 {
+				if shift >= 64 {
+					return ErrIntOverflowKvrpcpb
+				}
+				if iNdEx >= l {
+					return io.ErrUnexpectedEOF
+				}
+				b := dAtA[iNdEx]
+				iNdEx++
+				m.Case |= (ExistCase(b) & 0x7F) << shift
+				if b < 0x80 {
+					break
+				}
+			}
 		default:
 			iNdEx = preIndex
 			skippy, err := skipKvrpcpb(dAtA[iNdEx:])
@@ -12134,7 +13879,7 @@ func (m *BatchInsertResponse) Unmarshal(dAtA []byte) error {
 	}
 	return nil
 }
-func (m *DsDeleteRequest) Unmarshal(dAtA []byte) error {
+func (m *KvSetResponse) Unmarshal(dAtA []byte) error {
 	l := len(dAtA)
 	iNdEx := 0
 	for iNdEx < l {
@@ -12157,17 +13902,17 @@ func (m *DsDeleteRequest) Unmarshal(dAtA []byte) error {
 		fieldNum := int32(wire >> 3)
 		wireType := int(wire & 0x7)
 		if wireType == 4 {
-			return fmt.Errorf("proto: DsDeleteRequest: wiretype end group for non-group")
+			return fmt.Errorf("proto: KvSetResponse: wiretype end group for non-group")
 		}
 		if fieldNum <= 0 {
-			return fmt.Errorf("proto: DsDeleteRequest: illegal tag %d (wire type %d)", fieldNum, wire)
+			return fmt.Errorf("proto: KvSetResponse: illegal tag %d (wire type %d)", fieldNum, wire)
 		}
 		switch fieldNum {
 		case 1:
-			if wireType != 2 {
-				return fmt.Errorf("proto: wrong wireType = %d for field Header", wireType)
+			if wireType != 0 {
+				return fmt.Errorf("proto: wrong wireType = %d for field Code", wireType)
 			}
-			var msglen int
+			m.Code = 0
 			for shift := uint(0); ; shift += 7 {
 				if shift >= 64 {
 					return ErrIntOverflowKvrpcpb
@@ -12177,30 +13922,16 @@ func (m *DsDeleteRequest) Unmarshal(dAtA []byte) error {
 				}
 				b := dAtA[iNdEx]
 				iNdEx++
-				msglen |= (int(b) & 0x7F) << shift
+				m.Code |= (int32(b) & 0x7F) << shift
 				if b < 0x80 {
 					break
 				}
 			}
-			if msglen < 0 {
-				return ErrInvalidLengthKvrpcpb
-			}
-			postIndex := iNdEx + msglen
-			if postIndex > l {
-				return io.ErrUnexpectedEOF
-			}
-			if m.Header == nil {
-				m.Header = &RequestHeader{}
-			}
-			if err := m.Header.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
-				return err
-			}
-			iNdEx = postIndex
 		case 2:
-			if wireType != 2 {
-				return fmt.Errorf("proto: wrong wireType = %d for field Req", wireType)
+			if wireType != 0 {
+				return fmt.Errorf("proto: wrong wireType = %d for field AffectedKeys", wireType)
 			}
-			var msglen int
+			m.AffectedKeys = 0
 			for shift := uint(0); ; shift += 7 {
 				if shift >= 64 {
 					return ErrIntOverflowKvrpcpb
@@ -12210,25 +13941,11 @@ func (m *DsDeleteRequest) Unmarshal(dAtA []byte) error {
 				}
 				b := dAtA[iNdEx]
 				iNdEx++
-				msglen |= (int(b) & 0x7F) << shift
+				m.AffectedKeys |= (uint64(b) & 0x7F) << shift
 				if b < 0x80 {
 					break
 				}
 			}
-			if msglen < 0 {
-				return ErrInvalidLengthKvrpcpb
-			}
-			postIndex := iNdEx + msglen
-			if postIndex > l {
-				return io.ErrUnexpectedEOF
-			}
-			if m.Req == nil {
-				m.Req = &DeleteRequest{}
-			}
-			if err := m.Req.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
-				return err
-			}
-			iNdEx = postIndex
 		default:
 			iNdEx = preIndex
 			skippy, err := skipKvrpcpb(dAtA[iNdEx:])
@@ -12250,7 +13967,7 @@ func (m *DsDeleteRequest) Unmarshal(dAtA []byte) error {
 	}
 	return nil
 }
-func (m *DsDeleteResponse) Unmarshal(dAtA []byte) error {
+func (m *DsKvSetRequest) Unmarshal(dAtA []byte) error {
 	l := len(dAtA)
 	iNdEx := 0
 	for iNdEx < l {
@@ -12273,10 +13990,10 @@ func (m *DsDeleteResponse) Unmarshal(dAtA []byte) error {
 		fieldNum := int32(wire >> 3)
 		wireType := int(wire & 0x7)
 		if wireType == 4 {
-			return fmt.Errorf("proto: DsDeleteResponse: wiretype end group for non-group")
+			return fmt.Errorf("proto: DsKvSetRequest: wiretype end group for non-group")
 		}
 		if fieldNum <= 0 {
-			return fmt.Errorf("proto: DsDeleteResponse: illegal tag %d (wire type %d)", fieldNum, wire)
+			return fmt.Errorf("proto: DsKvSetRequest: illegal tag %d (wire type %d)", fieldNum, wire)
 		}
 		switch fieldNum {
 		case 1:
@@ -12306,7 +14023,7 @@ func (m *DsDeleteResponse) Unmarshal(dAtA []byte) error {
 				return io.ErrUnexpectedEOF
 			}
 			if m.Header == nil {
-				m.Header = &ResponseHeader{}
+				m.Header = &RequestHeader{}
 			}
 			if err := m.Header.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
 				return err
@@ -12314,7 +14031,7 @@ func (m *DsDeleteResponse) Unmarshal(dAtA []byte) error {
 			iNdEx = postIndex
 		case 2:
 			if wireType != 2 {
-				return fmt.Errorf("proto: wrong wireType = %d for field Resp", wireType)
+				return fmt.Errorf("proto: wrong wireType = %d for field Req", wireType)
 			}
 			var msglen int
 			for shift := uint(0); ; shift += 7 {
@@ -12338,10 +14055,10 @@ func (m *DsDeleteResponse) Unmarshal(dAtA []byte) error {
 			if postIndex > l {
 				return io.ErrUnexpectedEOF
 			}
-			if m.Resp == nil {
-				m.Resp = &DeleteResponse{}
+			if m.Req == nil {
+				m.Req = &KvSetRequest{}
 			}
-			if err := m.Resp.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
+			if err := m.Req.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
 				return err
 			}
 			iNdEx = postIndex
@@ -12366,7 +14083,7 @@ func (m *DsDeleteResponse) Unmarshal(dAtA []byte) error {
 	}
 	return nil
 }
-func (m *DeleteRequest) Unmarshal(dAtA []byte) error {
+func (m *DsKvSetResponse) Unmarshal(dAtA []byte) error {
 	l := len(dAtA)
 	iNdEx := 0
 	for iNdEx < l {
@@ -12389,46 +14106,15 @@ func (m *DeleteRequest) Unmarshal(dAtA []byte) error {
 		fieldNum := int32(wire >> 3)
 		wireType := int(wire & 0x7)
 		if wireType == 4 {
-			return fmt.Errorf("proto: DeleteRequest: wiretype end group for non-group")
+			return fmt.Errorf("proto: DsKvSetResponse: wiretype end group for non-group")
 		}
 		if fieldNum <= 0 {
-			return fmt.Errorf("proto: DeleteRequest: illegal tag %d (wire type %d)", fieldNum, wire)
+			return fmt.Errorf("proto: DsKvSetResponse: illegal tag %d (wire type %d)", fieldNum, wire)
 		}
 		switch fieldNum {
 		case 1:
 			if wireType != 2 {
-				return fmt.Errorf("proto: wrong wireType = %d for field Key", wireType)
-			}
-			var byteLen int
-			for shift := uint(0); ; shift += 7 {
-				if shift >= 64 {
-					return ErrIntOverflowKvrpcpb
-				}
-				if iNdEx >= l {
-					return io.ErrUnexpectedEOF
-				}
-				b := dAtA[iNdEx]
-				iNdEx++
-				byteLen |= (int(b) & 0x7F) << shift
-				if b < 0x80 {
-					break
-				}
-			}
-			if byteLen < 0 {
-				return ErrInvalidLengthKvrpcpb
-			}
-			postIndex := iNdEx + byteLen
-			if postIndex > l {
-				return io.ErrUnexpectedEOF
-			}
-			m.Key = append(m.Key[:0], dAtA[iNdEx:postIndex]...)
-			if m.Key == nil {
-				m.Key = []byte{}
-			}
-			iNdEx = postIndex
-		case 2:
-			if wireType != 2 {
-				return fmt.Errorf("proto: wrong wireType = %d for field Scope", wireType)
+				return fmt.Errorf("proto: wrong wireType = %d for field Header", wireType)
 			}
 			var msglen int
 			for shift := uint(0); ; shift += 7 {
@@ -12452,109 +14138,16 @@ func (m *DeleteRequest) Unmarshal(dAtA []byte) error {
 			if postIndex > l {
 				return io.ErrUnexpectedEOF
 			}
-			if m.Scope == nil {
-				m.Scope = &Scope{}
-			}
-			if err := m.Scope.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
-				return err
-			}
-			iNdEx = postIndex
-		case 3:
-			if wireType != 2 {
-				return fmt.Errorf("proto: wrong wireType = %d for field WhereFilters", wireType)
-			}
-			var msglen int
-			for shift := uint(0); ; shift += 7 {
-				if shift >= 64 {
-					return ErrIntOverflowKvrpcpb
-				}
-				if iNdEx >= l {
-					return io.ErrUnexpectedEOF
-				}
-				b := dAtA[iNdEx]
-				iNdEx++
-				msglen |= (int(b) & 0x7F) << shift
-				if b < 0x80 {
-					break
-				}
-			}
-			if msglen < 0 {
-				return ErrInvalidLengthKvrpcpb
-			}
-			postIndex := iNdEx + msglen
-			if postIndex > l {
-				return io.ErrUnexpectedEOF
+			if m.Header == nil {
+				m.Header = &ResponseHeader{}
 			}
-			m.WhereFilters = append(m.WhereFilters, &Match{})
-			if err := m.WhereFilters[len(m.WhereFilters)-1].Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
+			if err := m.Header.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
 				return err
 			}
 			iNdEx = postIndex
-		case 4:
-			if wireType == 0 {
-				var v uint64
-				for shift := uint(0); ; shift += 7 {
-					if shift >= 64 {
-						return ErrIntOverflowKvrpcpb
-					}
-					if iNdEx >= l {
-						return io.ErrUnexpectedEOF
-					}
-					b := dAtA[iNdEx]
-					iNdEx++
-					v |= (uint64(b) & 0x7F) << shift
-					if b < 0x80 {
-						break
-					}
-				}
-				m.Indexs = append(m.Indexs, v)
-			} else if wireType == 2 {
-				var packedLen int
-				for shift := uint(0); ; shift += 7 {
-					if shift >= 64 {
-						return ErrIntOverflowKvrpcpb
-					}
-					if iNdEx >= l {
-						return io.ErrUnexpectedEOF
-					}
-					b := dAtA[iNdEx]
-					iNdEx++
-					packedLen |= (int(b) & 0x7F) << shift
-					if b < 0x80 {
-						break
-					}
-				}
-				if packedLen < 0 {
-					return ErrInvalidLengthKvrpcpb
-				}
-				postIndex := iNdEx + packedLen
-				if postIndex > l {
-					return io.ErrUnexpectedEOF
-				}
-				for iNdEx < postIndex {
-					var v uint64
-					for shift := uint(0); ; shift += 7 {
-						if shift >= 64 {
-							return ErrIntOverflowKvrpcpb
-						}
-						if iNdEx >= l {
-							return io.ErrUnexpectedEOF
-						}
-						b := dAtA[iNdEx]
-						iNdEx++
-						v |= (uint64(b) & 0x7F) << shift
-						if b < 0x80 {
-							break
-						}
-					}
-					m.Indexs = append(m.Indexs, v)
-				}
-			} else {
-				return fmt.Errorf("proto: wrong wireType = %d for field Indexs", wireType)
-			}
-		case 10:
+		case 2:
 			if wireType != 2 {
-				return fmt.Errorf("proto: wrong wireType = %d for field Timestamp", wireType)
+				return fmt.Errorf("proto: wrong wireType = %d for field Resp", wireType)
 			}
 			var msglen int
 			for shift := uint(0); ; shift += 7 {
@@ -12578,10 +14171,10 @@ func (m *DeleteRequest) Unmarshal(dAtA []byte) error {
 			if postIndex > l {
 				return io.ErrUnexpectedEOF
 			}
-			if m.Timestamp == nil {
-				m.Timestamp = &timestamp.Timestamp{}
+			if m.Resp == nil {
+				m.Resp = &KvSetResponse{}
 			}
-			if err := m.Timestamp.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
+			if err := m.Resp.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
 				return err
 			}
 			iNdEx = postIndex
@@ -12606,7 +14199,7 @@ func (m *DeleteRequest) Unmarshal(dAtA []byte) error {
 	}
 	return nil
 }
-func (m *DeleteResponse) Unmarshal(dAtA []byte) error {
+func (m *KvGetRequest) Unmarshal(dAtA []byte) error {
 	l := len(dAtA)
 	iNdEx := 0
 	for iNdEx < l {
@@ -12629,17 +14222,17 @@ func (m *DeleteResponse) Unmarshal(dAtA []byte) error {
 		fieldNum := int32(wire >> 3)
 		wireType := int(wire & 0x7)
 		if wireType == 4 {
-			return fmt.Errorf("proto: DeleteResponse: wiretype end group for non-group")
+			return fmt.Errorf("proto: KvGetRequest: wiretype end group for non-group")
 		}
 		if fieldNum <= 0 {
-			return fmt.Errorf("proto: DeleteResponse: illegal tag %d (wire type %d)", fieldNum, wire)
+			return fmt.Errorf("proto: KvGetRequest: illegal tag %d (wire type %d)", fieldNum, wire)
 		}
 		switch fieldNum {
 		case 1:
-			if wireType != 0 {
-				return fmt.Errorf("proto: wrong wireType = %d for field Code", wireType)
+			if wireType != 2 {
+				return fmt.Errorf("proto: wrong wireType = %d for field Key", wireType)
 			}
-			m.Code = 0
+			var byteLen int
 			for shift := uint(0); ; shift += 7 {
 				if shift >= 64 {
 					return ErrIntOverflowKvrpcpb
@@ -12649,30 +14242,23 @@ func (m *DeleteResponse) Unmarshal(dAtA []byte) error {
 				}
 				b := dAtA[iNdEx]
 				iNdEx++
-				m.Code |= (int32(b) & 0x7F) << shift
+				byteLen |= (int(b) & 0x7F) << shift
 				if b < 0x80 {
 					break
 				}
 			}
-		case 2:
-			if wireType != 0 {
-				return fmt.Errorf("proto: wrong wireType = %d for field AffectedKeys", wireType)
+			if byteLen < 0 {
+				return ErrInvalidLengthKvrpcpb
 			}
-			m.AffectedKeys = 0
-			for shift := uint(0); ; shift += 7 {
-				if shift >= 64 {
-					return ErrIntOverflowKvrpcpb
-				}
-				if iNdEx >= l {
-					return io.ErrUnexpectedEOF
-				}
-				b := dAtA[iNdEx]
-				iNdEx++
-				m.AffectedKeys |= (uint64(b) & 0x7F) << shift
-				if b < 0x80 {
-					break
-				}
+			postIndex := iNdEx + byteLen
+			if postIndex > l {
+				return io.ErrUnexpectedEOF
+			}
+			m.Key = append(m.Key[:0], dAtA[iNdEx:postIndex]...)
+			if m.Key == nil {
+				m.Key = []byte{}
 			}
+			iNdEx = postIndex
 		default:
 			iNdEx = preIndex
 			skippy, err := skipKvrpcpb(dAtA[iNdEx:])
@@ -12694,7 +14280,7 @@ func (m *DeleteResponse) Unmarshal(dAtA []byte) error {
 	}
 	return nil
 }
-func (m *Field) Unmarshal(dAtA []byte) error {
+func (m *KvGetResponse) Unmarshal(dAtA []byte) error {
 	l := len(dAtA)
 	iNdEx := 0
 	for iNdEx < l {
@@ -12717,17 +14303,17 @@ func (m *Field) Unmarshal(dAtA []byte) error {
 		fieldNum := int32(wire >> 3)
 		wireType := int(wire & 0x7)
 		if wireType == 4 {
-			return fmt.Errorf("proto: Field: wiretype end group for non-group")
+			return fmt.Errorf("proto: KvGetResponse: wiretype end group for non-group")
 		}
 		if fieldNum <= 0 {
-			return fmt.Errorf("proto: Field: illegal tag %d (wire type %d)", fieldNum, wire)
+			return fmt.Errorf("proto: KvGetResponse: illegal tag %d (wire type %d)", fieldNum, wire)
 		}
 		switch fieldNum {
 		case 1:
 			if wireType != 0 {
-				return fmt.Errorf("proto: wrong wireType = %d for field ColumnId", wireType)
+				return fmt.Errorf("proto: wrong wireType = %d for field Code", wireType)
 			}
-			m.ColumnId = 0
+			m.Code = 0
 			for shift := uint(0); ; shift += 7 {
 				if shift >= 64 {
 					return ErrIntOverflowKvrpcpb
@@ -12737,7 +14323,7 @@ func (m *Field) Unmarshal(dAtA []byte) error {
 				}
 				b := dAtA[iNdEx]
 				iNdEx++
-				m.ColumnId |= (uint64(b) & 0x7F) << shift
+				m.Code |= (int32(b) & 0x7F) << shift
 				if b < 0x80 {
 					break
 				}
@@ -12794,7 +14380,7 @@ func (m *Field) Unmarshal(dAtA []byte) error {
 	}
 	return nil
 }
-func (m *RedisKeyValue) Unmarshal(dAtA []byte) error {
+func (m *DsKvGetRequest) Unmarshal(dAtA []byte) error {
 	l := len(dAtA)
 	iNdEx := 0
 	for iNdEx < l {
@@ -12817,17 +14403,17 @@ func (m *RedisKeyValue) Unmarshal(dAtA []byte) error {
 		fieldNum := int32(wire >> 3)
 		wireType := int(wire & 0x7)
 		if wireType == 4 {
-			return fmt.Errorf("proto: RedisKeyValue: wiretype end group for non-group")
+			return fmt.Errorf("proto: DsKvGetRequest: wiretype end group for non-group")
 		}
 		if fieldNum <= 0 {
-			return fmt.Errorf("proto: RedisKeyValue: illegal tag %d (wire type %d)", fieldNum, wire)
+			return fmt.Errorf("proto: DsKvGetRequest: illegal tag %d (wire type %d)", fieldNum, wire)
 		}
 		switch fieldNum {
 		case 1:
 			if wireType != 2 {
-				return fmt.Errorf("proto: wrong wireType = %d for field Key", wireType)
+				return fmt.Errorf("proto: wrong wireType = %d for field Header", wireType)
 			}
-			var byteLen int
+			var msglen int
 			for shift := uint(0); ; shift += 7 {
 				if shift >= 64 {
 					return ErrIntOverflowKvrpcpb
@@ -12837,28 +14423,30 @@ func (m *RedisKeyValue) Unmarshal(dAtA []byte) error {
 				}
 				b := dAtA[iNdEx]
 				iNdEx++
-				byteLen |= (int(b) & 0x7F) << shift
+				msglen |= (int(b) & 0x7F) << shift
 				if b < 0x80 {
 					break
 				}
 			}
-			if byteLen < 0 {
+			if msglen < 0 {
 				return ErrInvalidLengthKvrpcpb
 			}
-			postIndex := iNdEx + byteLen
+			postIndex := iNdEx + msglen
 			if postIndex > l {
 				return io.ErrUnexpectedEOF
 			}
-			m.Key = append(m.Key[:0], dAtA[iNdEx:postIndex]...)
-			if m.Key == nil {
-				m.Key = []byte{}
+			if m.Header == nil {
+				m.Header = &RequestHeader{}
+			}
+			if err := m.Header.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
+				return err
 			}
 			iNdEx = postIndex
 		case 2:
 			if wireType != 2 {
-				return fmt.Errorf("proto: wrong wireType = %d for field Value", wireType)
+				return fmt.Errorf("proto: wrong wireType = %d for field Req", wireType)
 			}
-			var byteLen int
+			var msglen int
 			for shift := uint(0); ; shift += 7 {
 				if shift >= 64 {
 					return ErrIntOverflowKvrpcpb
@@ -12868,21 +14456,23 @@ func (m *RedisKeyValue) Unmarshal(dAtA []byte) error {
 				}
 				b := dAtA[iNdEx]
 				iNdEx++
-				byteLen |= (int(b) & 0x7F) << shift
+				msglen |= (int(b) & 0x7F) << shift
 				if b < 0x80 {
 					break
 				}
 			}
-			if byteLen < 0 {
+			if msglen < 0 {
 				return ErrInvalidLengthKvrpcpb
 			}
-			postIndex := iNdEx + byteLen
+			postIndex := iNdEx + msglen
 			if postIndex > l {
 				return io.ErrUnexpectedEOF
 			}
-			m.Value = append(m.Value[:0], dAtA[iNdEx:postIndex]...)
-			if m.Value == nil {
-				m.Value = []byte{}
+			if m.Req == nil {
+				m.Req = &KvGetRequest{}
+			}
+			if err := m.Req.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
+				return err
 			}
 			iNdEx = postIndex
 		default:
@@ -12906,7 +14496,7 @@ func (m *RedisKeyValue) Unmarshal(dAtA []byte) error {
 	}
 	return nil
 }
-func (m *RedisDo) Unmarshal(dAtA []byte) error {
+func (m *DsKvGetResponse) Unmarshal(dAtA []byte) error {
 	l := len(dAtA)
 	iNdEx := 0
 	for iNdEx < l {
@@ -12929,17 +14519,17 @@ func (m *RedisDo) Unmarshal(dAtA []byte) error {
 		fieldNum := int32(wire >> 3)
 		wireType := int(wire & 0x7)
 		if wireType == 4 {
-			return fmt.Errorf("proto: RedisDo: wiretype end group for non-group")
+			return fmt.Errorf("proto: DsKvGetResponse: wiretype end group for non-group")
 		}
 		if fieldNum <= 0 {
-			return fmt.Errorf("proto: RedisDo: illegal tag %d (wire type %d)", fieldNum, wire)
+			return fmt.Errorf("proto: DsKvGetResponse: illegal tag %d (wire type %d)", fieldNum, wire)
 		}
 		switch fieldNum {
 		case 1:
 			if wireType != 2 {
-				return fmt.Errorf("proto: wrong wireType = %d for field Key", wireType)
+				return fmt.Errorf("proto: wrong wireType = %d for field Header", wireType)
 			}
-			var byteLen int
+			var msglen int
 			for shift := uint(0); ; shift += 7 {
 				if shift >= 64 {
 					return ErrIntOverflowKvrpcpb
@@ -12949,28 +14539,30 @@ func (m *RedisDo) Unmarshal(dAtA []byte) error {
 				}
 				b := dAtA[iNdEx]
 				iNdEx++
-				byteLen |= (int(b) & 0x7F) << shift
+				msglen |= (int(b) & 0x7F) << shift
 				if b < 0x80 {
 					break
 				}
 			}
-			if byteLen < 0 {
+			if msglen < 0 {
 				return ErrInvalidLengthKvrpcpb
 			}
-			postIndex := iNdEx + byteLen
+			postIndex := iNdEx + msglen
 			if postIndex > l {
 				return io.ErrUnexpectedEOF
 			}
-			m.Key = append(m.Key[:0], dAtA[iNdEx:postIndex]...)
-			if m.Key == nil {
-				m.Key = []byte{}
+			if m.Header == nil {
+				m.Header = &ResponseHeader{}
+			}
+			if err := m.Header.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
+				return err
 			}
 			iNdEx = postIndex
 		case 2:
 			if wireType != 2 {
-				return fmt.Errorf("proto: wrong wireType = %d for field Value", wireType)
+				return fmt.Errorf("proto: wrong wireType = %d for field Resp", wireType)
 			}
-			var byteLen int
+			var msglen int
 			for shift := uint(0); ; shift += 7 {
 				if shift >= 64 {
 					return ErrIntOverflowKvrpcpb
@@ -12980,28 +14572,80 @@ func (m *RedisDo) Unmarshal(dAtA []byte) error {
 				}
 				b := dAtA[iNdEx]
 				iNdEx++
-				byteLen |= (int(b) & 0x7F) << shift
+				msglen |= (int(b) & 0x7F) << shift
 				if b < 0x80 {
 					break
 				}
 			}
-			if byteLen < 0 {
+			if msglen < 0 {
 				return ErrInvalidLengthKvrpcpb
 			}
-			postIndex := iNdEx + byteLen
+			postIndex := iNdEx + msglen
 			if postIndex > l {
 				return io.ErrUnexpectedEOF
 			}
-			m.Value = append(m.Value[:0], dAtA[iNdEx:postIndex]...)
-			if m.Value == nil {
-				m.Value = []byte{}
+			if m.Resp == nil {
+				m.Resp = &KvGetResponse{}
+			}
+			if err := m.Resp.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
+				return err
 			}
 			iNdEx = postIndex
-		case 3:
-			if wireType != 0 {
-				return fmt.Errorf("proto: wrong wireType = %d for field Op", wireType)
+		default:
+			iNdEx = preIndex
+			skippy, err := skipKvrpcpb(dAtA[iNdEx:])
+			if err != nil {
+				return err
 			}
-			m.Op = 0
+			if skippy < 0 {
+				return ErrInvalidLengthKvrpcpb
+			}
+			if (iNdEx + skippy) > l {
+				return io.ErrUnexpectedEOF
+			}
+			iNdEx += skippy
+		}
+	}
+
+	if iNdEx > l {
+		return io.ErrUnexpectedEOF
+	}
+	return nil
+}
+func (m *KvBatchSetRequest) Unmarshal(dAtA []byte) error {
+	l := len(dAtA)
+	iNdEx := 0
+	for iNdEx < l {
+		preIndex := iNdEx
+		var wire uint64
+		for shift := uint(0); ; shift += 7 {
+			if shift >= 64 {
+				return ErrIntOverflowKvrpcpb
+			}
+			if iNdEx >= l {
+				return io.ErrUnexpectedEOF
+			}
+			b := dAtA[iNdEx]
+			iNdEx++
+			wire |= (uint64(b) & 0x7F) << shift
+			if b < 0x80 {
+				break
+			}
+		}
+		fieldNum := int32(wire >> 3)
+		wireType := int(wire & 0x7)
+		if wireType == 4 {
+			return fmt.Errorf("proto: KvBatchSetRequest: wiretype end group for non-group")
+		}
+		if fieldNum <= 0 {
+			return fmt.Errorf("proto: KvBatchSetRequest: illegal tag %d (wire type %d)", fieldNum, wire)
+		}
+		switch fieldNum {
+		case 1:
+			if wireType != 2 {
+				return fmt.Errorf("proto: wrong wireType = %d for field Kvs", wireType)
+			}
+			var msglen int
 			for shift := uint(0); ; shift += 7 {
 				if shift >= 64 {
 					return ErrIntOverflowKvrpcpb
@@ -13011,12 +14655,24 @@ func (m *RedisDo) Unmarshal(dAtA []byte) error {
 				}
 				b := dAtA[iNdEx]
 				iNdEx++
-				m.Op |= (Operation(b) & 0x7F) << shift
+				msglen |= (int(b) & 0x7F) << shift
 				if b < 0x80 {
 					break
 				}
 			}
-		case 4:
+			if msglen < 0 {
+				return ErrInvalidLengthKvrpcpb
+			}
+			postIndex := iNdEx + msglen
+			if postIndex > l {
+				return io.ErrUnexpectedEOF
+			}
+			m.Kvs = append(m.Kvs, &RedisKeyValue{})
+			if err := m.Kvs[len(m.Kvs)-1].Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
+				return err
+			}
+			iNdEx = postIndex
+		case 2:
 			if wireType != 0 {
 				return fmt.Errorf("proto: wrong wireType = %d for field Case", wireType)
 			}
@@ -13056,7 +14712,7 @@ func (m *RedisDo) Unmarshal(dAtA []byte) error {
 	}
 	return nil
 }
-func (m *KvSetRequest) Unmarshal(dAtA []byte) error {
+func (m *KvBatchSetResponse) Unmarshal(dAtA []byte) error {
 	l := len(dAtA)
 	iNdEx := 0
 	for iNdEx < l {
@@ -13079,17 +14735,17 @@ func (m *KvSetRequest) Unmarshal(dAtA []byte) error {
 		fieldNum := int32(wire >> 3)
 		wireType := int(wire & 0x7)
 		if wireType == 4 {
-			return fmt.Errorf("proto: KvSetRequest: wiretype end group for non-group")
+			return fmt.Errorf("proto: KvBatchSetResponse: wiretype end group for non-group")
 		}
 		if fieldNum <= 0 {
-			return fmt.Errorf("proto: KvSetRequest: illegal tag %d (wire type %d)", fieldNum, wire)
+			return fmt.Errorf("proto: KvBatchSetResponse: illegal tag %d (wire type %d)", fieldNum, wire)
 		}
 		switch fieldNum {
 		case 1:
-			if wireType != 2 {
-				return fmt.Errorf("proto: wrong wireType = %d for field Kv", wireType)
+			if wireType != 0 {
+				return fmt.Errorf("proto: wrong wireType = %d for field Code", wireType)
 			}
-			var msglen int
+			m.Code = 0
 			for shift := uint(0); ; shift += 7 {
 				if shift >= 64 {
 					return ErrIntOverflowKvrpcpb
@@ -13099,30 +14755,16 @@ func (m *KvSetRequest) Unmarshal(dAtA []byte) error {
 				}
 				b := dAtA[iNdEx]
 				iNdEx++
-				msglen |= (int(b) & 0x7F) << shift
+				m.Code |= (int32(b) & 0x7F) << shift
 				if b < 0x80 {
 					break
 				}
 			}
-			if msglen < 0 {
-				return ErrInvalidLengthKvrpcpb
-			}
-			postIndex := iNdEx + msglen
-			if postIndex > l {
-				return io.ErrUnexpectedEOF
-			}
-			if m.Kv == nil {
-				m.Kv = &RedisKeyValue{}
-			}
-			if err := m.Kv.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
-				return err
-			}
-			iNdEx = postIndex
 		case 2:
 			if wireType != 0 {
-				return fmt.Errorf("proto: wrong wireType = %d for field Case", wireType)
+				return fmt.Errorf("proto: wrong wireType = %d for field AffectedKeys", wireType)
 			}
-			m.Case = 0
+			m.AffectedKeys = 0
 			for shift := uint(0); ; shift += 7 {
 				if shift >= 64 {
 					return ErrIntOverflowKvrpcpb
@@ -13132,7 +14774,7 @@ func (m *KvSetRequest) Unmarshal(dAtA []byte) error {
 				}
 				b := dAtA[iNdEx]
 				iNdEx++
-				m.Case |= (ExistCase(b) & 0x7F) << shift
+				m.AffectedKeys |= (uint64(b) & 0x7F) << shift
 				if b < 0x80 {
 					break
 				}
@@ -13158,7 +14800,7 @@ func (m *KvSetRequest) Unmarshal(dAtA []byte) error {
 	}
 	return nil
 }
-func (m *KvSetResponse) Unmarshal(dAtA []byte) error {
+func (m *DsKvBatchSetRequest) Unmarshal(dAtA []byte) error {
 	l := len(dAtA)
 	iNdEx := 0
 	for iNdEx < l {
@@ -13181,17 +14823,17 @@ func (m *KvSetResponse) Unmarshal(dAtA []byte) error {
 		fieldNum := int32(wire >> 3)
 		wireType := int(wire & 0x7)
 		if wireType == 4 {
-			return fmt.Errorf("proto: KvSetResponse: wiretype end group for non-group")
+			return fmt.Errorf("proto: DsKvBatchSetRequest: wiretype end group for non-group")
 		}
 		if fieldNum <= 0 {
-			return fmt.Errorf("proto: KvSetResponse: illegal tag %d (wire type %d)", fieldNum, wire)
+			return fmt.Errorf("proto: DsKvBatchSetRequest: illegal tag %d (wire type %d)", fieldNum, wire)
 		}
 		switch fieldNum {
 		case 1:
-			if wireType != 0 {
-				return fmt.Errorf("proto: wrong wireType = %d for field Code", wireType)
+			if wireType != 2 {
+				return fmt.Errorf("proto: wrong wireType = %d for field Header", wireType)
 			}
-			m.Code = 0
+			var msglen int
 			for shift := uint(0); ; shift += 7 {
 				if shift >= 64 {
 					return ErrIntOverflowKvrpcpb
@@ -13201,16 +14843,30 @@ func (m *KvSetResponse) Unmarshal(dAtA []byte) error {
 				}
 				b := dAtA[iNdEx]
 				iNdEx++
-				m.Code |= (int32(b) & 0x7F) << shift
+				msglen |= (int(b) & 0x7F) << shift
 				if b < 0x80 {
 					break
 				}
 			}
+			if msglen < 0 {
+				return ErrInvalidLengthKvrpcpb
+			}
+			postIndex := iNdEx + msglen
+			if postIndex > l {
+				return io.ErrUnexpectedEOF
+			}
+			if m.Header == nil {
+				m.Header = &RequestHeader{}
+			}
+			if err := m.Header.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
+				return err
+			}
+			iNdEx = postIndex
 		case 2:
-			if wireType != 0 {
-				return fmt.Errorf("proto: wrong wireType = %d for field AffectedKeys", wireType)
+			if wireType != 2 {
+				return fmt.Errorf("proto: wrong wireType = %d for field Req", wireType)
 			}
-			m.AffectedKeys = 0
+			var msglen int
 			for shift := uint(0); ; shift += 7 {
 				if shift >= 64 {
 					return ErrIntOverflowKvrpcpb
@@ -13220,11 +14876,25 @@ func (m *KvSetResponse) Unmarshal(dAtA []byte) error {
 				}
 				b := dAtA[iNdEx]
 				iNdEx++
-				m.AffectedKeys |= (uint64(b) & 0x7F) << shift
+				msglen |= (int(b) & 0x7F) << shift
 				if b < 0x80 {
 					break
 				}
 			}
+			if msglen < 0 {
+				return ErrInvalidLengthKvrpcpb
+			}
+			postIndex := iNdEx + msglen
+			if postIndex > l {
+				return io.ErrUnexpectedEOF
+			}
+			if m.Req == nil {
+				m.Req = &KvBatchSetRequest{}
+			}
+			if err := m.Req.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
+				return err
+			}
+			iNdEx = postIndex
 		default:
 			iNdEx = preIndex
 			skippy, err := skipKvrpcpb(dAtA[iNdEx:])
@@ -13246,7 +14916,7 @@ func (m *KvSetResponse) Unmarshal(dAtA []byte) error {
 	}
 	return nil
 }
-func (m *DsKvSetRequest) Unmarshal(dAtA []byte) error {
+func (m *DsKvBatchSetResponse) Unmarshal(dAtA []byte) error {
 	l := len(dAtA)
 	iNdEx := 0
 	for iNdEx < l {
@@ -13269,10 +14939,10 @@ func (m *DsKvSetRequest) Unmarshal(dAtA []byte) error {
 		fieldNum := int32(wire >> 3)
 		wireType := int(wire & 0x7)
 		if wireType == 4 {
-			return fmt.Errorf("proto: DsKvSetRequest: wiretype end group for non-group")
+			return fmt.Errorf("proto: DsKvBatchSetResponse: wiretype end group for non-group")
 		}
 		if fieldNum <= 0 {
-			return fmt.Errorf("proto: DsKvSetRequest: illegal tag %d (wire type %d)", fieldNum, wire)
+			return fmt.Errorf("proto: DsKvBatchSetResponse: illegal tag %d (wire type %d)", fieldNum, wire)
 		}
 		switch fieldNum {
 		case 1:
@@ -13302,7 +14972,7 @@ func (m *DsKvSetRequest) Unmarshal(dAtA []byte) error {
 				return io.ErrUnexpectedEOF
 			}
 			if m.Header == nil {
-				m.Header = &RequestHeader{}
+				m.Header = &ResponseHeader{}
 			}
 			if err := m.Header.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
 				return err
@@ -13310,7 +14980,7 @@ func (m *DsKvSetRequest) Unmarshal(dAtA []byte) error {
 			iNdEx = postIndex
 		case 2:
 			if wireType != 2 {
-				return fmt.Errorf("proto: wrong wireType = %d for field Req", wireType)
+				return fmt.Errorf("proto: wrong wireType = %d for field Resp", wireType)
 			}
 			var msglen int
 			for shift := uint(0); ; shift += 7 {
@@ -13334,10 +15004,10 @@ func (m *DsKvSetRequest) Unmarshal(dAtA []byte) error {
 			if postIndex > l {
 				return io.ErrUnexpectedEOF
 			}
-			if m.Req == nil {
-				m.Req = &KvSetRequest{}
+			if m.Resp == nil {
+				m.Resp = &KvBatchSetResponse{}
 			}
-			if err := m.Req.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
+			if err := m.Resp.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
 				return err
 			}
 			iNdEx = postIndex
@@ -13362,7 +15032,7 @@ func (m *DsKvSetRequest) Unmarshal(dAtA []byte) error {
 	}
 	return nil
 }
-func (m *DsKvSetResponse) Unmarshal(dAtA []byte) error {
+func (m *KvBatchGetRequest) Unmarshal(dAtA []byte) error {
 	l := len(dAtA)
 	iNdEx := 0
 	for iNdEx < l {
@@ -13385,17 +15055,17 @@ func (m *DsKvSetResponse) Unmarshal(dAtA []byte) error {
 		fieldNum := int32(wire >> 3)
 		wireType := int(wire & 0x7)
 		if wireType == 4 {
-			return fmt.Errorf("proto: DsKvSetResponse: wiretype end group for non-group")
+			return fmt.Errorf("proto: KvBatchGetRequest: wiretype end group for non-group")
 		}
 		if fieldNum <= 0 {
-			return fmt.Errorf("proto: DsKvSetResponse: illegal tag %d (wire type %d)", fieldNum, wire)
+			return fmt.Errorf("proto: KvBatchGetRequest: illegal tag %d (wire type %d)", fieldNum, wire)
 		}
 		switch fieldNum {
 		case 1:
-			if wireType != 2 {
-				return fmt.Errorf("proto: wrong wireType = %d for field Header", wireType)
+			if wireType != 0 {
+				return fmt.Errorf("proto: wrong wireType = %d for field Code", wireType)
 			}
-			var msglen int
+			m.Code = 0
 			for shift := uint(0); ; shift += 7 {
 				if shift >= 64 {
 					return ErrIntOverflowKvrpcpb
@@ -13405,30 +15075,16 @@ func (m *DsKvSetResponse) Unmarshal(dAtA []byte) error {
 				}
 				b := dAtA[iNdEx]
 				iNdEx++
-				msglen |= (int(b) & 0x7F) << shift
+				m.Code |= (int32(b) & 0x7F) << shift
 				if b < 0x80 {
 					break
 				}
 			}
-			if msglen < 0 {
-				return ErrInvalidLengthKvrpcpb
-			}
-			postIndex := iNdEx + msglen
-			if postIndex > l {
-				return io.ErrUnexpectedEOF
-			}
-			if m.Header == nil {
-				m.Header = &ResponseHeader{}
-			}
-			if err := m.Header.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
-				return err
-			}
-			iNdEx = postIndex
 		case 2:
 			if wireType != 2 {
-				return fmt.Errorf("proto: wrong wireType = %d for field Resp", wireType)
+				return fmt.Errorf("proto: wrong wireType = %d for field Keys", wireType)
 			}
-			var msglen int
+			var byteLen int
 			for shift := uint(0); ; shift += 7 {
 				if shift >= 64 {
 					return ErrIntOverflowKvrpcpb
@@ -13438,24 +15094,20 @@ func (m *DsKvSetResponse) Unmarshal(dAtA []byte) error {
 				}
 				b := dAtA[iNdEx]
 				iNdEx++
-				msglen |= (int(b) & 0x7F) << shift
+				byteLen |= (int(b) & 0x7F) << shift
 				if b < 0x80 {
 					break
 				}
 			}
-			if msglen < 0 {
+			if byteLen < 0 {
 				return ErrInvalidLengthKvrpcpb
 			}
-			postIndex := iNdEx + msglen
+			postIndex := iNdEx + byteLen
 			if postIndex > l {
 				return io.ErrUnexpectedEOF
 			}
-			if m.Resp == nil {
-				m.Resp = &KvSetResponse{}
-			}
-			if err := m.Resp.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
-				return err
-			}
+			m.Keys = append(m.Keys, make([]byte, postIndex-iNdEx))
+			copy(m.Keys[len(m.Keys)-1], dAtA[iNdEx:postIndex])
 			iNdEx = postIndex
 		default:
 			iNdEx = preIndex
@@ -13478,7 +15130,7 @@ func (m *DsKvSetResponse) Unmarshal(dAtA []byte) error {
 	}
 	return nil
 }
-func (m *KvGetRequest) Unmarshal(dAtA []byte) error {
+func (m *KvBatchGetResponse) Unmarshal(dAtA []byte) error {
 	l := len(dAtA)
 	iNdEx := 0
 	for iNdEx < l {
@@ -13501,17 +15153,36 @@ func (m *KvGetRequest) Unmarshal(dAtA []byte) error {
 		fieldNum := int32(wire >> 3)
 		wireType := int(wire & 0x7)
 		if wireType == 4 {
-			return fmt.Errorf("proto: KvGetRequest: wiretype end group for non-group")
+			return fmt.Errorf("proto: KvBatchGetResponse: wiretype end group for non-group")
 		}
 		if fieldNum <= 0 {
-			return fmt.Errorf("proto: KvGetRequest: illegal tag %d (wire type %d)", fieldNum, wire)
+			return fmt.Errorf("proto: KvBatchGetResponse: illegal tag %d (wire type %d)", fieldNum, wire)
 		}
 		switch fieldNum {
 		case 1:
+			if wireType != 0 {
+				return fmt.Errorf("proto: wrong wireType = %d for field Code", wireType)
+			}
+			m.Code = 0
+			for shift := uint(0); ; shift += 7 {
+				if shift >= 64 {
+					return ErrIntOverflowKvrpcpb
+				}
+				if iNdEx >= l {
+					return io.ErrUnexpectedEOF
+				}
+				b := dAtA[iNdEx]
+				iNdEx++
+				m.Code |= (int32(b) & 0x7F) << shift
+				if b < 0x80 {
+					break
+				}
+			}
+		case 2:
 			if wireType != 2 {
-				return fmt.Errorf("proto: wrong wireType = %d for field Key", wireType)
+				return fmt.Errorf("proto: wrong wireType = %d for field Kvs", wireType)
 			}
-			var byteLen int
+			var msglen int
 			for shift := uint(0); ; shift += 7 {
 				if shift >= 64 {
 					return ErrIntOverflowKvrpcpb
@@ -13521,21 +15192,21 @@ func (m *KvGetRequest) Unmarshal(dAtA []byte) error {
 				}
 				b := dAtA[iNdEx]
 				iNdEx++
-				byteLen |= (int(b) & 0x7F) << shift
+				msglen |= (int(b) & 0x7F) << shift
 				if b < 0x80 {
 					break
 				}
 			}
-			if byteLen < 0 {
+			if msglen < 0 {
 				return ErrInvalidLengthKvrpcpb
 			}
-			postIndex := iNdEx + byteLen
+			postIndex := iNdEx + msglen
 			if postIndex > l {
 				return io.ErrUnexpectedEOF
 			}
-			m.Key = append(m.Key[:0], dAtA[iNdEx:postIndex]...)
-			if m.Key == nil {
-				m.Key = []byte{}
+			m.Kvs = append(m.Kvs, &RedisKeyValue{})
+			if err := m.Kvs[len(m.Kvs)-1].Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
+				return err
 			}
 			iNdEx = postIndex
 		default:
@@ -13559,7 +15230,7 @@ func (m *KvGetRequest) Unmarshal(dAtA []byte) error {
 	}
 	return nil
 }
-func (m *KvGetResponse) Unmarshal(dAtA []byte) error {
+func (m *DsKvBatchGetRequest) Unmarshal(dAtA []byte) error {
 	l := len(dAtA)
 	iNdEx := 0
 	for iNdEx < l {
@@ -13582,17 +15253,17 @@ func (m *KvGetResponse) Unmarshal(dAtA []byte) error {
 		fieldNum := int32(wire >> 3)
 		wireType := int(wire & 0x7)
 		if wireType == 4 {
-			return fmt.Errorf("proto: KvGetResponse: wiretype end group for non-group")
+			return fmt.Errorf("proto: DsKvBatchGetRequest: wiretype end group for non-group")
 		}
 		if fieldNum <= 0 {
-			return fmt.Errorf("proto: KvGetResponse: illegal tag %d (wire type %d)", fieldNum, wire)
+			return fmt.Errorf("proto: DsKvBatchGetRequest: illegal tag %d (wire type %d)", fieldNum, wire)
 		}
 		switch fieldNum {
 		case 1:
-			if wireType != 0 {
-				return fmt.Errorf("proto: wrong wireType = %d for field Code", wireType)
+			if wireType != 2 {
+				return fmt.Errorf("proto: wrong wireType = %d for field Header", wireType)
 			}
-			m.Code = 0
+			var msglen int
 			for shift := uint(0); ; shift += 7 {
 				if shift >= 64 {
 					return ErrIntOverflowKvrpcpb
@@ -13602,16 +15273,30 @@ func (m *KvGetResponse) Unmarshal(dAtA []byte) error {
 				}
 				b := dAtA[iNdEx]
 				iNdEx++
-				m.Code |= (int32(b) & 0x7F) << shift
+				msglen |= (int(b) & 0x7F) << shift
 				if b < 0x80 {
 					break
 				}
 			}
+			if msglen < 0 {
+				return ErrInvalidLengthKvrpcpb
+			}
+			postIndex := iNdEx + msglen
+			if postIndex > l {
+				return io.ErrUnexpectedEOF
+			}
+			if m.Header == nil {
+				m.Header = &RequestHeader{}
+			}
+			if err := m.Header.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
+				return err
+			}
+			iNdEx = postIndex
 		case 2:
 			if wireType != 2 {
-				return fmt.Errorf("proto: wrong wireType = %d for field Value", wireType)
+				return fmt.Errorf("proto: wrong wireType = %d for field Req", wireType)
 			}
-			var byteLen int
+			var msglen int
 			for shift := uint(0); ; shift += 7 {
 				if shift >= 64 {
 					return ErrIntOverflowKvrpcpb
@@ -13621,21 +15306,23 @@ func (m *KvGetResponse) Unmarshal(dAtA []byte) error {
 				}
 				b := dAtA[iNdEx]
 				iNdEx++
-				byteLen |= (int(b) & 0x7F) << shift
+				msglen |= (int(b) & 0x7F) << shift
 				if b < 0x80 {
 					break
 				}
 			}
-			if byteLen < 0 {
+			if msglen < 0 {
 				return ErrInvalidLengthKvrpcpb
 			}
-			postIndex := iNdEx + byteLen
+			postIndex := iNdEx + msglen
 			if postIndex > l {
 				return io.ErrUnexpectedEOF
 			}
-			m.Value = append(m.Value[:0], dAtA[iNdEx:postIndex]...)
-			if m.Value == nil {
-				m.Value = []byte{}
+			if m.Req == nil {
+				m.Req = &KvBatchGetRequest{}
+			}
+			if err := m.Req.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
+				return err
 			}
 			iNdEx = postIndex
 		default:
@@ -13659,7 +15346,7 @@ func (m *KvGetResponse) Unmarshal(dAtA []byte) error {
 	}
 	return nil
 }
-func (m *DsKvGetRequest) Unmarshal(dAtA []byte) error {
+func (m *DsKvBatchGetResponse) Unmarshal(dAtA []byte) error {
 	l := len(dAtA)
 	iNdEx := 0
 	for iNdEx < l {
@@ -13682,10 +15369,10 @@ func (m *DsKvGetRequest) Unmarshal(dAtA []byte) error {
 		fieldNum := int32(wire >> 3)
 		wireType := int(wire & 0x7)
 		if wireType == 4 {
-			return fmt.Errorf("proto: DsKvGetRequest: wiretype end group for non-group")
+			return fmt.Errorf("proto: DsKvBatchGetResponse: wiretype end group for non-group")
 		}
 		if fieldNum <= 0 {
-			return fmt.Errorf("proto: DsKvGetRequest: illegal tag %d (wire type %d)", fieldNum, wire)
+			return fmt.Errorf("proto: DsKvBatchGetResponse: illegal tag %d (wire type %d)", fieldNum, wire)
 		}
 		switch fieldNum {
 		case 1:
@@ -13715,7 +15402,7 @@ func (m *DsKvGetRequest) Unmarshal(dAtA []byte) error {
 				return io.ErrUnexpectedEOF
 			}
 			if m.Header == nil {
-				m.Header = &RequestHeader{}
+				m.Header = &ResponseHeader{}
 			}
 			if err := m.Header.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
 				return err
@@ -13723,7 +15410,7 @@ func (m *DsKvGetRequest) Unmarshal(dAtA []byte) error {
 			iNdEx = postIndex
 		case 2:
 			if wireType != 2 {
-				return fmt.Errorf("proto: wrong wireType = %d for field Req", wireType)
+				return fmt.Errorf("proto: wrong wireType = %d for field Resp", wireType)
 			}
 			var msglen int
 			for shift := uint(0); ; shift += 7 {
@@ -13747,10 +15434,10 @@ func (m *DsKvGetRequest) Unmarshal(dAtA []byte) error {
 			if postIndex > l {
 				return io.ErrUnexpectedEOF
 			}
-			if m.Req == nil {
-				m.Req = &KvGetRequest{}
+			if m.Resp == nil {
+				m.Resp = &KvBatchGetResponse{}
 			}
-			if err := m.Req.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
+			if err := m.Resp.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
 				return err
 			}
 			iNdEx = postIndex
@@ -13775,7 +15462,7 @@ func (m *DsKvGetRequest) Unmarshal(dAtA []byte) error {
 	}
 	return nil
 }
-func (m *DsKvGetResponse) Unmarshal(dAtA []byte) error {
+func (m *KvScanRequest) Unmarshal(dAtA []byte) error {
 	l := len(dAtA)
 	iNdEx := 0
 	for iNdEx < l {
@@ -13798,17 +15485,99 @@ func (m *DsKvGetResponse) Unmarshal(dAtA []byte) error {
 		fieldNum := int32(wire >> 3)
 		wireType := int(wire & 0x7)
 		if wireType == 4 {
-			return fmt.Errorf("proto: DsKvGetResponse: wiretype end group for non-group")
+			return fmt.Errorf("proto: KvScanRequest: wiretype end group for non-group")
 		}
 		if fieldNum <= 0 {
-			return fmt.Errorf("proto: DsKvGetResponse: illegal tag %d (wire type %d)", fieldNum, wire)
+			return fmt.Errorf("proto: KvScanRequest: illegal tag %d (wire type %d)", fieldNum, wire)
 		}
 		switch fieldNum {
 		case 1:
 			if wireType != 2 {
-				return fmt.Errorf("proto: wrong wireType = %d for field Header", wireType)
+				return fmt.Errorf("proto: wrong wireType = %d for field Start", wireType)
 			}
-			var msglen int
+			var byteLen int
+			for shift := uint(0); ; shift += 7 {
+				if shift >= 64 {
+					return ErrIntOverflowKvrpcpb
+				}
+				if iNdEx >= l {
+					return io.ErrUnexpectedEOF
+				}
+				b := dAtA[iNdEx]
+				iNdEx++
+				byteLen |= (int(b) & 0x7F) << shift
+				if b < 0x80 {
+					break
+				}
+			}
+			if byteLen < 0 {
+				return ErrInvalidLengthKvrpcpb
+			}
+			postIndex := iNdEx + byteLen
+			if postIndex > l {
+				return io.ErrUnexpectedEOF
+			}
+			m.Start = append(m.Start[:0], dAtA[iNdEx:postIndex]...)
+			if m.Start == nil {
+				m.Start = []byte{}
+			}
+			iNdEx = postIndex
+		case 2:
+			if wireType != 2 {
+				return fmt.Errorf("proto: wrong wireType = %d for field Limit", wireType)
+			}
+			var byteLen int
+			for shift := uint(0); ; shift += 7 {
+				if shift >= 64 {
+					return ErrIntOverflowKvrpcpb
+				}
+				if iNdEx >= l {
+					return io.ErrUnexpectedEOF
+				}
+				b := dAtA[iNdEx]
+				iNdEx++
+				byteLen |= (int(b) & 0x7F) << shift
+				if b < 0x80 {
+					break
+				}
+			}
+			if byteLen < 0 {
+				return ErrInvalidLengthKvrpcpb
+			}
+			postIndex := iNdEx + byteLen
+			if postIndex > l {
+				return io.ErrUnexpectedEOF
+			}
+			m.Limit = append(m.Limit[:0], dAtA[iNdEx:postIndex]...)
+			if m.Limit == nil {
+				m.Limit = []byte{}
+			}
+			iNdEx = postIndex
+		case 3:
+			if wireType != 0 {
+				return fmt.Errorf("proto: wrong wireType = %d for field CountOnly", wireType)
+			}
+			var v int
+			for shift := uint(0); ; shift += 7 {
+				if shift >= 64 {
+					return ErrIntOverflowKvrpcpb
+				}
+				if iNdEx >= l {
+					return io.ErrUnexpectedEOF
+				}
+				b := dAtA[iNdEx]
+				iNdEx++
+				v |= (int(b) & 0x7F) << shift
+				if b < 0x80 {
+					break
+				}
+			}
+			m.CountOnly = bool(v != 0)
+		case 4:
+			if wireType != 0 {
+				return fmt.Errorf("proto: wrong wireType = %d for field KeyOnly", wireType)
+			}
+			var v int
 			for shift := uint(0); ; shift += 7 {
 				if shift >= 64 {
 					return ErrIntOverflowKvrpcpb
@@ -13818,30 +15587,17 @@ func (m *DsKvGetResponse) Unmarshal(dAtA []byte) error {
 				}
 				b := dAtA[iNdEx]
 				iNdEx++
-				msglen |= (int(b) & 0x7F) << shift
+				v |= (int(b) & 0x7F) << shift
 				if b < 0x80 {
 					break
 				}
 			}
-			if msglen < 0 {
-				return ErrInvalidLengthKvrpcpb
-			}
-			postIndex := iNdEx + msglen
-			if postIndex > l {
-				return io.ErrUnexpectedEOF
-			}
-			if m.Header == nil {
-				m.Header = &ResponseHeader{}
-			}
-			if err := m.Header.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
-				return err
-			}
-			iNdEx = postIndex
-		case 2:
-			if wireType != 2 {
-				return fmt.Errorf("proto: wrong wireType = %d for field Resp", wireType)
+			m.KeyOnly = bool(v != 0)
+		case 5:
+			if wireType != 0 {
+				return fmt.Errorf("proto: wrong wireType = %d for field MaxCount", wireType)
 			}
-			var msglen int
+			m.MaxCount = 0
 			for shift := uint(0); ; shift += 7 {
 				if shift >= 64 {
 					return ErrIntOverflowKvrpcpb
@@ -13851,25 +15607,50 @@ func (m *DsKvGetResponse) Unmarshal(dAtA []byte) error {
 				}
 				b := dAtA[iNdEx]
 				iNdEx++
-				msglen |= (int(b) & 0x7F) << shift
+				m.MaxCount |= (int64(b) & 0x7F) << shift
 				if b < 0x80 {
 					break
 				}
 			}
-			if msglen < 0 {
-				return ErrInvalidLengthKvrpcpb
+		case 6:
+			if wireType != 0 {
+				return fmt.Errorf("proto: wrong wireType = %d for field OpenSnapshot", wireType)
 			}
-			postIndex := iNdEx + msglen
-			if postIndex > l {
-				return io.ErrUnexpectedEOF
+			var v int
+			for shift := uint(0); ; shift += 7 {
+				if shift >= 64 {
+					return ErrIntOverflowKvrpcpb
+				}
+				if iNdEx >= l {
+					return io.ErrUnexpectedEOF
+				}
+				b := dAtA[iNdEx]
+				iNdEx++
+				v |= (int(b) & 0x7F) << shift
+				if b < 0x80 {
+					break
+				}
 			}
-			if m.Resp == nil {
-				m.Resp = &KvGetResponse{}
+			m.OpenSnapshot = bool(v != 0)
+		case 7:
+			if wireType != 0 {
+				return fmt.Errorf("proto: wrong wireType = %d for field SnapshotId", wireType)
 			}
-			if err := m.Resp.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
-				return err
+			m.SnapshotId = 0
+			for shift := uint(0); ; shift += 7 {
+				if shift >= 64 {
+					return ErrIntOverflowKvrpcpb
+				}
+				if iNdEx >= l {
+					return io.ErrUnexpectedEOF
+				}
+				b := dAtA[iNdEx]
+				iNdEx++
+				m.SnapshotId |= (uint64(b) & 0x7F) << shift
+				if b < 0x80 {
+					break
+				}
 			}
-			iNdEx = postIndex
 		default:
 			iNdEx = preIndex
 			skippy, err := skipKvrpcpb(dAtA[iNdEx:])
@@ -13891,7 +15672,7 @@ func (m *DsKvGetResponse) Unmarshal(dAtA []byte) error {
 	}
 	return nil
 }
-func (m *KvBatchSetRequest) Unmarshal(dAtA []byte) error {
+func (m *KvScanResponse) Unmarshal(dAtA []byte) error {
 	l := len(dAtA)
 	iNdEx := 0
 	for iNdEx < l {
@@ -13914,17 +15695,17 @@ func (m *KvBatchSetRequest) Unmarshal(dAtA []byte) error {
 		fieldNum := int32(wire >> 3)
 		wireType := int(wire & 0x7)
 		if wireType == 4 {
-			return fmt.Errorf("proto: KvBatchSetRequest: wiretype end group for non-group")
+			return fmt.Errorf("proto: KvScanResponse: wiretype end group for non-group")
 		}
 		if fieldNum <= 0 {
-			return fmt.Errorf("proto: KvBatchSetRequest: illegal tag %d (wire type %d)", fieldNum, wire)
+			return fmt.Errorf("proto: KvScanResponse: illegal tag %d (wire type %d)", fieldNum, wire)
 		}
 		switch fieldNum {
 		case 1:
-			if wireType != 2 {
-				return fmt.Errorf("proto: wrong wireType = %d for field Kvs", wireType)
+			if wireType != 0 {
+				return fmt.Errorf("proto: wrong wireType = %d for field Code", wireType)
 			}
-			var msglen int
+			m.Code = 0
 			for shift := uint(0); ; shift += 7 {
 				if shift >= 64 {
 					return ErrIntOverflowKvrpcpb
@@ -13934,28 +15715,16 @@ func (m *KvBatchSetRequest) Unmarshal(dAtA []byte) error {
 				}
 				b := dAtA[iNdEx]
 				iNdEx++
-				msglen |= (int(b) & 0x7F) << shift
+				m.Code |= (int32(b) & 0x7F) << shift
 				if b < 0x80 {
 					break
 				}
 			}
-			if msglen < 0 {
-				return ErrInvalidLengthKvrpcpb
-			}
-			postIndex := iNdEx + msglen
-			if postIndex > l {
-				return io.ErrUnexpectedEOF
-			}
-			m.Kvs = append(m.Kvs, &RedisKeyValue{})
-			if err := m.Kvs[len(m.Kvs)-1].Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
-				return err
-			}
-			iNdEx = postIndex
 		case 2:
 			if wireType != 0 {
-				return fmt.Errorf("proto: wrong wireType = %d for field Case", wireType)
+				return fmt.Errorf("proto: wrong wireType = %d for field Count", wireType)
 			}
-			m.Case = 0
+			m.Count = 0
 			for shift := uint(0); ; shift += 7 {
 				if shift >= 64 {
 					return ErrIntOverflowKvrpcpb
@@ -13965,66 +15734,47 @@ func (m *KvBatchSetRequest) Unmarshal(dAtA []byte) error {
 				}
 				b := dAtA[iNdEx]
 				iNdEx++
-				m.Case |= (ExistCase(b) & 0x7F) << shift
+				m.Count |= (int64(b) & 0x7F) << shift
 				if b < 0x80 {
 					break
 				}
 			}
-		default:
-			iNdEx = preIndex
-			skippy, err := skipKvrpcpb(dAtA[iNdEx:])
-			if err != nil {
-				return err
-			}
-			if skippy < 0 {
-				return ErrInvalidLengthKvrpcpb
+		case 3:
+			if wireType != 2 {
+				return fmt.Errorf("proto: wrong wireType = %d for field Kvs", wireType)
 			}
-			if (iNdEx + skippy) > l {
-				return io.ErrUnexpectedEOF
+			var msglen int
+			for shift := uint(0); ; shift += 7 {
+				if shift >= 64 {
+					return ErrIntOverflowKvrpcpb
+				}
+				if iNdEx >= l {
+					return io.ErrUnexpectedEOF
+				}
+				b := dAtA[iNdEx]
+				iNdEx++
+				msglen |= (int(b) & 0x7F) << shift
+				if b < 0x80 {
+					break
+				}
 			}
-			iNdEx += skippy
-		}
-	}
-
-	if iNdEx > l {
-		return io.ErrUnexpectedEOF
-	}
-	return nil
-}
-func (m *KvBatchSetResponse) Unmarshal(dAtA []byte) error {
-	l := len(dAtA)
-	iNdEx := 0
-	for iNdEx < l {
-		preIndex := iNdEx
-		var wire uint64
-		for shift := uint(0); ; shift += 7 {
-			if shift >= 64 {
-				return ErrIntOverflowKvrpcpb
+			if msglen < 0 {
+				return ErrInvalidLengthKvrpcpb
 			}
-			if iNdEx >= l {
+			postIndex := iNdEx + msglen
+			if postIndex > l {
 				return io.ErrUnexpectedEOF
 			}
-			b := dAtA[iNdEx]
-			iNdEx++
-			wire |= (uint64(b) & 0x7F) << shift
-			if b < 0x80 {
-				break
+			m.Kvs = append(m.Kvs, &RedisKeyValue{})
+			if err := m.Kvs[len(m.Kvs)-1].Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
+				return err
 			}
-		}
-		fieldNum := int32(wire >> 3)
-		wireType := int(wire & 0x7)
-		if wireType == 4 {
-			return fmt.Errorf("proto: KvBatchSetResponse: wiretype end group for non-group")
-		}
-		if fieldNum <= 0 {
-			return fmt.Errorf("proto: KvBatchSetResponse: illegal tag %d (wire type %d)", fieldNum, wire)
-		}
-		switch fieldNum {
-		case 1:
-			if wireType != 0 {
-				return fmt.Errorf("proto: wrong wireType = %d for field Code", wireType)
+			iNdEx = postIndex
+		case 4:
+			if wireType != 2 {
+				return fmt.Errorf("proto: wrong wireType = %d for field LastKey", wireType)
 			}
-			m.Code = 0
+			var byteLen int
 			for shift := uint(0); ; shift += 7 {
 				if shift >= 64 {
 					return ErrIntOverflowKvrpcpb
@@ -14034,16 +15784,28 @@ func (m *KvBatchSetResponse) Unmarshal(dAtA []byte) error {
 				}
 				b := dAtA[iNdEx]
 				iNdEx++
-				m.Code |= (int32(b) & 0x7F) << shift
+				byteLen |= (int(b) & 0x7F) << shift
 				if b < 0x80 {
 					break
 				}
 			}
-		case 2:
+			if byteLen < 0 {
+				return ErrInvalidLengthKvrpcpb
+			}
+			postIndex := iNdEx + byteLen
+			if postIndex > l {
+				return io.ErrUnexpectedEOF
+			}
+			m.LastKey = append(m.LastKey[:0], dAtA[iNdEx:postIndex]...)
+			if m.LastKey == nil {
+				m.LastKey = []byte{}
+			}
+			iNdEx = postIndex
+		case 5:
 			if wireType != 0 {
-				return fmt.Errorf("proto: wrong wireType = %d for field AffectedKeys", wireType)
+				return fmt.Errorf("proto: wrong wireType = %d for field SnapshotId", wireType)
 			}
-			m.AffectedKeys = 0
+			m.SnapshotId = 0
 			for shift := uint(0); ; shift += 7 {
 				if shift >= 64 {
 					return ErrIntOverflowKvrpcpb
@@ -14053,7 +15815,7 @@ func (m *KvBatchSetResponse) Unmarshal(dAtA []byte) error {
 				}
 				b := dAtA[iNdEx]
 				iNdEx++
-				m.AffectedKeys |= (uint64(b) & 0x7F) << shift
+				m.SnapshotId |= (uint64(b) & 0x7F) << shift
 				if b < 0x80 {
 					break
 				}
@@ -14079,7 +15841,7 @@ func (m *KvBatchSetResponse) Unmarshal(dAtA []byte) error {
 	}
 	return nil
 }
-func (m *DsKvBatchSetRequest) Unmarshal(dAtA []byte) error {
+func (m *DsKvScanRequest) Unmarshal(dAtA []byte) error {
 	l := len(dAtA)
 	iNdEx := 0
 	for iNdEx < l {
@@ -14102,10 +15864,10 @@ func (m *DsKvBatchSetRequest) Unmarshal(dAtA []byte) error {
 		fieldNum := int32(wire >> 3)
 		wireType := int(wire & 0x7)
 		if wireType == 4 {
-			return fmt.Errorf("proto: DsKvBatchSetRequest: wiretype end group for non-group")
+			return fmt.Errorf("proto: DsKvScanRequest: wiretype end group for non-group")
 		}
 		if fieldNum <= 0 {
-			return fmt.Errorf("proto: DsKvBatchSetRequest: illegal tag %d (wire type %d)", fieldNum, wire)
+			return fmt.Errorf("proto: DsKvScanRequest: illegal tag %d (wire type %d)", fieldNum, wire)
 		}
 		switch fieldNum {
 		case 1:
@@ -14168,7 +15930,7 @@ func (m *DsKvBatchSetRequest) Unmarshal(dAtA []byte) error {
 				return io.ErrUnexpectedEOF
 			}
 			if m.Req == nil {
-				m.Req = &KvBatchSetRequest{}
+				m.Req = &KvScanRequest{}
 			}
 			if err := m.Req.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
 				return err
@@ -14195,7 +15957,7 @@ func (m *DsKvBatchSetRequest) Unmarshal(dAtA []byte) error {
 	}
 	return nil
 }
-func (m *DsKvBatchSetResponse) Unmarshal(dAtA []byte) error {
+func (m *DsKvScanResponse) Unmarshal(dAtA []byte) error {
 	l := len(dAtA)
 	iNdEx := 0
 	for iNdEx < l {
@@ -14218,10 +15980,10 @@ func (m *DsKvBatchSetResponse) Unmarshal(dAtA []byte) error {
 		fieldNum := int32(wire >> 3)
 		wireType := int(wire & 0x7)
 		if wireType == 4 {
-			return fmt.Errorf("proto: DsKvBatchSetResponse: wiretype end group for non-group")
+			return fmt.Errorf("proto: DsKvScanResponse: wiretype end group for non-group")
 		}
 		if fieldNum <= 0 {
-			return fmt.Errorf("proto: DsKvBatchSetResponse: illegal tag %d (wire type %d)", fieldNum, wire)
+			return fmt.Errorf("proto: DsKvScanResponse: illegal tag %d (wire type %d)", fieldNum, wire)
 		}
 		switch fieldNum {
 		case 1:
@@ -14284,7 +16046,7 @@ func (m *DsKvBatchSetResponse) Unmarshal(dAtA []byte) error {
 				return io.ErrUnexpectedEOF
 			}
 			if m.Resp == nil {
-				m.Resp = &KvBatchSetResponse{}
+				m.Resp = &KvScanResponse{}
 			}
 			if err := m.Resp.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
 				return err
@@ -14311,7 +16073,7 @@ func (m *DsKvBatchSetResponse) Unmarshal(dAtA []byte) error {
 	}
 	return nil
 }
-func (m *KvBatchGetRequest) Unmarshal(dAtA []byte) error {
+func (m *KvDeleteRequest) Unmarshal(dAtA []byte) error {
 	l := len(dAtA)
 	iNdEx := 0
 	for iNdEx < l {
@@ -14334,17 +16096,17 @@ func (m *KvBatchGetRequest) Unmarshal(dAtA []byte) error {
 		fieldNum := int32(wire >> 3)
 		wireType := int(wire & 0x7)
 		if wireType == 4 {
-			return fmt.Errorf("proto: KvBatchGetRequest: wiretype end group for non-group")
+			return fmt.Errorf("proto: KvDeleteRequest: wiretype end group for non-group")
 		}
 		if fieldNum <= 0 {
-			return fmt.Errorf("proto: KvBatchGetRequest: illegal tag %d (wire type %d)", fieldNum, wire)
+			return fmt.Errorf("proto: KvDeleteRequest: illegal tag %d (wire type %d)", fieldNum, wire)
 		}
 		switch fieldNum {
 		case 1:
-			if wireType != 0 {
-				return fmt.Errorf("proto: wrong wireType = %d for field Code", wireType)
+			if wireType != 2 {
+				return fmt.Errorf("proto: wrong wireType = %d for field Key", wireType)
 			}
-			m.Code = 0
+			var byteLen int
 			for shift := uint(0); ; shift += 7 {
 				if shift >= 64 {
 					return ErrIntOverflowKvrpcpb
@@ -14354,16 +16116,28 @@ func (m *KvBatchGetRequest) Unmarshal(dAtA []byte) error {
 				}
 				b := dAtA[iNdEx]
 				iNdEx++
-				m.Code |= (int32(b) & 0x7F) << shift
+				byteLen |= (int(b) & 0x7F) << shift
 				if b < 0x80 {
 					break
 				}
 			}
+			if byteLen < 0 {
+				return ErrInvalidLengthKvrpcpb
+			}
+			postIndex := iNdEx + byteLen
+			if postIndex > l {
+				return io.ErrUnexpectedEOF
+			}
+			m.Key = append(m.Key[:0], dAtA[iNdEx:postIndex]...)
+			if m.Key == nil {
+				m.Key = []byte{}
+			}
+			iNdEx = postIndex
 		case 2:
-			if wireType != 2 {
-				return fmt.Errorf("proto: wrong wireType = %d for field Keys", wireType)
+			if wireType != 0 {
+				return fmt.Errorf("proto: wrong wireType = %d for field Case", wireType)
 			}
-			var byteLen int
+			m.Case = 0
 			for shift := uint(0); ; shift += 7 {
 				if shift >= 64 {
 					return ErrIntOverflowKvrpcpb
@@ -14372,22 +16146,12 @@ func (m *KvBatchGetRequest) Unmarshal(dAtA []byte) error {
 					return io.ErrUnexpectedEOF
 				}
 				b := dAtA[iNdEx]
-				iNdEx++
-				byteLen |= (int(b) & 0x7F) << shift
-				if b < 0x80 {
-					break
-				}
-			}
-			if byteLen < 0 {
-				return ErrInvalidLengthKvrpcpb
-			}
-			postIndex := iNdEx + byteLen
-			if postIndex > l {
-				return io.ErrUnexpectedEOF
+				iNdEx++
+				m.Case |= (ExistCase(b) & 0x7F) << shift
+				if b < 0x80 {
+					break
+				}
 			}
-			m.Keys = append(m.Keys, make([]byte, postIndex-iNdEx))
-			copy(m.Keys[len(m.Keys)-1], dAtA[iNdEx:postIndex])
-			iNdEx = postIndex
 		default:
 			iNdEx = preIndex
 			skippy, err := skipKvrpcpb(dAtA[iNdEx:])
@@ -14409,7 +16173,7 @@ func (m *KvBatchGetRequest) Unmarshal(dAtA []byte) error {
 	}
 	return nil
 }
-func (m *KvBatchGetResponse) Unmarshal(dAtA []byte) error {
+func (m *KvDeleteResponse) Unmarshal(dAtA []byte) error {
 	l := len(dAtA)
 	iNdEx := 0
 	for iNdEx < l {
@@ -14432,10 +16196,10 @@ func (m *KvBatchGetResponse) Unmarshal(dAtA []byte) error {
 		fieldNum := int32(wire >> 3)
 		wireType := int(wire & 0x7)
 		if wireType == 4 {
-			return fmt.Errorf("proto: KvBatchGetResponse: wiretype end group for non-group")
+			return fmt.Errorf("proto: KvDeleteResponse: wiretype end group for non-group")
 		}
 		if fieldNum <= 0 {
-			return fmt.Errorf("proto: KvBatchGetResponse: illegal tag %d (wire type %d)", fieldNum, wire)
+			return fmt.Errorf("proto: KvDeleteResponse: illegal tag %d (wire type %d)", fieldNum, wire)
 		}
 		switch fieldNum {
 		case 1:
@@ -14458,10 +16222,10 @@ func (m *KvBatchGetResponse) Unmarshal(dAtA []byte) error {
 				}
 			}
 		case 2:
-			if wireType != 2 {
-				return fmt.Errorf("proto: wrong wireType = %d for field Kvs", wireType)
+			if wireType != 0 {
+				return fmt.Errorf("proto: wrong wireType = %d for field AffectedKeys", wireType)
 			}
-			var msglen int
+			m.AffectedKeys = 0
 			for shift := uint(0); ; shift += 7 {
 				if shift >= 64 {
 					return ErrIntOverflowKvrpcpb
@@ -14471,23 +16235,11 @@ func (m *KvBatchGetResponse) Unmarshal(dAtA []byte) error {
 				}
 				b := dAtA[iNdEx]
 				iNdEx++
-				msglen |= (int(b) & 0x7F) << shift
+				m.AffectedKeys |= (uint64(b) & 0x7F) << shift
 				if b < 0x80 {
 					break
 				}
 			}
-			if msglen < 0 {
-				return ErrInvalidLengthKvrpcpb
-			}
-			postIndex := iNdEx + msglen
-			if postIndex > l {
-				return io.ErrUnexpectedEOF
-			}
-			m.Kvs = append(m.Kvs, &RedisKeyValue{})
-			if err := m.Kvs[len(m.Kvs)-1].Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
-				return err
-			}
-			iNdEx = postIndex
 		default:
 			iNdEx = preIndex
 			skippy, err := skipKvrpcpb(dAtA[iNdEx:])
@@ -14509,7 +16261,7 @@ func (m *KvBatchGetResponse) Unmarshal(dAtA []byte) error {
 	}
 	return nil
 }
-func (m *DsKvBatchGetRequest) Unmarshal(dAtA []byte) error {
+func (m *DsKvDeleteRequest) Unmarshal(dAtA []byte) error {
 	l := len(dAtA)
 	iNdEx := 0
 	for iNdEx < l {
@@ -14532,10 +16284,10 @@ func (m *DsKvBatchGetRequest) Unmarshal(dAtA []byte) error {
 		fieldNum := int32(wire >> 3)
 		wireType := int(wire & 0x7)
 		if wireType == 4 {
-			return fmt.Errorf("proto: DsKvBatchGetRequest: wiretype end group for non-group")
+			return fmt.Errorf("proto: DsKvDeleteRequest: wiretype end group for non-group")
 		}
 		if fieldNum <= 0 {
-			return fmt.Errorf("proto: DsKvBatchGetRequest: illegal tag %d (wire type %d)", fieldNum, wire)
+			return fmt.Errorf("proto: DsKvDeleteRequest: illegal tag %d (wire type %d)", fieldNum, wire)
 		}
 		switch fieldNum {
 		case 1:
@@ -14598,7 +16350,7 @@ func (m *DsKvBatchGetRequest) Unmarshal(dAtA []byte) error {
 				return io.ErrUnexpectedEOF
 			}
 			if m.Req == nil {
-				m.Req = &KvBatchGetRequest{}
+				m.Req = &KvDeleteRequest{}
 			}
 			if err := m.Req.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
 				return err
@@ -14625,7 +16377,7 @@ func (m *DsKvBatchGetRequest) Unmarshal(dAtA []byte) error {
 	}
 	return nil
 }
-func (m *DsKvBatchGetResponse) Unmarshal(dAtA []byte) error {
+func (m *DsKvDeleteResponse) Unmarshal(dAtA []byte) error {
 	l := len(dAtA)
 	iNdEx := 0
 	for iNdEx < l {
@@ -14648,10 +16400,10 @@ func (m *DsKvBatchGetResponse) Unmarshal(dAtA []byte) error {
 		fieldNum := int32(wire >> 3)
 		wireType := int(wire & 0x7)
 		if wireType == 4 {
-			return fmt.Errorf("proto: DsKvBatchGetResponse: wiretype end group for non-group")
+			return fmt.Errorf("proto: DsKvDeleteResponse: wiretype end group for non-group")
 		}
 		if fieldNum <= 0 {
-			return fmt.Errorf("proto: DsKvBatchGetResponse: illegal tag %d (wire type %d)", fieldNum, wire)
+			return fmt.Errorf("proto: DsKvDeleteResponse: illegal tag %d (wire type %d)", fieldNum, wire)
 		}
 		switch fieldNum {
 		case 1:
@@ -14714,7 +16466,7 @@ func (m *DsKvBatchGetResponse) Unmarshal(dAtA []byte) error {
 				return io.ErrUnexpectedEOF
 			}
 			if m.Resp == nil {
-				m.Resp = &KvBatchGetResponse{}
+				m.Resp = &KvDeleteResponse{}
 			}
 			if err := m.Resp.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
 				return err
@@ -14741,7 +16493,7 @@ func (m *DsKvBatchGetResponse) Unmarshal(dAtA []byte) error {
 	}
 	return nil
 }
-func (m *KvScanRequest) Unmarshal(dAtA []byte) error {
+func (m *KvBatchDeleteRequest) Unmarshal(dAtA []byte) error {
 	l := len(dAtA)
 	iNdEx := 0
 	for iNdEx < l {
@@ -14764,15 +16516,15 @@ func (m *KvScanRequest) Unmarshal(dAtA []byte) error {
 		fieldNum := int32(wire >> 3)
 		wireType := int(wire & 0x7)
 		if wireType == 4 {
-			return fmt.Errorf("proto: KvScanRequest: wiretype end group for non-group")
+			return fmt.Errorf("proto: KvBatchDeleteRequest: wiretype end group for non-group")
 		}
 		if fieldNum <= 0 {
-			return fmt.Errorf("proto: KvScanRequest: illegal tag %d (wire type %d)", fieldNum, wire)
+			return fmt.Errorf("proto: KvBatchDeleteRequest: illegal tag %d (wire type %d)", fieldNum, wire)
 		}
 		switch fieldNum {
 		case 1:
 			if wireType != 2 {
-				return fmt.Errorf("proto: wrong wireType = %d for field Start", wireType)
+				return fmt.Errorf("proto: wrong wireType = %d for field Keys", wireType)
 			}
 			var byteLen int
 			for shift := uint(0); ; shift += 7 {
@@ -14796,87 +16548,14 @@ func (m *KvScanRequest) Unmarshal(dAtA []byte) error {
 			if postIndex > l {
 				return io.ErrUnexpectedEOF
 			}
-			m.Start = append(m.Start[:0], dAtA[iNdEx:postIndex]...)
-			if m.Start == nil {
-				m.Start = []byte{}
-			}
+			m.Keys = append(m.Keys, make([]byte, postIndex-iNdEx))
+			copy(m.Keys[len(m.Keys)-1], dAtA[iNdEx:postIndex])
 			iNdEx = postIndex
 		case 2:
-			if wireType != 2 {
-				return fmt.Errorf("proto: wrong wireType = %d for field Limit", wireType)
-			}
-			var byteLen int
-			for shift := uint(0); ; shift += 7 {
-				if shift >= 64 {
-					return ErrIntOverflowKvrpcpb
-				}
-				if iNdEx >= l {
-					return io.ErrUnexpectedEOF
-				}
-				b := dAtA[iNdEx]
-				iNdEx++
-				byteLen |= (int(b) & 0x7F) << shift
-				if b < 0x80 {
-					break
-				}
-			}
-			if byteLen < 0 {
-				return ErrInvalidLengthKvrpcpb
-			}
-			postIndex := iNdEx + byteLen
-			if postIndex > l {
-				return io.ErrUnexpectedEOF
-			}
-			m.Limit = append(m.Limit[:0], dAtA[iNdEx:postIndex]...)
-			if m.Limit == nil {
-				m.Limit = []byte{}
-			}
-			iNdEx = postIndex
-		case 3:
-			if wireType != 0 {
-				return fmt.Errorf("proto: wrong wireType = %d for field CountOnly", wireType)
-			}
-			var v int
-			for shift := uint(0); ; shift += 7 {
-				if shift >= 64 {
-					return ErrIntOverflowKvrpcpb
-				}
-				if iNdEx >= l {
-					return io.ErrUnexpectedEOF
-				}
-				b := dAtA[iNdEx]
-				iNdEx++
-				v |= (int(b) & 0x7F) << shift
-				if b < 0x80 {
-					break
-				}
-			}
-			m.CountOnly = bool(v != 0)
-		case 4:
-			if wireType != 0 {
-				return fmt.Errorf("proto: wrong wireType = %d for field KeyOnly", wireType)
-			}
-			var v int
-			for shift := uint(0); ; shift += 7 {
-				if shift >= 64 {
-					return ErrIntOverflowKvrpcpb
-				}
-				if iNdEx >= l {
-					return io.ErrUnexpectedEOF
-				}
-				b := dAtA[iNdEx]
-				iNdEx++
-				v |= (int(b) & 0x7F) << shift
-				if b < 0x80 {
-					break
-				}
-			}
-			m.KeyOnly = bool(v != 0)
-		case 5:
 			if wireType != 0 {
-				return fmt.Errorf("proto: wrong wireType = %d for field MaxCount", wireType)
+				return fmt.Errorf("proto: wrong wireType = %d for field Case", wireType)
 			}
-			m.MaxCount = 0
+			m.Case = 0
 			for shift := uint(0); ; shift += 7 {
 				if shift >= 64 {
 					return ErrIntOverflowKvrpcpb
@@ -14886,7 +16565,7 @@ func (m *KvScanRequest) Unmarshal(dAtA []byte) error {
 				}
 				b := dAtA[iNdEx]
 				iNdEx++
-				m.MaxCount |= (int64(b) & 0x7F) << shift
+				m.Case |= (ExistCase(b) & 0x7F) << shift
 				if b < 0x80 {
 					break
 				}
@@ -14912,7 +16591,7 @@ func (m *KvScanRequest) Unmarshal(dAtA []byte) error {
 	}
 	return nil
 }
-func (m *KvScanResponse) Unmarshal(dAtA []byte) error {
+func (m *KvBatchDeleteResponse) Unmarshal(dAtA []byte) error {
 	l := len(dAtA)
 	iNdEx := 0
 	for iNdEx < l {
@@ -14935,10 +16614,10 @@ func (m *KvScanResponse) Unmarshal(dAtA []byte) error {
 		fieldNum := int32(wire >> 3)
 		wireType := int(wire & 0x7)
 		if wireType == 4 {
-			return fmt.Errorf("proto: KvScanResponse: wiretype end group for non-group")
+			return fmt.Errorf("proto: KvBatchDeleteResponse: wiretype end group for non-group")
 		}
 		if fieldNum <= 0 {
-			return fmt.Errorf("proto: KvScanResponse: illegal tag %d (wire type %d)", fieldNum, wire)
+			return fmt.Errorf("proto: KvBatchDeleteResponse: illegal tag %d (wire type %d)", fieldNum, wire)
 		}
 		switch fieldNum {
 		case 1:
@@ -14962,59 +16641,9 @@ func (m *KvScanResponse) Unmarshal(dAtA []byte) error {
 			}
 		case 2:
 			if wireType != 0 {
-				return fmt.Errorf("proto: wrong wireType = %d for field Count", wireType)
-			}
-			m.Count = 0
-			for shift := uint(0); ; shift += 7 {
-				if shift >= 64 {
-					return ErrIntOverflowKvrpcpb
-				}
-				if iNdEx >= l {
-					return io.ErrUnexpectedEOF
-				}
-				b := dAtA[iNdEx]
-				iNdEx++
-				m.Count |= (int64(b) & 0x7F) << shift
-				if b < 0x80 {
-					break
-				}
-			}
-		case 3:
-			if wireType != 2 {
-				return fmt.Errorf("proto: wrong wireType = %d for field Kvs", wireType)
-			}
-			var msglen int
-			for shift := uint(0); ; shift += 7 {
-				if shift >= 64 {
-					return ErrIntOverflowKvrpcpb
-				}
-				if iNdEx >= l {
-					return io.ErrUnexpectedEOF
-				}
-				b := dAtA[iNdEx]
-				iNdEx++
-				msglen |= (int(b) & 0x7F) << shift
-				if b < 0x80 {
-					break
-				}
-			}
-			if msglen < 0 {
-				return ErrInvalidLengthKvrpcpb
-			}
-			postIndex := iNdEx + msglen
-			if postIndex > l {
-				return io.ErrUnexpectedEOF
-			}
-			m.Kvs = append(m.Kvs, &RedisKeyValue{})
-			if err := m.Kvs[len(m.Kvs)-1].Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
-				return err
-			}
-			iNdEx = postIndex
-		case 4:
-			if wireType != 2 {
-				return fmt.Errorf("proto: wrong wireType = %d for field LastKey", wireType)
+				return fmt.Errorf("proto: wrong wireType = %d for field AffectedKeys", wireType)
 			}
-			var byteLen int
+			m.AffectedKeys = 0
 			for shift := uint(0); ; shift += 7 {
 				if shift >= 64 {
 					return ErrIntOverflowKvrpcpb
@@ -15024,23 +16653,11 @@ func (m *KvScanResponse) Unmarshal(dAtA []byte) error {
 				}
 				b := dAtA[iNdEx]
 				iNdEx++
-				byteLen |= (int(b) & 0x7F) << shift
+				m.AffectedKeys |= (uint64(b) & 0x7F) << shift
 				if b < 0x80 {
 					break
 				}
 			}
-			if byteLen < 0 {
-				return ErrInvalidLengthKvrpcpb
-			}
-			postIndex := iNdEx + byteLen
-			if postIndex > l {
-				return io.ErrUnexpectedEOF
-			}
-			m.LastKey = append(m.LastKey[:0], dAtA[iNdEx:postIndex]...)
-			if m.LastKey == nil {
-				m.LastKey = []byte{}
-			}
-			iNdEx = postIndex
 		default:
 			iNdEx = preIndex
 			skippy, err := skipKvrpcpb(dAtA[iNdEx:])
@@ -15062,7 +16679,7 @@ func (m *KvScanResponse) Unmarshal(dAtA []byte) error {
 	}
 	return nil
 }
-func (m *DsKvScanRequest) Unmarshal(dAtA []byte) error {
+func (m *DsKvBatchDeleteRequest) Unmarshal(dAtA []byte) error {
 	l := len(dAtA)
 	iNdEx := 0
 	for iNdEx < l {
@@ -15085,10 +16702,10 @@ func (m *DsKvScanRequest) Unmarshal(dAtA []byte) error {
 		fieldNum := int32(wire >> 3)
 		wireType := int(wire & 0x7)
 		if wireType == 4 {
-			return fmt.Errorf("proto: DsKvScanRequest: wiretype end group for non-group")
+			return fmt.Errorf("proto: DsKvBatchDeleteRequest: wiretype end group for non-group")
 		}
 		if fieldNum <= 0 {
-			return fmt.Errorf("proto: DsKvScanRequest: illegal tag %d (wire type %d)", fieldNum, wire)
+			return fmt.Errorf("proto: DsKvBatchDeleteRequest: illegal tag %d (wire type %d)", fieldNum, wire)
 		}
 		switch fieldNum {
 		case 1:
@@ -15151,7 +16768,7 @@ func (m *DsKvScanRequest) Unmarshal(dAtA []byte) error {
 				return io.ErrUnexpectedEOF
 			}
 			if m.Req == nil {
-				m.Req = &KvScanRequest{}
+				m.Req = &KvBatchDeleteRequest{}
 			}
 			if err := m.Req.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
 				return err
@@ -15178,7 +16795,7 @@ func (m *DsKvScanRequest) Unmarshal(dAtA []byte) error {
 	}
 	return nil
 }
-func (m *DsKvScanResponse) Unmarshal(dAtA []byte) error {
+func (m *DsKvBatchDeleteResponse) Unmarshal(dAtA []byte) error {
 	l := len(dAtA)
 	iNdEx := 0
 	for iNdEx < l {
@@ -15201,10 +16818,10 @@ func (m *DsKvScanResponse) Unmarshal(dAtA []byte) error {
 		fieldNum := int32(wire >> 3)
 		wireType := int(wire & 0x7)
 		if wireType == 4 {
-			return fmt.Errorf("proto: DsKvScanResponse: wiretype end group for non-group")
+			return fmt.Errorf("proto: DsKvBatchDeleteResponse: wiretype end group for non-group")
 		}
 		if fieldNum <= 0 {
-			return fmt.Errorf("proto: DsKvScanResponse: illegal tag %d (wire type %d)", fieldNum, wire)
+			return fmt.Errorf("proto: DsKvBatchDeleteResponse: illegal tag %d (wire type %d)", fieldNum, wire)
 		}
 		switch fieldNum {
 		case 1:
@@ -15267,7 +16884,7 @@ func (m *DsKvScanResponse) Unmarshal(dAtA []byte) error {
 				return io.ErrUnexpectedEOF
 			}
 			if m.Resp == nil {
-				m.Resp = &KvScanResponse{}
+				m.Resp = &KvBatchDeleteResponse{}
 			}
 			if err := m.Resp.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
 				return err
@@ -15294,7 +16911,7 @@ func (m *DsKvScanResponse) Unmarshal(dAtA []byte) error {
 	}
 	return nil
 }
-func (m *KvDeleteRequest) Unmarshal(dAtA []byte) error {
+func (m *KvRangeDeleteRequest) Unmarshal(dAtA []byte) error {
 	l := len(dAtA)
 	iNdEx := 0
 	for iNdEx < l {
@@ -15317,15 +16934,46 @@ func (m *KvDeleteRequest) Unmarshal(dAtA []byte) error {
 		fieldNum := int32(wire >> 3)
 		wireType := int(wire & 0x7)
 		if wireType == 4 {
-			return fmt.Errorf("proto: KvDeleteRequest: wiretype end group for non-group")
+			return fmt.Errorf("proto: KvRangeDeleteRequest: wiretype end group for non-group")
 		}
 		if fieldNum <= 0 {
-			return fmt.Errorf("proto: KvDeleteRequest: illegal tag %d (wire type %d)", fieldNum, wire)
+			return fmt.Errorf("proto: KvRangeDeleteRequest: illegal tag %d (wire type %d)", fieldNum, wire)
 		}
 		switch fieldNum {
 		case 1:
 			if wireType != 2 {
-				return fmt.Errorf("proto: wrong wireType = %d for field Key", wireType)
+				return fmt.Errorf("proto: wrong wireType = %d for field Start", wireType)
+			}
+			var byteLen int
+			for shift := uint(0); ; shift += 7 {
+				if shift >= 64 {
+					return ErrIntOverflowKvrpcpb
+				}
+				if iNdEx >= l {
+					return io.ErrUnexpectedEOF
+				}
+				b := dAtA[iNdEx]
+				iNdEx++
+				byteLen |= (int(b) & 0x7F) << shift
+				if b < 0x80 {
+					break
+				}
+			}
+			if byteLen < 0 {
+				return ErrInvalidLengthKvrpcpb
+			}
+			postIndex := iNdEx + byteLen
+			if postIndex > l {
+				return io.ErrUnexpectedEOF
+			}
+			m.Start = append(m.Start[:0], dAtA[iNdEx:postIndex]...)
+			if m.Start == nil {
+				m.Start = []byte{}
+			}
+			iNdEx = postIndex
+		case 2:
+			if wireType != 2 {
+				return fmt.Errorf("proto: wrong wireType = %d for field Limit", wireType)
 			}
 			var byteLen int
 			for shift := uint(0); ; shift += 7 {
@@ -15349,12 +16997,31 @@ func (m *KvDeleteRequest) Unmarshal(dAtA []byte) error {
 			if postIndex > l {
 				return io.ErrUnexpectedEOF
 			}
-			m.Key = append(m.Key[:0], dAtA[iNdEx:postIndex]...)
-			if m.Key == nil {
-				m.Key = []byte{}
+			m.Limit = append(m.Limit[:0], dAtA[iNdEx:postIndex]...)
+			if m.Limit == nil {
+				m.Limit = []byte{}
 			}
 			iNdEx = postIndex
-		case 2:
+		case 3:
+			if wireType != 0 {
+				return fmt.Errorf("proto: wrong wireType = %d for field MaxCount", wireType)
+			}
+			m.MaxCount = 0
+			for shift := uint(0); ; shift += 7 {
+				if shift >= 64 {
+					return ErrIntOverflowKvrpcpb
+				}
+				if iNdEx >= l {
+					return io.ErrUnexpectedEOF
+				}
+				b := dAtA[iNdEx]
+				iNdEx++
+				m.MaxCount |= (int64(b) & 0x7F) << shift
+				if b < 0x80 {
+					break
+				}
+			}
+		case 4:
 			if wireType != 0 {
 				return fmt.Errorf("proto: wrong wireType = %d for field Case", wireType)
 			}
@@ -15394,7 +17061,7 @@ func (m *KvDeleteRequest) Unmarshal(dAtA []byte) error {
 	}
 	return nil
 }
-func (m *KvDeleteResponse) Unmarshal(dAtA []byte) error {
+func (m *KvRangeDeleteResponse) Unmarshal(dAtA []byte) error {
 	l := len(dAtA)
 	iNdEx := 0
 	for iNdEx < l {
@@ -15417,10 +17084,10 @@ func (m *KvDeleteResponse) Unmarshal(dAtA []byte) error {
 		fieldNum := int32(wire >> 3)
 		wireType := int(wire & 0x7)
 		if wireType == 4 {
-			return fmt.Errorf("proto: KvDeleteResponse: wiretype end group for non-group")
+			return fmt.Errorf("proto: KvRangeDeleteResponse: wiretype end group for non-group")
 		}
 		if fieldNum <= 0 {
-			return fmt.Errorf("proto: KvDeleteResponse: illegal tag %d (wire type %d)", fieldNum, wire)
+			return fmt.Errorf("proto: KvRangeDeleteResponse: illegal tag %d (wire type %d)", fieldNum, wire)
 		}
 		switch fieldNum {
 		case 1:
@@ -15461,6 +17128,37 @@ func (m *KvDeleteResponse) Unmarshal(dAtA []byte) error {
 					break
 				}
 			}
+		case 3:
+			if wireType != 2 {
+				return fmt.Errorf("proto: wrong wireType = %d for field LastKey", wireType)
+			}
+			var byteLen int
+			for shift := uint(0); ; shift += 7 {
+				if shift >= 64 {
+					return ErrIntOverflowKvrpcpb
+				}
+				if iNdEx >= l {
+					return io.ErrUnexpectedEOF
+				}
+				b := dAtA[iNdEx]
+				iNdEx++
+				byteLen |= (int(b) & 0x7F) << shift
+				if b < 0x80 {
+					break
+				}
+			}
+			if byteLen < 0 {
+				return ErrInvalidLengthKvrpcpb
+			}
+			postIndex := iNdEx + byteLen
+			if postIndex > l {
+				return io.ErrUnexpectedEOF
+			}
+			m.LastKey = append(m.LastKey[:0], dAtA[iNdEx:postIndex]...)
+			if m.LastKey == nil {
+				m.LastKey = []byte{}
+			}
+			iNdEx = postIndex
 		default:
 			iNdEx = preIndex
 			skippy, err := skipKvrpcpb(dAtA[iNdEx:])
@@ -15482,7 +17180,7 @@ func (m *KvDeleteResponse) Unmarshal(dAtA []byte) error {
 	}
 	return nil
 }
-func (m *DsKvDeleteRequest) Unmarshal(dAtA []byte) error {
+func (m *DsKvRangeDeleteRequest) Unmarshal(dAtA []byte) error {
 	l := len(dAtA)
 	iNdEx := 0
 	for iNdEx < l {
@@ -15505,10 +17203,10 @@ func (m *DsKvDeleteRequest) Unmarshal(dAtA []byte) error {
 		fieldNum := int32(wire >> 3)
 		wireType := int(wire & 0x7)
 		if wireType == 4 {
-			return fmt.Errorf("proto: DsKvDeleteRequest: wiretype end group for non-group")
+			return fmt.Errorf("proto: DsKvRangeDeleteRequest: wiretype end group for non-group")
 		}
 		if fieldNum <= 0 {
-			return fmt.Errorf("proto: DsKvDeleteRequest: illegal tag %d (wire type %d)", fieldNum, wire)
+			return fmt.Errorf("proto: DsKvRangeDeleteRequest: illegal tag %d (wire type %d)", fieldNum, wire)
 		}
 		switch fieldNum {
 		case 1:
@@ -15571,7 +17269,7 @@ func (m *DsKvDeleteRequest) Unmarshal(dAtA []byte) error {
 				return io.ErrUnexpectedEOF
 			}
 			if m.Req == nil {
-				m.Req = &KvDeleteRequest{}
+				m.Req = &KvRangeDeleteRequest{}
 			}
 			if err := m.Req.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
 				return err
@@ -15598,7 +17296,7 @@ func (m *DsKvDeleteRequest) Unmarshal(dAtA []byte) error {
 	}
 	return nil
 }
-func (m *DsKvDeleteResponse) Unmarshal(dAtA []byte) error {
+func (m *DsKvRangeDeleteResponse) Unmarshal(dAtA []byte) error {
 	l := len(dAtA)
 	iNdEx := 0
 	for iNdEx < l {
@@ -15621,10 +17319,10 @@ func (m *DsKvDeleteResponse) Unmarshal(dAtA []byte) error {
 		fieldNum := int32(wire >> 3)
 		wireType := int(wire & 0x7)
 		if wireType == 4 {
-			return fmt.Errorf("proto: DsKvDeleteResponse: wiretype end group for non-group")
+			return fmt.Errorf("proto: DsKvRangeDeleteResponse: wiretype end group for non-group")
 		}
 		if fieldNum <= 0 {
-			return fmt.Errorf("proto: DsKvDeleteResponse: illegal tag %d (wire type %d)", fieldNum, wire)
+			return fmt.Errorf("proto: DsKvRangeDeleteResponse: illegal tag %d (wire type %d)", fieldNum, wire)
 		}
 		switch fieldNum {
 		case 1:
@@ -15687,7 +17385,7 @@ func (m *DsKvDeleteResponse) Unmarshal(dAtA []byte) error {
 				return io.ErrUnexpectedEOF
 			}
 			if m.Resp == nil {
-				m.Resp = &KvDeleteResponse{}
+				m.Resp = &KvRangeDeleteResponse{}
 			}
 			if err := m.Resp.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
 				return err
@@ -15714,7 +17412,7 @@ func (m *DsKvDeleteResponse) Unmarshal(dAtA []byte) error {
 	}
 	return nil
 }
-func (m *KvBatchDeleteRequest) Unmarshal(dAtA []byte) error {
+func (m *KvIncrRequest) Unmarshal(dAtA []byte) error {
 	l := len(dAtA)
 	iNdEx := 0
 	for iNdEx < l {
@@ -15737,15 +17435,15 @@ func (m *KvBatchDeleteRequest) Unmarshal(dAtA []byte) error {
 		fieldNum := int32(wire >> 3)
 		wireType := int(wire & 0x7)
 		if wireType == 4 {
-			return fmt.Errorf("proto: KvBatchDeleteRequest: wiretype end group for non-group")
+			return fmt.Errorf("proto: KvIncrRequest: wiretype end group for non-group")
 		}
 		if fieldNum <= 0 {
-			return fmt.Errorf("proto: KvBatchDeleteRequest: illegal tag %d (wire type %d)", fieldNum, wire)
+			return fmt.Errorf("proto: KvIncrRequest: illegal tag %d (wire type %d)", fieldNum, wire)
 		}
 		switch fieldNum {
 		case 1:
 			if wireType != 2 {
-				return fmt.Errorf("proto: wrong wireType = %d for field Keys", wireType)
+				return fmt.Errorf("proto: wrong wireType = %d for field Key", wireType)
 			}
 			var byteLen int
 			for shift := uint(0); ; shift += 7 {
@@ -15769,14 +17467,16 @@ func (m *KvBatchDeleteRequest) Unmarshal(dAtA []byte) error {
 			if postIndex > l {
 				return io.ErrUnexpectedEOF
 			}
-			m.Keys = append(m.Keys, make([]byte, postIndex-iNdEx))
-			copy(m.Keys[len(m.Keys)-1], dAtA[iNdEx:postIndex])
+			m.Key = append(m.Key[:0], dAtA[iNdEx:postIndex]...)
+			if m.Key == nil {
+				m.Key = []byte{}
+			}
 			iNdEx = postIndex
 		case 2:
 			if wireType != 0 {
-				return fmt.Errorf("proto: wrong wireType = %d for field Case", wireType)
+				return fmt.Errorf("proto: wrong wireType = %d for field Delta", wireType)
 			}
-			m.Case = 0
+			m.Delta = 0
 			for shift := uint(0); ; shift += 7 {
 				if shift >= 64 {
 					return ErrIntOverflowKvrpcpb
@@ -15786,7 +17486,7 @@ func (m *KvBatchDeleteRequest) Unmarshal(dAtA []byte) error {
 				}
 				b := dAtA[iNdEx]
 				iNdEx++
-				m.Case |= (ExistCase(b) & 0x7F) << shift
+				m.Delta |= (int64(b) & 0x7F) << shift
 				if b < 0x80 {
 					break
 				}
@@ -15812,7 +17512,7 @@ func (m *KvBatchDeleteRequest) Unmarshal(dAtA []byte) error {
 	}
 	return nil
 }
-func (m *KvBatchDeleteResponse) Unmarshal(dAtA []byte) error {
+func (m *KvIncrResponse) Unmarshal(dAtA []byte) error {
 	l := len(dAtA)
 	iNdEx := 0
 	for iNdEx < l {
@@ -15835,10 +17535,10 @@ func (m *KvBatchDeleteResponse) Unmarshal(dAtA []byte) error {
 		fieldNum := int32(wire >> 3)
 		wireType := int(wire & 0x7)
 		if wireType == 4 {
-			return fmt.Errorf("proto: KvBatchDeleteResponse: wiretype end group for non-group")
+			return fmt.Errorf("proto: KvIncrResponse: wiretype end group for non-group")
 		}
 		if fieldNum <= 0 {
-			return fmt.Errorf("proto: KvBatchDeleteResponse: illegal tag %d (wire type %d)", fieldNum, wire)
+			return fmt.Errorf("proto: KvIncrResponse: illegal tag %d (wire type %d)", fieldNum, wire)
 		}
 		switch fieldNum {
 		case 1:
@@ -15860,25 +17560,6 @@ func (m *KvBatchDeleteResponse) Unmarshal(dAtA []byte) error {
 					break
 				}
 			}
-		case 2:
-			if wireType != 0 {
-				return fmt.Errorf("proto: wrong wireType = %d for field AffectedKeys", wireType)
-			}
-			m.AffectedKeys = 0
-			for shift := uint(0); ; shift += 7 {
-				if shift >= 64 {
-					return ErrIntOverflowKvrpcpb
-				}
-				if iNdEx >= l {
-					return io.ErrUnexpectedEOF
-				}
-				b := dAtA[iNdEx]
-				iNdEx++
-				m.AffectedKeys |= (uint64(b) & 0x7F) << shift
-				if b < 0x80 {
-					break
-				}
-			}
 		default:
 			iNdEx = preIndex
 			skippy, err := skipKvrpcpb(dAtA[iNdEx:])
@@ -15900,7 +17581,7 @@ func (m *KvBatchDeleteResponse) Unmarshal(dAtA []byte) error {
 	}
 	return nil
 }
-func (m *DsKvBatchDeleteRequest) Unmarshal(dAtA []byte) error {
+func (m *DsKvIncrRequest) Unmarshal(dAtA []byte) error {
 	l := len(dAtA)
 	iNdEx := 0
 	for iNdEx < l {
@@ -15923,10 +17604,10 @@ func (m *DsKvBatchDeleteRequest) Unmarshal(dAtA []byte) error {
 		fieldNum := int32(wire >> 3)
 		wireType := int(wire & 0x7)
 		if wireType == 4 {
-			return fmt.Errorf("proto: DsKvBatchDeleteRequest: wiretype end group for non-group")
+			return fmt.Errorf("proto: DsKvIncrRequest: wiretype end group for non-group")
 		}
 		if fieldNum <= 0 {
-			return fmt.Errorf("proto: DsKvBatchDeleteRequest: illegal tag %d (wire type %d)", fieldNum, wire)
+			return fmt.Errorf("proto: DsKvIncrRequest: illegal tag %d (wire type %d)", fieldNum, wire)
 		}
 		switch fieldNum {
 		case 1:
@@ -15989,7 +17670,7 @@ func (m *DsKvBatchDeleteRequest) Unmarshal(dAtA []byte) error {
 				return io.ErrUnexpectedEOF
 			}
 			if m.Req == nil {
-				m.Req = &KvBatchDeleteRequest{}
+				m.Req = &KvIncrRequest{}
 			}
 			if err := m.Req.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
 				return err
@@ -16016,7 +17697,7 @@ func (m *DsKvBatchDeleteRequest) Unmarshal(dAtA []byte) error {
 	}
 	return nil
 }
-func (m *DsKvBatchDeleteResponse) Unmarshal(dAtA []byte) error {
+func (m *DsKvIncrResponse) Unmarshal(dAtA []byte) error {
 	l := len(dAtA)
 	iNdEx := 0
 	for iNdEx < l {
@@ -16039,10 +17720,10 @@ func (m *DsKvBatchDeleteResponse) Unmarshal(dAtA []byte) error {
 		fieldNum := int32(wire >> 3)
 		wireType := int(wire & 0x7)
 		if wireType == 4 {
-			return fmt.Errorf("proto: DsKvBatchDeleteResponse: wiretype end group for non-group")
+			return fmt.Errorf("proto: DsKvIncrResponse: wiretype end group for non-group")
 		}
 		if fieldNum <= 0 {
-			return fmt.Errorf("proto: DsKvBatchDeleteResponse: illegal tag %d (wire type %d)", fieldNum, wire)
+			return fmt.Errorf("proto: DsKvIncrResponse: illegal tag %d (wire type %d)", fieldNum, wire)
 		}
 		switch fieldNum {
 		case 1:
@@ -16105,7 +17786,7 @@ func (m *DsKvBatchDeleteResponse) Unmarshal(dAtA []byte) error {
 				return io.ErrUnexpectedEOF
 			}
 			if m.Resp == nil {
-				m.Resp = &KvBatchDeleteResponse{}
+				m.Resp = &KvIncrResponse{}
 			}
 			if err := m.Resp.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
 				return err
@@ -16132,7 +17813,7 @@ func (m *DsKvBatchDeleteResponse) Unmarshal(dAtA []byte) error {
 	}
 	return nil
 }
-func (m *KvRangeDeleteRequest) Unmarshal(dAtA []byte) error {
+func (m *KvAppendRequest) Unmarshal(dAtA []byte) error {
 	l := len(dAtA)
 	iNdEx := 0
 	for iNdEx < l {
@@ -16155,15 +17836,15 @@ func (m *KvRangeDeleteRequest) Unmarshal(dAtA []byte) error {
 		fieldNum := int32(wire >> 3)
 		wireType := int(wire & 0x7)
 		if wireType == 4 {
-			return fmt.Errorf("proto: KvRangeDeleteRequest: wiretype end group for non-group")
+			return fmt.Errorf("proto: KvAppendRequest: wiretype end group for non-group")
 		}
 		if fieldNum <= 0 {
-			return fmt.Errorf("proto: KvRangeDeleteRequest: illegal tag %d (wire type %d)", fieldNum, wire)
+			return fmt.Errorf("proto: KvAppendRequest: illegal tag %d (wire type %d)", fieldNum, wire)
 		}
 		switch fieldNum {
 		case 1:
 			if wireType != 2 {
-				return fmt.Errorf("proto: wrong wireType = %d for field Start", wireType)
+				return fmt.Errorf("proto: wrong wireType = %d for field Key", wireType)
 			}
 			var byteLen int
 			for shift := uint(0); ; shift += 7 {
@@ -16187,14 +17868,14 @@ func (m *KvRangeDeleteRequest) Unmarshal(dAtA []byte) error {
 			if postIndex > l {
 				return io.ErrUnexpectedEOF
 			}
-			m.Start = append(m.Start[:0], dAtA[iNdEx:postIndex]...)
-			if m.Start == nil {
-				m.Start = []byte{}
+			m.Key = append(m.Key[:0], dAtA[iNdEx:postIndex]...)
+			if m.Key == nil {
+				m.Key = []byte{}
 			}
 			iNdEx = postIndex
 		case 2:
 			if wireType != 2 {
-				return fmt.Errorf("proto: wrong wireType = %d for field Limit", wireType)
+				return fmt.Errorf("proto: wrong wireType = %d for field Value", wireType)
 			}
 			var byteLen int
 			for shift := uint(0); ; shift += 7 {
@@ -16218,49 +17899,11 @@ func (m *KvRangeDeleteRequest) Unmarshal(dAtA []byte) error {
 			if postIndex > l {
 				return io.ErrUnexpectedEOF
 			}
-			m.Limit = append(m.Limit[:0], dAtA[iNdEx:postIndex]...)
-			if m.Limit == nil {
-				m.Limit = []byte{}
+			m.Value = append(m.Value[:0], dAtA[iNdEx:postIndex]...)
+			if m.Value == nil {
+				m.Value = []byte{}
 			}
 			iNdEx = postIndex
-		case 3:
-			if wireType != 0 {
-				return fmt.Errorf("proto: wrong wireType = %d for field MaxCount", wireType)
-			}
-			m.MaxCount = 0
-			for shift := uint(0); ; shift += 7 {
-				if shift >= 64 {
-					return ErrIntOverflowKvrpcpb
-				}
-				if iNdEx >= l {
-					return io.ErrUnexpectedEOF
-				}
-				b := dAtA[iNdEx]
-				iNdEx++
-				m.MaxCount |= (int64(b) & 0x7F) << shift
-				if b < 0x80 {
-					break
-				}
-			}
-		case 4:
-			if wireType != 0 {
-				return fmt.Errorf("proto: wrong wireType = %d for field Case", wireType)
-			}
-			m.Case = 0
-			for shift := uint(0); ; shift += 7 {
-				if shift >= 64 {
-					return ErrIntOverflowKvrpcpb
-				}
-				if iNdEx >= l {
-					return io.ErrUnexpectedEOF
-				}
-				b := dAtA[iNdEx]
-				iNdEx++
-				m.Case |= (ExistCase(b) & 0x7F) << shift
-				if b < 0x80 {
-					break
-				}
-			}
 		default:
 			iNdEx = preIndex
 			skippy, err := skipKvrpcpb(dAtA[iNdEx:])
@@ -16282,7 +17925,7 @@ func (m *KvRangeDeleteRequest) Unmarshal(dAtA []byte) error {
 	}
 	return nil
 }
-func (m *KvRangeDeleteResponse) Unmarshal(dAtA []byte) error {
+func (m *KvAppendResponse) Unmarshal(dAtA []byte) error {
 	l := len(dAtA)
 	iNdEx := 0
 	for iNdEx < l {
@@ -16305,10 +17948,10 @@ func (m *KvRangeDeleteResponse) Unmarshal(dAtA []byte) error {
 		fieldNum := int32(wire >> 3)
 		wireType := int(wire & 0x7)
 		if wireType == 4 {
-			return fmt.Errorf("proto: KvRangeDeleteResponse: wiretype end group for non-group")
+			return fmt.Errorf("proto: KvAppendResponse: wiretype end group for non-group")
 		}
 		if fieldNum <= 0 {
-			return fmt.Errorf("proto: KvRangeDeleteResponse: illegal tag %d (wire type %d)", fieldNum, wire)
+			return fmt.Errorf("proto: KvAppendResponse: illegal tag %d (wire type %d)", fieldNum, wire)
 		}
 		switch fieldNum {
 		case 1:
@@ -16330,56 +17973,6 @@ func (m *KvRangeDeleteResponse) Unmarshal(dAtA []byte) error {
 					break
 				}
 			}
-		case 2:
-			if wireType != 0 {
-				return fmt.Errorf("proto: wrong wireType = %d for field AffectedKeys", wireType)
-			}
-			m.AffectedKeys = 0
-			for shift := uint(0); ; shift += 7 {
-				if shift >= 64 {
-					return ErrIntOverflowKvrpcpb
-				}
-				if iNdEx >= l {
-					return io.ErrUnexpectedEOF
-				}
-				b := dAtA[iNdEx]
-				iNdEx++
-				m.AffectedKeys |= (uint64(b) & 0x7F) << shift
-				if b < 0x80 {
-					break
-				}
-			}
-		case 3:
-			if wireType != 2 {
-				return fmt.Errorf("proto: wrong wireType = %d for field LastKey", wireType)
-			}
-			var byteLen int
-			for shift := uint(0); ; shift += 7 {
-				if shift >= 64 {
-					return ErrIntOverflowKvrpcpb
-				}
-				if iNdEx >= l {
-					return io.ErrUnexpectedEOF
-				}
-				b := dAtA[iNdEx]
-				iNdEx++
-				byteLen |= (int(b) & 0x7F) << shift
-				if b < 0x80 {
-					break
-				}
-			}
-			if byteLen < 0 {
-				return ErrInvalidLengthKvrpcpb
-			}
-			postIndex := iNdEx + byteLen
-			if postIndex > l {
-				return io.ErrUnexpectedEOF
-			}
-			m.LastKey = append(m.LastKey[:0], dAtA[iNdEx:postIndex]...)
-			if m.LastKey == nil {
-				m.LastKey = []byte{}
-			}
-			iNdEx = postIndex
 		default:
 			iNdEx = preIndex
 			skippy, err := skipKvrpcpb(dAtA[iNdEx:])
@@ -16401,7 +17994,7 @@ func (m *KvRangeDeleteResponse) Unmarshal(dAtA []byte) error {
 	}
 	return nil
 }
-func (m *DsKvRangeDeleteRequest) Unmarshal(dAtA []byte) error {
+func (m *DsKvAppendRequest) Unmarshal(dAtA []byte) error {
 	l := len(dAtA)
 	iNdEx := 0
 	for iNdEx < l {
@@ -16424,10 +18017,10 @@ func (m *DsKvRangeDeleteRequest) Unmarshal(dAtA []byte) error {
 		fieldNum := int32(wire >> 3)
 		wireType := int(wire & 0x7)
 		if wireType == 4 {
-			return fmt.Errorf("proto: DsKvRangeDeleteRequest: wiretype end group for non-group")
+			return fmt.Errorf("proto: DsKvAppendRequest: wiretype end group for non-group")
 		}
 		if fieldNum <= 0 {
-			return fmt.Errorf("proto: DsKvRangeDeleteRequest: illegal tag %d (wire type %d)", fieldNum, wire)
+			return fmt.Errorf("proto: DsKvAppendRequest: illegal tag %d (wire type %d)", fieldNum, wire)
 		}
 		switch fieldNum {
 		case 1:
@@ -16490,7 +18083,7 @@ func (m *DsKvRangeDeleteRequest) Unmarshal(dAtA []byte) error {
 				return io.ErrUnexpectedEOF
 			}
 			if m.Req == nil {
-				m.Req = &KvRangeDeleteRequest{}
+				m.Req = &KvAppendRequest{}
 			}
 			if err := m.Req.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
 				return err
@@ -16517,7 +18110,7 @@ func (m *DsKvRangeDeleteRequest) Unmarshal(dAtA []byte) error {
 	}
 	return nil
 }
-func (m *DsKvRangeDeleteResponse) Unmarshal(dAtA []byte) error {
+func (m *DsKvAppendResponse) Unmarshal(dAtA []byte) error {
 	l := len(dAtA)
 	iNdEx := 0
 	for iNdEx < l {
@@ -16540,10 +18133,10 @@ func (m *DsKvRangeDeleteResponse) Unmarshal(dAtA []byte) error {
 		fieldNum := int32(wire >> 3)
 		wireType := int(wire & 0x7)
 		if wireType == 4 {
-			return fmt.Errorf("proto: DsKvRangeDeleteResponse: wiretype end group for non-group")
+			return fmt.Errorf("proto: DsKvAppendResponse: wiretype end group for non-group")
 		}
 		if fieldNum <= 0 {
-			return fmt.Errorf("proto: DsKvRangeDeleteResponse: illegal tag %d (wire type %d)", fieldNum, wire)
+			return fmt.Errorf("proto: DsKvAppendResponse: illegal tag %d (wire type %d)", fieldNum, wire)
 		}
 		switch fieldNum {
 		case 1:
@@ -16606,7 +18199,7 @@ func (m *DsKvRangeDeleteResponse) Unmarshal(dAtA []byte) error {
 				return io.ErrUnexpectedEOF
 			}
 			if m.Resp == nil {
-				m.Resp = &KvRangeDeleteResponse{}
+				m.Resp = &KvAppendResponse{}
 			}
 			if err := m.Resp.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
 				return err
@@ -19258,155 +20851,164 @@ var (
 func init() { proto.RegisterFile("kvrpcpb.proto", fileDescriptorKvrpcpb) }
 
 var fileDescriptorKvrpcpb = []byte{
-	// 2399 bytes of a gzipped FileDescriptorProto
-	0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xc4, 0x5a, 0x4b, 0x73, 0xdb, 0xc8,
-	0x11, 0x36, 0x08, 0x92, 0x22, 0x9b, 0x0f, 0x41, 0x63, 0x59, 0x96, 0xed, 0xb5, 0xe3, 0x60, 0x6d,
-	0xad, 0x56, 0x8e, 0xe5, 0x5d, 0xb9, 0x52, 0xa9, 0xcd, 0xe6, 0x10, 0x5b, 0xaf, 0x55, 0x51, 0xbb,
-	0x52, 0x8d, 0xbc, 0x3e, 0xe4, 0xb0, 0x2c, 0x08, 0x18, 0x51, 0x08, 0x21, 0x80, 0x06, 0x40, 0x4a,
-	0x4c, 0xe5, 0x75, 0xcb, 0x29, 0x97, 0x24, 0x87, 0xfc, 0x84, 0x5c, 0x72, 0xcf, 0x4f, 0xd8, 0x43,
-	0x52, 0x95, 0x9f, 0x90, 0x72, 0xfe, 0x48, 0x6a, 0x1e, 0x20, 0x30, 0x20, 0x28, 0x51, 0x24, 0xe5,
-	0x9c, 0x84, 0x99, 0x69, 0xf4, 0xe3, 0xfb, 0x7a, 0x1a, 0x3d, 0x43, 0x41, 0xad, 0xdd, 0xf3, 0x3b,
-	0x66, 0xe7, 0x78, 0xbd, 0xe3, 0x7b, 0xa1, 0x87, 0xe6, 0xc4, 0xf0, 0x7e, 0xf5, 0x8c, 0x84, 0x46,
-	0x34, 0x7d, 0xbf, 0x46, 0x7c, 0xdf, 0xf3, 0x07, 0xc3, 0xf9, 0xd0, 0x3e, 0x23, 0x41, 0x68, 0x9c,
-	0x75, 0xc4, 0xc4, 0x62, 0xcb, 0x6b, 0x79, 0xec, 0xf1, 0x05, 0x7d, 0xe2, 0xb3, 0xfa, 0x67, 0x50,
-	0x6c, 0xf4, 0x0e, 0x0d, 0xdb, 0x47, 0x1a, 0xa8, 0x6d, 0xd2, 0x5f, 0x56, 0x1e, 0x2b, 0xab, 0x55,
-	0x4c, 0x1f, 0xd1, 0x22, 0x14, 0x7a, 0x86, 0xd3, 0x25, 0xcb, 0x39, 0x36, 0xc7, 0x07, 0xfa, 0xbf,
-	0x14, 0xa8, 0x61, 0xf2, 0xae, 0x4b, 0x82, 0xf0, 0x2b, 0x62, 0x58, 0xc4, 0x47, 0x0f, 0x01, 0x4c,
-	0xa7, 0x1b, 0x84, 0xc4, 0x6f, 0xda, 0x16, 0x53, 0x90, 0xc7, 0x65, 0x31, 0xb3, 0x67, 0xa1, 0x0d,
-	0x28, 0x0f, 0x7c, 0x61, 0xaa, 0x2a, 0x1b, 0x8b, 0xeb, 0xb1, 0x77, 0x6f, 0xa2, 0x27, 0x1c, 0x8b,
-	0xa1, 0x7b, 0x50, 0x0a, 0x7d, 0xc3, 0x24, 0x54, 0xa1, 0xca, 0x14, 0xce, 0xb1, 0xf1, 0x9e, 0x45,
-	0x97, 0x7c, 0xc3, 0x6d, 0xb1, 0xa5, 0x3c, 0x5f, 0x62, 0xe3, 0x3d, 0x0b, 0xbd, 0x84, 0x0a, 0x5f,
-	0x22, 0x1d, 0xcf, 0x3c, 0x5d, 0x2e, 0x30, 0x5b, 0x68, 0x5d, 0xc0, 0x84, 0xe9, 0xd2, 0x36, 0x5d,
-	0xc1, 0xe0, 0x0f, 0x9e, 0xf5, 0x7f, 0x2a, 0x50, 0xc7, 0x24, 0xe8, 0x78, 0x6e, 0x40, 0xfe, 0x2f,
-	0x01, 0xad, 0x80, 0xea, 0x7a, 0xe7, 0x2c, 0x96, 0x51, 0x8a, 0xa8, 0x00, 0x7a, 0x02, 0x05, 0x46,
-	0xb1, 0x88, 0xab, 0xbe, 0x1e, 0x11, 0xbe, 0x4d, 0xff, 0x62, 0xbe, 0xa8, 0x7b, 0xb0, 0xb0, 0x15,
-	0x34, 0x7a, 0xd8, 0x38, 0xdf, 0x25, 0xa1, 0xe0, 0x09, 0xad, 0x43, 0xf1, 0x94, 0x85, 0xc6, 0x82,
-	0xa9, 0x6c, 0x2c, 0xad, 0x47, 0x29, 0x25, 0x31, 0x89, 0x85, 0x14, 0x5a, 0x03, 0xd5, 0x27, 0xef,
-	0x44, 0x6c, 0xcb, 0x03, 0xe1, 0x94, 0x5a, 0x4c, 0x85, 0xf4, 0x10, 0x50, 0xd2, 0x20, 0x07, 0x12,
-	0xbd, 0x48, 0x59, 0xbc, 0x9b, 0xb0, 0x98, 0xc4, 0x7a, 0x60, 0xf2, 0x39, 0xe4, 0x7d, 0x12, 0x44,
-	0x78, 0xde, 0xcb, 0xb0, 0xc9, 0x5f, 0xc3, 0x4c, 0x4c, 0xff, 0x18, 0xe6, 0xd3, 0x41, 0x0e, 0x25,
-	0xb0, 0xfe, 0x33, 0xd0, 0x86, 0x1c, 0x43, 0x90, 0x37, 0x3d, 0x8b, 0x30, 0xb1, 0x02, 0x66, 0xcf,
-	0x23, 0x12, 0x3d, 0x46, 0xf2, 0xb0, 0x7b, 0x23, 0x48, 0xc6, 0x6a, 0xd3, 0x48, 0xb2, 0x95, 0x1b,
-	0x41, 0x32, 0xa1, 0x59, 0x20, 0xf9, 0x85, 0x40, 0x32, 0x11, 0xe4, 0xb8, 0xa5, 0x60, 0x45, 0xe0,
-	0x9b, 0x74, 0x37, 0x03, 0x5f, 0xbd, 0x0b, 0x8b, 0x22, 0xb0, 0x2d, 0xe2, 0x90, 0x90, 0x4c, 0x0a,
-	0xe6, 0xf3, 0x24, 0x98, 0x0f, 0xe4, 0xc0, 0x24, 0xcd, 0x1c, 0xcf, 0x5f, 0xc1, 0x9d, 0x94, 0xd9,
-	0x49, 0x21, 0xfd, 0x4c, 0x82, 0xf4, 0xa3, 0x6c, 0xcb, 0x12, 0xaa, 0x2b, 0x80, 0x32, 0x02, 0x1e,
-	0x4e, 0xd1, 0x4f, 0xe1, 0x76, 0x96, 0x87, 0x59, 0x28, 0x1e, 0x53, 0xb4, 0x69, 0xa9, 0xc6, 0xc6,
-	0xf9, 0xf6, 0x05, 0x31, 0xbb, 0x21, 0x41, 0x4f, 0x20, 0x67, 0x79, 0x4c, 0xaa, 0xbe, 0xb1, 0x38,
-	0x70, 0x4b, 0xac, 0xbe, 0xe9, 0x77, 0x08, 0xce, 0x59, 0x1e, 0x5a, 0x85, 0xb9, 0x76, 0xaf, 0xd9,
-	0x31, 0x6c, 0x5f, 0x44, 0x30, 0x9f, 0x88, 0x80, 0x69, 0x2c, 0xb6, 0xd9, 0x5f, 0xfd, 0x7c, 0x00,
-	0x99, 0xd0, 0x31, 0x29, 0x55, 0xeb, 0x49, 0xaa, 0x52, 0x80, 0xc9, 0xaa, 0x39, 0x57, 0xbf, 0x86,
-	0xa5, 0xb4, 0xe1, 0x49, 0xc9, 0xfa, 0x5c, 0x22, 0xeb, 0xe1, 0x08, 0xdb, 0x12, 0x5b, 0x3b, 0x82,
-	0x85, 0x54, 0xd0, 0x2f, 0xa0, 0x40, 0x2e, 0x88, 0x19, 0x2c, 0x2b, 0x8f, 0xd5, 0xd4, 0x56, 0x92,
-	0x79, 0xc0, 0x5c, 0x4e, 0x5f, 0x83, 0xc5, 0xcc, 0x18, 0xb2, 0xe8, 0x7c, 0x09, 0x85, 0x23, 0xd3,
-	0xeb, 0xb0, 0xea, 0x13, 0x84, 0x86, 0x1f, 0x8a, 0xb4, 0xe0, 0x03, 0x3a, 0xeb, 0xd8, 0x67, 0x76,
-	0x18, 0xed, 0x38, 0x36, 0xd0, 0xff, 0xa6, 0x40, 0xe5, 0x88, 0x38, 0xc4, 0x0c, 0x77, 0x6c, 0xe2,
-	0x58, 0xe8, 0x19, 0xa8, 0x61, 0xbf, 0x23, 0x12, 0x20, 0xf6, 0x2f, 0x21, 0xb2, 0xce, 0xb2, 0x80,
-	0x4a, 0xd1, 0xcf, 0x9a, 0xd1, 0x6a, 0xf9, 0xa4, 0x79, 0xd2, 0x75, 0x4d, 0xa6, 0xb7, 0x8c, 0xcb,
-	0x6c, 0x66, 0xa7, 0xeb, 0x9a, 0x68, 0x05, 0x8a, 0xa6, 0xe7, 0x74, 0xcf, 0x5c, 0xf6, 0x81, 0xa2,
-	0x1f, 0x18, 0xf1, 0xe1, 0xdc, 0x64, 0xb3, 0x58, 0xac, 0xea, 0x4f, 0x21, 0x4f, 0x75, 0x22, 0x80,
-	0x22, 0x5f, 0xd1, 0x6e, 0xa1, 0x05, 0xa8, 0xbd, 0x8a, 0x14, 0x85, 0xb6, 0xe7, 0x6a, 0x8a, 0xfe,
-	0x7b, 0x05, 0x0a, 0x5f, 0x1b, 0xa1, 0x79, 0x9a, 0x50, 0xac, 0x5c, 0xa6, 0x18, 0x7d, 0x04, 0xe5,
-	0xf0, 0xd4, 0x27, 0xc1, 0xa9, 0xe7, 0x58, 0x22, 0xec, 0x78, 0x02, 0x7d, 0x0e, 0x70, 0x46, 0xd5,
-	0x35, 0xc3, 0x7e, 0x87, 0x30, 0x17, 0xeb, 0x1b, 0x68, 0x10, 0x31, 0xb3, 0xc4, 0x42, 0x2d, 0x9f,
-	0x45, 0x8f, 0xfa, 0x8f, 0xa1, 0xb0, 0x4f, 0x61, 0x43, 0x4b, 0x50, 0xf4, 0x4e, 0x4e, 0x02, 0x12,
-	0x8a, 0x8f, 0xb9, 0x18, 0x51, 0x90, 0x4d, 0xaf, 0xeb, 0x72, 0x90, 0xf3, 0x98, 0x0f, 0xf4, 0x36,
-	0xcc, 0x6f, 0x05, 0x1c, 0xc2, 0x49, 0xd3, 0x7f, 0x35, 0x99, 0xfe, 0x4b, 0x29, 0x5e, 0xa4, 0xc4,
-	0xff, 0x47, 0x0e, 0x6a, 0xb2, 0xad, 0xe1, 0xea, 0xfb, 0x04, 0x0a, 0x01, 0x4d, 0x15, 0xa1, 0xaf,
-	0x1e, 0xeb, 0xa3, 0xb3, 0x98, 0x2f, 0xa2, 0x97, 0x00, 0x27, 0x94, 0xf1, 0xa6, 0x63, 0x07, 0xe1,
-	0xb2, 0xca, 0x52, 0x76, 0x31, 0x2b, 0x25, 0x70, 0x99, 0xc9, 0xed, 0xdb, 0x41, 0x88, 0x5e, 0x42,
-	0xed, 0xfc, 0x94, 0xd0, 0x9c, 0xb0, 0x9d, 0x90, 0xf8, 0xc1, 0x72, 0x9e, 0xbd, 0x57, 0x97, 0x81,
-	0xc5, 0x55, 0x26, 0xb4, 0xc3, 0x65, 0xd0, 0x33, 0x28, 0xb7, 0x7c, 0xaf, 0xdb, 0x69, 0x1e, 0xf7,
-	0x83, 0xe5, 0x82, 0x78, 0x41, 0xe6, 0xb4, 0xc4, 0x04, 0x5e, 0xf7, 0x03, 0xea, 0x3c, 0x4f, 0xe4,
-	0x62, 0xca, 0x79, 0x46, 0x8d, 0x48, 0x6c, 0xb9, 0xa7, 0x9a, 0x1b, 0xab, 0xa7, 0xd2, 0xdf, 0x80,
-	0x8a, 0xbd, 0xf3, 0x0c, 0xbc, 0x96, 0xa0, 0xc8, 0x22, 0x0c, 0x44, 0x16, 0x89, 0x11, 0xfa, 0x18,
-	0x6a, 0x2c, 0xdd, 0xad, 0x26, 0x23, 0x3a, 0x60, 0x20, 0xa9, 0xb8, 0xca, 0x27, 0x37, 0xd9, 0x9c,
-	0xde, 0x01, 0x2d, 0x66, 0x7f, 0xd2, 0x1a, 0xf4, 0x4c, 0xaa, 0x41, 0x77, 0x87, 0x12, 0x40, 0xaa,
-	0x3e, 0xdf, 0x41, 0x3d, 0x65, 0x2f, 0xab, 0x49, 0x79, 0x0c, 0x79, 0xdf, 0x3b, 0xa7, 0x21, 0x51,
-	0xbc, 0xab, 0xb1, 0x07, 0xde, 0x39, 0x66, 0x2b, 0x89, 0x2c, 0x57, 0x93, 0x59, 0xae, 0x7f, 0x03,
-	0xa5, 0x06, 0xe9, 0xbf, 0xa5, 0x9f, 0x6c, 0x0a, 0x56, 0x23, 0x06, 0xab, 0xc1, 0x3f, 0xed, 0x6f,
-	0x93, 0x9f, 0x76, 0x2e, 0x77, 0x1f, 0x4a, 0xdb, 0x17, 0x1d, 0xdb, 0x27, 0xaf, 0xb8, 0x36, 0x15,
-	0x0f, 0xc6, 0x7c, 0x7f, 0xec, 0xb9, 0x01, 0xf1, 0x67, 0xbd, 0x3f, 0x24, 0xa5, 0x7c, 0x7f, 0x30,
-	0x3a, 0xa2, 0xf9, 0x59, 0xd3, 0x21, 0xeb, 0x15, 0x74, 0xfc, 0x59, 0x81, 0x9a, 0x1c, 0xdd, 0x53,
-	0x01, 0x3d, 0xff, 0x0c, 0x2c, 0xc4, 0x9f, 0x01, 0x81, 0xaa, 0xc0, 0xff, 0x13, 0x98, 0x37, 0x4f,
-	0x89, 0xd9, 0x6e, 0x5a, 0xdd, 0x8e, 0x63, 0x9b, 0x46, 0xc8, 0x31, 0x2d, 0xe1, 0x3a, 0x9b, 0xde,
-	0x8a, 0x66, 0xe5, 0x64, 0x57, 0xc7, 0x4b, 0x76, 0x17, 0xea, 0x29, 0x14, 0xb2, 0x92, 0x84, 0x66,
-	0xf8, 0xc9, 0x09, 0x31, 0x43, 0x62, 0x35, 0xdb, 0xa4, 0x1f, 0x88, 0xc2, 0x56, 0x8d, 0x26, 0x1b,
-	0xa4, 0xcf, 0xb6, 0xc1, 0xc0, 0x43, 0x2a, 0xc5, 0x5c, 0xa8, 0xe2, 0xea, 0x60, 0xb2, 0x41, 0xfa,
-	0xfa, 0xcf, 0x01, 0xbd, 0xa6, 0x5b, 0x5f, 0x46, 0x62, 0x8d, 0x02, 0xf9, 0x2e, 0x42, 0x62, 0x14,
-	0x71, 0x4c, 0x46, 0xdf, 0x82, 0xdb, 0x92, 0x06, 0xe1, 0xf6, 0x73, 0x28, 0x50, 0x98, 0xa3, 0x44,
-	0x1e, 0x49, 0x06, 0x97, 0xe2, 0xc9, 0x36, 0x5d, 0xdb, 0x38, 0x22, 0xd9, 0x32, 0x3a, 0x46, 0x96,
-	0x6c, 0xd3, 0x36, 0x8b, 0xa3, 0x92, 0x2d, 0xb3, 0x4f, 0xfc, 0x5e, 0x81, 0xda, 0x15, 0x3d, 0xe2,
-	0xd8, 0xe5, 0x3f, 0x55, 0xc9, 0xd5, 0x31, 0x2a, 0xf9, 0x12, 0x14, 0x6d, 0xd7, 0x22, 0x17, 0xbc,
-	0xee, 0xe7, 0xb1, 0x18, 0xc9, 0x19, 0x0a, 0xe3, 0x65, 0xe8, 0x1e, 0xd4, 0xaf, 0xee, 0x62, 0xc7,
-	0xca, 0x50, 0xfd, 0xa7, 0x50, 0xe0, 0xfd, 0xcd, 0x03, 0x28, 0xf3, 0xe6, 0x20, 0x3e, 0x88, 0x97,
-	0xf8, 0xc4, 0x9e, 0x35, 0xe2, 0x50, 0xf2, 0x13, 0xa8, 0x61, 0x62, 0xd9, 0x41, 0xb2, 0xe4, 0x8d,
-	0x75, 0x9a, 0xf9, 0x0d, 0xcc, 0xb1, 0x17, 0xb7, 0xbc, 0x71, 0x5f, 0x41, 0x3a, 0xe4, 0xbc, 0xce,
-	0x50, 0x2f, 0x72, 0xd0, 0x21, 0xbe, 0x41, 0xbb, 0x20, 0x9c, 0xf3, 0x3a, 0x68, 0x05, 0xf2, 0xa6,
-	0x11, 0x10, 0x76, 0xbe, 0x4f, 0x4a, 0x6d, 0x5f, 0xd8, 0x41, 0xb8, 0x69, 0xd0, 0x4c, 0xa0, 0xeb,
-	0xfa, 0x77, 0x50, 0x6d, 0xf4, 0x8e, 0xe2, 0xe3, 0xec, 0x0a, 0xe4, 0xda, 0xbd, 0x8c, 0x0c, 0x4f,
-	0x84, 0x86, 0x73, 0xed, 0xde, 0x40, 0x7f, 0xee, 0x0a, 0xfd, 0x5f, 0x41, 0x4d, 0xe8, 0x9f, 0x96,
-	0x1d, 0x1b, 0xea, 0xb4, 0x57, 0x3f, 0x9a, 0xfc, 0x7e, 0xe1, 0x93, 0xe4, 0x8e, 0xbc, 0x93, 0x68,
-	0xab, 0x8f, 0x52, 0x97, 0x0b, 0x2e, 0xdd, 0xfd, 0xb2, 0xdb, 0xd7, 0xde, 0x8f, 0x6b, 0xd2, 0x7e,
-	0x5c, 0x4a, 0x5b, 0x93, 0xb6, 0xe3, 0x63, 0x4a, 0xc2, 0xa5, 0x77, 0x0a, 0x5f, 0x50, 0x18, 0x27,
-	0xbb, 0x50, 0x10, 0xb8, 0xed, 0xde, 0x00, 0x6e, 0xbb, 0xd9, 0xb8, 0xed, 0xde, 0x0c, 0x6e, 0xc3,
-	0xd7, 0x31, 0x04, 0x16, 0x1a, 0x3d, 0x56, 0xed, 0x13, 0x59, 0xb1, 0x0a, 0x6a, 0xbb, 0x37, 0xfc,
-	0xad, 0x90, 0x53, 0x98, 0x8a, 0x8c, 0x9d, 0xc3, 0x5f, 0xd3, 0x53, 0x75, 0x6c, 0x66, 0xda, 0x44,
-	0x0e, 0xe0, 0x36, 0x45, 0x29, 0xed, 0xf7, 0x75, 0x59, 0xf9, 0x51, 0x92, 0x95, 0xfb, 0x09, 0x9c,
-	0x52, 0x8a, 0x39, 0x35, 0x17, 0xfc, 0x32, 0x64, 0x28, 0x8a, 0x6b, 0xf3, 0xf3, 0x42, 0xe2, 0xe7,
-	0x41, 0xa6, 0x5d, 0x89, 0xa4, 0x2f, 0x07, 0x24, 0x25, 0x52, 0x30, 0x0b, 0x3c, 0x04, 0x79, 0x81,
-	0x99, 0xba, 0x5a, 0xc5, 0xec, 0x59, 0xc7, 0x03, 0xe8, 0xaf, 0x4a, 0x7e, 0x41, 0x7b, 0xee, 0x4a,
-	0xda, 0x25, 0xfc, 0x77, 0x6f, 0x0a, 0xff, 0xdd, 0x4b, 0xf0, 0xdf, 0xbd, 0x41, 0xfc, 0x87, 0x37,
-	0xc9, 0x9f, 0x14, 0x56, 0x82, 0x4d, 0xc3, 0x8d, 0x22, 0xbd, 0xc6, 0xd1, 0x9f, 0x5d, 0x4a, 0xd3,
-	0x13, 0x4a, 0xd3, 0x73, 0x1d, 0xde, 0xb2, 0x95, 0x70, 0x99, 0xcd, 0x1c, 0xb8, 0x4e, 0x1f, 0xdd,
-	0x83, 0x52, 0x9b, 0xf4, 0xf9, 0x62, 0x9e, 0x2d, 0xce, 0xb5, 0x49, 0x9f, 0x2d, 0x3d, 0x80, 0xf2,
-	0x99, 0x71, 0xc1, 0xcf, 0x3c, 0xec, 0xf2, 0x58, 0xc5, 0xa5, 0x33, 0xe3, 0x82, 0x9d, 0x77, 0xf4,
-	0xdf, 0x41, 0x3d, 0xf2, 0xe9, 0xf2, 0x82, 0x16, 0x1f, 0x94, 0x55, 0x71, 0x50, 0x8e, 0x98, 0x56,
-	0xaf, 0xde, 0xe0, 0xf7, 0xa0, 0xe4, 0x18, 0x41, 0xc8, 0xba, 0xcd, 0x3c, 0x8b, 0x6a, 0x8e, 0x8e,
-	0x69, 0xa3, 0xd9, 0x16, 0x25, 0x3e, 0x01, 0xcb, 0x8c, 0x1a, 0x3c, 0x49, 0x69, 0xa2, 0xc1, 0x4b,
-	0xc5, 0x3b, 0xb3, 0x06, 0x4f, 0xd6, 0x2b, 0x48, 0x6f, 0xc0, 0x7c, 0xa3, 0x77, 0x55, 0x87, 0x37,
-	0x6e, 0xfd, 0x6b, 0x80, 0x16, 0x2b, 0x9b, 0xb6, 0xfa, 0x89, 0xfb, 0xed, 0xe9, 0x7a, 0xeb, 0x91,
-	0xf7, 0xdb, 0x19, 0xdd, 0xb5, 0xb8, 0xdf, 0x9e, 0xb6, 0xbf, 0x1e, 0x7d, 0xbf, 0x9d, 0xd9, 0x61,
-	0x63, 0x58, 0x14, 0x3b, 0x52, 0x8e, 0x34, 0x2a, 0x72, 0x4a, 0x5c, 0xe4, 0xc6, 0xe6, 0xe1, 0x10,
-	0xee, 0xa4, 0x74, 0x4e, 0x4b, 0x46, 0x9f, 0xdf, 0x7f, 0x66, 0xf8, 0x79, 0x5d, 0x46, 0x5e, 0x24,
-	0x19, 0x79, 0x98, 0xae, 0x4a, 0x19, 0xb4, 0xfc, 0x16, 0xee, 0x0e, 0x99, 0x9e, 0x94, 0x9b, 0x0d,
-	0x89, 0x9b, 0x47, 0xa3, 0xac, 0x4b, 0x04, 0xfd, 0x41, 0xe1, 0xb7, 0xa6, 0x6e, 0x8b, 0xc8, 0x91,
-	0x5f, 0xa7, 0x3a, 0x4a, 0x35, 0x4e, 0x95, 0x6b, 0xdc, 0xd8, 0x2d, 0x78, 0x9b, 0xd2, 0x2a, 0x39,
-	0x32, 0xed, 0x51, 0x3b, 0x59, 0xf7, 0x54, 0xb9, 0xee, 0xf5, 0xa3, 0x1b, 0xef, 0xa1, 0xb8, 0x67,
-	0xc6, 0xf8, 0xb0, 0x6e, 0x89, 0xf1, 0xac, 0x48, 0x67, 0xc8, 0x78, 0x86, 0x7a, 0xc1, 0xf8, 0x5f,
-	0x14, 0x28, 0xef, 0x7b, 0x66, 0x9b, 0x9f, 0xcf, 0xb2, 0x8f, 0x56, 0x75, 0xc8, 0x89, 0x9f, 0x4a,
-	0xcb, 0x38, 0x67, 0x5b, 0xe8, 0x07, 0x50, 0xb1, 0x98, 0xae, 0x26, 0x3d, 0x71, 0x32, 0x2a, 0x55,
-	0x0c, 0x7c, 0x8a, 0x1e, 0x47, 0xa9, 0x40, 0xb7, 0x63, 0x19, 0x91, 0x00, 0xff, 0xce, 0x01, 0x9f,
-	0x8a, 0x04, 0x84, 0x86, 0x13, 0xc7, 0x68, 0xb1, 0xeb, 0xc8, 0x52, 0xa4, 0x61, 0xc7, 0x31, 0x5a,
-	0xfa, 0x1f, 0x15, 0xa8, 0x50, 0xb7, 0x46, 0xd7, 0xe9, 0xd5, 0xa4, 0xab, 0x95, 0x44, 0x26, 0x0d,
-	0xa2, 0x89, 0xdc, 0x9f, 0xe0, 0x00, 0x4d, 0x43, 0x3e, 0xee, 0x2f, 0x57, 0x78, 0xc8, 0xc7, 0x7d,
-	0xbd, 0x05, 0xb5, 0xad, 0x20, 0xe9, 0xd0, 0x75, 0x13, 0x63, 0x25, 0x99, 0x18, 0x8b, 0x92, 0xb3,
-	0x52, 0x3e, 0x78, 0x50, 0xe5, 0x73, 0x19, 0xe9, 0xae, 0xc6, 0x1d, 0x00, 0xff, 0xf5, 0x99, 0xff,
-	0x6e, 0xc0, 0x07, 0x31, 0x77, 0x6a, 0x92, 0xbb, 0x14, 0x15, 0xf9, 0x34, 0x15, 0xfa, 0x0e, 0x94,
-	0xa8, 0xc1, 0x3d, 0xf7, 0xc4, 0x9b, 0x06, 0x65, 0xfd, 0x0d, 0x68, 0x74, 0x4e, 0xfa, 0x9c, 0x3f,
-	0x85, 0xbc, 0xed, 0x9e, 0x78, 0x43, 0x97, 0x75, 0x91, 0x41, 0xcc, 0x96, 0xa5, 0x9d, 0x99, 0x93,
-	0x77, 0xa6, 0x43, 0xcf, 0x69, 0x12, 0x20, 0xd7, 0xde, 0x15, 0x9f, 0x4a, 0xbb, 0xe2, 0x4e, 0x0a,
-	0x7a, 0x69, 0x33, 0xfc, 0x5d, 0x81, 0x05, 0x3a, 0xfd, 0x2d, 0x83, 0x67, 0x74, 0xee, 0x65, 0x6c,
-	0x88, 0xcb, 0xf3, 0xfd, 0x87, 0x50, 0x15, 0x02, 0x1c, 0xcd, 0x22, 0xd3, 0x25, 0x5e, 0x7a, 0x3b,
-	0x69, 0x96, 0xf2, 0xa6, 0x7d, 0xd8, 0xe1, 0x19, 0x35, 0xed, 0x43, 0x8a, 0x79, 0x86, 0xfa, 0xb4,
-	0x69, 0x4f, 0xae, 0x7d, 0x00, 0x62, 0xba, 0x50, 0xfb, 0xd6, 0x75, 0x2e, 0xad, 0x07, 0x69, 0x4e,
-	0x66, 0xb1, 0xeb, 0x59, 0x3f, 0x2c, 0x1b, 0x9e, 0x51, 0x3f, 0x2c, 0x29, 0x8d, 0xee, 0x09, 0xb4,
-	0xd8, 0xd8, 0x07, 0xc0, 0xf4, 0x97, 0x80, 0xb8, 0xb5, 0x1d, 0xcf, 0x37, 0x2f, 0x49, 0xf6, 0x59,
-	0x00, 0xc9, 0xfe, 0xeb, 0x20, 0xc3, 0xda, 0x8c, 0xfe, 0xeb, 0x60, 0x58, 0x33, 0x87, 0x34, 0x80,
-	0x3b, 0x29, 0xb3, 0x1f, 0x00, 0xd7, 0x23, 0x98, 0x8f, 0x0b, 0xe1, 0xf5, 0xbb, 0xa7, 0xc1, 0xf1,
-	0x8e, 0xa6, 0x72, 0x2d, 0xfa, 0x1d, 0x94, 0x1d, 0x10, 0xd2, 0x6a, 0x67, 0x74, 0x40, 0x48, 0xa9,
-	0x4d, 0x1c, 0x10, 0x86, 0x0a, 0xfa, 0xcc, 0x0e, 0x08, 0x69, 0xcd, 0x1c, 0xbb, 0xb5, 0x2f, 0xa1,
-	0x92, 0xf8, 0x87, 0x09, 0x34, 0xcf, 0x87, 0x7b, 0x6e, 0xcf, 0x70, 0x6c, 0x4b, 0xbb, 0x85, 0x2a,
-	0x30, 0x47, 0x27, 0x0e, 0xbb, 0xa1, 0xa6, 0xa0, 0x3a, 0x00, 0x1d, 0xf0, 0xb6, 0x46, 0xcb, 0xad,
-	0xb5, 0xa1, 0x3c, 0xf8, 0xe9, 0x99, 0x4a, 0xc6, 0xaf, 0x95, 0xa1, 0xb0, 0xfd, 0xae, 0x6b, 0x38,
-	0x9a, 0x82, 0xaa, 0x50, 0xfa, 0xc6, 0x0b, 0xf9, 0x28, 0x87, 0x4a, 0x90, 0xdf, 0x27, 0x41, 0xa0,
-	0xa9, 0xd4, 0x14, 0x7d, 0x3a, 0xf0, 0xf9, 0x52, 0x1e, 0x01, 0x14, 0xf7, 0x0d, 0xbf, 0x45, 0x7c,
-	0xad, 0x80, 0x16, 0xa0, 0xc6, 0x9f, 0xa3, 0xe5, 0xe2, 0xda, 0x2f, 0xa0, 0x3c, 0x68, 0x59, 0x99,
-	0x27, 0x9b, 0xcd, 0xd8, 0x9e, 0x06, 0xd5, 0xed, 0xcd, 0x26, 0xb5, 0x43, 0x45, 0x02, 0x4d, 0x41,
-	0x35, 0x28, 0x6f, 0x6f, 0x36, 0xc5, 0x30, 0x27, 0x5e, 0x78, 0xe5, 0xf6, 0xe9, 0xeb, 0x9a, 0x4a,
-	0xbd, 0xda, 0xde, 0x6c, 0xb2, 0x1c, 0xd5, 0xf2, 0x6b, 0xaf, 0xa1, 0x3c, 0xb8, 0xb7, 0xa6, 0xa2,
-	0x07, 0x87, 0x09, 0xdd, 0x00, 0xc5, 0x83, 0xc3, 0xe6, 0x11, 0x09, 0xb9, 0xd6, 0x83, 0xc3, 0x66,
-	0x04, 0x80, 0x58, 0xda, 0x25, 0xa1, 0xa6, 0xbe, 0xd6, 0xbe, 0x7f, 0xff, 0x48, 0xf9, 0xf7, 0xfb,
-	0x47, 0xca, 0x7f, 0xde, 0x3f, 0x52, 0xfe, 0xfa, 0xdf, 0x47, 0xb7, 0x8e, 0x8b, 0xec, 0xbf, 0x0c,
-	0x5f, 0xfe, 0x2f, 0x00, 0x00, 0xff, 0xff, 0xa6, 0xa0, 0xd5, 0x26, 0xc3, 0x28, 0x00, 0x00,
+	// 2543 bytes of a gzipped FileDescriptorProto
+	0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xc4, 0x5a, 0x4d, 0x73, 0xdb, 0xc6,
+	0xf9, 0x0f, 0x08, 0x92, 0x22, 0x1f, 0x91, 0x14, 0xb5, 0x91, 0x65, 0xd9, 0x8e, 0xfd, 0xf7, 0x1f,
+	0xb1, 0x15, 0x45, 0xae, 0xe5, 0x44, 0x9e, 0x4e, 0x26, 0x4d, 0x0f, 0xb5, 0xf5, 0x16, 0x0d, 0x9d,
+	0x48, 0xb3, 0x72, 0x7c, 0xe8, 0xa1, 0x1c, 0x08, 0x58, 0x51, 0x28, 0x41, 0x00, 0x06, 0x40, 0x4a,
+	0xec, 0xf4, 0xed, 0xd6, 0x53, 0x4f, 0xed, 0xa1, 0xc7, 0x1e, 0x7b, 0xe9, 0xf7, 0xc8, 0xa1, 0x9d,
+	0xe9, 0xb1, 0xc7, 0x8e, 0xfb, 0x3d, 0x3a, 0x9d, 0x7d, 0x01, 0x81, 0x05, 0x40, 0x89, 0xa2, 0x28,
+	0xf7, 0x44, 0xec, 0x0b, 0x9e, 0x97, 0xdf, 0xef, 0xd9, 0x67, 0x9f, 0x5d, 0x02, 0xea, 0xdd, 0x81,
+	0xef, 0x19, 0xde, 0xf1, 0x86, 0xe7, 0xbb, 0xa1, 0x8b, 0xe6, 0x44, 0xf3, 0x6e, 0xad, 0x47, 0x42,
+	0x3d, 0xea, 0xbe, 0x5b, 0x27, 0xbe, 0xef, 0xfa, 0xa3, 0xe6, 0x42, 0x68, 0xf5, 0x48, 0x10, 0xea,
+	0x3d, 0x4f, 0x74, 0x2c, 0x75, 0xdc, 0x8e, 0xcb, 0x1e, 0x9f, 0xd1, 0x27, 0xde, 0xab, 0x7d, 0x06,
+	0xe5, 0xd6, 0xe0, 0x50, 0xb7, 0x7c, 0xd4, 0x04, 0xb5, 0x4b, 0x86, 0x2b, 0xca, 0x43, 0x65, 0xad,
+	0x86, 0xe9, 0x23, 0x5a, 0x82, 0xd2, 0x40, 0xb7, 0xfb, 0x64, 0xa5, 0xc0, 0xfa, 0x78, 0x43, 0xfb,
+	0xbb, 0x02, 0x75, 0x4c, 0xde, 0xf6, 0x49, 0x10, 0x7e, 0x4d, 0x74, 0x93, 0xf8, 0xe8, 0x3e, 0x80,
+	0x61, 0xf7, 0x83, 0x90, 0xf8, 0x6d, 0xcb, 0x64, 0x02, 0x8a, 0xb8, 0x2a, 0x7a, 0xf6, 0x4d, 0xb4,
+	0x09, 0xd5, 0x91, 0x2d, 0x4c, 0xd4, 0xfc, 0xe6, 0xd2, 0x46, 0x6c, 0xdd, 0xeb, 0xe8, 0x09, 0xc7,
+	0xd3, 0xd0, 0x1d, 0xa8, 0x84, 0xbe, 0x6e, 0x10, 0x2a, 0x50, 0x65, 0x02, 0xe7, 0x58, 0x7b, 0xdf,
+	0xa4, 0x43, 0xbe, 0xee, 0x74, 0xd8, 0x50, 0x91, 0x0f, 0xb1, 0xf6, 0xbe, 0x89, 0x9e, 0xc3, 0x3c,
+	0x1f, 0x22, 0x9e, 0x6b, 0x9c, 0xae, 0x94, 0x98, 0x2e, 0xb4, 0x21, 0x60, 0xc2, 0x74, 0x68, 0x87,
+	0x8e, 0x60, 0xf0, 0x47, 0xcf, 0xda, 0xdf, 0x14, 0x68, 0x60, 0x12, 0x78, 0xae, 0x13, 0x90, 0xff,
+	0x89, 0x43, 0xab, 0xa0, 0x3a, 0xee, 0x19, 0xf3, 0x65, 0x9c, 0x20, 0x3a, 0x01, 0x3d, 0x82, 0x12,
+	0xa3, 0x58, 0xf8, 0xd5, 0xd8, 0x88, 0x08, 0xdf, 0xa1, 0xbf, 0x98, 0x0f, 0x6a, 0x2e, 0x2c, 0x6e,
+	0x07, 0xad, 0x01, 0xd6, 0xcf, 0xf6, 0x48, 0x28, 0x78, 0x42, 0x1b, 0x50, 0x3e, 0x65, 0xae, 0x31,
+	0x67, 0xe6, 0x37, 0x97, 0x37, 0xa2, 0x90, 0x92, 0x98, 0xc4, 0x62, 0x16, 0x5a, 0x07, 0xd5, 0x27,
+	0x6f, 0x85, 0x6f, 0x2b, 0xa3, 0xc9, 0x29, 0xb1, 0x98, 0x4e, 0xd2, 0x42, 0x40, 0x49, 0x85, 0x1c,
+	0x48, 0xf4, 0x2c, 0xa5, 0xf1, 0x76, 0x42, 0x63, 0x12, 0xeb, 0x91, 0xca, 0xa7, 0x50, 0xf4, 0x49,
+	0x10, 0xe1, 0x79, 0x27, 0x47, 0x27, 0x7f, 0x0d, 0xb3, 0x69, 0xda, 0xc7, 0xb0, 0x90, 0x76, 0x32,
+	0x13, 0xc0, 0xda, 0x8f, 0xa1, 0x99, 0x31, 0x0c, 0x41, 0xd1, 0x70, 0x4d, 0xc2, 0xa6, 0x95, 0x30,
+	0x7b, 0x1e, 0x13, 0xe8, 0x31, 0x92, 0x87, 0xfd, 0x1b, 0x41, 0x32, 0x16, 0x9b, 0x46, 0x92, 0x8d,
+	0xdc, 0x08, 0x92, 0x09, 0xc9, 0x02, 0xc9, 0x2f, 0x05, 0x92, 0x09, 0x27, 0x27, 0x4d, 0x05, 0xab,
+	0x02, 0xdf, 0xa4, 0xb9, 0x39, 0xf8, 0x6a, 0x7d, 0x58, 0x12, 0x8e, 0x6d, 0x13, 0x9b, 0x84, 0x64,
+	0x5a, 0x30, 0x9f, 0x26, 0xc1, 0xbc, 0x27, 0x3b, 0x26, 0x49, 0xe6, 0x78, 0xfe, 0x02, 0x6e, 0xa5,
+	0xd4, 0x4e, 0x0b, 0xe9, 0x67, 0x12, 0xa4, 0x1f, 0xe5, 0x6b, 0x96, 0x50, 0x5d, 0x05, 0x94, 0xe3,
+	0x70, 0x36, 0x44, 0x3f, 0x85, 0x0f, 0xf3, 0x2c, 0xcc, 0x43, 0xf1, 0x98, 0xa2, 0x4d, 0x53, 0x35,
+	0xd6, 0xcf, 0x76, 0xce, 0x89, 0xd1, 0x0f, 0x09, 0x7a, 0x04, 0x05, 0xd3, 0x65, 0xb3, 0x1a, 0x9b,
+	0x4b, 0x23, 0xb3, 0xc4, 0xe8, 0xeb, 0xa1, 0x47, 0x70, 0xc1, 0x74, 0xd1, 0x1a, 0xcc, 0x75, 0x07,
+	0x6d, 0x4f, 0xb7, 0x7c, 0xe1, 0xc1, 0x42, 0xc2, 0x03, 0x26, 0xb1, 0xdc, 0x65, 0xbf, 0xda, 0xd9,
+	0x08, 0x32, 0x21, 0x63, 0x5a, 0xaa, 0x36, 0x92, 0x54, 0xa5, 0x00, 0x93, 0x45, 0x73, 0xae, 0x7e,
+	0x09, 0xcb, 0x69, 0xc5, 0xd3, 0x92, 0xf5, 0xb9, 0x44, 0xd6, 0xfd, 0x31, 0xba, 0x25, 0xb6, 0x76,
+	0x05, 0x0b, 0x29, 0xa7, 0x9f, 0x41, 0x89, 0x9c, 0x13, 0x23, 0x58, 0x51, 0x1e, 0xaa, 0xa9, 0xa5,
+	0x24, 0xf3, 0x80, 0xf9, 0x3c, 0x6d, 0x1d, 0x96, 0x72, 0x7d, 0xc8, 0xa3, 0xf3, 0x39, 0x94, 0x8e,
+	0x0c, 0xd7, 0x63, 0xd9, 0x27, 0x08, 0x75, 0x3f, 0x14, 0x61, 0xc1, 0x1b, 0xb4, 0xd7, 0xb6, 0x7a,
+	0x56, 0x18, 0xad, 0x38, 0xd6, 0xd0, 0xfe, 0xa2, 0xc0, 0xfc, 0x11, 0xb1, 0x89, 0x11, 0xee, 0x5a,
+	0xc4, 0x36, 0xd1, 0x13, 0x50, 0xc3, 0xa1, 0x27, 0x02, 0x20, 0xb6, 0x2f, 0x31, 0x65, 0x83, 0x45,
+	0x01, 0x9d, 0x45, 0xb7, 0x35, 0xbd, 0xd3, 0xf1, 0x49, 0xfb, 0xa4, 0xef, 0x18, 0x4c, 0x6e, 0x15,
+	0x57, 0x59, 0xcf, 0x6e, 0xdf, 0x31, 0xd0, 0x2a, 0x94, 0x0d, 0xd7, 0xee, 0xf7, 0x1c, 0xb6, 0x41,
+	0xd1, 0x0d, 0x46, 0x6c, 0x9c, 0x5b, 0xac, 0x17, 0x8b, 0x51, 0xed, 0x31, 0x14, 0xa9, 0x4c, 0x04,
+	0x50, 0xe6, 0x23, 0xcd, 0x0f, 0xd0, 0x22, 0xd4, 0x5f, 0x44, 0x82, 0x42, 0xcb, 0x75, 0x9a, 0x8a,
+	0xf6, 0x5b, 0x05, 0x4a, 0xdf, 0xe8, 0xa1, 0x71, 0x9a, 0x10, 0xac, 0x5c, 0x24, 0x18, 0x7d, 0x04,
+	0xd5, 0xf0, 0xd4, 0x27, 0xc1, 0xa9, 0x6b, 0x9b, 0xc2, 0xed, 0xb8, 0x03, 0x7d, 0x0e, 0xd0, 0xa3,
+	0xe2, 0xda, 0xe1, 0xd0, 0x23, 0xcc, 0xc4, 0xc6, 0x26, 0x1a, 0x79, 0xcc, 0x34, 0x31, 0x57, 0xab,
+	0xbd, 0xe8, 0x51, 0xfb, 0x21, 0x94, 0x5e, 0x51, 0xd8, 0xd0, 0x32, 0x94, 0xdd, 0x93, 0x93, 0x80,
+	0x84, 0x62, 0x33, 0x17, 0x2d, 0x0a, 0xb2, 0xe1, 0xf6, 0x1d, 0x0e, 0x72, 0x11, 0xf3, 0x86, 0xd6,
+	0x85, 0x85, 0xed, 0x80, 0x43, 0x38, 0x6d, 0xf8, 0xaf, 0x25, 0xc3, 0x7f, 0x39, 0xc5, 0x8b, 0x14,
+	0xf8, 0xff, 0x29, 0x40, 0x5d, 0xd6, 0x95, 0xcd, 0xbe, 0x8f, 0xa0, 0x14, 0xd0, 0x50, 0x11, 0xf2,
+	0x1a, 0xb1, 0x3c, 0xda, 0x8b, 0xf9, 0x20, 0x7a, 0x0e, 0x70, 0x42, 0x19, 0x6f, 0xdb, 0x56, 0x10,
+	0xae, 0xa8, 0x2c, 0x64, 0x97, 0xf2, 0x42, 0x02, 0x57, 0xd9, 0xbc, 0x57, 0x56, 0x10, 0xa2, 0xe7,
+	0x50, 0x3f, 0x3b, 0x25, 0x34, 0x26, 0x2c, 0x3b, 0x24, 0x7e, 0xb0, 0x52, 0x64, 0xef, 0x35, 0x64,
+	0x60, 0x71, 0x8d, 0x4d, 0xda, 0xe5, 0x73, 0xd0, 0x13, 0xa8, 0x76, 0x7c, 0xb7, 0xef, 0xb5, 0x8f,
+	0x87, 0xc1, 0x4a, 0x49, 0xbc, 0x20, 0x73, 0x5a, 0x61, 0x13, 0x5e, 0x0e, 0x03, 0x6a, 0x3c, 0x0f,
+	0xe4, 0x72, 0xca, 0x78, 0x46, 0x8d, 0x08, 0x6c, 0xb9, 0xa6, 0x9a, 0x9b, 0xac, 0xa6, 0xfa, 0x18,
+	0xea, 0xae, 0x47, 0x9c, 0x76, 0xe0, 0xe8, 0x5e, 0x70, 0xea, 0x86, 0x2b, 0x95, 0x87, 0xca, 0x5a,
+	0x05, 0xd7, 0x68, 0xe7, 0x91, 0xe8, 0x43, 0xff, 0x07, 0xf3, 0xd1, 0x38, 0xad, 0xbd, 0xaa, 0x8c,
+	0x68, 0x88, 0xba, 0xf6, 0x4d, 0xed, 0x35, 0xa8, 0xd8, 0x3d, 0xcb, 0x41, 0x7d, 0x19, 0xca, 0x0c,
+	0xa7, 0x40, 0xc4, 0xa2, 0x68, 0x51, 0xb5, 0x6c, 0xd1, 0x98, 0x6d, 0x16, 0x2e, 0x01, 0x83, 0x5a,
+	0xc5, 0x35, 0xde, 0xb9, 0xc5, 0xfa, 0x34, 0x0f, 0x9a, 0x71, 0x0c, 0x4d, 0x9b, 0xc9, 0x9e, 0x48,
+	0x99, 0xec, 0x76, 0x26, 0x8c, 0xa4, 0x1c, 0xf6, 0x1b, 0x68, 0xa4, 0xf4, 0xe5, 0x95, 0x3a, 0x0f,
+	0xa1, 0xe8, 0xbb, 0x67, 0xd4, 0x25, 0xca, 0x5a, 0x2d, 0xb6, 0xc0, 0x3d, 0xc3, 0x6c, 0x24, 0xb1,
+	0x56, 0x54, 0x69, 0xad, 0xa4, 0x80, 0x2c, 0x66, 0x80, 0xfc, 0x16, 0x2a, 0x2d, 0x32, 0x7c, 0x43,
+	0x2b, 0x03, 0x8a, 0x66, 0x2b, 0x46, 0xb3, 0xc5, 0x2b, 0x88, 0x37, 0xc9, 0x0a, 0x82, 0xcf, 0xbb,
+	0x0b, 0x95, 0x9d, 0x73, 0xcf, 0xf2, 0xc9, 0x0b, 0xae, 0x4e, 0xc5, 0xa3, 0x36, 0x5f, 0x86, 0xfb,
+	0x4e, 0x40, 0xfc, 0x59, 0x2f, 0x43, 0x49, 0x28, 0x5f, 0x86, 0x8c, 0xaf, 0xa8, 0x7f, 0xd6, 0x7c,
+	0xc9, 0x72, 0x05, 0x5f, 0x7f, 0x50, 0xa0, 0x2e, 0x7b, 0xf7, 0x58, 0x70, 0xc3, 0x77, 0x9b, 0xc5,
+	0x78, 0xb7, 0x11, 0xa8, 0x0a, 0x82, 0x3e, 0x81, 0x05, 0xe3, 0x94, 0x18, 0xdd, 0xb6, 0xd9, 0xf7,
+	0x6c, 0xcb, 0xd0, 0x43, 0x8e, 0x69, 0x05, 0x37, 0x58, 0xf7, 0x76, 0xd4, 0x2b, 0xaf, 0x29, 0x75,
+	0xa2, 0x35, 0xa5, 0x39, 0xd0, 0x48, 0xa1, 0x90, 0x17, 0x45, 0x74, 0x09, 0x9c, 0x9c, 0x10, 0x23,
+	0x24, 0x66, 0xbb, 0x4b, 0x86, 0x81, 0xc8, 0x9f, 0xb5, 0xa8, 0xb3, 0x45, 0x86, 0x6c, 0x9d, 0x8c,
+	0x2c, 0xa4, 0xb3, 0x98, 0x09, 0x35, 0x5c, 0x1b, 0x75, 0xb6, 0xc8, 0x50, 0xfb, 0x09, 0xa0, 0x97,
+	0x34, 0xc3, 0xc8, 0x48, 0xac, 0x53, 0x20, 0xdf, 0x46, 0x48, 0x8c, 0x23, 0x8e, 0xcd, 0xd1, 0xb6,
+	0xe1, 0x43, 0x49, 0x82, 0x30, 0xfb, 0x29, 0x94, 0x28, 0xcc, 0x51, 0xa4, 0x8f, 0x25, 0x83, 0xcf,
+	0xe2, 0xc1, 0x76, 0xbd, 0xea, 0x74, 0x4c, 0xb0, 0xe5, 0x14, 0xa6, 0x2c, 0xd8, 0xae, 0x5b, 0x93,
+	0x8e, 0x0b, 0xb6, 0xdc, 0x72, 0xf4, 0x7b, 0x05, 0xea, 0x97, 0x94, 0xa2, 0x13, 0xef, 0x32, 0xa9,
+	0x0d, 0x43, 0x9d, 0x60, 0xc3, 0x58, 0x86, 0xb2, 0xe5, 0x98, 0xe4, 0x9c, 0x6f, 0x2f, 0x45, 0x2c,
+	0x5a, 0x72, 0x84, 0xc2, 0x64, 0x11, 0xba, 0x0f, 0x8d, 0xcb, 0x8b, 0xe5, 0x89, 0x22, 0x54, 0xfb,
+	0x11, 0x94, 0x78, 0x19, 0x75, 0x0f, 0xaa, 0xbc, 0x06, 0x89, 0xcf, 0xfb, 0x15, 0xde, 0xb1, 0x6f,
+	0x8e, 0x39, 0xfb, 0x7c, 0x01, 0x75, 0x4c, 0x4c, 0x2b, 0x48, 0xa6, 0xbc, 0x89, 0x0e, 0x4d, 0xbf,
+	0x82, 0x39, 0xf6, 0xe2, 0xb6, 0x3b, 0xe9, 0x2b, 0x48, 0x83, 0x82, 0xeb, 0x65, 0x4a, 0x9e, 0x03,
+	0x8f, 0xf8, 0x3a, 0x2d, 0xb6, 0x70, 0xc1, 0xf5, 0xd0, 0x2a, 0x14, 0x0d, 0x3d, 0x20, 0x2c, 0x2f,
+	0x27, 0x67, 0xed, 0x9c, 0x5b, 0x41, 0xb8, 0xa5, 0xd3, 0x48, 0xa0, 0xe3, 0xda, 0xcf, 0xa0, 0xd6,
+	0x1a, 0x1c, 0xc5, 0xa7, 0xe6, 0x55, 0x28, 0x74, 0x07, 0x39, 0x11, 0x9e, 0x70, 0x0d, 0x17, 0xba,
+	0x83, 0x91, 0xfc, 0xc2, 0x25, 0xf2, 0xbf, 0x86, 0xba, 0x90, 0x7f, 0x5d, 0x76, 0x2c, 0x68, 0xd0,
+	0x23, 0xc1, 0xd1, 0xf4, 0xd7, 0x18, 0x9f, 0x24, 0x57, 0xe4, 0xad, 0x44, 0xf5, 0x7e, 0x94, 0xba,
+	0xc3, 0x70, 0xe8, 0xea, 0x97, 0xcd, 0xbe, 0xf2, 0x7a, 0x5c, 0x97, 0xd6, 0xe3, 0x72, 0x5a, 0x9b,
+	0xb4, 0x1c, 0x1f, 0x52, 0x12, 0x2e, 0xbc, 0xba, 0xf8, 0x92, 0xc2, 0x38, 0xdd, 0xbd, 0x85, 0xc0,
+	0x6d, 0xef, 0x06, 0x70, 0xdb, 0xcb, 0xc7, 0x6d, 0xef, 0x66, 0x70, 0xcb, 0xde, 0xfa, 0x10, 0x58,
+	0x6c, 0x0d, 0x58, 0xb6, 0x4f, 0x44, 0xc5, 0x1a, 0xa8, 0xdd, 0x41, 0x76, 0xaf, 0x90, 0x43, 0x98,
+	0x4e, 0x99, 0x38, 0x86, 0xbf, 0xa1, 0x87, 0xf7, 0x58, 0xcd, 0x75, 0x03, 0x39, 0x80, 0x0f, 0x29,
+	0x4a, 0x69, 0xbb, 0xaf, 0xca, 0xca, 0x0f, 0x92, 0xac, 0xdc, 0x4d, 0xe0, 0x94, 0x12, 0xcc, 0xa9,
+	0x39, 0xe7, 0x77, 0x2e, 0x19, 0x2f, 0xae, 0xcc, 0xcf, 0x33, 0x89, 0x9f, 0x7b, 0xb9, 0x7a, 0x25,
+	0x92, 0xbe, 0x1a, 0x91, 0x94, 0x08, 0xc1, 0x3c, 0xf0, 0x10, 0x14, 0x05, 0x66, 0xea, 0x5a, 0x0d,
+	0xb3, 0x67, 0x0d, 0x8f, 0xa0, 0xbf, 0x2c, 0xf8, 0x05, 0xed, 0x85, 0x4b, 0x69, 0x97, 0xf0, 0xdf,
+	0xbb, 0x29, 0xfc, 0xf7, 0x2e, 0xc0, 0x7f, 0xef, 0x06, 0xf1, 0xcf, 0x2e, 0x92, 0x7f, 0x2a, 0x2c,
+	0x05, 0x1b, 0xba, 0x13, 0x79, 0x7a, 0x85, 0x1b, 0x06, 0x76, 0xf7, 0x4d, 0x8f, 0x30, 0x6d, 0xd7,
+	0xb1, 0x79, 0xc9, 0x56, 0xc1, 0x55, 0xd6, 0x73, 0xe0, 0xd8, 0x43, 0x74, 0x07, 0x2a, 0x5d, 0x32,
+	0xe4, 0x83, 0x45, 0x36, 0x38, 0xd7, 0x25, 0x43, 0x36, 0x74, 0x0f, 0xaa, 0x3d, 0xfd, 0x9c, 0x1f,
+	0x8a, 0xd8, 0x1d, 0xb5, 0x8a, 0x2b, 0x3d, 0xfd, 0x9c, 0x1d, 0x88, 0xb2, 0x67, 0xb5, 0xf2, 0xe5,
+	0x67, 0xb5, 0xb9, 0xcc, 0x11, 0xe3, 0xcf, 0x0a, 0x34, 0x22, 0xd7, 0x2e, 0xce, 0x8b, 0xf1, 0xb1,
+	0x5e, 0x15, 0xc7, 0xfa, 0x28, 0x60, 0xd4, 0xcb, 0xf3, 0xc4, 0x1d, 0xa8, 0xd8, 0x7a, 0x10, 0xb2,
+	0xa2, 0xb5, 0xc8, 0xc0, 0x99, 0xa3, 0x6d, 0x7a, 0x8c, 0x49, 0x99, 0x58, 0xca, 0x98, 0xd8, 0x15,
+	0x5b, 0x49, 0x02, 0xfe, 0x19, 0x15, 0x92, 0x92, 0xd0, 0x44, 0x21, 0x99, 0x02, 0x64, 0x66, 0x85,
+	0xa4, 0x2c, 0x57, 0x04, 0x57, 0x0b, 0x16, 0x5a, 0x83, 0xcb, 0x2a, 0xc9, 0x49, 0xf3, 0x6c, 0x0b,
+	0x9a, 0xb1, 0xb0, 0xeb, 0x66, 0x59, 0x71, 0x5d, 0x7f, 0xbd, 0x1a, 0x7e, 0xec, 0x75, 0x7d, 0x4e,
+	0x15, 0x2f, 0xae, 0xeb, 0xaf, 0x5b, 0xc7, 0x8f, 0xbf, 0xae, 0xcf, 0xad, 0xe4, 0x31, 0x2c, 0x89,
+	0x95, 0x2f, 0x7b, 0x1a, 0x25, 0x53, 0x25, 0x4e, 0xa6, 0x13, 0xf3, 0x70, 0x08, 0xb7, 0x52, 0x32,
+	0xaf, 0x4b, 0xc6, 0x90, 0x5f, 0xe7, 0xe6, 0xd8, 0x79, 0x55, 0x46, 0x9e, 0x25, 0x19, 0xb9, 0x9f,
+	0xce, 0x7e, 0x39, 0xb4, 0xfc, 0x1a, 0x6e, 0x67, 0x54, 0x4f, 0xcb, 0xcd, 0xa6, 0xc4, 0xcd, 0x83,
+	0x71, 0xda, 0x25, 0x82, 0x7e, 0xa7, 0xf0, 0x4b, 0x60, 0xa7, 0x43, 0x64, 0xcf, 0xaf, 0x92, 0x85,
+	0xa5, 0x5c, 0xaa, 0xa6, 0x72, 0xe9, 0xa4, 0xa5, 0x7e, 0x97, 0xd2, 0x2a, 0x19, 0x72, 0xdd, 0x23,
+	0x7d, 0x32, 0x31, 0xaa, 0x52, 0x62, 0x8c, 0x18, 0xcf, 0xf1, 0x7b, 0x66, 0x8c, 0x67, 0x65, 0x4b,
+	0x8c, 0xe7, 0x79, 0x3a, 0x43, 0xc6, 0x73, 0xc4, 0x0b, 0xc6, 0xbf, 0xa0, 0xfb, 0xed, 0xbe, 0x63,
+	0xf8, 0x17, 0xfe, 0x7f, 0x66, 0x12, 0x3b, 0xd4, 0xa3, 0x1d, 0x89, 0x35, 0xb4, 0x47, 0x74, 0x37,
+	0xe3, 0x2f, 0x5e, 0xf0, 0x47, 0x81, 0xd8, 0x51, 0x92, 0x0a, 0x66, 0xb6, 0xa3, 0x24, 0x84, 0x4a,
+	0x3b, 0x8a, 0x64, 0xd4, 0x0c, 0x77, 0x94, 0xa4, 0xdc, 0xe4, 0xff, 0x8f, 0x2f, 0x3c, 0x8f, 0x38,
+	0xe6, 0x54, 0xff, 0x3f, 0x46, 0xaf, 0x5e, 0x80, 0xa0, 0xd8, 0x1a, 0x64, 0x25, 0x33, 0xdb, 0x1a,
+	0x24, 0xb1, 0xd2, 0xd6, 0x90, 0x32, 0x6d, 0x86, 0x5b, 0x83, 0x2c, 0x59, 0x20, 0xf9, 0x47, 0x05,
+	0xaa, 0xaf, 0x5c, 0xa3, 0xcb, 0xef, 0x23, 0xf2, 0xaf, 0x12, 0x1a, 0x50, 0x10, 0x5f, 0x20, 0x54,
+	0x71, 0xc1, 0x32, 0x69, 0x3d, 0x63, 0xb2, 0x98, 0x6e, 0x87, 0x56, 0x8f, 0xa7, 0x14, 0x15, 0x03,
+	0xef, 0x7a, 0x6d, 0xf5, 0x08, 0x9d, 0xd0, 0xf7, 0x4c, 0x3d, 0x9a, 0xc0, 0xeb, 0x3a, 0xe0, 0x5d,
+	0xd1, 0x04, 0x21, 0xe1, 0xc4, 0xd6, 0x3b, 0xa2, 0xae, 0x13, 0x12, 0x76, 0x6d, 0xbd, 0xa3, 0xfd,
+	0x5e, 0x81, 0x79, 0x6a, 0xd6, 0x78, 0x76, 0xd7, 0x92, 0xa6, 0xce, 0x27, 0x32, 0xda, 0xc8, 0x9b,
+	0xc8, 0xfc, 0x29, 0x2e, 0x8c, 0xa8, 0xcb, 0xc7, 0xc3, 0x95, 0x79, 0xee, 0xf2, 0xf1, 0x50, 0xeb,
+	0x40, 0x7d, 0x3b, 0x48, 0x1a, 0x74, 0xd5, 0x48, 0x58, 0x4d, 0x46, 0xc2, 0x92, 0x64, 0xac, 0x14,
+	0x05, 0x2e, 0xd4, 0x78, 0x5f, 0x4e, 0x68, 0xaa, 0x71, 0xa9, 0xca, 0x3f, 0xea, 0xe0, 0x7f, 0xc7,
+	0xf1, 0x46, 0xcc, 0x9d, 0x9a, 0xe4, 0x2e, 0x45, 0x45, 0x31, 0x4d, 0x85, 0xb6, 0x0b, 0x15, 0xaa,
+	0x70, 0xdf, 0x39, 0x71, 0xaf, 0x83, 0xb2, 0xf6, 0x1a, 0x9a, 0xb4, 0x4f, 0x2a, 0x2b, 0x1f, 0x43,
+	0xd1, 0x72, 0x4e, 0xdc, 0xcc, 0xe5, 0x74, 0xa4, 0x10, 0xb3, 0x61, 0x69, 0x87, 0x28, 0xc8, 0x3b,
+	0x84, 0x0d, 0x8d, 0x08, 0xf7, 0x69, 0x17, 0xc4, 0xa7, 0xd2, 0x82, 0xb8, 0x95, 0x82, 0x5e, 0x5a,
+	0x0c, 0x7f, 0x55, 0x60, 0x91, 0x76, 0x7f, 0xc7, 0xe0, 0x19, 0x1f, 0x7b, 0x39, 0x0b, 0xe2, 0xe2,
+	0x78, 0xff, 0x7f, 0xa8, 0x89, 0x09, 0x1c, 0xcd, 0x32, 0x93, 0x25, 0x5e, 0x7a, 0x33, 0x6d, 0x94,
+	0xf2, 0x43, 0x6a, 0xd6, 0xe0, 0x19, 0x1d, 0x52, 0x33, 0x82, 0x79, 0x84, 0xfa, 0xf4, 0x90, 0x9a,
+	0x1c, 0x7b, 0x0f, 0xc4, 0xf4, 0xa1, 0xfe, 0x9d, 0x63, 0x5f, 0x98, 0x0f, 0xd2, 0x9c, 0xcc, 0x62,
+	0xd5, 0xb3, 0x5d, 0x54, 0x56, 0x3c, 0xa3, 0x5d, 0x54, 0x12, 0x1a, 0xdd, 0x8b, 0x35, 0x63, 0x65,
+	0xef, 0x01, 0xd3, 0x9f, 0x03, 0xe2, 0xda, 0x76, 0x5d, 0xdf, 0xb8, 0x20, 0xd8, 0x67, 0x01, 0x24,
+	0xfb, 0x98, 0x27, 0x47, 0xdb, 0x8c, 0x3e, 0xe6, 0xc9, 0x4a, 0xe6, 0x90, 0x06, 0x70, 0x2b, 0xa5,
+	0xf6, 0x3d, 0xe0, 0x7a, 0x04, 0x0b, 0x71, 0x22, 0xbc, 0x7a, 0x15, 0x3f, 0xba, 0x87, 0xa0, 0xa1,
+	0x5c, 0x8f, 0x3e, 0x2f, 0x60, 0xd5, 0x48, 0x5a, 0xec, 0x8c, 0xaa, 0x91, 0x94, 0xd8, 0x44, 0x35,
+	0x92, 0x49, 0xe8, 0x33, 0xab, 0x46, 0xd2, 0x92, 0x39, 0x76, 0xeb, 0x5f, 0xc1, 0x7c, 0xe2, 0x3b,
+	0x24, 0xb4, 0xc0, 0x9b, 0xfb, 0xce, 0x40, 0xb7, 0x2d, 0xb3, 0xf9, 0x01, 0x9a, 0x87, 0x39, 0xda,
+	0x71, 0xd8, 0x0f, 0x9b, 0x0a, 0x6a, 0x00, 0xd0, 0x06, 0x2f, 0xaf, 0x9b, 0x85, 0xf5, 0x2e, 0x54,
+	0x47, 0x5f, 0x74, 0xd0, 0x99, 0xf1, 0x6b, 0x55, 0x28, 0xed, 0xbc, 0xed, 0xeb, 0x76, 0x53, 0x41,
+	0x35, 0xa8, 0x7c, 0xeb, 0x86, 0xbc, 0x55, 0x40, 0x15, 0x28, 0xbe, 0x22, 0x41, 0xd0, 0x54, 0xa9,
+	0x2a, 0xfa, 0x74, 0xe0, 0xf3, 0xa1, 0x22, 0x02, 0x28, 0xbf, 0xd2, 0xfd, 0x0e, 0xf1, 0x9b, 0x25,
+	0xb4, 0x08, 0x75, 0xfe, 0x1c, 0x0d, 0x97, 0xd7, 0x7f, 0x0a, 0xd5, 0xd1, 0xd1, 0x89, 0x59, 0xb2,
+	0xd5, 0x8e, 0xf5, 0x35, 0xa1, 0xb6, 0xb3, 0xd5, 0xa6, 0x7a, 0xe8, 0x94, 0xa0, 0xa9, 0xa0, 0x3a,
+	0x54, 0x77, 0xb6, 0xda, 0xa2, 0x59, 0x10, 0x2f, 0xbc, 0x70, 0x86, 0xf4, 0xf5, 0xa6, 0x4a, 0xad,
+	0xda, 0xd9, 0x6a, 0xb3, 0x18, 0x6d, 0x16, 0xd7, 0x5f, 0x42, 0x75, 0xf4, 0x3f, 0x0d, 0x9d, 0x7a,
+	0x70, 0x98, 0x90, 0x0d, 0x50, 0x3e, 0x38, 0x6c, 0x1f, 0x91, 0x90, 0x4b, 0x3d, 0x38, 0x6c, 0x47,
+	0x00, 0x88, 0xa1, 0x3d, 0x12, 0x36, 0xd5, 0x97, 0xcd, 0xef, 0xdf, 0x3d, 0x50, 0xfe, 0xf1, 0xee,
+	0x81, 0xf2, 0xaf, 0x77, 0x0f, 0x94, 0x3f, 0xfd, 0xfb, 0xc1, 0x07, 0xc7, 0x65, 0xf6, 0xf1, 0xee,
+	0xf3, 0xff, 0x06, 0x00, 0x00, 0xff, 0xff, 0x86, 0xb0, 0x8f, 0x9c, 0x1a, 0x2c, 0x00, 0x00,
 }
@@ -15,6 +15,8 @@
 		RangeStats
 		RangeHeartbeatRequest
 		RangeHeartbeatResponse
+		BatchRangeHeartbeatRequest
+		BatchRangeHeartbeatResponse
 		NodeStats
 		NodeHeartbeatRequest
 		NodeHeartbeatResponse
@@ -76,6 +78,8 @@ import (
 	context "golang.org/x/net/context"
 
 	grpc "google.golang.org/grpc"
+
+	binary "encoding/binary"
 )
 
 // Reference imports to suppress errors if they are not otherwise used.
@@ -369,6 +373,84 @@ func (m *RangeHeartbeatResponse) GetTask() *taskpb.Task {
 	return nil
 }
 
+// 一个节点上到期的range心跳合并为一个请求
+// 与上次发送的内容相比没有变化的range只带range id，master沿用缓存中的信息
+type BatchRangeHeartbeatRequest struct {
+	Header *RequestHeader `protobuf:"bytes,1,opt,name=header" json:"header,omitempty"`
+	NodeId uint64         `protobuf:"varint,2,opt,name=node_id,json=nodeId,proto3" json:"node_id,omitempty"`
+	// changed ranges, full heartbeat
+	Heartbeats []*RangeHeartbeatRequest `protobuf:"bytes,3,rep,name=heartbeats" json:"heartbeats,omitempty"`
+	// unchanged range ids
+	UnchangedRanges []uint64 `protobuf:"varint,4,rep,packed,name=unchanged_ranges,json=unchangedRanges" json:"unchanged_ranges,omitempty"`
+}
+
+func (m *BatchRangeHeartbeatRequest) Reset()                    { *m = BatchRangeHeartbeatRequest{} }
+func (m *BatchRangeHeartbeatRequest) String() string            { return proto.CompactTextString(m) }
+func (*BatchRangeHeartbeatRequest) ProtoMessage()               {}
+func (*BatchRangeHeartbeatRequest) Descriptor() ([]byte, []int) { return fileDescriptorMspb, []int{7} }
+
+func (m *BatchRangeHeartbeatRequest) GetHeader() *RequestHeader {
+	if m != nil {
+		return m.Header
+	}
+	return nil
+}
+
+func (m *BatchRangeHeartbeatRequest) GetNodeId() uint64 {
+	if m != nil {
+		return m.NodeId
+	}
+	return 0
+}
+
+func (m *BatchRangeHeartbeatRequest) GetHeartbeats() []*RangeHeartbeatRequest {
+	if m != nil {
+		return m.Heartbeats
+	}
+	return nil
+}
+
+func (m *BatchRangeHeartbeatRequest) GetUnchangedRanges() []uint64 {
+	if m != nil {
+		return m.UnchangedRanges
+	}
+	return nil
+}
+
+type BatchRangeHeartbeatResponse struct {
+	Header *ResponseHeader `protobuf:"bytes,1,opt,name=header" json:"header,omitempty"`
+	// 只回复有任务的range
+	Responses []*RangeHeartbeatResponse `protobuf:"bytes,2,rep,name=responses" json:"responses,omitempty"`
+	// master缓存中没有的range，下次需发送完整心跳
+	FullRequired []uint64 `protobuf:"varint,3,rep,packed,name=full_required,json=fullRequired" json:"full_required,omitempty"`
+}
+
+func (m *BatchRangeHeartbeatResponse) Reset()                    { *m = BatchRangeHeartbeatResponse{} }
+func (m *BatchRangeHeartbeatResponse) String() string            { return proto.CompactTextString(m) }
+func (*BatchRangeHeartbeatResponse) ProtoMessage()               {}
+func (*BatchRangeHeartbeatResponse) Descriptor() ([]byte, []int) { return fileDescriptorMspb, []int{8} }
+
+func (m *BatchRangeHeartbeatResponse) GetHeader() *ResponseHeader {
+	if m != nil {
+		return m.Header
+	}
+	return nil
+}
+
+func (m *BatchRangeHeartbeatResponse) GetResponses() []*RangeHeartbeatResponse {
+	if m != nil {
+		return m.Responses
+	}
+	return nil
+}
+
+func (m *BatchRangeHeartbeatResponse) GetFullRequired() []uint64 {
+	if m != nil {
+		return m.FullRequired
+	}
+	return nil
+}
+
 type NodeStats struct {
 	// Total range count in this node.
 	RangeCount uint32 `protobuf:"varint,1,opt,name=range_count,json=rangeCount,proto3" json:"range_count,omitempty"`
@@ -399,12 +481,49 @@ type NodeStats struct {
 	IsBusy bool `protobuf:"varint,14,opt,name=is_busy,json=isBusy,proto3" json:"is_busy,omitempty"`
 	// When the node is started (unix timestamp in seconds).
 	Start uint32 `protobuf:"varint,15,opt,name=start,proto3" json:"start,omitempty"`
+	// System stats over the last sampling interval, not set until two samples are taken.
+	// Whole machine cpu usage (percent).
+	CpuUsage float64 `protobuf:"fixed64,16,opt,name=cpu_usage,json=cpuUsage,proto3" json:"cpu_usage,omitempty"`
+	// Cpu usage of the DS process (percent of the whole machine).
+	ProcessCpuUsage float64 `protobuf:"fixed64,17,opt,name=process_cpu_usage,json=processCpuUsage,proto3" json:"process_cpu_usage,omitempty"`
+	CpuCount        uint32  `protobuf:"varint,18,opt,name=cpu_count,json=cpuCount,proto3" json:"cpu_count,omitempty"`
+	// Max busy time ratio among disks (percent).
+	DiskUtil float64 `protobuf:"fixed64,19,opt,name=disk_util,json=diskUtil,proto3" json:"disk_util,omitempty"`
+	// Max average read/write latency among disks (milliseconds).
+	DiskReadLatencyMs  float64 `protobuf:"fixed64,20,opt,name=disk_read_latency_ms,json=diskReadLatencyMs,proto3" json:"disk_read_latency_ms,omitempty"`
+	DiskWriteLatencyMs float64 `protobuf:"fixed64,21,opt,name=disk_write_latency_ms,json=diskWriteLatencyMs,proto3" json:"disk_write_latency_ms,omitempty"`
+	// Total disk read/write bytes per second.
+	DiskReadBytes  uint64 `protobuf:"varint,22,opt,name=disk_read_bytes,json=diskReadBytes,proto3" json:"disk_read_bytes,omitempty"`
+	DiskWriteBytes uint64 `protobuf:"varint,23,opt,name=disk_write_bytes,json=diskWriteBytes,proto3" json:"disk_write_bytes,omitempty"`
+	// Total network receive/transmit bytes per second.
+	NetInBytes  uint64 `protobuf:"varint,24,opt,name=net_in_bytes,json=netInBytes,proto3" json:"net_in_bytes,omitempty"`
+	NetOutBytes uint64 `protobuf:"varint,25,opt,name=net_out_bytes,json=netOutBytes,proto3" json:"net_out_bytes,omitempty"`
+	// Sampled rocksdb perf stats summed over all request types, cumulative since
+	// the node started (the master diffs two heartbeats to get rates).
+	// Sampled request count.
+	PerfSamples        uint64 `protobuf:"varint,26,opt,name=perf_samples,json=perfSamples,proto3" json:"perf_samples,omitempty"`
+	PerfBlockCacheHits uint64 `protobuf:"varint,27,opt,name=perf_block_cache_hits,json=perfBlockCacheHits,proto3" json:"perf_block_cache_hits,omitempty"`
+	// Blocks read from files (block cache misses).
+	PerfBlockReads     uint64 `protobuf:"varint,28,opt,name=perf_block_reads,json=perfBlockReads,proto3" json:"perf_block_reads,omitempty"`
+	PerfBlockReadBytes uint64 `protobuf:"varint,29,opt,name=perf_block_read_bytes,json=perfBlockReadBytes,proto3" json:"perf_block_read_bytes,omitempty"`
+	PerfBlockReadNanos uint64 `protobuf:"varint,30,opt,name=perf_block_read_nanos,json=perfBlockReadNanos,proto3" json:"perf_block_read_nanos,omitempty"`
+	// Time spent looking up memtables.
+	PerfMemtableNanos uint64 `protobuf:"varint,31,opt,name=perf_memtable_nanos,json=perfMemtableNanos,proto3" json:"perf_memtable_nanos,omitempty"`
+	// Time spent looking up sst files by point lookups.
+	PerfSstNanos uint64 `protobuf:"varint,32,opt,name=perf_sst_nanos,json=perfSstNanos,proto3" json:"perf_sst_nanos,omitempty"`
+	// Time spent in iterator seeks and skipping invalid keys.
+	PerfIterSeekNanos uint64 `protobuf:"varint,33,opt,name=perf_iter_seek_nanos,json=perfIterSeekNanos,proto3" json:"perf_iter_seek_nanos,omitempty"`
+	// Old versions and delete markers skipped by iterators.
+	PerfKeysSkipped    uint64 `protobuf:"varint,34,opt,name=perf_keys_skipped,json=perfKeysSkipped,proto3" json:"perf_keys_skipped,omitempty"`
+	PerfDeletesSkipped uint64 `protobuf:"varint,35,opt,name=perf_deletes_skipped,json=perfDeletesSkipped,proto3" json:"perf_deletes_skipped,omitempty"`
+	PerfIoReadBytes    uint64 `protobuf:"varint,36,opt,name=perf_io_read_bytes,json=perfIoReadBytes,proto3" json:"perf_io_read_bytes,omitempty"`
+	PerfIoReadNanos    uint64 `protobuf:"varint,37,opt,name=perf_io_read_nanos,json=perfIoReadNanos,proto3" json:"perf_io_read_nanos,omitempty"`
 }
 
 func (m *NodeStats) Reset()                    { *m = NodeStats{} }
 func (m *NodeStats) String() string            { return proto.CompactTextString(m) }
 func (*NodeStats) ProtoMessage()               {}
-func (*NodeStats) Descriptor() ([]byte, []int) { return fileDescriptorMspb, []int{7} }
+func (*NodeStats) Descriptor() ([]byte, []int) { return fileDescriptorMspb, []int{9} }
 
 func (m *NodeStats) GetRangeCount() uint32 {
 	if m != nil {
@@ -511,6 +630,160 @@ func (m *NodeStats) GetStart() uint32 {
 	return 0
 }
 
+func (m *NodeStats) GetCpuUsage() float64 {
+	if m != nil {
+		return m.CpuUsage
+	}
+	return 0
+}
+
+func (m *NodeStats) GetProcessCpuUsage() float64 {
+	if m != nil {
+		return m.ProcessCpuUsage
+	}
+	return 0
+}
+
+func (m *NodeStats) GetCpuCount() uint32 {
+	if m != nil {
+		return m.CpuCount
+	}
+	return 0
+}
+
+func (m *NodeStats) GetDiskUtil() float64 {
+	if m != nil {
+		return m.DiskUtil
+	}
+	return 0
+}
+
+func (m *NodeStats) GetDiskReadLatencyMs() float64 {
+	if m != nil {
+		return m.DiskReadLatencyMs
+	}
+	return 0
+}
+
+func (m *NodeStats) GetDiskWriteLatencyMs() float64 {
+	if m != nil {
+		return m.DiskWriteLatencyMs
+	}
+	return 0
+}
+
+func (m *NodeStats) GetDiskReadBytes() uint64 {
+	if m != nil {
+		return m.DiskReadBytes
+	}
+	return 0
+}
+
+func (m *NodeStats) GetDiskWriteBytes() uint64 {
+	if m != nil {
+		return m.DiskWriteBytes
+	}
+	return 0
+}
+
+func (m *NodeStats) GetNetInBytes() uint64 {
+	if m != nil {
+		return m.NetInBytes
+	}
+	return 0
+}
+
+func (m *NodeStats) GetNetOutBytes() uint64 {
+	if m != nil {
+		return m.NetOutBytes
+	}
+	return 0
+}
+
+func (m *NodeStats) GetPerfSamples() uint64 {
+	if m != nil {
+		return m.PerfSamples
+	}
+	return 0
+}
+
+func (m *NodeStats) GetPerfBlockCacheHits() uint64 {
+	if m != nil {
+		return m.PerfBlockCacheHits
+	}
+	return 0
+}
+
+func (m *NodeStats) GetPerfBlockReads() uint64 {
+	if m != nil {
+		return m.PerfBlockReads
+	}
+	return 0
+}
+
+func (m *NodeStats) GetPerfBlockReadBytes() uint64 {
+	if m != nil {
+		return m.PerfBlockReadBytes
+	}
+	return 0
+}
+
+func (m *NodeStats) GetPerfBlockReadNanos() uint64 {
+	if m != nil {
+		return m.PerfBlockReadNanos
+	}
+	return 0
+}
+
+func (m *NodeStats) GetPerfMemtableNanos() uint64 {
+	if m != nil {
+		return m.PerfMemtableNanos
+	}
+	return 0
+}
+
+func (m *NodeStats) GetPerfSstNanos() uint64 {
+	if m != nil {
+		return m.PerfSstNanos
+	}
+	return 0
+}
+
+func (m *NodeStats) GetPerfIterSeekNanos() uint64 {
+	if m != nil {
+		return m.PerfIterSeekNanos
+	}
+	return 0
+}
+
+func (m *NodeStats) GetPerfKeysSkipped() uint64 {
+	if m != nil {
+		return m.PerfKeysSkipped
+	}
+	return 0
+}
+
+func (m *NodeStats) GetPerfDeletesSkipped() uint64 {
+	if m != nil {
+		return m.PerfDeletesSkipped
+	}
+	return 0
+}
+
+func (m *NodeStats) GetPerfIoReadBytes() uint64 {
+	if m != nil {
+		return m.PerfIoReadBytes
+	}
+	return 0
+}
+
+func (m *NodeStats) GetPerfIoReadNanos() uint64 {
+	if m != nil {
+		return m.PerfIoReadNanos
+	}
+	return 0
+}
+
 type NodeHeartbeatRequest struct {
 	Header *RequestHeader `protobuf:"bytes,1,opt,name=header" json:"header,omitempty"`
 	NodeId uint64         `protobuf:"varint,2,opt,name=node_id,json=nodeId,proto3" json:"node_id,omitempty"`
@@ -522,7 +795,7 @@ type NodeHeartbeatRequest struct {
 func (m *NodeHeartbeatRequest) Reset()                    { *m = NodeHeartbeatRequest{} }
 func (m *NodeHeartbeatRequest) String() string            { return proto.CompactTextString(m) }
 func (*NodeHeartbeatRequest) ProtoMessage()               {}
-func (*NodeHeartbeatRequest) Descriptor() ([]byte, []int) { return fileDescriptorMspb, []int{8} }
+func (*NodeHeartbeatRequest) Descriptor() ([]byte, []int) { return fileDescriptorMspb, []int{10} }
 
 func (m *NodeHeartbeatRequest) GetHeader() *RequestHeader {
 	if m != nil {
@@ -562,7 +835,7 @@ type NodeHeartbeatResponse struct {
 func (m *NodeHeartbeatResponse) Reset()                    { *m = NodeHeartbeatResponse{} }
 func (m *NodeHeartbeatResponse) String() string            { return proto.CompactTextString(m) }
 func (*NodeHeartbeatResponse) ProtoMessage()               {}
-func (*NodeHeartbeatResponse) Descriptor() ([]byte, []int) { return fileDescriptorMspb, []int{9} }
+func (*NodeHeartbeatResponse) Descriptor() ([]byte, []int) { return fileDescriptorMspb, []int{11} }
 
 func (m *NodeHeartbeatResponse) GetHeader() *ResponseHeader {
 	if m != nil {
@@ -594,7 +867,7 @@ type AskSplitRequest struct {
 func (m *AskSplitRequest) Reset()                    { *m = AskSplitRequest{} }
 func (m *AskSplitRequest) String() string            { return proto.CompactTextString(m) }
 func (*AskSplitRequest) ProtoMessage()               {}
-func (*AskSplitRequest) Descriptor() ([]byte, []int) { return fileDescriptorMspb, []int{10} }
+func (*AskSplitRequest) Descriptor() ([]byte, []int) { return fileDescriptorMspb, []int{12} }
 
 func (m *AskSplitRequest) GetHeader() *RequestHeader {
 	if m != nil {
@@ -633,7 +906,7 @@ type AskSplitResponse struct {
 func (m *AskSplitResponse) Reset()                    { *m = AskSplitResponse{} }
 func (m *AskSplitResponse) String() string            { return proto.CompactTextString(m) }
 func (*AskSplitResponse) ProtoMessage()               {}
-func (*AskSplitResponse) Descriptor() ([]byte, []int) { return fileDescriptorMspb, []int{11} }
+func (*AskSplitResponse) Descriptor() ([]byte, []int) { return fileDescriptorMspb, []int{13} }
 
 func (m *AskSplitResponse) GetHeader() *ResponseHeader {
 	if m != nil {
@@ -679,7 +952,7 @@ type ReportSplitRequest struct {
 func (m *ReportSplitRequest) Reset()                    { *m = ReportSplitRequest{} }
 func (m *ReportSplitRequest) String() string            { return proto.CompactTextString(m) }
 func (*ReportSplitRequest) ProtoMessage()               {}
-func (*ReportSplitRequest) Descriptor() ([]byte, []int) { return fileDescriptorMspb, []int{12} }
+func (*ReportSplitRequest) Descriptor() ([]byte, []int) { return fileDescriptorMspb, []int{14} }
 
 func (m *ReportSplitRequest) GetHeader() *RequestHeader {
 	if m != nil {
@@ -709,7 +982,7 @@ type ReportSplitResponse struct {
 func (m *ReportSplitResponse) Reset()                    { *m = ReportSplitResponse{} }
 func (m *ReportSplitResponse) String() string            { return proto.CompactTextString(m) }
 func (*ReportSplitResponse) ProtoMessage()               {}
-func (*ReportSplitResponse) Descriptor() ([]byte, []int) { return fileDescriptorMspb, []int{13} }
+func (*ReportSplitResponse) Descriptor() ([]byte, []int) { return fileDescriptorMspb, []int{15} }
 
 func (m *ReportSplitResponse) GetHeader() *ResponseHeader {
 	if m != nil {
@@ -726,7 +999,7 @@ type NodeLoginRequest struct {
 func (m *NodeLoginRequest) Reset()                    { *m = NodeLoginRequest{} }
 func (m *NodeLoginRequest) String() string            { return proto.CompactTextString(m) }
 func (*NodeLoginRequest) ProtoMessage()               {}
-func (*NodeLoginRequest) Descriptor() ([]byte, []int) { return fileDescriptorMspb, []int{14} }
+func (*NodeLoginRequest) Descriptor() ([]byte, []int) { return fileDescriptorMspb, []int{16} }
 
 func (m *NodeLoginRequest) GetHeader() *RequestHeader {
 	if m != nil {
@@ -749,7 +1022,7 @@ type NodeLoginResponse struct {
 func (m *NodeLoginResponse) Reset()                    { *m = NodeLoginResponse{} }
 func (m *NodeLoginResponse) String() string            { return proto.CompactTextString(m) }
 func (*NodeLoginResponse) ProtoMessage()               {}
-func (*NodeLoginResponse) Descriptor() ([]byte, []int) { return fileDescriptorMspb, []int{15} }
+func (*NodeLoginResponse) Descriptor() ([]byte, []int) { return fileDescriptorMspb, []int{17} }
 
 func (m *NodeLoginResponse) GetHeader() *ResponseHeader {
 	if m != nil {
@@ -769,7 +1042,7 @@ type GetNodeIdRequest struct {
 func (m *GetNodeIdRequest) Reset()                    { *m = GetNodeIdRequest{} }
 func (m *GetNodeIdRequest) String() string            { return proto.CompactTextString(m) }
 func (*GetNodeIdRequest) ProtoMessage()               {}
-func (*GetNodeIdRequest) Descriptor() ([]byte, []int) { return fileDescriptorMspb, []int{16} }
+func (*GetNodeIdRequest) Descriptor() ([]byte, []int) { return fileDescriptorMspb, []int{18} }
 
 func (m *GetNodeIdRequest) GetHeader() *RequestHeader {
 	if m != nil {
@@ -816,7 +1089,7 @@ type GetNodeIdResponse struct {
 func (m *GetNodeIdResponse) Reset()                    { *m = GetNodeIdResponse{} }
 func (m *GetNodeIdResponse) String() string            { return proto.CompactTextString(m) }
 func (*GetNodeIdResponse) ProtoMessage()               {}
-func (*GetNodeIdResponse) Descriptor() ([]byte, []int) { return fileDescriptorMspb, []int{17} }
+func (*GetNodeIdResponse) Descriptor() ([]byte, []int) { return fileDescriptorMspb, []int{19} }
 
 func (m *GetNodeIdResponse) GetHeader() *ResponseHeader {
 	if m != nil {
@@ -849,7 +1122,7 @@ type GetRouteRequest struct {
 func (m *GetRouteRequest) Reset()                    { *m = GetRouteRequest{} }
 func (m *GetRouteRequest) String() string            { return proto.CompactTextString(m) }
 func (*GetRouteRequest) ProtoMessage()               {}
-func (*GetRouteRequest) Descriptor() ([]byte, []int) { return fileDescriptorMspb, []int{18} }
+func (*GetRouteRequest) Descriptor() ([]byte, []int) { return fileDescriptorMspb, []int{20} }
 
 func (m *GetRouteRequest) GetHeader() *RequestHeader {
 	if m != nil {
@@ -887,7 +1160,7 @@ type GetRouteResponse struct {
 func (m *GetRouteResponse) Reset()                    { *m = GetRouteResponse{} }
 func (m *GetRouteResponse) String() string            { return proto.CompactTextString(m) }
 func (*GetRouteResponse) ProtoMessage()               {}
-func (*GetRouteResponse) Descriptor() ([]byte, []int) { return fileDescriptorMspb, []int{19} }
+func (*GetRouteResponse) Descriptor() ([]byte, []int) { return fileDescriptorMspb, []int{21} }
 
 func (m *GetRouteResponse) GetHeader() *ResponseHeader {
 	if m != nil {
@@ -911,7 +1184,7 @@ type GetNodeRequest struct {
 func (m *GetNodeRequest) Reset()                    { *m = GetNodeRequest{} }
 func (m *GetNodeRequest) String() string            { return proto.CompactTextString(m) }
 func (*GetNodeRequest) ProtoMessage()               {}
-func (*GetNodeRequest) Descriptor() ([]byte, []int) { return fileDescriptorMspb, []int{20} }
+func (*GetNodeRequest) Descriptor() ([]byte, []int) { return fileDescriptorMspb, []int{22} }
 
 func (m *GetNodeRequest) GetHeader() *RequestHeader {
 	if m != nil {
@@ -935,7 +1208,7 @@ type GetNodeResponse struct {
 func (m *GetNodeResponse) Reset()                    { *m = GetNodeResponse{} }
 func (m *GetNodeResponse) String() string            { return proto.CompactTextString(m) }
 func (*GetNodeResponse) ProtoMessage()               {}
-func (*GetNodeResponse) Descriptor() ([]byte, []int) { return fileDescriptorMspb, []int{21} }
+func (*GetNodeResponse) Descriptor() ([]byte, []int) { return fileDescriptorMspb, []int{23} }
 
 func (m *GetNodeResponse) GetHeader() *ResponseHeader {
 	if m != nil {
@@ -959,7 +1232,7 @@ type GetDBRequest struct {
 func (m *GetDBRequest) Reset()                    { *m = GetDBRequest{} }
 func (m *GetDBRequest) String() string            { return proto.CompactTextString(m) }
 func (*GetDBRequest) ProtoMessage()               {}
-func (*GetDBRequest) Descriptor() ([]byte, []int) { return fileDescriptorMspb, []int{22} }
+func (*GetDBRequest) Descriptor() ([]byte, []int) { return fileDescriptorMspb, []int{24} }
 
 func (m *GetDBRequest) GetHeader() *RequestHeader {
 	if m != nil {
@@ -983,7 +1256,7 @@ type GetDBResponse struct {
 func (m *GetDBResponse) Reset()                    { *m = GetDBResponse{} }
 func (m *GetDBResponse) String() string            { return proto.CompactTextString(m) }
 func (*GetDBResponse) ProtoMessage()               {}
-func (*GetDBResponse) Descriptor() ([]byte, []int) { return fileDescriptorMspb, []int{23} }
+func (*GetDBResponse) Descriptor() ([]byte, []int) { return fileDescriptorMspb, []int{25} }
 
 func (m *GetDBResponse) GetHeader() *ResponseHeader {
 	if m != nil {
@@ -1008,7 +1281,7 @@ type GetTableRequest struct {
 func (m *GetTableRequest) Reset()                    { *m = GetTableRequest{} }
 func (m *GetTableRequest) String() string            { return proto.CompactTextString(m) }
 func (*GetTableRequest) ProtoMessage()               {}
-func (*GetTableRequest) Descriptor() ([]byte, []int) { return fileDescriptorMspb, []int{24} }
+func (*GetTableRequest) Descriptor() ([]byte, []int) { return fileDescriptorMspb, []int{26} }
 
 func (m *GetTableRequest) GetHeader() *RequestHeader {
 	if m != nil {
@@ -1040,7 +1313,7 @@ type GetTableByIdRequest struct {
 func (m *GetTableByIdRequest) Reset()                    { *m = GetTableByIdRequest{} }
 func (m *GetTableByIdRequest) String() string            { return proto.CompactTextString(m) }
 func (*GetTableByIdRequest) ProtoMessage()               {}
-func (*GetTableByIdRequest) Descriptor() ([]byte, []int) { return fileDescriptorMspb, []int{25} }
+func (*GetTableByIdRequest) Descriptor() ([]byte, []int) { return fileDescriptorMspb, []int{27} }
 
 func (m *GetTableByIdRequest) GetHeader() *RequestHeader {
 	if m != nil {
@@ -1071,7 +1344,7 @@ type GetTableResponse struct {
 func (m *GetTableResponse) Reset()                    { *m = GetTableResponse{} }
 func (m *GetTableResponse) String() string            { return proto.CompactTextString(m) }
 func (*GetTableResponse) ProtoMessage()               {}
-func (*GetTableResponse) Descriptor() ([]byte, []int) { return fileDescriptorMspb, []int{26} }
+func (*GetTableResponse) Descriptor() ([]byte, []int) { return fileDescriptorMspb, []int{28} }
 
 func (m *GetTableResponse) GetHeader() *ResponseHeader {
 	if m != nil {
@@ -1095,7 +1368,7 @@ type GetTableByIdResponse struct {
 func (m *GetTableByIdResponse) Reset()                    { *m = GetTableByIdResponse{} }
 func (m *GetTableByIdResponse) String() string            { return proto.CompactTextString(m) }
 func (*GetTableByIdResponse) ProtoMessage()               {}
-func (*GetTableByIdResponse) Descriptor() ([]byte, []int) { return fileDescriptorMspb, []int{27} }
+func (*GetTableByIdResponse) Descriptor() ([]byte, []int) { return fileDescriptorMspb, []int{29} }
 
 func (m *GetTableByIdResponse) GetHeader() *ResponseHeader {
 	if m != nil {
@@ -1120,7 +1393,7 @@ type GetColumnsRequest struct {
 func (m *GetColumnsRequest) Reset()                    { *m = GetColumnsRequest{} }
 func (m *GetColumnsRequest) String() string            { return proto.CompactTextString(m) }
 func (*GetColumnsRequest) ProtoMessage()               {}
-func (*GetColumnsRequest) Descriptor() ([]byte, []int) { return fileDescriptorMspb, []int{28} }
+func (*GetColumnsRequest) Descriptor() ([]byte, []int) { return fileDescriptorMspb, []int{30} }
 
 func (m *GetColumnsRequest) GetHeader() *RequestHeader {
 	if m != nil {
@@ -1151,7 +1424,7 @@ type GetColumnsResponse struct {
 func (m *GetColumnsResponse) Reset()                    { *m = GetColumnsResponse{} }
 func (m *GetColumnsResponse) String() string            { return proto.CompactTextString(m) }
 func (*GetColumnsResponse) ProtoMessage()               {}
-func (*GetColumnsResponse) Descriptor() ([]byte, []int) { return fileDescriptorMspb, []int{29} }
+func (*GetColumnsResponse) Descriptor() ([]byte, []int) { return fileDescriptorMspb, []int{31} }
 
 func (m *GetColumnsResponse) GetHeader() *ResponseHeader {
 	if m != nil {
@@ -1177,7 +1450,7 @@ type GetColumnByNameRequest struct {
 func (m *GetColumnByNameRequest) Reset()                    { *m = GetColumnByNameRequest{} }
 func (m *GetColumnByNameRequest) String() string            { return proto.CompactTextString(m) }
 func (*GetColumnByNameRequest) ProtoMessage()               {}
-func (*GetColumnByNameRequest) Descriptor() ([]byte, []int) { return fileDescriptorMspb, []int{30} }
+func (*GetColumnByNameRequest) Descriptor() ([]byte, []int) { return fileDescriptorMspb, []int{32} }
 
 func (m *GetColumnByNameRequest) GetHeader() *RequestHeader {
 	if m != nil {
@@ -1215,7 +1488,7 @@ type GetColumnByNameResponse struct {
 func (m *GetColumnByNameResponse) Reset()                    { *m = GetColumnByNameResponse{} }
 func (m *GetColumnByNameResponse) String() string            { return proto.CompactTextString(m) }
 func (*GetColumnByNameResponse) ProtoMessage()               {}
-func (*GetColumnByNameResponse) Descriptor() ([]byte, []int) { return fileDescriptorMspb, []int{31} }
+func (*GetColumnByNameResponse) Descriptor() ([]byte, []int) { return fileDescriptorMspb, []int{33} }
 
 func (m *GetColumnByNameResponse) GetHeader() *ResponseHeader {
 	if m != nil {
@@ -1241,7 +1514,7 @@ type GetColumnByIdRequest struct {
 func (m *GetColumnByIdRequest) Reset()                    { *m = GetColumnByIdRequest{} }
 func (m *GetColumnByIdRequest) String() string            { return proto.CompactTextString(m) }
 func (*GetColumnByIdRequest) ProtoMessage()               {}
-func (*GetColumnByIdRequest) Descriptor() ([]byte, []int) { return fileDescriptorMspb, []int{32} }
+func (*GetColumnByIdRequest) Descriptor() ([]byte, []int) { return fileDescriptorMspb, []int{34} }
 
 func (m *GetColumnByIdRequest) GetHeader() *RequestHeader {
 	if m != nil {
@@ -1279,7 +1552,7 @@ type GetColumnByIdResponse struct {
 func (m *GetColumnByIdResponse) Reset()                    { *m = GetColumnByIdResponse{} }
 func (m *GetColumnByIdResponse) String() string            { return proto.CompactTextString(m) }
 func (*GetColumnByIdResponse) ProtoMessage()               {}
-func (*GetColumnByIdResponse) Descriptor() ([]byte, []int) { return fileDescriptorMspb, []int{33} }
+func (*GetColumnByIdResponse) Descriptor() ([]byte, []int) { return fileDescriptorMspb, []int{35} }
 
 func (m *GetColumnByIdResponse) GetHeader() *ResponseHeader {
 	if m != nil {
@@ -1305,7 +1578,7 @@ type AddColumnRequest struct {
 func (m *AddColumnRequest) Reset()                    { *m = AddColumnRequest{} }
 func (m *AddColumnRequest) String() string            { return proto.CompactTextString(m) }
 func (*AddColumnRequest) ProtoMessage()               {}
-func (*AddColumnRequest) Descriptor() ([]byte, []int) { return fileDescriptorMspb, []int{34} }
+func (*AddColumnRequest) Descriptor() ([]byte, []int) { return fileDescriptorMspb, []int{36} }
 
 func (m *AddColumnRequest) GetHeader() *RequestHeader {
 	if m != nil {
@@ -1343,7 +1616,7 @@ type AddColumnResponse struct {
 func (m *AddColumnResponse) Reset()                    { *m = AddColumnResponse{} }
 func (m *AddColumnResponse) String() string            { return proto.CompactTextString(m) }
 func (*AddColumnResponse) ProtoMessage()               {}
-func (*AddColumnResponse) Descriptor() ([]byte, []int) { return fileDescriptorMspb, []int{35} }
+func (*AddColumnResponse) Descriptor() ([]byte, []int) { return fileDescriptorMspb, []int{37} }
 
 func (m *AddColumnResponse) GetHeader() *ResponseHeader {
 	if m != nil {
@@ -1368,7 +1641,7 @@ type TruncateTableRequest struct {
 func (m *TruncateTableRequest) Reset()                    { *m = TruncateTableRequest{} }
 func (m *TruncateTableRequest) String() string            { return proto.CompactTextString(m) }
 func (*TruncateTableRequest) ProtoMessage()               {}
-func (*TruncateTableRequest) Descriptor() ([]byte, []int) { return fileDescriptorMspb, []int{36} }
+func (*TruncateTableRequest) Descriptor() ([]byte, []int) { return fileDescriptorMspb, []int{38} }
 
 func (m *TruncateTableRequest) GetHeader() *RequestHeader {
 	if m != nil {
@@ -1398,7 +1671,7 @@ type TruncateTableResponse struct {
 func (m *TruncateTableResponse) Reset()                    { *m = TruncateTableResponse{} }
 func (m *TruncateTableResponse) String() string            { return proto.CompactTextString(m) }
 func (*TruncateTableResponse) ProtoMessage()               {}
-func (*TruncateTableResponse) Descriptor() ([]byte, []int) { return fileDescriptorMspb, []int{37} }
+func (*TruncateTableResponse) Descriptor() ([]byte, []int) { return fileDescriptorMspb, []int{39} }
 
 func (m *TruncateTableResponse) GetHeader() *ResponseHeader {
 	if m != nil {
@@ -1415,7 +1688,7 @@ type CreateDatabaseRequest struct {
 func (m *CreateDatabaseRequest) Reset()                    { *m = CreateDatabaseRequest{} }
 func (m *CreateDatabaseRequest) String() string            { return proto.CompactTextString(m) }
 func (*CreateDatabaseRequest) ProtoMessage()               {}
-func (*CreateDatabaseRequest) Descriptor() ([]byte, []int) { return fileDescriptorMspb, []int{38} }
+func (*CreateDatabaseRequest) Descriptor() ([]byte, []int) { return fileDescriptorMspb, []int{40} }
 
 func (m *CreateDatabaseRequest) GetHeader() *RequestHeader {
 	if m != nil {
@@ -1438,7 +1711,7 @@ type CreateDatabaseResponse struct {
 func (m *CreateDatabaseResponse) Reset()                    { *m = CreateDatabaseResponse{} }
 func (m *CreateDatabaseResponse) String() string            { return proto.CompactTextString(m) }
 func (*CreateDatabaseResponse) ProtoMessage()               {}
-func (*CreateDatabaseResponse) Descriptor() ([]byte, []int) { return fileDescriptorMspb, []int{39} }
+func (*CreateDatabaseResponse) Descriptor() ([]byte, []int) { return fileDescriptorMspb, []int{41} }
 
 func (m *CreateDatabaseResponse) GetHeader() *ResponseHeader {
 	if m != nil {
@@ -1457,7 +1730,7 @@ type CreateTableRequest struct {
 func (m *CreateTableRequest) Reset()                    { *m = CreateTableRequest{} }
 func (m *CreateTableRequest) String() string            { return proto.CompactTextString(m) }
 func (*CreateTableRequest) ProtoMessage()               {}
-func (*CreateTableRequest) Descriptor() ([]byte, []int) { return fileDescriptorMspb, []int{40} }
+func (*CreateTableRequest) Descriptor() ([]byte, []int) { return fileDescriptorMspb, []int{42} }
 
 func (m *CreateTableRequest) GetHeader() *RequestHeader {
 	if m != nil {
@@ -1494,7 +1767,7 @@ type CreateTableResponse struct {
 func (m *CreateTableResponse) Reset()                    { *m = CreateTableResponse{} }
 func (m *CreateTableResponse) String() string            { return proto.CompactTextString(m) }
 func (*CreateTableResponse) ProtoMessage()               {}
-func (*CreateTableResponse) Descriptor() ([]byte, []int) { return fileDescriptorMspb, []int{41} }
+func (*CreateTableResponse) Descriptor() ([]byte, []int) { return fileDescriptorMspb, []int{43} }
 
 func (m *CreateTableResponse) GetHeader() *ResponseHeader {
 	if m != nil {
@@ -1513,7 +1786,7 @@ type GetAutoIncIdRequest struct {
 func (m *GetAutoIncIdRequest) Reset()                    { *m = GetAutoIncIdRequest{} }
 func (m *GetAutoIncIdRequest) String() string            { return proto.CompactTextString(m) }
 func (*GetAutoIncIdRequest) ProtoMessage()               {}
-func (*GetAutoIncIdRequest) Descriptor() ([]byte, []int) { return fileDescriptorMspb, []int{42} }
+func (*GetAutoIncIdRequest) Descriptor() ([]byte, []int) { return fileDescriptorMspb, []int{44} }
 
 func (m *GetAutoIncIdRequest) GetHeader() *RequestHeader {
 	if m != nil {
@@ -1551,7 +1824,7 @@ type GetAutoIncIdResponse struct {
 func (m *GetAutoIncIdResponse) Reset()                    { *m = GetAutoIncIdResponse{} }
 func (m *GetAutoIncIdResponse) String() string            { return proto.CompactTextString(m) }
 func (*GetAutoIncIdResponse) ProtoMessage()               {}
-func (*GetAutoIncIdResponse) Descriptor() ([]byte, []int) { return fileDescriptorMspb, []int{43} }
+func (*GetAutoIncIdResponse) Descriptor() ([]byte, []int) { return fileDescriptorMspb, []int{45} }
 
 func (m *GetAutoIncIdResponse) GetHeader() *ResponseHeader {
 	if m != nil {
@@ -1574,7 +1847,7 @@ type RequestHeader struct {
 func (m *RequestHeader) Reset()                    { *m = RequestHeader{} }
 func (m *RequestHeader) String() string            { return proto.CompactTextString(m) }
 func (*RequestHeader) ProtoMessage()               {}
-func (*RequestHeader) Descriptor() ([]byte, []int) { return fileDescriptorMspb, []int{44} }
+func (*RequestHeader) Descriptor() ([]byte, []int) { return fileDescriptorMspb, []int{46} }
 
 func (m *RequestHeader) GetClusterId() uint64 {
 	if m != nil {
@@ -1591,7 +1864,7 @@ type ResponseHeader struct {
 func (m *ResponseHeader) Reset()                    { *m = ResponseHeader{} }
 func (m *ResponseHeader) String() string            { return proto.CompactTextString(m) }
 func (*ResponseHeader) ProtoMessage()               {}
-func (*ResponseHeader) Descriptor() ([]byte, []int) { return fileDescriptorMspb, []int{45} }
+func (*ResponseHeader) Descriptor() ([]byte, []int) { return fileDescriptorMspb, []int{47} }
 
 func (m *ResponseHeader) GetClusterId() uint64 {
 	if m != nil {
@@ -1615,7 +1888,7 @@ type LeaderHint struct {
 func (m *LeaderHint) Reset()                    { *m = LeaderHint{} }
 func (m *LeaderHint) String() string            { return proto.CompactTextString(m) }
 func (*LeaderHint) ProtoMessage()               {}
-func (*LeaderHint) Descriptor() ([]byte, []int) { return fileDescriptorMspb, []int{46} }
+func (*LeaderHint) Descriptor() ([]byte, []int) { return fileDescriptorMspb, []int{48} }
 
 func (m *LeaderHint) GetAddress() string {
 	if m != nil {
@@ -1637,7 +1910,7 @@ type NoLeader struct {
 func (m *NoLeader) Reset()                    { *m = NoLeader{} }
 func (m *NoLeader) String() string            { return proto.CompactTextString(m) }
 func (*NoLeader) ProtoMessage()               {}
-func (*NoLeader) Descriptor() ([]byte, []int) { return fileDescriptorMspb, []int{47} }
+func (*NoLeader) Descriptor() ([]byte, []int) { return fileDescriptorMspb, []int{49} }
 
 type Error struct {
 	NewLeader *LeaderHint `protobuf:"bytes,2,opt,name=new_leader,json=newLeader" json:"new_leader,omitempty"`
@@ -1647,7 +1920,7 @@ type Error struct {
 func (m *Error) Reset()                    { *m = Error{} }
 func (m *Error) String() string            { return proto.CompactTextString(m) }
 func (*Error) ProtoMessage()               {}
-func (*Error) Descriptor() ([]byte, []int) { return fileDescriptorMspb, []int{48} }
+func (*Error) Descriptor() ([]byte, []int) { return fileDescriptorMspb, []int{50} }
 
 func (m *Error) GetNewLeader() *LeaderHint {
 	if m != nil {
@@ -1671,6 +1944,8 @@ func init() {
 	proto.RegisterType((*RangeStats)(nil), "mspb.RangeStats")
 	proto.RegisterType((*RangeHeartbeatRequest)(nil), "mspb.RangeHeartbeatRequest")
 	proto.RegisterType((*RangeHeartbeatResponse)(nil), "mspb.RangeHeartbeatResponse")
+	proto.RegisterType((*BatchRangeHeartbeatRequest)(nil), "mspb.BatchRangeHeartbeatRequest")
+	proto.RegisterType((*BatchRangeHeartbeatResponse)(nil), "mspb.BatchRangeHeartbeatResponse")
 	proto.RegisterType((*NodeStats)(nil), "mspb.NodeStats")
 	proto.RegisterType((*NodeHeartbeatRequest)(nil), "mspb.NodeHeartbeatRequest")
 	proto.RegisterType((*NodeHeartbeatResponse)(nil), "mspb.NodeHeartbeatResponse")
@@ -1746,6 +2021,7 @@ type MsServerClient interface {
 	CreateDatabase(ctx context.Context, in *CreateDatabaseRequest, opts ...grpc.CallOption) (*CreateDatabaseResponse, error)
 	CreateTable(ctx context.Context, in *CreateTableRequest, opts ...grpc.CallOption) (*CreateTableResponse, error)
 	GetAutoIncId(ctx context.Context, in *GetAutoIncIdRequest, opts ...grpc.CallOption) (*GetAutoIncIdResponse, error)
+	BatchRangeHeartbeat(ctx context.Context, in *BatchRangeHeartbeatRequest, opts ...grpc.CallOption) (*BatchRangeHeartbeatResponse, error)
 }
 
 type msServerClient struct {
@@ -1936,6 +2212,15 @@ func (c *msServerClient) GetAutoIncId(ctx context.Context, in *GetAutoIncIdReque
 	return out, nil
 }
 
+func (c *msServerClient) BatchRangeHeartbeat(ctx context.Context, in *BatchRangeHeartbeatRequest, opts ...grpc.CallOption) (*BatchRangeHeartbeatResponse, error) {
+	out := new(BatchRangeHeartbeatResponse)
+	err := grpc.Invoke(ctx, "/mspb.MsServer/BatchRangeHeartbeat", in, out, c.cc, opts...)
+	if err != nil {
+		return nil, err
+	}
+	return out, nil
+}
+
 // Server API for MsServer service
 
 type MsServerServer interface {
@@ -1959,6 +2244,7 @@ type MsServerServer interface {
 	CreateDatabase(context.Context, *CreateDatabaseRequest) (*CreateDatabaseResponse, error)
 	CreateTable(context.Context, *CreateTableRequest) (*CreateTableResponse, error)
 	GetAutoIncId(context.Context, *GetAutoIncIdRequest) (*GetAutoIncIdResponse, error)
+	BatchRangeHeartbeat(context.Context, *BatchRangeHeartbeatRequest) (*BatchRangeHeartbeatResponse, error)
 }
 
 func RegisterMsServerServer(s *grpc.Server, srv MsServerServer) {
@@ -2325,6 +2611,24 @@ func _MsServer_GetAutoIncId_Handler(srv interface{}, ctx context.Context, dec fu
 	return interceptor(ctx, in, info, handler)
 }
 
+func _MsServer_BatchRangeHeartbeat_Handler(srv interface{}, ctx context.Context, dec func(interface{}) error, interceptor grpc.UnaryServerInterceptor) (interface{}, error) {
+	in := new(BatchRangeHeartbeatRequest)
+	if err := dec(in); err != nil {
+		return nil, err
+	}
+	if interceptor == nil {
+		return srv.(MsServerServer).BatchRangeHeartbeat(ctx, in)
+	}
+	info := &grpc.UnaryServerInfo{
+		Server:     srv,
+		FullMethod: "/mspb.MsServer/BatchRangeHeartbeat",
+	}
+	handler := func(ctx context.Context, req interface{}) (interface{}, error) {
+		return srv.(MsServerServer).BatchRangeHeartbeat(ctx, req.(*BatchRangeHeartbeatRequest))
+	}
+	return interceptor(ctx, in, info, handler)
+}
+
 var _MsServer_serviceDesc = grpc.ServiceDesc{
 	ServiceName: "mspb.MsServer",
 	HandlerType: (*MsServerServer)(nil),
@@ -2409,6 +2713,10 @@ var _MsServer_serviceDesc = grpc.ServiceDesc{
 			MethodName: "GetAutoIncId",
 			Handler:    _MsServer_GetAutoIncId_Handler,
 		},
+		{
+			MethodName: "BatchRangeHeartbeat",
+			Handler:    _MsServer_BatchRangeHeartbeat_Handler,
+		},
 	},
 	Streams:  []grpc.StreamDesc{},
 	Metadata: "mspb.proto",
@@ -2748,7 +3056,7 @@ func (m *RangeHeartbeatResponse) MarshalTo(dAtA []byte) (int, error) {
 	return i, nil
 }
 
-func (m *NodeStats) Marshal() (dAtA []byte, err error) {
+func (m *BatchRangeHeartbeatRequest) Marshal() (dAtA []byte, err error) {
 	size := m.Size()
 	dAtA = make([]byte, size)
 	n, err := m.MarshalTo(dAtA)
@@ -2758,53 +3066,172 @@ func (m *NodeStats) Marshal() (dAtA []byte, err error) {
 	return dAtA[:n], nil
 }
 
-func (m *NodeStats) MarshalTo(dAtA []byte) (int, error) {
+func (m *BatchRangeHeartbeatRequest) MarshalTo(dAtA []byte) (int, error) {
 	var i int
 	_ = i
 	var l int
 	_ = l
-	if m.RangeCount != 0 {
-		dAtA[i] = 0x8
+	if m.Header != nil {
+		dAtA[i] = 0xa
 		i++
-		i = encodeVarintMspb(dAtA, i, uint64(m.RangeCount))
+		i = encodeVarintMspb(dAtA, i, uint64(m.Header.Size()))
+		n13, err := m.Header.MarshalTo(dAtA[i:])
+		if err != nil {
+			return 0, err
+		}
+		i += n13
 	}
-	if m.RangeSplitCount != 0 {
+	if m.NodeId != 0 {
 		dAtA[i] = 0x10
 		i++
-		i = encodeVarintMspb(dAtA, i, uint64(m.RangeSplitCount))
-	}
-	if m.SendingSnapCount != 0 {
-		dAtA[i] = 0x18
-		i++
-		i = encodeVarintMspb(dAtA, i, uint64(m.SendingSnapCount))
-	}
-	if m.ReceivingSnapCount != 0 {
-		dAtA[i] = 0x20
-		i++
-		i = encodeVarintMspb(dAtA, i, uint64(m.ReceivingSnapCount))
+		i = encodeVarintMspb(dAtA, i, uint64(m.NodeId))
 	}
-	if m.ApplyingSnapCount != 0 {
-		dAtA[i] = 0x28
-		i++
-		i = encodeVarintMspb(dAtA, i, uint64(m.ApplyingSnapCount))
+	if len(m.Heartbeats) > 0 {
+		for _, msg := range m.Heartbeats {
+			dAtA[i] = 0x1a
+			i++
+			i = encodeVarintMspb(dAtA, i, uint64(msg.Size()))
+			n, err := msg.MarshalTo(dAtA[i:])
+			if err != nil {
+				return 0, err
+			}
+			i += n
+		}
 	}
-	if m.RangeLeaderCount != 0 {
-		dAtA[i] = 0x30
+	if len(m.UnchangedRanges) > 0 {
+		dAtA15 := make([]byte, len(m.UnchangedRanges)*10)
+		var j14 int
+		for _, num := range m.UnchangedRanges {
+			for num >= 1<<7 {
+				dAtA15[j14] = uint8(uint64(num)&0x7f | 0x80)
+				num >>= 7
+				j14++
+			}
+			dAtA15[j14] = uint8(num)
+			j14++
+		}
+		dAtA[i] = 0x22
 		i++
-		i = encodeVarintMspb(dAtA, i, uint64(m.RangeLeaderCount))
+		i = encodeVarintMspb(dAtA, i, uint64(j14))
+		i += copy(dAtA[i:], dAtA15[:j14])
 	}
-	if m.Capacity != 0 {
-		dAtA[i] = 0x38
-		i++
-		i = encodeVarintMspb(dAtA, i, uint64(m.Capacity))
+	return i, nil
+}
+
+func (m *BatchRangeHeartbeatResponse) Marshal() (dAtA []byte, err error) {
+	size := m.Size()
+	dAtA = make([]byte, size)
+	n, err := m.MarshalTo(dAtA)
+	if err != nil {
+		return nil, err
 	}
-	if m.UsedSize != 0 {
-		dAtA[i] = 0x40
+	return dAtA[:n], nil
+}
+
+func (m *BatchRangeHeartbeatResponse) MarshalTo(dAtA []byte) (int, error) {
+	var i int
+	_ = i
+	var l int
+	_ = l
+	if m.Header != nil {
+		dAtA[i] = 0xa
 		i++
-		i = encodeVarintMspb(dAtA, i, uint64(m.UsedSize))
+		i = encodeVarintMspb(dAtA, i, uint64(m.Header.Size()))
+		n16, err := m.Header.MarshalTo(dAtA[i:])
+		if err != nil {
+			return 0, err
+		}
+		i += n16
 	}
-	if m.Available != 0 {
-		dAtA[i] = 0x48
+	if len(m.Responses) > 0 {
+		for _, msg := range m.Responses {
+			dAtA[i] = 0x12
+			i++
+			i = encodeVarintMspb(dAtA, i, uint64(msg.Size()))
+			n, err := msg.MarshalTo(dAtA[i:])
+			if err != nil {
+				return 0, err
+			}
+			i += n
+		}
+	}
+	if len(m.FullRequired) > 0 {
+		dAtA18 := make([]byte, len(m.FullRequired)*10)
+		var j17 int
+		for _, num := range m.FullRequired {
+			for num >= 1<<7 {
+				dAtA18[j17] = uint8(uint64(num)&0x7f | 0x80)
+				num >>= 7
+				j17++
+			}
+			dAtA18[j17] = uint8(num)
+			j17++
+		}
+		dAtA[i] = 0x1a
+		i++
+		i = encodeVarintMspb(dAtA, i, uint64(j17))
+		i += copy(dAtA[i:], dAtA18[:j17])
+	}
+	return i, nil
+}
+
+func (m *NodeStats) Marshal() (dAtA []byte, err error) {
+	size := m.Size()
+	dAtA = make([]byte, size)
+	n, err := m.MarshalTo(dAtA)
+	if err != nil {
+		return nil, err
+	}
+	return dAtA[:n], nil
+}
+
+func (m *NodeStats) MarshalTo(dAtA []byte) (int, error) {
+	var i int
+	_ = i
+	var l int
+	_ = l
+	if m.RangeCount != 0 {
+		dAtA[i] = 0x8
+		i++
+		i = encodeVarintMspb(dAtA, i, uint64(m.RangeCount))
+	}
+	if m.RangeSplitCount != 0 {
+		dAtA[i] = 0x10
+		i++
+		i = encodeVarintMspb(dAtA, i, uint64(m.RangeSplitCount))
+	}
+	if m.SendingSnapCount != 0 {
+		dAtA[i] = 0x18
+		i++
+		i = encodeVarintMspb(dAtA, i, uint64(m.SendingSnapCount))
+	}
+	if m.ReceivingSnapCount != 0 {
+		dAtA[i] = 0x20
+		i++
+		i = encodeVarintMspb(dAtA, i, uint64(m.ReceivingSnapCount))
+	}
+	if m.ApplyingSnapCount != 0 {
+		dAtA[i] = 0x28
+		i++
+		i = encodeVarintMspb(dAtA, i, uint64(m.ApplyingSnapCount))
+	}
+	if m.RangeLeaderCount != 0 {
+		dAtA[i] = 0x30
+		i++
+		i = encodeVarintMspb(dAtA, i, uint64(m.RangeLeaderCount))
+	}
+	if m.Capacity != 0 {
+		dAtA[i] = 0x38
+		i++
+		i = encodeVarintMspb(dAtA, i, uint64(m.Capacity))
+	}
+	if m.UsedSize != 0 {
+		dAtA[i] = 0x40
+		i++
+		i = encodeVarintMspb(dAtA, i, uint64(m.UsedSize))
+	}
+	if m.Available != 0 {
+		dAtA[i] = 0x48
 		i++
 		i = encodeVarintMspb(dAtA, i, uint64(m.Available))
 	}
@@ -2843,6 +3270,165 @@ func (m *NodeStats) MarshalTo(dAtA []byte) (int, error) {
 		i++
 		i = encodeVarintMspb(dAtA, i, uint64(m.Start))
 	}
+	if m.CpuUsage != 0 {
+		dAtA[i] = 0x81
+		i++
+		dAtA[i] = 0x1
+		i++
+		binary.LittleEndian.PutUint64(dAtA[i:], uint64(math.Float64bits(float64(m.CpuUsage))))
+		i += 8
+	}
+	if m.ProcessCpuUsage != 0 {
+		dAtA[i] = 0x89
+		i++
+		dAtA[i] = 0x1
+		i++
+		binary.LittleEndian.PutUint64(dAtA[i:], uint64(math.Float64bits(float64(m.ProcessCpuUsage))))
+		i += 8
+	}
+	if m.CpuCount != 0 {
+		dAtA[i] = 0x90
+		i++
+		dAtA[i] = 0x1
+		i++
+		i = encodeVarintMspb(dAtA, i, uint64(m.CpuCount))
+	}
+	if m.DiskUtil != 0 {
+		dAtA[i] = 0x99
+		i++
+		dAtA[i] = 0x1
+		i++
+		binary.LittleEndian.PutUint64(dAtA[i:], uint64(math.Float64bits(float64(m.DiskUtil))))
+		i += 8
+	}
+	if m.DiskReadLatencyMs != 0 {
+		dAtA[i] = 0xa1
+		i++
+		dAtA[i] = 0x1
+		i++
+		binary.LittleEndian.PutUint64(dAtA[i:], uint64(math.Float64bits(float64(m.DiskReadLatencyMs))))
+		i += 8
+	}
+	if m.DiskWriteLatencyMs != 0 {
+		dAtA[i] = 0xa9
+		i++
+		dAtA[i] = 0x1
+		i++
+		binary.LittleEndian.PutUint64(dAtA[i:], uint64(math.Float64bits(float64(m.DiskWriteLatencyMs))))
+		i += 8
+	}
+	if m.DiskReadBytes != 0 {
+		dAtA[i] = 0xb0
+		i++
+		dAtA[i] = 0x1
+		i++
+		i = encodeVarintMspb(dAtA, i, uint64(m.DiskReadBytes))
+	}
+	if m.DiskWriteBytes != 0 {
+		dAtA[i] = 0xb8
+		i++
+		dAtA[i] = 0x1
+		i++
+		i = encodeVarintMspb(dAtA, i, uint64(m.DiskWriteBytes))
+	}
+	if m.NetInBytes != 0 {
+		dAtA[i] = 0xc0
+		i++
+		dAtA[i] = 0x1
+		i++
+		i = encodeVarintMspb(dAtA, i, uint64(m.NetInBytes))
+	}
+	if m.NetOutBytes != 0 {
+		dAtA[i] = 0xc8
+		i++
+		dAtA[i] = 0x1
+		i++
+		i = encodeVarintMspb(dAtA, i, uint64(m.NetOutBytes))
+	}
+	if m.PerfSamples != 0 {
+		dAtA[i] = 0xd0
+		i++
+		dAtA[i] = 0x1
+		i++
+		i = encodeVarintMspb(dAtA, i, uint64(m.PerfSamples))
+	}
+	if m.PerfBlockCacheHits != 0 {
+		dAtA[i] = 0xd8
+		i++
+		dAtA[i] = 0x1
+		i++
+		i = encodeVarintMspb(dAtA, i, uint64(m.PerfBlockCacheHits))
+	}
+	if m.PerfBlockReads != 0 {
+		dAtA[i] = 0xe0
+		i++
+		dAtA[i] = 0x1
+		i++
+		i = encodeVarintMspb(dAtA, i, uint64(m.PerfBlockReads))
+	}
+	if m.PerfBlockReadBytes != 0 {
+		dAtA[i] = 0xe8
+		i++
+		dAtA[i] = 0x1
+		i++
+		i = encodeVarintMspb(dAtA, i, uint64(m.PerfBlockReadBytes))
+	}
+	if m.PerfBlockReadNanos != 0 {
+		dAtA[i] = 0xf0
+		i++
+		dAtA[i] = 0x1
+		i++
+		i = encodeVarintMspb(dAtA, i, uint64(m.PerfBlockReadNanos))
+	}
+	if m.PerfMemtableNanos != 0 {
+		dAtA[i] = 0xf8
+		i++
+		dAtA[i] = 0x1
+		i++
+		i = encodeVarintMspb(dAtA, i, uint64(m.PerfMemtableNanos))
+	}
+	if m.PerfSstNanos != 0 {
+		dAtA[i] = 0x80
+		i++
+		dAtA[i] = 0x2
+		i++
+		i = encodeVarintMspb(dAtA, i, uint64(m.PerfSstNanos))
+	}
+	if m.PerfIterSeekNanos != 0 {
+		dAtA[i] = 0x88
+		i++
+		dAtA[i] = 0x2
+		i++
+		i = encodeVarintMspb(dAtA, i, uint64(m.PerfIterSeekNanos))
+	}
+	if m.PerfKeysSkipped != 0 {
+		dAtA[i] = 0x90
+		i++
+		dAtA[i] = 0x2
+		i++
+		i = encodeVarintMspb(dAtA, i, uint64(m.PerfKeysSkipped))
+	}
+	if m.PerfDeletesSkipped != 0 {
+		dAtA[i] = 0x98
+		i++
+		dAtA[i] = 0x2
+		i++
+		i = encodeVarintMspb(dAtA, i, uint64(m.PerfDeletesSkipped))
+	}
+	if m.PerfIoReadBytes != 0 {
+		dAtA[i] = 0xa0
+		i++
+		dAtA[i] = 0x2
+		i++
+		i = encodeVarintMspb(dAtA, i, uint64(m.PerfIoReadBytes))
+	}
+	if m.PerfIoReadNanos != 0 {
+		dAtA[i] = 0xa8
+		i++
+		dAtA[i] = 0x2
+		i++
+		i = encodeVarintMspb(dAtA, i, uint64(m.PerfIoReadNanos))
+	}
 	return i, nil
 }
 
@@ -2865,11 +3451,11 @@ func (m *NodeHeartbeatRequest) MarshalTo(dAtA []byte) (int, error) {
 		dAtA[i] = 0xa
 		i++
 		i = encodeVarintMspb(dAtA, i, uint64(m.Header.Size()))
-		n13, err := m.Header.MarshalTo(dAtA[i:])
+		n19, err := m.Header.MarshalTo(dAtA[i:])
 		if err != nil {
 			return 0, err
 		}
-		i += n13
+		i += n19
 	}
 	if m.NodeId != 0 {
 		dAtA[i] = 0x10
@@ -2880,28 +3466,28 @@ func (m *NodeHeartbeatRequest) MarshalTo(dAtA []byte) (int, error) {
 		dAtA[i] = 0x1a
 		i++
 		i = encodeVarintMspb(dAtA, i, uint64(m.Stats.Size()))
-		n14, err := m.Stats.MarshalTo(dAtA[i:])
+		n20, err := m.Stats.MarshalTo(dAtA[i:])
 		if err != nil {
 			return 0, err
 		}
-		i += n14
+		i += n20
 	}
 	if len(m.IsolatedReplicas) > 0 {
-		dAtA16 := make([]byte, len(m.IsolatedReplicas)*10)
-		var j15 int
+		dAtA22 := make([]byte, len(m.IsolatedReplicas)*10)
+		var j21 int
 		for _, num := range m.IsolatedReplicas {
 			for num >= 1<<7 {
-				dAtA16[j15] = uint8(uint64(num)&0x7f | 0x80)
+				dAtA22[j21] = uint8(uint64(num)&0x7f | 0x80)
 				num >>= 7
-				j15++
+				j21++
 			}
-			dAtA16[j15] = uint8(num)
-			j15++
+			dAtA22[j21] = uint8(num)
+			j21++
 		}
 		dAtA[i] = 0x22
 		i++
-		i = encodeVarintMspb(dAtA, i, uint64(j15))
-		i += copy(dAtA[i:], dAtA16[:j15])
+		i = encodeVarintMspb(dAtA, i, uint64(j21))
+		i += copy(dAtA[i:], dAtA22[:j21])
 	}
 	return i, nil
 }
@@ -2925,11 +3511,11 @@ func (m *NodeHeartbeatResponse) MarshalTo(dAtA []byte) (int, error) {
 		dAtA[i] = 0xa
 		i++
 		i = encodeVarintMspb(dAtA, i, uint64(m.Header.Size()))
-		n17, err := m.Header.MarshalTo(dAtA[i:])
+		n23, err := m.Header.MarshalTo(dAtA[i:])
 		if err != nil {
 			return 0, err
 		}
-		i += n17
+		i += n23
 	}
 	if m.NodeId != 0 {
 		dAtA[i] = 0x10
@@ -2937,21 +3523,21 @@ func (m *NodeHeartbeatResponse) MarshalTo(dAtA []byte) (int, error) {
 		i = encodeVarintMspb(dAtA, i, uint64(m.NodeId))
 	}
 	if len(m.DeleteReplicas) > 0 {
-		dAtA19 := make([]byte, len(m.DeleteReplicas)*10)
-		var j18 int
+		dAtA25 := make([]byte, len(m.DeleteReplicas)*10)
+		var j24 int
 		for _, num := range m.DeleteReplicas {
 			for num >= 1<<7 {
-				dAtA19[j18] = uint8(uint64(num)&0x7f | 0x80)
+				dAtA25[j24] = uint8(uint64(num)&0x7f | 0x80)
 				num >>= 7
-				j18++
+				j24++
 			}
-			dAtA19[j18] = uint8(num)
-			j18++
+			dAtA25[j24] = uint8(num)
+			j24++
 		}
 		dAtA[i] = 0x1a
 		i++
-		i = encodeVarintMspb(dAtA, i, uint64(j18))
-		i += copy(dAtA[i:], dAtA19[:j18])
+		i = encodeVarintMspb(dAtA, i, uint64(j24))
+		i += copy(dAtA[i:], dAtA25[:j24])
 	}
 	return i, nil
 }
@@ -2975,21 +3561,21 @@ func (m *AskSplitRequest) MarshalTo(dAtA []byte) (int, error) {
 		dAtA[i] = 0xa
 		i++
 		i = encodeVarintMspb(dAtA, i, uint64(m.Header.Size()))
-		n20, err := m.Header.MarshalTo(dAtA[i:])
+		n26, err := m.Header.MarshalTo(dAtA[i:])
 		if err != nil {
 			return 0, err
 		}
-		i += n20
+		i += n26
 	}
 	if m.Range != nil {
 		dAtA[i] = 0x12
 		i++
 		i = encodeVarintMspb(dAtA, i, uint64(m.Range.Size()))
-		n21, err := m.Range.MarshalTo(dAtA[i:])
+		n27, err := m.Range.MarshalTo(dAtA[i:])
 		if err != nil {
 			return 0, err
 		}
-		i += n21
+		i += n27
 	}
 	if len(m.SplitKey) > 0 {
 		dAtA[i] = 0x1a
@@ -3019,21 +3605,21 @@ func (m *AskSplitResponse) MarshalTo(dAtA []byte) (int, error) {
 		dAtA[i] = 0xa
 		i++
 		i = encodeVarintMspb(dAtA, i, uint64(m.Header.Size()))
-		n22, err := m.Header.MarshalTo(dAtA[i:])
+		n28, err := m.Header.MarshalTo(dAtA[i:])
 		if err != nil {
 			return 0, err
 		}
-		i += n22
+		i += n28
 	}
 	if m.Range != nil {
 		dAtA[i] = 0x12
 		i++
 		i = encodeVarintMspb(dAtA, i, uint64(m.Range.Size()))
-		n23, err := m.Range.MarshalTo(dAtA[i:])
+		n29, err := m.Range.MarshalTo(dAtA[i:])
 		if err != nil {
 			return 0, err
 		}
-		i += n23
+		i += n29
 	}
 	if m.NewRangeId != 0 {
 		dAtA[i] = 0x18
@@ -3041,21 +3627,21 @@ func (m *AskSplitResponse) MarshalTo(dAtA []byte) (int, error) {
 		i = encodeVarintMspb(dAtA, i, uint64(m.NewRangeId))
 	}
 	if len(m.NewPeerIds) > 0 {
-		dAtA25 := make([]byte, len(m.NewPeerIds)*10)
-		var j24 int
+		dAtA31 := make([]byte, len(m.NewPeerIds)*10)
+		var j30 int
 		for _, num := range m.NewPeerIds {
 			for num >= 1<<7 {
-				dAtA25[j24] = uint8(uint64(num)&0x7f | 0x80)
+				dAtA31[j30] = uint8(uint64(num)&0x7f | 0x80)
 				num >>= 7
-				j24++
+				j30++
 			}
-			dAtA25[j24] = uint8(num)
-			j24++
+			dAtA31[j30] = uint8(num)
+			j30++
 		}
 		dAtA[i] = 0x22
 		i++
-		i = encodeVarintMspb(dAtA, i, uint64(j24))
-		i += copy(dAtA[i:], dAtA25[:j24])
+		i = encodeVarintMspb(dAtA, i, uint64(j30))
+		i += copy(dAtA[i:], dAtA31[:j30])
 	}
 	if len(m.SplitKey) > 0 {
 		dAtA[i] = 0x2a
@@ -3085,31 +3671,31 @@ func (m *ReportSplitRequest) MarshalTo(dAtA []byte) (int, error) {
 		dAtA[i] = 0xa
 		i++
 		i = encodeVarintMspb(dAtA, i, uint64(m.Header.Size()))
-		n26, err := m.Header.MarshalTo(dAtA[i:])
+		n32, err := m.Header.MarshalTo(dAtA[i:])
 		if err != nil {
 			return 0, err
 		}
-		i += n26
+		i += n32
 	}
 	if m.Left != nil {
 		dAtA[i] = 0x12
 		i++
 		i = encodeVarintMspb(dAtA, i, uint64(m.Left.Size()))
-		n27, err := m.Left.MarshalTo(dAtA[i:])
+		n33, err := m.Left.MarshalTo(dAtA[i:])
 		if err != nil {
 			return 0, err
 		}
-		i += n27
+		i += n33
 	}
 	if m.Right != nil {
 		dAtA[i] = 0x1a
 		i++
 		i = encodeVarintMspb(dAtA, i, uint64(m.Right.Size()))
-		n28, err := m.Right.MarshalTo(dAtA[i:])
+		n34, err := m.Right.MarshalTo(dAtA[i:])
 		if err != nil {
 			return 0, err
 		}
-		i += n28
+		i += n34
 	}
 	return i, nil
 }
@@ -3133,11 +3719,11 @@ func (m *ReportSplitResponse) MarshalTo(dAtA []byte) (int, error) {
 		dAtA[i] = 0xa
 		i++
 		i = encodeVarintMspb(dAtA, i, uint64(m.Header.Size()))
-		n29, err := m.Header.MarshalTo(dAtA[i:])
+		n35, err := m.Header.MarshalTo(dAtA[i:])
 		if err != nil {
 			return 0, err
 		}
-		i += n29
+		i += n35
 	}
 	return i, nil
 }
@@ -3161,11 +3747,11 @@ func (m *NodeLoginRequest) MarshalTo(dAtA []byte) (int, error) {
 		dAtA[i] = 0xa
 		i++
 		i = encodeVarintMspb(dAtA, i, uint64(m.Header.Size()))
-		n30, err := m.Header.MarshalTo(dAtA[i:])
+		n36, err := m.Header.MarshalTo(dAtA[i:])
 		if err != nil {
 			return 0, err
 		}
-		i += n30
+		i += n36
 	}
 	if m.NodeId != 0 {
 		dAtA[i] = 0x10
@@ -3194,11 +3780,11 @@ func (m *NodeLoginResponse) MarshalTo(dAtA []byte) (int, error) {
 		dAtA[i] = 0xa
 		i++
 		i = encodeVarintMspb(dAtA, i, uint64(m.Header.Size()))
-		n31, err := m.Header.MarshalTo(dAtA[i:])
+		n37, err := m.Header.MarshalTo(dAtA[i:])
 		if err != nil {
 			return 0, err
 		}
-		i += n31
+		i += n37
 	}
 	return i, nil
 }
@@ -3222,11 +3808,11 @@ func (m *GetNodeIdRequest) MarshalTo(dAtA []byte) (int, error) {
 		dAtA[i] = 0xa
 		i++
 		i = encodeVarintMspb(dAtA, i, uint64(m.Header.Size()))
-		n32, err := m.Header.MarshalTo(dAtA[i:])
+		n38, err := m.Header.MarshalTo(dAtA[i:])
 		if err != nil {
 			return 0, err
 		}
-		i += n32
+		i += n38
 	}
 	if m.ServerPort != 0 {
 		dAtA[i] = 0x10
@@ -3271,11 +3857,11 @@ func (m *GetNodeIdResponse) MarshalTo(dAtA []byte) (int, error) {
 		dAtA[i] = 0xa
 		i++
 		i = encodeVarintMspb(dAtA, i, uint64(m.Header.Size()))
-		n33, err := m.Header.MarshalTo(dAtA[i:])
+		n39, err := m.Header.MarshalTo(dAtA[i:])
 		if err != nil {
 			return 0, err
 		}
-		i += n33
+		i += n39
 	}
 	if m.NodeId != 0 {
 		dAtA[i] = 0x10
@@ -3314,11 +3900,11 @@ func (m *GetRouteRequest) MarshalTo(dAtA []byte) (int, error) {
 		dAtA[i] = 0xa
 		i++
 		i = encodeVarintMspb(dAtA, i, uint64(m.Header.Size()))
-		n34, err := m.Header.MarshalTo(dAtA[i:])
+		n40, err := m.Header.MarshalTo(dAtA[i:])
 		if err != nil {
 			return 0, err
 		}
-		i += n34
+		i += n40
 	}
 	if m.DbId != 0 {
 		dAtA[i] = 0x10
@@ -3358,11 +3944,11 @@ func (m *GetRouteResponse) MarshalTo(dAtA []byte) (int, error) {
 		dAtA[i] = 0xa
 		i++
 		i = encodeVarintMspb(dAtA, i, uint64(m.Header.Size()))
-		n35, err := m.Header.MarshalTo(dAtA[i:])
+		n41, err := m.Header.MarshalTo(dAtA[i:])
 		if err != nil {
 			return 0, err
 		}
-		i += n35
+		i += n41
 	}
 	if len(m.Routes) > 0 {
 		for _, msg := range m.Routes {
@@ -3398,11 +3984,11 @@ func (m *GetNodeRequest) MarshalTo(dAtA []byte) (int, error) {
 		dAtA[i] = 0xa
 		i++
 		i = encodeVarintMspb(dAtA, i, uint64(m.Header.Size()))
-		n36, err := m.Header.MarshalTo(dAtA[i:])
+		n42, err := m.Header.MarshalTo(dAtA[i:])
 		if err != nil {
 			return 0, err
 		}
-		i += n36
+		i += n42
 	}
 	if m.Id != 0 {
 		dAtA[i] = 0x10
@@ -3431,21 +4017,21 @@ func (m *GetNodeResponse) MarshalTo(dAtA []byte) (int, error) {
 		dAtA[i] = 0xa
 		i++
 		i = encodeVarintMspb(dAtA, i, uint64(m.Header.Size()))
-		n37, err := m.Header.MarshalTo(dAtA[i:])
+		n43, err := m.Header.MarshalTo(dAtA[i:])
 		if err != nil {
 			return 0, err
 		}
-		i += n37
+		i += n43
 	}
 	if m.Node != nil {
 		dAtA[i] = 0x12
 		i++
 		i = encodeVarintMspb(dAtA, i, uint64(m.Node.Size()))
-		n38, err := m.Node.MarshalTo(dAtA[i:])
+		n44, err := m.Node.MarshalTo(dAtA[i:])
 		if err != nil {
 			return 0, err
 		}
-		i += n38
+		i += n44
 	}
 	return i, nil
 }
@@ -3469,11 +4055,11 @@ func (m *GetDBRequest) MarshalTo(dAtA []byte) (int, error) {
 		dAtA[i] = 0xa
 		i++
 		i = encodeVarintMspb(dAtA, i, uint64(m.Header.Size()))
-		n39, err := m.Header.MarshalTo(dAtA[i:])
+		n45, err := m.Header.MarshalTo(dAtA[i:])
 		if err != nil {
 			return 0, err
 		}
-		i += n39
+		i += n45
 	}
 	if len(m.Name) > 0 {
 		dAtA[i] = 0x12
@@ -3503,21 +4089,21 @@ func (m *GetDBResponse) MarshalTo(dAtA []byte) (int, error) {
 		dAtA[i] = 0xa
 		i++
 		i = encodeVarintMspb(dAtA, i, uint64(m.Header.Size()))
-		n40, err := m.Header.MarshalTo(dAtA[i:])
+		n46, err := m.Header.MarshalTo(dAtA[i:])
 		if err != nil {
 			return 0, err
 		}
-		i += n40
+		i += n46
 	}
 	if m.Db != nil {
 		dAtA[i] = 0x12
 		i++
 		i = encodeVarintMspb(dAtA, i, uint64(m.Db.Size()))
-		n41, err := m.Db.MarshalTo(dAtA[i:])
+		n47, err := m.Db.MarshalTo(dAtA[i:])
 		if err != nil {
 			return 0, err
 		}
-		i += n41
+		i += n47
 	}
 	return i, nil
 }
@@ -3541,11 +4127,11 @@ func (m *GetTableRequest) MarshalTo(dAtA []byte) (int, error) {
 		dAtA[i] = 0xa
 		i++
 		i = encodeVarintMspb(dAtA, i, uint64(m.Header.Size()))
-		n42, err := m.Header.MarshalTo(dAtA[i:])
+		n48, err := m.Header.MarshalTo(dAtA[i:])
 		if err != nil {
 			return 0, err
 		}
-		i += n42
+		i += n48
 	}
 	if len(m.DbName) > 0 {
 		dAtA[i] = 0x12
@@ -3581,11 +4167,11 @@ func (m *GetTableByIdRequest) MarshalTo(dAtA []byte) (int, error) {
 		dAtA[i] = 0xa
 		i++
 		i = encodeVarintMspb(dAtA, i, uint64(m.Header.Size()))
-		n43, err := m.Header.MarshalTo(dAtA[i:])
+		n49, err := m.Header.MarshalTo(dAtA[i:])
 		if err != nil {
 			return 0, err
 		}
-		i += n43
+		i += n49
 	}
 	if m.DbId != 0 {
 		dAtA[i] = 0x10
@@ -3619,21 +4205,21 @@ func (m *GetTableResponse) MarshalTo(dAtA []byte) (int, error) {
 		dAtA[i] = 0xa
 		i++
 		i = encodeVarintMspb(dAtA, i, uint64(m.Header.Size()))
-		n44, err := m.Header.MarshalTo(dAtA[i:])
+		n50, err := m.Header.MarshalTo(dAtA[i:])
 		if err != nil {
 			return 0, err
 		}
-		i += n44
+		i += n50
 	}
 	if m.Table != nil {
 		dAtA[i] = 0x12
 		i++
 		i = encodeVarintMspb(dAtA, i, uint64(m.Table.Size()))
-		n45, err := m.Table.MarshalTo(dAtA[i:])
+		n51, err := m.Table.MarshalTo(dAtA[i:])
 		if err != nil {
 			return 0, err
 		}
-		i += n45
+		i += n51
 	}
 	return i, nil
 }
@@ -3657,21 +4243,21 @@ func (m *GetTableByIdResponse) MarshalTo(dAtA []byte) (int, error) {
 		dAtA[i] = 0xa
 		i++
 		i = encodeVarintMspb(dAtA, i, uint64(m.Header.Size()))
-		n46, err := m.Header.MarshalTo(dAtA[i:])
+		n52, err := m.Header.MarshalTo(dAtA[i:])
 		if err != nil {
 			return 0, err
 		}
-		i += n46
+		i += n52
 	}
 	if m.Table != nil {
 		dAtA[i] = 0x12
 		i++
 		i = encodeVarintMspb(dAtA, i, uint64(m.Table.Size()))
-		n47, err := m.Table.MarshalTo(dAtA[i:])
+		n53, err := m.Table.MarshalTo(dAtA[i:])
 		if err != nil {
 			return 0, err
 		}
-		i += n47
+		i += n53
 	}
 	return i, nil
 }
@@ -3695,11 +4281,11 @@ func (m *GetColumnsRequest) MarshalTo(dAtA []byte) (int, error) {
 		dAtA[i] = 0xa
 		i++
 		i = encodeVarintMspb(dAtA, i, uint64(m.Header.Size()))
-		n48, err := m.Header.MarshalTo(dAtA[i:])
+		n54, err := m.Header.MarshalTo(dAtA[i:])
 		if err != nil {
 			return 0, err
 		}
-		i += n48
+		i += n54
 	}
 	if m.DbId != 0 {
 		dAtA[i] = 0x10
@@ -3733,11 +4319,11 @@ func (m *GetColumnsResponse) MarshalTo(dAtA []byte) (int, error) {
 		dAtA[i] = 0xa
 		i++
 		i = encodeVarintMspb(dAtA, i, uint64(m.Header.Size()))
-		n49, err := m.Header.MarshalTo(dAtA[i:])
+		n55, err := m.Header.MarshalTo(dAtA[i:])
 		if err != nil {
 			return 0, err
 		}
-		i += n49
+		i += n55
 	}
 	if len(m.Columns) > 0 {
 		for _, msg := range m.Columns {
@@ -3773,11 +4359,11 @@ func (m *GetColumnByNameRequest) MarshalTo(dAtA []byte) (int, error) {
 		dAtA[i] = 0xa
 		i++
 		i = encodeVarintMspb(dAtA, i, uint64(m.Header.Size()))
-		n50, err := m.Header.MarshalTo(dAtA[i:])
+		n56, err := m.Header.MarshalTo(dAtA[i:])
 		if err != nil {
 			return 0, err
 		}
-		i += n50
+		i += n56
 	}
 	if m.DbId != 0 {
 		dAtA[i] = 0x10
@@ -3817,21 +4403,21 @@ func (m *GetColumnByNameResponse) MarshalTo(dAtA []byte) (int, error) {
 		dAtA[i] = 0xa
 		i++
 		i = encodeVarintMspb(dAtA, i, uint64(m.Header.Size()))
-		n51, err := m.Header.MarshalTo(dAtA[i:])
+		n57, err := m.Header.MarshalTo(dAtA[i:])
 		if err != nil {
 			return 0, err
 		}
-		i += n51
+		i += n57
 	}
 	if m.Column != nil {
 		dAtA[i] = 0x12
 		i++
 		i = encodeVarintMspb(dAtA, i, uint64(m.Column.Size()))
-		n52, err := m.Column.MarshalTo(dAtA[i:])
+		n58, err := m.Column.MarshalTo(dAtA[i:])
 		if err != nil {
 			return 0, err
 		}
-		i += n52
+		i += n58
 	}
 	return i, nil
 }
@@ -3855,11 +4441,11 @@ func (m *GetColumnByIdRequest) MarshalTo(dAtA []byte) (int, error) {
 		dAtA[i] = 0xa
 		i++
 		i = encodeVarintMspb(dAtA, i, uint64(m.Header.Size()))
-		n53, err := m.Header.MarshalTo(dAtA[i:])
+		n59, err := m.Header.MarshalTo(dAtA[i:])
 		if err != nil {
 			return 0, err
 		}
-		i += n53
+		i += n59
 	}
 	if m.DbId != 0 {
 		dAtA[i] = 0x10
@@ -3898,21 +4484,21 @@ func (m *GetColumnByIdResponse) MarshalTo(dAtA []byte) (int, error) {
 		dAtA[i] = 0xa
 		i++
 		i = encodeVarintMspb(dAtA, i, uint64(m.Header.Size()))
-		n54, err := m.Header.MarshalTo(dAtA[i:])
+		n60, err := m.Header.MarshalTo(dAtA[i:])
 		if err != nil {
 			return 0, err
 		}
-		i += n54
+		i += n60
 	}
 	if m.Column != nil {
 		dAtA[i] = 0x12
 		i++
 		i = encodeVarintMspb(dAtA, i, uint64(m.Column.Size()))
-		n55, err := m.Column.MarshalTo(dAtA[i:])
+		n61, err := m.Column.MarshalTo(dAtA[i:])
 		if err != nil {
 			return 0, err
 		}
-		i += n55
+		i += n61
 	}
 	return i, nil
 }
@@ -3936,11 +4522,11 @@ func (m *AddColumnRequest) MarshalTo(dAtA []byte) (int, error) {
 		dAtA[i] = 0xa
 		i++
 		i = encodeVarintMspb(dAtA, i, uint64(m.Header.Size()))
-		n56, err := m.Header.MarshalTo(dAtA[i:])
+		n62, err := m.Header.MarshalTo(dAtA[i:])
 		if err != nil {
 			return 0, err
 		}
-		i += n56
+		i += n62
 	}
 	if m.DbId != 0 {
 		dAtA[i] = 0x10
@@ -3986,11 +4572,11 @@ func (m *AddColumnResponse) MarshalTo(dAtA []byte) (int, error) {
 		dAtA[i] = 0xa
 		i++
 		i = encodeVarintMspb(dAtA, i, uint64(m.Header.Size()))
-		n57, err := m.Header.MarshalTo(dAtA[i:])
+		n63, err := m.Header.MarshalTo(dAtA[i:])
 		if err != nil {
 			return 0, err
 		}
-		i += n57
+		i += n63
 	}
 	if len(m.Columns) > 0 {
 		for _, msg := range m.Columns {
@@ -4026,11 +4612,11 @@ func (m *TruncateTableRequest) MarshalTo(dAtA []byte) (int, error) {
 		dAtA[i] = 0xa
 		i++
 		i = encodeVarintMspb(dAtA, i, uint64(m.Header.Size()))
-		n58, err := m.Header.MarshalTo(dAtA[i:])
+		n64, err := m.Header.MarshalTo(dAtA[i:])
 		if err != nil {
 			return 0, err
 		}
-		i += n58
+		i += n64
 	}
 	if m.DbId != 0 {
 		dAtA[i] = 0x10
@@ -4064,11 +4650,11 @@ func (m *TruncateTableResponse) MarshalTo(dAtA []byte) (int, error) {
 		dAtA[i] = 0xa
 		i++
 		i = encodeVarintMspb(dAtA, i, uint64(m.Header.Size()))
-		n59, err := m.Header.MarshalTo(dAtA[i:])
+		n65, err := m.Header.MarshalTo(dAtA[i:])
 		if err != nil {
 			return 0, err
 		}
-		i += n59
+		i += n65
 	}
 	return i, nil
 }
@@ -4092,11 +4678,11 @@ func (m *CreateDatabaseRequest) MarshalTo(dAtA []byte) (int, error) {
 		dAtA[i] = 0xa
 		i++
 		i = encodeVarintMspb(dAtA, i, uint64(m.Header.Size()))
-		n60, err := m.Header.MarshalTo(dAtA[i:])
+		n66, err := m.Header.MarshalTo(dAtA[i:])
 		if err != nil {
 			return 0, err
 		}
-		i += n60
+		i += n66
 	}
 	if len(m.DbName) > 0 {
 		dAtA[i] = 0x12
@@ -4126,11 +4712,11 @@ func (m *CreateDatabaseResponse) MarshalTo(dAtA []byte) (int, error) {
 		dAtA[i] = 0xa
 		i++
 		i = encodeVarintMspb(dAtA, i, uint64(m.Header.Size()))
-		n61, err := m.Header.MarshalTo(dAtA[i:])
+		n67, err := m.Header.MarshalTo(dAtA[i:])
 		if err != nil {
 			return 0, err
 		}
-		i += n61
+		i += n67
 	}
 	return i, nil
 }
@@ -4154,11 +4740,11 @@ func (m *CreateTableRequest) MarshalTo(dAtA []byte) (int, error) {
 		dAtA[i] = 0xa
 		i++
 		i = encodeVarintMspb(dAtA, i, uint64(m.Header.Size()))
-		n62, err := m.Header.MarshalTo(dAtA[i:])
+		n68, err := m.Header.MarshalTo(dAtA[i:])
 		if err != nil {
 			return 0, err
 		}
-		i += n62
+		i += n68
 	}
 	if len(m.DbName) > 0 {
 		dAtA[i] = 0x12
@@ -4200,11 +4786,11 @@ func (m *CreateTableResponse) MarshalTo(dAtA []byte) (int, error) {
 		dAtA[i] = 0xa
 		i++
 		i = encodeVarintMspb(dAtA, i, uint64(m.Header.Size()))
-		n63, err := m.Header.MarshalTo(dAtA[i:])
+		n69, err := m.Header.MarshalTo(dAtA[i:])
 		if err != nil {
 			return 0, err
 		}
-		i += n63
+		i += n69
 	}
 	return i, nil
 }
@@ -4228,11 +4814,11 @@ func (m *GetAutoIncIdRequest) MarshalTo(dAtA []byte) (int, error) {
 		dAtA[i] = 0xa
 		i++
 		i = encodeVarintMspb(dAtA, i, uint64(m.Header.Size()))
-		n64, err := m.Header.MarshalTo(dAtA[i:])
+		n70, err := m.Header.MarshalTo(dAtA[i:])
 		if err != nil {
 			return 0, err
 		}
-		i += n64
+		i += n70
 	}
 	if m.DbId != 0 {
 		dAtA[i] = 0x10
@@ -4271,28 +4857,28 @@ func (m *GetAutoIncIdResponse) MarshalTo(dAtA []byte) (int, error) {
 		dAtA[i] = 0xa
 		i++
 		i = encodeVarintMspb(dAtA, i, uint64(m.Header.Size()))
-		n65, err := m.Header.MarshalTo(dAtA[i:])
+		n71, err := m.Header.MarshalTo(dAtA[i:])
 		if err != nil {
 			return 0, err
 		}
-		i += n65
+		i += n71
 	}
 	if len(m.Ids) > 0 {
-		dAtA67 := make([]byte, len(m.Ids)*10)
-		var j66 int
+		dAtA73 := make([]byte, len(m.Ids)*10)
+		var j72 int
 		for _, num := range m.Ids {
 			for num >= 1<<7 {
-				dAtA67[j66] = uint8(uint64(num)&0x7f | 0x80)
+				dAtA73[j72] = uint8(uint64(num)&0x7f | 0x80)
 				num >>= 7
-				j66++
+				j72++
 			}
-			dAtA67[j66] = uint8(num)
-			j66++
+			dAtA73[j72] = uint8(num)
+			j72++
 		}
 		dAtA[i] = 0x12
 		i++
-		i = encodeVarintMspb(dAtA, i, uint64(j66))
-		i += copy(dAtA[i:], dAtA67[:j66])
+		i = encodeVarintMspb(dAtA, i, uint64(j72))
+		i += copy(dAtA[i:], dAtA73[:j72])
 	}
 	return i, nil
 }
@@ -4344,11 +4930,11 @@ func (m *ResponseHeader) MarshalTo(dAtA []byte) (int, error) {
 		dAtA[i] = 0x12
 		i++
 		i = encodeVarintMspb(dAtA, i, uint64(m.Error.Size()))
-		n68, err := m.Error.MarshalTo(dAtA[i:])
+		n74, err := m.Error.MarshalTo(dAtA[i:])
 		if err != nil {
 			return 0, err
 		}
-		i += n68
+		i += n74
 	}
 	return i, nil
 }
@@ -4419,21 +5005,21 @@ func (m *Error) MarshalTo(dAtA []byte) (int, error) {
 		dAtA[i] = 0x12
 		i++
 		i = encodeVarintMspb(dAtA, i, uint64(m.NewLeader.Size()))
-		n69, err := m.NewLeader.MarshalTo(dAtA[i:])
+		n75, err := m.NewLeader.MarshalTo(dAtA[i:])
 		if err != nil {
 			return 0, err
 		}
-		i += n69
+		i += n75
 	}
 	if m.NoLeader != nil {
 		dAtA[i] = 0x1a
 		i++
 		i = encodeVarintMspb(dAtA, i, uint64(m.NoLeader.Size()))
-		n70, err := m.NoLeader.MarshalTo(dAtA[i:])
+		n76, err := m.NoLeader.MarshalTo(dAtA[i:])
 		if err != nil {
 			return 0, err
 		}
-		i += n70
+		i += n76
 	}
 	return i, nil
 }
@@ -4586,6 +5172,55 @@ func (m *RangeHeartbeatResponse) Size() (n int) {
 	return n
 }
 
+func (m *BatchRangeHeartbeatRequest) Size() (n int) {
+	var l int
+	_ = l
+	if m.Header != nil {
+		l = m.Header.Size()
+		n += 1 + l + sovMspb(uint64(l))
+	}
+	if m.NodeId != 0 {
+		n += 1 + sovMspb(uint64(m.NodeId))
+	}
+	if len(m.Heartbeats) > 0 {
+		for _, e := range m.Heartbeats {
+			l = e.Size()
+			n += 1 + l + sovMspb(uint64(l))
+		}
+	}
+	if len(m.UnchangedRanges) > 0 {
+		l = 0
+		for _, e := range m.UnchangedRanges {
+			l += sovMspb(uint64(e))
+		}
+		n += 1 + sovMspb(uint64(l)) + l
+	}
+	return n
+}
+
+func (m *BatchRangeHeartbeatResponse) Size() (n int) {
+	var l int
+	_ = l
+	if m.Header != nil {
+		l = m.Header.Size()
+		n += 1 + l + sovMspb(uint64(l))
+	}
+	if len(m.Responses) > 0 {
+		for _, e := range m.Responses {
+			l = e.Size()
+			n += 1 + l + sovMspb(uint64(l))
+		}
+	}
+	if len(m.FullRequired) > 0 {
+		l = 0
+		for _, e := range m.FullRequired {
+			l += sovMspb(uint64(e))
+		}
+		n += 1 + sovMspb(uint64(l)) + l
+	}
+	return n
+}
+
 func (m *NodeStats) Size() (n int) {
 	var l int
 	_ = l
@@ -4634,6 +5269,72 @@ func (m *NodeStats) Size() (n int) {
 	if m.Start != 0 {
 		n += 1 + sovMspb(uint64(m.Start))
 	}
+	if m.CpuUsage != 0 {
+		n += 10
+	}
+	if m.ProcessCpuUsage != 0 {
+		n += 10
+	}
+	if m.CpuCount != 0 {
+		n += 2 + sovMspb(uint64(m.CpuCount))
+	}
+	if m.DiskUtil != 0 {
+		n += 10
+	}
+	if m.DiskReadLatencyMs != 0 {
+		n += 10
+	}
+	if m.DiskWriteLatencyMs != 0 {
+		n += 10
+	}
+	if m.DiskReadBytes != 0 {
+		n += 2 + sovMspb(uint64(m.DiskReadBytes))
+	}
+	if m.DiskWriteBytes != 0 {
+		n += 2 + sovMspb(uint64(m.DiskWriteBytes))
+	}
+	if m.NetInBytes != 0 {
+		n += 2 + sovMspb(uint64(m.NetInBytes))
+	}
+	if m.NetOutBytes != 0 {
+		n += 2 + sovMspb(uint64(m.NetOutBytes))
+	}
+	if m.PerfSamples != 0 {
+		n += 2 + sovMspb(uint64(m.PerfSamples))
+	}
+	if m.PerfBlockCacheHits != 0 {
+		n += 2 + sovMspb(uint64(m.PerfBlockCacheHits))
+	}
+	if m.PerfBlockReads != 0 {
+		n += 2 + sovMspb(uint64(m.PerfBlockReads))
+	}
+	if m.PerfBlockReadBytes != 0 {
+		n += 2 + sovMspb(uint64(m.PerfBlockReadBytes))
+	}
+	if m.PerfBlockReadNanos != 0 {
+		n += 2 + sovMspb(uint64(m.PerfBlockReadNanos))
+	}
+	if m.PerfMemtableNanos != 0 {
+		n += 2 + sovMspb(uint64(m.PerfMemtableNanos))
+	}
+	if m.PerfSstNanos != 0 {
+		n += 2 + sovMspb(uint64(m.PerfSstNanos))
+	}
+	if m.PerfIterSeekNanos != 0 {
+		n += 2 + sovMspb(uint64(m.PerfIterSeekNanos))
+	}
+	if m.PerfKeysSkipped != 0 {
+		n += 2 + sovMspb(uint64(m.PerfKeysSkipped))
+	}
+	if m.PerfDeletesSkipped != 0 {
+		n += 2 + sovMspb(uint64(m.PerfDeletesSkipped))
+	}
+	if m.PerfIoReadBytes != 0 {
+		n += 2 + sovMspb(uint64(m.PerfIoReadBytes))
+	}
+	if m.PerfIoReadNanos != 0 {
+		n += 2 + sovMspb(uint64(m.PerfIoReadNanos))
+	}
 	return n
 }
 
@@ -6347,7 +7048,7 @@ func (m *RangeHeartbeatResponse) Unmarshal(dAtA []byte) error {
 	}
 	return nil
 }
-func (m *NodeStats) Unmarshal(dAtA []byte) error {
+func (m *BatchRangeHeartbeatRequest) Unmarshal(dAtA []byte) error {
 	l := len(dAtA)
 	iNdEx := 0
 	for iNdEx < l {
@@ -6370,17 +7071,17 @@ func (m *NodeStats) Unmarshal(dAtA []byte) error {
 		fieldNum := int32(wire >> 3)
 		wireType := int(wire & 0x7)
 		if wireType == 4 {
-			return fmt.Errorf("proto: NodeStats: wiretype end group for non-group")
+			return fmt.Errorf("proto: BatchRangeHeartbeatRequest: wiretype end group for non-group")
 		}
 		if fieldNum <= 0 {
-			return fmt.Errorf("proto: NodeStats: illegal tag %d (wire type %d)", fieldNum, wire)
+			return fmt.Errorf("proto: BatchRangeHeartbeatRequest: illegal tag %d (wire type %d)", fieldNum, wire)
 		}
 		switch fieldNum {
 		case 1:
-			if wireType != 0 {
-				return fmt.Errorf("proto: wrong wireType = %d for field RangeCount", wireType)
+			if wireType != 2 {
+				return fmt.Errorf("proto: wrong wireType = %d for field Header", wireType)
 			}
-			m.RangeCount = 0
+			var msglen int
 			for shift := uint(0); ; shift += 7 {
 				if shift >= 64 {
 					return ErrIntOverflowMspb
@@ -6390,16 +7091,30 @@ func (m *NodeStats) Unmarshal(dAtA []byte) error {
 				}
 				b := dAtA[iNdEx]
 				iNdEx++
-				m.RangeCount |= (uint32(b) & 0x7F) << shift
+				msglen |= (int(b) & 0x7F) << shift
 				if b < 0x80 {
 					break
 				}
 			}
+			if msglen < 0 {
+				return ErrInvalidLengthMspb
+			}
+			postIndex := iNdEx + msglen
+			if postIndex > l {
+				return io.ErrUnexpectedEOF
+			}
+			if m.Header == nil {
+				m.Header = &RequestHeader{}
+			}
+			if err := m.Header.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
+				return err
+			}
+			iNdEx = postIndex
 		case 2:
 			if wireType != 0 {
-				return fmt.Errorf("proto: wrong wireType = %d for field RangeSplitCount", wireType)
+				return fmt.Errorf("proto: wrong wireType = %d for field NodeId", wireType)
 			}
-			m.RangeSplitCount = 0
+			m.NodeId = 0
 			for shift := uint(0); ; shift += 7 {
 				if shift >= 64 {
 					return ErrIntOverflowMspb
@@ -6409,16 +7124,16 @@ func (m *NodeStats) Unmarshal(dAtA []byte) error {
 				}
 				b := dAtA[iNdEx]
 				iNdEx++
-				m.RangeSplitCount |= (uint32(b) & 0x7F) << shift
+				m.NodeId |= (uint64(b) & 0x7F) << shift
 				if b < 0x80 {
 					break
 				}
 			}
 		case 3:
-			if wireType != 0 {
-				return fmt.Errorf("proto: wrong wireType = %d for field SendingSnapCount", wireType)
+			if wireType != 2 {
+				return fmt.Errorf("proto: wrong wireType = %d for field Heartbeats", wireType)
 			}
-			m.SendingSnapCount = 0
+			var msglen int
 			for shift := uint(0); ; shift += 7 {
 				if shift >= 64 {
 					return ErrIntOverflowMspb
@@ -6428,16 +7143,140 @@ func (m *NodeStats) Unmarshal(dAtA []byte) error {
 				}
 				b := dAtA[iNdEx]
 				iNdEx++
-				m.SendingSnapCount |= (uint32(b) & 0x7F) << shift
+				msglen |= (int(b) & 0x7F) << shift
 				if b < 0x80 {
 					break
 				}
 			}
+			if msglen < 0 {
+				return ErrInvalidLengthMspb
+			}
+			postIndex := iNdEx + msglen
+			if postIndex > l {
+				return io.ErrUnexpectedEOF
+			}
+			m.Heartbeats = append(m.Heartbeats, &RangeHeartbeatRequest{})
+			if err := m.Heartbeats[len(m.Heartbeats)-1].Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
+				return err
+			}
+			iNdEx = postIndex
 		case 4:
-			if wireType != 0 {
-				return fmt.Errorf("proto: wrong wireType = %d for field ReceivingSnapCount", wireType)
+			if wireType == 0 {
+				var v uint64
+				for shift := uint(0); ; shift += 7 {
+					if shift >= 64 {
+						return ErrIntOverflowMspb
+					}
+					if iNdEx >= l {
+						return io.ErrUnexpectedEOF
+					}
+					b := dAtA[iNdEx]
+					iNdEx++
+					v |= (uint64(b) & 0x7F) << shift
+					if b < 0x80 {
+						break
+					}
+				}
+				m.UnchangedRanges = append(m.UnchangedRanges, v)
+			} else if wireType == 2 {
+				var packedLen int
+				for shift := uint(0); ; shift += 7 {
+					if shift >= 64 {
+						return ErrIntOverflowMspb
+					}
+					if iNdEx >= l {
+						return io.ErrUnexpectedEOF
+					}
+					b := dAtA[iNdEx]
+					iNdEx++
+					packedLen |= (int(b) & 0x7F) << shift
+					if b < 0x80 {
+						break
+					}
+				}
+				if packedLen < 0 {
+					return ErrInvalidLengthMspb
+				}
+				postIndex := iNdEx + packedLen
+				if postIndex > l {
+					return io.ErrUnexpectedEOF
+				}
+				for iNdEx < postIndex {
+					var v uint64
+					for shift := uint(0); ; shift += 7 {
+						if shift >= 64 {
+							return ErrIntOverflowMspb
+						}
+						if iNdEx >= l {
+							return io.ErrUnexpectedEOF
+						}
+						b := dAtA[iNdEx]
+						iNdEx++
+						v |= (uint64(b) & 0x7F) << shift
+						if b < 0x80 {
+							break
+						}
+					}
+					m.UnchangedRanges = append(m.UnchangedRanges, v)
+				}
+			} else {
+				return fmt.Errorf("proto: wrong wireType = %d for field UnchangedRanges", wireType)
 			}
-			m.ReceivingSnapCount = 0
+		default:
+			iNdEx = preIndex
+			skippy, err := skipMspb(dAtA[iNdEx:])
+			if err != nil {
+				return err
+			}
+			if skippy < 0 {
+				return ErrInvalidLengthMspb
+			}
+			if (iNdEx + skippy) > l {
+				return io.ErrUnexpectedEOF
+			}
+			iNdEx += skippy
+		}
+	}
+
+	if iNdEx > l {
+		return io.ErrUnexpectedEOF
+	}
+	return nil
+}
+func (m *BatchRangeHeartbeatResponse) Unmarshal(dAtA []byte) error {
+	l := len(dAtA)
+	iNdEx := 0
+	for iNdEx < l {
+		preIndex := iNdEx
+		var wire uint64
+		for shift := uint(0); ; shift += 7 {
+			if shift >= 64 {
+				return ErrIntOverflowMspb
+			}
+			if iNdEx >= l {
+				return io.ErrUnexpectedEOF
+			}
+			b := dAtA[iNdEx]
+			iNdEx++
+			wire |= (uint64(b) & 0x7F) << shift
+			if b < 0x80 {
+				break
+			}
+		}
+		fieldNum := int32(wire >> 3)
+		wireType := int(wire & 0x7)
+		if wireType == 4 {
+			return fmt.Errorf("proto: BatchRangeHeartbeatResponse: wiretype end group for non-group")
+		}
+		if fieldNum <= 0 {
+			return fmt.Errorf("proto: BatchRangeHeartbeatResponse: illegal tag %d (wire type %d)", fieldNum, wire)
+		}
+		switch fieldNum {
+		case 1:
+			if wireType != 2 {
+				return fmt.Errorf("proto: wrong wireType = %d for field Header", wireType)
+			}
+			var msglen int
 			for shift := uint(0); ; shift += 7 {
 				if shift >= 64 {
 					return ErrIntOverflowMspb
@@ -6447,7 +7286,240 @@ func (m *NodeStats) Unmarshal(dAtA []byte) error {
 				}
 				b := dAtA[iNdEx]
 				iNdEx++
-				m.ReceivingSnapCount |= (uint32(b) & 0x7F) << shift
+				msglen |= (int(b) & 0x7F) << shift
+				if b < 0x80 {
+					break
+				}
+			}
+			if msglen < 0 {
+				return ErrInvalidLengthMspb
+			}
+			postIndex := iNdEx + msglen
+			if postIndex > l {
+				return io.ErrUnexpectedEOF
+			}
+			if m.Header == nil {
+				m.Header = &ResponseHeader{}
+			}
+			if err := m.Header.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
+				return err
+			}
+			iNdEx = postIndex
+		case 2:
+			if wireType != 2 {
+				return fmt.Errorf("proto: wrong wireType = %d for field Responses", wireType)
+			}
+			var msglen int
+			for shift := uint(0); ; shift += 7 {
+				if shift >= 64 {
+					return ErrIntOverflowMspb
+				}
+				if iNdEx >= l {
+					return io.ErrUnexpectedEOF
+				}
+				b := dAtA[iNdEx]
+				iNdEx++
+				msglen |= (int(b) & 0x7F) << shift
+				if b < 0x80 {
+					break
+				}
+			}
+			if msglen < 0 {
+				return ErrInvalidLengthMspb
+			}
+			postIndex := iNdEx + msglen
+			if postIndex > l {
+				return io.ErrUnexpectedEOF
+			}
+			m.Responses = append(m.Responses, &RangeHeartbeatResponse{})
+			if err := m.Responses[len(m.Responses)-1].Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
+				return err
+			}
+			iNdEx = postIndex
+		case 3:
+			if wireType == 0 {
+				var v uint64
+				for shift := uint(0); ; shift += 7 {
+					if shift >= 64 {
+						return ErrIntOverflowMspb
+					}
+					if iNdEx >= l {
+						return io.ErrUnexpectedEOF
+					}
+					b := dAtA[iNdEx]
+					iNdEx++
+					v |= (uint64(b) & 0x7F) << shift
+					if b < 0x80 {
+						break
+					}
+				}
+				m.FullRequired = append(m.FullRequired, v)
+			} else if wireType == 2 {
+				var packedLen int
+				for shift := uint(0); ; shift += 7 {
+					if shift >= 64 {
+						return ErrIntOverflowMspb
+					}
+					if iNdEx >= l {
+						return io.ErrUnexpectedEOF
+					}
+					b := dAtA[iNdEx]
+					iNdEx++
+					packedLen |= (int(b) & 0x7F) << shift
+					if b < 0x80 {
+						break
+					}
+				}
+				if packedLen < 0 {
+					return ErrInvalidLengthMspb
+				}
+				postIndex := iNdEx + packedLen
+				if postIndex > l {
+					return io.ErrUnexpectedEOF
+				}
+				for iNdEx < postIndex {
+					var v uint64
+					for shift := uint(0); ; shift += 7 {
+						if shift >= 64 {
+							return ErrIntOverflowMspb
+						}
+						if iNdEx >= l {
+							return io.ErrUnexpectedEOF
+						}
+						b := dAtA[iNdEx]
+						iNdEx++
+						v |= (uint64(b) & 0x7F) << shift
+						if b < 0x80 {
+							break
+						}
+					}
+					m.FullRequired = append(m.FullRequired, v)
+				}
+			} else {
+				return fmt.Errorf("proto: wrong wireType = %d for field FullRequired", wireType)
+			}
+		default:
+			iNdEx = preIndex
+			skippy, err := skipMspb(dAtA[iNdEx:])
+			if err != nil {
+				return err
+			}
+			if skippy < 0 {
+				return ErrInvalidLengthMspb
+			}
+			if (iNdEx + skippy) > l {
+				return io.ErrUnexpectedEOF
+			}
+			iNdEx += skippy
+		}
+	}
+
+	if iNdEx > l {
+		return io.ErrUnexpectedEOF
+	}
+	return nil
+}
+func (m *NodeStats) Unmarshal(dAtA []byte) error {
+	l := len(dAtA)
+	iNdEx := 0
+	for iNdEx < l {
+		preIndex := iNdEx
+		var wire uint64
+		for shift := uint(0); ; shift += 7 {
+			if shift >= 64 {
+				return ErrIntOverflowMspb
+			}
+			if iNdEx >= l {
+				return io.ErrUnexpectedEOF
+			}
+			b := dAtA[iNdEx]
+			iNdEx++
+			wire |= (uint64(b) & 0x7F) << shift
+			if b < 0x80 {
+				break
+			}
+		}
+		fieldNum := int32(wire >> 3)
+		wireType := int(wire & 0x7)
+		if wireType == 4 {
+			return fmt.Errorf("proto: NodeStats: wiretype end group for non-group")
+		}
+		if fieldNum <= 0 {
+			return fmt.Errorf("proto: NodeStats: illegal tag %d (wire type %d)", fieldNum, wire)
+		}
+		switch fieldNum {
+		case 1:
+			if wireType != 0 {
+				return fmt.Errorf("proto: wrong wireType = %d for field RangeCount", wireType)
+			}
+			m.RangeCount = 0
+			for shift := uint(0); ; shift += 7 {
+				if shift >= 64 {
+					return ErrIntOverflowMspb
+				}
+				if iNdEx >= l {
+					return io.ErrUnexpectedEOF
+				}
+				b := dAtA[iNdEx]
+				iNdEx++
+				m.RangeCount |= (uint32(b) & 0x7F) << shift
+				if b < 0x80 {
+					break
+				}
+			}
+		case 2:
+			if wireType != 0 {
+				return fmt.Errorf("proto: wrong wireType = %d for field RangeSplitCount", wireType)
+			}
+			m.RangeSplitCount = 0
+			for shift := uint(0); ; shift += 7 {
+				if shift >= 64 {
+					return ErrIntOverflowMspb
+				}
+				if iNdEx >= l {
+					return io.ErrUnexpectedEOF
+				}
+				b := dAtA[iNdEx]
+				iNdEx++
+				m.RangeSplitCount |= (uint32(b) & 0x7F) << shift
+				if b < 0x80 {
+					break
+				}
+			}
+		case 3:
+			if wireType != 0 {
+				return fmt.Errorf("proto: wrong wireType = %d for field SendingSnapCount", wireType)
+			}
+			m.SendingSnapCount = 0
+			for shift := uint(0); ; shift += 7 {
+				if shift >= 64 {
+					return ErrIntOverflowMspb
+				}
+				if iNdEx >= l {
+					return io.ErrUnexpectedEOF
+				}
+				b := dAtA[iNdEx]
+				iNdEx++
+				m.SendingSnapCount |= (uint32(b) & 0x7F) << shift
+				if b < 0x80 {
+					break
+				}
+			}
+		case 4:
+			if wireType != 0 {
+				return fmt.Errorf("proto: wrong wireType = %d for field ReceivingSnapCount", wireType)
+			}
+			m.ReceivingSnapCount = 0
+			for shift := uint(0); ; shift += 7 {
+				if shift >= 64 {
+					return ErrIntOverflowMspb
+				}
+				if iNdEx >= l {
+					return io.ErrUnexpectedEOF
+				}
+				b := dAtA[iNdEx]
+				iNdEx++
+				m.ReceivingSnapCount |= (uint32(b) & 0x7F) << shift
 				if b < 0x80 {
 					break
 				}
@@ -6662,6 +7734,384 @@ func (m *NodeStats) Unmarshal(dAtA []byte) error {
 					break
 				}
 			}
+		case 16:
+			if wireType != 1 {
+				return fmt.Errorf("proto: wrong wireType = %d for field CpuUsage", wireType)
+			}
+			var v uint64
+			if (iNdEx + 8) > l {
+				return io.ErrUnexpectedEOF
+			}
+			v = uint64(binary.LittleEndian.Uint64(dAtA[iNdEx:]))
+			iNdEx += 8
+			m.CpuUsage = float64(math.Float64frombits(v))
+		case 17:
+			if wireType != 1 {
+				return fmt.Errorf("proto: wrong wireType = %d for field ProcessCpuUsage", wireType)
+			}
+			var v uint64
+			if (iNdEx + 8) > l {
+				return io.ErrUnexpectedEOF
+			}
+			v = uint64(binary.LittleEndian.Uint64(dAtA[iNdEx:]))
+			iNdEx += 8
+			m.ProcessCpuUsage = float64(math.Float64frombits(v))
+		case 18:
+			if wireType != 0 {
+				return fmt.Errorf("proto: wrong wireType = %d for field CpuCount", wireType)
+			}
+			m.CpuCount = 0
+			for shift := uint(0); ; shift += 7 {
+				if shift >= 64 {
+					return ErrIntOverflowMspb
+				}
+				if iNdEx >= l {
+					return io.ErrUnexpectedEOF
+				}
+				b := dAtA[iNdEx]
+				iNdEx++
+				m.CpuCount |= (uint32(b) & 0x7F) << shift
+				if b < 0x80 {
+					break
+				}
+			}
+		case 19:
+			if wireType != 1 {
+				return fmt.Errorf("proto: wrong wireType = %d for field DiskUtil", wireType)
+			}
+			var v uint64
+			if (iNdEx + 8) > l {
+				return io.ErrUnexpectedEOF
+			}
+			v = uint64(binary.LittleEndian.Uint64(dAtA[iNdEx:]))
+			iNdEx += 8
+			m.DiskUtil = float64(math.Float64frombits(v))
+		case 20:
+			if wireType != 1 {
+				return fmt.Errorf("proto: wrong wireType = %d for field DiskReadLatencyMs", wireType)
+			}
+			var v uint64
+			if (iNdEx + 8) > l {
+				return io.ErrUnexpectedEOF
+			}
+			v = uint64(binary.LittleEndian.Uint64(dAtA[iNdEx:]))
+			iNdEx += 8
+			m.DiskReadLatencyMs = float64(math.Float64frombits(v))
+		case 21:
+			if wireType != 1 {
+				return fmt.Errorf("proto: wrong wireType = %d for field DiskWriteLatencyMs", wireType)
+			}
+			var v uint64
+			if (iNdEx + 8) > l {
+				return io.ErrUnexpectedEOF
+			}
+			v = uint64(binary.LittleEndian.Uint64(dAtA[iNdEx:]))
+			iNdEx += 8
+			m.DiskWriteLatencyMs = float64(math.Float64frombits(v))
+		case 22:
+			if wireType != 0 {
+				return fmt.Errorf("proto: wrong wireType = %d for field DiskReadBytes", wireType)
+			}
+			m.DiskReadBytes = 0
+			for shift := uint(0); ; shift += 7 {
+				if shift >= 64 {
+					return ErrIntOverflowMspb
+				}
+				if iNdEx >= l {
+					return io.ErrUnexpectedEOF
+				}
+				b := dAtA[iNdEx]
+				iNdEx++
+				m.DiskReadBytes |= (uint64(b) & 0x7F) << shift
+				if b < 0x80 {
+					break
+				}
+			}
+		case 23:
+			if wireType != 0 {
+				return fmt.Errorf("proto: wrong wireType = %d for field DiskWriteBytes", wireType)
+			}
+			m.DiskWriteBytes = 0
+			for shift := uint(0); ; shift += 7 {
+				if shift >= 64 {
+					return ErrIntOverflowMspb
+				}
+				if iNdEx >= l {
+					return io.ErrUnexpectedEOF
+				}
+				b := dAtA[iNdEx]
+				iNdEx++
+				m.DiskWriteBytes |= (uint64(b) & 0x7F) << shift
+				if b < 0x80 {
+					break
+				}
+			}
+		case 24:
+			if wireType != 0 {
+				return fmt.Errorf("proto: wrong wireType = %d for field NetInBytes", wireType)
+			}
+			m.NetInBytes = 0
+			for shift := uint(0); ; shift += 7 {
+				if shift >= 64 {
+					return ErrIntOverflowMspb
+				}
+				if iNdEx >= l {
+					return io.ErrUnexpectedEOF
+				}
+				b := dAtA[iNdEx]
+				iNdEx++
+				m.NetInBytes |= (uint64(b) & 0x7F) << shift
+				if b < 0x80 {
+					break
+				}
+			}
+		case 25:
+			if wireType != 0 {
+				return fmt.Errorf("proto: wrong wireType = %d for field NetOutBytes", wireType)
+			}
+			m.NetOutBytes = 0
+			for shift := uint(0); ; shift += 7 {
+				if shift >= 64 {
+					return ErrIntOverflowMspb
+				}
+				if iNdEx >= l {
+					return io.ErrUnexpectedEOF
+				}
+				b := dAtA[iNdEx]
+				iNdEx++
+				m.NetOutBytes |= (uint64(b) & 0x7F) << shift
+				if b < 0x80 {
+					break
+				}
+			}
+		case 26:
+			if wireType != 0 {
+				return fmt.Errorf("proto: wrong wireType = %d for field PerfSamples", wireType)
+			}
+			m.PerfSamples = 0
+			for shift := uint(0); ; shift += 7 {
+				if shift >= 64 {
+					return ErrIntOverflowMspb
+				}
+				if iNdEx >= l {
+					return io.ErrUnexpectedEOF
+				}
+				b := dAtA[iNdEx]
+				iNdEx++
+				m.PerfSamples |= (uint64(b) & 0x7F) << shift
+				if b < 0x80 {
+					break
+				}
+			}
+		case 27:
+			if wireType != 0 {
+				return fmt.Errorf("proto: wrong wireType = %d for field PerfBlockCacheHits", wireType)
+			}
+			m.PerfBlockCacheHits = 0
+			for shift := uint(0); ; shift += 7 {
+				if shift >= 64 {
+					return ErrIntOverflowMspb
+				}
+				if iNdEx >= l {
+					return io.ErrUnexpectedEOF
+				}
+				b := dAtA[iNdEx]
+				iNdEx++
+				m.PerfBlockCacheHits |= (uint64(b) & 0x7F) << shift
+				if b < 0x80 {
+					break
+				}
+			}
+		case 28:
+			if wireType != 0 {
+				return fmt.Errorf("proto: wrong wireType = %d for field PerfBlockReads", wireType)
+			}
+			m.PerfBlockReads = 0
+			for shift := uint(0); ; shift += 7 {
+				if shift >= 64 {
+					return ErrIntOverflowMspb
+				}
+				if iNdEx >= l {
+					return io.ErrUnexpectedEOF
+				}
+				b := dAtA[iNdEx]
+				iNdEx++
+				m.PerfBlockReads |= (uint64(b) & 0x7F) << shift
+				if b < 0x80 {
+					break
+				}
+			}
+		case 29:
+			if wireType != 0 {
+				return fmt.Errorf("proto: wrong wireType = %d for field PerfBlockReadBytes", wireType)
+			}
+			m.PerfBlockReadBytes = 0
+			for shift := uint(0); ; shift += 7 {
+				if shift >= 64 {
+					return ErrIntOverflowMspb
+				}
+				if iNdEx >= l {
+					return io.ErrUnexpectedEOF
+				}
+				b := dAtA[iNdEx]
+				iNdEx++
+				m.PerfBlockReadBytes |= (uint64(b) & 0x7F) << shift
+				if b < 0x80 {
+					break
+				}
+			}
+		case 30:
+			if wireType != 0 {
+				return fmt.Errorf("proto: wrong wireType = %d for field PerfBlockReadNanos", wireType)
+			}
+			m.PerfBlockReadNanos = 0
+			for shift := uint(0); ; shift += 7 {
+				if shift >= 64 {
+					return ErrIntOverflowMspb
+				}
+				if iNdEx >= l {
+					return io.ErrUnexpectedEOF
+				}
+				b := dAtA[iNdEx]
+				iNdEx++
+				m.PerfBlockReadNanos |= (uint64(b) & 0x7F) << shift
+				if b < 0x80 {
+					break
+				}
+			}
+		case 31:
+			if wireType != 0 {
+				return fmt.Errorf("proto: wrong wireType = %d for field PerfMemtableNanos", wireType)
+			}
+			m.PerfMemtableNanos = 0
+			for shift := uint(0); ; shift += 7 {
+				if shift >= 64 {
+					return ErrIntOverflowMspb
+				}
+				if iNdEx >= l {
+					return io.ErrUnexpectedEOF
+				}
+				b := dAtA[iNdEx]
+				iNdEx++
+				m.PerfMemtableNanos |= (uint64(b) & 0x7F) << shift
+				if b < 0x80 {
+					break
+				}
+			}
+		case 32:
+			if wireType != 0 {
+				return fmt.Errorf("proto: wrong wireType = %d for field PerfSstNanos", wireType)
+			}
+			m.PerfSstNanos = 0
+			for shift := uint(0); ; shift += 7 {
+				if shift >= 64 {
+					return ErrIntOverflowMspb
+				}
+				if iNdEx >= l {
+					return io.ErrUnexpectedEOF
+				}
+				b := dAtA[iNdEx]
+				iNdEx++
+				m.PerfSstNanos |= (uint64(b) & 0x7F) << shift
+				if b < 0x80 {
+					break
+				}
+			}
+		case 33:
+			if wireType != 0 {
+				return fmt.Errorf("proto: wrong wireType = %d for field PerfIterSeekNanos", wireType)
+			}
+			m.PerfIterSeekNanos = 0
+			for shift := uint(0); ; shift += 7 {
+				if shift >= 64 {
+					return ErrIntOverflowMspb
+				}
+				if iNdEx >= l {
+					return io.ErrUnexpectedEOF
+				}
+				b := dAtA[iNdEx]
+				iNdEx++
+				m.PerfIterSeekNanos |= (uint64(b) & 0x7F) << shift
+				if b < 0x80 {
+					break
+				}
+			}
+		case 34:
+			if wireType != 0 {
+				return fmt.Errorf("proto: wrong wireType = %d for field PerfKeysSkipped", wireType)
+			}
+			m.PerfKeysSkipped = 0
+			for shift := uint(0); ; shift += 7 {
+				if shift >= 64 {
+					return ErrIntOverflowMspb
+				}
+				if iNdEx >= l {
+					return io.ErrUnexpectedEOF
+				}
+				b := dAtA[iNdEx]
+				iNdEx++
+				m.PerfKeysSkipped |= (uint64(b) & 0x7F) << shift
+				if b < 0x80 {
+					break
+				}
+			}
+		case 35:
+			if wireType != 0 {
+				return fmt.Errorf("proto: wrong wireType = %d for field PerfDeletesSkipped", wireType)
+			}
+			m.PerfDeletesSkipped = 0
+			for shift := uint(0); ; shift += 7 {
+				if shift >= 64 {
+					return ErrIntOverflowMspb
+				}
+				if iNdEx >= l {
+					return io.ErrUnexpectedEOF
+				}
+				b := dAtA[iNdEx]
+				iNdEx++
+				m.PerfDeletesSkipped |= (uint64(b) & 0x7F) << shift
+				if b < 0x80 {
+					break
+				}
+			}
+		case 36:
+			if wireType != 0 {
+				return fmt.Errorf("proto: wrong wireType = %d for field PerfIoReadBytes", wireType)
+			}
+			m.PerfIoReadBytes = 0
+			for shift := uint(0); ; shift += 7 {
+				if shift >= 64 {
+					return ErrIntOverflowMspb
+				}
+				if iNdEx >= l {
+					return io.ErrUnexpectedEOF
+				}
+				b := dAtA[iNdEx]
+				iNdEx++
+				m.PerfIoReadBytes |= (uint64(b) & 0x7F) << shift
+				if b < 0x80 {
+					break
+				}
+			}
+		case 37:
+			if wireType != 0 {
+				return fmt.Errorf("proto: wrong wireType = %d for field PerfIoReadNanos", wireType)
+			}
+			m.PerfIoReadNanos = 0
+			for shift := uint(0); ; shift += 7 {
+				if shift >= 64 {
+					return ErrIntOverflowMspb
+				}
+				if iNdEx >= l {
+					return io.ErrUnexpectedEOF
+				}
+				b := dAtA[iNdEx]
+				iNdEx++
+				m.PerfIoReadNanos |= (uint64(b) & 0x7F) << shift
+				if b < 0x80 {
+					break
+				}
+			}
 		default:
 			iNdEx = preIndex
 			skippy, err := skipMspb(dAtA[iNdEx:])
@@ -11836,132 +13286,163 @@ var (
 func init() { proto.RegisterFile("mspb.proto", fileDescriptorMspb) }
 
 var fileDescriptorMspb = []byte{
-	// 2029 bytes of a gzipped FileDescriptorProto
-	0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xbc, 0x59, 0xcd, 0x72, 0x1c, 0x49,
-	0x11, 0x76, 0xcf, 0xf4, 0xfc, 0xe5, 0x8c, 0xa4, 0x51, 0xe9, 0xc7, 0xe3, 0xb1, 0xad, 0x95, 0x6b,
-	0xd9, 0x45, 0x60, 0xa3, 0x25, 0xbc, 0x17, 0x02, 0x22, 0x88, 0x90, 0x6c, 0x23, 0x6b, 0x59, 0x1b,
-	0x47, 0xcb, 0x01, 0x5c, 0x88, 0x89, 0x9a, 0xe9, 0x5a, 0xb9, 0x43, 0x33, 0xdd, 0x4d, 0x57, 0x8d,
-	0xb4, 0xb3, 0xa7, 0x3d, 0x41, 0xc0, 0x89, 0x23, 0x7b, 0x23, 0x82, 0x17, 0xe0, 0xc4, 0x85, 0x3b,
-	0xc1, 0x91, 0x07, 0xe0, 0x40, 0x98, 0x1b, 0x4f, 0x41, 0x54, 0x56, 0x55, 0xff, 0xcd, 0x2c, 0xb0,
-	0xbd, 0xb6, 0x6e, 0xdd, 0x99, 0x59, 0xd9, 0x5f, 0x66, 0x65, 0x66, 0x55, 0x66, 0x03, 0xcc, 0x44,
-	0x3c, 0x3e, 0x8c, 0x93, 0x48, 0x46, 0xc4, 0x55, 0xcf, 0xc3, 0xde, 0x8c, 0x4b, 0x66, 0x69, 0xc3,
-	0x9e, 0x64, 0xe2, 0x22, 0x7d, 0xdb, 0x3e, 0x8f, 0xce, 0x23, 0x7c, 0xfc, 0x40, 0x3d, 0x69, 0x2a,
-	0x7d, 0x0a, 0xed, 0x67, 0x67, 0x1f, 0x73, 0xe6, 0xf3, 0x84, 0xac, 0x43, 0x2d, 0xf0, 0x07, 0xce,
-	0xbe, 0x73, 0xe0, 0x7a, 0xb5, 0xc0, 0x27, 0x03, 0x68, 0x31, 0xdf, 0x4f, 0xb8, 0x10, 0x83, 0xda,
-	0xbe, 0x73, 0xd0, 0xf1, 0xec, 0x2b, 0x21, 0xe0, 0x4a, 0x9e, 0xcc, 0x06, 0x75, 0x94, 0xc5, 0x67,
-	0x7a, 0x04, 0xe4, 0x84, 0x4b, 0xab, 0xcc, 0xe3, 0xbf, 0x9c, 0x73, 0x21, 0xc9, 0x7d, 0x68, 0xbe,
-	0x42, 0x02, 0xea, 0xed, 0x3e, 0xdc, 0x3a, 0x44, 0xd0, 0x86, 0xfd, 0x54, 0xcb, 0x1a, 0x11, 0x7a,
-	0x01, 0x5b, 0x05, 0x15, 0x22, 0x8e, 0x42, 0xc1, 0xc9, 0x83, 0x92, 0x8e, 0x6d, 0xab, 0x43, 0xf3,
-	0x8b, 0x4a, 0xc8, 0xfb, 0xd0, 0x9c, 0x6a, 0xe9, 0x1a, 0x4a, 0xaf, 0x6b, 0xe9, 0x54, 0xab, 0xe1,
-	0xd2, 0x3f, 0x3a, 0x00, 0x2f, 0x38, 0x4f, 0xce, 0x24, 0x93, 0x73, 0x41, 0xf6, 0xc1, 0x8d, 0x79,
-	0xfa, 0x89, 0xde, 0xa1, 0xf1, 0xa4, 0x92, 0xf0, 0x90, 0x43, 0xb6, 0xa1, 0x11, 0x84, 0x3e, 0xff,
-	0x14, 0xf5, 0xba, 0x9e, 0x7e, 0x21, 0xbb, 0xd0, 0x9c, 0x44, 0xb3, 0x59, 0x20, 0x8d, 0x33, 0xcc,
-	0x1b, 0xb9, 0x07, 0x3d, 0x3f, 0xba, 0x0a, 0x47, 0x82, 0x4f, 0xa2, 0xd0, 0x17, 0x03, 0x17, 0xb9,
-	0x5d, 0x45, 0x3b, 0xd3, 0x24, 0x42, 0xa1, 0x27, 0x42, 0x16, 0x8b, 0x57, 0x91, 0x94, 0x41, 0x78,
-	0x3e, 0x68, 0xec, 0x3b, 0x07, 0x6d, 0xaf, 0x40, 0xa3, 0x7f, 0x71, 0x00, 0x3c, 0x16, 0x9e, 0x73,
-	0x05, 0x53, 0x90, 0x77, 0x61, 0x6d, 0xbc, 0x90, 0x5c, 0x8c, 0xae, 0x92, 0x40, 0x4a, 0x1e, 0x9a,
-	0xdd, 0xea, 0x21, 0xf1, 0x67, 0x9a, 0x46, 0xee, 0x02, 0x68, 0xa1, 0x84, 0x33, 0xdf, 0xa0, 0xed,
-	0x20, 0xc5, 0xe3, 0xcc, 0x57, 0xc8, 0x2e, 0xf8, 0x22, 0x53, 0xa1, 0x71, 0x77, 0x15, 0xcd, 0x6a,
-	0xb8, 0x0d, 0x1d, 0x14, 0x41, 0x05, 0x1a, 0x79, 0x5b, 0x11, 0x70, 0xfd, 0xb7, 0xa0, 0xcf, 0xe2,
-	0x38, 0x89, 0x3e, 0x0d, 0x66, 0x4c, 0xf2, 0x91, 0x08, 0x3e, 0xe3, 0x08, 0xdd, 0xf5, 0x36, 0x72,
-	0xf4, 0xb3, 0xe0, 0x33, 0x4e, 0x3f, 0xaf, 0xc1, 0x0e, 0xa2, 0x7f, 0xca, 0x59, 0x22, 0xc7, 0x9c,
-	0xc9, 0x2a, 0x71, 0x41, 0xde, 0x85, 0x46, 0xa2, 0xb4, 0x98, 0x1d, 0x5d, 0xb3, 0x9b, 0x83, 0xaa,
-	0x3d, 0xcd, 0x23, 0xdf, 0x48, 0xf7, 0xbd, 0xbe, 0x62, 0x0b, 0x0d, 0x8f, 0xbc, 0x0f, 0x0d, 0xa1,
-	0x3c, 0x39, 0x68, 0xa2, 0x50, 0xdf, 0x7c, 0x36, 0xf5, 0xb0, 0xa7, 0xd9, 0x69, 0x84, 0xb7, 0xb2,
-	0x08, 0x27, 0x1f, 0x42, 0x4f, 0x05, 0x82, 0x18, 0x09, 0x0c, 0x99, 0x41, 0x7b, 0xbf, 0x9e, 0xa9,
-	0xc8, 0x42, 0xc9, 0xeb, 0xa2, 0x94, 0x7e, 0xa1, 0xff, 0x70, 0x60, 0xb7, 0xec, 0x82, 0x4a, 0x71,
-	0x7d, 0x0b, 0xda, 0x68, 0xe8, 0x28, 0xb0, 0x7b, 0xda, 0xc2, 0xf7, 0x53, 0x9f, 0x1c, 0x40, 0x83,
-	0xc7, 0xd1, 0xe4, 0x95, 0xb1, 0x9c, 0x14, 0xfc, 0xf3, 0x44, 0x71, 0x3c, 0x2d, 0x40, 0xbe, 0x03,
-	0x5d, 0xc9, 0x92, 0x73, 0x2e, 0x47, 0x18, 0xec, 0xee, 0x0a, 0x4f, 0x81, 0x16, 0x50, 0xcf, 0x2a,
-	0x29, 0x54, 0x0d, 0xc1, 0xed, 0x55, 0x72, 0xa6, 0xa0, 0xbc, 0x64, 0xe2, 0xc2, 0x43, 0x0e, 0xfd,
-	0x83, 0x0b, 0x9d, 0xe7, 0x91, 0x6f, 0xc2, 0xf3, 0x1d, 0xe8, 0x6a, 0x8c, 0x93, 0x68, 0x1e, 0x4a,
-	0x34, 0x6b, 0xcd, 0x03, 0x24, 0x3d, 0x52, 0x14, 0xf2, 0x6d, 0xd8, 0xd4, 0x02, 0x22, 0x9e, 0x06,
-	0xd2, 0x88, 0xd5, 0x50, 0x6c, 0x03, 0x19, 0x67, 0x8a, 0xae, 0x65, 0x1f, 0x00, 0x11, 0x3c, 0xf4,
-	0x83, 0xf0, 0x7c, 0xa4, 0x52, 0xc2, 0x08, 0xd7, 0x51, 0xb8, 0x6f, 0x38, 0x67, 0x21, 0x8b, 0xb5,
-	0xf4, 0x77, 0x61, 0x3b, 0xe1, 0x13, 0x1e, 0x5c, 0x96, 0xe4, 0x5d, 0x94, 0x27, 0x29, 0x2f, 0x5b,
-	0x71, 0x08, 0x5b, 0x2c, 0x8e, 0xa7, 0x8b, 0xd2, 0x82, 0x06, 0x2e, 0xd8, 0xb4, 0xac, 0x4c, 0xfe,
-	0x01, 0x10, 0x8d, 0x5d, 0x87, 0x92, 0x11, 0x6f, 0x6a, 0x3c, 0xc8, 0xd1, 0x15, 0x46, 0x4b, 0x0f,
-	0xa1, 0x3d, 0x61, 0x31, 0x9b, 0x04, 0x72, 0x61, 0x82, 0x28, 0x7d, 0x57, 0xe9, 0x35, 0x17, 0xdc,
-	0xd7, 0xa9, 0xd3, 0xd6, 0x4c, 0x45, 0x50, 0x39, 0x43, 0xee, 0x40, 0x87, 0x5d, 0xb2, 0x60, 0xca,
-	0xc6, 0x53, 0x3e, 0xe8, 0xe8, 0xe4, 0x4d, 0x09, 0xcb, 0x05, 0x00, 0x56, 0x14, 0x80, 0x72, 0x86,
-	0x77, 0x97, 0x33, 0xbc, 0x58, 0x23, 0x7a, 0xe5, 0x1a, 0x51, 0x28, 0x00, 0x6b, 0xa5, 0x02, 0x70,
-	0x13, 0x5a, 0x81, 0x18, 0x8d, 0xe7, 0x62, 0x31, 0x58, 0xc7, 0x92, 0xd5, 0x0c, 0xc4, 0xf1, 0x5c,
-	0x2c, 0x54, 0x85, 0x14, 0x92, 0x25, 0x72, 0xb0, 0x81, 0x4e, 0xd1, 0x2f, 0xf4, 0x4f, 0x0e, 0x6c,
-	0xab, 0x10, 0xf9, 0x7a, 0x35, 0xe0, 0x26, 0xb4, 0xc2, 0xc8, 0xcf, 0x45, 0x7f, 0x53, 0xbd, 0x9e,
-	0xfa, 0xe4, 0x3d, 0x9b, 0xd1, 0x3a, 0xf8, 0x37, 0xb4, 0x92, 0x34, 0x26, 0x6d, 0x42, 0xdf, 0x87,
-	0xcd, 0x40, 0x44, 0x53, 0x26, 0xb9, 0x3f, 0x4a, 0x78, 0x3c, 0x0d, 0x26, 0x4c, 0x15, 0xe5, 0xfa,
-	0x81, 0xeb, 0xf5, 0x2d, 0xc3, 0x33, 0x74, 0xfa, 0x6b, 0x07, 0x76, 0x4a, 0x90, 0x2b, 0xe5, 0xec,
-	0x97, 0x82, 0xfe, 0x26, 0x6c, 0xf8, 0x7c, 0xca, 0x25, 0xcf, 0xb0, 0xd4, 0x11, 0xcb, 0xba, 0x26,
-	0xa7, 0x48, 0x3e, 0x77, 0x60, 0xe3, 0x48, 0x5c, 0x60, 0x5a, 0xbc, 0xbd, 0xda, 0x79, 0x1b, 0x3a,
-	0x3a, 0x21, 0x2f, 0xf8, 0x02, 0xfd, 0xd8, 0xf3, 0xda, 0x48, 0xf8, 0x31, 0x5f, 0xd0, 0xbf, 0x3a,
-	0xd0, 0xcf, 0x20, 0x54, 0xf2, 0xc3, 0xff, 0x05, 0x62, 0x1f, 0x7a, 0x21, 0xbf, 0x1a, 0xa5, 0x45,
-	0x4e, 0x9f, 0x4b, 0x10, 0xf2, 0x2b, 0xcf, 0xd4, 0x39, 0x23, 0xa1, 0x4a, 0xd7, 0x28, 0xf0, 0xed,
-	0xf6, 0x29, 0x09, 0x55, 0xad, 0x4e, 0x7d, 0x51, 0x34, 0xa4, 0x51, 0x32, 0xe4, 0x37, 0x0e, 0x10,
-	0x8f, 0xc7, 0x51, 0x22, 0xab, 0xbb, 0xf3, 0x1e, 0xb8, 0x53, 0xfe, 0x89, 0x5c, 0x6d, 0x08, 0xb2,
-	0xd0, 0xd8, 0xe0, 0xfc, 0x95, 0x34, 0x01, 0xb9, 0x64, 0xac, 0xe2, 0xd1, 0x47, 0xb0, 0x55, 0x80,
-	0x52, 0xc5, 0xad, 0xf4, 0xe7, 0xd0, 0x57, 0x51, 0xfa, 0x71, 0x74, 0x1e, 0x84, 0x6f, 0x34, 0xa9,
-	0xe8, 0x11, 0x6c, 0xe6, 0x34, 0x57, 0x02, 0xf7, 0x67, 0x07, 0xfa, 0x27, 0x5c, 0x3e, 0x47, 0x85,
-	0x95, 0xd0, 0xbd, 0x03, 0x5d, 0xc1, 0x93, 0x4b, 0x9e, 0x8c, 0x94, 0xa3, 0xcc, 0x31, 0x01, 0x9a,
-	0xf4, 0x22, 0x4a, 0xa4, 0xda, 0xed, 0x84, 0x7d, 0x22, 0x35, 0x5b, 0x1f, 0x0c, 0x6d, 0x45, 0x40,
-	0xe6, 0x5d, 0x00, 0xe6, 0xcf, 0x82, 0x50, 0x73, 0xf5, 0x31, 0xd0, 0x41, 0x0a, 0xb2, 0x07, 0xd0,
-	0xba, 0xe4, 0x89, 0x08, 0xa2, 0x10, 0xe3, 0xa4, 0xe3, 0xd9, 0x57, 0x2a, 0x61, 0x33, 0x87, 0xfb,
-	0xcd, 0xe6, 0xfd, 0x00, 0x5a, 0x93, 0x29, 0x67, 0xc9, 0x3c, 0x46, 0xbc, 0x6d, 0xcf, 0xbe, 0x62,
-	0xa2, 0x9f, 0x70, 0xe9, 0x45, 0x73, 0x95, 0xfd, 0x15, 0xbc, 0xb5, 0x05, 0x0d, 0x7f, 0x9c, 0x7d,
-	0xd1, 0xf5, 0xc7, 0xa7, 0xbe, 0xba, 0x34, 0x48, 0x75, 0x6e, 0x64, 0xf9, 0xd4, 0xc2, 0xf7, 0x53,
-	0x9f, 0xf4, 0xa1, 0xae, 0x92, 0xc4, 0xc5, 0x24, 0x51, 0x8f, 0xf4, 0x1c, 0x37, 0xcc, 0x20, 0xa8,
-	0x64, 0xf7, 0x7b, 0xd0, 0x4c, 0xd4, 0x72, 0xd5, 0x30, 0xd4, 0x0b, 0xb1, 0x8f, 0x4a, 0x0d, 0x93,
-	0x3e, 0x83, 0x75, 0xe3, 0xe1, 0x4a, 0x96, 0xea, 0x3e, 0xa5, 0x66, 0xfb, 0x14, 0xca, 0xd0, 0x73,
-	0x5a, 0x5d, 0x25, 0xd8, 0xfb, 0xe0, 0xaa, 0xfd, 0x31, 0x49, 0x9d, 0x5e, 0x87, 0x50, 0x23, 0x72,
-	0xe8, 0x4f, 0xa0, 0x77, 0xc2, 0xe5, 0xe3, 0xe3, 0x4a, 0x78, 0x09, 0xb8, 0x21, 0x9b, 0x71, 0xd3,
-	0x44, 0xe1, 0x33, 0x1d, 0xc1, 0x9a, 0x51, 0x58, 0x11, 0x71, 0xcd, 0x1f, 0x1b, 0xbc, 0x7d, 0x8b,
-	0xf7, 0x31, 0x93, 0xec, 0x98, 0x09, 0xee, 0xd5, 0xfc, 0x31, 0xbd, 0x44, 0xa7, 0xbc, 0x54, 0x9b,
-	0x5d, 0xb5, 0x34, 0xf8, 0xe3, 0x51, 0x0e, 0x77, 0xd3, 0x1f, 0x3f, 0x67, 0x33, 0xae, 0xf2, 0x4a,
-	0x87, 0x14, 0xf2, 0xea, 0xc8, 0xeb, 0x20, 0x45, 0xb1, 0x69, 0x82, 0x3d, 0x1c, 0x7e, 0xf7, 0x78,
-	0x51, 0x31, 0xf1, 0xbf, 0x62, 0x28, 0x53, 0x8e, 0x81, 0x6b, 0x6c, 0xad, 0x7a, 0x40, 0xa1, 0xb2,
-	0x72, 0x5d, 0xd7, 0x3a, 0x35, 0x8f, 0x06, 0xb0, 0x5d, 0x34, 0xed, 0xed, 0x7d, 0x2a, 0xc6, 0x1a,
-	0xf4, 0x28, 0x9a, 0xce, 0x67, 0xa1, 0xb8, 0x16, 0x1f, 0x4e, 0xb1, 0x7d, 0x4f, 0xbf, 0x58, 0xc9,
-	0xb4, 0x03, 0x68, 0x4d, 0xb4, 0x02, 0x93, 0xff, 0xeb, 0xd6, 0x38, 0xad, 0xd7, 0xb3, 0x6c, 0xfa,
-	0x3b, 0x07, 0x76, 0xd3, 0xcf, 0x1d, 0x2f, 0x54, 0xe4, 0x5c, 0x4b, 0xd1, 0xbb, 0x05, 0xed, 0x49,
-	0x34, 0xd5, 0xa1, 0xeb, 0xea, 0xb2, 0x3f, 0x89, 0xa6, 0x18, 0xb8, 0x11, 0xdc, 0x5c, 0x42, 0x54,
-	0x75, 0x00, 0xa1, 0xcd, 0xcc, 0x06, 0x10, 0x05, 0x27, 0x18, 0x2e, 0xfd, 0xad, 0x83, 0xf1, 0x64,
-	0xbf, 0x78, 0x3d, 0xb9, 0x42, 0x76, 0x10, 0x9d, 0x62, 0xe8, 0xbe, 0xbe, 0x31, 0x89, 0xa6, 0xa7,
-	0x3e, 0x9d, 0xc1, 0x4e, 0x09, 0xcb, 0x5b, 0xb5, 0xfd, 0x0b, 0x75, 0xa7, 0xf4, 0x7d, 0x43, 0xbd,
-	0x0e, 0xbb, 0x73, 0xb1, 0xe9, 0xfe, 0xf7, 0xd8, 0xbc, 0x80, 0xcd, 0x1c, 0xb4, 0xb7, 0x9c, 0x08,
-	0x02, 0xb6, 0x5f, 0x26, 0xf3, 0x70, 0xc2, 0x24, 0xaf, 0x5e, 0xab, 0xbf, 0x6a, 0xae, 0x3f, 0x81,
-	0x9d, 0xd2, 0x47, 0x2b, 0xdd, 0xf0, 0x7e, 0x01, 0x3b, 0x8f, 0x12, 0xce, 0x24, 0x57, 0x07, 0xcf,
-	0x58, 0x1d, 0x3c, 0x6f, 0xf2, 0xa0, 0xa1, 0x3f, 0x82, 0xdd, 0xb2, 0xfa, 0x4a, 0x30, 0xbf, 0x70,
-	0x80, 0x68, 0x45, 0xd7, 0x7e, 0x1a, 0x92, 0x3d, 0x80, 0x38, 0x89, 0x62, 0x9e, 0xc8, 0x80, 0x0b,
-	0x53, 0x71, 0x72, 0x14, 0xd5, 0x06, 0x14, 0xa0, 0x55, 0x32, 0xf0, 0x57, 0x0e, 0x9e, 0xb9, 0x47,
-	0x73, 0x19, 0x9d, 0x86, 0x93, 0x6b, 0xaa, 0x23, 0x04, 0x5c, 0x1c, 0x5f, 0xe8, 0x8b, 0x35, 0x3e,
-	0xd3, 0x9f, 0x62, 0x41, 0xcb, 0xe1, 0xa8, 0x94, 0x3c, 0x7d, 0xa8, 0xab, 0xe6, 0xae, 0x86, 0xcd,
-	0x9d, 0x7a, 0xa4, 0x87, 0xb0, 0x56, 0x00, 0xad, 0xbc, 0x3e, 0x99, 0xce, 0x85, 0xc4, 0x3e, 0xd0,
-	0xcc, 0x40, 0x3b, 0x86, 0x72, 0xea, 0x53, 0x0f, 0xd6, 0x8b, 0xba, 0xff, 0xc7, 0x02, 0x72, 0x0f,
-	0x1a, 0x3c, 0x49, 0x22, 0x3b, 0x32, 0xee, 0x6a, 0x7c, 0x4f, 0x14, 0xc9, 0xd3, 0x1c, 0xfa, 0x7d,
-	0x00, 0x3d, 0xde, 0x79, 0x1a, 0x84, 0x32, 0x3f, 0x1a, 0x77, 0x56, 0x8f, 0xc6, 0x6b, 0xb9, 0xd1,
-	0x38, 0x40, 0xfb, 0x79, 0xa4, 0x57, 0x53, 0x0e, 0x0d, 0xd4, 0x4b, 0x3e, 0x00, 0xd5, 0xb8, 0x8e,
-	0x0a, 0xb3, 0x6a, 0x33, 0x4b, 0xcc, 0x3e, 0xe4, 0x75, 0x42, 0x7e, 0x65, 0xc6, 0xf3, 0xf7, 0xa1,
-	0x13, 0x46, 0xa3, 0xc2, 0x8c, 0x73, 0xdd, 0x0e, 0x3b, 0xcc, 0x6c, 0xbb, 0x1d, 0x9a, 0xa7, 0x87,
-	0xff, 0x06, 0x68, 0x3f, 0x13, 0x67, 0xd8, 0x2b, 0x91, 0x8f, 0x60, 0xad, 0x30, 0xcd, 0x20, 0xc3,
-	0x6c, 0x48, 0x52, 0x9e, 0xca, 0x0c, 0x6f, 0xaf, 0xe4, 0x69, 0x6f, 0xd2, 0x1b, 0xe4, 0x19, 0xac,
-	0x17, 0xc7, 0x99, 0xe4, 0x76, 0x6e, 0x86, 0xba, 0xa4, 0xed, 0xce, 0x6a, 0x66, 0xaa, 0xee, 0x07,
-	0xd0, 0xb6, 0xb3, 0x05, 0xb2, 0xa3, 0x65, 0x4b, 0xe3, 0x8e, 0xe1, 0x6e, 0x99, 0x9c, 0x2e, 0x7e,
-	0x0c, 0xdd, 0x5c, 0x13, 0x4d, 0x06, 0x36, 0xac, 0xca, 0x2d, 0xfe, 0xf0, 0xd6, 0x0a, 0x4e, 0xaa,
-	0xe5, 0x87, 0x7a, 0x82, 0x89, 0xbd, 0x2e, 0xd9, 0xcd, 0xac, 0xcf, 0xb7, 0xd5, 0xc3, 0x9b, 0x4b,
-	0xf4, 0xfc, 0xfa, 0xb4, 0x5f, 0xb4, 0xeb, 0xcb, 0x8d, 0xaf, 0x5d, 0xbf, 0xd4, 0x58, 0x6a, 0x2b,
-	0x72, 0x7f, 0x3d, 0xac, 0x15, 0xcb, 0xff, 0x52, 0xac, 0x15, 0x2b, 0x7e, 0x91, 0x68, 0x47, 0xda,
-	0xe6, 0xcd, 0x3a, 0xb2, 0xd4, 0x4e, 0x0e, 0x77, 0xcb, 0xe4, 0x74, 0xf1, 0xf7, 0xa0, 0x65, 0x90,
-	0x91, 0xed, 0x02, 0x50, 0xbb, 0x74, 0xa7, 0x44, 0x4d, 0x57, 0x3e, 0x84, 0x06, 0xf6, 0x31, 0x84,
-	0xa4, 0x12, 0x69, 0x97, 0x34, 0xdc, 0x2a, 0xd0, 0x4a, 0x50, 0xb1, 0xe2, 0xe5, 0xa0, 0xe6, 0x8b,
-	0x73, 0x0e, 0x6a, 0xa1, 0x30, 0xd2, 0x1b, 0xe4, 0x04, 0x3b, 0xb1, 0xf4, 0x12, 0x4e, 0x6e, 0x15,
-	0x25, 0x73, 0xf7, 0xa8, 0xe1, 0x70, 0x15, 0x2b, 0x55, 0x74, 0x04, 0x90, 0x5d, 0x78, 0x49, 0xb6,
-	0x3f, 0xc5, 0x4b, 0xf7, 0x70, 0xb0, 0xcc, 0x48, 0x55, 0xbc, 0xc0, 0x1e, 0x2b, 0x7f, 0x65, 0x24,
-	0x77, 0x4a, 0xe2, 0x85, 0xbb, 0xed, 0xf0, 0xee, 0x97, 0x70, 0x53, 0x8d, 0x1f, 0x61, 0x5b, 0x98,
-	0x5d, 0xc3, 0xc8, 0x70, 0x69, 0x45, 0x66, 0xdf, 0xed, 0x95, 0xbc, 0xbc, 0xae, 0xc2, 0x29, 0x6f,
-	0x75, 0xad, 0xba, 0x6f, 0x58, 0x5d, 0x2b, 0xaf, 0x05, 0x3a, 0xc6, 0xd3, 0x3b, 0x91, 0x8d, 0xf1,
-	0xf2, 0xfd, 0xcd, 0xc6, 0xf8, 0xd2, 0xe5, 0x49, 0x57, 0x8d, 0xe2, 0x59, 0x6e, 0xab, 0xc6, 0xca,
-	0x0b, 0x84, 0xad, 0x1a, 0xab, 0x8f, 0x7f, 0x9d, 0x32, 0xb9, 0x63, 0xd3, 0xa6, 0xcc, 0xf2, 0x21,
-	0x6f, 0x53, 0x66, 0xc5, 0x19, 0x9b, 0x86, 0x52, 0x7a, 0x5c, 0xe5, 0x42, 0xa9, 0x7c, 0x94, 0xe6,
-	0x42, 0x69, 0xe9, 0x74, 0xa3, 0x37, 0x8e, 0xfb, 0x7f, 0x7b, 0xbd, 0xe7, 0xfc, 0xfd, 0xf5, 0x9e,
-	0xf3, 0xcf, 0xd7, 0x7b, 0xce, 0xef, 0xff, 0xb5, 0x77, 0x63, 0xdc, 0xc4, 0xbf, 0xab, 0x1f, 0xfe,
-	0x27, 0x00, 0x00, 0xff, 0xff, 0x88, 0xc0, 0x30, 0x4e, 0xa3, 0x1d, 0x00, 0x00,
+	// 2523 bytes of a gzipped FileDescriptorProto
+	0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xbc, 0x5a, 0x4b, 0x73, 0xdb, 0xc8,
+	0x11, 0x36, 0x24, 0x52, 0x22, 0x9b, 0x94, 0x44, 0x8d, 0x1e, 0x86, 0x29, 0x5b, 0x96, 0xe0, 0x47,
+	0x94, 0xd8, 0xb1, 0x13, 0xef, 0x25, 0xb5, 0x5b, 0x95, 0x2a, 0x4b, 0x76, 0x6c, 0xee, 0x5a, 0x5e,
+	0x17, 0xe4, 0x4d, 0x72, 0x48, 0x0a, 0x05, 0x02, 0x63, 0x09, 0x45, 0x10, 0xc0, 0x62, 0x86, 0xf6,
+	0x72, 0x4f, 0x7b, 0x4a, 0x2a, 0x39, 0xe5, 0x98, 0x3d, 0xe7, 0x9a, 0x43, 0x4e, 0xb9, 0xe4, 0x9a,
+	0x4a, 0x6d, 0xe5, 0x94, 0x1f, 0x90, 0x43, 0xca, 0xf9, 0x23, 0xa9, 0xe9, 0x99, 0xc1, 0x8b, 0xb4,
+	0xb3, 0x8b, 0xb2, 0x75, 0x23, 0xba, 0xbf, 0xe9, 0xe9, 0xee, 0xe9, 0xee, 0xe9, 0x99, 0x21, 0xc0,
+	0x98, 0x25, 0xc3, 0x3b, 0x49, 0x1a, 0xf3, 0x98, 0x34, 0xc4, 0xef, 0x7e, 0x77, 0x4c, 0xb9, 0xab,
+	0x69, 0xfd, 0x2e, 0x77, 0xd9, 0x28, 0xfb, 0xda, 0x3c, 0x8d, 0x4f, 0x63, 0xfc, 0x79, 0x57, 0xfc,
+	0x92, 0x54, 0xeb, 0x31, 0xb4, 0x8e, 0x4f, 0x9e, 0x50, 0xd7, 0xa7, 0x29, 0x59, 0x85, 0x85, 0xc0,
+	0x37, 0x8d, 0x3d, 0xe3, 0xa0, 0x61, 0x2f, 0x04, 0x3e, 0x31, 0x61, 0xd9, 0xf5, 0xfd, 0x94, 0x32,
+	0x66, 0x2e, 0xec, 0x19, 0x07, 0x6d, 0x5b, 0x7f, 0x12, 0x02, 0x0d, 0x4e, 0xd3, 0xb1, 0xb9, 0x88,
+	0x58, 0xfc, 0x6d, 0xdd, 0x07, 0xf2, 0x88, 0x72, 0x2d, 0xcc, 0xa6, 0x9f, 0x4f, 0x28, 0xe3, 0xe4,
+	0x16, 0x2c, 0x9d, 0x21, 0x01, 0xe5, 0x76, 0xee, 0x6d, 0xdc, 0x41, 0xa5, 0x15, 0xfb, 0xb1, 0xc4,
+	0x2a, 0x88, 0x35, 0x82, 0x8d, 0x92, 0x08, 0x96, 0xc4, 0x11, 0xa3, 0xe4, 0x76, 0x45, 0xc6, 0xa6,
+	0x96, 0x21, 0xf9, 0x65, 0x21, 0xe4, 0x26, 0x2c, 0x85, 0x12, 0xbd, 0x80, 0xe8, 0x55, 0x89, 0xce,
+	0xa4, 0x2a, 0xae, 0xf5, 0x27, 0x03, 0xe0, 0x19, 0xa5, 0xe9, 0x09, 0x77, 0xf9, 0x84, 0x91, 0x3d,
+	0x68, 0x24, 0x34, 0x9b, 0xa2, 0x7b, 0x47, 0x79, 0x52, 0x20, 0x6c, 0xe4, 0x90, 0x4d, 0x68, 0x06,
+	0x91, 0x4f, 0xbf, 0x40, 0xb9, 0x0d, 0x5b, 0x7e, 0x90, 0x6d, 0x58, 0xf2, 0xe2, 0xf1, 0x38, 0xe0,
+	0xca, 0x19, 0xea, 0x8b, 0xec, 0x43, 0xd7, 0x8f, 0x5f, 0x45, 0x0e, 0xa3, 0x5e, 0x1c, 0xf9, 0xcc,
+	0x6c, 0x20, 0xb7, 0x23, 0x68, 0x27, 0x92, 0x44, 0x2c, 0xe8, 0xb2, 0xc8, 0x4d, 0xd8, 0x59, 0xcc,
+	0x79, 0x10, 0x9d, 0x9a, 0xcd, 0x3d, 0xe3, 0xa0, 0x65, 0x97, 0x68, 0xd6, 0xdf, 0x0c, 0x00, 0xdb,
+	0x8d, 0x4e, 0xa9, 0x50, 0x93, 0x91, 0x6b, 0xb0, 0x32, 0x9c, 0x72, 0xca, 0x9c, 0x57, 0x69, 0xc0,
+	0x39, 0x8d, 0xd4, 0x6a, 0x75, 0x91, 0xf8, 0x0b, 0x49, 0x23, 0x57, 0x00, 0x24, 0x28, 0xa5, 0xae,
+	0xaf, 0xb4, 0x6d, 0x23, 0xc5, 0xa6, 0xae, 0x2f, 0x34, 0x1b, 0xd1, 0x69, 0x2e, 0x42, 0xea, 0xdd,
+	0x11, 0x34, 0x2d, 0x61, 0x07, 0xda, 0x08, 0x41, 0x01, 0x52, 0xf3, 0x96, 0x20, 0xe0, 0xf8, 0xef,
+	0x43, 0xcf, 0x4d, 0x92, 0x34, 0xfe, 0x22, 0x18, 0xbb, 0x9c, 0x3a, 0x2c, 0xf8, 0x92, 0xa2, 0xea,
+	0x0d, 0x7b, 0xad, 0x40, 0x3f, 0x09, 0xbe, 0xa4, 0xd6, 0x57, 0x0b, 0xb0, 0x85, 0xda, 0x3f, 0xa6,
+	0x6e, 0xca, 0x87, 0xd4, 0xe5, 0x75, 0xe2, 0x82, 0x5c, 0x83, 0x66, 0x2a, 0xa4, 0xa8, 0x15, 0x5d,
+	0xd1, 0x8b, 0x83, 0xa2, 0x6d, 0xc9, 0x23, 0xd7, 0xb3, 0x75, 0x5f, 0x9c, 0xb3, 0x84, 0x8a, 0x47,
+	0x6e, 0x42, 0x93, 0x09, 0x4f, 0x9a, 0x4b, 0x08, 0xea, 0xa9, 0x69, 0x33, 0x0f, 0xdb, 0x92, 0x9d,
+	0x45, 0xf8, 0x72, 0x1e, 0xe1, 0xe4, 0x03, 0xe8, 0x8a, 0x40, 0x60, 0x0e, 0xc3, 0x90, 0x31, 0x5b,
+	0x7b, 0x8b, 0xb9, 0x88, 0x3c, 0x94, 0xec, 0x0e, 0xa2, 0xe4, 0x87, 0xf5, 0x6f, 0x03, 0xb6, 0xab,
+	0x2e, 0xa8, 0x15, 0xd7, 0x97, 0xa0, 0x85, 0x86, 0x3a, 0x81, 0x5e, 0xd3, 0x65, 0xfc, 0x1e, 0xf8,
+	0xe4, 0x00, 0x9a, 0x34, 0x89, 0xbd, 0x33, 0x65, 0x39, 0x29, 0xf9, 0xe7, 0xa1, 0xe0, 0xd8, 0x12,
+	0x40, 0x7e, 0x08, 0x1d, 0xee, 0xa6, 0xa7, 0x94, 0x3b, 0x18, 0xec, 0x8d, 0x39, 0x9e, 0x02, 0x09,
+	0x10, 0xbf, 0x45, 0x52, 0x88, 0x1a, 0x82, 0xcb, 0x2b, 0x70, 0xaa, 0xa0, 0x3c, 0x77, 0xd9, 0xc8,
+	0x46, 0x8e, 0xf5, 0x4f, 0x03, 0xfa, 0x87, 0x2e, 0xf7, 0xce, 0xde, 0xc1, 0x32, 0x5f, 0x84, 0xe5,
+	0x28, 0xf6, 0x0b, 0x06, 0x2e, 0x89, 0xcf, 0x81, 0x4f, 0x3e, 0x02, 0x38, 0xd3, 0x92, 0x99, 0xb9,
+	0x88, 0x6e, 0xdf, 0x29, 0xac, 0x5c, 0x75, 0x5a, 0xbb, 0x00, 0x17, 0xe1, 0x3a, 0x89, 0xbc, 0x33,
+	0x81, 0xf3, 0x1d, 0xf4, 0x98, 0x48, 0xc6, 0x45, 0x11, 0xae, 0x19, 0x1d, 0xa5, 0x30, 0xeb, 0xcf,
+	0x06, 0xec, 0xcc, 0x35, 0xa6, 0xd6, 0x82, 0x7d, 0x08, 0xed, 0x54, 0x71, 0x44, 0x01, 0x15, 0x4a,
+	0x5f, 0x9e, 0xaf, 0xb4, 0x04, 0xd9, 0x39, 0x5c, 0xe4, 0xf9, 0x8b, 0x49, 0x18, 0x3a, 0x29, 0xfd,
+	0x7c, 0x12, 0xa4, 0xd4, 0x47, 0xa3, 0x1b, 0x76, 0x57, 0x10, 0x6d, 0x45, 0xb3, 0xfe, 0xde, 0x81,
+	0xf6, 0xd3, 0xd8, 0x57, 0xa5, 0xe1, 0x2a, 0x74, 0x64, 0x7c, 0x78, 0xf1, 0x24, 0xe2, 0xa8, 0xe1,
+	0x8a, 0x0d, 0x48, 0x3a, 0x12, 0x14, 0xf2, 0x03, 0x58, 0x97, 0x00, 0x96, 0x84, 0x01, 0x57, 0xb0,
+	0x05, 0x84, 0xad, 0x21, 0xe3, 0x44, 0xd0, 0x25, 0xf6, 0x36, 0x10, 0x46, 0x23, 0x3f, 0x88, 0x4e,
+	0x1d, 0x51, 0x8e, 0x14, 0x78, 0x11, 0xc1, 0x3d, 0xc5, 0x39, 0x89, 0xdc, 0x44, 0xa2, 0x7f, 0x04,
+	0x9b, 0x29, 0xf5, 0x68, 0xf0, 0xb2, 0x82, 0x6f, 0x20, 0x9e, 0x64, 0xbc, 0x7c, 0xc4, 0x1d, 0xd8,
+	0x70, 0x93, 0x24, 0x9c, 0x56, 0x06, 0x34, 0x71, 0xc0, 0xba, 0x66, 0xe5, 0xf8, 0xdb, 0x40, 0xa4,
+	0xee, 0x32, 0x8d, 0x15, 0x7c, 0x49, 0xea, 0x83, 0x1c, 0x59, 0xdd, 0x25, 0xba, 0x0f, 0x2d, 0xcf,
+	0x4d, 0x5c, 0x2f, 0xe0, 0x53, 0x95, 0xc0, 0xd9, 0xb7, 0x28, 0x6d, 0x13, 0x46, 0x7d, 0x59, 0xb6,
+	0x5a, 0x92, 0x29, 0x08, 0xa2, 0x5e, 0x91, 0xcb, 0xd0, 0x76, 0x5f, 0xba, 0x41, 0xe8, 0x0e, 0x43,
+	0x6a, 0xb6, 0x65, 0xe1, 0xcc, 0x08, 0xb3, 0xc5, 0x17, 0xe6, 0x14, 0xdf, 0x6a, 0x75, 0xed, 0xcc,
+	0x56, 0xd7, 0x72, 0x7d, 0xee, 0x56, 0xeb, 0x73, 0xa9, 0xf8, 0xae, 0x54, 0x8a, 0xef, 0x45, 0x58,
+	0x0e, 0x98, 0x33, 0x9c, 0xb0, 0xa9, 0xb9, 0x8a, 0xdb, 0xc5, 0x52, 0xc0, 0x0e, 0x27, 0x6c, 0x2a,
+	0x76, 0x27, 0xc6, 0xdd, 0x94, 0x9b, 0x6b, 0xe8, 0x14, 0xf9, 0x21, 0x64, 0x79, 0xc9, 0xc4, 0x99,
+	0x30, 0xf7, 0x94, 0x9a, 0xbd, 0x3d, 0xe3, 0xc0, 0xb0, 0x5b, 0x5e, 0x32, 0xf9, 0x4c, 0x7c, 0x8b,
+	0x80, 0x48, 0xd2, 0xd8, 0xa3, 0x8c, 0x39, 0x39, 0x68, 0x1d, 0x41, 0x6b, 0x8a, 0x71, 0xa4, 0xb1,
+	0x4a, 0x90, 0xf4, 0x3b, 0xc1, 0x29, 0x84, 0x20, 0xe9, 0xef, 0x1d, 0x68, 0xfb, 0x01, 0x1b, 0x39,
+	0x13, 0x1e, 0x84, 0xe6, 0x86, 0x9c, 0x45, 0x10, 0x3e, 0xe3, 0x41, 0x48, 0xee, 0xc2, 0x26, 0x32,
+	0x85, 0x39, 0x4e, 0xe8, 0x72, 0x1a, 0x79, 0x53, 0x67, 0xcc, 0xcc, 0x4d, 0xc4, 0xad, 0x0b, 0x9e,
+	0xb0, 0xec, 0x89, 0xe4, 0x1c, 0x33, 0xf2, 0x63, 0xd8, 0xc2, 0x01, 0xc2, 0x83, 0xb4, 0x38, 0x62,
+	0x0b, 0x47, 0x10, 0xc1, 0x14, 0xae, 0xa4, 0xf9, 0x90, 0x9b, 0xb0, 0x96, 0xcf, 0x81, 0x9e, 0x34,
+	0xb7, 0xd1, 0x71, 0x2b, 0x5a, 0xfc, 0xa1, 0x20, 0x92, 0x03, 0xe8, 0x15, 0x44, 0x4b, 0xe0, 0x45,
+	0x04, 0xae, 0x66, 0x52, 0x25, 0x72, 0x0f, 0xba, 0x11, 0xe5, 0x4e, 0x10, 0x29, 0x94, 0x89, 0x28,
+	0x88, 0x28, 0x1f, 0x44, 0x12, 0x61, 0xc1, 0x8a, 0x40, 0xc4, 0x13, 0xae, 0x20, 0x97, 0xe4, 0x4a,
+	0x47, 0x94, 0x7f, 0x3a, 0xe1, 0x12, 0xb3, 0x2f, 0x76, 0x8c, 0xf4, 0x85, 0xc3, 0xdc, 0x71, 0x12,
+	0x52, 0x66, 0xf6, 0x25, 0x44, 0xd0, 0x4e, 0x24, 0x49, 0x58, 0x8b, 0x90, 0x61, 0x18, 0x7b, 0x23,
+	0xc7, 0x73, 0xbd, 0x33, 0xea, 0x9c, 0x05, 0x9c, 0x99, 0x3b, 0x88, 0x25, 0x82, 0x79, 0x28, 0x78,
+	0x47, 0x82, 0xf5, 0x38, 0xe0, 0x68, 0x45, 0x61, 0x88, 0xb0, 0x99, 0x99, 0x97, 0xa5, 0x15, 0x19,
+	0x5a, 0xd8, 0x5c, 0x15, 0x5e, 0xf0, 0xce, 0x95, 0x8a, 0xf0, 0xdc, 0x45, 0x73, 0x86, 0x44, 0x6e,
+	0x14, 0x33, 0x73, 0x77, 0xce, 0x90, 0xa7, 0x82, 0x23, 0x92, 0x19, 0x87, 0x8c, 0xe9, 0x98, 0x8b,
+	0x44, 0x51, 0x03, 0xae, 0xe2, 0x80, 0x75, 0xc1, 0x3a, 0x56, 0x1c, 0x89, 0xbf, 0x0e, 0xab, 0xd2,
+	0x2b, 0x8c, 0x2b, 0xe8, 0x9e, 0x4c, 0x24, 0xf4, 0x0b, 0xe3, 0x12, 0x75, 0x17, 0x36, 0x11, 0x15,
+	0x70, 0x9a, 0x3a, 0x8c, 0xd2, 0x91, 0xc2, 0xee, 0xe7, 0x62, 0x07, 0x9c, 0xa6, 0x27, 0x94, 0x8e,
+	0xe4, 0x00, 0x11, 0xce, 0x62, 0x00, 0x26, 0x0f, 0x1b, 0x05, 0x49, 0x42, 0x7d, 0xd3, 0x92, 0x8d,
+	0x89, 0x60, 0x7c, 0x42, 0xa7, 0xec, 0x44, 0x92, 0x45, 0xc5, 0x42, 0xac, 0x4f, 0x43, 0x2a, 0x32,
+	0x51, 0xc3, 0xaf, 0xe5, 0x46, 0x3e, 0x90, 0x2c, 0x3d, 0xe2, 0x16, 0x10, 0xa9, 0x4e, 0x5c, 0xf4,
+	0xe3, 0xf5, 0x5c, 0xfc, 0x20, 0xce, 0x9d, 0x58, 0x05, 0x4b, 0xcd, 0x6f, 0x54, 0xc1, 0xa8, 0xb7,
+	0xf5, 0x17, 0x03, 0x36, 0x45, 0x19, 0x7f, 0x4f, 0x9b, 0xe7, 0x0d, 0xdd, 0xf1, 0xc8, 0xe6, 0x60,
+	0x4d, 0x0a, 0xc9, 0xf6, 0x0d, 0xdd, 0xf0, 0xdc, 0x82, 0xf5, 0x80, 0xc5, 0x22, 0xdb, 0x7c, 0x27,
+	0xa5, 0x49, 0x18, 0x78, 0xae, 0xde, 0x27, 0x7b, 0x9a, 0x61, 0x2b, 0xba, 0xf5, 0x5b, 0x03, 0xb6,
+	0x2a, 0x2a, 0xd7, 0xda, 0x22, 0xdf, 0xa8, 0xf4, 0xf7, 0x60, 0x4d, 0x2e, 0x4d, 0xae, 0x8b, 0xdc,
+	0x01, 0x57, 0x25, 0x39, 0xd3, 0xe4, 0x2b, 0x03, 0xd6, 0xee, 0xb3, 0x11, 0x6e, 0x5d, 0xef, 0xaf,
+	0xb7, 0xdc, 0x81, 0xb6, 0xdc, 0x34, 0x47, 0x74, 0x8a, 0x7e, 0xec, 0xda, 0x2d, 0x24, 0x7c, 0x42,
+	0xa7, 0xd6, 0x3f, 0x0c, 0xe8, 0xe5, 0x2a, 0xd4, 0xf2, 0xc3, 0xb7, 0x52, 0x02, 0x4b, 0xd2, 0x2b,
+	0x27, 0x6b, 0x02, 0x17, 0x75, 0x49, 0x7a, 0x65, 0xab, 0x3e, 0x50, 0x21, 0x44, 0x6b, 0xe7, 0x04,
+	0xbe, 0x5e, 0x3e, 0x81, 0x10, 0xdd, 0xdc, 0xc0, 0x67, 0x65, 0x43, 0x9a, 0x15, 0x43, 0x7e, 0x67,
+	0x00, 0xb1, 0x69, 0x12, 0xa7, 0xbc, 0xbe, 0x3b, 0xf7, 0xa1, 0x11, 0xd2, 0x17, 0x7c, 0xbe, 0x21,
+	0xc8, 0x42, 0x63, 0x83, 0xd3, 0x33, 0xae, 0x02, 0x72, 0xc6, 0x58, 0xc1, 0xb3, 0x8e, 0x60, 0xa3,
+	0xa4, 0x4a, 0x1d, 0xb7, 0x5a, 0xbf, 0x84, 0x9e, 0x88, 0xd2, 0x27, 0xf1, 0x69, 0x10, 0xbd, 0xd3,
+	0xa4, 0xb2, 0xee, 0xc3, 0x7a, 0x41, 0x72, 0x2d, 0xe5, 0xfe, 0x6a, 0x40, 0xef, 0x11, 0xe5, 0x4f,
+	0x51, 0x60, 0x2d, 0xed, 0xae, 0x42, 0x87, 0xd1, 0xf4, 0x25, 0x4d, 0x1d, 0xe1, 0x28, 0xd5, 0xca,
+	0x81, 0x24, 0x3d, 0x8b, 0xe5, 0xee, 0x9f, 0xba, 0x2f, 0xb8, 0x64, 0xcb, 0xe6, 0xad, 0x25, 0x08,
+	0xc8, 0xbc, 0x02, 0xe0, 0xfa, 0xe3, 0x20, 0x92, 0x5c, 0xd9, 0xaa, 0xb5, 0x91, 0x82, 0x6c, 0x13,
+	0x96, 0x5f, 0xd2, 0x94, 0x05, 0x71, 0x84, 0x71, 0xd2, 0xb6, 0xf5, 0xa7, 0xc5, 0x61, 0xbd, 0xa0,
+	0xf7, 0xbb, 0xcd, 0x7b, 0x13, 0x96, 0xbd, 0x90, 0xba, 0xe9, 0x24, 0x41, 0x7d, 0x5b, 0xb6, 0xfe,
+	0xc4, 0x44, 0x7f, 0x44, 0xb9, 0x1d, 0x4f, 0x44, 0xf6, 0xd7, 0xf0, 0xd6, 0x06, 0x34, 0xfd, 0x61,
+	0x3e, 0x63, 0xc3, 0x1f, 0x0e, 0x7c, 0x71, 0xa8, 0x92, 0x5b, 0x56, 0x96, 0x4f, 0xcb, 0xf8, 0x3d,
+	0xf0, 0x49, 0x0f, 0x16, 0x45, 0x92, 0x34, 0x30, 0x49, 0xc4, 0x4f, 0xeb, 0x14, 0x17, 0x4c, 0x69,
+	0x50, 0xcb, 0xee, 0x1b, 0xb0, 0x94, 0x8a, 0xe1, 0xfa, 0x3c, 0x90, 0xc7, 0x3e, 0x0a, 0x55, 0x4c,
+	0xeb, 0x18, 0x56, 0x95, 0x87, 0x6b, 0x59, 0x2a, 0xef, 0x71, 0x16, 0xf4, 0x3d, 0x8e, 0xe5, 0xa2,
+	0xe7, 0xa4, 0xb8, 0x5a, 0x6a, 0xef, 0x41, 0x43, 0xac, 0x8f, 0x4a, 0xea, 0xec, 0xb8, 0x88, 0x12,
+	0x91, 0x63, 0x7d, 0x0a, 0xdd, 0x47, 0x94, 0x3f, 0x38, 0xac, 0xa5, 0x2f, 0x81, 0x46, 0xe4, 0x8e,
+	0xa9, 0xba, 0x64, 0xc2, 0xdf, 0x96, 0x03, 0x2b, 0x4a, 0x60, 0x4d, 0x8d, 0x17, 0xfc, 0xa1, 0xd2,
+	0xb7, 0xa7, 0xf5, 0x7d, 0xe0, 0x72, 0xf7, 0xd0, 0x65, 0xd4, 0x5e, 0xf0, 0x87, 0xd6, 0x4b, 0x74,
+	0xca, 0x73, 0xb1, 0xd8, 0x75, 0x4b, 0x83, 0x3f, 0x74, 0x0a, 0x7a, 0x2f, 0xf9, 0xc3, 0xa7, 0xee,
+	0x98, 0x8a, 0xbc, 0xd2, 0x5d, 0xd0, 0x98, 0x62, 0x50, 0xb5, 0xed, 0xb6, 0xea, 0x7e, 0xc6, 0xd4,
+	0x4a, 0xf1, 0x8e, 0x0b, 0xe7, 0x3d, 0x9c, 0xd6, 0x4c, 0xfc, 0xef, 0x18, 0xca, 0x16, 0xc5, 0xc0,
+	0x55, 0xb6, 0xd6, 0xdd, 0xa0, 0x50, 0x58, 0xb5, 0xae, 0x4b, 0x99, 0x92, 0x67, 0x05, 0xb0, 0x59,
+	0x36, 0xed, 0xfd, 0x4d, 0x95, 0x60, 0x0d, 0x3a, 0x8a, 0xc3, 0xc9, 0x38, 0x62, 0xe7, 0xe2, 0xc3,
+	0x10, 0xaf, 0x37, 0xb3, 0x19, 0x6b, 0x99, 0x76, 0x00, 0xcb, 0x9e, 0x14, 0xa0, 0xf2, 0x7f, 0x55,
+	0x1b, 0x27, 0xe5, 0xda, 0x9a, 0x6d, 0xfd, 0xc1, 0x80, 0xed, 0x6c, 0xba, 0xc3, 0xa9, 0x88, 0x9c,
+	0x73, 0x29, 0x7a, 0x97, 0xa0, 0xe5, 0xc5, 0xa1, 0x0c, 0xdd, 0x86, 0x2c, 0xfb, 0x5e, 0x1c, 0x62,
+	0xe0, 0xc6, 0x70, 0x71, 0x46, 0xa3, 0xba, 0x17, 0xb4, 0xd2, 0xcc, 0xfc, 0x82, 0xb6, 0xe4, 0x04,
+	0xc5, 0xb5, 0x7e, 0x6f, 0x60, 0x3c, 0xe9, 0x19, 0xcf, 0x27, 0x57, 0xc8, 0x16, 0x6a, 0x27, 0x18,
+	0xf2, 0xde, 0xb3, 0xe9, 0xc5, 0xe1, 0xc0, 0xb7, 0xc6, 0xb0, 0x55, 0xd1, 0xe5, 0xbd, 0xda, 0xfe,
+	0xb5, 0xe8, 0x29, 0x7d, 0x5f, 0x51, 0xcf, 0xc3, 0xee, 0x42, 0x6c, 0x36, 0xde, 0x1e, 0x9b, 0x23,
+	0x58, 0x2f, 0xa8, 0xf6, 0x9e, 0x13, 0x81, 0xc1, 0xe6, 0xf3, 0x74, 0x12, 0x79, 0x2e, 0xa7, 0xf5,
+	0x6b, 0xf5, 0x77, 0xcd, 0xf5, 0x87, 0xb0, 0x55, 0x99, 0xb4, 0x56, 0x87, 0xf7, 0x6b, 0xd8, 0x3a,
+	0x4a, 0xa9, 0xcb, 0xa9, 0xd8, 0x78, 0x86, 0x62, 0xe3, 0x79, 0x97, 0x1b, 0x8d, 0xf5, 0x33, 0xd8,
+	0xae, 0x8a, 0xaf, 0xa5, 0xe6, 0xd7, 0x06, 0x10, 0x29, 0xe8, 0xdc, 0x77, 0x43, 0xb2, 0x0b, 0x90,
+	0xa4, 0x71, 0x42, 0x53, 0x1e, 0x50, 0xa6, 0x2a, 0x4e, 0x81, 0x22, 0x8e, 0x01, 0x25, 0xd5, 0x6a,
+	0x19, 0xf8, 0x1b, 0x03, 0xf7, 0xdc, 0xfb, 0x13, 0x1e, 0x0f, 0x22, 0xef, 0x9c, 0xea, 0x08, 0x81,
+	0x06, 0x5e, 0x31, 0xca, 0xc6, 0x1a, 0x7f, 0x5b, 0x3f, 0xc7, 0x82, 0x56, 0xd0, 0xa3, 0x56, 0xf2,
+	0xf4, 0x60, 0x51, 0x1c, 0xee, 0x16, 0xf0, 0x70, 0x27, 0x7e, 0x5a, 0x77, 0x60, 0xa5, 0xa4, 0xb4,
+	0xf0, 0xba, 0x17, 0x4e, 0x18, 0xc7, 0x73, 0xa0, 0x7a, 0x23, 0x6a, 0x2b, 0xca, 0xc0, 0xb7, 0x6c,
+	0x58, 0x2d, 0xcb, 0xfe, 0x3f, 0x03, 0xc8, 0x3e, 0x34, 0x69, 0x9a, 0xc6, 0xfa, 0x49, 0xad, 0x23,
+	0xf5, 0x7b, 0x28, 0x48, 0xb6, 0xe4, 0x58, 0x1f, 0x02, 0xc8, 0x2b, 0xd8, 0xc7, 0x41, 0xc4, 0x8b,
+	0x4f, 0x87, 0xc6, 0xfc, 0xa7, 0xc3, 0x85, 0xc2, 0xd3, 0x21, 0x40, 0xeb, 0x69, 0x2c, 0x47, 0x5b,
+	0x14, 0x9a, 0x28, 0x97, 0xdc, 0x05, 0x71, 0x70, 0x75, 0x4a, 0x6f, 0x79, 0xea, 0xad, 0x25, 0x9f,
+	0xc8, 0x6e, 0x47, 0xf4, 0x95, 0x7a, 0xbe, 0xbc, 0x05, 0xed, 0x28, 0x76, 0x4a, 0x6f, 0x40, 0xab,
+	0xfa, 0xb2, 0x43, 0xbd, 0xfd, 0xb5, 0x22, 0xf5, 0xeb, 0xde, 0x37, 0x1d, 0x68, 0x1d, 0xb3, 0x13,
+	0x3c, 0x2b, 0x91, 0x8f, 0x61, 0xa5, 0x74, 0x9b, 0x41, 0xfa, 0xf9, 0x25, 0x49, 0xf5, 0x56, 0xa6,
+	0xbf, 0x33, 0x97, 0x27, 0xbd, 0x69, 0x5d, 0x20, 0xc7, 0xb0, 0x5a, 0xbe, 0xde, 0x27, 0x6f, 0x7b,
+	0xa9, 0xe8, 0xbf, 0xf5, 0x45, 0xc0, 0xba, 0x40, 0x3e, 0x82, 0x96, 0xbe, 0x5b, 0x20, 0x5b, 0x12,
+	0x5b, 0xb9, 0xee, 0xe8, 0x6f, 0x57, 0xc9, 0xd9, 0xe0, 0x07, 0xd0, 0x29, 0x1c, 0xa2, 0x89, 0xa9,
+	0xc3, 0xaa, 0x7a, 0xc4, 0xef, 0x5f, 0x9a, 0xc3, 0xc9, 0xa4, 0xfc, 0x54, 0xbe, 0x32, 0xe0, 0x59,
+	0x97, 0x6c, 0xe7, 0xd6, 0x17, 0x8f, 0xd5, 0xfd, 0x8b, 0x33, 0xf4, 0xe2, 0xf8, 0xec, 0xbc, 0xa8,
+	0xc7, 0x57, 0x0f, 0xbe, 0x7a, 0xfc, 0xcc, 0xc1, 0x52, 0x5a, 0x51, 0x78, 0x15, 0xd6, 0x56, 0xcc,
+	0xbe, 0x35, 0x6b, 0x2b, 0xe6, 0x3c, 0x21, 0x4b, 0x47, 0xea, 0xc3, 0x9b, 0x76, 0x64, 0xe5, 0x38,
+	0xd9, 0xdf, 0xae, 0x92, 0xb3, 0xc1, 0x3f, 0x81, 0x65, 0xa5, 0x19, 0xd9, 0x2c, 0x29, 0xaa, 0x87,
+	0x6e, 0x55, 0xa8, 0xd9, 0xc8, 0x7b, 0xd0, 0xc4, 0x73, 0x0c, 0x21, 0x19, 0x22, 0x3b, 0x25, 0xf5,
+	0x37, 0x4a, 0xb4, 0x8a, 0xaa, 0x58, 0xf1, 0x0a, 0xaa, 0x16, 0x8b, 0x73, 0x41, 0xd5, 0x52, 0x61,
+	0xb4, 0x2e, 0x90, 0x47, 0x78, 0x12, 0xcb, 0x9a, 0x70, 0x72, 0xa9, 0x8c, 0x2c, 0xf4, 0x51, 0xfd,
+	0xfe, 0x3c, 0x56, 0x26, 0xe8, 0x3e, 0x40, 0xde, 0xf0, 0x92, 0x7c, 0x7d, 0xca, 0x4d, 0x77, 0xdf,
+	0x9c, 0x65, 0x64, 0x22, 0x9e, 0xe1, 0x19, 0xab, 0xd8, 0x32, 0x92, 0xcb, 0x15, 0x78, 0xa9, 0xb7,
+	0xed, 0x5f, 0x79, 0x03, 0x37, 0x93, 0xf8, 0x31, 0x1e, 0x0b, 0xf3, 0x36, 0x8c, 0xf4, 0x67, 0x46,
+	0xe4, 0xf6, 0xed, 0xcc, 0xe5, 0x15, 0x65, 0x95, 0x76, 0x79, 0x2d, 0x6b, 0x5e, 0xbf, 0xa1, 0x65,
+	0xcd, 0x6d, 0x0b, 0x64, 0x8c, 0x67, 0x3d, 0x91, 0x8e, 0xf1, 0x6a, 0xff, 0xa6, 0x63, 0x7c, 0xa6,
+	0x79, 0x92, 0x55, 0xa3, 0xbc, 0x97, 0xeb, 0xaa, 0x31, 0xb7, 0x81, 0xd0, 0x55, 0x63, 0xfe, 0xf6,
+	0x2f, 0x53, 0xa6, 0xb0, 0x6d, 0xea, 0x94, 0x99, 0xdd, 0xe4, 0x75, 0xca, 0xcc, 0xd9, 0x63, 0xb3,
+	0x50, 0xca, 0xb6, 0xab, 0x42, 0x28, 0x55, 0xb7, 0xd2, 0x42, 0x28, 0xcd, 0xec, 0x6e, 0xd6, 0x05,
+	0xf2, 0x2b, 0xd8, 0x98, 0xf3, 0xac, 0x4a, 0xf6, 0xe4, 0xa0, 0x37, 0x3f, 0x1f, 0xf7, 0xf7, 0xdf,
+	0x82, 0xd0, 0xd2, 0x0f, 0x7b, 0xdf, 0xbc, 0xde, 0x35, 0xfe, 0xf5, 0x7a, 0xd7, 0xf8, 0xcf, 0xeb,
+	0x5d, 0xe3, 0x8f, 0xff, 0xdd, 0xbd, 0x30, 0x5c, 0xc2, 0xff, 0xb6, 0x7c, 0xf0, 0xbf, 0x00, 0x00,
+	0x00, 0xff, 0xff, 0xff, 0x4d, 0x97, 0x7a, 0x21, 0x23, 0x00, 0x00,
 }
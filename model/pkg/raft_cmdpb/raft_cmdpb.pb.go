@@ -14,6 +14,8 @@
 		MergeResponse
 		LeaderChangeRequest
 		LeaderChangeResponse
+		LockReapRequest
+		ReapLock
 		CmdID
 		Command
 		PeerTask
@@ -69,6 +71,8 @@ const (
 	CmdType_KvDelete          CmdType = 18
 	CmdType_KvBatchDel        CmdType = 19
 	CmdType_KvRangeDel        CmdType = 20
+	CmdType_KvIncr            CmdType = 22
+	CmdType_KvAppend          CmdType = 23
 	CmdType_AdminSplit        CmdType = 30
 	CmdType_AdminMerge        CmdType = 31
 	CmdType_AdminLeaderChange CmdType = 32
@@ -76,6 +80,7 @@ const (
 	CmdType_LockUpdate        CmdType = 41
 	CmdType_Unlock            CmdType = 42
 	CmdType_UnlockForce       CmdType = 43
+	CmdType_LockReap          CmdType = 44
 )
 
 var CmdType_name = map[int32]string{
@@ -98,6 +103,8 @@ var CmdType_name = map[int32]string{
 	18: "KvDelete",
 	19: "KvBatchDel",
 	20: "KvRangeDel",
+	22: "KvIncr",
+	23: "KvAppend",
 	30: "AdminSplit",
 	31: "AdminMerge",
 	32: "AdminLeaderChange",
@@ -105,6 +112,7 @@ var CmdType_name = map[int32]string{
 	41: "LockUpdate",
 	42: "Unlock",
 	43: "UnlockForce",
+	44: "LockReap",
 }
 var CmdType_value = map[string]int32{
 	"Invalid":           0,
@@ -126,6 +134,8 @@ var CmdType_value = map[string]int32{
 	"KvDelete":          18,
 	"KvBatchDel":        19,
 	"KvRangeDel":        20,
+	"KvIncr":            22,
+	"KvAppend":          23,
 	"AdminSplit":        30,
 	"AdminMerge":        31,
 	"AdminLeaderChange": 32,
@@ -133,6 +143,7 @@ var CmdType_value = map[string]int32{
 	"LockUpdate":        41,
 	"Unlock":            42,
 	"UnlockForce":       43,
+	"LockReap":          44,
 }
 
 func (x CmdType) String() string {
@@ -140,6 +151,31 @@ func (x CmdType) String() string {
 }
 func (CmdType) EnumDescriptor() ([]byte, []int) { return fileDescriptorRaftCmdpb, []int{0} }
 
+// 快照数据中值的格式
+type SnapshotValueFormat int32
+
+const (
+	SnapshotValueFormat_SVF_Unknown   SnapshotValueFormat = 0
+	SnapshotValueFormat_SVF_Raw       SnapshotValueFormat = 1
+	SnapshotValueFormat_SVF_TtlHeader SnapshotValueFormat = 2
+)
+
+var SnapshotValueFormat_name = map[int32]string{
+	0: "SVF_Unknown",
+	1: "SVF_Raw",
+	2: "SVF_TtlHeader",
+}
+var SnapshotValueFormat_value = map[string]int32{
+	"SVF_Unknown":   0,
+	"SVF_Raw":       1,
+	"SVF_TtlHeader": 2,
+}
+
+func (x SnapshotValueFormat) String() string {
+	return proto.EnumName(SnapshotValueFormat_name, int32(x))
+}
+func (SnapshotValueFormat) EnumDescriptor() ([]byte, []int) { return fileDescriptorRaftCmdpb, []int{1} }
+
 type SplitRequest struct {
 	Leader   uint64             `protobuf:"varint,1,opt,name=leader,proto3" json:"leader,omitempty"`
 	SplitKey []byte             `protobuf:"bytes,2,opt,name=split_key,json=splitKey,proto3" json:"split_key,omitempty"`
@@ -188,7 +224,11 @@ func (m *SplitResponse) String() string            { return proto.CompactTextStr
 func (*SplitResponse) ProtoMessage()               {}
 func (*SplitResponse) Descriptor() ([]byte, []int) { return fileDescriptorRaftCmdpb, []int{1} }
 
+// 合并分两步：source提交freeze冻结自己，target提交commit吸收source的key范围
 type MergeRequest struct {
+	Commit bool          `protobuf:"varint,1,opt,name=commit,proto3" json:"commit,omitempty"`
+	Target *metapb.Range `protobuf:"bytes,2,opt,name=target" json:"target,omitempty"`
+	Source *metapb.Range `protobuf:"bytes,3,opt,name=source" json:"source,omitempty"`
 }
 
 func (m *MergeRequest) Reset()                    { *m = MergeRequest{} }
@@ -196,6 +236,27 @@ func (m *MergeRequest) String() string            { return proto.CompactTextStri
 func (*MergeRequest) ProtoMessage()               {}
 func (*MergeRequest) Descriptor() ([]byte, []int) { return fileDescriptorRaftCmdpb, []int{2} }
 
+func (m *MergeRequest) GetCommit() bool {
+	if m != nil {
+		return m.Commit
+	}
+	return false
+}
+
+func (m *MergeRequest) GetTarget() *metapb.Range {
+	if m != nil {
+		return m.Target
+	}
+	return nil
+}
+
+func (m *MergeRequest) GetSource() *metapb.Range {
+	if m != nil {
+		return m.Source
+	}
+	return nil
+}
+
 type MergeResponse struct {
 }
 
@@ -236,6 +297,47 @@ func (m *LeaderChangeResponse) String() string            { return proto.Compact
 func (*LeaderChangeResponse) ProtoMessage()               {}
 func (*LeaderChangeResponse) Descriptor() ([]byte, []int) { return fileDescriptorRaftCmdpb, []int{5} }
 
+// 过期锁清理，由leader判断过期后提交，apply时只删除列出的、锁id一致的key
+type LockReapRequest struct {
+	Locks []*ReapLock `protobuf:"bytes,1,rep,name=locks" json:"locks,omitempty"`
+}
+
+func (m *LockReapRequest) Reset()                    { *m = LockReapRequest{} }
+func (m *LockReapRequest) String() string            { return proto.CompactTextString(m) }
+func (*LockReapRequest) ProtoMessage()               {}
+func (*LockReapRequest) Descriptor() ([]byte, []int) { return fileDescriptorRaftCmdpb, []int{6} }
+
+func (m *LockReapRequest) GetLocks() []*ReapLock {
+	if m != nil {
+		return m.Locks
+	}
+	return nil
+}
+
+type ReapLock struct {
+	Key []byte `protobuf:"bytes,1,opt,name=key,proto3" json:"key,omitempty"`
+	Id  string `protobuf:"bytes,2,opt,name=id,proto3" json:"id,omitempty"`
+}
+
+func (m *ReapLock) Reset()                    { *m = ReapLock{} }
+func (m *ReapLock) String() string            { return proto.CompactTextString(m) }
+func (*ReapLock) ProtoMessage()               {}
+func (*ReapLock) Descriptor() ([]byte, []int) { return fileDescriptorRaftCmdpb, []int{7} }
+
+func (m *ReapLock) GetKey() []byte {
+	if m != nil {
+		return m.Key
+	}
+	return nil
+}
+
+func (m *ReapLock) GetId() string {
+	if m != nil {
+		return m.Id
+	}
+	return ""
+}
+
 type CmdID struct {
 	NodeId uint64 `protobuf:"varint,1,opt,name=node_id,json=nodeId,proto3" json:"node_id,omitempty"`
 	Seq    uint64 `protobuf:"varint,2,opt,name=seq,proto3" json:"seq,omitempty"`
@@ -244,7 +346,7 @@ type CmdID struct {
 func (m *CmdID) Reset()                    { *m = CmdID{} }
 func (m *CmdID) String() string            { return proto.CompactTextString(m) }
 func (*CmdID) ProtoMessage()               {}
-func (*CmdID) Descriptor() ([]byte, []int) { return fileDescriptorRaftCmdpb, []int{6} }
+func (*CmdID) Descriptor() ([]byte, []int) { return fileDescriptorRaftCmdpb, []int{8} }
 
 func (m *CmdID) GetNodeId() uint64 {
 	if m != nil {
@@ -280,6 +382,8 @@ type Command struct {
 	KvDeleteReq          *kvrpcpb.KvDeleteRequest      `protobuf:"bytes,17,opt,name=kv_delete_req,json=kvDeleteReq" json:"kv_delete_req,omitempty"`
 	KvBatchDelReq        *kvrpcpb.KvBatchDeleteRequest `protobuf:"bytes,18,opt,name=kv_batch_del_req,json=kvBatchDelReq" json:"kv_batch_del_req,omitempty"`
 	KvRangeDelReq        *kvrpcpb.KvRangeDeleteRequest `protobuf:"bytes,19,opt,name=kv_range_del_req,json=kvRangeDelReq" json:"kv_range_del_req,omitempty"`
+	KvIncrReq            *kvrpcpb.KvIncrRequest        `protobuf:"bytes,21,opt,name=kv_incr_req,json=kvIncrReq" json:"kv_incr_req,omitempty"`
+	KvAppendReq          *kvrpcpb.KvAppendRequest      `protobuf:"bytes,22,opt,name=kv_append_req,json=kvAppendReq" json:"kv_append_req,omitempty"`
 	AdminSplitReq        *SplitRequest                 `protobuf:"bytes,30,opt,name=admin_split_req,json=adminSplitReq" json:"admin_split_req,omitempty"`
 	AdminMergeReq        *MergeRequest                 `protobuf:"bytes,31,opt,name=admin_merge_req,json=adminMergeReq" json:"admin_merge_req,omitempty"`
 	AdminLeaderChangeReq *LeaderChangeRequest          `protobuf:"bytes,32,opt,name=admin_leader_change_req,json=adminLeaderChangeReq" json:"admin_leader_change_req,omitempty"`
@@ -287,12 +391,15 @@ type Command struct {
 	LockUpdateReq        *kvrpcpb.LockUpdateRequest    `protobuf:"bytes,41,opt,name=lock_update_req,json=lockUpdateReq" json:"lock_update_req,omitempty"`
 	UnlockReq            *kvrpcpb.UnlockRequest        `protobuf:"bytes,42,opt,name=unlock_req,json=unlockReq" json:"unlock_req,omitempty"`
 	UnlockForceReq       *kvrpcpb.UnlockForceRequest   `protobuf:"bytes,43,opt,name=unlock_force_req,json=unlockForceReq" json:"unlock_force_req,omitempty"`
+	LockReapReq          *LockReapRequest              `protobuf:"bytes,44,opt,name=lock_reap_req,json=lockReapReq" json:"lock_reap_req,omitempty"`
+	// TTL表写入的值的到期时间（unix秒，0表示不过期），由leader提交时计算，各副本写入相同的值
+	ExpireAt uint64 `protobuf:"varint,50,opt,name=expire_at,json=expireAt,proto3" json:"expire_at,omitempty"`
 }
 
 func (m *Command) Reset()                    { *m = Command{} }
 func (m *Command) String() string            { return proto.CompactTextString(m) }
 func (*Command) ProtoMessage()               {}
-func (*Command) Descriptor() ([]byte, []int) { return fileDescriptorRaftCmdpb, []int{7} }
+func (*Command) Descriptor() ([]byte, []int) { return fileDescriptorRaftCmdpb, []int{9} }
 
 func (m *Command) GetCmdId() *CmdID {
 	if m != nil {
@@ -427,6 +534,20 @@ func (m *Command) GetKvRangeDelReq() *kvrpcpb.KvRangeDeleteRequest {
 	return nil
 }
 
+func (m *Command) GetKvIncrReq() *kvrpcpb.KvIncrRequest {
+	if m != nil {
+		return m.KvIncrReq
+	}
+	return nil
+}
+
+func (m *Command) GetKvAppendReq() *kvrpcpb.KvAppendRequest {
+	if m != nil {
+		return m.KvAppendReq
+	}
+	return nil
+}
+
 func (m *Command) GetAdminSplitReq() *SplitRequest {
 	if m != nil {
 		return m.AdminSplitReq
@@ -476,6 +597,20 @@ func (m *Command) GetUnlockForceReq() *kvrpcpb.UnlockForceRequest {
 	return nil
 }
 
+func (m *Command) GetLockReapReq() *LockReapRequest {
+	if m != nil {
+		return m.LockReapReq
+	}
+	return nil
+}
+
+func (m *Command) GetExpireAt() uint64 {
+	if m != nil {
+		return m.ExpireAt
+	}
+	return 0
+}
+
 type PeerTask struct {
 	VerifyEpoch *metapb.RangeEpoch `protobuf:"bytes,1,opt,name=verify_epoch,json=verifyEpoch" json:"verify_epoch,omitempty"`
 	Peer        *metapb.Peer       `protobuf:"bytes,2,opt,name=peer" json:"peer,omitempty"`
@@ -484,7 +619,7 @@ type PeerTask struct {
 func (m *PeerTask) Reset()                    { *m = PeerTask{} }
 func (m *PeerTask) String() string            { return proto.CompactTextString(m) }
 func (*PeerTask) ProtoMessage()               {}
-func (*PeerTask) Descriptor() ([]byte, []int) { return fileDescriptorRaftCmdpb, []int{8} }
+func (*PeerTask) Descriptor() ([]byte, []int) { return fileDescriptorRaftCmdpb, []int{10} }
 
 func (m *PeerTask) GetVerifyEpoch() *metapb.RangeEpoch {
 	if m != nil {
@@ -508,7 +643,7 @@ type SnapshotKVPair struct {
 func (m *SnapshotKVPair) Reset()                    { *m = SnapshotKVPair{} }
 func (m *SnapshotKVPair) String() string            { return proto.CompactTextString(m) }
 func (*SnapshotKVPair) ProtoMessage()               {}
-func (*SnapshotKVPair) Descriptor() ([]byte, []int) { return fileDescriptorRaftCmdpb, []int{9} }
+func (*SnapshotKVPair) Descriptor() ([]byte, []int) { return fileDescriptorRaftCmdpb, []int{11} }
 
 func (m *SnapshotKVPair) GetKey() []byte {
 	if m != nil {
@@ -526,12 +661,14 @@ func (m *SnapshotKVPair) GetValue() []byte {
 
 type SnapshotContext struct {
 	Meta *metapb.Range `protobuf:"bytes,1,opt,name=meta" json:"meta,omitempty"`
+	// 各节点的rocksdb.table_ttl可能不一致，与本地的格式不同时apply时转换
+	ValueFormat SnapshotValueFormat `protobuf:"varint,2,opt,name=value_format,json=valueFormat,proto3,enum=raft_cmdpb.SnapshotValueFormat" json:"value_format,omitempty"`
 }
 
 func (m *SnapshotContext) Reset()                    { *m = SnapshotContext{} }
 func (m *SnapshotContext) String() string            { return proto.CompactTextString(m) }
 func (*SnapshotContext) ProtoMessage()               {}
-func (*SnapshotContext) Descriptor() ([]byte, []int) { return fileDescriptorRaftCmdpb, []int{10} }
+func (*SnapshotContext) Descriptor() ([]byte, []int) { return fileDescriptorRaftCmdpb, []int{12} }
 
 func (m *SnapshotContext) GetMeta() *metapb.Range {
 	if m != nil {
@@ -540,6 +677,13 @@ func (m *SnapshotContext) GetMeta() *metapb.Range {
 	return nil
 }
 
+func (m *SnapshotContext) GetValueFormat() SnapshotValueFormat {
+	if m != nil {
+		return m.ValueFormat
+	}
+	return SnapshotValueFormat_SVF_Unknown
+}
+
 func init() {
 	proto.RegisterType((*SplitRequest)(nil), "raft_cmdpb.SplitRequest")
 	proto.RegisterType((*SplitResponse)(nil), "raft_cmdpb.SplitResponse")
@@ -547,12 +691,15 @@ func init() {
 	proto.RegisterType((*MergeResponse)(nil), "raft_cmdpb.MergeResponse")
 	proto.RegisterType((*LeaderChangeRequest)(nil), "raft_cmdpb.LeaderChangeRequest")
 	proto.RegisterType((*LeaderChangeResponse)(nil), "raft_cmdpb.LeaderChangeResponse")
+	proto.RegisterType((*LockReapRequest)(nil), "raft_cmdpb.LockReapRequest")
+	proto.RegisterType((*ReapLock)(nil), "raft_cmdpb.ReapLock")
 	proto.RegisterType((*CmdID)(nil), "raft_cmdpb.CmdID")
 	proto.RegisterType((*Command)(nil), "raft_cmdpb.Command")
 	proto.RegisterType((*PeerTask)(nil), "raft_cmdpb.PeerTask")
 	proto.RegisterType((*SnapshotKVPair)(nil), "raft_cmdpb.SnapshotKVPair")
 	proto.RegisterType((*SnapshotContext)(nil), "raft_cmdpb.SnapshotContext")
 	proto.RegisterEnum("raft_cmdpb.CmdType", CmdType_name, CmdType_value)
+	proto.RegisterEnum("raft_cmdpb.SnapshotValueFormat", SnapshotValueFormat_name, SnapshotValueFormat_value)
 }
 func (m *SplitRequest) Marshal() (dAtA []byte, err error) {
 	size := m.Size()
@@ -636,6 +783,36 @@ func (m *MergeRequest) MarshalTo(dAtA []byte) (int, error) {
 	_ = i
 	var l int
 	_ = l
+	if m.Commit {
+		dAtA[i] = 0x8
+		i++
+		if m.Commit {
+			dAtA[i] = 1
+		} else {
+			dAtA[i] = 0
+		}
+		i++
+	}
+	if m.Target != nil {
+		dAtA[i] = 0x12
+		i++
+		i = encodeVarintRaftCmdpb(dAtA, i, uint64(m.Target.Size()))
+		n3, err := m.Target.MarshalTo(dAtA[i:])
+		if err != nil {
+			return 0, err
+		}
+		i += n3
+	}
+	if m.Source != nil {
+		dAtA[i] = 0x1a
+		i++
+		i = encodeVarintRaftCmdpb(dAtA, i, uint64(m.Source.Size()))
+		n4, err := m.Source.MarshalTo(dAtA[i:])
+		if err != nil {
+			return 0, err
+		}
+		i += n4
+	}
 	return i, nil
 }
 
@@ -681,11 +858,11 @@ func (m *LeaderChangeRequest) MarshalTo(dAtA []byte) (int, error) {
 		dAtA[i] = 0x12
 		i++
 		i = encodeVarintRaftCmdpb(dAtA, i, uint64(m.Epoch.Size()))
-		n3, err := m.Epoch.MarshalTo(dAtA[i:])
+		n5, err := m.Epoch.MarshalTo(dAtA[i:])
 		if err != nil {
 			return 0, err
 		}
-		i += n3
+		i += n5
 	}
 	return i, nil
 }
@@ -708,6 +885,66 @@ func (m *LeaderChangeResponse) MarshalTo(dAtA []byte) (int, error) {
 	return i, nil
 }
 
+func (m *LockReapRequest) Marshal() (dAtA []byte, err error) {
+	size := m.Size()
+	dAtA = make([]byte, size)
+	n, err := m.MarshalTo(dAtA)
+	if err != nil {
+		return nil, err
+	}
+	return dAtA[:n], nil
+}
+
+func (m *LockReapRequest) MarshalTo(dAtA []byte) (int, error) {
+	var i int
+	_ = i
+	var l int
+	_ = l
+	if len(m.Locks) > 0 {
+		for _, msg := range m.Locks {
+			dAtA[i] = 0xa
+			i++
+			i = encodeVarintRaftCmdpb(dAtA, i, uint64(msg.Size()))
+			n, err := msg.MarshalTo(dAtA[i:])
+			if err != nil {
+				return 0, err
+			}
+			i += n
+		}
+	}
+	return i, nil
+}
+
+func (m *ReapLock) Marshal() (dAtA []byte, err error) {
+	size := m.Size()
+	dAtA = make([]byte, size)
+	n, err := m.MarshalTo(dAtA)
+	if err != nil {
+		return nil, err
+	}
+	return dAtA[:n], nil
+}
+
+func (m *ReapLock) MarshalTo(dAtA []byte) (int, error) {
+	var i int
+	_ = i
+	var l int
+	_ = l
+	if len(m.Key) > 0 {
+		dAtA[i] = 0xa
+		i++
+		i = encodeVarintRaftCmdpb(dAtA, i, uint64(len(m.Key)))
+		i += copy(dAtA[i:], m.Key)
+	}
+	if len(m.Id) > 0 {
+		dAtA[i] = 0x12
+		i++
+		i = encodeVarintRaftCmdpb(dAtA, i, uint64(len(m.Id)))
+		i += copy(dAtA[i:], m.Id)
+	}
+	return i, nil
+}
+
 func (m *CmdID) Marshal() (dAtA []byte, err error) {
 	size := m.Size()
 	dAtA = make([]byte, size)
@@ -755,11 +992,11 @@ func (m *Command) MarshalTo(dAtA []byte) (int, error) {
 		dAtA[i] = 0xa
 		i++
 		i = encodeVarintRaftCmdpb(dAtA, i, uint64(m.CmdId.Size()))
-		n4, err := m.CmdId.MarshalTo(dAtA[i:])
+		n6, err := m.CmdId.MarshalTo(dAtA[i:])
 		if err != nil {
 			return 0, err
 		}
-		i += n4
+		i += n6
 	}
 	if m.CmdType != 0 {
 		dAtA[i] = 0x10
@@ -770,131 +1007,131 @@ func (m *Command) MarshalTo(dAtA []byte) (int, error) {
 		dAtA[i] = 0x1a
 		i++
 		i = encodeVarintRaftCmdpb(dAtA, i, uint64(m.VerifyEpoch.Size()))
-		n5, err := m.VerifyEpoch.MarshalTo(dAtA[i:])
+		n7, err := m.VerifyEpoch.MarshalTo(dAtA[i:])
 		if err != nil {
 			return 0, err
 		}
-		i += n5
+		i += n7
 	}
 	if m.KvRawGetReq != nil {
 		dAtA[i] = 0x22
 		i++
 		i = encodeVarintRaftCmdpb(dAtA, i, uint64(m.KvRawGetReq.Size()))
-		n6, err := m.KvRawGetReq.MarshalTo(dAtA[i:])
+		n8, err := m.KvRawGetReq.MarshalTo(dAtA[i:])
 		if err != nil {
 			return 0, err
 		}
-		i += n6
+		i += n8
 	}
 	if m.KvRawPutReq != nil {
 		dAtA[i] = 0x2a
 		i++
 		i = encodeVarintRaftCmdpb(dAtA, i, uint64(m.KvRawPutReq.Size()))
-		n7, err := m.KvRawPutReq.MarshalTo(dAtA[i:])
+		n9, err := m.KvRawPutReq.MarshalTo(dAtA[i:])
 		if err != nil {
 			return 0, err
 		}
-		i += n7
+		i += n9
 	}
 	if m.KvRawDeleteReq != nil {
 		dAtA[i] = 0x32
 		i++
 		i = encodeVarintRaftCmdpb(dAtA, i, uint64(m.KvRawDeleteReq.Size()))
-		n8, err := m.KvRawDeleteReq.MarshalTo(dAtA[i:])
+		n10, err := m.KvRawDeleteReq.MarshalTo(dAtA[i:])
 		if err != nil {
 			return 0, err
 		}
-		i += n8
+		i += n10
 	}
 	if m.KvRawExecuteReq != nil {
 		dAtA[i] = 0x3a
 		i++
 		i = encodeVarintRaftCmdpb(dAtA, i, uint64(m.KvRawExecuteReq.Size()))
-		n9, err := m.KvRawExecuteReq.MarshalTo(dAtA[i:])
+		n11, err := m.KvRawExecuteReq.MarshalTo(dAtA[i:])
 		if err != nil {
 			return 0, err
 		}
-		i += n9
+		i += n11
 	}
 	if m.SelectReq != nil {
 		dAtA[i] = 0x42
 		i++
 		i = encodeVarintRaftCmdpb(dAtA, i, uint64(m.SelectReq.Size()))
-		n10, err := m.SelectReq.MarshalTo(dAtA[i:])
+		n12, err := m.SelectReq.MarshalTo(dAtA[i:])
 		if err != nil {
 			return 0, err
 		}
-		i += n10
+		i += n12
 	}
 	if m.InsertReq != nil {
 		dAtA[i] = 0x4a
 		i++
 		i = encodeVarintRaftCmdpb(dAtA, i, uint64(m.InsertReq.Size()))
-		n11, err := m.InsertReq.MarshalTo(dAtA[i:])
+		n13, err := m.InsertReq.MarshalTo(dAtA[i:])
 		if err != nil {
 			return 0, err
 		}
-		i += n11
+		i += n13
 	}
 	if m.DeleteReq != nil {
 		dAtA[i] = 0x52
 		i++
 		i = encodeVarintRaftCmdpb(dAtA, i, uint64(m.DeleteReq.Size()))
-		n12, err := m.DeleteReq.MarshalTo(dAtA[i:])
+		n14, err := m.DeleteReq.MarshalTo(dAtA[i:])
 		if err != nil {
 			return 0, err
 		}
-		i += n12
+		i += n14
 	}
 	if m.BatchInsertReq != nil {
 		dAtA[i] = 0x5a
 		i++
 		i = encodeVarintRaftCmdpb(dAtA, i, uint64(m.BatchInsertReq.Size()))
-		n13, err := m.BatchInsertReq.MarshalTo(dAtA[i:])
+		n15, err := m.BatchInsertReq.MarshalTo(dAtA[i:])
 		if err != nil {
 			return 0, err
 		}
-		i += n13
+		i += n15
 	}
 	if m.KvSetReq != nil {
 		dAtA[i] = 0x62
 		i++
 		i = encodeVarintRaftCmdpb(dAtA, i, uint64(m.KvSetReq.Size()))
-		n14, err := m.KvSetReq.MarshalTo(dAtA[i:])
+		n16, err := m.KvSetReq.MarshalTo(dAtA[i:])
 		if err != nil {
 			return 0, err
 		}
-		i += n14
+		i += n16
 	}
 	if m.KvGetReq != nil {
 		dAtA[i] = 0x6a
 		i++
 		i = encodeVarintRaftCmdpb(dAtA, i, uint64(m.KvGetReq.Size()))
-		n15, err := m.KvGetReq.MarshalTo(dAtA[i:])
+		n17, err := m.KvGetReq.MarshalTo(dAtA[i:])
 		if err != nil {
 			return 0, err
 		}
-		i += n15
+		i += n17
 	}
 	if m.KvBatchSetReq != nil {
 		dAtA[i] = 0x72
 		i++
 		i = encodeVarintRaftCmdpb(dAtA, i, uint64(m.KvBatchSetReq.Size()))
-		n16, err := m.KvBatchSetReq.MarshalTo(dAtA[i:])
+		n18, err := m.KvBatchSetReq.MarshalTo(dAtA[i:])
 		if err != nil {
 			return 0, err
 		}
-		i += n16
+		i += n18
 	}
 	if m.KvBatchGetReq != nil {
 		dAtA[i] = 0x7a
 		i++
 		i = encodeVarintRaftCmdpb(dAtA, i, uint64(m.KvBatchGetReq.Size()))
-		n17, err := m.KvBatchGetReq.MarshalTo(dAtA[i:])
+		n19, err := m.KvBatchGetReq.MarshalTo(dAtA[i:])
 		if err != nil {
 			return 0, err
 		}
-		i += n17
+		i += n19
 	}
 	if m.KvScanReq != nil {
 		dAtA[i] = 0x82
@@ -902,11 +1139,11 @@ func (m *Command) MarshalTo(dAtA []byte) (int, error) {
 		dAtA[i] = 0x1
 		i++
 		i = encodeVarintRaftCmdpb(dAtA, i, uint64(m.KvScanReq.Size()))
-		n18, err := m.KvScanReq.MarshalTo(dAtA[i:])
+		n20, err := m.KvScanReq.MarshalTo(dAtA[i:])
 		if err != nil {
 			return 0, err
 		}
-		i += n18
+		i += n20
 	}
 	if m.KvDeleteReq != nil {
 		dAtA[i] = 0x8a
@@ -914,11 +1151,11 @@ func (m *Command) MarshalTo(dAtA []byte) (int, error) {
 		dAtA[i] = 0x1
 		i++
 		i = encodeVarintRaftCmdpb(dAtA, i, uint64(m.KvDeleteReq.Size()))
-		n19, err := m.KvDeleteReq.MarshalTo(dAtA[i:])
+		n21, err := m.KvDeleteReq.MarshalTo(dAtA[i:])
 		if err != nil {
 			return 0, err
 		}
-		i += n19
+		i += n21
 	}
 	if m.KvBatchDelReq != nil {
 		dAtA[i] = 0x92
@@ -926,11 +1163,11 @@ func (m *Command) MarshalTo(dAtA []byte) (int, error) {
 		dAtA[i] = 0x1
 		i++
 		i = encodeVarintRaftCmdpb(dAtA, i, uint64(m.KvBatchDelReq.Size()))
-		n20, err := m.KvBatchDelReq.MarshalTo(dAtA[i:])
+		n22, err := m.KvBatchDelReq.MarshalTo(dAtA[i:])
 		if err != nil {
 			return 0, err
 		}
-		i += n20
+		i += n22
 	}
 	if m.KvRangeDelReq != nil {
 		dAtA[i] = 0x9a
@@ -938,11 +1175,35 @@ func (m *Command) MarshalTo(dAtA []byte) (int, error) {
 		dAtA[i] = 0x1
 		i++
 		i = encodeVarintRaftCmdpb(dAtA, i, uint64(m.KvRangeDelReq.Size()))
-		n21, err := m.KvRangeDelReq.MarshalTo(dAtA[i:])
+		n23, err := m.KvRangeDelReq.MarshalTo(dAtA[i:])
 		if err != nil {
 			return 0, err
 		}
-		i += n21
+		i += n23
+	}
+	if m.KvIncrReq != nil {
+		dAtA[i] = 0xaa
+		i++
+		dAtA[i] = 0x1
+		i++
+		i = encodeVarintRaftCmdpb(dAtA, i, uint64(m.KvIncrReq.Size()))
+		n24, err := m.KvIncrReq.MarshalTo(dAtA[i:])
+		if err != nil {
+			return 0, err
+		}
+		i += n24
+	}
+	if m.KvAppendReq != nil {
+		dAtA[i] = 0xb2
+		i++
+		dAtA[i] = 0x1
+		i++
+		i = encodeVarintRaftCmdpb(dAtA, i, uint64(m.KvAppendReq.Size()))
+		n25, err := m.KvAppendReq.MarshalTo(dAtA[i:])
+		if err != nil {
+			return 0, err
+		}
+		i += n25
 	}
 	if m.AdminSplitReq != nil {
 		dAtA[i] = 0xf2
@@ -950,11 +1211,11 @@ func (m *Command) MarshalTo(dAtA []byte) (int, error) {
 		dAtA[i] = 0x1
 		i++
 		i = encodeVarintRaftCmdpb(dAtA, i, uint64(m.AdminSplitReq.Size()))
-		n22, err := m.AdminSplitReq.MarshalTo(dAtA[i:])
+		n26, err := m.AdminSplitReq.MarshalTo(dAtA[i:])
 		if err != nil {
 			return 0, err
 		}
-		i += n22
+		i += n26
 	}
 	if m.AdminMergeReq != nil {
 		dAtA[i] = 0xfa
@@ -962,11 +1223,11 @@ func (m *Command) MarshalTo(dAtA []byte) (int, error) {
 		dAtA[i] = 0x1
 		i++
 		i = encodeVarintRaftCmdpb(dAtA, i, uint64(m.AdminMergeReq.Size()))
-		n23, err := m.AdminMergeReq.MarshalTo(dAtA[i:])
+		n27, err := m.AdminMergeReq.MarshalTo(dAtA[i:])
 		if err != nil {
 			return 0, err
 		}
-		i += n23
+		i += n27
 	}
 	if m.AdminLeaderChangeReq != nil {
 		dAtA[i] = 0x82
@@ -974,11 +1235,11 @@ func (m *Command) MarshalTo(dAtA []byte) (int, error) {
 		dAtA[i] = 0x2
 		i++
 		i = encodeVarintRaftCmdpb(dAtA, i, uint64(m.AdminLeaderChangeReq.Size()))
-		n24, err := m.AdminLeaderChangeReq.MarshalTo(dAtA[i:])
+		n28, err := m.AdminLeaderChangeReq.MarshalTo(dAtA[i:])
 		if err != nil {
 			return 0, err
 		}
-		i += n24
+		i += n28
 	}
 	if m.LockReq != nil {
 		dAtA[i] = 0xc2
@@ -986,11 +1247,11 @@ func (m *Command) MarshalTo(dAtA []byte) (int, error) {
 		dAtA[i] = 0x2
 		i++
 		i = encodeVarintRaftCmdpb(dAtA, i, uint64(m.LockReq.Size()))
-		n25, err := m.LockReq.MarshalTo(dAtA[i:])
+		n29, err := m.LockReq.MarshalTo(dAtA[i:])
 		if err != nil {
 			return 0, err
 		}
-		i += n25
+		i += n29
 	}
 	if m.LockUpdateReq != nil {
 		dAtA[i] = 0xca
@@ -998,11 +1259,11 @@ func (m *Command) MarshalTo(dAtA []byte) (int, error) {
 		dAtA[i] = 0x2
 		i++
 		i = encodeVarintRaftCmdpb(dAtA, i, uint64(m.LockUpdateReq.Size()))
-		n26, err := m.LockUpdateReq.MarshalTo(dAtA[i:])
+		n30, err := m.LockUpdateReq.MarshalTo(dAtA[i:])
 		if err != nil {
 			return 0, err
 		}
-		i += n26
+		i += n30
 	}
 	if m.UnlockReq != nil {
 		dAtA[i] = 0xd2
@@ -1010,11 +1271,11 @@ func (m *Command) MarshalTo(dAtA []byte) (int, error) {
 		dAtA[i] = 0x2
 		i++
 		i = encodeVarintRaftCmdpb(dAtA, i, uint64(m.UnlockReq.Size()))
-		n27, err := m.UnlockReq.MarshalTo(dAtA[i:])
+		n31, err := m.UnlockReq.MarshalTo(dAtA[i:])
 		if err != nil {
 			return 0, err
 		}
-		i += n27
+		i += n31
 	}
 	if m.UnlockForceReq != nil {
 		dAtA[i] = 0xda
@@ -1022,11 +1283,30 @@ func (m *Command) MarshalTo(dAtA []byte) (int, error) {
 		dAtA[i] = 0x2
 		i++
 		i = encodeVarintRaftCmdpb(dAtA, i, uint64(m.UnlockForceReq.Size()))
-		n28, err := m.UnlockForceReq.MarshalTo(dAtA[i:])
+		n32, err := m.UnlockForceReq.MarshalTo(dAtA[i:])
 		if err != nil {
 			return 0, err
 		}
-		i += n28
+		i += n32
+	}
+	if m.LockReapReq != nil {
+		dAtA[i] = 0xe2
+		i++
+		dAtA[i] = 0x2
+		i++
+		i = encodeVarintRaftCmdpb(dAtA, i, uint64(m.LockReapReq.Size()))
+		n33, err := m.LockReapReq.MarshalTo(dAtA[i:])
+		if err != nil {
+			return 0, err
+		}
+		i += n33
+	}
+	if m.ExpireAt != 0 {
+		dAtA[i] = 0x90
+		i++
+		dAtA[i] = 0x3
+		i++
+		i = encodeVarintRaftCmdpb(dAtA, i, uint64(m.ExpireAt))
 	}
 	return i, nil
 }
@@ -1050,21 +1330,21 @@ func (m *PeerTask) MarshalTo(dAtA []byte) (int, error) {
 		dAtA[i] = 0xa
 		i++
 		i = encodeVarintRaftCmdpb(dAtA, i, uint64(m.VerifyEpoch.Size()))
-		n29, err := m.VerifyEpoch.MarshalTo(dAtA[i:])
+		n34, err := m.VerifyEpoch.MarshalTo(dAtA[i:])
 		if err != nil {
 			return 0, err
 		}
-		i += n29
+		i += n34
 	}
 	if m.Peer != nil {
 		dAtA[i] = 0x12
 		i++
 		i = encodeVarintRaftCmdpb(dAtA, i, uint64(m.Peer.Size()))
-		n30, err := m.Peer.MarshalTo(dAtA[i:])
+		n35, err := m.Peer.MarshalTo(dAtA[i:])
 		if err != nil {
 			return 0, err
 		}
-		i += n30
+		i += n35
 	}
 	return i, nil
 }
@@ -1118,11 +1398,16 @@ func (m *SnapshotContext) MarshalTo(dAtA []byte) (int, error) {
 		dAtA[i] = 0xa
 		i++
 		i = encodeVarintRaftCmdpb(dAtA, i, uint64(m.Meta.Size()))
-		n31, err := m.Meta.MarshalTo(dAtA[i:])
+		n36, err := m.Meta.MarshalTo(dAtA[i:])
 		if err != nil {
 			return 0, err
 		}
-		i += n31
+		i += n36
+	}
+	if m.ValueFormat != 0 {
+		dAtA[i] = 0x10
+		i++
+		i = encodeVarintRaftCmdpb(dAtA, i, uint64(m.ValueFormat))
 	}
 	return i, nil
 }
@@ -1166,6 +1451,17 @@ func (m *SplitResponse) Size() (n int) {
 func (m *MergeRequest) Size() (n int) {
 	var l int
 	_ = l
+	if m.Commit {
+		n += 2
+	}
+	if m.Target != nil {
+		l = m.Target.Size()
+		n += 1 + l + sovRaftCmdpb(uint64(l))
+	}
+	if m.Source != nil {
+		l = m.Source.Size()
+		n += 1 + l + sovRaftCmdpb(uint64(l))
+	}
 	return n
 }
 
@@ -1194,6 +1490,32 @@ func (m *LeaderChangeResponse) Size() (n int) {
 	return n
 }
 
+func (m *LockReapRequest) Size() (n int) {
+	var l int
+	_ = l
+	if len(m.Locks) > 0 {
+		for _, e := range m.Locks {
+			l = e.Size()
+			n += 1 + l + sovRaftCmdpb(uint64(l))
+		}
+	}
+	return n
+}
+
+func (m *ReapLock) Size() (n int) {
+	var l int
+	_ = l
+	l = len(m.Key)
+	if l > 0 {
+		n += 1 + l + sovRaftCmdpb(uint64(l))
+	}
+	l = len(m.Id)
+	if l > 0 {
+		n += 1 + l + sovRaftCmdpb(uint64(l))
+	}
+	return n
+}
+
 func (m *CmdID) Size() (n int) {
 	var l int
 	_ = l
@@ -1284,6 +1606,14 @@ func (m *Command) Size() (n int) {
 		l = m.KvRangeDelReq.Size()
 		n += 2 + l + sovRaftCmdpb(uint64(l))
 	}
+	if m.KvIncrReq != nil {
+		l = m.KvIncrReq.Size()
+		n += 2 + l + sovRaftCmdpb(uint64(l))
+	}
+	if m.KvAppendReq != nil {
+		l = m.KvAppendReq.Size()
+		n += 2 + l + sovRaftCmdpb(uint64(l))
+	}
 	if m.AdminSplitReq != nil {
 		l = m.AdminSplitReq.Size()
 		n += 2 + l + sovRaftCmdpb(uint64(l))
@@ -1312,6 +1642,13 @@ func (m *Command) Size() (n int) {
 		l = m.UnlockForceReq.Size()
 		n += 2 + l + sovRaftCmdpb(uint64(l))
 	}
+	if m.LockReapReq != nil {
+		l = m.LockReapReq.Size()
+		n += 2 + l + sovRaftCmdpb(uint64(l))
+	}
+	if m.ExpireAt != 0 {
+		n += 2 + sovRaftCmdpb(uint64(m.ExpireAt))
+	}
 	return n
 }
 
@@ -1350,6 +1687,9 @@ func (m *SnapshotContext) Size() (n int) {
 		l = m.Meta.Size()
 		n += 1 + l + sovRaftCmdpb(uint64(l))
 	}
+	if m.ValueFormat != 0 {
+		n += 1 + sovRaftCmdpb(uint64(m.ValueFormat))
+	}
 	return n
 }
 
@@ -1545,22 +1885,310 @@ func (m *SplitResponse) Unmarshal(dAtA []byte) error {
 			if iNdEx >= l {
 				return io.ErrUnexpectedEOF
 			}
-			b := dAtA[iNdEx]
-			iNdEx++
-			wire |= (uint64(b) & 0x7F) << shift
-			if b < 0x80 {
-				break
+			b := dAtA[iNdEx]
+			iNdEx++
+			wire |= (uint64(b) & 0x7F) << shift
+			if b < 0x80 {
+				break
+			}
+		}
+		fieldNum := int32(wire >> 3)
+		wireType := int(wire & 0x7)
+		if wireType == 4 {
+			return fmt.Errorf("proto: SplitResponse: wiretype end group for non-group")
+		}
+		if fieldNum <= 0 {
+			return fmt.Errorf("proto: SplitResponse: illegal tag %d (wire type %d)", fieldNum, wire)
+		}
+		switch fieldNum {
+		default:
+			iNdEx = preIndex
+			skippy, err := skipRaftCmdpb(dAtA[iNdEx:])
+			if err != nil {
+				return err
+			}
+			if skippy < 0 {
+				return ErrInvalidLengthRaftCmdpb
+			}
+			if (iNdEx + skippy) > l {
+				return io.ErrUnexpectedEOF
+			}
+			iNdEx += skippy
+		}
+	}
+
+	if iNdEx > l {
+		return io.ErrUnexpectedEOF
+	}
+	return nil
+}
+func (m *MergeRequest) Unmarshal(dAtA []byte) error {
+	l := len(dAtA)
+	iNdEx := 0
+	for iNdEx < l {
+		preIndex := iNdEx
+		var wire uint64
+		for shift := uint(0); ; shift += 7 {
+			if shift >= 64 {
+				return ErrIntOverflowRaftCmdpb
+			}
+			if iNdEx >= l {
+				return io.ErrUnexpectedEOF
+			}
+			b := dAtA[iNdEx]
+			iNdEx++
+			wire |= (uint64(b) & 0x7F) << shift
+			if b < 0x80 {
+				break
+			}
+		}
+		fieldNum := int32(wire >> 3)
+		wireType := int(wire & 0x7)
+		if wireType == 4 {
+			return fmt.Errorf("proto: MergeRequest: wiretype end group for non-group")
+		}
+		if fieldNum <= 0 {
+			return fmt.Errorf("proto: MergeRequest: illegal tag %d (wire type %d)", fieldNum, wire)
+		}
+		switch fieldNum {
+		case 1:
+			if wireType != 0 {
+				return fmt.Errorf("proto: wrong wireType = %d for field Commit", wireType)
+			}
+			var v int
+			for shift := uint(0); ; shift += 7 {
+				if shift >= 64 {
+					return ErrIntOverflowRaftCmdpb
+				}
+				if iNdEx >= l {
+					return io.ErrUnexpectedEOF
+				}
+				b := dAtA[iNdEx]
+				iNdEx++
+				v |= (int(b) & 0x7F) << shift
+				if b < 0x80 {
+					break
+				}
+			}
+			m.Commit = bool(v != 0)
+		case 2:
+			if wireType != 2 {
+				return fmt.Errorf("proto: wrong wireType = %d for field Target", wireType)
+			}
+			var msglen int
+			for shift := uint(0); ; shift += 7 {
+				if shift >= 64 {
+					return ErrIntOverflowRaftCmdpb
+				}
+				if iNdEx >= l {
+					return io.ErrUnexpectedEOF
+				}
+				b := dAtA[iNdEx]
+				iNdEx++
+				msglen |= (int(b) & 0x7F) << shift
+				if b < 0x80 {
+					break
+				}
+			}
+			if msglen < 0 {
+				return ErrInvalidLengthRaftCmdpb
+			}
+			postIndex := iNdEx + msglen
+			if postIndex > l {
+				return io.ErrUnexpectedEOF
+			}
+			if m.Target == nil {
+				m.Target = &metapb.Range{}
+			}
+			if err := m.Target.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
+				return err
+			}
+			iNdEx = postIndex
+		case 3:
+			if wireType != 2 {
+				return fmt.Errorf("proto: wrong wireType = %d for field Source", wireType)
+			}
+			var msglen int
+			for shift := uint(0); ; shift += 7 {
+				if shift >= 64 {
+					return ErrIntOverflowRaftCmdpb
+				}
+				if iNdEx >= l {
+					return io.ErrUnexpectedEOF
+				}
+				b := dAtA[iNdEx]
+				iNdEx++
+				msglen |= (int(b) & 0x7F) << shift
+				if b < 0x80 {
+					break
+				}
+			}
+			if msglen < 0 {
+				return ErrInvalidLengthRaftCmdpb
+			}
+			postIndex := iNdEx + msglen
+			if postIndex > l {
+				return io.ErrUnexpectedEOF
+			}
+			if m.Source == nil {
+				m.Source = &metapb.Range{}
+			}
+			if err := m.Source.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
+				return err
+			}
+			iNdEx = postIndex
+		default:
+			iNdEx = preIndex
+			skippy, err := skipRaftCmdpb(dAtA[iNdEx:])
+			if err != nil {
+				return err
+			}
+			if skippy < 0 {
+				return ErrInvalidLengthRaftCmdpb
+			}
+			if (iNdEx + skippy) > l {
+				return io.ErrUnexpectedEOF
+			}
+			iNdEx += skippy
+		}
+	}
+
+	if iNdEx > l {
+		return io.ErrUnexpectedEOF
+	}
+	return nil
+}
+func (m *MergeResponse) Unmarshal(dAtA []byte) error {
+	l := len(dAtA)
+	iNdEx := 0
+	for iNdEx < l {
+		preIndex := iNdEx
+		var wire uint64
+		for shift := uint(0); ; shift += 7 {
+			if shift >= 64 {
+				return ErrIntOverflowRaftCmdpb
+			}
+			if iNdEx >= l {
+				return io.ErrUnexpectedEOF
+			}
+			b := dAtA[iNdEx]
+			iNdEx++
+			wire |= (uint64(b) & 0x7F) << shift
+			if b < 0x80 {
+				break
+			}
+		}
+		fieldNum := int32(wire >> 3)
+		wireType := int(wire & 0x7)
+		if wireType == 4 {
+			return fmt.Errorf("proto: MergeResponse: wiretype end group for non-group")
+		}
+		if fieldNum <= 0 {
+			return fmt.Errorf("proto: MergeResponse: illegal tag %d (wire type %d)", fieldNum, wire)
+		}
+		switch fieldNum {
+		default:
+			iNdEx = preIndex
+			skippy, err := skipRaftCmdpb(dAtA[iNdEx:])
+			if err != nil {
+				return err
+			}
+			if skippy < 0 {
+				return ErrInvalidLengthRaftCmdpb
+			}
+			if (iNdEx + skippy) > l {
+				return io.ErrUnexpectedEOF
+			}
+			iNdEx += skippy
+		}
+	}
+
+	if iNdEx > l {
+		return io.ErrUnexpectedEOF
+	}
+	return nil
+}
+func (m *LeaderChangeRequest) Unmarshal(dAtA []byte) error {
+	l := len(dAtA)
+	iNdEx := 0
+	for iNdEx < l {
+		preIndex := iNdEx
+		var wire uint64
+		for shift := uint(0); ; shift += 7 {
+			if shift >= 64 {
+				return ErrIntOverflowRaftCmdpb
+			}
+			if iNdEx >= l {
+				return io.ErrUnexpectedEOF
+			}
+			b := dAtA[iNdEx]
+			iNdEx++
+			wire |= (uint64(b) & 0x7F) << shift
+			if b < 0x80 {
+				break
+			}
+		}
+		fieldNum := int32(wire >> 3)
+		wireType := int(wire & 0x7)
+		if wireType == 4 {
+			return fmt.Errorf("proto: LeaderChangeRequest: wiretype end group for non-group")
+		}
+		if fieldNum <= 0 {
+			return fmt.Errorf("proto: LeaderChangeRequest: illegal tag %d (wire type %d)", fieldNum, wire)
+		}
+		switch fieldNum {
+		case 1:
+			if wireType != 0 {
+				return fmt.Errorf("proto: wrong wireType = %d for field RangeId", wireType)
+			}
+			m.RangeId = 0
+			for shift := uint(0); ; shift += 7 {
+				if shift >= 64 {
+					return ErrIntOverflowRaftCmdpb
+				}
+				if iNdEx >= l {
+					return io.ErrUnexpectedEOF
+				}
+				b := dAtA[iNdEx]
+				iNdEx++
+				m.RangeId |= (uint64(b) & 0x7F) << shift
+				if b < 0x80 {
+					break
+				}
+			}
+		case 2:
+			if wireType != 2 {
+				return fmt.Errorf("proto: wrong wireType = %d for field Epoch", wireType)
+			}
+			var msglen int
+			for shift := uint(0); ; shift += 7 {
+				if shift >= 64 {
+					return ErrIntOverflowRaftCmdpb
+				}
+				if iNdEx >= l {
+					return io.ErrUnexpectedEOF
+				}
+				b := dAtA[iNdEx]
+				iNdEx++
+				msglen |= (int(b) & 0x7F) << shift
+				if b < 0x80 {
+					break
+				}
+			}
+			if msglen < 0 {
+				return ErrInvalidLengthRaftCmdpb
+			}
+			postIndex := iNdEx + msglen
+			if postIndex > l {
+				return io.ErrUnexpectedEOF
+			}
+			if m.Epoch == nil {
+				m.Epoch = &metapb.RangeEpoch{}
+			}
+			if err := m.Epoch.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
+				return err
 			}
-		}
-		fieldNum := int32(wire >> 3)
-		wireType := int(wire & 0x7)
-		if wireType == 4 {
-			return fmt.Errorf("proto: SplitResponse: wiretype end group for non-group")
-		}
-		if fieldNum <= 0 {
-			return fmt.Errorf("proto: SplitResponse: illegal tag %d (wire type %d)", fieldNum, wire)
-		}
-		switch fieldNum {
+			iNdEx = postIndex
 		default:
 			iNdEx = preIndex
 			skippy, err := skipRaftCmdpb(dAtA[iNdEx:])
@@ -1582,7 +2210,7 @@ func (m *SplitResponse) Unmarshal(dAtA []byte) error {
 	}
 	return nil
 }
-func (m *MergeRequest) Unmarshal(dAtA []byte) error {
+func (m *LeaderChangeResponse) Unmarshal(dAtA []byte) error {
 	l := len(dAtA)
 	iNdEx := 0
 	for iNdEx < l {
@@ -1605,10 +2233,10 @@ func (m *MergeRequest) Unmarshal(dAtA []byte) error {
 		fieldNum := int32(wire >> 3)
 		wireType := int(wire & 0x7)
 		if wireType == 4 {
-			return fmt.Errorf("proto: MergeRequest: wiretype end group for non-group")
+			return fmt.Errorf("proto: LeaderChangeResponse: wiretype end group for non-group")
 		}
 		if fieldNum <= 0 {
-			return fmt.Errorf("proto: MergeRequest: illegal tag %d (wire type %d)", fieldNum, wire)
+			return fmt.Errorf("proto: LeaderChangeResponse: illegal tag %d (wire type %d)", fieldNum, wire)
 		}
 		switch fieldNum {
 		default:
@@ -1632,7 +2260,7 @@ func (m *MergeRequest) Unmarshal(dAtA []byte) error {
 	}
 	return nil
 }
-func (m *MergeResponse) Unmarshal(dAtA []byte) error {
+func (m *LockReapRequest) Unmarshal(dAtA []byte) error {
 	l := len(dAtA)
 	iNdEx := 0
 	for iNdEx < l {
@@ -1655,12 +2283,43 @@ func (m *MergeResponse) Unmarshal(dAtA []byte) error {
 		fieldNum := int32(wire >> 3)
 		wireType := int(wire & 0x7)
 		if wireType == 4 {
-			return fmt.Errorf("proto: MergeResponse: wiretype end group for non-group")
+			return fmt.Errorf("proto: LockReapRequest: wiretype end group for non-group")
 		}
 		if fieldNum <= 0 {
-			return fmt.Errorf("proto: MergeResponse: illegal tag %d (wire type %d)", fieldNum, wire)
+			return fmt.Errorf("proto: LockReapRequest: illegal tag %d (wire type %d)", fieldNum, wire)
 		}
 		switch fieldNum {
+		case 1:
+			if wireType != 2 {
+				return fmt.Errorf("proto: wrong wireType = %d for field Locks", wireType)
+			}
+			var msglen int
+			for shift := uint(0); ; shift += 7 {
+				if shift >= 64 {
+					return ErrIntOverflowRaftCmdpb
+				}
+				if iNdEx >= l {
+					return io.ErrUnexpectedEOF
+				}
+				b := dAtA[iNdEx]
+				iNdEx++
+				msglen |= (int(b) & 0x7F) << shift
+				if b < 0x80 {
+					break
+				}
+			}
+			if msglen < 0 {
+				return ErrInvalidLengthRaftCmdpb
+			}
+			postIndex := iNdEx + msglen
+			if postIndex > l {
+				return io.ErrUnexpectedEOF
+			}
+			m.Locks = append(m.Locks, &ReapLock{})
+			if err := m.Locks[len(m.Locks)-1].Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
+				return err
+			}
+			iNdEx = postIndex
 		default:
 			iNdEx = preIndex
 			skippy, err := skipRaftCmdpb(dAtA[iNdEx:])
@@ -1682,7 +2341,7 @@ func (m *MergeResponse) Unmarshal(dAtA []byte) error {
 	}
 	return nil
 }
-func (m *LeaderChangeRequest) Unmarshal(dAtA []byte) error {
+func (m *ReapLock) Unmarshal(dAtA []byte) error {
 	l := len(dAtA)
 	iNdEx := 0
 	for iNdEx < l {
@@ -1705,17 +2364,17 @@ func (m *LeaderChangeRequest) Unmarshal(dAtA []byte) error {
 		fieldNum := int32(wire >> 3)
 		wireType := int(wire & 0x7)
 		if wireType == 4 {
-			return fmt.Errorf("proto: LeaderChangeRequest: wiretype end group for non-group")
+			return fmt.Errorf("proto: ReapLock: wiretype end group for non-group")
 		}
 		if fieldNum <= 0 {
-			return fmt.Errorf("proto: LeaderChangeRequest: illegal tag %d (wire type %d)", fieldNum, wire)
+			return fmt.Errorf("proto: ReapLock: illegal tag %d (wire type %d)", fieldNum, wire)
 		}
 		switch fieldNum {
 		case 1:
-			if wireType != 0 {
-				return fmt.Errorf("proto: wrong wireType = %d for field RangeId", wireType)
+			if wireType != 2 {
+				return fmt.Errorf("proto: wrong wireType = %d for field Key", wireType)
 			}
-			m.RangeId = 0
+			var byteLen int
 			for shift := uint(0); ; shift += 7 {
 				if shift >= 64 {
 					return ErrIntOverflowRaftCmdpb
@@ -1725,16 +2384,28 @@ func (m *LeaderChangeRequest) Unmarshal(dAtA []byte) error {
 				}
 				b := dAtA[iNdEx]
 				iNdEx++
-				m.RangeId |= (uint64(b) & 0x7F) << shift
+				byteLen |= (int(b) & 0x7F) << shift
 				if b < 0x80 {
 					break
 				}
 			}
+			if byteLen < 0 {
+				return ErrInvalidLengthRaftCmdpb
+			}
+			postIndex := iNdEx + byteLen
+			if postIndex > l {
+				return io.ErrUnexpectedEOF
+			}
+			m.Key = append(m.Key[:0], dAtA[iNdEx:postIndex]...)
+			if m.Key == nil {
+				m.Key = []byte{}
+			}
+			iNdEx = postIndex
 		case 2:
 			if wireType != 2 {
-				return fmt.Errorf("proto: wrong wireType = %d for field Epoch", wireType)
+				return fmt.Errorf("proto: wrong wireType = %d for field Id", wireType)
 			}
-			var msglen int
+			var stringLen uint64
 			for shift := uint(0); ; shift += 7 {
 				if shift >= 64 {
 					return ErrIntOverflowRaftCmdpb
@@ -1744,24 +2415,20 @@ func (m *LeaderChangeRequest) Unmarshal(dAtA []byte) error {
 				}
 				b := dAtA[iNdEx]
 				iNdEx++
-				msglen |= (int(b) & 0x7F) << shift
+				stringLen |= (uint64(b) & 0x7F) << shift
 				if b < 0x80 {
 					break
 				}
 			}
-			if msglen < 0 {
+			intStringLen := int(stringLen)
+			if intStringLen < 0 {
 				return ErrInvalidLengthRaftCmdpb
 			}
-			postIndex := iNdEx + msglen
+			postIndex := iNdEx + intStringLen
 			if postIndex > l {
 				return io.ErrUnexpectedEOF
 			}
-			if m.Epoch == nil {
-				m.Epoch = &metapb.RangeEpoch{}
-			}
-			if err := m.Epoch.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
-				return err
-			}
+			m.Id = string(dAtA[iNdEx:postIndex])
 			iNdEx = postIndex
 		default:
 			iNdEx = preIndex
@@ -1784,56 +2451,6 @@ func (m *LeaderChangeRequest) Unmarshal(dAtA []byte) error {
 	}
 	return nil
 }
-func (m *LeaderChangeResponse) Unmarshal(dAtA []byte) error {
-	l := len(dAtA)
-	iNdEx := 0
-	for iNdEx < l {
-		preIndex := iNdEx
-		var wire uint64
-		for shift := uint(0); ; shift += 7 {
-			if shift >= 64 {
-				return ErrIntOverflowRaftCmdpb
-			}
-			if iNdEx >= l {
-				return io.ErrUnexpectedEOF
-			}
-			b := dAtA[iNdEx]
-			iNdEx++
-			wire |= (uint64(b) & 0x7F) << shift
-			if b < 0x80 {
-				break
-			}
-		}
-		fieldNum := int32(wire >> 3)
-		wireType := int(wire & 0x7)
-		if wireType == 4 {
-			return fmt.Errorf("proto: LeaderChangeResponse: wiretype end group for non-group")
-		}
-		if fieldNum <= 0 {
-			return fmt.Errorf("proto: LeaderChangeResponse: illegal tag %d (wire type %d)", fieldNum, wire)
-		}
-		switch fieldNum {
-		default:
-			iNdEx = preIndex
-			skippy, err := skipRaftCmdpb(dAtA[iNdEx:])
-			if err != nil {
-				return err
-			}
-			if skippy < 0 {
-				return ErrInvalidLengthRaftCmdpb
-			}
-			if (iNdEx + skippy) > l {
-				return io.ErrUnexpectedEOF
-			}
-			iNdEx += skippy
-		}
-	}
-
-	if iNdEx > l {
-		return io.ErrUnexpectedEOF
-	}
-	return nil
-}
 func (m *CmdID) Unmarshal(dAtA []byte) error {
 	l := len(dAtA)
 	iNdEx := 0
@@ -2564,6 +3181,72 @@ func (m *Command) Unmarshal(dAtA []byte) error {
 				return err
 			}
 			iNdEx = postIndex
+		case 21:
+			if wireType != 2 {
+				return fmt.Errorf("proto: wrong wireType = %d for field KvIncrReq", wireType)
+			}
+			var msglen int
+			for shift := uint(0); ; shift += 7 {
+				if shift >= 64 {
+					return ErrIntOverflowRaftCmdpb
+				}
+				if iNdEx >= l {
+					return io.ErrUnexpectedEOF
+				}
+				b := dAtA[iNdEx]
+				iNdEx++
+				msglen |= (int(b) & 0x7F) << shift
+				if b < 0x80 {
+					break
+				}
+			}
+			if msglen < 0 {
+				return ErrInvalidLengthRaftCmdpb
+			}
+			postIndex := iNdEx + msglen
+			if postIndex > l {
+				return io.ErrUnexpectedEOF
+			}
+			if m.KvIncrReq == nil {
+				m.KvIncrReq = &kvrpcpb.KvIncrRequest{}
+			}
+			if err := m.KvIncrReq.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
+				return err
+			}
+			iNdEx = postIndex
+		case 22:
+			if wireType != 2 {
+				return fmt.Errorf("proto: wrong wireType = %d for field KvAppendReq", wireType)
+			}
+			var msglen int
+			for shift := uint(0); ; shift += 7 {
+				if shift >= 64 {
+					return ErrIntOverflowRaftCmdpb
+				}
+				if iNdEx >= l {
+					return io.ErrUnexpectedEOF
+				}
+				b := dAtA[iNdEx]
+				iNdEx++
+				msglen |= (int(b) & 0x7F) << shift
+				if b < 0x80 {
+					break
+				}
+			}
+			if msglen < 0 {
+				return ErrInvalidLengthRaftCmdpb
+			}
+			postIndex := iNdEx + msglen
+			if postIndex > l {
+				return io.ErrUnexpectedEOF
+			}
+			if m.KvAppendReq == nil {
+				m.KvAppendReq = &kvrpcpb.KvAppendRequest{}
+			}
+			if err := m.KvAppendReq.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
+				return err
+			}
+			iNdEx = postIndex
 		case 30:
 			if wireType != 2 {
 				return fmt.Errorf("proto: wrong wireType = %d for field AdminSplitReq", wireType)
@@ -2795,6 +3478,58 @@ func (m *Command) Unmarshal(dAtA []byte) error {
 				return err
 			}
 			iNdEx = postIndex
+		case 44:
+			if wireType != 2 {
+				return fmt.Errorf("proto: wrong wireType = %d for field LockReapReq", wireType)
+			}
+			var msglen int
+			for shift := uint(0); ; shift += 7 {
+				if shift >= 64 {
+					return ErrIntOverflowRaftCmdpb
+				}
+				if iNdEx >= l {
+					return io.ErrUnexpectedEOF
+				}
+				b := dAtA[iNdEx]
+				iNdEx++
+				msglen |= (int(b) & 0x7F) << shift
+				if b < 0x80 {
+					break
+				}
+			}
+			if msglen < 0 {
+				return ErrInvalidLengthRaftCmdpb
+			}
+			postIndex := iNdEx + msglen
+			if postIndex > l {
+				return io.ErrUnexpectedEOF
+			}
+			if m.LockReapReq == nil {
+				m.LockReapReq = &LockReapRequest{}
+			}
+			if err := m.LockReapReq.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
+				return err
+			}
+			iNdEx = postIndex
+		case 50:
+			if wireType != 0 {
+				return fmt.Errorf("proto: wrong wireType = %d for field ExpireAt", wireType)
+			}
+			m.ExpireAt = 0
+			for shift := uint(0); ; shift += 7 {
+				if shift >= 64 {
+					return ErrIntOverflowRaftCmdpb
+				}
+				if iNdEx >= l {
+					return io.ErrUnexpectedEOF
+				}
+				b := dAtA[iNdEx]
+				iNdEx++
+				m.ExpireAt |= (uint64(b) & 0x7F) << shift
+				if b < 0x80 {
+					break
+				}
+			}
 		default:
 			iNdEx = preIndex
 			skippy, err := skipRaftCmdpb(dAtA[iNdEx:])
@@ -3106,6 +3841,25 @@ func (m *SnapshotContext) Unmarshal(dAtA []byte) error {
 				return err
 			}
 			iNdEx = postIndex
+		case 2:
+			if wireType != 0 {
+				return fmt.Errorf("proto: wrong wireType = %d for field ValueFormat", wireType)
+			}
+			m.ValueFormat = 0
+			for shift := uint(0); ; shift += 7 {
+				if shift >= 64 {
+					return ErrIntOverflowRaftCmdpb
+				}
+				if iNdEx >= l {
+					return io.ErrUnexpectedEOF
+				}
+				b := dAtA[iNdEx]
+				iNdEx++
+				m.ValueFormat |= (SnapshotValueFormat(b) & 0x7F) << shift
+				if b < 0x80 {
+					break
+				}
+			}
 		default:
 			iNdEx = preIndex
 			skippy, err := skipRaftCmdpb(dAtA[iNdEx:])
@@ -3235,74 +3989,89 @@ var (
 func init() { proto.RegisterFile("raft_cmdpb.proto", fileDescriptorRaftCmdpb) }
 
 var fileDescriptorRaftCmdpb = []byte{
-	// 1097 bytes of a gzipped FileDescriptorProto
-	0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0x8c, 0x56, 0xcd, 0x6e, 0xdb, 0x46,
-	0x10, 0x0e, 0x1d, 0xfd, 0x50, 0xa3, 0xbf, 0xf5, 0x5a, 0x71, 0x5c, 0xa7, 0x95, 0x55, 0x9d, 0x14,
-	0x07, 0x70, 0x00, 0xa7, 0x29, 0x7a, 0x68, 0x81, 0xc6, 0xbf, 0x10, 0x9c, 0x02, 0x06, 0x9d, 0xe4,
-	0xd0, 0x0b, 0x41, 0x93, 0x6b, 0x5b, 0x20, 0x45, 0xd2, 0x24, 0x25, 0xc7, 0x6f, 0xd2, 0xbe, 0x51,
-	0x8f, 0x7d, 0x84, 0xc0, 0x7d, 0x8a, 0xde, 0x8a, 0x9d, 0xdd, 0x25, 0x97, 0x94, 0x81, 0xf4, 0x36,
-	0x7f, 0xdf, 0x37, 0x33, 0xdc, 0xd9, 0x59, 0x02, 0x49, 0x9c, 0xab, 0xcc, 0x76, 0xe7, 0x5e, 0x7c,
-	0xb9, 0x17, 0x27, 0x51, 0x16, 0x51, 0x28, 0x2c, 0xdb, 0x9d, 0x39, 0xcb, 0x1c, 0xe5, 0xd9, 0xee,
-	0xfa, 0xcb, 0x24, 0x76, 0x73, 0x75, 0x70, 0x1d, 0x5d, 0x47, 0x28, 0xbe, 0xe6, 0x92, 0xb0, 0x8e,
-	0xff, 0x34, 0xa0, 0x73, 0x11, 0x07, 0xb3, 0xcc, 0x62, 0xb7, 0x0b, 0x96, 0x66, 0x74, 0x13, 0x1a,
-	0x01, 0x73, 0x3c, 0x96, 0x6c, 0x19, 0x23, 0x63, 0x52, 0xb3, 0xa4, 0x46, 0x5f, 0x40, 0x2b, 0xe5,
-	0x71, 0xb6, 0xcf, 0xee, 0xb7, 0xd6, 0x46, 0xc6, 0xa4, 0x63, 0x99, 0x68, 0x38, 0x63, 0xf7, 0x74,
-	0x02, 0x75, 0x16, 0x47, 0xee, 0xcd, 0xd6, 0xd3, 0x91, 0x31, 0x69, 0xef, 0xd3, 0x3d, 0x59, 0x88,
-	0xe5, 0x84, 0xd7, 0xec, 0x98, 0x7b, 0x2c, 0x11, 0x40, 0x77, 0xa1, 0x15, 0xb2, 0x3b, 0x3b, 0xe1,
-	0x8e, 0xad, 0x1a, 0x46, 0x77, 0x4b, 0xd1, 0x96, 0x19, 0xb2, 0x3b, 0x94, 0xc6, 0x7d, 0xe8, 0xca,
-	0xd2, 0xd2, 0x38, 0x0a, 0x53, 0x36, 0xee, 0x41, 0xe7, 0x37, 0x96, 0x5c, 0x33, 0x59, 0x2b, 0x0f,
-	0x90, 0xba, 0x0c, 0xf8, 0x1d, 0x36, 0xde, 0x63, 0xb9, 0x87, 0x37, 0xc8, 0x25, 0x7b, 0xfa, 0x06,
-	0x4c, 0x4c, 0x68, 0xcf, 0x3c, 0xd9, 0x55, 0x13, 0xf5, 0xa9, 0x57, 0x54, 0xbe, 0xf6, 0x95, 0xca,
-	0xc7, 0x9b, 0x30, 0x28, 0x73, 0xcb, 0x9c, 0xfb, 0x50, 0x3f, 0x9c, 0x7b, 0xd3, 0x23, 0xfa, 0x1c,
-	0x9a, 0x61, 0xe4, 0x69, 0x49, 0x1a, 0x5c, 0x9d, 0x7a, 0x94, 0xc0, 0xd3, 0x94, 0xdd, 0x62, 0x86,
-	0x9a, 0xc5, 0xc5, 0xf1, 0x97, 0x0e, 0x34, 0x0f, 0xa3, 0xf9, 0xdc, 0x09, 0x79, 0x05, 0x0d, 0x77,
-	0xee, 0x29, 0x54, 0x7b, 0x7f, 0x7d, 0x4f, 0x3b, 0x63, 0x64, 0xb6, 0xea, 0xee, 0xdc, 0x9b, 0x7a,
-	0x74, 0x0f, 0x4c, 0x1e, 0x99, 0xdd, 0xc7, 0x0c, 0xc9, 0x7a, 0xfb, 0x1b, 0x95, 0xd8, 0x0f, 0xf7,
-	0x31, 0xb3, 0x9a, 0xae, 0x10, 0xe8, 0x5b, 0xe8, 0x2c, 0x59, 0x32, 0xbb, 0xba, 0xb7, 0xbf, 0x76,
-	0x38, 0x6d, 0x11, 0x87, 0x0a, 0xfd, 0x05, 0x7a, 0xfe, 0xd2, 0x4e, 0x9c, 0x3b, 0xfb, 0x9a, 0x65,
-	0x76, 0xc2, 0x6e, 0xe5, 0x39, 0x6d, 0xed, 0xa9, 0x81, 0x3a, 0x5b, 0x5a, 0xce, 0xdd, 0x29, 0x53,
-	0x33, 0x63, 0xb5, 0xfd, 0xc2, 0xa0, 0xc1, 0xe3, 0x85, 0x80, 0xd7, 0x1f, 0x83, 0x9f, 0x2f, 0x2a,
-	0x70, 0x61, 0xa0, 0x27, 0xb0, 0x2e, 0xe1, 0x1e, 0x0b, 0x58, 0xc6, 0x90, 0xa1, 0x81, 0x0c, 0x2f,
-	0xca, 0x0c, 0x47, 0xe8, 0x57, 0x24, 0x3d, 0xbf, 0x64, 0xa3, 0x53, 0xa0, 0x92, 0x87, 0x7d, 0x66,
-	0xee, 0x42, 0x12, 0x35, 0x91, 0xe8, 0xdb, 0x32, 0xd1, 0xb1, 0x08, 0x50, 0x4c, 0x7d, 0xbf, 0x6c,
-	0xa4, 0x6f, 0x01, 0x52, 0x16, 0x30, 0x57, 0x74, 0x63, 0x22, 0xc5, 0x66, 0x4e, 0x71, 0x81, 0x2e,
-	0x05, 0x6e, 0xa5, 0x4a, 0xe5, 0xb0, 0x59, 0x98, 0xb2, 0x44, 0xc0, 0x5a, 0x15, 0xd8, 0x14, 0x5d,
-	0x39, 0x6c, 0xa6, 0x54, 0x0e, 0xd3, 0x3a, 0x87, 0x0a, 0xac, 0xdc, 0x74, 0xcb, 0xcb, 0xfb, 0x3d,
-	0x06, 0x72, 0xe9, 0x64, 0xee, 0x8d, 0xad, 0xe5, 0x6c, 0x57, 0x3e, 0xdb, 0x01, 0x0f, 0x28, 0x27,
-	0xee, 0x5d, 0x96, 0x6c, 0xf4, 0x0d, 0x80, 0xbf, 0xb4, 0x53, 0x79, 0xf0, 0x1d, 0x24, 0x78, 0xa6,
-	0x7d, 0xae, 0x8b, 0xe2, 0xd4, 0x4d, 0x5f, 0x6a, 0x12, 0xa4, 0xa6, 0xa5, 0xbb, 0x02, 0x3a, 0x2d,
-	0x81, 0xe4, 0x9c, 0x1c, 0x02, 0xf1, 0x97, 0xb6, 0xa8, 0x59, 0xe5, 0xeb, 0x21, 0x74, 0x5b, 0x83,
-	0x62, 0xc9, 0x5a, 0xd2, 0xae, 0xaf, 0x9b, 0x4a, 0x24, 0x2a, 0x7f, 0xff, 0x71, 0x92, 0xd3, 0x55,
-	0x12, 0x59, 0xc9, 0x8f, 0xd0, 0xe6, 0x3d, 0xbb, 0x4e, 0x88, 0x78, 0x52, 0xf9, 0xe4, 0x67, 0xcb,
-	0x0b, 0xd7, 0x09, 0xf3, 0x4f, 0xee, 0x2b, 0x95, 0xfe, 0x0c, 0x5d, 0x7f, 0xa9, 0x8f, 0xe9, 0xfa,
-	0xca, 0xa0, 0x97, 0x8f, 0xab, 0xed, 0x17, 0x06, 0x7a, 0xa2, 0x95, 0xee, 0xb1, 0x00, 0x09, 0x28,
-	0x12, 0x7c, 0x57, 0x2d, 0xbd, 0xcc, 0xa2, 0xaa, 0x3f, 0x62, 0x41, 0xc1, 0x23, 0xf6, 0x9b, 0xe2,
-	0xd9, 0x58, 0xe1, 0xc1, 0xcb, 0xbe, 0xc2, 0xa3, 0xac, 0x9c, 0xe7, 0x57, 0xe8, 0x3b, 0xde, 0x7c,
-	0x16, 0xda, 0x62, 0xcd, 0x73, 0x9a, 0xa1, 0xec, 0x47, 0x5b, 0x32, 0xfa, 0x5b, 0x61, 0x75, 0x11,
-	0xa0, 0x4c, 0x05, 0xc3, 0x9c, 0x2f, 0x65, 0x64, 0xd8, 0x59, 0x65, 0xd0, 0x37, 0xb8, 0x64, 0x50,
-	0x26, 0xfa, 0x09, 0x9e, 0x0b, 0x06, 0xf1, 0xe8, 0xd8, 0x2e, 0xae, 0x5a, 0x64, 0x1a, 0x21, 0xd3,
-	0x8e, 0xce, 0xf4, 0xc8, 0xaa, 0xb7, 0x06, 0x88, 0xaf, 0x78, 0xe8, 0x6b, 0x30, 0x83, 0xc8, 0xf5,
-	0x91, 0x68, 0x82, 0x44, 0x83, 0xfc, 0xdb, 0xbc, 0x8f, 0x5c, 0x5f, 0xa1, 0x9b, 0x81, 0x50, 0xe8,
-	0x01, 0xf4, 0x11, 0xb0, 0x88, 0x3d, 0x47, 0x1e, 0xee, 0xcb, 0xca, 0x58, 0x71, 0xdc, 0x47, 0x74,
-	0xe7, 0xcd, 0x04, 0xba, 0x89, 0x5f, 0xe4, 0x45, 0x98, 0xa7, 0xdd, 0xad, 0x4c, 0xd5, 0xc7, 0x30,
-	0xd0, 0x12, 0xb7, 0x16, 0x4a, 0xe5, 0x17, 0x59, 0xc2, 0xae, 0xa2, 0xc4, 0x15, 0xb9, 0x5f, 0x55,
-	0x2e, 0xb2, 0x00, 0x9f, 0x70, 0x7f, 0x7e, 0x91, 0x17, 0x25, 0xdb, 0xd8, 0x05, 0xf3, 0x9c, 0xb1,
-	0xe4, 0x83, 0x93, 0xfa, 0x2b, 0x0f, 0x81, 0xf1, 0xff, 0x1e, 0x82, 0x11, 0xd4, 0x62, 0xc6, 0x12,
-	0xf9, 0x34, 0x76, 0x54, 0x38, 0xa7, 0xb5, 0xd0, 0x33, 0xfe, 0x09, 0x7a, 0x17, 0xa1, 0x13, 0xa7,
-	0x37, 0x51, 0x76, 0xf6, 0xe9, 0xdc, 0x99, 0x25, 0xfc, 0xad, 0xe3, 0x3f, 0x08, 0x06, 0xfe, 0x20,
-	0x70, 0x91, 0x0e, 0xa0, 0xbe, 0x74, 0x82, 0x05, 0x93, 0x3f, 0x0d, 0x42, 0x19, 0xff, 0x00, 0x7d,
-	0x85, 0x3c, 0x8c, 0xc2, 0x8c, 0x7d, 0xce, 0xe8, 0xf7, 0x50, 0xe3, 0x19, 0x64, 0x75, 0x95, 0xbf,
-	0x02, 0x74, 0xed, 0xfe, 0xbb, 0x06, 0x4d, 0xf9, 0xcc, 0xd1, 0x36, 0x34, 0xa7, 0xe1, 0xd2, 0x09,
-	0x66, 0x1e, 0x79, 0x42, 0x01, 0x1a, 0xe2, 0x05, 0x22, 0x86, 0x94, 0xcf, 0x17, 0x19, 0x59, 0xa3,
-	0x5d, 0x68, 0xe5, 0xaf, 0x02, 0x79, 0x4a, 0x7b, 0x00, 0xc5, 0x6a, 0x27, 0x35, 0x1e, 0x2a, 0xd6,
-	0x37, 0x69, 0x72, 0x59, 0xac, 0x41, 0x62, 0x72, 0x59, 0x62, 0x5a, 0x5c, 0x16, 0x67, 0x4a, 0x80,
-	0xe7, 0xb4, 0x58, 0x1c, 0x38, 0x2e, 0x23, 0x6d, 0xda, 0x87, 0xb6, 0xb6, 0x50, 0x49, 0x87, 0xb6,
-	0xa0, 0x8e, 0x0b, 0x92, 0x74, 0x85, 0xc8, 0xcb, 0xe9, 0xf1, 0x9c, 0xc5, 0x1a, 0x23, 0x7d, 0x4d,
-	0xe7, 0x7e, 0xc2, 0xf9, 0xc5, 0x86, 0x21, 0xeb, 0xb4, 0x03, 0xa6, 0xda, 0x19, 0x84, 0x6a, 0x91,
-	0x47, 0x2c, 0x20, 0x1b, 0x42, 0x57, 0x57, 0x96, 0x0c, 0xb8, 0xfe, 0x2e, 0xbf, 0x80, 0x64, 0x98,
-	0xeb, 0x78, 0x9d, 0xc8, 0x0e, 0x7d, 0x06, 0xeb, 0xef, 0xaa, 0xb7, 0x81, 0x8c, 0xa8, 0x09, 0x35,
-	0x3e, 0xbb, 0x64, 0xc2, 0x01, 0xc5, 0x14, 0x93, 0x97, 0xd8, 0x2a, 0x4e, 0x11, 0xd9, 0xe5, 0xdd,
-	0x69, 0x53, 0x46, 0x5e, 0x1d, 0x90, 0xbf, 0x1e, 0x86, 0xc6, 0xdf, 0x0f, 0x43, 0xe3, 0xcb, 0xc3,
-	0xd0, 0xf8, 0xe3, 0x9f, 0xe1, 0x93, 0xcb, 0x06, 0xfe, 0x42, 0xbe, 0xf9, 0x2f, 0x00, 0x00, 0xff,
-	0xff, 0x24, 0x62, 0xeb, 0xff, 0x95, 0x0a, 0x00, 0x00,
+	// 1337 bytes of a gzipped FileDescriptorProto
+	0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0x8c, 0x57, 0xdb, 0x6e, 0xdb, 0x46,
+	0x13, 0x8e, 0x6c, 0x1d, 0xa8, 0xd1, 0x69, 0xbd, 0x56, 0x1c, 0xfd, 0xc9, 0x5f, 0x47, 0x15, 0x50,
+	0x40, 0x71, 0x02, 0x07, 0x70, 0x90, 0xa2, 0x17, 0x0d, 0x5a, 0x1f, 0xe2, 0x54, 0x70, 0x0a, 0x18,
+	0x74, 0xe2, 0x8b, 0xde, 0x10, 0x34, 0xb9, 0xb1, 0x09, 0x52, 0x24, 0x43, 0x52, 0xb2, 0xfd, 0x26,
+	0xed, 0x65, 0xdf, 0xa1, 0x0f, 0xd1, 0xcb, 0x3e, 0x42, 0xe1, 0xbe, 0x48, 0xb1, 0xb3, 0xbb, 0xe4,
+	0x92, 0x32, 0x90, 0xde, 0xed, 0x1c, 0xbe, 0x6f, 0x66, 0x87, 0xb3, 0x33, 0x12, 0x90, 0xc4, 0xfe,
+	0x94, 0x59, 0xce, 0xdc, 0x8d, 0x2f, 0x76, 0xe3, 0x24, 0xca, 0x22, 0x0a, 0x85, 0xe6, 0x71, 0x77,
+	0xce, 0x32, 0x5b, 0x59, 0x1e, 0xf7, 0xfc, 0x65, 0x12, 0x3b, 0xb9, 0x38, 0xbc, 0x8c, 0x2e, 0x23,
+	0x3c, 0xbe, 0xe4, 0x27, 0xa1, 0x9d, 0xfc, 0x56, 0x83, 0xee, 0x59, 0x1c, 0x78, 0x99, 0xc9, 0x3e,
+	0x2f, 0x58, 0x9a, 0xd1, 0x2d, 0x68, 0x06, 0xcc, 0x76, 0x59, 0x32, 0xaa, 0x8d, 0x6b, 0xd3, 0xba,
+	0x29, 0x25, 0xfa, 0x04, 0xda, 0x29, 0xf7, 0xb3, 0x7c, 0x76, 0x3b, 0x5a, 0x1b, 0xd7, 0xa6, 0x5d,
+	0xd3, 0x40, 0xc5, 0x09, 0xbb, 0xa5, 0x53, 0x68, 0xb0, 0x38, 0x72, 0xae, 0x46, 0xeb, 0xe3, 0xda,
+	0xb4, 0xb3, 0x47, 0x77, 0x65, 0x22, 0xa6, 0x1d, 0x5e, 0xb2, 0xb7, 0xdc, 0x62, 0x0a, 0x07, 0xba,
+	0x03, 0xed, 0x90, 0x5d, 0x5b, 0x09, 0x37, 0x8c, 0xea, 0xe8, 0xdd, 0x2b, 0x79, 0x9b, 0x46, 0xc8,
+	0xae, 0xf1, 0x34, 0x19, 0x40, 0x4f, 0xa6, 0x96, 0xc6, 0x51, 0x98, 0xb2, 0x49, 0x06, 0xdd, 0x9f,
+	0x59, 0x72, 0xc9, 0xb4, 0x5c, 0x9d, 0x68, 0x3e, 0xf7, 0x32, 0xcc, 0xd5, 0x30, 0xa5, 0x44, 0xbf,
+	0x81, 0x66, 0x66, 0x27, 0x97, 0x2c, 0xc3, 0x44, 0x57, 0x22, 0x48, 0x23, 0x77, 0x4b, 0xa3, 0x45,
+	0xe2, 0x30, 0x99, 0x76, 0xd5, 0x4d, 0x18, 0x79, 0x1a, 0x32, 0xaa, 0x4c, 0xe3, 0x17, 0xd8, 0x7c,
+	0x8f, 0x45, 0x39, 0xbc, 0x42, 0x47, 0x99, 0xcd, 0xff, 0xc0, 0xc0, 0x6b, 0x59, 0x9e, 0x2b, 0x6b,
+	0xd7, 0x42, 0x79, 0xe6, 0x16, 0xf5, 0x59, 0xfb, 0x42, 0x7d, 0x26, 0x5b, 0x30, 0x2c, 0x73, 0xcb,
+	0x98, 0x6f, 0x60, 0xf0, 0x3e, 0x72, 0x7c, 0x93, 0xd9, 0xb1, 0x8a, 0xb7, 0x03, 0x8d, 0x20, 0x72,
+	0xfc, 0x74, 0x54, 0x1b, 0xaf, 0x4f, 0x3b, 0x7b, 0xc3, 0x5d, 0xad, 0x37, 0xb8, 0x1f, 0xfa, 0x0b,
+	0x97, 0xc9, 0x0b, 0x30, 0x94, 0x8a, 0x12, 0x58, 0xe7, 0xdf, 0xb0, 0x86, 0xdf, 0x90, 0x1f, 0x69,
+	0x1f, 0xd6, 0x3c, 0x17, 0x73, 0x6b, 0x9b, 0x6b, 0x9e, 0x3b, 0xd9, 0x83, 0xc6, 0xe1, 0xdc, 0x9d,
+	0x1d, 0xd1, 0x47, 0xd0, 0x0a, 0x23, 0x57, 0xbb, 0x51, 0x93, 0x8b, 0x33, 0x97, 0x73, 0xa4, 0xec,
+	0x33, 0x42, 0xea, 0x26, 0x3f, 0x4e, 0xfe, 0xe8, 0x43, 0xeb, 0x30, 0x9a, 0xcf, 0xed, 0x90, 0x5f,
+	0xb7, 0xe9, 0xcc, 0x5d, 0x85, 0xea, 0xec, 0x6d, 0xe8, 0xa9, 0x21, 0xb3, 0xd9, 0x70, 0xe6, 0xee,
+	0xcc, 0xa5, 0xbb, 0x60, 0x70, 0xcf, 0xec, 0x36, 0x66, 0x48, 0xd6, 0xdf, 0xdb, 0xac, 0xf8, 0x7e,
+	0xb8, 0x8d, 0x99, 0xd9, 0x72, 0xc4, 0x81, 0xbe, 0x86, 0xee, 0x92, 0x25, 0xde, 0xa7, 0x5b, 0xeb,
+	0x4b, 0xfd, 0xd6, 0x11, 0x7e, 0x28, 0xd0, 0x37, 0xd0, 0xf7, 0x97, 0x56, 0x62, 0x5f, 0x5b, 0x97,
+	0x2c, 0xb3, 0x12, 0xf6, 0x59, 0xb6, 0xde, 0x68, 0x57, 0xbd, 0x91, 0x93, 0xa5, 0x69, 0x5f, 0xbf,
+	0x63, 0xea, 0x19, 0x98, 0x1d, 0xbf, 0x50, 0x68, 0xf0, 0x78, 0x21, 0xe0, 0x8d, 0xfb, 0xe0, 0xa7,
+	0x8b, 0x0a, 0x5c, 0x28, 0xe8, 0x31, 0x6c, 0x48, 0xb8, 0xcb, 0x02, 0x96, 0x31, 0x64, 0x68, 0x22,
+	0xc3, 0x93, 0x32, 0xc3, 0x11, 0xda, 0x15, 0x49, 0xdf, 0x2f, 0xe9, 0xe8, 0x0c, 0xa8, 0xe4, 0x61,
+	0x37, 0xcc, 0x59, 0x48, 0xa2, 0x16, 0x12, 0xfd, 0xbf, 0x4c, 0xf4, 0x56, 0x38, 0x28, 0xa6, 0x81,
+	0x5f, 0x56, 0xd2, 0xd7, 0x00, 0x29, 0x0b, 0x98, 0x23, 0x6e, 0x63, 0x20, 0xc5, 0x56, 0x4e, 0x71,
+	0x86, 0x26, 0x05, 0x6e, 0xa7, 0x4a, 0xe4, 0x30, 0x2f, 0x4c, 0x59, 0x22, 0x60, 0xed, 0x0a, 0x6c,
+	0x86, 0xa6, 0x1c, 0xe6, 0x29, 0x91, 0xc3, 0xb4, 0x9b, 0x43, 0x05, 0x56, 0xbe, 0x74, 0xdb, 0xcd,
+	0xef, 0xfb, 0x16, 0xc8, 0x85, 0x9d, 0x39, 0x57, 0x96, 0x16, 0xb3, 0x53, 0x29, 0xdb, 0x01, 0x77,
+	0x28, 0x07, 0xee, 0x5f, 0x94, 0x74, 0xf4, 0x15, 0x80, 0xbf, 0xb4, 0x52, 0xf9, 0xe1, 0xbb, 0x48,
+	0xf0, 0x50, 0x2b, 0xd7, 0x59, 0xf1, 0xd5, 0x0d, 0x5f, 0x4a, 0x12, 0xa4, 0xba, 0xa5, 0xb7, 0x02,
+	0x7a, 0x57, 0x02, 0xc9, 0x3e, 0x39, 0x04, 0xe2, 0x2f, 0x2d, 0x91, 0xb3, 0x8a, 0xd7, 0x47, 0xe8,
+	0x63, 0x0d, 0x8a, 0x29, 0x6b, 0x41, 0x7b, 0xbe, 0xae, 0x2a, 0x91, 0xa8, 0xf8, 0x83, 0xfb, 0x49,
+	0xde, 0xad, 0x92, 0xc8, 0x4c, 0xbe, 0x85, 0x0e, 0xbf, 0xb3, 0x63, 0x87, 0x88, 0x27, 0x95, 0x92,
+	0x9f, 0x2c, 0xcf, 0x1c, 0x3b, 0xcc, 0x4b, 0xee, 0x2b, 0x91, 0x7e, 0x0f, 0x3d, 0x7f, 0xa9, 0xb7,
+	0xe9, 0xc6, 0x4a, 0xa3, 0x97, 0x3f, 0x57, 0xc7, 0x2f, 0x14, 0xf4, 0x58, 0x4b, 0xdd, 0x65, 0x01,
+	0x12, 0x50, 0x24, 0xf8, 0xaa, 0x9a, 0x7a, 0x99, 0x45, 0x65, 0x7f, 0xc4, 0x82, 0x82, 0x47, 0x0c,
+	0x53, 0xc5, 0xb3, 0xb9, 0xc2, 0x83, 0x8f, 0x7d, 0x85, 0x47, 0x69, 0x8b, 0x2a, 0x78, 0xa1, 0x93,
+	0x20, 0xc5, 0xc3, 0x95, 0x2a, 0xcc, 0x42, 0x27, 0xd1, 0xaa, 0x20, 0x45, 0x59, 0x05, 0x3b, 0x8e,
+	0x59, 0xe8, 0x22, 0x72, 0x6b, 0xa5, 0x0a, 0xfb, 0x68, 0xd4, 0xaa, 0x90, 0x2b, 0xe8, 0x8f, 0x30,
+	0xb0, 0xdd, 0xb9, 0x17, 0x5a, 0x62, 0x5f, 0x72, 0xfc, 0xb6, 0xc4, 0x6b, 0xa3, 0x4d, 0x5f, 0xba,
+	0x66, 0x0f, 0x01, 0x4a, 0x55, 0x30, 0xcc, 0xf9, 0xde, 0x41, 0x86, 0xa7, 0xab, 0x0c, 0xfa, 0x2a,
+	0x94, 0x0c, 0x4a, 0x45, 0xcf, 0xe1, 0x91, 0x60, 0x10, 0xdb, 0xdb, 0x72, 0x70, 0x9b, 0x20, 0xd3,
+	0x18, 0x99, 0x9e, 0xea, 0x4c, 0xf7, 0x6c, 0x33, 0x73, 0x88, 0xf8, 0x8a, 0x85, 0xbe, 0x04, 0x83,
+	0x2f, 0x14, 0x24, 0x9a, 0x22, 0xd1, 0x30, 0x2f, 0x8a, 0xd8, 0x4f, 0x02, 0xdd, 0x0a, 0x84, 0x40,
+	0x0f, 0x60, 0x80, 0x80, 0x45, 0xec, 0xda, 0xb2, 0xa5, 0x9e, 0x55, 0x9a, 0x99, 0xe3, 0x3e, 0xa2,
+	0x39, 0xbf, 0x4c, 0xa0, 0xab, 0xf8, 0xf8, 0x58, 0x84, 0x79, 0xd8, 0x9d, 0xca, 0x57, 0xfc, 0x18,
+	0x06, 0x5a, 0xe0, 0xf6, 0x42, 0x89, 0x7c, 0x7c, 0x48, 0xd8, 0xa7, 0x28, 0x71, 0x44, 0xec, 0xe7,
+	0x95, 0xf1, 0x21, 0xc0, 0xc7, 0xdc, 0x9e, 0x8f, 0x8f, 0x45, 0x49, 0x47, 0x7f, 0x80, 0x9e, 0x8c,
+	0x6d, 0xc7, 0xc8, 0xf1, 0x42, 0x72, 0xe8, 0x05, 0x2c, 0xaf, 0x66, 0xb3, 0x13, 0x14, 0x0a, 0xfe,
+	0xcb, 0x89, 0xdd, 0xc4, 0x5e, 0xc2, 0x2c, 0x3b, 0x1b, 0xed, 0xe1, 0xc6, 0x34, 0x84, 0x62, 0x3f,
+	0x9b, 0x38, 0x60, 0x9c, 0x32, 0x96, 0x7c, 0xb0, 0x53, 0x7f, 0x65, 0xb9, 0xd5, 0xfe, 0xdb, 0x72,
+	0x1b, 0x43, 0x3d, 0x66, 0x2c, 0x91, 0xbf, 0x2d, 0xba, 0xca, 0x9d, 0xd3, 0x9a, 0x68, 0x99, 0x7c,
+	0x07, 0xfd, 0xb3, 0xd0, 0x8e, 0xd3, 0xab, 0x28, 0x3b, 0x39, 0x3f, 0xb5, 0xbd, 0xe4, 0x9e, 0xdf,
+	0x00, 0x43, 0x68, 0x2c, 0xed, 0x60, 0xc1, 0xe4, 0x6f, 0x3b, 0x21, 0x4c, 0x6e, 0x60, 0xa0, 0x90,
+	0x87, 0x51, 0x98, 0xb1, 0x9b, 0x8c, 0x7e, 0x0d, 0x75, 0x1e, 0x41, 0x66, 0x57, 0xf9, 0xcd, 0x84,
+	0x26, 0x7a, 0x00, 0x5d, 0x84, 0xf3, 0xc2, 0xcf, 0xed, 0x4c, 0x6e, 0xf6, 0x52, 0xcb, 0x29, 0xd6,
+	0x73, 0xee, 0x77, 0x8c, 0x6e, 0x66, 0x67, 0x59, 0x08, 0x3b, 0xbf, 0xaf, 0x43, 0x4b, 0xae, 0x7f,
+	0xda, 0x81, 0xd6, 0x2c, 0x5c, 0xda, 0x81, 0xe7, 0x92, 0x07, 0x14, 0xa0, 0x29, 0x36, 0x33, 0xa9,
+	0xc9, 0xf3, 0xe9, 0x22, 0x23, 0x6b, 0xb4, 0x07, 0xed, 0x7c, 0x5b, 0x92, 0x75, 0xda, 0x07, 0x28,
+	0x56, 0x1e, 0xa9, 0x73, 0x57, 0xb1, 0xd6, 0x48, 0x8b, 0x9f, 0xc5, 0x7a, 0x20, 0x06, 0x3f, 0x4b,
+	0x4c, 0x9b, 0x9f, 0x45, 0xd7, 0x11, 0xe0, 0x31, 0x4d, 0x16, 0x07, 0xb6, 0xc3, 0x48, 0x87, 0x0e,
+	0xa0, 0xa3, 0x2d, 0x1a, 0xd2, 0xa5, 0x6d, 0x68, 0xe0, 0xe2, 0x20, 0x3d, 0x71, 0xe4, 0xe9, 0xf4,
+	0x79, 0xcc, 0x62, 0xbc, 0x93, 0x81, 0x26, 0x73, 0x3b, 0xe1, 0xfc, 0x62, 0xf2, 0x92, 0x0d, 0xda,
+	0x05, 0x43, 0xcd, 0x52, 0x42, 0x35, 0xcf, 0x23, 0x16, 0x90, 0x4d, 0x21, 0xab, 0x51, 0x46, 0x86,
+	0x02, 0xc9, 0xc7, 0x13, 0xd9, 0x12, 0x48, 0x31, 0x6e, 0xc8, 0x23, 0xee, 0xb9, 0x9f, 0x0f, 0x0f,
+	0xb2, 0x9d, 0xcb, 0x38, 0x0a, 0xc8, 0x53, 0xfa, 0x10, 0x36, 0xf6, 0xab, 0x2f, 0x99, 0x8c, 0xa9,
+	0x01, 0x75, 0xde, 0xb4, 0x64, 0xca, 0x01, 0xc5, 0x0b, 0x24, 0xcf, 0xb0, 0x08, 0xf8, 0x02, 0xc8,
+	0x0e, 0xbf, 0xb7, 0xf6, 0x42, 0xc8, 0x73, 0x1e, 0x5b, 0xf5, 0x3a, 0x79, 0xb1, 0x73, 0x0c, 0x9b,
+	0xf7, 0x7c, 0x47, 0x8e, 0x3a, 0x3b, 0x3f, 0xb6, 0x3e, 0x86, 0x7e, 0x18, 0x5d, 0x87, 0xe4, 0x01,
+	0xaf, 0x25, 0x57, 0x98, 0xf6, 0x35, 0xa9, 0xd1, 0x0d, 0xe8, 0x71, 0xe1, 0x43, 0x16, 0xfc, 0x84,
+	0x29, 0x91, 0xb5, 0x03, 0xf2, 0xe7, 0xdd, 0x76, 0xed, 0xaf, 0xbb, 0xed, 0xda, 0xdf, 0x77, 0xdb,
+	0xb5, 0x5f, 0xff, 0xd9, 0x7e, 0x70, 0xd1, 0xc4, 0x7f, 0x27, 0xaf, 0xfe, 0x0d, 0x00, 0x00, 0xff,
+	0xff, 0x9c, 0x51, 0x13, 0x3c, 0xf0, 0x0c, 0x00, 0x00,
 }
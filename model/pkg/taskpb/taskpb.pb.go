@@ -73,8 +73,9 @@ func (x TaskType) String() string {
 }
 func (TaskType) EnumDescriptor() ([]byte, []int) { return fileDescriptorTaskpb, []int{0} }
 
-// TODO range merge
+// 合并右侧相邻的range，两者的leader须在同一节点
 type TaskRangeMerge struct {
+	SourceId uint64 `protobuf:"varint,1,opt,name=source_id,json=sourceId,proto3" json:"source_id,omitempty"`
 }
 
 func (m *TaskRangeMerge) Reset()                    { *m = TaskRangeMerge{} }
@@ -82,6 +83,13 @@ func (m *TaskRangeMerge) String() string            { return proto.CompactTextSt
 func (*TaskRangeMerge) ProtoMessage()               {}
 func (*TaskRangeMerge) Descriptor() ([]byte, []int) { return fileDescriptorTaskpb, []int{0} }
 
+func (m *TaskRangeMerge) GetSourceId() uint64 {
+	if m != nil {
+		return m.SourceId
+	}
+	return 0
+}
+
 type TaskRangeDelete struct {
 	RangeId uint64 `protobuf:"varint,1,opt,name=range_id,json=rangeId,proto3" json:"range_id,omitempty"`
 }
@@ -226,6 +234,11 @@ func (m *TaskRangeMerge) MarshalTo(dAtA []byte) (int, error) {
 	_ = i
 	var l int
 	_ = l
+	if m.SourceId != 0 {
+		dAtA[i] = 0x8
+		i++
+		i = encodeVarintTaskpb(dAtA, i, uint64(m.SourceId))
+	}
 	return i, nil
 }
 
@@ -421,6 +434,9 @@ func encodeVarintTaskpb(dAtA []byte, offset int, v uint64) int {
 func (m *TaskRangeMerge) Size() (n int) {
 	var l int
 	_ = l
+	if m.SourceId != 0 {
+		n += 1 + sovTaskpb(uint64(m.SourceId))
+	}
 	return n
 }
 
@@ -534,6 +550,25 @@ func (m *TaskRangeMerge) Unmarshal(dAtA []byte) error {
 			return fmt.Errorf("proto: TaskRangeMerge: illegal tag %d (wire type %d)", fieldNum, wire)
 		}
 		switch fieldNum {
+		case 1:
+			if wireType != 0 {
+				return fmt.Errorf("proto: wrong wireType = %d for field SourceId", wireType)
+			}
+			m.SourceId = 0
+			for shift := uint(0); ; shift += 7 {
+				if shift >= 64 {
+					return ErrIntOverflowTaskpb
+				}
+				if iNdEx >= l {
+					return io.ErrUnexpectedEOF
+				}
+				b := dAtA[iNdEx]
+				iNdEx++
+				m.SourceId |= (uint64(b) & 0x7F) << shift
+				if b < 0x80 {
+					break
+				}
+			}
 		default:
 			iNdEx = preIndex
 			skippy, err := skipTaskpb(dAtA[iNdEx:])
@@ -1215,31 +1250,32 @@ var (
 func init() { proto.RegisterFile("taskpb.proto", fileDescriptorTaskpb) }
 
 var fileDescriptorTaskpb = []byte{
-	// 409 bytes of a gzipped FileDescriptorProto
-	0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0x8c, 0x92, 0x41, 0x6b, 0x1a, 0x41,
-	0x14, 0xc7, 0x5d, 0x5d, 0xad, 0x3e, 0xb7, 0xeb, 0x30, 0xb6, 0x75, 0xeb, 0x61, 0x2b, 0x4b, 0x0f,
-	0xa5, 0x2d, 0x16, 0x6c, 0xa1, 0xd0, 0x43, 0xa1, 0xc5, 0x04, 0x02, 0x09, 0x84, 0x89, 0xf7, 0x65,
-	0x65, 0x5e, 0x96, 0xe0, 0xea, 0x0e, 0xe3, 0x42, 0xf4, 0x9b, 0xe4, 0x23, 0xe5, 0x98, 0x8f, 0x10,
-	0xcc, 0x77, 0xc8, 0x39, 0xec, 0xcc, 0xb8, 0x2a, 0x2a, 0xe4, 0x36, 0xf3, 0xde, 0xfc, 0xfe, 0x3b,
-	0xf3, 0x7b, 0x0b, 0x4e, 0x16, 0xcd, 0x27, 0x62, 0xdc, 0x17, 0x32, 0xcd, 0x52, 0x5a, 0xd3, 0xbb,
-	0xae, 0x33, 0xc5, 0x2c, 0x5a, 0x57, 0xbb, 0xef, 0xe2, 0x34, 0x4e, 0xd5, 0xf2, 0x47, 0xbe, 0xd2,
-	0xd5, 0x80, 0x80, 0x3b, 0x8a, 0xe6, 0x13, 0x16, 0xcd, 0x62, 0xbc, 0x40, 0x19, 0x63, 0xf0, 0x1d,
-	0x5a, 0x45, 0x65, 0x88, 0x09, 0x66, 0x48, 0x3f, 0x42, 0x5d, 0xe6, 0xdb, 0xf0, 0x86, 0x7b, 0x56,
-	0xcf, 0xfa, 0x62, 0xb3, 0x37, 0x6a, 0x7f, 0xc6, 0x83, 0x53, 0xe8, 0x14, 0xa7, 0xcf, 0x31, 0xe2,
-	0x28, 0x47, 0x32, 0x9a, 0xcd, 0xaf, 0x51, 0xd2, 0x6f, 0x00, 0xb8, 0x10, 0x61, 0xa2, 0xaa, 0x8a,
-	0x6b, 0x0e, 0x9c, 0xbe, 0xb9, 0xd3, 0x25, 0xa2, 0x64, 0x0d, 0x5c, 0x08, 0x0d, 0x05, 0xbf, 0x80,
-	0x14, 0x39, 0xff, 0x38, 0xcf, 0xdb, 0xb4, 0x07, 0xb6, 0xc0, 0x23, 0xa8, 0xea, 0xec, 0x50, 0x43,
-	0x4c, 0x5e, 0x49, 0x3d, 0x97, 0xc1, 0xce, 0x31, 0xfa, 0x19, 0xec, 0x6c, 0x29, 0x50, 0x1d, 0x75,
-	0x07, 0xa4, 0x6f, 0x2c, 0xe6, 0xbd, 0xd1, 0x52, 0x20, 0x53, 0x5d, 0xfa, 0x1b, 0x9a, 0xfa, 0xf5,
-	0xd3, 0xdc, 0x8f, 0x57, 0x56, 0xb9, 0x1f, 0xb6, 0x0f, 0x6f, 0xec, 0x31, 0x90, 0xc5, 0x9a, 0xfe,
-	0x01, 0x47, 0x83, 0x5c, 0x69, 0xf4, 0x2a, 0x8a, 0xec, 0xec, 0x91, 0xda, 0x32, 0xd3, 0x5f, 0x31,
-	0xca, 0xaf, 0xe0, 0xbd, 0x66, 0xb5, 0xbe, 0x30, 0x33, 0x56, 0x3d, 0x5b, 0x85, 0x7c, 0xda, 0x0b,
-	0xd9, 0x95, 0xcf, 0xda, 0xf2, 0xc0, 0x44, 0xfe, 0x82, 0xab, 0x43, 0x23, 0xce, 0x43, 0x25, 0xa9,
-	0xaa, 0xd2, 0xbc, 0xbd, 0x34, 0x33, 0x02, 0xa6, 0x1f, 0xb0, 0x1e, 0x48, 0xc1, 0x73, 0x4c, 0x34,
-	0x5f, 0x3b, 0xc2, 0x9b, 0x61, 0x18, 0xde, 0xec, 0xbe, 0xde, 0x42, 0x7d, 0xed, 0x96, 0xbe, 0x85,
-	0xc6, 0xc9, 0x54, 0x64, 0xcb, 0xbc, 0x40, 0x4a, 0xd4, 0x05, 0xd8, 0x58, 0x24, 0x16, 0x6d, 0x41,
-	0x73, 0xcb, 0x0d, 0x29, 0xd3, 0x0e, 0xb4, 0x0f, 0xbc, 0x93, 0x54, 0x28, 0x01, 0x67, 0xfb, 0xca,
-	0xc4, 0x2e, 0x2a, 0xe6, 0xb3, 0xa4, 0xfa, 0x9f, 0xdc, 0xaf, 0x7c, 0xeb, 0x61, 0xe5, 0x5b, 0x8f,
-	0x2b, 0xdf, 0xba, 0x7b, 0xf2, 0x4b, 0xe3, 0x9a, 0xfa, 0xfd, 0x7f, 0xbe, 0x04, 0x00, 0x00, 0xff,
-	0xff, 0xcc, 0xc9, 0x16, 0xe0, 0x3a, 0x03, 0x00, 0x00,
+	// 421 bytes of a gzipped FileDescriptorProto
+	0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0x8c, 0x93, 0xcd, 0xaa, 0xd3, 0x40,
+	0x14, 0x80, 0x9b, 0x36, 0xad, 0xed, 0x69, 0x4c, 0x87, 0xa9, 0xda, 0x58, 0x21, 0x96, 0xe0, 0x42,
+	0xfc, 0xa9, 0x50, 0x05, 0xc1, 0x85, 0xa0, 0x54, 0xa1, 0xa0, 0x20, 0x63, 0xf7, 0x21, 0x75, 0x8e,
+	0x41, 0x9a, 0x36, 0xc3, 0x24, 0x62, 0xfb, 0x26, 0x3e, 0x92, 0x4b, 0x1f, 0x41, 0xea, 0x3b, 0xdc,
+	0xf5, 0x25, 0x33, 0xd3, 0xa4, 0xa5, 0x2d, 0xdc, 0x5d, 0xce, 0xcf, 0x77, 0x66, 0xe6, 0x3b, 0x04,
+	0x9c, 0x3c, 0xca, 0x96, 0x62, 0x31, 0x16, 0x32, 0xcd, 0x53, 0xda, 0xd2, 0xd1, 0xd0, 0x59, 0x61,
+	0x1e, 0xed, 0xb3, 0xc3, 0x3b, 0x71, 0x1a, 0xa7, 0xea, 0xf3, 0x45, 0xf1, 0xa5, 0xb3, 0xc1, 0x73,
+	0x70, 0xe7, 0x51, 0xb6, 0x64, 0xd1, 0x3a, 0xc6, 0xcf, 0x28, 0x63, 0xa4, 0x0f, 0xa0, 0x93, 0xa5,
+	0x3f, 0xe5, 0x37, 0x0c, 0x7f, 0x70, 0xcf, 0x1a, 0x59, 0x8f, 0x6d, 0xd6, 0xd6, 0x89, 0x19, 0x0f,
+	0x9e, 0x41, 0xaf, 0x6c, 0x9f, 0x62, 0x82, 0x39, 0xd2, 0xfb, 0xd0, 0x96, 0x45, 0x58, 0xb5, 0xdf,
+	0x52, 0xf1, 0x8c, 0x07, 0x1f, 0x61, 0x50, 0x76, 0x7f, 0xc2, 0x88, 0xa3, 0x9c, 0xcb, 0x68, 0x9d,
+	0x7d, 0x47, 0x49, 0x9f, 0x02, 0xe0, 0x46, 0x84, 0x89, 0xca, 0x2a, 0xae, 0x3b, 0x71, 0xc6, 0xe6,
+	0xc2, 0x5f, 0x10, 0x25, 0xeb, 0xe0, 0x46, 0x68, 0x28, 0x78, 0x05, 0xa4, 0x9c, 0xf3, 0x8e, 0xf3,
+	0xa2, 0x4c, 0x47, 0x60, 0x0b, 0xbc, 0x80, 0xaa, 0xca, 0x11, 0x35, 0xc5, 0xe4, 0x86, 0xd4, 0x55,
+	0x1d, 0xec, 0x02, 0xa3, 0x8f, 0xc0, 0xce, 0xb7, 0x02, 0x55, 0xab, 0x3b, 0x21, 0x63, 0xa3, 0xb8,
+	0xa8, 0xcd, 0xb7, 0x02, 0x99, 0xaa, 0xd2, 0xd7, 0xd0, 0xd5, 0xaf, 0x5f, 0x15, 0xf2, 0xbc, 0xba,
+	0x9a, 0x7b, 0xef, 0xb0, 0xb9, 0x52, 0xcb, 0x40, 0x56, 0x9a, 0xdf, 0x80, 0xa3, 0x41, 0xae, 0x34,
+	0x7a, 0x0d, 0x45, 0x0e, 0x4e, 0x48, 0x6d, 0x99, 0xe9, 0x53, 0x8c, 0xf2, 0xaf, 0x70, 0x57, 0xb3,
+	0x5a, 0x5f, 0x98, 0x1b, 0xab, 0x9e, 0xad, 0x86, 0x3c, 0x3c, 0x19, 0x72, 0x2c, 0x9f, 0xf5, 0xe5,
+	0x99, 0x8d, 0xbc, 0x05, 0x57, 0x0f, 0x8d, 0x38, 0x0f, 0x95, 0xa4, 0xa6, 0x9a, 0xe6, 0x9d, 0x4c,
+	0x33, 0x2b, 0x60, 0xfa, 0x01, 0xfb, 0x85, 0x94, 0x3c, 0xc7, 0x44, 0xf3, 0xad, 0x0b, 0xbc, 0x59,
+	0x86, 0xe1, 0x4d, 0xf4, 0xe4, 0x17, 0xb4, 0xf7, 0x6e, 0xe9, 0x6d, 0xe8, 0x7c, 0x58, 0x89, 0x7c,
+	0x5b, 0x24, 0x48, 0x8d, 0xba, 0x00, 0x95, 0x45, 0x62, 0xd1, 0x1e, 0x74, 0x0f, 0xdc, 0x90, 0x3a,
+	0x1d, 0x40, 0xff, 0xcc, 0x3b, 0x49, 0x83, 0x12, 0x70, 0x0e, 0xaf, 0x4c, 0xec, 0x32, 0x63, 0x8e,
+	0x25, 0xcd, 0xf7, 0xe4, 0xcf, 0xce, 0xb7, 0xfe, 0xee, 0x7c, 0xeb, 0xdf, 0xce, 0xb7, 0x7e, 0xff,
+	0xf7, 0x6b, 0x8b, 0x96, 0xfa, 0x37, 0x5e, 0x5e, 0x07, 0x00, 0x00, 0xff, 0xff, 0xae, 0x3f, 0xb5,
+	0x25, 0x57, 0x03, 0x00, 0x00,
 }
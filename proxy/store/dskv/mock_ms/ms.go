@@ -128,6 +128,11 @@ func (c *Cluster) RangeHeartbeat(ctx context.Context, req *mspb.RangeHeartbeatRe
 	return resp, nil
 }
 
+func (c *Cluster) BatchRangeHeartbeat(ctx context.Context, req *mspb.BatchRangeHeartbeatRequest) (*mspb.BatchRangeHeartbeatResponse, error) {
+	resp := &mspb.BatchRangeHeartbeatResponse{Header: &mspb.ResponseHeader{}}
+	return resp, nil
+}
+
 func (c *Cluster) AskSplit(ctx context.Context, req *mspb.AskSplitRequest) (*mspb.AskSplitResponse, error) {
 	return nil, nil
 }